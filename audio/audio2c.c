@@ -0,0 +1,383 @@
+// Convert WAV files to 'C' arrays of audio data for the sound component.
+// Does the job of audio2c.m and audio2ci.m without MATLAB, and can also
+// compress to IMA-ADPCM (about 4:1), which sound_start() decodes as it
+// plays. Channels are mixed to mono and the audio is resampled to the
+// target rate with a windowed-sinc filter.
+//
+// Build:
+//   gcc -O2 -I. -I../components/sound -o audio2c audio2c.c ../components/sound/adpcm.c ../components/sound/bank.c -lm
+// The esp_attr.h here stands in for the one of ESP-IDF.
+// Run:
+//   ./audio2c [-r <rate>] [-f adpcm|s16|u8] [-a <amp>] [-o <dir> | -b <bank>] <file.wav>...
+//   -r: target sample rate in Hz, default 32000.
+//   -f: target format, default adpcm. s16 matches audio2ci.m and u8
+//       matches audio2c.m: raw samples with no header.
+//   -a: scale the audio to a max amplitude of 0.0 to 1.0, otherwise the
+//       amplitude is left the same.
+//   -o: output directory, default c<rate>k_<format>, e.g. c32k_adpcm.
+//   -b: write a sound bank (bank.h) instead of 'C' files.
+// For each input file, <name>.c and <name>.h are written to the output
+// directory. An ADPCM array starts with an asset header (asset.h).
+//
+// A bank holds all the input files, named after the files. Write it to
+// the flash partition of the sounds without a rebuild, e.g.:
+//   ./audio2c -b sounds.bin *.wav
+//   parttool.py write_partition --partition-name sounds --input sounds.bin
+// or place it at ltag/sounds.bin for idf.py flash to write it.
+
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h> // mkdir
+
+#include "adpcm.h"
+#include "asset.h"
+#include "bank.h"
+
+#define RATE 32000
+#define TAPS 32 // Zero crossings of the resampling filter on each side
+#define CUTOFF 0.45 // Of the lower sample rate
+#define ELEM_LINE 16 // 'C' array elements per line
+
+typedef enum {FMT_ADPCM, FMT_S16, FMT_U8} fmt_t;
+static const char *fmt_name[] = {"adpcm", "16b", "8b"};
+
+// Read a little endian value.
+static uint32_t le(const uint8_t *p, uint32_t n)
+{
+	uint32_t v = 0;
+	for (uint32_t i = 0; i < n; i++) v |= (uint32_t)p[i] << (8*i);
+	return v;
+}
+
+// Read a WAV file and mix its channels to mono in [-1, 1].
+// Returns the samples, or NULL on error, with the count and rate.
+static double *wav_read(const char *path, uint32_t *count, uint32_t *rate)
+{
+	FILE *f = fopen(path, "rb");
+	if (!f) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return NULL;
+	}
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	uint8_t *buf = malloc(size);
+	if (!buf || fread(buf, 1, size, f) != (size_t)size) {
+		fprintf(stderr, "%s: read error\n", path);
+		fclose(f);
+		free(buf);
+		return NULL;
+	}
+	fclose(f);
+
+	uint32_t tag = 0, chans = 0, bits = 0, dlen = 0;
+	const uint8_t *data = NULL;
+	if (size < 12 || memcmp(buf, "RIFF", 4) || memcmp(buf+8, "WAVE", 4)) {
+		fprintf(stderr, "%s: not a WAV file\n", path);
+		free(buf);
+		return NULL;
+	}
+	for (long pos = 12; pos + 8 <= size; ) {
+		uint32_t len = le(buf+pos+4, 4);
+		const uint8_t *c = buf+pos+8;
+		if (pos + 8 + (long)len > size) len = size - pos - 8;
+		if (!memcmp(buf+pos, "fmt ", 4) && len >= 16) {
+			tag = le(c, 2);
+			chans = le(c+2, 2);
+			*rate = le(c+4, 4);
+			bits = le(c+14, 2);
+			if (tag == 0xFFFE && len >= 26) tag = le(c+24, 2); // Extensible
+		} else if (!memcmp(buf+pos, "data", 4)) {
+			data = c;
+			dlen = len;
+		}
+		pos += 8 + len + (len & 1);
+	}
+	uint32_t bytes = bits/8;
+	if (!data || !chans || !*rate || !((tag == 1 && bytes >= 1 && bytes <= 4) ||
+		(tag == 3 && bytes == 4))) {
+		fprintf(stderr, "%s: unsupported WAV format %u, %u bits\n", path, tag, bits);
+		free(buf);
+		return NULL;
+	}
+	*count = dlen / (bytes*chans);
+	double *x = malloc(*count * sizeof(double));
+	for (uint32_t i = 0; i < *count; i++) {
+		double sum = 0.0;
+		for (uint32_t ch = 0; ch < chans; ch++) {
+			const uint8_t *p = data + (i*chans + ch)*bytes;
+			uint32_t v = le(p, bytes);
+			float fv;
+			if (tag == 3) {
+				memcpy(&fv, &v, sizeof(fv));
+				sum += fv;
+			} else if (bytes == 1) {
+				sum += ((int32_t)v - 128) / 128.0;
+			} else {
+				int32_t s = (int32_t)(v << (32 - 8*bytes)); // Sign extend
+				sum += s / 2147483648.0;
+			}
+		}
+		x[i] = sum / chans;
+	}
+	free(buf);
+	return x;
+}
+
+// Resample with a Hann-windowed sinc low-pass filter.
+// Returns the resampled audio and its count.
+static double *resample(const double *x, uint32_t n, uint32_t fs, uint32_t to, uint32_t *count)
+{
+	double ratio = (double)to/fs;
+	double fc = CUTOFF * (ratio < 1.0 ? ratio : 1.0) * 2.0; // Of the input rate, times two
+	uint32_t m = (uint32_t)ceil(n * ratio);
+	double *y = malloc((m ? m : 1) * sizeof(double));
+	double half = TAPS / fc; // Filter half width in input samples
+
+	for (uint32_t j = 0; j < m; j++) {
+		double t = j / ratio; // Position in the input
+		int64_t lo = (int64_t)ceil(t - half), hi = (int64_t)floor(t + half);
+		double sum = 0.0;
+		for (int64_t i = lo < 0 ? 0 : lo; i <= hi && i < n; i++) {
+			double d = i - t;
+			double a = M_PI * fc * d;
+			double sinc = (fabs(a) < 1e-9) ? 1.0 : sin(a) / a;
+			double w = 0.5 + 0.5 * cos(M_PI * d / half);
+			sum += x[i] * fc * sinc * w;
+		}
+		y[j] = sum;
+	}
+	*count = m;
+	return y;
+}
+
+// Write the bytes of an array in lines of hex values.
+static void write_hex(FILE *f, const uint8_t *p, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++)
+		fprintf(f, " 0x%02x,%s", p[i], (i % ELEM_LINE == ELEM_LINE-1 || i == n-1) ? "\n" : "");
+}
+
+// Write <name>.h and <name>.c.
+// Returns zero if successful.
+static int write_c(const char *dir, const char *name, fmt_t fmt, uint32_t rate,
+	const int16_t *s, uint32_t n)
+{
+	char path[1024], upper[256];
+	uint32_t i;
+
+	for (i = 0; name[i] && i < sizeof(upper)-1; i++) upper[i] = (name[i] >= 'a' && name[i] <= 'z') ? name[i] - 'a' + 'A' : name[i];
+	upper[i] = '\0';
+	const char *type = (fmt == FMT_S16) ? "int16_t" : "uint8_t";
+	uint32_t bytes = (fmt == FMT_ADPCM) ? sizeof(asset_hdr_t) + adpcm_size(n) : n;
+
+	snprintf(path, sizeof(path), "%s/%s.h", dir, name);
+	FILE *f = fopen(path, "w");
+	if (!f) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return 1;
+	}
+	fprintf(f, "\n#include <stdint.h>\n\n");
+	fprintf(f, "#define %s_BITS_PER_SAMPLE %u\n", upper, fmt == FMT_ADPCM ? 4 : fmt == FMT_S16 ? 16 : 8);
+	fprintf(f, "#define %s_SAMPLE_RATE %u\n", upper, rate);
+	fprintf(f, "#define %s_SAMPLES %u\n", upper, n);
+	if (fmt == FMT_ADPCM) {
+		fprintf(f, "#define %s_BYTES %u\n\n", upper, bytes);
+		fprintf(f, "extern const %s %s[%s_BYTES];\n", type, name, upper);
+	} else {
+		fprintf(f, "\nextern const %s %s[%s_SAMPLES];\n", type, name, upper);
+	}
+	fclose(f);
+
+	snprintf(path, sizeof(path), "%s/%s.c", dir, name);
+	if (!(f = fopen(path, "w"))) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return 1;
+	}
+	fprintf(f, "\n#include <stdint.h>\n\n");
+	fprintf(f, "const %s %s[] = {\n", type, name);
+	if (fmt == FMT_S16) {
+		for (i = 0; i < n; i++)
+			fprintf(f, " %6d,%s", s[i], (i % ELEM_LINE == ELEM_LINE-1 || i == n-1) ? "\n" : "");
+	} else if (fmt == FMT_U8) {
+		uint8_t *u = malloc(n ? n : 1);
+		for (i = 0; i < n; i++) u[i] = (s[i] >> 8) + 0x80;
+		write_hex(f, u, n);
+		free(u);
+	} else {
+		uint8_t *a = malloc(bytes);
+		asset_make(a, MIXER_ADPCM, rate, n);
+		adpcm_encode(s, n, a + sizeof(asset_hdr_t));
+		write_hex(f, a, bytes);
+		free(a);
+	}
+	fprintf(f, "};\n");
+	fclose(f);
+	return 0;
+}
+
+// Encode samples in a format, without a header.
+// Returns the data, or NULL if out of memory, with its size.
+static uint8_t *encode(fmt_t fmt, const int16_t *s, uint32_t n, uint32_t *bytes)
+{
+	*bytes = (fmt == FMT_ADPCM) ? adpcm_size(n) : (fmt == FMT_S16) ? n*sizeof(int16_t) : n;
+	uint8_t *d = malloc(*bytes ? *bytes : 1);
+	if (!d) return NULL;
+	if (fmt == FMT_ADPCM) adpcm_encode(s, n, d);
+	else if (fmt == FMT_S16) memcpy(d, s, *bytes);
+	else for (uint32_t i = 0; i < n; i++) d[i] = (s[i] >> 8) + 0x80;
+	return d;
+}
+
+// Write a bank of sounds to a file.
+// Returns zero if successful.
+static int write_bank(const char *path, const bank_src_t *src, uint16_t n)
+{
+	uint32_t size = bank_pack(NULL, 0, src, n);
+	uint8_t *b = size ? malloc(size) : NULL;
+	FILE *f;
+
+	if (!b || bank_pack(b, size, src, n) != size) {
+		fprintf(stderr, "%s: cannot pack the bank\n", path);
+		free(b);
+		return 1;
+	}
+	if (!(f = fopen(path, "wb")) || fwrite(b, 1, size, f) != size) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		if (f) fclose(f);
+		free(b);
+		return 1;
+	}
+	fclose(f);
+	free(b);
+	printf("%s: %u sounds, %u bytes\n", path, n, size);
+	return 0;
+}
+
+// Return the SNR in dB of decoded ADPCM against the samples.
+static double adpcm_snr(const int16_t *s, uint32_t n)
+{
+	uint8_t *a = malloc(adpcm_size(n) + 1);
+	int16_t *d = malloc((n ? n : 1) * sizeof(int16_t));
+	adpcm_state_t st;
+	double sig = 0.0, err = 0.0;
+
+	adpcm_encode(s, n, a);
+	adpcm_decode(&st, a, 0, d, n);
+	for (uint32_t i = 0; i < n; i++) {
+		sig += (double)s[i]*s[i];
+		err += (double)(s[i]-d[i])*(s[i]-d[i]);
+	}
+	free(a);
+	free(d);
+	return 10.0*log10((sig + 1e-9) / (err + 1e-9));
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t rate = RATE;
+	fmt_t fmt = FMT_ADPCM;
+	double amp = 0.0;
+	const char *dir = NULL, *bank = NULL;
+	bank_src_t *src = NULL;
+	uint16_t srcs = 0;
+	char dbuf[64];
+	int i, err = 0;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+		if (!strcmp(argv[i], "-r") && i+1 < argc) rate = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-a") && i+1 < argc) amp = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-o") && i+1 < argc) dir = argv[++i];
+		else if (!strcmp(argv[i], "-b") && i+1 < argc) bank = argv[++i];
+		else if (!strcmp(argv[i], "-f") && i+1 < argc) {
+			i++;
+			if (!strcmp(argv[i], "adpcm")) fmt = FMT_ADPCM;
+			else if (!strcmp(argv[i], "s16")) fmt = FMT_S16;
+			else if (!strcmp(argv[i], "u8")) fmt = FMT_U8;
+			else i = argc; // Error
+		} else break;
+	}
+	if (i >= argc || !rate || (dir && bank)) {
+		fprintf(stderr, "usage: %s [-r <rate>] [-f adpcm|s16|u8] [-a <amp>] [-o <dir> | -b <bank>] <file.wav>...\n", argv[0]);
+		return 1;
+	}
+	if (bank) {
+		if (argc - i > UINT16_MAX || !(src = calloc(argc - i, sizeof(*src)))) return 1;
+	} else {
+		if (!dir) {
+			snprintf(dbuf, sizeof(dbuf), "c%uk_%s", rate/1000, fmt_name[fmt]);
+			dir = dbuf;
+		}
+		if (mkdir(dir, 0777) && errno != EEXIST) {
+			fprintf(stderr, "%s: %s\n", dir, strerror(errno));
+			return 1;
+		}
+	}
+
+	for (; i < argc; i++) {
+		uint32_t n, m, fs = 0;
+		double *x = wav_read(argv[i], &n, &fs);
+		if (!x) {
+			err = 1;
+			continue;
+		}
+		double *y = (fs == rate) ? x : resample(x, n, fs, rate, &m);
+		if (fs == rate) m = n;
+
+		double gain = 32767.0;
+		if (amp > 0.0) { // Set the max amplitude
+			double max = 0.0;
+			for (uint32_t k = 0; k < m; k++) if (fabs(y[k]) > max) max = fabs(y[k]);
+			if (max > 0.0) gain *= amp / max;
+		}
+		int16_t *s = malloc((m ? m : 1) * sizeof(int16_t));
+		for (uint32_t k = 0; k < m; k++) {
+			double v = round(y[k] * gain);
+			s[k] = (v > 32767.0) ? 32767 : (v < -32767.0) ? -32767 : (int16_t)v;
+		}
+
+		// Name of the array from the file name
+		char name[256];
+		const char *base = strrchr(argv[i], '/');
+		base = base ? base+1 : argv[i];
+		snprintf(name, sizeof(name), "%s", base);
+		char *dot = strrchr(name, '.');
+		if (dot) *dot = '\0';
+
+		if (bank) {
+			uint32_t bytes;
+			uint8_t *d = encode(fmt, s, m, &bytes);
+			static const uint8_t mfmt[] = {MIXER_ADPCM, MIXER_S16, MIXER_U8};
+			if (!d || strlen(name) >= BANK_NAME) {
+				fprintf(stderr, "%s: %s\n", name, d ? "name too long" : "out of memory");
+				free(d);
+				err = 1;
+			} else {
+				src[srcs++] = (bank_src_t){strdup(name), mfmt[fmt], rate, m, d};
+				printf("%s: %u samples, %u bytes\n", name, m, bytes);
+			}
+		} else if (write_c(dir, name, fmt, rate, s, m)) err = 1;
+		else if (fmt == FMT_ADPCM)
+			printf("%s: %u samples, %u bytes (%.1f:1), SNR %.1f dB\n", name, m,
+				(uint32_t)(sizeof(asset_hdr_t) + adpcm_size(m)),
+				(double)m*sizeof(int16_t)/(sizeof(asset_hdr_t) + adpcm_size(m)), adpcm_snr(s, m));
+		else
+			printf("%s: %u samples\n", name, m);
+		free(s);
+		if (y != x) free(y);
+		free(x);
+	}
+	if (bank) {
+		if (err || write_bank(bank, src, srcs)) err = 1;
+		for (uint16_t k = 0; k < srcs; k++) {
+			free((void *)src[k].name);
+			free((void *)src[k].data);
+		}
+		free(src);
+	}
+	return err;
+}
@@ -0,0 +1,10 @@
+#ifndef ESP_ATTR_H_
+#define ESP_ATTR_H_
+
+// Memory placement attributes of ESP-IDF, for building audio2c on a host.
+// Code and data are placed as usual.
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif // ESP_ATTR_H_
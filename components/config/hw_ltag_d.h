@@ -54,5 +54,6 @@
 #define HW_LTAG_LED     16
 #define HW_LTAG_TX      39
 #define HW_LTAG_RX       1
+#define HW_LTAG_RX2      8 // Optional second receiver, spare pin on the same ADC unit
 
 #endif // HW_LTAG_H_
@@ -0,0 +1,114 @@
+#include "esp_attr.h" // IRAM_ATTR, DRAM_ATTR
+
+#include "adpcm.h"
+
+#define INDEX_MAX 88
+
+// Quantizer step sizes and index adjustments of IMA-ADPCM, in RAM so the
+// DMA callback can run while the flash cache is off.
+static const DRAM_ATTR int16_t step_tab[INDEX_MAX+1] = {
+	    7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+	   19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+	   50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+	  130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+	  337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+	  876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+	 2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+	 5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+static const DRAM_ATTR int8_t index_tab[16] = {
+	-1, -1, -1, -1, 2, 4, 6, 8,
+	-1, -1, -1, -1, 2, 4, 6, 8,
+};
+
+// Update the state with a 4-bit code and return the new sample.
+static inline int32_t adpcm_step(adpcm_state_t *s, uint32_t code)
+{
+	int32_t step = step_tab[s->index];
+	int32_t diff = step >> 3;
+	if (code & 4) diff += step;
+	if (code & 2) diff += step >> 1;
+	if (code & 1) diff += step >> 2;
+	int32_t pred = (code & 8) ? s->pred - diff : s->pred + diff;
+	s->pred = (pred > INT16_MAX) ? INT16_MAX : (pred < INT16_MIN) ? INT16_MIN : pred;
+	int32_t index = s->index + index_tab[code];
+	s->index = (index < 0) ? 0 : (index > INDEX_MAX) ? INDEX_MAX : index;
+	return s->pred;
+}
+
+uint32_t adpcm_size(uint32_t samples)
+{
+	uint32_t full = samples / ADPCM_SAMPLES, rest = samples % ADPCM_SAMPLES;
+	return full*ADPCM_BLOCK + (rest ? ADPCM_HDR + rest/2 : 0);
+}
+
+uint32_t adpcm_encode(const int16_t *in, uint32_t n, uint8_t *out)
+{
+	adpcm_state_t s = {0, 0};
+	uint8_t *p = out;
+
+	for (uint32_t i = 0; i < n; i++) {
+		uint32_t k = i % ADPCM_SAMPLES;
+		if (k == 0) { // Block header, the first sample as is
+			s.pred = in[i];
+			*p++ = s.pred & 0xFF;
+			*p++ = (s.pred >> 8) & 0xFF;
+			*p++ = s.index;
+			*p++ = 0;
+			continue;
+		}
+		// Pick the code the decoder turns into the closest sample
+		int32_t diff = in[i] - s.pred;
+		int32_t step = step_tab[s.index];
+		uint32_t code = 0;
+		if (diff < 0) {code = 8; diff = -diff;}
+		if (diff >= step) {code |= 4; diff -= step;}
+		step >>= 1;
+		if (diff >= step) {code |= 2; diff -= step;}
+		step >>= 1;
+		if (diff >= step) code |= 1;
+		adpcm_step(&s, code);
+		if (k & 1) *p = code; // Low nibble first
+		else *p++ |= code << 4;
+	}
+	uint32_t rest = n % ADPCM_SAMPLES;
+	if (rest && !(rest & 1)) p++; // Last byte with a low nibble only
+	return p - out;
+}
+
+void IRAM_ATTR adpcm_decode(adpcm_state_t *s, const uint8_t *data, uint32_t idx, int16_t *out, uint32_t n)
+{
+	uint32_t k = idx % ADPCM_SAMPLES;
+	const uint8_t *b = data + (idx / ADPCM_SAMPLES)*ADPCM_BLOCK;
+
+	while (n) {
+		if (k == 0) { // Block header
+			s->pred = (int16_t)(b[0] | (b[1] << 8));
+			s->index = (b[2] > INDEX_MAX) ? INDEX_MAX : b[2];
+			*out++ = s->pred;
+			n--;
+			k = 1;
+			continue;
+		}
+		uint32_t run = ADPCM_SAMPLES - k;
+		if (run > n) run = n;
+		const uint8_t *p = b + ADPCM_HDR + (k-1)/2;
+		uint32_t i = 0;
+		if (!(k & 1)) { // Starts on a high nibble
+			*out++ = adpcm_step(s, *p++ >> 4);
+			i++;
+		}
+		for (; i+1 < run; i += 2, p++) {
+			*out++ = adpcm_step(s, *p & 0xF);
+			*out++ = adpcm_step(s, *p >> 4);
+		}
+		if (i < run) *out++ = adpcm_step(s, *p & 0xF);
+		n -= run;
+		k += run;
+		if (k == ADPCM_SAMPLES) {
+			b += ADPCM_BLOCK;
+			k = 0;
+		}
+	}
+}
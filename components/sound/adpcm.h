@@ -0,0 +1,47 @@
+#ifndef ADPCM_H_
+#define ADPCM_H_
+
+#include <stdint.h>
+
+// IMA-ADPCM codec for sound assets, 4 bits per sample. The stream is a
+// series of blocks of ADPCM_BLOCK bytes, laid out like the mono IMA-ADPCM
+// blocks of a WAV file: a 4-byte header with the first sample (16-bit
+// little endian) and the step index, followed by two samples per byte,
+// low nibble first. Each block can be decoded on its own, so a sound can
+// loop and a decoding error does not last past the block. The last block
+// is cut short after its last sample.
+//
+// The decoder is cheap enough for the DMA callback. The encoder is used
+// by the host tool audio/audio2c.c and by the tests.
+
+#define ADPCM_BLOCK 256 // Bytes in a block
+#define ADPCM_HDR 4 // Bytes of the block header
+#define ADPCM_SAMPLES (1 + (ADPCM_BLOCK-ADPCM_HDR)*2) // Samples in a block
+
+// Decoder state, kept between calls to decode a sound in pieces
+typedef struct {
+	int32_t pred; // Last sample
+	int32_t index; // Step index
+} adpcm_state_t;
+
+// Return the size in bytes of the ADPCM stream of a number of samples.
+uint32_t adpcm_size(uint32_t samples);
+
+// Encode samples.
+// in: signed 16-bit samples.
+// n: number of samples.
+// out: ADPCM stream of adpcm_size(n) bytes.
+// Returns the size of the stream in bytes.
+uint32_t adpcm_encode(const int16_t *in, uint32_t n, uint8_t *out);
+
+// Decode samples. A sound is decoded in order, in pieces of any size: the
+// state carries on from the last sample of the previous piece, unless the
+// piece starts a block.
+// s: decoder state.
+// data: ADPCM stream.
+// idx: index of the first sample to decode.
+// out: decoded samples.
+// n: number of samples to decode.
+void adpcm_decode(adpcm_state_t *s, const uint8_t *data, uint32_t idx, int16_t *out, uint32_t n);
+
+#endif // ADPCM_H_
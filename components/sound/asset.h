@@ -0,0 +1,70 @@
+#ifndef ASSET_H_
+#define ASSET_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h> // memcpy
+
+#include "adpcm.h"
+#include "mixer.h" // mixer_fmt_t
+#include "synth.h"
+
+// Header of a sound asset. An asset made by audio/audio2c.c starts with
+// this header, followed by the samples in the format given. The sound
+// functions look for the header and play the rest of the data in its
+// format. Audio without the header is taken as raw samples in the native
+// format of the driver. All fields are little endian.
+
+#define ASSET_MAGIC 0x444E534CU // "LSND"
+
+typedef struct {
+	uint32_t magic; // ASSET_MAGIC
+	uint8_t fmt; // mixer_fmt_t
+	uint8_t reserved[3];
+	uint32_t rate; // Sample rate in Hz
+	uint32_t samples; // Number of samples
+} asset_hdr_t;
+
+// Synthesizer patch as an asset, played by sound_start() like samples.
+// Define one with ASSET_SYNTH_HDR and a patch, e.g.
+//   const synth_asset_t beep = {ASSET_SYNTH_HDR, {.wave = SYNTH_SQUARE, ...}};
+typedef struct {
+	asset_hdr_t hdr;
+	synth_patch_t patch;
+} synth_asset_t;
+
+#define ASSET_SYNTH_HDR {ASSET_MAGIC, MIXER_SYNTH, {0}, 0, 0}
+
+// Return the size in bytes of the samples of an asset.
+static inline uint32_t asset_data_size(mixer_fmt_t fmt, uint32_t samples)
+{
+	return (fmt == MIXER_ADPCM) ? adpcm_size(samples) :
+		(fmt == MIXER_SYNTH) ? sizeof(synth_patch_t) :
+		(fmt == MIXER_S16) ? samples*sizeof(int16_t) : samples;
+}
+
+// Write the header of an asset.
+// out: header, may be unaligned.
+// fmt: format of the samples that follow.
+// rate: sample rate in Hz.
+// samples: number of samples.
+static inline void asset_make(void *out, mixer_fmt_t fmt, uint32_t rate, uint32_t samples)
+{
+	asset_hdr_t hdr = {ASSET_MAGIC, fmt, {0}, rate, samples};
+	memcpy(out, &hdr, sizeof(hdr));
+}
+
+// Read the header of an asset.
+// audio: asset data, may be unaligned.
+// size: size of the data in bytes.
+// hdr: header read.
+// Return true if the data has a valid header and holds all the samples.
+static inline bool asset_parse(const void *audio, uint32_t size, asset_hdr_t *hdr)
+{
+	if (audio == NULL || size < sizeof(asset_hdr_t)) return false;
+	memcpy(hdr, audio, sizeof(asset_hdr_t));
+	return hdr->magic == ASSET_MAGIC && hdr->fmt <= MIXER_SYNTH &&
+		asset_data_size(hdr->fmt, hdr->samples) <= size - sizeof(asset_hdr_t);
+}
+
+#endif // ASSET_H_
@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, free
+#include <string.h>
+
+#include "asset.h"
+#include "bank.h"
+
+#define ALIGN 4 // Of each asset in the bank
+
+static inline uint32_t bank_align(uint32_t n)
+{
+	return (n + ALIGN-1) & ~(uint32_t)(ALIGN-1);
+}
+
+uint32_t bank_pack(uint8_t *out, uint32_t cap, const bank_src_t *src, uint16_t n)
+{
+	uint32_t pos = sizeof(bank_hdr_t) + n*sizeof(bank_entry_t);
+
+	if (out && bank_pack(NULL, 0, src, n) > cap) return 0;
+	for (uint16_t i = 0; i < n; i++) {
+		uint32_t bytes = asset_data_size(src[i].fmt, src[i].samples);
+		bank_entry_t e = {{0}, pos, sizeof(asset_hdr_t) + bytes,
+			src[i].rate, src[i].samples, src[i].fmt, {0}};
+
+		if (strlen(src[i].name) >= BANK_NAME) return 0;
+		if (out) {
+			strcpy(e.name, src[i].name);
+			memcpy(out + sizeof(bank_hdr_t) + i*sizeof(e), &e, sizeof(e));
+			asset_make(out + pos, src[i].fmt, src[i].rate, src[i].samples);
+			memcpy(out + pos + sizeof(asset_hdr_t), src[i].data, bytes);
+			memset(out + pos + e.size, 0, bank_align(e.size) - e.size);
+		}
+		pos += bank_align(e.size);
+	}
+	if (out) {
+		bank_hdr_t hdr = {BANK_MAGIC, BANK_VERSION, n, pos, 0};
+		memcpy(out, &hdr, sizeof(hdr));
+	}
+	return pos;
+}
+
+bool bank_open(bank_t *b, const void *data, uint32_t size)
+{
+	const uint8_t *p = data;
+	bank_hdr_t hdr;
+
+	memset(b, 0, sizeof(*b));
+	if (p == NULL || size < sizeof(hdr)) return false;
+	memcpy(&hdr, p, sizeof(hdr));
+	if (hdr.magic != BANK_MAGIC || hdr.version != BANK_VERSION || hdr.size > size ||
+		hdr.size < sizeof(hdr) + (uint32_t)hdr.count*sizeof(bank_entry_t))
+		return false;
+	for (uint16_t i = 0; i < hdr.count; i++) {
+		bank_entry_t e;
+		asset_hdr_t a;
+		memcpy(&e, p + sizeof(hdr) + i*sizeof(e), sizeof(e));
+		if (memchr(e.name, '\0', BANK_NAME) == NULL || e.offset % ALIGN ||
+			e.offset > hdr.size || e.size > hdr.size - e.offset ||
+			!asset_parse(p + e.offset, e.size, &a) || a.fmt != e.fmt ||
+			a.rate != e.rate || a.samples != e.samples ||
+			e.size != sizeof(a) + asset_data_size(a.fmt, a.samples))
+			return false;
+	}
+	b->data = p;
+	b->size = hdr.size;
+	b->count = hdr.count;
+	return true;
+}
+
+bool bank_load(bank_t *b, const char *path)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *buf = NULL;
+	long size = -1;
+
+	memset(b, 0, sizeof(*b));
+	if (f == NULL) return false;
+	if (!fseek(f, 0, SEEK_END)) size = ftell(f);
+	if (size > 0 && !fseek(f, 0, SEEK_SET) && (buf = malloc(size)) != NULL &&
+		fread(buf, 1, size, f) == (size_t)size && bank_open(b, buf, size)) {
+		b->buf = buf;
+		fclose(f);
+		return true;
+	}
+	free(buf);
+	fclose(f);
+	return false;
+}
+
+void bank_close(bank_t *b)
+{
+	free(b->buf);
+	memset(b, 0, sizeof(*b));
+}
+
+int32_t bank_find(const bank_t *b, const char *name)
+{
+	for (uint16_t i = 0; i < b->count; i++)
+		if (!strncmp(bank_entry(b, i)->name, name, BANK_NAME)) return i;
+	return BANK_NONE;
+}
+
+const bank_entry_t *bank_entry(const bank_t *b, int32_t i)
+{
+	if (i < 0 || i >= b->count) return NULL;
+	return (const bank_entry_t *)(b->data + sizeof(bank_hdr_t)) + i;
+}
+
+const void *bank_audio(const bank_t *b, int32_t i, uint32_t *size)
+{
+	const bank_entry_t *e = bank_entry(b, i);
+
+	if (e == NULL) return NULL;
+	*size = e->size;
+	return b->data + e->offset;
+}
@@ -0,0 +1,112 @@
+#ifndef BANK_H_
+#define BANK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Sound bank: a packed set of sound assets kept outside the firmware
+// image, in a flash data partition, so sounds can change without
+// rebuilding the application. The bank is a header, an index of entries,
+// then the assets. Each asset starts with its own asset header
+// (asset.h), so the pointer returned by bank_audio() goes straight to
+// sound_start() and plays from the memory mapped flash with no copy.
+// All fields are little endian, and assets start on a 4-byte boundary.
+//
+// Banks are built by audio/audio2c.c with -b, or by bank_pack(). On the
+// target, bank_map() maps a partition. On a host, bank_load() reads a
+// bank file.
+
+#define BANK_MAGIC 0x4B4E424CU // "LBNK"
+#define BANK_VERSION 1
+#define BANK_NAME 24 // Bytes of a name, including the terminating NUL
+#define BANK_NONE (-1) // Not an entry
+#define BANK_PARTITION "sounds" // Label of the flash partition
+
+// Header at the start of a bank
+typedef struct {
+	uint32_t magic; // BANK_MAGIC
+	uint16_t version; // BANK_VERSION
+	uint16_t count; // Number of entries
+	uint32_t size; // Size of the bank in bytes
+	uint32_t reserved;
+} bank_hdr_t;
+
+// Index entry of a sound, following the header
+typedef struct {
+	char name[BANK_NAME]; // Name of the sound, NUL terminated
+	uint32_t offset; // Of the asset from the start of the bank
+	uint32_t size; // Of the asset in bytes, with its header
+	uint32_t rate; // Sample rate in Hz
+	uint32_t samples; // Number of samples
+	uint8_t fmt; // mixer_fmt_t
+	uint8_t reserved[3];
+} bank_entry_t;
+
+// Sound to pack in a bank
+typedef struct {
+	const char *name;
+	uint8_t fmt; // mixer_fmt_t
+	uint32_t rate; // Sample rate in Hz
+	uint32_t samples; // Number of samples
+	const void *data; // Samples in the format, without an asset header
+} bank_src_t;
+
+// Open bank
+typedef struct {
+	const uint8_t *data; // Start of the bank
+	uint32_t size; // Size of the bank in bytes
+	uint16_t count; // Number of entries
+	void *buf; // Memory of a loaded bank, freed by bank_close()
+	uint32_t map; // Handle of a mapped partition, if mapped
+	bool mapped;
+} bank_t;
+
+// Pack sounds into a bank.
+// out: bank, or NULL to get the size only.
+// cap: size of out in bytes.
+// src: sounds.
+// n: number of sounds.
+// Returns the size of the bank in bytes, or zero if it does not fit in
+// cap or a name is too long.
+uint32_t bank_pack(uint8_t *out, uint32_t cap, const bank_src_t *src, uint16_t n);
+
+// Open a bank in memory. The index and every asset header are checked
+// against the size, so a bad or partly written bank is not played.
+// b: bank state.
+// data: bank, must stay valid while the bank is open.
+// size: size of the memory holding the bank, may be more than the bank.
+// Return true if the bank is valid.
+bool bank_open(bank_t *b, const void *data, uint32_t size);
+
+// Load a bank from a file and open it.
+// b: bank state.
+// path: file name.
+// Return true if the bank was read and is valid.
+bool bank_load(bank_t *b, const char *path);
+
+// Close a bank, freeing the memory of a loaded bank.
+void bank_close(bank_t *b);
+
+// Return the index of a sound by name, or BANK_NONE if not found.
+int32_t bank_find(const bank_t *b, const char *name);
+
+// Return the index entry of a sound, or NULL if out of range.
+const bank_entry_t *bank_entry(const bank_t *b, int32_t i);
+
+// Return the asset of a sound, to pass to sound_start(), or NULL if out
+// of range.
+// b: bank state.
+// i: index of the sound.
+// size: size of the asset in bytes.
+const void *bank_audio(const bank_t *b, int32_t i, uint32_t *size);
+
+// Map a flash partition holding a bank and open it (target only).
+// b: bank state.
+// label: partition label, such as BANK_PARTITION.
+// Return zero if successful, or non-zero otherwise.
+int32_t bank_map(bank_t *b, const char *label);
+
+// Unmap a bank mapped by bank_map() (target only).
+void bank_unmap(bank_t *b);
+
+#endif // BANK_H_
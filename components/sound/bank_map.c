@@ -0,0 +1,45 @@
+#include <string.h>
+
+#include "esp_partition.h"
+#include "esp_log.h"
+
+#include "bank.h"
+
+static const char *TAG = "bank";
+
+// NOTE: The bank is read through the flash cache. Like sounds compiled
+// into the image, a mapped sound must not play while the cache is off,
+// such as during a flash write.
+
+int32_t bank_map(bank_t *b, const char *label)
+{
+	const esp_partition_t *part;
+	const void *ptr;
+	esp_partition_mmap_handle_t map;
+
+	memset(b, 0, sizeof(*b));
+	part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+	if (part == NULL) {
+		ESP_LOGW(TAG, "no partition %s", label);
+		return -1;
+	}
+	if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &map) != ESP_OK) {
+		ESP_LOGE(TAG, "esp_partition_mmap failed");
+		return -1;
+	}
+	if (!bank_open(b, ptr, part->size)) {
+		ESP_LOGW(TAG, "no valid bank in %s", label);
+		esp_partition_munmap(map);
+		return -1;
+	}
+	b->map = map;
+	b->mapped = true;
+	ESP_LOGI(TAG, "%s: %u sounds, %lu bytes", label, b->count, b->size);
+	return 0;
+}
+
+void bank_unmap(bank_t *b)
+{
+	if (b->mapped) esp_partition_munmap(b->map);
+	memset(b, 0, sizeof(*b));
+}
@@ -0,0 +1,560 @@
+#include <math.h> // sinf, cosf, powf
+#include <string.h> // memset
+
+#include "esp_attr.h" // IRAM_ATTR
+
+#include "asset.h"
+#include "mixer.h"
+
+#define HANDLE_BITS 8 // Voice index bits in a handle
+#define GEN_MAX 0x7FFF // Keeps handles positive
+#define S16_SHIFT 15 // Q15 gain of a signed 16-bit sample
+#define U8_SHIFT 7 // Q15 gain and 8 to 16-bit scaling of an unsigned sample
+#define U8_BIAS 0x80
+#define ONE (1U << 16) // Q16 step of one source sample
+#define PHASE_SHIFT 11 // Q16 position to filter phase, 2^(16-11) = MIXER_PHASES
+#define CENTER (MIXER_TAPS/2 - 1) // Source sample at the output position
+#define LEAD (MIXER_TAPS - CENTER) // Samples taken up to the output position
+#define SRC_MAX MIXER_BLOCK // Source samples taken at a time
+#define CUTOFF 0.9f // Of the lower Nyquist rate
+#define NO_GAIN UINT32_MAX // No gain waiting for mixer_begin()
+
+// Command waiting for mixer_begin()
+enum {
+	PEND_NONE,
+	PEND_PLAY, // The staged sound replaces the voice
+	PEND_STOP,
+};
+
+// Resampling filters, built once by mixer_init(). For each band and
+// phase, the Q15 taps sum to one.
+static DRAM_ATTR int16_t fir[MIXER_BANDS][MIXER_PHASES][MIXER_TAPS];
+static const uint32_t band_step[MIXER_BANDS] = {ONE, ONE*3/2, ONE*2}; // Max step
+static bool fir_built;
+
+// Prepared silence, sent by mixer_next() while no voice plays. In DRAM,
+// as the DMA callback copies it.
+static DRAM_ATTR const int16_t silence[MIXER_SILENCE];
+
+// Q15 gain of each volume, built once by mixer_init()
+static uint16_t volume[MIXER_VOLUME_MAX+1];
+
+// Build the polyphase filters. Each is a Blackman-windowed sinc with its
+// cutoff below the output Nyquist rate for the largest step of its band.
+static void mixer_fir(void)
+{
+	for (uint32_t b = 0; b < MIXER_BANDS; b++) {
+		float fc = CUTOFF * ONE / band_step[b]; // Of the source Nyquist rate
+		for (uint32_t ph = 0; ph < MIXER_PHASES; ph++) {
+			float h[MIXER_TAPS], sum = 0.0f;
+			for (uint32_t k = 0; k < MIXER_TAPS; k++) {
+				float t = (float)k - CENTER - (float)ph/MIXER_PHASES;
+				float x = (float)M_PI * fc * t;
+				float w = 0.42f + 0.5f*cosf(2*(float)M_PI*t/MIXER_TAPS) +
+					0.08f*cosf(4*(float)M_PI*t/MIXER_TAPS);
+				h[k] = ((x == 0.0f) ? 1.0f : sinf(x)/x) * w;
+				sum += h[k];
+			}
+			int32_t total = 0, big = 0;
+			for (uint32_t k = 0; k < MIXER_TAPS; k++) {
+				fir[b][ph][k] = lrintf(h[k] * MIXER_UNITY / sum);
+				total += fir[b][ph][k];
+				if (fir[b][ph][k] > fir[b][ph][big]) big = k;
+			}
+			fir[b][ph][big] += MIXER_UNITY - total; // Unity gain at DC
+		}
+	}
+	fir_built = true;
+}
+
+// Build the volume table. Zero is silent, and each step above it is an
+// equal fraction of MIXER_VOLUME_DB.
+static void mixer_volumes(void)
+{
+	volume[0] = 0;
+	for (uint32_t i = 1; i <= MIXER_VOLUME_MAX; i++)
+		volume[i] = lrintf(MIXER_UNITY * powf(10.0f,
+			-(float)MIXER_VOLUME_DB * (MIXER_VOLUME_MAX - i) / MIXER_VOLUME_MAX / 20));
+}
+
+// Return true if a voice plays, or will once the command waiting is
+// applied. While deferring, the voices are not read, as the render may
+// be changing them.
+static inline bool mixer_on(const mixer_t *m, uint32_t i)
+{
+	if (!m->defer) return m->v[i].on;
+	return m->pend[i] == PEND_PLAY || (m->pend[i] == PEND_NONE && m->live[i]);
+}
+
+// Return the voice index of a handle, or -1 if its sound ended.
+static int32_t mixer_slot(const mixer_t *m, mixer_handle_t h)
+{
+	if (h < 0) return -1;
+	uint32_t i = h & ((1U << HANDLE_BITS) - 1);
+	if (i >= MIXER_VOICES || m->gen[i] != (h >> HANDLE_BITS) || !mixer_on(m, i)) return -1;
+	return i;
+}
+
+static inline uint32_t mixer_clamp(uint32_t gain)
+{
+	return (gain > MIXER_UNITY) ? MIXER_UNITY : gain;
+}
+
+void mixer_init(mixer_t *m)
+{
+	memset(m, 0, sizeof(*m));
+	m->master = MIXER_UNITY;
+	m->pmaster = NO_GAIN;
+	for (uint32_t i = 0; i < MIXER_VOICES; i++) m->pgain[i] = NO_GAIN;
+	m->quality = MIXER_RESAMPLE;
+	if (!fir_built) {
+		mixer_fir();
+		mixer_volumes();
+	}
+	synth_init();
+}
+
+void mixer_rate(mixer_t *m, uint32_t hz)
+{
+	m->rate = hz;
+}
+
+void mixer_quality(mixer_t *m, mixer_quality_t q)
+{
+	m->quality = q;
+}
+
+void mixer_defer(mixer_t *m, bool on)
+{
+	for (uint32_t i = 0; i < MIXER_VOICES; i++) m->live[i] = m->v[i].on;
+	m->defer = on;
+}
+
+// Start a sound on a voice, resampled from a rate to the output rate.
+static mixer_handle_t mixer_start(mixer_t *m, const void *audio, uint32_t len,
+	mixer_fmt_t fmt, bool loop, uint32_t gain, uint32_t rate)
+{
+	uint32_t i, pick = 0;
+	synth_state_t syn;
+
+	if (audio != NULL && fmt == MIXER_SYNTH) // Rendered at the output rate
+		len = synth_start(&syn, audio, m->rate ? m->rate : SYNTH_RATE);
+	if (audio == NULL || !len) return MIXER_NONE;
+	for (i = 0; i < MIXER_VOICES; i++) {
+		if (!mixer_on(m, i)) break;
+		if (m->order[i] - m->order[pick] > UINT32_MAX/2) pick = i; // Older
+	}
+	if (i < MIXER_VOICES) pick = i;
+	mixer_voice_t *v = m->defer ? &m->stage[pick] : &m->v[pick];
+	v->base = audio;
+	v->len = len;
+	v->idx = 0;
+	v->gain = mixer_clamp(gain);
+	uint32_t master = (m->pmaster != NO_GAIN) ? m->pmaster : m->master; // As of the first block
+	v->aim = (v->gain * master) >> S16_SHIFT; // No ramp at the start
+	v->amp = v->aim << MIXER_RAMP_BITS;
+	v->ramp = 0;
+	m->order[pick] = m->seq++;
+	m->gen[pick] = (m->gen[pick] >= GEN_MAX) ? 1 : m->gen[pick] + 1;
+	v->fmt = fmt;
+	v->loop = loop;
+	if (fmt == MIXER_SYNTH) v->syn = syn;
+	v->step = 0;
+	if (m->rate && rate && rate != m->rate) {
+		v->step = ((uint64_t)rate << 16) / m->rate;
+		v->frac = LEAD * ONE; // First output on the first sample
+		v->pad = 0;
+		for (v->band = 0; v->band < MIXER_BANDS-1 && v->step > band_step[v->band]; v->band++);
+		if (m->quality == MIXER_LINEAR) v->band = MIXER_BANDS; // No filter
+		memset(v->hist, 0, sizeof(v->hist));
+	}
+	v->t_start = m->now;
+	v->fresh = true;
+	v->on = true;
+	if (m->defer) {
+		m->pend[pick] = PEND_PLAY;
+		m->pgain[pick] = NO_GAIN;
+	}
+	return ((mixer_handle_t)m->gen[pick] << HANDLE_BITS) | pick;
+}
+
+mixer_handle_t mixer_play(mixer_t *m, const void *audio, uint32_t len,
+	mixer_fmt_t fmt, bool loop, uint32_t gain)
+{
+	return mixer_start(m, audio, len, fmt, loop, gain, 0);
+}
+
+mixer_handle_t mixer_play_asset(mixer_t *m, const void *audio, uint32_t size,
+	mixer_fmt_t raw, bool loop, uint32_t gain)
+{
+	asset_hdr_t hdr;
+
+	if (asset_parse(audio, size, &hdr))
+		return mixer_start(m, (const uint8_t *)audio + sizeof(hdr), hdr.samples,
+			hdr.fmt, loop, gain, hdr.rate);
+	return mixer_play(m, audio, (raw == MIXER_S16) ? size/sizeof(int16_t) : size,
+		raw, loop, gain);
+}
+
+// Stop the voice at an index, or stage the stop.
+static void mixer_halt(mixer_t *m, uint32_t i)
+{
+	if (!mixer_on(m, i)) return;
+	if (m->defer) m->pend[i] = PEND_STOP;
+	else m->v[i].on = false;
+}
+
+void mixer_stop(mixer_t *m, mixer_handle_t h)
+{
+	int32_t i = mixer_slot(m, h);
+	if (i >= 0) mixer_halt(m, i);
+}
+
+void mixer_stop_all(mixer_t *m)
+{
+	for (uint32_t i = 0; i < MIXER_VOICES; i++) mixer_halt(m, i);
+}
+
+bool mixer_busy(const mixer_t *m, mixer_handle_t h)
+{
+	return mixer_slot(m, h) >= 0;
+}
+
+void mixer_gain(mixer_t *m, mixer_handle_t h, uint32_t gain)
+{
+	int32_t i = mixer_slot(m, h);
+	if (i < 0) return;
+	if (!m->defer) m->v[i].gain = mixer_clamp(gain);
+	else if (m->pend[i] == PEND_PLAY) m->stage[i].gain = mixer_clamp(gain);
+	else m->pgain[i] = mixer_clamp(gain);
+}
+
+void mixer_master(mixer_t *m, uint32_t gain)
+{
+	if (m->defer) m->pmaster = mixer_clamp(gain);
+	else m->master = mixer_clamp(gain);
+}
+
+uint32_t mixer_volume(uint32_t vol)
+{
+	return volume[(vol > MIXER_VOLUME_MAX) ? MIXER_VOLUME_MAX : vol];
+}
+
+uint16_t IRAM_ATTR mixer_active(const mixer_t *m)
+{
+	uint16_t n = 0;
+	for (uint32_t i = 0; i < MIXER_VOICES; i++) n += mixer_on(m, i);
+	return n;
+}
+
+// Return the number of voices the render plays, not counting the
+// commands waiting.
+static inline uint16_t mixer_playing(const mixer_t *m)
+{
+	uint16_t n = 0;
+	for (uint32_t i = 0; i < MIXER_VOICES; i++) n += m->v[i].on;
+	return n;
+}
+
+// Decode or render n samples of an ADPCM sound or a patch.
+static inline void IRAM_ATTR mixer_gen(mixer_voice_t *v, int16_t *out, uint32_t n)
+{
+	if (v->fmt == MIXER_ADPCM) adpcm_decode(&v->dec, v->base, v->idx, out, n);
+	else synth_render(&v->syn, v->base, v->idx, out, n);
+}
+
+// Take n source samples of a resampled voice, as signed 16-bit. After the
+// end of a sound that does not loop, the samples are silent.
+static void IRAM_ATTR mixer_take(mixer_voice_t *v, int16_t *out, uint32_t n)
+{
+	while (n) {
+		uint32_t run = v->len - v->idx;
+		if (run > n) run = n;
+		if (!run) { // Ended
+			memset(out, 0, n*sizeof(out[0]));
+			v->pad += n;
+			break;
+		}
+		if (v->fmt == MIXER_S16) {
+			memcpy(out, (const int16_t *)v->base + v->idx, run*sizeof(out[0]));
+		} else if (v->fmt >= MIXER_ADPCM) {
+			mixer_gen(v, out, run);
+		} else {
+			const uint8_t *p = (const uint8_t *)v->base + v->idx;
+			for (uint32_t i = 0; i < run; i++) out[i] = (p[i] - U8_BIAS) << 8;
+		}
+		out += run;
+		n -= run;
+		v->idx += run;
+		if (v->idx == v->len && v->loop) v->idx = 0;
+	}
+}
+
+// Add n samples of a resampled voice to the accumulator. The source
+// samples for a run of output are taken at once, after the history of the
+// voice, so the filter reads them in place. The voice ends when its last
+// sample passes the output position.
+static void IRAM_ATTR mixer_resample(mixer_t *m, mixer_voice_t *v, int32_t *acc, uint32_t n, int32_t g)
+{
+	int16_t *buf = m->src; // MIXER_TAPS + SRC_MAX samples
+	const int16_t (*tab)[MIXER_TAPS] = (v->band < MIXER_BANDS) ? fir[v->band] : NULL;
+
+	while (n) {
+		uint32_t cnt = n;
+		if (v->frac + (uint64_t)(cnt-1)*v->step >= (uint64_t)(SRC_MAX+1) << 16)
+			cnt = ((((uint64_t)(SRC_MAX+1) << 16) - 1 - v->frac) / v->step) + 1;
+		uint32_t take = (v->frac + (cnt-1)*v->step) >> 16;
+		memcpy(buf, v->hist, sizeof(v->hist));
+		mixer_take(v, buf + MIXER_TAPS, take);
+		int32_t last = (int32_t)(LEAD + take) - (int32_t)v->pad; // Past the sound
+		uint32_t pos = v->frac, i;
+		for (i = 0; i < cnt; i++, pos += v->step) {
+			uint32_t k = pos >> 16;
+			if ((int32_t)k >= last) break;
+			const int16_t *x = buf + k;
+			int32_t y;
+			if (tab) {
+				const int16_t *h = tab[(pos & (ONE-1)) >> PHASE_SHIFT];
+				y = 0;
+				for (uint32_t j = 0; j < MIXER_TAPS; j++) y += x[j] * h[j];
+				y >>= S16_SHIFT;
+				y = (y > INT16_MAX) ? INT16_MAX : (y < INT16_MIN) ? INT16_MIN : y;
+			} else {
+				y = x[CENTER] + (((x[CENTER+1] - x[CENTER]) *
+					(int32_t)((pos & (ONE-1)) >> 1)) >> 15);
+			}
+			acc[i] += (y * g) >> S16_SHIFT;
+		}
+		if (i < cnt) {
+			v->on = false;
+			break;
+		}
+		memcpy(v->hist, buf + take, sizeof(v->hist));
+		v->frac = pos - (take << 16);
+		acc += cnt;
+		n -= cnt;
+	}
+}
+
+// Add n samples of a voice to the accumulator. The samples are taken in
+// runs up to the end of the sound, so there is no test of the end of the
+// sound per sample.
+static void IRAM_ATTR mixer_add(mixer_t *m, mixer_voice_t *v, int32_t *acc, uint32_t n, int32_t g)
+{
+	if (v->step) {
+		mixer_resample(m, v, acc, n, g);
+		return;
+	}
+	while (n) {
+		uint32_t run = v->len - v->idx;
+		if (run > n) run = n;
+		if (v->fmt == MIXER_S16) {
+			const int16_t *p = (const int16_t *)v->base + v->idx;
+			for (uint32_t i = 0; i < run; i++) acc[i] += (p[i] * g) >> S16_SHIFT;
+		} else if (v->fmt >= MIXER_ADPCM) {
+			int16_t *p = m->src;
+			if (run > MIXER_BLOCK) run = MIXER_BLOCK;
+			mixer_gen(v, p, run);
+			for (uint32_t i = 0; i < run; i++) acc[i] += (p[i] * g) >> S16_SHIFT;
+		} else {
+			const uint8_t *p = (const uint8_t *)v->base + v->idx;
+			for (uint32_t i = 0; i < run; i++) acc[i] += ((p[i] - U8_BIAS) * g) >> U8_SHIFT;
+		}
+		acc += run;
+		n -= run;
+		v->idx += run;
+		if (v->idx == v->len) {
+			if (!v->loop) {
+				v->on = false;
+				break;
+			}
+			v->idx = 0;
+		}
+	}
+}
+
+// Copy n samples of the only voice playing to the output, with its gain.
+// A gain of one is a block copy. The output after the end of the sound is
+// silent. With one voice and a gain not above one there is nothing to
+// saturate.
+static void IRAM_ATTR mixer_copy(mixer_voice_t *v, int16_t *out, uint32_t n, int32_t g)
+{
+	while (n) {
+		uint32_t run = v->len - v->idx;
+		if (run > n) run = n;
+		if (v->fmt == MIXER_S16) {
+			const int16_t *p = (const int16_t *)v->base + v->idx;
+			if (g == MIXER_UNITY) memcpy(out, p, run*sizeof(out[0]));
+			else for (uint32_t i = 0; i < run; i++) out[i] = (p[i] * g) >> S16_SHIFT;
+		} else if (v->fmt >= MIXER_ADPCM) { // Decode or render in place
+			mixer_gen(v, out, run);
+			if (g != MIXER_UNITY)
+				for (uint32_t i = 0; i < run; i++) out[i] = (out[i] * g) >> S16_SHIFT;
+		} else {
+			const uint8_t *p = (const uint8_t *)v->base + v->idx;
+			for (uint32_t i = 0; i < run; i++) out[i] = ((p[i] - U8_BIAS) * g) >> U8_SHIFT;
+		}
+		out += run;
+		n -= run;
+		v->idx += run;
+		if (v->idx == v->len) {
+			if (!v->loop) {
+				v->on = false;
+				memset(out, 0, n*sizeof(out[0]));
+				break;
+			}
+			v->idx = 0;
+		}
+	}
+}
+
+// Start a ramp of the gain of a voice if its gain or the master gain
+// changed. The step is set once for the ramp, rounded toward zero so the
+// gain does not pass the aim.
+static inline void IRAM_ATTR mixer_aim(const mixer_t *m, mixer_voice_t *v)
+{
+	uint32_t aim = (v->gain * m->master) >> S16_SHIFT;
+
+	if (aim == v->aim) return;
+	v->aim = aim;
+	v->damp = ((int32_t)(aim << MIXER_RAMP_BITS) - v->amp) / MIXER_RAMP;
+	v->ramp = MIXER_RAMP;
+}
+
+// Add n samples of a voice to the accumulator with its gain. The samples
+// of a ramp are taken at a gain of one and scaled one by one, the others
+// at the gain the ramp aimed at.
+static void IRAM_ATTR mixer_mix(mixer_t *m, mixer_voice_t *v, int32_t *acc, uint32_t n)
+{
+	if (v->ramp) {
+		int32_t *tmp = m->tmp;
+		uint32_t r = (n < v->ramp) ? n : v->ramp;
+		memset(tmp, 0, r*sizeof(tmp[0]));
+		mixer_add(m, v, tmp, r, MIXER_UNITY);
+		for (uint32_t i = 0; i < r; i++) {
+			v->amp += v->damp;
+			acc[i] += (tmp[i] * (v->amp >> MIXER_RAMP_BITS)) >> S16_SHIFT;
+		}
+		v->ramp -= r;
+		if (!v->ramp) v->amp = v->aim << MIXER_RAMP_BITS;
+		if (!v->on || r == n) return;
+		acc += r;
+		n -= r;
+	}
+	mixer_add(m, v, acc, n, v->aim);
+}
+
+uint16_t IRAM_ATTR mixer_render(mixer_t *m, int16_t *out, uint32_t n)
+{
+	int32_t *acc = m->acc;
+	uint16_t played = mixer_playing(m);
+
+	for (uint32_t i = 0; i < MIXER_VOICES; i++)
+		if (m->v[i].on) mixer_aim(m, &m->v[i]);
+	if (played == 1) {
+		mixer_voice_t *v = m->v;
+		while (!v->on) v++;
+		if (!v->step && !v->ramp) {
+			mixer_copy(v, out, n, v->aim);
+			return played;
+		}
+	}
+	while (n) {
+		uint32_t cnt = (n < MIXER_BLOCK) ? n : MIXER_BLOCK;
+		memset(acc, 0, cnt*sizeof(acc[0]));
+		for (uint32_t i = 0; i < MIXER_VOICES; i++) {
+			mixer_voice_t *v = &m->v[i];
+			if (v->on) mixer_mix(m, v, acc, cnt);
+		}
+		for (uint32_t i = 0; i < cnt; i++) { // Saturate
+			int32_t s = acc[i];
+			if (s > INT16_MAX) {s = INT16_MAX; m->clips++;}
+			else if (s < INT16_MIN) {s = INT16_MIN; m->clips++;}
+			out[i] = s;
+		}
+		out += cnt;
+		n -= cnt;
+	}
+	return played;
+}
+
+mixer_fill_t IRAM_ATTR mixer_fill(mixer_t *m, volatile uint32_t *tail, int16_t *out, uint32_t n)
+{
+	if (mixer_active(m)) {
+		mixer_render(m, out, n);
+		return MIXER_FILL_SOUND;
+	}
+	if (!*tail) return MIXER_FILL_IDLE;
+	(*tail)--;
+	memset(out, 0, n*sizeof(out[0]));
+	return MIXER_FILL_SILENCE;
+}
+
+void mixer_now(mixer_t *m, int64_t t)
+{
+	m->now = t;
+}
+
+bool IRAM_ATTR mixer_begin(mixer_t *m, int64_t t)
+{
+	for (uint32_t i = 0; i < MIXER_VOICES; i++) {
+		mixer_voice_t *v = &m->v[i];
+		if (m->pend[i] == PEND_PLAY) *v = m->stage[i];
+		else if (m->pend[i] == PEND_STOP) v->on = false;
+		m->pend[i] = PEND_NONE;
+		if (m->pgain[i] != NO_GAIN) {
+			v->gain = m->pgain[i];
+			m->pgain[i] = NO_GAIN;
+		}
+		m->live[i] = v->on;
+		if (!v->on || !v->fresh) continue;
+		int64_t lat = t - v->t_start;
+		if (lat > m->stats.lat_max) m->stats.lat_max = lat;
+		m->stats.lat_sum += lat;
+		m->stats.starts++;
+		v->fresh = false;
+	}
+	if (m->pmaster != NO_GAIN) {
+		m->master = m->pmaster;
+		m->pmaster = NO_GAIN;
+	}
+	m->stats.blocks++;
+	m->sound = mixer_playing(m) != 0;
+	if (!m->sound) m->stats.silent++;
+	return m->sound;
+}
+
+const int16_t * IRAM_ATTR mixer_block(mixer_t *m, int16_t *out, uint32_t n)
+{
+	if (m->sound) {
+		mixer_render(m, out, n);
+		return out;
+	}
+	if (n <= MIXER_SILENCE) return silence;
+	memset(out, 0, n*sizeof(out[0]));
+	return out;
+}
+
+bool IRAM_ATTR mixer_end(mixer_t *m)
+{
+	bool ended = false;
+
+	for (uint32_t i = 0; i < MIXER_VOICES; i++) {
+		if (m->live[i] && !m->v[i].on) ended = true;
+		m->live[i] = m->v[i].on;
+	}
+	return ended;
+}
+
+const int16_t * IRAM_ATTR mixer_next(mixer_t *m, int16_t *out, uint32_t n, int64_t t)
+{
+	mixer_begin(m, t);
+	const int16_t *src = mixer_block(m, out, n);
+	mixer_end(m);
+	return src;
+}
+
+void IRAM_ATTR mixer_to_u8(uint8_t *out, const int16_t *in, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) out[i] = (in[i] >> 8) + U8_BIAS;
+}
@@ -0,0 +1,277 @@
+#ifndef MIXER_H_
+#define MIXER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "adpcm.h"
+#include "synth.h"
+
+// Software audio mixer. Up to MIXER_VOICES sounds play at once, each
+// with its own position, loop flag and gain. mixer_render() sums the
+// voices into a block of signed 16-bit samples, with saturation, for the
+// sound driver to send to the DMA buffers.
+//
+// Gains are Q15 fixed point (MIXER_UNITY is a gain of one), and the
+// render loop uses only integer multiplies and shifts, so it can run in
+// the DMA callback. Its scratch buffers are in the mixer state, so the
+// render needs little stack. The mixer does no locking and no I/O: the
+// caller serializes calls that come from different contexts, and it can
+// be run on a host.
+//
+// A driver that renders in an ISR sets the mixer to defer its commands
+// (mixer_defer()). mixer_play(), mixer_stop(), and the gain changes are
+// then staged per voice, and mixer_begin() applies them at the start of
+// each block. The render (mixer_block()) runs outside the driver's lock,
+// on voices that only it changes, and mixer_end() then reports the sounds
+// that ended to the commands under the lock.
+//
+// A voice is referred to by a handle returned by mixer_play(). The handle
+// includes a generation number, so a handle kept after its sound ended
+// does not affect a later sound that reuses the voice.
+//
+// An asset with a sample rate other than the output rate (mixer_rate()) is
+// resampled as it plays, so one set of assets serves every output rate.
+// The quality is linear interpolation or a MIXER_TAPS polyphase
+// windowed-sinc filter. The filter's cutoff is below the lower of the two
+// Nyquist rates, for ratios of up to 2:1. Sounds at the output rate are
+// not filtered.
+//
+// A change of the gain of a voice or of the master gain ramps linearly
+// over MIXER_RAMP samples, so it makes no click, however the blocks fall.
+// mixer_volume() maps a volume in percent to a master gain on a log curve
+// of MIXER_VOLUME_DB, so equal steps of the volume sound equal.
+//
+// A driver with a standing DMA ring calls mixer_next() for each block and
+// sends what it returns: the rendered block, or a prepared block of
+// silence while no voice plays. A sound started between two calls is in
+// the next block, so it waits at most one block period, which the mixer
+// measures on the clock given to mixer_now() and mixer_next().
+
+#define MIXER_VOICES 4 // Voices that play at once
+#define MIXER_BLOCK 64 // Samples summed at a time by mixer_render()
+#define MIXER_UNITY 0x8000U // Gain of one in Q15
+#define MIXER_NONE (-1) // Not a voice
+#define MIXER_TAPS 16 // Taps of the polyphase resampling filter
+#define MIXER_PHASES 32 // Phases of the polyphase resampling filter
+#define MIXER_BANDS 3 // Filters for ratios up to 1, 1.5 and 2
+#define MIXER_RAMP_BITS 6
+#define MIXER_RAMP (1 << MIXER_RAMP_BITS) // Samples of a gain change
+#define MIXER_VOLUME_MAX 100 // Volume of a gain of one, see mixer_volume()
+#define MIXER_VOLUME_DB 40 // Range of the volume above zero
+#define MIXER_SILENCE 256 // Samples of the prepared silence of mixer_next()
+#ifndef MIXER_RESAMPLE
+#define MIXER_RESAMPLE MIXER_POLY // Default quality
+#endif
+
+// Voice handle, negative if no voice
+typedef int32_t mixer_handle_t;
+
+// Content of a block filled by mixer_fill()
+typedef enum {
+	MIXER_FILL_IDLE, // Nothing to send, the block is not written
+	MIXER_FILL_SOUND, // Mixed sound, padded with silence
+	MIXER_FILL_SILENCE, // Silence sent after the last sound
+} mixer_fill_t;
+
+// Sample format of a sound
+typedef enum {
+	MIXER_S16, // Signed 16-bit
+	MIXER_U8, // Unsigned 8-bit, 0x80 is silence
+	MIXER_ADPCM, // IMA-ADPCM blocks, see adpcm.h
+	MIXER_SYNTH, // Patch of the synthesizer, see synth.h
+} mixer_fmt_t;
+
+// Resampling quality
+typedef enum {
+	MIXER_LINEAR, // Linear interpolation, no anti-aliasing
+	MIXER_POLY, // Polyphase windowed-sinc filter
+} mixer_quality_t;
+
+// Voice state
+typedef struct {
+	const void *base; // Samples
+	uint32_t len; // Number of samples
+	uint32_t idx; // Next sample
+	uint32_t gain; // Q15
+	uint8_t fmt; // mixer_fmt_t
+	bool loop; // Start over at the end
+	bool on; // Playing
+	adpcm_state_t dec; // Decoder state of an ADPCM sound
+	synth_state_t syn; // Render state of a patch
+	uint32_t step; // Q16 source samples per output sample, 0 if not resampled
+	uint32_t frac; // Q16 position in the source, from the last sample taken
+	uint32_t pad; // Silent samples taken after the end of the sound
+	uint8_t band; // Resampling filter
+	int16_t hist[MIXER_TAPS]; // Last source samples taken
+	uint32_t aim; // Q15 gain of the voice and master, where the ramp ends
+	int32_t amp; // Gain applied, Q15 << MIXER_RAMP_BITS
+	int32_t damp; // Change of amp per sample
+	uint32_t ramp; // Samples left of the ramp
+	int64_t t_start; // Time started, see mixer_now()
+	bool fresh; // Started, not yet in a block of mixer_next()
+} mixer_voice_t;
+
+// Statistics of mixer_next()
+typedef struct {
+	uint32_t blocks; // Blocks filled
+	uint32_t silent; // Blocks of the prepared silence
+	uint32_t starts; // Sounds in their first block
+	int64_t lat_max; // Longest time from a start to its first block
+	int64_t lat_sum; // Of all starts
+} mixer_stats_t;
+
+// Mixer state
+typedef struct {
+	mixer_voice_t v[MIXER_VOICES];
+	uint32_t master; // Q15 gain applied to all voices
+	uint32_t seq; // Sounds started
+	uint32_t clips; // Samples saturated, for statistics
+	uint32_t rate; // Output sample rate in Hz, 0 if not resampling
+	uint8_t quality; // mixer_quality_t
+	int64_t now; // Time of the sounds started next
+	mixer_stats_t stats; // Of mixer_next()
+	bool sound; // The block begun has voices to render
+	// Scratch of the render, kept here rather than on the ISR stack
+	int32_t acc[MIXER_BLOCK]; // Sum of the voices
+	int32_t tmp[MIXER_RAMP]; // Samples of a voice in a gain ramp
+	int16_t src[MIXER_TAPS + MIXER_BLOCK]; // Source samples taken from a voice
+	// Owned by the commands, not the render
+	bool defer; // Commands wait for mixer_begin()
+	bool live[MIXER_VOICES]; // Voice playing, as of the last mixer_begin() or mixer_end()
+	uint16_t gen[MIXER_VOICES]; // Generation of each voice, part of the handle
+	uint32_t order[MIXER_VOICES]; // Of the sounds started, to pick a voice to steal
+	uint8_t pend[MIXER_VOICES]; // Command waiting for mixer_begin()
+	uint32_t pgain[MIXER_VOICES]; // Gain waiting for mixer_begin()
+	uint32_t pmaster; // Master gain waiting for mixer_begin()
+	mixer_voice_t stage[MIXER_VOICES]; // Sounds started, waiting for mixer_begin()
+} mixer_t;
+
+// Initialize the mixer with no voices playing, a master gain of one, and
+// no output rate, so assets are not resampled.
+void mixer_init(mixer_t *m);
+
+// Set the output sample rate. Assets with another rate started after this
+// are resampled.
+// m: mixer state.
+// hz: output rate in Hz, 0 to not resample.
+void mixer_rate(mixer_t *m, uint32_t hz);
+
+// Set the resampling quality of sounds started after this.
+void mixer_quality(mixer_t *m, mixer_quality_t q);
+
+// Defer the commands until the next mixer_begin(), so the render can run
+// outside the lock of the driver. The commands, mixer_begin() and
+// mixer_end() are then called under the lock, mixer_block() outside it.
+// mixer_busy() and mixer_active() count the commands waiting.
+// m: mixer state.
+// on: if true, defer, otherwise apply each command at once.
+void mixer_defer(mixer_t *m, bool on);
+
+// Start playing a sound on a free voice. If all voices are busy, the
+// voice started first is taken.
+// m: mixer state.
+// audio: samples, must stay valid while the sound plays.
+// len: number of samples, not used for a patch (MIXER_SYNTH).
+// fmt: sample format.
+// loop: if true, play until stopped, otherwise play once.
+// gain: Q15 gain of the voice.
+// Returns the voice handle, or MIXER_NONE if there is nothing to play.
+mixer_handle_t mixer_play(mixer_t *m, const void *audio, uint32_t len,
+	mixer_fmt_t fmt, bool loop, uint32_t gain);
+
+// Start playing a sound that may be an asset with a header (asset.h).
+// Audio without a header is taken as raw samples of a format, at the
+// output rate.
+// m: mixer state.
+// audio: asset or raw samples, must stay valid while the sound plays.
+// size: size of the audio in bytes.
+// raw: format of raw samples.
+// loop, gain: as for mixer_play().
+// Returns the voice handle, or MIXER_NONE if there is nothing to play.
+mixer_handle_t mixer_play_asset(mixer_t *m, const void *audio, uint32_t size,
+	mixer_fmt_t raw, bool loop, uint32_t gain);
+
+// Stop a voice. A handle of a sound that ended is ignored.
+void mixer_stop(mixer_t *m, mixer_handle_t h);
+
+// Stop all voices.
+void mixer_stop_all(mixer_t *m);
+
+// Return true if the sound of a voice handle is still playing.
+bool mixer_busy(const mixer_t *m, mixer_handle_t h);
+
+// Set the Q15 gain of a voice. The gain ramps to the new value.
+void mixer_gain(mixer_t *m, mixer_handle_t h, uint32_t gain);
+
+// Set the Q15 gain applied to all voices. The gain ramps to the new value.
+void mixer_master(mixer_t *m, uint32_t gain);
+
+// Return the Q15 gain of a volume, from a table built by mixer_init().
+// vol: 0 (silent) to MIXER_VOLUME_MAX (a gain of one), log scaled.
+uint32_t mixer_volume(uint32_t vol);
+
+// Return the number of voices playing, or started and waiting for
+// mixer_begin().
+uint16_t mixer_active(const mixer_t *m);
+
+// Sum the voices into a block of samples. Samples after the end of all
+// sounds are silent. A single voice is copied with its gain applied,
+// without the accumulator and saturation.
+// m: mixer state.
+// out: output samples.
+// n: number of samples.
+// Returns the number of voices that played in the block.
+uint16_t mixer_render(mixer_t *m, int16_t *out, uint32_t n);
+
+// Fill a DMA block. The sound drivers call this from the DMA callback and
+// to preload DMA buffers. While voices play, the block is rendered. After
+// the last sound, *tail blocks of silence follow to flush the DMA buffers.
+// m: mixer state.
+// tail: silent blocks still to send, decremented for each one.
+// out: output samples.
+// n: number of samples in the block.
+// Returns what the block holds.
+mixer_fill_t mixer_fill(mixer_t *m, volatile uint32_t *tail, int16_t *out, uint32_t n);
+
+// Set the time of the sounds started after this, on the clock of
+// mixer_next(), to measure the latency of their start.
+// m: mixer state.
+// t: time, in any unit, such as microseconds.
+void mixer_now(mixer_t *m, int64_t t);
+
+// Begin the next block of a standing DMA ring, which sends a block every
+// period whether a sound plays or not. Applies the commands waiting and
+// measures the latency of the sounds they start. Called under the lock
+// that serializes the commands, then mixer_block() outside it.
+// m: mixer state.
+// t: time of the fill, on the clock of mixer_now().
+// Returns true if voices play in the block.
+bool mixer_begin(mixer_t *m, int64_t t);
+
+// Fill the block begun by mixer_begin(). While voices play, the block is
+// rendered into out. Otherwise out is not written, and the prepared
+// silence is returned.
+// m: mixer state.
+// out: output samples.
+// n: number of samples in the block.
+// Returns the samples to send, out or n samples of silence.
+const int16_t *mixer_block(mixer_t *m, int16_t *out, uint32_t n);
+
+// End the block filled by mixer_block(): the sounds that ended in it are
+// no longer busy. Called under the lock, like mixer_begin().
+// Returns true if a sound ended in the block.
+bool mixer_end(mixer_t *m);
+
+// Get the next block of a standing DMA ring: mixer_begin(), mixer_block()
+// and mixer_end(), for a caller that holds its lock for all or has none.
+// Returns the samples to send, out or n samples of silence.
+const int16_t *mixer_next(mixer_t *m, int16_t *out, uint32_t n, int64_t t);
+
+// Convert signed 16-bit samples to unsigned 8-bit for a DAC.
+// out: unsigned samples, 0x80 is silence.
+// in: signed samples.
+// n: number of samples.
+void mixer_to_u8(uint8_t *out, const int16_t *in, uint32_t n);
+
+#endif // MIXER_H_
@@ -0,0 +1,139 @@
+#include <string.h> // memset, memmove
+
+#include "sndq.h"
+
+// Queue the result of an event.
+static void sndq_report(sndq_t *s, const sndq_entry_t *x, sndq_result_t r)
+{
+	if (s->rcnt == SNDQ_RESULTS) {
+		s->lost++;
+		return;
+	}
+	sndq_report_t *p = &s->res[(s->rhead + s->rcnt) % SNDQ_RESULTS];
+	p->done = x->e.done;
+	p->arg = x->e.arg;
+	p->id = x->id;
+	p->r = r;
+	s->rcnt++;
+}
+
+// Start an event. Reports it dropped if no voice plays it.
+// Return true if started.
+static bool sndq_start(sndq_t *s, const sndq_entry_t *x)
+{
+	int32_t v = s->ops->play(s->ops->ctx, x->e.audio, x->e.size, x->e.gain);
+
+	if (v < 0) {
+		sndq_report(s, x, SNDQ_DROPPED);
+		return false;
+	}
+	s->cur = *x;
+	s->voice = v;
+	s->playing = true;
+	return true;
+}
+
+// Stop the playing event.
+static void sndq_stop(sndq_t *s, sndq_result_t r)
+{
+	s->ops->stop(s->ops->ctx, s->voice);
+	s->playing = false;
+	sndq_report(s, &s->cur, r);
+}
+
+// Insert an event in the queue after the events of the same or higher
+// priority. When the queue is full, the last event is dropped, which is
+// the new one unless it has a higher priority.
+static void sndq_insert(sndq_t *s, const sndq_entry_t *x)
+{
+	uint16_t i = s->n;
+
+	while (i && s->q[i-1].e.prio < x->e.prio) i--;
+	if (s->n == SNDQ_LEN) {
+		if (i == SNDQ_LEN) {
+			sndq_report(s, x, SNDQ_DROPPED);
+			return;
+		}
+		sndq_report(s, &s->q[--s->n], SNDQ_DROPPED);
+	}
+	memmove(&s->q[i+1], &s->q[i], (s->n - i)*sizeof(s->q[0]));
+	s->q[i] = *x;
+	s->n++;
+}
+
+// Start queued events until one plays.
+static void sndq_next(sndq_t *s)
+{
+	while (!s->playing && s->n) {
+		sndq_entry_t x = s->q[0];
+		memmove(&s->q[0], &s->q[1], --s->n*sizeof(s->q[0]));
+		sndq_start(s, &x);
+	}
+}
+
+void sndq_init(sndq_t *s, const sndq_ops_t *ops)
+{
+	memset(s, 0, sizeof(*s));
+	s->ops = ops;
+	s->next = SNDQ_NONE+1;
+}
+
+sndq_id_t sndq_post(sndq_t *s, const sndq_event_t *e)
+{
+	sndq_entry_t x = {.e = *e, .id = s->next++};
+
+	if (s->next == SNDQ_NONE) s->next++;
+	sndq_poll(s); // The playing event may have ended
+	if (!s->playing) {
+		sndq_start(s, &x);
+		return x.id;
+	}
+	switch (e->policy) {
+	case SNDQ_INTERRUPT:
+		if (e->prio >= s->cur.e.prio) {
+			sndq_stop(s, SNDQ_PREEMPTED);
+			if (!sndq_start(s, &x)) sndq_next(s);
+		} else sndq_insert(s, &x);
+		break;
+	case SNDQ_QUEUE:
+		sndq_insert(s, &x);
+		break;
+	default:
+		sndq_report(s, &x, SNDQ_DROPPED);
+		break;
+	}
+	return x.id;
+}
+
+void sndq_poll(sndq_t *s)
+{
+	if (s->playing && !s->ops->busy(s->ops->ctx, s->voice)) {
+		s->playing = false;
+		sndq_report(s, &s->cur, SNDQ_DONE);
+	}
+	sndq_next(s);
+}
+
+void sndq_flush(sndq_t *s)
+{
+	if (s->playing) sndq_stop(s, SNDQ_FLUSHED);
+	for (uint16_t i = 0; i < s->n; i++) sndq_report(s, &s->q[i], SNDQ_FLUSHED);
+	s->n = 0;
+}
+
+bool sndq_busy(const sndq_t *s)
+{
+	return s->playing || s->n;
+}
+
+uint16_t sndq_results(sndq_t *s, sndq_report_t *out, uint16_t max)
+{
+	uint16_t n = 0;
+
+	while (n < max && s->rcnt) {
+		out[n++] = s->res[s->rhead];
+		s->rhead = (s->rhead + 1) % SNDQ_RESULTS;
+		s->rcnt--;
+	}
+	return n;
+}
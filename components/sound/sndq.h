@@ -0,0 +1,133 @@
+#ifndef SNDQ_H_
+#define SNDQ_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Sound event scheduler. Callers post sound events, each with a priority
+// and a policy, and never block. One event plays at a time; the others
+// wait in a queue ordered by priority, first in first out for equal
+// priorities. When the sound of an event ends, the next event in the
+// queue starts. The result of each event is reported once, when it is
+// done, preempted or dropped, so callers need not poll sound_busy().
+//
+// The scheduler plays sounds through the functions in an ops table, so it
+// can run over the sound driver or a mixer on a host. It does no locking:
+// the caller serializes calls that come from different contexts. Results
+// are queued and handed out by sndq_results(), so the caller can run the
+// callbacks outside its lock. On the target, sound_post() in sound.h runs
+// a scheduler in a task woken by the DMA callback (sndq_task.c); on a
+// host, in the thread that stands in for the DMA (sound_host.h).
+
+#define SNDQ_LEN 8 // Max queued events
+#define SNDQ_RESULTS (2*SNDQ_LEN+4) // Max results not handed out
+#define SNDQ_NONE 0 // Not an event
+
+// Event ID returned by sndq_post(), never SNDQ_NONE
+typedef uint32_t sndq_id_t;
+
+// What a posted event does when an event is playing
+typedef enum {
+	SNDQ_INTERRUPT, // Preempt an event of the same or lower priority, else queue
+	SNDQ_QUEUE, // Wait in the queue
+	SNDQ_DROP, // Drop if busy
+} sndq_policy_t;
+
+// Result of an event
+typedef enum {
+	SNDQ_DONE, // Played to the end
+	SNDQ_PREEMPTED, // Stopped by an event of the same or higher priority
+	SNDQ_DROPPED, // Not played: busy, queue full, or no voice
+	SNDQ_FLUSHED, // Stopped or removed by sndq_flush()
+} sndq_result_t;
+
+// Called once with the result of an event.
+typedef void (*sndq_done_t)(void *arg, sndq_id_t id, sndq_result_t r);
+
+// Sound event
+typedef struct {
+	const void *audio; // See sound.h
+	uint32_t size; // Bytes of audio
+	uint32_t gain; // Passed to ops->play
+	uint8_t prio; // Higher plays first
+	uint8_t policy; // sndq_policy_t
+	sndq_done_t done; // Or NULL
+	void *arg; // Passed to done
+} sndq_event_t;
+
+// Result handed out by sndq_results()
+typedef struct {
+	sndq_done_t done;
+	void *arg;
+	sndq_id_t id;
+	sndq_result_t r;
+} sndq_report_t;
+
+// Sound output of the scheduler. All are required. ctx is passed to each.
+typedef struct {
+	// Start a sound once. Return a voice, or a negative value if none.
+	int32_t (*play)(void *ctx, const void *audio, uint32_t size, uint32_t gain);
+	// Stop the sound of a voice.
+	void (*stop)(void *ctx, int32_t voice);
+	// Return true if the sound of a voice is still playing.
+	bool (*busy)(void *ctx, int32_t voice);
+	void *ctx;
+} sndq_ops_t;
+
+// Event in the scheduler
+typedef struct {
+	sndq_event_t e;
+	sndq_id_t id;
+} sndq_entry_t;
+
+// Scheduler state
+typedef struct {
+	const sndq_ops_t *ops;
+	sndq_entry_t cur; // Playing event, if playing
+	int32_t voice; // Of cur
+	bool playing;
+	uint16_t n; // Queued events
+	sndq_entry_t q[SNDQ_LEN]; // Highest priority first
+	sndq_report_t res[SNDQ_RESULTS]; // Ring of results
+	uint16_t rhead, rcnt;
+	sndq_id_t next; // ID of the next post
+	uint32_t lost; // Results lost because the ring was full
+} sndq_t;
+
+// Initialize a scheduler.
+// ops: sound output, must stay valid.
+void sndq_init(sndq_t *s, const sndq_ops_t *ops);
+
+// Post a sound event. Does not block. An event that cannot play is
+// dropped, and its result is queued like any other.
+// e: event, copied. The audio must stay valid until the result.
+// Returns the ID of the event.
+sndq_id_t sndq_post(sndq_t *s, const sndq_event_t *e);
+
+// Check whether the playing event ended, and if so start the next one.
+// Call when a sound ends, or periodically.
+void sndq_poll(sndq_t *s);
+
+// Stop the playing event and remove the queued ones.
+void sndq_flush(sndq_t *s);
+
+// Return true if an event is playing or queued.
+bool sndq_busy(const sndq_t *s);
+
+// Hand out the results of events, oldest first.
+// out: set to the results.
+// max: max results.
+// Returns the number of results.
+uint16_t sndq_results(sndq_t *s, sndq_report_t *out, uint16_t max);
+
+// Start the scheduler task of sound_post(). Called by sound_init().
+// Return zero if successful, or non-zero otherwise.
+int32_t sndq_task_init(void);
+
+// Wake the scheduler task after a sound ended. Called by the sound
+// driver; sndq_wake_isr() from the DMA callback, where it returns true if
+// a higher priority task was woken.
+void sndq_wake(void);
+bool sndq_wake_isr(void);
+
+#endif // SNDQ_H_
@@ -0,0 +1,114 @@
+// Scheduler task of sound_post(). The sound driver wakes the task from
+// the DMA callback when a sound ends, and the task starts the next event
+// and runs the callbacks of the results. Callbacks run in the task, not
+// in the caller of sound_post() nor the DMA callback, so they may post.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_attr.h" // IRAM_ATTR
+#include "esp_log.h"
+
+#include "sndq.h"
+#include "sound.h"
+
+#define SNDQ_TASK_STACK 3072
+#define SNDQ_TASK_PRIO 6
+#define SNDQ_POLL 100 // ms between runs when no sound ends
+
+static const char *TAG = "sndq";
+
+static sndq_t sched;
+static SemaphoreHandle_t lock;
+static TaskHandle_t task;
+
+static int32_t sndq_play(void *ctx, const void *audio, uint32_t size, uint32_t gain)
+{
+	return sound_play(audio, size, false, gain);
+}
+
+static void sndq_stop(void *ctx, int32_t voice)
+{
+	sound_voice_stop(voice);
+}
+
+static bool sndq_voice_busy(void *ctx, int32_t voice)
+{
+	return sound_voice_busy(voice);
+}
+
+static const sndq_ops_t ops = {
+	.play = sndq_play,
+	.stop = sndq_stop,
+	.busy = sndq_voice_busy,
+};
+
+// Start the next event if the playing one ended, then run the callbacks.
+static void sndq_run(void *arg)
+{
+	sndq_report_t res[SNDQ_RESULTS];
+
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SNDQ_POLL));
+		xSemaphoreTake(lock, portMAX_DELAY);
+		sndq_poll(&sched);
+		uint16_t n = sndq_results(&sched, res, SNDQ_RESULTS);
+		xSemaphoreGive(lock);
+		for (uint16_t i = 0; i < n; i++)
+			if (res[i].done) res[i].done(res[i].arg, res[i].id, res[i].r);
+	}
+}
+
+int32_t sndq_task_init(void)
+{
+	if (task != NULL) return 0;
+	sndq_init(&sched, &ops);
+	if ((lock = xSemaphoreCreateMutex()) == NULL ||
+		xTaskCreate(sndq_run, "sndq", SNDQ_TASK_STACK, NULL, SNDQ_TASK_PRIO,
+		&task) != pdPASS) {
+		ESP_LOGE(TAG, "task not created");
+		return -1;
+	}
+	return 0;
+}
+
+void sndq_wake(void)
+{
+	if (task != NULL) xTaskNotifyGive(task);
+}
+
+bool IRAM_ATTR sndq_wake_isr(void)
+{
+	BaseType_t woken = pdFALSE;
+
+	if (task != NULL) vTaskNotifyGiveFromISR(task, &woken);
+	return woken == pdTRUE;
+}
+
+sndq_id_t sound_post(const void *audio, uint32_t size, uint8_t prio,
+	sndq_policy_t policy, sndq_done_t done, void *arg)
+{
+	sndq_event_t e = {
+		.audio = audio, .size = size, .gain = MAX_VOL,
+		.prio = prio, .policy = policy, .done = done, .arg = arg,
+	};
+	sndq_id_t id;
+	bool report;
+
+	if (task == NULL) return SNDQ_NONE;
+	xSemaphoreTake(lock, portMAX_DELAY);
+	id = sndq_post(&sched, &e);
+	report = sched.rcnt != 0;
+	xSemaphoreGive(lock);
+	if (report) xTaskNotifyGive(task); // Run the callbacks in the task
+	return id;
+}
+
+void sound_post_flush(void)
+{
+	if (task == NULL) return;
+	xSemaphoreTake(lock, portMAX_DELAY);
+	sndq_flush(&sched);
+	xSemaphoreGive(lock);
+	xTaskNotifyGive(task);
+}
@@ -4,8 +4,21 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "sndq.h"
+
 #define MAX_VOL 100U
 
+// The audio given to sound_start(), sound_cyclic() and sound_play() is
+// either raw samples in the native format of the driver (signed 16-bit
+// for I2S, unsigned 8-bit for the DAC), or an asset that starts with a
+// header giving its format (asset.h), such as IMA-ADPCM made by
+// audio/audio2c.c, a patch of the synthesizer (synth.h), or a sound of a
+// bank mapped from flash (bank.h). An asset is resampled to the rate
+// given to sound_init(), while raw samples are taken to be at that rate.
+
+// Voice handle returned by sound_play(), negative if none.
+typedef int32_t sound_voice_t;
+
 // Initialize the sound driver. Must be called before using sound.
 // May be called again to change sample rate.
 // sample_hz: sample rate in Hz to playback audio.
@@ -17,12 +30,14 @@ int32_t sound_init(uint32_t sample_hz);
 int32_t sound_deinit(void);
 
 // Start playing the sound immediately. Play the audio buffer once.
+// Sounds already playing go on, mixed with this one.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
 void sound_start(const void *audio, uint32_t size, bool wait);
 
 // Cyclically play samples from audio buffer until sound_stop() is called.
+// Replaces the sound of the last call, other sounds go on.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size);
@@ -30,15 +45,58 @@ void sound_cyclic(const void *audio, uint32_t size);
 // Return true if sound playing, otherwise return false.
 bool sound_busy(void);
 
-// Stop playing the sound.
+// Stop playing all sounds.
 void sound_stop(void);
 
-// Set the volume.
-// volume: 0-100% as an integer value.
+// Start playing a sound on a voice of the mixer, along with the sounds
+// already playing. If all voices are busy, the oldest sound is stopped.
+// audio: a pointer to an array of audio data.
+// size: the size of the array in bytes.
+// loop: if true, play until stopped, otherwise play once.
+// gain: 0-100% of the volume set by sound_set_volume().
+// Return the voice handle, or a negative value if nothing to play.
+sound_voice_t sound_play(const void *audio, uint32_t size, bool loop, uint32_t gain);
+
+// Return true if the sound of a voice is still playing.
+bool sound_voice_busy(sound_voice_t v);
+
+// Stop the sound of a voice. Ignored if the sound already ended.
+void sound_voice_stop(sound_voice_t v);
+
+// Set the gain of a voice.
+// gain: 0-100% of the volume set by sound_set_volume().
+void sound_voice_gain(sound_voice_t v, uint32_t gain);
+
+// Post a sound event to the scheduler (sndq.h). Does not block. The
+// event plays once, when no event of a higher priority is in the way,
+// along with the sounds started by the other functions.
+// audio: a pointer to an array of audio data.
+// size: the size of the array in bytes.
+// prio: priority, higher plays first.
+// policy: what the event does when another one is playing.
+// done: called with the result in the scheduler task, or NULL.
+// arg: passed to done.
+// Return the event ID, or SNDQ_NONE if the scheduler is not running.
+sndq_id_t sound_post(const void *audio, uint32_t size, uint8_t prio,
+	sndq_policy_t policy, sndq_done_t done, void *arg);
+
+// Stop the playing event of the scheduler and remove the queued ones.
+void sound_post_flush(void);
+
+// Set the volume. A change ramps over a few samples, with no click.
+// volume: 0-100% as an integer value, on a log scale.
 void sound_set_volume(uint32_t vol);
 
 // Enable or disable the sound output device.
 // enable: if true, enable sound, otherwise disable.
 void sound_device(bool enable);
 
+// Get the latency of sound starts since sound_init(): the time from the
+// call that starts a sound to the fill of the DMA buffer with its first
+// sample. The buffers queued ahead of it add a fixed delay, not counted.
+// max_us: longest latency in microseconds.
+// mean_us: mean latency in microseconds.
+// Return the number of starts measured.
+uint32_t sound_latency(uint32_t *max_us, uint32_t *mean_us);
+
 #endif // SOUND_H_
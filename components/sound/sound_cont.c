@@ -1,15 +1,16 @@
 // https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/dac.html
 
-#include <string.h> // memset
-
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_timer.h" // esp_timer_get_time
 #include "driver/dac_continuous.h"
 #include "driver/gpio.h"
 
 #include "hw.h"
+#include "mixer.h"
+#include "sndq.h"
 #include "sound.h"
 
 #define SOUND_A  HW_SND_A  // Audio output
@@ -20,7 +21,7 @@
 // was able to play audio at 48kHz with buf size of  8 and 8 desc, async.
 // was able to play audio at 48kHz with buf size of 64 and 8 desc, sync w/ vol control.
 
-#define SOUND_VOLUME_DEFAULT 50
+#define SOUND_VOLUME_DEFAULT 85 // -6 dB
 #define SILENCE 0x80U
 #define POLL_DELAY 10
 #define PERCENT 100U
@@ -29,51 +30,48 @@ static const char *TAG = "sound";
 
 // Critical section protected variables
 static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
-static const uint8_t *abase;
-static volatile uint32_t asize;
-static volatile uint32_t aidx;
-static volatile bool     cyclic;
-static volatile uint32_t dcnt;
+static mixer_t mix;
+static sound_voice_t cyc = MIXER_NONE; // Voice of sound_cyclic()
+
+// Owned by the DMA callback, kept off the ISR stack
+static uint8_t buf[DAC_BUF_SZ]; // DAC samples
+static int16_t mbuf[DAC_BUF_SZ]; // Mixer samples
 
 // Other global variables
 static dac_continuous_handle_t dac_handle;
 static volatile bool device_en;
-static volatile uint32_t volume;
-static volatile uint8_t bias; // to prevent popping at end when vol low.
 
 
+// Refill the DMA buffer just sent, from the mixer: the rendered sound, or
+// the prepared silence while none plays, so a stale buffer is never sent
+// again and a sound starts in the next buffer. Only the voice commands
+// waiting and the sounds that ended are taken under the lock; the block
+// is rendered outside it.
 static bool IRAM_ATTR dac_convert_callback(dac_continuous_handle_t handle,
 	const dac_event_data_t *event, void *user_data)
 {
 #if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
-	uint8_t buf[event->buf_size/2];
+	uint32_t n = event->buf_size/2;
 #else
-	uint8_t buf[event->buf_size];
+	uint32_t n = event->buf_size;
 #endif
+	const int16_t *src;
+	bool ended;
 	// size_t load_bytes = 0;
+	if (n > DAC_BUF_SZ) n = DAC_BUF_SZ;
 	portENTER_CRITICAL_ISR(&spinlock);
-	if (aidx < asize) {
-		uint32_t idx = aidx;
-		uint32_t size = (!cyclic && asize < sizeof(buf)) ? asize : sizeof(buf);
-		aidx =  cyclic ? (aidx + size) % asize : aidx + size;
-		portEXIT_CRITICAL_ISR(&spinlock);
-		uint32_t i;
-		for (i = 0; i < size; i++) buf[i] = abase[(idx+i)%asize]*volume/PERCENT + bias;
-		while (i < sizeof(buf)) buf[i++] = SILENCE; // pad to block size with silence
-		dac_continuous_write_asynchronously(handle,
-			event->buf, event->buf_size,
-			buf, sizeof(buf), NULL /*&load_bytes*/);
-			// error if load_bytes != sizeof(buf)
-	} else if (dcnt) {
-		dcnt--; // add silence to DMA buffer when done
-		portEXIT_CRITICAL_ISR(&spinlock);
-		memset(buf, SILENCE, sizeof(buf));
-		dac_continuous_write_asynchronously(handle,
-			event->buf, event->buf_size,
-			buf, sizeof(buf), NULL /*&load_bytes*/);
-	} else {
-		portEXIT_CRITICAL_ISR(&spinlock);
-	}
+	mixer_begin(&mix, esp_timer_get_time());
+	portEXIT_CRITICAL_ISR(&spinlock);
+	src = mixer_block(&mix, mbuf, n);
+	portENTER_CRITICAL_ISR(&spinlock);
+	ended = mixer_end(&mix);
+	portEXIT_CRITICAL_ISR(&spinlock);
+	mixer_to_u8(buf, src, n);
+	dac_continuous_write_asynchronously(handle,
+		event->buf, event->buf_size,
+		buf, n, NULL /*&load_bytes*/);
+		// error if load_bytes != sizeof(buf)
+	if (ended) return sndq_wake_isr(); // A sound ended, start the next one
 	return false; // no high priority task awoken
 }
 
@@ -84,7 +82,10 @@ static bool IRAM_ATTR dac_convert_callback(dac_continuous_handle_t handle,
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_init(uint32_t sample_hz)
 {
+	mixer_init(&mix);
+	mixer_rate(&mix, sample_hz); // Assets at other rates are resampled
 	sound_set_volume(SOUND_VOLUME_DEFAULT);
+	mixer_defer(&mix, true); // Commands wait for the callback
 	
 	/* * * * * * * * * * GPIO25 Pin Config * * * * * * * * * */
 	// if the first time called, configure GPIO25 as output
@@ -139,7 +140,7 @@ int32_t sound_init(uint32_t sample_hz)
 	ESP_ERROR_CHECK(dac_continuous_enable(dac_handle));
 	ESP_LOGI(TAG, "Start async audio DMA");
 	ESP_ERROR_CHECK(dac_continuous_start_async_writing(dac_handle));
-	return 0;
+	return sndq_task_init(); // Scheduler of sound_post()
 }
 
 // Free resources used for sound (DAC, etc.).
@@ -156,57 +157,106 @@ int32_t sound_deinit(void)
 	return 0;
 }
 
+// Start a sound on a voice of the mixer.
+// cur: if not NULL, voice to stop first, set to the new voice under the
+//   lock.
+static sound_voice_t sound_mix(const void *audio, uint32_t size, bool loop, uint32_t gain, sound_voice_t *cur)
+{
+	sound_voice_t v;
+	int64_t now = esp_timer_get_time();
+
+	portENTER_CRITICAL(&spinlock);
+	if (cur != NULL) mixer_stop(&mix, *cur);
+	mixer_now(&mix, now);
+	v = mixer_play_asset(&mix, audio, size, MIXER_U8, loop, gain*MIXER_UNITY/MAX_VOL);
+	if (cur != NULL) *cur = v;
+	portEXIT_CRITICAL(&spinlock);
+	return v;
+}
+
 // Start playing the sound immediately. Play the audio buffer once.
+// Sounds already playing go on, mixed with this one.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
 void sound_start(const void *audio, uint32_t size, bool wait)
 {
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = false;
-	dcnt = DAC_DESC_NUM;
-	portEXIT_CRITICAL(&spinlock);
-	while (wait && aidx < asize)
+	sound_voice_t v = sound_mix(audio, size, false, MAX_VOL, NULL);
+	while (wait && sound_voice_busy(v))
 		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
 }
 
 // Cyclically play samples from audio buffer until sound_stop() is called.
+// Replaces the sound of the last call, other sounds go on.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size)
 {
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = true;
-	dcnt = DAC_DESC_NUM;
-	portEXIT_CRITICAL(&spinlock);
+	sound_mix(audio, size, true, MAX_VOL, &cyc);
 }
 
 // Return true if sound playing, otherwise return false.
 bool sound_busy(void)
 {
-	return aidx < asize;
+	portENTER_CRITICAL(&spinlock);
+	bool busy = mixer_active(&mix) != 0;
+	portEXIT_CRITICAL(&spinlock);
+	return busy;
 }
 
-// Stop playing the sound.
+// Stop playing all sounds.
 void sound_stop(void)
 {
 	portENTER_CRITICAL(&spinlock);
-	aidx = asize;
+	mixer_stop_all(&mix);
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Start playing a sound on a voice of the mixer, along with the sounds
+// already playing. If all voices are busy, the oldest sound is stopped.
+// audio: a pointer to an array of audio data.
+// size: the size of the array in bytes.
+// loop: if true, play until stopped, otherwise play once.
+// gain: 0-100% of the volume set by sound_set_volume().
+// Return the voice handle, or a negative value if nothing to play.
+sound_voice_t sound_play(const void *audio, uint32_t size, bool loop, uint32_t gain)
+{
+	return sound_mix(audio, size, loop, gain, NULL);
+}
+
+// Return true if the sound of a voice is still playing.
+bool sound_voice_busy(sound_voice_t v)
+{
+	portENTER_CRITICAL(&spinlock);
+	bool busy = mixer_busy(&mix, v);
+	portEXIT_CRITICAL(&spinlock);
+	return busy;
+}
+
+// Stop the sound of a voice. Ignored if the sound already ended.
+void sound_voice_stop(sound_voice_t v)
+{
+	portENTER_CRITICAL(&spinlock);
+	mixer_stop(&mix, v);
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Set the gain of a voice.
+// gain: 0-100% of the volume set by sound_set_volume().
+void sound_voice_gain(sound_voice_t v, uint32_t gain)
+{
+	portENTER_CRITICAL(&spinlock);
+	mixer_gain(&mix, v, gain*MIXER_UNITY/MAX_VOL);
 	portEXIT_CRITICAL(&spinlock);
 }
 
-// Set the volume.
-// volume: 0-100% as an integer value.
+// Set the volume. A change ramps over a few samples, with no click.
+// volume: 0-100% as an integer value, on a log scale (mixer_volume()).
 void sound_set_volume(uint32_t vol)
 {
-	volume = vol;
-	bias = SILENCE - (SILENCE * vol / PERCENT);
+	portENTER_CRITICAL(&spinlock);
+	mixer_master(&mix, mixer_volume(vol*MIXER_VOLUME_MAX/PERCENT));
+	portEXIT_CRITICAL(&spinlock);
 }
 
 // Enable or disable the sound output device.
@@ -216,6 +266,22 @@ void sound_device(bool enable)
 	gpio_set_level(SOUND_EN, device_en = enable);
 }
 
+// Get the latency of sound starts since sound_init(), from the mixer.
+// max_us: longest latency in microseconds.
+// mean_us: mean latency in microseconds.
+// Return the number of starts measured.
+uint32_t sound_latency(uint32_t *max_us, uint32_t *mean_us)
+{
+	mixer_stats_t st;
+
+	portENTER_CRITICAL(&spinlock);
+	st = mix.stats;
+	portEXIT_CRITICAL(&spinlock);
+	*max_us = st.lat_max;
+	*mean_us = st.starts ? st.lat_sum/st.starts : 0;
+	return st.starts;
+}
+
 // NOTES:
 // * Switching back and forth between sync and async crashes with WDT timeout
 // in ISR. The crash happens when async follows sync.
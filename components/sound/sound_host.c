@@ -0,0 +1,453 @@
+// Host (Linux) build of the sound driver, see sound_host.h. The fill and
+// the standing channel follow sound_i2s.c, with a mutex in place of the
+// spinlock and a thread in place of the DMA callback.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h> // memset, strlen, strcmp
+#include <time.h>
+
+#include "mixer.h"
+#include "sndq.h"
+#include "sound.h"
+#include "sound_host.h"
+
+#define DMA_DESC_SZ 128 // DMA descriptor (buffer) size in bytes, as sound_i2s.c
+#define DMA_DESC_NUM 8 // Number of DMA descriptors (buffers)
+#define FRAME_NUM (DMA_DESC_SZ/sizeof(slot_t)) // Frames in a DMA buffer
+
+#define SOUND_VOLUME_DEFAULT 50 // -20 dB
+#define PERCENT 100
+#define NS 1000000000LL
+#define WAV_EXT ".wav"
+
+typedef int16_t slot_t;
+
+// Mutex protected variables
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER; // Sound started
+static pthread_cond_t sent = PTHREAD_COND_INITIALIZER; // Buffer sent
+static mixer_t mix;
+static sound_voice_t cyc = MIXER_NONE; // Voice of sound_cyclic()
+static sndq_t sched; // Scheduler of sound_post()
+static bool enabled; // Channel sending buffers, see sound_device()
+static bool delivering; // Callbacks of the scheduler running
+static bool quit;
+static int64_t due; // ns, when the next buffer is sent
+static uint32_t stall_us;
+static uint32_t speed = SOUND_HOST_REALTIME;
+static sound_host_stats_t stats;
+
+// Other global variables
+static pthread_t dma;
+static bool started;
+static uint32_t rate;
+static const char *out_path;
+static FILE *out;
+static bool wav;
+
+// Return the monotonic time in ns.
+static int64_t host_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*NS + ts.tv_nsec;
+}
+
+// Return the ns between buffers at the speed, 0 if fast.
+static int64_t host_period(void)
+{
+	return speed ? FRAME_NUM*NS/rate/speed : 0;
+}
+
+// Write the WAV header for a number of samples.
+static void host_wav(uint64_t samples)
+{
+	uint32_t data = samples*sizeof(slot_t);
+	uint32_t hdr[] = {
+		0x46464952, 36+data, 0x45564157, // "RIFF", size, "WAVE"
+		0x20746d66, 16, 1 | (1 << 16), rate, rate*sizeof(slot_t), // "fmt " PCM mono
+		sizeof(slot_t) | (16 << 16), // 16-bit
+		0x61746164, data, // "data"
+	};
+	fseek(out, 0, SEEK_SET);
+	fwrite(hdr, sizeof(hdr), 1, out);
+	fseek(out, 0, SEEK_END);
+}
+
+// Send a DMA buffer: write it to the file and count it.
+static void host_send(const slot_t *buf)
+{
+	if (out) fwrite(buf, sizeof(buf[0]), FRAME_NUM, out);
+	stats.blocks++;
+	stats.samples += FRAME_NUM;
+}
+
+// Fill a DMA buffer from the mixer, the rendered sound or the prepared
+// silence, and send it, as the callback of sound_i2s.c does: the block is
+// rendered with the lock released. Called with the lock held.
+static void host_fill(void)
+{
+	slot_t buf[FRAME_NUM];
+	const slot_t *src;
+
+	mixer_begin(&mix, host_now()/1000);
+	pthread_mutex_unlock(&lock);
+	src = mixer_block(&mix, buf, FRAME_NUM);
+	pthread_mutex_lock(&lock);
+	mixer_end(&mix);
+	host_send(src);
+}
+
+// Preload the DMA ring with silence and start the channel, as i2s_start()
+// does. The silence is sent ahead of the first fill. Called with the lock
+// held.
+static void host_start(void)
+{
+	static const slot_t zero[FRAME_NUM];
+
+	for (uint32_t i = 0; i < DMA_DESC_NUM; i++) host_send(zero);
+	enabled = true;
+	due = host_now() + host_period();
+	pthread_cond_signal(&wake);
+}
+
+// DMA thread. While the channel is enabled, wait for each buffer to be
+// sent, fill it, then run the scheduler. At SOUND_HOST_FAST, the time
+// with no sound is skipped: the thread waits for a sound, and sends no
+// silence. The callbacks of the results of the scheduler run outside the
+// lock, also while no buffer is sent.
+static void *host_dma(void *arg)
+{
+	sndq_report_t res[SNDQ_RESULTS];
+
+	pthread_mutex_lock(&lock);
+	while (!quit) {
+		if (enabled && (speed || mixer_active(&mix))) {
+			int64_t t = due, period = host_period();
+			uint32_t stall = stall_us;
+			stall_us = 0;
+			pthread_mutex_unlock(&lock);
+			if (period) {
+				struct timespec ts = {.tv_sec = t/NS, .tv_nsec = t%NS};
+				clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+			}
+			if (stall) {
+				struct timespec ts = {.tv_sec = stall/1000000, .tv_nsec = (stall%1000000)*1000};
+				nanosleep(&ts, NULL);
+			}
+			pthread_mutex_lock(&lock);
+			int64_t t0 = host_now(), late = period ? t0 - t : 0;
+			if (late > stats.late_max_us*1000) stats.late_max_us = late/1000;
+			if (period && late >= period) stats.underruns++;
+			due = t + period; // The DMA keeps its cadence
+			host_fill();
+			int64_t fill = host_now() - t0;
+			if (fill > stats.fill_max_ns) stats.fill_max_ns = fill;
+			stats.fill_sum_ns += fill;
+			sndq_poll(&sched);
+		} else if (!sched.rcnt) {
+			pthread_cond_wait(&wake, &lock);
+			continue;
+		}
+		uint16_t n = sndq_results(&sched, res, SNDQ_RESULTS);
+		if (n) {
+			delivering = true;
+			pthread_mutex_unlock(&lock);
+			for (uint16_t i = 0; i < n; i++)
+				if (res[i].done) res[i].done(res[i].arg, res[i].id, res[i].r);
+			pthread_mutex_lock(&lock);
+			delivering = false;
+		}
+		pthread_cond_broadcast(&sent);
+	}
+	pthread_mutex_unlock(&lock);
+	return NULL;
+}
+
+// Start a sound on a voice of the mixer, sent from the next fill. Nothing
+// plays while the channel is disabled. Called with the lock held.
+// old: voice to stop first, or MIXER_NONE.
+static sound_voice_t host_mix(const void *audio, uint32_t size, bool loop, uint32_t gain, sound_voice_t old)
+{
+	sound_voice_t v;
+
+	mixer_stop(&mix, old);
+	if (!enabled) return MIXER_NONE;
+	mixer_now(&mix, host_now()/1000);
+	v = mixer_play_asset(&mix, audio, size, MIXER_S16, loop, gain*MIXER_UNITY/MAX_VOL);
+	if (v >= 0) pthread_cond_signal(&wake); // A fast thread waits for a sound
+	return v;
+}
+
+// Sound output of the scheduler. Called with the lock held.
+static int32_t host_sndq_play(void *ctx, const void *audio, uint32_t size, uint32_t gain)
+{
+	return host_mix(audio, size, false, gain, MIXER_NONE);
+}
+
+static void host_sndq_stop(void *ctx, int32_t voice)
+{
+	mixer_stop(&mix, voice);
+}
+
+static bool host_sndq_busy(void *ctx, int32_t voice)
+{
+	return mixer_busy(&mix, voice);
+}
+
+static const sndq_ops_t ops = {
+	.play = host_sndq_play,
+	.stop = host_sndq_stop,
+	.busy = host_sndq_busy,
+};
+
+void sound_host_output(const char *path)
+{
+	out_path = path;
+}
+
+void sound_host_speed(uint32_t x)
+{
+	pthread_mutex_lock(&lock);
+	speed = x;
+	due = host_now() + host_period();
+	pthread_cond_signal(&wake);
+	pthread_mutex_unlock(&lock);
+}
+
+void sound_host_stall(uint32_t us)
+{
+	pthread_mutex_lock(&lock);
+	stall_us = us;
+	pthread_mutex_unlock(&lock);
+}
+
+bool sound_host_idle(uint32_t timeout_ms)
+{
+	struct timespec ts; // Condition variables time out on the realtime clock
+	bool idle;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += timeout_ms/1000;
+	ts.tv_nsec += (timeout_ms%1000)*1000000L;
+	if (ts.tv_nsec >= NS) {
+		ts.tv_sec++;
+		ts.tv_nsec -= NS;
+	}
+	pthread_mutex_lock(&lock);
+	while (!(idle = !mixer_active(&mix) && !sndq_busy(&sched) && !sched.rcnt && !delivering))
+		if (pthread_cond_timedwait(&sent, &lock, &ts)) break;
+	pthread_mutex_unlock(&lock);
+	return idle;
+}
+
+void sound_host_stats(sound_host_stats_t *s)
+{
+	pthread_mutex_lock(&lock);
+	*s = stats;
+	s->starts = mix.stats.starts;
+	s->lat_max_us = mix.stats.lat_max;
+	pthread_mutex_unlock(&lock);
+}
+
+// Initialize the sound driver. Must be called before using sound.
+// May be called again to change sample rate.
+// sample_hz: sample rate in Hz to playback audio.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_init(uint32_t sample_hz)
+{
+	if (started) sound_deinit();
+	pthread_mutex_lock(&lock);
+	mixer_init(&mix);
+	mixer_rate(&mix, sample_hz); // Assets at other rates are resampled
+	mixer_master(&mix, mixer_volume(SOUND_VOLUME_DEFAULT*MIXER_VOLUME_MAX/PERCENT));
+	mixer_defer(&mix, true); // Commands wait for the fill
+	sndq_init(&sched, &ops);
+	memset(&stats, 0, sizeof(stats));
+	rate = sample_hz;
+	cyc = MIXER_NONE;
+	enabled = quit = false;
+	pthread_mutex_unlock(&lock);
+
+	if (out_path != NULL) {
+		size_t len = strlen(out_path), ext = strlen(WAV_EXT);
+		wav = len >= ext && !strcmp(out_path + len - ext, WAV_EXT);
+		if ((out = fopen(out_path, "wb")) == NULL) return -1;
+		if (wav) host_wav(0);
+	}
+	pthread_mutex_lock(&lock);
+	host_start();
+	pthread_mutex_unlock(&lock);
+	if (pthread_create(&dma, NULL, host_dma, NULL)) return -1;
+	started = true;
+	return 0;
+}
+
+// Free resources used for sound. Waits for the sounds to end, as on the
+// target, then stops the DMA thread and closes the file.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_deinit(void)
+{
+	if (!started) return 0;
+	pthread_mutex_lock(&lock);
+	while (mixer_active(&mix)) pthread_cond_wait(&sent, &lock);
+	quit = true;
+	pthread_cond_signal(&wake);
+	pthread_mutex_unlock(&lock);
+	pthread_join(dma, NULL);
+	started = false;
+	if (out) {
+		if (wav) host_wav(stats.samples);
+		fclose(out);
+		out = NULL;
+	}
+	return 0;
+}
+
+// Start playing the sound immediately. Play the audio buffer once.
+// Sounds already playing go on, mixed with this one.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes.
+// wait: if true, block until done playing, otherwise return straight away.
+void sound_start(const void *audio, uint32_t size, bool wait)
+{
+	pthread_mutex_lock(&lock);
+	sound_voice_t v = host_mix(audio, size, false, MAX_VOL, MIXER_NONE);
+	while (wait && mixer_busy(&mix, v)) pthread_cond_wait(&sent, &lock);
+	pthread_mutex_unlock(&lock);
+}
+
+// Cyclically play samples from audio buffer until sound_stop() is called.
+// Replaces the sound of the last call, other sounds go on.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes.
+void sound_cyclic(const void *audio, uint32_t size)
+{
+	pthread_mutex_lock(&lock);
+	cyc = host_mix(audio, size, true, MAX_VOL, cyc);
+	pthread_mutex_unlock(&lock);
+}
+
+// Return true if sound playing, otherwise return false.
+bool sound_busy(void)
+{
+	pthread_mutex_lock(&lock);
+	bool busy = mixer_active(&mix) != 0;
+	pthread_mutex_unlock(&lock);
+	return busy;
+}
+
+// Stop playing all sounds.
+void sound_stop(void)
+{
+	pthread_mutex_lock(&lock);
+	mixer_stop_all(&mix);
+	pthread_mutex_unlock(&lock);
+}
+
+// Start playing a sound on a voice of the mixer, along with the sounds
+// already playing. If all voices are busy, the oldest sound is stopped.
+// audio: a pointer to an array of audio data.
+// size: the size of the array in bytes.
+// loop: if true, play until stopped, otherwise play once.
+// gain: 0-100% of the volume set by sound_set_volume().
+// Return the voice handle, or a negative value if nothing to play.
+sound_voice_t sound_play(const void *audio, uint32_t size, bool loop, uint32_t gain)
+{
+	pthread_mutex_lock(&lock);
+	sound_voice_t v = host_mix(audio, size, loop, gain, MIXER_NONE);
+	pthread_mutex_unlock(&lock);
+	return v;
+}
+
+// Return true if the sound of a voice is still playing.
+bool sound_voice_busy(sound_voice_t v)
+{
+	pthread_mutex_lock(&lock);
+	bool busy = mixer_busy(&mix, v);
+	pthread_mutex_unlock(&lock);
+	return busy;
+}
+
+// Stop the sound of a voice. Ignored if the sound already ended.
+void sound_voice_stop(sound_voice_t v)
+{
+	pthread_mutex_lock(&lock);
+	mixer_stop(&mix, v);
+	pthread_mutex_unlock(&lock);
+}
+
+// Set the gain of a voice.
+// gain: 0-100% of the volume set by sound_set_volume().
+void sound_voice_gain(sound_voice_t v, uint32_t gain)
+{
+	pthread_mutex_lock(&lock);
+	mixer_gain(&mix, v, gain*MIXER_UNITY/MAX_VOL);
+	pthread_mutex_unlock(&lock);
+}
+
+// Post a sound event to the scheduler. The result is reported from the
+// DMA thread, after the next fill.
+sndq_id_t sound_post(const void *audio, uint32_t size, uint8_t prio,
+	sndq_policy_t policy, sndq_done_t done, void *arg)
+{
+	sndq_event_t e = {
+		.audio = audio, .size = size, .gain = MAX_VOL,
+		.prio = prio, .policy = policy, .done = done, .arg = arg,
+	};
+
+	pthread_mutex_lock(&lock);
+	sndq_id_t id = sndq_post(&sched, &e);
+	if (sched.rcnt) pthread_cond_signal(&wake); // Run the callbacks
+	pthread_mutex_unlock(&lock);
+	return id;
+}
+
+// Stop the playing event of the scheduler and remove the queued ones.
+void sound_post_flush(void)
+{
+	pthread_mutex_lock(&lock);
+	sndq_flush(&sched);
+	pthread_cond_signal(&wake); // Run the callbacks
+	pthread_mutex_unlock(&lock);
+}
+
+// Set the volume. A change ramps over a few samples, with no click.
+// volume: 0-100% as an integer value, on a log scale (mixer_volume()).
+void sound_set_volume(uint32_t vol)
+{
+	pthread_mutex_lock(&lock);
+	mixer_master(&mix, mixer_volume(vol*MIXER_VOLUME_MAX/PERCENT));
+	pthread_mutex_unlock(&lock);
+}
+
+// Enable or disable the sound output device, as sound_i2s.c does.
+// Disabling stops the sounds and the channel, enabling starts the channel
+// again with silence.
+// enable: if true, enable sound, otherwise disable.
+void sound_device(bool enable)
+{
+	pthread_mutex_lock(&lock);
+	if (enable && !enabled) {
+		host_start();
+	} else if (!enable && enabled) {
+		enabled = false;
+		mixer_stop_all(&mix);
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+// Get the latency of sound starts since sound_init(), from the mixer.
+// max_us: longest latency in microseconds.
+// mean_us: mean latency in microseconds.
+// Return the number of starts measured.
+uint32_t sound_latency(uint32_t *max_us, uint32_t *mean_us)
+{
+	pthread_mutex_lock(&lock);
+	mixer_stats_t st = mix.stats;
+	pthread_mutex_unlock(&lock);
+	*max_us = st.lat_max;
+	*mean_us = st.starts ? st.lat_sum/st.starts : 0;
+	return st.starts;
+}
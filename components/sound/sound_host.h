@@ -0,0 +1,61 @@
+#ifndef SOUND_HOST_H_
+#define SOUND_HOST_H_
+
+// Host (Linux) build of the sound driver. A thread stands in for the I2S
+// DMA: it fills one DMA buffer of DMA_DESC_SZ bytes at a time, at the
+// cadence the hardware would send them, on a virtual sample clock, and
+// writes the stream to a file in place of the speaker. As on the target,
+// the channel stands from sound_init(): the ring is preloaded with
+// DMA_DESC_NUM buffers of silence, written first, then every buffer is
+// filled, with silence while no sound plays, and a sound starts in the
+// next fill. At SOUND_HOST_FAST the time with no sound is skipped. The
+// scheduler of sound_post() runs in the same thread, after each fill, in
+// place of its task.
+//
+// A fill that runs a buffer period or more after it was due is counted
+// as an underrun: on the target the DMA would have sent a stale buffer.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sound.h"
+
+#define SOUND_HOST_REALTIME 1 // Speed of the target
+#define SOUND_HOST_FAST 0 // No waiting, each buffer follows the last
+
+// Statistics since sound_init()
+typedef struct {
+	uint64_t blocks; // DMA buffers sent
+	uint64_t samples; // Samples sent, the virtual sample clock
+	uint32_t starts; // Sounds started, in their first buffer
+	int64_t lat_max_us; // Longest time from a start to its first buffer
+	uint32_t underruns; // Fills a buffer period or more late
+	int64_t late_max_us; // Latest fill after it was due
+	int64_t fill_max_ns; // Longest fill
+	int64_t fill_sum_ns; // Of all fills
+} sound_host_stats_t;
+
+// Set the file the next sound_init() writes the stream to, closed by
+// sound_deinit(). A name that ends in ".wav" is a WAV file, any other
+// holds raw signed 16-bit samples.
+// path: file name, or NULL for none.
+void sound_host_output(const char *path);
+
+// Set the speed of the DMA cadence.
+// x: multiple of real time, or SOUND_HOST_FAST.
+void sound_host_speed(uint32_t x);
+
+// Hold off the next fill, as a long critical section would on the
+// target, to cause an underrun.
+// us: delay in microseconds.
+void sound_host_stall(uint32_t us);
+
+// Wait until no sound plays and no sound event is playing or queued.
+// timeout_ms: max time to wait.
+// Returns true if idle, false on timeout.
+bool sound_host_idle(uint32_t timeout_ms);
+
+// Get the statistics since sound_init().
+void sound_host_stats(sound_host_stats_t *s);
+
+#endif // SOUND_HOST_H_
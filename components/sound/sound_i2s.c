@@ -1,16 +1,17 @@
 // https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/peripherals/i2s.html
 // https://github.com/espressif/esp-idf/tree/v6.0.2/examples/peripherals/i2s
 
-#include <string.h> // memset
-
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/i2s_std.h"
 #include "driver/gpio.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_timer.h" // esp_timer_get_time
 
 #include "hw.h"
+#include "mixer.h"
+#include "sndq.h"
 #include "sound.h"
 
 //#include "i2s_private.h" // hidden i2s_chan_handle_t members
@@ -25,52 +26,60 @@
 #define I2S_FRAME_SZ sizeof(slot_t) // Frame size in bytes (16-bit mono)
 #define I2S_FRAME_NUM (DMA_DESC_SZ/I2S_FRAME_SZ) // Number of frames in a DMA descriptor
 
-// Make audio buffer extern for testing
+// Make mixer state extern for testing
 #ifdef EXTERN_BUF
 #define scope
 #else
 #define scope static
 #endif
 
-#define SOUND_VOLUME_DEFAULT 10
+#define SOUND_VOLUME_DEFAULT 50 // -20 dB
 #define POLL_DELAY 10
 #define PERCENT 100
 #define IN_BIAS 0x80U
 
 static const char *TAG = "sound";
 
-typedef int16_t sample_t;
 typedef int16_t slot_t;
 
 // Critical section protected variables
 static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
-scope  volatile const sample_t *abase;
-scope  volatile uint32_t asize;
-static volatile uint32_t aidx;
-static volatile bool     cyclic;
-static volatile uint32_t dcnt;
+scope  mixer_t mix;
+static sound_voice_t cyc = MIXER_NONE; // Voice of sound_cyclic()
+
+// Owned by the I2S callback, kept off the ISR stack
+static slot_t buf[I2S_FRAME_NUM];
 
 // Other global variables
 static i2s_chan_handle_t i2s_handle;
 static volatile bool device_en;
-static volatile int32_t volume;
 
 #if DMA_DEBUG
 static volatile size_t missed_dat, missed_sil;
 #endif
 
 // NOTE:
-// 1) The function i2s_channel_enable() must be called each time a new
-//    sound is played from silence, otherwise the DMA buffers somehow get
-//    messed up and garbled sound will be heard.
+// 1) The function i2s_channel_enable() used to be called each time a new
+//    sound was played from silence, after the channel was disabled at the
+//    end of the last one, otherwise the DMA buffers somehow got messed up
+//    and garbled sound was heard. The channel now stands: it is enabled
+//    once, with the ring preloaded with silence, and the callback fills
+//    every buffer, with silence while no sound plays. A sound starts in
+//    the next buffer filled, at most one buffer period after the call,
+//    with the DMA_DESC_NUM buffers of the ring as a fixed delay.
+//    The channel is never disabled, so the callback also runs while idle,
+//    once per buffer (2 ms at 32 kHz). That path takes the lock twice to
+//    find no voice, and writes the prepared silence without a render. It
+//    keeps no arrays on the ISR stack, as the render buffers are static
+//    (see buf and mixer_t).
 // 2) After a call to i2s_channel_write() in the I2S callback, sometimes
 //    the bytes_written will be less than the bytes requested for both active
 //    data and silence. It is not known where in the playback this occurs.
-// 3) When starting to play a sound, preloading one DMA descriptor worth of
+// 3) When starting the channel, preloading one DMA descriptor worth of
 //    data with a call to i2s_channel_preload_data() seems to eliminate the
 //    discrepancy between bytes requested and written in the I2S callback.
 //    However, more than one DMA buffer needs to be preloaded before
-//    playback to prevent a garbled sound.
+//    playback to prevent a garbled sound. The whole ring is preloaded.
 // 4) The function i2s_channel_write() should not normally be called within
 //    an interrupt context since it can block. However, it is known that at
 //    least one DMA buffer is available to fill when the i2s done callback
@@ -83,75 +92,48 @@ static volatile size_t missed_dat, missed_sil;
 
 // Called when a TX channel finishes sending a DMA buffer.
 // The event data includes the DMA buffer address and size (not used here).
+// The buffer is refilled from the mixer: the rendered sound, or the
+// prepared silence while none plays. Only the voice commands waiting and
+// the sounds that ended are taken under the lock; the block is rendered
+// outside it. When a sound ends, the scheduler task is woken to start the
+// next one.
 static bool IRAM_ATTR i2s_done_callback(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
 {
-	slot_t buf[I2S_FRAME_NUM];
-	#if DMA_DEBUG
-	size_t bytes_written;
-	#endif
+	const slot_t *src;
+	size_t bytes_written = DMA_DESC_SZ;
+	bool ended;
+
 	portENTER_CRITICAL_ISR(&spinlock);
-	if (aidx < asize) {
-		uint32_t idx = aidx;
-		uint32_t size = (!cyclic && asize < I2S_FRAME_NUM) ? asize : I2S_FRAME_NUM;
-		aidx =  cyclic ? (aidx + size) % asize : aidx + size;
-		portEXIT_CRITICAL_ISR(&spinlock);
-		int i;
-		for (i = 0; i < size; i++) buf[i] = (abase[(idx+i)%asize])*volume/PERCENT;
-		while (i < I2S_FRAME_NUM) buf[i++] = 0; // pad to block size with silence
-		#if DMA_DEBUG
-		i2s_channel_write(handle, buf, DMA_DESC_SZ, /*NULL*/ &bytes_written, 0);
-		if (bytes_written != DMA_DESC_SZ) missed_dat += DMA_DESC_SZ-bytes_written;
-		#else
-		i2s_channel_write(handle, buf, DMA_DESC_SZ, NULL /*&bytes_written*/, 0);
-		#endif
-	} else if (dcnt) {
-		dcnt--; // add silence to DMA buffer when done
-		portEXIT_CRITICAL_ISR(&spinlock);
-		memset(buf, 0, sizeof(buf));
-		#if DMA_DEBUG
-		i2s_channel_write(handle, buf, DMA_DESC_SZ, /*NULL*/ &bytes_written, 0);
-		if (bytes_written != DMA_DESC_SZ) missed_sil += DMA_DESC_SZ-bytes_written;
-		#else
-		i2s_channel_write(handle, buf, DMA_DESC_SZ, NULL /*&bytes_written*/, 0);
-		#endif
-		if (!dcnt) i2s_channel_disable(i2s_handle);
-	} else {
-		portEXIT_CRITICAL_ISR(&spinlock);
+	mixer_begin(&mix, esp_timer_get_time());
+	portEXIT_CRITICAL_ISR(&spinlock);
+	src = mixer_block(&mix, buf, I2S_FRAME_NUM);
+	portENTER_CRITICAL_ISR(&spinlock);
+	ended = mixer_end(&mix);
+	portEXIT_CRITICAL_ISR(&spinlock);
+	i2s_channel_write(handle, src, DMA_DESC_SZ, &bytes_written, 0);
+	#if DMA_DEBUG
+	if (bytes_written != DMA_DESC_SZ) {
+		if (src == buf) missed_dat += DMA_DESC_SZ-bytes_written;
+		else missed_sil += DMA_DESC_SZ-bytes_written;
 	}
+	#endif
+	if (ended) return sndq_wake_isr();
 	return false; // no high priority task awoken
 }
 
-// Preload audio data into a TX DMA buffer.
-// Must be called before i2s_channel_enable().
-static void i2s_tx_preload(i2s_chan_handle_t handle)
+// Preload the DMA ring with silence and enable the channel. From then on
+// the callback keeps the ring full.
+static void i2s_start(void)
 {
-	slot_t buf[I2S_FRAME_NUM];
-	size_t bytes_written;
-	portENTER_CRITICAL_ISR(&spinlock);
-	if (aidx < asize) {
-		uint32_t idx = aidx;
-		uint32_t size = (!cyclic && asize < I2S_FRAME_NUM) ? asize : I2S_FRAME_NUM;
-		aidx =  cyclic ? (aidx + size) % asize : aidx + size;
-		portEXIT_CRITICAL_ISR(&spinlock);
-		int i;
-		for (i = 0; i < size; i++) buf[i] = (abase[(idx+i)%asize])*volume/PERCENT;
-		while (i < I2S_FRAME_NUM) buf[i++] = 0; // pad to block size with silence
-		i2s_channel_preload_data(handle, buf, DMA_DESC_SZ, &bytes_written);
-		#if DMA_DEBUG
-		if (bytes_written != DMA_DESC_SZ) missed_dat += DMA_DESC_SZ-bytes_written;
-		#endif
-	} else if (dcnt) {
-		dcnt--; // add silence to DMA buffer when done
-		portEXIT_CRITICAL_ISR(&spinlock);
-		memset(buf, 0, sizeof(buf));
-		i2s_channel_preload_data(handle, buf, DMA_DESC_SZ, &bytes_written);
-		#if DMA_DEBUG
-		if (bytes_written != DMA_DESC_SZ) missed_sil += DMA_DESC_SZ-bytes_written;
-		#endif
-		if (!dcnt) i2s_channel_disable(i2s_handle);
-	} else {
-		portEXIT_CRITICAL_ISR(&spinlock);
-	}
+	static const slot_t zero[I2S_FRAME_NUM];
+	size_t bytes_loaded = DMA_DESC_SZ;
+
+	for (uint32_t i = 0; i < DMA_DESC_NUM && bytes_loaded == DMA_DESC_SZ; i++)
+		i2s_channel_preload_data(i2s_handle, zero, DMA_DESC_SZ, &bytes_loaded);
+	#if DMA_DEBUG
+	printf("missed0:%u,%u\n", missed_dat, missed_sil);
+	#endif
+	ESP_ERROR_CHECK(i2s_channel_enable(i2s_handle));
 }
 
 // Initialize the sound driver. Must be called before using sound.
@@ -160,7 +142,10 @@ static void i2s_tx_preload(i2s_chan_handle_t handle)
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_init(uint32_t sample_hz)
 {
+	mixer_init(&mix);
+	mixer_rate(&mix, sample_hz); // Assets at other rates are resampled
 	sound_set_volume(SOUND_VOLUME_DEFAULT);
+	mixer_defer(&mix, true); // Commands wait for the callback
 
 	/* * * * * * * * * * Sound Config * * * * * * * * * */
 	ESP_LOGI(TAG, "Configure I2S channel in Standard mode, Philips format, %lu Hz", sample_hz);
@@ -195,8 +180,10 @@ int32_t sound_init(uint32_t sample_hz)
 		.on_send_q_ovf = NULL,
 	};
 	ESP_ERROR_CHECK(i2s_channel_register_event_callback(i2s_handle, &cbs, NULL));
+	i2s_start();
+	device_en = true;
 
-	return 0;
+	return sndq_task_init(); // Scheduler of sound_post()
 }
 
 // Free resources used for sound (DAC, etc.).
@@ -204,39 +191,45 @@ int32_t sound_init(uint32_t sample_hz)
 int32_t sound_deinit(void)
 {
 	ESP_LOGI(TAG, "Stop I2S channel");
-	while (aidx < asize || dcnt); // busy
+	while (sound_busy()); // busy
+	sound_device(false);
 	ESP_ERROR_CHECK(i2s_del_channel(i2s_handle));
 	return 0;
 }
 
+// Start a sound on a voice of the mixer. The channel is running, so the
+// callback sends it from the next buffer it fills. Nothing plays while
+// the device is disabled.
+// cur: if not NULL, voice to stop first, set to the new voice under the
+//   lock.
+static sound_voice_t sound_mix(const void *audio, uint32_t size, bool loop, uint32_t gain, sound_voice_t *cur)
+{
+	sound_voice_t v = MIXER_NONE;
+	int64_t now = esp_timer_get_time();
+
+	portENTER_CRITICAL(&spinlock);
+	if (cur != NULL) mixer_stop(&mix, *cur);
+	if (device_en) {
+		mixer_now(&mix, now);
+		v = mixer_play_asset(&mix, audio, size, MIXER_S16, loop, gain*MIXER_UNITY/MAX_VOL);
+	}
+	if (cur != NULL) *cur = v;
+	portEXIT_CRITICAL(&spinlock);
+	return v;
+}
+
 // Start playing the sound immediately. Play the audio buffer once.
+// Sounds already playing go on, mixed with this one.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
 void sound_start(const void *audio, uint32_t size, bool wait)
 {
-	bool enable;
-
-	portENTER_CRITICAL(&spinlock);
-	enable = !(aidx < asize || dcnt);
-	abase = audio;
-	asize = size/sizeof(abase[0]);
-	aidx = 0;
-	cyclic = false;
-	dcnt = DMA_DESC_NUM;
-	portEXIT_CRITICAL(&spinlock);
-	if (enable) {
-		i2s_tx_preload(i2s_handle); // preload two DMA buffers
-		i2s_tx_preload(i2s_handle);
-		#if DMA_DEBUG
-		printf("missed0:%u,%u\n", missed_dat, missed_sil);
-		#endif
-		i2s_channel_enable(i2s_handle);
-	}
+	sound_voice_t v = sound_mix(audio, size, false, MAX_VOL, NULL);
 	#if DMA_DEBUG
 	printf("missed1:%u,%u\n", missed_dat, missed_sil);
 	#endif
-	while (wait && aidx < asize)
+	while (wait && sound_voice_busy(v))
 		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
 	#if DMA_DEBUG
 	printf("missed2:%u,%u\n", missed_dat, missed_sil);
@@ -244,59 +237,110 @@ void sound_start(const void *audio, uint32_t size, bool wait)
 }
 
 // Cyclically play samples from audio buffer until sound_stop() is called.
+// Replaces the sound of the last call, other sounds go on.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size)
 {
-	bool enable;
-
-	portENTER_CRITICAL(&spinlock);
-	enable = !(aidx < asize || dcnt);
-	abase = audio;
-	asize = size/sizeof(abase[0]);
-	aidx = 0;
-	cyclic = true;
-	dcnt = DMA_DESC_NUM;
-	portEXIT_CRITICAL(&spinlock);
-	if (enable) {
-		i2s_tx_preload(i2s_handle); // preload two DMA buffers
-		i2s_tx_preload(i2s_handle);
-		#if DMA_DEBUG
-		printf("missed0:%u,%u\n", missed_dat, missed_sil);
-		#endif
-		i2s_channel_enable(i2s_handle);
-	}
+	sound_mix(audio, size, true, MAX_VOL, &cyc);
 }
 
 // Return true if sound playing, otherwise return false.
 bool sound_busy(void)
 {
-	return aidx < asize;
+	portENTER_CRITICAL(&spinlock);
+	bool busy = mixer_active(&mix) != 0;
+	portEXIT_CRITICAL(&spinlock);
+	return busy;
 }
 
-// Stop playing the sound.
+// Stop playing all sounds.
 void sound_stop(void)
 {
 	portENTER_CRITICAL(&spinlock);
-	aidx = asize;
+	mixer_stop_all(&mix);
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Start playing a sound on a voice of the mixer, along with the sounds
+// already playing. If all voices are busy, the oldest sound is stopped.
+// audio: a pointer to an array of audio data.
+// size: the size of the array in bytes.
+// loop: if true, play until stopped, otherwise play once.
+// gain: 0-100% of the volume set by sound_set_volume().
+// Return the voice handle, or a negative value if nothing to play.
+sound_voice_t sound_play(const void *audio, uint32_t size, bool loop, uint32_t gain)
+{
+	return sound_mix(audio, size, loop, gain, NULL);
+}
+
+// Return true if the sound of a voice is still playing.
+bool sound_voice_busy(sound_voice_t v)
+{
+	portENTER_CRITICAL(&spinlock);
+	bool busy = mixer_busy(&mix, v);
+	portEXIT_CRITICAL(&spinlock);
+	return busy;
+}
+
+// Stop the sound of a voice. Ignored if the sound already ended.
+void sound_voice_stop(sound_voice_t v)
+{
+	portENTER_CRITICAL(&spinlock);
+	mixer_stop(&mix, v);
 	portEXIT_CRITICAL(&spinlock);
 }
 
-// Set the volume.
-// volume: 0-100% as an integer value.
+// Set the gain of a voice.
+// gain: 0-100% of the volume set by sound_set_volume().
+void sound_voice_gain(sound_voice_t v, uint32_t gain)
+{
+	portENTER_CRITICAL(&spinlock);
+	mixer_gain(&mix, v, gain*MIXER_UNITY/MAX_VOL);
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Set the volume. A change ramps over a few samples, with no click.
+// volume: 0-100% as an integer value, on a log scale (mixer_volume()).
 // https://www.dr-lex.be/info-stuff/volumecontrols.html
 // https://en.wikipedia.org/wiki/Audio_bit_depth
 void sound_set_volume(uint32_t vol)
 {
-	// TODO: use an exponential volume control.
-	volume = vol;
+	portENTER_CRITICAL(&spinlock);
+	mixer_master(&mix, mixer_volume(vol*MIXER_VOLUME_MAX/PERCENT));
+	portEXIT_CRITICAL(&spinlock);
 }
 
-// Enable or disable the sound output device.
+// Enable or disable the sound output device. Disabling stops the sounds
+// and the I2S channel, enabling starts the channel again with silence.
 // enable: if true, enable sound, otherwise disable.
 void sound_device(bool enable)
 {
-	// TODO: implement sound_device() enable, disable.
-	// ESP_ERROR_CHECK(i2s_channel_disable(i2s_handle)); // only if enabled
-	// ESP_ERROR_CHECK(i2s_channel_enable(i2s_handle)); // only if disabled
+	if (enable == device_en) return;
+	if (enable) {
+		i2s_start();
+		device_en = true;
+	} else {
+		portENTER_CRITICAL(&spinlock);
+		device_en = false;
+		mixer_stop_all(&mix);
+		portEXIT_CRITICAL(&spinlock);
+		ESP_ERROR_CHECK(i2s_channel_disable(i2s_handle));
+	}
+}
+
+// Get the latency of sound starts since sound_init(), from the mixer.
+// max_us: longest latency in microseconds.
+// mean_us: mean latency in microseconds.
+// Return the number of starts measured.
+uint32_t sound_latency(uint32_t *max_us, uint32_t *mean_us)
+{
+	mixer_stats_t st;
+
+	portENTER_CRITICAL(&spinlock);
+	st = mix.stats;
+	portEXIT_CRITICAL(&spinlock);
+	*max_us = st.lat_max;
+	*mean_us = st.starts ? st.lat_sum/st.starts : 0;
+	return st.starts;
 }
@@ -12,9 +12,11 @@
 #include "driver/dac_oneshot.h"
 
 #include "hw.h"
+#include "mixer.h"
+#include "sndq.h"
 #include "sound.h"
 
-// Make audio buffer extern for testing
+// Make mixer state extern for testing
 #ifdef EXTERN_BUF
 #define scope
 #else
@@ -26,44 +28,59 @@
 
 #define GPTIMER_RESOLUTION_HZ 1000000
 
-#define SOUND_VOLUME_DEFAULT 50
+#define SOUND_VOLUME_DEFAULT 85 // -6 dB
 #define SILENCE 0x80U
 #define POLL_DELAY 10
 #define PERCENT 100U
+#define ONE_BLOCK 32 // Samples rendered at a time by the timer ISR
 
 static const char *TAG = "sound";
 
 // Critical section protected variables
 static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
-scope  const uint8_t *abase;
-scope  volatile uint32_t asize;
-static volatile uint32_t aidx;
-static volatile bool     cyclic;
+scope  mixer_t mix;
+static volatile bool     quiet; // Silence sent after the last sound
+static sound_voice_t cyc = MIXER_NONE; // Voice of sound_cyclic()
+
+// Owned by the timer ISR
+static int16_t blk[ONE_BLOCK]; // Samples of the block being sent
+static uint32_t pos = ONE_BLOCK; // Next sample of the block
+static bool sound; // The block has voices
 
 // Other global variables
 static dac_oneshot_handle_t dac_handle;
 static gptimer_handle_t dac_timer;
 static volatile bool device_en;
-static volatile uint32_t volume;
-static volatile uint8_t bias; // to prevent popping at end when vol low.
 
 
-// DAC timer ISR callback
+// DAC timer ISR callback. Sends one sample per call from a block of
+// ONE_BLOCK samples. At the start of each block, the lock is taken once to
+// report the sounds that ended in the last block and apply the voice
+// commands waiting, then the block is rendered outside it. The other
+// samples take no lock.
 static bool IRAM_ATTR dac_timer_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_ctx)
 {
-	// TODO: why does critical section cause abort?
-	// portENTER_CRITICAL_ISR(&spinlock);
-	if (aidx < asize) {
-		uint32_t idx = aidx;
-		aidx =  cyclic ? (aidx + 1) % asize : aidx + 1;
-		// portEXIT_CRITICAL_ISR(&spinlock);
-		dac_oneshot_output_voltage(dac_handle, abase[idx]*volume/PERCENT + bias);
-	} else if (aidx == asize) {
-		aidx++;
-		// portEXIT_CRITICAL_ISR(&spinlock);
+	bool woken = false;
+
+	if (pos == ONE_BLOCK) {
+		bool ended;
+		portENTER_CRITICAL_ISR(&spinlock);
+		ended = mixer_end(&mix);
+		sound = mixer_begin(&mix, 0);
+		portEXIT_CRITICAL_ISR(&spinlock);
+		if (sound) mixer_block(&mix, blk, ONE_BLOCK);
+		pos = 0;
+		if (ended) woken = sndq_wake_isr(); // A sound ended, start the next one
+	}
+	if (sound) {
+		quiet = false;
+		dac_oneshot_output_voltage(dac_handle, (blk[pos] >> 8) + SILENCE);
+	} else if (!quiet) {
+		quiet = true;
 		dac_oneshot_output_voltage(dac_handle, SILENCE);
 	}
-	return false; // no high priority task awoken
+	pos++;
+	return woken;
 }
 
 // Initialize the sound driver. Must be called before using sound.
@@ -72,7 +89,10 @@ static bool IRAM_ATTR dac_timer_isr(gptimer_handle_t timer, const gptimer_alarm_
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_init(uint32_t sample_hz)
 {
+	mixer_init(&mix);
+	mixer_rate(&mix, sample_hz); // Assets at other rates are resampled
 	sound_set_volume(SOUND_VOLUME_DEFAULT);
+	mixer_defer(&mix, true); // Commands wait for the timer ISR
 
 	// if the first time called, configure pins
 	if (dac_handle == NULL) {
@@ -138,7 +158,7 @@ int32_t sound_init(uint32_t sample_hz)
 		ESP_LOGI(TAG, "alarm_count: %llu", dac_alarm_config.alarm_count);
 		ESP_ERROR_CHECK(gptimer_set_alarm_action(dac_timer, &dac_alarm_config));
 	}
-	return 0;
+	return sndq_task_init(); // Scheduler of sound_post()
 }
 
 // Free resources used for sound (DAC, etc.).
@@ -155,55 +175,104 @@ int32_t sound_deinit(void)
 	return 0;
 }
 
+// Start a sound on a voice of the mixer.
+// cur: if not NULL, voice to stop first, set to the new voice under the
+//   lock.
+static sound_voice_t sound_mix(const void *audio, uint32_t size, bool loop, uint32_t gain, sound_voice_t *cur)
+{
+	sound_voice_t v;
+
+	portENTER_CRITICAL(&spinlock);
+	if (cur != NULL) mixer_stop(&mix, *cur);
+	v = mixer_play_asset(&mix, audio, size, MIXER_U8, loop, gain*MIXER_UNITY/MAX_VOL);
+	if (cur != NULL) *cur = v;
+	portEXIT_CRITICAL(&spinlock);
+	return v;
+}
+
 // Start playing the sound immediately. Play the audio buffer once.
+// Sounds already playing go on, mixed with this one.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
 void sound_start(const void *audio, uint32_t size, bool wait)
 {
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = false;
-	portEXIT_CRITICAL(&spinlock);
-	while (wait && aidx < asize)
+	sound_voice_t v = sound_mix(audio, size, false, MAX_VOL, NULL);
+	while (wait && sound_voice_busy(v))
 		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
 }
 
 // Cyclically play samples from audio buffer until sound_stop() is called.
+// Replaces the sound of the last call, other sounds go on.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size)
 {
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = true;
-	portEXIT_CRITICAL(&spinlock);
+	sound_mix(audio, size, true, MAX_VOL, &cyc);
 }
 
 // Return true if sound playing, otherwise return false.
 bool sound_busy(void)
 {
-	return aidx < asize;
+	portENTER_CRITICAL(&spinlock);
+	bool busy = mixer_active(&mix) != 0;
+	portEXIT_CRITICAL(&spinlock);
+	return busy;
 }
 
-// Stop playing the sound.
+// Stop playing all sounds.
 void sound_stop(void)
 {
 	portENTER_CRITICAL(&spinlock);
-	aidx = asize;
+	mixer_stop_all(&mix);
 	portEXIT_CRITICAL(&spinlock);
 }
 
-// Set the volume.
-// volume: 0-100% as an integer value.
+// Start playing a sound on a voice of the mixer, along with the sounds
+// already playing. If all voices are busy, the oldest sound is stopped.
+// audio: a pointer to an array of audio data.
+// size: the size of the array in bytes.
+// loop: if true, play until stopped, otherwise play once.
+// gain: 0-100% of the volume set by sound_set_volume().
+// Return the voice handle, or a negative value if nothing to play.
+sound_voice_t sound_play(const void *audio, uint32_t size, bool loop, uint32_t gain)
+{
+	return sound_mix(audio, size, loop, gain, NULL);
+}
+
+// Return true if the sound of a voice is still playing.
+bool sound_voice_busy(sound_voice_t v)
+{
+	portENTER_CRITICAL(&spinlock);
+	bool busy = mixer_busy(&mix, v);
+	portEXIT_CRITICAL(&spinlock);
+	return busy;
+}
+
+// Stop the sound of a voice. Ignored if the sound already ended.
+void sound_voice_stop(sound_voice_t v)
+{
+	portENTER_CRITICAL(&spinlock);
+	mixer_stop(&mix, v);
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Set the gain of a voice.
+// gain: 0-100% of the volume set by sound_set_volume().
+void sound_voice_gain(sound_voice_t v, uint32_t gain)
+{
+	portENTER_CRITICAL(&spinlock);
+	mixer_gain(&mix, v, gain*MIXER_UNITY/MAX_VOL);
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Set the volume. A change ramps over a few samples, with no click.
+// volume: 0-100% as an integer value, on a log scale (mixer_volume()).
 void sound_set_volume(uint32_t vol)
 {
-	volume = vol;
-	bias = SILENCE - (SILENCE * vol / PERCENT);
+	portENTER_CRITICAL(&spinlock);
+	mixer_master(&mix, mixer_volume(vol*MIXER_VOLUME_MAX/PERCENT));
+	portEXIT_CRITICAL(&spinlock);
 }
 
 // Enable or disable the sound output device.
@@ -212,3 +281,13 @@ void sound_device(bool enable)
 {
 	gpio_set_level(SOUND_EN, device_en = enable);
 }
+
+// Get the latency of sound starts. Not measured: the timer ISR renders a
+// block of ONE_BLOCK samples at a time, so a sound starts within one
+// block period.
+// Return zero starts measured.
+uint32_t sound_latency(uint32_t *max_us, uint32_t *mean_us)
+{
+	*max_us = *mean_us = 0;
+	return 0;
+}
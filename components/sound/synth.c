@@ -0,0 +1,155 @@
+#include <math.h> // sinf
+#include <stdbool.h>
+#include <string.h> // memset
+
+#include "esp_attr.h" // IRAM_ATTR, DRAM_ATTR
+
+#include "synth.h"
+
+#define SINE_BITS 8 // log2 of the sine table size
+#define STAGES 4 // Attack, decay, sustain, release
+#define NOISE_SEED 0x2545F491U
+#define ENV_SHIFT 15 // Q30 envelope to Q15
+
+static DRAM_ATTR int16_t sine[1 << SINE_BITS];
+static bool sine_built;
+
+void synth_init(void)
+{
+	if (sine_built) return;
+	for (uint32_t i = 0; i < (1 << SINE_BITS); i++)
+		sine[i] = lrintf(INT16_MAX * sinf(2.0f * (float)M_PI * i / (1 << SINE_BITS)));
+	sine_built = true;
+}
+
+// Return the samples of a stage of the envelope.
+static inline uint32_t synth_samples(const synth_patch_t *p, uint32_t stage, uint32_t rate)
+{
+	uint32_t ms = (stage == 0) ? p->attack : (stage == 1) ? p->decay :
+		(stage == 2) ? p->sustain : p->release;
+	return (uint64_t)ms * rate / 1000;
+}
+
+// Return the samples of a note.
+static inline uint32_t synth_note_len(const synth_patch_t *p, uint32_t rate)
+{
+	uint32_t len = 0;
+	for (uint32_t i = 0; i < STAGES; i++) len += synth_samples(p, i, rate);
+	return len;
+}
+
+// Return the phase per sample of a frequency.
+static inline uint32_t synth_inc(uint32_t hz, uint32_t rate)
+{
+	return ((uint64_t)hz << 32) / rate;
+}
+
+// Enter the stage of the envelope in s->stage, skipping stages of no
+// length.
+static void IRAM_ATTR synth_stage(synth_state_t *s, const synth_patch_t *p)
+{
+	int32_t peak = (int32_t)p->volume << ENV_SHIFT;
+	int32_t hold = (int32_t)(((uint32_t)p->volume * p->level) >> 15) << ENV_SHIFT;
+
+	for (; s->stage < STAGES; s->stage++) {
+		int32_t target = (s->stage == 0) ? peak : (s->stage < 3) ? hold : 0;
+		s->left = synth_samples(p, s->stage, s->rate);
+		if (s->left) {
+			s->denv = (target - s->env) / (int32_t)s->left;
+			return;
+		}
+		s->env = target;
+	}
+}
+
+// Start a note.
+static void IRAM_ATTR synth_note(synth_state_t *s, const synth_patch_t *p)
+{
+	uint32_t len = synth_note_len(p, s->rate);
+
+	s->inc = synth_inc(p->freq, s->rate);
+	s->dinc = len ? ((int64_t)synth_inc(p->freq_end, s->rate) - s->inc) / len : 0;
+	s->env = 0;
+	s->stage = 0;
+	synth_stage(s, p);
+}
+
+// Return the next value of the noise generator (xorshift32).
+static inline uint32_t synth_rand(synth_state_t *s)
+{
+	uint32_t x = s->rnd;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return s->rnd = x;
+}
+
+uint32_t IRAM_ATTR synth_start(synth_state_t *s, const synth_patch_t *p, uint32_t rate)
+{
+	uint32_t notes = (p->repeat > 1) ? p->repeat : 1;
+
+	memset(s, 0, sizeof(*s));
+	s->rate = rate;
+	s->rnd = NOISE_SEED;
+	s->noise = (int16_t)(synth_rand(s) >> 16);
+	s->notes = notes - 1;
+	synth_note(s, p);
+	return synth_note_len(p, rate) * notes;
+}
+
+void IRAM_ATTR synth_render(synth_state_t *s, const synth_patch_t *p, uint32_t idx, int16_t *out, uint32_t n)
+{
+	uint32_t duty = (p->duty ? p->duty : 128U) << 24;
+	int32_t mask = ~((1 << (p->crush & 15)) - 1);
+
+	if (idx == 0) synth_start(s, p, s->rate);
+	while (n) {
+		if (s->stage >= STAGES) { // End of a note
+			if (!s->notes) {
+				memset(out, 0, n*sizeof(out[0]));
+				return;
+			}
+			s->notes--;
+			synth_note(s, p);
+			continue;
+		}
+		if (!s->left) {
+			s->stage++;
+			synth_stage(s, p);
+			continue;
+		}
+		uint32_t run = (n < s->left) ? n : s->left;
+		for (uint32_t i = 0; i < run; i++) {
+			int32_t osc;
+			switch (p->wave) {
+			case SYNTH_SQUARE: osc = (s->phase < duty) ? INT16_MAX : -INT16_MAX; break;
+			case SYNTH_SAW: osc = (int32_t)(s->phase >> 16) - 32768; break;
+			case SYNTH_TRIANGLE: {
+				int32_t t = s->phase >> 15;
+				osc = (t < 65536) ? t - 32768 : 98303 - t;
+				break;
+			}
+			case SYNTH_SINE: osc = sine[s->phase >> (32 - SINE_BITS)]; break;
+			default: osc = s->noise; break;
+			}
+			int32_t y = ((osc * (s->env >> ENV_SHIFT)) >> 15) & mask;
+			if (p->hold > 1) {
+				if (!s->hcnt) {
+					s->held = y;
+					s->hcnt = p->hold;
+				}
+				s->hcnt--;
+				y = s->held;
+			}
+			out[i] = y;
+			uint32_t ph = s->phase + s->inc;
+			if (ph < s->phase) s->noise = (int16_t)(synth_rand(s) >> 16); // New period
+			s->phase = ph;
+			s->inc += s->dinc;
+			s->env += s->denv;
+		}
+		out += run;
+		n -= run;
+		s->left -= run;
+	}
+}
@@ -0,0 +1,84 @@
+#ifndef SYNTH_H_
+#define SYNTH_H_
+
+#include <stdint.h>
+
+// Sound effect synthesizer. An effect is a patch record of a few dozen
+// bytes in place of its samples: an oscillator with a frequency sweep,
+// an ADSR envelope, and a bit-crush, played for one or more notes. The
+// mixer renders a patch block by block in the DMA fill, like a sound of
+// samples (see MIXER_SYNTH and synth_asset_t in asset.h), so a patch can
+// be changed while the game runs.
+//
+// Rendering uses only integer operations, so a patch renders to the same
+// samples on the target and a host, except for the sine table.
+
+#define SYNTH_RATE 32000 // Rate in Hz when the mixer has none set
+#define SYNTH_UNITY 0x8000U // Level of one in Q15
+
+// Oscillator wave
+typedef enum {
+	SYNTH_SQUARE, // Square with a duty cycle
+	SYNTH_SAW, // Rising saw
+	SYNTH_TRIANGLE,
+	SYNTH_SINE, // From a table
+	SYNTH_NOISE, // White noise, a new value each period
+} synth_wave_t;
+
+// Patch of an effect. Times are in ms, and each note lasts
+// attack+decay+sustain+release.
+typedef struct {
+	uint8_t wave; // synth_wave_t
+	uint8_t duty; // Of a square, in 1/256 of a period, 0 for 128
+	uint8_t crush; // Low bits of each sample cleared, 0 for none
+	uint8_t hold; // Samples each output is held for, 0 or 1 for none
+	uint16_t freq; // Frequency at the start of a note, Hz
+	uint16_t freq_end; // Frequency at the end of a note, Hz, linear sweep
+	uint16_t attack; // Rise from zero to the volume
+	uint16_t decay; // Fall from the volume to the sustain level
+	uint16_t sustain; // Time at the sustain level
+	uint16_t release; // Fall from the sustain level to zero
+	uint16_t level; // Sustain level, Q15 of the volume
+	uint16_t volume; // Peak level, Q15
+	uint8_t repeat; // Notes played, 0 or 1 for one
+	uint8_t reserved[3];
+} synth_patch_t;
+
+// Render state of a patch
+typedef struct {
+	uint32_t rate; // Output rate in Hz
+	uint32_t phase; // Q32 of a period
+	uint32_t inc; // Phase per sample
+	int32_t dinc; // Change of inc per sample, the sweep
+	int32_t env; // Envelope, Q30
+	int32_t denv; // Change of env per sample
+	uint32_t left; // Samples left in the stage
+	uint32_t rnd; // Noise generator
+	int16_t noise; // Noise value of the period
+	int16_t held; // Output held by hold
+	uint8_t stage; // Envelope stage
+	uint8_t notes; // Notes left after this one
+	uint8_t hcnt; // Samples left of the held output
+} synth_state_t;
+
+// Build the sine table. Called by mixer_init().
+void synth_init(void);
+
+// Start a patch.
+// s: render state.
+// p: patch, must stay valid while it plays.
+// rate: output rate in Hz.
+// Returns the length of the effect in samples.
+uint32_t synth_start(synth_state_t *s, const synth_patch_t *p, uint32_t rate);
+
+// Render samples of a patch, in order, in pieces of any size. A piece
+// that starts at sample zero starts the patch over, at the rate given to
+// synth_start(). Samples past the end are silent.
+// s: render state.
+// p: patch.
+// idx: index of the first sample to render.
+// out: signed 16-bit samples.
+// n: number of samples.
+void synth_render(synth_state_t *s, const synth_patch_t *p, uint32_t idx, int16_t *out, uint32_t n);
+
+#endif // SYNTH_H_
@@ -0,0 +1,1134 @@
+
+#include <stdint.h>
+
+const uint8_t bcFire[] = {
+ 0x4c, 0x53, 0x4e, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00,
+ 0xff, 0xff, 0x00, 0x00, 0x91, 0x19, 0x19, 0x91, 0x19, 0x00, 0x90, 0x11, 0x1a, 0xa3, 0x3a, 0xb1,
+ 0x11, 0x10, 0x99, 0xb3, 0x39, 0xb0, 0x12, 0x9f, 0x23, 0x90, 0xa0, 0x74, 0x86, 0x08, 0xa8, 0xa8,
+ 0xab, 0x92, 0x9a, 0xaf, 0x63, 0x91, 0x00, 0x9a, 0x90, 0x1a, 0x92, 0xbf, 0x18, 0x28, 0x32, 0x05,
+ 0x70, 0x15, 0x77, 0x35, 0xfc, 0xdf, 0x08, 0x76, 0xd2, 0x1d, 0x84, 0x0a, 0x84, 0x9d, 0x22, 0x98,
+ 0x1a, 0x82, 0x0a, 0xa2, 0x70, 0xc2, 0x28, 0xda, 0x32, 0xcb, 0x33, 0xaa, 0x13, 0x8a, 0x00, 0x9c,
+ 0x32, 0xa8, 0x53, 0xda, 0x20, 0xb9, 0x60, 0xb0, 0x8a, 0x30, 0x83, 0x4a, 0x95, 0xae, 0x40, 0x82,
+ 0xab, 0x21, 0xe9, 0x38, 0x05, 0xaa, 0x00, 0x89, 0x32, 0x91, 0xb8, 0xac, 0x20, 0x14, 0x18, 0xb1,
+ 0x9f, 0x22, 0x08, 0x82, 0x9b, 0x82, 0xae, 0x63, 0x81, 0x88, 0x98, 0x08, 0x99, 0x22, 0xda, 0x40,
+ 0xb2, 0x0d, 0x35, 0xb0, 0x9c, 0x80, 0x08, 0x23, 0xc0, 0x19, 0x83, 0x9c, 0x98, 0x72, 0xb1, 0x0b,
+ 0x24, 0xa9, 0x73, 0x90, 0xba, 0x1a, 0xd2, 0x2b, 0x05, 0x88, 0x20, 0x86, 0xac, 0x31, 0xb0, 0xaa,
+ 0x08, 0x46, 0xa1, 0x0a, 0x15, 0xfb, 0x18, 0x00, 0x88, 0x00, 0x01, 0x10, 0x90, 0x89, 0x88, 0xb0,
+ 0x8d, 0x02, 0x71, 0x94, 0x9b, 0x00, 0xa8, 0x1a, 0x85, 0x9d, 0x43, 0x82, 0x0b, 0x05, 0xcb, 0x01,
+ 0xac, 0x64, 0x92, 0xcb, 0x50, 0xa2, 0xac, 0x62, 0x92, 0x9a, 0x9a, 0x11, 0x10, 0x12, 0x10, 0xe9,
+ 0x39, 0xa3, 0xaf, 0x48, 0xb3, 0x9d, 0x54, 0xa1, 0x9b, 0x52, 0xa0, 0x9a, 0x8a, 0x30, 0x81, 0x28,
+ 0x45, 0xb0, 0xac, 0x09, 0x01, 0x08, 0x41, 0x26, 0xdb, 0x8b, 0x22, 0x98, 0x72, 0x84, 0xbf, 0x39,
+ 0x02, 0x18, 0xa2, 0x9f, 0x32, 0x80, 0xa0, 0x0c, 0x81, 0x42, 0xfb, 0x30, 0x91, 0x9b, 0x50, 0xb8,
+ 0x91, 0xe7, 0x41, 0x00, 0x43, 0xc8, 0x3a, 0xc3, 0x2c, 0x94, 0x0b, 0x83, 0x88, 0x8b, 0x26, 0x9d,
+ 0x13, 0x9a, 0x99, 0x52, 0xa9, 0x9a, 0x73, 0xa8, 0x32, 0xae, 0x23, 0xa9, 0x08, 0x11, 0x98, 0x00,
+ 0x89, 0x08, 0x82, 0x7c, 0xb4, 0x2e, 0xa1, 0x30, 0xaa, 0x86, 0x1c, 0xb3, 0x38, 0xbc, 0x16, 0x9a,
+ 0xa8, 0x73, 0xca, 0x23, 0xab, 0x33, 0xab, 0x19, 0x01, 0xc9, 0x51, 0xe8, 0x50, 0xa8, 0x18, 0x19,
+ 0xb1, 0x49, 0xc0, 0x18, 0x21, 0xeb, 0x53, 0xac, 0x23, 0x9b, 0x11, 0x00, 0x8c, 0x86, 0x8c, 0x24,
+ 0xeb, 0x42, 0xd8, 0x28, 0x81, 0x99, 0x31, 0xda, 0x42, 0xc9, 0x20, 0x91, 0x0b, 0x86, 0x8c, 0x14,
+ 0xab, 0x33, 0xd9, 0x48, 0xb1, 0x2a, 0x95, 0x8b, 0x24, 0xac, 0x32, 0xd8, 0x48, 0xb1, 0x3a, 0xa3,
+ 0x0c, 0x13, 0xcb, 0x52, 0xb8, 0x28, 0x91, 0x19, 0xc1, 0x5b, 0xb2, 0x1b, 0x05, 0x9c, 0x24, 0xdb,
+ 0x50, 0xb1, 0x1b, 0x05, 0x9c, 0x32, 0xc8, 0x29, 0x83, 0x8b, 0xa2, 0x7b, 0xc2, 0x2b, 0x85, 0x8c,
+ 0x23, 0xc9, 0x48, 0xa1, 0x0b, 0x14, 0xab, 0x32, 0xba, 0x63, 0xca, 0x41, 0xa8, 0x0a, 0x21, 0x89,
+ 0xa0, 0x7a, 0xb4, 0x1c, 0x13, 0xea, 0x39, 0x84, 0xaa, 0x38, 0x13, 0xca, 0x0a, 0x25, 0xca, 0x1a,
+ 0x24, 0xda, 0x28, 0x02, 0x8a, 0x98, 0x52, 0xc8, 0x28, 0xa0, 0x39, 0x95, 0x8c, 0x05, 0x8a, 0x03,
+ 0xac, 0x31, 0x91, 0x99, 0x9a, 0x37, 0xc0, 0x8c, 0x13, 0x10, 0xd8, 0x3a, 0x15, 0xab, 0x00, 0x89,
+ 0x34, 0xcb, 0x38, 0x92, 0x49, 0xa3, 0xae, 0x10, 0x31, 0x93, 0xdf, 0x41, 0x02, 0xbb, 0x0a, 0x62,
+ 0xa2, 0xab, 0x11, 0x28, 0x02, 0xbc, 0x29, 0x01, 0x43, 0xd0, 0xab, 0x42, 0x04, 0xaa, 0x30, 0x93,
+ 0xbf, 0x63, 0x92, 0xcd, 0x19, 0x42, 0x82, 0xbc, 0x1a, 0x43, 0x02, 0xe9, 0x8b, 0x20, 0x63, 0xa1,
+ 0xca, 0xeb, 0x4c, 0x00, 0x9a, 0x28, 0x34, 0x82, 0xcc, 0x8c, 0x31, 0x34, 0xc0, 0x9e, 0x18, 0x42,
+ 0x82, 0xca, 0x9a, 0x20, 0x44, 0x90, 0xbb, 0x0c, 0x21, 0x53, 0xa0, 0xbb, 0x9c, 0x41, 0x44, 0xa1,
+ 0xa9, 0xac, 0x10, 0x63, 0x83, 0xa9, 0xcb, 0x1a, 0x73, 0x02, 0xa9, 0xcb, 0x19, 0x52, 0x13, 0xa9,
+ 0xcc, 0x19, 0x32, 0x15, 0x98, 0xdb, 0x0a, 0x21, 0x34, 0x91, 0xda, 0x9c, 0x00, 0x53, 0x82, 0x99,
+ 0xba, 0x30, 0x83, 0xaa, 0x9a, 0x72, 0x15, 0x99, 0xb8, 0x8d, 0x00, 0x51, 0x23, 0xb8, 0xbc, 0xbb,
+ 0x38, 0x45, 0x22, 0xa8, 0xcc, 0xac, 0x20, 0x32, 0x43, 0x90, 0x8a, 0xb9, 0xad, 0x0a, 0x54, 0x23,
+ 0x02, 0xa9, 0xc9, 0xbc, 0x2a, 0x37, 0x02, 0x80, 0xca, 0x9d, 0x08, 0x20, 0x35, 0x00, 0x99, 0xbd,
+ 0x0b, 0x88, 0x54, 0x22, 0x12, 0xda, 0xbb, 0x9b, 0x60, 0x23, 0x20, 0x92, 0xcc, 0xac, 0x19, 0x21,
+ 0x33, 0x11, 0xa2, 0xcf, 0x90, 0x09, 0x21, 0x13, 0x53, 0xc8, 0x09, 0x00, 0xb0, 0x0b, 0xfa, 0x8a,
+ 0x52, 0xa2, 0x1b, 0x93, 0xcd, 0x19, 0x43, 0x33, 0x91, 0xbb, 0x88, 0x21, 0x92, 0x58, 0xc0, 0x39,
+ 0xa4, 0x0c, 0xd2, 0x9e, 0xa8, 0x71, 0x14, 0x88, 0xbc, 0x09, 0x98, 0x18, 0x88, 0x72, 0x16, 0x00,
+ 0xa9, 0x8a, 0x10, 0x81, 0x8a, 0xa9, 0x71, 0x32, 0xa1, 0xcd, 0xac, 0x99, 0x30, 0x12, 0x71, 0x33,
+ 0x80, 0xaa, 0xc9, 0xae, 0x8a, 0x10, 0x33, 0x45, 0x91, 0x18, 0x03, 0x99, 0xaa, 0xcd, 0xba, 0x0b,
+ 0x25, 0x28, 0x25, 0xca, 0x1b, 0x23, 0x99, 0xa0, 0xac, 0xa8, 0x28, 0x55, 0x93, 0x0a, 0x02, 0x51,
+ 0x03, 0x11, 0xfb, 0x8c, 0xa9, 0x42, 0x81, 0x18, 0x24, 0xa1, 0xac, 0xd8, 0xae, 0x00, 0x10, 0x11,
+ 0x43, 0x32, 0x82, 0xaa, 0xad, 0x20, 0xa0, 0xbd, 0x30, 0x30, 0x37, 0x13, 0x80, 0x98, 0xdc, 0xbc,
+ 0x4a, 0xed, 0x43, 0x00, 0x33, 0xd8, 0x8a, 0xba, 0x19, 0x73, 0x14, 0x31, 0x11, 0xa2, 0xce, 0xba,
+ 0x9b, 0x29, 0x02, 0x61, 0x23, 0x80, 0x49, 0x27, 0x98, 0xa9, 0xbe, 0x9c, 0x08, 0x01, 0x22, 0x23,
+ 0x33, 0x81, 0xb8, 0x8d, 0x20, 0x04, 0xcf, 0x09, 0x08, 0x91, 0x18, 0x91, 0x8c, 0x55, 0x02, 0x31,
+ 0x82, 0xcd, 0x0a, 0x02, 0x8a, 0x80, 0xcd, 0x9a, 0x29, 0x45, 0x13, 0x01, 0xb8, 0x2a, 0x02, 0x48,
+ 0x03, 0xdd, 0xac, 0x8a, 0x50, 0x14, 0x01, 0x90, 0xbb, 0x99, 0xba, 0x0b, 0x44, 0x01, 0x62, 0x32,
+ 0x24, 0x11, 0x81, 0x18, 0xb1, 0xdf, 0xaa, 0xba, 0x9b, 0x38, 0x36, 0x22, 0x90, 0x9b, 0x51, 0x36,
+ 0x02, 0x98, 0xcc, 0x9c, 0x99, 0x18, 0x90, 0xaa, 0x90, 0x0b, 0x47, 0x41, 0x26, 0x00, 0x98, 0x10,
+ 0x81, 0xab, 0xfb, 0x9d, 0x99, 0x18, 0x98, 0x42, 0x98, 0x11, 0x64, 0x82, 0x00, 0x89, 0xb9, 0xac,
+ 0x9b, 0x22, 0x30, 0x14, 0x92, 0xad, 0x01, 0x09, 0x46, 0xd0, 0xab, 0x88, 0x21, 0x21, 0xb2, 0x9c,
+ 0x18, 0x44, 0x21, 0x02, 0xfc, 0x8c, 0x11, 0x62, 0xa2, 0xab, 0xba, 0x19, 0x80, 0x59, 0x15, 0x99,
+ 0x19, 0x36, 0x81, 0x21, 0xc9, 0x0b, 0x35, 0xca, 0x9a, 0xab, 0xeb, 0x0a, 0x03, 0x30, 0x04, 0x9b,
+ 0x01, 0xdb, 0x58, 0x35, 0x92, 0x99, 0xd8, 0x0c, 0x33, 0x04, 0xaa, 0x98, 0xbc, 0x39, 0x57, 0x9a,
+ 0x28, 0x88, 0x89, 0x24, 0xc9, 0xbb, 0x08, 0x00, 0x73, 0x11, 0x01, 0xb9, 0x09, 0x18, 0x23, 0x22,
+ 0xfc, 0xaa, 0x2a, 0x17, 0xc9, 0x9b, 0x11, 0x81, 0x21, 0x92, 0x8e, 0x44, 0x80, 0x18, 0x91, 0x0c,
+ 0x33, 0xd8, 0xbe, 0x09, 0x10, 0x32, 0x26, 0xc8, 0xaa, 0x29, 0x23, 0x52, 0xe0, 0x89, 0x08, 0x80,
+ 0x31, 0xb0, 0xbd, 0x51, 0xa2, 0x19, 0x98, 0x36, 0xdb, 0x61, 0x02, 0x88, 0x81, 0xb9, 0x9c, 0x31,
+ 0x8c, 0x27, 0x42, 0x00, 0xc8, 0xac, 0xac, 0x20, 0x10, 0x23, 0xb9, 0x19, 0x41, 0x17, 0xa9, 0x43,
+ 0xb8, 0xab, 0x19, 0x26, 0xaa, 0x44, 0x00, 0x99, 0x50, 0x91, 0x18, 0x50, 0x94, 0x0b, 0xb0, 0x59,
+ 0xc1, 0xae, 0x89, 0x80, 0x01, 0xa8, 0x09, 0xa3, 0xcf, 0x44, 0x82, 0x08, 0x01, 0xb9, 0xa9, 0x49,
+ 0x02, 0x91, 0x8f, 0x14, 0x99, 0x19, 0x06, 0xab, 0x32, 0x11, 0x20, 0xc8, 0x38, 0xf1, 0xae, 0x50,
+ 0xa1, 0x89, 0x89, 0x23, 0x80, 0x9a, 0x34, 0x21, 0xf0, 0x1f, 0x11, 0x88, 0x08, 0x10, 0x41, 0xc1,
+ 0x1b, 0x15, 0x88, 0xaa, 0xeb, 0x49, 0x03, 0x88, 0xb9, 0x40, 0x92, 0x9f, 0x20, 0xa0, 0x8c, 0x8a,
+ 0x33, 0x80, 0x17, 0xbb, 0x08, 0x30, 0xa1, 0x9b, 0x73, 0xb1, 0x8b, 0x89, 0x25, 0xb9, 0x50, 0xc3,
+ 0x9f, 0x11, 0x80, 0x41, 0x13, 0xcb, 0x08, 0x18, 0x34, 0xa0, 0xeb, 0x0a, 0x00, 0x22, 0xfc, 0x38,
+ 0xa2, 0x0c, 0x91, 0x58, 0x03, 0x90, 0xbc, 0x09, 0x43, 0x01, 0xfa, 0x0d, 0x02, 0x00, 0x11, 0x82,
+ 0x9d, 0x21, 0x12, 0x28, 0xd2, 0x3b, 0xa5, 0x8e, 0x22, 0xaa, 0x53, 0xeb, 0x29, 0x90, 0x18, 0xa3,
+ 0x1d, 0x84, 0x8b, 0x06, 0x8a, 0x23, 0xbc, 0x43, 0xfb, 0x40, 0xa0, 0x19, 0x92, 0x0a, 0x94, 0x0c,
+ 0x14, 0x9b, 0x23, 0xca, 0x51, 0xa8, 0x40, 0xd8, 0x3a, 0x93, 0x1b, 0x85, 0x9c, 0x02, 0x29, 0x26,
+ 0xbb, 0x28, 0xb9, 0x51, 0xa8, 0x30, 0xd8, 0x30, 0xd3, 0x9c, 0x13, 0x9b, 0x04, 0xbb, 0x45, 0xc9,
+ 0x58, 0x91, 0x19, 0x91, 0x0c, 0x23, 0xba, 0x32, 0xcd, 0x60, 0xa2, 0x0c, 0x83, 0x9a, 0x24, 0xda,
+ 0x38, 0xa3, 0x8c, 0x12, 0xb8, 0x68, 0xb2, 0x9e, 0x22, 0x88, 0x21, 0xf9, 0x18, 0x83, 0x9b, 0x42,
+ 0xb9, 0x30, 0xc8, 0x09, 0x23, 0xa1, 0x9c, 0x91, 0x0a, 0x36, 0xda, 0x2a, 0x24, 0xa8, 0x8b, 0x26,
+ 0xdc, 0x1a, 0x4a, 0x00, 0x30, 0xc0, 0x8c, 0x00, 0x44, 0xb8, 0x0a, 0x11, 0x11, 0xfa, 0x9b, 0x52,
+ 0x12, 0x98, 0xa8, 0x9c, 0x43, 0xa8, 0x62, 0xc9, 0x11, 0xbb, 0x51, 0x11, 0x80, 0xc9, 0x0b, 0x05,
+ 0x10, 0xb9, 0x32, 0x89, 0x85, 0xbf, 0x31, 0xa0, 0x58, 0xa1, 0xab, 0x8b, 0x27, 0xa9, 0x99, 0x21,
+ 0xec, 0x60, 0x92, 0x0a, 0x83, 0xad, 0x38, 0x15, 0xa9, 0x88, 0x9a, 0x99, 0x75, 0xa2, 0x9d, 0x21,
+ 0x88, 0x20, 0x11, 0xb8, 0x0a, 0x11, 0x82, 0x0b, 0xa0, 0x1a, 0x91, 0xfa, 0x2c, 0x06, 0x9a, 0x33,
+ 0xa8, 0xcf, 0x3a, 0x25, 0xb0, 0x8d, 0x13, 0x9a, 0x32, 0xb8, 0xbd, 0x30, 0x35, 0xd8, 0x0c, 0x11,
+ 0x08, 0x32, 0xc0, 0x19, 0xa8, 0x81, 0x9d, 0x25, 0x01, 0xca, 0x09, 0x81, 0x9a, 0x54, 0xb8, 0x18,
+ 0x81, 0x23, 0x8b, 0x35, 0x0a, 0xa3, 0x8e, 0xb9, 0x60, 0x13, 0x00, 0xda, 0x38, 0xf0, 0x2d, 0x15,
+ 0xa9, 0x90, 0x38, 0x07, 0x8b, 0x01, 0x0a, 0xa0, 0x48, 0xd1, 0x9b, 0x42, 0x21, 0xb1, 0x8f, 0x02,
+ 0x09, 0x00, 0x20, 0xb0, 0x4b, 0x06, 0x99, 0x90, 0x99, 0xac, 0x11, 0x32, 0x14, 0xfd, 0x48, 0xa1,
+ 0x09, 0xa9, 0x31, 0x98, 0x30, 0xb2, 0x3c, 0xc5, 0x3c, 0xd3, 0x8d, 0x32, 0x81, 0x89, 0x9b, 0x13,
+ 0x8b, 0x06, 0x19, 0x92, 0x1a, 0x53, 0xc3, 0xaf, 0x10, 0x81, 0x48, 0x92, 0x2a, 0xb3, 0x9f, 0x88,
+ 0x44, 0x98, 0x52, 0x90, 0x98, 0xaa, 0x88, 0x00, 0x12, 0xa9, 0x74, 0xc9, 0x38, 0xb2, 0x8c, 0x22,
+ 0x98, 0x22, 0xba, 0x53, 0xea, 0x88, 0x0b, 0x27, 0xeb, 0x48, 0xa2, 0x0a, 0x81, 0x88, 0x9b, 0x33,
+ 0x1b, 0x37, 0xcc, 0x08, 0x80, 0x88, 0x50, 0xb3, 0x0f, 0x82, 0x8a, 0x11, 0x01, 0xb9, 0x50, 0x91,
+ 0x28, 0xda, 0x19, 0x11, 0x89, 0xca, 0x70, 0xf1, 0x29, 0x92, 0x20, 0xc8, 0x09, 0x28, 0x35, 0xb0,
+ 0xba, 0xe0, 0x4b, 0x00, 0x8c, 0x31, 0x02, 0x9a, 0x28, 0x45, 0xb8, 0x0b, 0xc8, 0x18, 0x12, 0x01,
+ 0x73, 0x07, 0x89, 0xc8, 0x09, 0x82, 0x18, 0xb1, 0x78, 0x96, 0x8b, 0x83, 0x8b, 0xa3, 0x1c, 0x05,
+ 0x38, 0xb2, 0x8f, 0x01, 0xaa, 0x00, 0x09, 0x24, 0xa9, 0xaa, 0x18, 0x68, 0x95, 0x9c, 0x00, 0x48,
+ 0x04, 0xda, 0x48, 0xb0, 0x3b, 0xa2, 0x19, 0x91, 0x10, 0x90, 0xdf, 0x61, 0xa0, 0x50, 0xa0, 0x0a,
+ 0x08, 0x31, 0xc1, 0x8d, 0x24, 0x89, 0x01, 0x9b, 0xa0, 0x48, 0xa8, 0x11, 0x4a, 0x87, 0x1b, 0x94,
+ 0x8e, 0x81, 0x89, 0x21, 0xcb, 0x61, 0xb0, 0x10, 0xb8, 0x80, 0x9d, 0x34, 0x01, 0xab, 0x35, 0xaa,
+ 0x84, 0xbd, 0x08, 0x41, 0x12, 0xeb, 0x48, 0xa4, 0x0b, 0x03, 0x0c, 0x81, 0x8a, 0x32, 0xa1, 0x79,
+ 0x84, 0x9c, 0x99, 0x10, 0x02, 0xba, 0x62, 0xf9, 0x58, 0xa2, 0x0b, 0x11, 0x89, 0x00, 0x02, 0x98,
+ 0x9d, 0x34, 0xb8, 0x31, 0xc9, 0x9a, 0x61, 0xa1, 0x1a, 0x82, 0x30, 0x33, 0xa5, 0xcf, 0x42, 0x00,
+ 0x90, 0xcc, 0x40, 0x82, 0x09, 0xb9, 0x19, 0x81, 0x71, 0xd1, 0x0b, 0x25, 0x99, 0x00, 0xc9, 0x2a,
+ 0x25, 0x90, 0xba, 0x0a, 0x35, 0x98, 0x22, 0xee, 0x28, 0x82, 0x18, 0xa8, 0x38, 0xa0, 0x41, 0xa1,
+ 0xad, 0x8b, 0x31, 0x05, 0xaa, 0x90, 0x39, 0xc5, 0x0c, 0x92, 0x9c, 0x34, 0x90, 0x18, 0xb8, 0x2b,
+ 0x83, 0xbc, 0x18, 0x44, 0x90, 0x90, 0x3a, 0xe6, 0x9f, 0x32, 0x98, 0x21, 0xc0, 0x1a, 0x33, 0x80,
+ 0x83, 0xef, 0x18, 0x20, 0x02, 0xaa, 0x38, 0xa4, 0x9f, 0x23, 0xb9, 0x40, 0x03, 0x99, 0x8a, 0x02,
+ 0x9c, 0x53, 0xb9, 0x48, 0xa1, 0x19, 0xb9, 0x80, 0xef, 0x72, 0x91, 0x09, 0x91, 0x09, 0x88, 0x00,
+ 0x38, 0x85, 0x0a, 0x13, 0xfc, 0x09, 0x80, 0x61, 0xa2, 0x8b, 0x91, 0x1b, 0x27, 0xa9, 0x20, 0xb1,
+ 0x35, 0xfb, 0x4c, 0x00, 0x18, 0x29, 0x37, 0x80, 0xdb, 0xa9, 0x4a, 0x16, 0xaa, 0x9a, 0x09, 0x42,
+ 0x10, 0x14, 0xca, 0x09, 0x01, 0xab, 0x24, 0x18, 0x95, 0xdf, 0x21, 0x11, 0x01, 0xb0, 0xbe, 0x20,
+ 0x81, 0x22, 0x01, 0xb9, 0x30, 0x12, 0xd1, 0xaf, 0x09, 0x43, 0x81, 0x18, 0xb1, 0xbf, 0x32, 0x02,
+ 0xbb, 0x99, 0x49, 0x94, 0x29, 0x36, 0xc0, 0x0a, 0xd0, 0x9b, 0x18, 0x40, 0x15, 0xca, 0x18, 0x88,
+ 0x21, 0x94, 0x8e, 0x02, 0x0b, 0x05, 0x99, 0x51, 0xa1, 0x29, 0xc2, 0xad, 0x11, 0x80, 0x33, 0xaa,
+ 0x22, 0xea, 0x9c, 0x12, 0x2a, 0x47, 0x98, 0xaa, 0x8b, 0x42, 0xc0, 0x6b, 0x05, 0xcb, 0x18, 0x80,
+ 0x80, 0x20, 0x81, 0x08, 0x21, 0xfa, 0x1a, 0x02, 0x40, 0x84, 0xad, 0x88, 0x38, 0x83, 0xad, 0x30,
+ 0x80, 0x73, 0xb8, 0x28, 0x92, 0x89, 0x36, 0xca, 0x19, 0x18, 0x91, 0x0b, 0x17, 0xba, 0x68, 0x93,
+ 0xbb, 0x18, 0x00, 0x22, 0x89, 0x45, 0xb1, 0x2a, 0xc3, 0x9d, 0xaa, 0x61, 0x33, 0xfa, 0x2a, 0x02,
+ 0x08, 0x99, 0xca, 0x60, 0x91, 0x29, 0x81, 0x9a, 0x30, 0xa2, 0xbf, 0x29, 0x02, 0xbd, 0x71, 0x94,
+ 0x9b, 0x28, 0xa0, 0x8a, 0x08, 0x46, 0x90, 0x18, 0x91, 0xaf, 0x21, 0x88, 0xa0, 0x8c, 0x45, 0xb0,
+ 0x1b, 0x84, 0x9b, 0x33, 0xc8, 0x31, 0xd9, 0x19, 0x21, 0xa0, 0x9b, 0x18, 0xe2, 0x9e, 0x43, 0x81,
+ 0x19, 0xb9, 0x70, 0x92, 0x9f, 0x31, 0x81, 0xa9, 0x38, 0x92, 0x9b, 0x41, 0xb2, 0x8f, 0x34, 0xa0,
+ 0x9c, 0x10, 0x31, 0xb1, 0x1d, 0x03, 0x98, 0x40, 0x94, 0xae, 0x89, 0x41, 0xc2, 0x1c, 0x05, 0x99,
+ 0x12, 0xc9, 0x8a, 0x01, 0x50, 0x84, 0x09, 0x00, 0x80, 0xca, 0x1a, 0x92, 0x9e, 0x42, 0x21, 0x13,
+ 0xcd, 0x08, 0x00, 0x08, 0xc8, 0x79, 0x86, 0x8b, 0x13, 0xb8, 0x18, 0x98, 0x11, 0xbd, 0x38, 0x14,
+ 0xd1, 0x2e, 0x4c, 0x00, 0x28, 0xf9, 0x38, 0x91, 0x09, 0xa0, 0x2d, 0x27, 0xaa, 0x12, 0xfa, 0x48,
+ 0x91, 0x09, 0xb8, 0x30, 0x93, 0x8c, 0x25, 0xbb, 0x38, 0x82, 0xb9, 0x9a, 0x63, 0xb0, 0x1a, 0x90,
+ 0x8a, 0x91, 0x3b, 0xd5, 0x8f, 0x13, 0xbc, 0x63, 0xb0, 0x29, 0x01, 0x09, 0xa3, 0x0f, 0x14, 0xaa,
+ 0x09, 0x21, 0xcc, 0x31, 0x92, 0x9a, 0x12, 0x88, 0x81, 0xcf, 0x58, 0x84, 0x08, 0x01, 0xba, 0x1a,
+ 0xe9, 0x58, 0xa1, 0x18, 0x32, 0xc0, 0x29, 0xc8, 0xac, 0x48, 0x05, 0xaa, 0x50, 0x83, 0x8a, 0x33,
+ 0xe9, 0x9b, 0x89, 0x30, 0x91, 0x71, 0x04, 0xbe, 0x50, 0x91, 0x8c, 0x21, 0x80, 0x88, 0x10, 0x12,
+ 0xca, 0x38, 0xc0, 0x09, 0x9a, 0x23, 0x10, 0x57, 0xb8, 0x8c, 0x03, 0xaa, 0x8a, 0x11, 0x73, 0x97,
+ 0x1a, 0x82, 0xcb, 0x09, 0x04, 0xba, 0x00, 0x44, 0xa2, 0x9b, 0x28, 0xa4, 0x8c, 0x02, 0x80, 0xb9,
+ 0x71, 0x83, 0x9c, 0x42, 0xc8, 0x1b, 0x33, 0xc0, 0xbc, 0x28, 0x27, 0xc9, 0x30, 0x91, 0x99, 0x19,
+ 0x04, 0x9a, 0x8a, 0x34, 0xb9, 0x8a, 0x45, 0xcb, 0x42, 0x01, 0xdc, 0x19, 0x11, 0x91, 0x21, 0xc9,
+ 0x41, 0xc9, 0x28, 0x14, 0xbb, 0x08, 0x62, 0xa0, 0x19, 0xe9, 0x28, 0x82, 0xa9, 0x18, 0xca, 0x48,
+ 0x92, 0x0a, 0x41, 0x92, 0x8d, 0x06, 0xcc, 0x09, 0x31, 0x23, 0xf9, 0x1b, 0x03, 0xb9, 0x2a, 0x06,
+ 0x8a, 0x92, 0x0a, 0x21, 0x94, 0x4b, 0x86, 0x19, 0x12, 0xba, 0xac, 0x31, 0xe0, 0x9b, 0x32, 0x25,
+ 0x01, 0xda, 0x0a, 0x81, 0xaa, 0x72, 0x03, 0xd9, 0x38, 0xf0, 0x29, 0x23, 0xc1, 0x8e, 0x81, 0x38,
+ 0x82, 0x41, 0xd9, 0x8a, 0x10, 0xb2, 0xac, 0x22, 0x45, 0x92, 0xab, 0x21, 0xfa, 0x28, 0x93, 0xaa,
+ 0x18, 0x92, 0x19, 0x25, 0xaa, 0x72, 0x01, 0xb8, 0x0c, 0x82, 0xad, 0x60, 0x83, 0x8c, 0x33, 0x90,
+ 0x83, 0x2c, 0x4b, 0x00, 0x2b, 0x93, 0xcd, 0x28, 0x25, 0x90, 0xbd, 0x51, 0x02, 0xa9, 0x11, 0xdb,
+ 0x28, 0x83, 0x8b, 0x04, 0x19, 0xa1, 0x31, 0x09, 0xb5, 0xaf, 0x20, 0x03, 0xbb, 0xbc, 0x73, 0x93,
+ 0x81, 0x8b, 0x93, 0x9d, 0x81, 0x28, 0x84, 0x0c, 0x34, 0xfa, 0x1a, 0x82, 0x8d, 0x03, 0xad, 0x22,
+ 0x89, 0x03, 0xbb, 0x41, 0x15, 0xcd, 0x20, 0x81, 0x28, 0x90, 0x08, 0xcb, 0x42, 0x90, 0xa9, 0x98,
+ 0xcf, 0x52, 0x01, 0x81, 0xbd, 0x60, 0x82, 0xaa, 0x00, 0x41, 0x02, 0xb9, 0x9b, 0x88, 0x71, 0xa3,
+ 0xbf, 0x31, 0x83, 0x99, 0x32, 0xfb, 0x0a, 0x45, 0xb0, 0x0a, 0x02, 0xa9, 0x8b, 0x12, 0x28, 0x44,
+ 0x03, 0xbf, 0x09, 0x10, 0x82, 0xa9, 0x28, 0xf0, 0x59, 0x81, 0x10, 0xaa, 0x88, 0x30, 0x14, 0xea,
+ 0x0c, 0x32, 0x01, 0x9c, 0x80, 0x69, 0xa3, 0xaf, 0x31, 0x13, 0xca, 0x1a, 0x01, 0xa9, 0x19, 0x24,
+ 0xa8, 0x9c, 0x34, 0x89, 0x02, 0x89, 0xee, 0x30, 0x12, 0xc1, 0x1d, 0xa3, 0x8d, 0x32, 0xa1, 0xab,
+ 0x20, 0x47, 0xa9, 0x22, 0xbb, 0x48, 0x1b, 0x9b, 0xb7, 0x31, 0x78, 0x98, 0x9c, 0x30, 0xa1, 0x8b,
+ 0x23, 0x82, 0x28, 0x01, 0xa8, 0x0f, 0x15, 0xb9, 0x9a, 0x42, 0x81, 0x00, 0x45, 0xf9, 0x0b, 0x14,
+ 0xa9, 0x09, 0x63, 0xa1, 0x19, 0x90, 0x1a, 0x12, 0xa8, 0xbc, 0x90, 0x49, 0x35, 0x92, 0x8c, 0xc1,
+ 0x1c, 0x92, 0xab, 0x70, 0x85, 0x8b, 0x13, 0xeb, 0x28, 0x22, 0xa0, 0xad, 0x18, 0x91, 0x8a, 0x43,
+ 0x15, 0xb9, 0x40, 0xa0, 0xce, 0x29, 0x12, 0x22, 0xa9, 0x21, 0x81, 0xcd, 0x49, 0xa3, 0xae, 0x38,
+ 0x25, 0xa8, 0x09, 0x25, 0xdc, 0x38, 0x02, 0xa8, 0x9a, 0x09, 0x43, 0x00, 0x00, 0x98, 0x10, 0xa0,
+ 0x62, 0xd8, 0xab, 0x9d, 0x54, 0x82, 0xca, 0x28, 0xc2, 0x39, 0x94, 0xab, 0x10, 0x08, 0x46, 0xb8,
+ 0x95, 0x34, 0x50, 0x00, 0x13, 0xea, 0x2a, 0x14, 0xbb, 0x8a, 0x38, 0x17, 0xaa, 0x31, 0xf1, 0x2a,
+ 0x05, 0x9a, 0x01, 0xaa, 0x20, 0x11, 0x20, 0x12, 0xcd, 0x89, 0x00, 0x90, 0x8b, 0x43, 0xd8, 0x60,
+ 0xe0, 0x2b, 0x16, 0xb9, 0x19, 0x11, 0x91, 0xaa, 0x08, 0x91, 0x0a, 0x34, 0x01, 0x80, 0xbc, 0x71,
+ 0xf2, 0x0b, 0x23, 0xaa, 0x42, 0xa0, 0x0a, 0xc9, 0x69, 0x14, 0xcb, 0x19, 0x03, 0x88, 0xa9, 0x28,
+ 0x25, 0xb9, 0xa9, 0x1c, 0x27, 0xdb, 0x18, 0x11, 0x09, 0x32, 0x88, 0x42, 0xf8, 0x3b, 0x06, 0xab,
+ 0x00, 0x88, 0xa1, 0x8f, 0x44, 0xb0, 0x1a, 0x83, 0xab, 0x02, 0x09, 0x44, 0xa0, 0x9c, 0x54, 0xa1,
+ 0x89, 0x89, 0x90, 0x8b, 0xb9, 0x4a, 0x37, 0xc8, 0x1b, 0x14, 0xa9, 0x50, 0xb2, 0x9e, 0x90, 0x30,
+ 0x15, 0xa9, 0x18, 0xa0, 0xab, 0x64, 0xb0, 0x9b, 0x21, 0x11, 0xba, 0x70, 0x84, 0x9b, 0x02, 0x9b,
+ 0x45, 0xe9, 0x19, 0x14, 0xa9, 0x8b, 0x42, 0x02, 0xb8, 0x1b, 0x23, 0xe9, 0x9b, 0x30, 0x57, 0xc9,
+ 0x29, 0x02, 0xaa, 0x28, 0x92, 0x98, 0xad, 0x41, 0x23, 0xca, 0x60, 0x02, 0xeb, 0x09, 0x13, 0xc9,
+ 0x19, 0x13, 0x8a, 0x12, 0xcb, 0x48, 0x92, 0x9c, 0x72, 0xc1, 0x0b, 0x83, 0x20, 0xb8, 0x39, 0x23,
+ 0xb9, 0x08, 0xad, 0x54, 0xf9, 0x8a, 0x33, 0x90, 0x08, 0x81, 0x00, 0x91, 0x5a, 0x05, 0xaa, 0xaa,
+ 0x3a, 0x16, 0x89, 0xa8, 0x4a, 0xc3, 0x1d, 0x82, 0x8c, 0x22, 0xda, 0x71, 0x02, 0x99, 0x08, 0x98,
+ 0x31, 0x91, 0xfb, 0x8b, 0x24, 0x22, 0x88, 0xa1, 0xef, 0x11, 0x01, 0x08, 0x22, 0xc9, 0x28, 0xb0,
+ 0xab, 0x19, 0x04, 0x61, 0x23, 0xd8, 0x0b, 0x03, 0xdb, 0x9b, 0x31, 0x04, 0xbd, 0x73, 0x91, 0x98,
+ 0x0a, 0x23, 0xe8, 0xab, 0x51, 0x12, 0xba, 0x0b, 0x33, 0x81, 0x08, 0x81, 0x9d, 0x36, 0xde, 0x28,
+ 0xe8, 0xff, 0x53, 0x00, 0x80, 0x10, 0x81, 0xa9, 0x18, 0x04, 0xd9, 0x8a, 0x11, 0x99, 0x62, 0x82,
+ 0x3a, 0x16, 0x99, 0xcd, 0x39, 0x02, 0xa8, 0x0b, 0x13, 0x34, 0xdf, 0x50, 0x92, 0xbc, 0x30, 0x05,
+ 0x99, 0x89, 0x09, 0x41, 0x82, 0xbd, 0x38, 0x14, 0xba, 0x09, 0x14, 0xd9, 0x89, 0x11, 0x11, 0x13,
+ 0xed, 0x19, 0x12, 0x80, 0x00, 0x43, 0xeb, 0x09, 0x11, 0x04, 0xca, 0x8b, 0x24, 0xa8, 0xa8, 0x29,
+ 0x04, 0x99, 0x22, 0xd8, 0x18, 0x90, 0x0b, 0x46, 0x90, 0x88, 0x28, 0x01, 0xfa, 0x8f, 0x02, 0x10,
+ 0x91, 0x88, 0x0a, 0x44, 0xa8, 0x0a, 0x05, 0xdd, 0x50, 0x02, 0xbb, 0x4a, 0x16, 0xb8, 0x8b, 0x43,
+ 0xa0, 0x9a, 0x09, 0x32, 0x03, 0xfb, 0x0a, 0x35, 0xb8, 0x10, 0x89, 0x01, 0xaa, 0x88, 0x00, 0x60,
+ 0x36, 0xd9, 0x8b, 0x33, 0xa1, 0xa9, 0xbd, 0x18, 0x11, 0x53, 0x91, 0xac, 0x73, 0x81, 0xcc, 0x1a,
+ 0x16, 0x80, 0xbb, 0x40, 0x02, 0x92, 0xab, 0xa9, 0x61, 0xa2, 0x9c, 0x42, 0xc0, 0x09, 0x88, 0x19,
+ 0x21, 0x00, 0x00, 0x88, 0x61, 0x93, 0x8f, 0x01, 0xa9, 0xab, 0x72, 0xa4, 0xad, 0x42, 0x91, 0x88,
+ 0xca, 0x40, 0x83, 0xac, 0x8a, 0x61, 0x03, 0xaa, 0xa8, 0x9b, 0x22, 0x45, 0x91, 0x80, 0xad, 0x22,
+ 0x31, 0xe8, 0x8b, 0x80, 0x80, 0x98, 0x19, 0x25, 0x41, 0xc2, 0xbf, 0x51, 0x82, 0xb9, 0x0a, 0x63,
+ 0xa1, 0x9a, 0x8a, 0x88, 0x70, 0x94, 0x9b, 0x31, 0xb1, 0x0c, 0x81, 0x89, 0x20, 0x94, 0xad, 0x21,
+ 0x43, 0x91, 0x0a, 0x15, 0xfb, 0x8a, 0x32, 0x01, 0x98, 0x20, 0x90, 0xdc, 0x69, 0x04, 0x08, 0xdb,
+ 0x09, 0x31, 0xc2, 0x2b, 0x15, 0x08, 0xb8, 0x1a, 0x35, 0xb0, 0xaa, 0xb9, 0x2a, 0x37, 0xb1, 0xcb,
+ 0x1b, 0x57, 0xa8, 0x88, 0x0a, 0x21, 0x90, 0x8c, 0x33, 0x33, 0xf9, 0x9a, 0x18, 0x33, 0xd8, 0x9e,
+ 0xa0, 0xc6, 0x51, 0x00, 0x01, 0x02, 0xbc, 0x42, 0x82, 0xa8, 0x19, 0x85, 0x9d, 0x22, 0xa0, 0xbc,
+ 0x30, 0x45, 0xd0, 0x0b, 0x23, 0x00, 0x98, 0x9b, 0x32, 0xe9, 0xbb, 0x30, 0x44, 0x82, 0xaf, 0x30,
+ 0xa1, 0x38, 0x94, 0x9d, 0x88, 0x19, 0x26, 0xa0, 0xaa, 0x00, 0x10, 0x92, 0x8d, 0x44, 0x82, 0xcd,
+ 0x09, 0x32, 0x92, 0x1a, 0x26, 0xdb, 0x18, 0x90, 0x40, 0x13, 0xcb, 0x1a, 0x88, 0x10, 0x20, 0x14,
+ 0xcd, 0x29, 0x14, 0xc8, 0x38, 0xb3, 0x8a, 0xfb, 0x40, 0x82, 0x9b, 0x45, 0x90, 0xba, 0x8b, 0x56,
+ 0xb1, 0x0c, 0x20, 0x82, 0xac, 0xa8, 0x38, 0x25, 0x90, 0x0a, 0x44, 0xb0, 0xcc, 0x29, 0xa1, 0x3b,
+ 0x87, 0xab, 0x21, 0x32, 0x93, 0xbe, 0x31, 0x90, 0x89, 0x9a, 0x12, 0x21, 0xf0, 0x0f, 0x44, 0x91,
+ 0xaa, 0x88, 0x53, 0xd8, 0x8a, 0x00, 0x03, 0x10, 0xda, 0x28, 0x03, 0x89, 0xb1, 0x0e, 0x26, 0xa9,
+ 0x88, 0xba, 0x61, 0x84, 0xa9, 0xa8, 0x1a, 0x25, 0xb0, 0x0c, 0x42, 0x13, 0xeb, 0x9a, 0x21, 0x00,
+ 0x44, 0xc8, 0xac, 0x41, 0x82, 0x9a, 0x81, 0x9a, 0x11, 0x09, 0xc0, 0x1b, 0x25, 0x88, 0x73, 0xc1,
+ 0x09, 0x01, 0x90, 0x8c, 0x32, 0x04, 0xbb, 0xfa, 0x0b, 0x10, 0x37, 0xca, 0x10, 0x11, 0xc8, 0x09,
+ 0x98, 0x22, 0x88, 0x40, 0x07, 0xaa, 0x11, 0x10, 0xca, 0x10, 0x0a, 0xb1, 0x9e, 0x0a, 0x44, 0x63,
+ 0xc0, 0x1a, 0x12, 0x80, 0xc9, 0xbc, 0x48, 0x04, 0x99, 0x88, 0x01, 0x73, 0xa2, 0xac, 0x38, 0x03,
+ 0x88, 0xbc, 0xb9, 0x5a, 0x17, 0x98, 0x0a, 0x23, 0x88, 0x98, 0x11, 0x9b, 0xf0, 0x1e, 0x81, 0x58,
+ 0x02, 0x99, 0x88, 0xcb, 0x10, 0x73, 0xb1, 0x9f, 0x20, 0x13, 0xa9, 0xbb, 0x40, 0x25, 0xa0, 0xbd,
+ 0x28, 0x25, 0x90, 0x9b, 0x08, 0x91, 0x8b, 0x35, 0x82, 0xcd, 0x40, 0x91, 0x9a, 0x29, 0x24, 0xb1,
+ 0x10, 0xd5, 0x4b, 0x00, 0x8e, 0x32, 0x80, 0x01, 0x99, 0x01, 0xdb, 0x19, 0x46, 0xb0, 0x0b, 0x13,
+ 0xc8, 0x8b, 0x54, 0x80, 0x0a, 0x12, 0xa9, 0x00, 0x01, 0xfb, 0x8a, 0x22, 0xe8, 0x29, 0x24, 0x80,
+ 0xda, 0x19, 0x31, 0x25, 0xa0, 0xab, 0x42, 0xfb, 0x09, 0x08, 0xc1, 0x2c, 0x27, 0x80, 0xcb, 0x48,
+ 0x03, 0xa9, 0xb8, 0x1b, 0xb1, 0x4a, 0x16, 0x00, 0x09, 0x82, 0x9c, 0x19, 0x25, 0xba, 0x88, 0x9a,
+ 0x88, 0x27, 0xb8, 0xcb, 0x30, 0x53, 0x05, 0xac, 0x11, 0x21, 0xa8, 0x8a, 0xd9, 0x5a, 0x14, 0x18,
+ 0xf8, 0x9a, 0x51, 0x03, 0x0a, 0xa0, 0x8c, 0x28, 0x83, 0x9c, 0x22, 0x26, 0xcb, 0x88, 0x2a, 0x26,
+ 0x11, 0xfb, 0x09, 0x21, 0x82, 0xbb, 0x18, 0x15, 0xba, 0x89, 0x40, 0x15, 0x90, 0xa9, 0xcd, 0x1a,
+ 0x32, 0x14, 0xaa, 0x10, 0x80, 0x9a, 0x33, 0x13, 0xd0, 0x9c, 0xeb, 0x8c, 0x32, 0x11, 0x81, 0x8d,
+ 0x32, 0xd9, 0x78, 0xa4, 0x9d, 0x18, 0x23, 0xa9, 0x00, 0x88, 0x50, 0xd2, 0x8c, 0x12, 0x02, 0x98,
+ 0xdc, 0x18, 0x22, 0xb0, 0x29, 0x91, 0x19, 0x62, 0xd1, 0x8c, 0x32, 0x92, 0xbd, 0x40, 0xb0, 0x1a,
+ 0x46, 0xa2, 0xbd, 0x18, 0x13, 0x90, 0x8a, 0x81, 0x99, 0x08, 0x27, 0xa9, 0x09, 0x45, 0xfa, 0x8a,
+ 0x32, 0x83, 0xb9, 0x99, 0x09, 0x63, 0x81, 0xca, 0x28, 0x80, 0x80, 0xcb, 0x29, 0x27, 0x89, 0x12,
+ 0xbc, 0xab, 0x69, 0x04, 0x8c, 0x22, 0xba, 0x8c, 0x46, 0x81, 0xa8, 0x1a, 0xa1, 0x1a, 0x32, 0x94,
+ 0x2c, 0x14, 0xfa, 0x9b, 0x42, 0x23, 0xb8, 0xba, 0x50, 0xa1, 0x8c, 0x42, 0xb0, 0x9d, 0x52, 0x83,
+ 0x8d, 0x22, 0x00, 0xa9, 0x20, 0xfb, 0x18, 0x80, 0x22, 0x28, 0xf0, 0x0b, 0x33, 0x81, 0x20, 0xf0,
+ 0x0d, 0x82, 0x0a, 0x10, 0x01, 0x32, 0x92, 0xbe, 0x0a, 0x38, 0x47, 0xca, 0x09, 0x10, 0x00, 0x88,
+ 0x6a, 0x22, 0x4a, 0x00, 0x03, 0xab, 0x73, 0xc0, 0xae, 0x41, 0x03, 0xba, 0x18, 0x90, 0x19, 0x12,
+ 0x82, 0x88, 0xcb, 0x99, 0xac, 0x51, 0x27, 0xaa, 0x88, 0x2a, 0xc2, 0x3b, 0x37, 0x82, 0xbe, 0x0b,
+ 0x23, 0x88, 0x14, 0xb8, 0xad, 0x42, 0x80, 0xa0, 0x29, 0x25, 0xb1, 0xbf, 0x08, 0x52, 0x92, 0xba,
+ 0x9a, 0x20, 0x21, 0x92, 0x3c, 0x07, 0xaf, 0x21, 0x12, 0x88, 0x90, 0x9b, 0xba, 0x59, 0x32, 0x85,
+ 0xaa, 0xb0, 0xeb, 0x29, 0x56, 0x80, 0x1e, 0xb0, 0x13, 0xaa, 0x38, 0x11, 0xba, 0x59, 0xe0, 0x28,
+ 0x14, 0x98, 0x8a, 0xc9, 0x2a, 0x35, 0xb1, 0x9c, 0x88, 0x20, 0x10, 0x80, 0x20, 0x31, 0x96, 0xbf,
+ 0x22, 0x90, 0xca, 0x41, 0x99, 0x32, 0x30, 0x92, 0x30, 0xfc, 0x09, 0x08, 0xc0, 0x38, 0x81, 0xa8,
+ 0x8d, 0x02, 0x60, 0x15, 0xd9, 0x9b, 0x31, 0x02, 0x28, 0xc0, 0x2c, 0x27, 0xc9, 0x1a, 0x03, 0xda,
+ 0x48, 0x84, 0x9c, 0x08, 0x21, 0x00, 0x88, 0xaa, 0x38, 0x15, 0xda, 0x38, 0x84, 0xac, 0x40, 0x02,
+ 0x9c, 0x31, 0xb0, 0x9b, 0x11, 0xcc, 0x72, 0x82, 0xa9, 0x09, 0x98, 0x62, 0x14, 0xdc, 0x18, 0x02,
+ 0xba, 0x30, 0x82, 0x9d, 0x62, 0x82, 0xaa, 0x00, 0x89, 0x45, 0xb1, 0xbc, 0x18, 0x14, 0xaa, 0x01,
+ 0xba, 0x1a, 0x57, 0xaa, 0x28, 0x21, 0xa1, 0x8b, 0xb8, 0x8d, 0x25, 0xc9, 0x50, 0x03, 0xda, 0x18,
+ 0x02, 0x99, 0x22, 0x81, 0xed, 0x38, 0xc0, 0x2a, 0x12, 0x98, 0x73, 0xa2, 0xae, 0x28, 0x15, 0xa9,
+ 0x88, 0x09, 0x21, 0x02, 0xad, 0x10, 0x01, 0xfa, 0x40, 0x92, 0x99, 0x28, 0x02, 0x98, 0xdd, 0x38,
+ 0x24, 0xa0, 0xbd, 0x41, 0xb0, 0x1a, 0x53, 0xb1, 0x2a, 0xc8, 0x20, 0x18, 0x84, 0xbc, 0x58, 0x04,
+ 0xab, 0xa8, 0x08, 0x34, 0x81, 0xa8, 0xbe, 0x63, 0x81, 0x00, 0xc8, 0x9c, 0x31, 0xa8, 0x40, 0xa0,
+ 0x8d, 0xf4, 0x4a, 0x00, 0xa1, 0x5a, 0x84, 0x8a, 0x21, 0xa1, 0xaf, 0x00, 0x18, 0xa0, 0x50, 0x03,
+ 0x01, 0xce, 0x1a, 0x45, 0xb8, 0x09, 0xb8, 0x59, 0x04, 0xbb, 0x10, 0x20, 0x04, 0x9a, 0x10, 0xa8,
+ 0x8b, 0x57, 0xb0, 0xbc, 0x29, 0x15, 0x01, 0xb9, 0x89, 0x38, 0xe1, 0x59, 0x93, 0x09, 0x80, 0x08,
+ 0xbb, 0x70, 0x05, 0xcc, 0x18, 0x22, 0xb8, 0x0b, 0x32, 0x92, 0x1c, 0xb2, 0x1d, 0x03, 0xbd, 0x50,
+ 0xb0, 0x1a, 0x04, 0x9a, 0x22, 0x40, 0xf2, 0x8c, 0x53, 0x81, 0xab, 0x20, 0xa1, 0xab, 0x08, 0x01,
+ 0x08, 0x43, 0x04, 0xcb, 0xec, 0x68, 0x82, 0x08, 0xcb, 0x48, 0x32, 0xa1, 0xad, 0x88, 0x11, 0x10,
+ 0xa0, 0x58, 0x05, 0xcb, 0x18, 0xa0, 0x9c, 0x22, 0xaa, 0x75, 0xa0, 0x8a, 0x88, 0x10, 0x24, 0x02,
+ 0xe8, 0xab, 0x42, 0x81, 0x20, 0x13, 0xfb, 0x8c, 0x41, 0x93, 0x8b, 0x20, 0x13, 0xcf, 0x21, 0x08,
+ 0xa1, 0x1a, 0x83, 0xbc, 0x19, 0x24, 0xca, 0x71, 0x82, 0xba, 0xbc, 0x72, 0x03, 0xa8, 0xab, 0x30,
+ 0x14, 0xa0, 0xae, 0x20, 0x02, 0xb8, 0x71, 0xd8, 0x0a, 0x43, 0x80, 0x00, 0xbb, 0x22, 0x9a, 0xa8,
+ 0x30, 0xaa, 0x57, 0x90, 0x9c, 0x41, 0x22, 0xa8, 0x9d, 0xa9, 0x18, 0x23, 0xb1, 0x9d, 0x28, 0x47,
+ 0xb0, 0x9c, 0x12, 0x32, 0xc2, 0x8d, 0x98, 0x30, 0x91, 0x98, 0xa9, 0x9c, 0x55, 0x01, 0x99, 0x01,
+ 0xac, 0x23, 0x8a, 0xd0, 0x8d, 0x51, 0x04, 0xab, 0x28, 0x90, 0x8b, 0x12, 0x10, 0x13, 0xda, 0x1b,
+ 0x22, 0x90, 0x9e, 0x65, 0xa0, 0x8b, 0x12, 0xdb, 0x21, 0x31, 0xa2, 0xbf, 0x20, 0x04, 0x80, 0x01,
+ 0x99, 0x19, 0x33, 0xb0, 0xbf, 0x29, 0x35, 0x83, 0xec, 0x0a, 0x32, 0x02, 0x08, 0x99, 0xfb, 0x3b,
+ 0x16, 0xa0, 0x8d, 0x42, 0x00, 0xa9, 0x31, 0xb1, 0x8a, 0xba, 0x00, 0x99, 0x58, 0x17, 0x98, 0xfa,
+ 0x44, 0xa9, 0x4f, 0x00, 0x63, 0x01, 0xa8, 0x09, 0xa1, 0x38, 0x13, 0x89, 0xf8, 0x1e, 0x12, 0x9a,
+ 0x01, 0x91, 0x19, 0x81, 0x20, 0x82, 0xdd, 0x1a, 0x24, 0xb8, 0xcc, 0x8a, 0x24, 0x42, 0x93, 0xbc,
+ 0xbc, 0x28, 0x47, 0xa1, 0x9d, 0x00, 0x20, 0x21, 0xc9, 0x29, 0x00, 0x11, 0xbe, 0x99, 0x49, 0x04,
+ 0x10, 0xeb, 0x29, 0x23, 0x88, 0x01, 0xab, 0xd9, 0x0c, 0x22, 0x23, 0xc8, 0x2b, 0x17, 0x8b, 0xa0,
+ 0x4a, 0x17, 0x98, 0xaa, 0xba, 0x21, 0x31, 0x86, 0x0a, 0x83, 0x40, 0xf9, 0x1b, 0x24, 0x82, 0xad,
+ 0x11, 0x02, 0xca, 0x8a, 0x18, 0x03, 0x59, 0x05, 0xbb, 0x18, 0x43, 0x22, 0xd0, 0xaf, 0x31, 0x22,
+ 0xd0, 0x8c, 0x22, 0x00, 0x88, 0x08, 0xa0, 0x8b, 0x34, 0x98, 0xa9, 0x8b, 0x14, 0x58, 0x94, 0x1a,
+ 0xf0, 0x2b, 0x12, 0xb1, 0x8f, 0x34, 0x00, 0xcb, 0x09, 0x10, 0x11, 0x35, 0xec, 0x28, 0x03, 0xb9,
+ 0xab, 0x48, 0x04, 0xaa, 0x52, 0xa0, 0x0c, 0x52, 0xa0, 0x28, 0x90, 0xb9, 0xbf, 0x31, 0x21, 0x00,
+ 0x80, 0xba, 0x28, 0xd9, 0x71, 0x04, 0xca, 0x0a, 0xb8, 0x09, 0x40, 0x84, 0x8d, 0x25, 0xa8, 0xbb,
+ 0x28, 0x45, 0x13, 0xda, 0xab, 0x19, 0x54, 0x81, 0xaa, 0x8a, 0x20, 0xa8, 0x60, 0x03, 0xc8, 0x9b,
+ 0x01, 0x08, 0x50, 0xa3, 0x8d, 0x90, 0x11, 0xac, 0x44, 0x28, 0x04, 0xbc, 0x89, 0x44, 0xa9, 0x21,
+ 0xeb, 0x09, 0x08, 0x81, 0x48, 0x25, 0xc8, 0xac, 0x10, 0x11, 0x22, 0xb8, 0xac, 0x28, 0x37, 0xc8,
+ 0xab, 0x30, 0x34, 0xb0, 0x1c, 0x03, 0xaa, 0x78, 0x06, 0xbb, 0x8a, 0x21, 0x23, 0xa9, 0x19, 0xb9,
+ 0xde, 0x49, 0x12, 0x81, 0xab, 0x10, 0x37, 0xea, 0x19, 0x91, 0x18, 0x82, 0xad, 0x41, 0x24, 0xfb,
+ 0x29, 0x12, 0x98, 0xa8, 0x0a, 0x03, 0x39, 0xf1, 0x0c, 0x01, 0x11, 0x31, 0xa2, 0xbd, 0x3a, 0x27,
+ 0x8f, 0x1f, 0x50, 0x00, 0xa9, 0x8b, 0x21, 0x44, 0xfa, 0x09, 0x21, 0x12, 0x98, 0xa8, 0xac, 0x32,
+ 0x21, 0x14, 0xac, 0x98, 0xbb, 0x00, 0x12, 0x72, 0x35, 0xb0, 0xbd, 0x20, 0x00, 0x32, 0x33, 0xec,
+ 0x38, 0xc0, 0x9b, 0x21, 0x03, 0x52, 0x93, 0xbf, 0x09, 0x20, 0x16, 0x99, 0x30, 0xd8, 0xac, 0x10,
+ 0x10, 0x23, 0x32, 0xb0, 0xce, 0x9a, 0x41, 0x15, 0x08, 0xb8, 0x9c, 0x28, 0x35, 0xda, 0x29, 0x81,
+ 0xab, 0x29, 0x12, 0xaa, 0x52, 0x44, 0xa1, 0xbd, 0xaa, 0x20, 0x01, 0x01, 0x60, 0xa2, 0x9c, 0x80,
+ 0x01, 0x28, 0x37, 0xea, 0x99, 0x88, 0xa8, 0x00, 0x42, 0x92, 0x0c, 0x34, 0xa2, 0xef, 0x20, 0x14,
+ 0xa0, 0x9c, 0x88, 0x01, 0x08, 0x31, 0x12, 0xea, 0x0b, 0x44, 0xa1, 0x8c, 0x00, 0x21, 0x11, 0xd8,
+ 0x0c, 0x42, 0x91, 0xbd, 0x10, 0x01, 0x10, 0x21, 0x22, 0xd8, 0x9d, 0x20, 0x00, 0xa0, 0x4b, 0x03,
+ 0x03, 0xff, 0x40, 0x01, 0xa0, 0x0b, 0x33, 0x12, 0xfb, 0x29, 0x81, 0x1a, 0x92, 0x9d, 0x20, 0x23,
+ 0x11, 0xa1, 0x8b, 0xc1, 0x8c, 0x81, 0xa9, 0xbc, 0x70, 0x17, 0xda, 0x8a, 0x30, 0x15, 0x88, 0xba,
+ 0x9a, 0x44, 0x90, 0x40, 0xb1, 0x2a, 0xa2, 0xda, 0x5a, 0x05, 0x9d, 0x88, 0x52, 0x92, 0xbd, 0x28,
+ 0x02, 0x98, 0x08, 0x10, 0x14, 0xdb, 0x1a, 0x83, 0x38, 0xd2, 0x0d, 0x11, 0x31, 0x91, 0xae, 0x61,
+ 0x91, 0x99, 0xbc, 0x29, 0x63, 0x90, 0x88, 0x98, 0xa9, 0x28, 0x24, 0x91, 0x9a, 0x41, 0xa1, 0x8c,
+ 0xf9, 0x0b, 0x25, 0x01, 0xa0, 0xbd, 0x52, 0x80, 0x13, 0x99, 0xc8, 0x8c, 0x91, 0x38, 0x26, 0x98,
+ 0xcb, 0x60, 0xa2, 0x9a, 0x09, 0x43, 0x13, 0xe8, 0x8a, 0x10, 0x03, 0x0a, 0x12, 0xc9, 0x8d, 0x22,
+ 0x11, 0xb8, 0x50, 0xe0, 0x0b, 0x33, 0x12, 0xfc, 0x29, 0x92, 0x8b, 0x02, 0x10, 0xd8, 0x39, 0x07,
+ 0x63, 0xf4, 0x4b, 0x00, 0x0a, 0x12, 0x88, 0x11, 0xb0, 0x9e, 0x38, 0x25, 0x98, 0x98, 0x61, 0xd0,
+ 0x9b, 0x10, 0x36, 0xa0, 0xbc, 0x28, 0x33, 0x82, 0xbe, 0x38, 0x25, 0xea, 0x8a, 0x21, 0x82, 0x28,
+ 0x04, 0xab, 0x99, 0x61, 0xa8, 0x32, 0xbd, 0x10, 0x38, 0xf1, 0x0b, 0x01, 0x34, 0x22, 0xfa, 0x8c,
+ 0x32, 0x91, 0x89, 0x98, 0x28, 0x32, 0xee, 0x29, 0x12, 0x13, 0x8b, 0xc1, 0x8e, 0x33, 0x23, 0xc2,
+ 0x8c, 0x80, 0x09, 0x52, 0xb1, 0xae, 0x08, 0x12, 0x31, 0x91, 0x0b, 0xf8, 0x1a, 0x16, 0xb8, 0x29,
+ 0x93, 0xc8, 0xaf, 0x02, 0x08, 0x01, 0x63, 0xc0, 0x9b, 0x38, 0x26, 0x90, 0xaa, 0xaa, 0x40, 0x15,
+ 0xda, 0x8a, 0x10, 0x42, 0x82, 0x0a, 0x93, 0xbf, 0x28, 0x14, 0x0a, 0x82, 0x9c, 0x99, 0x80, 0xa9,
+ 0x60, 0x26, 0xa9, 0xb9, 0x9d, 0x33, 0x53, 0xa2, 0x9d, 0x08, 0x32, 0xa0, 0xfb, 0x29, 0x02, 0x21,
+ 0xbb, 0x03, 0x9a, 0xed, 0x61, 0x80, 0x10, 0x98, 0x9a, 0x89, 0x00, 0x89, 0x32, 0x57, 0xa0, 0xbc,
+ 0x08, 0x22, 0x36, 0xb9, 0x88, 0xaa, 0x20, 0x02, 0xea, 0x19, 0x90, 0x60, 0xa2, 0x9c, 0x38, 0x04,
+ 0x01, 0xca, 0x08, 0x1a, 0xd8, 0x60, 0x80, 0x18, 0x30, 0xe0, 0x99, 0xad, 0x73, 0x02, 0x8a, 0x80,
+ 0x09, 0x82, 0x08, 0x81, 0xdb, 0x8a, 0x9a, 0x31, 0x32, 0x05, 0xcd, 0x30, 0x13, 0xb9, 0x58, 0xd2,
+ 0x49, 0xd1, 0x8b, 0x00, 0x52, 0x01, 0x90, 0xac, 0x89, 0x52, 0x13, 0xb8, 0x39, 0xb1, 0x9c, 0x51,
+ 0xa2, 0xbe, 0x30, 0xa2, 0x9c, 0x91, 0x78, 0x15, 0x9b, 0x10, 0x09, 0x92, 0xad, 0x21, 0x91, 0xbc,
+ 0x32, 0x20, 0x37, 0xfa, 0x9a, 0x22, 0x13, 0x98, 0x39, 0x84, 0xbd, 0x18, 0x01, 0x8a, 0x53, 0xc1,
+ 0x9c, 0x11, 0x02, 0x09, 0x25, 0x08, 0xc0, 0x0a, 0x98, 0x31, 0x45, 0xd8, 0xac, 0x29, 0x25, 0x90,
+ 0x38, 0xe9, 0x49, 0x00, 0x0e, 0x24, 0x28, 0x82, 0xbb, 0x28, 0x83, 0xab, 0x41, 0xa2, 0x9f, 0x01,
+ 0x98, 0x9a, 0x46, 0x80, 0x13, 0x09, 0xd2, 0x8b, 0x00, 0x02, 0x3a, 0x87, 0xcf, 0x18, 0x24, 0x90,
+ 0x9b, 0x10, 0x30, 0x94, 0xab, 0xbb, 0x73, 0x23, 0xf8, 0x8b, 0x01, 0x10, 0x90, 0xaa, 0x18, 0x33,
+ 0xe8, 0x68, 0x82, 0xbb, 0x19, 0x13, 0x88, 0xb9, 0x71, 0xc4, 0x9e, 0x31, 0x91, 0x18, 0x80, 0x88,
+ 0x8b, 0x24, 0x0a, 0x02, 0x8b, 0x90, 0xfa, 0x8e, 0x03, 0xac, 0x10, 0x10, 0x91, 0x70, 0x04, 0x90,
+ 0xbb, 0x09, 0x44, 0xb8, 0xbd, 0x8a, 0x42, 0xa2, 0x9f, 0x62, 0x01, 0x98, 0xbb, 0x10, 0x44, 0x91,
+ 0x99, 0x88, 0x80, 0x89, 0xeb, 0x51, 0xb0, 0x8b, 0x63, 0x90, 0x32, 0xfa, 0x29, 0x23, 0xa8, 0xcb,
+ 0x20, 0x91, 0x98, 0x8d, 0x33, 0xa8, 0x4b, 0x57, 0x99, 0xba, 0x39, 0x16, 0x18, 0xa0, 0xcc, 0x20,
+ 0x11, 0x02, 0xbb, 0x0a, 0x82, 0x8e, 0x45, 0x88, 0x01, 0x9c, 0x00, 0x41, 0x82, 0xcb, 0x8a, 0x81,
+ 0x8b, 0x02, 0x51, 0x92, 0x0c, 0x34, 0x80, 0xd9, 0x2a, 0x15, 0x21, 0xb0, 0xdc, 0x9b, 0x02, 0x0a,
+ 0x15, 0x8b, 0x13, 0xab, 0x37, 0xb8, 0x51, 0xc8, 0x20, 0x02, 0x01, 0xbd, 0x18, 0x90, 0x9c, 0xba,
+ 0x50, 0x34, 0xb1, 0x1b, 0xc8, 0x74, 0xb1, 0x8a, 0x10, 0x02, 0xdb, 0x8a, 0x80, 0x32, 0x08, 0x27,
+ 0xa8, 0x9c, 0x11, 0x2a, 0x17, 0x09, 0x88, 0x11, 0x1a, 0xd1, 0x9c, 0x20, 0x04, 0x8c, 0xa2, 0x8e,
+ 0x02, 0x28, 0x26, 0x90, 0xca, 0x89, 0x28, 0x26, 0xb0, 0x9f, 0x22, 0xa9, 0x80, 0x19, 0x93, 0xab,
+ 0x78, 0x14, 0xac, 0x09, 0x01, 0x11, 0xbb, 0x20, 0x11, 0x06, 0x8b, 0x91, 0xef, 0x09, 0x21, 0x24,
+ 0x88, 0x19, 0xc8, 0x39, 0x95, 0xac, 0x31, 0x34, 0xd0, 0x9c, 0x31, 0x80, 0xbb, 0x1a, 0x73, 0xb0,
+ 0xc5, 0xcc, 0x4a, 0x00, 0x21, 0x00, 0xc8, 0x9a, 0x19, 0x32, 0x35, 0xb1, 0xaa, 0x3a, 0xa7, 0x0f,
+ 0x81, 0x29, 0xa1, 0x49, 0x24, 0xc9, 0x8b, 0x35, 0xa0, 0x1a, 0x32, 0x85, 0xae, 0x98, 0x48, 0x83,
+ 0xa1, 0xaf, 0x00, 0x52, 0x82, 0x99, 0x09, 0x83, 0xad, 0x40, 0x03, 0x11, 0xdb, 0x0a, 0x01, 0x18,
+ 0x93, 0xbf, 0x25, 0x99, 0x22, 0xba, 0x1a, 0x32, 0x81, 0x32, 0xfa, 0x0d, 0x22, 0xa8, 0x2a, 0xd8,
+ 0x99, 0x9f, 0x53, 0x80, 0x20, 0x02, 0xca, 0x28, 0x81, 0xcc, 0x30, 0x26, 0xc8, 0xbb, 0x08, 0x21,
+ 0x93, 0x9d, 0x00, 0x22, 0x98, 0x80, 0x68, 0x06, 0xca, 0x8a, 0x61, 0x03, 0xd9, 0x9b, 0x24, 0xa8,
+ 0x99, 0xac, 0x22, 0x20, 0x24, 0x42, 0xc0, 0xbb, 0x19, 0x55, 0x92, 0xbd, 0x00, 0x20, 0x90, 0xa8,
+ 0x9d, 0x01, 0x3a, 0x57, 0x90, 0x99, 0x9b, 0x50, 0x14, 0xa0, 0xbb, 0x09, 0x43, 0x83, 0xab, 0x00,
+ 0xeb, 0xbb, 0x30, 0x34, 0x36, 0xc9, 0x0b, 0x00, 0x33, 0x82, 0xde, 0x28, 0x82, 0x99, 0x0a, 0x34,
+ 0xc9, 0x8b, 0x20, 0x33, 0x36, 0xfa, 0x09, 0x12, 0x12, 0xda, 0x99, 0x00, 0x90, 0x89, 0x13, 0xbf,
+ 0x32, 0x20, 0x91, 0xdc, 0xac, 0x71, 0x13, 0xa9, 0x00, 0xbb, 0x62, 0x90, 0x98, 0x39, 0x84, 0x9c,
+ 0x18, 0x15, 0xca, 0x00, 0x98, 0x20, 0x12, 0x30, 0xe1, 0x58, 0xa2, 0xcb, 0x3a, 0x06, 0xaa, 0x00,
+ 0x11, 0x80, 0x32, 0xfa, 0x0d, 0x12, 0x98, 0x28, 0x90, 0x60, 0xc1, 0x1a, 0x82, 0x9a, 0x62, 0x23,
+ 0xda, 0x99, 0x8b, 0x35, 0xb8, 0xab, 0x9a, 0x56, 0xa8, 0x10, 0x10, 0x84, 0x9c, 0x90, 0x71, 0xa1,
+ 0x09, 0x91, 0x0a, 0x02, 0x11, 0xbc, 0x20, 0x81, 0xcb, 0x44, 0xa9, 0x81, 0x60, 0xa8, 0x73, 0xa0,
+ 0xab, 0x32, 0xda, 0x31, 0xc9, 0xbc, 0x29, 0x81, 0x30, 0xb0, 0x7b, 0x15, 0x09, 0x02, 0xcb, 0x8a,
+ 0x16, 0xe2, 0x43, 0x00, 0x48, 0x24, 0x01, 0xcd, 0x98, 0x30, 0xa4, 0xcb, 0x28, 0xa0, 0x61, 0x03,
+ 0xa8, 0x3a, 0xb5, 0x8d, 0x11, 0x12, 0xca, 0x8a, 0x72, 0xa0, 0x9b, 0x88, 0x81, 0x48, 0x05, 0x10,
+ 0xa9, 0x53, 0x98, 0x31, 0xc8, 0xcb, 0x0c, 0x34, 0xb0, 0x9a, 0x00, 0x89, 0x44, 0x12, 0xe9, 0x38,
+ 0xd9, 0x40, 0x12, 0x02, 0x9d, 0x01, 0x22, 0xb0, 0xdb, 0x9c, 0x35, 0x90, 0xc9, 0x1b, 0x36, 0xa1,
+ 0xbc, 0x29, 0x32, 0x26, 0xdb, 0x18, 0x11, 0xd9, 0x0b, 0x23, 0x91, 0x00, 0x8b, 0x07, 0x9c, 0x02,
+ 0x08, 0x81, 0xba, 0x0b, 0x47, 0xb0, 0xac, 0x28, 0x35, 0xa8, 0xab, 0x31, 0x81, 0x91, 0xcf, 0x31,
+ 0x08, 0x91, 0xaf, 0x11, 0x01, 0x89, 0x10, 0xba, 0x58, 0x34, 0x90, 0x9b, 0xac, 0x43, 0x08, 0x14,
+ 0xca, 0xcd, 0x29, 0x13, 0x14, 0xbb, 0x08, 0x41, 0x84, 0x9a, 0x89, 0x64, 0xc8, 0xa9, 0xaa, 0x30,
+ 0x46, 0xa2, 0x9d, 0x91, 0x8b, 0x34, 0x30, 0xb1, 0x0d, 0x11, 0x00, 0x49, 0x27, 0xb9, 0xbc, 0x28,
+ 0x03, 0x10, 0xc8, 0x8a, 0x12, 0x1a, 0x27, 0x88, 0xfa, 0x0a, 0x01, 0x32, 0xa1, 0x0c, 0xa1, 0x6b,
+ 0x13, 0x02, 0x9c, 0xe2, 0x2b, 0x04, 0x51, 0xb8, 0xdb, 0x39, 0x15, 0x00, 0xa8, 0x08, 0x81, 0x18,
+ 0xa1, 0xcf, 0x19, 0x14, 0x18, 0xa1, 0x3a, 0x82, 0xc9, 0x6b, 0x84, 0xab, 0x98, 0xba, 0x60, 0x82,
+ 0xaa, 0xa8, 0x1d, 0x47, 0x80, 0xa8, 0xaa, 0x0b, 0x24, 0x89, 0xc8, 0x0a, 0x26, 0x99, 0x31, 0xb8,
+ 0xcb, 0x29, 0x81, 0x43, 0xb9, 0x11, 0x89, 0x22, 0x93, 0x2e, 0x37, 0xaa, 0xac, 0x31, 0x02, 0xe9,
+ 0x0b, 0xa9, 0x76, 0x83, 0xb9, 0x0a, 0xa0, 0x52, 0x80, 0x00, 0xb9, 0xbb, 0x00, 0xb9, 0x79, 0x84,
+ 0x0c, 0x03, 0x2a, 0x82, 0xbc, 0x18, 0x25, 0x21, 0xa8, 0xaa, 0x60, 0xb2, 0x0c, 0x21, 0xf0, 0x0c,
+ 0x4d, 0xf0, 0x45, 0x00, 0x80, 0x40, 0x13, 0x99, 0xf9, 0x2b, 0x25, 0x91, 0xbd, 0x89, 0x20, 0x03,
+ 0x10, 0x22, 0xb1, 0xaf, 0x19, 0x23, 0xda, 0xdb, 0x78, 0x03, 0x89, 0x99, 0x01, 0x60, 0x93, 0x09,
+ 0xe9, 0x09, 0x89, 0x00, 0x10, 0x13, 0xdc, 0x28, 0x14, 0x00, 0x10, 0xc8, 0x19, 0xc2, 0x8b, 0x32,
+ 0x84, 0x8c, 0x83, 0x7a, 0xe3, 0x2b, 0x94, 0x8b, 0x23, 0x81, 0xcc, 0x09, 0x08, 0x56, 0x91, 0x99,
+ 0xbb, 0x28, 0x20, 0x05, 0xbb, 0x11, 0x08, 0xa0, 0x71, 0xc2, 0x09, 0x89, 0x43, 0xca, 0x09, 0xa2,
+ 0x0c, 0xc8, 0x70, 0x80, 0x21, 0x00, 0x12, 0xc9, 0xbc, 0x89, 0x52, 0x02, 0xda, 0x28, 0xa0, 0xac,
+ 0x22, 0x88, 0x35, 0xc9, 0x38, 0xa3, 0x9f, 0x43, 0x81, 0xc9, 0x89, 0x30, 0x14, 0x81, 0xfb, 0x1a,
+ 0x02, 0x89, 0xcb, 0x58, 0x33, 0x12, 0xc8, 0x9f, 0x80, 0x72, 0x82, 0xa9, 0xbc, 0x39, 0x12, 0x20,
+ 0x91, 0xab, 0xdb, 0x30, 0x23, 0x52, 0xd2, 0xae, 0x11, 0x20, 0x14, 0xdb, 0x09, 0x01, 0x11, 0x00,
+ 0x19, 0x91, 0x8a, 0x10, 0x27, 0xc9, 0x10, 0xca, 0x09, 0xb0, 0x09, 0x80, 0x41, 0x57, 0xd8, 0x19,
+ 0x90, 0x88, 0x28, 0x37, 0x81, 0xbd, 0x9a, 0x40, 0x02, 0x30, 0xa1, 0xcb, 0x0d, 0x24, 0x81, 0x0a,
+ 0xb1, 0x9d, 0x21, 0x24, 0x11, 0x31, 0xf8, 0xbe, 0x20, 0x14, 0x08, 0xb0, 0x9c, 0x11, 0x80, 0x9a,
+ 0x32, 0x82, 0xdb, 0x38, 0x25, 0xb8, 0xdd, 0x29, 0x16, 0xa8, 0x9a, 0x43, 0xb0, 0x8a, 0x81, 0x01,
+ 0xcd, 0x72, 0x01, 0x00, 0xbc, 0x9a, 0x32, 0x33, 0x92, 0x9b, 0xd9, 0x28, 0xc1, 0x49, 0x26, 0xb8,
+ 0xab, 0x28, 0x33, 0x24, 0xda, 0x08, 0xbb, 0x43, 0x42, 0x82, 0xaa, 0xbc, 0x0a, 0x11, 0xb9, 0x78,
+ 0x04, 0x9d, 0x34, 0x80, 0xd9, 0x9b, 0x21, 0x25, 0x90, 0xaa, 0xc8, 0xaf, 0x11, 0x31, 0x23, 0xd0,
+ 0xb1, 0xda, 0x46, 0x00, 0x48, 0x04, 0x88, 0x89, 0xaa, 0x50, 0x24, 0xb0, 0xab, 0x98, 0x08, 0x31,
+ 0x46, 0xa8, 0x99, 0x0b, 0x67, 0xb0, 0x8d, 0x82, 0x8a, 0x01, 0x51, 0xa1, 0x9a, 0x12, 0xcb, 0x28,
+ 0x24, 0x99, 0x12, 0xdf, 0x10, 0x43, 0x98, 0x99, 0x99, 0x34, 0x00, 0x90, 0xdb, 0x1b, 0x04, 0xab,
+ 0x12, 0x0a, 0x94, 0x0c, 0x82, 0x51, 0x82, 0xba, 0x9c, 0x73, 0x84, 0x8a, 0xb0, 0x9f, 0x20, 0x02,
+ 0x00, 0x90, 0x58, 0x91, 0x18, 0xad, 0x80, 0x0c, 0x34, 0xa1, 0x9b, 0xc1, 0x9d, 0x20, 0x13, 0x61,
+ 0xa2, 0x0d, 0x23, 0xb9, 0x1c, 0x91, 0x9f, 0x22, 0x18, 0x85, 0xaa, 0xd9, 0x38, 0x02, 0x12, 0xbd,
+ 0x21, 0x62, 0xa1, 0xaa, 0x9b, 0xb2, 0x7a, 0x15, 0x80, 0x9c, 0x80, 0xab, 0x42, 0x02, 0x9b, 0x81,
+ 0x6b, 0x86, 0x1b, 0xb0, 0x3b, 0x13, 0x33, 0xb9, 0xfb, 0x9c, 0x21, 0x98, 0x30, 0xf2, 0x1c, 0x25,
+ 0x11, 0xc9, 0x89, 0x09, 0x14, 0x00, 0xa1, 0x8b, 0xa1, 0x8e, 0x34, 0x98, 0x90, 0x29, 0x85, 0x2a,
+ 0xa1, 0x9d, 0xcc, 0x52, 0x90, 0x02, 0x19, 0xc1, 0x39, 0xa0, 0x81, 0x9f, 0x25, 0x99, 0x98, 0x80,
+ 0x9b, 0x75, 0x02, 0xcb, 0x18, 0x30, 0x25, 0xcb, 0xa8, 0x0a, 0x82, 0x71, 0x92, 0x9b, 0x90, 0x1b,
+ 0x04, 0x68, 0xa1, 0x8d, 0x90, 0x8a, 0x44, 0xb9, 0x20, 0x88, 0xb9, 0x51, 0xa1, 0x8a, 0x45, 0xa2,
+ 0xbe, 0x28, 0x01, 0x90, 0x69, 0xb2, 0x2b, 0xa3, 0xab, 0x98, 0x68, 0x07, 0x88, 0x81, 0x99, 0xcc,
+ 0x39, 0x35, 0x91, 0x19, 0xb1, 0x8b, 0xdb, 0x73, 0xb3, 0x0a, 0x98, 0x01, 0x01, 0x9b, 0x15, 0x0d,
+ 0x26, 0x89, 0xa0, 0x9c, 0x00, 0x21, 0x32, 0xe9, 0x9b, 0x9a, 0x40, 0x42, 0x33, 0xe8, 0x8b, 0x90,
+ 0x6a, 0x04, 0x99, 0xba, 0x08, 0x42, 0x01, 0x80, 0xdf, 0x20, 0x01, 0x24, 0xb8, 0xaa, 0x28, 0x05,
+ 0xce, 0x13, 0x46, 0x00, 0x88, 0xc9, 0x18, 0x80, 0x8b, 0x47, 0xb9, 0x18, 0xa8, 0x51, 0x93, 0x1a,
+ 0xe2, 0x8c, 0x22, 0x20, 0x02, 0xfd, 0x19, 0x22, 0x02, 0xa9, 0xb8, 0x9d, 0x22, 0x02, 0x99, 0x00,
+ 0xb9, 0xba, 0x74, 0xa4, 0x39, 0xf9, 0x19, 0x03, 0x80, 0x89, 0xb9, 0x9a, 0x29, 0x47, 0x01, 0xd0,
+ 0x0d, 0x03, 0x08, 0x21, 0xb0, 0x9d, 0xa8, 0x50, 0x13, 0x10, 0xd8, 0x8b, 0x10, 0x34, 0x11, 0xe9,
+ 0x8b, 0x21, 0x14, 0x0a, 0x95, 0x9e, 0x80, 0x31, 0x82, 0xdc, 0x09, 0xa1, 0x39, 0x26, 0x00, 0xc8,
+ 0x8c, 0x12, 0x32, 0x88, 0xc0, 0x1c, 0xb2, 0x78, 0xa1, 0x1a, 0xb0, 0x49, 0x83, 0x08, 0xd9, 0x19,
+ 0x9b, 0x32, 0x11, 0xfa, 0x3d, 0x83, 0x18, 0x28, 0x84, 0x20, 0xfe, 0x38, 0x91, 0x01, 0xa9, 0x08,
+ 0xa1, 0x0c, 0x14, 0x8b, 0xa0, 0x60, 0x01, 0x23, 0xdd, 0x28, 0xa0, 0x1b, 0x17, 0x88, 0x98, 0x19,
+ 0x10, 0xb0, 0x5b, 0xc4, 0x0d, 0x83, 0x29, 0x03, 0xaa, 0xbd, 0x09, 0x65, 0x04, 0xaa, 0x8b, 0x90,
+ 0x40, 0x13, 0x90, 0xbd, 0x9a, 0x52, 0x92, 0x19, 0x83, 0xad, 0xb9, 0x72, 0x92, 0x11, 0xaa, 0xc8,
+ 0x5b, 0x04, 0x10, 0xeb, 0x09, 0x32, 0x04, 0xaa, 0x09, 0x98, 0xb9, 0x70, 0x06, 0xaa, 0xaa, 0x18,
+ 0x20, 0x25, 0xa8, 0xbb, 0x12, 0x52, 0xd1, 0x19, 0x01, 0xb0, 0x8e, 0x11, 0x24, 0xad, 0x00, 0x48,
+ 0x23, 0x90, 0x9d, 0x03, 0xac, 0x00, 0x52, 0x84, 0xad, 0x80, 0x8b, 0x22, 0x43, 0xd9, 0x08, 0x10,
+ 0x01, 0x22, 0xee, 0x18, 0x88, 0x31, 0x82, 0xcb, 0x28, 0x90, 0x48, 0x01, 0x22, 0xfb, 0x19, 0xa8,
+ 0x58, 0x82, 0x33, 0xed, 0x18, 0x30, 0x13, 0xb9, 0x9c, 0x22, 0xda, 0x41, 0xa2, 0x9b, 0xaa, 0x53,
+ 0x42, 0xa1, 0x8a, 0x80, 0xeb, 0x39, 0x92, 0x41, 0x12, 0xc1, 0xdf, 0x18, 0x80, 0x80, 0x18, 0x03,
+ 0x6e, 0xfa, 0x40, 0x00, 0x9a, 0x62, 0xc1, 0xac, 0x09, 0x36, 0x01, 0x88, 0xca, 0x8b, 0x88, 0x26,
+ 0x80, 0x01, 0xba, 0x3a, 0xf8, 0x7c, 0xa3, 0x08, 0xb9, 0x20, 0x11, 0x88, 0x83, 0x9f, 0x08, 0x21,
+ 0x30, 0xc3, 0x1c, 0xba, 0x44, 0x8a, 0x17, 0xda, 0x8a, 0x01, 0x20, 0x94, 0x30, 0xf8, 0x18, 0x90,
+ 0x20, 0x02, 0x99, 0xaa, 0x98, 0x38, 0x31, 0x95, 0x8f, 0x85, 0x8b, 0x03, 0x88, 0x0a, 0x91, 0x1c,
+ 0xf3, 0x2b, 0x03, 0x08, 0x99, 0xa8, 0x31, 0xba, 0x37, 0xac, 0x01, 0x60, 0xa2, 0x19, 0xc0, 0x0a,
+ 0x01, 0x98, 0x75, 0xd0, 0x2a, 0xc8, 0x41, 0x01, 0x90, 0xab, 0x40, 0x23, 0x21, 0xec, 0x20, 0xca,
+ 0x11, 0x21, 0xa1, 0x98, 0x0d, 0x91, 0x73, 0x94, 0xb9, 0x8d, 0x80, 0x42, 0x89, 0x01, 0x89, 0xd9,
+ 0x28, 0x31, 0x03, 0xa1, 0xaf, 0x81, 0x58, 0xa0, 0x01, 0x8e, 0x82, 0x50, 0x90, 0x21, 0xa0, 0x0a,
+ 0x84, 0x0d, 0x14, 0xa1, 0x9f, 0xa0, 0x58, 0x83, 0x00, 0xab, 0xa8, 0x8c, 0x24, 0x22, 0x98, 0xbb,
+ 0x1a, 0x13, 0x2d, 0x07, 0x2b, 0xf0, 0x3a, 0x01, 0x04, 0x2b, 0xc2, 0x8d, 0x31, 0x93, 0x8a, 0x98,
+ 0xa1, 0x8e, 0x81, 0x88, 0x41, 0xf0, 0x2b, 0x82, 0x01, 0x28, 0xb2, 0xcc, 0x4b, 0x07, 0x89, 0x81,
+ 0x89, 0x81, 0xbc, 0x51, 0x80, 0x80, 0x1a, 0x11, 0xd2, 0x3c, 0x96, 0x8a, 0x99, 0x11, 0x18, 0x23,
+ 0x32, 0xeb, 0x88, 0x32, 0xfd, 0x28, 0x80, 0xca, 0x30, 0x11, 0x33, 0xfa, 0x8a, 0x23, 0x99, 0x11,
+ 0x89, 0x09, 0xd8, 0x0c, 0x80, 0x57, 0xa9, 0x21, 0xb9, 0x72, 0xb2, 0x8d, 0x92, 0x0b, 0xa3, 0x3b,
+ 0x85, 0x08, 0x8a, 0x84, 0x5a, 0xc3, 0x2c, 0x92, 0x19, 0x09, 0x90, 0x40, 0xd9, 0x22, 0xad, 0x33,
+ 0x40, 0xe2, 0x1c, 0x05, 0xa9, 0x90, 0x19, 0x92, 0x0a, 0xaa, 0x33, 0x39, 0x07, 0xcd, 0x29, 0x04,
+ 0x2e, 0xf0, 0x48, 0x00, 0x31, 0xaa, 0x11, 0x80, 0xbc, 0x31, 0x83, 0x9c, 0xa0, 0x78, 0xb1, 0x38,
+ 0xa1, 0xa0, 0x09, 0x73, 0xa4, 0x0d, 0x82, 0x09, 0x81, 0xcd, 0x51, 0xb0, 0x28, 0xd9, 0x28, 0x03,
+ 0x0a, 0xb2, 0x2a, 0xfb, 0x7c, 0x01, 0x08, 0x99, 0xa9, 0x20, 0x91, 0x53, 0x90, 0xda, 0x19, 0x12,
+ 0x41, 0x05, 0xbd, 0x28, 0x92, 0x69, 0x83, 0x0b, 0xb2, 0x8e, 0x01, 0x88, 0x42, 0xb8, 0xab, 0x38,
+ 0x06, 0xba, 0x51, 0xa0, 0x0a, 0x80, 0x09, 0x84, 0x5b, 0xa5, 0x1c, 0xb1, 0x28, 0x90, 0x01, 0x50,
+ 0x82, 0x23, 0xbf, 0x00, 0xac, 0x33, 0x52, 0x83, 0x09, 0xa8, 0xb1, 0x8f, 0x95, 0x1b, 0x12, 0x13,
+ 0xbe, 0x00, 0x40, 0xa3, 0xab, 0x59, 0x03, 0x20, 0xc9, 0x9a, 0x21, 0xce, 0x10, 0x11, 0x09, 0x86,
+ 0x0c, 0xe8, 0x28, 0x80, 0x12, 0x0a, 0x05, 0x9a, 0x00, 0xdc, 0x20, 0x10, 0xb2, 0x1f, 0x91, 0x29,
+ 0x03, 0xcc, 0x30, 0x31, 0x17, 0x9c, 0x91, 0x1b, 0x90, 0x50, 0xa1, 0x29, 0xb1, 0x4a, 0xb3, 0x0d,
+ 0x14, 0x8a, 0x84, 0x9e, 0x81, 0x48, 0xb3, 0x0d, 0x01, 0xa9, 0x31, 0xb0, 0x41, 0x90, 0x08, 0xc8,
+ 0x8a, 0xd8, 0x0a, 0x35, 0xa8, 0x71, 0x90, 0x19, 0x82, 0xaf, 0x25, 0xab, 0x24, 0xaa, 0x38, 0xd3,
+ 0x1c, 0xc1, 0x38, 0xa9, 0x21, 0x00, 0x80, 0x98, 0x4a, 0xa4, 0x0c, 0xf9, 0x38, 0x92, 0x28, 0xa4,
+ 0x3a, 0xd2, 0x1a, 0x81, 0x01, 0x55, 0xdc, 0x32, 0xea, 0x32, 0xa9, 0x88, 0x88, 0xb8, 0x40, 0x11,
+ 0x12, 0xbc, 0x43, 0x01, 0xda, 0x40, 0xb1, 0x9b, 0x1a, 0xa3, 0x68, 0xc8, 0x43, 0xde, 0x30, 0x81,
+ 0x18, 0xa2, 0x1b, 0xb4, 0x6a, 0x91, 0x19, 0x98, 0x32, 0xc9, 0x89, 0x98, 0x68, 0x93, 0x2a, 0xd1,
+ 0x09, 0x09, 0x47, 0x99, 0x01, 0x99, 0x89, 0x32, 0xaa, 0x11, 0x0a, 0xb4, 0xbf, 0x25, 0x09, 0x22,
+ 0xa9, 0x1a, 0x3e, 0x00, 0xda, 0x19, 0x00, 0x23, 0xdb, 0x20, 0x04, 0xfb, 0x38, 0x85, 0x9a, 0x18,
+ 0x15, 0x89, 0xc9, 0x39, 0x90, 0x80, 0x9c, 0x00, 0x61, 0x24, 0xca, 0x18, 0x58, 0x06, 0xab, 0x89,
+ 0x10, 0x9a, 0x99, 0x64, 0xc9, 0x20, 0x90, 0x0a, 0x25, 0x8a, 0xc0, 0x4b, 0x83, 0xa9, 0x2c, 0xb3,
+ 0x0d, 0x10, 0xa0, 0x2c, 0x15, 0xcb, 0x61, 0xd0, 0x29, 0x01, 0x88, 0xba, 0x20, 0x26, 0xb8, 0x1a,
+ 0x90, 0x4b, 0xa4, 0x0c, 0xb1, 0x4a, 0x13, 0xfb, 0x3a, 0x85, 0x89, 0x80, 0x08, 0x08, 0x42, 0xa1,
+ 0x29, 0xf9, 0x30, 0xb1, 0xab, 0x29, 0xa1, 0x3a, 0xd1, 0x8c, 0x22, 0x09, 0x32, 0xa3, 0x8f, 0x03,
+ 0x19, 0xab, 0x37, 0x08, 0xe8, 0x58, 0xb1, 0x38, 0xb8, 0x48, 0x90, 0x43, 0xab, 0x16, 0xac, 0x14,
+ 0x89, 0x98, 0x12, 0x19, 0xf3, 0x9f, 0x84, 0x19, 0x90, 0x28, 0xc9, 0x58, 0x83, 0x9a, 0x00, 0xca,
+ 0x58, 0x81, 0x31, 0xda, 0x22, 0xcb, 0x34, 0xa8, 0x08, 0xab, 0x52, 0x91, 0x51, 0xc2, 0x9b, 0x98,
+ 0x44, 0x00, 0x02, 0xbb, 0xcb, 0x51, 0x02, 0xca, 0x50, 0xe9, 0x19, 0x91, 0x00, 0x32, 0xb2, 0xbf,
+ 0x24, 0xba, 0x31, 0x10, 0xa2, 0x0c, 0x8a, 0x83, 0x1e, 0x84, 0x8a, 0x28, 0x05, 0x9c, 0x80, 0x10,
+ 0x99, 0xc8, 0x78, 0x15, 0xd9, 0x19, 0x11, 0x02, 0xbc, 0x30, 0x84, 0x9c, 0x81, 0x99, 0x38, 0x37,
+ 0x99, 0x89, 0x33, 0xd8, 0xab, 0x52, 0xb8, 0x50, 0xc2, 0x0c, 0x14, 0xaa, 0x8a, 0x23, 0x8a, 0x07,
+ 0x0a, 0x82, 0xa9, 0x8a, 0x11, 0x89, 0x42, 0xd8, 0x9a, 0x30, 0xa5, 0x39, 0xfc, 0x2d, 0x11, 0x81,
+ 0x31, 0xda, 0x0a, 0x28, 0x05, 0x99, 0x19, 0x05, 0x9b, 0x23, 0xd8, 0xbb, 0x48, 0x94, 0x8e, 0x24,
+ 0x00, 0x9a, 0x13, 0xae, 0x23, 0x09, 0x02, 0x80, 0xba, 0xa9, 0x8b, 0x56, 0xa1, 0x11, 0xaa, 0x12,
+ 0x33, 0x0d, 0x3b, 0x00, 0x24, 0xcf, 0x33, 0xcc, 0x28, 0xa0, 0x20, 0x00, 0xa0, 0x70, 0xa0, 0x19,
+ 0xca, 0x31, 0x02, 0xbb, 0x19, 0x63, 0x90, 0x01, 0x2a, 0xa7, 0x8f, 0x22, 0xa8, 0x29, 0x04, 0x9b,
+ 0x32, 0xa0, 0x88, 0x8a, 0x83, 0x2a, 0xfa, 0x3f, 0xa2, 0x29, 0xed, 0x40, 0x01, 0xa8, 0x2a, 0xc0,
+ 0x4a, 0x92, 0x88, 0xa9, 0x51, 0xb1, 0x0d, 0x44, 0x90, 0x18, 0x90, 0xba, 0x59, 0x85, 0x8a, 0x11,
+ 0xc8, 0x1c, 0xa1, 0x30, 0xb0, 0x80, 0x2d, 0x17, 0xa9, 0x19, 0x23, 0xaa, 0x09, 0x81, 0x71, 0xf0,
+ 0x38, 0xc1, 0x0a, 0x22, 0xb0, 0x8d, 0x33, 0x9a, 0x22, 0x08, 0xfb, 0x40, 0xb0, 0x38, 0x81, 0x00,
+ 0x08, 0xa1, 0x8c, 0x10, 0x25, 0xef, 0x10, 0x31, 0xa2, 0x8d, 0x80, 0x31, 0x90, 0x80, 0xcf, 0x61,
+ 0xa0, 0x18, 0x10, 0x00, 0x28, 0xc8, 0x20, 0xeb, 0x31, 0xb8, 0x29, 0xa3, 0x9e, 0x22, 0x20, 0xf0,
+ 0x3b, 0x95, 0x3a, 0x83, 0xba, 0x4b, 0x87, 0x9b, 0x10, 0x80, 0x9b, 0x02, 0x81, 0x8b, 0x05, 0x09,
+ 0xfc, 0x31, 0x00, 0x91, 0x39, 0xd9, 0x32, 0x09, 0xe3, 0x2c, 0x82, 0x10, 0x20, 0xf9, 0x3a, 0xa2,
+ 0x9a, 0x98, 0x8c, 0x37, 0xb8, 0x88, 0x98, 0x32, 0x89, 0x14, 0xbe, 0xa8, 0x38, 0x00, 0x24, 0x38,
+ 0xe5, 0x0c, 0x04, 0x98, 0x22, 0xd9, 0x0b, 0x36, 0xb9, 0x29, 0x08, 0xb0, 0x2a, 0x89, 0x85, 0x1e,
+ 0x84, 0xa9, 0x8a, 0x27, 0xaa, 0x11, 0x00, 0xda, 0x10, 0x20, 0xa1, 0x8d, 0x13, 0xbb, 0x74, 0xc2,
+ 0x0a, 0x02, 0x88, 0x89, 0x44, 0xca, 0x28, 0x11, 0x92, 0x0b, 0x06, 0xbb, 0x01, 0x10, 0xb1, 0x39,
+ 0xd8, 0x8a, 0x10, 0xfb, 0x71, 0x92, 0x9b, 0x43, 0xd8, 0x8a, 0x30, 0xb2, 0xad, 0x11, 0x01, 0x51,
+ 0xc2, 0x8d, 0x02, 0x48, 0xc3, 0x1c, 0x93, 0x8b, 0x20, 0x02, 0xab, 0x32, 0xf9, 0x49, 0x03, 0x28,
+ 0x10, 0x0a, 0x3d, 0x00, 0xbb, 0x62, 0xc9, 0x73, 0xd1, 0x1a, 0x00, 0x00, 0x08, 0xa0, 0x50, 0xd9,
+ 0x28, 0x02, 0x80, 0x10, 0xea, 0x19, 0x22, 0xa8, 0x71, 0xd0, 0x19, 0x81, 0x01, 0xbb, 0x15, 0x8d,
+ 0x02, 0x2a, 0x95, 0x0b, 0x01, 0x98, 0x0c, 0x13, 0xbb, 0x61, 0x92, 0x1b, 0x25, 0xc9, 0x09, 0x90,
+ 0x9b, 0x47, 0xa8, 0x19, 0x09, 0xa1, 0x8e, 0x32, 0xa1, 0x48, 0x02, 0xe8, 0x8d, 0x15, 0xaa, 0x18,
+ 0x02, 0xab, 0x43, 0xb8, 0x31, 0xda, 0x11, 0xbe, 0x53, 0x90, 0x10, 0xb9, 0x40, 0xa2, 0x9c, 0x28,
+ 0x03, 0x21, 0xa9, 0x41, 0xa8, 0x00, 0x8b, 0xf2, 0xcf, 0x24, 0x08, 0x81, 0x0b, 0x23, 0xca, 0x0a,
+ 0x10, 0xc1, 0x69, 0xa2, 0x59, 0xd8, 0x38, 0xc0, 0x0b, 0x01, 0x13, 0xbb, 0x36, 0xb8, 0xbc, 0x71,
+ 0xb0, 0x89, 0x38, 0xb2, 0x49, 0xb0, 0x49, 0x15, 0xda, 0x88, 0x19, 0x16, 0xa9, 0x41, 0xd1, 0x0c,
+ 0x01, 0x80, 0x18, 0x83, 0xdb, 0x38, 0x24, 0x81, 0xaa, 0x03, 0x9c, 0x88, 0x57, 0xc9, 0x21, 0x99,
+ 0x08, 0x41, 0xa0, 0x8b, 0x20, 0xb8, 0x09, 0x1b, 0x57, 0xcb, 0x10, 0xba, 0x71, 0x93, 0x0a, 0x91,
+ 0x0b, 0x05, 0x9e, 0x22, 0xc9, 0x28, 0x84, 0x9b, 0x43, 0x81, 0x99, 0x00, 0xad, 0x23, 0x89, 0x17,
+ 0xac, 0x38, 0x91, 0x1c, 0x84, 0x9e, 0x02, 0x8a, 0x22, 0x00, 0xd8, 0x0a, 0x01, 0x81, 0x9c, 0x22,
+ 0x13, 0xbb, 0x13, 0x9f, 0x24, 0x91, 0xbc, 0x00, 0x4b, 0x07, 0x88, 0xa8, 0x00, 0xb9, 0x48, 0x85,
+ 0xaf, 0x41, 0xb0, 0x29, 0xb0, 0x30, 0x09, 0x93, 0x1d, 0xa1, 0x48, 0x12, 0x14, 0xdc, 0x38, 0xa1,
+ 0x28, 0x42, 0xf9, 0x3c, 0x02, 0x90, 0xac, 0x81, 0x09, 0x88, 0x74, 0xa8, 0x09, 0x12, 0xc8, 0x48,
+ 0xa2, 0x8b, 0x24, 0x99, 0x82, 0x49, 0xf3, 0x2b, 0x02, 0xc9, 0x4a, 0x16, 0x9a, 0x08, 0xc1, 0x3b,
+ 0x80, 0x0e, 0x41, 0x00, 0xc8, 0x88, 0x09, 0xa0, 0x51, 0xea, 0x40, 0xa0, 0x20, 0xb0, 0x29, 0x14,
+ 0x91, 0x18, 0xe1, 0x1b, 0x82, 0x54, 0xb8, 0x09, 0x31, 0x82, 0x8a, 0xe1, 0x8c, 0xb9, 0x71, 0xc1,
+ 0x1a, 0x25, 0xb9, 0x2a, 0x14, 0xac, 0x42, 0x99, 0xa0, 0x5b, 0x94, 0x0a, 0x00, 0x05, 0x9d, 0x12,
+ 0x0a, 0x22, 0x01, 0xac, 0x32, 0xca, 0x31, 0xd9, 0x20, 0xb0, 0x48, 0xf2, 0x0e, 0x12, 0x88, 0xbb,
+ 0x70, 0x92, 0x08, 0x98, 0x99, 0x49, 0x84, 0x9a, 0x00, 0xb9, 0x5a, 0x85, 0x8a, 0x88, 0x12, 0xbe,
+ 0x44, 0x00, 0xb8, 0x3a, 0x83, 0xa9, 0x8c, 0x16, 0xbd, 0x42, 0xa0, 0x19, 0x21, 0xa8, 0x30, 0xa0,
+ 0x99, 0x8f, 0x17, 0xbb, 0x32, 0xb8, 0x1a, 0x14, 0xba, 0x98, 0x48, 0xb3, 0x70, 0xc1, 0x28, 0xaa,
+ 0xa0, 0x1c, 0xb1, 0x44, 0xce, 0x51, 0x98, 0x1a, 0x03, 0xab, 0x33, 0xcc, 0x30, 0x12, 0xb9, 0x10,
+ 0xc9, 0x78, 0x83, 0xab, 0x18, 0x32, 0xd0, 0x8d, 0x13, 0x89, 0x04, 0xbc, 0x31, 0xc9, 0x50, 0x13,
+ 0x80, 0xa0, 0xad, 0x51, 0x91, 0x0a, 0x81, 0x1a, 0xe2, 0x6a, 0xa1, 0x50, 0x91, 0xaa, 0x4b, 0x86,
+ 0x0a, 0x00, 0x02, 0xaf, 0x32, 0x88, 0x80, 0x11, 0xbc, 0x01, 0x38, 0xa4, 0x1e, 0x13, 0xbb, 0x49,
+ 0x26, 0xcb, 0x28, 0xa1, 0x0d, 0x24, 0x90, 0xbb, 0x30, 0xa1, 0xaa, 0x72, 0xb0, 0x1a, 0x15, 0xaa,
+ 0x22, 0xeb, 0x89, 0x40, 0x91, 0x10, 0x9a, 0xa2, 0x8f, 0x16, 0xbb, 0x42, 0x90, 0x89, 0x19, 0x90,
+ 0x11, 0xba, 0x42, 0xb0, 0x5a, 0x95, 0x9d, 0x34, 0xf8, 0x2a, 0x93, 0x1c, 0x04, 0x8a, 0x90, 0x19,
+ 0x15, 0xb9, 0x38, 0xb2, 0x0c, 0x02, 0x20, 0x10, 0x84, 0xaf, 0x12, 0xbb, 0x44, 0xa8, 0x41, 0xfb,
+ 0x40, 0xb0, 0x39, 0x83, 0xca, 0x10, 0xba, 0x37, 0xaa, 0x83, 0x8e, 0x82, 0x28, 0xb0, 0x8c, 0x13,
+ 0x54, 0xfa, 0x3f, 0x00, 0x28, 0xb0, 0x42, 0xab, 0x21, 0xd8, 0x9d, 0x12, 0x0b, 0x16, 0xaa, 0x51,
+ 0xb2, 0x1b, 0x12, 0x33, 0xdc, 0x30, 0x84, 0xbd, 0x20, 0x81, 0x99, 0x72, 0xa0, 0x08, 0x0a, 0x85,
+ 0x29, 0xb1, 0x1b, 0xb0, 0x09, 0x57, 0xeb, 0x10, 0x9b, 0x12, 0x28, 0x82, 0x13, 0xbe, 0xa9, 0x72,
+ 0xa2, 0x88, 0x8a, 0xb2, 0x3d, 0x17, 0x90, 0x1b, 0xb3, 0x0d, 0x04, 0x89, 0x10, 0x88, 0x00, 0x40,
+ 0x03, 0xcc, 0x8a, 0x13, 0xcd, 0x30, 0x93, 0x9d, 0x22, 0xa0, 0x99, 0x0c, 0x24, 0xb8, 0x60, 0xa3,
+ 0x8e, 0x23, 0x80, 0x9c, 0xb1, 0x5b, 0x06, 0x00, 0xca, 0x28, 0x80, 0x82, 0x0b, 0xc1, 0x49, 0xb0,
+ 0x02, 0xbf, 0x16, 0x09, 0xa2, 0x1a, 0xa1, 0x0d, 0x36, 0xc9, 0x38, 0xa0, 0x08, 0x10, 0x22, 0xdb,
+ 0x28, 0xa9, 0x32, 0xb9, 0xab, 0x98, 0x69, 0x04, 0x50, 0xc8, 0x2b, 0x15, 0xbb, 0x54, 0xa9, 0x88,
+ 0x09, 0x82, 0x0a, 0x17, 0xbc, 0x22, 0x98, 0x02, 0x8a, 0x04, 0xac, 0x88, 0x51, 0xc9, 0x30, 0xc9,
+ 0x09, 0x31, 0x24, 0xdb, 0x73, 0xa8, 0x10, 0x41, 0xf0, 0x3a, 0x83, 0x9a, 0x08, 0xa2, 0x2a, 0x83,
+ 0xbc, 0xb8, 0x2c, 0x17, 0xbb, 0x52, 0x81, 0x9a, 0xa8, 0x58, 0x22, 0x91, 0x8c, 0xd1, 0x39, 0x04,
+ 0x12, 0xad, 0x23, 0xec, 0x40, 0xb1, 0x28, 0x91, 0xcb, 0x41, 0xfa, 0x38, 0x83, 0xba, 0x30, 0xd8,
+ 0x20, 0x00, 0x91, 0x10, 0xa9, 0x93, 0x0f, 0x84, 0x2b, 0x05, 0x99, 0x28, 0xa2, 0x9d, 0x52, 0x92,
+ 0xac, 0x10, 0x20, 0xc2, 0x3c, 0x86, 0x9c, 0x00, 0x90, 0x18, 0x94, 0x8c, 0x12, 0x10, 0xdd, 0x18,
+ 0x18, 0x25, 0xb9, 0x19, 0xa8, 0x3a, 0x17, 0xaa, 0xc8, 0x49, 0x93, 0x1a, 0x00, 0x01, 0x50, 0xd3,
+ 0x0c, 0x03, 0x1a, 0x92, 0x11, 0xaf, 0x32, 0x8b, 0x84, 0x18, 0xdb, 0x25, 0xad, 0x25, 0x99, 0x00,
+ 0x08, 0x09, 0x41, 0x00, 0xb0, 0x2a, 0xa2, 0x1b, 0x88, 0x12, 0x38, 0xf8, 0x50, 0xc0, 0x1a, 0x02,
+ 0xfb, 0x48, 0xb0, 0x29, 0xc2, 0x4a, 0x84, 0x0a, 0x82, 0x9b, 0x00, 0x81, 0x0c, 0x37, 0xbc, 0x18,
+ 0x28, 0x04, 0xad, 0x31, 0xa1, 0x29, 0x92, 0x39, 0xd3, 0x69, 0xa1, 0x19, 0xa9, 0x32, 0x48, 0xd3,
+ 0x0c, 0x13, 0x99, 0x5a, 0x85, 0x8d, 0x32, 0xda, 0x28, 0x00, 0x90, 0x29, 0xc1, 0x3b, 0x26, 0xa9,
+ 0x20, 0xd9, 0x50, 0xa1, 0x8c, 0x13, 0xeb, 0x20, 0xa0, 0x19, 0x11, 0x90, 0x8c, 0x05, 0xab, 0x41,
+ 0xa2, 0x0c, 0x93, 0x1a, 0xb9, 0x67, 0xd9, 0x30, 0xb1, 0x0c, 0x01, 0x08, 0x30, 0xc2, 0x39, 0xf2,
+ 0x8a, 0x10, 0x13, 0x1a, 0x84, 0xac, 0x08, 0x72, 0x81, 0x0a, 0x13, 0xca, 0x99, 0x08, 0x44, 0xa1,
+ 0x8d, 0x12, 0x8b, 0x14, 0x99, 0x00, 0x03, 0xaf, 0x43, 0x89, 0x32, 0xe8, 0x0c, 0x81, 0x10, 0x18,
+ 0x92, 0x3c, 0xf2, 0x39, 0xb9, 0x80, 0x2b, 0xc4, 0x4a, 0xf8, 0x39, 0x23, 0xd9, 0x88, 0xaa, 0x25,
+ 0x99, 0x11, 0x00, 0x8b, 0x85, 0x9f, 0x03, 0x1a, 0x04, 0xac, 0x28, 0x12, 0x01, 0x30, 0xc2, 0x0f,
+ 0xa2, 0x1b, 0x83, 0x99, 0x62, 0xa0, 0x41, 0xb8, 0x50, 0xd0, 0x29, 0xa4, 0x9d, 0x21, 0x00, 0x31,
+ 0xf0, 0x0b, 0x93, 0x1a, 0x04, 0xca, 0x4a, 0xa3, 0x59, 0xb1, 0x19, 0x89, 0x91, 0x1b, 0xa0, 0x41,
+ 0x42, 0xf2, 0x4a, 0x82, 0x8a, 0x40, 0x04, 0xf9, 0x1b, 0x13, 0x8c, 0x24, 0xb0, 0x8a, 0x10, 0x99,
+ 0x30, 0x02, 0xcd, 0x8b, 0x41, 0x91, 0xac, 0x31, 0xc1, 0x8d, 0x63, 0x81, 0x19, 0xb0, 0x3a, 0xa3,
+ 0x89, 0x11, 0xe8, 0x59, 0xa2, 0x8a, 0x32, 0xc0, 0x3b, 0x15, 0x88, 0xdb, 0x9a, 0x18, 0x81, 0xcd,
+ 0x8a, 0x41, 0x35, 0xd0, 0x2a, 0x24, 0x91, 0x2b, 0x84, 0xca, 0x1a, 0x07, 0xbb, 0x10, 0x21, 0x82,
+ 0xa5, 0x00, 0x36, 0x00, 0x9a, 0x89, 0x66, 0xa1, 0x9b, 0x08, 0x51, 0xb3, 0x9f, 0x14, 0x89, 0x08,
+ 0x18, 0x32, 0xa2, 0x9c, 0x01, 0xcb, 0x48, 0xa2, 0x8c, 0x02, 0xbc, 0x71, 0x84, 0x89, 0x80, 0x8b,
+ 0x04, 0x89, 0x01, 0x71, 0x92, 0xcc, 0x1a, 0x13, 0x00, 0x9a, 0x21, 0xda, 0xad, 0x63, 0x90, 0x88,
+ 0x18, 0x80, 0x00, 0x0a, 0x27, 0x08, 0xb1, 0x9d, 0x18, 0x24, 0xfa, 0x28, 0xa0, 0x1a, 0x03, 0x0a,
+ 0x23, 0xcb, 0x99, 0x8d, 0x55, 0x81, 0x80, 0x28, 0xf9, 0x2a, 0x05, 0x08, 0xaa, 0x00, 0x89, 0xa8,
+ 0x49, 0xa3, 0x1b, 0xf0, 0x8d, 0x43, 0x81, 0x08, 0x83, 0x0a, 0xe1, 0x0b, 0x53, 0x92, 0x8e, 0x90,
+ 0x28, 0x82, 0x88, 0x41, 0xf9, 0x0d, 0x11, 0x90, 0x89, 0x00, 0x08, 0x08, 0x20, 0xe0, 0x8e, 0x34,
+ 0x80, 0xab, 0x30, 0x11, 0xb0, 0x0e, 0x14, 0xbb, 0x51, 0x81, 0x0a, 0xc8, 0x09, 0x10, 0x86, 0x9f,
+ 0x88, 0x28, 0x13, 0x88, 0xaa, 0x83, 0x9f, 0x43, 0x90, 0xac, 0x51, 0x81, 0x09, 0x91, 0x19, 0x12,
+ 0x18, 0x03, 0xce, 0x09, 0x21, 0x44, 0x91, 0x0a, 0x21, 0xd8, 0x8d, 0x53, 0xb0, 0x8b, 0x24, 0xf9,
+ 0x09, 0x11, 0x90, 0x89, 0x90, 0x21, 0x89, 0x12, 0xcb, 0x71, 0x94, 0x0b, 0xb1, 0x0d, 0x33, 0x12,
+ 0xd0, 0x9f, 0x11, 0x18, 0x32, 0x92, 0xae, 0x41, 0x14, 0xba, 0x39, 0x33, 0xea, 0x29, 0x81, 0xb8,
+ 0x29, 0x35, 0x94, 0x9c, 0x14, 0xa9, 0x31, 0xd8, 0x1b, 0x13, 0xb9, 0x41, 0xa1, 0x18, 0xb9, 0x68,
+ 0x26, 0xc8, 0xad, 0x30, 0x81, 0xca, 0x2a, 0xa1, 0x2a, 0x01, 0x82, 0x3b, 0xb1, 0x73, 0xf2, 0xab,
+ 0x10, 0x13, 0xb8, 0x4a, 0x84, 0xad, 0x71, 0x93, 0x9c, 0x88, 0x21, 0x88, 0x90, 0xca, 0x09, 0x45,
+ 0x82, 0xac, 0x33, 0xaa, 0x90, 0x39, 0x82, 0xc8, 0x4b, 0x07, 0xaa, 0x70, 0x94, 0x8a, 0x01, 0x8a,
+ 0x7c, 0x04, 0x36, 0x00, 0x33, 0xca, 0x09, 0x30, 0x25, 0xb1, 0x8f, 0x02, 0x08, 0xc8, 0x60, 0x02,
+ 0xca, 0x1a, 0x14, 0x9a, 0x98, 0x18, 0xb9, 0x70, 0x25, 0x99, 0x99, 0x19, 0x14, 0x08, 0xd8, 0x1b,
+ 0x04, 0x9c, 0x98, 0x89, 0x18, 0x07, 0xbc, 0x88, 0x40, 0x92, 0x20, 0xf9, 0x1a, 0x12, 0x99, 0x89,
+ 0x09, 0xa2, 0x7a, 0x95, 0x8d, 0x13, 0xaa, 0x28, 0x84, 0xbd, 0x20, 0x43, 0xa8, 0x18, 0xc9, 0x19,
+ 0x28, 0xa2, 0x6b, 0x03, 0x8a, 0x09, 0x27, 0xaa, 0x18, 0xa9, 0x29, 0x24, 0x21, 0x56, 0x91, 0xae,
+ 0x10, 0x91, 0xbb, 0x38, 0xb1, 0x40, 0x92, 0x18, 0x00, 0x93, 0x1b, 0xf2, 0x0f, 0x84, 0xac, 0x31,
+ 0xa3, 0xbe, 0xaa, 0x42, 0x91, 0x00, 0xbb, 0x90, 0x1b, 0x77, 0x90, 0x18, 0xb8, 0x9a, 0xb9, 0x9e,
+ 0x33, 0x00, 0x21, 0xb0, 0x7a, 0x06, 0x8a, 0x02, 0xda, 0x38, 0x92, 0x2a, 0x86, 0xbb, 0x53, 0xa0,
+ 0x19, 0x83, 0x8a, 0x12, 0xcb, 0x20, 0x80, 0xda, 0x3a, 0x17, 0xaa, 0x08, 0xd1, 0x0d, 0x85, 0x8a,
+ 0x23, 0x99, 0x8a, 0xa0, 0x1a, 0xb2, 0x78, 0x90, 0x38, 0xb0, 0x71, 0x23, 0xb8, 0x09, 0x21, 0xa1,
+ 0xac, 0x64, 0x93, 0xbc, 0x58, 0x04, 0xbd, 0x31, 0x81, 0x80, 0xbd, 0x30, 0x92, 0x89, 0x00, 0xd9,
+ 0x50, 0xf0, 0x3a, 0x03, 0x9a, 0x51, 0x81, 0x89, 0x33, 0xdc, 0x61, 0xa1, 0x19, 0x91, 0x8c, 0x22,
+ 0x90, 0x0a, 0x04, 0x9a, 0x9a, 0x55, 0xd9, 0x09, 0x22, 0xca, 0x28, 0xa1, 0x31, 0x24, 0xfa, 0x38,
+ 0x83, 0x10, 0xb0, 0x41, 0xdb, 0x43, 0xa8, 0xec, 0x20, 0xa1, 0x01, 0x89, 0x22, 0xb1, 0x9f, 0x16,
+ 0x9a, 0x80, 0x18, 0x99, 0x33, 0xa9, 0x80, 0x18, 0x00, 0x43, 0x14, 0xe9, 0x1b, 0x85, 0x8d, 0xa0,
+ 0x39, 0xf9, 0x18, 0xaa, 0x10, 0x28, 0x13, 0x23, 0xda, 0x39, 0x37, 0xb9, 0x89, 0x20, 0xf1, 0x0c,
+ 0x45, 0x04, 0x37, 0x00, 0x92, 0xa8, 0x9d, 0x05, 0xac, 0x00, 0x41, 0xe8, 0x08, 0x88, 0x01, 0x28,
+ 0x92, 0x88, 0xbb, 0x74, 0x92, 0x8a, 0x12, 0xbb, 0x71, 0xb2, 0x1b, 0x26, 0xb8, 0x8b, 0x22, 0xba,
+ 0x4a, 0x94, 0xae, 0x21, 0xa0, 0x0c, 0x33, 0xb8, 0x58, 0xa2, 0x8d, 0x33, 0x91, 0xbf, 0x32, 0xa0,
+ 0x18, 0x35, 0xda, 0x40, 0x83, 0xa8, 0x18, 0x92, 0x8b, 0x11, 0xb0, 0x70, 0xa1, 0x1a, 0xa0, 0x58,
+ 0xc2, 0x48, 0xd8, 0x28, 0xca, 0xa9, 0x71, 0xb1, 0x0c, 0x12, 0xa9, 0x1a, 0x43, 0xb0, 0x9c, 0xa8,
+ 0x4b, 0xa4, 0x3c, 0x07, 0x8a, 0x98, 0x39, 0x14, 0x9c, 0x43, 0xd8, 0x29, 0x21, 0x01, 0xbc, 0x51,
+ 0x81, 0x8b, 0x32, 0xb8, 0x10, 0x9a, 0x26, 0x8a, 0xa2, 0xbf, 0x20, 0xa1, 0x09, 0x73, 0x93, 0x9c,
+ 0x33, 0xc9, 0x0c, 0x03, 0xba, 0xbc, 0x40, 0xd2, 0x0b, 0x85, 0x9d, 0x24, 0xa8, 0x10, 0xb0, 0x18,
+ 0x12, 0x01, 0xdc, 0x8b, 0x44, 0x11, 0xd9, 0x19, 0xb0, 0x70, 0x81, 0xaa, 0x08, 0x11, 0x03, 0xaf,
+ 0x42, 0x90, 0x1a, 0x33, 0x21, 0xda, 0x28, 0x91, 0x1a, 0x45, 0x02, 0xca, 0x0b, 0xa0, 0x74, 0xd0,
+ 0x0a, 0x02, 0x89, 0x24, 0xab, 0x34, 0xb9, 0x98, 0x39, 0x95, 0x9c, 0x21, 0xb8, 0x2a, 0x25, 0xfa,
+ 0x1a, 0x23, 0xb1, 0x2b, 0x86, 0xae, 0x21, 0x08, 0x43, 0xeb, 0x09, 0x12, 0xa8, 0x89, 0x10, 0xa0,
+ 0x8a, 0x88, 0x81, 0xcb, 0x59, 0x05, 0xeb, 0x8a, 0x43, 0xa0, 0x31, 0xa3, 0xce, 0x19, 0x32, 0x83,
+ 0xae, 0x22, 0x82, 0xac, 0x21, 0x10, 0x15, 0xeb, 0x18, 0x81, 0x1a, 0x33, 0xc9, 0x20, 0xb0, 0xbd,
+ 0x28, 0x30, 0x95, 0x8c, 0x42, 0x93, 0x9e, 0x10, 0x11, 0x88, 0xd1, 0x0c, 0x92, 0x49, 0x92, 0x72,
+ 0x85, 0xac, 0x30, 0x12, 0x08, 0x80, 0x8b, 0x12, 0xec, 0x39, 0x07, 0xaa, 0x11, 0xc0, 0x1b, 0x25,
+ 0xa6, 0x05, 0x37, 0x00, 0x30, 0x92, 0xae, 0x00, 0x99, 0x33, 0x88, 0x98, 0xb9, 0x2b, 0x27, 0x9a,
+ 0x29, 0x05, 0x29, 0xf1, 0x2a, 0x92, 0x88, 0x0a, 0xa2, 0x9d, 0x89, 0x45, 0x00, 0xa0, 0x18, 0xb8,
+ 0xbd, 0x8c, 0x23, 0xa8, 0xcb, 0x1a, 0x22, 0x26, 0x88, 0xf8, 0x8f, 0x25, 0x99, 0x80, 0x00, 0x01,
+ 0xaa, 0x60, 0x93, 0xbd, 0x48, 0xa2, 0x8b, 0x03, 0x88, 0x32, 0xb0, 0x8d, 0x35, 0xb0, 0x48, 0x03,
+ 0x99, 0x38, 0xa1, 0x62, 0x81, 0x31, 0xb3, 0xff, 0x18, 0x28, 0x13, 0xba, 0x58, 0x04, 0xab, 0x18,
+ 0x02, 0xba, 0xdc, 0x29, 0x92, 0x2a, 0x37, 0xa1, 0x9d, 0x21, 0xca, 0x09, 0x98, 0xeb, 0x8a, 0x43,
+ 0xb2, 0x8c, 0x10, 0x03, 0xac, 0x02, 0xb9, 0x9d, 0x33, 0x8a, 0x37, 0xc8, 0x19, 0x16, 0x98, 0x99,
+ 0x34, 0xfa, 0x39, 0x83, 0xba, 0x58, 0x84, 0x8a, 0x13, 0xbb, 0x21, 0xda, 0x40, 0x02, 0xca, 0x29,
+ 0x23, 0x80, 0x88, 0xfb, 0x9c, 0x08, 0x88, 0x20, 0xb9, 0x73, 0xb8, 0xcb, 0x29, 0x83, 0x0b, 0x37,
+ 0xe9, 0x29, 0x91, 0x28, 0x43, 0x91, 0xbd, 0x68, 0x82, 0x0a, 0x23, 0xc0, 0x9c, 0x02, 0xad, 0x18,
+ 0x42, 0xb0, 0x8c, 0x81, 0x88, 0x30, 0xc3, 0xaf, 0x22, 0xa1, 0x69, 0x03, 0x9d, 0x31, 0x01, 0x90,
+ 0xbb, 0x9b, 0x18, 0x53, 0x92, 0xcc, 0xaa, 0x18, 0x31, 0x16, 0xaa, 0xbc, 0x73, 0xa0, 0x18, 0x21,
+ 0xf8, 0x38, 0x83, 0x88, 0x09, 0x23, 0x81, 0x8b, 0x17, 0xfc, 0x19, 0x23, 0x90, 0x19, 0x04, 0xcc,
+ 0x08, 0x31, 0xa1, 0x48, 0x13, 0xd8, 0x38, 0x93, 0x71, 0x03, 0x9b, 0x98, 0x0a, 0x24, 0x9a, 0xb0,
+ 0x3a, 0xf1, 0x8e, 0x22, 0xb9, 0x51, 0xb2, 0x1b, 0x85, 0x9b, 0x55, 0x12, 0x90, 0xcb, 0x19, 0x43,
+ 0x90, 0x89, 0xc9, 0x8c, 0x81, 0x2b, 0x05, 0xab, 0x89, 0xc8, 0x3b, 0x94, 0x61, 0xb1, 0x0c, 0x16,
+ 0xa7, 0x03, 0x35, 0x00, 0x1c, 0x15, 0x98, 0x09, 0x01, 0x9a, 0x10, 0x31, 0x81, 0xfb, 0x09, 0xa8,
+ 0x0b, 0x22, 0xc8, 0x2a, 0xb8, 0x99, 0xec, 0x1a, 0x25, 0x08, 0xa1, 0x0d, 0x46, 0x91, 0x0a, 0x98,
+ 0xab, 0x60, 0x14, 0x9a, 0x21, 0xb9, 0x60, 0x81, 0x18, 0x90, 0x90, 0x0b, 0x91, 0x28, 0xc1, 0xdf,
+ 0x3a, 0xb1, 0x9b, 0x8b, 0x37, 0x9b, 0x00, 0x22, 0xed, 0x30, 0x81, 0x80, 0xe9, 0x1a, 0x16, 0x08,
+ 0x11, 0x00, 0xb8, 0x39, 0x07, 0xbb, 0x21, 0x80, 0x89, 0x22, 0x80, 0x40, 0x22, 0x10, 0xf8, 0xaf,
+ 0x52, 0xa0, 0x19, 0xa0, 0x9a, 0x00, 0xcc, 0x09, 0x89, 0x51, 0xb1, 0x8e, 0x80, 0x8a, 0x32, 0x82,
+ 0xbd, 0x30, 0x80, 0x11, 0xbb, 0x61, 0xf9, 0x29, 0x04, 0x98, 0x28, 0xb1, 0x38, 0xd9, 0x53, 0x41,
+ 0x84, 0x8b, 0x12, 0x02, 0x9b, 0x57, 0x91, 0xac, 0x21, 0xa0, 0x29, 0x02, 0x23, 0xde, 0x30, 0xa2,
+ 0x9c, 0x44, 0xa9, 0x32, 0xbd, 0x21, 0xaa, 0x10, 0x35, 0xd8, 0x0a, 0xb9, 0x08, 0x99, 0xb9, 0x51,
+ 0xd9, 0x38, 0xb8, 0x28, 0x02, 0x20, 0x06, 0xdf, 0x08, 0x08, 0x24, 0xb9, 0x08, 0x80, 0x0c, 0x24,
+ 0x88, 0xb9, 0x9b, 0x38, 0xf2, 0x3c, 0x03, 0x90, 0x2b, 0xe2, 0x2c, 0x13, 0xb0, 0x59, 0x93, 0x49,
+ 0xc3, 0x3a, 0x06, 0xa9, 0x21, 0xd9, 0x49, 0xa3, 0x3a, 0x07, 0x08, 0xb8, 0x9b, 0x29, 0x26, 0x80,
+ 0xc8, 0x2a, 0xb2, 0x29, 0x02, 0xa8, 0x28, 0xa1, 0x65, 0xd8, 0x8a, 0x24, 0x18, 0x82, 0xad, 0x18,
+ 0x54, 0xa0, 0x00, 0xba, 0x08, 0x29, 0x06, 0xdd, 0x1a, 0x23, 0xc9, 0xaa, 0x10, 0x80, 0x54, 0x91,
+ 0xbb, 0x29, 0xb2, 0x79, 0x07, 0xba, 0x08, 0x00, 0x00, 0x90, 0x28, 0xc2, 0x0c, 0x23, 0xb8, 0x2c,
+ 0x17, 0x9a, 0x22, 0xda, 0x18, 0x43, 0x92, 0xaa, 0x3b, 0xa5, 0x0e, 0x23, 0x80, 0x18, 0x05, 0x8a,
+ 0x9b, 0x03, 0x2b, 0x00, 0xa8, 0x20, 0x42, 0xa2, 0x9e, 0x91, 0x8c, 0x25, 0x23, 0xd9, 0xa9, 0x0b,
+ 0xa4, 0x2c, 0x85, 0x9b, 0x18, 0x22, 0x91, 0x9d, 0x44, 0xb9, 0x19, 0xb0, 0x9b, 0x0b, 0x47, 0xcb,
+ 0x11, 0xcb, 0x0a, 0x13, 0xad, 0xc9, 0x1c, 0x16, 0x98, 0x00, 0x90, 0x08, 0x03, 0xca, 0xb9, 0x0d,
+ 0x26, 0x12, 0xb8, 0x0b, 0x02, 0x91, 0x9d, 0x02, 0xaa, 0x71, 0x16, 0x99, 0x18, 0x10, 0x32, 0x81,
+ 0x8a, 0x08, 0x37, 0x33, 0x13, 0x82, 0xae, 0x32, 0x34, 0xf9, 0x29, 0x90, 0x18, 0xb0, 0xac, 0x62,
+ 0x22, 0x33, 0x91, 0xbb, 0x19, 0x00, 0x22, 0xff, 0x0c, 0xa8, 0x08, 0x81, 0x89, 0x02, 0x89, 0x89,
+ 0x90, 0xed, 0x29, 0xa1, 0x09, 0xfb, 0x19, 0x11, 0x34, 0x33, 0xf8, 0x0d, 0x81, 0x0b, 0x03, 0x0a,
+ 0x27, 0x88, 0x10, 0x82, 0x99, 0x51, 0x92, 0xbe, 0x38, 0x92, 0x52, 0x81, 0x02, 0xad, 0x12, 0xdb,
+ 0x88, 0xdc, 0x19, 0x12, 0x99, 0x90, 0x99, 0x31, 0xe2, 0x8c, 0xf0, 0x0c, 0x22, 0x01, 0x89, 0x22,
+ 0xaa, 0x51, 0x82, 0xea, 0x19, 0x23, 0x13, 0x0c, 0x17, 0x8b, 0x24, 0xca, 0x08, 0x98, 0x1a, 0x27,
+ 0xb0, 0x28, 0xc1, 0x8c, 0x90, 0x0b, 0xc0, 0x2a, 0x92, 0x99, 0xad, 0x91, 0x1b, 0x27, 0x81, 0x9c,
+ 0x22, 0x40, 0x16, 0x8a, 0x01, 0x9b, 0x32, 0xb0, 0x9f, 0x20, 0x10, 0x11, 0x98, 0xba, 0xbd, 0x74,
+ 0xd2, 0x8a, 0xa8, 0x09, 0x43, 0x90, 0xeb, 0x38, 0xd0, 0x0a, 0x11, 0x92, 0x0d, 0x14, 0x81, 0x1a,
+ 0x13, 0x41, 0xa1, 0x20, 0xda, 0x8a, 0x57, 0xa0, 0x39, 0xb2, 0x29, 0xd0, 0x0b, 0xa8, 0x89, 0xbd,
+ 0x42, 0xa8, 0x80, 0x08, 0xfb, 0x52, 0xa8, 0x10, 0x9b, 0x26, 0x28, 0x82, 0x9a, 0x32, 0xa8, 0x8a,
+ 0x88, 0x80, 0x77, 0x94, 0x1a, 0x91, 0x31, 0x21, 0xc3, 0x1d, 0xb2, 0x0e, 0x33, 0xca, 0x88, 0xb9,
+ 0x01, 0xfd, 0x2b, 0x00, 0x00, 0xeb, 0x38, 0x91, 0x42, 0xc0, 0x9c, 0x10, 0x0a, 0x34, 0x98, 0xcd,
+ 0x28, 0x08, 0x46, 0x98, 0x11, 0x89, 0x23, 0x88, 0xdc, 0x71, 0x80, 0x10, 0x88, 0xb0, 0x59, 0x04,
+ 0x09, 0x01, 0xa0, 0x1b, 0x33, 0x32, 0xa1, 0xdc, 0x89, 0xfa, 0x2a, 0xa1, 0x3a, 0xa4, 0xaa, 0x0a,
+ 0x84, 0x8e, 0x81, 0xa9, 0x9a, 0x00, 0x41, 0xa0, 0x63, 0xfa, 0x29, 0xa2, 0x2b, 0x95, 0x1a, 0x94,
+ 0x29, 0x93, 0x31, 0xec, 0x40, 0x00, 0x15, 0x9a, 0x12, 0x19, 0x14, 0x1a, 0x14, 0x11, 0xfa, 0x18,
+ 0xb8, 0x2b, 0x24, 0x34, 0xa1, 0xce, 0x08, 0x21, 0x25, 0xa9, 0x98, 0xba, 0x4a, 0x17, 0x0b, 0x83,
+ 0x9c, 0x98, 0xb9, 0x8c, 0x03, 0x18, 0x98, 0xfc, 0x0e, 0x82, 0x09, 0x98, 0x88, 0x9b, 0x36, 0xc8,
+ 0x31, 0xa8, 0xa8, 0x9c, 0x90, 0x19, 0x29, 0x27, 0x8b, 0xf9, 0x1b, 0x12, 0x81, 0x98, 0x9a, 0x41,
+ 0x10, 0x85, 0x1e, 0xa4, 0x0d, 0x92, 0x8c, 0x80, 0x31, 0x01, 0x03, 0x0c, 0xa3, 0x2e, 0x06, 0x09,
+ 0x23, 0xca, 0x38, 0x94, 0x39, 0x05, 0x1a, 0xa1, 0x8c, 0x00, 0xa1, 0x4b, 0x07, 0xab, 0x41, 0xb8,
+ 0x69, 0x92, 0x19, 0x88, 0x99, 0x58, 0x82, 0x30, 0xc1, 0x08, 0x32, 0xf9, 0x2a, 0xb8, 0x30, 0x12,
+ 0xc0, 0xaf, 0x53, 0x01, 0x98, 0x90, 0xad, 0x82, 0x40, 0xf0, 0x0a, 0xa0, 0xaa, 0x89, 0x01, 0x89,
+ 0x23, 0x90, 0xca, 0x41, 0xe0, 0xbb, 0x8b, 0x14, 0xbb, 0x75, 0xb0, 0x4a, 0xa3, 0x0c, 0x02, 0xa9,
+ 0x09, 0x88, 0x22, 0xec, 0x48, 0xa2, 0x3a, 0xc3, 0x0d, 0x13, 0x11, 0xea, 0x38, 0xc0, 0x29, 0x02,
+ 0x20, 0xd1, 0x5b, 0x85, 0x8b, 0x03, 0x99, 0x73, 0x92, 0x0a, 0xa1, 0x39, 0x14, 0x10, 0x14, 0xa0,
+ 0x0a, 0x04, 0x1b, 0x47, 0x88, 0x9a, 0x01, 0x9e, 0x13, 0x0a, 0x06, 0xa9, 0x00, 0x99, 0x72, 0x93,
+ 0x73, 0x06, 0x2d, 0x00, 0x00, 0x89, 0xa8, 0x68, 0xa1, 0x49, 0xb1, 0xac, 0x18, 0xb0, 0x60, 0xb0,
+ 0x53, 0xea, 0x09, 0x98, 0x00, 0x89, 0x01, 0xbe, 0x80, 0x8a, 0x03, 0xba, 0x09, 0xc1, 0xae, 0x00,
+ 0x33, 0x42, 0x94, 0xaf, 0x80, 0x9a, 0x11, 0x33, 0xf9, 0x19, 0x00, 0x33, 0x28, 0xb4, 0x8d, 0x10,
+ 0xc0, 0x5b, 0x06, 0x19, 0x03, 0x29, 0x13, 0x18, 0xb3, 0x49, 0xb2, 0x18, 0xcb, 0x39, 0x77, 0x92,
+ 0x01, 0x1a, 0xa3, 0xbd, 0x89, 0x01, 0x71, 0x92, 0x8c, 0xa9, 0x2a, 0x25, 0x99, 0xba, 0xcc, 0x1b,
+ 0x98, 0x40, 0x81, 0xb8, 0x8f, 0xa2, 0x9d, 0x41, 0x93, 0x3b, 0xc4, 0x0d, 0x98, 0x28, 0x02, 0x88,
+ 0x21, 0xc8, 0x71, 0x13, 0x09, 0x92, 0x9f, 0x20, 0x20, 0x81, 0x39, 0x26, 0x08, 0xa1, 0x9c, 0xa2,
+ 0x0e, 0x14, 0xba, 0x18, 0xb2, 0x1c, 0x04, 0x11, 0xda, 0x38, 0xc8, 0xac, 0x90, 0xbe, 0x31, 0x92,
+ 0xaa, 0x9b, 0x63, 0x21, 0x35, 0xb9, 0x29, 0x80, 0x31, 0x14, 0x11, 0x92, 0xaf, 0x43, 0xbc, 0x27,
+ 0x0a, 0x13, 0x8b, 0xb8, 0x20, 0xcb, 0x11, 0x89, 0xc8, 0x9a, 0xdc, 0x09, 0x34, 0xb8, 0x9a, 0x9a,
+ 0x18, 0x48, 0x86, 0x2d, 0x27, 0xa9, 0x98, 0xa9, 0x41, 0x24, 0x31, 0xc1, 0x0d, 0x15, 0x09, 0x91,
+ 0x0b, 0xa3, 0x8a, 0xfb, 0x09, 0x20, 0x83, 0xcb, 0xaa, 0xab, 0x61, 0x32, 0x92, 0x0a, 0x84, 0x71,
+ 0x83, 0x21, 0xc8, 0x20, 0x01, 0xaa, 0x42, 0x21, 0xb0, 0x0b, 0xad, 0x90, 0x0c, 0xf8, 0x4a, 0xe8,
+ 0x89, 0xba, 0x52, 0x90, 0x41, 0x91, 0x89, 0x20, 0xf0, 0x2a, 0x92, 0x73, 0x92, 0x88, 0x1a, 0x02,
+ 0x55, 0xc8, 0x88, 0x8a, 0x91, 0x48, 0xb0, 0x2a, 0xf9, 0x9a, 0x08, 0x10, 0x13, 0xeb, 0x10, 0xaa,
+ 0x21, 0x50, 0x15, 0x19, 0x99, 0x46, 0xa9, 0x11, 0x30, 0x94, 0x8e, 0xb8, 0x2a, 0x82, 0xa9, 0x39,
+ 0x06, 0x02, 0x24, 0x00, 0xbf, 0x81, 0x0b, 0x83, 0x29, 0xb1, 0xad, 0x29, 0xb1, 0x59, 0x93, 0x9b,
+ 0xb8, 0xfb, 0x2d, 0x37, 0x80, 0x08, 0xa0, 0x8b, 0x35, 0x98, 0x00, 0x88, 0x13, 0x2a, 0x86, 0x9c,
+ 0x12, 0xd8, 0xbc, 0xbb, 0x1b, 0x25, 0xca, 0xa9, 0x9e, 0x22, 0x01, 0xb9, 0x8a, 0xb9, 0x9c, 0x02,
+ 0x0c, 0x06, 0x00, 0xd9, 0x19, 0x40, 0x24, 0x32, 0xe9, 0x58, 0x92, 0x99, 0x31, 0x13, 0x80, 0x90,
+ 0x58, 0x14, 0x62, 0x14, 0xb8, 0x9c, 0x23, 0xab, 0x01, 0x28, 0x26, 0xca, 0xbb, 0x1c, 0x16, 0x19,
+ 0xa2, 0x9d, 0xaa, 0x31, 0x22, 0xf8, 0x8c, 0xb1, 0x89, 0xbb, 0x62, 0x81, 0x12, 0xea, 0x9b, 0x32,
+ 0x01, 0x43, 0xc1, 0x8d, 0x01, 0x00, 0xaa, 0x74, 0xb2, 0x4a, 0xa2, 0x8c, 0x52, 0x13, 0x09, 0x02,
+ 0xaa, 0x1a, 0x35, 0xaa, 0xa8, 0x0c, 0x27, 0x08, 0x24, 0xb9, 0x08, 0x02, 0xbc, 0x21, 0x09, 0x16,
+ 0x8a, 0xb0, 0x9f, 0x33, 0x81, 0x80, 0x2b, 0x86, 0x0a, 0x24, 0xb0, 0x19, 0xe8, 0x9d, 0xa9, 0x08,
+ 0x01, 0xc8, 0xbe, 0x08, 0x02, 0x81, 0x19, 0xa1, 0x2b, 0xe0, 0x30, 0xfc, 0x38, 0x92, 0xbc, 0xaa,
+ 0x19, 0x33, 0x93, 0xad, 0xa0, 0x3a, 0x15, 0x81, 0xaf, 0x44, 0x98, 0x98, 0x8a, 0x53, 0xb1, 0x9c,
+ 0xb8, 0x0d, 0x25, 0x80, 0x00, 0x00, 0x32, 0xfb, 0x28, 0x12, 0x33, 0x01, 0x03, 0xaf, 0x54, 0x12,
+ 0x88, 0x88, 0x00, 0x01, 0x09, 0x12, 0x71, 0x14, 0xc9, 0xaa, 0x09, 0x73, 0x02, 0xa9, 0x99, 0x30,
+ 0x24, 0x00, 0xb9, 0x1a, 0xa2, 0xab, 0xcc, 0x79, 0x27, 0xa8, 0x88, 0x99, 0xa9, 0x72, 0x81, 0x80,
+ 0x9b, 0x23, 0x30, 0x92, 0x33, 0x98, 0xea, 0xdb, 0xad, 0x42, 0x01, 0x98, 0xfb, 0x8c, 0x12, 0x00,
+ 0xa8, 0x18, 0xd8, 0xab, 0x08, 0xa8, 0x8b, 0x01, 0xef, 0x8a, 0x10, 0x23, 0x98, 0xca, 0x8b, 0x81,
+ 0x29, 0xfc, 0x20, 0x00, 0x17, 0x9c, 0x10, 0x99, 0x19, 0xb0, 0x38, 0xa2, 0x0b, 0xfa, 0x8d, 0x31,
+ 0x36, 0xb1, 0x9a, 0x08, 0xdb, 0x71, 0xc0, 0x19, 0xa0, 0x20, 0x98, 0x62, 0x02, 0x8a, 0x92, 0xbf,
+ 0x90, 0x71, 0x84, 0x88, 0x88, 0x08, 0x31, 0x14, 0xa9, 0x28, 0x12, 0x18, 0x43, 0x89, 0x65, 0xc8,
+ 0x8c, 0x13, 0x8b, 0x25, 0x9a, 0x98, 0x0a, 0x24, 0x01, 0x88, 0x89, 0x33, 0x9c, 0x25, 0xca, 0x1a,
+ 0xa2, 0x8e, 0x23, 0x43, 0x90, 0x99, 0x89, 0xdc, 0x30, 0xca, 0x20, 0xa8, 0x09, 0xfa, 0xac, 0x29,
+ 0x93, 0xaf, 0x98, 0x8a, 0x10, 0xc9, 0x9e, 0x20, 0x22, 0xcb, 0xcc, 0x18, 0x33, 0x93, 0xaf, 0x08,
+ 0x51, 0x83, 0x19, 0x92, 0xdb, 0x08, 0xa8, 0x19, 0x91, 0x73, 0xa5, 0x2a, 0x44, 0x11, 0x22, 0xa1,
+ 0xab, 0x80, 0x0a, 0x55, 0x00, 0x23, 0x90, 0xbb, 0x73, 0x01, 0x82, 0xba, 0x8a, 0xa1, 0x69, 0x92,
+ 0x71, 0xb1, 0x0a, 0x9a, 0xb9, 0x78, 0x93, 0xbe, 0x0a, 0xb9, 0x89, 0x08, 0xb1, 0x8a, 0xbf, 0x31,
+ 0xa8, 0xa9, 0x72, 0xc8, 0x90, 0x8c, 0x01, 0x21, 0x8a, 0x26, 0x99, 0x30, 0x26, 0x80, 0x63, 0x01,
+ 0x41, 0xc0, 0x0a, 0x80, 0x01, 0x63, 0x82, 0x18, 0x98, 0x19, 0x40, 0x92, 0x1c, 0xf9, 0x0c, 0xb8,
+ 0x39, 0x82, 0x01, 0xcd, 0xcb, 0x9c, 0x22, 0x08, 0xf9, 0x9c, 0x10, 0x01, 0x00, 0xb8, 0x09, 0x01,
+ 0xc9, 0x09, 0x70, 0x24, 0xba, 0xca, 0x58, 0x24, 0x42, 0x03, 0x99, 0x18, 0xa2, 0x8e, 0x21, 0x31,
+ 0xb9, 0x89, 0xcd, 0x88, 0x18, 0xc8, 0xbb, 0xbe, 0x19, 0x38, 0x27, 0xa9, 0xbb, 0x8b, 0xba, 0x73,
+ 0x12, 0x81, 0x8c, 0x04, 0x28, 0x37, 0x01, 0x90, 0xcc, 0x09, 0x21, 0x53, 0x33, 0x80, 0x20, 0xb3,
+ 0xbf, 0x08, 0x18, 0xca, 0xeb, 0x1a, 0x93, 0x0b, 0x23, 0xb0, 0xdd, 0xab, 0x48, 0x24, 0x12, 0xca,
+ 0x59, 0xfb, 0x26, 0x00, 0x18, 0x12, 0x54, 0x83, 0x08, 0x00, 0x80, 0xda, 0x79, 0x15, 0x08, 0xb0,
+ 0x8d, 0x01, 0x40, 0x03, 0x89, 0xb9, 0xcb, 0x8a, 0xa8, 0x18, 0x92, 0xa9, 0xbf, 0x30, 0x14, 0xea,
+ 0x09, 0xda, 0x0a, 0x44, 0x83, 0x30, 0xa2, 0x0b, 0x00, 0x73, 0x12, 0xa0, 0x2a, 0xa3, 0x48, 0x11,
+ 0x47, 0x91, 0xbb, 0x9a, 0x9a, 0x64, 0x02, 0x88, 0x28, 0xf8, 0x8c, 0x01, 0xa9, 0xaa, 0xba, 0x9b,
+ 0x0a, 0x56, 0x82, 0xab, 0x99, 0xcd, 0x30, 0x43, 0x24, 0x10, 0xd9, 0x29, 0x14, 0x11, 0x09, 0x11,
+ 0xca, 0x9a, 0x73, 0x12, 0x32, 0xc0, 0xab, 0x89, 0x74, 0x02, 0x98, 0x20, 0xc0, 0x8a, 0x08, 0x98,
+ 0x29, 0xf0, 0xad, 0x08, 0x90, 0x18, 0xc0, 0x9b, 0xaa, 0x9a, 0x38, 0x53, 0xa2, 0xaf, 0xa8, 0x9e,
+ 0x10, 0x21, 0xb8, 0xbe, 0x0a, 0x22, 0x53, 0x14, 0x01, 0xd8, 0x9c, 0x38, 0x36, 0x33, 0x81, 0xa0,
+ 0xac, 0x10, 0x33, 0xa1, 0xa9, 0x9b, 0xe9, 0x48, 0x47, 0x13, 0x98, 0xbc, 0x98, 0x29, 0x27, 0x99,
+ 0x09, 0x90, 0x0a, 0x12, 0x53, 0x22, 0xd8, 0xae, 0x10, 0x02, 0xa9, 0xdb, 0xac, 0x99, 0xaa, 0x08,
+ 0x20, 0x45, 0x02, 0xdc, 0x0a, 0x00, 0x18, 0xa1, 0xad, 0x00, 0xbc, 0x0a, 0x20, 0x34, 0x81, 0xc9,
+ 0x8b, 0x00, 0x30, 0x27, 0xd0, 0x8c, 0x01, 0xa8, 0x98, 0x8a, 0x31, 0x21, 0xd9, 0x49, 0x47, 0x02,
+ 0x99, 0xa9, 0x72, 0x23, 0x22, 0x93, 0xab, 0xc9, 0x08, 0x20, 0x56, 0x81, 0x88, 0xb0, 0x49, 0x25,
+ 0x01, 0xcb, 0xaa, 0x8a, 0x33, 0x38, 0x06, 0x30, 0x04, 0x28, 0xb8, 0xae, 0x21, 0xd8, 0x8a, 0x41,
+ 0x34, 0x25, 0xe9, 0x8b, 0x11, 0x88, 0x10, 0x12, 0x21, 0x02, 0xba, 0xaa, 0x68, 0xa3, 0xad, 0xd9,
+ 0x0a, 0x42, 0x90, 0xdc, 0xcb, 0xab, 0x50, 0x81, 0x09, 0x98, 0x99, 0x89, 0xed, 0x09, 0x80, 0x80,
+ 0x92, 0xfb, 0x20, 0x00, 0xae, 0x31, 0x23, 0x92, 0xad, 0xaa, 0x18, 0x13, 0x08, 0x45, 0x98, 0x90,
+ 0x2a, 0xec, 0x28, 0x90, 0xb9, 0x9b, 0xdb, 0x55, 0x80, 0x00, 0xca, 0xbd, 0x29, 0x32, 0x44, 0x81,
+ 0xab, 0xcb, 0x1a, 0x13, 0x0a, 0x84, 0xae, 0x33, 0x10, 0x53, 0x02, 0xcc, 0xba, 0x18, 0x11, 0x33,
+ 0x64, 0x13, 0x80, 0x43, 0x80, 0x67, 0x90, 0x09, 0x01, 0x88, 0x00, 0x43, 0x13, 0xea, 0x8b, 0x00,
+ 0x73, 0x02, 0x81, 0xba, 0x18, 0x15, 0x8a, 0x33, 0xa1, 0xcf, 0x88, 0x21, 0x34, 0x23, 0xca, 0xcb,
+ 0x1a, 0x35, 0x12, 0x01, 0x09, 0x88, 0xba, 0x59, 0x15, 0x89, 0xb0, 0xbf, 0x19, 0x55, 0x82, 0x08,
+ 0x99, 0x9a, 0xca, 0x10, 0x33, 0x04, 0x00, 0xfc, 0x89, 0x18, 0xa0, 0x9c, 0x80, 0xa9, 0xac, 0xc9,
+ 0x58, 0x85, 0xcb, 0xab, 0x89, 0x42, 0x24, 0xb9, 0xbb, 0x00, 0x10, 0x12, 0xaa, 0xeb, 0x8a, 0x88,
+ 0x18, 0x67, 0x03, 0xca, 0xab, 0x88, 0x30, 0x25, 0xcb, 0x19, 0xa8, 0x21, 0x88, 0x00, 0xab, 0x55,
+ 0xc0, 0x1b, 0x47, 0x11, 0x98, 0x89, 0x90, 0x18, 0x46, 0x33, 0x01, 0x89, 0xa8, 0x0a, 0x32, 0x12,
+ 0xea, 0x0a, 0x10, 0x44, 0x33, 0x43, 0xb2, 0xaf, 0x90, 0x0a, 0x34, 0x53, 0x02, 0xc9, 0xab, 0x00,
+ 0x20, 0x03, 0xfe, 0x9b, 0x88, 0xb9, 0x8a, 0x43, 0xb0, 0xce, 0x9c, 0x89, 0x21, 0x02, 0xaa, 0xac,
+ 0xb9, 0x28, 0x34, 0x84, 0xbb, 0x99, 0xbc, 0x2a, 0x46, 0x03, 0xdb, 0xcc, 0x8a, 0x41, 0x44, 0x12,
+ 0x01, 0x80, 0x28, 0x23, 0x18, 0x24, 0xea, 0x8b, 0xa1, 0x79, 0x15, 0x00, 0xb8, 0x9a, 0x52, 0x23,
+ 0x21, 0x92, 0xcb, 0x9d, 0x89, 0x89, 0x81, 0xa9, 0xdd, 0x1b, 0x15, 0x00, 0xa0, 0xac, 0xaa, 0xca,
+ 0x0b, 0x35, 0x98, 0xab, 0xa9, 0xbb, 0x48, 0x36, 0x04, 0xac, 0x00, 0x0a, 0x64, 0x34, 0x91, 0xb9,
+ 0x7f, 0xfe, 0x24, 0x00, 0x09, 0x52, 0x15, 0x01, 0x98, 0x00, 0x11, 0xb8, 0x39, 0x25, 0xd9, 0xbb,
+ 0x0b, 0x45, 0x01, 0xeb, 0xad, 0x0a, 0x21, 0x11, 0x80, 0x90, 0xcb, 0xab, 0x00, 0xc9, 0x89, 0x90,
+ 0xdd, 0x71, 0x24, 0x91, 0x8a, 0x01, 0x18, 0x80, 0x21, 0x12, 0x64, 0x13, 0xbb, 0x38, 0x03, 0xba,
+ 0x61, 0xf9, 0x09, 0x08, 0xa1, 0x2a, 0xa2, 0x39, 0xfd, 0x9d, 0x20, 0x02, 0xb9, 0xbd, 0x08, 0x12,
+ 0x00, 0x81, 0x9a, 0x41, 0x23, 0x00, 0x77, 0x12, 0xa0, 0xbc, 0x1a, 0x35, 0x11, 0x81, 0x8a, 0x22,
+ 0x31, 0x33, 0x03, 0xdc, 0xdb, 0xac, 0x19, 0x15, 0xa8, 0xac, 0xbb, 0x9a, 0x1a, 0x12, 0xca, 0x1a,
+ 0x27, 0xcb, 0x8a, 0x29, 0xa2, 0x8b, 0xaa, 0x62, 0x11, 0x21, 0x62, 0x27, 0x90, 0x89, 0x21, 0x33,
+ 0x32, 0x02, 0xdb, 0x60, 0x24, 0x98, 0x89, 0x89, 0x31, 0xd0, 0x9b, 0x98, 0x32, 0xfb, 0xcf, 0x08,
+ 0x00, 0x00, 0xa9, 0x9a, 0x99, 0x90, 0xcc, 0x99, 0x0a, 0xc0, 0xae, 0x09, 0x53, 0x22, 0x88, 0x01,
+ 0x80, 0x99, 0x52, 0x54, 0x04, 0x18, 0x84, 0x1a, 0x54, 0x04, 0x99, 0x31, 0x01, 0x00, 0xb0, 0x8b,
+ 0x33, 0x34, 0xf8, 0x9e, 0x09, 0x10, 0x90, 0xeb, 0x8a, 0x11, 0x88, 0xa8, 0xbd, 0xa8, 0xbe, 0xab,
+ 0x28, 0x33, 0x53, 0x14, 0xda, 0x8b, 0x11, 0x30, 0x91, 0x59, 0x91, 0x73, 0x23, 0x24, 0x80, 0x00,
+ 0x38, 0x35, 0x33, 0xa0, 0x1a, 0xea, 0x8a, 0x0a, 0x37, 0x00, 0x80, 0xa9, 0xad, 0x31, 0x02, 0x01,
+ 0x52, 0xfa, 0x9d, 0x99, 0x8a, 0x21, 0xa8, 0xef, 0x9a, 0x88, 0x32, 0x04, 0xb9, 0x8b, 0x33, 0x02,
+ 0x98, 0x99, 0xed, 0xa9, 0x9b, 0x31, 0x41, 0xb1, 0xad, 0x00, 0x64, 0x24, 0x00, 0x20, 0x01, 0x28,
+ 0x14, 0x11, 0x42, 0x26, 0xa9, 0x28, 0x73, 0x02, 0xaa, 0x99, 0xa9, 0x30, 0x36, 0x12, 0x12, 0xa9,
+ 0xc3, 0x04, 0x1b, 0x00, 0x09, 0x54, 0x33, 0xa0, 0x89, 0x99, 0xa0, 0x0f, 0x36, 0x08, 0xb8, 0xab,
+ 0xdb, 0x0a, 0x01, 0xb0, 0x9e, 0xba, 0xac, 0x09, 0x82, 0xcc, 0xdb, 0x9a, 0xab, 0xba, 0x3b, 0x17,
+ 0xba, 0x20, 0xeb, 0x99, 0x29, 0x84, 0x18, 0xb8, 0x8a, 0x10, 0x98, 0x80, 0x59, 0xb4, 0xbf, 0xab,
+ 0x18, 0x11, 0xd0, 0xbd, 0x8b, 0x02, 0x73, 0x27, 0x00, 0x10, 0xb9, 0x39, 0x35, 0x01, 0x80, 0xb0,
+ 0x8b, 0x32, 0x57, 0x03, 0x08, 0xb9, 0x19, 0x73, 0x15, 0x00, 0xa9, 0x89, 0x8a, 0x43, 0x22, 0xca,
+ 0x9b, 0xaa, 0xcb, 0x60, 0x34, 0x23, 0xc9, 0x9d, 0x00, 0x43, 0x12, 0xa0, 0xaa, 0x29, 0x84, 0x9b,
+ 0x40, 0x36, 0xc9, 0x9a, 0x89, 0x88, 0x82, 0xdf, 0xcb, 0xaa, 0x8a, 0x10, 0x00, 0xcb, 0x8a, 0x9a,
+ 0xa8, 0xbd, 0xdc, 0xbb, 0xa9, 0xbc, 0x1a, 0xa1, 0xbe, 0xab, 0x81, 0x28, 0x27, 0xa0, 0x19, 0x92,
+ 0xba, 0x19, 0x83, 0xde, 0x9b, 0x18, 0x88, 0x21, 0xfa, 0x4a, 0x06, 0xcb, 0x9a, 0x89, 0x63, 0x03,
+ 0x98, 0xc9, 0x8a, 0x43, 0x13, 0x98, 0x81, 0x10, 0x21, 0x63, 0x64, 0x35, 0x12, 0xa8, 0xbb, 0x51,
+ 0x44, 0x12, 0x08, 0xa8, 0x0a, 0x81, 0x18, 0x13, 0x24, 0xa8, 0x1a, 0x47, 0x01, 0xa2, 0xae, 0x80,
+ 0x18, 0x42, 0x25, 0xc9, 0x89, 0x00, 0xaa, 0x55, 0x11, 0x01, 0xba, 0xbb, 0xaa, 0x18, 0x31, 0xc1,
+ 0xff, 0x9a, 0x89, 0x88, 0x89, 0x99, 0xaa, 0x2a, 0x47, 0x02, 0xaa, 0x89, 0xcd, 0x99, 0x08, 0x19,
+ 0x02, 0xdc, 0x09, 0x21, 0x63, 0x24, 0x90, 0x8a, 0x88, 0x9a, 0x41, 0xa2, 0x3a, 0x85, 0x9d, 0x73,
+ 0x25, 0x01, 0x10, 0x88, 0x08, 0x34, 0x12, 0x88, 0x73, 0x82, 0x88, 0x41, 0x02, 0x33, 0x93, 0xbc,
+ 0x08, 0xcc, 0x40, 0x34, 0xb1, 0xad, 0xaa, 0x89, 0x42, 0x91, 0xbb, 0x9a, 0xdb, 0x89, 0x98, 0x9a,
+ 0xea, 0x01, 0x14, 0x00, 0xdf, 0xac, 0x09, 0x33, 0x13, 0xfb, 0xac, 0x9b, 0x41, 0x03, 0x18, 0x00,
+ 0x20, 0x43, 0x13, 0x10, 0x47, 0x82, 0xbb, 0x10, 0x52, 0x14, 0x08, 0x08, 0x41, 0x44, 0x23, 0x98,
+ 0x8a, 0x10, 0x31, 0x14, 0xa8, 0x8c, 0x41, 0xa0, 0x48, 0x37, 0xfa, 0x9b, 0x08, 0xb9, 0x8a, 0xb9,
+ 0x99, 0xae, 0xaa, 0xbd, 0x99, 0x19, 0x02, 0xcd, 0x99, 0xba, 0x09, 0x22, 0x32, 0x16, 0xba, 0xdb,
+ 0x19, 0x37, 0x92, 0x9a, 0x40, 0x34, 0x12, 0x00, 0x31, 0x03, 0x21, 0x33, 0x53, 0x23, 0x01, 0xfc,
+ 0x49, 0x35, 0x92, 0xcb, 0xbb, 0xcd, 0xbb, 0x9b, 0x01, 0x98, 0x89, 0xbb, 0x30, 0xb1, 0xff, 0x9d,
+ 0x99, 0x99, 0xa8, 0xac, 0x19, 0x11, 0x81, 0x51, 0x35, 0x22, 0x24, 0xb0, 0xad, 0x18, 0x12, 0x61,
+ 0x25, 0x90, 0x99, 0x10, 0x00, 0x31, 0xa1, 0xbd, 0x51, 0x82, 0xbc, 0x9a, 0xeb, 0x99, 0x98, 0xaa,
+ 0xbb, 0xbc, 0x89, 0xcc, 0xa9, 0xab, 0xd8, 0xbe, 0x19, 0x34, 0x23, 0x45, 0x33, 0x01, 0x30, 0x24,
+ 0x80, 0x89, 0x10, 0x01, 0x56, 0x03, 0x80, 0x80, 0xba, 0x38, 0xa2, 0x71, 0x92, 0x89, 0xdd, 0xa9,
+ 0xbc, 0xab, 0x9b, 0x98, 0x89, 0x98, 0xdd, 0x1a, 0x12, 0x08, 0xd9, 0x68, 0x13, 0x32, 0x24, 0x21,
+ 0x46, 0x24, 0x01, 0x20, 0x81, 0x20, 0x98, 0x64, 0x01, 0x31, 0x01, 0x31, 0xb1, 0x9d, 0x80, 0xbb,
+ 0x09, 0xfb, 0x9d, 0x09, 0xa8, 0x99, 0xcc, 0xbb, 0xbd, 0x9c, 0x88, 0x19, 0x94, 0x8c, 0x12, 0x01,
+ 0x00, 0x82, 0xaf, 0x73, 0x01, 0x31, 0x04, 0x89, 0x44, 0x80, 0x11, 0x31, 0x82, 0x11, 0x8a, 0x47,
+ 0x22, 0x12, 0x00, 0x00, 0x10, 0x33, 0x21, 0x27, 0xfb, 0xbd, 0xaa, 0xa9, 0x09, 0x41, 0xa1, 0xac,
+ 0xbb, 0x9a, 0xdd, 0xab, 0xca, 0x9b, 0x11, 0x98, 0x32, 0x13, 0xfb, 0x0b, 0xa8, 0x18, 0xfa, 0x9e,
+ 0x53, 0xfc, 0x1f, 0x00, 0x22, 0x12, 0x81, 0x20, 0x44, 0x43, 0x24, 0x98, 0x21, 0x35, 0x01, 0xba,
+ 0x3a, 0x26, 0x20, 0x03, 0x38, 0x14, 0x34, 0xf8, 0x8b, 0x18, 0x44, 0x81, 0x88, 0x80, 0x28, 0x04,
+ 0x0a, 0x11, 0x88, 0xde, 0x8a, 0x00, 0xb8, 0xff, 0x8a, 0xa9, 0x88, 0xb9, 0xba, 0x0a, 0x01, 0xa0,
+ 0xdb, 0xcd, 0x8a, 0x89, 0xb8, 0x0b, 0x32, 0xe0, 0x8b, 0xb0, 0x9b, 0xad, 0x20, 0x08, 0xab, 0x91,
+ 0xdf, 0x11, 0x11, 0xba, 0x89, 0xbd, 0x60, 0x34, 0x31, 0x03, 0xaa, 0x8c, 0x73, 0x06, 0x80, 0x01,
+ 0x88, 0x20, 0x21, 0x42, 0x53, 0x43, 0x22, 0x90, 0x09, 0x98, 0x29, 0x26, 0x89, 0x13, 0x19, 0x26,
+ 0x12, 0x98, 0x41, 0x21, 0x45, 0x22, 0xd9, 0x19, 0x81, 0x53, 0xa0, 0xba, 0x20, 0x22, 0x53, 0x64,
+ 0x35, 0x13, 0x88, 0x11, 0xa9, 0xab, 0x18, 0x12, 0xb9, 0xef, 0x8a, 0x33, 0x83, 0xda, 0x8a, 0xb9,
+ 0xcd, 0xab, 0xa9, 0xac, 0xba, 0xcc, 0x0b, 0x33, 0xd8, 0x9c, 0x28, 0x11, 0x24, 0xb0, 0xcd, 0x1a,
+ 0x03, 0x9a, 0x10, 0x00, 0xb9, 0xac, 0xed, 0x8b, 0x08, 0x33, 0xfa, 0x4a, 0x23, 0x42, 0x91, 0xab,
+ 0xcc, 0x09, 0x20, 0x83, 0x9a, 0xc0, 0xaf, 0x31, 0x22, 0x14, 0xbb, 0xa0, 0x2a, 0x06, 0x89, 0xb8,
+ 0xbd, 0xca, 0x19, 0xa8, 0x51, 0x80, 0x48, 0x46, 0x22, 0x81, 0x9b, 0x41, 0x46, 0x12, 0x02, 0x88,
+ 0x88, 0x21, 0x01, 0x21, 0x77, 0x12, 0x01, 0x98, 0x89, 0x32, 0x01, 0x00, 0xab, 0x00, 0x1b, 0x86,
+ 0x0c, 0x46, 0x80, 0x9a, 0x10, 0xa0, 0x4a, 0x05, 0x88, 0x30, 0x34, 0x46, 0xb0, 0xaa, 0x88, 0x88,
+ 0x00, 0xb0, 0xef, 0x89, 0x21, 0x34, 0x02, 0x98, 0x1a, 0x02, 0x31, 0xa2, 0x19, 0xf0, 0xbf, 0x28,
+ 0x91, 0x89, 0xa8, 0xac, 0x10, 0x34, 0x02, 0xec, 0x9b, 0x98, 0xbc, 0xdc, 0xac, 0x9a, 0x88, 0x99,
+ 0xf3, 0xff, 0x18, 0x00, 0xbb, 0xca, 0xac, 0xdb, 0x8b, 0x11, 0xc9, 0xbe, 0xbc, 0x9a, 0x00, 0x12,
+ 0xeb, 0x8b, 0x98, 0x09, 0x99, 0xba, 0x5a, 0x04, 0xa8, 0xad, 0x10, 0xb1, 0xcf, 0x99, 0xa9, 0x18,
+ 0x83, 0xac, 0x21, 0x90, 0x9c, 0x34, 0xb8, 0x98, 0x28, 0x26, 0x90, 0x10, 0xa2, 0xdf, 0xab, 0x1a,
+ 0x46, 0x34, 0x23, 0x21, 0x45, 0x12, 0x88, 0x11, 0x01, 0x10, 0x88, 0x28, 0x64, 0x13, 0xaa, 0x9a,
+ 0x74, 0x53, 0x22, 0x11, 0x98, 0x08, 0x00, 0x89, 0x51, 0x81, 0x19, 0x80, 0x55, 0x24, 0x00, 0x80,
+ 0x18, 0x24, 0x18, 0xb1, 0xae, 0x99, 0x08, 0x12, 0xb9, 0x91, 0xff, 0xca, 0x8a, 0x11, 0x98, 0xcb,
+ 0x0b, 0x99, 0x89, 0x40, 0x03, 0xcd, 0xdb, 0xbb, 0x09, 0x02, 0x9a, 0x12, 0xdc, 0x89, 0x11, 0x21,
+ 0x67, 0x81, 0xba, 0x0a, 0x41, 0x12, 0x80, 0x01, 0x73, 0x33, 0x02, 0x80, 0x11, 0x32, 0x32, 0x77,
+ 0x33, 0x81, 0x89, 0x30, 0x45, 0x01, 0x80, 0x09, 0xba, 0x0b, 0x21, 0x54, 0x43, 0x14, 0xc9, 0x1a,
+ 0x12, 0x03, 0xba, 0xec, 0x9c, 0xca, 0xad, 0x89, 0x80, 0xba, 0x9a, 0x30, 0xb1, 0xbb, 0xde, 0xab,
+ 0x08, 0x98, 0x29, 0x14, 0xda, 0xbb, 0x18, 0x53, 0x23, 0x90, 0x18, 0x66, 0x34, 0x23, 0x42, 0x02,
+ 0x10, 0x98, 0x39, 0x36, 0xb1, 0x1a, 0x01, 0x73, 0x04, 0x99, 0x19, 0x11, 0x13, 0x20, 0x23, 0xfb,
+ 0x9f, 0xba, 0x9d, 0x80, 0x99, 0xbb, 0xcb, 0x8c, 0x99, 0x98, 0xdb, 0xbb, 0x09, 0x33, 0x82, 0x10,
+ 0x82, 0x30, 0x33, 0x14, 0x22, 0x75, 0x17, 0x21, 0x23, 0x34, 0x12, 0x22, 0x82, 0x29, 0x34, 0xc9,
+ 0xbd, 0x18, 0x12, 0xb0, 0xbd, 0x0a, 0x90, 0xba, 0xbd, 0x09, 0xfc, 0xeb, 0xbc, 0x88, 0x80, 0xa9,
+ 0xaa, 0x19, 0x45, 0x90, 0x8a, 0x98, 0x12, 0x2a, 0x07, 0x8b, 0x80, 0xa8, 0x4b, 0x67, 0x12, 0x11,
+ 0x9c, 0x00, 0x1c, 0x00, 0x08, 0x11, 0x02, 0xea, 0x8a, 0x90, 0x0a, 0x00, 0x80, 0x11, 0xc9, 0x10,
+ 0xfd, 0xca, 0xab, 0xdb, 0x9c, 0x99, 0xa8, 0xbc, 0x89, 0x89, 0x51, 0x25, 0x00, 0x01, 0x99, 0x08,
+ 0x64, 0x91, 0x40, 0x02, 0x00, 0x80, 0x30, 0x45, 0x22, 0x03, 0x19, 0x14, 0x08, 0x01, 0x99, 0x41,
+ 0x14, 0x81, 0xcc, 0xee, 0x9b, 0xba, 0x9a, 0x09, 0x33, 0xb2, 0xff, 0x99, 0x89, 0x18, 0x98, 0xcb,
+ 0x9a, 0x88, 0x99, 0x41, 0x22, 0x44, 0x32, 0x90, 0x30, 0x42, 0x23, 0x71, 0x27, 0x01, 0x11, 0x10,
+ 0x31, 0x12, 0x08, 0x31, 0x33, 0x90, 0x08, 0x32, 0x54, 0x55, 0x43, 0x11, 0xa9, 0xdd, 0x19, 0x12,
+ 0x22, 0xf9, 0x9b, 0x99, 0xa8, 0xcb, 0xdb, 0x0a, 0x80, 0xcb, 0x9b, 0x11, 0x91, 0xdc, 0x8a, 0xb8,
+ 0x19, 0x94, 0xbd, 0x50, 0x03, 0x8a, 0x10, 0x34, 0x11, 0x43, 0x34, 0x32, 0x83, 0x58, 0x36, 0x13,
+ 0x18, 0x31, 0x67, 0x23, 0x82, 0x09, 0x43, 0x12, 0x21, 0x10, 0x81, 0xda, 0x09, 0x88, 0x73, 0x82,
+ 0x98, 0xbb, 0x71, 0x34, 0x22, 0x92, 0xab, 0x21, 0xa8, 0xa8, 0xcb, 0xfb, 0x9e, 0xa9, 0x0a, 0xa1,
+ 0xbe, 0x9a, 0x98, 0x8a, 0x99, 0xde, 0x8a, 0xa0, 0x9a, 0xa9, 0x8a, 0xba, 0x72, 0xb0, 0x9a, 0x88,
+ 0xba, 0xab, 0xee, 0x9b, 0xa8, 0x09, 0x11, 0x98, 0x18, 0x63, 0x12, 0x90, 0xdb, 0xac, 0xba, 0x9d,
+ 0x20, 0x73, 0x02, 0x9a, 0x20, 0x47, 0x32, 0x01, 0x11, 0x01, 0x73, 0x23, 0x21, 0x14, 0x11, 0xb8,
+ 0x30, 0x36, 0x80, 0x10, 0x98, 0x08, 0x10, 0x12, 0x63, 0x88, 0x36, 0x08, 0x35, 0x90, 0x81, 0xbb,
+ 0x09, 0xb0, 0x59, 0x37, 0x90, 0xbb, 0x8b, 0x53, 0x13, 0x32, 0xd8, 0x0b, 0x91, 0xcb, 0x0b, 0x12,
+ 0x89, 0xe0, 0x8d, 0x72, 0x13, 0x20, 0x80, 0x98, 0xab, 0xfa, 0xbc, 0xab, 0xcc, 0xbc, 0xba, 0xa9,
+ 0x0d, 0x00, 0x14, 0x00, 0xbe, 0xbb, 0xad, 0x8a, 0x00, 0xb8, 0xbc, 0xfb, 0x8a, 0x01, 0x98, 0x10,
+ 0xfa, 0x0d, 0x82, 0x19, 0x98, 0xa9, 0xad, 0xa8, 0x9c, 0x10, 0x12, 0xc9, 0x99, 0x20, 0x32, 0x82,
+ 0xbb, 0x4c, 0x27, 0xa9, 0x9a, 0x91, 0xad, 0x99, 0x60, 0x82, 0x20, 0xcb, 0xcb, 0xab, 0x08, 0x72,
+ 0x25, 0x21, 0x91, 0x09, 0xa0, 0x08, 0x99, 0x21, 0x88, 0x38, 0x57, 0x31, 0x13, 0x34, 0x43, 0x35,
+ 0x53, 0x32, 0x43, 0x24, 0x43, 0x35, 0x12, 0x81, 0x42, 0x13, 0x32, 0x13, 0x91, 0x40, 0xc1, 0x20,
+ 0xb9, 0x19, 0x36, 0x08, 0x24, 0x28, 0x36, 0x23, 0x00, 0x24, 0x99, 0x52, 0x82, 0x52, 0xb0, 0x38,
+ 0x10, 0x03, 0xaf, 0x02, 0x9c, 0x23, 0x8a, 0x25, 0x30, 0x23, 0x55, 0x12, 0x23, 0x10, 0xe9, 0xbb,
+ 0x28, 0xc2, 0x58, 0xa0, 0x30, 0x98, 0x33, 0x98, 0xeb, 0xaa, 0xbb, 0x9b, 0x10, 0xed, 0xba, 0xdf,
+ 0xab, 0xab, 0xcb, 0xaa, 0xad, 0x99, 0xcb, 0x9a, 0xa9, 0xcb, 0xa9, 0xdc, 0x09, 0xa9, 0x88, 0x80,
+ 0x20, 0x90, 0x49, 0xf3, 0x9c, 0xc8, 0x9d, 0x98, 0x8a, 0x88, 0x21, 0x20, 0x33, 0x14, 0xfc, 0xba,
+ 0x99, 0xb9, 0x9c, 0x10, 0xc9, 0x60, 0x02, 0x38, 0x14, 0x11, 0x32, 0x12, 0x63, 0x33, 0x44, 0x25,
+ 0x12, 0x21, 0x32, 0x33, 0x52, 0x24, 0x43, 0x23, 0x88, 0x80, 0x10, 0x23, 0x53, 0x44, 0x12, 0x31,
+ 0x42, 0x34, 0x82, 0x1a, 0x06, 0xbb, 0xa9, 0x10, 0x09, 0xb0, 0x7b, 0x24, 0x80, 0xab, 0xfa, 0xab,
+ 0xcb, 0xac, 0xba, 0xce, 0x89, 0x99, 0xb9, 0xbd, 0xac, 0xbb, 0xae, 0xba, 0xab, 0xac, 0x98, 0x09,
+ 0x81, 0x98, 0xcc, 0xcd, 0x9a, 0x98, 0x89, 0x10, 0x00, 0x10, 0x21, 0xb1, 0x0b, 0xcb, 0x50, 0x42,
+ 0x45, 0x22, 0x44, 0x53, 0x33, 0x42, 0x12, 0x12, 0x11, 0x52, 0x33, 0x24, 0x10, 0x43, 0x12, 0x9a,
+ 0xe7, 0xff, 0x0c, 0x00, 0xe8, 0x9b, 0x80, 0xbb, 0x41, 0x00, 0x63, 0x82, 0xaa, 0xfa, 0xcb, 0xac,
+ 0xba, 0xcb, 0xcb, 0xdc, 0xaa, 0xcb, 0xab, 0x99, 0xa9, 0x19, 0xb8, 0x19, 0xbd, 0x30, 0xba, 0x01,
+ 0x5a, 0xb1, 0x38, 0x20, 0x67, 0x32, 0x23, 0x45, 0x44, 0x22, 0x33, 0x81, 0x31, 0x25, 0x12, 0x43,
+ 0x23, 0x32, 0x23, 0x88, 0xb0, 0x40, 0x92, 0x10, 0x10, 0x37, 0xeb, 0xda, 0x9d, 0x99, 0xaa, 0xba,
+ 0x09, 0x21, 0x98, 0x32, 0xea, 0x89, 0xd9, 0xaf, 0x00, 0x99, 0x22, 0x44, 0x34, 0x25, 0x28, 0x33,
+ 0x23, 0x31, 0x17, 0x18, 0x02, 0x11, 0x10, 0x24, 0x22, 0x32, 0x27, 0x11, 0x90, 0x80, 0xcd, 0xbb,
+ 0x89, 0xbc, 0xdd, 0x9b, 0xa9, 0xbb, 0xbc, 0xbc, 0xab, 0x9a, 0x19, 0x63, 0x22, 0x32, 0xe1, 0x0b,
+ 0x90, 0x20, 0x42, 0x24, 0x43, 0x02, 0x44, 0x24, 0x13, 0x53, 0x23, 0x24, 0x90, 0x00, 0x98, 0x9a,
+ 0x08, 0xdb, 0xa9, 0xbd, 0xa0, 0xce, 0xca, 0x99, 0xba, 0x9a, 0x99, 0xcc, 0xb9, 0xaf, 0xa9, 0x8c,
+ 0x88, 0x20, 0x09, 0x12, 0x18, 0x23, 0x74, 0x24, 0x21, 0x32, 0x46, 0x22, 0x22, 0x22, 0x53, 0x13,
+ 0x20, 0x81, 0x12, 0xac, 0x00, 0xeb, 0x18, 0x99, 0x21, 0x90, 0xfb, 0x19, 0xeb, 0xbb, 0x9b, 0xdc,
+ 0x9b, 0x89, 0x99, 0xba, 0xcc, 0xcb, 0xba, 0xad, 0x00, 0x9b, 0x22, 0x31, 0x27, 0x41, 0x02, 0x50,
+ 0x43, 0x13, 0x19, 0x13, 0x31, 0x33, 0x33, 0x62, 0x53, 0x34, 0x42, 0x43, 0x32, 0x25, 0xa0, 0x8c,
+ 0x88, 0x9a, 0xc8, 0x8b, 0xba, 0xcc, 0x8b, 0xc9, 0x9c, 0xdb, 0xab, 0xbb, 0xdb, 0xbb, 0xbd, 0xab,
+ 0xca, 0x8b, 0xca, 0x8b, 0xcd, 0x8a, 0xaa, 0x10, 0xba, 0xac, 0x18, 0x80, 0x23, 0xe9, 0x89, 0x1a,
+ 0x35, 0x21, 0x24, 0x65, 0x82, 0x20, 0x81, 0x08, 0x88, 0x73, 0x13, 0x41, 0x26, 0x32, 0x34, 0x14,
+ 0xaa, 0x00, 0x18, 0x00, 0x89, 0x81, 0xa8, 0x98, 0x8a, 0x93, 0x9d, 0x53, 0x91, 0x71, 0x82, 0x20,
+ 0x21, 0x33, 0x09, 0x03, 0xbc, 0xec, 0x9a, 0xcd, 0xab, 0x9b, 0xa9, 0xbc, 0x8c, 0x98, 0xdb, 0x9b,
+ 0x9a, 0x11, 0xab, 0xb0, 0xce, 0xaa, 0x08, 0xfb, 0x0b, 0xa8, 0x99, 0xaa, 0xba, 0xbc, 0xdb, 0xa9,
+ 0x8a, 0x08, 0x92, 0x8d, 0xc8, 0x48, 0x03, 0x98, 0x28, 0x02, 0x75, 0x13, 0x52, 0x35, 0x12, 0x31,
+ 0x35, 0x13, 0x43, 0x23, 0x53, 0x21, 0x14, 0x42, 0x13, 0x53, 0x23, 0x33, 0x43, 0x12, 0x32, 0x43,
+ 0x24, 0x11, 0x11, 0x10, 0x02, 0xa1, 0xaf, 0x21, 0xa0, 0x0b, 0x01, 0x73, 0x27, 0x21, 0x08, 0x11,
+ 0x42, 0x03, 0x41, 0x90, 0x9a, 0x65, 0x01, 0x08, 0x99, 0xca, 0x49, 0xb1, 0x39, 0xa4, 0x39, 0x27,
+ 0x80, 0x19, 0x01, 0x01, 0xdb, 0xdf, 0xaa, 0xaa, 0xba, 0xcc, 0xb9, 0xac, 0xab, 0xda, 0x9c, 0xa8,
+ 0x9a, 0xab, 0x10, 0xb9, 0x98, 0xce, 0x99, 0xaa, 0xaa, 0x09, 0xa9, 0xba, 0xbb, 0xef, 0x98, 0x9a,
+ 0xaa, 0x99, 0x19, 0x02, 0xbc, 0x9c, 0x72, 0x12, 0x01, 0x18, 0x80, 0x9d, 0xa8, 0x9f, 0x10, 0xa0,
+ 0x8c, 0x22, 0xa8, 0xbb, 0xdf, 0x9c, 0xaa, 0x08, 0x18, 0x35, 0x12, 0x81, 0x00, 0x33, 0x25, 0xf9,
+ 0x8a, 0xa8, 0x0b, 0xaa, 0x52, 0x21, 0x63, 0x44, 0x24, 0x12, 0x28, 0x01, 0x18, 0x43, 0x10, 0x34,
+ 0x62, 0x24, 0x40, 0x33, 0x34, 0x11, 0x53, 0x33, 0x81, 0x00, 0x38, 0x06, 0x20, 0x82, 0x28, 0x19,
+ 0x13, 0x11, 0x08, 0x17, 0x31, 0x82, 0x72, 0x42, 0x35, 0x51, 0x13, 0x81, 0x9b, 0xb9, 0x0b, 0x88,
+ 0x10, 0xd9, 0x8c, 0x33, 0x22, 0x15, 0xcb, 0xb9, 0xaf, 0x99, 0x89, 0x00, 0x45, 0x12, 0x11, 0x53,
+ 0x12, 0x10, 0x80, 0x89, 0x33, 0x52, 0x83, 0xbb, 0x29, 0xf8, 0xbf, 0xab, 0xdb, 0xcc, 0x9b, 0xca,
+ 0x19, 0x01, 0x14, 0x00, 0x9a, 0xb8, 0x8a, 0xd9, 0x9c, 0x9a, 0xa9, 0xec, 0xbb, 0xaa, 0xbc, 0xb9,
+ 0xbb, 0xab, 0xcc, 0x9b, 0x90, 0x0b, 0x02, 0xb9, 0xac, 0xba, 0x73, 0x00, 0xa1, 0x1b, 0xf9, 0x8a,
+ 0xcb, 0x99, 0x30, 0xc0, 0x51, 0x00, 0x73, 0x86, 0xba, 0x08, 0xda, 0x09, 0x90, 0x99, 0x32, 0x24,
+ 0x63, 0x24, 0x21, 0x23, 0x31, 0x11, 0x34, 0x23, 0x56, 0x13, 0x42, 0x23, 0x64, 0x12, 0x10, 0x31,
+ 0x23, 0x12, 0x00, 0x34, 0x11, 0x98, 0x80, 0x0a, 0xa8, 0x28, 0x43, 0x53, 0x57, 0x24, 0x34, 0x92,
+ 0x99, 0x10, 0x02, 0x18, 0x13, 0xec, 0xcb, 0xad, 0x9b, 0xa9, 0x89, 0x00, 0x08, 0xe9, 0xcc, 0xca,
+ 0xbc, 0xa9, 0xcb, 0xa9, 0xcb, 0xac, 0xb9, 0xac, 0x88, 0x89, 0x21, 0xa0, 0x1a, 0xca, 0xab, 0xba,
+ 0xce, 0x8a, 0x89, 0x80, 0xba, 0xbd, 0x20, 0x43, 0x35, 0x24, 0x65, 0x12, 0x31, 0x12, 0x12, 0x09,
+ 0x22, 0x64, 0x13, 0x43, 0x34, 0x11, 0x01, 0x31, 0x03, 0x19, 0x11, 0x11, 0x11, 0x99, 0x93, 0xbd,
+ 0x32, 0xff, 0x8b, 0xb8, 0xbb, 0xdc, 0xbb, 0x99, 0xbb, 0xbf, 0xab, 0xb9, 0xbf, 0xac, 0x9a, 0xaa,
+ 0xaa, 0x9b, 0xa8, 0x29, 0x53, 0x24, 0x53, 0x33, 0x34, 0x13, 0x00, 0x51, 0x34, 0x33, 0x45, 0x24,
+ 0x11, 0x32, 0x42, 0x43, 0x81, 0xba, 0x9b, 0xcc, 0x8b, 0xcb, 0xba, 0xac, 0xeb, 0x0a, 0xb9, 0xcc,
+ 0x8a, 0x08, 0x11, 0xa8, 0x9b, 0x11, 0xfa, 0x8d, 0x43, 0x01, 0x32, 0x01, 0x19, 0x26, 0x11, 0x14,
+ 0x30, 0x37, 0x23, 0x90, 0x29, 0xa8, 0x88, 0x9c, 0xa1, 0xaf, 0x98, 0x9a, 0xd8, 0xab, 0x11, 0xe8,
+ 0xaf, 0xaa, 0xab, 0xb9, 0x89, 0x9a, 0x18, 0x24, 0x31, 0x57, 0x11, 0x24, 0x22, 0x34, 0x33, 0x90,
+ 0x28, 0x92, 0x9c, 0xb0, 0xbe, 0xac, 0x10, 0x88, 0xca, 0x31, 0xcb, 0xc9, 0xbe, 0xca, 0x9a, 0x00,
+ 0x5a, 0xfe, 0x10, 0x00, 0x31, 0x33, 0x02, 0x51, 0x93, 0x71, 0x03, 0x22, 0x31, 0x02, 0x89, 0xa9,
+ 0x71, 0x57, 0x20, 0x13, 0x98, 0x10, 0x00, 0xc0, 0xbe, 0x8a, 0xcc, 0x8a, 0xdb, 0x88, 0x89, 0x80,
+ 0x09, 0xba, 0x09, 0x30, 0x85, 0x1b, 0x27, 0x01, 0x53, 0x81, 0x72, 0x22, 0x54, 0x02, 0x08, 0x00,
+ 0x10, 0x80, 0x08, 0x81, 0xbc, 0xb9, 0x8d, 0xb8, 0x09, 0xbe, 0xa8, 0x9d, 0xb9, 0x99, 0x19, 0x24,
+ 0x30, 0xb0, 0x09, 0xbf, 0x00, 0xa9, 0xaa, 0x08, 0x40, 0x57, 0x00, 0x53, 0x24, 0x22, 0x02, 0x88,
+ 0x11, 0x41, 0x27, 0x22, 0x34, 0x02, 0x10, 0xb0, 0xab, 0xb9, 0xdc, 0xac, 0xcb, 0xac, 0xb9, 0x9a,
+ 0x0a, 0xc0, 0xbb, 0xce, 0x09, 0x20, 0x02, 0xc9, 0xac, 0x99, 0xba, 0x9c, 0x10, 0x81, 0x51, 0x17,
+ 0x10, 0x25, 0x11, 0x45, 0x23, 0x12, 0x23, 0xba, 0x58, 0x32, 0x01, 0x1a, 0x24, 0x81, 0x18, 0x31,
+ 0x45, 0x33, 0x01, 0xb0, 0xae, 0x09, 0x91, 0xdf, 0xaa, 0xbb, 0xdb, 0x9a, 0xba, 0x99, 0xca, 0xca,
+ 0xcb, 0xaa, 0xa9, 0x09, 0xfa, 0xcb, 0x9b, 0x21, 0x90, 0xba, 0xbd, 0xaa, 0x8a, 0x80, 0x54, 0x13,
+ 0x64, 0x13, 0x51, 0x34, 0x21, 0x33, 0x00, 0x31, 0x83, 0x40, 0x35, 0x35, 0xa8, 0x18, 0x11, 0x41,
+ 0x46, 0x31, 0x24, 0x99, 0x9a, 0xaa, 0x30, 0x14, 0xfb, 0x29, 0x81, 0x42, 0x81, 0x90, 0x9a, 0xaa,
+ 0xec, 0xbc, 0xba, 0xcd, 0x8a, 0xcd, 0x99, 0xab, 0x91, 0x8b, 0xd9, 0x0a, 0x00, 0x98, 0xad, 0xcc,
+ 0x99, 0x80, 0x99, 0xb0, 0xbe, 0xb9, 0x8a, 0xba, 0x99, 0xaf, 0x99, 0x9a, 0x88, 0x11, 0xcb, 0x73,
+ 0x13, 0x22, 0xa0, 0xb9, 0x0d, 0x02, 0x30, 0x13, 0x76, 0x12, 0x43, 0x21, 0x44, 0x34, 0x02, 0x88,
+ 0x89, 0x34, 0x11, 0x43, 0x33, 0x13, 0x80, 0x88, 0x40, 0x23, 0x50, 0x13, 0x12, 0xdc, 0x41, 0x21,
+ 0xaf, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x88, 0x09, 0x51, 0x12, 0x42, 0x22, 0x02, 0x1b, 0xe9, 0x28,
+ 0x00, 0x12, 0x9a, 0xf9, 0x9c, 0x88, 0xbb, 0x8b, 0x11, 0xeb, 0xea, 0xae, 0xa9, 0x98, 0xaa, 0xca,
+ 0xab, 0x88, 0xfa, 0xac, 0xb9, 0x89, 0xcb, 0xb8, 0xac, 0x99, 0x9b, 0xba, 0xac, 0x11, 0x12, 0xf9,
+ 0x8a, 0xb9, 0xab, 0xea, 0xac, 0xac, 0x88, 0x99, 0x82, 0x89, 0x01, 0x2a, 0x77, 0x33, 0x80, 0xa9,
+ 0x09, 0x91, 0x9b, 0x09, 0xb0, 0xaf, 0x9b, 0x01, 0x71, 0x33, 0x27, 0x00, 0x22, 0x23, 0x53, 0x44,
+ 0x34, 0x11, 0x33, 0x43, 0x25, 0x00, 0x42, 0x01, 0x23, 0x20, 0x25, 0x63, 0x01, 0x20, 0x91, 0x70,
+ 0x13, 0x52, 0x02, 0x00, 0x0a, 0x82, 0x52, 0x82, 0x24, 0x19, 0x03, 0x38, 0x88, 0x24, 0x29, 0x85,
+ 0x0b, 0x54, 0x24, 0x32, 0x88, 0x82, 0x8b, 0xb0, 0x49, 0xc8, 0x29, 0xc0, 0x70, 0x82, 0x08, 0x21,
+ 0x92, 0x71, 0xd8, 0xcc, 0xac, 0x98, 0xaa, 0xe9, 0xbb, 0xca, 0xac, 0xb9, 0xab, 0x88, 0x9c, 0x98,
+ 0x30, 0xf9, 0x9b, 0xa9, 0xeb, 0xac, 0xa9, 0x88, 0xb9, 0x9a, 0xbc, 0xb9, 0x8c, 0x98, 0x22, 0xdc,
+ 0x99, 0x00, 0xbc, 0x11, 0x8a, 0x91, 0xc0, 0x0c, 0xb0, 0xaa, 0xad, 0xe8, 0x2a, 0x12, 0x77, 0x11,
+ 0x11, 0x30, 0x14, 0x28, 0x15, 0x11, 0x03, 0x42, 0x91, 0x10, 0x90, 0x61, 0x04, 0x10, 0x11, 0x72,
+ 0x24, 0x23, 0x10, 0x23, 0x11, 0xa8, 0x89, 0x1a, 0x13, 0x10, 0xfb, 0x60, 0x24, 0x23, 0x32, 0x35,
+ 0x88, 0xa1, 0xaf, 0xb9, 0x9a, 0xbb, 0xdc, 0xac, 0xbb, 0xca, 0x8b, 0xda, 0x18, 0xa9, 0x98, 0x9a,
+ 0xcb, 0xcb, 0xcd, 0xaa, 0xb9, 0xa9, 0xab, 0x03, 0x8e, 0xc1, 0x8d, 0xa0, 0x29, 0x91, 0x18, 0x19,
+ 0x35, 0x34, 0x33, 0x44, 0x13, 0x32, 0x03, 0x31, 0x33, 0x27, 0x40, 0x15, 0x10, 0x01, 0x08, 0x53,
+ 0xc6, 0xff, 0x0e, 0x00, 0x51, 0xa1, 0x42, 0x31, 0x06, 0x2a, 0x93, 0xac, 0xa9, 0xaa, 0x8a, 0x00,
+ 0x98, 0xcc, 0xde, 0xbb, 0xbc, 0x9b, 0xb9, 0x28, 0x80, 0x44, 0x08, 0xa3, 0xcf, 0xb8, 0x9a, 0xa9,
+ 0x09, 0x19, 0x13, 0x71, 0x24, 0x33, 0x23, 0x34, 0x00, 0x24, 0x52, 0x33, 0x25, 0x22, 0x43, 0x20,
+ 0x33, 0x35, 0x53, 0x43, 0x33, 0x12, 0x22, 0x22, 0x84, 0xcd, 0x99, 0xba, 0xbc, 0xad, 0xc8, 0x8a,
+ 0xa9, 0x98, 0x9c, 0xa2, 0x3b, 0xd9, 0xa0, 0xbf, 0x00, 0x89, 0x31, 0x22, 0x36, 0x11, 0x63, 0x22,
+ 0x33, 0x12, 0x34, 0x44, 0x34, 0x52, 0x14, 0x08, 0xa0, 0xab, 0xa8, 0x9b, 0x08, 0xb9, 0xbc, 0xbc,
+ 0xcf, 0x9b, 0xca, 0x89, 0x90, 0xba, 0x29, 0xcb, 0x31, 0xe1, 0xac, 0x82, 0x29, 0x92, 0x6a, 0x83,
+ 0x38, 0x22, 0x55, 0x33, 0x44, 0x81, 0x22, 0x88, 0xba, 0x88, 0x9e, 0xa0, 0xab, 0xcf, 0x99, 0xbb,
+ 0xd9, 0x0b, 0xca, 0x19, 0xdb, 0x98, 0x9e, 0x80, 0x1a, 0x01, 0x52, 0x02, 0x33, 0x41, 0x02, 0x21,
+ 0x81, 0x88, 0x19, 0x13, 0x63, 0x53, 0x81, 0x42, 0x91, 0x21, 0xfb, 0xba, 0x9d, 0xc8, 0x2a, 0xd8,
+ 0x89, 0xc9, 0xdb, 0xcb, 0xba, 0x9b, 0xa9, 0xb9, 0xad, 0xaa, 0x30, 0x89, 0x06, 0x3a, 0x03, 0x32,
+ 0x00, 0x37, 0x18, 0x15, 0x20, 0x11, 0x31, 0x01, 0x73, 0x26, 0x23, 0x12, 0x30, 0x04, 0x19, 0x84,
+ 0xbf, 0xba, 0x0b, 0x90, 0xba, 0x4a, 0x04, 0x19, 0xdd, 0xba, 0xbb, 0xcb, 0xac, 0xb9, 0xbc, 0xa0,
+ 0xbd, 0x90, 0x29, 0x02, 0x66, 0x32, 0x33, 0x22, 0x88, 0x11, 0x9a, 0x35, 0x73, 0x22, 0x52, 0x12,
+ 0x02, 0x88, 0x10, 0x20, 0x21, 0x33, 0x42, 0x91, 0xc9, 0x9b, 0xcb, 0x11, 0x9c, 0xf9, 0xab, 0xcd,
+ 0xca, 0x9d, 0xa9, 0x9a, 0x99, 0xcb, 0x8a, 0xa9, 0x9b, 0xc0, 0xcd, 0xab, 0xa8, 0x8d, 0x23, 0x19,
+ 0x9b, 0xfd, 0x0c, 0x00, 0x11, 0x14, 0x09, 0x55, 0x53, 0x12, 0x41, 0x82, 0x28, 0x15, 0x28, 0x34,
+ 0x23, 0x33, 0x80, 0x00, 0x2b, 0x26, 0x63, 0x52, 0x24, 0x51, 0x92, 0x08, 0x89, 0x13, 0x1a, 0x84,
+ 0x38, 0xb2, 0x99, 0xdf, 0xa9, 0xcb, 0x99, 0xaa, 0x18, 0x10, 0x05, 0xab, 0xae, 0x10, 0x80, 0xc9,
+ 0x9a, 0xaf, 0x80, 0xab, 0xaa, 0xb9, 0x8c, 0x99, 0x30, 0x11, 0x25, 0x41, 0x83, 0x28, 0x03, 0x8a,
+ 0xb0, 0xac, 0x55, 0x91, 0x10, 0x13, 0x5a, 0x27, 0x72, 0x32, 0x35, 0x42, 0x13, 0x00, 0x42, 0x83,
+ 0x18, 0x00, 0x21, 0x32, 0xa0, 0x84, 0x5b, 0x04, 0x62, 0x11, 0x34, 0x33, 0x22, 0xc8, 0x0a, 0x80,
+ 0xa8, 0x10, 0xd0, 0x9d, 0x42, 0x90, 0x32, 0x99, 0x77, 0x81, 0xa9, 0xac, 0x81, 0x89, 0xc8, 0xbc,
+ 0xaa, 0xaa, 0xcd, 0x9a, 0x99, 0xcb, 0xbc, 0xdb, 0xaa, 0xaa, 0xcb, 0x08, 0x30, 0x93, 0xbb, 0xbe,
+ 0xa9, 0xbe, 0xa9, 0x9a, 0xa8, 0x99, 0xaa, 0xc9, 0x9e, 0xb9, 0x8b, 0xa9, 0x13, 0xbe, 0xea, 0x1a,
+ 0x43, 0x12, 0x99, 0x08, 0xc8, 0x9d, 0x98, 0x09, 0xcb, 0x98, 0x9c, 0xb8, 0x0b, 0xb9, 0x52, 0x20,
+ 0x77, 0x12, 0x24, 0x23, 0x23, 0x32, 0x31, 0x34, 0x73, 0x43, 0x22, 0x80, 0x00, 0x88, 0x23, 0x35,
+ 0x35, 0x33, 0x52, 0x23, 0x43, 0xb1, 0xaa, 0x70, 0x03, 0x00, 0xca, 0x99, 0x9c, 0x99, 0x18, 0x30,
+ 0x57, 0x22, 0x11, 0x03, 0xa9, 0xeb, 0x8b, 0x19, 0x80, 0xaa, 0x9c, 0x11, 0x88, 0x99, 0x25, 0x1b,
+ 0x37, 0x18, 0x02, 0x09, 0x30, 0x14, 0x18, 0x92, 0x73, 0x47, 0x90, 0xbb, 0x89, 0xb9, 0x2b, 0x92,
+ 0x29, 0xd1, 0x9d, 0xda, 0xbe, 0xba, 0xbd, 0x88, 0xbb, 0xbb, 0xba, 0xbd, 0xcc, 0x9b, 0xda, 0x08,
+ 0x99, 0x98, 0x8a, 0xc9, 0xa9, 0xaf, 0xa9, 0xab, 0xca, 0x8a, 0x98, 0xa8, 0xad, 0xd9, 0x9b, 0x08,
+ 0xfd, 0xfc, 0x0b, 0x00, 0x03, 0xcb, 0x1a, 0x54, 0x02, 0x98, 0xad, 0x19, 0xd8, 0xab, 0x99, 0xdb,
+ 0xbb, 0x00, 0x28, 0x23, 0x21, 0x55, 0x34, 0xa2, 0xbf, 0x19, 0x12, 0x34, 0x21, 0x13, 0x0b, 0xc9,
+ 0x9b, 0x8a, 0x12, 0x51, 0x43, 0x47, 0x12, 0x43, 0x33, 0x57, 0x22, 0x02, 0x00, 0x11, 0x12, 0x33,
+ 0x33, 0x22, 0x32, 0x32, 0x37, 0x34, 0x35, 0x35, 0x11, 0x01, 0x00, 0x21, 0x22, 0x90, 0x56, 0x01,
+ 0x23, 0x18, 0x24, 0x11, 0x88, 0x10, 0x57, 0x12, 0x82, 0x8a, 0x13, 0xab, 0x01, 0x12, 0xbb, 0xa4,
+ 0x1e, 0x03, 0x99, 0x0b, 0x54, 0x33, 0x11, 0xb8, 0x9c, 0xad, 0xe0, 0xae, 0xcb, 0xaa, 0xcb, 0xb9,
+ 0xad, 0xa9, 0xab, 0xab, 0x9b, 0xe9, 0xac, 0xca, 0xbb, 0xab, 0xbb, 0xac, 0xa9, 0xbb, 0x99, 0xdb,
+ 0xad, 0x99, 0x88, 0xfb, 0x9c, 0x18, 0x04, 0xaa, 0x99, 0xcc, 0xbc, 0xab, 0x09, 0x31, 0x81, 0x72,
+ 0x24, 0x24, 0x22, 0x13, 0x34, 0x10, 0x25, 0x21, 0x13, 0x32, 0x12, 0x44, 0x42, 0x15, 0x42, 0x33,
+ 0x43, 0x24, 0x21, 0x23, 0x08, 0x10, 0x36, 0x31, 0x37, 0x30, 0x02, 0x10, 0x31, 0x14, 0x23, 0xc0,
+ 0xbc, 0xbb, 0xdc, 0xcb, 0xac, 0x99, 0x89, 0xa8, 0xdb, 0xbc, 0xcb, 0xbc, 0xaa, 0x9a, 0xaa, 0x88,
+ 0xa9, 0xfb, 0xbc, 0xaa, 0xbd, 0xbc, 0xaa, 0xac, 0xc9, 0xab, 0xa9, 0x09, 0x10, 0x35, 0x53, 0x23,
+ 0x09, 0x81, 0x58, 0x34, 0x35, 0x12, 0x22, 0x33, 0x31, 0x27, 0x41, 0x12, 0x01, 0xab, 0x10, 0x54,
+ 0x10, 0x91, 0x29, 0x90, 0x11, 0x74, 0x23, 0x23, 0x28, 0xc1, 0xac, 0xeb, 0xcb, 0x8a, 0xba, 0xbc,
+ 0x9b, 0x81, 0x0a, 0xdb, 0x9d, 0xaa, 0x9a, 0x11, 0x99, 0xe9, 0xab, 0x73, 0x15, 0x02, 0x00, 0x31,
+ 0x82, 0x11, 0x31, 0x25, 0x21, 0x31, 0x27, 0x11, 0x42, 0x73, 0x24, 0x32, 0x43, 0x24, 0x92, 0x99,
+ 0x5b, 0x01, 0x0f, 0x00, 0x8a, 0xca, 0x9a, 0xa9, 0x99, 0x8c, 0xb8, 0x19, 0xf9, 0xcc, 0xaa, 0xfb,
+ 0x9a, 0x89, 0x99, 0xa9, 0x10, 0x80, 0x89, 0xa9, 0x42, 0x63, 0x33, 0x35, 0x35, 0x03, 0x80, 0x28,
+ 0x23, 0x8a, 0x12, 0x30, 0x04, 0x9a, 0xbf, 0x09, 0xaa, 0x37, 0x42, 0x26, 0x11, 0xc9, 0xbd, 0x9b,
+ 0xcc, 0xa9, 0xac, 0xa8, 0x9b, 0xbc, 0x01, 0x8a, 0x25, 0x33, 0x34, 0x02, 0x99, 0x09, 0x33, 0x83,
+ 0x78, 0x37, 0x21, 0x33, 0x35, 0x22, 0x33, 0x23, 0xba, 0xbc, 0x9b, 0xba, 0x59, 0xa1, 0xbb, 0xa8,
+ 0xbe, 0xbb, 0xac, 0xca, 0xbc, 0xbb, 0x19, 0xf8, 0xbb, 0xec, 0x08, 0x88, 0x10, 0xb9, 0x09, 0x19,
+ 0x04, 0x48, 0x36, 0x24, 0x32, 0x23, 0x54, 0x12, 0x32, 0x22, 0x90, 0x99, 0x9c, 0x22, 0x2a, 0x67,
+ 0x10, 0x91, 0x0a, 0xb9, 0xcd, 0xbd, 0xcb, 0xab, 0x99, 0x89, 0x88, 0x09, 0xa9, 0xcb, 0x99, 0xca,
+ 0xce, 0x0a, 0xa1, 0x8d, 0x90, 0x38, 0x33, 0xb8, 0x1b, 0x13, 0x30, 0x77, 0x37, 0x02, 0x10, 0x13,
+ 0x22, 0x88, 0x00, 0x90, 0xcb, 0x8a, 0x44, 0x42, 0x24, 0x30, 0x47, 0x02, 0x98, 0xaa, 0xba, 0x9d,
+ 0xb9, 0xbb, 0xab, 0xd9, 0xbc, 0xaa, 0x28, 0x81, 0x43, 0xb9, 0xc0, 0xbf, 0xbd, 0x8a, 0xba, 0xa9,
+ 0x08, 0x98, 0x04, 0xbd, 0x99, 0x19, 0x19, 0x57, 0x11, 0x01, 0xa8, 0xab, 0x11, 0x8a, 0x24, 0x41,
+ 0x47, 0x12, 0x20, 0x22, 0x74, 0x33, 0x81, 0x88, 0x08, 0xb9, 0x8a, 0x9a, 0xa2, 0x8e, 0x02, 0x41,
+ 0x53, 0x05, 0x31, 0x01, 0x01, 0x19, 0xb1, 0x18, 0x40, 0x06, 0xc9, 0xbd, 0xba, 0xbc, 0xcb, 0xb9,
+ 0xbc, 0xca, 0x9a, 0xaa, 0xb8, 0x1c, 0xa0, 0x20, 0xb9, 0xbb, 0xef, 0xa9, 0xaa, 0x98, 0xab, 0x99,
+ 0xc8, 0xad, 0xda, 0x9c, 0xb9, 0x8b, 0x98, 0x80, 0x40, 0x93, 0x31, 0x03, 0xbc, 0x13, 0xbf, 0x36,
+ 0xf9, 0xfd, 0x0c, 0x00, 0x15, 0x08, 0x13, 0x10, 0x32, 0x42, 0x37, 0x12, 0x33, 0x42, 0x35, 0x35,
+ 0x13, 0x21, 0x32, 0x53, 0x23, 0x33, 0x09, 0x72, 0x35, 0x21, 0x13, 0x90, 0xaa, 0x19, 0x99, 0xb1,
+ 0x8d, 0xb8, 0x2b, 0x23, 0x77, 0x25, 0x12, 0x88, 0x21, 0x01, 0xcb, 0x8a, 0x81, 0x8a, 0x08, 0x12,
+ 0xa8, 0x58, 0x92, 0x56, 0x11, 0x02, 0x98, 0xfb, 0xaa, 0xc9, 0x8a, 0xa9, 0x29, 0x11, 0x90, 0x09,
+ 0xff, 0xac, 0xaa, 0xab, 0xaa, 0xac, 0xb9, 0xae, 0x9b, 0x80, 0x99, 0x99, 0x9a, 0xa8, 0x1b, 0xfb,
+ 0x8f, 0x13, 0xa8, 0xcd, 0x9a, 0x00, 0x08, 0x11, 0x00, 0xa8, 0xbf, 0x0b, 0xa8, 0x19, 0xcb, 0x21,
+ 0x73, 0x12, 0x53, 0xb2, 0xad, 0x99, 0xb9, 0xaf, 0x80, 0x0a, 0xb8, 0x9b, 0xb8, 0x99, 0x0d, 0x90,
+ 0x49, 0x33, 0x36, 0x33, 0x13, 0x09, 0xf8, 0x0b, 0x92, 0x48, 0x24, 0x22, 0x32, 0x35, 0x24, 0x43,
+ 0x90, 0x41, 0x33, 0xa0, 0x72, 0x34, 0x14, 0x42, 0x11, 0x35, 0x12, 0x23, 0x80, 0x99, 0x52, 0x80,
+ 0x41, 0x22, 0x43, 0xb9, 0x9b, 0x30, 0x00, 0x34, 0x31, 0x77, 0x81, 0x18, 0x81, 0x50, 0x22, 0x80,
+ 0x30, 0xf8, 0x9b, 0xa9, 0xad, 0x89, 0x09, 0x44, 0x32, 0x01, 0x47, 0x11, 0xa8, 0x18, 0xca, 0x9c,
+ 0x10, 0xa9, 0xa9, 0x9d, 0xa8, 0x99, 0x00, 0x73, 0x02, 0x2b, 0x36, 0x33, 0xb9, 0x38, 0x13, 0xea,
+ 0x9c, 0x88, 0xca, 0x9a, 0xc8, 0xac, 0xe9, 0x8b, 0xc8, 0x0a, 0x81, 0xba, 0xaf, 0x08, 0xba, 0x9a,
+ 0xbc, 0xa9, 0xcc, 0xbc, 0xaa, 0xca, 0x99, 0xa9, 0xb9, 0x8b, 0xc9, 0x28, 0x65, 0x91, 0xaa, 0xbd,
+ 0xaa, 0x29, 0xa0, 0x88, 0x62, 0x01, 0x33, 0x08, 0xb9, 0x0d, 0xfb, 0xaf, 0x18, 0xa9, 0x89, 0x98,
+ 0xcb, 0x41, 0x14, 0xaa, 0x09, 0x12, 0x29, 0x92, 0x30, 0xfb, 0xaa, 0x8d, 0x02, 0xa8, 0x9b, 0x32,
+ 0xe0, 0xfd, 0x03, 0x00, 0x77, 0x13, 0x20, 0x21, 0x13, 0x00, 0x01, 0x41, 0x34, 0x31, 0x77, 0x81,
+ 0x11, 0x00, 0x10, 0x15, 0x08, 0x32, 0x43, 0x22, 0x23, 0x9b, 0x22, 0xcb, 0xaa, 0x30, 0x35, 0x46,
+ 0x43, 0x33, 0x11, 0xa1, 0x0b, 0x00, 0x13, 0xac, 0xb8, 0x3a, 0xf0, 0xac, 0xcb, 0xbd, 0x89, 0x09,
+ 0x91, 0xb9, 0x8e, 0x03, 0xdd, 0xab, 0x8a, 0xeb, 0x9b, 0xaa, 0xba, 0xbe, 0x89, 0x98, 0x0a, 0x36,
+ 0x12, 0xa0, 0x9b, 0x33, 0xf9, 0x8c, 0x01, 0x90, 0xba, 0x29, 0x12, 0x40, 0x55, 0x34, 0x01, 0x32,
+ 0x46, 0x13, 0x22, 0x98, 0x00, 0x73, 0x02, 0x19, 0x00, 0x12, 0x18, 0x81, 0x01, 0x1b, 0x96, 0x9b,
+ 0xf9, 0x0b, 0xa8, 0x21, 0x02, 0xb1, 0xcf, 0x89, 0x88, 0x00, 0xd9, 0xbd, 0x9b, 0xeb, 0xcb, 0xbb,
+ 0xba, 0x9c, 0xb9, 0x0a, 0x9a, 0x22, 0x0a, 0x23, 0x74, 0x25, 0x82, 0x8b, 0x56, 0x92, 0x0a, 0x22,
+ 0x02, 0x41, 0x14, 0x51, 0x03, 0x00, 0x32, 0x14, 0x31, 0x93, 0xbb, 0x18, 0x98, 0xb2, 0x3d, 0xc4,
+ 0x1b, 0xfc, 0xa9, 0x99, 0xba, 0xbc, 0x9b, 0xc9, 0x0a, 0xbc, 0xc8, 0xaf, 0x89, 0x88, 0x99, 0x98,
+ 0x41, 0x89, 0x36, 0x10, 0x24, 0x22, 0x54, 0x23, 0x21, 0x31, 0x34, 0x82, 0x54, 0xa1, 0x88, 0xba,
+ 0xf9, 0x8d, 0xa0, 0x89, 0x08, 0x00, 0x01, 0xcd, 0xaa, 0x19, 0xd9, 0x29, 0xb8, 0x08, 0xab, 0xeb,
+ 0x31, 0x10, 0x37, 0x22, 0x01, 0x42, 0x91, 0x38, 0x63, 0x13, 0x22, 0x25, 0x31, 0x92, 0x29, 0xb1,
+ 0xca, 0xff, 0x10, 0x00, 0x01, 0x88, 0x90, 0x8b, 0xd0, 0xae, 0x98, 0x9a, 0x89, 0x9a, 0xa9, 0x8a,
+ 0xbb, 0x52, 0x29, 0x67, 0x21, 0x53, 0x13, 0x01, 0x02, 0x00, 0x18, 0x21, 0x10, 0xcb, 0xa8, 0xbc,
+ 0xac, 0xbd, 0xaa, 0xbd, 0xc9, 0xad, 0xba, 0xbb, 0xac, 0xaa, 0x51, 0x21, 0x35, 0x23, 0x13, 0xba,
+ 0xe3, 0xff, 0x05, 0x00, 0x46, 0x12, 0x90, 0x19, 0x06, 0x0a, 0x92, 0x40, 0x00, 0x81, 0x29, 0x90,
+ 0x37, 0x01, 0x01, 0x21, 0x58, 0xf3, 0xaf, 0x98, 0x99, 0xaa, 0xa9, 0xac, 0x08, 0xaa, 0x11, 0xaa,
+ 0x20, 0x52, 0x47, 0x03, 0x90, 0x88, 0x52, 0x01, 0x52, 0x12, 0x33, 0x32, 0xa2, 0x2a, 0xb1, 0x10,
+ 0xcd, 0xb9, 0xaf, 0xdb, 0x9c, 0xb9, 0x0a, 0x88, 0x43, 0x12, 0xd9, 0xbc, 0xca, 0x9c, 0x00, 0x9a,
+ 0xaa, 0x08, 0xa9, 0x11, 0x73, 0x27, 0x13, 0x20, 0x82, 0x51, 0x81, 0x20, 0x21, 0x02, 0x21, 0xad,
+ 0xb9, 0xad, 0xbb, 0xcc, 0x9b, 0x08, 0x98, 0x53, 0x22, 0xb1, 0xce, 0xcd, 0x99, 0xbc, 0xaa, 0x9c,
+ 0xbb, 0xa9, 0xab, 0x80, 0x63, 0x81, 0x33, 0x50, 0x91, 0x72, 0x81, 0x91, 0x29, 0x13, 0x14, 0x6b,
+ 0x85, 0x30, 0x03, 0x63, 0x32, 0x23, 0x33, 0x03, 0x01, 0x18, 0xaa, 0x43, 0x99, 0x16, 0x09, 0x42,
+ 0x92, 0x0b, 0x22, 0x43, 0xc8, 0xc9, 0xdf, 0x89, 0xb0, 0xaa, 0xbb, 0xba, 0x9d, 0xba, 0x9c, 0x88,
+ 0x11, 0x02, 0xae, 0x21, 0xa0, 0xee, 0x9b, 0x10, 0x18, 0x02, 0x38, 0x43, 0x47, 0x34, 0x01, 0x22,
+ 0x43, 0x33, 0x33, 0x11, 0x11, 0x40, 0x24, 0x81, 0x61, 0x13, 0x11, 0x52, 0x23, 0x31, 0x33, 0x57,
+ 0x01, 0x91, 0x29, 0x92, 0x30, 0x80, 0x55, 0x00, 0xa0, 0xba, 0xaf, 0x88, 0xbb, 0x19, 0xfa, 0x09,
+ 0xa9, 0x91, 0xaa, 0xa9, 0xbc, 0xed, 0xab, 0x00, 0x43, 0xa9, 0x11, 0xfb, 0xaa, 0xcb, 0x9c, 0xaa,
+ 0x9b, 0x8a, 0xba, 0xbb, 0x2a, 0x11, 0x37, 0x08, 0xc2, 0x9e, 0xda, 0xaa, 0xb9, 0x0a, 0x22, 0x41,
+ 0x24, 0x43, 0x99, 0x33, 0x31, 0x43, 0x26, 0x80, 0x80, 0x90, 0x0a, 0x90, 0x72, 0x33, 0x53, 0x26,
+ 0x00, 0x02, 0x10, 0x9a, 0x13, 0x8d, 0x03, 0x73, 0x93, 0x98, 0xca, 0xbb, 0xad, 0x09, 0x62, 0xa1,
+ 0x67, 0x00, 0x0b, 0x00, 0x91, 0x19, 0x30, 0x16, 0x10, 0x02, 0x08, 0x08, 0xfc, 0x08, 0x9b, 0xc1,
+ 0x9d, 0xc9, 0xba, 0xad, 0xca, 0x8b, 0xcb, 0x8a, 0xa9, 0xba, 0xaa, 0x9b, 0x63, 0xa8, 0xdc, 0xbb,
+ 0xab, 0xc8, 0x9e, 0x01, 0x98, 0xad, 0x9a, 0x99, 0x99, 0x90, 0x9d, 0x99, 0x00, 0x30, 0x11, 0x32,
+ 0xb2, 0xcf, 0x0b, 0xba, 0x20, 0x43, 0x15, 0x19, 0x88, 0x09, 0x13, 0xbb, 0xb0, 0xab, 0xdd, 0xa8,
+ 0xbc, 0x91, 0x8b, 0x81, 0x72, 0x36, 0x35, 0x33, 0x13, 0x22, 0x91, 0x10, 0x12, 0x43, 0x25, 0x43,
+ 0x33, 0x35, 0x42, 0x33, 0x45, 0x43, 0x23, 0x10, 0x91, 0x08, 0x21, 0xa9, 0x02, 0x5b, 0x05, 0x61,
+ 0x92, 0x21, 0x66, 0x23, 0x02, 0x89, 0x90, 0xba, 0xa9, 0x99, 0x30, 0x11, 0x33, 0x90, 0x73, 0x34,
+ 0x34, 0x82, 0x31, 0x36, 0x92, 0x38, 0x14, 0xa1, 0xcf, 0x8b, 0x98, 0x8b, 0x15, 0x18, 0x13, 0x21,
+ 0xda, 0x29, 0xa3, 0x0b, 0xc0, 0xae, 0x01, 0xeb, 0x88, 0xba, 0xca, 0xbb, 0xac, 0x98, 0x9a, 0xbb,
+ 0xf9, 0xab, 0xdb, 0x9a, 0x9b, 0xa0, 0x19, 0x09, 0x90, 0xcb, 0x9c, 0xfa, 0x29, 0x10, 0x16, 0x10,
+ 0x02, 0x99, 0xb9, 0xaf, 0xba, 0xac, 0xfb, 0x8a, 0x08, 0x99, 0x08, 0x09, 0x34, 0x22, 0x53, 0x37,
+ 0x81, 0x08, 0x11, 0x35, 0x11, 0x10, 0x80, 0xbb, 0x11, 0x9d, 0x22, 0x24, 0x32, 0x67, 0x23, 0x52,
+ 0x03, 0x08, 0x90, 0x18, 0x89, 0x35, 0x08, 0x25, 0x80, 0x99, 0xa0, 0x9a, 0x11, 0x34, 0x51, 0x37,
+ 0x22, 0xa1, 0x9a, 0xa0, 0xab, 0xde, 0x8a, 0x09, 0x02, 0xdb, 0x80, 0x99, 0x51, 0x92, 0xdd, 0xaa,
+ 0xbb, 0xbc, 0x9c, 0x98, 0xba, 0x9c, 0xa9, 0x1a, 0xa0, 0x18, 0xfc, 0xbc, 0x99, 0xba, 0xdb, 0xad,
+ 0x99, 0xa9, 0x99, 0x20, 0x42, 0x35, 0x21, 0x02, 0x32, 0xbb, 0x00, 0x79, 0x93, 0x09, 0xa9, 0x0a,
+ 0x79, 0xff, 0x00, 0x00, 0x0c, 0x12, 0x77, 0x12, 0x44, 0x22, 0x91, 0x08, 0xa9, 0xb9, 0x09, 0xa9,
+ 0x11, 0x9b, 0xb1, 0xbd, 0xab, 0x30, 0x15, 0x44, 0xa9, 0x32, 0x20, 0xf0, 0x9c, 0xdd, 0xaa, 0xac,
+ 0xa9, 0xaa, 0xac, 0x98, 0x1a, 0xb8, 0x9b, 0xa9, 0x12, 0x54, 0x82, 0x21, 0x31, 0x92, 0x46, 0x20,
+ 0x92, 0x2b, 0xa2, 0x43, 0x90, 0x73, 0x83, 0x48, 0x14, 0x64, 0x02, 0x20, 0x10, 0x33, 0x91, 0x99,
+ 0x5a, 0xd1, 0x8c, 0xaa, 0x9b, 0x8b, 0xc8, 0x49, 0x82, 0x3a, 0x02, 0xca, 0xcf, 0xab, 0x9b, 0xb9,
+ 0xad, 0x99, 0x21, 0x52, 0x02, 0x51, 0x26, 0x31, 0x33, 0x22, 0x33, 0x10, 0x37, 0x01, 0x82, 0x8b,
+ 0xb9, 0x01, 0xae, 0x34, 0x98, 0xa0, 0xa9, 0xdd, 0x9a, 0xa1, 0x8c, 0x47, 0x01, 0xa8, 0xa8, 0x8b,
+ 0xb0, 0x8c, 0x01, 0x01, 0x81, 0x0d, 0x13, 0xaa, 0x31, 0x35, 0x73, 0x34, 0x35, 0x53, 0x23, 0x88,
+ 0x90, 0xbb, 0xac, 0x90, 0x9c, 0x00, 0x21, 0x9a, 0x23, 0x54, 0x02, 0x12, 0x19, 0x04, 0xdc, 0xbe,
+ 0x90, 0xaa, 0xb9, 0x38, 0xb2, 0x51, 0x81, 0x99, 0x45, 0x42, 0x14, 0x52, 0xa8, 0x50, 0x21, 0x14,
+ 0xa9, 0xab, 0x88, 0xeb, 0xaa, 0xaa, 0xa9, 0xcc, 0xab, 0xfa, 0x8a, 0x91, 0x20, 0x81, 0x08, 0x56,
+ 0x22, 0x12, 0x32, 0x01, 0x34, 0xb8, 0x10, 0x22, 0xb8, 0x0c, 0xf0, 0x9c, 0x80, 0x9b, 0xb0, 0xaa,
+ 0xf9, 0x9c, 0xaa, 0xb9, 0x9d, 0xda, 0x89, 0x18, 0x33, 0x41, 0x12, 0x52, 0x22, 0x24, 0x23, 0x54,
+ 0x24, 0x21, 0x11, 0xd9, 0x89, 0xa0, 0xa9, 0x9e, 0x98, 0x9e, 0xa9, 0x9b, 0xb0, 0x40, 0x83, 0x01,
+ 0x2b, 0x17, 0x99, 0xce, 0x89, 0x10, 0xc8, 0x29, 0xb9, 0x80, 0x9b, 0x81, 0x19, 0x23, 0x71, 0x13,
+ 0x21, 0x33, 0xb9, 0x03, 0x8e, 0x03, 0x39, 0x06, 0x00, 0x12, 0x12, 0x33, 0xa1, 0xbd, 0xb8, 0xcf,
+ 0xcb, 0xff, 0x0b, 0x00, 0x9c, 0xc9, 0x8a, 0x99, 0x11, 0x21, 0x00, 0xc0, 0x9a, 0xbc, 0xa0, 0x70,
+ 0x23, 0x35, 0x45, 0x01, 0x24, 0x41, 0x92, 0x18, 0xba, 0x10, 0xb8, 0xad, 0x99, 0x8a, 0xbd, 0xaa,
+ 0x29, 0x55, 0x23, 0x12, 0xd9, 0x0b, 0x90, 0xac, 0xdb, 0xbb, 0x99, 0xa8, 0x9b, 0xe0, 0x38, 0xc8,
+ 0x18, 0xa0, 0x39, 0x04, 0x2b, 0x04, 0x3b, 0x93, 0x43, 0x09, 0x33, 0x63, 0x22, 0x24, 0x61, 0x14,
+ 0x42, 0x32, 0x23, 0x10, 0x21, 0x35, 0x34, 0xa0, 0xdb, 0x19, 0xdb, 0xb9, 0xad, 0xb9, 0xaa, 0x89,
+ 0xbb, 0x00, 0x1d, 0xa4, 0x5a, 0x89, 0x24, 0x9a, 0xeb, 0x39, 0x15, 0xb8, 0xac, 0x8b, 0xb9, 0xcd,
+ 0xab, 0xa9, 0x01, 0x08, 0xb0, 0x58, 0x31, 0x37, 0x33, 0x44, 0x44, 0x03, 0x01, 0x10, 0x11, 0x01,
+ 0x98, 0x09, 0x22, 0xaa, 0x33, 0x2b, 0x26, 0x41, 0x80, 0x52, 0xa1, 0x8a, 0x29, 0x67, 0x22, 0xa1,
+ 0x39, 0xa2, 0x19, 0xea, 0xba, 0xab, 0xb8, 0xac, 0xbc, 0xbb, 0x9d, 0x81, 0xae, 0xb9, 0x99, 0x2b,
+ 0x15, 0xc9, 0xac, 0xca, 0x30, 0xe9, 0x9b, 0x19, 0xd0, 0x8a, 0xa8, 0xbb, 0x00, 0xbe, 0xa9, 0xdb,
+ 0x8b, 0x03, 0x38, 0x15, 0x12, 0xda, 0xa9, 0xcb, 0xa9, 0x09, 0x19, 0x91, 0x73, 0x33, 0x14, 0x31,
+ 0x13, 0x75, 0x02, 0x32, 0x13, 0xba, 0x28, 0x23, 0x9a, 0x73, 0x80, 0x43, 0x33, 0x23, 0x43, 0x91,
+ 0x30, 0x34, 0x90, 0x64, 0x21, 0x36, 0x12, 0xa2, 0x08, 0x19, 0x92, 0x9c, 0xdb, 0x30, 0xb9, 0x35,
+ 0x12, 0x73, 0x24, 0x23, 0x00, 0x11, 0x73, 0x91, 0x80, 0x49, 0xa2, 0x9b, 0xbb, 0xdb, 0xdb, 0xaa,
+ 0x09, 0xb0, 0x4a, 0x24, 0x44, 0x21, 0x83, 0x50, 0x01, 0xf9, 0xae, 0x9a, 0xba, 0xab, 0x99, 0x88,
+ 0xaa, 0x01, 0x20, 0xf0, 0xae, 0x9a, 0x88, 0x99, 0x25, 0x32, 0x84, 0x10, 0x0a, 0x13, 0xc0, 0xef,
+ 0xca, 0xff, 0x12, 0x00, 0xa8, 0x08, 0x9c, 0x88, 0x80, 0x09, 0x80, 0x71, 0x22, 0x12, 0x10, 0x03,
+ 0xfb, 0x8a, 0x08, 0x09, 0x11, 0xab, 0xb0, 0xbb, 0xbc, 0xba, 0x1e, 0xa0, 0x38, 0x32, 0x37, 0x92,
+ 0x9c, 0x80, 0xa0, 0x9c, 0xa1, 0x73, 0x26, 0x12, 0x12, 0xab, 0xc8, 0x1b, 0x93, 0x31, 0x73, 0x27,
+ 0x22, 0x99, 0x88, 0x00, 0xbb, 0xda, 0x9d, 0x10, 0x22, 0xaa, 0x13, 0x19, 0x05, 0x89, 0x48, 0x06,
+ 0x0a, 0x02, 0x42, 0xa0, 0xda, 0xab, 0xc9, 0x2a, 0x14, 0x18, 0x04, 0x98, 0x19, 0x64, 0x34, 0x08,
+ 0x23, 0x99, 0xc8, 0xac, 0xdc, 0x09, 0x98, 0x51, 0x02, 0x80, 0x18, 0x32, 0x14, 0xdc, 0x9a, 0x31,
+ 0xb0, 0xc9, 0xad, 0xdb, 0x9a, 0xbc, 0x90, 0x8a, 0xcd, 0x88, 0xbc, 0xa9, 0xba, 0x2a, 0x94, 0x71,
+ 0x01, 0x81, 0x31, 0x91, 0x13, 0xbf, 0xba, 0x0c, 0xc8, 0x09, 0xab, 0xa8, 0xad, 0x43, 0x31, 0x24,
+ 0x08, 0x53, 0x23, 0x41, 0x25, 0xdb, 0xa9, 0x8b, 0xb8, 0x1a, 0x21, 0x37, 0x01, 0x10, 0x24, 0x51,
+ 0x33, 0x47, 0x10, 0x23, 0x32, 0x13, 0xc8, 0x2a, 0x92, 0x00, 0x30, 0x54, 0x24, 0x18, 0x11, 0x51,
+ 0x21, 0x23, 0x48, 0x36, 0x82, 0xab, 0x00, 0x64, 0x23, 0xb1, 0x9d, 0x08, 0x88, 0xcc, 0x10, 0x10,
+ 0x92, 0x71, 0x81, 0x31, 0xc8, 0xbb, 0xbd, 0x9a, 0xcb, 0x09, 0x99, 0x31, 0x13, 0xbb, 0x35, 0x90,
+ 0xba, 0xfb, 0xad, 0xb9, 0x9d, 0xa9, 0x8a, 0xa0, 0xa0, 0x8d, 0x92, 0x39, 0xb0, 0x02, 0xaf, 0xb9,
+ 0x80, 0x8d, 0x12, 0x23, 0x59, 0x25, 0x40, 0x33, 0xc2, 0x0c, 0xba, 0x32, 0x18, 0x91, 0x19, 0xad,
+ 0x01, 0x70, 0x81, 0x13, 0x8b, 0x37, 0x41, 0x12, 0x24, 0xb9, 0x9d, 0x80, 0x0a, 0xa8, 0xbb, 0xcd,
+ 0xab, 0xb0, 0xae, 0xb9, 0x09, 0x10, 0x35, 0x11, 0xb9, 0xd9, 0x9d, 0xba, 0x18, 0x88, 0x23, 0xbf,
+ 0x89, 0xff, 0x07, 0x00, 0x81, 0x9c, 0xca, 0x8a, 0x91, 0x31, 0x04, 0x50, 0x33, 0x57, 0x11, 0x91,
+ 0x9d, 0x00, 0x00, 0x19, 0x31, 0x14, 0x11, 0x99, 0xb1, 0x3b, 0x23, 0x35, 0x28, 0x24, 0x63, 0x32,
+ 0x13, 0x59, 0xa1, 0x21, 0xae, 0x22, 0x9a, 0xa9, 0xb9, 0x8f, 0x91, 0x99, 0x29, 0x23, 0x51, 0x24,
+ 0x90, 0xaa, 0xde, 0xa9, 0x9a, 0xbb, 0xa0, 0x0d, 0x02, 0x73, 0x13, 0x34, 0x02, 0xa9, 0x8a, 0xb9,
+ 0x1c, 0xb0, 0x29, 0x09, 0x23, 0x33, 0x43, 0x44, 0x24, 0x73, 0x24, 0x00, 0x90, 0x89, 0xaa, 0x99,
+ 0x9a, 0xdb, 0xaa, 0x9c, 0xa0, 0x9a, 0xf9, 0x08, 0x21, 0xa3, 0xab, 0xfc, 0x9c, 0x90, 0x18, 0xa8,
+ 0x53, 0x98, 0x02, 0x09, 0xc9, 0x9a, 0xcf, 0xa8, 0x08, 0xb9, 0x20, 0x53, 0x52, 0x25, 0x01, 0x91,
+ 0x89, 0x99, 0x01, 0x19, 0x90, 0x12, 0xcc, 0x9a, 0x8a, 0x34, 0xb0, 0xa3, 0x9f, 0xd1, 0x8b, 0xd9,
+ 0xab, 0x8a, 0x80, 0x09, 0x31, 0xe0, 0x20, 0x9a, 0x14, 0x19, 0xb0, 0x9d, 0x99, 0xbc, 0xba, 0xac,
+ 0x98, 0x32, 0x91, 0x34, 0x12, 0x9b, 0x47, 0x22, 0x43, 0x92, 0x90, 0xad, 0xb9, 0xac, 0x09, 0xb9,
+ 0x72, 0x93, 0x11, 0x32, 0x02, 0x52, 0x82, 0x73, 0x81, 0xa9, 0x9d, 0x98, 0x9b, 0x32, 0x98, 0x45,
+ 0xc9, 0xaa, 0xbb, 0xac, 0x9a, 0x08, 0x38, 0x33, 0x51, 0x33, 0x43, 0x24, 0x32, 0x13, 0x71, 0xb0,
+ 0x29, 0xb8, 0x91, 0x09, 0x41, 0x35, 0x73, 0x32, 0x43, 0x43, 0x81, 0x80, 0xbc, 0xa0, 0x0c, 0x80,
+ 0x33, 0x2a, 0x27, 0x21, 0x44, 0x24, 0x90, 0x09, 0xb8, 0xac, 0x99, 0xaa, 0xa0, 0xbb, 0xcb, 0x0b,
+ 0xab, 0x9a, 0x32, 0xbb, 0xc1, 0x0e, 0xda, 0x09, 0xbc, 0x08, 0x00, 0x10, 0x23, 0x59, 0x35, 0x33,
+ 0x10, 0xa2, 0x30, 0xa2, 0x00, 0x00, 0xbd, 0x81, 0x7b, 0x04, 0x28, 0x98, 0x12, 0x61, 0x14, 0xb8,
+ 0x71, 0x00, 0x07, 0x00, 0x81, 0x89, 0xba, 0xa0, 0x8c, 0x92, 0x0c, 0xb1, 0x1b, 0x43, 0x98, 0x91,
+ 0xdb, 0x49, 0x02, 0x11, 0x10, 0x21, 0x24, 0xba, 0xda, 0x0b, 0xcc, 0x9a, 0xc9, 0xac, 0xb8, 0x0c,
+ 0xa0, 0x00, 0x08, 0xd9, 0x09, 0x9a, 0x11, 0xfa, 0x8a, 0x80, 0x11, 0xab, 0xd9, 0x5b, 0x03, 0x10,
+ 0x89, 0xb9, 0x10, 0xaf, 0xa1, 0xbb, 0x00, 0x9c, 0x99, 0xcd, 0xcb, 0x18, 0x09, 0x44, 0x43, 0x92,
+ 0x1b, 0xc0, 0x8d, 0x90, 0xaa, 0x49, 0x94, 0x5a, 0x02, 0x01, 0x72, 0x02, 0x88, 0xab, 0x99, 0x19,
+ 0xaa, 0x29, 0xb0, 0x73, 0x11, 0x35, 0x22, 0x81, 0x42, 0x11, 0x13, 0x11, 0xdf, 0x00, 0x80, 0xa8,
+ 0x8c, 0x02, 0x99, 0x00, 0x99, 0x59, 0x94, 0x40, 0x92, 0x20, 0x24, 0x22, 0xd0, 0x19, 0x22, 0x93,
+ 0xbd, 0x9c, 0x10, 0x63, 0xa9, 0xc9, 0x0b, 0xfb, 0xba, 0x9b, 0xa0, 0x8a, 0x9b, 0x14, 0x51, 0x21,
+ 0x54, 0x33, 0x11, 0xdc, 0x8a, 0x19, 0xa3, 0x0c, 0xc9, 0x9b, 0x20, 0x23, 0xb0, 0xbf, 0xb8, 0xac,
+ 0x8a, 0x92, 0x4b, 0x27, 0x10, 0x12, 0x18, 0x91, 0x3b, 0x27, 0x10, 0x91, 0x18, 0x91, 0x09, 0x00,
+ 0xa0, 0x5a, 0xb1, 0x49, 0xb8, 0x30, 0x22, 0x03, 0x19, 0x47, 0x11, 0x52, 0x33, 0x11, 0x89, 0x90,
+ 0x99, 0xba, 0x30, 0xd1, 0x50, 0x91, 0x18, 0x23, 0x33, 0x36, 0x98, 0xb9, 0x8c, 0xda, 0x09, 0xab,
+ 0xb1, 0x1c, 0x33, 0xa1, 0x59, 0x03, 0x32, 0x73, 0x17, 0x98, 0xa0, 0x9a, 0xbb, 0x99, 0xaa, 0xb9,
+ 0x2a, 0xfb, 0x88, 0x0b, 0x03, 0x32, 0xbc, 0xd0, 0x9d, 0x10, 0x11, 0x1a, 0xc1, 0x30, 0xad, 0xa2,
+ 0x71, 0xb0, 0x80, 0xbf, 0x90, 0x9a, 0xbb, 0xb8, 0x8c, 0xd9, 0x18, 0x31, 0x27, 0x43, 0x90, 0xaa,
+ 0x28, 0xa0, 0x00, 0x1a, 0xb0, 0xbb, 0x2b, 0xd1, 0x0b, 0x21, 0xc9, 0x61, 0x82, 0x50, 0x12, 0x43,
+ 0xf4, 0xff, 0x07, 0x00, 0x80, 0xaa, 0xcb, 0x98, 0xad, 0x11, 0x39, 0x15, 0x41, 0x01, 0x90, 0x30,
+ 0x25, 0x01, 0x08, 0x39, 0x23, 0x74, 0x02, 0x81, 0x0b, 0x05, 0x31, 0xa0, 0x91, 0x3a, 0x27, 0x30,
+ 0x92, 0xeb, 0x0c, 0x83, 0x29, 0xb8, 0x31, 0xad, 0x91, 0x1b, 0x31, 0x17, 0x31, 0x33, 0xa1, 0x39,
+ 0x32, 0x43, 0x91, 0xbc, 0x20, 0x56, 0x92, 0xab, 0x09, 0xc9, 0xac, 0xcd, 0x88, 0x9a, 0x80, 0x30,
+ 0x11, 0x28, 0x32, 0x26, 0x31, 0xdd, 0xaa, 0xbb, 0x00, 0x00, 0xdb, 0x32, 0x00, 0x10, 0x13, 0xbb,
+ 0x31, 0x43, 0x31, 0x27, 0x98, 0x22, 0x09, 0xbb, 0xdb, 0x9c, 0x31, 0xa0, 0x28, 0xb9, 0x1a, 0xbb,
+ 0xfa, 0x9a, 0x81, 0x8c, 0x34, 0x39, 0x27, 0x40, 0x03, 0x11, 0x88, 0xea, 0x89, 0x99, 0x81, 0xaa,
+ 0x99, 0xc1, 0xab, 0xbb, 0x99, 0x0c, 0xa8, 0x01, 0x01,
+};
@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define BCFIRE_BITS_PER_SAMPLE 4
+#define BCFIRE_SAMPLE_RATE 32000
+#define BCFIRE_SAMPLES 35584
+#define BCFIRE_BYTES 18057
+
+extern const uint8_t bcFire[BCFIRE_BYTES];
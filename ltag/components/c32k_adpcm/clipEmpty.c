@@ -0,0 +1,318 @@
+
+#include <stdint.h>
+
+const uint8_t clipEmpty[] = {
+ 0x4c, 0x53, 0x4e, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x6a, 0x26, 0x00, 0x00,
+ 0xff, 0xff, 0x00, 0x00, 0x00, 0x19, 0x91, 0x30, 0xa0, 0x22, 0xbb, 0x19, 0xa9, 0x33, 0x2b, 0x67,
+ 0x1a, 0x27, 0x8b, 0x03, 0xad, 0xda, 0x8c, 0x92, 0x1c, 0x84, 0x5a, 0x92, 0x51, 0xa8, 0x11, 0x19,
+ 0xb3, 0x1d, 0xc0, 0xba, 0x38, 0xd0, 0x30, 0x30, 0x15, 0x64, 0x90, 0x03, 0xff, 0xff, 0xaf, 0x63,
+ 0x23, 0xa8, 0x9b, 0xa9, 0x21, 0x98, 0x99, 0x73, 0x04, 0x99, 0x88, 0x19, 0x23, 0xaa, 0xb9, 0x9a,
+ 0xef, 0x19, 0x43, 0x11, 0x80, 0x18, 0xe0, 0x8b, 0x01, 0x08, 0x09, 0x13, 0x52, 0x82, 0xc8, 0xad,
+ 0x99, 0x09, 0x01, 0x43, 0x82, 0xaa, 0x21, 0xc8, 0xc9, 0x3a, 0x83, 0x61, 0xc8, 0x20, 0x01, 0x98,
+ 0x88, 0x30, 0x04, 0x32, 0x98, 0xa0, 0x8b, 0xff, 0x8c, 0x30, 0x11, 0x62, 0x03, 0x99, 0xab, 0x08,
+ 0xc9, 0x3a, 0xa0, 0x41, 0xa9, 0xb8, 0x1c, 0x90, 0x12, 0x28, 0xf8, 0x29, 0xff, 0x8a, 0x45, 0xa8,
+ 0x54, 0xa9, 0x31, 0x9a, 0xa2, 0x0f, 0x85, 0x0b, 0x83, 0x8a, 0x99, 0xa8, 0x28, 0xb9, 0x43, 0xa9,
+ 0x9a, 0x47, 0x00, 0x02, 0x39, 0xd1, 0x29, 0xb8, 0xa9, 0x8f, 0x06, 0x1a, 0x05, 0x8a, 0x81, 0x21,
+ 0xa9, 0x09, 0x22, 0xcc, 0x10, 0x18, 0xc9, 0x88, 0x29, 0x9c, 0x77, 0xc7, 0x19, 0xa9, 0x1b, 0x47,
+ 0xa0, 0x9a, 0x10, 0xa8, 0x9a, 0x62, 0xa2, 0x8c, 0x81, 0x8a, 0x52, 0x02, 0x18, 0xf0, 0x2b, 0xa2,
+ 0x58, 0xb1, 0x21, 0x9c, 0x01, 0x58, 0x80, 0x01, 0x9d, 0x82, 0x0b, 0x05, 0x19, 0x93, 0x8c, 0xb8,
+ 0x09, 0x8b, 0x17, 0x19, 0xe8, 0x28, 0xaa, 0x00, 0x50, 0xe0, 0x39, 0x03, 0x88, 0x98, 0x20, 0xca,
+ 0x62, 0x81, 0x00, 0x80, 0x60, 0xa2, 0x8d, 0xc0, 0x58, 0x91, 0x00, 0xab, 0xa0, 0x29, 0x91, 0x28,
+ 0x15, 0xdc, 0x28, 0x92, 0x8a, 0x99, 0x48, 0x13, 0x91, 0xbf, 0x28, 0x24, 0x91, 0x09, 0x01, 0x10,
+ 0xc3, 0x01, 0x32, 0x00, 0x33, 0xa9, 0xa2, 0x2e, 0xd2, 0x48, 0xcb, 0x36, 0xc8, 0x9a, 0x31, 0x01,
+ 0x02, 0xbb, 0xc9, 0x1a, 0xa8, 0x08, 0xea, 0xba, 0x1a, 0x36, 0x22, 0xb0, 0xac, 0x09, 0x01, 0x73,
+ 0x13, 0xa8, 0x3a, 0x17, 0x91, 0xbb, 0x91, 0x5a, 0x05, 0x30, 0x02, 0xba, 0x8b, 0x90, 0xa9, 0xcd,
+ 0x09, 0x08, 0x20, 0x35, 0xe9, 0xcb, 0xbc, 0x30, 0x23, 0x00, 0x31, 0xa8, 0x42, 0x00, 0xfa, 0x1c,
+ 0x11, 0x32, 0x43, 0xc1, 0xbb, 0x9d, 0x01, 0x72, 0x04, 0x90, 0x88, 0x80, 0x08, 0x10, 0x24, 0xaa,
+ 0xab, 0xcd, 0x39, 0x05, 0xbd, 0x09, 0x63, 0x82, 0x8b, 0xea, 0x09, 0x01, 0x82, 0xc9, 0x8d, 0x14,
+ 0x3a, 0xe2, 0x49, 0xa0, 0x25, 0x29, 0xf1, 0x18, 0xa8, 0x03, 0x2e, 0xa5, 0x1d, 0x93, 0x1c, 0x93,
+ 0x0a, 0x93, 0x4b, 0xb4, 0x5b, 0xe0, 0x30, 0xa0, 0x11, 0xab, 0x11, 0x88, 0xb1, 0x38, 0xee, 0x62,
+ 0xa9, 0x22, 0xba, 0x30, 0x91, 0x30, 0xf9, 0x31, 0xac, 0x85, 0x0c, 0x03, 0x8a, 0x10, 0xa0, 0x53,
+ 0xba, 0x82, 0x8c, 0x83, 0x19, 0x25, 0xa9, 0xda, 0x39, 0x98, 0x07, 0x3a, 0xc8, 0x84, 0xdf, 0x15,
+ 0x29, 0xb0, 0xbb, 0x7c, 0x85, 0x9a, 0x08, 0xb2, 0x6c, 0x93, 0x8c, 0x20, 0xd0, 0x58, 0xa0, 0x81,
+ 0x1e, 0xa6, 0x3c, 0xc2, 0x58, 0xda, 0x32, 0x99, 0x81, 0x19, 0x02, 0xdb, 0x61, 0xca, 0x52, 0xbb,
+ 0x13, 0x0b, 0x94, 0x08, 0x99, 0x82, 0x50, 0xeb, 0x33, 0xac, 0x14, 0x89, 0x90, 0x00, 0x2a, 0xd3,
+ 0x68, 0xc8, 0x31, 0xba, 0x32, 0xb9, 0x0a, 0x05, 0x8b, 0x03, 0x09, 0xba, 0x73, 0x98, 0x00, 0xb9,
+ 0x18, 0x04, 0xdb, 0x10, 0x88, 0x12, 0x31, 0xd9, 0x72, 0x91, 0x1b, 0xb1, 0x0b, 0x88, 0x15, 0x9f,
+ 0x01, 0x28, 0xba, 0x45, 0x99, 0x81, 0x28, 0xd0, 0x38, 0xe8, 0x0a, 0x15, 0xa0, 0xa9, 0x4a, 0x27,
+ 0xff, 0xf8, 0x51, 0x00, 0x68, 0xd8, 0x29, 0x01, 0xa9, 0x50, 0x92, 0xba, 0x30, 0xb8, 0x42, 0xaa,
+ 0x82, 0x68, 0xc0, 0x20, 0xbb, 0x03, 0x9a, 0x13, 0x9b, 0x67, 0xb8, 0x88, 0x10, 0x01, 0xb9, 0x60,
+ 0xe0, 0x2a, 0x03, 0xa0, 0x29, 0xe0, 0x29, 0x12, 0xa2, 0x0e, 0x93, 0x0d, 0x06, 0x89, 0x80, 0x2a,
+ 0xb1, 0x19, 0x80, 0x81, 0x08, 0x8b, 0x27, 0x2b, 0xc6, 0x2b, 0x84, 0x00, 0xac, 0x23, 0x89, 0xa8,
+ 0x38, 0x91, 0xac, 0x71, 0x91, 0x18, 0xac, 0x24, 0x9b, 0x02, 0xac, 0xab, 0x45, 0xa9, 0x31, 0x09,
+ 0x81, 0x0c, 0x33, 0x25, 0xba, 0x44, 0xbc, 0x03, 0x2d, 0x87, 0x0c, 0xb8, 0x30, 0x09, 0xd3, 0x3c,
+ 0xb4, 0x19, 0x80, 0x81, 0x11, 0xcc, 0x22, 0x31, 0xa3, 0x8b, 0x31, 0xf1, 0x0b, 0xa0, 0xac, 0x72,
+ 0x92, 0xba, 0x30, 0xba, 0x46, 0x9a, 0x17, 0xbc, 0x20, 0x08, 0x80, 0x33, 0x9a, 0xc4, 0x2f, 0xb3,
+ 0x59, 0xbb, 0x85, 0xb1, 0x20, 0x79, 0xa8, 0x81, 0x8b, 0x94, 0x20, 0xaa, 0x81, 0x1b, 0x05, 0x08,
+ 0xbb, 0x73, 0xd8, 0x00, 0x1a, 0x97, 0x1b, 0xb2, 0x50, 0x88, 0xa1, 0x2b, 0xc2, 0x48, 0xb0, 0x40,
+ 0x90, 0x21, 0xbe, 0x43, 0xa8, 0x89, 0xa8, 0x68, 0x92, 0x48, 0xcb, 0x23, 0x0c, 0xa2, 0x3a, 0xb9,
+ 0x45, 0xa8, 0x8b, 0x15, 0x89, 0xb0, 0x9b, 0x35, 0x88, 0x94, 0x9f, 0x04, 0x8a, 0x92, 0x1c, 0x85,
+ 0x0b, 0x83, 0x19, 0xc0, 0x88, 0x71, 0xc9, 0x31, 0xaa, 0x04, 0x0b, 0xb9, 0x01, 0x40, 0xd9, 0x25,
+ 0x8c, 0x86, 0x1b, 0x03, 0x08, 0x80, 0xcb, 0x02, 0x39, 0xd4, 0x8b, 0x29, 0xa1, 0x72, 0xe9, 0x91,
+ 0x02, 0x80, 0x7c, 0x9a, 0xa1, 0xc2, 0x21, 0xb8, 0x49, 0x80, 0x28, 0x04, 0x8e, 0x93, 0x3c, 0xa3,
+ 0x60, 0xc8, 0x19, 0x02, 0x89, 0x98, 0x1b, 0x22, 0xf1, 0x91, 0x1d, 0x52, 0xaa, 0x92, 0x19, 0xa3,
+ 0xba, 0x17, 0x4e, 0x00, 0x84, 0x09, 0xba, 0x31, 0x88, 0xb3, 0x8f, 0x23, 0xa8, 0x9c, 0x94, 0x8f,
+ 0x85, 0x0b, 0x04, 0x99, 0x02, 0x8b, 0x33, 0x89, 0xc9, 0x5a, 0x04, 0x8a, 0x21, 0xc9, 0x2a, 0x33,
+ 0x81, 0xbe, 0x80, 0x4b, 0xe4, 0x4a, 0xc0, 0x38, 0xab, 0x13, 0x29, 0xa3, 0x20, 0x0d, 0x94, 0x1d,
+ 0x04, 0x88, 0x81, 0x1a, 0xa3, 0x72, 0xa9, 0xb0, 0x1e, 0xb3, 0x4c, 0xa3, 0x0b, 0xa0, 0x18, 0x88,
+ 0x15, 0x1c, 0x93, 0x49, 0xca, 0x23, 0x9b, 0x09, 0x07, 0x8f, 0x85, 0x29, 0xa2, 0x0a, 0x19, 0x12,
+ 0x08, 0xb8, 0xbd, 0x2a, 0x82, 0x49, 0xd1, 0x70, 0xc0, 0x20, 0xa9, 0x83, 0x0e, 0x02, 0x89, 0x21,
+ 0xb0, 0x29, 0x22, 0xba, 0x45, 0x99, 0xda, 0x70, 0xc1, 0x19, 0x09, 0x03, 0x1a, 0xc3, 0x1d, 0x83,
+ 0x0a, 0xd9, 0x28, 0x11, 0xa1, 0x70, 0xa8, 0x24, 0xbc, 0x82, 0x49, 0xb0, 0x00, 0x1c, 0x94, 0x49,
+ 0xd1, 0x29, 0xa0, 0x32, 0xb9, 0x80, 0x0e, 0x86, 0x1a, 0xb0, 0x29, 0x91, 0xa1, 0x30, 0x9b, 0x37,
+ 0x8e, 0x03, 0x2a, 0x93, 0x0c, 0xa1, 0x5b, 0x93, 0x20, 0xca, 0x90, 0x0e, 0x83, 0x0a, 0xaa, 0x26,
+ 0xaa, 0x91, 0x31, 0xea, 0x20, 0xb8, 0x79, 0x92, 0x3a, 0xb4, 0x2a, 0xb2, 0x2a, 0x83, 0x99, 0x32,
+ 0x23, 0x21, 0xa1, 0xef, 0x30, 0xf8, 0x08, 0xca, 0x20, 0xb9, 0x40, 0xd8, 0x60, 0x91, 0x00, 0x89,
+ 0x80, 0x43, 0x9a, 0x05, 0x4a, 0xe1, 0x20, 0xb8, 0xa1, 0x3a, 0xc1, 0x38, 0x19, 0xa5, 0x2d, 0xa2,
+ 0x30, 0xcb, 0x08, 0x9b, 0x14, 0xb9, 0x23, 0xad, 0x17, 0x0b, 0x14, 0x88, 0x21, 0xe9, 0x39, 0xa2,
+ 0x20, 0xfa, 0x20, 0xaa, 0x12, 0x2a, 0xf1, 0x20, 0xaa, 0x13, 0x5a, 0xc2, 0x41, 0xbb, 0x14, 0x9c,
+ 0xa1, 0x3a, 0x17, 0xaa, 0x13, 0x1a, 0xa1, 0x8b, 0xba, 0x99, 0x65, 0xa9, 0x20, 0x89, 0x82, 0x8c,
+ 0xed, 0xf6, 0x3f, 0x00, 0x11, 0x15, 0x9d, 0x91, 0x3c, 0xa3, 0x30, 0x0a, 0xd5, 0x5a, 0xc0, 0x20,
+ 0x8a, 0x01, 0x18, 0x08, 0x92, 0x58, 0xb9, 0x92, 0x9f, 0x01, 0x11, 0x18, 0xb1, 0x71, 0xa8, 0x13,
+ 0x8b, 0x82, 0xaa, 0x55, 0xda, 0x10, 0x9a, 0x83, 0x9c, 0x31, 0x81, 0x12, 0xbd, 0x23, 0xb0, 0x4c,
+ 0xa6, 0x3a, 0xd9, 0x23, 0x9d, 0xa2, 0x3b, 0x91, 0x80, 0x58, 0x04, 0x09, 0x10, 0x88, 0xd9, 0x40,
+ 0xfb, 0x33, 0x8e, 0x84, 0x0b, 0x92, 0x88, 0x38, 0xc2, 0x39, 0xc9, 0x28, 0xb1, 0x69, 0xb1, 0x43,
+ 0x8c, 0x95, 0x4b, 0xd0, 0x20, 0x8a, 0x84, 0x0a, 0xa9, 0x03, 0x0c, 0x84, 0x8b, 0x04, 0x1a, 0xa4,
+ 0x4b, 0xc2, 0x18, 0x09, 0xc1, 0x61, 0xb9, 0x15, 0x8b, 0x93, 0x3b, 0xb1, 0x19, 0xc0, 0x2a, 0xb8,
+ 0x14, 0x2d, 0xa5, 0x29, 0xbc, 0x85, 0x2f, 0xa2, 0x49, 0x90, 0x11, 0x89, 0x80, 0x80, 0x0a, 0x12,
+ 0x01, 0x30, 0xcf, 0x33, 0x8d, 0xc3, 0x4a, 0xb0, 0x22, 0x8d, 0x84, 0x0b, 0x80, 0x88, 0x00, 0x09,
+ 0x80, 0x12, 0x4a, 0xa7, 0x6a, 0xb0, 0x30, 0xaa, 0x80, 0x22, 0xab, 0x84, 0x49, 0xa8, 0x13, 0x4b,
+ 0xf9, 0x80, 0x1b, 0xf1, 0x48, 0x99, 0x00, 0x08, 0x28, 0xf1, 0x70, 0xc8, 0x21, 0x0a, 0x84, 0x08,
+ 0x90, 0x02, 0x0a, 0xc2, 0x39, 0xb1, 0x2b, 0xd1, 0x29, 0xeb, 0x12, 0x0e, 0xb3, 0x5a, 0xa0, 0x04,
+ 0x1b, 0xc1, 0x68, 0xa8, 0x22, 0xab, 0x13, 0xab, 0x24, 0x0a, 0x85, 0x19, 0x09, 0x87, 0x0e, 0xb1,
+ 0x5a, 0xa0, 0x88, 0x1a, 0xa3, 0x50, 0xc0, 0x39, 0xb1, 0x21, 0x8a, 0x87, 0x3b, 0xe3, 0x39, 0xb9,
+ 0x06, 0x8c, 0x04, 0x08, 0xa9, 0x00, 0x39, 0xf3, 0x1b, 0x93, 0x59, 0xd1, 0x19, 0x91, 0x83, 0x2c,
+ 0xd1, 0x61, 0xa9, 0x11, 0x9b, 0x04, 0x89, 0x99, 0x41, 0x98, 0x41, 0xca, 0x23, 0x8e, 0x83, 0x1a,
+ 0x82, 0xff, 0x3d, 0x00, 0x2b, 0xb2, 0x54, 0xdb, 0x01, 0x29, 0xb3, 0x28, 0xb8, 0x23, 0xbe, 0x42,
+ 0xaa, 0x02, 0x1b, 0x92, 0x42, 0x0b, 0xa6, 0x7b, 0xa1, 0x20, 0x99, 0x92, 0x8a, 0xad, 0x12, 0xaa,
+ 0x39, 0x04, 0x22, 0xef, 0x12, 0x19, 0x02, 0x90, 0x0d, 0x84, 0x28, 0xbc, 0x13, 0x5b, 0xb2, 0x48,
+ 0xb9, 0x12, 0x19, 0xa0, 0xbb, 0x51, 0x09, 0xb4, 0x9f, 0x10, 0x83, 0x4a, 0xe8, 0x42, 0xa9, 0x83,
+ 0x19, 0xa8, 0x16, 0x1c, 0x83, 0xab, 0x99, 0x72, 0xd2, 0x0d, 0x92, 0x41, 0xc9, 0x11, 0x8a, 0x10,
+ 0x05, 0xae, 0x81, 0x50, 0xb1, 0x0b, 0x13, 0x89, 0x80, 0x28, 0xc1, 0x18, 0x35, 0xfc, 0x21, 0x9a,
+ 0x82, 0x49, 0xc0, 0x30, 0x18, 0xb3, 0x1f, 0x14, 0x99, 0x88, 0x09, 0x90, 0x19, 0xbc, 0x88, 0x73,
+ 0xd3, 0x18, 0x8a, 0x94, 0x49, 0xc1, 0x19, 0x09, 0x92, 0x19, 0xab, 0x10, 0x09, 0xa0, 0x2a, 0x77,
+ 0xa0, 0x00, 0x22, 0xfb, 0x20, 0x88, 0x93, 0x1e, 0x93, 0x8b, 0x34, 0xa8, 0x89, 0x20, 0x91, 0xa0,
+ 0x4b, 0xf0, 0x48, 0xb8, 0x10, 0x21, 0x90, 0x85, 0x8e, 0xa2, 0x0b, 0x82, 0xcd, 0x30, 0x90, 0x22,
+ 0x40, 0x25, 0xa8, 0x58, 0xb1, 0x8b, 0x10, 0xb2, 0xae, 0x29, 0x84, 0x4a, 0xe0, 0x18, 0x80, 0x01,
+ 0x11, 0xcc, 0x43, 0x89, 0x23, 0xfa, 0x3b, 0xa2, 0x09, 0x9b, 0xb2, 0x7d, 0x84, 0xaa, 0x20, 0xa0,
+ 0x81, 0x8f, 0x84, 0x59, 0xe0, 0x39, 0x85, 0xac, 0x44, 0xcb, 0x21, 0x88, 0x80, 0x32, 0xfa, 0x10,
+ 0x8a, 0x92, 0x2b, 0x81, 0x22, 0x42, 0xf9, 0x31, 0xdb, 0x00, 0x2a, 0xa2, 0x30, 0xb0, 0x41, 0xb8,
+ 0x18, 0x31, 0xf9, 0x5b, 0x83, 0x08, 0x9a, 0x91, 0x0a, 0xa8, 0x44, 0xca, 0x28, 0x33, 0x98, 0x08,
+ 0xdc, 0x19, 0xa0, 0x28, 0x33, 0xf9, 0x5a, 0xb0, 0x12, 0x9e, 0x12, 0x18, 0x18, 0xa6, 0x1e, 0xa4,
+ 0x4b, 0xf9, 0x43, 0x00, 0x13, 0x9d, 0x82, 0x18, 0x80, 0x82, 0x1a, 0xc1, 0x28, 0x98, 0x13, 0xac,
+ 0x81, 0x09, 0x18, 0xd0, 0x59, 0xa2, 0x1a, 0x81, 0x9a, 0x15, 0x0a, 0xa3, 0x3c, 0x01, 0x14, 0xca,
+ 0x9f, 0x14, 0x9b, 0x80, 0x31, 0xaa, 0x17, 0x1c, 0xb3, 0x3a, 0x91, 0xa8, 0x4b, 0xd2, 0x1c, 0x21,
+ 0x13, 0xae, 0x12, 0x09, 0x95, 0x1d, 0xa2, 0x50, 0x98, 0x84, 0x8d, 0x82, 0x8a, 0x08, 0x81, 0x18,
+ 0x11, 0x90, 0x8c, 0x44, 0x99, 0x00, 0x0b, 0xc1, 0x3a, 0xeb, 0x22, 0x0c, 0x86, 0x89, 0x08, 0x23,
+ 0xca, 0x30, 0xc0, 0x31, 0xab, 0xb3, 0x79, 0xc4, 0x30, 0x19, 0xc2, 0x2a, 0xb9, 0x26, 0x8c, 0x82,
+ 0x1b, 0x01, 0x88, 0xb1, 0x3b, 0xd2, 0x31, 0x8e, 0x87, 0x0a, 0xc0, 0x08, 0x8a, 0x03, 0x38, 0x00,
+ 0x06, 0x28, 0xa0, 0x90, 0x9a, 0xeb, 0x80, 0x0c, 0x02, 0x42, 0x0a, 0xb4, 0x78, 0x99, 0x82, 0x5b,
+ 0xc1, 0x11, 0x8d, 0x92, 0x3b, 0xa1, 0x20, 0x09, 0x12, 0x01, 0x22, 0xad, 0x95, 0x6c, 0xd0, 0x41,
+ 0x8b, 0x94, 0x3c, 0xc1, 0x38, 0x99, 0x13, 0x0b, 0x92, 0x29, 0xe0, 0x29, 0xd9, 0x43, 0x8c, 0x87,
+ 0x2b, 0xc1, 0x30, 0x9a, 0x83, 0x1b, 0xb2, 0x2b, 0xa1, 0x41, 0xa9, 0x36, 0x8b, 0x87, 0x2c, 0xd1,
+ 0x30, 0x9b, 0x04, 0x1a, 0xb1, 0x21, 0x9b, 0xa3, 0x2a, 0x91, 0x28, 0x97, 0x5b, 0xe2, 0x28, 0xa9,
+ 0x04, 0x3b, 0xc2, 0x32, 0x8e, 0xa2, 0x3a, 0xb1, 0x10, 0x30, 0x83, 0x92, 0x0e, 0xb8, 0x01, 0x69,
+ 0xd0, 0x32, 0x8e, 0xa4, 0x3b, 0xd0, 0x31, 0x0b, 0x04, 0x20, 0x99, 0xa2, 0x2a, 0xc9, 0x82, 0x0a,
+ 0x8a, 0xb5, 0x7b, 0xd3, 0x11, 0x8b, 0x86, 0x29, 0x9a, 0x91, 0x3b, 0xb0, 0x45, 0x9a, 0x91, 0x29,
+ 0x10, 0xf0, 0x19, 0x18, 0x03, 0x44, 0x0c, 0xf3, 0x3b, 0xd0, 0x31, 0x9c, 0x85, 0x1a, 0xa1, 0x28,
+ 0x5e, 0x01, 0x28, 0x00, 0x99, 0x18, 0x43, 0x92, 0x19, 0xad, 0x15, 0x2c, 0xd3, 0x61, 0xb8, 0x12,
+ 0x8c, 0xa2, 0x29, 0x99, 0x00, 0x38, 0x03, 0x8b, 0x06, 0x2e, 0xe3, 0x3a, 0xc0, 0x22, 0x9e, 0x82,
+ 0x48, 0xb0, 0x19, 0x9a, 0x02, 0x8b, 0x12, 0x2b, 0x07, 0x61, 0xa0, 0x25, 0x99, 0xa2, 0x8b, 0xaf,
+ 0x02, 0x0c, 0x91, 0x28, 0x80, 0x91, 0x48, 0x02, 0x80, 0xab, 0x10, 0x54, 0x93, 0xaf, 0xd0, 0x1c,
+ 0xa1, 0x62, 0x98, 0x03, 0x38, 0x92, 0x02, 0xbf, 0x99, 0x0a, 0x98, 0x08, 0x35, 0x32, 0xa0, 0x52,
+ 0xbb, 0x94, 0x0e, 0xb8, 0x20, 0x9b, 0x04, 0x22, 0xef, 0x77, 0xcd, 0x54, 0xca, 0x40, 0xb0, 0x28,
+ 0x90, 0x08, 0x10, 0xb8, 0x38, 0x92, 0x8d, 0x05, 0x8c, 0x04, 0x8b, 0x82, 0x89, 0x38, 0xe2, 0x4a,
+ 0xc2, 0x28, 0x80, 0x00, 0x89, 0x99, 0x22, 0x18, 0xb3, 0x0d, 0x92, 0x8b, 0x16, 0xbb, 0x31, 0xbb,
+ 0x62, 0x02, 0xa9, 0x80, 0x9c, 0x82, 0x63, 0xb8, 0x19, 0x99, 0x31, 0x07, 0xab, 0xb1, 0x3c, 0xa3,
+ 0x40, 0xa0, 0xba, 0x63, 0xc9, 0x32, 0xaa, 0x10, 0x10, 0x80, 0x32, 0xfb, 0x60, 0xd0, 0x1a, 0x91,
+ 0x29, 0x92, 0x29, 0xb1, 0x31, 0x81, 0x05, 0x99, 0xd9, 0x9b, 0x53, 0x99, 0x91, 0x1f, 0x82, 0x18,
+ 0x89, 0xa5, 0x1e, 0x15, 0x8a, 0x82, 0xab, 0x88, 0x29, 0x04, 0x08, 0x08, 0xb9, 0x56, 0xb8, 0x81,
+ 0x9c, 0x90, 0x50, 0x02, 0x20, 0xa2, 0x2c, 0x92, 0x12, 0xcf, 0x84, 0x0c, 0x81, 0x10, 0xaa, 0x94,
+ 0x0c, 0x04, 0x80, 0xa9, 0x80, 0x1a, 0x13, 0xaa, 0xf8, 0x1c, 0xa3, 0x68, 0x82, 0x18, 0x01, 0x1a,
+ 0x86, 0x99, 0x99, 0x93, 0x2e, 0x95, 0x29, 0xb9, 0x01, 0x71, 0xc1, 0x19, 0xb9, 0x0a, 0x27, 0xaa,
+ 0x81, 0x08, 0x90, 0x18, 0x41, 0xe0, 0x9c, 0x21, 0x22, 0xd0, 0x2a, 0xc0, 0x51, 0xb8, 0x80, 0x38,
+ 0xff, 0x01, 0x28, 0x00, 0x8a, 0xb8, 0x72, 0x81, 0xe8, 0x29, 0x81, 0x80, 0x1a, 0x83, 0x80, 0xa9,
+ 0x31, 0xa5, 0x1d, 0x02, 0x13, 0xef, 0x12, 0x89, 0x08, 0xb1, 0x1c, 0x93, 0x89, 0x38, 0xf4, 0x5a,
+ 0xa1, 0x19, 0xa8, 0x21, 0xe9, 0x48, 0xa2, 0x0a, 0x11, 0xa8, 0x44, 0xd9, 0x28, 0xa9, 0x3a, 0x85,
+ 0x58, 0xd1, 0x29, 0x90, 0x90, 0x11, 0xbb, 0x25, 0x09, 0x82, 0xa0, 0x4b, 0xf0, 0x1d, 0x81, 0x80,
+ 0x10, 0x88, 0x02, 0x9b, 0x12, 0x84, 0x8f, 0x03, 0x09, 0x98, 0xa2, 0x4a, 0xd8, 0x10, 0x9a, 0x00,
+ 0x03, 0x2e, 0xa5, 0x58, 0x91, 0x89, 0x32, 0xec, 0x21, 0xab, 0x34, 0xb9, 0x40, 0xb1, 0x09, 0x19,
+ 0xa1, 0x73, 0xc0, 0x12, 0x38, 0xe3, 0x1a, 0xc9, 0x89, 0x30, 0xa1, 0x20, 0x30, 0x43, 0x95, 0x0d,
+ 0x04, 0x99, 0x98, 0xac, 0xb0, 0x0f, 0xd2, 0x3a, 0xc8, 0x41, 0x28, 0x03, 0x51, 0x80, 0x83, 0x8e,
+ 0x90, 0x8a, 0xb8, 0x0d, 0x14, 0x20, 0x81, 0x15, 0x0a, 0xd8, 0x60, 0xa9, 0x91, 0x1c, 0xb0, 0x28,
+ 0xb8, 0x88, 0x51, 0x28, 0x94, 0x2a, 0x23, 0xb2, 0x79, 0xe1, 0x00, 0xaa, 0xc9, 0x3a, 0xa8, 0x22,
+ 0x50, 0x13, 0x16, 0x89, 0xb9, 0x39, 0xb9, 0x18, 0xcb, 0x38, 0xf0, 0x4a, 0xb9, 0x32, 0x31, 0x91,
+ 0x47, 0x9b, 0x80, 0xa9, 0x1c, 0x94, 0x2b, 0x84, 0x31, 0x91, 0xae, 0x14, 0x0d, 0x03, 0x9a, 0x18,
+ 0xd3, 0x5a, 0xd8, 0x28, 0x99, 0x91, 0x08, 0x19, 0x24, 0x80, 0x2a, 0xa5, 0x0b, 0xcd, 0x22, 0x55,
+ 0xf9, 0x39, 0x08, 0x05, 0x9c, 0x01, 0x42, 0xc9, 0x0b, 0x21, 0x90, 0x0a, 0xb1, 0x0d, 0x04, 0x89,
+ 0xcb, 0x71, 0x13, 0x08, 0xa1, 0x1a, 0xf8, 0x28, 0xeb, 0x08, 0x40, 0xe9, 0x10, 0x09, 0x07, 0x0b,
+ 0x12, 0x22, 0x80, 0x18, 0x94, 0x8f, 0x94, 0x8f, 0x81, 0x18, 0xb9, 0x31, 0x28, 0x93, 0x09, 0x8c,
+ 0x5a, 0x04, 0x2e, 0x00, 0xf1, 0x2e, 0x83, 0x88, 0x98, 0x89, 0x91, 0x3a, 0x87, 0xaa, 0x09, 0x25,
+ 0xaa, 0x81, 0x7a, 0x85, 0x9b, 0x82, 0x8a, 0x90, 0x8d, 0x26, 0x9a, 0x81, 0x3a, 0xa6, 0x9c, 0x01,
+ 0x18, 0x83, 0x2a, 0x93, 0x0e, 0x34, 0xd8, 0x1a, 0xc0, 0x30, 0x02, 0xf0, 0x4b, 0x94, 0x19, 0xaa,
+ 0x43, 0xba, 0x31, 0xdb, 0x20, 0x98, 0x89, 0x30, 0x82, 0xfa, 0x5b, 0xa3, 0x3a, 0x01, 0x24, 0xdc,
+ 0x18, 0x83, 0x88, 0xbd, 0x45, 0xa8, 0x01, 0x09, 0x91, 0x10, 0x20, 0xd0, 0x8a, 0xac, 0x12, 0xab,
+ 0x89, 0x63, 0x80, 0xa9, 0x31, 0x98, 0x14, 0xaa, 0x08, 0x00, 0x10, 0xba, 0x75, 0x83, 0x89, 0xca,
+ 0x77, 0xb8, 0x20, 0x8a, 0xb2, 0x2e, 0xa3, 0x38, 0xb8, 0x13, 0x9e, 0xb8, 0x28, 0xb8, 0x51, 0xa1,
+ 0x8a, 0x23, 0xa8, 0xbd, 0x48, 0x04, 0x38, 0x94, 0x1a, 0x93, 0xbc, 0x11, 0x8b, 0x27, 0x38, 0x94,
+ 0x30, 0xcd, 0x32, 0xb9, 0xbb, 0x23, 0xac, 0xa1, 0xae, 0x19, 0x14, 0x11, 0xc9, 0x89, 0x75, 0xa1,
+ 0x19, 0xba, 0x31, 0x90, 0x38, 0x84, 0x10, 0xca, 0x33, 0xdf, 0x10, 0x82, 0x18, 0x80, 0x20, 0xb8,
+ 0x0b, 0xc2, 0x1c, 0x07, 0x00, 0xa8, 0xa9, 0x2a, 0xf0, 0x38, 0xa9, 0x53, 0x22, 0xc8, 0x88, 0x0a,
+ 0x23, 0x18, 0x11, 0x15, 0xac, 0x10, 0x89, 0x99, 0x43, 0xf9, 0xbe, 0x28, 0xa2, 0x50, 0xa0, 0x40,
+ 0xb8, 0xfa, 0x4c, 0xb2, 0x47, 0xaf, 0x25, 0x89, 0xb4, 0x1c, 0xda, 0x42, 0x9a, 0x17, 0x9b, 0x92,
+ 0x39, 0x92, 0xc8, 0x8f, 0x33, 0x10, 0xa1, 0xac, 0x10, 0x10, 0x87, 0x8d, 0x92, 0x5b, 0x92, 0x08,
+ 0xac, 0x81, 0x69, 0x93, 0x09, 0xa8, 0x88, 0x70, 0xa3, 0x8f, 0x82, 0x2a, 0x84, 0x0a, 0xb9, 0x41,
+ 0x89, 0x03, 0xab, 0x99, 0x32, 0x25, 0xbd, 0x02, 0x0f, 0x04, 0x11, 0xdb, 0x02, 0x1c, 0x85, 0x1a,
+ 0xc8, 0xed, 0x50, 0x00, 0x1c, 0x85, 0x88, 0x80, 0x98, 0x28, 0x02, 0xc8, 0x40, 0xe9, 0x30, 0x11,
+ 0xd9, 0x08, 0x9b, 0x27, 0x0a, 0xc2, 0x39, 0xa0, 0x12, 0x0c, 0x94, 0x8c, 0x11, 0x02, 0x18, 0xfa,
+ 0x1b, 0x44, 0xc0, 0x09, 0x89, 0x14, 0x2a, 0xe3, 0x2c, 0x02, 0x08, 0x08, 0xd1, 0x3b, 0x85, 0x1b,
+ 0x91, 0x8d, 0x12, 0x89, 0x22, 0xdb, 0x38, 0x84, 0x29, 0xb3, 0x0f, 0x02, 0x98, 0x00, 0xa8, 0x08,
+ 0x18, 0x25, 0xab, 0x81, 0xae, 0x60, 0x84, 0x8e, 0x13, 0x8d, 0x14, 0x9b, 0x81, 0x09, 0x08, 0x33,
+ 0xbd, 0x22, 0x9a, 0x25, 0xa8, 0xab, 0x22, 0x49, 0x95, 0x8b, 0xa0, 0x62, 0xa8, 0x18, 0xba, 0x28,
+ 0x99, 0x32, 0x81, 0x9d, 0x47, 0xba, 0x80, 0xa9, 0x09, 0x37, 0xb9, 0x20, 0x88, 0x32, 0xc1, 0x9c,
+ 0x90, 0x09, 0x47, 0xb8, 0x28, 0xb8, 0x89, 0x30, 0xee, 0x58, 0x91, 0x00, 0x01, 0xa8, 0x29, 0xa1,
+ 0x29, 0xe8, 0x38, 0x13, 0xda, 0x48, 0xa2, 0x38, 0xd8, 0x0a, 0x18, 0x91, 0x39, 0x04, 0xba, 0x21,
+ 0xb0, 0x30, 0xb8, 0xc9, 0x0c, 0x77, 0xa1, 0x1a, 0x91, 0xcb, 0x0a, 0x92, 0x49, 0x83, 0x32, 0x0a,
+ 0x87, 0x8d, 0xa2, 0x8d, 0x10, 0x04, 0x28, 0xa3, 0x8b, 0x11, 0xd9, 0x8a, 0x10, 0x89, 0x24, 0x08,
+ 0x06, 0x8b, 0xb0, 0x3a, 0xc1, 0x0a, 0x47, 0xb1, 0x0a, 0x98, 0x80, 0xad, 0x08, 0x2a, 0x67, 0xa8,
+ 0x38, 0x92, 0x19, 0xc8, 0xa9, 0x49, 0xd3, 0x2c, 0x82, 0x30, 0x80, 0x88, 0xc9, 0x4b, 0x87, 0x8b,
+ 0xab, 0x44, 0x09, 0xb4, 0x3b, 0x92, 0x03, 0xbf, 0x04, 0x0a, 0x88, 0x26, 0x8c, 0x92, 0x1c, 0x82,
+ 0x10, 0x9b, 0x94, 0x7a, 0xc2, 0x1a, 0x98, 0x21, 0x8b, 0x05, 0x99, 0x21, 0x82, 0x18, 0xd8, 0x8a,
+ 0x02, 0x29, 0xa4, 0xbf, 0x30, 0x83, 0x8b, 0xc0, 0x2a, 0x91, 0x40, 0x41, 0x84, 0x0a, 0x23, 0x90,
+ 0x50, 0x05, 0x31, 0x00, 0x7b, 0xe1, 0x39, 0xa0, 0x19, 0x10, 0xb8, 0x29, 0x0a, 0xa5, 0x1e, 0xb1,
+ 0x68, 0x01, 0x03, 0x9c, 0x12, 0xac, 0x22, 0xb9, 0x29, 0x23, 0xb0, 0x1d, 0xe2, 0x4b, 0x94, 0x19,
+ 0xea, 0x30, 0x11, 0x92, 0x9d, 0x20, 0x03, 0xaa, 0x9c, 0x03, 0x3b, 0x87, 0x1d, 0x92, 0x19, 0xa9,
+ 0x22, 0xcb, 0x18, 0x43, 0x02, 0x29, 0xd0, 0x5a, 0xd1, 0x2a, 0xa0, 0x71, 0x91, 0x0a, 0x82, 0x8a,
+ 0xe8, 0x0c, 0x12, 0x21, 0xaa, 0x33, 0x1b, 0x97, 0x0c, 0xb1, 0x40, 0x88, 0x32, 0x10, 0xf9, 0x8a,
+ 0x30, 0x04, 0xbc, 0x0b, 0x27, 0xa9, 0xb8, 0x3a, 0xa3, 0x89, 0x39, 0x26, 0x22, 0x89, 0x37, 0xba,
+ 0xb0, 0x0b, 0x00, 0xd0, 0x8f, 0x02, 0x18, 0xc8, 0x08, 0x41, 0xa1, 0x1b, 0x14, 0x43, 0xa0, 0x18,
+ 0x04, 0x9e, 0x90, 0x8a, 0x91, 0x9b, 0x88, 0x22, 0xa8, 0xba, 0x6a, 0x17, 0xca, 0x42, 0x91, 0x32,
+ 0xb9, 0x21, 0xb9, 0xfa, 0x0a, 0x02, 0xb9, 0x9d, 0x21, 0x01, 0x90, 0xcb, 0x48, 0x03, 0x72, 0x91,
+ 0x63, 0xb9, 0x31, 0x90, 0xc8, 0x9a, 0xac, 0x15, 0xba, 0x21, 0x92, 0xac, 0xb9, 0x61, 0xb8, 0x21,
+ 0x20, 0x27, 0x02, 0x9b, 0xd0, 0x3a, 0x06, 0x80, 0x89, 0xa9, 0x41, 0xd0, 0xbb, 0x0a, 0x88, 0x21,
+ 0x88, 0x90, 0x73, 0x86, 0xa9, 0x18, 0x33, 0x22, 0x88, 0x0a, 0x44, 0xc0, 0xbb, 0xdc, 0x58, 0x92,
+ 0x90, 0xaf, 0x11, 0x00, 0xa8, 0x9a, 0x29, 0x26, 0x21, 0xa1, 0x48, 0x35, 0x92, 0xba, 0xbb, 0x08,
+ 0xfb, 0x18, 0xca, 0x29, 0xa8, 0x00, 0xac, 0x00, 0x30, 0x01, 0x66, 0x02, 0x53, 0x81, 0x98, 0x98,
+ 0x08, 0xb1, 0xcf, 0x99, 0x28, 0xb8, 0xca, 0x9d, 0x21, 0x52, 0x02, 0x18, 0x21, 0x35, 0x80, 0xa9,
+ 0x0b, 0x22, 0x10, 0xda, 0x8a, 0x99, 0xfb, 0xac, 0x9b, 0x44, 0x9a, 0x11, 0x1c, 0x17, 0x08, 0x90,
+ 0x54, 0x00, 0x21, 0x00, 0x22, 0x32, 0xa2, 0xab, 0xbe, 0x08, 0xaa, 0x91, 0xbf, 0x18, 0x11, 0xa8,
+ 0xbd, 0x1b, 0x33, 0x46, 0x81, 0x31, 0x21, 0x14, 0x11, 0xc8, 0x48, 0x90, 0x10, 0xca, 0xbd, 0x88,
+ 0xca, 0xaa, 0x8b, 0x89, 0x24, 0x69, 0x84, 0x58, 0xa2, 0x9a, 0x09, 0x42, 0x02, 0xbd, 0x09, 0x48,
+ 0x06, 0xa9, 0xca, 0x89, 0x01, 0x90, 0xd9, 0x1b, 0x35, 0x24, 0x11, 0x91, 0x59, 0x12, 0x12, 0x08,
+ 0xf2, 0x0b, 0xc0, 0x99, 0xce, 0x18, 0xb9, 0x1a, 0x92, 0x38, 0x33, 0x34, 0x67, 0x81, 0x10, 0xca,
+ 0x88, 0x08, 0x80, 0xf8, 0x8c, 0x81, 0x09, 0x82, 0x21, 0x8b, 0x37, 0x74, 0x67, 0x89, 0xba, 0x0a,
+ 0xaa, 0x08, 0xab, 0x82, 0x09, 0x30, 0x26, 0x62, 0x01, 0x12, 0x89, 0x84, 0x8b, 0x12, 0x11, 0x02,
+ 0xab, 0x92, 0x0c, 0xd1, 0x9a, 0xbf, 0x01, 0x28, 0x04, 0x89, 0xeb, 0x89, 0xaa, 0xa8, 0x8b, 0xb9,
+ 0x11, 0x08, 0x14, 0xca, 0x30, 0x37, 0x22, 0x25, 0x31, 0x24, 0x18, 0x10, 0x11, 0xa8, 0xac, 0xbc,
+ 0x99, 0xcb, 0x8a, 0x89, 0x80, 0x68, 0x26, 0x99, 0x89, 0x00, 0xa9, 0xb9, 0xec, 0xbe, 0x8a, 0x19,
+ 0x81, 0x1a, 0x01, 0x53, 0x01, 0x01, 0x40, 0x24, 0x90, 0x99, 0xa1, 0x78, 0x16, 0x12, 0x90, 0x11,
+ 0x80, 0x01, 0xcf, 0x88, 0xbb, 0xa1, 0x9f, 0x98, 0x8c, 0x12, 0x52, 0x01, 0x43, 0x80, 0x12, 0x08,
+ 0x14, 0x98, 0x08, 0xa0, 0x5b, 0x85, 0x8c, 0x90, 0x89, 0x09, 0xc0, 0x9d, 0x08, 0x34, 0x52, 0x92,
+ 0xaa, 0x18, 0xb1, 0xba, 0x8c, 0xfa, 0x38, 0xdb, 0x02, 0xaf, 0xa0, 0x2c, 0xa1, 0x38, 0x80, 0x11,
+ 0x73, 0x93, 0x31, 0xa8, 0x90, 0x1c, 0x26, 0x52, 0x82, 0x89, 0x99, 0x92, 0x9f, 0xc8, 0x1b, 0x91,
+ 0x98, 0x49, 0x84, 0x73, 0x03, 0x12, 0x9b, 0xd9, 0x40, 0x91, 0x00, 0xea, 0xab, 0x8a, 0xaa, 0x98,
+ 0x3b, 0xfe, 0x17, 0x00, 0x09, 0x21, 0x41, 0x47, 0x01, 0x31, 0x02, 0x18, 0x93, 0x9f, 0x90, 0x8b,
+ 0xa8, 0x11, 0xff, 0x08, 0x10, 0x10, 0x11, 0x88, 0x02, 0x00, 0xcb, 0x88, 0x2b, 0x47, 0x80, 0x08,
+ 0xb9, 0x9a, 0xb9, 0x72, 0x82, 0xa9, 0x0a, 0x60, 0x84, 0x8b, 0xb2, 0x3d, 0x17, 0x08, 0x80, 0x9a,
+ 0x18, 0x18, 0x84, 0x8d, 0x01, 0x08, 0x09, 0xfa, 0x8c, 0xaa, 0x11, 0x19, 0xb3, 0x4c, 0x02, 0x24,
+ 0x48, 0xa5, 0x19, 0xda, 0x42, 0x11, 0x82, 0x9a, 0x09, 0xc1, 0x8d, 0xa2, 0xcb, 0x9d, 0x92, 0xac,
+ 0x80, 0x64, 0x21, 0x15, 0x88, 0x91, 0x8b, 0x21, 0xa1, 0xad, 0xdb, 0x09, 0x8b, 0x17, 0x89, 0x89,
+ 0x02, 0x8e, 0x04, 0x29, 0x01, 0x32, 0x51, 0xa3, 0x0c, 0xb8, 0x02, 0x9f, 0x91, 0x0c, 0xa1, 0x38,
+ 0x02, 0x91, 0x0e, 0x13, 0x18, 0x20, 0xe1, 0x1c, 0x84, 0xba, 0x21, 0xfa, 0x39, 0x92, 0x42, 0xcb,
+ 0x80, 0x1c, 0x15, 0x80, 0x00, 0x83, 0x0b, 0xa9, 0x23, 0x78, 0x96, 0x00, 0xad, 0xa8, 0x0d, 0x88,
+ 0x51, 0x81, 0x00, 0x89, 0xa0, 0x71, 0xf9, 0x34, 0xaf, 0x03, 0x3c, 0xb0, 0x27, 0x0e, 0x94, 0x4b,
+ 0xd0, 0x22, 0x8c, 0x93, 0x4b, 0xc8, 0x13, 0x0d, 0xa3, 0x4a, 0xb8, 0x13, 0x1c, 0xc3, 0x49, 0xa9,
+ 0x03, 0x0c, 0x92, 0x18, 0x88, 0xa2, 0x6b, 0xa0, 0x41, 0x9a, 0x83, 0x3b, 0xa1, 0x22, 0x8e, 0x93,
+ 0x1d, 0x91, 0x38, 0x98, 0x90, 0x2a, 0xe9, 0x31, 0xbc, 0x05, 0x0b, 0xa4, 0x39, 0xb9, 0x23, 0x8c,
+ 0xd3, 0x49, 0xa0, 0x21, 0x8a, 0x01, 0x22, 0x8a, 0x86, 0x1b, 0x94, 0x29, 0xa0, 0x08, 0x8b, 0x04,
+ 0x41, 0xeb, 0x28, 0x43, 0xb8, 0x98, 0x1c, 0xa1, 0x64, 0xca, 0x89, 0x2a, 0xa2, 0x28, 0xb8, 0x90,
+ 0x9c, 0x34, 0x91, 0xbb, 0xae, 0x45, 0x00, 0x22, 0x21, 0xc1, 0xbb, 0x0c, 0x24, 0x09, 0x00, 0x62,
+ 0x79, 0x00, 0x1e, 0x00, 0xba, 0xaa, 0x9c, 0x23, 0xba, 0x51, 0x24, 0xa9, 0x31, 0x10, 0x92, 0x9e,
+ 0xbb, 0x9b, 0xeb, 0x0a, 0x34, 0xa9, 0x99, 0xeb, 0x59, 0x24, 0x32, 0xd9, 0x18, 0xa9, 0x52, 0x82,
+ 0x0a, 0x43, 0xb9, 0x88, 0xba, 0x32, 0xfb, 0x1a, 0x34, 0xb0, 0xae, 0x99, 0x89, 0x72, 0x82, 0x99,
+ 0xac, 0x31, 0x44, 0x12, 0x01, 0x1a, 0x34, 0xb1, 0xff, 0x89, 0x19, 0x02, 0x21, 0x98, 0x81, 0x38,
+ 0xa8, 0x04, 0xdf, 0x80, 0x48, 0x83, 0x20, 0xc9, 0x08, 0x31, 0xd1, 0x0a, 0xc8, 0x9b, 0x31, 0x54,
+ 0x12, 0xc9, 0x8d, 0x12, 0x20, 0xa2, 0x40, 0x91, 0x80, 0xbe, 0x99, 0x90, 0x78, 0x04, 0x8a, 0x91,
+ 0x8d, 0x10, 0x00, 0x01, 0x08, 0x46, 0xa8, 0x98, 0xac, 0x08, 0x18, 0x31, 0x34, 0x23, 0x98, 0x11,
+ 0x90, 0xde, 0x09, 0xeb, 0x19, 0x20, 0x44, 0xa1, 0xbd, 0x21, 0x99, 0x02, 0x40, 0x13, 0x33, 0xca,
+ 0xdb, 0x49, 0x83, 0x11, 0x51, 0xb1, 0x50, 0x98, 0x01, 0xa9, 0x0a, 0xc0, 0x0a, 0xfb, 0x18, 0xb0,
+ 0x8c, 0x13, 0xae, 0x22, 0x76, 0xc8, 0x3a, 0xa2, 0x89, 0xbe, 0x80, 0xab, 0x22, 0x18, 0x14, 0x0b,
+ 0x67, 0x99, 0x22, 0xaa, 0x01, 0xc9, 0x3a, 0xa2, 0x2c, 0x44, 0xa0, 0x3a, 0xa1, 0x38, 0xa9, 0xa2,
+ 0x8c, 0x13, 0x18, 0x55, 0xf8, 0x1a, 0x91, 0x19, 0x91, 0x99, 0x99, 0x08, 0x88, 0xa0, 0xbd, 0x39,
+ 0x27, 0x18, 0x12, 0x32, 0xa0, 0x40, 0x82, 0x38, 0x26, 0x99, 0x44, 0x00, 0x32, 0xa1, 0x41, 0x43,
+ 0x03, 0x8b, 0xfa, 0x0b, 0x11, 0x00, 0xea, 0x9d, 0x31, 0x81, 0x10, 0x80, 0x08, 0x08, 0xa9, 0x08,
+ 0xc8, 0xbd, 0x28, 0xfb, 0x71, 0x91, 0xd9, 0xad, 0x80, 0x1a, 0x83, 0x1b, 0x81, 0x80, 0x9e, 0x22,
+ 0x89, 0x11, 0x32, 0xb3, 0xaf, 0x90, 0xcc, 0x0b, 0x36, 0xb1, 0xbc, 0x9a, 0x9b, 0x11, 0x38, 0xb3,
+ 0x6d, 0xff, 0x0a, 0x00, 0x45, 0x90, 0x72, 0x15, 0x89, 0x88, 0xbb, 0x00, 0xde, 0x09, 0x89, 0x53,
+ 0x32, 0xb8, 0x31, 0xaa, 0x17, 0xcb, 0xda, 0x9c, 0x18, 0x35, 0x33, 0x12, 0x62, 0x80, 0xc8, 0x9e,
+ 0x08, 0x89, 0x88, 0x20, 0x63, 0x25, 0x90, 0x09, 0x88, 0x20, 0x98, 0xfb, 0x8b, 0x33, 0x02, 0xb8,
+ 0xbd, 0x9a, 0xc9, 0x8b, 0xda, 0x1b, 0x64, 0x04, 0x88, 0x00, 0x31, 0x02, 0xda, 0x9c, 0x08, 0x29,
+ 0x02, 0x11, 0x52, 0x35, 0x90, 0x8b, 0x41, 0x02, 0xcc, 0xba, 0x9d, 0x00, 0x10, 0x88, 0x99, 0xa9,
+ 0x0a, 0x94, 0xef, 0xba, 0x38, 0x13, 0x08, 0x10, 0x73, 0x02, 0x9a, 0x28, 0x81, 0x73, 0x06, 0x88,
+ 0x10, 0xb0, 0xbe, 0x0a, 0x20, 0x23, 0xeb, 0x40, 0x11, 0x91, 0xad, 0xa9, 0x8b, 0x23, 0x80, 0xb8,
+ 0xfb, 0xac, 0x18, 0x11, 0x00, 0x63, 0x44, 0x23, 0xba, 0x9c, 0x81, 0x60, 0x04, 0x89, 0x11, 0xc0,
+ 0x9d, 0x31, 0x80, 0x00, 0xea, 0x39, 0x16, 0x80, 0xa9, 0xca, 0x0d, 0x25, 0x99, 0x12, 0xaa, 0x41,
+ 0xb1, 0x8e, 0x81, 0x8a, 0x64, 0x81, 0xab, 0x98, 0x9a, 0x12, 0xa9, 0x21, 0x31, 0x32, 0x26, 0xea,
+ 0x2a, 0x23, 0x09, 0x24, 0x89, 0xb8, 0x9e, 0x43, 0x98, 0x09, 0x32, 0xa0, 0x72, 0xa8, 0x20, 0xfd,
+ 0x8a, 0x18, 0x11, 0x20, 0x15, 0xa9, 0x08, 0xea, 0x1a, 0x02, 0x21, 0x01, 0x80, 0x10, 0xf8, 0x1b,
+ 0x84, 0x9b, 0x10, 0xc8, 0x1c, 0x47, 0x80, 0x00, 0xa1, 0xaf, 0x10, 0x00, 0x21, 0xc0, 0x2a, 0x04,
+ 0x09, 0x13, 0xba, 0x48, 0x57, 0xb0, 0xce, 0xaa, 0x89, 0x89, 0x38, 0x46, 0x23, 0x21, 0x23, 0xa8,
+ 0xab, 0xcc, 0x9a, 0xa8, 0x9b, 0x20, 0x18, 0x56, 0x92, 0xa9, 0xcb, 0x99, 0x19, 0x83, 0xad, 0x18,
+ 0x98, 0x53, 0x91, 0x09, 0x22, 0x73, 0x34, 0xa2, 0xad, 0x20, 0x13, 0x9a, 0x33, 0xca, 0x61, 0x82,
+ 0x22, 0x01, 0x1b, 0x00, 0x22, 0xfa, 0x0a, 0x32, 0x80, 0xa9, 0xab, 0xda, 0x8a, 0xf9, 0x0d, 0x03,
+ 0xaa, 0x18, 0x91, 0x38, 0xf3, 0xad, 0x21, 0x13, 0x08, 0x44, 0x02, 0x22, 0xfa, 0x9a, 0x81, 0xba,
+ 0x40, 0x37, 0x80, 0x90, 0x9c, 0x00, 0x99, 0x08, 0x31, 0x81, 0x48, 0xa2, 0x0d, 0x22, 0xc9, 0x39,
+ 0x27, 0x98, 0xa9, 0x48, 0x14, 0xeb, 0xaa, 0x89, 0x10, 0x31, 0x14, 0xca, 0x18, 0x01, 0x8a, 0x01,
+ 0x49, 0x27, 0x01, 0xa1, 0xcd, 0xbb, 0x89, 0x21, 0x34, 0x21, 0x12, 0x31, 0x84, 0x18, 0xfc, 0x9f,
+ 0x00, 0x90, 0x20, 0x81, 0x18, 0x22, 0xa8, 0x0d, 0x01, 0x41, 0x03, 0x9a, 0xa0, 0x8a, 0xcf, 0x32,
+ 0x88, 0x86, 0xad, 0x12, 0x02, 0x0b, 0x37, 0x98, 0x99, 0x21, 0xf9, 0x0b, 0x91, 0x0c, 0x14, 0xb9,
+ 0xbb, 0x10, 0x72, 0x15, 0xa9, 0x98, 0x40, 0xa2, 0xbd, 0x08, 0x12, 0x21, 0x42, 0x86, 0x9d, 0x01,
+ 0xa9, 0x0a, 0x14, 0x9a, 0x21, 0x11, 0xeb, 0x52, 0xc0, 0x0a, 0x80, 0xa9, 0x9b, 0x73, 0x14, 0x99,
+ 0x08, 0x32, 0xa3, 0x40, 0xfa, 0x8d, 0x20, 0x12, 0x00, 0xca, 0x8a, 0x53, 0xb0, 0x1a, 0x20, 0x03,
+ 0x8c, 0x24, 0xfc, 0x09, 0x42, 0x81, 0x18, 0xe9, 0xac, 0x88, 0x28, 0x27, 0x88, 0x01, 0x88, 0x00,
+ 0x21, 0xf9, 0x8e, 0x00, 0x09, 0x22, 0x00, 0x21, 0x23, 0xdb, 0xac, 0x8a, 0x12, 0x89, 0x73, 0x03,
+ 0x10, 0xca, 0x09, 0xeb, 0x18, 0x02, 0x10, 0x01, 0x29, 0xb1, 0x09, 0xba, 0x64, 0x90, 0x22, 0xa9,
+ 0x9b, 0xc9, 0x0b, 0x65, 0x82, 0x9a, 0x33, 0x23, 0xfb, 0x8b, 0xb9, 0x30, 0x14, 0x80, 0xca, 0x8a,
+ 0xb9, 0x71, 0x15, 0x90, 0x09, 0x80, 0x88, 0xa8, 0xde, 0x29, 0x24, 0x00, 0x82, 0xbc, 0x8b, 0x09,
+ 0x32, 0x42, 0x12, 0x18, 0xb0, 0x0c, 0xb1, 0xdf, 0x09, 0x00, 0x52, 0x03, 0x90, 0x89, 0x9a, 0xb9,
+ 0xc8, 0xff, 0x09, 0x00, 0x20, 0x74, 0x24, 0x02, 0x40, 0x13, 0x73, 0x12, 0x81, 0xaa, 0xfb, 0xad,
+ 0xba, 0x9a, 0xdb, 0x89, 0x20, 0x43, 0x21, 0x13, 0x08, 0x88, 0x10, 0xeb, 0x09, 0x41, 0x45, 0x23,
+ 0x81, 0x80, 0x98, 0x89, 0x14, 0xbc, 0x99, 0x50, 0x91, 0x18, 0xc9, 0xdc, 0xcb, 0x9c, 0x9a, 0x20,
+ 0x22, 0x23, 0x10, 0xc9, 0x09, 0xa0, 0x40, 0x47, 0x22, 0x33, 0x33, 0x13, 0xb0, 0xbb, 0x99, 0xdd,
+ 0x0b, 0x35, 0xa0, 0xbd, 0x89, 0x9a, 0x08, 0x98, 0xde, 0x29, 0xa1, 0xdc, 0xbc, 0x20, 0x23, 0x33,
+ 0x33, 0xa2, 0x3a, 0x35, 0x15, 0x98, 0xb0, 0x8f, 0x81, 0x8b, 0x02, 0x18, 0x37, 0xa2, 0x09, 0x51,
+ 0x03, 0xbd, 0x19, 0x22, 0xa0, 0xbc, 0xb9, 0x9b, 0x81, 0xbf, 0xac, 0x99, 0x89, 0x44, 0x63, 0x03,
+ 0xa8, 0xcc, 0x08, 0x88, 0x10, 0x21, 0xc9, 0x38, 0x73, 0x14, 0x10, 0x11, 0x25, 0x00, 0x13, 0x0a,
+ 0xa8, 0x74, 0x91, 0xb9, 0x0a, 0xf8, 0x1a, 0x12, 0x24, 0x33, 0x15, 0xfc, 0xbc, 0xbc, 0x9a, 0x98,
+ 0x40, 0x45, 0x33, 0x12, 0xa0, 0xdb, 0xdb, 0xbc, 0x99, 0x10, 0x20, 0x43, 0x34, 0x34, 0x01, 0x98,
+ 0x08, 0x88, 0xa9, 0x08, 0xa8, 0xaa, 0x30, 0xf8, 0x9d, 0x98, 0x42, 0x90, 0x62, 0x91, 0x9a, 0xab,
+ 0x20, 0xd0, 0x9e, 0x45, 0x98, 0x01, 0xae, 0x22, 0xaa, 0x55, 0xa0, 0x49, 0x14, 0xea, 0x89, 0xba,
+ 0x50, 0x11, 0x23, 0x88, 0xb2, 0xbf, 0x12, 0xbf, 0x50, 0x02, 0x80, 0x11, 0xca, 0x19, 0xb9, 0x9b,
+ 0x55, 0x01, 0x18, 0xd0, 0x2b, 0xa3, 0x0c, 0x02, 0x21, 0x18, 0x06, 0xac, 0x89, 0x00, 0x09, 0x28,
+ 0x06, 0x30, 0xe1, 0x2a, 0xa0, 0x99, 0x29, 0xa2, 0x48, 0x13, 0x88, 0xc8, 0x0b, 0xf9, 0x18, 0xab,
+ 0x36, 0x89, 0x01, 0x32, 0xdf, 0x20, 0x90, 0x10, 0x18, 0x94, 0x2a, 0xe0, 0x1a, 0x02, 0xb8, 0x3b,
+ 0x70, 0xff, 0x1a, 0x00, 0xcf, 0x36, 0xa0, 0x18, 0x89, 0x03, 0x99, 0xa8, 0x30, 0xad, 0x54, 0x99,
+ 0x02, 0x0a, 0x03, 0xa9, 0x08, 0xca, 0x8b, 0x80, 0x30, 0xb2, 0xcf, 0x46, 0x98, 0xa1, 0x8f, 0x82,
+ 0x0b, 0x12, 0xa0, 0x3a, 0x57, 0xb9, 0x1a, 0x81, 0x30, 0x88, 0x80, 0x19, 0x02, 0xc9, 0x2b, 0xc8,
+ 0x60, 0x83, 0xbd, 0x42, 0xb9, 0x91, 0x1c, 0x85, 0x29, 0xb0, 0x38, 0xd8, 0x28, 0x00, 0x80, 0x20,
+ 0xb8, 0xba, 0x3a, 0x27, 0xb0, 0x68, 0x92, 0x9b, 0xa9, 0xbb, 0x9d, 0x98, 0x59, 0x16, 0x88, 0xa8,
+ 0x20, 0x80, 0x82, 0xbc, 0x9b, 0x64, 0x02, 0xb9, 0x18, 0x10, 0x14, 0x53, 0x90, 0x40, 0x25, 0xda,
+ 0x18, 0x98, 0x11, 0xa9, 0x09, 0x11, 0x05, 0xbe, 0xca, 0x4a, 0x04, 0x9a, 0xa8, 0x2a, 0x13, 0xba,
+ 0x1a, 0x12, 0x88, 0xdb, 0x73, 0x91, 0x42, 0x88, 0x22, 0x62, 0xa2, 0x9e, 0x10, 0x31, 0xb0, 0x1a,
+ 0x91, 0x11, 0x90, 0xac, 0x44, 0xbb, 0x44, 0x80, 0x20, 0xa1, 0xcd, 0x1b, 0x15, 0x9b, 0xd9, 0x39,
+ 0xb1, 0x1a, 0xa8, 0x41, 0x13, 0x98, 0xa9, 0x18, 0xb3, 0xef, 0x18, 0x40, 0x83, 0x9b, 0x12, 0x40,
+ 0x85, 0xa9, 0xb9, 0x29, 0x24, 0xb0, 0x8c, 0xa0, 0x51, 0xc8, 0x09, 0xaa, 0x01, 0x4b, 0x17, 0x8b,
+ 0xa0, 0x3b, 0xa2, 0x74, 0xa1, 0x48, 0x81, 0x02, 0xaa, 0xdb, 0x50, 0x91, 0x30, 0x22, 0x91, 0xab,
+ 0xfb, 0x0b, 0x02, 0x11, 0x9c, 0x36, 0x08, 0x33, 0xdc, 0x09, 0xa0, 0xbe, 0x40, 0x11, 0x90, 0xbc,
+ 0x31, 0x43, 0xf9, 0xab, 0x9b, 0x75, 0x91, 0x89, 0x88, 0x32, 0xb1, 0x2a, 0x35, 0xb8, 0x1b, 0xb0,
+ 0xbc, 0x0c, 0x81, 0x73, 0x07, 0x90, 0xba, 0x0a, 0x21, 0xa0, 0xaf, 0x42, 0x82, 0x9a, 0x01, 0x9a,
+ 0x22, 0x9b, 0xc9, 0x2c, 0x15, 0x11, 0xda, 0x50, 0x81, 0x88, 0x9b, 0x22, 0x33, 0x35, 0xe9, 0x8b,
+ 0x0b, 0x00, 0x0d, 0x00, 0x14, 0x18, 0x07, 0xfe, 0x49, 0xa3, 0x72, 0xf0, 0x29, 0xa8, 0x28, 0x13,
+ 0xbb, 0x45, 0x9a, 0x90, 0x8b, 0xba, 0x72, 0x02, 0x98, 0x22, 0xba, 0x00, 0xd9, 0x8e, 0x15, 0x88,
+ 0x00, 0x82, 0x9c, 0x03, 0xda, 0x29, 0x05, 0x19, 0x92, 0xa9, 0x48, 0xe1, 0x1a, 0x81, 0x00, 0x28,
+ 0x92, 0x81, 0x31, 0xfe, 0x29, 0x90, 0x21, 0x88, 0x80, 0x52, 0xa8, 0xcb, 0x0a, 0x31, 0x03, 0x31,
+ 0xa9, 0x83, 0xaf, 0xc9, 0x30, 0x80, 0x25, 0x09, 0x24, 0xda, 0x89, 0xaa, 0x08, 0x41, 0x25, 0x88,
+ 0x08, 0xc9, 0x0b, 0x92, 0x8c, 0x25, 0x09, 0x03, 0x0a, 0xfb, 0x38, 0xc9, 0x51, 0x01, 0x88, 0x80,
+ 0xab, 0x30, 0xc8, 0x0c, 0x35, 0x98, 0x8a, 0x43, 0xc9, 0x31, 0xd9, 0x40, 0x81, 0xbb, 0x0a, 0x10,
+ 0x34, 0xb1, 0x2a, 0x12, 0xc2, 0xaf, 0x81, 0x88, 0x81, 0x42, 0xa0,
+};
@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define CLIPEMPTY_BITS_PER_SAMPLE 4
+#define CLIPEMPTY_SAMPLE_RATE 32000
+#define CLIPEMPTY_SAMPLES 9834
+#define CLIPEMPTY_BYTES 5003
+
+extern const uint8_t clipEmpty[CLIPEMPTY_BYTES];
@@ -0,0 +1,862 @@
+
+#include <stdint.h>
+
+const uint8_t gameBoyStartup[] = {
+ 0x4c, 0x53, 0x4e, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x86, 0x69, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x29, 0xbb, 0x87, 0x89, 0x10, 0x29, 0xb0, 0x1a, 0xc1, 0x32, 0x9d, 0x82,
+ 0x28, 0x99, 0x91, 0x91, 0x91, 0x19, 0x3b, 0x04, 0xb9, 0x19, 0x99, 0xa1, 0x13, 0x2a, 0x90, 0xaa,
+ 0x03, 0x3d, 0xd3, 0x10, 0x08, 0x98, 0x20, 0x92, 0x99, 0x10, 0x10, 0x10, 0x1b, 0xb1, 0x93, 0x40,
+ 0xbb, 0x95, 0x11, 0x1a, 0x90, 0x11, 0x11, 0x0b, 0x93, 0x92, 0x0b, 0x13, 0xab, 0x31, 0xb0, 0x39,
+ 0xc3, 0x28, 0x3a, 0xb3, 0x3b, 0x1a, 0xa1, 0xa1, 0x93, 0x3b, 0xb3, 0x12, 0x3d, 0xb8, 0xb3, 0x6a,
+ 0xb0, 0x81, 0x91, 0x3b, 0x4a, 0xd1, 0x01, 0x00, 0xb8, 0x1b, 0x07, 0x09, 0x09, 0xa0, 0x30, 0xbb,
+ 0x93, 0xb3, 0x39, 0x1c, 0xb2, 0x21, 0x91, 0x9b, 0x09, 0x33, 0xb2, 0x01, 0x1d, 0xc2, 0x04, 0x1e,
+ 0x80, 0x10, 0x88, 0xa0, 0x12, 0xb0, 0x43, 0x1c, 0xb0, 0x39, 0x96, 0x9b, 0x14, 0xcb, 0x33, 0x90,
+ 0x5c, 0x81, 0xb9, 0x89, 0x03, 0xc3, 0x39, 0x02, 0x2d, 0x11, 0x1a, 0x91, 0xa2, 0x19, 0x03, 0x1a,
+ 0x8c, 0x1a, 0xb5, 0x49, 0x90, 0x01, 0x2a, 0xb0, 0x13, 0x0b, 0xb0, 0x43, 0xe9, 0x38, 0x21, 0x99,
+ 0x29, 0xc1, 0x20, 0x9b, 0xb3, 0x0b, 0x05, 0x9b, 0x41, 0x99, 0x93, 0x52, 0x8d, 0xb3, 0x20, 0x5b,
+ 0xb2, 0x99, 0xb5, 0x7a, 0xa9, 0x92, 0xa1, 0x4a, 0x18, 0xb8, 0x12, 0x10, 0x9a, 0xbb, 0xb7, 0x39,
+ 0x69, 0xa2, 0x5a, 0xf8, 0x18, 0x2a, 0x04, 0x90, 0xac, 0x13, 0x8e, 0x83, 0x29, 0xd0, 0x00, 0x73,
+ 0xc1, 0x38, 0x98, 0x89, 0xba, 0x39, 0xe1, 0x5a, 0x04, 0xb1, 0x29, 0xa9, 0x27, 0x9d, 0x13, 0x9d,
+ 0x98, 0x15, 0x18, 0xd1, 0x3b, 0xd1, 0x30, 0x11, 0xb0, 0x9b, 0x89, 0x57, 0x8a, 0x91, 0xab, 0x88,
+ 0x41, 0x22, 0xd8, 0x08, 0x28, 0x30, 0xd3, 0x00, 0xfa, 0x5a, 0x80, 0x80, 0x01, 0x9a, 0x29, 0xbb,
+ 0x4e, 0x00, 0x12, 0x00, 0xfb, 0x81, 0x01, 0x5c, 0x90, 0x90, 0xa4, 0x1e, 0xa2, 0x8b, 0x16, 0xab,
+ 0x42, 0xa9, 0x50, 0xb2, 0x3b, 0x80, 0x0b, 0xa7, 0x4b, 0x10, 0xfb, 0x10, 0x21, 0x9a, 0xa3, 0x43,
+ 0x9d, 0x21, 0x80, 0xc1, 0x8e, 0x81, 0x04, 0x1c, 0xb3, 0x39, 0x9a, 0x80, 0x14, 0xd4, 0x2d, 0xa0,
+ 0x13, 0x5b, 0xb0, 0x88, 0x88, 0x23, 0xeb, 0xa3, 0x22, 0x8c, 0x79, 0x80, 0xa3, 0x3a, 0x8b, 0xb2,
+ 0xc2, 0x9a, 0x3a, 0x03, 0x1d, 0xc0, 0x59, 0x02, 0x12, 0x2e, 0xb2, 0xb1, 0xb7, 0x60, 0x1d, 0xa2,
+ 0x89, 0x39, 0x02, 0xcb, 0x03, 0x3a, 0xa2, 0x10, 0x2f, 0xb4, 0xc2, 0x90, 0x82, 0x3a, 0x09, 0x5a,
+ 0x21, 0xe9, 0xc9, 0x86, 0x18, 0x88, 0x08, 0x0e, 0x82, 0xc3, 0x01, 0x6b, 0xb9, 0x11, 0x2a, 0xa3,
+ 0x38, 0xc8, 0x30, 0x0f, 0x93, 0x1a, 0xa2, 0x50, 0xaa, 0xb1, 0x39, 0xaa, 0x12, 0x95, 0x24, 0x2f,
+ 0xda, 0x02, 0x11, 0x98, 0x29, 0xc1, 0xa1, 0x2a, 0x24, 0x19, 0xf8, 0x6c, 0x90, 0x94, 0x18, 0x9b,
+ 0x83, 0x2b, 0x79, 0x9a, 0xc5, 0x28, 0x90, 0x12, 0x0f, 0xa0, 0x03, 0x1a, 0x30, 0x0a, 0xd4, 0x89,
+ 0x61, 0x92, 0x9c, 0xb0, 0x98, 0x44, 0x1a, 0x1e, 0xa8, 0x03, 0xb5, 0x22, 0x2a, 0x1f, 0xa1, 0xa4,
+ 0x20, 0x1c, 0xaa, 0x00, 0x94, 0x2a, 0xc4, 0x80, 0x78, 0x09, 0x99, 0x98, 0x83, 0xb2, 0x35, 0x8d,
+ 0x9a, 0x14, 0x13, 0x0c, 0x09, 0xe4, 0x09, 0x3a, 0x84, 0xa1, 0x1f, 0x91, 0x92, 0x1a, 0x00, 0xa0,
+ 0xa4, 0x28, 0x2e, 0x94, 0x09, 0x1b, 0x01, 0xc4, 0xa2, 0x2e, 0x92, 0x59, 0x80, 0xc0, 0x00, 0xa3,
+ 0x4e, 0x99, 0x01, 0xc3, 0x68, 0x89, 0xb8, 0x30, 0xb1, 0x01, 0x59, 0xb8, 0x49, 0x10, 0xf1, 0x19,
+ 0x83, 0x09, 0x0d, 0x89, 0x11, 0x93, 0x30, 0x97, 0x38, 0xbf, 0x31, 0xb2, 0xb1, 0x60, 0xba, 0x93,
+ 0xb5, 0xff, 0x2b, 0x00, 0xa5, 0x89, 0x0a, 0xa4, 0x06, 0x2a, 0x0f, 0x8a, 0x87, 0x81, 0x10, 0x0c,
+ 0xb3, 0x2c, 0x40, 0x9a, 0x0d, 0xc4, 0xfe, 0x8b, 0x75, 0x83, 0x90, 0x01, 0x88, 0x88, 0x90, 0xc0,
+ 0xff, 0x80, 0x80, 0x00, 0x80, 0x80, 0x10, 0x70, 0x85, 0x00, 0x88, 0x08, 0x80, 0x09, 0x08, 0xff,
+ 0x08, 0x08, 0x80, 0x00, 0x00, 0x19, 0x78, 0x06, 0x08, 0x08, 0x09, 0x88, 0x18, 0x89, 0xfb, 0x0d,
+ 0x08, 0x08, 0x00, 0x08, 0x08, 0x10, 0x77, 0x80, 0x80, 0x08, 0x88, 0x80, 0x90, 0xf0, 0x0e, 0x88,
+ 0x00, 0x80, 0x80, 0x91, 0x81, 0x67, 0x80, 0x80, 0x08, 0x88, 0x90, 0x80, 0xd0, 0x9f, 0x08, 0x80,
+ 0x08, 0x00, 0x80, 0x00, 0x72, 0x87, 0x80, 0x80, 0x80, 0x88, 0x80, 0x88, 0xef, 0x80, 0x80, 0x80,
+ 0x00, 0x08, 0x10, 0x78, 0x05, 0x80, 0x08, 0x08, 0x08, 0x09, 0x09, 0xfd, 0x0a, 0x08, 0x08, 0x18,
+ 0x08, 0x29, 0x20, 0x77, 0x00, 0x88, 0x80, 0x08, 0x08, 0x98, 0xf0, 0x0e, 0x08, 0x08, 0x08, 0x80,
+ 0x80, 0x91, 0x67, 0x80, 0x80, 0x80, 0x88, 0x80, 0x80, 0xd0, 0x9f, 0x08, 0x80, 0x80, 0x80, 0x80,
+ 0x00, 0x73, 0x87, 0x80, 0x80, 0x08, 0x88, 0x00, 0x98, 0xef, 0x80, 0x80, 0x00, 0x08, 0x80, 0x00,
+ 0x78, 0x86, 0x00, 0x88, 0x80, 0x08, 0x08, 0x19, 0xef, 0x08, 0x08, 0x08, 0x80, 0x00, 0x00, 0x38,
+ 0x67, 0x08, 0x88, 0x08, 0x80, 0x88, 0x08, 0xf9, 0x0e, 0x08, 0x08, 0x00, 0x08, 0x80, 0x81, 0x67,
+ 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0xf0, 0x8e, 0x80, 0x00, 0x80, 0x80, 0x91, 0x81, 0x75, 0x82,
+ 0x80, 0x90, 0x08, 0x80, 0x88, 0xa8, 0xff, 0x80, 0x80, 0x00, 0x08, 0x08, 0x00, 0x70, 0x86, 0x80,
+ 0x80, 0x08, 0x08, 0x88, 0x08, 0xef, 0x08, 0x08, 0x80, 0x80, 0x00, 0x00, 0x58, 0x17, 0x80, 0x08,
+ 0x12, 0x66, 0x52, 0x00, 0x08, 0x80, 0x88, 0xa8, 0xef, 0x80, 0x80, 0x00, 0x08, 0x08, 0x00, 0x71,
+ 0x85, 0x00, 0x08, 0x09, 0x08, 0x88, 0x88, 0xef, 0x08, 0x08, 0x08, 0x80, 0x00, 0x18, 0x68, 0x07,
+ 0x08, 0x08, 0x88, 0x80, 0x08, 0x88, 0xfa, 0x0e, 0x08, 0x08, 0x80, 0x00, 0x08, 0x10, 0x57, 0x08,
+ 0x08, 0x08, 0x08, 0x88, 0x90, 0xf0, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x80, 0x81, 0x57, 0x00, 0x88,
+ 0x80, 0x80, 0x80, 0x90, 0xc0, 0xcf, 0x80, 0x80, 0x00, 0x80, 0x80, 0x00, 0x71, 0x07, 0x08, 0x88,
+ 0x80, 0x80, 0x80, 0x88, 0xef, 0x80, 0x80, 0x00, 0x88, 0x00, 0x18, 0x79, 0x06, 0x08, 0x08, 0x88,
+ 0x80, 0x08, 0x19, 0xfc, 0x0b, 0x08, 0x08, 0x80, 0x00, 0x18, 0x10, 0x77, 0x81, 0x80, 0x80, 0x08,
+ 0x88, 0x88, 0xf0, 0x0f, 0x88, 0x80, 0x00, 0x08, 0x00, 0x80, 0x67, 0x08, 0x80, 0x08, 0x08, 0x88,
+ 0x80, 0xd0, 0xaf, 0x00, 0x08, 0x08, 0x88, 0x81, 0x80, 0x73, 0x87, 0x80, 0x80, 0x00, 0x88, 0x00,
+ 0x89, 0xef, 0x80, 0x80, 0x80, 0x80, 0x00, 0x19, 0x78, 0x86, 0x80, 0x00, 0x08, 0x08, 0x08, 0x88,
+ 0xfe, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x30, 0x57, 0x08, 0x08, 0x88, 0x80, 0x08, 0x08, 0xf9,
+ 0x0f, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x67, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0xe1, 0x8f,
+ 0x80, 0x80, 0x00, 0x80, 0x08, 0x80, 0x73, 0x85, 0x80, 0x08, 0x88, 0x00, 0x08, 0x98, 0xff, 0x80,
+ 0x80, 0x80, 0x00, 0x08, 0x08, 0x78, 0x86, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0xdf, 0x08, 0x08,
+ 0x08, 0x08, 0x08, 0x00, 0x48, 0x37, 0x08, 0x08, 0x88, 0x08, 0x08, 0x09, 0xfa, 0x9f, 0x00, 0x08,
+ 0x08, 0x80, 0x80, 0x00, 0x77, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0xf0, 0x8d, 0x80, 0x80, 0x00,
+ 0x9d, 0xad, 0x50, 0x00, 0x08, 0x08, 0x58, 0x17, 0x08, 0x88, 0x80, 0x08, 0x08, 0x08, 0xfa, 0x0f,
+ 0x08, 0x00, 0x08, 0x08, 0x08, 0x80, 0x67, 0x88, 0x80, 0x08, 0x08, 0x08, 0x08, 0xf0, 0x0e, 0x08,
+ 0x08, 0x00, 0x08, 0x88, 0x80, 0x76, 0x80, 0x80, 0x88, 0x80, 0x80, 0x80, 0xa0, 0xdf, 0x80, 0x80,
+ 0x00, 0x80, 0x08, 0x08, 0x71, 0x87, 0x80, 0x80, 0x88, 0x00, 0x88, 0x08, 0xdf, 0x80, 0x80, 0x80,
+ 0x00, 0x08, 0x08, 0x78, 0x06, 0x08, 0x88, 0x08, 0x08, 0x08, 0x08, 0xfb, 0x0d, 0x80, 0x00, 0x08,
+ 0x08, 0x08, 0x18, 0x77, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x8d, 0x00, 0x08, 0x08, 0x88,
+ 0x81, 0x80, 0x67, 0x80, 0x08, 0x88, 0x80, 0x80, 0x88, 0xc1, 0xaf, 0x80, 0x00, 0x08, 0x08, 0x08,
+ 0x80, 0x72, 0x07, 0x08, 0x08, 0x88, 0x00, 0x88, 0x08, 0xef, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08,
+ 0x78, 0x05, 0x08, 0x88, 0x08, 0x08, 0x08, 0x08, 0xfd, 0x09, 0x08, 0x08, 0x80, 0x08, 0x00, 0x38,
+ 0x67, 0x08, 0x08, 0x88, 0x00, 0x88, 0x08, 0xf8, 0x0f, 0x08, 0x80, 0x00, 0x88, 0x00, 0x80, 0x57,
+ 0x08, 0x88, 0x80, 0x80, 0x80, 0x88, 0xe1, 0x8f, 0x80, 0x80, 0x00, 0x88, 0x00, 0x80, 0x72, 0x85,
+ 0x08, 0x88, 0x80, 0x00, 0x88, 0x88, 0xef, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x78, 0x86, 0x80,
+ 0x80, 0x08, 0x08, 0x08, 0x08, 0xee, 0x08, 0x08, 0x08, 0x00, 0x88, 0x00, 0x38, 0x57, 0x08, 0x08,
+ 0x88, 0x08, 0x80, 0x08, 0xfa, 0x0f, 0x08, 0x08, 0x80, 0x80, 0x00, 0x80, 0x57, 0x08, 0x08, 0x88,
+ 0x80, 0x80, 0x88, 0xf0, 0x8d, 0x80, 0x80, 0x00, 0x88, 0x00, 0x80, 0x75, 0x82, 0x80, 0x88, 0x80,
+ 0x80, 0x80, 0x98, 0xff, 0x88, 0x00, 0x08, 0x80, 0x80, 0x00, 0x70, 0x86, 0x80, 0x80, 0x08, 0x88,
+ 0x86, 0x4f, 0x4f, 0x00, 0x90, 0xf1, 0x8c, 0x80, 0x80, 0x81, 0x80, 0x80, 0x91, 0x75, 0x82, 0x80,
+ 0x90, 0x80, 0x80, 0x88, 0xa0, 0xff, 0x08, 0x80, 0x80, 0x80, 0x00, 0x08, 0x70, 0x86, 0x80, 0x08,
+ 0x08, 0x08, 0x88, 0x08, 0xdf, 0x08, 0x80, 0x00, 0x08, 0x08, 0x00, 0x58, 0x17, 0x08, 0x08, 0x09,
+ 0x80, 0x08, 0x08, 0xfb, 0x0f, 0x08, 0x00, 0x88, 0x00, 0x08, 0x18, 0x57, 0x88, 0x80, 0x08, 0x08,
+ 0x08, 0x88, 0xf0, 0x0e, 0x08, 0x08, 0x80, 0x80, 0x80, 0x91, 0x76, 0x80, 0x08, 0x88, 0x80, 0x80,
+ 0x80, 0xb0, 0xdf, 0x00, 0x08, 0x80, 0x08, 0x80, 0x00, 0x71, 0x86, 0x80, 0x80, 0x08, 0x08, 0x88,
+ 0x08, 0xef, 0x80, 0x80, 0x00, 0x08, 0x08, 0x00, 0x79, 0x05, 0x08, 0x88, 0x80, 0x08, 0x08, 0x08,
+ 0xfc, 0x0b, 0x08, 0x00, 0x08, 0x80, 0x00, 0x28, 0x77, 0x00, 0x08, 0x88, 0x80, 0x80, 0x88, 0xf0,
+ 0x0f, 0x08, 0x08, 0x80, 0x00, 0x08, 0x90, 0x57, 0x80, 0x80, 0x08, 0x88, 0x80, 0x90, 0xd1, 0x9f,
+ 0x08, 0x80, 0x00, 0x08, 0x80, 0x80, 0x72, 0x87, 0x80, 0x80, 0x08, 0x88, 0x80, 0x08, 0xdf, 0x80,
+ 0x80, 0x00, 0x80, 0x00, 0x08, 0x79, 0x06, 0x08, 0x88, 0x08, 0x88, 0x80, 0x18, 0xfd, 0x09, 0x80,
+ 0x00, 0x08, 0x00, 0x08, 0x39, 0x67, 0x08, 0x88, 0x08, 0x08, 0x88, 0x80, 0xf0, 0x0e, 0x08, 0x08,
+ 0x80, 0x00, 0x08, 0x90, 0x57, 0x80, 0x80, 0x88, 0x80, 0x80, 0x90, 0xf1, 0x8e, 0x80, 0x00, 0x80,
+ 0x80, 0x80, 0x81, 0x72, 0x85, 0x80, 0x88, 0x80, 0x80, 0x08, 0x98, 0xef, 0x80, 0x80, 0x00, 0x08,
+ 0x80, 0x00, 0x78, 0x86, 0x80, 0x80, 0x88, 0x80, 0x80, 0x18, 0xdf, 0x08, 0x08, 0x00, 0x08, 0x08,
+ 0x08, 0x48, 0x37, 0x08, 0x88, 0x88, 0x80, 0x18, 0x09, 0xfa, 0x8f, 0x08, 0x08, 0x80, 0x00, 0x88,
+ 0x74, 0xb3, 0x4b, 0x00, 0x78, 0x86, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0xdf, 0x08, 0x80, 0x00,
+ 0x08, 0x08, 0x08, 0x58, 0x17, 0x08, 0x08, 0x88, 0x80, 0x00, 0x88, 0xfa, 0x0f, 0x08, 0x08, 0x80,
+ 0x80, 0x80, 0x00, 0x57, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0xf1, 0x0e, 0x88, 0x00, 0x08, 0x80,
+ 0x08, 0x80, 0x75, 0x81, 0x08, 0x88, 0x80, 0x80, 0x90, 0xa0, 0xef, 0x80, 0x80, 0x81, 0x80, 0x80,
+ 0x00, 0x70, 0x86, 0x80, 0x08, 0x88, 0x80, 0x80, 0x08, 0xdf, 0x80, 0x80, 0x00, 0x08, 0x08, 0x18,
+ 0x68, 0x07, 0x08, 0x08, 0x88, 0x08, 0x08, 0x09, 0xfa, 0x0c, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00,
+ 0x77, 0x00, 0x88, 0x80, 0x08, 0x08, 0x98, 0xf0, 0x0e, 0x08, 0x80, 0x00, 0x08, 0x88, 0x81, 0x66,
+ 0x80, 0x08, 0x80, 0x88, 0x80, 0x80, 0xc0, 0xaf, 0x08, 0x90, 0x01, 0x08, 0x88, 0x01, 0x72, 0x07,
+ 0x80, 0x08, 0x88, 0x80, 0x08, 0x09, 0xef, 0x80, 0x80, 0x80, 0x00, 0x08, 0x18, 0x78, 0x05, 0x08,
+ 0x88, 0x80, 0x08, 0x08, 0x09, 0xfc, 0x0b, 0x08, 0x08, 0x00, 0x18, 0x08, 0x30, 0x77, 0x00, 0x80,
+ 0x88, 0x80, 0x90, 0x08, 0xf8, 0x0f, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x57, 0x08, 0x80, 0x88,
+ 0x80, 0x80, 0x88, 0xe1, 0x8f, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x72, 0x85, 0x08, 0x80, 0x08,
+ 0x88, 0x88, 0x88, 0xef, 0x80, 0x80, 0x00, 0x08, 0x08, 0x10, 0x78, 0x85, 0x80, 0x80, 0x00, 0x88,
+ 0x88, 0x08, 0xef, 0x08, 0x08, 0x08, 0x00, 0x08, 0x00, 0x38, 0x57, 0x08, 0x88, 0x08, 0x00, 0x98,
+ 0x08, 0xf9, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x80, 0x81, 0x57, 0x08, 0x08, 0x88, 0x80, 0x80, 0x88,
+ 0xf1, 0x8e, 0x80, 0x00, 0x80, 0x80, 0x00, 0x90, 0x73, 0x84, 0x80, 0x80, 0x08, 0x80, 0x98, 0xa0,
+ 0xa8, 0xc2, 0x47, 0x00, 0x1e, 0x19, 0x08, 0x80, 0x08, 0x11, 0x00, 0x77, 0x06, 0x88, 0x88, 0x00,
+ 0x88, 0x80, 0xf0, 0x8e, 0x00, 0x80, 0x80, 0x08, 0x80, 0x81, 0x75, 0x80, 0x80, 0x80, 0x80, 0x91,
+ 0x89, 0xa0, 0xef, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x70, 0x85, 0x80, 0x08, 0x08, 0x88, 0x88,
+ 0x00, 0xff, 0x80, 0x00, 0x08, 0x08, 0x18, 0x08, 0x58, 0x07, 0x80, 0x08, 0x88, 0x08, 0x08, 0x18,
+ 0xfb, 0x0d, 0x09, 0x00, 0x80, 0x18, 0x80, 0x18, 0x77, 0x08, 0x08, 0x88, 0x80, 0x08, 0x80, 0xf0,
+ 0x0d, 0x08, 0x08, 0x08, 0x80, 0x01, 0x88, 0x66, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0xb8, 0xdf,
+ 0x80, 0x88, 0x00, 0x80, 0x66, 0x90, 0x00, 0x88, 0xad, 0x08, 0x80, 0x18, 0x27, 0x00, 0x88, 0xb8,
+ 0x9f, 0x00, 0x08, 0x50, 0x83, 0x08, 0x00, 0xfa, 0x0a, 0x88, 0x80, 0x54, 0x81, 0x08, 0x08, 0xbe,
+ 0x08, 0x00, 0x18, 0x27, 0x08, 0x88, 0xa8, 0x9e, 0x80, 0x80, 0x60, 0x83, 0x08, 0x80, 0xf9, 0x0a,
+ 0x80, 0x80, 0x73, 0x00, 0x88, 0x08, 0xdc, 0x08, 0x18, 0x18, 0x35, 0x88, 0x80, 0xc0, 0x8e, 0x80,
+ 0x08, 0x40, 0x04, 0x80, 0x09, 0xf8, 0x8a, 0x00, 0x80, 0x72, 0x81, 0x80, 0x80, 0xdc, 0x08, 0x08,
+ 0x00, 0x26, 0x88, 0x80, 0xa0, 0x9f, 0x80, 0x00, 0x48, 0x05, 0x08, 0x88, 0xe8, 0x8a, 0x00, 0x00,
+ 0x71, 0x81, 0x80, 0x08, 0xdc, 0x08, 0x08, 0x08, 0x26, 0x80, 0x80, 0xa0, 0x9f, 0x80, 0x18, 0x48,
+ 0x05, 0x08, 0x08, 0xd9, 0x8b, 0x80, 0x80, 0x72, 0x83, 0x08, 0x08, 0xec, 0x08, 0x08, 0x08, 0x35,
+ 0x80, 0x80, 0xa0, 0xaf, 0x80, 0x08, 0x48, 0x06, 0x08, 0x80, 0xd8, 0x8b, 0x80, 0x80, 0x72, 0x82,
+ 0x80, 0x80, 0xfb, 0x09, 0x80, 0x80, 0x45, 0x08, 0x88, 0x80, 0x9f, 0x08, 0x08, 0x20, 0x17, 0x88,
+ 0xdc, 0x6b, 0x55, 0x00, 0x08, 0xcc, 0x08, 0x08, 0x08, 0x27, 0x08, 0x08, 0xa8, 0x9f, 0x80, 0x00,
+ 0x40, 0x04, 0x08, 0x88, 0xf8, 0x0a, 0x08, 0x08, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x88, 0x08, 0x00,
+ 0x27, 0x80, 0x08, 0x98, 0x9f, 0x08, 0x08, 0x40, 0x14, 0x08, 0x88, 0xe9, 0x0b, 0x88, 0x00, 0x72,
+ 0x82, 0x00, 0x88, 0xdc, 0x88, 0x08, 0x00, 0x36, 0x08, 0x08, 0xa8, 0xaf, 0x00, 0x08, 0x48, 0x05,
+ 0x08, 0x80, 0xd8, 0x8b, 0x80, 0x80, 0x72, 0x02, 0x08, 0x88, 0xfb, 0x09, 0x08, 0x80, 0x26, 0x00,
+ 0x88, 0xa0, 0xae, 0x80, 0x00, 0x38, 0x17, 0x08, 0x88, 0xc8, 0x8c, 0x80, 0x00, 0x71, 0x82, 0x08,
+ 0x08, 0xfb, 0x09, 0x80, 0x00, 0x54, 0x80, 0x88, 0x90, 0x9e, 0x08, 0x08, 0x20, 0x17, 0x88, 0x80,
+ 0xc8, 0x8d, 0x00, 0x80, 0x60, 0x02, 0x88, 0x80, 0xfa, 0x09, 0x08, 0x80, 0x54, 0x80, 0x80, 0x90,
+ 0xae, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x8d, 0x80, 0x80, 0x61, 0x82, 0x80, 0x80, 0xfa,
+ 0x09, 0x08, 0x80, 0x54, 0x80, 0x80, 0x88, 0xbd, 0x80, 0x80, 0x20, 0x27, 0x08, 0x08, 0xc8, 0x8d,
+ 0x88, 0x00, 0x60, 0x83, 0x80, 0x08, 0xfa, 0x89, 0x80, 0x80, 0x54, 0x80, 0x80, 0x80, 0xae, 0x08,
+ 0x08, 0x28, 0x17, 0x08, 0x80, 0xc0, 0x8d, 0x80, 0x80, 0x50, 0x03, 0x08, 0x08, 0xfa, 0x0a, 0x88,
+ 0x80, 0x64, 0x80, 0x80, 0x80, 0xbd, 0x08, 0x08, 0x28, 0x27, 0x80, 0x80, 0xb8, 0x9f, 0x80, 0x00,
+ 0x58, 0x84, 0x80, 0x80, 0xe9, 0x0a, 0x80, 0x80, 0x73, 0x81, 0x80, 0x88, 0xcc, 0x88, 0x00, 0x18,
+ 0x27, 0x08, 0x88, 0xa0, 0x9f, 0x80, 0x00, 0x58, 0x03, 0x00, 0x09, 0xf9, 0x0b, 0x08, 0x00, 0x72,
+ 0x81, 0x80, 0x80, 0xdc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x80, 0x00, 0x48, 0x05,
+ 0x43, 0x6c, 0x57, 0x00, 0x80, 0x88, 0xad, 0x08, 0x08, 0x28, 0x27, 0x88, 0x80, 0xb8, 0x8f, 0x80,
+ 0x00, 0x50, 0x83, 0x80, 0x08, 0xfa, 0x0a, 0x08, 0x80, 0x54, 0x00, 0x88, 0x80, 0xbe, 0x80, 0x00,
+ 0x28, 0x17, 0x80, 0x80, 0xc0, 0x8d, 0x80, 0x80, 0x50, 0x03, 0x08, 0x08, 0xfa, 0x0a, 0x88, 0x00,
+ 0x73, 0x81, 0x80, 0x88, 0xcc, 0x88, 0x00, 0x18, 0x27, 0x08, 0x08, 0xb8, 0x8f, 0x08, 0x80, 0x50,
+ 0x03, 0x08, 0x08, 0xf9, 0x0b, 0x08, 0x80, 0x73, 0x81, 0x80, 0x08, 0xdc, 0x08, 0x08, 0x00, 0x26,
+ 0x08, 0x88, 0xa0, 0x9f, 0x80, 0x00, 0x58, 0x03, 0x00, 0x09, 0xf9, 0x0b, 0x80, 0x80, 0x73, 0x81,
+ 0x80, 0x80, 0xdc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x80, 0x00, 0x48, 0x05, 0x08,
+ 0x08, 0xd9, 0x0b, 0x08, 0x80, 0x72, 0x82, 0x80, 0x08, 0xdc, 0x88, 0x00, 0x08, 0x36, 0x08, 0x88,
+ 0xa0, 0x9f, 0x08, 0x08, 0x48, 0x05, 0x08, 0x08, 0xe8, 0x8a, 0x80, 0x00, 0x71, 0x81, 0x00, 0x88,
+ 0xfb, 0x08, 0x08, 0x08, 0x35, 0x80, 0x80, 0xa0, 0xaf, 0x80, 0x80, 0x30, 0x17, 0x88, 0x80, 0xd8,
+ 0x8b, 0x80, 0x81, 0x71, 0x83, 0x08, 0x88, 0xfb, 0x09, 0x80, 0x00, 0x54, 0x08, 0x88, 0x90, 0xae,
+ 0x00, 0x08, 0x20, 0x17, 0x88, 0x80, 0xc8, 0x0d, 0x08, 0x80, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09,
+ 0x08, 0x80, 0x45, 0x08, 0x88, 0x80, 0xae, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xd0, 0x0c, 0x08,
+ 0x80, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x08, 0x80, 0x54, 0x80, 0x80, 0x88, 0xbd, 0x80, 0x00,
+ 0x28, 0x27, 0x08, 0x88, 0xc0, 0x8d, 0x08, 0x80, 0x60, 0x83, 0x80, 0x08, 0xfa, 0x0a, 0x80, 0x00,
+ 0x73, 0x80, 0x80, 0x08, 0xae, 0x08, 0x08, 0x10, 0x17, 0x08, 0x80, 0xb8, 0x8f, 0x80, 0x80, 0x60,
+ 0x1f, 0x6f, 0x58, 0x00, 0x08, 0x88, 0x90, 0xae, 0x00, 0x08, 0x30, 0x07, 0x08, 0x88, 0xd0, 0x0c,
+ 0x80, 0x80, 0x61, 0x82, 0x08, 0x08, 0xfb, 0x09, 0x80, 0x00, 0x35, 0x80, 0x80, 0x98, 0xbf, 0x00,
+ 0x08, 0x30, 0x17, 0x88, 0x80, 0xd0, 0x0c, 0x08, 0x08, 0x70, 0x82, 0x08, 0x08, 0xfb, 0x09, 0x80,
+ 0x80, 0x45, 0x08, 0x08, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8d, 0x80, 0x00,
+ 0x60, 0x82, 0x08, 0x08, 0xfa, 0x09, 0x08, 0x80, 0x54, 0x80, 0x80, 0x88, 0xbd, 0x80, 0x00, 0x28,
+ 0x27, 0x08, 0x88, 0xc0, 0x8e, 0x80, 0x00, 0x50, 0x83, 0x08, 0x08, 0xfa, 0x0a, 0x80, 0x80, 0x54,
+ 0x80, 0x80, 0x80, 0xbe, 0x00, 0x08, 0x10, 0x17, 0x08, 0x80, 0xb8, 0x8e, 0x80, 0x80, 0x60, 0x02,
+ 0x08, 0x08, 0xfa, 0x09, 0x08, 0x08, 0x72, 0x80, 0x80, 0x80, 0xbd, 0x00, 0x08, 0x18, 0x27, 0x08,
+ 0x88, 0xb0, 0x8f, 0x80, 0x80, 0x40, 0x04, 0x08, 0x88, 0xf9, 0x09, 0x88, 0x80, 0x73, 0x80, 0x80,
+ 0x80, 0xcc, 0x08, 0x08, 0x00, 0x27, 0x88, 0x80, 0xa0, 0x8f, 0x08, 0x08, 0x58, 0x03, 0x08, 0x88,
+ 0xf8, 0x0a, 0x88, 0x00, 0x72, 0x81, 0x80, 0x08, 0xdc, 0x80, 0x80, 0x00, 0x35, 0x88, 0x80, 0xb0,
+ 0x9f, 0x80, 0x80, 0x40, 0x05, 0x08, 0x88, 0xe8, 0x0a, 0x08, 0x80, 0x71, 0x81, 0x80, 0x80, 0xeb,
+ 0x08, 0x08, 0x08, 0x26, 0x80, 0x80, 0xa0, 0x9f, 0x80, 0x80, 0x30, 0x06, 0x08, 0x08, 0xe8, 0x8a,
+ 0x80, 0x80, 0x72, 0x81, 0x80, 0x00, 0xcc, 0x09, 0x80, 0x00, 0x36, 0x08, 0x88, 0x90, 0xaf, 0x80,
+ 0x00, 0x38, 0x07, 0x80, 0x08, 0xd8, 0x0b, 0x08, 0x80, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x08, 0x08,
+ 0x08, 0x44, 0x80, 0x80, 0x98, 0x9f, 0x08, 0x80, 0x20, 0x07, 0x08, 0x08, 0xc8, 0x8c, 0x80, 0x00,
+ 0xac, 0xb4, 0x51, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x80, 0x00, 0x48, 0x04, 0x08, 0x08, 0xe9,
+ 0x8a, 0x80, 0x00, 0x72, 0x81, 0x80, 0x80, 0xdc, 0x08, 0x80, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f,
+ 0x00, 0x08, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08, 0x80, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x88,
+ 0x00, 0x08, 0x26, 0x80, 0x08, 0x98, 0x9f, 0x80, 0x80, 0x30, 0x06, 0x08, 0x08, 0xe8, 0x8a, 0x80,
+ 0x80, 0x72, 0x81, 0x80, 0x80, 0xfa, 0x08, 0x08, 0x08, 0x35, 0x08, 0x88, 0x90, 0xaf, 0x80, 0x00,
+ 0x38, 0x07, 0x08, 0x08, 0xc8, 0x8c, 0x00, 0x08, 0x71, 0x81, 0x00, 0x88, 0xfa, 0x08, 0x08, 0x08,
+ 0x44, 0x80, 0x80, 0x88, 0xaf, 0x00, 0x08, 0x28, 0x17, 0x88, 0x80, 0xc8, 0x8c, 0x80, 0x00, 0x70,
+ 0x82, 0x08, 0x08, 0xfa, 0x88, 0x80, 0x00, 0x63, 0x80, 0x80, 0x90, 0xae, 0x80, 0x00, 0x28, 0x17,
+ 0x08, 0x88, 0xc0, 0x8c, 0x80, 0x80, 0x61, 0x02, 0x08, 0x08, 0xfb, 0x09, 0x08, 0x08, 0x73, 0x80,
+ 0x80, 0x80, 0xbd, 0x80, 0x00, 0x28, 0x17, 0x80, 0x80, 0xc0, 0x8d, 0x80, 0x80, 0x60, 0x02, 0x08,
+ 0x88, 0xf9, 0x09, 0x88, 0x00, 0x63, 0x00, 0x88, 0x80, 0xae, 0x08, 0x08, 0x28, 0x17, 0x08, 0x80,
+ 0xb8, 0x8e, 0x08, 0x80, 0x50, 0x03, 0x80, 0x08, 0xfa, 0x8a, 0x80, 0x00, 0x73, 0x81, 0x80, 0x88,
+ 0xdc, 0x80, 0x80, 0x10, 0x26, 0x88, 0x80, 0xb0, 0x8f, 0x08, 0x08, 0x40, 0x84, 0x00, 0x88, 0xe9,
+ 0x8a, 0x80, 0x00, 0x73, 0x81, 0x80, 0x08, 0xbd, 0x88, 0x80, 0x10, 0x37, 0x88, 0x80, 0xb0, 0x9f,
+ 0x80, 0x08, 0x40, 0x05, 0x08, 0x88, 0xe8, 0x0a, 0x08, 0x08, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x08,
+ 0x08, 0x08, 0x27, 0x08, 0x08, 0xa8, 0x9e, 0x80, 0x80, 0x40, 0x05, 0x08, 0x88, 0xd8, 0x0b, 0x88,
+ 0x48, 0xa3, 0x51, 0x00, 0x28, 0x27, 0x08, 0x88, 0xc0, 0x8d, 0x80, 0x80, 0x60, 0x02, 0x08, 0x08,
+ 0xfa, 0x09, 0x08, 0x08, 0x63, 0x80, 0x80, 0x80, 0xbd, 0x08, 0x08, 0x28, 0x27, 0x08, 0x80, 0xb8,
+ 0x9f, 0x80, 0x00, 0x50, 0x83, 0x00, 0x88, 0xf9, 0x8a, 0x80, 0x80, 0x54, 0x81, 0x80, 0x08, 0xbe,
+ 0x80, 0x08, 0x10, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x08, 0x40, 0x84, 0x00, 0x88, 0xf8, 0x89,
+ 0x08, 0x80, 0x62, 0x81, 0x80, 0x80, 0xdc, 0x80, 0x08, 0x18, 0x26, 0x08, 0x08, 0xa8, 0x9f, 0x80,
+ 0x00, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08, 0x08, 0x62, 0x81, 0x80, 0x80, 0xdc, 0x08, 0x08,
+ 0x18, 0x35, 0x08, 0x80, 0xa8, 0xaf, 0x80, 0x80, 0x40, 0x05, 0x80, 0x80, 0xe8, 0x8a, 0x08, 0x80,
+ 0x72, 0x01, 0x08, 0x08, 0xdc, 0x08, 0x08, 0x08, 0x35, 0x80, 0x80, 0xa0, 0xaf, 0x80, 0x08, 0x48,
+ 0x06, 0x08, 0x08, 0xd8, 0x8a, 0x08, 0x80, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x08, 0x88, 0x00, 0x44,
+ 0x08, 0x80, 0x88, 0x9f, 0x08, 0x08, 0x28, 0x07, 0x08, 0x80, 0xd0, 0x0b, 0x88, 0x80, 0x71, 0x82,
+ 0x80, 0x00, 0xfb, 0x88, 0x80, 0x80, 0x44, 0x80, 0x80, 0x90, 0xae, 0x80, 0x08, 0x38, 0x17, 0x08,
+ 0x08, 0xc8, 0x8c, 0x08, 0x08, 0x70, 0x82, 0x00, 0x08, 0xfb, 0x88, 0x80, 0x80, 0x44, 0x80, 0x80,
+ 0x80, 0xaf, 0x80, 0x00, 0x28, 0x16, 0x08, 0x88, 0xc0, 0x8c, 0x88, 0x00, 0x70, 0x82, 0x00, 0x08,
+ 0xfa, 0x09, 0x08, 0x08, 0x63, 0x80, 0x80, 0x80, 0xae, 0x80, 0x08, 0x28, 0x17, 0x08, 0x08, 0xb8,
+ 0x8e, 0x80, 0x80, 0x50, 0x83, 0x00, 0x08, 0xfa, 0x0a, 0x08, 0x08, 0x73, 0x00, 0x08, 0x88, 0xbd,
+ 0x80, 0x00, 0x18, 0x27, 0x08, 0x80, 0xc0, 0x8d, 0x88, 0x00, 0x68, 0x83, 0x80, 0x80, 0xf9, 0x89,
+ 0x84, 0xa5, 0x55, 0x00, 0x08, 0x38, 0x06, 0x80, 0x80, 0xd0, 0x8b, 0x80, 0x80, 0x71, 0x82, 0x00,
+ 0x08, 0xfb, 0x09, 0x08, 0x80, 0x44, 0x80, 0x00, 0x88, 0xaf, 0x80, 0x80, 0x38, 0x07, 0x08, 0x80,
+ 0xc0, 0x8c, 0x80, 0x80, 0x61, 0x82, 0x00, 0x88, 0xfa, 0x09, 0x08, 0x80, 0x44, 0x80, 0x80, 0x80,
+ 0xaf, 0x80, 0x00, 0x18, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x60, 0x82, 0x80, 0x08, 0xf9,
+ 0x09, 0x80, 0x80, 0x63, 0x80, 0x80, 0x08, 0xae, 0x80, 0x00, 0x18, 0x17, 0x88, 0x80, 0xa0, 0x8e,
+ 0x80, 0x80, 0x50, 0x02, 0x08, 0x08, 0xfa, 0x09, 0x88, 0x80, 0x73, 0x80, 0x80, 0x80, 0xcc, 0x00,
+ 0x08, 0x18, 0x17, 0x08, 0x88, 0xa0, 0x8e, 0x08, 0x08, 0x58, 0x03, 0x08, 0x08, 0xf9, 0x0a, 0x88,
+ 0x80, 0x73, 0x81, 0x80, 0x08, 0xbd, 0x08, 0x08, 0x18, 0x27, 0x08, 0x80, 0xb0, 0x9f, 0x00, 0x08,
+ 0x58, 0x03, 0x08, 0x88, 0xf8, 0x0a, 0x88, 0x80, 0x73, 0x81, 0x08, 0x08, 0xdc, 0x80, 0x80, 0x00,
+ 0x26, 0x88, 0x80, 0xa0, 0x9f, 0x00, 0x08, 0x48, 0x04, 0x08, 0x88, 0xe8, 0x0a, 0x88, 0x00, 0x72,
+ 0x81, 0x80, 0x08, 0xcc, 0x08, 0x08, 0x08, 0x27, 0x08, 0x88, 0x90, 0x9f, 0x80, 0x00, 0x38, 0x06,
+ 0x08, 0x88, 0xe0, 0x0a, 0x08, 0x80, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x80, 0x26, 0x08,
+ 0x88, 0x90, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x88, 0xd0, 0x0b, 0x88, 0x81, 0x71, 0x82, 0x80,
+ 0x08, 0xfb, 0x88, 0x00, 0x08, 0x35, 0x88, 0x80, 0x90, 0xaf, 0x80, 0x00, 0x49, 0x05, 0x80, 0x08,
+ 0xd8, 0x0c, 0x80, 0x80, 0x71, 0x81, 0x80, 0x08, 0xea, 0x08, 0x08, 0x88, 0x35, 0x80, 0x80, 0x88,
+ 0xaf, 0x80, 0x18, 0x39, 0x17, 0x08, 0x88, 0xd0, 0x8b, 0x80, 0x00, 0x70, 0x82, 0x00, 0x08, 0xfb,
+ 0x8f, 0xa9, 0x56, 0x00, 0x80, 0x00, 0x48, 0x84, 0x80, 0x08, 0xf8, 0x89, 0x80, 0x80, 0x72, 0x80,
+ 0x80, 0x80, 0xdb, 0x80, 0x08, 0x00, 0x26, 0x08, 0x90, 0x90, 0x9f, 0x80, 0x08, 0x30, 0x87, 0x00,
+ 0x88, 0xd8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x80, 0x08, 0xfb, 0x08, 0x08, 0x80, 0x35, 0x88, 0x80,
+ 0xa0, 0x9f, 0x80, 0x18, 0x49, 0x05, 0x08, 0x88, 0xe0, 0x0a, 0x88, 0x81, 0x71, 0x81, 0x80, 0x08,
+ 0xeb, 0x08, 0x08, 0x80, 0x35, 0x08, 0x90, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x07, 0x08, 0x80, 0xe0,
+ 0x8a, 0x80, 0x00, 0x70, 0x81, 0x00, 0x08, 0xeb, 0x08, 0x88, 0x80, 0x45, 0x88, 0x80, 0x80, 0x9f,
+ 0x80, 0x00, 0x18, 0x06, 0x00, 0x88, 0xd0, 0x0b, 0x88, 0x81, 0x70, 0x82, 0x80, 0x08, 0xfa, 0x88,
+ 0x80, 0x80, 0x44, 0x80, 0x80, 0x80, 0xaf, 0x80, 0x00, 0x28, 0x16, 0x08, 0x88, 0xc0, 0x0d, 0x88,
+ 0x00, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x08, 0x80, 0x44, 0x80, 0x80, 0x08, 0xaf, 0x80, 0x00,
+ 0x18, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x00, 0x40, 0x84, 0x80, 0x08, 0xf9, 0x09, 0x88, 0x00,
+ 0x72, 0x80, 0x80, 0x08, 0xad, 0x80, 0x08, 0x10, 0x17, 0x08, 0x88, 0xa0, 0x8f, 0x80, 0x80, 0x40,
+ 0x03, 0x08, 0x08, 0xfa, 0x0a, 0x08, 0x90, 0x54, 0x81, 0x80, 0x08, 0xbe, 0x80, 0x08, 0x10, 0x27,
+ 0x88, 0x80, 0xb0, 0x8f, 0x80, 0x08, 0x40, 0x84, 0x80, 0x08, 0xf8, 0x89, 0x80, 0x80, 0x72, 0x80,
+ 0x00, 0x88, 0xdb, 0x08, 0x08, 0x00, 0x26, 0x08, 0x80, 0xb0, 0x9f, 0x80, 0x00, 0x48, 0x85, 0x80,
+ 0x80, 0xe8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08, 0x08, 0xcc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x80,
+ 0xa0, 0x9f, 0x08, 0x08, 0x48, 0x05, 0x08, 0x88, 0xe0, 0x0a, 0x88, 0x80, 0x72, 0x81, 0x80, 0x08,
+ 0xfe, 0x18, 0x51, 0x00, 0x8d, 0x08, 0x08, 0x60, 0x02, 0x08, 0x08, 0xfa, 0x09, 0x88, 0x80, 0x73,
+ 0x80, 0x00, 0x88, 0xcc, 0x80, 0x00, 0x18, 0x17, 0x08, 0x08, 0xa8, 0x8e, 0x08, 0x08, 0x58, 0x03,
+ 0x08, 0x08, 0xf9, 0x0a, 0x88, 0x80, 0x73, 0x81, 0x80, 0x08, 0xbd, 0x08, 0x08, 0x18, 0x37, 0x88,
+ 0x80, 0xb0, 0x9f, 0x80, 0x00, 0x58, 0x03, 0x08, 0x08, 0xf9, 0x8a, 0x80, 0x80, 0x73, 0x81, 0x80,
+ 0x08, 0xdc, 0x80, 0x08, 0x00, 0x26, 0x88, 0x80, 0xa0, 0x9f, 0x00, 0x08, 0x48, 0x04, 0x08, 0x88,
+ 0xe8, 0x0a, 0x88, 0x00, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x08, 0x08, 0x08, 0x27, 0x08, 0x08, 0x98,
+ 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x08, 0xe8, 0x0a, 0x88, 0x00, 0x71, 0x81, 0x80, 0x08, 0xeb,
+ 0x08, 0x08, 0x08, 0x26, 0x08, 0x80, 0x98, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x08, 0xd8, 0x8b,
+ 0x80, 0x80, 0x72, 0x82, 0x80, 0x00, 0xec, 0x08, 0x08, 0x08, 0x35, 0x88, 0x80, 0x90, 0xaf, 0x00,
+ 0x08, 0x38, 0x07, 0x08, 0x08, 0xc8, 0x0c, 0x08, 0x08, 0x61, 0x82, 0x80, 0x08, 0xfb, 0x09, 0x80,
+ 0x80, 0x35, 0x80, 0x80, 0x90, 0xaf, 0x08, 0x08, 0x38, 0x17, 0x08, 0x08, 0xd8, 0x8b, 0x80, 0x80,
+ 0x71, 0x83, 0x08, 0x08, 0xfb, 0x09, 0x08, 0x80, 0x54, 0x80, 0x08, 0x88, 0xae, 0x80, 0x00, 0x28,
+ 0x17, 0x88, 0x80, 0xc0, 0x8c, 0x80, 0x80, 0x61, 0x02, 0x88, 0x00, 0xfa, 0x0a, 0x80, 0x80, 0x54,
+ 0x80, 0x80, 0x80, 0xae, 0x08, 0x80, 0x28, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x60, 0x02,
+ 0x88, 0x80, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x80, 0x28, 0x17, 0x08,
+ 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x50, 0x84, 0x08, 0x08, 0xf9, 0x09, 0x80, 0x80, 0x62, 0x80, 0x80,
+ 0x7c, 0x4f, 0x53, 0x00, 0xc8, 0x8b, 0x00, 0x80, 0x71, 0x93, 0x80, 0x00, 0xec, 0x08, 0x08, 0x80,
+ 0x44, 0x80, 0x08, 0x88, 0xaf, 0x00, 0x08, 0x38, 0x16, 0x88, 0x08, 0xc8, 0x0d, 0x08, 0x80, 0x70,
+ 0x81, 0x80, 0x80, 0xe9, 0x09, 0x80, 0x80, 0x54, 0x08, 0x88, 0x80, 0xae, 0x00, 0x80, 0x28, 0x07,
+ 0x80, 0x08, 0xc0, 0x0c, 0x08, 0x80, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80,
+ 0x80, 0x90, 0xae, 0x08, 0x80, 0x28, 0x17, 0x08, 0x08, 0xc0, 0x8d, 0x00, 0x08, 0x50, 0x83, 0x08,
+ 0x08, 0xfa, 0x0a, 0x80, 0x80, 0x54, 0x80, 0x80, 0x80, 0xae, 0x08, 0x08, 0x10, 0x17, 0x08, 0x08,
+ 0xb8, 0x8e, 0x80, 0x80, 0x50, 0x84, 0x08, 0x08, 0xf9, 0x09, 0x08, 0x80, 0x53, 0x81, 0x88, 0x80,
+ 0xbe, 0x80, 0x00, 0x18, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x80, 0x80, 0x40, 0x04, 0x08, 0x88, 0xf9,
+ 0x09, 0x88, 0x00, 0x72, 0x80, 0x80, 0x80, 0xbc, 0x08, 0x08, 0x18, 0x37, 0x88, 0x80, 0xb0, 0x9f,
+ 0x80, 0x00, 0x58, 0x03, 0x08, 0x08, 0xf9, 0x0b, 0x80, 0x80, 0x73, 0x81, 0x80, 0x08, 0xdc, 0x08,
+ 0x80, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00, 0x08, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08,
+ 0x80, 0x71, 0x81, 0x08, 0x08, 0xeb, 0x08, 0x08, 0x00, 0x25, 0x80, 0x80, 0xa0, 0xaf, 0x80, 0x00,
+ 0x48, 0x05, 0x08, 0x08, 0xe8, 0x8a, 0x80, 0x80, 0x72, 0x81, 0x80, 0x80, 0xeb, 0x08, 0x08, 0x08,
+ 0x45, 0x88, 0x80, 0x90, 0x9f, 0x80, 0x00, 0x28, 0x06, 0x80, 0x80, 0xd8, 0x0b, 0x08, 0x80, 0x71,
+ 0x82, 0x80, 0x80, 0xfb, 0x88, 0x00, 0x08, 0x44, 0x80, 0x80, 0x88, 0xaf, 0x80, 0x00, 0x38, 0x16,
+ 0x88, 0x80, 0xd0, 0x8c, 0x00, 0x08, 0x70, 0x01, 0x08, 0x88, 0xea, 0x88, 0x00, 0x08, 0x44, 0x80,
+ 0x19, 0x52, 0x52, 0x00, 0x08, 0xe9, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x08, 0x08,
+ 0x18, 0x36, 0x88, 0x80, 0xb0, 0x9f, 0x80, 0x80, 0x40, 0x05, 0x08, 0x88, 0xe8, 0x0a, 0x88, 0x00,
+ 0x71, 0x01, 0x88, 0x80, 0xeb, 0x08, 0x08, 0x08, 0x26, 0x80, 0x80, 0xa0, 0x9f, 0x80, 0x08, 0x30,
+ 0x06, 0x80, 0x08, 0xe8, 0x8a, 0x80, 0x80, 0x72, 0x01, 0x88, 0x80, 0xeb, 0x88, 0x00, 0x08, 0x45,
+ 0x08, 0x88, 0x90, 0x9f, 0x80, 0x00, 0x28, 0x06, 0x80, 0x08, 0xc8, 0x8c, 0x80, 0x00, 0x71, 0x01,
+ 0x08, 0x88, 0xfa, 0x88, 0x00, 0x08, 0x44, 0x08, 0x88, 0x90, 0xae, 0x80, 0x00, 0x38, 0x17, 0x88,
+ 0x80, 0xc8, 0x8c, 0x80, 0x00, 0x70, 0x82, 0x80, 0x08, 0xfa, 0x88, 0x80, 0x80, 0x44, 0x80, 0x80,
+ 0x88, 0xae, 0x80, 0x00, 0x39, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x08, 0x80, 0x70, 0x82, 0x80, 0x80,
+ 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x80, 0xae, 0x80, 0x80, 0x10, 0x17, 0x08, 0x88, 0xb0,
+ 0x8e, 0x80, 0x80, 0x60, 0x82, 0x80, 0x80, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x80, 0xbd,
+ 0x08, 0x08, 0x10, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x80, 0x50, 0x83, 0x80, 0x08, 0xf9, 0x0a,
+ 0x08, 0x08, 0x73, 0x00, 0x88, 0x80, 0xbd, 0x80, 0x00, 0x18, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08,
+ 0x80, 0x40, 0x04, 0x08, 0x88, 0xf8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08, 0x88, 0xeb, 0x80, 0x80,
+ 0x00, 0x26, 0x88, 0x80, 0xa0, 0x9f, 0x00, 0x08, 0x48, 0x04, 0x08, 0x88, 0xe8, 0x0a, 0x08, 0x08,
+ 0x72, 0x81, 0x80, 0x08, 0xdc, 0x08, 0x00, 0x08, 0x26, 0x88, 0x80, 0xa0, 0x9f, 0x00, 0x08, 0x48,
+ 0x04, 0x08, 0x88, 0xe8, 0x8a, 0x00, 0x80, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x88, 0x00, 0x08, 0x27,
+ 0x3f, 0x55, 0x55, 0x00, 0x08, 0x08, 0xea, 0x09, 0x08, 0x80, 0x44, 0x81, 0x88, 0x80, 0xbe, 0x08,
+ 0x00, 0x18, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x80, 0x50, 0x83, 0x80, 0x08, 0xf9, 0x0a, 0x08,
+ 0x90, 0x54, 0x81, 0x88, 0x80, 0xcd, 0x80, 0x00, 0x18, 0x17, 0x08, 0x88, 0xa0, 0x8e, 0x08, 0x80,
+ 0x40, 0x04, 0x08, 0x08, 0xf9, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08, 0x08, 0xbd, 0x08, 0x00, 0x08,
+ 0x27, 0x08, 0x88, 0xa0, 0x8f, 0x08, 0x08, 0x48, 0x04, 0x08, 0x08, 0xe9, 0x0a, 0x08, 0x80, 0x72,
+ 0x81, 0x80, 0x08, 0xdc, 0x08, 0x00, 0x08, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00, 0x08, 0x48, 0x04,
+ 0x08, 0x88, 0xe8, 0x8a, 0x00, 0x08, 0x71, 0x82, 0x08, 0x08, 0xdc, 0x08, 0x08, 0x80, 0x26, 0x80,
+ 0x80, 0x98, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x88, 0xe0, 0x8a, 0x00, 0x08, 0x71, 0x81, 0x80,
+ 0x08, 0xeb, 0x08, 0x08, 0x08, 0x35, 0x80, 0x80, 0xa0, 0xaf, 0x80, 0x80, 0x30, 0x17, 0x88, 0x80,
+ 0xd8, 0x8b, 0x00, 0x80, 0x71, 0x02, 0x08, 0x88, 0xfb, 0x09, 0x80, 0x00, 0x54, 0x08, 0x88, 0x90,
+ 0xae, 0x00, 0x08, 0x38, 0x17, 0x88, 0x80, 0xc8, 0x0c, 0x08, 0x08, 0x61, 0x82, 0x80, 0x08, 0xfa,
+ 0x09, 0x08, 0x08, 0x54, 0x80, 0x08, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8c,
+ 0x08, 0x80, 0x61, 0x02, 0x08, 0x88, 0xfa, 0x09, 0x08, 0x08, 0x44, 0x00, 0x88, 0x80, 0xaf, 0x08,
+ 0x08, 0x10, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80, 0x80, 0x60, 0x02, 0x08, 0x88, 0xf9, 0x09, 0x08,
+ 0x08, 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x08, 0x10, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80, 0x80,
+ 0x50, 0x03, 0x08, 0x08, 0xfa, 0x8a, 0x80, 0x00, 0x73, 0x81, 0x80, 0x88, 0xdc, 0x80, 0x00, 0x18,
+ 0xfd, 0x25, 0x50, 0x00, 0x83, 0x80, 0x08, 0xfd, 0x09, 0x08, 0x80, 0x35, 0x00, 0x88, 0x90, 0xbf,
+ 0x80, 0x00, 0x38, 0x17, 0x08, 0x08, 0xd8, 0x8b, 0x08, 0x00, 0x70, 0x83, 0x80, 0x08, 0xfb, 0x09,
+ 0x08, 0x80, 0x54, 0x80, 0x80, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xb8, 0x8e, 0x80,
+ 0x00, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x08, 0x80, 0x44, 0x80, 0x80, 0x80, 0xae, 0x08, 0x08,
+ 0x28, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x08, 0x80, 0x60, 0x02, 0x08, 0x88, 0xf9, 0x89, 0x00, 0x08,
+ 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x08, 0x28, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80, 0x80, 0x50,
+ 0x84, 0x80, 0x08, 0xf9, 0x09, 0x08, 0x80, 0x62, 0x00, 0x88, 0x80, 0xcc, 0x08, 0x08, 0x10, 0x17,
+ 0x08, 0x80, 0xb0, 0x8f, 0x80, 0x80, 0x40, 0x03, 0x08, 0x08, 0xf9, 0x0b, 0x08, 0x80, 0x73, 0x81,
+ 0x80, 0x08, 0xbd, 0x88, 0x00, 0x18, 0x37, 0x08, 0x88, 0xb0, 0x9f, 0x80, 0x80, 0x40, 0x05, 0x08,
+ 0x88, 0xe8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x88, 0x00, 0x08, 0x27, 0x08, 0x88,
+ 0x90, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x88, 0xe0, 0x0a, 0x08, 0x80, 0x71, 0x81, 0x80, 0x08,
+ 0xeb, 0x08, 0x08, 0x80, 0x26, 0x08, 0x88, 0x90, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x88, 0xd0,
+ 0x0b, 0x08, 0x80, 0x71, 0x82, 0x08, 0x08, 0xfb, 0x08, 0x88, 0x00, 0x44, 0x08, 0x80, 0x98, 0x9f,
+ 0x80, 0x08, 0x20, 0x07, 0x08, 0x08, 0xc8, 0x8b, 0x80, 0x80, 0x71, 0x83, 0x08, 0x08, 0xfb, 0x09,
+ 0x08, 0x80, 0x35, 0x80, 0x80, 0x90, 0xbf, 0x00, 0x08, 0x38, 0x17, 0x08, 0x88, 0xc0, 0x8d, 0x80,
+ 0x00, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80, 0x80, 0x90, 0xae, 0x80, 0x08,
+ 0x24, 0xb4, 0x4f, 0x00, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x08, 0x08, 0x18, 0x26, 0x80, 0x90, 0x90,
+ 0xaf, 0x00, 0x08, 0x48, 0x05, 0x08, 0x88, 0xe0, 0x8a, 0x00, 0x08, 0x71, 0x81, 0x80, 0x08, 0xeb,
+ 0x08, 0x08, 0x80, 0x35, 0x80, 0x90, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x07, 0x80, 0x08, 0xd8, 0x0b,
+ 0x08, 0x80, 0x71, 0x82, 0x80, 0x00, 0xdc, 0x88, 0x80, 0x00, 0x35, 0x80, 0x80, 0x90, 0xbf, 0x80,
+ 0x00, 0x38, 0x17, 0x08, 0x08, 0xd8, 0x0c, 0x08, 0x80, 0x70, 0x01, 0x08, 0x08, 0xeb, 0x88, 0x00,
+ 0x08, 0x44, 0x80, 0x80, 0x90, 0xaf, 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8c, 0x80, 0x80,
+ 0x61, 0x82, 0x80, 0x00, 0xfb, 0x09, 0x08, 0x80, 0x44, 0x80, 0x80, 0x80, 0xaf, 0x80, 0x00, 0x18,
+ 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x60, 0x82, 0x80, 0x08, 0xf9, 0x09, 0x08, 0x80, 0x63,
+ 0x80, 0x80, 0x80, 0xae, 0x80, 0x00, 0x18, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x50, 0x03,
+ 0x88, 0x18, 0xfa, 0x0a, 0x08, 0x80, 0x73, 0x00, 0x88, 0x80, 0xbd, 0x00, 0x08, 0x18, 0x27, 0x08,
+ 0x88, 0xc1, 0x8d, 0x08, 0x80, 0x50, 0x03, 0x08, 0x08, 0xfa, 0x8a, 0x80, 0x80, 0x64, 0x80, 0x80,
+ 0x80, 0xcc, 0x08, 0x08, 0x00, 0x27, 0x88, 0x80, 0xb0, 0x9e, 0x00, 0x80, 0x40, 0x85, 0x80, 0x08,
+ 0xf8, 0x09, 0x08, 0x88, 0x63, 0x80, 0x80, 0x80, 0xcc, 0x08, 0x80, 0x00, 0x27, 0x88, 0x80, 0xa0,
+ 0x8f, 0x08, 0x08, 0x48, 0x04, 0x88, 0x80, 0xe8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08, 0x08, 0xcc,
+ 0x08, 0x08, 0x18, 0x26, 0x80, 0x80, 0xa8, 0x9f, 0x80, 0x00, 0x38, 0x07, 0x08, 0x08, 0xe8, 0x0a,
+ 0x80, 0x80, 0x71, 0x81, 0x08, 0x08, 0xeb, 0x08, 0x80, 0x00, 0x25, 0x80, 0x90, 0x90, 0xaf, 0x00,
+ 0x1a, 0xbc, 0x51, 0x00, 0x80, 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x00, 0x18, 0x17, 0x08, 0x88,
+ 0xb0, 0x8e, 0x80, 0x00, 0x68, 0x02, 0x08, 0x09, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x08,
+ 0xcd, 0x00, 0x08, 0x18, 0x17, 0x08, 0x88, 0xa0, 0x8e, 0x08, 0x80, 0x40, 0x04, 0x88, 0x08, 0xf9,
+ 0x09, 0x08, 0x80, 0x72, 0x80, 0x80, 0x08, 0xcc, 0x00, 0x08, 0x00, 0x26, 0x88, 0x90, 0xa0, 0x9f,
+ 0x00, 0x00, 0x48, 0x04, 0x88, 0x08, 0xe9, 0x0a, 0x08, 0x80, 0x73, 0x81, 0x08, 0x88, 0xdc, 0x00,
+ 0x08, 0x18, 0x35, 0x88, 0x88, 0xa0, 0xaf, 0x00, 0x00, 0x48, 0x05, 0x08, 0x09, 0xe8, 0x0b, 0x00,
+ 0x80, 0x72, 0x81, 0x80, 0x08, 0xdc, 0x08, 0x00, 0x08, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00, 0x80,
+ 0x30, 0x06, 0x88, 0x08, 0xd8, 0x0b, 0x80, 0x80, 0x72, 0x82, 0x08, 0x88, 0xfb, 0x08, 0x08, 0x80,
+ 0x35, 0x90, 0x80, 0xa0, 0xaf, 0x00, 0x80, 0x30, 0x07, 0x08, 0x88, 0xd0, 0x8b, 0x00, 0x80, 0x71,
+ 0x82, 0x80, 0x08, 0xfb, 0x19, 0x08, 0x80, 0x35, 0x88, 0x80, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x17,
+ 0x09, 0x88, 0xc0, 0x0d, 0x80, 0x80, 0x61, 0x92, 0x80, 0x08, 0xfa, 0x08, 0x08, 0x80, 0x44, 0x88,
+ 0x80, 0x90, 0xae, 0x00, 0x08, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x0d, 0x80, 0x80, 0x60, 0x82, 0x08,
+ 0x08, 0xfa, 0x09, 0x80, 0x00, 0x63, 0x80, 0x88, 0x80, 0xae, 0x00, 0x08, 0x28, 0x17, 0x88, 0x80,
+ 0xc0, 0x8c, 0x80, 0x00, 0x60, 0x82, 0x80, 0x08, 0xf9, 0x1a, 0x08, 0x08, 0x73, 0x80, 0x08, 0x88,
+ 0xcc, 0x00, 0x08, 0x28, 0x17, 0x88, 0x80, 0xb0, 0x8e, 0x80, 0x00, 0x58, 0x83, 0x80, 0x08, 0xf9,
+ 0x0a, 0x08, 0x80, 0x73, 0x00, 0x88, 0x80, 0xcc, 0x08, 0x08, 0x00, 0x27, 0x08, 0x88, 0xa0, 0x8f,
+ 0x8e, 0xc0, 0x54, 0x00, 0x08, 0x80, 0x34, 0x80, 0x80, 0x88, 0xbf, 0x00, 0x08, 0x38, 0x17, 0x08,
+ 0x88, 0xd0, 0x8b, 0x80, 0x80, 0x71, 0x83, 0x08, 0x08, 0xfb, 0x09, 0x08, 0x80, 0x54, 0x08, 0x08,
+ 0x88, 0xae, 0x00, 0x08, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8c, 0x80, 0x80, 0x61, 0x82, 0x00, 0x08,
+ 0xfa, 0x89, 0x80, 0x80, 0x44, 0x80, 0x80, 0x80, 0xaf, 0x80, 0x00, 0x18, 0x17, 0x08, 0x88, 0xb0,
+ 0x8e, 0x80, 0x00, 0x68, 0x82, 0x80, 0x80, 0xf9, 0x09, 0x80, 0x80, 0x63, 0x80, 0x80, 0x08, 0xbd,
+ 0x80, 0x80, 0x10, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x08, 0x50, 0x83, 0x80, 0x08, 0xf9, 0x0a,
+ 0x08, 0x08, 0x73, 0x80, 0x00, 0x88, 0xcc, 0x08, 0x08, 0x00, 0x27, 0x08, 0x88, 0xb0, 0x8e, 0x08,
+ 0x08, 0x58, 0x84, 0x00, 0x88, 0xf8, 0x09, 0x88, 0x80, 0x62, 0x81, 0x80, 0x80, 0xcc, 0x08, 0x88,
+ 0x00, 0x27, 0x08, 0x08, 0xa8, 0x9e, 0x80, 0x80, 0x40, 0x05, 0x08, 0x08, 0xe9, 0x0a, 0x08, 0x88,
+ 0x73, 0x81, 0x80, 0x80, 0xcc, 0x08, 0x88, 0x00, 0x27, 0x08, 0x80, 0xa0, 0x9f, 0x80, 0x80, 0x30,
+ 0x06, 0x08, 0x08, 0xe8, 0x0a, 0x88, 0x80, 0x72, 0x81, 0x80, 0x80, 0xeb, 0x08, 0x08, 0x08, 0x26,
+ 0x08, 0x80, 0xa0, 0x9f, 0x80, 0x80, 0x30, 0x06, 0x08, 0x08, 0xd8, 0x8b, 0x80, 0x80, 0x72, 0x82,
+ 0x00, 0x88, 0xfb, 0x88, 0x08, 0x00, 0x35, 0x08, 0x80, 0x98, 0xaf, 0x08, 0x08, 0x30, 0x07, 0x80,
+ 0x80, 0xc8, 0x8c, 0x80, 0x80, 0x71, 0x82, 0x80, 0x08, 0xeb, 0x09, 0x08, 0x80, 0x36, 0x08, 0x80,
+ 0x98, 0xaf, 0x00, 0x08, 0x38, 0x07, 0x08, 0x80, 0xc8, 0x0c, 0x08, 0x08, 0x70, 0x82, 0x08, 0x08,
+ 0xfa, 0x08, 0x88, 0x00, 0x53, 0x80, 0x80, 0x88, 0xae, 0x08, 0x08, 0x38, 0x17, 0x08, 0x08, 0xc8,
+ 0x4b, 0xbf, 0x50, 0x00, 0x08, 0x08, 0x18, 0x37, 0x08, 0x80, 0xb0, 0xaf, 0x00, 0x08, 0x48, 0x06,
+ 0x08, 0x88, 0xd8, 0x0a, 0x88, 0x80, 0x72, 0x82, 0x08, 0x08, 0xdc, 0x08, 0x08, 0x08, 0x26, 0x80,
+ 0x80, 0xa0, 0x9f, 0x80, 0x80, 0x30, 0x06, 0x08, 0x08, 0xd8, 0x8b, 0x80, 0x80, 0x72, 0x82, 0x00,
+ 0x88, 0xfb, 0x09, 0x80, 0x00, 0x35, 0x08, 0x08, 0x98, 0xaf, 0x80, 0x08, 0x48, 0x15, 0x08, 0x88,
+ 0xe0, 0x0b, 0x88, 0x00, 0x71, 0x82, 0x08, 0x08, 0xfb, 0x08, 0x88, 0x00, 0x44, 0x08, 0x08, 0x88,
+ 0xaf, 0x00, 0x08, 0x28, 0x07, 0x08, 0x80, 0xb8, 0x8d, 0x80, 0x80, 0x71, 0x01, 0x08, 0x08, 0xea,
+ 0x09, 0x08, 0x08, 0x54, 0x80, 0x08, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8c,
+ 0x80, 0x80, 0x61, 0x02, 0x08, 0x08, 0xfb, 0x09, 0x08, 0x08, 0x73, 0x80, 0x80, 0x80, 0xbd, 0x00,
+ 0x08, 0x28, 0x17, 0x08, 0x80, 0xc0, 0x8d, 0x80, 0x80, 0x50, 0x03, 0x08, 0x08, 0xfa, 0x0a, 0x08,
+ 0x88, 0x64, 0x80, 0x80, 0x80, 0xbd, 0x00, 0x08, 0x18, 0x27, 0x88, 0x80, 0xb0, 0x8f, 0x80, 0x80,
+ 0x40, 0x84, 0x80, 0x80, 0xe9, 0x0a, 0x08, 0x80, 0x73, 0x81, 0x08, 0x08, 0xbd, 0x08, 0x08, 0x18,
+ 0x27, 0x08, 0x80, 0xb0, 0x9f, 0x80, 0x00, 0x48, 0x85, 0x80, 0x80, 0xe8, 0x0a, 0x80, 0x80, 0x72,
+ 0x00, 0x08, 0x08, 0xcc, 0x08, 0x08, 0x18, 0x26, 0x08, 0x80, 0xa0, 0x9f, 0x80, 0x08, 0x48, 0x05,
+ 0x08, 0x08, 0xd9, 0x0b, 0x80, 0x80, 0x72, 0x82, 0x08, 0x08, 0xdc, 0x08, 0x08, 0x08, 0x26, 0x80,
+ 0x80, 0xa0, 0x9f, 0x80, 0x80, 0x48, 0x05, 0x08, 0x88, 0xe0, 0x0a, 0x08, 0x88, 0x72, 0x81, 0x08,
+ 0x08, 0xdb, 0x88, 0x80, 0x80, 0x27, 0x80, 0x80, 0x90, 0x9f, 0x80, 0x08, 0x38, 0x06, 0x08, 0x08,
+ 0x09, 0x41, 0x4f, 0x00, 0xad, 0x08, 0x08, 0x18, 0x27, 0x88, 0x80, 0xb0, 0x8f, 0x80, 0x80, 0x40,
+ 0x03, 0x08, 0x08, 0xf9, 0x0b, 0x80, 0x80, 0x73, 0x81, 0x80, 0x80, 0xbd, 0x08, 0x08, 0x18, 0x37,
+ 0x88, 0x80, 0xb0, 0x9f, 0x80, 0x80, 0x68, 0x83, 0x80, 0x00, 0xf9, 0x0a, 0x80, 0x90, 0x73, 0x80,
+ 0x00, 0x08, 0xcc, 0x08, 0x80, 0x18, 0x26, 0x08, 0x08, 0xb0, 0x9f, 0x00, 0x08, 0x48, 0x04, 0x08,
+ 0x08, 0xf8, 0x0a, 0x08, 0x88, 0x72, 0x81, 0x08, 0x08, 0xeb, 0x08, 0x80, 0x08, 0x26, 0x08, 0x88,
+ 0xa1, 0x9f, 0x00, 0x08, 0x38, 0x06, 0x88, 0x00, 0xe8, 0x0a, 0x08, 0x90, 0x72, 0x81, 0x08, 0x08,
+ 0xdb, 0x88, 0x00, 0x88, 0x27, 0x08, 0x08, 0x90, 0x9f, 0x80, 0x80, 0x38, 0x06, 0x08, 0x08, 0xd0,
+ 0x8b, 0x00, 0x88, 0x71, 0x82, 0x80, 0x00, 0xfb, 0x09, 0x80, 0x80, 0x35, 0x08, 0x88, 0x91, 0xaf,
+ 0x80, 0x80, 0x38, 0x07, 0x80, 0x80, 0xd0, 0x0b, 0x08, 0x90, 0x71, 0x82, 0x80, 0x00, 0xfb, 0x88,
+ 0x80, 0x80, 0x44, 0x80, 0x80, 0x80, 0xaf, 0x80, 0x00, 0x28, 0x16, 0x88, 0x80, 0xc0, 0x0d, 0x08,
+ 0x88, 0x61, 0x82, 0x08, 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80, 0x80, 0x80, 0xaf, 0x00, 0x08,
+ 0x29, 0x17, 0x88, 0x80, 0xb0, 0x8e, 0x00, 0x08, 0x68, 0x82, 0x08, 0x08, 0xf9, 0x09, 0x80, 0x80,
+ 0x63, 0x80, 0x88, 0x00, 0xae, 0x00, 0x08, 0x18, 0x17, 0x88, 0x80, 0xb0, 0x8d, 0x80, 0x80, 0x78,
+ 0x82, 0x80, 0x08, 0xe9, 0x09, 0x08, 0x88, 0x54, 0x80, 0x80, 0x80, 0xbd, 0x08, 0x00, 0x19, 0x37,
+ 0x09, 0x08, 0xb0, 0x9f, 0x00, 0x08, 0x58, 0x03, 0x88, 0x00, 0xf9, 0x0a, 0x08, 0x88, 0x73, 0x81,
+ 0x08, 0x08, 0xbd, 0x08, 0x80, 0x18, 0x27, 0x80, 0x08, 0xb0, 0x9f, 0x00, 0x08, 0x58, 0x03, 0x88,
+ 0x8c, 0x36, 0x4d, 0x00, 0x80, 0xaf, 0x80, 0x00, 0x39, 0x07, 0x08, 0x08, 0xc0, 0x8c, 0x00, 0x88,
+ 0x61, 0x82, 0x80, 0x18, 0xfb, 0x09, 0x08, 0x80, 0x54, 0x08, 0x88, 0x80, 0xae, 0x00, 0x08, 0x28,
+ 0x17, 0x88, 0x08, 0xc0, 0x8c, 0x00, 0x08, 0x60, 0x82, 0x80, 0x00, 0xfa, 0x09, 0x80, 0x90, 0x54,
+ 0x80, 0x88, 0x80, 0xad, 0x08, 0x00, 0x29, 0x27, 0x09, 0x08, 0xc0, 0x8d, 0x00, 0x08, 0x68, 0x82,
+ 0x80, 0x08, 0xf9, 0x09, 0x80, 0x80, 0x63, 0x80, 0x08, 0x08, 0xbd, 0x08, 0x00, 0x29, 0x27, 0x08,
+ 0x88, 0xb0, 0x8f, 0x08, 0x80, 0x68, 0x02, 0x88, 0x18, 0xf9, 0x09, 0x08, 0x88, 0x63, 0x80, 0x80,
+ 0x00, 0xcd, 0x00, 0x08, 0x08, 0x17, 0x08, 0x88, 0xb1, 0x9d, 0x00, 0x80, 0x58, 0x04, 0x88, 0x08,
+ 0xf8, 0x89, 0x00, 0x90, 0x72, 0x80, 0x80, 0x00, 0xcc, 0x80, 0x00, 0x08, 0x26, 0x88, 0x80, 0xa0,
+ 0x9f, 0x00, 0x80, 0x48, 0x04, 0x88, 0x08, 0xf0, 0x0a, 0x80, 0x80, 0x62, 0x81, 0x88, 0x00, 0xdc,
+ 0x80, 0x00, 0x08, 0x35, 0x88, 0x80, 0xa0, 0xaf, 0x00, 0x80, 0x48, 0x05, 0x08, 0x08, 0xe8, 0x0b,
+ 0x00, 0x90, 0x72, 0x81, 0x80, 0x18, 0xdc, 0x08, 0x18, 0x88, 0x26, 0x08, 0x88, 0x90, 0x9f, 0x80,
+ 0x00, 0x38, 0x06, 0x08, 0x88, 0xd0, 0x8b, 0x00, 0x80, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x88, 0x00,
+ 0x88, 0x26, 0x80, 0x90, 0x91, 0x9f, 0x08, 0x00, 0x39, 0x06, 0x80, 0x08, 0xe0, 0x8a, 0x80, 0x80,
+ 0x71, 0x81, 0x80, 0x00, 0xeb, 0x88, 0x00, 0x88, 0x45, 0x08, 0x88, 0x80, 0x9f, 0x80, 0x00, 0x18,
+ 0x16, 0x88, 0x08, 0xc0, 0x8c, 0x80, 0x80, 0x71, 0x01, 0x88, 0x18, 0xfa, 0x88, 0x00, 0x88, 0x44,
+ 0x08, 0x88, 0x80, 0xae, 0x00, 0x08, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8c, 0x80, 0x00, 0x78, 0x82,
+ 0x77, 0x38, 0x51, 0x00, 0x08, 0xa0, 0x9e, 0x00, 0x80, 0x48, 0x04, 0x08, 0x88, 0xf0, 0x0a, 0x80,
+ 0x80, 0x71, 0x81, 0x08, 0x08, 0xeb, 0x08, 0x80, 0x80, 0x35, 0x08, 0x88, 0x90, 0xaf, 0x00, 0x08,
+ 0x38, 0x07, 0x08, 0x08, 0xd8, 0x8a, 0x80, 0x80, 0x72, 0x01, 0x88, 0x00, 0xfb, 0x88, 0x00, 0x08,
+ 0x44, 0x08, 0x88, 0x90, 0x9f, 0x80, 0x00, 0x28, 0x07, 0x08, 0x88, 0xc0, 0x8b, 0x80, 0x00, 0x70,
+ 0x83, 0x08, 0x19, 0xfb, 0x09, 0x08, 0x80, 0x35, 0x80, 0x80, 0x90, 0xbf, 0x00, 0x08, 0x38, 0x17,
+ 0x08, 0x88, 0xd0, 0x8b, 0x80, 0x00, 0x70, 0x83, 0x08, 0x08, 0xfb, 0x09, 0x08, 0x80, 0x54, 0x08,
+ 0x90, 0x80, 0xae, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x80, 0x80, 0x61, 0x82, 0x00,
+ 0x08, 0xfb, 0x09, 0x08, 0x80, 0x44, 0x00, 0x88, 0x80, 0xaf, 0x80, 0x08, 0x28, 0x17, 0x08, 0x88,
+ 0xb0, 0x8e, 0x80, 0x80, 0x60, 0x82, 0x00, 0x88, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x80,
+ 0xbd, 0x08, 0x08, 0x28, 0x27, 0x08, 0x88, 0xc1, 0x8e, 0x80, 0x00, 0x58, 0x83, 0x08, 0x08, 0xf9,
+ 0x0a, 0x08, 0x80, 0x73, 0x80, 0x80, 0x80, 0xcc, 0x80, 0x00, 0x08, 0x27, 0x88, 0x80, 0xb0, 0x8e,
+ 0x80, 0x08, 0x58, 0x84, 0x80, 0x08, 0xf8, 0x09, 0x08, 0x88, 0x62, 0x81, 0x08, 0x08, 0xcc, 0x08,
+ 0x08, 0x18, 0x17, 0x08, 0x80, 0xa0, 0x8f, 0x80, 0x08, 0x48, 0x84, 0x80, 0x80, 0xe8, 0x0a, 0x08,
+ 0x80, 0x72, 0x81, 0x08, 0x08, 0xcc, 0x08, 0x08, 0x08, 0x27, 0x08, 0x88, 0x90, 0x9f, 0x00, 0x08,
+ 0x38, 0x06, 0x08, 0x88, 0xe0, 0x0a, 0x08, 0x80, 0x71, 0x81, 0x08, 0x08, 0xeb, 0x08, 0x08, 0x80,
+ 0x35, 0x08, 0x08, 0xa0, 0xaf, 0x00, 0x08, 0x38, 0x07, 0x08, 0x08, 0xd8, 0x8a, 0x80, 0x80, 0x71,
+ 0x75, 0x3e, 0x52, 0x00, 0x08, 0x08, 0xa8, 0x8f, 0x80, 0x80, 0x40, 0x03, 0x08, 0x08, 0xfa, 0x0a,
+ 0x88, 0x80, 0x64, 0x80, 0x80, 0x80, 0xcc, 0x80, 0x08, 0x18, 0x27, 0x88, 0x80, 0xb0, 0x8e, 0x08,
+ 0x08, 0x58, 0x84, 0x80, 0x80, 0xf8, 0x09, 0x08, 0x88, 0x72, 0x80, 0x80, 0x80, 0xdb, 0x80, 0x80,
+ 0x00, 0x26, 0x08, 0x08, 0xb0, 0x9f, 0x00, 0x08, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08, 0x08,
+ 0x71, 0x81, 0x08, 0x08, 0xeb, 0x08, 0x08, 0x00, 0x25, 0x08, 0x80, 0xa0, 0xaf, 0x00, 0x08, 0x48,
+ 0x05, 0x08, 0x08, 0xe8, 0x8a, 0x80, 0x80, 0x72, 0x81, 0x80, 0x00, 0xcc, 0x88, 0x80, 0x80, 0x27,
+ 0x08, 0x80, 0xa0, 0x9e, 0x80, 0x08, 0x48, 0x05, 0x08, 0x08, 0xd8, 0x8b, 0x80, 0x80, 0x71, 0x83,
+ 0x80, 0x08, 0xec, 0x08, 0x08, 0x08, 0x35, 0x08, 0x80, 0x98, 0xaf, 0x80, 0x00, 0x38, 0x07, 0x08,
+ 0x80, 0xc8, 0x0c, 0x88, 0x80, 0x71, 0x82, 0x80, 0x08, 0xeb, 0x88, 0x08, 0x80, 0x36, 0x08, 0x08,
+ 0x98, 0xaf, 0x00, 0x08, 0x38, 0x16, 0x08, 0x88, 0xd0, 0x0c, 0x88, 0x00, 0x70, 0x01, 0x08, 0x08,
+ 0xfa, 0x08, 0x88, 0x00, 0x53, 0x80, 0x80, 0x88, 0x9f, 0x08, 0x08, 0x28, 0x16, 0x08, 0x88, 0xc0,
+ 0x0d, 0x08, 0x08, 0x60, 0x82, 0x08, 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80, 0x80, 0x88, 0xae,
+ 0x80, 0x80, 0x20, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x80, 0x80, 0x70, 0x82, 0x80, 0x80, 0xf9, 0x09,
+ 0x08, 0x80, 0x63, 0x80, 0x80, 0x08, 0xae, 0x80, 0x80, 0x10, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80,
+ 0x00, 0x58, 0x03, 0x08, 0x88, 0xf9, 0x0a, 0x08, 0x80, 0x73, 0x00, 0x08, 0x88, 0xbd, 0x80, 0x00,
+ 0x18, 0x27, 0x08, 0x08, 0xb8, 0x8f, 0x08, 0x08, 0x40, 0x04, 0x08, 0x88, 0xf9, 0x09, 0x88, 0x00,
+ 0x79, 0xe7, 0x4d, 0x00, 0x06, 0x08, 0x80, 0xc8, 0x8c, 0x80, 0x00, 0x71, 0x81, 0x00, 0x88, 0xfa,
+ 0x08, 0x08, 0x08, 0x34, 0x80, 0x80, 0x90, 0xbf, 0x00, 0x08, 0x38, 0x17, 0x08, 0x08, 0xc8, 0x8d,
+ 0x80, 0x80, 0x51, 0x83, 0x08, 0x08, 0xfb, 0x09, 0x08, 0x08, 0x54, 0x80, 0x08, 0x88, 0xae, 0x80,
+ 0x00, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8c, 0x80, 0x00, 0x60, 0x83, 0x08, 0x88, 0xfa, 0x09, 0x08,
+ 0x08, 0x73, 0x80, 0x80, 0x80, 0xbd, 0x00, 0x08, 0x28, 0x17, 0x08, 0x80, 0xb8, 0x8f, 0x80, 0x00,
+ 0x58, 0x83, 0x08, 0x08, 0xf9, 0x0a, 0x80, 0x80, 0x73, 0x80, 0x80, 0x80, 0xcc, 0x80, 0x00, 0x18,
+ 0x17, 0x08, 0x08, 0xa8, 0x8f, 0x80, 0x00, 0x48, 0x03, 0x08, 0x88, 0xf8, 0x0b, 0x80, 0x80, 0x73,
+ 0x81, 0x80, 0x08, 0xbd, 0x08, 0x08, 0x18, 0x37, 0x88, 0x80, 0xb0, 0x9f, 0x80, 0x00, 0x48, 0x85,
+ 0x00, 0x88, 0xe8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08, 0x08, 0xcc, 0x08, 0x08, 0x00, 0x26, 0x08,
+ 0x80, 0xa8, 0x9f, 0x80, 0x00, 0x48, 0x85, 0x80, 0x80, 0xe8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08,
+ 0x08, 0xcc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x80, 0x98, 0xaf, 0x00, 0x08, 0x30, 0x07, 0x08, 0x88,
+ 0xc8, 0x0c, 0x80, 0x80, 0x72, 0x81, 0x08, 0x08, 0xeb, 0x08, 0x08, 0x08, 0x35, 0x08, 0x80, 0x98,
+ 0xaf, 0x80, 0x80, 0x30, 0x07, 0x80, 0x80, 0xd8, 0x0b, 0x08, 0x08, 0x71, 0x82, 0x00, 0x88, 0xfb,
+ 0x88, 0x80, 0x00, 0x35, 0x08, 0x08, 0x98, 0xaf, 0x80, 0x08, 0x30, 0x07, 0x80, 0x80, 0xc8, 0x8c,
+ 0x80, 0x00, 0x70, 0x82, 0x08, 0x08, 0xfa, 0x09, 0x80, 0x00, 0x34, 0x80, 0x80, 0x90, 0xbf, 0x80,
+ 0x00, 0x38, 0x17, 0x08, 0x08, 0xc8, 0x8d, 0x80, 0x00, 0x60, 0x82, 0x80, 0x80, 0xfa, 0x09, 0x08,
+ 0xb1, 0xd0, 0x4d, 0x00, 0x48, 0x04, 0x08, 0x88, 0xe8, 0x0a, 0x88, 0x00, 0x72, 0x81, 0x80, 0x08,
+ 0xcc, 0x08, 0x88, 0x00, 0x27, 0x08, 0x80, 0x98, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x88, 0xe0,
+ 0x0a, 0x88, 0x00, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x80, 0x26, 0x08, 0x80, 0x98, 0x9f,
+ 0x80, 0x00, 0x38, 0x06, 0x08, 0x88, 0xd0, 0x8b, 0x80, 0x00, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x88,
+ 0x80, 0x00, 0x35, 0x08, 0x88, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x07, 0x80, 0x80, 0xc8, 0x8c, 0x80,
+ 0x00, 0x70, 0x82, 0x80, 0x08, 0xeb, 0x09, 0x08, 0x00, 0x54, 0x80, 0x80, 0x98, 0xae, 0x80, 0x00,
+ 0x38, 0x17, 0x08, 0x88, 0xc8, 0x8c, 0x80, 0x00, 0x70, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x80, 0x00,
+ 0x63, 0x80, 0x80, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xb8, 0x8d, 0x80, 0x80, 0x61,
+ 0x83, 0x08, 0x88, 0xf9, 0x0a, 0x08, 0x80, 0x54, 0x80, 0x80, 0x80, 0xbe, 0x00, 0x08, 0x10, 0x17,
+ 0x80, 0x08, 0xb8, 0x8e, 0x08, 0x80, 0x60, 0x02, 0x08, 0x88, 0xf9, 0x09, 0x08, 0x08, 0x72, 0x80,
+ 0x80, 0x80, 0xcc, 0x80, 0x00, 0x18, 0x17, 0x08, 0x88, 0xa0, 0x8e, 0x08, 0x80, 0x40, 0x04, 0x08,
+ 0x88, 0xf8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08, 0x88, 0xbc, 0x08, 0x08, 0x18, 0x37, 0x08, 0x88,
+ 0xb0, 0x9f, 0x80, 0x00, 0x58, 0x84, 0x80, 0x08, 0xf8, 0x89, 0x80, 0x80, 0x62, 0x81, 0x80, 0x08,
+ 0xdc, 0x80, 0x80, 0x00, 0x26, 0x88, 0x80, 0xa0, 0x9f, 0x00, 0x08, 0x48, 0x04, 0x08, 0x88, 0xe8,
+ 0x0a, 0x08, 0x80, 0x71, 0x81, 0x00, 0x88, 0xeb, 0x08, 0x08, 0x08, 0x26, 0x80, 0x80, 0xa0, 0x9f,
+ 0x80, 0x80, 0x30, 0x06, 0x08, 0x08, 0xe8, 0x8a, 0x80, 0x00, 0x71, 0x81, 0x80, 0x80, 0xeb, 0x08,
+ 0xb8, 0xcb, 0x4e, 0x00, 0x00, 0x58, 0x83, 0x80, 0x08, 0xf9, 0x0a, 0x08, 0x80, 0x73, 0x00, 0x08,
+ 0x88, 0xcc, 0x08, 0x08, 0x00, 0x27, 0x08, 0x88, 0xb0, 0x9e, 0x80, 0x00, 0x40, 0x85, 0x00, 0x88,
+ 0xf8, 0x09, 0x88, 0x00, 0x71, 0x80, 0x80, 0x80, 0xdb, 0x80, 0x08, 0x00, 0x17, 0x08, 0x80, 0xa0,
+ 0x9e, 0x80, 0x00, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08, 0x80, 0x62, 0x81, 0x80, 0x08, 0xdc,
+ 0x08, 0x08, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x80, 0x00, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a,
+ 0x08, 0x80, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x80, 0x35, 0x08, 0x90, 0x90, 0xaf, 0x80,
+ 0x00, 0x38, 0x07, 0x80, 0x80, 0xd8, 0x0b, 0x08, 0x80, 0x71, 0x82, 0x80, 0x80, 0xfb, 0x08, 0x08,
+ 0x08, 0x35, 0x08, 0x88, 0x90, 0xaf, 0x80, 0x80, 0x30, 0x07, 0x08, 0x08, 0xc8, 0x8c, 0x80, 0x00,
+ 0x70, 0x82, 0x80, 0x08, 0xeb, 0x09, 0x08, 0x00, 0x35, 0x80, 0x80, 0x90, 0xbf, 0x80, 0x00, 0x38,
+ 0x17, 0x08, 0x88, 0xd0, 0x8b, 0x08, 0x80, 0x71, 0x83, 0x80, 0x08, 0xfb, 0x09, 0x08, 0x80, 0x54,
+ 0x80, 0x80, 0x88, 0xae, 0x80, 0x18, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x08, 0x80, 0x70, 0x82,
+ 0x80, 0x08, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x08, 0xae, 0x80, 0x00, 0x18, 0x17, 0x08,
+ 0x88, 0xb0, 0x8e, 0x80, 0x00, 0x68, 0x82, 0x80, 0x08, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80,
+ 0x08, 0xbd, 0x80, 0x18, 0x18, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x08, 0x50, 0x83, 0x80, 0x08,
+ 0xf9, 0x0a, 0x88, 0x81, 0x73, 0x00, 0x08, 0x88, 0xcc, 0x08, 0x08, 0x00, 0x27, 0x08, 0x88, 0xb0,
+ 0x9e, 0x80, 0x00, 0x58, 0x84, 0x00, 0x88, 0xf8, 0x09, 0x88, 0x00, 0x71, 0x80, 0x00, 0x88, 0xdb,
+ 0x51, 0xce, 0x50, 0x00, 0x80, 0x80, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x88, 0x08, 0x00, 0x53, 0x80,
+ 0x80, 0x90, 0xae, 0x08, 0x08, 0x38, 0x17, 0x08, 0x80, 0xc0, 0x0d, 0x88, 0x00, 0x50, 0x02, 0x08,
+ 0x88, 0xfa, 0x09, 0x88, 0x00, 0x54, 0x80, 0x80, 0x88, 0xae, 0x80, 0x18, 0x18, 0x17, 0x08, 0x88,
+ 0xb0, 0x8e, 0x80, 0x80, 0x60, 0x82, 0x00, 0x88, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x08,
+ 0xae, 0x80, 0x08, 0x10, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x50, 0x03, 0x08, 0x88, 0xf9,
+ 0x0a, 0x88, 0x91, 0x64, 0x80, 0x80, 0x08, 0xcc, 0x80, 0x08, 0x00, 0x27, 0x88, 0x80, 0xb0, 0x8e,
+ 0x08, 0x08, 0x58, 0x84, 0x80, 0x08, 0xf8, 0x09, 0x08, 0x08, 0x71, 0x80, 0x80, 0x80, 0xdb, 0x80,
+ 0x80, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x80, 0x00, 0x48, 0x85, 0x80, 0x08, 0xe8, 0x89, 0x80,
+ 0x80, 0x72, 0x00, 0x08, 0x08, 0xcc, 0x80, 0x18, 0x08, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00, 0x08,
+ 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08, 0x80, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x00,
+ 0x25, 0x08, 0x80, 0x98, 0xaf, 0x00, 0x08, 0x48, 0x05, 0x08, 0x88, 0xe0, 0x8a, 0x80, 0x00, 0x71,
+ 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x80, 0x35, 0x80, 0x80, 0x98, 0xaf, 0x80, 0x18, 0x38, 0x17,
+ 0x08, 0x88, 0xd8, 0x0b, 0x88, 0x00, 0x71, 0x82, 0x00, 0x88, 0xfb, 0x09, 0x08, 0x00, 0x35, 0x80,
+ 0x80, 0x98, 0xaf, 0x80, 0x08, 0x38, 0x17, 0x08, 0x08, 0xc8, 0x0d, 0x88, 0x00, 0x60, 0x82, 0x80,
+ 0x08, 0xfa, 0x09, 0x08, 0x80, 0x54, 0x08, 0x08, 0x88, 0xae, 0x00, 0x08, 0x28, 0x07, 0x00, 0x88,
+ 0xb8, 0x8d, 0x80, 0x00, 0x60, 0x02, 0x08, 0x88, 0xf9, 0x0a, 0x80, 0x00, 0x73, 0x80, 0x80, 0x88,
+ 0xf6, 0xf4, 0x4a, 0x00, 0x0c, 0x08, 0x80, 0x72, 0x82, 0x80, 0x08, 0xdc, 0x08, 0x08, 0x08, 0x36,
+ 0x08, 0x88, 0xa0, 0x9f, 0x08, 0x08, 0x30, 0x07, 0x08, 0x88, 0xd0, 0x0b, 0x08, 0x80, 0x71, 0x82,
+ 0x80, 0x08, 0xfb, 0x08, 0x88, 0x00, 0x44, 0x08, 0x90, 0x90, 0x9f, 0x80, 0x00, 0x28, 0x07, 0x08,
+ 0x88, 0xc0, 0x8b, 0x80, 0x00, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x09, 0x80, 0x00, 0x44, 0x80, 0x80,
+ 0x88, 0xaf, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xc8, 0x0c, 0x08, 0x80, 0x61, 0x82, 0x80, 0x08,
+ 0xfa, 0x09, 0x08, 0x80, 0x54, 0x08, 0x88, 0x80, 0xae, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xc0,
+ 0x8c, 0x80, 0x00, 0x78, 0x82, 0x80, 0x08, 0xea, 0x09, 0x08, 0x80, 0x54, 0x80, 0x80, 0x88, 0xae,
+ 0x80, 0x00, 0x18, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80, 0x00, 0x68, 0x82, 0x00, 0x88, 0xf9, 0x09,
+ 0x08, 0x80, 0x63, 0x80, 0x80, 0x80, 0xbd, 0x80, 0x08, 0x10, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08,
+ 0x08, 0x50, 0x83, 0x80, 0x08, 0xf9, 0x0a, 0x08, 0x88, 0x54, 0x00, 0x80, 0x08, 0xbe, 0x80, 0x00,
+ 0x08, 0x27, 0x08, 0x88, 0xa0, 0x8f, 0x80, 0x08, 0x58, 0x83, 0x80, 0x08, 0xf8, 0x0a, 0x08, 0x90,
+ 0x73, 0x80, 0x00, 0x08, 0xcc, 0x08, 0x08, 0x18, 0x26, 0x08, 0x80, 0xb0, 0x9f, 0x80, 0x00, 0x48,
+ 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x88, 0x80, 0x72, 0x81, 0x80, 0x80, 0xeb, 0x08, 0x08, 0x08, 0x26,
+ 0x08, 0x80, 0xa0, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x08, 0xe8, 0x0a, 0x88, 0x80, 0x72, 0x81,
+ 0x80, 0x08, 0xeb, 0x08, 0x08, 0x08, 0x26, 0x08, 0x80, 0x98, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08,
+ 0x08, 0xd8, 0x8b, 0x80, 0x80, 0x72, 0x82, 0x80, 0x18, 0xec, 0x08, 0x08, 0x80, 0x35, 0x88, 0x80,
+ 0x5b, 0x2a, 0x49, 0x00, 0xf9, 0x09, 0x08, 0x88, 0x73, 0x80, 0x80, 0x08, 0xbc, 0x08, 0x08, 0x18,
+ 0x37, 0x88, 0x80, 0xb0, 0x9f, 0x80, 0x00, 0x58, 0x03, 0x08, 0x08, 0xf9, 0x0b, 0x80, 0x80, 0x73,
+ 0x81, 0x80, 0x08, 0xbd, 0x08, 0x08, 0x18, 0x37, 0x88, 0x80, 0xb0, 0x9f, 0x80, 0x00, 0x48, 0x05,
+ 0x08, 0x88, 0xe8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08, 0x08, 0xcc, 0x08, 0x08, 0x08, 0x27, 0x08,
+ 0x88, 0x90, 0x9f, 0x00, 0x08, 0x38, 0x06, 0x08, 0x88, 0xd8, 0x8a, 0x80, 0x80, 0x72, 0x82, 0x08,
+ 0x08, 0xdc, 0x08, 0x08, 0x08, 0x26, 0x80, 0x80, 0xa0, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x08,
+ 0xe8, 0x8a, 0x80, 0x00, 0x71, 0x81, 0x80, 0x80, 0xeb, 0x08, 0x08, 0x08, 0x45, 0x88, 0x80, 0x90,
+ 0x9f, 0x80, 0x00, 0x28, 0x07, 0x08, 0x88, 0xc0, 0x8b, 0x80, 0x00, 0x71, 0x82, 0x80, 0x08, 0xfb,
+ 0x08, 0x88, 0x00, 0x44, 0x08, 0x80, 0x88, 0xaf, 0x00, 0x08, 0x28, 0x07, 0x80, 0x80, 0xb8, 0x0e,
+ 0x08, 0x08, 0x60, 0x82, 0x08, 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80, 0x80, 0x88, 0xae, 0x80,
+ 0x18, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x0d, 0x08, 0x08, 0x50, 0x83, 0x08, 0x08, 0xfa, 0x0a, 0x80,
+ 0x80, 0x64, 0x80, 0x08, 0x88, 0xad, 0x80, 0x18, 0x18, 0x17, 0x08, 0x80, 0xb8, 0x8e, 0x80, 0x80,
+ 0x60, 0x83, 0x08, 0x88, 0xf9, 0x09, 0x88, 0x81, 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x08, 0x10,
+ 0x17, 0x08, 0x80, 0xb8, 0x8e, 0x80, 0x08, 0x50, 0x03, 0x08, 0x08, 0xf9, 0x0b, 0x08, 0x80, 0x73,
+ 0x81, 0x80, 0x80, 0xbd, 0x88, 0x00, 0x18, 0x37, 0x08, 0x88, 0xb0, 0x9f, 0x80, 0x80, 0x50, 0x03,
+ 0x08, 0x08, 0xf9, 0x0b, 0x08, 0x80, 0x73, 0x81, 0x80, 0x80, 0xdc, 0x08, 0x08, 0x00, 0x26, 0x08,
+ 0x9b, 0x2e, 0x4c, 0x00, 0x08, 0xfa, 0x88, 0x80, 0x80, 0x44, 0x08, 0x80, 0x88, 0xae, 0x80, 0x08,
+ 0x10, 0x17, 0x88, 0x80, 0xb0, 0x8e, 0x80, 0x00, 0x50, 0x02, 0x08, 0x08, 0xfa, 0x0a, 0x80, 0x80,
+ 0x54, 0x80, 0x80, 0x08, 0xae, 0x80, 0x00, 0x18, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x00, 0x58,
+ 0x03, 0x08, 0x88, 0xf9, 0x0a, 0x08, 0x80, 0x73, 0x00, 0x08, 0x88, 0xcc, 0x08, 0x08, 0x00, 0x27,
+ 0x08, 0x88, 0xa0, 0x8f, 0x08, 0x08, 0x58, 0x83, 0x80, 0x08, 0xf8, 0x0a, 0x08, 0x80, 0x72, 0x00,
+ 0x08, 0x08, 0xbd, 0x80, 0x08, 0x00, 0x27, 0x08, 0x88, 0xa0, 0x8f, 0x08, 0x08, 0x30, 0x06, 0x08,
+ 0x88, 0xe8, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x08, 0x08, 0xcc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x90,
+ 0xb1, 0x9f, 0x80, 0x00, 0x48, 0x85, 0x80, 0x80, 0xd8, 0x0b, 0x08, 0x80, 0x72, 0x82, 0x80, 0x08,
+ 0xec, 0x08, 0x80, 0x00, 0x25, 0x08, 0x90, 0x90, 0x9f, 0x08, 0x08, 0x48, 0x05, 0x08, 0x88, 0xe0,
+ 0x0a, 0x88, 0x00, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x08, 0x35, 0x80, 0x80, 0x98, 0xaf,
+ 0x80, 0x00, 0x38, 0x07, 0x80, 0x80, 0xd8, 0x0b, 0x08, 0x80, 0x71, 0x82, 0x80, 0x08, 0xfa, 0x09,
+ 0x08, 0x80, 0x35, 0x80, 0x80, 0x88, 0xbf, 0x00, 0x18, 0x28, 0x17, 0x08, 0x88, 0xd0, 0x8b, 0x80,
+ 0x00, 0x70, 0x02, 0x08, 0x88, 0xfa, 0x09, 0x08, 0x80, 0x35, 0x80, 0x80, 0x88, 0xbf, 0x00, 0x08,
+ 0x20, 0x17, 0x08, 0x88, 0xc0, 0x8d, 0x00, 0x08, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x08, 0x80,
+ 0x44, 0x80, 0x80, 0x90, 0xae, 0x08, 0x18, 0x28, 0x17, 0x08, 0x08, 0xc8, 0x8c, 0x08, 0x80, 0x70,
+ 0x02, 0x08, 0x88, 0xf9, 0x09, 0x08, 0x08, 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x08, 0x10, 0x17,
+ 0x38, 0x29, 0x4e, 0x00, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x80, 0x35, 0x08, 0x88, 0x90, 0xaf, 0x80,
+ 0x00, 0x48, 0x05, 0x08, 0x08, 0xe8, 0x0b, 0x80, 0x80, 0x72, 0x81, 0x80, 0x80, 0xeb, 0x08, 0x08,
+ 0x08, 0x45, 0x88, 0x80, 0x90, 0x9f, 0x80, 0x00, 0x38, 0x15, 0x88, 0x08, 0xe8, 0x0b, 0x08, 0x80,
+ 0x71, 0x82, 0x80, 0x08, 0xfb, 0x88, 0x00, 0x08, 0x44, 0x80, 0x80, 0x98, 0x9f, 0x08, 0x00, 0x28,
+ 0x07, 0x08, 0x08, 0xc8, 0x8b, 0x08, 0x00, 0x70, 0x83, 0x80, 0x08, 0xfb, 0x09, 0x08, 0x80, 0x54,
+ 0x80, 0x08, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8c, 0x80, 0x80, 0x61, 0x02,
+ 0x88, 0x80, 0xfa, 0x09, 0x08, 0x80, 0x54, 0x80, 0x08, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x88,
+ 0x80, 0xc0, 0x8c, 0x80, 0x80, 0x70, 0x82, 0x08, 0x08, 0xf9, 0x09, 0x80, 0x80, 0x63, 0x80, 0x08,
+ 0x08, 0xbd, 0x80, 0x00, 0x18, 0x27, 0x88, 0x80, 0xb0, 0x8f, 0x80, 0x80, 0x40, 0x84, 0x80, 0x80,
+ 0xf9, 0x09, 0x08, 0x08, 0x72, 0x80, 0x80, 0x80, 0xbc, 0x08, 0x08, 0x28, 0x27, 0x08, 0x08, 0xb8,
+ 0x9f, 0x00, 0x08, 0x40, 0x85, 0x80, 0x08, 0xe9, 0x0a, 0x80, 0x00, 0x72, 0x81, 0x08, 0x88, 0xcc,
+ 0x08, 0x80, 0x10, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x08, 0x80, 0x40, 0x05, 0x88, 0x80, 0xe8, 0x0a,
+ 0x08, 0x80, 0x72, 0x81, 0x08, 0x88, 0xeb, 0x08, 0x08, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00,
+ 0x08, 0x48, 0x04, 0x08, 0x88, 0xe8, 0x8a, 0x00, 0x80, 0x72, 0x81, 0x80, 0x08, 0xdc, 0x08, 0x80,
+ 0x00, 0x26, 0x08, 0x88, 0x90, 0x9f, 0x80, 0x80, 0x30, 0x06, 0x08, 0x88, 0xe0, 0x8a, 0x00, 0x08,
+ 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x08, 0x35, 0x80, 0x80, 0x98, 0xaf, 0x80, 0x00, 0x38,
+ 0xd9, 0x20, 0x46, 0x00, 0x81, 0x80, 0x88, 0xff, 0x80, 0x80, 0x00, 0x25, 0x88, 0x80, 0xb0, 0x8f,
+ 0x08, 0x08, 0x40, 0x04, 0x88, 0x80, 0xe9, 0x0a, 0x08, 0x80, 0x73, 0x81, 0x80, 0x88, 0xdc, 0x80,
+ 0x00, 0x18, 0x26, 0x88, 0x80, 0xa8, 0x9f, 0x00, 0x08, 0x40, 0x04, 0x08, 0x09, 0xf8, 0x0a, 0x08,
+ 0x80, 0x72, 0x81, 0x88, 0x80, 0xeb, 0x08, 0x00, 0x08, 0x26, 0x88, 0x80, 0xa0, 0x9f, 0x00, 0x08,
+ 0x30, 0x05, 0x08, 0x08, 0xe9, 0x0b, 0x80, 0x00, 0x72, 0x01, 0x88, 0x80, 0xdc, 0x08, 0x08, 0x00,
+ 0x26, 0x08, 0x90, 0xa0, 0x9f, 0x80, 0x00, 0x48, 0x04, 0x80, 0x08, 0xe8, 0x8b, 0x00, 0x80, 0x72,
+ 0x82, 0x08, 0x88, 0xfb, 0x88, 0x00, 0x08, 0x35, 0x80, 0x88, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x07,
+ 0x80, 0x80, 0xd8, 0x8b, 0x00, 0x80, 0x71, 0x02, 0x88, 0x08, 0xfb, 0x88, 0x80, 0x00, 0x44, 0x80,
+ 0x80, 0x88, 0xaf, 0x80, 0x00, 0x38, 0x16, 0x08, 0x88, 0xc8, 0x8d, 0x00, 0x08, 0x70, 0x01, 0x08,
+ 0x88, 0xf9, 0x88, 0x00, 0x08, 0x53, 0x80, 0x80, 0x88, 0xae, 0x08, 0x08, 0x20, 0x17, 0x08, 0x88,
+ 0xc0, 0x8c, 0x08, 0x80, 0x70, 0x82, 0x80, 0x80, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x80,
+ 0xae, 0x80, 0x80, 0x10, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x50, 0x83, 0x00, 0x88, 0xf9,
+ 0x0a, 0x08, 0x80, 0x73, 0x00, 0x08, 0x88, 0xad, 0x88, 0x80, 0x10, 0x27, 0x08, 0x80, 0xb8, 0x8f,
+ 0x08, 0x08, 0x40, 0x84, 0x00, 0x08, 0xea, 0x0a, 0x08, 0x80, 0x73, 0x81, 0x80, 0x08, 0xbd, 0x88,
+ 0x00, 0x18, 0x27, 0x80, 0x80, 0xb0, 0x9f, 0x80, 0x80, 0x40, 0x85, 0x00, 0x08, 0xe9, 0x0a, 0x08,
+ 0x90, 0x73, 0x00, 0x80, 0x08, 0xcc, 0x08, 0x08, 0x18, 0x26, 0x08, 0x80, 0xb0, 0x9f, 0x80, 0x80,
+ 0x2e, 0xd8, 0x49, 0x00, 0x44, 0x80, 0x80, 0x80, 0xae, 0x80, 0x80, 0x28, 0x17, 0x08, 0x88, 0xb0,
+ 0x8e, 0x80, 0x80, 0x60, 0x82, 0x80, 0x80, 0xea, 0x09, 0x08, 0x08, 0x54, 0x80, 0x80, 0x88, 0xae,
+ 0x80, 0x00, 0x18, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80, 0x80, 0x60, 0x82, 0x00, 0x08, 0xfa, 0x09,
+ 0x08, 0x08, 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x08, 0x28, 0x17, 0x08, 0x08, 0xa8, 0x8f, 0x80,
+ 0x80, 0x40, 0x03, 0x08, 0x08, 0xfa, 0x0a, 0x88, 0x00, 0x73, 0x81, 0x80, 0x88, 0xbd, 0x08, 0x18,
+ 0x18, 0x27, 0x80, 0x80, 0xb8, 0x9f, 0x00, 0x08, 0x40, 0x85, 0x80, 0x08, 0xe9, 0x0a, 0x80, 0x81,
+ 0x72, 0x81, 0x88, 0x08, 0xcc, 0x08, 0x00, 0x18, 0x17, 0x80, 0x88, 0xa0, 0x9e, 0x80, 0x00, 0x40,
+ 0x85, 0x00, 0x09, 0xd9, 0x0b, 0x08, 0x00, 0x72, 0x82, 0x80, 0x08, 0xcd, 0x88, 0x00, 0x00, 0x36,
+ 0x08, 0x88, 0xa8, 0x9f, 0x88, 0x10, 0x48, 0x05, 0x08, 0x88, 0xe8, 0x0a, 0x88, 0x00, 0x71, 0x01,
+ 0x80, 0x88, 0xeb, 0x88, 0x80, 0x00, 0x26, 0x00, 0x88, 0x98, 0x9f, 0x80, 0x08, 0x30, 0x06, 0x80,
+ 0x80, 0xe8, 0x8a, 0x80, 0x80, 0x72, 0x81, 0x00, 0x88, 0xeb, 0x88, 0x00, 0x08, 0x35, 0x00, 0x88,
+ 0xa0, 0xaf, 0x08, 0x08, 0x48, 0x06, 0x80, 0x08, 0xd8, 0x0b, 0x88, 0x00, 0x71, 0x82, 0x00, 0x88,
+ 0xfb, 0x88, 0x80, 0x00, 0x44, 0x80, 0x80, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x16, 0x08, 0x88, 0xe0,
+ 0x0b, 0x88, 0x00, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x88, 0x80, 0x00, 0x44, 0x80, 0x80, 0x98, 0xae,
+ 0x80, 0x18, 0x28, 0x17, 0x08, 0x08, 0xc8, 0x8c, 0x08, 0x80, 0x70, 0x02, 0x08, 0x08, 0xfa, 0x09,
+ 0x08, 0x08, 0x63, 0x80, 0x80, 0x80, 0xae, 0x80, 0x08, 0x10, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80,
+ 0x12, 0xdd, 0x4a, 0x00, 0x80, 0x35, 0x08, 0x88, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x07, 0x80, 0x08,
+ 0xd8, 0x8a, 0x08, 0x80, 0x72, 0x01, 0x80, 0x88, 0xeb, 0x88, 0x08, 0x00, 0x45, 0x08, 0x90, 0x90,
+ 0x9f, 0x80, 0x18, 0x28, 0x06, 0x00, 0x88, 0xd8, 0x0b, 0x88, 0x81, 0x71, 0x02, 0x08, 0x09, 0xfb,
+ 0x88, 0x08, 0x00, 0x44, 0x80, 0x80, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x16, 0x08, 0x88, 0xc8, 0x0d,
+ 0x88, 0x00, 0x70, 0x01, 0x08, 0x88, 0xda, 0x09, 0x08, 0x80, 0x45, 0x80, 0x80, 0x90, 0xaf, 0x80,
+ 0x00, 0x28, 0x07, 0x00, 0x88, 0xc0, 0x0c, 0x88, 0x00, 0x60, 0x82, 0x00, 0x09, 0xfa, 0x09, 0x08,
+ 0x80, 0x44, 0x80, 0x80, 0x80, 0xaf, 0x80, 0x00, 0x18, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80,
+ 0x60, 0x82, 0x00, 0x09, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x80, 0xbd, 0x08, 0x08, 0x28,
+ 0x27, 0x08, 0x08, 0xc0, 0x8e, 0x80, 0x80, 0x50, 0x02, 0x08, 0x08, 0xf9, 0x0a, 0x80, 0x80, 0x73,
+ 0x80, 0x00, 0x88, 0xcc, 0x80, 0x18, 0x18, 0x26, 0x08, 0x88, 0xb0, 0x9f, 0x80, 0x00, 0x58, 0x03,
+ 0x80, 0x08, 0xf9, 0x8a, 0x80, 0x80, 0x73, 0x81, 0x80, 0x08, 0xcc, 0x88, 0x00, 0x18, 0x27, 0x08,
+ 0x88, 0xb0, 0x9e, 0x80, 0x00, 0x58, 0x04, 0x08, 0x88, 0xe8, 0x8a, 0x08, 0x00, 0x72, 0x81, 0x80,
+ 0x08, 0xcc, 0x88, 0x18, 0x18, 0x36, 0x08, 0x88, 0xa8, 0x9f, 0x88, 0x00, 0x40, 0x05, 0x08, 0x08,
+ 0xe9, 0x8a, 0x80, 0x00, 0x72, 0x81, 0x00, 0x88, 0xfb, 0x08, 0x08, 0x08, 0x35, 0x08, 0x88, 0xa0,
+ 0x9f, 0x08, 0x08, 0x48, 0x14, 0x08, 0x88, 0xe0, 0x8b, 0x80, 0x80, 0x71, 0x02, 0x08, 0x08, 0xdc,
+ 0x88, 0x08, 0x00, 0x35, 0x00, 0x88, 0xa0, 0xaf, 0x08, 0x08, 0x48, 0x06, 0x08, 0x08, 0xc8, 0x8c,
+ 0x50, 0xde, 0x4a, 0x00, 0x08, 0x18, 0x17, 0x08, 0x80, 0xb0, 0x8e, 0x80, 0x80, 0x40, 0x04, 0x08,
+ 0x88, 0xf8, 0x0a, 0x08, 0x80, 0x72, 0x00, 0x08, 0x08, 0xcc, 0x08, 0x08, 0x00, 0x17, 0x08, 0x90,
+ 0xa1, 0x8f, 0x80, 0x80, 0x30, 0x85, 0x00, 0x09, 0xe8, 0x0a, 0x88, 0x91, 0x73, 0x81, 0x80, 0x08,
+ 0xcc, 0x08, 0x08, 0x08, 0x27, 0x08, 0x88, 0x90, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x88, 0xe0,
+ 0x0a, 0x08, 0x80, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x08, 0x35, 0x08, 0x08, 0xa0, 0xaf,
+ 0x80, 0x00, 0x38, 0x07, 0x80, 0x80, 0xd8, 0x0b, 0x08, 0x80, 0x71, 0x82, 0x00, 0x88, 0xfb, 0x88,
+ 0x80, 0x00, 0x35, 0x08, 0x88, 0x90, 0xaf, 0x80, 0x00, 0x38, 0x07, 0x08, 0x08, 0xc8, 0x0c, 0x88,
+ 0x00, 0x70, 0x82, 0x80, 0x08, 0xeb, 0x09, 0x08, 0x00, 0x35, 0x80, 0x80, 0x88, 0xbf, 0x80, 0x00,
+ 0x38, 0x17, 0x08, 0x88, 0xc0, 0x8d, 0x80, 0x00, 0x60, 0x82, 0x00, 0x09, 0xfa, 0x09, 0x08, 0x80,
+ 0x44, 0x80, 0x80, 0x80, 0xaf, 0x80, 0x00, 0x18, 0x17, 0x08, 0x88, 0xc0, 0x0c, 0x88, 0x00, 0x60,
+ 0x82, 0x00, 0x88, 0xfa, 0x09, 0x08, 0x80, 0x44, 0x80, 0x80, 0x80, 0xaf, 0x80, 0x00, 0x18, 0x17,
+ 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x00, 0x68, 0x82, 0x80, 0x08, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80,
+ 0x80, 0x08, 0xbd, 0x80, 0x18, 0x18, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x80, 0x50, 0x83, 0x80,
+ 0x08, 0xf9, 0x0a, 0x88, 0x81, 0x73, 0x00, 0x88, 0x80, 0xbd, 0x80, 0x00, 0x18, 0x27, 0x08, 0x88,
+ 0xa0, 0x9f, 0x80, 0x00, 0x58, 0x03, 0x08, 0x88, 0xf9, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x80, 0x08,
+ 0xcc, 0x08, 0x08, 0x18, 0x17, 0x00, 0x88, 0xa0, 0x8f, 0x88, 0x00, 0x38, 0x85, 0x00, 0x88, 0xd8,
+ 0x45, 0xdd, 0x49, 0x00, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x80, 0x00, 0x60, 0x83,
+ 0x08, 0x88, 0xfa, 0x09, 0x08, 0x80, 0x54, 0x80, 0x80, 0x88, 0xae, 0x80, 0x80, 0x20, 0x17, 0x08,
+ 0x88, 0xc0, 0x8c, 0x80, 0x80, 0x61, 0x02, 0x08, 0x88, 0xf9, 0x0a, 0x08, 0x80, 0x54, 0x00, 0x88,
+ 0x80, 0xbe, 0x00, 0x08, 0x10, 0x17, 0x08, 0x80, 0xc0, 0x8d, 0x80, 0x00, 0x58, 0x03, 0x08, 0x08,
+ 0xfa, 0x0a, 0x08, 0x80, 0x73, 0x00, 0x08, 0x88, 0xcc, 0x80, 0x08, 0x10, 0x17, 0x08, 0x80, 0xa8,
+ 0x8f, 0x80, 0x80, 0x40, 0x03, 0x08, 0x88, 0xf8, 0x0b, 0x08, 0x80, 0x73, 0x81, 0x80, 0x80, 0xbd,
+ 0x88, 0x00, 0x18, 0x37, 0x08, 0x88, 0xb0, 0x9f, 0x80, 0x80, 0x40, 0x05, 0x08, 0x88, 0xe8, 0x0a,
+ 0x08, 0x08, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x08, 0x88, 0x10, 0x26, 0x80, 0x80, 0xb0, 0x9f, 0x80,
+ 0x08, 0x40, 0x05, 0x08, 0x88, 0xe8, 0x0a, 0x88, 0x00, 0x72, 0x81, 0x80, 0x08, 0xcc, 0x08, 0x08,
+ 0x08, 0x27, 0x08, 0x88, 0x90, 0x9f, 0x80, 0x00, 0x38, 0x06, 0x08, 0x88, 0xd0, 0x0b, 0x08, 0x80,
+ 0x71, 0x82, 0x80, 0x08, 0xfb, 0x08, 0x88, 0x00, 0x44, 0x08, 0x08, 0x98, 0x9f, 0x80, 0x08, 0x20,
+ 0x07, 0x08, 0x08, 0xc8, 0x8b, 0x08, 0x80, 0x72, 0x02, 0x08, 0x08, 0xdc, 0x09, 0x08, 0x08, 0x45,
+ 0x80, 0x80, 0x90, 0xaf, 0x00, 0x08, 0x38, 0x16, 0x88, 0x80, 0xd0, 0x0c, 0x08, 0x08, 0x60, 0x82,
+ 0x80, 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80, 0x80, 0x80, 0xaf, 0x80, 0x00, 0x28, 0x16, 0x08,
+ 0x88, 0xc0, 0x8d, 0x00, 0x08, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x08, 0x80, 0x44, 0x80, 0x80,
+ 0x88, 0xae, 0x08, 0x80, 0x20, 0x17, 0x08, 0x88, 0xc0, 0x8d, 0x00, 0x80, 0x60, 0x82, 0x80, 0x08,
+ 0x33, 0x10, 0x44, 0x00, 0x9e, 0x08, 0x80, 0x30, 0x07, 0x08, 0x08, 0xd8, 0x0b, 0x08, 0x80, 0x71,
+ 0x82, 0x80, 0x08, 0xfb, 0x88, 0x00, 0x08, 0x44, 0x80, 0x80, 0x98, 0x9f, 0x80, 0x80, 0x20, 0x16,
+ 0x88, 0x80, 0xc8, 0x8c, 0x80, 0x80, 0x71, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80,
+ 0x80, 0x90, 0x9f, 0x08, 0x08, 0x38, 0x16, 0x88, 0x80, 0xd0, 0x0c, 0x08, 0x80, 0x60, 0x82, 0x80,
+ 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80, 0x80, 0x90, 0xae, 0x08, 0x08, 0x38, 0x17, 0x80, 0x08,
+ 0xc8, 0x8d, 0x80, 0x00, 0x60, 0x02, 0x88, 0x80, 0xfa, 0x09, 0x08, 0x80, 0x44, 0x00, 0x88, 0x80,
+ 0xaf, 0x80, 0x80, 0x10, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x60, 0x02, 0x88, 0x80, 0xf9,
+ 0x09, 0x08, 0x80, 0x53, 0x81, 0x08, 0x88, 0xbe, 0x80, 0x00, 0x18, 0x27, 0x08, 0x08, 0xb8, 0x8f,
+ 0x08, 0x08, 0x40, 0x04, 0x08, 0x08, 0xfa, 0x09, 0x88, 0x00, 0x72, 0x80, 0x80, 0x80, 0xbc, 0x88,
+ 0x00, 0x18, 0x37, 0x08, 0x88, 0xb0, 0x9f, 0x80, 0x80, 0x50, 0x03, 0x80, 0x80, 0xf9, 0x0b, 0x08,
+ 0x80, 0x73, 0x81, 0x80, 0x80, 0xdc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00, 0x08,
+ 0x48, 0x04, 0x08, 0x08, 0xe9, 0x8a, 0x80, 0x00, 0x72, 0x01, 0x88, 0x08, 0xdc, 0x08, 0x80, 0x00,
+ 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00, 0x08, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x80, 0x80, 0x71,
+ 0x81, 0x08, 0x08, 0xeb, 0x08, 0x80, 0x00, 0x44, 0x88, 0x80, 0xa0, 0xae, 0x00, 0x08, 0x30, 0x07,
+ 0x08, 0x80, 0xd8, 0x0b, 0x08, 0x80, 0x71, 0x82, 0x80, 0x80, 0xfb, 0x88, 0x80, 0x00, 0x35, 0x08,
+ 0x08, 0x98, 0xaf, 0x80, 0x08, 0x30, 0x07, 0x08, 0x80, 0xd0, 0x0c, 0x80, 0x80, 0x61, 0x81, 0x00,
+ 0x16, 0x18, 0x46, 0x00, 0xb0, 0x8e, 0x80, 0x80, 0x40, 0x85, 0x08, 0x08, 0xf8, 0x09, 0x08, 0x80,
+ 0x52, 0x81, 0x08, 0x08, 0xcd, 0x08, 0x08, 0x00, 0x17, 0x80, 0x80, 0x98, 0x8f, 0x80, 0x80, 0x30,
+ 0x85, 0x80, 0x08, 0xe8, 0x0a, 0x08, 0x90, 0x73, 0x81, 0x80, 0x08, 0xdc, 0x80, 0x80, 0x00, 0x35,
+ 0x88, 0x80, 0xa0, 0xaf, 0x00, 0x08, 0x48, 0x05, 0x08, 0x08, 0xe8, 0x8a, 0x80, 0x80, 0x72, 0x81,
+ 0x00, 0x88, 0xfb, 0x08, 0x08, 0x00, 0x34, 0x80, 0x80, 0xa0, 0xbf, 0x80, 0x00, 0x48, 0x06, 0x08,
+ 0x08, 0xd8, 0x0b, 0x08, 0x80, 0x71, 0x82, 0x80, 0x80, 0xfb, 0x88, 0x00, 0x08, 0x35, 0x08, 0x88,
+ 0x90, 0xaf, 0x80, 0x00, 0x49, 0x15, 0x88, 0x08, 0xd8, 0x0c, 0x08, 0x80, 0x71, 0x81, 0x80, 0x08,
+ 0xea, 0x88, 0x00, 0x08, 0x44, 0x80, 0x80, 0x88, 0xaf, 0x80, 0x00, 0x28, 0x17, 0x88, 0x08, 0xc0,
+ 0x8c, 0x80, 0x00, 0x70, 0x01, 0x88, 0x80, 0xea, 0x88, 0x00, 0x08, 0x44, 0x80, 0x80, 0x88, 0xaf,
+ 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xb8, 0x8e, 0x00, 0x08, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09,
+ 0x80, 0x00, 0x63, 0x80, 0x08, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xc0, 0x8c, 0x80,
+ 0x80, 0x61, 0x02, 0x08, 0x88, 0xfa, 0x09, 0x08, 0x08, 0x73, 0x80, 0x80, 0x80, 0xbd, 0x00, 0x08,
+ 0x28, 0x17, 0x80, 0x08, 0xc0, 0x8d, 0x80, 0x80, 0x50, 0x03, 0x08, 0x08, 0xfa, 0x0a, 0x08, 0x08,
+ 0x73, 0x81, 0x88, 0x80, 0xbd, 0x80, 0x00, 0x18, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x80, 0x50,
+ 0x83, 0x80, 0x08, 0xf9, 0x0a, 0x08, 0x80, 0x72, 0x81, 0x80, 0x08, 0xbd, 0x08, 0x08, 0x28, 0x27,
+ 0x08, 0x08, 0xa8, 0x8e, 0x80, 0x08, 0x58, 0x03, 0x08, 0x08, 0xf9, 0x8a, 0x80, 0x80, 0x73, 0x81,
+ 0x21, 0x18, 0x46, 0x00, 0x08, 0xb8, 0x8d, 0x80, 0x80, 0x61, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x08,
+ 0x80, 0x44, 0x80, 0x80, 0x90, 0xbe, 0x80, 0x00, 0x28, 0x27, 0x08, 0x88, 0xc0, 0x8d, 0x08, 0x08,
+ 0x60, 0x83, 0x08, 0x08, 0xfa, 0x89, 0x80, 0x80, 0x54, 0x80, 0x80, 0x80, 0xae, 0x08, 0x08, 0x10,
+ 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80, 0x80, 0x60, 0x02, 0x08, 0x88, 0xf9, 0x09, 0x88, 0x00, 0x63,
+ 0x80, 0x80, 0x80, 0xbd, 0x08, 0x08, 0x28, 0x27, 0x08, 0x80, 0xb8, 0x9f, 0x00, 0x08, 0x40, 0x85,
+ 0x80, 0x08, 0xe9, 0x0a, 0x80, 0x80, 0x73, 0x00, 0x08, 0x88, 0xeb, 0x08, 0x08, 0x00, 0x26, 0x08,
+ 0x88, 0xa0, 0x9f, 0x80, 0x00, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08, 0x88, 0x63, 0x81, 0x80,
+ 0x80, 0xdc, 0x08, 0x08, 0x18, 0x35, 0x08, 0x80, 0xb0, 0xaf, 0x80, 0x80, 0x40, 0x06, 0x08, 0x08,
+ 0xd9, 0x8a, 0x80, 0x80, 0x72, 0x82, 0x80, 0x08, 0xdc, 0x08, 0x08, 0x08, 0x26, 0x80, 0x80, 0xa0,
+ 0x9f, 0x80, 0x08, 0x30, 0x06, 0x08, 0x08, 0xd8, 0x8b, 0x80, 0x80, 0x72, 0x82, 0x00, 0x08, 0xec,
+ 0x08, 0x88, 0x00, 0x44, 0x08, 0x80, 0x90, 0x9f, 0x08, 0x08, 0x28, 0x07, 0x08, 0x80, 0xc0, 0x0c,
+ 0x08, 0x88, 0x61, 0x82, 0x80, 0x80, 0xfa, 0x88, 0x08, 0x08, 0x44, 0x80, 0x80, 0x90, 0xae, 0x08,
+ 0x80, 0x38, 0x17, 0x08, 0x08, 0xc8, 0x0d, 0x08, 0x88, 0x61, 0x82, 0x80, 0x08, 0xfa, 0x88, 0x80,
+ 0x80, 0x44, 0x80, 0x80, 0x90, 0xae, 0x08, 0x08, 0x38, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x08, 0x80,
+ 0x70, 0x82, 0x00, 0x08, 0xfa, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x80, 0x10,
+ 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x60, 0x02, 0x88, 0x80, 0xf9, 0x09, 0x08, 0x08, 0x63,
+ 0x0e, 0x15, 0x47, 0x00, 0x08, 0x08, 0xd8, 0x0b, 0x80, 0x80, 0x72, 0x01, 0x08, 0x88, 0xeb, 0x88,
+ 0x80, 0x00, 0x45, 0x08, 0x88, 0x90, 0x9f, 0x80, 0x80, 0x20, 0x06, 0x80, 0x80, 0xd0, 0x8b, 0x80,
+ 0x80, 0x71, 0x82, 0x00, 0x08, 0xfb, 0x09, 0x08, 0x80, 0x35, 0x80, 0x80, 0x90, 0xaf, 0x08, 0x08,
+ 0x38, 0x17, 0x88, 0x80, 0xc0, 0x8c, 0x08, 0x08, 0x70, 0x82, 0x80, 0x80, 0xea, 0x09, 0x08, 0x08,
+ 0x54, 0x80, 0x80, 0x90, 0xae, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x08, 0x80, 0x70,
+ 0x82, 0x80, 0x80, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x80, 0xae, 0x80, 0x00, 0x18, 0x17,
+ 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x51, 0x02, 0x08, 0x88, 0xf9, 0x0a, 0x08, 0x80, 0x54, 0x00,
+ 0x88, 0x08, 0xbe, 0x00, 0x08, 0x10, 0x17, 0x80, 0x88, 0xb0, 0x8e, 0x08, 0x80, 0x50, 0x84, 0x80,
+ 0x08, 0xe9, 0x0a, 0x08, 0x80, 0x73, 0x81, 0x80, 0x88, 0xcc, 0x08, 0x08, 0x00, 0x27, 0x08, 0x88,
+ 0xb0, 0x9e, 0x80, 0x00, 0x58, 0x04, 0x08, 0x08, 0xf9, 0x89, 0x08, 0x80, 0x72, 0x00, 0x08, 0x08,
+ 0xbc, 0x88, 0x08, 0x00, 0x37, 0x08, 0x88, 0xa0, 0x9f, 0x08, 0x80, 0x40, 0x04, 0x80, 0x08, 0xf8,
+ 0x8a, 0x80, 0x80, 0x72, 0x81, 0x80, 0x80, 0xeb, 0x08, 0x08, 0x08, 0x26, 0x80, 0x80, 0xa8, 0x9f,
+ 0x00, 0x08, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08, 0x80, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08,
+ 0x08, 0x80, 0x26, 0x08, 0x88, 0x90, 0x9f, 0x80, 0x00, 0x38, 0x05, 0x00, 0x88, 0xd8, 0x0c, 0x88,
+ 0x00, 0x71, 0x81, 0x00, 0x08, 0xfb, 0x08, 0x08, 0x08, 0x34, 0x80, 0x80, 0xa0, 0xaf, 0x08, 0x00,
+ 0x38, 0x17, 0x08, 0x88, 0xd8, 0x8b, 0x80, 0x81, 0x71, 0x02, 0x08, 0x88, 0xfb, 0x09, 0x08, 0x00,
+ 0x05, 0x00, 0x41, 0x00, 0x05, 0x08, 0x88, 0xf9, 0x0a, 0x08, 0x00, 0x72, 0x81, 0x80, 0x88, 0xcc,
+ 0x08, 0x08, 0x00, 0x27, 0x08, 0x88, 0x98, 0x8f, 0x08, 0x08, 0x30, 0x05, 0x08, 0x88, 0xe8, 0x8a,
+ 0x80, 0x00, 0x72, 0x81, 0x80, 0x80, 0xdc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x80, 0xa8, 0x9f, 0x80,
+ 0x00, 0x48, 0x04, 0x80, 0x88, 0xe8, 0x8a, 0x08, 0x00, 0x72, 0x01, 0x80, 0x09, 0xfb, 0x88, 0x00,
+ 0x08, 0x35, 0x08, 0x90, 0xa0, 0xaf, 0x80, 0x00, 0x40, 0x14, 0x08, 0x88, 0xe9, 0x0b, 0x88, 0x81,
+ 0x72, 0x82, 0x00, 0x09, 0xdc, 0x88, 0x08, 0x00, 0x36, 0x08, 0x88, 0xa0, 0xaf, 0x80, 0x00, 0x30,
+ 0x07, 0x80, 0x08, 0xd8, 0x0b, 0x88, 0x81, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x88, 0x80, 0x00, 0x44,
+ 0x80, 0x80, 0x98, 0x9f, 0x08, 0x08, 0x20, 0x07, 0x80, 0x08, 0xc8, 0x8b, 0x08, 0x00, 0x71, 0x02,
+ 0x08, 0x88, 0xfa, 0x89, 0x80, 0x00, 0x35, 0x00, 0x88, 0x90, 0xbf, 0x80, 0x00, 0x38, 0x17, 0x80,
+ 0x88, 0xc0, 0x8d, 0x80, 0x00, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x08, 0x80, 0x44, 0x00, 0x88,
+ 0x90, 0xae, 0x08, 0x08, 0x20, 0x17, 0x08, 0x08, 0xc8, 0x8c, 0x08, 0x80, 0x70, 0x02, 0x08, 0x88,
+ 0xf9, 0x89, 0x00, 0x80, 0x63, 0x00, 0x88, 0x80, 0xae, 0x08, 0x08, 0x10, 0x17, 0x08, 0x08, 0xb8,
+ 0x8e, 0x80, 0x80, 0x50, 0x03, 0x08, 0x88, 0xf9, 0x0a, 0x88, 0x81, 0x73, 0x00, 0x08, 0x88, 0xcc,
+ 0x08, 0x08, 0x00, 0x27, 0x08, 0x88, 0xa0, 0x8f, 0x88, 0x00, 0x58, 0x83, 0x00, 0x88, 0xf9, 0x89,
+ 0x08, 0x80, 0x63, 0x81, 0x80, 0x80, 0xcd, 0x08, 0x08, 0x18, 0x15, 0x08, 0x80, 0xb0, 0x9e, 0x80,
+ 0x00, 0x50, 0x03, 0x00, 0x09, 0xf9, 0x0b, 0x08, 0x80, 0x73, 0x81, 0x00, 0x88, 0xdc, 0x80, 0x08,
+ 0x78, 0xef, 0x3f, 0x00, 0x50, 0x83, 0x80, 0x08, 0xfa, 0x89, 0x00, 0x08, 0x44, 0x81, 0x88, 0x90,
+ 0xaf, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x08, 0x08, 0x60, 0x02, 0x08, 0x88, 0xf9,
+ 0x09, 0x08, 0x08, 0x63, 0x80, 0x80, 0x80, 0xae, 0x80, 0x80, 0x10, 0x17, 0x08, 0x08, 0xb8, 0x8e,
+ 0x80, 0x80, 0x50, 0x03, 0x08, 0x88, 0xf9, 0x8a, 0x00, 0x80, 0x73, 0x81, 0x90, 0x80, 0xcc, 0x88,
+ 0x00, 0x10, 0x27, 0x08, 0x88, 0xa8, 0x9f, 0x80, 0x00, 0x40, 0x04, 0x88, 0x80, 0xe9, 0x0a, 0x08,
+ 0x80, 0x72, 0x01, 0x88, 0x80, 0xcc, 0x88, 0x00, 0x08, 0x27, 0x80, 0x08, 0xb0, 0x8f, 0x08, 0x08,
+ 0x48, 0x04, 0x08, 0x08, 0xe9, 0x8a, 0x80, 0x00, 0x72, 0x81, 0x80, 0x80, 0xfb, 0x08, 0x08, 0x08,
+ 0x25, 0x00, 0x08, 0xa8, 0x9f, 0x80, 0x08, 0x30, 0x06, 0x80, 0x80, 0xe8, 0x8a, 0x80, 0x80, 0x72,
+ 0x01, 0x08, 0x88, 0xeb, 0x88, 0x00, 0x08, 0x26, 0x80, 0x80, 0xa0, 0x9f, 0x08, 0x08, 0x48, 0x05,
+ 0x08, 0x08, 0xd8, 0x8b, 0x80, 0x00, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x88, 0x80, 0x00, 0x35, 0x08,
+ 0x88, 0x90, 0xaf, 0x80, 0x08, 0x30, 0x07, 0x80, 0x80, 0xd8, 0x8b, 0x00, 0x08, 0x71, 0x83, 0x08,
+ 0x88, 0xfb, 0x09, 0x80, 0x00, 0x54, 0x08, 0x08, 0x98, 0xae, 0x00, 0x08, 0x38, 0x07, 0x80, 0x80,
+ 0xc8, 0x0c, 0x08, 0x08, 0x61, 0x82, 0x80, 0x80, 0xfa, 0x89, 0x00, 0x08, 0x54, 0x80, 0x08, 0x88,
+ 0xae, 0x80, 0x80, 0x20, 0x17, 0x88, 0x80, 0xb8, 0x8d, 0x08, 0x80, 0x61, 0x83, 0x80, 0x08, 0xfb,
+ 0x89, 0x80, 0x00, 0x54, 0x80, 0x80, 0x88, 0xae, 0x08, 0x08, 0x20, 0x17, 0x08, 0x88, 0xb0, 0x8f,
+ 0x80, 0x00, 0x40, 0x03, 0x08, 0x88, 0xfa, 0x8a, 0x80, 0x00, 0x54, 0x81, 0x80, 0x88, 0xbe, 0x08,
+ 0x2f, 0xf2, 0x3e, 0x00, 0x80, 0x72, 0x01, 0x88, 0x80, 0xeb, 0x88, 0x80, 0x00, 0x45, 0x08, 0x88,
+ 0x90, 0x9f, 0x80, 0x08, 0x20, 0x07, 0x08, 0x08, 0xc8, 0x8b, 0x80, 0x80, 0x72, 0x82, 0x00, 0x88,
+ 0xfb, 0x09, 0x08, 0x00, 0x44, 0x80, 0x80, 0x90, 0xaf, 0x80, 0x00, 0x28, 0x17, 0x88, 0x80, 0xc0,
+ 0x8c, 0x80, 0x80, 0x61, 0x02, 0x88, 0x80, 0xfa, 0x09, 0x08, 0x08, 0x44, 0x00, 0x88, 0x80, 0xaf,
+ 0x80, 0x80, 0x28, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80, 0x80, 0x60, 0x82, 0x00, 0x08, 0xfa, 0x09,
+ 0x08, 0x08, 0x63, 0x80, 0x80, 0x80, 0xae, 0x80, 0x08, 0x28, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80,
+ 0x80, 0x60, 0x02, 0x08, 0x08, 0xfa, 0x09, 0x08, 0x08, 0x63, 0x80, 0x80, 0x80, 0xae, 0x08, 0x80,
+ 0x28, 0x17, 0x08, 0x88, 0xb0, 0x8e, 0x80, 0x80, 0x50, 0x03, 0x08, 0x08, 0xfa, 0x8a, 0x00, 0x08,
+ 0x73, 0x81, 0x08, 0x88, 0xcc, 0x08, 0x08, 0x00, 0x27, 0x08, 0x88, 0xb0, 0x9e, 0x00, 0x08, 0x40,
+ 0x05, 0x08, 0x88, 0xe9, 0x0a, 0x80, 0x80, 0x73, 0x81, 0x08, 0x08, 0xcd, 0x00, 0x08, 0x18, 0x16,
+ 0x80, 0x80, 0xa8, 0x8f, 0x80, 0x08, 0x30, 0x06, 0x88, 0x80, 0xe8, 0x0a, 0x80, 0x80, 0x72, 0x81,
+ 0x08, 0x88, 0xeb, 0x08, 0x80, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00, 0x08, 0x30, 0x06, 0x88,
+ 0x80, 0xe8, 0x0a, 0x08, 0x80, 0x62, 0x01, 0x08, 0x88, 0xfb, 0x88, 0x00, 0x08, 0x35, 0x08, 0x88,
+ 0xa0, 0xaf, 0x00, 0x08, 0x30, 0x07, 0x08, 0x08, 0xd8, 0x0b, 0x08, 0x08, 0x72, 0x01, 0x08, 0x08,
+ 0xdc, 0x08, 0x08, 0x08, 0x35, 0x80, 0x80, 0xa0, 0xaf, 0x80, 0x08, 0x30, 0x17, 0x88, 0x80, 0xc8,
+ 0x8c, 0x80, 0x80, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x08, 0x08, 0x08, 0x44, 0x08, 0x80, 0x88, 0xaf,
+ 0x7f, 0xf3, 0x42, 0x00, 0x08, 0x80, 0x62, 0x00, 0x08, 0x88, 0xcc, 0x80, 0x08, 0x00, 0x27, 0x88,
+ 0x80, 0xa0, 0x8f, 0x08, 0x08, 0x30, 0x05, 0x08, 0x08, 0xe9, 0x0b, 0x80, 0x00, 0x72, 0x81, 0x00,
+ 0x09, 0xdc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x90, 0xa0, 0x9f, 0x80, 0x00, 0x30, 0x06, 0x08, 0x88,
+ 0xd8, 0x0b, 0x88, 0x00, 0x72, 0x82, 0x00, 0x09, 0xec, 0x08, 0x08, 0x00, 0x25, 0x80, 0x80, 0x98,
+ 0xaf, 0x80, 0x00, 0x30, 0x07, 0x08, 0x88, 0xd0, 0x0b, 0x88, 0x81, 0x71, 0x82, 0x80, 0x08, 0xfb,
+ 0x88, 0x00, 0x08, 0x35, 0x08, 0x90, 0x90, 0xaf, 0x08, 0x00, 0x38, 0x07, 0x80, 0x08, 0xc8, 0x8c,
+ 0x80, 0x00, 0x71, 0x81, 0x00, 0x88, 0xea, 0x09, 0x08, 0x80, 0x45, 0x08, 0x08, 0x98, 0xae, 0x00,
+ 0x08, 0x38, 0x17, 0x08, 0x88, 0xb8, 0x8e, 0x08, 0x80, 0x61, 0x82, 0x00, 0x88, 0xfa, 0x09, 0x08,
+ 0x08, 0x44, 0x00, 0x88, 0x90, 0xaf, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x80, 0x80,
+ 0x61, 0x02, 0x08, 0x88, 0xf9, 0x89, 0x80, 0x80, 0x54, 0x80, 0x80, 0x88, 0xad, 0x88, 0x00, 0x28,
+ 0x27, 0x08, 0x88, 0xc0, 0x8d, 0x08, 0x08, 0x60, 0x02, 0x80, 0x08, 0xfa, 0x89, 0x80, 0x00, 0x63,
+ 0x00, 0x80, 0x88, 0xae, 0x88, 0x00, 0x28, 0x17, 0x00, 0x98, 0xb0, 0x8e, 0x88, 0x81, 0x50, 0x03,
+ 0x00, 0x09, 0xfa, 0x8a, 0x08, 0x81, 0x73, 0x81, 0x80, 0x88, 0xbd, 0x08, 0x18, 0x18, 0x37, 0x08,
+ 0x88, 0xb8, 0x9f, 0x80, 0x00, 0x58, 0x84, 0x80, 0x08, 0xf8, 0x89, 0x00, 0x88, 0x53, 0x01, 0x88,
+ 0x80, 0xcb, 0x00, 0x08, 0x18, 0x35, 0x08, 0x89, 0xb0, 0xaf, 0x80, 0x81, 0x40, 0x05, 0x88, 0x08,
+ 0xe9, 0x8a, 0x00, 0x80, 0x72, 0x01, 0x88, 0x08, 0xcc, 0x09, 0x80, 0x00, 0x36, 0x08, 0x88, 0xb0,
+ 0x9b, 0xfd, 0x33, 0x00, 0x8b, 0x00, 0x01, 0x77, 0x80, 0x80, 0x98, 0xbc, 0x80, 0x00, 0x30, 0x27,
+ 0x88, 0x90, 0xc8, 0x8d, 0x08, 0x00, 0x60, 0x83, 0x08, 0x88, 0xfa, 0x0a, 0x00, 0x80, 0x73, 0x80,
+ 0x80, 0x80, 0xbd, 0x80, 0x00, 0x18, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x08, 0x40, 0x04, 0x08,
+ 0x88, 0xf8, 0x0a, 0x08, 0x80, 0x72, 0x00, 0x08, 0x88, 0xdb, 0x88, 0x00, 0x18, 0x27, 0x08, 0x88,
+ 0xb0, 0x8f, 0x80, 0x80, 0x40, 0x84, 0x80, 0x08, 0xe9, 0x0a, 0x08, 0x80, 0x73, 0x81, 0x08, 0x88,
+ 0xcc, 0x08, 0x08, 0x00, 0x27, 0x08, 0x88, 0xa0, 0x8f, 0x08, 0x08, 0x30, 0x05, 0x08, 0x08, 0xf9,
+ 0x0a, 0x80, 0x80, 0x72, 0x81, 0x08, 0x08, 0xcc, 0x08, 0x08, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f,
+ 0x00, 0x08, 0x48, 0x04, 0x08, 0x08, 0xf8, 0x0a, 0x08, 0x80, 0x62, 0x81, 0x80, 0x08, 0xdc, 0x08,
+ 0x08, 0x08, 0x36, 0x88, 0x80, 0x90, 0xaf, 0x00, 0x08, 0x48, 0x05, 0x08, 0x88, 0xd8, 0x0b, 0x80,
+ 0x80, 0x72, 0x82, 0x80, 0x08, 0xec, 0x08, 0x80, 0x80, 0x35, 0x08, 0x88, 0x90, 0xaf, 0x00, 0x08,
+ 0x38, 0x07, 0x08, 0x08, 0xc8, 0x0c, 0x80, 0x80, 0x70, 0x81, 0x00, 0x08, 0xeb, 0x08, 0x88, 0x00,
+ 0x44, 0x80, 0x80, 0x90, 0xaf, 0x80, 0x00, 0x28, 0x17, 0x08, 0x88, 0xc0, 0x8c, 0x80, 0x80, 0x71,
+ 0x01, 0x08, 0x88, 0xea, 0x09, 0x80, 0x00, 0x54, 0x08, 0x88, 0x80, 0xae, 0x80, 0x00, 0x28, 0x17,
+ 0x88, 0x80, 0xb8, 0x8e, 0x80, 0x00, 0x60, 0x82, 0x80, 0x08, 0xfa, 0x09, 0x80, 0x80, 0x44, 0x80,
+ 0x80, 0x08, 0xaf, 0x80, 0x00, 0x18, 0x17, 0x88, 0x80, 0xb0, 0x8d, 0x08, 0x08, 0x60, 0x83, 0x08,
+ 0x08, 0xfa, 0x0a, 0x00, 0x80, 0x73, 0x80, 0x80, 0x88, 0xcc, 0x00, 0x08, 0x28, 0x17, 0x08, 0x88,
+ 0xc9, 0x06, 0x38, 0x00, 0xdb, 0x08, 0x08, 0x08, 0x36, 0x88, 0x80, 0xa0, 0x9f, 0x08, 0x08, 0x30,
+ 0x07, 0x08, 0x88, 0xd0, 0x0b, 0x08, 0x80, 0x71, 0x82, 0x80, 0x08, 0xfb, 0x08, 0x08, 0x08, 0x44,
+ 0x08, 0x08, 0x98, 0xae, 0x80, 0x80, 0x30, 0x17, 0x08, 0x88, 0xd0, 0x8b, 0x08, 0x08, 0x71, 0x02,
+ 0x08, 0x08, 0xfa, 0x89, 0x80, 0x80, 0x54, 0x80, 0x80, 0x80, 0xae, 0x80, 0x08, 0x28, 0x17, 0x08,
+ 0x08, 0xb8, 0x8e, 0x80, 0x80, 0x60, 0x82, 0x00, 0x88, 0xf9, 0x09, 0x08, 0x08, 0x63, 0x80, 0x80,
+ 0x08, 0xbd, 0x08, 0x08, 0x10, 0x27, 0x08, 0x88, 0xb0, 0x8f, 0x08, 0x08, 0x50, 0x83, 0x80, 0x08,
+ 0xf9, 0x0a, 0x08, 0x88, 0x64, 0x80, 0x80, 0x08, 0xad, 0x08, 0x08, 0x18, 0x17, 0x80, 0x80, 0xb0,
+ 0x8e, 0x08, 0x08, 0x68, 0x02, 0x08, 0x08, 0xf9, 0x89, 0x80, 0x80, 0x73, 0x80, 0x80, 0x80, 0xbc,
+ 0x08, 0x08, 0x18, 0x37, 0x88, 0x80, 0xb0, 0x9f, 0x80, 0x80, 0x50, 0x84, 0x08, 0x08, 0xf8, 0x09,
+ 0x88, 0x80, 0x72, 0x80, 0x80, 0x80, 0xdb, 0x80, 0x80, 0x00, 0x26, 0x08, 0x88, 0xa0, 0x9f, 0x00,
+ 0x08, 0x48, 0x04, 0x08, 0x08, 0xe9, 0x0a, 0x88, 0x00, 0x72, 0x81, 0x80, 0x18, 0xcd, 0x80, 0x80,
+ 0x00, 0x35, 0x08, 0x88, 0xa0, 0xaf, 0x80, 0x00, 0x48, 0x06, 0x08, 0x88, 0xd8, 0x0a, 0x88, 0x80,
+ 0x72, 0x01, 0x08, 0x08, 0xfb, 0x08, 0x08, 0x88, 0x26, 0x08, 0x90, 0x90, 0x9e, 0x08, 0x08, 0x48,
+ 0x05, 0x08, 0x08, 0xd8, 0x8b, 0x80, 0x00, 0x71, 0x82, 0x00, 0x09, 0xfb, 0x09, 0x08, 0x00, 0x35,
+ 0x80, 0x80, 0x98, 0xaf, 0x80, 0x08, 0x38, 0x17, 0x08, 0x08, 0xd8, 0x8b, 0x80, 0x80, 0x71, 0x83,
+ 0x80, 0x08, 0xfb, 0x09, 0x08, 0x08, 0x35, 0x00, 0x88, 0x90, 0xbf, 0x80, 0x00, 0x48, 0x06, 0x08,
+ 0x9c, 0x06, 0x39, 0x00, 0x08, 0xcc, 0x80, 0x00, 0x18, 0x26, 0x88, 0x90, 0xa0, 0x8f, 0x88, 0x00,
+ 0x40, 0x84, 0x00, 0x09, 0xf8, 0x0a, 0x08, 0x80, 0x72, 0x80, 0x00, 0x88, 0xdb, 0x80, 0x08, 0x18,
+ 0x36, 0x08, 0x98, 0xb1, 0x9f, 0x80, 0x18, 0x48, 0x05, 0x08, 0x88, 0xe8, 0x0a, 0x08, 0x80, 0x72,
+ 0x81, 0x08, 0x88, 0xeb, 0x08, 0x80, 0x80, 0x36, 0x88, 0x80, 0x98, 0x9f, 0x80, 0x00, 0x38, 0x06,
+ 0x08, 0x08, 0xe8, 0x8a, 0x80, 0x00, 0x71, 0x81, 0x80, 0x08, 0xeb, 0x08, 0x08, 0x08, 0x45, 0x88,
+ 0x80, 0x90, 0xae, 0x00, 0x08, 0x38, 0x17, 0x88, 0x08, 0xc8, 0x0c, 0x08, 0x80, 0x71, 0x81, 0x80,
+ 0x08, 0xfa, 0x08, 0x08, 0x80, 0x34, 0x80, 0x90, 0xa1, 0xaf, 0x80, 0x00, 0x38, 0x17, 0x08, 0x89,
+ 0xc0, 0x0d, 0x08, 0x80, 0x61, 0x82, 0x08, 0x88, 0xfa, 0x09, 0x18, 0x80, 0x63, 0x80, 0x80, 0x88,
+ 0xbd, 0x80, 0x00, 0x38, 0x17, 0x80, 0x88, 0xc0, 0x8d, 0x80, 0x00, 0x60, 0x93, 0x00, 0x08, 0xfb,
+ 0x89, 0x00, 0x80, 0x54, 0x80, 0x08, 0x88, 0xae, 0x80, 0x00, 0x28, 0x17, 0x88, 0x90, 0xb1, 0x8f,
+ 0x00, 0x80, 0x58, 0x02, 0x08, 0x09, 0xf9, 0x09, 0x08, 0x80, 0x63, 0x80, 0x80, 0x08, 0xae, 0x80,
+ 0x80, 0x28, 0x17, 0x08, 0x08, 0xb8, 0x8e, 0x80, 0x00, 0x58, 0x03, 0x08, 0x88, 0xf9, 0x0a, 0x88,
+ 0x00, 0x73, 0x00, 0x90, 0x90, 0xdb, 0x08, 0x19, 0x10, 0x27, 0x08, 0xa0, 0xb0, 0x8f, 0x90, 0x11,
+ 0x58, 0x83, 0x80, 0x09, 0xf9, 0x0b, 0x00, 0x80, 0x23, 0x0d, 0x90, 0x80, 0x88, 0x80, 0x11, 0x19,
+ 0x81, 0x81, 0x1a, 0x91, 0x3b, 0x12, 0x09, 0x45, 0x98, 0x23, 0x9c, 0x90, 0xb1, 0x48, 0x81, 0x27,
+ 0x11, 0x0c, 0xb0, 0x9a, 0x4a, 0x03, 0x15, 0x08, 0x82, 0xbb, 0x08, 0x8f, 0x03, 0x44, 0x01, 0xc8,
+ 0x45, 0xff, 0x1d, 0x00, 0xd0, 0x88, 0x98, 0x01, 0x52, 0x01, 0x28, 0xb9, 0x99, 0xc1, 0x41, 0x22,
+ 0xa3, 0x39, 0xfa, 0x31, 0x9d, 0x81, 0x93, 0x8a, 0x12, 0x70, 0x18, 0xc9, 0x58, 0xb9, 0x93, 0x88,
+ 0x88, 0x63, 0x10, 0x22, 0x0c, 0xab, 0xf8, 0x82, 0x49, 0x82, 0x78, 0x1a, 0xd1, 0x09, 0x92, 0x89,
+ 0x40, 0x1a, 0x94, 0x00, 0xa9, 0x92, 0x8a, 0x4b, 0xb9, 0x01, 0x73, 0x94, 0x2b, 0xd0, 0x8a, 0x80,
+ 0x24, 0x58, 0x81, 0xb9, 0x30, 0xf8, 0x99, 0x31, 0x9b, 0x06, 0x10, 0x8b, 0xb8, 0x98, 0x7b, 0x95,
+ 0x28, 0xa1, 0x90, 0x0d, 0x84, 0xa9, 0x42, 0x89, 0xb9, 0x23, 0xaa, 0x16, 0x31, 0xbb, 0xb3, 0xaf,
+ 0x99, 0x03, 0x43, 0x12, 0x99, 0x8c, 0x9a, 0xa4, 0x58, 0x91, 0x0a, 0xa3, 0x0a, 0x3c, 0x87, 0x01,
+ 0xac, 0xa9, 0x3a, 0x49, 0xa6, 0x78, 0xb8, 0xc2, 0x38, 0x9a, 0x21, 0x52, 0x19, 0xb2, 0xc0, 0xbb,
+ 0x9a, 0x38, 0x7a, 0x23, 0xb3, 0x10, 0xaf, 0xac, 0x13, 0x4a, 0x03, 0x01, 0x80, 0x88, 0xb1, 0x1f,
+ 0xa8, 0x88, 0x10, 0xf2, 0x22, 0x69, 0x89, 0xa0, 0xa0, 0x1a, 0x94, 0x23, 0x71, 0x18, 0xb9, 0x29,
+ 0x0b, 0xe3, 0x85, 0x11, 0x40, 0x09, 0x8e, 0xb8, 0xa1, 0x1b, 0x22, 0x25, 0x98, 0xc8, 0x1a, 0x9d,
+ 0x03, 0x51, 0x80, 0x11, 0x02, 0x8b, 0xc1, 0x0e, 0xb9, 0x01, 0x71, 0xc1, 0x43, 0x89, 0x8a, 0xc8,
+ 0x9b, 0x12, 0x00, 0x44, 0x90, 0x8a, 0xf1, 0x10, 0x0b, 0x1a, 0x07, 0x09, 0x00, 0x19, 0x1b, 0xf3,
+ 0x01, 0x80, 0x39, 0xa0, 0x19, 0x2f, 0x11, 0xd1, 0x92, 0x89, 0x0c, 0x58, 0xb1, 0x02, 0x87, 0x19,
+ 0x00, 0x2d, 0x08, 0x92, 0x81, 0xbb, 0x23, 0x99, 0x12, 0xcb, 0x78, 0xa9, 0x3b, 0xf3, 0x2b, 0x11,
+ 0x08, 0x30, 0xa4, 0x21, 0x07, 0x8d, 0x98, 0x08, 0x20, 0x21, 0x7a, 0xa1, 0x96, 0x99, 0x00, 0xdb,
+ 0xec, 0xff, 0x0f, 0x00, 0x03, 0x08, 0x42, 0x90, 0x99, 0x19, 0xf0, 0x39, 0x09, 0x83, 0x3a, 0x0a,
+ 0xd5, 0x92, 0x2c, 0x08, 0x82, 0xa0, 0xaa, 0x0d, 0x61, 0x8a, 0x92, 0x12, 0x22, 0x8f, 0xa0, 0x90,
+ 0x7a, 0xb2, 0x20, 0x21, 0x9c, 0x04, 0x9b, 0x0a, 0xc3, 0x10, 0x23, 0x70, 0x91, 0x8b, 0xc3, 0xac,
+ 0xc8, 0x31, 0x39, 0x15, 0x21, 0xd9, 0xb1, 0x0c, 0x88, 0x87, 0x48, 0x28, 0x99, 0x89, 0xd9, 0xb1,
+ 0x02, 0x3a, 0x05, 0x5a, 0x80, 0x8b, 0xdb, 0x93, 0x80, 0x30, 0x03, 0x0f, 0xa0, 0xb8, 0x49, 0x00,
+ 0xc0, 0x53, 0xc2, 0x1b, 0x19, 0xd9, 0x89, 0x09, 0xa3, 0x35, 0x28, 0x99, 0xb1, 0x10, 0x1d, 0x9a,
+ 0x13, 0x73, 0x81, 0x92, 0x99, 0x09, 0x9f, 0x11, 0x18, 0x12, 0x95, 0x0a, 0xa9, 0x2a, 0x3c, 0x94,
+ 0x92, 0x33, 0xc2, 0x09, 0x9d, 0xa1, 0x60, 0x80, 0x90, 0x11, 0xba, 0x19, 0x29, 0x8c, 0x93, 0x99,
+};
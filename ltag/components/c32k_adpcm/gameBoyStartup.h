@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define GAMEBOYSTARTUP_BITS_PER_SAMPLE 4
+#define GAMEBOYSTARTUP_SAMPLE_RATE 32000
+#define GAMEBOYSTARTUP_SAMPLES 27014
+#define GAMEBOYSTARTUP_BYTES 13712
+
+extern const uint8_t gameBoyStartup[GAMEBOYSTARTUP_BYTES];
@@ -0,0 +1,2543 @@
+
+#include <stdint.h>
+
+const uint8_t gameOver[] = {
+ 0x4c, 0x53, 0x4e, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0xb6, 0x38, 0x01, 0x00,
+ 0x09, 0x00, 0x00, 0x00, 0xf5, 0xe2, 0x6e, 0x88, 0x99, 0x18, 0xa5, 0x08, 0x88, 0xaa, 0x51, 0x19,
+ 0x27, 0x09, 0xb9, 0xd0, 0x43, 0x98, 0x01, 0xab, 0x15, 0x0a, 0x00, 0xad, 0x14, 0xa9, 0xb0, 0x61,
+ 0x9b, 0x28, 0x8a, 0xfa, 0x83, 0x08, 0x1f, 0x12, 0xb1, 0x08, 0x0c, 0x15, 0xba, 0x11, 0x0a, 0x20,
+ 0xb0, 0xca, 0x51, 0xa3, 0xf9, 0x49, 0x38, 0x1a, 0x82, 0x05, 0xb2, 0x0a, 0x49, 0xb8, 0x99, 0x18,
+ 0x99, 0x22, 0x87, 0x72, 0x90, 0x19, 0xb2, 0x9a, 0x1b, 0x01, 0x8f, 0x04, 0xc9, 0x13, 0x1f, 0xc0,
+ 0x81, 0x09, 0x28, 0x00, 0xab, 0x17, 0x01, 0x08, 0x19, 0x9b, 0x52, 0xd8, 0x88, 0x30, 0x98, 0x85,
+ 0x0d, 0x00, 0xa2, 0x1a, 0x9b, 0x85, 0x4b, 0x93, 0xdb, 0x51, 0x81, 0x98, 0x1d, 0x89, 0x97, 0x00,
+ 0x98, 0x00, 0x38, 0x08, 0x31, 0xfa, 0x88, 0x00, 0x8e, 0x32, 0xa1, 0x31, 0xa1, 0x9a, 0x12, 0x49,
+ 0x07, 0x8f, 0x82, 0x23, 0x2c, 0xf2, 0x00, 0x81, 0x8a, 0x18, 0x8e, 0x83, 0x01, 0x10, 0xa3, 0x3b,
+ 0xea, 0x10, 0xa0, 0x42, 0x10, 0x9a, 0x38, 0x47, 0xbd, 0x2a, 0x06, 0x19, 0x88, 0xa9, 0x00, 0x72,
+ 0x09, 0x93, 0x09, 0xd8, 0xa1, 0x68, 0x3a, 0xa0, 0xa8, 0xe0, 0x3a, 0xf2, 0x47, 0x28, 0x4d, 0xeb,
+ 0xa0, 0x90, 0x21, 0x1a, 0x88, 0xaa, 0x21, 0x20, 0x43, 0x97, 0x81, 0x29, 0x2c, 0x98, 0x94, 0x85,
+ 0x29, 0x18, 0x9c, 0x82, 0x33, 0x19, 0xb8, 0xf2, 0x88, 0x3c, 0xa0, 0x00, 0xb2, 0x09, 0xaa, 0xa9,
+ 0x22, 0x7d, 0x99, 0xc2, 0xa3, 0x8b, 0x70, 0x2a, 0xd1, 0x82, 0x80, 0x4d, 0x81, 0xe8, 0x85, 0x1a,
+ 0x4a, 0x9a, 0x82, 0xb0, 0x93, 0xaa, 0x60, 0xac, 0x22, 0x89, 0x02, 0x3a, 0x87, 0x80, 0x28, 0x8b,
+ 0xb8, 0x87, 0x4b, 0x90, 0x91, 0xc1, 0x7a, 0x91, 0x48, 0xb8, 0x94, 0xf1, 0x31, 0x0d, 0x01, 0xb0,
+ 0x84, 0x00, 0x2f, 0x00, 0x91, 0x39, 0xb0, 0x78, 0xba, 0x93, 0x88, 0x38, 0x8d, 0x84, 0x88, 0x92,
+ 0x19, 0x8a, 0x1c, 0x87, 0x0b, 0xa4, 0x08, 0x20, 0x2a, 0x02, 0xbb, 0x27, 0x0c, 0x12, 0xca, 0x02,
+ 0x09, 0x49, 0x91, 0x1b, 0x96, 0x91, 0x21, 0xdd, 0x39, 0xa0, 0x51, 0xd2, 0x2a, 0x89, 0x9a, 0x84,
+ 0x38, 0x20, 0xf0, 0x09, 0x89, 0x69, 0x90, 0x22, 0xf2, 0x0a, 0xb2, 0x3a, 0x13, 0x39, 0xfa, 0x20,
+ 0xad, 0x84, 0x92, 0x40, 0x0b, 0x0b, 0x83, 0x09, 0x37, 0x9c, 0x01, 0xab, 0x12, 0xca, 0x25, 0x1a,
+ 0x48, 0xb9, 0xd4, 0x31, 0x4b, 0x91, 0xb3, 0x01, 0x1e, 0x89, 0xb9, 0xb8, 0x62, 0x9a, 0x44, 0x31,
+ 0x81, 0x39, 0xf8, 0xad, 0x99, 0x18, 0x29, 0x24, 0xfb, 0x19, 0xa8, 0x18, 0xb3, 0x04, 0x19, 0x58,
+ 0x89, 0x31, 0x92, 0x11, 0x41, 0x81, 0x14, 0x11, 0x69, 0xd0, 0x72, 0x9b, 0x83, 0xa1, 0x79, 0x8a,
+ 0xb2, 0xa9, 0x11, 0x2f, 0x81, 0x88, 0xb0, 0x90, 0x82, 0x6c, 0x81, 0xcb, 0x01, 0x0d, 0x00, 0x00,
+ 0xb4, 0x89, 0x6a, 0x70, 0x90, 0x90, 0xb6, 0x2d, 0x19, 0xb8, 0x03, 0x88, 0x0a, 0x32, 0xaa, 0x0b,
+ 0x97, 0x88, 0x38, 0x19, 0x9b, 0x07, 0x92, 0x41, 0x1a, 0xe0, 0x20, 0x82, 0x2c, 0x81, 0x02, 0xf2,
+ 0x8a, 0x02, 0x1f, 0x81, 0x80, 0x98, 0x9b, 0x18, 0x93, 0x58, 0x88, 0xa8, 0xb0, 0x11, 0x6a, 0xb8,
+ 0x86, 0x1a, 0x0a, 0x9a, 0x05, 0x40, 0x14, 0xf2, 0x89, 0x31, 0x99, 0x3b, 0x83, 0xf8, 0x02, 0x00,
+ 0x39, 0x0f, 0xa2, 0x05, 0x98, 0x1a, 0x2b, 0x80, 0xd3, 0x41, 0xa9, 0x08, 0x90, 0x13, 0x4d, 0x03,
+ 0x1d, 0x81, 0xf9, 0x00, 0x4b, 0x10, 0xab, 0x04, 0xab, 0x84, 0xb9, 0x7b, 0xa9, 0x12, 0x00, 0x98,
+ 0xfb, 0x30, 0x10, 0x1b, 0xa3, 0x0d, 0x93, 0x3a, 0x11, 0xb1, 0x07, 0x4c, 0x80, 0x92, 0x10, 0x11,
+ 0xb6, 0x01, 0x26, 0x00, 0x4a, 0x89, 0xa3, 0x1c, 0x10, 0x15, 0xb2, 0x4b, 0xd8, 0x8b, 0x94, 0x2a,
+ 0x93, 0x4b, 0xc9, 0xa9, 0x81, 0x28, 0x88, 0x98, 0x4c, 0xd0, 0x01, 0x9f, 0x3a, 0x87, 0x99, 0x28,
+ 0x19, 0x9a, 0x85, 0x10, 0xba, 0x82, 0x6d, 0x01, 0xd0, 0x01, 0x11, 0x0b, 0x30, 0xc3, 0x9c, 0x48,
+ 0x91, 0x90, 0x39, 0xb3, 0x2d, 0xb1, 0x4a, 0x17, 0x0a, 0xa3, 0x0d, 0x90, 0x00, 0x02, 0xda, 0x28,
+ 0xc0, 0x3a, 0x2a, 0x11, 0xb6, 0xba, 0xb1, 0x9f, 0x84, 0x08, 0x1a, 0xb1, 0xb1, 0x0a, 0x58, 0x99,
+ 0x1a, 0xa6, 0x00, 0x10, 0x71, 0xc8, 0x01, 0x21, 0xa1, 0x1a, 0x08, 0x54, 0x97, 0x10, 0x89, 0xab,
+ 0x0b, 0x85, 0x04, 0x18, 0xb9, 0x49, 0x98, 0x59, 0x86, 0x80, 0x09, 0x13, 0x2c, 0x84, 0x0c, 0xa0,
+ 0x98, 0x04, 0x81, 0xca, 0x1f, 0x00, 0x10, 0xf3, 0x18, 0x81, 0x3a, 0xb1, 0x81, 0xb1, 0x70, 0x8a,
+ 0x33, 0xc9, 0x18, 0x28, 0x8a, 0x92, 0x07, 0x99, 0x7a, 0x2a, 0x93, 0x18, 0x95, 0x98, 0x2b, 0x40,
+ 0x95, 0x40, 0xca, 0x91, 0x5b, 0xa0, 0x08, 0x02, 0x0d, 0xc3, 0x30, 0xb8, 0x79, 0xa0, 0x38, 0xf8,
+ 0x00, 0xa9, 0x00, 0x91, 0x88, 0x9e, 0x08, 0x90, 0x9a, 0xab, 0x83, 0xf0, 0x90, 0x9b, 0x99, 0x8d,
+ 0xab, 0xa1, 0xca, 0xc1, 0x9b, 0x8c, 0x9f, 0x86, 0x1b, 0xb0, 0x11, 0xbc, 0x3b, 0xc1, 0x91, 0x62,
+ 0x89, 0x91, 0x98, 0x9a, 0x0d, 0x15, 0x09, 0x20, 0x9c, 0x94, 0x4c, 0x87, 0x99, 0x91, 0x9d, 0x21,
+ 0x50, 0x92, 0x01, 0xca, 0x29, 0xdb, 0x90, 0x40, 0x01, 0x88, 0xb8, 0x9f, 0x03, 0x75, 0x63, 0x32,
+ 0x02, 0x80, 0xaa, 0x18, 0x43, 0x36, 0x13, 0x12, 0x20, 0x02, 0xa8, 0xba, 0xcf, 0x99, 0x09, 0xa9,
+ 0xa9, 0xbc, 0xbc, 0xeb, 0xdb, 0xac, 0xa9, 0x88, 0x10, 0x88, 0x99, 0xcb, 0xac, 0x89, 0x18, 0x41,
+ 0x50, 0xf2, 0x29, 0x00, 0x51, 0x22, 0x41, 0x82, 0x33, 0x11, 0x55, 0x21, 0x32, 0x21, 0x12, 0x11,
+ 0x81, 0x9b, 0x8d, 0x8b, 0x15, 0x24, 0x80, 0xda, 0xae, 0x9c, 0xaa, 0xa9, 0x8a, 0xb9, 0x88, 0xaa,
+ 0xbf, 0xac, 0x9a, 0xcb, 0xd9, 0x89, 0x8a, 0x80, 0x12, 0xba, 0xaf, 0xa9, 0x91, 0x41, 0x21, 0x45,
+ 0x22, 0x42, 0x03, 0x51, 0x01, 0x01, 0x35, 0x32, 0x27, 0x10, 0x1a, 0xb9, 0xb2, 0x1c, 0x09, 0xc4,
+ 0x40, 0xdd, 0xaa, 0xbc, 0x8a, 0xd9, 0xa8, 0xad, 0x10, 0x31, 0x77, 0x33, 0x24, 0x11, 0xa0, 0x9c,
+ 0xa8, 0x58, 0x43, 0x34, 0x12, 0x11, 0xc9, 0x8b, 0xbc, 0x99, 0xaa, 0x98, 0x99, 0x91, 0xdd, 0xc9,
+ 0xad, 0xbb, 0xba, 0x89, 0x19, 0x23, 0x52, 0x82, 0xa9, 0xdc, 0xaa, 0x09, 0x73, 0x33, 0x35, 0x21,
+ 0x11, 0x18, 0x00, 0x32, 0x24, 0x44, 0x23, 0x23, 0xb0, 0xba, 0x9f, 0x08, 0x99, 0x89, 0xa9, 0x91,
+ 0x09, 0xfe, 0xba, 0xcd, 0xaa, 0x9a, 0x00, 0x19, 0x80, 0xaa, 0xbb, 0xcc, 0xa9, 0x1b, 0x00, 0x26,
+ 0x13, 0x23, 0x20, 0x12, 0x41, 0x14, 0x72, 0x34, 0x25, 0x33, 0x12, 0x20, 0x00, 0x12, 0x73, 0x22,
+ 0x21, 0x80, 0x99, 0xb9, 0x88, 0xb9, 0x88, 0xff, 0xba, 0xac, 0xac, 0xb8, 0x9b, 0xcb, 0xd9, 0xab,
+ 0x9b, 0xac, 0x18, 0x9a, 0xa0, 0xca, 0xf8, 0x9d, 0xb9, 0x9b, 0x9a, 0xb8, 0xa9, 0x32, 0x30, 0x84,
+ 0x19, 0xcc, 0x77, 0x47, 0x44, 0x22, 0x01, 0xa9, 0xbb, 0x8a, 0x44, 0x35, 0x33, 0x82, 0xa9, 0xaa,
+ 0xbc, 0xcb, 0xab, 0x9a, 0x11, 0x11, 0xdc, 0xdb, 0xac, 0xab, 0xbb, 0xab, 0x9b, 0x11, 0x44, 0x23,
+ 0x90, 0xba, 0xbc, 0x8a, 0x40, 0x64, 0x45, 0x33, 0x33, 0x01, 0x98, 0x99, 0x10, 0x51, 0x35, 0x42,
+ 0x11, 0x99, 0xca, 0xcb, 0xbb, 0x89, 0x09, 0x21, 0x08, 0xf9, 0xac, 0xcd, 0xaa, 0x9b, 0x8a, 0x10,
+ 0x6d, 0xe5, 0x34, 0x00, 0x02, 0x01, 0xca, 0xcc, 0x9b, 0x08, 0x42, 0x43, 0x33, 0x42, 0x03, 0x00,
+ 0xa9, 0x1a, 0x45, 0x55, 0x32, 0x22, 0x01, 0x98, 0x99, 0x88, 0x41, 0x54, 0x22, 0x82, 0xa8, 0xbb,
+ 0x9c, 0x1a, 0x80, 0xc9, 0xfb, 0xab, 0xba, 0x9a, 0xbe, 0xda, 0xab, 0xab, 0x09, 0xa1, 0x0a, 0xea,
+ 0x8a, 0xd9, 0xab, 0xcc, 0x9a, 0xaa, 0xdc, 0xc9, 0x0a, 0x22, 0x72, 0x01, 0x99, 0xa8, 0x73, 0x77,
+ 0x43, 0x12, 0xa0, 0xcc, 0x9a, 0x30, 0x45, 0x12, 0x80, 0x89, 0x89, 0xa8, 0xca, 0xac, 0x89, 0x42,
+ 0x12, 0xb9, 0xcd, 0xaa, 0x89, 0x98, 0xbb, 0xaa, 0x21, 0x63, 0x23, 0x81, 0xb8, 0xcc, 0x9c, 0x28,
+ 0x45, 0x44, 0x22, 0x01, 0x00, 0x89, 0xa8, 0x08, 0x21, 0x47, 0x22, 0x80, 0xba, 0xbd, 0xba, 0x99,
+ 0x99, 0x18, 0x18, 0x13, 0xc9, 0xde, 0xbc, 0xb9, 0x89, 0x90, 0x31, 0x33, 0x26, 0xa8, 0xbc, 0xad,
+ 0x20, 0x32, 0x24, 0x01, 0x23, 0x31, 0x02, 0xbc, 0xab, 0x11, 0x57, 0x32, 0x33, 0x22, 0x90, 0xdb,
+ 0xac, 0x8a, 0x52, 0x44, 0x22, 0x81, 0xca, 0xac, 0xaa, 0x21, 0x24, 0x81, 0xca, 0xac, 0xa9, 0xb9,
+ 0xdc, 0x9a, 0x08, 0x10, 0xa8, 0xdb, 0x89, 0x00, 0x80, 0xdb, 0xfb, 0x8c, 0xaa, 0x08, 0x88, 0xd9,
+ 0xbb, 0x89, 0x68, 0x15, 0x10, 0x88, 0x76, 0x44, 0x25, 0x01, 0xc9, 0xac, 0x88, 0x52, 0x24, 0x11,
+ 0x88, 0x8a, 0x98, 0xba, 0xcc, 0x9a, 0x11, 0x34, 0x92, 0xeb, 0xcb, 0x9a, 0x98, 0x08, 0x99, 0x19,
+ 0x22, 0x24, 0x12, 0xa8, 0xcb, 0xac, 0x8a, 0x73, 0x36, 0x33, 0x23, 0x80, 0x88, 0xb9, 0x8a, 0x39,
+ 0x47, 0x33, 0x02, 0xcb, 0xcc, 0xab, 0xaa, 0x09, 0x88, 0x31, 0x80, 0xb1, 0xcf, 0xdb, 0x8b, 0x89,
+ 0x38, 0x10, 0x33, 0x22, 0x84, 0xdc, 0xba, 0x0a, 0x44, 0x33, 0x12, 0x10, 0x80, 0x00, 0xb8, 0xbb,
+ 0xa8, 0xf4, 0x2a, 0x00, 0x42, 0x45, 0x35, 0x22, 0x12, 0x90, 0xcd, 0xca, 0x88, 0x52, 0x35, 0x12,
+ 0x80, 0xbb, 0xad, 0x9a, 0x22, 0x43, 0x04, 0x99, 0xab, 0xcd, 0xab, 0x9a, 0x09, 0x22, 0x11, 0xbb,
+ 0xed, 0x9a, 0x0a, 0x81, 0xc9, 0xf9, 0xbb, 0xab, 0x89, 0xb9, 0xa9, 0x8e, 0x52, 0x32, 0x16, 0x63,
+ 0x56, 0x33, 0x82, 0xfb, 0xac, 0x18, 0x53, 0x14, 0x01, 0xa9, 0x8a, 0x88, 0x98, 0xcb, 0x9a, 0x42,
+ 0x43, 0x90, 0xdc, 0xab, 0x89, 0x00, 0x90, 0x99, 0x28, 0x63, 0x12, 0x98, 0xab, 0x9a, 0x88, 0x01,
+ 0x54, 0x36, 0x25, 0x02, 0x88, 0x9a, 0x88, 0x00, 0x11, 0x52, 0x34, 0x11, 0xfb, 0xcb, 0xab, 0x89,
+ 0x08, 0x00, 0x10, 0x00, 0xc0, 0xcd, 0xcb, 0x9a, 0x08, 0x11, 0x20, 0x44, 0x43, 0x82, 0xbc, 0xbd,
+ 0x28, 0x34, 0x24, 0x80, 0x08, 0x19, 0x12, 0xaa, 0xcc, 0x18, 0x53, 0x24, 0x81, 0x98, 0x89, 0x10,
+ 0x13, 0xba, 0xca, 0x78, 0x53, 0x23, 0xb8, 0xcc, 0x9a, 0x31, 0x14, 0xc0, 0xbc, 0xab, 0x11, 0x21,
+ 0xc9, 0xbe, 0x99, 0x10, 0xa2, 0x9b, 0x9f, 0x21, 0x23, 0x98, 0xdf, 0xab, 0x8a, 0x10, 0x81, 0x09,
+ 0xbc, 0x18, 0x25, 0x74, 0x25, 0x54, 0x22, 0x80, 0xdc, 0x9c, 0x00, 0x44, 0x23, 0x81, 0xb9, 0x9a,
+ 0xa8, 0xa8, 0xbc, 0x89, 0x53, 0x24, 0xa8, 0xbe, 0x9c, 0x09, 0x01, 0x88, 0x99, 0x20, 0x43, 0x13,
+ 0xa8, 0xac, 0x8a, 0x10, 0x32, 0x45, 0x45, 0x43, 0x01, 0x98, 0xa9, 0x89, 0x21, 0x32, 0x53, 0x03,
+ 0xb0, 0xde, 0xbc, 0xaa, 0x08, 0x00, 0x80, 0x88, 0x98, 0xc9, 0xad, 0xad, 0x88, 0x00, 0x12, 0x2b,
+ 0x25, 0x44, 0x82, 0xac, 0xbb, 0x48, 0x35, 0x23, 0x90, 0x8a, 0x19, 0x21, 0xc8, 0xbb, 0x18, 0x46,
+ 0x33, 0xa0, 0xda, 0x09, 0x21, 0x24, 0x88, 0xaa, 0x81, 0x73, 0x06, 0x98, 0xcb, 0x19, 0x43, 0x23,
+ 0x6d, 0x10, 0x32, 0x00, 0xcd, 0xbb, 0x09, 0x12, 0x81, 0xb9, 0x9f, 0xa0, 0x81, 0xa9, 0x9d, 0x0a,
+ 0x42, 0x94, 0xa9, 0xdf, 0xa9, 0x80, 0x10, 0x89, 0xa8, 0x20, 0x06, 0x75, 0x42, 0x44, 0x01, 0xb9,
+ 0xce, 0x09, 0x21, 0x36, 0x11, 0x98, 0xaa, 0x99, 0x99, 0xa8, 0x8c, 0x31, 0x44, 0x82, 0xeb, 0xbc,
+ 0x8a, 0x10, 0x11, 0x80, 0x09, 0x21, 0x24, 0x98, 0xcb, 0x9b, 0x10, 0x43, 0x33, 0x44, 0x44, 0x22,
+ 0x80, 0xca, 0x89, 0x28, 0x35, 0x22, 0x83, 0xa9, 0xbf, 0xbd, 0xab, 0x98, 0x11, 0x11, 0x00, 0xab,
+ 0xcb, 0xbe, 0xb9, 0x1c, 0x13, 0x52, 0xa1, 0x18, 0x11, 0x55, 0xa0, 0xa9, 0x9c, 0x63, 0x22, 0x03,
+ 0xba, 0xa9, 0x28, 0x00, 0xaa, 0x0a, 0x42, 0x37, 0x82, 0xca, 0xac, 0x29, 0x42, 0x33, 0x83, 0x88,
+ 0x91, 0x20, 0xaa, 0xcd, 0x08, 0x72, 0x35, 0x00, 0xfb, 0xcb, 0x8a, 0x10, 0x23, 0x80, 0xa8, 0x9d,
+ 0x89, 0xcc, 0xa8, 0x0b, 0x45, 0x12, 0xc8, 0xbf, 0xab, 0x09, 0x22, 0x33, 0x04, 0x18, 0x72, 0x55,
+ 0x34, 0x82, 0xeb, 0xac, 0x09, 0x63, 0x33, 0x01, 0xaa, 0x9b, 0x89, 0x99, 0xdb, 0x89, 0x53, 0x34,
+ 0xa1, 0xdc, 0xbb, 0x09, 0x11, 0x12, 0x88, 0x08, 0x42, 0x82, 0xb9, 0xcc, 0x89, 0x21, 0x24, 0x23,
+ 0x33, 0x24, 0x02, 0xb9, 0xbc, 0x8a, 0x61, 0x35, 0x33, 0x91, 0xeb, 0xcc, 0xbb, 0x99, 0x10, 0x11,
+ 0x12, 0x01, 0xc9, 0xcd, 0xbb, 0x89, 0x52, 0x23, 0x82, 0xab, 0x09, 0x54, 0x14, 0x99, 0xba, 0x58,
+ 0x34, 0x13, 0xca, 0xab, 0x1a, 0x24, 0x00, 0xc9, 0x09, 0x20, 0x03, 0xda, 0xbb, 0x20, 0x73, 0x05,
+ 0x88, 0x99, 0x31, 0x25, 0x04, 0xa9, 0xad, 0x09, 0x43, 0x14, 0x90, 0xcc, 0xbb, 0x8a, 0x80, 0x18,
+ 0x98, 0x20, 0x84, 0x9e, 0xfa, 0x8c, 0x20, 0x51, 0x82, 0xcb, 0xfb, 0x0a, 0x08, 0x11, 0x81, 0x21,
+ 0xdf, 0xe5, 0x36, 0x00, 0x30, 0x63, 0x64, 0x25, 0x01, 0xd9, 0xbc, 0x09, 0x72, 0x23, 0x01, 0xa9,
+ 0x9b, 0x8a, 0x09, 0xba, 0x08, 0x63, 0x24, 0xb1, 0xcd, 0xac, 0x19, 0x21, 0x01, 0x90, 0x09, 0x11,
+ 0x13, 0xb9, 0xbc, 0x1b, 0x32, 0x26, 0x13, 0x32, 0x23, 0x41, 0xa9, 0xba, 0x9b, 0x63, 0x46, 0x41,
+ 0x90, 0xbc, 0xeb, 0x8a, 0x89, 0x18, 0x08, 0x00, 0x98, 0xc8, 0xba, 0x9b, 0x29, 0x75, 0x01, 0xa0,
+ 0xad, 0x09, 0x44, 0x15, 0x80, 0xaa, 0x89, 0x23, 0x21, 0xd0, 0x8a, 0x18, 0x54, 0x00, 0xba, 0xad,
+ 0x09, 0x21, 0x02, 0x90, 0x28, 0x53, 0x33, 0xb0, 0xcc, 0x8b, 0x62, 0x43, 0x03, 0xb9, 0xba, 0x2a,
+ 0x12, 0xa0, 0xff, 0x9a, 0x18, 0x22, 0x84, 0xab, 0xbc, 0x8c, 0x80, 0x99, 0x00, 0x49, 0x25, 0xa1,
+ 0xdf, 0xbb, 0x9c, 0x22, 0x32, 0x14, 0x88, 0x18, 0x46, 0x65, 0x12, 0x90, 0xdc, 0x8a, 0x20, 0x45,
+ 0x12, 0x90, 0xab, 0x9a, 0x98, 0x88, 0x9a, 0x32, 0x36, 0x02, 0xec, 0xcb, 0x9a, 0x21, 0x22, 0x82,
+ 0x99, 0x89, 0x10, 0xa0, 0xb9, 0x9b, 0x54, 0x42, 0x22, 0x08, 0x21, 0x10, 0x82, 0x89, 0x88, 0x54,
+ 0x34, 0x33, 0x83, 0xcf, 0xcc, 0xab, 0x98, 0x22, 0x91, 0x90, 0xbd, 0xa8, 0x8d, 0xa8, 0x19, 0x43,
+ 0x17, 0x00, 0xd9, 0x9a, 0x09, 0x73, 0x02, 0x00, 0x98, 0x30, 0x81, 0x98, 0xaf, 0x08, 0x32, 0x25,
+ 0x80, 0xa9, 0xac, 0x9a, 0x99, 0x20, 0x43, 0x36, 0x21, 0x90, 0x9c, 0x9a, 0x41, 0x24, 0x82, 0xa9,
+ 0x8b, 0x30, 0x34, 0xd0, 0xce, 0xab, 0x99, 0x31, 0x01, 0x83, 0xab, 0xab, 0xfb, 0x8d, 0xdc, 0x20,
+ 0x28, 0x14, 0xd9, 0xbc, 0xac, 0x09, 0x22, 0x40, 0x83, 0x49, 0x26, 0x74, 0x13, 0x80, 0xfb, 0x9b,
+ 0x11, 0x45, 0x13, 0x80, 0xba, 0x9b, 0x98, 0x89, 0xa9, 0x40, 0x35, 0x13, 0xfa, 0xbc, 0x9b, 0x20,
+ 0x97, 0xf0, 0x42, 0x00, 0x13, 0x80, 0x99, 0x08, 0x01, 0xdb, 0xba, 0x19, 0x35, 0x34, 0x11, 0x00,
+ 0x89, 0x98, 0x9a, 0x01, 0x72, 0x43, 0x23, 0x12, 0xda, 0xdd, 0xab, 0x99, 0x21, 0x22, 0x01, 0xac,
+ 0xbd, 0xa9, 0x89, 0x80, 0x21, 0x72, 0x05, 0x08, 0xcc, 0x8a, 0x18, 0x36, 0x01, 0x00, 0x8a, 0x22,
+ 0x81, 0xc9, 0xbc, 0x48, 0x42, 0x33, 0x98, 0xdb, 0xaa, 0x09, 0x8a, 0x21, 0x60, 0x43, 0x12, 0xc8,
+ 0xaa, 0x0c, 0x42, 0x35, 0x90, 0xb8, 0xab, 0x19, 0x24, 0xa0, 0xcd, 0xcb, 0x08, 0x21, 0x08, 0xbb,
+ 0x89, 0x44, 0x80, 0xfb, 0xcd, 0x18, 0x00, 0x23, 0xbe, 0xc9, 0xab, 0x90, 0x19, 0x22, 0x73, 0x32,
+ 0x43, 0x37, 0x24, 0x01, 0xfb, 0xab, 0x10, 0x46, 0x23, 0x81, 0xca, 0x9a, 0x89, 0x08, 0xa0, 0x38,
+ 0x53, 0x23, 0xfa, 0xbc, 0x9c, 0x18, 0x23, 0x12, 0x99, 0x98, 0x09, 0x98, 0xcb, 0x9a, 0x41, 0x25,
+ 0x33, 0x10, 0x88, 0xa9, 0x89, 0x09, 0x46, 0x43, 0x24, 0x00, 0xb8, 0xcd, 0xca, 0x9a, 0x08, 0x42,
+ 0x01, 0xb8, 0xce, 0xaa, 0x09, 0x10, 0x10, 0x12, 0x12, 0xa1, 0xfb, 0x9f, 0x08, 0x42, 0x24, 0x00,
+ 0xb0, 0x88, 0x01, 0x11, 0xa8, 0x29, 0x52, 0x24, 0x91, 0xba, 0xad, 0x89, 0x28, 0x80, 0x41, 0x35,
+ 0x13, 0x04, 0xbd, 0x8b, 0x28, 0x27, 0x13, 0x90, 0xbc, 0x89, 0x29, 0x82, 0xc8, 0xec, 0x8a, 0x09,
+ 0x10, 0xa8, 0xab, 0xab, 0x45, 0x89, 0xf8, 0x9d, 0x00, 0x28, 0xd2, 0xae, 0xc9, 0x89, 0x09, 0x38,
+ 0x23, 0x63, 0x22, 0x22, 0x47, 0x13, 0x11, 0xfa, 0x8b, 0x21, 0x65, 0x13, 0x80, 0xca, 0x8a, 0x88,
+ 0x18, 0x90, 0x30, 0x22, 0x13, 0xdf, 0xbc, 0x9b, 0x21, 0x43, 0x82, 0x99, 0xba, 0x99, 0x98, 0x9a,
+ 0x18, 0x54, 0x23, 0x23, 0x88, 0xa8, 0x08, 0xa9, 0x72, 0x35, 0x45, 0x01, 0x90, 0xca, 0xaa, 0xcb,
+ 0x9b, 0x03, 0x38, 0x00, 0x90, 0x50, 0x81, 0x90, 0xce, 0xaa, 0x8a, 0x20, 0x02, 0x21, 0xa0, 0xa9,
+ 0xad, 0xbe, 0x28, 0x41, 0x36, 0x82, 0x90, 0xab, 0x18, 0x30, 0x33, 0x91, 0x43, 0x03, 0x02, 0xbd,
+ 0xba, 0x1b, 0x28, 0x05, 0x41, 0x33, 0x14, 0x20, 0xe0, 0x0a, 0xa8, 0x66, 0x81, 0x02, 0xbb, 0x9b,
+ 0xa9, 0x40, 0xb9, 0xbb, 0xeb, 0x1c, 0x01, 0x88, 0xd9, 0x8c, 0x9a, 0x27, 0x89, 0xaa, 0xcc, 0x10,
+ 0xa0, 0xfa, 0xac, 0xab, 0x89, 0x02, 0x19, 0x07, 0x20, 0x33, 0x40, 0x57, 0x32, 0x12, 0xd9, 0xab,
+ 0x28, 0x55, 0x34, 0x81, 0xa9, 0xab, 0x09, 0x18, 0x90, 0x88, 0x32, 0x23, 0xfa, 0xcf, 0xaa, 0x19,
+ 0x12, 0x12, 0xb8, 0x9a, 0x9b, 0x89, 0xa8, 0x99, 0x21, 0x36, 0x43, 0x22, 0x01, 0x02, 0x18, 0x01,
+ 0x65, 0x36, 0x21, 0x84, 0x8a, 0xcb, 0xbb, 0xaa, 0x89, 0x11, 0xa0, 0xfa, 0x9f, 0xaa, 0x99, 0x00,
+ 0xa0, 0x22, 0x80, 0x9b, 0xdd, 0x9c, 0x11, 0x45, 0x14, 0x00, 0xa9, 0x8b, 0x21, 0x43, 0x04, 0x80,
+ 0x01, 0x10, 0x02, 0x8e, 0xaa, 0x81, 0x51, 0x03, 0x21, 0x10, 0x48, 0x83, 0xb1, 0x8c, 0xb8, 0x72,
+ 0x34, 0x00, 0xf9, 0xab, 0xba, 0x12, 0x08, 0xd0, 0x8c, 0x98, 0x00, 0xc0, 0xbc, 0x8b, 0x61, 0x83,
+ 0x99, 0xbe, 0x89, 0x10, 0xeb, 0xdc, 0xbb, 0x8b, 0x88, 0x80, 0x34, 0x89, 0x16, 0x0a, 0x24, 0x74,
+ 0x27, 0x01, 0x81, 0xad, 0x09, 0x21, 0x27, 0x12, 0x80, 0xaa, 0x88, 0x9a, 0x98, 0x8a, 0x41, 0x43,
+ 0x83, 0xce, 0xdb, 0x9a, 0x18, 0x11, 0x82, 0x08, 0x99, 0x99, 0xb9, 0xbd, 0x99, 0x51, 0x42, 0x24,
+ 0x11, 0x00, 0xa8, 0x19, 0x11, 0x64, 0x33, 0x43, 0x02, 0x90, 0xdf, 0x9a, 0x9a, 0x10, 0x01, 0x90,
+ 0xaa, 0xbc, 0xcc, 0xab, 0x99, 0x20, 0x43, 0x82, 0x89, 0xcf, 0x08, 0x01, 0x45, 0x80, 0x88, 0x09,
+ 0x86, 0xf4, 0x33, 0x00, 0x24, 0x10, 0xb8, 0x8b, 0x43, 0x35, 0x02, 0x99, 0x9c, 0x10, 0x34, 0x82,
+ 0xa9, 0x08, 0x72, 0x34, 0xa1, 0xca, 0x9b, 0x20, 0x34, 0xb8, 0xbe, 0xaa, 0x20, 0x15, 0xa8, 0xde,
+ 0x0b, 0x80, 0x42, 0x90, 0x8a, 0xba, 0x31, 0xc2, 0xdb, 0x9d, 0x10, 0x32, 0xb2, 0xef, 0xba, 0x8a,
+ 0x88, 0x09, 0x84, 0x2c, 0x86, 0x09, 0x82, 0x29, 0x47, 0x62, 0x02, 0x08, 0xc9, 0x0a, 0x12, 0x54,
+ 0x13, 0x11, 0x98, 0x89, 0xca, 0x9b, 0xa9, 0x40, 0x24, 0x13, 0xfb, 0xbc, 0xac, 0x09, 0x10, 0x11,
+ 0x08, 0x80, 0x98, 0xaa, 0xcd, 0x9a, 0x28, 0x53, 0x34, 0x22, 0x02, 0x10, 0xa0, 0x80, 0x11, 0x73,
+ 0x36, 0x22, 0x91, 0xcd, 0xca, 0x9b, 0x98, 0x08, 0x81, 0x89, 0xa1, 0xcf, 0xb9, 0x9b, 0x88, 0x21,
+ 0x13, 0x30, 0xa1, 0x2d, 0x98, 0x31, 0x91, 0x90, 0x36, 0x75, 0x13, 0x21, 0x99, 0x80, 0x10, 0x10,
+ 0x90, 0x51, 0x34, 0x16, 0x01, 0xca, 0x9a, 0x09, 0x63, 0x01, 0x90, 0x98, 0x11, 0x88, 0xfb, 0xae,
+ 0x8a, 0x31, 0x24, 0x02, 0xdc, 0xaa, 0x8a, 0x00, 0x91, 0xaa, 0x09, 0x25, 0x00, 0xe8, 0xbe, 0x98,
+ 0x09, 0x00, 0xcb, 0xdc, 0xab, 0xa0, 0x0a, 0x10, 0xf8, 0x09, 0x10, 0x68, 0x17, 0x21, 0x26, 0x12,
+ 0x02, 0xcb, 0xa9, 0x28, 0x47, 0x23, 0x12, 0x98, 0x89, 0x9a, 0xaa, 0xcc, 0x09, 0x30, 0x25, 0xb0,
+ 0xcc, 0xcc, 0x99, 0x98, 0x88, 0x98, 0x21, 0x31, 0x01, 0xb9, 0xed, 0x99, 0x80, 0x32, 0x34, 0x63,
+ 0x32, 0x31, 0x82, 0x88, 0xb9, 0x8b, 0x30, 0x41, 0x06, 0x99, 0xcb, 0xdc, 0xba, 0xcc, 0xaa, 0x0a,
+ 0x01, 0x12, 0xa3, 0xac, 0xad, 0xaa, 0xaa, 0x88, 0x40, 0x37, 0x35, 0x00, 0xc8, 0x9a, 0x18, 0x43,
+ 0x24, 0x10, 0x01, 0x42, 0x12, 0xb8, 0xaa, 0x8c, 0x35, 0x32, 0x82, 0xa9, 0x29, 0x20, 0x25, 0xba,
+ 0x81, 0x08, 0x25, 0x00, 0x9c, 0x1b, 0x04, 0x98, 0xdc, 0x9a, 0x32, 0x01, 0xf8, 0xaf, 0xba, 0x29,
+ 0x11, 0x22, 0xcb, 0xa9, 0x9a, 0x22, 0xcf, 0xd8, 0x8b, 0x81, 0x9a, 0xf1, 0x9e, 0x99, 0xa9, 0x08,
+ 0xab, 0x82, 0x4b, 0x05, 0x51, 0x22, 0x72, 0x26, 0x21, 0x12, 0x8a, 0x89, 0x00, 0x26, 0x22, 0x24,
+ 0x20, 0x15, 0x81, 0xa9, 0xbf, 0xaa, 0x9b, 0x00, 0x89, 0x80, 0xa8, 0x90, 0xca, 0xcd, 0xad, 0xab,
+ 0x09, 0x20, 0x23, 0x33, 0x12, 0x82, 0x32, 0x50, 0x21, 0x14, 0x63, 0x33, 0x73, 0x02, 0x11, 0x10,
+ 0x10, 0xbb, 0xdd, 0xbc, 0xad, 0xaa, 0xaa, 0x80, 0x81, 0x18, 0x0a, 0xca, 0xda, 0xad, 0xba, 0x8b,
+ 0x09, 0x25, 0x53, 0x43, 0x21, 0x00, 0x02, 0x91, 0x08, 0xa8, 0x40, 0x73, 0x34, 0x41, 0x01, 0x82,
+ 0x00, 0x11, 0x91, 0xae, 0xb9, 0x28, 0x55, 0x20, 0x80, 0x98, 0x21, 0x10, 0x08, 0xfd, 0xba, 0x8a,
+ 0x00, 0xa9, 0xba, 0xaa, 0x36, 0x52, 0xb8, 0xce, 0xbb, 0x9a, 0x00, 0x10, 0x8a, 0xa0, 0x89, 0x9b,
+ 0xff, 0xbd, 0xbb, 0xa9, 0x09, 0x08, 0xb1, 0x31, 0x39, 0x07, 0x33, 0x73, 0x36, 0x43, 0x43, 0x22,
+ 0x22, 0x22, 0x23, 0x09, 0x90, 0x0c, 0x25, 0x31, 0x15, 0x99, 0xa0, 0xaf, 0x99, 0xbc, 0x99, 0xba,
+ 0xba, 0xbd, 0xbd, 0xba, 0xaa, 0x00, 0x31, 0x42, 0x91, 0x08, 0xb8, 0x28, 0x62, 0x44, 0x35, 0x33,
+ 0x14, 0x20, 0x91, 0x00, 0x18, 0x98, 0x03, 0xae, 0xb9, 0xbd, 0xbd, 0xfb, 0xaa, 0xba, 0x9a, 0xa9,
+ 0x89, 0x00, 0x28, 0x91, 0xf9, 0xab, 0xaa, 0x40, 0x23, 0x36, 0x90, 0x19, 0x03, 0x79, 0x24, 0x32,
+ 0x25, 0x12, 0x00, 0xb9, 0x1a, 0x80, 0x72, 0x05, 0x11, 0x01, 0x18, 0x33, 0x53, 0x12, 0x98, 0xc9,
+ 0xba, 0x89, 0x89, 0x21, 0x71, 0x83, 0xcb, 0xdd, 0xaa, 0x80, 0x40, 0x02, 0xa9, 0xbb, 0xae, 0xaa,
+ 0x47, 0xff, 0x26, 0x00, 0xca, 0xca, 0xab, 0xbd, 0xbc, 0xbd, 0xdb, 0xab, 0xa9, 0x8b, 0xc9, 0x9a,
+ 0x89, 0x19, 0x06, 0x18, 0x81, 0x29, 0x27, 0x42, 0x27, 0x34, 0x33, 0x24, 0x00, 0x10, 0x41, 0x45,
+ 0x33, 0x34, 0x01, 0x00, 0xc9, 0x8b, 0xaa, 0x20, 0x23, 0x01, 0xe8, 0xad, 0xaa, 0xab, 0x18, 0x18,
+ 0x23, 0xeb, 0xdb, 0xbd, 0xaa, 0x08, 0x31, 0x24, 0x23, 0x01, 0x10, 0x88, 0x80, 0x34, 0x81, 0x9a,
+ 0xfa, 0x8f, 0x9a, 0xac, 0xa0, 0xbb, 0xea, 0xbc, 0xbb, 0xab, 0x11, 0xa0, 0x80, 0xcd, 0xbb, 0xaa,
+ 0xbb, 0x09, 0x99, 0x13, 0x9b, 0x46, 0xab, 0x33, 0x10, 0x77, 0x02, 0x20, 0x88, 0x18, 0x24, 0x43,
+ 0x02, 0x89, 0x20, 0x41, 0x36, 0x23, 0x31, 0xb8, 0x0b, 0x82, 0x20, 0x77, 0x12, 0x13, 0x92, 0x9a,
+ 0x9c, 0x41, 0x23, 0x44, 0x82, 0x88, 0xdb, 0x99, 0x99, 0x39, 0x01, 0xfd, 0xcc, 0xcb, 0xbb, 0xac,
+ 0xa9, 0x09, 0xa9, 0xaa, 0xeb, 0x08, 0x88, 0x30, 0xa0, 0x22, 0x46, 0x55, 0x34, 0x42, 0x23, 0x02,
+ 0x23, 0x11, 0x55, 0x21, 0x43, 0x01, 0x00, 0xa8, 0xbb, 0xaa, 0x8a, 0x02, 0x90, 0xea, 0xae, 0xaa,
+ 0xba, 0x99, 0xca, 0x9d, 0xc9, 0x9e, 0xa9, 0x8a, 0x10, 0x21, 0x63, 0x01, 0x01, 0x11, 0x51, 0x13,
+ 0x33, 0x88, 0xd9, 0xbb, 0xbd, 0x98, 0xc8, 0x08, 0xbb, 0xbc, 0xcd, 0xba, 0xbb, 0x89, 0x21, 0x0a,
+ 0xb0, 0xdd, 0x8b, 0xca, 0x98, 0x09, 0x99, 0xdb, 0x81, 0x28, 0x70, 0x15, 0x00, 0x81, 0x8a, 0x99,
+ 0x99, 0x20, 0x44, 0x63, 0x22, 0x00, 0x90, 0x20, 0x25, 0x46, 0x33, 0x12, 0x80, 0xb8, 0x4a, 0x15,
+ 0x62, 0x12, 0x32, 0x89, 0xa0, 0xea, 0x9a, 0x18, 0x32, 0x47, 0x13, 0x00, 0xa0, 0x9b, 0xba, 0xdb,
+ 0xca, 0xeb, 0xba, 0xbf, 0xbc, 0xbc, 0xab, 0x98, 0x18, 0x88, 0x00, 0xa0, 0xb9, 0xac, 0x9a, 0x73,
+ 0x2a, 0xe9, 0x29, 0x00, 0x46, 0x34, 0x24, 0x33, 0x01, 0x10, 0x22, 0x64, 0x34, 0x43, 0x12, 0x08,
+ 0xa0, 0xab, 0xa9, 0x09, 0x10, 0x00, 0xca, 0xdd, 0x8b, 0xa9, 0x89, 0xa2, 0xad, 0xba, 0xde, 0x9b,
+ 0xaa, 0x08, 0x32, 0x33, 0x10, 0x00, 0x12, 0x31, 0x54, 0x00, 0x26, 0x00, 0x81, 0xcd, 0xca, 0x9a,
+ 0xda, 0x89, 0x9a, 0xab, 0xca, 0xb9, 0xbb, 0x0a, 0x0c, 0x80, 0x90, 0x9a, 0x39, 0xbe, 0xbb, 0xb8,
+ 0xf1, 0x2b, 0xb0, 0x6a, 0x11, 0x01, 0xc2, 0x08, 0x19, 0x29, 0x87, 0x60, 0x53, 0x01, 0xa9, 0x99,
+ 0x1b, 0x63, 0x32, 0x43, 0x90, 0x03, 0xc9, 0x20, 0x40, 0x62, 0x33, 0x42, 0x32, 0x00, 0x83, 0x2a,
+ 0x45, 0x48, 0x84, 0x21, 0x91, 0x19, 0xbc, 0x08, 0xbd, 0xb8, 0xcf, 0xba, 0xaf, 0xbc, 0xbc, 0xba,
+ 0x9a, 0x9a, 0x88, 0x18, 0x90, 0x89, 0xb8, 0x9c, 0x00, 0x72, 0x47, 0x44, 0x23, 0x24, 0x02, 0x11,
+ 0x13, 0x54, 0x33, 0x25, 0x12, 0x08, 0x98, 0xac, 0x98, 0x89, 0x11, 0xa0, 0xcc, 0xeb, 0x9a, 0x00,
+ 0x0a, 0x02, 0xbc, 0xb8, 0xcf, 0xba, 0xaa, 0x29, 0x22, 0x23, 0x13, 0x19, 0x22, 0x50, 0x34, 0x05,
+ 0x10, 0xa1, 0x0a, 0xf9, 0x9c, 0xba, 0xac, 0x9b, 0xb8, 0xcb, 0xb8, 0xad, 0xa1, 0x8c, 0x08, 0x10,
+ 0x98, 0x93, 0xcb, 0xa9, 0xcf, 0x98, 0x8b, 0x20, 0x00, 0x18, 0x04, 0xa8, 0x15, 0x8e, 0x23, 0x2a,
+ 0x25, 0x81, 0x53, 0x03, 0x20, 0xc0, 0x1b, 0x42, 0x33, 0x92, 0x82, 0x30, 0x01, 0x4f, 0x85, 0x44,
+ 0x12, 0x31, 0x31, 0x44, 0x31, 0x13, 0x41, 0x82, 0x12, 0x02, 0x1b, 0x61, 0x91, 0x0a, 0xf8, 0x9c,
+ 0xc8, 0xcc, 0xbc, 0xbd, 0xcc, 0xac, 0xaa, 0xbb, 0x88, 0x9b, 0x99, 0x9b, 0x90, 0x90, 0x9b, 0x82,
+ 0x28, 0x67, 0x54, 0x54, 0x32, 0x23, 0x12, 0x31, 0x35, 0x44, 0x43, 0x22, 0x12, 0x88, 0xa8, 0x9d,
+ 0xf5, 0x19, 0x30, 0x00, 0x08, 0x10, 0x00, 0xdb, 0xba, 0xb9, 0x0a, 0x88, 0x88, 0xf8, 0xbb, 0xce,
+ 0xac, 0x9a, 0x00, 0x21, 0x02, 0x00, 0x90, 0x18, 0x32, 0x36, 0x42, 0x82, 0x00, 0xdc, 0xab, 0xba,
+ 0x1a, 0xab, 0xfb, 0xe9, 0x9a, 0xb9, 0x09, 0x09, 0x23, 0xc0, 0x01, 0x9d, 0xc1, 0xa9, 0xab, 0x8d,
+ 0x88, 0xb0, 0xeb, 0x8a, 0x8c, 0x12, 0x82, 0x89, 0x35, 0x34, 0x23, 0x28, 0x21, 0x24, 0x27, 0xa1,
+ 0x40, 0xa8, 0x0a, 0xdb, 0xba, 0x81, 0x62, 0x44, 0x12, 0x52, 0x01, 0x30, 0x12, 0x54, 0x33, 0x43,
+ 0x21, 0x90, 0x09, 0x99, 0x51, 0x92, 0x63, 0x80, 0x09, 0xfb, 0x9a, 0x9a, 0x81, 0x81, 0xde, 0xcb,
+ 0xbe, 0xba, 0xbc, 0x9b, 0x9a, 0xa9, 0xb9, 0xcb, 0x09, 0xc9, 0x21, 0xa9, 0x40, 0x80, 0x73, 0x46,
+ 0x43, 0x34, 0x22, 0x32, 0x21, 0x45, 0x22, 0x43, 0x22, 0x10, 0x99, 0xcb, 0x89, 0x80, 0x10, 0xb8,
+ 0xad, 0xc9, 0x8b, 0x90, 0x8a, 0x91, 0xcc, 0xdc, 0xbc, 0x9d, 0x89, 0x08, 0x12, 0x90, 0x11, 0x9a,
+ 0x32, 0x64, 0x32, 0x24, 0x81, 0xb0, 0xac, 0x89, 0x98, 0x92, 0xae, 0xce, 0x99, 0xcb, 0x80, 0xb9,
+ 0x08, 0x8a, 0xa8, 0xcb, 0x9e, 0x98, 0x9a, 0xa9, 0xbf, 0x80, 0xc9, 0x9a, 0x09, 0x29, 0x21, 0x90,
+ 0x42, 0x63, 0x25, 0x01, 0x41, 0x12, 0x58, 0x92, 0x10, 0xb2, 0x98, 0xaa, 0x8c, 0x0e, 0x21, 0x40,
+ 0x17, 0x10, 0x34, 0x30, 0x14, 0x43, 0x31, 0x22, 0x12, 0x80, 0x9a, 0xaa, 0x11, 0x77, 0x20, 0x08,
+ 0x88, 0xd8, 0x18, 0xc9, 0x20, 0x81, 0x80, 0xff, 0xab, 0xdb, 0xab, 0xca, 0xaa, 0xb0, 0xab, 0xa9,
+ 0xca, 0x19, 0x99, 0x28, 0xe1, 0x3a, 0x82, 0x73, 0x47, 0x31, 0x24, 0x20, 0x32, 0x21, 0x24, 0x34,
+ 0x25, 0x12, 0x88, 0xa9, 0x9b, 0x01, 0x89, 0x00, 0x99, 0xaa, 0xfc, 0x9a, 0x9a, 0x21, 0x82, 0xe9,
+ 0x6b, 0x0c, 0x28, 0x00, 0xaf, 0xab, 0x9a, 0x08, 0x00, 0x11, 0x81, 0x8a, 0x02, 0x66, 0x33, 0x43,
+ 0x02, 0x98, 0xa8, 0x8c, 0x88, 0x9b, 0x00, 0xfe, 0xba, 0xac, 0x9b, 0x01, 0x89, 0x91, 0x9d, 0x90,
+ 0x9c, 0xa8, 0xbb, 0x19, 0xfb, 0xbb, 0xad, 0x9b, 0x18, 0x9a, 0x10, 0xa2, 0x65, 0x81, 0x31, 0x21,
+ 0x37, 0x01, 0x11, 0x00, 0x01, 0x08, 0x81, 0xbf, 0x88, 0x99, 0x18, 0x21, 0x36, 0x35, 0x22, 0x33,
+ 0x21, 0x37, 0x34, 0x32, 0x32, 0x03, 0x14, 0x8a, 0x20, 0x61, 0x24, 0x03, 0x10, 0xd9, 0x98, 0x8c,
+ 0xb9, 0x58, 0xa1, 0xd0, 0xec, 0xbc, 0xac, 0xbc, 0xaa, 0xbc, 0xa9, 0xcb, 0xa9, 0x9d, 0x89, 0x89,
+ 0x01, 0xbb, 0x90, 0x0a, 0x46, 0x54, 0x35, 0x32, 0x24, 0x21, 0x23, 0x63, 0x33, 0x63, 0x01, 0x01,
+ 0x90, 0x99, 0x08, 0x88, 0x10, 0x89, 0xb8, 0xeb, 0xb8, 0x0b, 0x33, 0x20, 0xfb, 0xec, 0xaa, 0x9b,
+ 0x98, 0x8b, 0x00, 0x22, 0x2a, 0x12, 0x55, 0x63, 0x12, 0x23, 0x88, 0xa8, 0xa9, 0x8f, 0xa8, 0x89,
+ 0xc8, 0xbb, 0xcf, 0xa9, 0x8a, 0x90, 0x88, 0x89, 0x99, 0x88, 0xdd, 0x9a, 0xd9, 0x8b, 0xe9, 0xaa,
+ 0xab, 0x98, 0x89, 0x80, 0x32, 0x52, 0x11, 0x15, 0x38, 0x06, 0x13, 0x42, 0x11, 0x31, 0x13, 0x98,
+ 0x9a, 0xec, 0x09, 0xa9, 0x90, 0x28, 0x61, 0x23, 0x24, 0x22, 0x54, 0x44, 0x23, 0x41, 0x02, 0x12,
+ 0x80, 0x99, 0x21, 0x71, 0x14, 0x12, 0x19, 0xa1, 0x08, 0x05, 0x8c, 0x42, 0x9b, 0xf8, 0xbf, 0xcb,
+ 0xca, 0xab, 0xbc, 0xda, 0x9a, 0x9a, 0x9a, 0xa0, 0x28, 0x38, 0x22, 0x37, 0x63, 0x62, 0x23, 0x35,
+ 0x32, 0x42, 0x11, 0x33, 0x30, 0x24, 0x01, 0x01, 0x9c, 0xd9, 0x9d, 0xda, 0x9a, 0xb9, 0x9a, 0xab,
+ 0xca, 0x89, 0x00, 0x88, 0x82, 0x88, 0x8a, 0xca, 0xae, 0x89, 0x88, 0x02, 0x9a, 0x13, 0x79, 0x27,
+ 0xee, 0xfc, 0x2d, 0x00, 0x24, 0x30, 0x34, 0x12, 0x33, 0x31, 0x35, 0x24, 0x02, 0x99, 0xa9, 0xdc,
+ 0x99, 0xdb, 0x0a, 0xfa, 0x89, 0xda, 0x8b, 0xb9, 0xaa, 0xa9, 0xc8, 0x8c, 0x90, 0x8c, 0x08, 0x08,
+ 0x24, 0x1a, 0x85, 0x1a, 0x23, 0x10, 0x10, 0x05, 0x58, 0x25, 0x92, 0x41, 0x23, 0x48, 0x03, 0x10,
+ 0x63, 0x22, 0x25, 0x31, 0x32, 0x20, 0x83, 0x2a, 0xb8, 0x25, 0xea, 0x10, 0xbd, 0x9d, 0x99, 0xac,
+ 0x90, 0xad, 0x99, 0xbc, 0xa9, 0x9c, 0x99, 0x8a, 0xc1, 0x30, 0xbf, 0x11, 0xba, 0x20, 0x8a, 0x92,
+ 0xaa, 0xff, 0xa9, 0xaa, 0xd8, 0x8a, 0xbb, 0x8d, 0xb1, 0x1a, 0x98, 0x60, 0x03, 0x46, 0x41, 0x34,
+ 0x53, 0x25, 0x43, 0x32, 0x32, 0x31, 0x04, 0x20, 0x93, 0x8a, 0xe8, 0xbc, 0xda, 0xbb, 0xbc, 0xbb,
+ 0xdb, 0xaa, 0xbb, 0x9a, 0x9a, 0x81, 0x01, 0x32, 0x33, 0x42, 0x03, 0x34, 0x63, 0x24, 0x31, 0x13,
+ 0x32, 0x72, 0x32, 0x44, 0x34, 0x42, 0x13, 0x31, 0x21, 0x23, 0x02, 0xa0, 0xcc, 0xae, 0xcc, 0xcb,
+ 0xbb, 0xbc, 0xbb, 0xbc, 0xba, 0x9c, 0xa8, 0x00, 0x00, 0x20, 0x12, 0x64, 0x01, 0x43, 0x12, 0x22,
+ 0x11, 0x13, 0x42, 0x34, 0x41, 0xa2, 0x58, 0x10, 0x01, 0x32, 0x01, 0x55, 0x10, 0xc1, 0x82, 0x1b,
+ 0x00, 0x32, 0x9f, 0x81, 0x9d, 0xc2, 0x98, 0x29, 0x39, 0x82, 0x1a, 0xf8, 0x18, 0xaa, 0xb3, 0xbf,
+ 0xb9, 0xbe, 0xd9, 0xbb, 0xba, 0x1c, 0xc9, 0x90, 0x9a, 0x93, 0x6b, 0x81, 0x31, 0x25, 0x29, 0xa4,
+ 0x1b, 0xcb, 0x08, 0xaf, 0xa0, 0xad, 0x00, 0xba, 0x08, 0x80, 0x50, 0x55, 0x32, 0x36, 0x53, 0x42,
+ 0x24, 0x32, 0x15, 0x21, 0x22, 0x88, 0x12, 0xda, 0xa8, 0xcc, 0xac, 0xdb, 0xaa, 0xbb, 0xca, 0x9b,
+ 0xaa, 0xaa, 0x80, 0x18, 0x23, 0x41, 0x23, 0x44, 0x21, 0x04, 0x21, 0x32, 0x24, 0x52, 0x13, 0x22,
+ 0x23, 0x09, 0x2b, 0x00, 0x15, 0x73, 0x13, 0x51, 0x12, 0x22, 0x00, 0x83, 0x9d, 0xd1, 0xbc, 0xca,
+ 0xad, 0xba, 0xac, 0xca, 0x9a, 0xb9, 0x89, 0x08, 0x00, 0x63, 0x22, 0x33, 0x33, 0x35, 0x31, 0x34,
+ 0x00, 0x14, 0x08, 0x90, 0x01, 0x18, 0x6a, 0x02, 0x59, 0x93, 0x21, 0x11, 0x00, 0x18, 0x8a, 0xf8,
+ 0x9e, 0xac, 0xaa, 0xbb, 0xa9, 0xaa, 0x1a, 0x43, 0x02, 0x57, 0x30, 0x24, 0x21, 0x04, 0x19, 0xd0,
+ 0x0a, 0xdc, 0xaa, 0xeb, 0xaa, 0xcb, 0xaa, 0xaa, 0x90, 0x19, 0x13, 0x10, 0x54, 0x22, 0x34, 0x24,
+ 0x20, 0x90, 0xc8, 0xba, 0xbc, 0x9f, 0xc9, 0x8b, 0xb9, 0x1a, 0x88, 0x22, 0x73, 0x35, 0x62, 0x34,
+ 0x32, 0x27, 0x21, 0x32, 0x22, 0x32, 0x22, 0x80, 0x08, 0xfa, 0xaa, 0xdb, 0xbc, 0xbb, 0xbd, 0xba,
+ 0xcb, 0xaa, 0xba, 0xa9, 0xa9, 0x08, 0x00, 0x32, 0x31, 0x16, 0x41, 0x25, 0x31, 0x34, 0x31, 0x44,
+ 0x24, 0x33, 0x24, 0x23, 0x34, 0x23, 0x13, 0x32, 0x88, 0x30, 0xfd, 0xa8, 0xbe, 0xba, 0xbd, 0xbb,
+ 0xbd, 0xba, 0x9c, 0xb9, 0x8a, 0xa8, 0x00, 0x41, 0x50, 0x33, 0x35, 0x32, 0x25, 0x31, 0x24, 0x31,
+ 0x12, 0x14, 0x28, 0x00, 0x80, 0x80, 0x8a, 0xc0, 0xad, 0xc8, 0xbb, 0xcd, 0x9a, 0xcb, 0x8a, 0xca,
+ 0x8b, 0x88, 0x09, 0x24, 0x13, 0x27, 0x44, 0x21, 0x34, 0x12, 0x41, 0x83, 0x18, 0xb1, 0xac, 0xda,
+ 0xaf, 0xaa, 0xad, 0xb9, 0xab, 0xcb, 0x99, 0x8b, 0x08, 0x91, 0x60, 0x91, 0x32, 0x12, 0x43, 0x00,
+ 0x18, 0xc9, 0x98, 0xc9, 0xae, 0x89, 0xba, 0x3a, 0x04, 0x48, 0x65, 0x81, 0x43, 0x15, 0x40, 0x14,
+ 0x33, 0x53, 0x23, 0x41, 0x43, 0x12, 0x43, 0x10, 0x10, 0x88, 0xb9, 0xda, 0xbc, 0xbe, 0xbc, 0xbc,
+ 0xac, 0xbb, 0xbb, 0xbb, 0xac, 0x9a, 0x88, 0x01, 0x41, 0x14, 0x44, 0x43, 0x33, 0x52, 0x22, 0x23,
+ 0x64, 0x0c, 0x33, 0x00, 0x24, 0x21, 0x03, 0x22, 0x20, 0x22, 0x18, 0xa1, 0x98, 0x0a, 0xa9, 0xff,
+ 0xd8, 0xac, 0xbb, 0xbd, 0xda, 0xab, 0xbc, 0xba, 0xab, 0x9a, 0xaa, 0x21, 0x41, 0x45, 0x34, 0x43,
+ 0x34, 0x42, 0x33, 0x43, 0x22, 0x12, 0x00, 0x80, 0xb8, 0xbc, 0xeb, 0xbb, 0xbc, 0xbb, 0xbc, 0xab,
+ 0xba, 0x8c, 0x08, 0x81, 0x14, 0x53, 0x22, 0x44, 0x22, 0x53, 0x12, 0x33, 0x21, 0x12, 0x82, 0x18,
+ 0xa8, 0xac, 0xec, 0xcb, 0xdb, 0xbb, 0xcd, 0x9a, 0xad, 0xaa, 0xba, 0x9c, 0xb9, 0x0b, 0x99, 0x10,
+ 0x28, 0x35, 0x22, 0x73, 0x03, 0x34, 0x22, 0x32, 0x12, 0x30, 0xa1, 0x08, 0xf3, 0x1a, 0xa0, 0x1d,
+ 0x91, 0x42, 0x22, 0x56, 0x41, 0x34, 0x26, 0x42, 0x32, 0x33, 0x43, 0x14, 0x22, 0x01, 0x90, 0x9b,
+ 0xcc, 0xcc, 0xcb, 0xbc, 0xac, 0xbc, 0xba, 0xab, 0xcb, 0x9a, 0x99, 0x08, 0x10, 0x42, 0x41, 0x43,
+ 0x24, 0x43, 0x32, 0x33, 0x32, 0x25, 0x42, 0x22, 0x23, 0x42, 0x22, 0x23, 0x33, 0x23, 0x01, 0x00,
+ 0xdc, 0xc9, 0xcf, 0xda, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xba, 0x8c, 0x99, 0x80, 0x32, 0x43, 0x45,
+ 0x24, 0x43, 0x43, 0x32, 0x33, 0x33, 0x12, 0x22, 0x88, 0xa9, 0xbd, 0xeb, 0xbb, 0xbc, 0xcb, 0xab,
+ 0xbb, 0xaa, 0xbb, 0x99, 0x08, 0x22, 0x43, 0x16, 0x53, 0x13, 0x43, 0x43, 0x23, 0x25, 0x12, 0x23,
+ 0x02, 0x01, 0x32, 0xdb, 0xb0, 0xbf, 0xbc, 0xcc, 0xcb, 0xad, 0xb9, 0xac, 0xba, 0x9c, 0xaa, 0x88,
+ 0x89, 0x22, 0x20, 0x45, 0x32, 0x44, 0x33, 0x53, 0x22, 0x21, 0x03, 0x21, 0xa1, 0x00, 0xad, 0xb0,
+ 0xad, 0x98, 0x9c, 0x98, 0xa1, 0x08, 0x37, 0x1a, 0x37, 0x22, 0x64, 0x22, 0x32, 0x34, 0x32, 0x62,
+ 0x83, 0x32, 0x01, 0x88, 0xa8, 0xeb, 0xaa, 0xbd, 0xbd, 0xdb, 0xbb, 0xcb, 0xbb, 0xab, 0xbc, 0xa9,
+ 0xdc, 0xda, 0x32, 0x00, 0x89, 0x88, 0x21, 0x42, 0x44, 0x32, 0x35, 0x33, 0x44, 0x33, 0x43, 0x24,
+ 0x42, 0x12, 0x22, 0x12, 0x42, 0x88, 0x82, 0xac, 0xba, 0xae, 0xcb, 0xbc, 0xbd, 0xbb, 0xad, 0xca,
+ 0xaa, 0xa9, 0x9a, 0x88, 0x18, 0x13, 0x73, 0x33, 0x73, 0x13, 0x33, 0x34, 0x22, 0x43, 0x12, 0x20,
+ 0x81, 0xb9, 0xb9, 0xbe, 0xcb, 0xbc, 0xbc, 0xbb, 0xbc, 0xaa, 0xba, 0x08, 0xaa, 0x21, 0x34, 0x63,
+ 0x53, 0x23, 0x44, 0x22, 0x32, 0x33, 0x11, 0x14, 0x98, 0x98, 0xda, 0xbd, 0xca, 0xad, 0xba, 0xbd,
+ 0xbb, 0xbc, 0xba, 0xaa, 0xab, 0x8b, 0x91, 0x38, 0x25, 0x41, 0x13, 0x45, 0x30, 0x25, 0x01, 0x22,
+ 0x30, 0x33, 0x52, 0xa2, 0x42, 0x99, 0x34, 0x8c, 0x84, 0x9a, 0x90, 0x39, 0xc9, 0x62, 0xdb, 0x12,
+ 0x9b, 0x16, 0x31, 0x45, 0x32, 0x34, 0x54, 0x13, 0x63, 0x02, 0x32, 0x82, 0x21, 0x98, 0xa9, 0xbd,
+ 0xfb, 0x9c, 0xdb, 0xab, 0xcb, 0xba, 0xab, 0xab, 0xba, 0x9a, 0x99, 0x32, 0x51, 0x44, 0x32, 0x44,
+ 0x32, 0x24, 0x52, 0x12, 0x43, 0x21, 0x23, 0x21, 0x14, 0x21, 0x12, 0x29, 0xd1, 0x19, 0xeb, 0x98,
+ 0xae, 0xb9, 0xad, 0xcb, 0xbb, 0xcb, 0xbb, 0xda, 0x8a, 0xb9, 0x11, 0x89, 0x43, 0x42, 0x35, 0x53,
+ 0x33, 0x43, 0x33, 0x43, 0x12, 0x23, 0x08, 0x98, 0xba, 0xcc, 0xbc, 0xdc, 0xab, 0xcb, 0xaa, 0x9a,
+ 0x9b, 0x99, 0x89, 0x11, 0x53, 0x32, 0x36, 0x31, 0x25, 0x32, 0x22, 0x32, 0x11, 0x83, 0xb9, 0x9a,
+ 0xde, 0x09, 0xcb, 0xa9, 0xba, 0xae, 0x9b, 0xcd, 0x88, 0xcb, 0x98, 0x9d, 0xa9, 0x8a, 0xa8, 0x98,
+ 0x82, 0x6b, 0x01, 0x30, 0x34, 0x54, 0x32, 0x24, 0x31, 0x01, 0x33, 0x82, 0x28, 0xe9, 0xba, 0x9d,
+ 0xca, 0xa9, 0xab, 0x9c, 0x02, 0x48, 0x47, 0x43, 0x44, 0x43, 0x33, 0x45, 0x32, 0x33, 0x33, 0x22,
+ 0x58, 0x37, 0x30, 0x00, 0x12, 0xa8, 0xda, 0xeb, 0xbc, 0xbc, 0xbd, 0xbb, 0xbc, 0xbb, 0xac, 0xab,
+ 0xba, 0x88, 0x0a, 0x30, 0x21, 0x37, 0x33, 0x25, 0x43, 0x33, 0x34, 0x14, 0x32, 0x33, 0x33, 0x24,
+ 0x32, 0x22, 0x33, 0x01, 0x01, 0x8b, 0xd3, 0x8c, 0xdd, 0xeb, 0xab, 0xcb, 0xbc, 0xcb, 0xcb, 0xba,
+ 0xab, 0xbb, 0x99, 0x9b, 0x13, 0x62, 0x43, 0x25, 0x34, 0x53, 0x33, 0x33, 0x24, 0x12, 0x12, 0x80,
+ 0x9a, 0xba, 0xce, 0xac, 0xbc, 0xca, 0xaa, 0xab, 0xaa, 0x9a, 0x09, 0x12, 0x43, 0x45, 0x42, 0x43,
+ 0x23, 0x22, 0x24, 0x22, 0x01, 0x81, 0xa8, 0x99, 0xbd, 0xac, 0xad, 0xba, 0xca, 0xba, 0xac, 0xab,
+ 0xca, 0xc9, 0xaa, 0xbb, 0xcc, 0xab, 0xca, 0x9a, 0x8a, 0x89, 0x08, 0x82, 0x44, 0x37, 0x42, 0x34,
+ 0x43, 0x33, 0x53, 0x01, 0x52, 0x90, 0x18, 0xc8, 0xaa, 0xb9, 0xcb, 0xad, 0x98, 0x9d, 0x10, 0x88,
+ 0x73, 0x33, 0x44, 0x53, 0x33, 0x34, 0x34, 0x42, 0x22, 0x02, 0x20, 0x91, 0xaa, 0xbc, 0xbe, 0xeb,
+ 0xab, 0xbd, 0xba, 0xca, 0xaa, 0xbb, 0xba, 0x99, 0x99, 0x08, 0x02, 0x40, 0x24, 0x34, 0x22, 0x35,
+ 0x42, 0x43, 0x42, 0x22, 0x53, 0x12, 0x24, 0x33, 0x34, 0x42, 0x03, 0x21, 0x02, 0x81, 0xa0, 0xfb,
+ 0xae, 0xbb, 0xdb, 0xbc, 0xd9, 0x9b, 0xaa, 0xab, 0xba, 0x98, 0x09, 0x42, 0x31, 0x55, 0x22, 0x24,
+ 0x53, 0x11, 0x33, 0x21, 0x00, 0x88, 0xb8, 0xbb, 0xbc, 0xbf, 0xab, 0xac, 0xaa, 0x9a, 0x9a, 0x18,
+ 0x22, 0x54, 0x25, 0x22, 0x44, 0x32, 0x31, 0x12, 0x01, 0x20, 0xb0, 0x9b, 0xbc, 0xcd, 0xbb, 0xcc,
+ 0xbb, 0xc9, 0x9c, 0xbb, 0xab, 0xae, 0x99, 0xba, 0xeb, 0x89, 0xaa, 0x0a, 0xd8, 0x2b, 0x82, 0x18,
+ 0x43, 0x12, 0x44, 0x34, 0x52, 0x34, 0x01, 0x24, 0x88, 0x13, 0xab, 0xb8, 0xbf, 0xb9, 0x9f, 0xa8,
+ 0xc0, 0xee, 0x2b, 0x00, 0x88, 0xaa, 0x81, 0x68, 0x34, 0x63, 0x44, 0x22, 0x26, 0x23, 0x43, 0x33,
+ 0x43, 0x32, 0x23, 0x01, 0x11, 0xba, 0xdb, 0xcc, 0xad, 0xdb, 0xbb, 0xbc, 0xac, 0xbb, 0x9c, 0xbb,
+ 0xaa, 0x9a, 0x8b, 0x98, 0x01, 0x22, 0x36, 0x41, 0x43, 0x43, 0x33, 0x44, 0x32, 0x33, 0x35, 0x32,
+ 0x34, 0x12, 0x34, 0x12, 0x15, 0x21, 0x82, 0x28, 0xc0, 0x9a, 0xd9, 0xbc, 0xbc, 0xbd, 0xbc, 0xbc,
+ 0xba, 0xbc, 0xba, 0xac, 0x99, 0x89, 0x89, 0x21, 0x50, 0x25, 0x42, 0x42, 0x32, 0x23, 0x53, 0x12,
+ 0x21, 0x91, 0x09, 0xc9, 0xa9, 0xbc, 0x9a, 0xad, 0xa9, 0x9a, 0x88, 0x33, 0x42, 0x54, 0x33, 0x33,
+ 0x53, 0x21, 0x22, 0x21, 0x91, 0xea, 0xbb, 0xbe, 0xaa, 0xae, 0xaa, 0xda, 0x99, 0x8c, 0xaa, 0x98,
+ 0x9a, 0xa8, 0xb8, 0xab, 0xaf, 0x99, 0xdb, 0x88, 0xdb, 0x18, 0xab, 0x20, 0x8a, 0x33, 0x50, 0x37,
+ 0x42, 0x24, 0x41, 0x22, 0x52, 0x80, 0x22, 0x9a, 0x81, 0x8d, 0xa0, 0x8e, 0x91, 0x0a, 0x80, 0x51,
+ 0x02, 0x67, 0x21, 0x44, 0x22, 0x53, 0x32, 0x14, 0x43, 0x11, 0x22, 0x00, 0x80, 0xca, 0xb9, 0xbf,
+ 0xab, 0xbe, 0xac, 0xbb, 0xac, 0xcb, 0xba, 0xaa, 0xa9, 0x9a, 0x8a, 0x88, 0x20, 0x25, 0x42, 0x43,
+ 0x32, 0x35, 0x52, 0x23, 0x41, 0x33, 0x42, 0x13, 0x42, 0x22, 0x34, 0x30, 0x43, 0x21, 0x03, 0x11,
+ 0xa1, 0x21, 0xac, 0xca, 0xed, 0xba, 0xbc, 0xdb, 0xbb, 0xbc, 0xcb, 0x9b, 0xca, 0x8b, 0xb9, 0x89,
+ 0x00, 0x11, 0x33, 0x62, 0x12, 0x34, 0x52, 0x01, 0x24, 0x20, 0x81, 0x11, 0x00, 0x01, 0x88, 0x11,
+ 0x32, 0x82, 0x46, 0x51, 0x42, 0x34, 0x22, 0x24, 0x13, 0x52, 0x21, 0x00, 0x98, 0xfb, 0xa9, 0xcd,
+ 0xb9, 0xbb, 0xcd, 0xba, 0xbc, 0xcb, 0x9b, 0xaa, 0x8d, 0x98, 0x98, 0xa8, 0x8a, 0x99, 0x08, 0xa1,
+ 0x07, 0xe9, 0x1e, 0x00, 0x27, 0x28, 0x31, 0x32, 0x14, 0x46, 0x23, 0x71, 0x02, 0x19, 0x84, 0x80,
+ 0x30, 0xa0, 0x2a, 0x85, 0x09, 0x21, 0x30, 0x85, 0x47, 0x21, 0x55, 0x22, 0x52, 0x23, 0x34, 0x52,
+ 0x23, 0x22, 0x15, 0x10, 0x20, 0x90, 0xb9, 0xda, 0xeb, 0xac, 0xbc, 0xdb, 0xba, 0xac, 0xbb, 0xbb,
+ 0xcb, 0x9b, 0xab, 0x89, 0x09, 0x80, 0x43, 0x44, 0x31, 0x26, 0x32, 0x24, 0x24, 0x32, 0x43, 0x22,
+ 0x23, 0x25, 0x31, 0x32, 0x22, 0x23, 0x25, 0x11, 0x32, 0x82, 0x32, 0x12, 0x0a, 0xcb, 0xfb, 0xad,
+ 0xcb, 0xbd, 0xbc, 0xbc, 0xac, 0xac, 0xbb, 0xcb, 0xca, 0x9a, 0x8a, 0x9a, 0x19, 0x00, 0x20, 0x35,
+ 0x23, 0x35, 0x43, 0x33, 0x53, 0x23, 0x32, 0x43, 0x21, 0x32, 0x32, 0x31, 0x35, 0x31, 0x34, 0x43,
+ 0x33, 0x53, 0x21, 0x33, 0x83, 0x00, 0xdb, 0xad, 0xcd, 0xc9, 0xdb, 0xab, 0xbd, 0xcb, 0xaa, 0xcc,
+ 0x9a, 0xba, 0x9a, 0x9a, 0xa9, 0x89, 0x88, 0x98, 0x16, 0x10, 0x73, 0x11, 0x21, 0x24, 0x21, 0x43,
+ 0x24, 0x20, 0x26, 0x18, 0x32, 0x92, 0x10, 0x32, 0xb9, 0x71, 0x82, 0x1a, 0x25, 0xaa, 0x35, 0x01,
+ 0x52, 0x55, 0x12, 0x53, 0x14, 0x31, 0x34, 0x32, 0x43, 0x14, 0x10, 0x12, 0x89, 0xb8, 0xfa, 0xbc,
+ 0xac, 0xdc, 0xaa, 0xcb, 0xcb, 0xaa, 0xbb, 0xbb, 0xaa, 0xac, 0x89, 0x98, 0x10, 0x42, 0x21, 0x64,
+ 0x12, 0x43, 0x43, 0x22, 0x43, 0x14, 0x22, 0x43, 0x21, 0x42, 0x12, 0x23, 0x43, 0x23, 0x52, 0x12,
+ 0x01, 0x34, 0x82, 0x28, 0x82, 0xad, 0xaa, 0xdd, 0xac, 0xcb, 0xcc, 0xaa, 0xcc, 0xaa, 0xbb, 0xac,
+ 0x9b, 0xba, 0x9b, 0xa8, 0x99, 0x20, 0x12, 0x72, 0x24, 0x21, 0x43, 0x24, 0x22, 0x35, 0x21, 0x42,
+ 0x22, 0x32, 0x24, 0x22, 0x42, 0x23, 0x22, 0x45, 0x08, 0x22, 0x01, 0x80, 0x88, 0xba, 0xbe, 0xd9,
+ 0x8e, 0x0b, 0x27, 0x00, 0xad, 0xda, 0xcb, 0xab, 0xcb, 0x9c, 0xaa, 0xbb, 0xba, 0xba, 0xab, 0xc0,
+ 0x8b, 0x19, 0x08, 0xc9, 0x13, 0x9c, 0x32, 0x04, 0x60, 0x24, 0x31, 0x35, 0x25, 0x30, 0x35, 0x31,
+ 0x25, 0x21, 0x12, 0x31, 0x03, 0x59, 0x93, 0x28, 0x02, 0x95, 0x0d, 0x04, 0x0e, 0x32, 0x12, 0x15,
+ 0x73, 0x10, 0x43, 0x22, 0x34, 0x43, 0x23, 0x31, 0x12, 0x18, 0x81, 0xcd, 0xc9, 0xeb, 0xac, 0xcb,
+ 0xcb, 0xcb, 0xba, 0xbc, 0xaa, 0xbb, 0xab, 0xca, 0x99, 0x00, 0x18, 0x33, 0x63, 0x43, 0x44, 0x22,
+ 0x44, 0x22, 0x33, 0x42, 0x23, 0x43, 0x22, 0x32, 0x23, 0x43, 0x10, 0x33, 0x80, 0x23, 0x41, 0xb8,
+ 0x43, 0xeb, 0x88, 0xba, 0xdb, 0x9c, 0xdc, 0x9c, 0xca, 0xcb, 0xca, 0xbb, 0xac, 0xba, 0xbb, 0xcb,
+ 0xb9, 0x9b, 0xa9, 0x09, 0x20, 0x21, 0x53, 0x35, 0x42, 0x25, 0x23, 0x33, 0x44, 0x32, 0x34, 0x32,
+ 0x33, 0x34, 0x33, 0x53, 0x23, 0x20, 0x26, 0x10, 0x10, 0x10, 0xb0, 0x01, 0xbd, 0x9a, 0xfc, 0xba,
+ 0xbc, 0xda, 0xbb, 0xda, 0x9c, 0xa9, 0xbb, 0xba, 0xaa, 0xbc, 0x89, 0xbb, 0x0b, 0xc1, 0x88, 0x24,
+ 0x49, 0x23, 0x26, 0x31, 0x34, 0x25, 0x22, 0x44, 0x10, 0x43, 0x81, 0x21, 0xa1, 0x91, 0x51, 0xb8,
+ 0x48, 0xb3, 0x2d, 0x93, 0x28, 0x83, 0x64, 0x11, 0x55, 0x21, 0x34, 0x05, 0x52, 0x22, 0x32, 0x33,
+ 0x34, 0x23, 0x42, 0x91, 0x22, 0xaa, 0xdb, 0xdc, 0xbb, 0xbe, 0xca, 0xac, 0xdb, 0xba, 0xca, 0xba,
+ 0xba, 0xab, 0xba, 0xaa, 0x80, 0x11, 0x33, 0x36, 0x35, 0x53, 0x33, 0x34, 0x34, 0x33, 0x44, 0x22,
+ 0x32, 0x23, 0x23, 0x24, 0x22, 0x21, 0x12, 0x18, 0x03, 0x9b, 0x31, 0xa0, 0xbb, 0xe8, 0xdd, 0xab,
+ 0xcd, 0xcb, 0xcb, 0xbb, 0xbd, 0xbc, 0xda, 0xaa, 0xbb, 0xba, 0xbb, 0xcb, 0x9a, 0x9a, 0xaa, 0x8a,
+ 0xee, 0xe7, 0x22, 0x00, 0x08, 0x70, 0x12, 0x22, 0x26, 0x22, 0x54, 0x32, 0x33, 0x35, 0x24, 0x42,
+ 0x22, 0x23, 0x43, 0x12, 0x41, 0x12, 0x21, 0x92, 0x99, 0x01, 0xbd, 0x9d, 0xba, 0xbf, 0xa9, 0xbc,
+ 0xbb, 0xcb, 0xac, 0xaa, 0xcb, 0x9b, 0xca, 0xab, 0xa9, 0xac, 0x09, 0x99, 0x20, 0xa2, 0x41, 0x89,
+ 0x50, 0x80, 0x53, 0x91, 0x00, 0x11, 0x22, 0x57, 0x18, 0x04, 0x21, 0x24, 0x21, 0x45, 0x82, 0x41,
+ 0x02, 0x21, 0x23, 0x34, 0x80, 0x13, 0x10, 0x50, 0x00, 0x33, 0x57, 0x01, 0x44, 0x10, 0x55, 0x11,
+ 0x34, 0x24, 0x31, 0x34, 0x23, 0x31, 0x12, 0x88, 0x90, 0xdd, 0xcb, 0xcc, 0xbc, 0xbc, 0xdb, 0xab,
+ 0xbb, 0xbb, 0xba, 0x9a, 0x99, 0x10, 0x21, 0x45, 0x43, 0x44, 0x32, 0x42, 0x33, 0x24, 0x33, 0x22,
+ 0x24, 0x20, 0x01, 0x88, 0x98, 0xa8, 0xc9, 0x18, 0x8a, 0x99, 0xa0, 0x93, 0x4b, 0x94, 0x69, 0xa0,
+ 0xa9, 0x92, 0xcf, 0xd9, 0x9a, 0xac, 0x9e, 0xb9, 0xda, 0xa9, 0x9d, 0xaa, 0xbb, 0xbb, 0xbb, 0xac,
+ 0xba, 0xa9, 0x8a, 0x09, 0x10, 0x03, 0x57, 0x32, 0x34, 0x44, 0x32, 0x34, 0x32, 0x17, 0x20, 0x32,
+ 0x11, 0x11, 0x13, 0x19, 0x52, 0x99, 0x81, 0xf0, 0x08, 0x9b, 0xb9, 0x90, 0x9f, 0x99, 0x92, 0x9d,
+ 0x9a, 0xd8, 0xaa, 0x89, 0xac, 0x89, 0xe9, 0x1a, 0xdb, 0x8d, 0xa3, 0x0a, 0x08, 0xcc, 0x9a, 0xc9,
+ 0x99, 0x09, 0x88, 0x11, 0x31, 0x08, 0x57, 0x11, 0x41, 0x94, 0x71, 0x10, 0x12, 0x23, 0x20, 0x21,
+ 0xb3, 0x34, 0x29, 0xaa, 0xa5, 0x9a, 0x8a, 0xbe, 0xb9, 0xad, 0x0c, 0xb8, 0xba, 0x00, 0x79, 0xa2,
+ 0x73, 0x02, 0x51, 0x22, 0x43, 0x32, 0x15, 0x23, 0x42, 0x11, 0x02, 0x13, 0x88, 0xb0, 0x9d, 0xc9,
+ 0xcb, 0xab, 0xad, 0xaa, 0x00, 0x09, 0x18, 0x88, 0x92, 0x28, 0x55, 0x29, 0x84, 0x09, 0x21, 0x83,
+ 0x01, 0x08, 0x17, 0x00, 0x4a, 0xe9, 0xb1, 0xad, 0xb9, 0x9e, 0xa8, 0x9d, 0xa9, 0x99, 0xbe, 0x98,
+ 0x90, 0x18, 0x91, 0x0b, 0x02, 0x48, 0x61, 0x28, 0x17, 0xa0, 0x39, 0xad, 0x99, 0xfb, 0x2a, 0xb8,
+ 0x8a, 0x92, 0x8c, 0xa9, 0x00, 0x19, 0x28, 0x97, 0x81, 0x71, 0x21, 0x81, 0x93, 0x08, 0x28, 0x30,
+ 0x8f, 0xd1, 0x99, 0x18, 0xbd, 0x0b, 0xf4, 0x29, 0x8a, 0x83, 0x18, 0x51, 0x42, 0xa9, 0x12, 0xc2,
+ 0x3a, 0x0b, 0xb0, 0x9e, 0x17, 0x09, 0x82, 0x89, 0x8b, 0xba, 0xa0, 0xf0, 0x0d, 0x9b, 0xd3, 0x1b,
+ 0x81, 0xae, 0x80, 0xb2, 0x79, 0xa0, 0x38, 0xd2, 0x58, 0xb2, 0x39, 0x23, 0x0b, 0x06, 0x08, 0x14,
+ 0x28, 0x82, 0x11, 0x04, 0x59, 0x00, 0xc0, 0xb0, 0x3b, 0x80, 0x8f, 0xd1, 0x99, 0x8b, 0xa9, 0xe9,
+ 0x08, 0xbb, 0xb9, 0x9c, 0xa8, 0x09, 0xa8, 0x6a, 0xd9, 0x40, 0x08, 0x23, 0x26, 0x22, 0x53, 0x31,
+ 0x27, 0x31, 0x23, 0x16, 0x12, 0x22, 0x20, 0x22, 0x22, 0x83, 0x11, 0xa9, 0xd8, 0xcb, 0x8c, 0xad,
+ 0xa9, 0xdb, 0xa9, 0xbb, 0x89, 0xcc, 0x89, 0xac, 0x99, 0x8a, 0xba, 0x99, 0xcb, 0x08, 0x82, 0x79,
+ 0xa1, 0x99, 0x21, 0x19, 0x92, 0xac, 0x5a, 0xc1, 0x9a, 0x25, 0xaa, 0x35, 0x21, 0x2d, 0x84, 0x08,
+ 0x06, 0x9b, 0x43, 0x9c, 0x80, 0xf9, 0x00, 0x81, 0x1b, 0x31, 0xc8, 0x53, 0x02, 0x29, 0xd8, 0x21,
+ 0xc1, 0x0d, 0xd9, 0x90, 0x4b, 0x14, 0xac, 0x16, 0xc9, 0x58, 0x99, 0x89, 0xa0, 0xb9, 0x10, 0xbc,
+ 0x00, 0x2a, 0x9a, 0xa9, 0xa9, 0x93, 0x9a, 0x1d, 0xa1, 0xdb, 0x55, 0x9a, 0x21, 0xd2, 0x70, 0x81,
+ 0x29, 0x92, 0x0a, 0x27, 0xba, 0x26, 0x99, 0x48, 0xb0, 0x18, 0x22, 0x18, 0x27, 0x88, 0x12, 0xa8,
+ 0x31, 0xf9, 0x28, 0xbb, 0x89, 0xc0, 0x9b, 0x90, 0x9f, 0x91, 0x08, 0xa1, 0x0d, 0xb1, 0x09, 0x09,
+ 0x33, 0xf9, 0x20, 0x00, 0x70, 0xcb, 0x3a, 0x86, 0x1a, 0x84, 0x99, 0x40, 0xa0, 0x33, 0x15, 0x48,
+ 0xa0, 0x38, 0xa9, 0x31, 0x13, 0x23, 0x0e, 0x91, 0x49, 0x20, 0xb5, 0x2c, 0xa2, 0xda, 0x31, 0x8c,
+ 0xc3, 0x1b, 0x81, 0x3a, 0x91, 0x47, 0x81, 0x62, 0x88, 0x13, 0x89, 0x42, 0x81, 0x50, 0x82, 0x80,
+ 0x11, 0x11, 0x23, 0x8b, 0xc8, 0xf1, 0xac, 0x8f, 0xb1, 0x88, 0x08, 0x99, 0x42, 0xa9, 0x89, 0xbe,
+ 0x42, 0x90, 0x08, 0x81, 0xaf, 0x30, 0xb8, 0x29, 0x12, 0xf9, 0x11, 0x88, 0x3c, 0xa5, 0x0d, 0x04,
+ 0xda, 0x13, 0x8c, 0x51, 0xa8, 0x20, 0xd0, 0x28, 0xa0, 0x2a, 0xb2, 0x01, 0x1a, 0xa9, 0xc0, 0x9d,
+ 0x90, 0xe9, 0xac, 0x2a, 0xb8, 0x34, 0xba, 0xdb, 0x10, 0x8a, 0x87, 0x0c, 0x12, 0xca, 0x41, 0xc0,
+ 0x58, 0x80, 0x20, 0x92, 0x9b, 0x29, 0xd3, 0x44, 0x02, 0x3c, 0xb2, 0x09, 0x12, 0x1e, 0x96, 0x8a,
+ 0x44, 0x9b, 0x23, 0xcb, 0x21, 0xbc, 0x80, 0x09, 0xd0, 0x8a, 0x33, 0xbb, 0x7b, 0xe1, 0x18, 0x91,
+ 0x39, 0x92, 0x0a, 0x58, 0xe8, 0x51, 0xc8, 0x30, 0xc1, 0x42, 0xa8, 0x28, 0x90, 0x31, 0xa8, 0x43,
+ 0xf9, 0x48, 0x91, 0x2c, 0xc3, 0x1c, 0x22, 0xca, 0x22, 0xa9, 0x98, 0x3a, 0xf2, 0x09, 0x01, 0x89,
+ 0x10, 0x85, 0x1c, 0x21, 0x9a, 0x02, 0x2b, 0x11, 0xa7, 0x10, 0x1b, 0x52, 0xd8, 0x44, 0xb0, 0x10,
+ 0x50, 0xbb, 0x92, 0x80, 0x08, 0x0d, 0x83, 0x8c, 0xa1, 0x7a, 0x80, 0x81, 0x08, 0xa2, 0x20, 0x18,
+ 0x8f, 0x96, 0x2a, 0xa1, 0x2a, 0x34, 0x9d, 0x13, 0xb9, 0x00, 0xe9, 0x28, 0xb3, 0x3f, 0xb3, 0x0c,
+ 0xa3, 0x00, 0x80, 0x52, 0x8e, 0x83, 0x9a, 0x11, 0x89, 0x2d, 0xd2, 0x8a, 0x05, 0x0a, 0x28, 0xd8,
+ 0x49, 0x94, 0x8d, 0x13, 0xca, 0x41, 0x88, 0x18, 0x83, 0x08, 0x29, 0xf2, 0x0b, 0xb2, 0x1d, 0x01,
+ 0xc0, 0xff, 0x2a, 0x00, 0xc8, 0x68, 0x90, 0x11, 0x80, 0x80, 0x8b, 0x21, 0xbf, 0x13, 0xb1, 0x2c,
+ 0x85, 0x0e, 0x11, 0xd9, 0x20, 0x88, 0x0a, 0xa0, 0x3c, 0xb4, 0x3b, 0x87, 0x2c, 0x83, 0x0c, 0xb2,
+ 0x2a, 0x80, 0x50, 0x82, 0x08, 0x01, 0xea, 0x50, 0xa2, 0x29, 0x99, 0x81, 0x99, 0x48, 0xc0, 0x84,
+ 0x7b, 0xb0, 0x2b, 0x05, 0xbb, 0x48, 0xe8, 0x48, 0x91, 0x1b, 0x92, 0x00, 0x19, 0x82, 0x8b, 0x04,
+ 0x10, 0xbb, 0x61, 0xf0, 0x3a, 0x93, 0x00, 0x35, 0xbb, 0x42, 0xba, 0x41, 0xbc, 0x24, 0x91, 0x0c,
+ 0xa3, 0xaf, 0x25, 0x8c, 0x02, 0xa9, 0x51, 0xba, 0x11, 0xa1, 0x18, 0x3d, 0xe4, 0x2a, 0x82, 0x1b,
+ 0x83, 0x8a, 0x38, 0xf0, 0x30, 0x98, 0x19, 0xd3, 0x22, 0xa8, 0x10, 0x80, 0x9d, 0x35, 0xbc, 0x33,
+ 0xea, 0x48, 0xc0, 0x30, 0x88, 0x12, 0xc0, 0x38, 0xc0, 0x2a, 0x84, 0x8d, 0x93, 0xb8, 0x51, 0x0a,
+ 0x23, 0xb9, 0x5a, 0xc0, 0x84, 0x39, 0x89, 0x81, 0x18, 0x60, 0xc8, 0x23, 0x88, 0xbc, 0x20, 0x1d,
+ 0x91, 0x94, 0xb1, 0x38, 0xdd, 0x32, 0xbd, 0x51, 0xd0, 0x00, 0x02, 0xa9, 0x21, 0x98, 0x3b, 0x97,
+ 0x9b, 0x33, 0xea, 0x4a, 0xb3, 0x3b, 0x01, 0xca, 0x04, 0xa1, 0x88, 0x09, 0x71, 0x00, 0xc8, 0x41,
+ 0xb8, 0x48, 0xe2, 0x29, 0xa9, 0x40, 0xe0, 0x38, 0xa0, 0x18, 0x04, 0x1c, 0x98, 0x99, 0x96, 0x1c,
+ 0xa3, 0x8a, 0x68, 0xb0, 0x18, 0xb0, 0x89, 0x73, 0xb9, 0x03, 0x0a, 0x10, 0x2a, 0xf1, 0x41, 0x18,
+ 0x19, 0xd2, 0x00, 0x0a, 0x03, 0x0d, 0x72, 0x91, 0x23, 0xa3, 0x9f, 0x99, 0xeb, 0x10, 0x9b, 0x11,
+ 0xa1, 0x33, 0x40, 0x89, 0x38, 0xe2, 0xb8, 0x29, 0xdb, 0x31, 0x28, 0x81, 0x80, 0x47, 0x08, 0x28,
+ 0x95, 0x0c, 0x83, 0x18, 0x4b, 0xb4, 0x8a, 0x01, 0xb9, 0x0a, 0xd3, 0x0d, 0x18, 0xda, 0x80, 0xa4,
+ 0xc4, 0xfc, 0x29, 0x00, 0x82, 0x94, 0x9a, 0x61, 0x89, 0x08, 0x99, 0x98, 0x83, 0x19, 0x38, 0x27,
+ 0x9f, 0x04, 0x8a, 0x18, 0x82, 0x98, 0x51, 0x80, 0x62, 0x21, 0x42, 0x92, 0x82, 0x48, 0xa8, 0x81,
+ 0x29, 0xd0, 0x09, 0x86, 0x89, 0x18, 0x00, 0xa9, 0xae, 0xb3, 0xaf, 0x01, 0xcb, 0x28, 0xba, 0xc9,
+ 0x82, 0x8f, 0x80, 0xa8, 0x11, 0x01, 0x19, 0x2b, 0x97, 0x42, 0x19, 0x21, 0x8a, 0x85, 0x8a, 0xa4,
+ 0x3b, 0x0b, 0xb1, 0x17, 0x21, 0x09, 0x13, 0xa8, 0x72, 0x62, 0x92, 0x32, 0x18, 0xa0, 0xe0, 0x20,
+ 0x9e, 0x18, 0xd9, 0x08, 0xba, 0x8a, 0xbb, 0x9f, 0x83, 0x89, 0x29, 0x89, 0xc9, 0xa1, 0x3a, 0xaf,
+ 0x80, 0xc9, 0xa0, 0x49, 0x22, 0x20, 0x23, 0x2d, 0xc6, 0x09, 0x43, 0x2c, 0x82, 0x88, 0xb2, 0x19,
+ 0x59, 0xa8, 0x1a, 0x85, 0x02, 0x20, 0x88, 0xa8, 0x08, 0xf0, 0x69, 0x8b, 0xd4, 0x20, 0x0b, 0x98,
+ 0xb2, 0x4b, 0xbb, 0x82, 0x9b, 0x8c, 0xf8, 0x8a, 0xa0, 0x0c, 0x0b, 0x85, 0xac, 0x88, 0xa5, 0x1d,
+ 0x81, 0xfa, 0x5a, 0xa8, 0x01, 0x83, 0x0a, 0x91, 0x3b, 0xa9, 0xa3, 0x23, 0x54, 0x41, 0x02, 0x30,
+ 0x05, 0x18, 0x74, 0x41, 0x26, 0x34, 0x44, 0x32, 0x25, 0x20, 0x81, 0x90, 0x99, 0xbd, 0xcb, 0xaa,
+ 0xbb, 0xba, 0xca, 0xb9, 0x9b, 0xcb, 0xbc, 0xbc, 0xca, 0x99, 0x0a, 0xb9, 0xa9, 0xcc, 0xa9, 0xad,
+ 0x99, 0x08, 0x44, 0x53, 0x45, 0x43, 0x23, 0x25, 0x11, 0x11, 0x81, 0x08, 0x88, 0x98, 0x20, 0x12,
+ 0x37, 0x11, 0x13, 0x89, 0x10, 0xbe, 0xe8, 0xbb, 0x9d, 0x99, 0xea, 0x9a, 0xbb, 0xaa, 0xca, 0xbc,
+ 0x9a, 0x89, 0x29, 0x02, 0x41, 0x25, 0x21, 0x28, 0xc2, 0x20, 0x80, 0x1c, 0x17, 0x18, 0x13, 0x21,
+ 0x63, 0x11, 0x90, 0x34, 0x90, 0x48, 0x98, 0x61, 0x01, 0x90, 0x38, 0xc8, 0x9a, 0xd1, 0x0c, 0x09,
+ 0x60, 0x01, 0x21, 0x00, 0x00, 0x18, 0x1b, 0xf1, 0xac, 0xa8, 0xaf, 0xa9, 0xeb, 0x99, 0x8a, 0x81,
+ 0x8a, 0x80, 0x25, 0x92, 0x4c, 0xa0, 0x82, 0xa2, 0x0c, 0x91, 0x20, 0x4b, 0x84, 0x63, 0x00, 0x38,
+ 0x93, 0x2a, 0x06, 0xab, 0x4b, 0xa5, 0x0b, 0xf8, 0x8b, 0x99, 0xbc, 0xad, 0xa0, 0xad, 0xa0, 0xad,
+ 0x10, 0x20, 0x55, 0x55, 0x43, 0x63, 0x23, 0x42, 0x22, 0x11, 0x10, 0xaa, 0xda, 0xcb, 0x9c, 0xaa,
+ 0xaa, 0x8a, 0x98, 0x89, 0xa8, 0xbc, 0xcb, 0xbe, 0xab, 0xbd, 0xab, 0xab, 0xcb, 0x88, 0x89, 0x08,
+ 0x23, 0x64, 0x34, 0x44, 0x43, 0x43, 0x33, 0x33, 0x21, 0x12, 0x08, 0xb8, 0x9a, 0x8a, 0x13, 0x59,
+ 0x46, 0x21, 0x13, 0x11, 0xc0, 0xab, 0xcf, 0xba, 0xcc, 0xaa, 0xac, 0xa9, 0xab, 0xa9, 0xbb, 0xba,
+ 0xab, 0x9a, 0x98, 0x48, 0x42, 0x24, 0x22, 0x23, 0x30, 0x34, 0x23, 0x65, 0x23, 0x54, 0x34, 0x43,
+ 0x24, 0x12, 0x02, 0x81, 0x99, 0xa9, 0xab, 0xa9, 0xac, 0x2b, 0x95, 0x18, 0x10, 0x99, 0xcc, 0xea,
+ 0xbc, 0xbb, 0xad, 0xaa, 0xc9, 0x8a, 0xa8, 0xad, 0x98, 0x9a, 0x80, 0x0c, 0x80, 0x14, 0x81, 0x20,
+ 0x89, 0x08, 0xea, 0x0e, 0x83, 0x52, 0x52, 0x23, 0x46, 0x12, 0x22, 0x11, 0x10, 0x99, 0xd8, 0x89,
+ 0xa9, 0x9d, 0xa0, 0x8b, 0x18, 0xba, 0xc0, 0x0c, 0x89, 0xf8, 0x8b, 0x98, 0x88, 0xcf, 0xa8, 0xbc,
+ 0x99, 0xcc, 0x10, 0x21, 0x55, 0x34, 0x35, 0x35, 0x24, 0x42, 0x21, 0x11, 0x01, 0xa8, 0xa9, 0xac,
+ 0xcb, 0xba, 0x9b, 0xba, 0xab, 0xab, 0xbd, 0xeb, 0xbc, 0xcc, 0xbb, 0xcc, 0xaa, 0xab, 0x99, 0x8a,
+ 0x10, 0x41, 0x53, 0x34, 0x43, 0x25, 0x33, 0x24, 0x23, 0x32, 0x31, 0x11, 0x11, 0x20, 0x40, 0x12,
+ 0x54, 0x24, 0x33, 0x23, 0x21, 0xaa, 0xfb, 0xcf, 0xb9, 0xbc, 0xbb, 0xac, 0xb9, 0x99, 0xaa, 0x98,
+ 0xc1, 0xee, 0x2c, 0x00, 0xaa, 0xcb, 0xba, 0xbb, 0xb9, 0x39, 0x43, 0x56, 0x43, 0x34, 0x33, 0x43,
+ 0x23, 0x22, 0x22, 0x22, 0x02, 0x42, 0x42, 0x83, 0x21, 0x21, 0x10, 0xa8, 0x99, 0xc0, 0x18, 0x9e,
+ 0xda, 0xdc, 0xcb, 0xbd, 0xbc, 0xcb, 0xab, 0xb9, 0x09, 0x20, 0x32, 0x26, 0x21, 0x81, 0x98, 0xdc,
+ 0xba, 0xad, 0x9c, 0x8a, 0x81, 0x33, 0x44, 0x21, 0x16, 0x21, 0x21, 0x81, 0x30, 0x32, 0x91, 0x47,
+ 0x88, 0x11, 0x91, 0x9a, 0x90, 0xbd, 0x89, 0xae, 0x01, 0x88, 0x99, 0x33, 0xbf, 0xbb, 0xfa, 0xac,
+ 0xa9, 0xbc, 0x88, 0xba, 0x51, 0x88, 0x30, 0x17, 0x42, 0x26, 0x42, 0x35, 0x33, 0x25, 0x23, 0x22,
+ 0x02, 0xa8, 0xba, 0xce, 0x9a, 0xac, 0x9a, 0x89, 0x88, 0x01, 0x98, 0xca, 0xce, 0xcb, 0xeb, 0xab,
+ 0xbb, 0xab, 0x89, 0x00, 0x41, 0x24, 0x63, 0x22, 0x31, 0x22, 0x22, 0x32, 0x33, 0x73, 0x33, 0x43,
+ 0x23, 0x33, 0x23, 0x23, 0x31, 0x83, 0x30, 0x03, 0xbb, 0xe9, 0xde, 0xcc, 0xca, 0xcb, 0xbb, 0xcb,
+ 0x9b, 0xaa, 0x9a, 0xca, 0x9b, 0xbb, 0xdc, 0xbc, 0x9a, 0x9b, 0x81, 0x21, 0x37, 0x44, 0x24, 0x43,
+ 0x21, 0x12, 0x11, 0x10, 0x80, 0x18, 0x31, 0x34, 0x35, 0x31, 0x34, 0x11, 0x01, 0xdb, 0xcb, 0xc9,
+ 0xab, 0xbd, 0xab, 0xab, 0xca, 0xca, 0xbc, 0xa9, 0xa8, 0x9b, 0x89, 0x02, 0x52, 0x81, 0x80, 0xda,
+ 0xbd, 0xec, 0xaa, 0xa9, 0x8a, 0x31, 0x55, 0x43, 0x33, 0x43, 0x23, 0x81, 0xa8, 0xab, 0xa9, 0xac,
+ 0x01, 0x50, 0x46, 0x21, 0x42, 0x01, 0x81, 0x99, 0xdb, 0xba, 0xad, 0xba, 0x99, 0x9a, 0x90, 0x89,
+ 0x9b, 0xd8, 0x9f, 0x8a, 0xb9, 0x19, 0xcc, 0x88, 0xc8, 0x0c, 0xdb, 0x9b, 0x38, 0x19, 0x77, 0x42,
+ 0x44, 0x43, 0x43, 0x22, 0x23, 0x01, 0x90, 0xbb, 0xcd, 0xba, 0xbb, 0xaa, 0x89, 0x10, 0x33, 0x00,
+ 0x2a, 0x12, 0x29, 0x00, 0xdb, 0xcd, 0xcc, 0xcc, 0xab, 0xbb, 0x9a, 0x09, 0x18, 0x42, 0x34, 0x34,
+ 0x23, 0x42, 0x21, 0x12, 0x21, 0x23, 0x42, 0x25, 0x43, 0x23, 0x43, 0x22, 0x13, 0x32, 0x21, 0x13,
+ 0x21, 0xa8, 0xdf, 0xbc, 0xbd, 0xcc, 0xbb, 0xad, 0xab, 0xaa, 0x98, 0x09, 0x00, 0x18, 0x90, 0xcc,
+ 0xca, 0xba, 0x8d, 0x9a, 0x21, 0x45, 0x44, 0x34, 0x42, 0x22, 0x22, 0x81, 0x90, 0xa9, 0xa9, 0x89,
+ 0x00, 0x42, 0x34, 0x35, 0x13, 0x81, 0xca, 0xcb, 0xcc, 0xbc, 0xbb, 0xaa, 0x9a, 0x98, 0x88, 0x88,
+ 0x88, 0x8a, 0xe9, 0x89, 0x01, 0x89, 0x00, 0xad, 0xc8, 0xce, 0xcb, 0xba, 0x8b, 0x00, 0x50, 0x55,
+ 0x32, 0x35, 0x13, 0x23, 0x88, 0x98, 0xbb, 0xcb, 0x8b, 0x08, 0x54, 0x34, 0x34, 0x24, 0x11, 0x80,
+ 0xcc, 0xbb, 0xdc, 0x9a, 0xba, 0x89, 0x80, 0x29, 0xa1, 0x99, 0xcb, 0xcf, 0xaa, 0xab, 0x8a, 0x10,
+ 0x39, 0x86, 0x22, 0x89, 0xfa, 0xbb, 0xaa, 0x19, 0x72, 0x37, 0x46, 0x43, 0x43, 0x43, 0x12, 0x12,
+ 0x80, 0xa9, 0xdb, 0xbb, 0xbc, 0xaa, 0x9a, 0x01, 0x31, 0x12, 0x02, 0xac, 0xcf, 0xdb, 0xcc, 0xba,
+ 0xab, 0x9b, 0x89, 0x10, 0x34, 0x53, 0x43, 0x22, 0x12, 0x11, 0x00, 0x08, 0x08, 0x31, 0x34, 0x46,
+ 0x43, 0x33, 0x34, 0x22, 0x12, 0x01, 0x91, 0xa9, 0xc9, 0xcc, 0xac, 0xcb, 0xcc, 0xca, 0xba, 0xbb,
+ 0xab, 0xa9, 0x98, 0x89, 0x00, 0xaa, 0xeb, 0xbd, 0xac, 0xbb, 0x9a, 0x08, 0x46, 0x63, 0x34, 0x33,
+ 0x33, 0x32, 0x81, 0xb9, 0xdb, 0xdb, 0x99, 0x0a, 0x20, 0x53, 0x34, 0x43, 0x12, 0x01, 0xb9, 0xcc,
+ 0xbc, 0xac, 0xa9, 0x09, 0x00, 0x23, 0x53, 0x22, 0x02, 0x08, 0xca, 0xcb, 0xad, 0x99, 0x9b, 0xba,
+ 0x80, 0x9a, 0xaa, 0x9e, 0xa8, 0xb9, 0x81, 0x45, 0x40, 0x34, 0x32, 0x30, 0xc1, 0x8a, 0xdd, 0xa8,
+ 0x0d, 0xf8, 0x25, 0x00, 0x12, 0x61, 0x25, 0x32, 0x35, 0x13, 0x12, 0xb8, 0xba, 0xec, 0xba, 0x99,
+ 0x8a, 0x21, 0x31, 0x24, 0x20, 0xa1, 0xfb, 0x9f, 0xbc, 0xba, 0xab, 0x9a, 0x08, 0x32, 0x06, 0x21,
+ 0x08, 0x9b, 0xc9, 0x9a, 0x18, 0x66, 0x55, 0x44, 0x43, 0x43, 0x32, 0x12, 0x01, 0xa8, 0xbc, 0xbc,
+ 0xbc, 0xba, 0x8a, 0x08, 0x22, 0x33, 0x13, 0xa0, 0xcf, 0xcd, 0xbc, 0xbc, 0xbb, 0x9a, 0x89, 0x21,
+ 0x52, 0x34, 0x33, 0x33, 0x11, 0x91, 0xa9, 0xbb, 0x9b, 0x18, 0x37, 0x45, 0x34, 0x34, 0x33, 0x23,
+ 0x12, 0x01, 0x88, 0xba, 0xdb, 0xbb, 0xcc, 0xaa, 0xad, 0xab, 0xac, 0xb9, 0x9c, 0xa9, 0x98, 0x08,
+ 0xbb, 0xcd, 0xdb, 0xcb, 0xcb, 0xab, 0x9a, 0x10, 0x34, 0x46, 0x43, 0x33, 0x33, 0x02, 0xa8, 0xdb,
+ 0xcb, 0xbb, 0xaa, 0x18, 0x53, 0x36, 0x42, 0x33, 0x22, 0x01, 0xa8, 0xcc, 0xca, 0xba, 0x9b, 0x18,
+ 0x21, 0x55, 0x13, 0x33, 0x01, 0x88, 0xda, 0xbc, 0xcb, 0xcb, 0xba, 0x8a, 0x8a, 0x90, 0x99, 0x18,
+ 0x98, 0x01, 0xbc, 0x82, 0x08, 0x89, 0xba, 0x9c, 0x9d, 0xfb, 0x88, 0x24, 0x73, 0x17, 0x32, 0x34,
+ 0x33, 0x13, 0x11, 0xc8, 0xba, 0xcd, 0x99, 0x09, 0x88, 0x44, 0x22, 0x35, 0x81, 0x91, 0xfb, 0xca,
+ 0xbc, 0xac, 0xaa, 0xba, 0x08, 0x10, 0x32, 0x43, 0x91, 0x91, 0xbd, 0xdb, 0xac, 0x99, 0x52, 0x44,
+ 0x45, 0x44, 0x32, 0x24, 0x32, 0x12, 0x88, 0xa8, 0xdb, 0xba, 0xbc, 0xaa, 0x99, 0x20, 0x11, 0x31,
+ 0xa1, 0xea, 0xcd, 0xbd, 0xbc, 0xbc, 0xba, 0xaa, 0x98, 0x21, 0x32, 0x36, 0x23, 0x23, 0x12, 0x01,
+ 0xa8, 0x88, 0xa8, 0x62, 0x53, 0x54, 0x33, 0x44, 0x23, 0x23, 0x22, 0x11, 0xa0, 0xa9, 0xca, 0xac,
+ 0xdb, 0xbb, 0xca, 0xaa, 0xab, 0xab, 0x9a, 0x9a, 0xca, 0xdb, 0xbb, 0xce, 0xcc, 0xaa, 0xbb, 0xba,
+ 0xd4, 0xea, 0x2a, 0x00, 0x18, 0x42, 0x53, 0x33, 0x34, 0x14, 0x01, 0x99, 0x9a, 0xcc, 0xa9, 0x09,
+ 0x42, 0x36, 0x54, 0x33, 0x34, 0x22, 0x02, 0x98, 0xaa, 0xbc, 0xbc, 0xab, 0x8a, 0x10, 0x43, 0x72,
+ 0x22, 0x11, 0x90, 0xbb, 0xec, 0xbc, 0xcb, 0xbb, 0x9b, 0xab, 0x88, 0x18, 0x32, 0x23, 0x44, 0x01,
+ 0x80, 0xab, 0xba, 0xbe, 0xb9, 0xa8, 0x2c, 0x52, 0x26, 0x53, 0x44, 0x32, 0x32, 0x13, 0x21, 0x81,
+ 0xa9, 0xdb, 0x99, 0x8d, 0x98, 0x33, 0x51, 0x22, 0x50, 0x91, 0xb8, 0xbd, 0xaf, 0xbb, 0xae, 0xb9,
+ 0x9a, 0x99, 0x9a, 0x98, 0xb9, 0x10, 0xae, 0xc0, 0xac, 0x90, 0x8a, 0x42, 0x73, 0x37, 0x43, 0x44,
+ 0x32, 0x25, 0x12, 0x23, 0x81, 0x08, 0xca, 0xab, 0xdb, 0x9b, 0xaa, 0x89, 0x02, 0x21, 0x00, 0xa9,
+ 0xfe, 0xbc, 0xcc, 0xac, 0xbb, 0xab, 0x9a, 0x08, 0x32, 0x54, 0x33, 0x33, 0x22, 0x01, 0x98, 0xab,
+ 0xba, 0x09, 0x73, 0x64, 0x43, 0x43, 0x24, 0x23, 0x22, 0x10, 0x98, 0xaa, 0xbc, 0xbc, 0xab, 0xbb,
+ 0xab, 0x98, 0x08, 0x00, 0x9a, 0xe9, 0xba, 0xfc, 0xcb, 0xac, 0xcb, 0xcb, 0x9c, 0x9a, 0x89, 0x00,
+ 0x32, 0x44, 0x24, 0x33, 0x22, 0x02, 0xa8, 0xca, 0xbc, 0x9a, 0x09, 0x72, 0x44, 0x53, 0x33, 0x24,
+ 0x23, 0x11, 0x99, 0xd9, 0xab, 0xac, 0xab, 0x89, 0x10, 0x32, 0x45, 0x22, 0x12, 0xb8, 0xce, 0xda,
+ 0xbb, 0xcb, 0x9c, 0x9a, 0x98, 0x10, 0x10, 0x32, 0x12, 0x22, 0x81, 0x08, 0xcc, 0x9b, 0xb8, 0x41,
+ 0x24, 0x71, 0x25, 0x32, 0x43, 0x13, 0x25, 0x01, 0x12, 0x90, 0x08, 0x98, 0xab, 0xe8, 0x3a, 0xa8,
+ 0x28, 0x16, 0x20, 0x22, 0x9c, 0xb0, 0xbf, 0xcd, 0xcb, 0xba, 0xad, 0x9a, 0xaa, 0x98, 0x08, 0x28,
+ 0x81, 0x32, 0xa9, 0xb1, 0xce, 0x89, 0xab, 0x39, 0x16, 0x57, 0x43, 0x53, 0x34, 0x43, 0x33, 0x33,
+ 0xe3, 0x1e, 0x31, 0x00, 0x12, 0x01, 0x99, 0xca, 0xca, 0xab, 0xab, 0xaa, 0xa9, 0x08, 0xcb, 0xd9,
+ 0xfc, 0xbb, 0xbd, 0xbc, 0xbc, 0xbb, 0xab, 0x9a, 0x00, 0x21, 0x35, 0x42, 0x33, 0x22, 0x13, 0x81,
+ 0x20, 0x81, 0x73, 0x53, 0x35, 0x34, 0x25, 0x24, 0x23, 0x12, 0x02, 0x88, 0xaa, 0xdc, 0xaa, 0xcb,
+ 0x9a, 0x9a, 0x98, 0x80, 0x10, 0x80, 0xd9, 0xdb, 0xbd, 0xbd, 0xdb, 0xbb, 0xcb, 0xaa, 0x99, 0x28,
+ 0x22, 0x34, 0x35, 0x24, 0x22, 0x12, 0x01, 0x99, 0x9a, 0xab, 0x10, 0x64, 0x43, 0x45, 0x33, 0x24,
+ 0x33, 0x22, 0x00, 0xb9, 0xdb, 0xbc, 0xba, 0xbb, 0xa9, 0x10, 0x51, 0x01, 0x31, 0xb0, 0xbc, 0xce,
+ 0xbe, 0xba, 0xac, 0xaa, 0xaa, 0x89, 0x18, 0x21, 0x42, 0x23, 0x83, 0x49, 0xa1, 0xa9, 0x9a, 0x29,
+ 0x30, 0x26, 0x77, 0x12, 0x53, 0x22, 0x21, 0x23, 0x10, 0x81, 0xab, 0xb8, 0xae, 0x80, 0xbb, 0x30,
+ 0x15, 0x30, 0x81, 0x20, 0x98, 0xef, 0xca, 0xdb, 0xba, 0x9c, 0xab, 0xaa, 0xa9, 0x30, 0x83, 0x50,
+ 0x12, 0x28, 0xc4, 0x9d, 0x89, 0xcc, 0x91, 0x9b, 0x63, 0x21, 0x45, 0x43, 0x63, 0x23, 0x34, 0x32,
+ 0x23, 0x13, 0x21, 0x80, 0x98, 0xba, 0x8c, 0xcc, 0x08, 0xba, 0x18, 0xfb, 0xa9, 0xea, 0xad, 0xcb,
+ 0xcb, 0xcb, 0xaa, 0xab, 0x9a, 0x88, 0x10, 0x22, 0x33, 0x34, 0x12, 0x21, 0x00, 0x02, 0x7a, 0x24,
+ 0x45, 0x25, 0x34, 0x53, 0x22, 0x23, 0x01, 0x82, 0x98, 0xac, 0xca, 0xaa, 0xab, 0xab, 0x11, 0x2a,
+ 0x33, 0x90, 0x98, 0xfd, 0xac, 0xec, 0xba, 0xb9, 0xad, 0xa9, 0xaa, 0x09, 0x08, 0x41, 0x22, 0x35,
+ 0x10, 0x12, 0x11, 0x98, 0xc0, 0x9a, 0x1b, 0xd9, 0x71, 0x02, 0x54, 0x32, 0x42, 0x33, 0x12, 0x01,
+ 0x88, 0xd9, 0x9a, 0xbb, 0xbb, 0x80, 0x38, 0x54, 0x24, 0x01, 0x81, 0x8c, 0xf9, 0xad, 0xba, 0xdb,
+ 0xc6, 0xfb, 0x2a, 0x00, 0x89, 0xab, 0x90, 0x81, 0x28, 0x18, 0x91, 0x11, 0xac, 0x90, 0xaa, 0xec,
+ 0x80, 0x30, 0x59, 0x50, 0x82, 0x26, 0x11, 0x52, 0x12, 0x0a, 0x83, 0x0a, 0x93, 0x29, 0xa4, 0x79,
+ 0x03, 0x40, 0x22, 0x11, 0x08, 0xe1, 0xa9, 0xbb, 0xeb, 0xab, 0x0c, 0xa0, 0x0a, 0x81, 0xb1, 0x2d,
+ 0xca, 0xfa, 0x9c, 0x8b, 0xe9, 0x89, 0x88, 0x18, 0x11, 0x08, 0x16, 0x33, 0x26, 0x52, 0x34, 0x33,
+ 0x37, 0x31, 0x25, 0x22, 0x33, 0x22, 0x21, 0xa1, 0x09, 0xeb, 0xb9, 0xac, 0x9d, 0xb9, 0xad, 0xb9,
+ 0xcc, 0xb9, 0xbc, 0xaa, 0xbc, 0x99, 0xac, 0xa8, 0x0a, 0x99, 0x18, 0x42, 0x22, 0x55, 0x32, 0x33,
+ 0x34, 0x35, 0x43, 0x33, 0x23, 0x42, 0x22, 0x43, 0x90, 0x28, 0xa9, 0x08, 0x9a, 0xbd, 0xd0, 0x8c,
+ 0xda, 0xb8, 0xab, 0xca, 0x9c, 0xad, 0xa9, 0xaa, 0xb8, 0x8e, 0x98, 0xa0, 0x19, 0x9b, 0x31, 0xc0,
+ 0x29, 0x1a, 0x85, 0x82, 0x70, 0x04, 0x68, 0x80, 0x00, 0x21, 0x99, 0x91, 0x89, 0x89, 0xa1, 0x7b,
+ 0x91, 0x70, 0x14, 0x31, 0x02, 0x23, 0x12, 0x43, 0x08, 0x8c, 0xa9, 0xf8, 0xa9, 0x8a, 0x4a, 0xb9,
+ 0xc8, 0x99, 0x88, 0xeb, 0xbc, 0xad, 0xba, 0x9e, 0x98, 0xab, 0xa9, 0x0a, 0x31, 0x88, 0x41, 0x8b,
+ 0x35, 0x98, 0xc4, 0xab, 0x13, 0x9e, 0x01, 0x42, 0x50, 0x24, 0x25, 0x33, 0x14, 0x51, 0x01, 0x00,
+ 0xb0, 0x0d, 0xa8, 0x9a, 0x00, 0x10, 0x73, 0x24, 0x14, 0x31, 0x80, 0xd8, 0xb9, 0xaf, 0xdb, 0xa9,
+ 0x8b, 0x89, 0x18, 0x15, 0x32, 0x32, 0xa3, 0x18, 0xbd, 0xbc, 0xed, 0x89, 0x9a, 0x18, 0x11, 0x44,
+ 0x43, 0x43, 0x24, 0x32, 0x12, 0x23, 0x12, 0x43, 0x23, 0x34, 0x44, 0x50, 0x03, 0x11, 0x13, 0x9b,
+ 0xe8, 0xba, 0x9f, 0xbb, 0xcb, 0xab, 0xbc, 0xca, 0xaa, 0xba, 0x9c, 0xba, 0x90, 0x8a, 0x01, 0x99,
+ 0xa7, 0xf7, 0x1d, 0x00, 0x41, 0x86, 0x23, 0x70, 0x11, 0x22, 0x34, 0x52, 0x33, 0x25, 0x31, 0x22,
+ 0x11, 0x91, 0xa8, 0xaa, 0xe9, 0x9a, 0x8b, 0x8d, 0x98, 0xb0, 0xb9, 0x8c, 0xfa, 0x9a, 0xbd, 0xca,
+ 0xaa, 0xbb, 0xc9, 0x89, 0xbb, 0x00, 0x0a, 0x03, 0x89, 0x01, 0x43, 0xaf, 0xe1, 0x00, 0x0b, 0x8a,
+ 0xa8, 0x12, 0x57, 0x30, 0x25, 0x51, 0x21, 0x12, 0x22, 0x93, 0x18, 0x09, 0xc0, 0x30, 0x28, 0x26,
+ 0x30, 0x23, 0x14, 0x95, 0x99, 0x8e, 0xcb, 0xbc, 0xab, 0xbd, 0xa9, 0x9b, 0x98, 0xba, 0x80, 0x3b,
+ 0x81, 0xb8, 0xbd, 0xbf, 0xb9, 0x8b, 0x9b, 0xb0, 0x27, 0x10, 0x43, 0x62, 0x42, 0x93, 0x62, 0x00,
+ 0x10, 0xb3, 0x38, 0x98, 0x32, 0x3b, 0x56, 0x24, 0x21, 0x33, 0x22, 0x12, 0x9a, 0x07, 0x8e, 0xa8,
+ 0x88, 0x1b, 0xc8, 0x02, 0x13, 0x3d, 0x05, 0x0a, 0x00, 0x99, 0xe1, 0x9c, 0x09, 0xfb, 0x8a, 0xa0,
+ 0x18, 0x89, 0x02, 0x2a, 0x06, 0x92, 0x21, 0xba, 0x18, 0xdf, 0xb9, 0xca, 0x10, 0x8b, 0x70, 0x83,
+ 0x34, 0x10, 0x31, 0x93, 0x39, 0x97, 0x38, 0x23, 0x72, 0x34, 0x42, 0x24, 0x22, 0x01, 0x88, 0xda,
+ 0xab, 0xec, 0xa9, 0xa9, 0x0b, 0x98, 0x99, 0x93, 0x2b, 0x02, 0xcf, 0x98, 0xba, 0x9d, 0x99, 0x82,
+ 0x18, 0x25, 0x14, 0x41, 0x54, 0x80, 0x91, 0x23, 0x99, 0x10, 0x92, 0x9c, 0x51, 0x90, 0xaa, 0x81,
+ 0x8b, 0xcc, 0x88, 0xfb, 0x09, 0xcb, 0xc9, 0x9a, 0xa9, 0x9c, 0x19, 0xaa, 0x84, 0x0a, 0x24, 0x10,
+ 0x04, 0x3b, 0x23, 0x4a, 0xa5, 0xa0, 0x40, 0x80, 0x12, 0x42, 0x99, 0x38, 0x13, 0x9c, 0x0b, 0x87,
+ 0xea, 0x8a, 0x48, 0xca, 0x91, 0x8f, 0x11, 0x10, 0xb4, 0x7a, 0x02, 0x12, 0x89, 0x42, 0x82, 0x11,
+ 0x09, 0x43, 0x01, 0xe9, 0x89, 0x21, 0xcb, 0xb8, 0x8b, 0xbc, 0x9b, 0xdc, 0xa0, 0xb9, 0x2a, 0x8e,
+ 0xcd, 0xfd, 0x1a, 0x00, 0x19, 0x0c, 0xf8, 0x8a, 0x90, 0x89, 0x3b, 0xa0, 0x83, 0x44, 0x82, 0x32,
+ 0x63, 0x80, 0x40, 0x0a, 0x94, 0xa1, 0x49, 0x3a, 0x06, 0x63, 0x11, 0x03, 0x24, 0x18, 0x42, 0x88,
+ 0xa1, 0x83, 0x9f, 0xda, 0x91, 0x2a, 0x8e, 0xb1, 0x88, 0x01, 0x19, 0xd0, 0x51, 0x80, 0x00, 0x88,
+ 0xac, 0xd2, 0x8c, 0xa2, 0x4b, 0x24, 0x28, 0x37, 0x40, 0x03, 0x08, 0xd8, 0xa1, 0x0c, 0xaa, 0x19,
+ 0x99, 0x00, 0x84, 0x15, 0x11, 0xca, 0xab, 0xac, 0x9d, 0xcb, 0x92, 0x22, 0x71, 0x25, 0x53, 0x43,
+ 0x23, 0x43, 0x20, 0x33, 0xb0, 0xa1, 0xbd, 0x9e, 0xbb, 0xae, 0xaa, 0xa9, 0x10, 0x80, 0x31, 0x41,
+ 0x01, 0x88, 0xcd, 0xcc, 0xab, 0xca, 0x89, 0x20, 0x43, 0x36, 0x53, 0x23, 0x21, 0x08, 0xba, 0xda,
+ 0xeb, 0x8a, 0x99, 0x09, 0x32, 0x24, 0x43, 0x23, 0xa1, 0xca, 0xba, 0xbf, 0xac, 0xac, 0x89, 0x98,
+ 0x22, 0x52, 0x32, 0x43, 0x23, 0x10, 0xa9, 0x98, 0xbd, 0xaa, 0xbc, 0x0a, 0x09, 0xa2, 0x7a, 0x25,
+ 0x43, 0x18, 0x23, 0x52, 0xc2, 0x10, 0x9a, 0xaa, 0xac, 0x9a, 0x98, 0x09, 0x37, 0x22, 0x62, 0x32,
+ 0x03, 0xa8, 0xaa, 0xe8, 0xae, 0xb9, 0x0b, 0x18, 0x10, 0x44, 0x24, 0x31, 0x82, 0xba, 0xcc, 0xcc,
+ 0xac, 0x9b, 0xaa, 0x98, 0x48, 0x32, 0x42, 0x15, 0x81, 0x80, 0x99, 0xa8, 0xae, 0x8b, 0x9c, 0xa9,
+ 0xa0, 0x15, 0x40, 0x48, 0x21, 0x15, 0x20, 0x02, 0x08, 0xbd, 0x90, 0x9a, 0x19, 0x2a, 0x37, 0x23,
+ 0x71, 0x30, 0x92, 0x02, 0xa1, 0xcb, 0x0c, 0x8a, 0xae, 0x98, 0x92, 0x21, 0x44, 0x10, 0x83, 0x80,
+ 0x30, 0xcf, 0xb8, 0x09, 0x90, 0x42, 0x58, 0x14, 0x22, 0x52, 0x12, 0x09, 0x92, 0xb8, 0xad, 0x1b,
+ 0xdc, 0x81, 0x9d, 0x81, 0x10, 0x80, 0x29, 0x04, 0x0c, 0x91, 0xf0, 0x28, 0x8e, 0x90, 0x99, 0x52,
+ 0xf6, 0xff, 0x1f, 0x00, 0x18, 0x11, 0x11, 0x98, 0x80, 0xa8, 0x8c, 0xef, 0x8b, 0xa1, 0x19, 0x00,
+ 0x21, 0x41, 0x37, 0x41, 0x31, 0x01, 0x20, 0x81, 0x01, 0xc1, 0x63, 0x3a, 0xaa, 0x90, 0x95, 0x91,
+ 0x09, 0x0d, 0x01, 0xc9, 0x36, 0x88, 0xc9, 0x19, 0x0c, 0xb9, 0xc1, 0xa9, 0x2b, 0x92, 0x27, 0x28,
+ 0x61, 0x92, 0x2a, 0xb0, 0x20, 0xfb, 0x9b, 0x80, 0x98, 0x23, 0x43, 0x8d, 0x18, 0xf9, 0xa0, 0x9c,
+ 0xb9, 0x8d, 0xa9, 0x89, 0x81, 0x30, 0x21, 0x24, 0x8a, 0x93, 0x97, 0x9f, 0x81, 0xa8, 0x9e, 0x01,
+ 0x89, 0x3a, 0xb8, 0x90, 0x3a, 0x93, 0x00, 0xd9, 0x1a, 0x17, 0x1b, 0xea, 0x08, 0x98, 0x01, 0xc8,
+ 0xb1, 0x68, 0x3b, 0xd2, 0x41, 0x82, 0x89, 0x72, 0x91, 0xa2, 0x62, 0x99, 0x22, 0x1a, 0xd1, 0x08,
+ 0x48, 0x9b, 0x91, 0x08, 0x86, 0x1a, 0x9c, 0x97, 0x28, 0x89, 0x11, 0x89, 0x82, 0x02, 0x0d, 0xd3,
+ 0x20, 0x9d, 0x13, 0xac, 0x14, 0x11, 0x78, 0x90, 0x85, 0x18, 0x91, 0x10, 0x1a, 0x4a, 0xc8, 0x11,
+ 0xa8, 0x8c, 0x92, 0x89, 0x12, 0x41, 0x18, 0x36, 0x9a, 0x44, 0xca, 0x92, 0x9f, 0x01, 0xa8, 0x21,
+ 0xba, 0x33, 0x11, 0x9a, 0xbf, 0x88, 0xf9, 0x09, 0xc8, 0x10, 0x09, 0x4b, 0xd8, 0xb0, 0x53, 0x0a,
+ 0x54, 0x23, 0x37, 0x33, 0x34, 0x23, 0x12, 0xbc, 0xdb, 0xac, 0xcd, 0xbb, 0xa9, 0x19, 0x08, 0x32,
+ 0x23, 0x65, 0x81, 0x08, 0x98, 0x98, 0xa9, 0x1f, 0x18, 0x32, 0x25, 0x53, 0x02, 0x10, 0x98, 0xdc,
+ 0xab, 0xaa, 0xcb, 0x8b, 0x88, 0x08, 0x35, 0x43, 0x28, 0x83, 0x01, 0x09, 0xa8, 0x20, 0xc9, 0x98,
+ 0x1a, 0x16, 0x0d, 0x12, 0xab, 0x23, 0x26, 0xbb, 0x57, 0x18, 0x90, 0x89, 0xa0, 0x8c, 0xcc, 0x09,
+ 0x89, 0x51, 0x04, 0x21, 0x24, 0x14, 0x19, 0x8b, 0xeb, 0xc8, 0xba, 0xb8, 0x0d, 0x81, 0x20, 0x09,
+ 0x54, 0xff, 0x1d, 0x00, 0x12, 0x9b, 0x90, 0xbf, 0x11, 0x02, 0x39, 0x01, 0x37, 0x33, 0x10, 0x00,
+ 0x1a, 0xe8, 0xaf, 0xb8, 0x19, 0xd0, 0x0c, 0x00, 0xb9, 0x32, 0xba, 0xb9, 0x70, 0x91, 0x53, 0x11,
+ 0x34, 0x11, 0x80, 0x82, 0x9d, 0x8e, 0x80, 0x80, 0x00, 0x52, 0x18, 0x21, 0x19, 0xf9, 0xc0, 0xaa,
+ 0x0c, 0xb9, 0x0a, 0x18, 0x46, 0x33, 0x72, 0x80, 0x02, 0x00, 0x89, 0x9a, 0x8e, 0xc0, 0x98, 0x10,
+ 0x88, 0xd8, 0x29, 0x80, 0xa1, 0x91, 0x1e, 0x09, 0x4a, 0x95, 0xa2, 0x30, 0x23, 0x8f, 0x41, 0x10,
+ 0xb1, 0x41, 0x81, 0x03, 0x2b, 0xc8, 0xcb, 0x0f, 0xba, 0xb9, 0x98, 0xa0, 0x70, 0x30, 0x05, 0x10,
+ 0xa1, 0x89, 0xda, 0x98, 0x4a, 0x11, 0x49, 0x07, 0x42, 0x02, 0x01, 0x90, 0x2b, 0x9d, 0xc0, 0xa0,
+ 0x29, 0x80, 0x52, 0x05, 0x59, 0x81, 0x08, 0x01, 0x1a, 0xa3, 0x20, 0x18, 0x2a, 0xc5, 0xaf, 0xb9,
+ 0x9f, 0xbb, 0xa8, 0x90, 0x3a, 0x02, 0x24, 0x32, 0x84, 0x41, 0x98, 0x42, 0x13, 0x89, 0x27, 0x89,
+ 0x48, 0xc1, 0xa0, 0x8b, 0xbb, 0xeb, 0x8c, 0x8a, 0xa2, 0x15, 0x81, 0x70, 0x18, 0x00, 0xb9, 0xa1,
+ 0xa2, 0x48, 0x2a, 0x55, 0x91, 0x42, 0x88, 0x93, 0xbf, 0x91, 0x8d, 0xc0, 0x29, 0x18, 0xa9, 0x13,
+ 0x81, 0x18, 0x9e, 0xc8, 0x21, 0x42, 0x51, 0x01, 0x71, 0x92, 0x81, 0x08, 0xa8, 0xac, 0xab, 0xb8,
+ 0x8d, 0x81, 0xa9, 0x41, 0xa1, 0xcb, 0x9f, 0xa0, 0x8c, 0x02, 0x00, 0x02, 0x43, 0x21, 0x35, 0x1b,
+ 0x0e, 0xf0, 0x80, 0x99, 0x89, 0x00, 0x00, 0x19, 0x81, 0x80, 0xdf, 0x09, 0xa0, 0x88, 0x00, 0x71,
+ 0x24, 0x12, 0x80, 0x01, 0x68, 0x98, 0xb9, 0xd8, 0x00, 0x08, 0x21, 0x23, 0x33, 0x04, 0x38, 0xbe,
+ 0x98, 0xad, 0xb3, 0x1c, 0x17, 0x3a, 0x20, 0x22, 0x01, 0x14, 0xa3, 0x2a, 0xfa, 0x99, 0x8e, 0x3b,
+ 0x1e, 0x00, 0x1a, 0x00, 0x0c, 0x80, 0x02, 0x9b, 0x00, 0xda, 0x93, 0x91, 0x33, 0x2e, 0x1a, 0x71,
+ 0xc3, 0x91, 0x1a, 0x02, 0x3a, 0x84, 0xc9, 0x43, 0x2a, 0x07, 0xaa, 0x82, 0x2e, 0x00, 0xab, 0x97,
+ 0x08, 0x80, 0x29, 0x69, 0xb8, 0x04, 0x48, 0x08, 0x02, 0x99, 0xa1, 0x92, 0xa0, 0x3e, 0x9d, 0xa0,
+ 0xc2, 0x4c, 0xb9, 0x81, 0x82, 0x52, 0x89, 0x19, 0x90, 0x73, 0x99, 0x84, 0x80, 0x0a, 0x29, 0x33,
+ 0xf3, 0x10, 0x89, 0xac, 0x88, 0x2b, 0xcd, 0x99, 0xa4, 0x21, 0x52, 0x49, 0x05, 0x31, 0xba, 0xc9,
+ 0xa8, 0x8a, 0xa0, 0x2f, 0xa2, 0x88, 0x89, 0x8e, 0xd9, 0x82, 0xcb, 0x39, 0xd0, 0x12, 0x88, 0x30,
+ 0x72, 0x83, 0x12, 0x19, 0x91, 0xde, 0x19, 0x91, 0x39, 0xb1, 0x20, 0x87, 0x1b, 0xb9, 0x90, 0x9b,
+ 0x38, 0xed, 0x08, 0x82, 0x28, 0x96, 0x60, 0x00, 0xa0, 0x98, 0xba, 0x90, 0xd8, 0x18, 0x38, 0x3c,
+ 0xb9, 0xa5, 0x03, 0xdb, 0x59, 0xa1, 0x31, 0x19, 0x80, 0x17, 0x10, 0x28, 0xa5, 0x8a, 0x98, 0x88,
+ 0x4c, 0x89, 0xd2, 0x09, 0x00, 0x0b, 0x87, 0x19, 0x88, 0xf8, 0x00, 0x09, 0x62, 0xb8, 0x01, 0x2a,
+ 0x22, 0xda, 0x91, 0x61, 0x99, 0x83, 0x23, 0x0b, 0x1f, 0x06, 0x09, 0xa0, 0x4a, 0x00, 0xc8, 0x92,
+ 0x51, 0x8a, 0x91, 0x20, 0x2b, 0x80, 0xf0, 0xa9, 0x25, 0x9a, 0xa4, 0x7a, 0x08, 0x11, 0x88, 0x05,
+ 0x81, 0xa8, 0x20, 0x29, 0x99, 0x70, 0xd0, 0x99, 0xc9, 0x91, 0x19, 0x00, 0x52, 0x40, 0x80, 0x98,
+ 0xe1, 0x19, 0x90, 0x3a, 0x09, 0xcc, 0x82, 0x17, 0x80, 0x2a, 0x1c, 0xa2, 0x01, 0xa9, 0x8b, 0xaf,
+ 0x38, 0xb6, 0x18, 0x19, 0x22, 0x08, 0xa8, 0xc7, 0x5a, 0x80, 0x18, 0x00, 0xb8, 0xb3, 0x2c, 0x9f,
+ 0x98, 0x80, 0x02, 0xb8, 0x6a, 0x23, 0x22, 0xd0, 0x4b, 0xb0, 0xb2, 0x19, 0x8f, 0x82, 0x30, 0xe1,
+ 0xfc, 0xff, 0x1b, 0x00, 0x81, 0x82, 0x19, 0x9c, 0xaa, 0xcd, 0xa1, 0x50, 0x00, 0x49, 0x9b, 0x00,
+ 0xc3, 0x8a, 0x29, 0x46, 0xba, 0xa1, 0xa0, 0x1f, 0x08, 0x18, 0xd3, 0xa1, 0x4a, 0x90, 0x98, 0x19,
+ 0x33, 0x42, 0xd2, 0xaa, 0x50, 0x0b, 0x07, 0x0a, 0x93, 0x1c, 0x00, 0x85, 0x28, 0x32, 0x33, 0xaf,
+ 0x91, 0x30, 0xcc, 0x21, 0xb9, 0x38, 0x33, 0x0b, 0x80, 0xf2, 0x2b, 0x31, 0xf9, 0x89, 0x99, 0x81,
+ 0xad, 0x71, 0x20, 0x82, 0xb2, 0x65, 0x09, 0x20, 0x00, 0x03, 0x0d, 0x22, 0xab, 0x03, 0x90, 0xbb,
+ 0x47, 0x8b, 0x89, 0x9b, 0xc4, 0x20, 0x39, 0x9a, 0xa1, 0xbd, 0x92, 0x8c, 0x18, 0x95, 0x2d, 0x10,
+ 0xc0, 0xb2, 0x80, 0x7b, 0xa1, 0xfa, 0x18, 0x29, 0x92, 0x0a, 0x92, 0x32, 0x2b, 0x19, 0x27, 0x80,
+ 0x81, 0x68, 0x90, 0xb3, 0x1c, 0xa9, 0x0e, 0xa0, 0x4a, 0x97, 0x40, 0xb1, 0x12, 0x1a, 0x18, 0x4c,
+ 0xa3, 0x02, 0x98, 0x39, 0xfb, 0x98, 0x38, 0x0f, 0xa0, 0x08, 0x30, 0xfa, 0x80, 0x9a, 0x00, 0x39,
+ 0x2d, 0xa4, 0x29, 0xa8, 0x11, 0xd4, 0x62, 0x8a, 0x21, 0x98, 0x92, 0xc2, 0xeb, 0x0a, 0x08, 0x38,
+ 0x0c, 0xb5, 0x28, 0x99, 0x95, 0x88, 0xa9, 0x9c, 0x80, 0x8c, 0x9b, 0x05, 0x04, 0x99, 0x3e, 0xa1,
+ 0x03, 0x1d, 0xb8, 0x92, 0x38, 0x70, 0xaa, 0x00, 0x05, 0x58, 0x10, 0xb2, 0x90, 0x4c, 0xb2, 0x10,
+ 0x29, 0x84, 0x51, 0xc8, 0x20, 0x29, 0xa9, 0xe3, 0xa1, 0x2b, 0x50, 0x51, 0xa0, 0x93, 0xa2, 0x5a,
+ 0x09, 0xd0, 0x09, 0x88, 0x09, 0x03, 0xcf, 0x23, 0xf8, 0x39, 0x81, 0x30, 0xb3, 0x2e, 0xb2, 0x8a,
+ 0xb1, 0x3a, 0x31, 0x2a, 0xb9, 0xb6, 0x92, 0x29, 0x65, 0x9c, 0x03, 0xa9, 0x18, 0x87, 0x2c, 0x92,
+ 0x99, 0x12, 0x3c, 0x18, 0xbd, 0x04, 0x92, 0x5b, 0x09, 0xa9, 0x08, 0x22, 0xd5, 0x1a, 0x1b, 0xe9,
+ 0xd2, 0xff, 0x1b, 0x00, 0x10, 0x02, 0xc9, 0x33, 0x39, 0x22, 0x17, 0x8d, 0x18, 0x01, 0x88, 0x8a,
+ 0x03, 0xc9, 0x73, 0xb9, 0x1a, 0xc1, 0xaa, 0x14, 0x1c, 0xca, 0xa2, 0x30, 0x8c, 0x42, 0xa1, 0x29,
+ 0xf2, 0x1e, 0x9a, 0x13, 0x01, 0x00, 0x29, 0x0f, 0xa3, 0xb0, 0x08, 0x90, 0x48, 0x02, 0x43, 0x3d,
+ 0x02, 0xca, 0x93, 0x31, 0x9d, 0xe0, 0x42, 0x9b, 0x0b, 0xd3, 0x18, 0x9a, 0x91, 0x05, 0x28, 0x8f,
+ 0xa1, 0x89, 0xa0, 0x40, 0x84, 0x59, 0x98, 0xa3, 0xb0, 0x2c, 0x34, 0x0b, 0xc2, 0xe2, 0x41, 0x0b,
+ 0x82, 0x09, 0xb6, 0x2a, 0x20, 0xb9, 0x13, 0xd8, 0x9b, 0x24, 0x49, 0x20, 0xf3, 0xa2, 0x4a, 0x82,
+ 0x0d, 0x0a, 0xf2, 0x81, 0x1a, 0x11, 0x18, 0x12, 0x8d, 0x93, 0xa8, 0x90, 0x1f, 0x11, 0x84, 0x1a,
+ 0x90, 0xe0, 0x3a, 0x12, 0x0a, 0x17, 0x09, 0x9a, 0x52, 0xa2, 0x94, 0x2a, 0x68, 0xa0, 0x31, 0xd1,
+ 0x89, 0x10, 0x00, 0x01, 0x8f, 0xc4, 0x01, 0x18, 0x3b, 0xd1, 0x1a, 0x98, 0xa6, 0x48, 0x89, 0xda,
+ 0x01, 0x11, 0x2d, 0xa4, 0x18, 0x29, 0x01, 0xcc, 0xb2, 0x20, 0xbb, 0x50, 0x02, 0xc2, 0x7b, 0x01,
+ 0x09, 0x80, 0x21, 0x93, 0x2b, 0x22, 0xf1, 0x2f, 0x80, 0x00, 0xda, 0x00, 0x1a, 0x84, 0x09, 0x80,
+ 0xa2, 0x58, 0x2a, 0x9c, 0x92, 0x08, 0xb2, 0x16, 0xb9, 0x1c, 0x8d, 0x07, 0x81, 0x2b, 0x0b, 0x93,
+ 0xae, 0xb2, 0x38, 0x24, 0x91, 0x1d, 0x8a, 0xc8, 0xb1, 0x99, 0x58, 0x12, 0x84, 0x1a, 0x9a, 0x43,
+ 0x0a, 0x87, 0x0c, 0x20, 0x3c, 0x00, 0xf3, 0x08, 0xb1, 0x1a, 0x89, 0x51, 0x80, 0x91, 0x9a, 0x78,
+ 0x81, 0x08, 0xaa, 0x99, 0x2f, 0xc3, 0x91, 0x49, 0x91, 0x99, 0x23, 0x38, 0x79, 0xaa, 0x24, 0xb0,
+ 0xb8, 0x84, 0x0f, 0xa0, 0x30, 0xa8, 0x8b, 0x27, 0x11, 0x99, 0x41, 0xa2, 0x1a, 0xe0, 0x58, 0x89,
+ 0x81, 0x00, 0x18, 0x00, 0x4a, 0xb8, 0x22, 0x3d, 0x94, 0xab, 0xa3, 0x1b, 0x89, 0x4b, 0x93, 0xa7,
+ 0x31, 0xcb, 0x3c, 0xcb, 0x91, 0xa4, 0x38, 0x0c, 0xa1, 0x78, 0xb0, 0x41, 0x09, 0xa8, 0x1c, 0xb0,
+ 0x95, 0x68, 0x89, 0x82, 0x3b, 0xc2, 0xa9, 0xb2, 0x2c, 0x0d, 0x39, 0xb4, 0x88, 0xa3, 0x22, 0x7a,
+ 0xb8, 0xeb, 0x31, 0x0d, 0x94, 0x09, 0x83, 0x08, 0x52, 0x29, 0x98, 0xa1, 0x03, 0x70, 0x18, 0xca,
+ 0x85, 0x18, 0xca, 0x10, 0x08, 0x99, 0x68, 0xc3, 0x18, 0xb8, 0x28, 0x69, 0xe2, 0x28, 0x9a, 0x20,
+ 0x94, 0x8a, 0x1a, 0xa5, 0x58, 0xa9, 0x82, 0xb9, 0x3a, 0xa2, 0x71, 0xaa, 0x18, 0xd8, 0xba, 0x19,
+ 0x93, 0x39, 0x2d, 0xfa, 0xb3, 0x3c, 0x38, 0x10, 0x85, 0x29, 0xa1, 0x24, 0x9a, 0xa9, 0x8f, 0x21,
+ 0x88, 0xc3, 0x11, 0x9b, 0x4a, 0x2a, 0x22, 0x07, 0xb9, 0x73, 0x0a, 0xe9, 0x4b, 0xa1, 0x86, 0x19,
+ 0x20, 0x88, 0x8a, 0xba, 0x24, 0xe9, 0x18, 0x19, 0x49, 0xa3, 0x03, 0x1a, 0x22, 0xa4, 0x12, 0x7b,
+ 0xc9, 0x03, 0x9b, 0x23, 0x91, 0x8a, 0x27, 0x6b, 0xb8, 0x90, 0xa9, 0x91, 0x2c, 0xbd, 0x22, 0xa8,
+ 0x98, 0x2e, 0x20, 0xe2, 0x13, 0xaf, 0x80, 0x21, 0x9b, 0x09, 0x22, 0xb8, 0x37, 0x38, 0x9b, 0x69,
+ 0x98, 0xb4, 0x81, 0x3e, 0x90, 0x31, 0x93, 0x93, 0x78, 0x81, 0xc8, 0x1b, 0xc3, 0x29, 0x08, 0xd1,
+ 0x31, 0xbb, 0x23, 0x9f, 0x86, 0x08, 0x19, 0x09, 0xda, 0x28, 0x92, 0x18, 0x0b, 0xa7, 0x9b, 0x20,
+ 0x51, 0x80, 0xaa, 0x03, 0x35, 0xae, 0x81, 0xba, 0x92, 0x03, 0x1f, 0x89, 0x11, 0x9c, 0x97, 0x09,
+ 0x13, 0x0a, 0x30, 0xa0, 0x0b, 0x23, 0x02, 0x71, 0xfa, 0x38, 0x90, 0x90, 0x1a, 0xac, 0xa5, 0x39,
+ 0xac, 0x48, 0x86, 0x08, 0x8a, 0xa1, 0x0c, 0x3a, 0xb5, 0x82, 0x1a, 0x1e, 0x92, 0x3a, 0xf8, 0x01,
+ 0x8e, 0xff, 0x1a, 0x00, 0xc1, 0x10, 0x99, 0x92, 0x18, 0x79, 0x11, 0x01, 0xc2, 0x11, 0x49, 0xf8,
+ 0x23, 0x08, 0x3b, 0x40, 0x1a, 0xb1, 0x06, 0xbb, 0xa9, 0x0b, 0x3c, 0xd8, 0x13, 0xaf, 0x03, 0x09,
+ 0x1b, 0x10, 0xa8, 0x13, 0x86, 0xbc, 0x22, 0x0c, 0x71, 0x92, 0xda, 0x11, 0x22, 0x1c, 0x10, 0x10,
+ 0x82, 0xa2, 0xba, 0x78, 0xc3, 0x49, 0xb0, 0x98, 0x0f, 0xc0, 0x40, 0x29, 0xa3, 0x54, 0x8a, 0x92,
+ 0x18, 0x99, 0xb1, 0x20, 0x59, 0xb0, 0x89, 0x8c, 0xc8, 0x25, 0xba, 0xa8, 0x0e, 0x18, 0x08, 0x90,
+ 0x85, 0x88, 0x71, 0xaa, 0xa0, 0x0d, 0xd1, 0x00, 0x22, 0x01, 0x89, 0x3a, 0x89, 0x05, 0x54, 0xa8,
+ 0x3a, 0x85, 0x1c, 0xd8, 0x80, 0x20, 0x98, 0x1b, 0x8b, 0xc3, 0xa0, 0x41, 0x8c, 0x58, 0xc3, 0x82,
+ 0x1a, 0xb9, 0x71, 0xab, 0xa2, 0x6c, 0xc3, 0x01, 0x09, 0x29, 0xa0, 0x4a, 0xc8, 0x12, 0x20, 0xa5,
+ 0x81, 0x2d, 0x09, 0x99, 0x13, 0xd2, 0x29, 0x43, 0x9a, 0x79, 0xb0, 0x11, 0x93, 0x83, 0x2f, 0x19,
+ 0xf2, 0xa2, 0x2c, 0x19, 0xb8, 0x33, 0x80, 0x0d, 0xa3, 0xa9, 0x81, 0x1d, 0xa2, 0x68, 0xd9, 0x08,
+ 0x13, 0x0a, 0x20, 0x9e, 0xa4, 0x29, 0x9b, 0x84, 0x4b, 0xa8, 0x17, 0x29, 0x10, 0x8f, 0x91, 0x9a,
+ 0x80, 0x6a, 0x91, 0x08, 0x2b, 0x13, 0xbc, 0xf3, 0x39, 0x31, 0x9a, 0xc3, 0x03, 0x21, 0x58, 0x0c,
+ 0xb2, 0x0c, 0x91, 0xf2, 0x39, 0x89, 0x21, 0x1c, 0x96, 0x11, 0x29, 0xb1, 0x30, 0x95, 0x0b, 0x50,
+ 0xc9, 0x12, 0x19, 0x85, 0x3b, 0x18, 0xb4, 0x18, 0x99, 0x13, 0x80, 0x0a, 0x9b, 0x77, 0x00, 0x08,
+ 0xd2, 0x8a, 0xaa, 0x22, 0xae, 0x82, 0x0a, 0x2b, 0xa3, 0x71, 0xb4, 0x91, 0x0d, 0x9a, 0xd2, 0x0d,
+ 0x90, 0x10, 0x20, 0xa2, 0xb3, 0x71, 0x08, 0x81, 0xab, 0x23, 0x06, 0x02, 0x8a, 0x9f, 0x3a, 0x90,
+ 0x06, 0x00, 0x15, 0x00, 0x8b, 0x0e, 0x82, 0xa3, 0x5b, 0xb9, 0xa3, 0xaa, 0x5e, 0x01, 0xc2, 0x32,
+ 0x80, 0x48, 0x92, 0x2e, 0x82, 0x8a, 0xc3, 0xa9, 0x80, 0x3d, 0x49, 0xb8, 0xb1, 0x80, 0x3b, 0x4b,
+ 0x97, 0x3a, 0x94, 0x60, 0x99, 0x80, 0xab, 0xa4, 0x48, 0xba, 0x11, 0x86, 0x19, 0x00, 0x18, 0xfb,
+ 0x0b, 0x1a, 0xc3, 0xc2, 0x3c, 0x1a, 0x23, 0xa1, 0xd8, 0x10, 0xa4, 0x21, 0x1f, 0x80, 0x03, 0x90,
+ 0x16, 0x0c, 0x1c, 0xa2, 0x91, 0xb0, 0x1d, 0x8d, 0x51, 0xb8, 0x03, 0x09, 0x81, 0x90, 0x7a, 0x90,
+ 0xa3, 0x94, 0x10, 0x30, 0x2d, 0x10, 0xa3, 0x1f, 0xd2, 0x10, 0x90, 0xaa, 0x51, 0x20, 0x10, 0xb8,
+ 0x85, 0xdb, 0x23, 0x3d, 0xa9, 0x95, 0x20, 0x99, 0xa0, 0x3b, 0x8d, 0x98, 0xb5, 0x13, 0x0c, 0x7b,
+ 0xb2, 0x2a, 0xb3, 0x11, 0x08, 0x97, 0x1b, 0x49, 0xa0, 0x11, 0x92, 0x19, 0xb9, 0xea, 0x99, 0x50,
+ 0xb0, 0x45, 0xb9, 0x80, 0x80, 0x4a, 0x6b, 0xd8, 0xb1, 0x29, 0x81, 0x01, 0x29, 0x7a, 0xa3, 0x82,
+ 0x38, 0x9c, 0xac, 0xe1, 0x02, 0x18, 0xad, 0x19, 0x88, 0x90, 0x36, 0x0b, 0xd2, 0x20, 0x18, 0x99,
+ 0x4b, 0x01, 0xca, 0x05, 0x1a, 0x07, 0x00, 0x09, 0x32, 0x83, 0x9f, 0x81, 0x0a, 0x15, 0xa1, 0xd8,
+ 0x2b, 0xa9, 0x91, 0x29, 0xc0, 0x0f, 0x92, 0x2a, 0xe8, 0x04, 0x18, 0x19, 0x18, 0x22, 0x94, 0xba,
+ 0x80, 0x2b, 0x1a, 0xf1, 0x44, 0x28, 0x79, 0xb1, 0x99, 0x82, 0x00, 0x00, 0x8a, 0x49, 0xb2, 0xf9,
+ 0x89, 0x02, 0x0e, 0x01, 0x08, 0x01, 0x32, 0xf9, 0x80, 0x1a, 0x2b, 0x1c, 0xfa, 0x95, 0x1d, 0x80,
+ 0x80, 0x38, 0x81, 0x8f, 0xa1, 0x02, 0x12, 0x2b, 0x02, 0x11, 0xb3, 0x78, 0xe1, 0x88, 0x1a, 0xa2,
+ 0x41, 0xa5, 0x19, 0x39, 0x9a, 0x11, 0x94, 0x0c, 0x39, 0xf5, 0x11, 0x1a, 0xa8, 0x04, 0x99, 0x10,
+ 0x1b, 0x00, 0x15, 0x00, 0x10, 0xbb, 0xa3, 0xfd, 0x58, 0x01, 0x98, 0x10, 0x99, 0x33, 0x99, 0x3a,
+ 0xa5, 0xa1, 0x71, 0xd0, 0x2a, 0x99, 0x09, 0x85, 0x08, 0xa9, 0x1b, 0x19, 0xcb, 0x37, 0x1a, 0x31,
+ 0x87, 0x0a, 0xb0, 0x1b, 0xb3, 0x3d, 0x96, 0x99, 0x03, 0x3a, 0x88, 0xb1, 0xb8, 0x57, 0x98, 0x7a,
+ 0x18, 0x98, 0xa1, 0xa4, 0x8b, 0x51, 0xdb, 0x88, 0x18, 0x2a, 0xa0, 0xb5, 0x3c, 0x83, 0x0a, 0x88,
+ 0x8a, 0xb6, 0x00, 0x3d, 0x10, 0x2a, 0xd4, 0x18, 0x0a, 0x90, 0x17, 0x19, 0x19, 0x20, 0xa2, 0x8c,
+ 0x17, 0x9a, 0x2a, 0x31, 0xa0, 0x01, 0xf8, 0xa2, 0x22, 0x9f, 0x09, 0x24, 0xba, 0xa1, 0xd0, 0x14,
+ 0x1b, 0x0c, 0x20, 0x28, 0x98, 0xd2, 0xa9, 0x07, 0x0a, 0x19, 0x2a, 0xd9, 0x31, 0xb9, 0x32, 0xd8,
+ 0xd3, 0x3a, 0x29, 0x09, 0xd9, 0x31, 0x34, 0xf0, 0x00, 0x1a, 0x28, 0xb8, 0x14, 0x9f, 0x02, 0xb0,
+ 0xa2, 0x38, 0x59, 0x8a, 0xa9, 0x90, 0x37, 0xad, 0x03, 0x3a, 0x21, 0xaa, 0xf1, 0x19, 0xb1, 0x59,
+ 0x00, 0x00, 0x0b, 0x0a, 0xb4, 0xa3, 0x35, 0xbf, 0x09, 0xa3, 0xb3, 0x3c, 0x0c, 0x95, 0x1d, 0x23,
+ 0x92, 0x41, 0x91, 0x92, 0x20, 0x1b, 0x78, 0x0e, 0xa4, 0x00, 0x98, 0x95, 0x38, 0x8a, 0x11, 0x91,
+ 0x86, 0x99, 0x9a, 0x00, 0x69, 0xd9, 0x12, 0x1a, 0x02, 0x10, 0x11, 0x1c, 0xb1, 0x88, 0x07, 0x82,
+ 0x9b, 0x69, 0xaf, 0x81, 0xa2, 0x3a, 0x2c, 0xd2, 0x12, 0x90, 0x1a, 0xb9, 0xfb, 0x28, 0xa8, 0x48,
+ 0x18, 0xa1, 0x04, 0x88, 0x9e, 0x30, 0x82, 0xc8, 0x5a, 0x9b, 0xb2, 0x20, 0x83, 0xaf, 0x36, 0x9a,
+ 0xa3, 0xa0, 0x4d, 0x90, 0x18, 0x83, 0x80, 0x8c, 0x31, 0xc2, 0xac, 0x63, 0x91, 0x83, 0x28, 0x8b,
+ 0xf0, 0x19, 0x94, 0x0d, 0x98, 0x1a, 0x15, 0x89, 0x00, 0x88, 0x81, 0x15, 0x1d, 0x21, 0x00, 0xc8,
+ 0x11, 0x00, 0x15, 0x00, 0x18, 0x83, 0x40, 0xe9, 0x80, 0x40, 0xf9, 0x00, 0x89, 0x08, 0x4a, 0xba,
+ 0x88, 0x06, 0x90, 0x10, 0xb0, 0x06, 0x6b, 0x0b, 0xb8, 0xa1, 0x39, 0x87, 0x08, 0x9b, 0x0c, 0xa4,
+ 0x90, 0x5b, 0x82, 0x08, 0x04, 0x11, 0x24, 0x8d, 0xa9, 0xc0, 0x1a, 0x4b, 0x85, 0x93, 0x18, 0x2d,
+ 0xb3, 0x3b, 0x84, 0x99, 0x28, 0xb1, 0x07, 0x89, 0x29, 0x3c, 0x99, 0xb7, 0x92, 0x31, 0x9c, 0xa0,
+ 0xcb, 0x58, 0x98, 0xe0, 0x38, 0x89, 0xa8, 0xc0, 0x05, 0x1a, 0x71, 0xa0, 0x18, 0x80, 0x02, 0xc8,
+ 0x20, 0x91, 0x8e, 0x84, 0x2a, 0x42, 0xc2, 0x00, 0x10, 0xa2, 0xc1, 0x18, 0x1e, 0x8b, 0x81, 0x09,
+ 0x91, 0x87, 0xbb, 0x31, 0xc8, 0x61, 0x0a, 0x04, 0xc9, 0x21, 0x60, 0xb9, 0x90, 0x08, 0x32, 0xb9,
+ 0x62, 0x38, 0x9d, 0x80, 0xc1, 0x91, 0x23, 0x38, 0x0f, 0xaa, 0x14, 0xc0, 0x19, 0xb1, 0x4d, 0x11,
+ 0xc1, 0x18, 0x39, 0x2c, 0x95, 0xa0, 0x0a, 0x2c, 0xa0, 0xab, 0xd3, 0x03, 0x22, 0x1f, 0xa0, 0x58,
+ 0xa0, 0xa2, 0x8b, 0x58, 0x90, 0xdc, 0x0a, 0xc3, 0x32, 0xd9, 0x3a, 0x38, 0xa9, 0xba, 0x27, 0xb1,
+ 0x20, 0x48, 0x04, 0x89, 0xa0, 0x94, 0x1c, 0x5a, 0xc2, 0x32, 0xcc, 0x18, 0x89, 0x31, 0x28, 0x93,
+ 0x8d, 0x83, 0x53, 0x1a, 0xc0, 0x93, 0xd0, 0x3c, 0xa8, 0xa0, 0x82, 0x79, 0x81, 0x02, 0x82, 0x30,
+ 0xca, 0x2a, 0x75, 0xe0, 0x11, 0x19, 0x98, 0x01, 0xc8, 0x11, 0x09, 0x0f, 0x98, 0x01, 0x91, 0x03,
+ 0x9f, 0x10, 0xc1, 0x38, 0x28, 0xb8, 0x01, 0xd8, 0x0c, 0x83, 0x19, 0x2a, 0x52, 0x11, 0x98, 0x98,
+ 0xf6, 0x28, 0x2c, 0x20, 0x99, 0xa5, 0x8a, 0x93, 0x7a, 0x91, 0x0b, 0x82, 0xf0, 0x88, 0x40, 0x48,
+ 0x82, 0x0a, 0xc9, 0x95, 0x20, 0xa1, 0x8a, 0x3a, 0x20, 0xe3, 0xac, 0x99, 0x92, 0x30, 0x3a, 0x99,
+ 0xc8, 0xff, 0x0e, 0x00, 0xaf, 0xb0, 0x42, 0x2b, 0xb7, 0x0b, 0x98, 0x59, 0x98, 0x58, 0xb1, 0x34,
+ 0x80, 0xab, 0x52, 0xb9, 0x53, 0x39, 0xc8, 0x23, 0x9e, 0x98, 0x88, 0x48, 0x06, 0x19, 0x00, 0x90,
+ 0x2a, 0xea, 0xa9, 0x03, 0x2d, 0xd1, 0x01, 0x09, 0x10, 0x8b, 0x12, 0xc3, 0x09, 0x33, 0x4e, 0xd1,
+ 0x9b, 0x07, 0x09, 0x98, 0x12, 0x8d, 0x21, 0x83, 0xac, 0x00, 0x02, 0x69, 0x22, 0xdb, 0x93, 0x80,
+ 0x20, 0xf0, 0x0b, 0x29, 0x01, 0xb1, 0x4a, 0x33, 0x21, 0xa6, 0x21, 0x1e, 0x99, 0x80, 0x5a, 0xf8,
+ 0x10, 0x80, 0x89, 0x6a, 0x99, 0x81, 0x92, 0x02, 0xcc, 0x11, 0x2b, 0xfb, 0x32, 0x8c, 0x81, 0xb2,
+ 0x8a, 0x3c, 0xd2, 0x81, 0x52, 0x12, 0x9b, 0x12, 0x82, 0x3f, 0xd1, 0x11, 0x88, 0x93, 0x9c, 0x43,
+ 0x59, 0x99, 0x82, 0xb9, 0x12, 0xb1, 0x73, 0x08, 0x00, 0x80, 0x84, 0x29, 0x84, 0xaf, 0x32, 0x99,
+ 0xd9, 0x85, 0x1d, 0x99, 0x98, 0x05, 0x88, 0x18, 0x58, 0xb8, 0x20, 0x89, 0xa8, 0xb3, 0x0f, 0xa2,
+ 0x40, 0x80, 0x18, 0x03, 0x49, 0x91, 0x1a, 0xd4, 0x12, 0x1a, 0xdb, 0x29, 0x28, 0x08, 0xf0, 0x9a,
+ 0x18, 0x0a, 0xb7, 0x2c, 0xb2, 0x28, 0x19, 0x24, 0xad, 0x08, 0x09, 0xd5, 0x11, 0x4a, 0xc8, 0x1a,
+ 0x82, 0xa1, 0xa3, 0xa0, 0x1f, 0x07, 0x1b, 0x88, 0x88, 0x85, 0x08, 0x20, 0x8c, 0x93, 0xf1, 0x29,
+ 0x0b, 0x8a, 0x28, 0x91, 0x03, 0x17, 0x1a, 0x08, 0x4b, 0x21, 0xac, 0xc4, 0x84, 0x2b, 0x3b, 0x86,
+ 0xaa, 0x10, 0x72, 0xa8, 0x01, 0xdb, 0xa1, 0x29, 0x6b, 0x99, 0x82, 0x91, 0x94, 0x4a, 0x8a, 0x92,
+ 0x26, 0x1b, 0xe2, 0xb9, 0x48, 0x91, 0x90, 0x59, 0x95, 0x19, 0x11, 0x8a, 0x99, 0x04, 0x50, 0xa9,
+ 0x93, 0xa9, 0x9d, 0xa8, 0x62, 0x2a, 0xf2, 0x10, 0xa9, 0x81, 0x90, 0x0e, 0x20, 0x82, 0xe2, 0x48,
+ 0xde, 0xff, 0x1d, 0x00, 0x91, 0x91, 0x3a, 0x60, 0x2b, 0xa2, 0xa2, 0xe2, 0x51, 0x89, 0x9b, 0x81,
+ 0x11, 0x80, 0x8a, 0xab, 0x37, 0xf2, 0x11, 0x08, 0x2b, 0xa9, 0x00, 0xb8, 0x97, 0x42, 0x99, 0x89,
+ 0x49, 0x0c, 0x04, 0xa8, 0x93, 0xab, 0x46, 0x88, 0x19, 0xdc, 0x81, 0x28, 0x90, 0x84, 0x1c, 0xa3,
+ 0x1a, 0x0a, 0x23, 0xbf, 0x88, 0x89, 0xa9, 0x06, 0x81, 0x8d, 0x29, 0xa0, 0xa8, 0x37, 0x80, 0x1a,
+ 0x0a, 0x02, 0x85, 0x12, 0x9b, 0x5c, 0x99, 0xae, 0x15, 0x01, 0x98, 0x8a, 0x10, 0x40, 0x3a, 0xb1,
+ 0x34, 0xf8, 0x9d, 0x12, 0x08, 0x00, 0x3b, 0xf4, 0x00, 0x0a, 0x00, 0x13, 0xac, 0x90, 0x25, 0x88,
+ 0x2d, 0xaa, 0x83, 0xe2, 0x11, 0x1a, 0x1e, 0x92, 0x81, 0x21, 0xbc, 0x01, 0x03, 0xf9, 0x59, 0x08,
+ 0xc0, 0x09, 0x49, 0xc1, 0x30, 0x08, 0x29, 0x84, 0xbb, 0x19, 0x39, 0xf2, 0x19, 0x33, 0x9c, 0x80,
+ 0x95, 0x85, 0x6c, 0x08, 0x88, 0x81, 0xa2, 0x90, 0x1b, 0x00, 0x1b, 0x13, 0x09, 0x98, 0x3a, 0x3a,
+ 0x67, 0x81, 0x0c, 0x8e, 0xc9, 0x21, 0x8a, 0x20, 0x97, 0x59, 0x00, 0x09, 0xb3, 0x21, 0x0b, 0x3c,
+ 0xa1, 0xa7, 0x12, 0xa9, 0x5c, 0xa8, 0xb8, 0x43, 0x20, 0x8b, 0xd9, 0x93, 0x23, 0x9f, 0x28, 0xa0,
+ 0x0b, 0x23, 0x07, 0x0c, 0x08, 0x8c, 0xa1, 0x07, 0x29, 0x8a, 0x80, 0xa1, 0x14, 0x0b, 0x83, 0xa0,
+ 0x98, 0xbf, 0x23, 0x1c, 0xf9, 0x90, 0x10, 0x29, 0x98, 0xc9, 0x42, 0xb3, 0x6c, 0x9a, 0xb1, 0x88,
+ 0x39, 0x84, 0x17, 0x0b, 0xbb, 0x06, 0x20, 0x1b, 0x23, 0xd0, 0x39, 0x94, 0x09, 0x18, 0xc1, 0x9f,
+ 0x82, 0x10, 0x19, 0x99, 0x05, 0x19, 0x32, 0xdb, 0x94, 0x0a, 0x71, 0x9a, 0x9a, 0x12, 0xa3, 0x18,
+ 0x08, 0xab, 0x87, 0x20, 0x4d, 0x80, 0x00, 0x0c, 0xd0, 0x91, 0x11, 0x21, 0x00, 0xe9, 0x71, 0xa0,
+ 0x41, 0x00, 0x1c, 0x00, 0x00, 0xa0, 0xac, 0x39, 0x8a, 0x97, 0x99, 0x30, 0x80, 0x4c, 0xa2, 0x11,
+ 0x89, 0xc1, 0x7a, 0xb1, 0x95, 0x29, 0x89, 0x89, 0x00, 0x01, 0xf3, 0x98, 0x29, 0x4a, 0x39, 0xd4,
+ 0x18, 0x98, 0x51, 0x20, 0xb1, 0x11, 0x80, 0xcf, 0x28, 0x11, 0xbc, 0x95, 0x89, 0x11, 0x0a, 0x2e,
+ 0xb2, 0x04, 0x80, 0xab, 0x1b, 0x8b, 0x17, 0x18, 0x12, 0x91, 0x8e, 0x01, 0xa0, 0x95, 0x6b, 0x90,
+ 0xa0, 0x32, 0x58, 0xe0, 0x29, 0x8b, 0x98, 0x01, 0xc1, 0x08, 0x22, 0x31, 0xe2, 0x78, 0x09, 0x98,
+ 0xa1, 0x3a, 0x10, 0xa1, 0xed, 0x32, 0x89, 0x4b, 0xa1, 0x11, 0x09, 0xda, 0xc2, 0x12, 0x1f, 0x02,
+ 0x30, 0xaa, 0xc2, 0x23, 0x2b, 0x09, 0x17, 0x9c, 0x2a, 0xf1, 0x3a, 0xa0, 0x23, 0xb1, 0x8d, 0x42,
+ 0x8b, 0x00, 0x98, 0xd4, 0xa9, 0x12, 0x3a, 0x3c, 0x0c, 0xe3, 0x81, 0x29, 0x9a, 0x17, 0x48, 0x82,
+ 0x99, 0x12, 0xb1, 0x2f, 0x93, 0xab, 0x41, 0x98, 0xf0, 0x08, 0x08, 0x08, 0x0a, 0xc1, 0x90, 0x10,
+ 0x71, 0x91, 0x92, 0x6b, 0xa8, 0x10, 0x84, 0x80, 0x3c, 0xca, 0x12, 0xc1, 0x4a, 0x81, 0x91, 0x59,
+ 0xfa, 0x11, 0x1a, 0xc1, 0x38, 0xcc, 0xa1, 0x02, 0x6b, 0x88, 0xa1, 0x1a, 0x48, 0x10, 0xb2, 0xc4,
+ 0x20, 0xb0, 0x6b, 0x0a, 0x0a, 0xb3, 0x07, 0x3a, 0x38, 0x9a, 0xd0, 0xa4, 0x18, 0x0c, 0x01, 0x18,
+ 0xbc, 0x26, 0x10, 0xca, 0xa0, 0x1b, 0x78, 0xa1, 0xa2, 0x19, 0x18, 0x79, 0x0a, 0x92, 0x17, 0x0a,
+ 0x88, 0x9a, 0x87, 0x0a, 0x20, 0x98, 0xbb, 0x3a, 0x96, 0x19, 0xe3, 0x09, 0x20, 0x0b, 0x1b, 0x93,
+ 0x05, 0x21, 0xb8, 0x97, 0x5c, 0x80, 0x02, 0x92, 0xb8, 0x7a, 0xb9, 0x10, 0x98, 0x21, 0x0b, 0xb4,
+ 0x5b, 0xea, 0x10, 0x18, 0xa0, 0xa5, 0x39, 0x8e, 0x04, 0x99, 0x11, 0x10, 0xd8, 0x88, 0x80, 0x41,
+ 0xcc, 0xff, 0x17, 0x00, 0x59, 0xc1, 0x0c, 0x30, 0x91, 0xa3, 0x7b, 0x92, 0x09, 0xa3, 0x81, 0x1f,
+ 0x81, 0xb8, 0x15, 0x0a, 0x99, 0x19, 0xa9, 0x45, 0xdb, 0x39, 0x99, 0x52, 0xb1, 0xa3, 0x1b, 0x51,
+ 0xa0, 0x20, 0xca, 0x20, 0xb1, 0x0d, 0x23, 0x20, 0xa4, 0x8f, 0x32, 0xb1, 0x41, 0x98, 0x0f, 0x99,
+ 0x18, 0xba, 0xa1, 0x06, 0x88, 0x2d, 0x01, 0x3a, 0xa6, 0x84, 0x00, 0x1c, 0x9a, 0x48, 0x82, 0xd3,
+ 0x19, 0x29, 0x06, 0x9c, 0x13, 0x28, 0xca, 0x12, 0x8d, 0x02, 0x29, 0x80, 0xb9, 0x91, 0x84, 0x49,
+ 0x18, 0x69, 0xab, 0x0d, 0xd0, 0x92, 0x98, 0xa8, 0x1b, 0x9d, 0x17, 0x00, 0x2a, 0x03, 0x13, 0xe4,
+ 0x19, 0xa8, 0x18, 0xb8, 0x1f, 0x39, 0xb1, 0xe8, 0x29, 0x11, 0x90, 0x79, 0xa3, 0x09, 0x33, 0x0c,
+ 0xb2, 0x1f, 0xb2, 0x29, 0x19, 0xe2, 0x80, 0x5a, 0x90, 0x42, 0xb8, 0xa8, 0xb2, 0x12, 0x00, 0x8f,
+ 0x21, 0xe8, 0x20, 0x12, 0xb9, 0x95, 0x00, 0x18, 0xbd, 0x4b, 0x62, 0xa0, 0x81, 0xb2, 0x8c, 0x20,
+ 0x0b, 0x00, 0xc4, 0x2b, 0xc9, 0x31, 0x20, 0x28, 0x47, 0x8a, 0xb1, 0x89, 0x71, 0xb8, 0x21, 0xcb,
+ 0x52, 0xa8, 0x20, 0x22, 0x2a, 0xba, 0xe2, 0x90, 0x24, 0x7a, 0x8b, 0xb5, 0xa0, 0x2c, 0x12, 0x9b,
+ 0xc0, 0x1a, 0x21, 0x9a, 0x91, 0x2f, 0xb4, 0x29, 0x10, 0x14, 0x2b, 0xb8, 0x0f, 0x80, 0x94, 0x8b,
+ 0x18, 0x96, 0x18, 0x3a, 0x69, 0xa8, 0xb3, 0xf3, 0x2b, 0x0c, 0x3a, 0x92, 0xa5, 0x3b, 0x82, 0x18,
+ 0x0b, 0xa5, 0x0b, 0x40, 0xc0, 0x08, 0x07, 0x29, 0x18, 0xb2, 0x29, 0x97, 0x1c, 0xc0, 0x8b, 0x04,
+ 0xa9, 0x5a, 0xaa, 0x87, 0x18, 0x01, 0x0a, 0xb8, 0x09, 0x03, 0x2e, 0x03, 0x03, 0x84, 0x99, 0x09,
+ 0x84, 0x48, 0x2f, 0xa2, 0xa2, 0xe9, 0x2b, 0xc0, 0x22, 0x80, 0x88, 0x69, 0x1a, 0x9b, 0xc5, 0x10,
+ 0xb5, 0xff, 0x19, 0x00, 0x10, 0x20, 0xe4, 0x28, 0x99, 0x31, 0x8a, 0x3a, 0xc5, 0x89, 0x33, 0x0f,
+ 0x02, 0x02, 0x09, 0xbb, 0xab, 0x17, 0x3b, 0xb0, 0x68, 0x00, 0xb0, 0x30, 0x9f, 0xb2, 0x80, 0x70,
+ 0x91, 0x19, 0x89, 0x40, 0x82, 0xb8, 0x29, 0xd8, 0x1a, 0xac, 0x84, 0x59, 0x90, 0x18, 0xf1, 0x82,
+ 0x0a, 0x48, 0x1b, 0x33, 0xe9, 0xa8, 0x22, 0x00, 0x1d, 0xc8, 0x10, 0x49, 0x90, 0x1a, 0x91, 0x95,
+ 0xc3, 0x1f, 0x98, 0x28, 0x80, 0xdb, 0x68, 0xb0, 0x80, 0x0a, 0x33, 0x7a, 0xa8, 0xaa, 0x81, 0x20,
+ 0xc2, 0x48, 0x9a, 0x34, 0xfa, 0x80, 0x28, 0x15, 0x80, 0x00, 0x23, 0xbb, 0x0d, 0xb4, 0x30, 0x8c,
+ 0x11, 0xd1, 0x1a, 0x28, 0x83, 0x9b, 0x26, 0x85, 0x89, 0x99, 0x8d, 0x40, 0x02, 0x19, 0xa8, 0xa3,
+ 0xe9, 0x3a, 0x89, 0xda, 0x87, 0x0b, 0x80, 0x82, 0x4c, 0x08, 0x05, 0xb1, 0x81, 0x79, 0xa9, 0x00,
+ 0xbc, 0x04, 0x4a, 0x84, 0x8a, 0xb9, 0x10, 0x28, 0xbe, 0x90, 0x32, 0x8a, 0x02, 0xa0, 0x70, 0x95,
+ 0x0c, 0x30, 0x93, 0xf9, 0x20, 0x19, 0x08, 0x91, 0xaa, 0xb2, 0xb3, 0x78, 0x07, 0x98, 0x9a, 0x85,
+ 0x91, 0x4b, 0x11, 0x80, 0x19, 0x88, 0x21, 0xb0, 0x30, 0x02, 0xcf, 0x3a, 0xfb, 0x91, 0x18, 0x82,
+ 0x52, 0x00, 0x1d, 0x90, 0xb8, 0x1c, 0xc1, 0xa0, 0x3c, 0x13, 0x39, 0xd1, 0x06, 0x20, 0x1d, 0x02,
+ 0x99, 0xa3, 0xf1, 0x0b, 0x4b, 0xa2, 0x81, 0x3b, 0xd1, 0x33, 0x0d, 0xa2, 0x2b, 0x09, 0xe3, 0x31,
+ 0x91, 0xe1, 0x6c, 0x09, 0xb8, 0x84, 0x30, 0x29, 0x90, 0x18, 0xbb, 0x14, 0xb9, 0x92, 0x0d, 0x71,
+ 0xc0, 0x91, 0xa8, 0x4a, 0x09, 0xb0, 0x58, 0x91, 0x50, 0xc8, 0x09, 0x03, 0xb1, 0xa2, 0x5b, 0x0e,
+ 0x88, 0x12, 0x83, 0x06, 0xaa, 0x58, 0x89, 0x91, 0x18, 0xb1, 0x59, 0x9b, 0x95, 0xaa, 0x3b, 0xa7,
+ 0x0a, 0x00, 0x19, 0x00, 0x00, 0xc2, 0x88, 0xd9, 0x10, 0x2d, 0x9a, 0xa3, 0x3a, 0x85, 0xa1, 0xa1,
+ 0x1e, 0x29, 0xd1, 0x39, 0x95, 0x28, 0xa8, 0x38, 0x42, 0xc8, 0x12, 0x81, 0xbf, 0x82, 0x99, 0x12,
+ 0x80, 0x78, 0x00, 0xf1, 0x18, 0x00, 0x3a, 0x12, 0x8a, 0xb4, 0xb0, 0x69, 0x8b, 0x14, 0x10, 0x04,
+ 0x8d, 0x22, 0x88, 0x0b, 0x19, 0xe3, 0x83, 0x0b, 0x71, 0x03, 0x9a, 0x0b, 0xb2, 0x4a, 0xf1, 0x1a,
+ 0x10, 0xba, 0x82, 0x17, 0x39, 0x90, 0x1b, 0x2d, 0xf9, 0x31, 0x08, 0xcb, 0x83, 0x3a, 0x9b, 0x80,
+ 0x78, 0xf2, 0x09, 0x48, 0x88, 0x9a, 0x90, 0x73, 0x89, 0x90, 0x81, 0x91, 0x4c, 0x89, 0x91, 0x02,
+ 0xad, 0x32, 0x89, 0x2b, 0x05, 0x11, 0x30, 0x61, 0x9a, 0x82, 0xa5, 0x0f, 0x92, 0x99, 0x82, 0x4c,
+ 0x10, 0x88, 0xb9, 0x19, 0xe3, 0x05, 0x00, 0x39, 0x1f, 0x88, 0xc0, 0x82, 0x90, 0x39, 0x40, 0x9c,
+ 0xa2, 0x96, 0x5a, 0x21, 0xa8, 0x90, 0x41, 0x98, 0x20, 0xf8, 0x82, 0x0c, 0x1c, 0x9a, 0x86, 0x89,
+ 0x88, 0x02, 0x18, 0x1f, 0x91, 0x01, 0x19, 0xa8, 0xc2, 0x93, 0x8d, 0x3b, 0x09, 0x04, 0xc1, 0x19,
+ 0x97, 0x98, 0x19, 0x99, 0x92, 0x1d, 0xa1, 0x33, 0x9f, 0x14, 0xb1, 0x90, 0x6a, 0x03, 0xab, 0x88,
+ 0x3c, 0xa2, 0xa7, 0x09, 0x10, 0x2b, 0xaa, 0x70, 0x11, 0x03, 0xf1, 0x21, 0x01, 0x4a, 0x98, 0x0a,
+ 0x37, 0xad, 0x12, 0x80, 0x09, 0x98, 0x20, 0x13, 0x8b, 0xf4, 0x3b, 0x90, 0x9c, 0x10, 0x08, 0x80,
+ 0xad, 0xb1, 0x93, 0x72, 0x80, 0x00, 0x9b, 0x00, 0xc3, 0x85, 0x0f, 0x01, 0x21, 0xd4, 0x18, 0x9c,
+ 0x21, 0xb8, 0x01, 0x2b, 0xab, 0xa7, 0xb3, 0x29, 0x1d, 0x18, 0xa2, 0x69, 0xd3, 0x20, 0x18, 0x20,
+ 0x89, 0xd9, 0x04, 0x09, 0x38, 0x89, 0xc5, 0x1a, 0x59, 0xb9, 0x91, 0x08, 0x36, 0x08, 0x38, 0x1a,
+ 0xaf, 0x00, 0x12, 0x00, 0x44, 0xaf, 0x28, 0x88, 0xa2, 0xc0, 0x21, 0xaa, 0x5a, 0xc2, 0x39, 0x1b,
+ 0xd3, 0x80, 0x21, 0xbb, 0x70, 0x99, 0x85, 0x89, 0x49, 0xa0, 0xa9, 0xa1, 0x9b, 0x70, 0x09, 0x9a,
+ 0xd4, 0x21, 0x9d, 0x04, 0xa9, 0x08, 0x09, 0x70, 0x98, 0x81, 0x95, 0xb8, 0x38, 0x0b, 0xad, 0x22,
+ 0x39, 0x94, 0xa1, 0x00, 0x09, 0xd4, 0x0e, 0x41, 0x88, 0xc1, 0x00, 0xb2, 0x20, 0x6c, 0x98, 0xa2,
+ 0x80, 0x91, 0x7b, 0x0a, 0x03, 0xa3, 0x05, 0x49, 0xd0, 0x80, 0x88, 0x1e, 0x80, 0xa4, 0x01, 0x80,
+ 0x31, 0x1b, 0x8e, 0x09, 0xd3, 0x13, 0x1c, 0xb8, 0xa4, 0x3a, 0xca, 0x68, 0xa1, 0x18, 0x09, 0xc4,
+ 0xa0, 0x3a, 0x1a, 0x82, 0x81, 0x13, 0x9f, 0x88, 0xea, 0x94, 0x19, 0x12, 0x79, 0x99, 0xa0, 0x13,
+ 0x1a, 0x04, 0x1d, 0xb9, 0x15, 0x99, 0x28, 0x89, 0xa3, 0x17, 0x0f, 0x01, 0x08, 0x02, 0xa0, 0x14,
+ 0x98, 0x8d, 0x82, 0x29, 0x9c, 0x06, 0x98, 0x29, 0xc1, 0x21, 0x08, 0x20, 0xa9, 0x48, 0x91, 0xa9,
+ 0xd2, 0x2f, 0xb1, 0x28, 0xa8, 0x17, 0x8c, 0x18, 0xba, 0x49, 0xe2, 0x19, 0x41, 0x80, 0x80, 0x40,
+ 0xa3, 0xb9, 0x0d, 0x81, 0xbd, 0x25, 0x2b, 0xa8, 0x82, 0x8b, 0x12, 0x70, 0xb1, 0xd9, 0x10, 0x8a,
+ 0xa8, 0xb5, 0x4f, 0x98, 0x83, 0xb9, 0x82, 0x6a, 0x80, 0x98, 0x93, 0x5a, 0x09, 0x92, 0xb2, 0x6b,
+ 0x2b, 0xf3, 0x49, 0xa1, 0x31, 0x11, 0xa9, 0x2b, 0x10, 0x15, 0xc8, 0xa8, 0x89, 0xeb, 0x01, 0x3a,
+ 0xab, 0x07, 0x10, 0x92, 0x99, 0x3a, 0x09, 0xa7, 0x22, 0x9e, 0x41, 0xda, 0x90, 0x02, 0x0b, 0x1c,
+ 0x0a, 0x02, 0x07, 0x8a, 0xa0, 0x1a, 0x10, 0x98, 0xb0, 0x2f, 0x40, 0xb5, 0x80, 0x08, 0x92, 0xba,
+ 0x68, 0x3c, 0x93, 0xb2, 0x89, 0xa1, 0x6c, 0x8b, 0xa8, 0x95, 0x30, 0x93, 0x91, 0x0f, 0xa1, 0x9c,
+ 0x82, 0xff, 0x16, 0x00, 0x05, 0x2b, 0x30, 0x94, 0xda, 0x23, 0xa8, 0x92, 0x0f, 0x92, 0x69, 0x88,
+ 0xa4, 0x48, 0x98, 0x18, 0xc1, 0x30, 0x0b, 0x8a, 0x87, 0x2c, 0x00, 0x09, 0x93, 0xba, 0x05, 0xa9,
+ 0x9c, 0x7b, 0xc1, 0x10, 0xb1, 0x3b, 0x81, 0x04, 0x39, 0x00, 0x9f, 0x84, 0x00, 0x00, 0x9b, 0x31,
+ 0xa3, 0xfa, 0x8b, 0x91, 0x8a, 0x9e, 0x31, 0xfb, 0x93, 0x20, 0x49, 0x03, 0x2c, 0xb9, 0xa3, 0x84,
+ 0x90, 0x21, 0x60, 0x38, 0xf8, 0x38, 0x0a, 0x23, 0xf0, 0x88, 0x82, 0x0c, 0x29, 0xbc, 0xa5, 0x09,
+ 0xb0, 0x52, 0x2a, 0x1a, 0xc4, 0x91, 0x39, 0x24, 0x0d, 0x82, 0x11, 0xa8, 0x90, 0x38, 0x60, 0xd3,
+ 0x18, 0x51, 0x0b, 0x90, 0xc2, 0x8a, 0x4b, 0xb0, 0xab, 0x10, 0x73, 0xfa, 0x19, 0x0a, 0x92, 0x42,
+ 0xba, 0x00, 0x23, 0x52, 0x8b, 0x00, 0x85, 0x7a, 0xa9, 0x81, 0x4b, 0xb1, 0xd2, 0x01, 0x8f, 0x28,
+ 0x91, 0x49, 0xd1, 0x82, 0x01, 0x8a, 0x00, 0x9b, 0x32, 0x3b, 0xd4, 0x38, 0x54, 0xa0, 0x31, 0xcb,
+ 0x90, 0x41, 0xf8, 0x48, 0x11, 0x01, 0x00, 0xb9, 0x4c, 0xa2, 0xa1, 0xab, 0x09, 0xfa, 0x1c, 0x08,
+ 0x18, 0xaa, 0x06, 0x99, 0x92, 0x64, 0x1b, 0x81, 0x99, 0xa4, 0x3a, 0x92, 0x10, 0x16, 0x2b, 0x3b,
+ 0xe0, 0x94, 0xa0, 0x28, 0xac, 0x3c, 0xc0, 0x83, 0x04, 0x6b, 0xb2, 0x30, 0x2c, 0xca, 0x93, 0x02,
+ 0x99, 0xb8, 0x79, 0xb3, 0x20, 0xac, 0x82, 0xcc, 0x38, 0x81, 0xbc, 0x00, 0x18, 0x0b, 0xc5, 0x31,
+ 0x98, 0x79, 0xc9, 0x25, 0x98, 0x81, 0x19, 0x3c, 0xb3, 0xa2, 0x8b, 0x1d, 0xb1, 0x33, 0x9e, 0x94,
+ 0xaa, 0x52, 0x1b, 0x19, 0xc4, 0x50, 0xa2, 0x98, 0x10, 0x8b, 0x2d, 0xa0, 0xbb, 0x07, 0x20, 0x28,
+ 0xb3, 0x20, 0x98, 0x1e, 0xe9, 0x90, 0x2c, 0x80, 0x87, 0x31, 0x1c, 0x80, 0x28, 0xb1, 0x13, 0x95,
+ 0x55, 0x00, 0x16, 0x00, 0x23, 0xc2, 0x79, 0x0b, 0x89, 0xd0, 0xc8, 0x39, 0xb1, 0x59, 0x08, 0xa1,
+ 0x91, 0x19, 0x99, 0x37, 0x4a, 0xb1, 0xa9, 0x80, 0x01, 0x9b, 0x73, 0xd9, 0x99, 0x19, 0x3a, 0xb8,
+ 0xb5, 0x02, 0x27, 0x1b, 0x99, 0x0a, 0x14, 0xa3, 0x23, 0x7b, 0x1a, 0xc2, 0xa9, 0x29, 0xd1, 0xb9,
+ 0x27, 0x0c, 0x88, 0x00, 0x80, 0xba, 0x04, 0x1b, 0x17, 0xaa, 0x22, 0x88, 0x08, 0x6c, 0x1a, 0xf3,
+ 0x88, 0xa2, 0x09, 0x50, 0x09, 0xa1, 0x0f, 0x92, 0x21, 0xa2, 0x99, 0x21, 0x21, 0x0c, 0x31, 0xb1,
+ 0x13, 0xd1, 0x8e, 0x12, 0xd9, 0x2b, 0x95, 0x0c, 0x82, 0x2a, 0xbb, 0x90, 0x64, 0xb0, 0x21, 0x85,
+ 0x8c, 0x48, 0xd0, 0x81, 0x9a, 0x89, 0x01, 0x93, 0x73, 0xb9, 0x69, 0x00, 0x1a, 0x86, 0x18, 0x09,
+ 0x00, 0x91, 0x21, 0x08, 0x13, 0x79, 0xb9, 0xa2, 0x89, 0xd5, 0x58, 0x89, 0x89, 0xd0, 0x02, 0x90,
+ 0x8c, 0xa0, 0x99, 0x70, 0xb9, 0xa0, 0x10, 0x4b, 0x02, 0x1b, 0x97, 0x14, 0x8a, 0x29, 0x01, 0xf1,
+ 0x38, 0xa8, 0x30, 0x11, 0xf0, 0x09, 0xa2, 0x8c, 0x48, 0x20, 0xf0, 0x39, 0x90, 0xa8, 0x05, 0x2a,
+ 0xe8, 0x01, 0x2c, 0xc8, 0x82, 0x28, 0x20, 0xed, 0x12, 0x01, 0x88, 0x18, 0x9b, 0x17, 0x2a, 0xa1,
+ 0xa9, 0x82, 0x39, 0x86, 0x18, 0x1f, 0x92, 0xa9, 0x18, 0xc2, 0x28, 0x20, 0xf1, 0x3c, 0xa9, 0x11,
+ 0x08, 0xb2, 0x9f, 0x23, 0xc2, 0x8a, 0x12, 0x39, 0x19, 0x73, 0xa0, 0x84, 0x9a, 0x42, 0xb9, 0x1a,
+ 0xca, 0xb5, 0x18, 0x1b, 0x0f, 0x13, 0xb9, 0x78, 0x01, 0xa0, 0x0a, 0x00, 0x31, 0x16, 0x9c, 0xc8,
+ 0x82, 0x5b, 0x98, 0x09, 0x03, 0x8a, 0x17, 0x98, 0x0d, 0x29, 0x82, 0xc8, 0xa2, 0x89, 0x2c, 0x73,
+ 0x18, 0xa9, 0xa3, 0x32, 0x1c, 0x81, 0x30, 0xb6, 0x2a, 0x9e, 0x80, 0x11, 0x81, 0x23, 0xc9, 0x1b,
+ 0xd4, 0xff, 0x10, 0x00, 0x10, 0xb8, 0x5f, 0x33, 0x82, 0x1d, 0xd2, 0x01, 0x10, 0x0d, 0x90, 0x12,
+ 0xcb, 0x50, 0xda, 0x80, 0xb0, 0x33, 0x5a, 0xb0, 0xa1, 0x28, 0x93, 0x4c, 0x38, 0x86, 0xa8, 0xb0,
+ 0x18, 0x23, 0x0f, 0xa9, 0x04, 0x32, 0x1d, 0x88, 0xe3, 0x88, 0x00, 0x0c, 0x98, 0x78, 0x90, 0xc2,
+ 0x12, 0x2a, 0x2a, 0xa2, 0x44, 0xaa, 0x39, 0xb1, 0x2e, 0xf2, 0x00, 0x18, 0x01, 0x1b, 0xf9, 0x0a,
+ 0x82, 0x08, 0x1c, 0x13, 0x16, 0x99, 0x84, 0x99, 0x3a, 0xab, 0xa1, 0x9a, 0xd1, 0xc8, 0x35, 0xa9,
+ 0x0d, 0x98, 0x23, 0xdb, 0x11, 0x50, 0x09, 0xa8, 0x13, 0x27, 0x2b, 0xc9, 0x12, 0x9a, 0x35, 0x0a,
+ 0xa9, 0xa7, 0x2a, 0x09, 0x49, 0xb8, 0x2a, 0xb7, 0x0b, 0x9b, 0x17, 0x80, 0x18, 0x95, 0x08, 0x38,
+ 0x1a, 0xf8, 0x00, 0x98, 0x11, 0x09, 0x9a, 0x03, 0x2d, 0xb0, 0xa5, 0x53, 0x4a, 0xc2, 0x18, 0x99,
+ 0xa1, 0x0c, 0x37, 0x0c, 0xa8, 0xa2, 0x80, 0x21, 0x2d, 0x8a, 0xb8, 0x07, 0x89, 0xa8, 0x2b, 0x32,
+ 0x22, 0xef, 0xa1, 0x53, 0x00, 0x2a, 0xa8, 0x80, 0xa0, 0x02, 0xd8, 0x0d, 0x10, 0x2a, 0x14, 0xc0,
+ 0x28, 0xbb, 0x93, 0x22, 0x94, 0x0e, 0x43, 0x0c, 0x94, 0x3a, 0x92, 0xa8, 0x8c, 0x17, 0x0b, 0x84,
+ 0x2b, 0x90, 0x95, 0x12, 0x4d, 0x99, 0x88, 0xc2, 0x82, 0x3a, 0x18, 0x1a, 0xc6, 0x0c, 0xa9, 0x13,
+ 0x2a, 0xb2, 0xac, 0x1d, 0xa5, 0x18, 0x0b, 0x9e, 0x95, 0x29, 0x23, 0x08, 0x31, 0x18, 0x0b, 0xf4,
+ 0x02, 0x8c, 0x10, 0x98, 0x28, 0x1a, 0xcc, 0x97, 0x2a, 0xa2, 0x30, 0x8a, 0x9c, 0x98, 0xb3, 0x7a,
+ 0x21, 0x91, 0x51, 0x99, 0x00, 0x87, 0x31, 0x58, 0x08, 0xc1, 0xc0, 0x09, 0xa0, 0x49, 0x39, 0xaf,
+ 0xb2, 0x01, 0x90, 0x9b, 0x24, 0x4c, 0x89, 0xb2, 0x40, 0x13, 0xfa, 0x19, 0xa0, 0x4a, 0x0a, 0xa3,
+ 0x43, 0x00, 0x16, 0x00, 0x13, 0xeb, 0x93, 0x71, 0x1a, 0xa0, 0x13, 0x90, 0x8d, 0x11, 0x01, 0x8b,
+ 0xb4, 0x1e, 0xb1, 0x98, 0xa9, 0x99, 0x8f, 0x91, 0x88, 0xb9, 0x10, 0x10, 0x09, 0x82, 0x21, 0x99,
+ 0x78, 0x00, 0xf9, 0x40, 0xc4, 0x44, 0x1b, 0x41, 0xd2, 0x11, 0x98, 0x10, 0x02, 0x10, 0xc8, 0xa8,
+ 0x8f, 0xa1, 0x10, 0x1e, 0xc9, 0x20, 0x94, 0xb8, 0x1c, 0x69, 0x90, 0x09, 0x28, 0x85, 0x88, 0x89,
+ 0x01, 0x29, 0xa3, 0x9a, 0x42, 0x2c, 0xb7, 0x58, 0x0b, 0x13, 0x99, 0x02, 0xbb, 0x80, 0x28, 0xa3,
+ 0xf9, 0x8b, 0x0f, 0x21, 0xdd, 0x84, 0x29, 0x09, 0x09, 0x20, 0xb5, 0x0b, 0x33, 0x42, 0x0b, 0x97,
+ 0x38, 0xca, 0x12, 0x19, 0x94, 0xa8, 0x0b, 0x1d, 0x02, 0x1b, 0xbb, 0xd0, 0xc3, 0x49, 0x43, 0x0e,
+ 0xb3, 0x28, 0x0a, 0x90, 0x40, 0xab, 0x93, 0xa5, 0x8f, 0x98, 0x01, 0x12, 0x89, 0x06, 0x24, 0x1b,
+ 0x22, 0x0c, 0x8a, 0xe3, 0x93, 0x2c, 0x01, 0x69, 0xd1, 0x10, 0x9a, 0xaa, 0x42, 0xb2, 0xa1, 0x8d,
+ 0x24, 0x0e, 0xa2, 0x91, 0x8b, 0x23, 0x21, 0x43, 0x0d, 0xb4, 0x09, 0x00, 0x39, 0xe9, 0x88, 0xac,
+ 0x80, 0x23, 0xbb, 0x79, 0x93, 0x93, 0xb1, 0xc8, 0x49, 0x2a, 0x68, 0xa0, 0xf9, 0x19, 0xb0, 0x09,
+ 0x24, 0x41, 0x92, 0xa1, 0x10, 0x18, 0xaf, 0x9a, 0x80, 0x97, 0x21, 0x21, 0x99, 0x6a, 0x41, 0xd1,
+ 0x00, 0x99, 0x91, 0x42, 0x19, 0xd2, 0x03, 0x29, 0xbd, 0x41, 0xb0, 0x03, 0x8f, 0xa0, 0xa9, 0x84,
+ 0x90, 0x3b, 0x78, 0xaa, 0xa1, 0xb2, 0xa9, 0x5b, 0x11, 0xeb, 0x95, 0x39, 0x10, 0x9d, 0x93, 0x80,
+ 0x4a, 0xd0, 0x10, 0x80, 0x3a, 0x00, 0xc8, 0x19, 0x87, 0x58, 0xa9, 0x02, 0x2c, 0x09, 0x11, 0xd8,
+ 0x93, 0x93, 0x1d, 0x41, 0x11, 0xac, 0x60, 0xe9, 0x81, 0x21, 0x0a, 0x0a, 0x82, 0xa8, 0x39, 0x11,
+ 0xd3, 0xff, 0x11, 0x00, 0x72, 0x82, 0xab, 0xa3, 0x6d, 0x88, 0x02, 0xa8, 0x3a, 0xe3, 0x99, 0x13,
+ 0x0b, 0xe0, 0x29, 0x09, 0x39, 0xe0, 0xb3, 0x9a, 0x32, 0x53, 0x1d, 0xb0, 0x2d, 0x83, 0xe1, 0x18,
+ 0x13, 0x38, 0x1b, 0x85, 0xda, 0x92, 0x6b, 0x02, 0x9b, 0x93, 0xbb, 0x11, 0x79, 0x8a, 0x98, 0xa0,
+ 0x53, 0xa2, 0x20, 0x1b, 0x19, 0x8f, 0x15, 0xa9, 0x21, 0x01, 0x71, 0xaf, 0x12, 0x92, 0x09, 0x13,
+ 0x88, 0x3c, 0x8b, 0xb3, 0xd2, 0x12, 0x2f, 0x89, 0xa0, 0x02, 0xab, 0x9c, 0x13, 0x24, 0xbd, 0x98,
+ 0x0d, 0xb0, 0x01, 0x07, 0x1a, 0x18, 0x98, 0xb4, 0xbb, 0x53, 0x17, 0x0a, 0x0a, 0xb8, 0x23, 0x88,
+ 0xb5, 0x31, 0x9e, 0x28, 0x12, 0xd9, 0x03, 0x09, 0x9a, 0xb5, 0x6c, 0xb2, 0x01, 0x6b, 0x01, 0x90,
+ 0xb9, 0x82, 0xb8, 0xab, 0x10, 0x27, 0x0f, 0x80, 0x40, 0xb9, 0x14, 0x89, 0x1b, 0x04, 0x82, 0x1b,
+ 0x11, 0x20, 0x9a, 0x95, 0x28, 0xba, 0x67, 0x8d, 0x98, 0xa2, 0x01, 0x2a, 0xbb, 0x3a, 0x15, 0xba,
+ 0x01, 0xf8, 0x31, 0x28, 0xb8, 0x38, 0x97, 0x00, 0x7a, 0xa9, 0xa1, 0x33, 0x28, 0xab, 0x9f, 0x93,
+ 0x22, 0x01, 0x8c, 0x2b, 0xb9, 0x11, 0x07, 0x98, 0xba, 0x1d, 0x2b, 0x99, 0xf0, 0x15, 0x88, 0xa8,
+ 0x8a, 0x0a, 0xc9, 0x01, 0x9b, 0x98, 0x07, 0x62, 0x8a, 0x01, 0x59, 0x09, 0xb0, 0x31, 0x86, 0xa8,
+ 0x05, 0x8c, 0x3c, 0x20, 0xb8, 0x80, 0x16, 0x18, 0xd3, 0x18, 0xca, 0x70, 0x8a, 0x91, 0x80, 0x88,
+ 0x81, 0x03, 0x29, 0x80, 0xdc, 0x08, 0x52, 0x20, 0xd9, 0x11, 0xa0, 0x33, 0xab, 0x02, 0x00, 0xaa,
+ 0xa6, 0x7a, 0xb6, 0x88, 0x00, 0x49, 0xb0, 0x90, 0x10, 0x8b, 0xc6, 0x3a, 0x9a, 0xc8, 0x10, 0x3a,
+ 0x61, 0xc5, 0x11, 0x09, 0x2a, 0x8f, 0x94, 0x88, 0x88, 0x02, 0x1c, 0x88, 0x00, 0x08, 0x0b, 0xe0,
+ 0xbf, 0xff, 0x17, 0x00, 0x1c, 0xb4, 0x04, 0x09, 0x10, 0x00, 0xa4, 0x58, 0x0c, 0x88, 0xd9, 0x02,
+ 0x01, 0x98, 0x2a, 0x32, 0x0e, 0x87, 0x1a, 0x81, 0x0d, 0xa8, 0x00, 0x11, 0x92, 0x40, 0x18, 0x29,
+ 0x17, 0xb8, 0x30, 0x0d, 0x93, 0x28, 0x90, 0x27, 0x9c, 0x21, 0x10, 0x1a, 0x9f, 0xb4, 0x91, 0x2c,
+ 0x12, 0xcc, 0x01, 0xcb, 0x09, 0xab, 0x53, 0x12, 0x98, 0x94, 0x3a, 0xa1, 0x9d, 0x20, 0x82, 0xe2,
+ 0x28, 0x1a, 0x25, 0x0e, 0xa2, 0xc2, 0x9a, 0x51, 0x08, 0x28, 0xab, 0x63, 0xa8, 0x84, 0x0b, 0x83,
+ 0xca, 0x21, 0x00, 0x9d, 0x72, 0x03, 0xb8, 0x03, 0xb0, 0x91, 0x83, 0x2d, 0x68, 0x9b, 0x69, 0x93,
+ 0xa8, 0x11, 0x99, 0x71, 0x8b, 0xa9, 0xb3, 0x87, 0x10, 0x8f, 0xa1, 0x88, 0x19, 0xa2, 0xc8, 0x3a,
+ 0xb2, 0x59, 0x0b, 0xd3, 0x58, 0x84, 0x90, 0x2b, 0x29, 0xa8, 0xb6, 0x0b, 0x3a, 0x06, 0x89, 0x92,
+ 0x6b, 0x88, 0x21, 0xb1, 0x01, 0x9d, 0x19, 0xa8, 0x16, 0x98, 0x19, 0x99, 0x48, 0x1e, 0x86, 0x01,
+ 0x19, 0x0c, 0x00, 0xa4, 0x80, 0x8a, 0x09, 0x60, 0x8b, 0x96, 0x1a, 0x82, 0x8b, 0xb4, 0x42, 0xbb,
+ 0x8b, 0x09, 0xff, 0xa0, 0x80, 0x30, 0x1d, 0x12, 0x08, 0x93, 0xa0, 0x0d, 0x00, 0x01, 0x41, 0xda,
+ 0x40, 0x82, 0x84, 0x51, 0x0a, 0xa3, 0x01, 0xab, 0xb4, 0x5b, 0x29, 0xae, 0x00, 0xb2, 0x92, 0x02,
+ 0x5d, 0x1e, 0x90, 0xb0, 0x18, 0x14, 0x1b, 0xbb, 0xa1, 0x22, 0x0c, 0x97, 0x09, 0x18, 0x10, 0x91,
+ 0x90, 0x37, 0x2b, 0x80, 0x0c, 0x99, 0xc7, 0x08, 0x8b, 0x89, 0xa1, 0x71, 0xb2, 0x52, 0x8a, 0x82,
+ 0x10, 0x20, 0x89, 0x8e, 0xa5, 0x2b, 0x08, 0xe8, 0x12, 0x10, 0x9a, 0x50, 0xab, 0x17, 0x19, 0x09,
+ 0x92, 0x88, 0x83, 0x22, 0x9f, 0x29, 0xc8, 0xa3, 0x99, 0x10, 0x2a, 0x4b, 0xa7, 0x19, 0x48, 0xc0,
+ 0x2f, 0x00, 0x17, 0x00, 0xa8, 0x30, 0x28, 0xf1, 0x99, 0x45, 0x0c, 0x21, 0xbc, 0x10, 0x91, 0x15,
+ 0x1b, 0x8a, 0xd8, 0x00, 0x38, 0x09, 0x86, 0xa9, 0x00, 0xa2, 0x2d, 0x14, 0x49, 0xc8, 0x08, 0xb2,
+ 0x08, 0x28, 0xa0, 0x75, 0x90, 0x99, 0x4a, 0xc3, 0x99, 0x18, 0x08, 0xa4, 0x8b, 0x29, 0x3e, 0xb1,
+ 0x15, 0xa3, 0xbb, 0x4a, 0x1c, 0xf8, 0x18, 0x21, 0x28, 0x31, 0xb8, 0xc1, 0x31, 0xba, 0xd3, 0xab,
+ 0x7d, 0x89, 0x83, 0xc3, 0x01, 0x5c, 0x90, 0x00, 0x18, 0x84, 0x09, 0xb8, 0x9b, 0x07, 0x69, 0x10,
+ 0x98, 0xc0, 0x10, 0x38, 0xd4, 0x0b, 0xa1, 0x0b, 0x28, 0x17, 0x8c, 0xb0, 0x91, 0x3c, 0xd3, 0x80,
+ 0x29, 0x9c, 0x88, 0x00, 0x8a, 0xc3, 0x10, 0x38, 0x96, 0x09, 0x95, 0x30, 0x1f, 0x10, 0x81, 0xd1,
+ 0x1b, 0x83, 0x99, 0xca, 0x1c, 0x13, 0x03, 0x0e, 0x80, 0x11, 0x80, 0xa6, 0x71, 0x8a, 0x91, 0x08,
+ 0x80, 0x05, 0x38, 0x3a, 0xc4, 0x00, 0x88, 0x5a, 0x98, 0x81, 0x12, 0xb1, 0xaf, 0x0c, 0x87, 0x90,
+ 0x09, 0x18, 0x08, 0xb2, 0x8f, 0xa1, 0x31, 0xaa, 0xe4, 0x1a, 0x03, 0x2b, 0x92, 0xa8, 0xa8, 0x81,
+ 0x07, 0x1d, 0x02, 0x2b, 0x9d, 0xb4, 0x13, 0x28, 0x29, 0x39, 0x02, 0x96, 0xc9, 0x01, 0x2c, 0x79,
+ 0xb0, 0xc0, 0x29, 0x92, 0x29, 0xe8, 0x28, 0x29, 0x0a, 0x81, 0xd4, 0x15, 0x09, 0x8b, 0x91, 0x19,
+ 0xa4, 0xa1, 0x7b, 0x83, 0x1b, 0xa0, 0x80, 0x34, 0x80, 0xf9, 0x34, 0x9d, 0x90, 0x08, 0x31, 0xbc,
+ 0x38, 0x23, 0xf9, 0x25, 0x0c, 0x91, 0x21, 0x10, 0x99, 0x00, 0xf3, 0x01, 0x29, 0x10, 0xc0, 0x0d,
+ 0xd8, 0x31, 0x1c, 0xa4, 0xb0, 0x38, 0x90, 0x7b, 0x80, 0xe0, 0x01, 0x22, 0x49, 0x8d, 0xa2, 0xa1,
+ 0x0a, 0x83, 0x38, 0x1d, 0xb4, 0xa9, 0x81, 0xba, 0x71, 0x83, 0x84, 0x9a, 0xb3, 0x0a, 0x51, 0x90,
+ 0xe6, 0xff, 0x13, 0x00, 0xa0, 0xa0, 0x9f, 0x1a, 0x42, 0xb3, 0x13, 0xa2, 0x70, 0x82, 0x4b, 0x06,
+ 0x90, 0x19, 0x29, 0x84, 0x90, 0xa8, 0x73, 0x99, 0x04, 0xcb, 0x88, 0x14, 0x0a, 0x0d, 0xd1, 0x98,
+ 0x20, 0xd9, 0x19, 0x28, 0xa0, 0x99, 0xc0, 0x40, 0xac, 0x05, 0x00, 0x2c, 0xa0, 0x83, 0x21, 0x17,
+ 0x2e, 0xb2, 0x00, 0x81, 0x38, 0x8f, 0x81, 0x90, 0x22, 0xc0, 0x29, 0x32, 0xc9, 0x39, 0xb1, 0x16,
+ 0xc2, 0x0a, 0x2c, 0x23, 0x84, 0xa2, 0x5c, 0xca, 0xb0, 0x93, 0x59, 0x1a, 0x51, 0x8c, 0xb2, 0xd0,
+ 0x30, 0xb8, 0x68, 0x19, 0xc0, 0x88, 0x38, 0x93, 0x00, 0xce, 0x01, 0x3c, 0x00, 0xc3, 0x09, 0xa9,
+ 0xa8, 0x2b, 0x94, 0x82, 0x4f, 0x00, 0x94, 0xb3, 0x18, 0x3f, 0x81, 0xa2, 0xd8, 0x2b, 0x81, 0x8c,
+ 0x19, 0x17, 0x90, 0xa0, 0x81, 0x6b, 0x80, 0x99, 0x02, 0xd8, 0x30, 0x9c, 0xc2, 0x31, 0x99, 0x58,
+ 0x91, 0x30, 0xc2, 0x72, 0x9b, 0xc1, 0x30, 0x99, 0xa1, 0x43, 0x1c, 0xba, 0xa3, 0x68, 0xaa, 0xa2,
+ 0x58, 0xab, 0x24, 0x98, 0x83, 0xab, 0x01, 0x4f, 0xb8, 0x93, 0x8c, 0xb0, 0xc4, 0x29, 0x88, 0x1d,
+ 0x26, 0x89, 0x99, 0x17, 0x88, 0x88, 0x1b, 0x94, 0x20, 0x10, 0x49, 0xb3, 0x33, 0x1a, 0xf0, 0x22,
+ 0x81, 0x1c, 0x48, 0x9c, 0xe8, 0x01, 0x1b, 0x20, 0xf1, 0x31, 0x8a, 0xc0, 0x08, 0x18, 0xac, 0x04,
+ 0x0a, 0x90, 0x2b, 0xf3, 0x21, 0x1c, 0xc0, 0xa4, 0x01, 0x2f, 0x3b, 0x94, 0x81, 0x89, 0x9b, 0x30,
+ 0x15, 0x90, 0x8a, 0x14, 0x4b, 0x8c, 0x03, 0x80, 0x87, 0x89, 0x09, 0x92, 0x0f, 0x01, 0xb8, 0x73,
+ 0x81, 0x82, 0x2b, 0xba, 0x09, 0xf9, 0x01, 0x21, 0x19, 0x0b, 0xc2, 0xbb, 0x92, 0xb5, 0x2d, 0x03,
+ 0x0a, 0x4b, 0xb2, 0x17, 0xe0, 0x18, 0x08, 0x0b, 0xa2, 0x31, 0x82, 0x8a, 0x1c, 0xb7, 0x2b, 0x90,
+ 0xe1, 0xff, 0x13, 0x00, 0x96, 0x4a, 0x91, 0x98, 0x30, 0xc8, 0xa0, 0x42, 0x22, 0x8a, 0x9e, 0xda,
+ 0x42, 0x89, 0xf2, 0x28, 0x0a, 0x83, 0x89, 0x9c, 0x28, 0x13, 0xb5, 0x0a, 0x17, 0x9a, 0x4c, 0xd8,
+ 0x88, 0x21, 0x99, 0x31, 0x85, 0x1b, 0x8a, 0x00, 0xb3, 0xa1, 0x79, 0xbb, 0x73, 0xbb, 0x13, 0xca,
+ 0x81, 0x01, 0x3a, 0xd8, 0x54, 0x8a, 0x40, 0x84, 0x89, 0x92, 0x8a, 0x91, 0x40, 0x1c, 0xd8, 0x02,
+ 0x08, 0xa8, 0x3c, 0xb3, 0xba, 0x62, 0xba, 0xc8, 0x70, 0x02, 0x08, 0x09, 0xf0, 0x00, 0x83, 0x38,
+ 0x8f, 0x80, 0x98, 0x91, 0x92, 0x51, 0x13, 0xbf, 0x33, 0x19, 0x80, 0x90, 0xa9, 0x1c, 0x88, 0xf2,
+ 0x00, 0x23, 0x2c, 0xbc, 0x40, 0x83, 0xd3, 0x01, 0x4a, 0x8b, 0x11, 0xc5, 0x89, 0x13, 0x99, 0x58,
+ 0xb2, 0x91, 0x7b, 0x09, 0x98, 0x88, 0xca, 0xe2, 0x5b, 0x82, 0x80, 0x29, 0x89, 0x49, 0x92, 0xb1,
+ 0xa1, 0x81, 0x79, 0xca, 0x90, 0x58, 0x2d, 0xc3, 0x12, 0xaa, 0x03, 0x28, 0x0d, 0x04, 0x48, 0x09,
+ 0x86, 0x89, 0x83, 0x1a, 0xa8, 0xa1, 0x72, 0xa0, 0xa0, 0xa1, 0xc3, 0x98, 0x2f, 0x08, 0xda, 0x80,
+ 0x20, 0xf1, 0x28, 0x59, 0xb9, 0x88, 0xa3, 0x93, 0x7a, 0x0d, 0x81, 0x81, 0x20, 0xd8, 0x09, 0x91,
+ 0x3a, 0x5b, 0xb2, 0x92, 0x28, 0x8f, 0x21, 0xc0, 0x20, 0x08, 0x06, 0x98, 0x3a, 0xc8, 0xbb, 0x32,
+ 0x39, 0xb5, 0x61, 0xb8, 0x48, 0x83, 0x9d, 0x11, 0x18, 0x08, 0x2d, 0xa7, 0x09, 0x2a, 0xca, 0x14,
+ 0x19, 0xb9, 0x06, 0x0b, 0x08, 0xaa, 0xc2, 0x11, 0x40, 0x38, 0x9c, 0x84, 0x3a, 0xf2, 0x80, 0x20,
+ 0x09, 0xe0, 0x20, 0x89, 0x99, 0x40, 0xd0, 0x20, 0x18, 0x15, 0x31, 0x81, 0xc0, 0xa0, 0x21, 0x1f,
+ 0xaa, 0x04, 0x85, 0x02, 0x0b, 0x9d, 0x08, 0x0b, 0x97, 0x88, 0x00, 0x20, 0x20, 0xdd, 0x38, 0x11,
+ 0x60, 0x00, 0x17, 0x00, 0x1d, 0x20, 0xb2, 0x22, 0x42, 0x2c, 0xcc, 0xa2, 0x60, 0xb9, 0x92, 0x90,
+ 0x49, 0x8a, 0x00, 0x2b, 0x92, 0xc7, 0xa0, 0x4b, 0x68, 0xb0, 0x11, 0xc8, 0xa8, 0x81, 0x20, 0x39,
+ 0xaf, 0xa5, 0x93, 0x4a, 0x98, 0xc0, 0x14, 0x0b, 0x38, 0xc0, 0x02, 0x2c, 0xa2, 0xc4, 0x10, 0x2a,
+ 0x92, 0x1d, 0x28, 0xea, 0x91, 0x02, 0x3a, 0x3a, 0x43, 0xa1, 0xb6, 0x81, 0x7a, 0x80, 0x91, 0x4b,
+ 0x8a, 0xa8, 0xc5, 0x18, 0x61, 0x98, 0x90, 0x99, 0x28, 0x0f, 0xb0, 0xe3, 0x81, 0x4b, 0x18, 0x98,
+ 0x00, 0xa0, 0x05, 0x85, 0x49, 0x9a, 0x0c, 0x98, 0x95, 0x00, 0x98, 0x28, 0x1d, 0xa2, 0x89, 0x16,
+ 0x28, 0x33, 0xac, 0xa2, 0x12, 0x8a, 0x3c, 0x9d, 0x16, 0xc8, 0x48, 0x90, 0x98, 0xa8, 0x02, 0x8b,
+ 0x3b, 0xac, 0x07, 0x08, 0x08, 0x3b, 0xc6, 0x83, 0x49, 0x0a, 0x1a, 0xe8, 0x80, 0xa0, 0x20, 0x3d,
+ 0xb3, 0x81, 0x31, 0x5a, 0xe9, 0x19, 0x23, 0xb9, 0x09, 0x2d, 0x81, 0x17, 0x98, 0x90, 0x39, 0x8f,
+ 0x06, 0x09, 0x89, 0x81, 0x18, 0x28, 0x82, 0x28, 0xaf, 0x91, 0x32, 0x91, 0x8d, 0x19, 0x08, 0xad,
+ 0x84, 0x99, 0x15, 0x0c, 0x90, 0x80, 0x6b, 0x13, 0xd0, 0x91, 0x50, 0xbb, 0x38, 0xa2, 0xca, 0x1a,
+ 0x15, 0x90, 0x2a, 0x8d, 0x23, 0xb8, 0x36, 0x91, 0x9f, 0x28, 0x81, 0xa1, 0x9f, 0x81, 0x30, 0x10,
+ 0x32, 0x8e, 0xa0, 0x10, 0x95, 0x0c, 0x89, 0x31, 0xe1, 0x90, 0x02, 0x10, 0x7b, 0x9b, 0x90, 0x97,
+ 0x80, 0x09, 0x00, 0xa1, 0x88, 0x3b, 0x2e, 0x83, 0xb3, 0x85, 0x3d, 0xa8, 0x21, 0x11, 0xad, 0x01,
+ 0x83, 0x2f, 0x88, 0xb5, 0x31, 0xb1, 0x3d, 0xd2, 0x10, 0x29, 0x89, 0x20, 0xc8, 0xa1, 0x04, 0x9a,
+ 0xb9, 0x3e, 0x20, 0xe1, 0xa3, 0x8f, 0x08, 0x94, 0x2a, 0x3a, 0xa2, 0x09, 0x9c, 0xc3, 0x12, 0x2c,
+ 0xf3, 0xff, 0x16, 0x00, 0xae, 0x82, 0x08, 0x14, 0xba, 0x5a, 0x08, 0xa2, 0xbd, 0x13, 0x08, 0x91,
+ 0x27, 0x9b, 0x38, 0x98, 0x28, 0x87, 0x98, 0x0b, 0x91, 0x31, 0x1b, 0x62, 0xf1, 0x0c, 0x11, 0x99,
+ 0x01, 0x32, 0x28, 0xa4, 0x61, 0x5b, 0xd0, 0xb1, 0x11, 0x00, 0x3a, 0x8a, 0x04, 0x99, 0x9b, 0x17,
+ 0x8b, 0xd1, 0x09, 0xba, 0x19, 0xb9, 0x37, 0x91, 0x4d, 0x91, 0xba, 0x18, 0x94, 0x68, 0x99, 0x80,
+ 0x02, 0x18, 0xb8, 0x79, 0x91, 0x84, 0x0d, 0x01, 0x83, 0xa8, 0x0b, 0xa5, 0x2d, 0x88, 0x2a, 0x33,
+ 0x12, 0xf3, 0x3a, 0x8f, 0x02, 0x90, 0x29, 0x8b, 0xa3, 0xc0, 0x2b, 0xa5, 0xbb, 0x62, 0x29, 0x93,
+ 0xc2, 0x48, 0x08, 0xbc, 0xb4, 0x9f, 0x24, 0x92, 0x20, 0xa8, 0x99, 0x81, 0x1b, 0x62, 0xad, 0x02,
+ 0x98, 0xad, 0x14, 0x1a, 0x01, 0xc9, 0x39, 0x1e, 0xb3, 0x84, 0x2a, 0x92, 0x7a, 0x09, 0xe2, 0x01,
+ 0x11, 0x3a, 0xb3, 0x12, 0xb9, 0x0d, 0x30, 0x97, 0x1a, 0x0d, 0xb2, 0x29, 0xb0, 0x90, 0xf3, 0x1d,
+ 0x30, 0xa0, 0x8b, 0x06, 0x02, 0x18, 0x89, 0xb2, 0x0a, 0x0c, 0x07, 0xb1, 0x7a, 0x08, 0x89, 0xb3,
+ 0x90, 0x09, 0x80, 0x5a, 0x18, 0x62, 0xa1, 0x10, 0xc4, 0x21, 0x91, 0x1e, 0x1c, 0x98, 0x81, 0x12,
+ 0xa5, 0xa0, 0x1e, 0x20, 0x08, 0x01, 0x99, 0xe0, 0x22, 0x00, 0x1b, 0x3a, 0x12, 0xca, 0xc0, 0xd3,
+ 0x11, 0xff, 0x11, 0x01, 0x90, 0x98, 0x3a, 0x0b, 0x3b, 0xa7, 0x92, 0x3b, 0x03, 0x8c, 0x21, 0x2a,
+ 0xad, 0x24, 0x80, 0xf0, 0x02, 0x2b, 0x8b, 0x1b, 0x05, 0x83, 0x33, 0xca, 0xa1, 0x3d, 0x82, 0x01,
+ 0x9d, 0x23, 0xd0, 0x8c, 0x10, 0xa7, 0x18, 0x8d, 0x02, 0xb8, 0x4b, 0x8a, 0xa7, 0x19, 0x98, 0x20,
+ 0x91, 0x89, 0x98, 0x31, 0xd8, 0x12, 0xbd, 0x1a, 0x78, 0xe2, 0xb1, 0x3a, 0x49, 0x93, 0xb1, 0x3c,
+ 0x96, 0xff, 0x16, 0x00, 0xa9, 0x18, 0x7a, 0xb3, 0x22, 0x12, 0xc9, 0x20, 0x03, 0x2c, 0x94, 0x18,
+ 0x01, 0xfa, 0x32, 0x21, 0x7a, 0xd1, 0x18, 0xc9, 0x81, 0x8c, 0x80, 0x52, 0x98, 0x91, 0x1c, 0xa9,
+ 0xb2, 0x82, 0x2e, 0x91, 0x53, 0xdb, 0xab, 0x93, 0xb0, 0x40, 0x88, 0x3c, 0x26, 0x80, 0x89, 0x94,
+ 0x9b, 0x24, 0x00, 0x4a, 0x8d, 0xd2, 0x21, 0x20, 0x89, 0xa1, 0x35, 0x3a, 0xc1, 0x0c, 0x41, 0xc9,
+ 0xa3, 0x29, 0xa1, 0x4b, 0x0d, 0x05, 0xa9, 0x13, 0xbf, 0x23, 0x90, 0xb9, 0xa2, 0x5a, 0x4b, 0xd1,
+ 0x21, 0x81, 0xbb, 0x50, 0xa8, 0x23, 0xb9, 0xf8, 0x18, 0x98, 0x29, 0x3a, 0x7a, 0x95, 0x9b, 0x80,
+ 0x72, 0x88, 0xc2, 0x31, 0x9a, 0x9c, 0x52, 0xa9, 0x16, 0x0a, 0x98, 0x81, 0x00, 0x8a, 0x0a, 0xab,
+ 0x45, 0xc1, 0x91, 0x39, 0x38, 0x2e, 0xe2, 0x01, 0x00, 0x90, 0x8c, 0x69, 0x98, 0xa8, 0x32, 0x23,
+ 0xba, 0x01, 0x01, 0xbf, 0x42, 0x29, 0xd5, 0x90, 0x28, 0x3a, 0x9a, 0xa9, 0x97, 0x89, 0x32, 0x2c,
+ 0x30, 0x8b, 0xa6, 0xa3, 0x2a, 0xb9, 0x9f, 0x81, 0x40, 0x3a, 0xb2, 0x08, 0xe1, 0x03, 0x89, 0x6a,
+ 0x0a, 0xd4, 0x10, 0x1a, 0x20, 0xa9, 0xe4, 0x18, 0x28, 0x80, 0xa2, 0x05, 0x9d, 0x0a, 0xc1, 0xa0,
+ 0x3d, 0xa4, 0x31, 0x09, 0x1b, 0x92, 0x05, 0xa0, 0x81, 0x1f, 0xa9, 0x02, 0xa2, 0x00, 0x54, 0x0a,
+ 0x0a, 0x80, 0xb2, 0xe7, 0x28, 0x2b, 0xa1, 0x58, 0x88, 0x88, 0xa5, 0x90, 0x2d, 0x3b, 0x89, 0xf3,
+ 0x81, 0x6a, 0x80, 0x29, 0x09, 0x80, 0x85, 0x09, 0xb9, 0x31, 0x1c, 0x19, 0x30, 0xd5, 0x83, 0x3a,
+ 0x14, 0x20, 0x8e, 0x82, 0x08, 0x28, 0xf2, 0x09, 0x83, 0x9a, 0x5b, 0xb0, 0xd8, 0x91, 0x69, 0x00,
+ 0x10, 0xa9, 0x1c, 0xc2, 0x43, 0x09, 0x1a, 0xdb, 0x03, 0x98, 0x31, 0xc2, 0xaf, 0x3a, 0xc2, 0xa1,
+ 0x6b, 0xff, 0x16, 0x00, 0x41, 0x3b, 0xd2, 0x84, 0x90, 0x38, 0x8f, 0x22, 0xa0, 0x88, 0x12, 0x32,
+ 0xa0, 0x98, 0x79, 0x8e, 0x91, 0x82, 0x12, 0xac, 0x1b, 0x07, 0x9b, 0x12, 0xb0, 0x1b, 0x92, 0x90,
+ 0x74, 0x99, 0x88, 0x9c, 0x04, 0xd8, 0x3a, 0xc1, 0x18, 0x2c, 0xb0, 0xa2, 0x44, 0x19, 0xd2, 0x4a,
+ 0x98, 0xa9, 0xb0, 0x34, 0x09, 0x42, 0x29, 0x87, 0x50, 0x0b, 0x88, 0x93, 0xe9, 0x28, 0xa8, 0x11,
+ 0x28, 0x13, 0xbc, 0x43, 0x1a, 0x8a, 0xf3, 0x5b, 0x29, 0x51, 0xb9, 0x89, 0x93, 0x9c, 0x16, 0x39,
+ 0x0a, 0xc5, 0x1a, 0x09, 0x92, 0xab, 0xb4, 0x70, 0xa9, 0xa2, 0x30, 0x30, 0xbb, 0x8e, 0xa0, 0xac,
+ 0x22, 0xa1, 0x80, 0x04, 0x2e, 0x20, 0xa0, 0xd2, 0x52, 0x9b, 0xa1, 0x12, 0x27, 0x28, 0xa9, 0x04,
+ 0xaf, 0x83, 0x30, 0xa8, 0x9a, 0x08, 0x6b, 0x80, 0xc0, 0x94, 0x42, 0x2a, 0x38, 0x86, 0xa1, 0xbd,
+ 0x31, 0x38, 0x11, 0x9a, 0x15, 0xdc, 0x88, 0x19, 0x31, 0xdc, 0x21, 0x8c, 0x90, 0xa0, 0x38, 0x22,
+ 0x48, 0x92, 0x8e, 0xa3, 0x1a, 0x21, 0x93, 0x2c, 0x13, 0x78, 0xa0, 0x01, 0x06, 0xa8, 0xfa, 0x19,
+ 0x20, 0x1b, 0xc1, 0x1b, 0x83, 0xb9, 0x12, 0x27, 0x49, 0x91, 0x9c, 0x22, 0x0c, 0x87, 0x9a, 0x90,
+ 0x58, 0x0e, 0xa1, 0x80, 0x03, 0xc9, 0x39, 0x0e, 0x94, 0x0a, 0x81, 0xa2, 0x3a, 0xb2, 0x9c, 0x01,
+ 0xb0, 0x70, 0x18, 0x85, 0xaa, 0x28, 0xba, 0x02, 0x72, 0x31, 0xb0, 0xb2, 0x30, 0x0f, 0xc2, 0x20,
+ 0x80, 0x35, 0x1a, 0x8d, 0x95, 0x99, 0xb0, 0x5c, 0x09, 0xd1, 0x40, 0xaa, 0x00, 0x10, 0xb0, 0x29,
+ 0x40, 0x41, 0x92, 0xb1, 0x0d, 0xe1, 0x39, 0x33, 0xa0, 0x80, 0x9b, 0x2d, 0xc8, 0x10, 0x07, 0xa1,
+ 0x7b, 0x10, 0x8b, 0x82, 0xa1, 0x91, 0x24, 0x89, 0x2d, 0xb0, 0x5a, 0x94, 0x88, 0xb8, 0x3b, 0x39,
+ 0x71, 0x00, 0x10, 0x00, 0x2f, 0xb8, 0x9c, 0x61, 0xc8, 0x12, 0x98, 0x8a, 0x20, 0x9c, 0xb2, 0xb8,
+ 0x1e, 0x21, 0xb0, 0x90, 0x11, 0x5c, 0x99, 0x57, 0x98, 0x90, 0x89, 0x32, 0x9f, 0x02, 0x91, 0x39,
+ 0x89, 0x24, 0x8a, 0xb0, 0x00, 0x62, 0x0d, 0xe3, 0x31, 0x89, 0x90, 0x7b, 0x90, 0x11, 0xd1, 0x3a,
+ 0x90, 0x80, 0x2a, 0x20, 0xb9, 0xa6, 0x19, 0x99, 0x48, 0xaa, 0xad, 0xa3, 0x13, 0x3b, 0x38, 0xf2,
+ 0x23, 0x9f, 0x20, 0xdb, 0x13, 0xa0, 0x29, 0x00, 0xab, 0x37, 0x9c, 0x82, 0x25, 0xac, 0x91, 0x79,
+ 0x91, 0x98, 0xa1, 0x1b, 0x2b, 0x14, 0x00, 0xf4, 0x20, 0x3a, 0xb8, 0x09, 0x00, 0x90, 0xa0, 0x14,
+ 0x60, 0x40, 0xbc, 0x15, 0x8b, 0xe0, 0x40, 0x88, 0x10, 0x00, 0x90, 0xca, 0x11, 0x42, 0x92, 0x0a,
+ 0x99, 0x09, 0x91, 0x30, 0xfc, 0x1f, 0x91, 0xa2, 0x68, 0x89, 0x89, 0x94, 0x11, 0x3c, 0xca, 0xc0,
+ 0x15, 0x18, 0x19, 0x9e, 0x91, 0x80, 0x02, 0x89, 0xa0, 0x81, 0x8f, 0x13, 0x28, 0xa4, 0x09, 0x71,
+ 0xaa, 0x10, 0x0a, 0xd1, 0x00, 0x99, 0x15, 0x10, 0x2b, 0xa3, 0xab, 0xd8, 0x70, 0xa0, 0x88, 0x14,
+ 0x21, 0xac, 0x8b, 0xc6, 0x13, 0x5b, 0x9b, 0x23, 0xa3, 0x93, 0x9d, 0x53, 0x98, 0x0c, 0xc1, 0x58,
+ 0x90, 0x80, 0x20, 0x90, 0x0d, 0xa2, 0xd9, 0x39, 0x10, 0xd9, 0x80, 0x24, 0x2b, 0x38, 0xb4, 0x78,
+ 0x81, 0x11, 0xc2, 0x2d, 0x01, 0xab, 0xb1, 0x29, 0xa9, 0xdb, 0x91, 0x40, 0x28, 0x9b, 0x83, 0x31,
+ 0xcf, 0x83, 0x98, 0x70, 0x10, 0xc9, 0x68, 0xb8, 0x01, 0x5b, 0xc4, 0x09, 0x10, 0x99, 0x10, 0x08,
+ 0x87, 0x2b, 0xa8, 0x40, 0x99, 0x14, 0x92, 0x1d, 0x22, 0x99, 0xe2, 0x29, 0x39, 0xda, 0x08, 0x82,
+ 0x90, 0x51, 0xa3, 0x90, 0x29, 0x3a, 0xef, 0x98, 0x01, 0xb8, 0x38, 0xf9, 0x28, 0x20, 0x00, 0x38,
+ 0xfd, 0xff, 0x13, 0x00, 0x0e, 0x24, 0x0b, 0x10, 0xd3, 0x11, 0x8a, 0x09, 0x28, 0xc9, 0xb0, 0x13,
+ 0xc8, 0x3f, 0x9a, 0xd2, 0xc1, 0x39, 0x0a, 0x89, 0xb7, 0x3d, 0xa2, 0x89, 0x10, 0x12, 0x32, 0xdc,
+ 0x90, 0x54, 0x80, 0x81, 0x8d, 0x91, 0x18, 0x94, 0x20, 0x9b, 0x58, 0xb8, 0x17, 0xa8, 0x1b, 0xda,
+ 0x41, 0x28, 0xda, 0x91, 0x09, 0x29, 0x13, 0xb2, 0x71, 0xb8, 0x04, 0x92, 0x48, 0x08, 0xba, 0xa3,
+ 0x38, 0x9b, 0x2e, 0xa0, 0x07, 0x5b, 0x08, 0xc8, 0x89, 0x16, 0x09, 0x88, 0x1b, 0xa1, 0xe9, 0x90,
+ 0x50, 0x49, 0xa0, 0x98, 0xa1, 0x00, 0x10, 0x80, 0x72, 0x11, 0x96, 0x39, 0x91, 0x04, 0x9b, 0xa3,
+ 0xaf, 0x18, 0x90, 0x23, 0xae, 0x30, 0xbe, 0xd2, 0x20, 0x39, 0x09, 0xa2, 0x1b, 0x16, 0x93, 0x39,
+ 0xdb, 0x78, 0xb1, 0x08, 0x82, 0x0a, 0x02, 0xab, 0x38, 0x07, 0x98, 0x49, 0xb9, 0x95, 0x21, 0x19,
+ 0xba, 0x26, 0x8c, 0x98, 0x81, 0xa3, 0xd8, 0x6c, 0x90, 0x21, 0xc9, 0x01, 0x9a, 0x0a, 0x99, 0xa8,
+ 0x21, 0xbf, 0x11, 0xb3, 0x3a, 0x94, 0x68, 0x1b, 0x0c, 0xb7, 0x19, 0x39, 0x03, 0x81, 0x3a, 0x2c,
+ 0xa6, 0xb0, 0xbb, 0x00, 0x7a, 0xb4, 0x48, 0x19, 0x29, 0x8a, 0xf2, 0x04, 0x19, 0x10, 0x2b, 0xd1,
+ 0xb2, 0x69, 0x89, 0x91, 0x81, 0x0c, 0x13, 0x84, 0x41, 0x9c, 0xaa, 0x34, 0x99, 0xe8, 0x31, 0x8b,
+ 0xa8, 0xf2, 0x10, 0x19, 0x3a, 0xb1, 0x90, 0x83, 0x1f, 0xd9, 0x09, 0x03, 0x99, 0x25, 0xa0, 0x79,
+ 0x08, 0xda, 0x80, 0x88, 0x33, 0x8f, 0x13, 0x10, 0xa0, 0x11, 0x0f, 0x20, 0x90, 0x98, 0x82, 0x93,
+ 0xc9, 0x43, 0x49, 0xb1, 0x3a, 0xb1, 0x18, 0x17, 0x01, 0x5a, 0xd8, 0x3c, 0xd0, 0x10, 0x98, 0x94,
+ 0xac, 0x08, 0x49, 0x88, 0xb1, 0x10, 0xc1, 0x48, 0x8b, 0x2b, 0x96, 0x07, 0x28, 0x29, 0xfa, 0x00,
+ 0xcd, 0xff, 0x1e, 0x00, 0x81, 0x0a, 0x11, 0x05, 0x1b, 0x98, 0x02, 0x9d, 0xa3, 0x48, 0xa8, 0x01,
+ 0x40, 0x8b, 0x2c, 0xa7, 0x19, 0x19, 0xa2, 0x00, 0x2c, 0x1a, 0xfb, 0x01, 0xa0, 0x19, 0x91, 0x15,
+ 0x9a, 0x57, 0x09, 0x12, 0xaa, 0x09, 0xad, 0x96, 0x18, 0x98, 0x8b, 0x11, 0xdc, 0x31, 0xa1, 0x18,
+ 0xb3, 0x2a, 0x7b, 0x85, 0x93, 0x19, 0x8a, 0x90, 0xb9, 0xba, 0xaf, 0x24, 0x41, 0x0b, 0xb2, 0xd8,
+ 0x33, 0x0e, 0xa1, 0xb1, 0x32, 0x7a, 0x89, 0xb5, 0xa0, 0x1b, 0x0e, 0x32, 0xc0, 0x00, 0x84, 0x1c,
+ 0x98, 0x91, 0x12, 0x51, 0x9c, 0xa0, 0x28, 0x06, 0x9a, 0x88, 0x00, 0x8e, 0x93, 0x8a, 0x02, 0x11,
+ 0x8c, 0x81, 0x08, 0xb4, 0x17, 0x0b, 0x33, 0x2c, 0x86, 0x08, 0xc0, 0x82, 0x1e, 0x88, 0xb0, 0x00,
+ 0x72, 0x88, 0x09, 0x00, 0x85, 0x20, 0xac, 0x01, 0x91, 0x83, 0x70, 0x3a, 0x96, 0x99, 0x39, 0xc8,
+ 0xa3, 0x49, 0x0a, 0x91, 0xbb, 0x2a, 0xfa, 0xb8, 0x53, 0x82, 0xca, 0x4a, 0x4a, 0xb2, 0x08, 0xc1,
+ 0x98, 0x0b, 0x72, 0x82, 0x1a, 0x10, 0x83, 0x95, 0x0d, 0x01, 0x22, 0x8f, 0xe1, 0x18, 0x30, 0x09,
+ 0x91, 0xa0, 0x71, 0xa8, 0x21, 0x09, 0xb1, 0x98, 0x68, 0x8e, 0x89, 0xa1, 0x52, 0x98, 0xc8, 0x04,
+ 0x2a, 0xb9, 0x1a, 0x48, 0xd1, 0x92, 0x00, 0x89, 0x10, 0xa5, 0x58, 0x8f, 0x00, 0x81, 0x12, 0x06,
+ 0x1c, 0xa8, 0x09, 0x08, 0x98, 0x98, 0xa5, 0x0b, 0x99, 0x04, 0x2c, 0x8a, 0x9e, 0xb4, 0x99, 0x61,
+ 0x00, 0x08, 0x12, 0x0b, 0xc2, 0xf8, 0xa1, 0x61, 0x2a, 0x80, 0x02, 0x20, 0x00, 0xe8, 0x88, 0x22,
+ 0x1c, 0x83, 0x9d, 0x13, 0xbc, 0xa8, 0x20, 0x73, 0x99, 0x15, 0x88, 0xab, 0x11, 0x0f, 0xb2, 0x90,
+ 0x5a, 0x11, 0x80, 0x0c, 0x15, 0xd1, 0x48, 0x09, 0x03, 0xa0, 0x80, 0x38, 0x0f, 0xa2, 0x18, 0xca,
+ 0x21, 0x00, 0x19, 0x00, 0x91, 0x2a, 0xf2, 0x08, 0x99, 0x21, 0xae, 0x01, 0x81, 0x0a, 0xb9, 0x05,
+ 0x34, 0x2a, 0x3a, 0xb0, 0xa5, 0xcc, 0x00, 0x79, 0xd1, 0x10, 0x3a, 0x01, 0xaa, 0x00, 0x14, 0x10,
+ 0xa9, 0x14, 0x8a, 0x31, 0x9f, 0xa4, 0xa1, 0x43, 0x0f, 0xa0, 0x10, 0x81, 0x8a, 0x9a, 0x07, 0x0a,
+ 0x93, 0x8e, 0x21, 0x88, 0x09, 0x05, 0x41, 0xa0, 0x33, 0x8e, 0x00, 0x01, 0x98, 0x12, 0xd0, 0x3d,
+ 0xd0, 0x28, 0x90, 0xa0, 0x54, 0x8a, 0x0a, 0xa1, 0x12, 0x3b, 0xc9, 0xa0, 0x97, 0x3a, 0x49, 0x1a,
+ 0x94, 0xd8, 0x22, 0x19, 0x21, 0xd8, 0xb2, 0x3d, 0x8d, 0x91, 0x3a, 0xc4, 0xa8, 0x28, 0x01, 0x52,
+ 0x39, 0xf1, 0x9b, 0x9b, 0x32, 0xbb, 0x50, 0x88, 0x88, 0xf3, 0x02, 0x1d, 0x00, 0x81, 0x01, 0xa9,
+ 0x23, 0x04, 0x9f, 0x32, 0xb5, 0x48, 0xa0, 0x09, 0x0b, 0x07, 0x2c, 0x01, 0xb8, 0x00, 0xa8, 0x29,
+ 0x2c, 0x32, 0xf8, 0x2a, 0x94, 0x88, 0x83, 0xa9, 0x0f, 0x29, 0xa8, 0x84, 0x38, 0x12, 0x43, 0xb8,
+ 0x9e, 0x41, 0xd9, 0x41, 0x8d, 0xa2, 0x98, 0x21, 0x50, 0x98, 0x89, 0x19, 0x34, 0xc8, 0xf3, 0x28,
+ 0xb9, 0x2b, 0x10, 0x30, 0x2b, 0xfc, 0x23, 0x29, 0xd2, 0x38, 0x9b, 0xaa, 0x20, 0x42, 0x95, 0x48,
+ 0xc0, 0x00, 0x33, 0x2c, 0xa5, 0x9c, 0x20, 0x83, 0x8a, 0x15, 0xeb, 0x40, 0xba, 0x31, 0x00, 0x28,
+ 0xb8, 0x99, 0xf9, 0x80, 0x9e, 0x00, 0x28, 0x92, 0x94, 0x90, 0x82, 0x0e, 0x38, 0x32, 0x09, 0xca,
+ 0x81, 0x26, 0xe0, 0x88, 0x38, 0x2b, 0xa5, 0x39, 0x24, 0x08, 0x08, 0xf9, 0xb0, 0x2b, 0x19, 0x22,
+ 0xfa, 0x01, 0x9c, 0x38, 0xf4, 0x0b, 0x32, 0x9a, 0xa4, 0x38, 0x28, 0x02, 0xf2, 0x5a, 0x98, 0x29,
+ 0x83, 0x01, 0xbc, 0x42, 0x91, 0xd0, 0x1d, 0x84, 0x08, 0x8b, 0x08, 0x80, 0x35, 0x99, 0xa5, 0x09,
+ 0xe2, 0xff, 0x17, 0x00, 0x92, 0x89, 0x20, 0x1f, 0x83, 0x38, 0x95, 0x91, 0xc0, 0x1f, 0x83, 0x18,
+ 0x38, 0xb9, 0x21, 0xd3, 0x49, 0x01, 0xbf, 0xa3, 0x81, 0x20, 0xc4, 0x7a, 0xb0, 0x28, 0xa9, 0x21,
+ 0xb1, 0x08, 0x18, 0x1f, 0x90, 0x89, 0xd9, 0x0b, 0x17, 0x09, 0x28, 0x0a, 0xc4, 0x80, 0x39, 0x30,
+ 0xc2, 0x90, 0x4a, 0xf2, 0x39, 0x09, 0x18, 0x9b, 0x15, 0xb2, 0x9b, 0x33, 0x02, 0x3f, 0xf0, 0x89,
+ 0xa0, 0x10, 0x9b, 0xb0, 0x73, 0x09, 0x90, 0x8b, 0xdb, 0x10, 0x13, 0x72, 0xc8, 0x41, 0x89, 0xa8,
+ 0xa0, 0x29, 0x4c, 0xf1, 0x82, 0x1b, 0x18, 0xb1, 0x51, 0xd1, 0x32, 0x88, 0x1d, 0xb9, 0x92, 0x22,
+ 0x09, 0x62, 0x10, 0xbb, 0xc3, 0x42, 0x99, 0xb0, 0x71, 0xb2, 0x0a, 0x33, 0x3a, 0x97, 0x99, 0x12,
+ 0x3d, 0xb3, 0x24, 0x2b, 0xca, 0xf3, 0x00, 0x2b, 0xa1, 0x42, 0x18, 0x80, 0xe0, 0xaa, 0x04, 0x31,
+ 0x72, 0x2a, 0xc2, 0x28, 0x29, 0xa1, 0x13, 0x18, 0x09, 0xfa, 0x2a, 0x00, 0x89, 0x9c, 0x95, 0x1b,
+ 0x92, 0x05, 0x81, 0x6a, 0x06, 0x10, 0x2a, 0xa8, 0x32, 0x8a, 0xb6, 0x13, 0x1d, 0xb8, 0x41, 0x0c,
+ 0x84, 0x10, 0xa8, 0x88, 0xf9, 0x8c, 0x30, 0x8b, 0x31, 0xb6, 0x1a, 0x96, 0x2a, 0x90, 0x2b, 0xdc,
+ 0xb1, 0x08, 0xd0, 0x28, 0xbb, 0x10, 0x9f, 0xa1, 0xa9, 0xa3, 0x8f, 0xa8, 0xa9, 0x49, 0xc8, 0x0a,
+ 0x9b, 0x88, 0x10, 0x84, 0x22, 0x9d, 0x81, 0x90, 0x5c, 0xd0, 0xa1, 0x10, 0x2d, 0xb0, 0x0b, 0x89,
+ 0x94, 0x8b, 0x20, 0x81, 0xb5, 0x13, 0xaf, 0x5c, 0xf8, 0x80, 0xaa, 0x99, 0xab, 0xc9, 0x2c, 0xfa,
+ 0x80, 0xab, 0xb8, 0x0b, 0xda, 0x0c, 0xb9, 0x39, 0x21, 0x67, 0x41, 0x35, 0x73, 0x33, 0x34, 0x42,
+ 0x22, 0x12, 0x00, 0xb8, 0xaa, 0xac, 0x9a, 0x1a, 0x31, 0x45, 0x24, 0x00, 0xca, 0xfb, 0xcc, 0xdb,
+ 0xc2, 0xfd, 0x3a, 0x00, 0xaa, 0xaa, 0x89, 0x00, 0x21, 0x14, 0x22, 0x80, 0xba, 0xbd, 0xdb, 0xba,
+ 0x98, 0x31, 0x64, 0x43, 0x24, 0x33, 0x23, 0x21, 0x00, 0x08, 0xaa, 0x98, 0x99, 0x91, 0x70, 0x11,
+ 0x23, 0x10, 0x23, 0x04, 0xa8, 0xeb, 0xbe, 0xcc, 0xda, 0xba, 0xab, 0x9b, 0xaa, 0x20, 0x12, 0x15,
+ 0x28, 0xb8, 0xc9, 0xcf, 0xba, 0xba, 0x89, 0x09, 0x42, 0x54, 0x33, 0x43, 0x21, 0x21, 0x00, 0x10,
+ 0x89, 0x12, 0x73, 0x25, 0x53, 0x32, 0x33, 0x33, 0x12, 0x11, 0xc1, 0xb9, 0xae, 0xba, 0x8a, 0x9b,
+ 0xa9, 0x9b, 0xf9, 0x9b, 0xeb, 0xca, 0xbd, 0xbb, 0xca, 0xaa, 0x9a, 0x90, 0x89, 0xaa, 0xa9, 0xf8,
+ 0xbc, 0xcb, 0x8a, 0x9b, 0xb1, 0x32, 0x10, 0x26, 0x11, 0x69, 0x84, 0x20, 0x32, 0x54, 0x43, 0x36,
+ 0x44, 0x43, 0x32, 0x24, 0x32, 0x12, 0x01, 0x08, 0x88, 0x00, 0x31, 0x42, 0x25, 0x21, 0xa1, 0xeb,
+ 0xce, 0xdb, 0xcb, 0xbb, 0xab, 0xaa, 0x99, 0x88, 0x90, 0x09, 0xdb, 0xeb, 0xbb, 0xcb, 0x9b, 0x8a,
+ 0x22, 0x34, 0x45, 0x24, 0x22, 0x12, 0x11, 0x01, 0x11, 0x61, 0x32, 0x45, 0x32, 0x33, 0x33, 0x12,
+ 0x01, 0x00, 0x9c, 0xa8, 0x18, 0xba, 0x90, 0xb1, 0xba, 0xff, 0xbc, 0xcb, 0xea, 0xaa, 0xab, 0x9b,
+ 0x9a, 0xa0, 0x90, 0xa9, 0x9e, 0xdb, 0xab, 0xbc, 0xcb, 0x89, 0x29, 0x22, 0x37, 0x33, 0x34, 0x32,
+ 0x10, 0x11, 0x21, 0x73, 0x33, 0x45, 0x43, 0x24, 0x23, 0x23, 0x01, 0x99, 0xb8, 0x89, 0x0a, 0x89,
+ 0x33, 0x53, 0x83, 0xa0, 0xbe, 0xcf, 0xbb, 0xbe, 0xca, 0xa9, 0x9a, 0x9a, 0x88, 0x8a, 0xc8, 0xda,
+ 0xad, 0xbb, 0xcb, 0x9b, 0xa9, 0x30, 0x20, 0x37, 0x22, 0x02, 0x30, 0x9a, 0xb9, 0x98, 0x50, 0x44,
+ 0x55, 0x33, 0x25, 0x32, 0x11, 0x81, 0x90, 0x18, 0x28, 0x36, 0x25, 0x53, 0x22, 0x21, 0x81, 0x08,
+ 0x9b, 0x10, 0x26, 0x00, 0x8d, 0xa8, 0x00, 0x48, 0x02, 0x01, 0xb9, 0xfc, 0xab, 0xae, 0xa9, 0x9b,
+ 0xa8, 0x88, 0xb8, 0x9a, 0xbd, 0xcd, 0xba, 0xba, 0xab, 0x29, 0x21, 0x16, 0x39, 0x93, 0x30, 0x1a,
+ 0x15, 0x32, 0x76, 0x32, 0x23, 0x42, 0x02, 0x12, 0x23, 0x51, 0x21, 0x24, 0x22, 0x85, 0x01, 0xaa,
+ 0x99, 0x8e, 0xaa, 0x90, 0x8a, 0x88, 0xe9, 0xfb, 0x9a, 0xbc, 0xba, 0xac, 0xca, 0x09, 0x99, 0xaa,
+ 0xeb, 0xa9, 0xb9, 0x99, 0x9c, 0x20, 0x30, 0x04, 0x13, 0x08, 0xb8, 0xea, 0x19, 0x22, 0x72, 0x44,
+ 0x43, 0x13, 0x24, 0x11, 0x01, 0x30, 0x80, 0x08, 0x13, 0x27, 0x10, 0x00, 0x01, 0xad, 0xa9, 0xf9,
+ 0xba, 0xaa, 0x9e, 0xb8, 0x09, 0xae, 0xaa, 0xca, 0xbb, 0xdc, 0x9a, 0x9a, 0x0b, 0x89, 0xd0, 0x8b,
+ 0xdb, 0xb9, 0xbc, 0xba, 0x9b, 0x0c, 0x14, 0xaa, 0x01, 0x9d, 0xd8, 0x99, 0x12, 0x71, 0x35, 0x45,
+ 0x33, 0x45, 0x33, 0x43, 0x32, 0x43, 0x33, 0x45, 0x22, 0x22, 0x32, 0x13, 0x18, 0x00, 0x90, 0x99,
+ 0x8d, 0xd8, 0xcb, 0xbb, 0xbe, 0xcd, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xac, 0xca, 0xb9, 0xbc, 0xcb,
+ 0xab, 0xbb, 0x9a, 0x80, 0x01, 0x31, 0x35, 0x33, 0x37, 0x43, 0x43, 0x51, 0x13, 0x53, 0x22, 0x34,
+ 0x33, 0x43, 0x12, 0x12, 0x31, 0x43, 0x32, 0x35, 0x32, 0x13, 0x08, 0xea, 0xc9, 0xba, 0xac, 0x8a,
+ 0x11, 0x90, 0xcc, 0xcd, 0xcc, 0xbb, 0xbc, 0xab, 0x99, 0x89, 0xaa, 0xba, 0xdc, 0xbc, 0xbc, 0xaa,
+ 0x08, 0x21, 0x51, 0x32, 0x33, 0x33, 0x81, 0x22, 0x41, 0x55, 0x35, 0x34, 0x24, 0x33, 0x11, 0x23,
+ 0x13, 0x33, 0x32, 0x25, 0x32, 0x34, 0x91, 0xa9, 0xbe, 0xbb, 0xbc, 0xca, 0xaa, 0xbc, 0xca, 0xdc,
+ 0xcb, 0xac, 0xac, 0xbb, 0xab, 0xa9, 0xaa, 0xca, 0xbb, 0xba, 0x9d, 0xb9, 0x9b, 0xa8, 0x40, 0x12,
+ 0xc6, 0xe0, 0x21, 0x00, 0x72, 0x31, 0x42, 0x14, 0x43, 0x24, 0x42, 0x43, 0x41, 0x14, 0x43, 0x24,
+ 0x43, 0x22, 0x43, 0x14, 0x32, 0x12, 0x53, 0x22, 0x32, 0x13, 0x30, 0x80, 0x01, 0xa0, 0xac, 0xeb,
+ 0xac, 0xcb, 0xbc, 0xdb, 0xcc, 0xaa, 0xac, 0xca, 0xab, 0xba, 0xbb, 0xbc, 0xdb, 0x9a, 0xbb, 0xba,
+ 0x9b, 0xa9, 0x21, 0x11, 0x14, 0x33, 0x43, 0x12, 0x63, 0x44, 0x33, 0x45, 0x24, 0x24, 0x32, 0x31,
+ 0x42, 0x22, 0x32, 0x33, 0x35, 0x42, 0x12, 0x31, 0x23, 0x23, 0x08, 0xb8, 0x80, 0xaf, 0xdb, 0xbb,
+ 0xeb, 0x9a, 0xbc, 0xca, 0xbb, 0xad, 0xdb, 0xb9, 0xbb, 0xca, 0xac, 0xba, 0xac, 0xa9, 0x9b, 0xb9,
+ 0x9b, 0xca, 0x29, 0x08, 0x02, 0x63, 0x44, 0x31, 0x27, 0x21, 0x33, 0x41, 0x43, 0x23, 0x53, 0x22,
+ 0x33, 0x33, 0x25, 0x43, 0x12, 0x08, 0x13, 0x2a, 0x82, 0xb8, 0xcc, 0xcb, 0xeb, 0xa8, 0xca, 0xbc,
+ 0xdb, 0xac, 0xc9, 0xbb, 0xbc, 0xac, 0x9a, 0x98, 0xab, 0xcb, 0xab, 0xb9, 0x9c, 0x0a, 0x80, 0x00,
+ 0xd9, 0x28, 0x2b, 0x35, 0x53, 0x33, 0x55, 0x24, 0x22, 0x33, 0x73, 0x43, 0x32, 0x27, 0x22, 0x13,
+ 0x10, 0x52, 0x22, 0x44, 0x22, 0x52, 0x01, 0x21, 0x80, 0x08, 0xa8, 0x08, 0xb0, 0x0a, 0xf0, 0x9c,
+ 0xdb, 0xac, 0xba, 0xad, 0xbb, 0xac, 0xca, 0xaa, 0xcb, 0x99, 0xcb, 0xab, 0xcb, 0x98, 0xca, 0x09,
+ 0x01, 0x11, 0x89, 0x00, 0x84, 0x28, 0x19, 0x57, 0x52, 0x23, 0x32, 0x32, 0x21, 0x12, 0x53, 0x15,
+ 0x52, 0x32, 0x23, 0x31, 0x22, 0x03, 0xa1, 0x30, 0x32, 0xb2, 0x1a, 0x78, 0xb0, 0xf9, 0x8e, 0x99,
+ 0xba, 0xcb, 0xac, 0xb9, 0xae, 0xba, 0xba, 0xbc, 0xac, 0xab, 0xba, 0xca, 0xab, 0x89, 0xcb, 0xb8,
+ 0x9d, 0xb0, 0x1a, 0x34, 0x53, 0x52, 0x43, 0x14, 0x28, 0x12, 0x53, 0x33, 0x22, 0x24, 0x35, 0x32,
+ 0xa2, 0x02, 0x25, 0x00, 0x23, 0x33, 0x24, 0x11, 0x22, 0xc9, 0x10, 0x00, 0x24, 0xe9, 0xab, 0xce,
+ 0xaa, 0xab, 0x9b, 0xcc, 0xab, 0xb9, 0x99, 0xdd, 0xdb, 0xac, 0x8b, 0x00, 0x89, 0xb1, 0x9a, 0x99,
+ 0xa9, 0x82, 0x4c, 0x06, 0x21, 0x03, 0x30, 0x94, 0x00, 0x1a, 0x31, 0x77, 0x32, 0x24, 0x25, 0x53,
+ 0x32, 0x11, 0x90, 0x08, 0x11, 0x54, 0x34, 0x52, 0x13, 0x23, 0x80, 0x98, 0x9a, 0xa0, 0x09, 0x10,
+ 0x35, 0x10, 0xbf, 0xcc, 0x9a, 0xb9, 0xca, 0xa9, 0x8a, 0x8c, 0xca, 0xba, 0xbc, 0xda, 0x99, 0xba,
+ 0x19, 0x8a, 0x1a, 0xd1, 0x08, 0x83, 0x32, 0xc9, 0x39, 0x9c, 0x06, 0x2a, 0x83, 0xa3, 0x38, 0x19,
+ 0x03, 0x73, 0x00, 0x87, 0x58, 0x82, 0xa9, 0x9c, 0xa0, 0x11, 0x09, 0xa3, 0x71, 0x24, 0x0a, 0xf0,
+ 0x8d, 0xa8, 0x88, 0x89, 0x18, 0xba, 0xc0, 0xe9, 0x9e, 0x98, 0x99, 0x99, 0xca, 0x8a, 0x88, 0xab,
+ 0xd9, 0x89, 0x48, 0xa8, 0xb9, 0x98, 0x44, 0x23, 0x70, 0x80, 0x23, 0x20, 0x53, 0x28, 0x16, 0x24,
+ 0x38, 0x12, 0xd9, 0x08, 0x44, 0x02, 0x30, 0x24, 0xbb, 0x40, 0xb2, 0x1a, 0x02, 0x9c, 0x2b, 0xf0,
+ 0x2a, 0xb3, 0x48, 0x93, 0xaf, 0x90, 0x99, 0x35, 0x88, 0x32, 0x22, 0x8f, 0x90, 0x19, 0x16, 0x3a,
+ 0x17, 0x3b, 0x98, 0x89, 0x11, 0xa2, 0x38, 0x55, 0x80, 0x93, 0x9e, 0x88, 0x88, 0x8a, 0x02, 0x9a,
+ 0x0b, 0xe0, 0xa1, 0xcc, 0x9a, 0x1b, 0xd9, 0x93, 0x8d, 0x38, 0x27, 0x13, 0x15, 0x18, 0x33, 0x24,
+ 0xa0, 0xed, 0xbb, 0x19, 0x33, 0x54, 0x11, 0xa0, 0xb1, 0x0e, 0x9c, 0x90, 0x11, 0x51, 0x90, 0xb2,
+ 0x1a, 0x80, 0x37, 0x18, 0x96, 0x19, 0x98, 0x62, 0x98, 0x03, 0x1b, 0xc1, 0x39, 0xb8, 0x12, 0xaa,
+ 0x00, 0xa8, 0x8d, 0xc8, 0x9a, 0x0b, 0xf9, 0x19, 0xc8, 0x9c, 0xc2, 0x89, 0x19, 0xca, 0x99, 0x8b,
+ 0xf9, 0xfe, 0x1d, 0x00, 0x1d, 0xb1, 0x0c, 0xea, 0xb0, 0x0b, 0x9c, 0x99, 0x83, 0x59, 0xd9, 0x10,
+ 0x0b, 0x02, 0x48, 0x95, 0x4a, 0xa0, 0x85, 0x2a, 0x38, 0x14, 0x23, 0x11, 0x33, 0x82, 0x78, 0x9a,
+ 0x06, 0x13, 0x9a, 0xa0, 0x31, 0x60, 0x81, 0x01, 0x9e, 0x9a, 0x90, 0x24, 0xa9, 0x9d, 0xa8, 0xb8,
+ 0x8c, 0x83, 0x9c, 0xb8, 0x8c, 0xac, 0x0b, 0x8e, 0x95, 0x11, 0x31, 0x9b, 0x1c, 0x91, 0x20, 0x81,
+ 0x42, 0x53, 0x60, 0x15, 0x12, 0x22, 0x02, 0x18, 0x81, 0x0b, 0x60, 0x04, 0x12, 0x36, 0xa9, 0xc9,
+ 0x09, 0x08, 0x2a, 0x9e, 0xc1, 0x98, 0xa1, 0xba, 0x1f, 0xcb, 0xa8, 0x98, 0xa2, 0x09, 0xad, 0x10,
+ 0x00, 0xad, 0x98, 0xb0, 0x20, 0x07, 0x10, 0x73, 0x10, 0x41, 0x03, 0x82, 0x14, 0x18, 0x60, 0x81,
+ 0x27, 0x11, 0x00, 0x22, 0x89, 0x10, 0x05, 0x32, 0x28, 0x52, 0xc3, 0x30, 0xa8, 0x19, 0x3a, 0xf9,
+ 0x81, 0x0a, 0xfc, 0x18, 0xaa, 0x00, 0x8e, 0xda, 0xa8, 0x0c, 0xb9, 0x8a, 0xb9, 0xab, 0x9b, 0xbe,
+ 0x10, 0x88, 0xfa, 0x29, 0x99, 0xc8, 0x8c, 0x21, 0x08, 0x34, 0xd0, 0x9b, 0xc8, 0x72, 0x42, 0x00,
+ 0x88, 0xb0, 0x51, 0x32, 0x22, 0x06, 0x88, 0x80, 0x28, 0x28, 0x16, 0x08, 0x83, 0x81, 0x28, 0x89,
+ 0xa9, 0x32, 0xea, 0x22, 0xd9, 0x8f, 0x08, 0xa0, 0x00, 0xb0, 0x8d, 0xac, 0x9c, 0x01, 0xad, 0x00,
+ 0xd8, 0x09, 0xb0, 0x1c, 0x00, 0x05, 0x2a, 0xab, 0x3e, 0x85, 0x01, 0x20, 0x81, 0x20, 0x05, 0x08,
+ 0x00, 0x78, 0x10, 0x97, 0x20, 0x00, 0x88, 0x92, 0x32, 0x89, 0x9a, 0xda, 0x15, 0x01, 0x1a, 0xfb,
+ 0xa8, 0x58, 0x9b, 0x18, 0xe0, 0x90, 0x99, 0x9b, 0x3b, 0x19, 0xd9, 0x94, 0xb8, 0x10, 0x8f, 0x00,
+ 0x58, 0x92, 0x12, 0xb9, 0x01, 0x3a, 0x17, 0x39, 0x10, 0xa4, 0x48, 0xb0, 0x17, 0x3a, 0x03, 0x99,
+ 0x8e, 0x01, 0x18, 0x00, 0x07, 0x10, 0x00, 0x28, 0x21, 0x01, 0x8d, 0xa3, 0xb9, 0x60, 0x18, 0x03,
+ 0x09, 0xaf, 0xc2, 0x3a, 0x1b, 0xd1, 0xb1, 0xea, 0x0c, 0x8a, 0x82, 0x9c, 0xa8, 0x90, 0xcd, 0x1a,
+ 0x90, 0x80, 0xa1, 0x1a, 0x8a, 0xad, 0xdc, 0x30, 0x23, 0x31, 0xb9, 0xe3, 0x4a, 0x11, 0x73, 0x00,
+ 0x12, 0x90, 0x26, 0x19, 0x40, 0xd1, 0x21, 0x9a, 0x91, 0x50, 0x10, 0x10, 0x95, 0x08, 0xd9, 0x29,
+ 0x11, 0xb0, 0x2c, 0xb3, 0xbe, 0xb1, 0x8e, 0x18, 0xbb, 0xb9, 0x04, 0x9c, 0x91, 0xa9, 0x2e, 0xd4,
+ 0x08, 0x99, 0x08, 0x0a, 0x02, 0x11, 0x65, 0xa8, 0x85, 0x1a, 0x08, 0x30, 0x80, 0x1d, 0x84, 0x86,
+ 0x80, 0x08, 0x10, 0x8a, 0x83, 0x44, 0x89, 0xa0, 0x1d, 0x00, 0x82, 0x07, 0x39, 0xc1, 0xa1, 0x0e,
+ 0x18, 0x9b, 0x02, 0x88, 0x91, 0x23, 0x61, 0x1c, 0x98, 0xb3, 0x43, 0xa1, 0x11, 0x50, 0xbf, 0x13,
+ 0x83, 0x18, 0x8a, 0xcb, 0x44, 0xa0, 0x29, 0x72, 0xa0, 0xb8, 0x1d, 0x02, 0x08, 0xda, 0x23, 0x29,
+ 0xaf, 0x94, 0x1b, 0x31, 0xe0, 0x18, 0x8a, 0x83, 0x20, 0x81, 0x01, 0x8c, 0xc3, 0x1a, 0xb9, 0x79,
+ 0x81, 0x07, 0x90, 0xa0, 0x9b, 0xb9, 0x4a, 0xc2, 0x60, 0x9b, 0xd0, 0xd9, 0x12, 0x38, 0x08, 0xb1,
+ 0x39, 0xad, 0xa9, 0x12, 0xc0, 0x70, 0x00, 0xa5, 0x19, 0x88, 0x3a, 0xf8, 0x22, 0x80, 0x89, 0x29,
+ 0xa5, 0x91, 0x0c, 0x0a, 0x08, 0xc1, 0x88, 0x0b, 0xa3, 0x71, 0xb1, 0x40, 0x99, 0x98, 0xf2, 0x72,
+ 0x88, 0x89, 0x2c, 0x83, 0x80, 0x29, 0x87, 0x89, 0x01, 0x90, 0x39, 0x2f, 0x80, 0x84, 0xc0, 0x32,
+ 0x22, 0x0b, 0xc8, 0x1a, 0x73, 0x90, 0xa9, 0xa2, 0x3b, 0x83, 0xdf, 0x00, 0x80, 0x98, 0x2d, 0x95,
+ 0x00, 0x88, 0x20, 0x9a, 0x90, 0x59, 0x84, 0x21, 0xfb, 0x39, 0x83, 0x00, 0xa8, 0xb9, 0x39, 0x9f,
+ 0x38, 0x00, 0x17, 0x00, 0x19, 0x88, 0x52, 0xca, 0x91, 0x95, 0x18, 0x38, 0x29, 0xdd, 0x81, 0x40,
+ 0x91, 0x88, 0x83, 0x0f, 0xb1, 0x18, 0x40, 0x88, 0xa4, 0x92, 0x9b, 0x8f, 0x13, 0xc0, 0x20, 0xbd,
+ 0x30, 0x49, 0xd2, 0x19, 0x81, 0x51, 0x9b, 0x81, 0x31, 0x89, 0xf8, 0xc3, 0x48, 0x80, 0x1b, 0x01,
+ 0x08, 0x2b, 0x89, 0x47, 0x01, 0x39, 0xb1, 0x28, 0x81, 0x0c, 0x02, 0x75, 0xa8, 0x93, 0x98, 0x9d,
+ 0x8a, 0xb0, 0x7b, 0xa3, 0x0d, 0x80, 0xe1, 0x00, 0x22, 0x0e, 0xa8, 0xaa, 0xc8, 0x12, 0x28, 0xaa,
+ 0x0a, 0xb1, 0x1b, 0x51, 0x94, 0x32, 0xcb, 0x08, 0x16, 0x2c, 0xb1, 0xc1, 0x12, 0x3d, 0x8b, 0x92,
+ 0x15, 0x96, 0x2b, 0xb8, 0x61, 0x0a, 0x00, 0x09, 0x84, 0x30, 0x14, 0x81, 0x1b, 0x78, 0xac, 0x94,
+ 0x92, 0x18, 0x61, 0x08, 0x88, 0x0b, 0x91, 0xac, 0xd5, 0x20, 0x29, 0xaa, 0x0a, 0x97, 0x80, 0x38,
+ 0xc2, 0x08, 0x31, 0x8b, 0xd0, 0x33, 0xcc, 0xa1, 0x34, 0x1f, 0x02, 0x91, 0x89, 0x85, 0x8b, 0x52,
+ 0x00, 0x10, 0x13, 0x29, 0x11, 0x25, 0xad, 0x15, 0x0b, 0x93, 0x18, 0xb9, 0x24, 0xac, 0x39, 0x08,
+ 0xc0, 0x90, 0x28, 0x93, 0x3f, 0xa0, 0xcb, 0xf8, 0x3b, 0x80, 0x03, 0xc2, 0x0e, 0x1b, 0x19, 0xe1,
+ 0x88, 0x21, 0xcc, 0x90, 0xab, 0x4c, 0xa0, 0xb0, 0xc0, 0x30, 0x28, 0xc1, 0x1d, 0x49, 0xe1, 0xa0,
+ 0x83, 0x79, 0x08, 0xa2, 0x22, 0x39, 0x00, 0x8a, 0x05, 0x1a, 0xb0, 0x25, 0x5b, 0xe0, 0x80, 0x01,
+ 0x5a, 0x88, 0x81, 0xa3, 0x93, 0x1f, 0x88, 0x91, 0xa1, 0x0a, 0x9c, 0x1d, 0xb4, 0x80, 0x99, 0x9d,
+ 0x31, 0x8c, 0x86, 0xc8, 0x08, 0x18, 0xa2, 0x2d, 0xa0, 0x26, 0xc9, 0x03, 0x0a, 0x1a, 0x92, 0x4a,
+ 0x18, 0x07, 0xa8, 0x50, 0x99, 0x03, 0x89, 0x90, 0xd3, 0x5a, 0x31, 0xaa, 0x94, 0x31, 0x73, 0xc0,
+ 0x30, 0x01, 0x1e, 0x00, 0x91, 0xa9, 0x10, 0xb9, 0x10, 0xf8, 0x0a, 0x8b, 0x84, 0x1a, 0xc8, 0x00,
+ 0xae, 0x08, 0x43, 0xb9, 0x2b, 0xba, 0x86, 0x9a, 0x22, 0x59, 0xa0, 0x8d, 0x12, 0x19, 0xb8, 0x0c,
+ 0x33, 0x07, 0x3c, 0x84, 0x13, 0x3a, 0x18, 0x80, 0x86, 0x0b, 0x05, 0x80, 0x49, 0x13, 0x35, 0x9b,
+ 0x85, 0x19, 0xb4, 0x8c, 0x41, 0x98, 0x03, 0x9b, 0x81, 0xcf, 0x11, 0x80, 0x9a, 0xc3, 0x38, 0x89,
+ 0x2b, 0xc3, 0x93, 0x7a, 0xc8, 0x83, 0x1b, 0x8a, 0x6b, 0x06, 0x73, 0x77, 0x07, 0xb8, 0xcc, 0x9c,
+ 0x18, 0x24, 0x13, 0x90, 0xbb, 0x9b, 0x28, 0x34, 0x03, 0xa8, 0xbb, 0x9d, 0x32, 0x45, 0x02, 0xa0,
+ 0xcb, 0x9a, 0x31, 0x34, 0x83, 0xaa, 0xbc, 0x0a, 0x20, 0x30, 0x77, 0x32, 0x13, 0xfa, 0xbd, 0xab,
+ 0x09, 0x42, 0x12, 0xa0, 0xaa, 0x99, 0x42, 0x34, 0x00, 0xa8, 0xaa, 0x30, 0x53, 0x34, 0x82, 0xa8,
+ 0x8f, 0x20, 0x31, 0x63, 0x85, 0x8b, 0xd0, 0xbc, 0x18, 0xa8, 0x10, 0x42, 0x31, 0x14, 0xc9, 0xac,
+ 0x9a, 0x28, 0x42, 0xf1, 0x1a, 0x11, 0x38, 0x27, 0x88, 0xaa, 0x09, 0x98, 0x41, 0x95, 0x0c, 0x31,
+ 0xf9, 0x30, 0xe9, 0x89, 0x11, 0x09, 0x22, 0xc9, 0x88, 0x09, 0x26, 0x12, 0xb8, 0xcb, 0x9c, 0x30,
+ 0x35, 0x02, 0x99, 0xb9, 0x8a, 0x70, 0x32, 0xb3, 0xaa, 0xdb, 0x99, 0x2d, 0x05, 0x11, 0x09, 0x98,
+ 0xbb, 0x71, 0x02, 0x8a, 0xa1, 0xad, 0x01, 0x10, 0x99, 0x90, 0x48, 0xfa, 0x30, 0xa0, 0xad, 0x32,
+ 0xc9, 0x73, 0xa8, 0xbc, 0x33, 0x19, 0x35, 0xa0, 0x30, 0xca, 0xa9, 0x10, 0x80, 0x71, 0xc3, 0x8a,
+ 0x10, 0x20, 0x14, 0xb8, 0x0d, 0x90, 0x19, 0x91, 0xa9, 0xb1, 0x70, 0x35, 0xda, 0x89, 0xe0, 0x0a,
+ 0x33, 0x98, 0x91, 0x12, 0x2a, 0x27, 0x99, 0xb0, 0x3b, 0xf2, 0x1b, 0x89, 0xa1, 0x1a, 0x18, 0xf8,
+ 0x79, 0xf4, 0x2f, 0x00, 0x71, 0x23, 0xa9, 0x02, 0xaa, 0x8b, 0x01, 0xdc, 0x42, 0x30, 0x25, 0x92,
+ 0x19, 0x82, 0xaf, 0x92, 0x9c, 0x31, 0x85, 0x9b, 0x08, 0x88, 0x00, 0x41, 0x51, 0x03, 0x04, 0x8c,
+ 0xb9, 0xfb, 0x2a, 0x22, 0x49, 0x14, 0x9d, 0xa9, 0x99, 0xab, 0x34, 0x10, 0x48, 0x94, 0x1a, 0x85,
+ 0x9f, 0x02, 0x81, 0x18, 0x02, 0xac, 0xac, 0x21, 0x10, 0x24, 0x14, 0x9f, 0x12, 0xaa, 0x10, 0x02,
+ 0xa9, 0x46, 0x01, 0xaa, 0xba, 0xaa, 0x45, 0x01, 0x8a, 0xa1, 0xbd, 0x28, 0x21, 0x27, 0x28, 0x81,
+ 0xfc, 0x08, 0x98, 0x89, 0x12, 0xc1, 0x38, 0x88, 0xad, 0x00, 0x52, 0x23, 0x82, 0xa2, 0xad, 0xae,
+ 0x01, 0x8a, 0x40, 0x13, 0x15, 0xaa, 0x98, 0xbc, 0x1b, 0x02, 0x60, 0x23, 0x24, 0xa8, 0xda, 0xaa,
+ 0x1a, 0x73, 0x82, 0x00, 0x81, 0xba, 0xac, 0x19, 0x92, 0x38, 0xb1, 0xce, 0x0a, 0x11, 0x9a, 0x85,
+ 0xab, 0x63, 0x32, 0x70, 0xd3, 0x9b, 0x01, 0x8d, 0x82, 0x89, 0x02, 0x30, 0x53, 0x11, 0xc0, 0xbb,
+ 0xa0, 0x3f, 0xa3, 0x08, 0x40, 0x8a, 0xb0, 0x15, 0x9a, 0x58, 0xc2, 0x3b, 0xc9, 0x59, 0xa1, 0x80,
+ 0xa2, 0x20, 0xda, 0x8c, 0x50, 0x14, 0x09, 0x80, 0x88, 0xcc, 0x98, 0x99, 0x71, 0x22, 0x91, 0x2b,
+ 0x11, 0x22, 0x94, 0xdc, 0xac, 0x9a, 0x30, 0x74, 0x13, 0x22, 0xa0, 0xcb, 0xaf, 0x98, 0x1a, 0x42,
+ 0x14, 0x11, 0x80, 0xca, 0xbc, 0x80, 0x1b, 0x35, 0x80, 0x92, 0x98, 0x9d, 0xa1, 0x8a, 0x51, 0x03,
+ 0x68, 0x82, 0x9c, 0xa0, 0xa8, 0x30, 0x88, 0x98, 0x67, 0x10, 0x11, 0xc9, 0xaa, 0x0b, 0xfa, 0x30,
+ 0x01, 0x12, 0x21, 0xb9, 0xae, 0x10, 0x88, 0x00, 0xdb, 0x45, 0x30, 0x04, 0xaa, 0xca, 0x8a, 0x08,
+ 0x03, 0x20, 0x10, 0xeb, 0xca, 0xbc, 0x10, 0x2b, 0x17, 0x18, 0x02, 0xa1, 0x30, 0xda, 0xab, 0x90,
+ 0x8b, 0xfb, 0x27, 0x00, 0x11, 0x27, 0x12, 0x54, 0x00, 0xb0, 0xac, 0xac, 0x40, 0x23, 0x20, 0x05,
+ 0x88, 0x99, 0xbd, 0xbb, 0x90, 0x18, 0x53, 0x31, 0x83, 0xba, 0xeb, 0xbf, 0x88, 0x0c, 0x22, 0x00,
+ 0xb3, 0x26, 0x19, 0x19, 0xa9, 0xe1, 0x10, 0x09, 0x09, 0x41, 0x85, 0x11, 0x5b, 0x81, 0x90, 0x84,
+ 0x1b, 0xcc, 0x19, 0xa3, 0x72, 0x03, 0x18, 0xa1, 0xba, 0xb8, 0xeb, 0x2c, 0x90, 0x02, 0x10, 0x82,
+ 0x9c, 0x0f, 0xb1, 0x89, 0x32, 0x0b, 0x8d, 0xb0, 0xa0, 0x61, 0x17, 0x8b, 0x33, 0x81, 0xaa, 0xda,
+ 0x8c, 0x33, 0x81, 0x46, 0x01, 0x72, 0xa8, 0x81, 0x0b, 0xa0, 0x09, 0xc0, 0x88, 0x09, 0x15, 0x1a,
+ 0xb8, 0xfa, 0x1a, 0xab, 0x09, 0xbb, 0x11, 0x37, 0x34, 0x22, 0x01, 0x80, 0xa8, 0xbf, 0x18, 0x62,
+ 0x21, 0x34, 0x12, 0xb8, 0x9f, 0xca, 0x8b, 0xda, 0x20, 0x00, 0x20, 0xa3, 0x88, 0xf1, 0x1a, 0x1f,
+ 0xab, 0xb7, 0x14, 0x7b, 0x89, 0x92, 0x18, 0x29, 0xa8, 0x11, 0x1a, 0x80, 0x93, 0x10, 0x30, 0x9d,
+ 0xa2, 0xcd, 0x18, 0x89, 0x80, 0x03, 0x42, 0x30, 0xcb, 0xe9, 0x9a, 0x19, 0x11, 0x53, 0x80, 0x00,
+ 0x11, 0xba, 0xb2, 0xbf, 0x89, 0x41, 0xb9, 0x44, 0x08, 0xb8, 0x31, 0x8a, 0x43, 0x00, 0x29, 0xfb,
+ 0xc1, 0xbb, 0x0f, 0x0c, 0x87, 0x22, 0x22, 0x08, 0x91, 0x0f, 0xbb, 0xb1, 0x3a, 0x90, 0x17, 0x43,
+ 0x48, 0x88, 0xa1, 0xa9, 0xbc, 0x9b, 0x91, 0x4b, 0x16, 0x10, 0x12, 0x10, 0x88, 0x8c, 0xfa, 0xd9,
+ 0x29, 0x8a, 0xb1, 0x85, 0x71, 0x18, 0x01, 0x90, 0xa9, 0xb8, 0x9c, 0x9a, 0x00, 0x72, 0x22, 0x53,
+ 0x91, 0x81, 0xa0, 0xac, 0x8c, 0x98, 0x02, 0x42, 0x21, 0x61, 0x82, 0x80, 0xec, 0x99, 0xaa, 0x8a,
+ 0x90, 0x28, 0x35, 0x22, 0x10, 0xe8, 0x8c, 0x88, 0xba, 0x08, 0xca, 0x51, 0x11, 0x36, 0x81, 0x43,
+ 0xc4, 0x04, 0x2b, 0x00, 0x89, 0xc9, 0x9c, 0x89, 0x18, 0x11, 0x45, 0x20, 0x31, 0x82, 0xea, 0xa8,
+ 0xcb, 0x8d, 0xab, 0x80, 0x29, 0x35, 0x01, 0x43, 0x92, 0x08, 0x98, 0xfb, 0x8b, 0x88, 0x13, 0x52,
+ 0x41, 0x10, 0x24, 0x88, 0xeb, 0xaa, 0xab, 0x9b, 0xc9, 0x91, 0x5b, 0x20, 0x07, 0x20, 0x82, 0x9c,
+ 0xca, 0xa8, 0x09, 0x28, 0x43, 0x15, 0x73, 0x12, 0x01, 0x18, 0xca, 0xbc, 0xb8, 0x8d, 0x11, 0x31,
+ 0x14, 0x22, 0x12, 0xad, 0xaa, 0xec, 0x99, 0xaa, 0x89, 0x32, 0x54, 0x02, 0x30, 0xa1, 0x09, 0xf9,
+ 0x1b, 0xba, 0x88, 0x08, 0x44, 0x44, 0x11, 0x13, 0x80, 0xd8, 0x99, 0xab, 0x9f, 0x10, 0x81, 0x62,
+ 0x33, 0x22, 0x14, 0x98, 0xdb, 0xcb, 0xac, 0xa8, 0x0a, 0x41, 0x23, 0x54, 0x02, 0x91, 0xaa, 0xdc,
+ 0x9a, 0xa9, 0x88, 0x40, 0x63, 0x33, 0x82, 0x81, 0xcc, 0xbd, 0xcb, 0x99, 0x19, 0x09, 0x26, 0x33,
+ 0x34, 0x01, 0x81, 0xaa, 0xa9, 0xac, 0x00, 0x40, 0x13, 0x65, 0x33, 0x82, 0x08, 0xca, 0xad, 0xb8,
+ 0xbb, 0xab, 0x19, 0x00, 0x71, 0x13, 0x92, 0x90, 0xcd, 0xbc, 0xdb, 0x0a, 0x81, 0x53, 0x34, 0x10,
+ 0x01, 0xc1, 0x8a, 0xa9, 0xab, 0x88, 0x4a, 0x15, 0x53, 0x23, 0x02, 0x98, 0x8c, 0xec, 0x9a, 0x98,
+ 0x99, 0x18, 0x20, 0x03, 0x57, 0x89, 0x18, 0x03, 0xab, 0x90, 0xe8, 0x09, 0x8d, 0x01, 0xa8, 0x48,
+ 0xd0, 0x80, 0x9a, 0xad, 0xb8, 0x0e, 0xb0, 0x19, 0x33, 0x33, 0x52, 0x13, 0x11, 0x82, 0xb0, 0x9f,
+ 0xa9, 0x82, 0x6a, 0x16, 0x12, 0x20, 0x21, 0x9d, 0xb1, 0xab, 0x19, 0xb1, 0x46, 0x33, 0x79, 0x23,
+ 0x11, 0x52, 0x81, 0xa1, 0x9b, 0x38, 0x81, 0x36, 0x33, 0x54, 0x14, 0x00, 0x48, 0xb0, 0xa0, 0x8a,
+ 0xc9, 0xad, 0xc9, 0x89, 0xab, 0x89, 0xc1, 0x8e, 0xb0, 0x0a, 0xf8, 0x99, 0xac, 0xaa, 0xaa, 0x89,
+ 0xfc, 0xfb, 0x22, 0x00, 0x23, 0x45, 0x35, 0x23, 0x10, 0xa9, 0xcc, 0xab, 0x98, 0x38, 0x33, 0x47,
+ 0x31, 0x01, 0xa0, 0xc9, 0xdb, 0xbc, 0xab, 0x9b, 0x80, 0x49, 0x05, 0x02, 0x08, 0x9c, 0xea, 0xb9,
+ 0xbb, 0x9a, 0xa8, 0x28, 0x28, 0x27, 0x00, 0x01, 0xcb, 0xdd, 0xac, 0xab, 0x99, 0x10, 0x52, 0x43,
+ 0x33, 0x42, 0x00, 0x90, 0xaa, 0xdc, 0xa8, 0x1c, 0x10, 0x34, 0x01, 0x22, 0xae, 0xaa, 0xcf, 0xb9,
+ 0xbb, 0x9c, 0x99, 0x0b, 0xa8, 0x82, 0x45, 0x73, 0x37, 0x35, 0x36, 0x42, 0x23, 0x12, 0x01, 0xb9,
+ 0xca, 0xcc, 0x9b, 0x8a, 0x08, 0x53, 0x33, 0x33, 0x01, 0xfa, 0xcd, 0xdb, 0xcb, 0xaa, 0x99, 0x08,
+ 0x22, 0x44, 0x33, 0x22, 0x01, 0xba, 0xbe, 0xbb, 0xac, 0x18, 0x41, 0x54, 0x24, 0x33, 0x23, 0x00,
+ 0x99, 0xdb, 0xbb, 0xac, 0x89, 0x11, 0x42, 0x25, 0x22, 0x01, 0x99, 0xbd, 0xbc, 0xbc, 0xab, 0x09,
+ 0x10, 0x42, 0x23, 0x11, 0xa1, 0xbd, 0xcc, 0xac, 0x9b, 0x88, 0x30, 0x36, 0x33, 0x34, 0x02, 0x90,
+ 0xca, 0xcc, 0xab, 0x9a, 0x28, 0x33, 0x47, 0x32, 0x43, 0x01, 0x00, 0xa9, 0xcb, 0xba, 0xaa, 0x19,
+ 0x52, 0x44, 0x33, 0x33, 0x82, 0xa9, 0xbf, 0xbe, 0xcb, 0xca, 0x9a, 0x9a, 0x18, 0x00, 0x12, 0x80,
+ 0xab, 0xe9, 0xaa, 0x29, 0x54, 0x56, 0x34, 0x35, 0x33, 0x22, 0x02, 0xa8, 0xcb, 0xbd, 0xbb, 0x9a,
+ 0x20, 0x35, 0x53, 0x14, 0x01, 0xb9, 0xce, 0xbc, 0xcc, 0x9a, 0x8a, 0x18, 0x42, 0x43, 0x33, 0x22,
+ 0x81, 0xb9, 0xcd, 0xbb, 0xab, 0x08, 0x63, 0x44, 0x43, 0x33, 0x22, 0x91, 0xb9, 0xbd, 0xad, 0xab,
+ 0x8a, 0x18, 0x31, 0x34, 0x24, 0x81, 0xc8, 0xbc, 0xbd, 0xbb, 0xab, 0x89, 0x41, 0x43, 0x34, 0x32,
+ 0x02, 0x80, 0xbb, 0xad, 0xab, 0x08, 0x41, 0x45, 0x43, 0x33, 0x12, 0x80, 0xba, 0xdd, 0xab, 0xcb,
+ 0x4b, 0xec, 0x3b, 0x00, 0x88, 0x20, 0x32, 0x24, 0x23, 0x12, 0x88, 0xcb, 0xcb, 0x9c, 0x99, 0x28,
+ 0x53, 0x45, 0x32, 0x14, 0x11, 0x98, 0xca, 0xcc, 0xbc, 0xab, 0xac, 0x99, 0x88, 0x18, 0x01, 0x30,
+ 0xa9, 0xdb, 0xdd, 0xca, 0xaa, 0x9a, 0x11, 0x74, 0x35, 0x35, 0x34, 0x32, 0x22, 0x00, 0xb9, 0xeb,
+ 0xac, 0xab, 0x89, 0x20, 0x44, 0x43, 0x32, 0x81, 0xba, 0xcf, 0xbc, 0xbc, 0xab, 0x99, 0x10, 0x53,
+ 0x53, 0x32, 0x22, 0x81, 0xb8, 0xbd, 0xac, 0xab, 0x08, 0x51, 0x63, 0x43, 0x32, 0x13, 0x81, 0xb9,
+ 0xcc, 0xac, 0xbb, 0x9a, 0x08, 0x22, 0x25, 0x33, 0x11, 0xa9, 0xcd, 0xbc, 0xbc, 0xaa, 0x09, 0x31,
+ 0x34, 0x26, 0x23, 0x12, 0x90, 0xaa, 0xbc, 0xbb, 0x8a, 0x30, 0x64, 0x43, 0x33, 0x22, 0x90, 0xdb,
+ 0xcc, 0xcb, 0xab, 0x8a, 0x08, 0x42, 0x43, 0x24, 0x13, 0x01, 0xa0, 0xbb, 0xad, 0xaa, 0x19, 0x32,
+ 0x37, 0x35, 0x23, 0x13, 0x90, 0xc9, 0xbd, 0xdb, 0xbb, 0xab, 0x99, 0x18, 0x10, 0x23, 0x12, 0x88,
+ 0xfa, 0xeb, 0xab, 0xbc, 0x8a, 0x10, 0x73, 0x44, 0x53, 0x34, 0x32, 0x13, 0x01, 0x98, 0xdb, 0xcb,
+ 0xab, 0xab, 0x00, 0x42, 0x63, 0x22, 0x02, 0xb8, 0xbe, 0xbe, 0xbc, 0xbb, 0xaa, 0x00, 0x43, 0x44,
+ 0x24, 0x22, 0x11, 0x99, 0xca, 0xbc, 0xab, 0x89, 0x31, 0x46, 0x44, 0x32, 0x13, 0x02, 0xa8, 0xeb,
+ 0xbb, 0xad, 0x9a, 0x89, 0x10, 0x32, 0x33, 0x23, 0x90, 0xbd, 0xbe, 0xbc, 0xab, 0xaa, 0x21, 0x63,
+ 0x53, 0x23, 0x23, 0x11, 0x98, 0xca, 0xcb, 0x9b, 0x89, 0x30, 0x54, 0x33, 0x25, 0x11, 0x98, 0xdb,
+ 0xbd, 0xcb, 0xab, 0x99, 0x10, 0x42, 0x35, 0x33, 0x13, 0x02, 0xa9, 0xca, 0xac, 0xaa, 0x08, 0x61,
+ 0x34, 0x44, 0x22, 0x02, 0x89, 0xeb, 0xba, 0xbd, 0xba, 0xab, 0x88, 0x11, 0x21, 0x13, 0x13, 0xbb,
+ 0x1b, 0xec, 0x2c, 0x00, 0xef, 0xba, 0xbb, 0x9b, 0x28, 0x73, 0x35, 0x35, 0x35, 0x32, 0x32, 0x01,
+ 0x98, 0xcb, 0xbc, 0xcb, 0x9a, 0x18, 0x32, 0x45, 0x23, 0x12, 0xb0, 0xce, 0xcc, 0xcb, 0xab, 0xaa,
+ 0x08, 0x33, 0x45, 0x24, 0x22, 0x01, 0xa0, 0xbb, 0xbe, 0xaa, 0x8a, 0x31, 0x45, 0x34, 0x34, 0x12,
+ 0x01, 0xb9, 0xcc, 0xcb, 0xbb, 0x9a, 0x08, 0x31, 0x43, 0x23, 0x11, 0xb9, 0xcd, 0xbd, 0xba, 0x9a,
+ 0x19, 0x43, 0x44, 0x33, 0x14, 0x11, 0x90, 0xaa, 0xad, 0x9a, 0x09, 0x41, 0x53, 0x34, 0x23, 0x02,
+ 0xa8, 0xcc, 0xbd, 0xbc, 0xab, 0x9a, 0x18, 0x32, 0x45, 0x33, 0x32, 0x81, 0xa9, 0xeb, 0xbb, 0x9b,
+ 0x89, 0x44, 0x44, 0x44, 0x32, 0x12, 0x81, 0xba, 0xcd, 0xac, 0xab, 0x9b, 0x89, 0x28, 0x33, 0x32,
+ 0x02, 0xda, 0xcd, 0xcb, 0xcb, 0xbb, 0x9a, 0x10, 0x52, 0x44, 0x34, 0x34, 0x35, 0x23, 0x33, 0x11,
+ 0x88, 0xb8, 0xbd, 0xcb, 0xaa, 0x08, 0x21, 0x55, 0x33, 0x21, 0xa0, 0xde, 0xdb, 0xcb, 0xbb, 0xaa,
+ 0x09, 0x32, 0x36, 0x34, 0x23, 0x02, 0x98, 0xdb, 0xbc, 0xbb, 0x89, 0x40, 0x73, 0x33, 0x34, 0x12,
+ 0x81, 0xaa, 0xbd, 0xbc, 0xac, 0x99, 0x10, 0x31, 0x34, 0x22, 0x80, 0xd9, 0xcc, 0xbb, 0xac, 0x89,
+ 0x10, 0x53, 0x34, 0x33, 0x23, 0x08, 0xba, 0xcd, 0xab, 0x9a, 0x08, 0x44, 0x44, 0x33, 0x13, 0x02,
+ 0xba, 0xcd, 0xbc, 0xbc, 0x9a, 0x89, 0x21, 0x43, 0x43, 0x24, 0x11, 0x98, 0xba, 0xcc, 0xaa, 0x9a,
+ 0x21, 0x45, 0x44, 0x33, 0x33, 0x02, 0xa0, 0xbd, 0xcc, 0xbb, 0xba, 0x89, 0x20, 0x52, 0x33, 0x02,
+ 0x98, 0xde, 0xbb, 0xcc, 0xab, 0x98, 0x09, 0x33, 0x34, 0x34, 0x04, 0x21, 0x02, 0x31, 0x37, 0x43,
+ 0x43, 0x13, 0x12, 0x81, 0xcc, 0xba, 0xad, 0x89, 0x00, 0x53, 0x33, 0x22, 0xb0, 0xed, 0xbc, 0xbd,
+ 0x58, 0xe3, 0x40, 0x00, 0xaa, 0x89, 0x41, 0x53, 0x43, 0x22, 0x11, 0x99, 0xcb, 0xcc, 0xba, 0x89,
+ 0x21, 0x35, 0x35, 0x33, 0x22, 0x90, 0xdb, 0xbc, 0xbc, 0xab, 0x89, 0x21, 0x34, 0x43, 0x13, 0x90,
+ 0xca, 0xbd, 0xbc, 0xaa, 0x09, 0x32, 0x45, 0x34, 0x31, 0x81, 0x90, 0xcb, 0xcb, 0xab, 0x09, 0x21,
+ 0x46, 0x33, 0x33, 0x03, 0xc8, 0xdb, 0xbd, 0xbb, 0xbb, 0x99, 0x21, 0x44, 0x34, 0x32, 0x13, 0x98,
+ 0xca, 0xbd, 0xba, 0x89, 0x30, 0x36, 0x45, 0x33, 0x14, 0x11, 0xa8, 0xcb, 0xcc, 0xbb, 0xaa, 0x09,
+ 0x31, 0x63, 0x33, 0x13, 0xa0, 0xdc, 0xcc, 0xcb, 0xba, 0x99, 0x10, 0x41, 0x24, 0x33, 0x02, 0xa0,
+ 0xba, 0xad, 0x8a, 0x73, 0x53, 0x44, 0x32, 0x22, 0x80, 0xa9, 0xbd, 0xcc, 0x99, 0x08, 0x31, 0x35,
+ 0x43, 0x02, 0xa8, 0xcc, 0xbd, 0xac, 0x9b, 0x89, 0x32, 0x54, 0x33, 0x33, 0x01, 0xba, 0xcd, 0xcb,
+ 0xab, 0x89, 0x21, 0x45, 0x33, 0x24, 0x12, 0xa8, 0xda, 0xac, 0xbb, 0x9a, 0x18, 0x32, 0x45, 0x33,
+ 0x11, 0x90, 0xeb, 0xca, 0xab, 0xaa, 0x18, 0x31, 0x36, 0x33, 0x22, 0x81, 0xba, 0xcd, 0xbb, 0x9b,
+ 0x08, 0x41, 0x35, 0x24, 0x33, 0x81, 0xb9, 0xcd, 0xac, 0xab, 0x9b, 0x08, 0x31, 0x36, 0x24, 0x32,
+ 0x01, 0xa8, 0xcb, 0xcc, 0x99, 0x08, 0x42, 0x44, 0x43, 0x34, 0x11, 0x90, 0xca, 0xcc, 0xba, 0xab,
+ 0x89, 0x30, 0x54, 0x43, 0x22, 0x81, 0xda, 0xeb, 0xbb, 0xac, 0x9b, 0x08, 0x22, 0x35, 0x33, 0x13,
+ 0xa8, 0xec, 0xbb, 0xac, 0x89, 0x41, 0x46, 0x43, 0x43, 0x12, 0x00, 0xa9, 0xbc, 0xad, 0x9a, 0x08,
+ 0x32, 0x36, 0x43, 0x13, 0x91, 0xda, 0xcc, 0xbb, 0xac, 0x89, 0x20, 0x43, 0x44, 0x22, 0x01, 0xa8,
+ 0xdb, 0xbc, 0xbb, 0x9a, 0x10, 0x44, 0x34, 0x24, 0x12, 0x81, 0xba, 0xcc, 0xbb, 0xaa, 0x18, 0x42,
+ 0x30, 0xfd, 0x3b, 0x00, 0x35, 0x23, 0x02, 0xa9, 0xcd, 0xcb, 0xac, 0x99, 0x18, 0x31, 0x34, 0x43,
+ 0x02, 0x80, 0xbb, 0xcd, 0xbb, 0xaa, 0x09, 0x42, 0x44, 0x43, 0x22, 0x12, 0x98, 0xcb, 0xcc, 0xba,
+ 0xa9, 0x08, 0x31, 0x36, 0x43, 0x23, 0x11, 0x98, 0xcc, 0xca, 0xab, 0x09, 0x30, 0x63, 0x24, 0x33,
+ 0x12, 0x98, 0xd9, 0xcc, 0xab, 0x9b, 0x29, 0x42, 0x35, 0x24, 0x22, 0x88, 0xcb, 0xdc, 0xcb, 0xba,
+ 0x98, 0x18, 0x22, 0x53, 0x12, 0x08, 0xdb, 0xcc, 0xcb, 0xaa, 0x89, 0x51, 0x53, 0x44, 0x33, 0x23,
+ 0x01, 0xa0, 0xcb, 0xcb, 0xab, 0x08, 0x41, 0x55, 0x32, 0x33, 0x02, 0xb9, 0xdd, 0xbc, 0xbb, 0xaa,
+ 0x09, 0x42, 0x53, 0x33, 0x12, 0xa1, 0xdb, 0xbd, 0xbc, 0xaa, 0x88, 0x32, 0x54, 0x43, 0x23, 0x02,
+ 0x98, 0xcb, 0xcb, 0xab, 0x89, 0x31, 0x35, 0x45, 0x21, 0x01, 0xb8, 0xbc, 0xcd, 0xaa, 0x9a, 0x08,
+ 0x41, 0x33, 0x24, 0x13, 0xa0, 0xdb, 0xcc, 0xba, 0xaa, 0x08, 0x42, 0x44, 0x43, 0x22, 0x01, 0xa8,
+ 0xbc, 0xbc, 0xbb, 0x89, 0x20, 0x45, 0x43, 0x33, 0x12, 0x90, 0xbb, 0xce, 0xba, 0xa9, 0x00, 0x52,
+ 0x43, 0x43, 0x22, 0x80, 0xb9, 0xcc, 0xbb, 0xab, 0x09, 0x41, 0x44, 0x43, 0x23, 0x01, 0xb9, 0xbd,
+ 0xbd, 0xba, 0x9b, 0x08, 0x21, 0x33, 0x31, 0xa8, 0xed, 0xdb, 0xbc, 0xab, 0x8a, 0x18, 0x32, 0x45,
+ 0x33, 0x34, 0x14, 0x22, 0x12, 0x12, 0x11, 0x11, 0x42, 0x24, 0x61, 0x33, 0x43, 0x24, 0x12, 0x80,
+ 0xbc, 0xcd, 0xbc, 0xac, 0xaa, 0x0a, 0x10, 0x22, 0x22, 0x82, 0xeb, 0xcd, 0xac, 0xbb, 0x9a, 0x20,
+ 0x54, 0x53, 0x23, 0x23, 0x80, 0xa9, 0xeb, 0x9a, 0x8a, 0x21, 0x45, 0x34, 0x33, 0x03, 0xa9, 0xce,
+ 0xcb, 0xbb, 0xab, 0x18, 0x30, 0x26, 0x33, 0x02, 0xc0, 0xdb, 0xbc, 0xac, 0x8a, 0x08, 0x52, 0x33,
+ 0xcd, 0xf8, 0x38, 0x00, 0x24, 0x01, 0xa8, 0xbc, 0xbc, 0x9b, 0x09, 0x43, 0x35, 0x35, 0x22, 0x01,
+ 0xa8, 0xac, 0xbc, 0xab, 0x89, 0x21, 0x45, 0x33, 0x24, 0x81, 0xa8, 0xcb, 0xbc, 0xbb, 0x8a, 0x31,
+ 0x34, 0x45, 0x22, 0x02, 0xa1, 0xcb, 0xda, 0xab, 0xab, 0x99, 0x11, 0x11, 0x01, 0x98, 0xeb, 0xbe,
+ 0xdb, 0xac, 0xaa, 0x8a, 0x89, 0x80, 0x00, 0x8a, 0x90, 0x18, 0x72, 0x63, 0x45, 0x43, 0x34, 0x23,
+ 0x21, 0x00, 0x98, 0x88, 0x00, 0x73, 0x25, 0x34, 0x22, 0x02, 0xa9, 0xdd, 0xbc, 0xcb, 0x9a, 0x89,
+ 0x10, 0x22, 0x33, 0x01, 0xb9, 0xcf, 0xbb, 0xbb, 0x9b, 0x20, 0x73, 0x34, 0x23, 0x22, 0x80, 0xa9,
+ 0xba, 0xaa, 0x31, 0x73, 0x27, 0x32, 0x82, 0x90, 0xbd, 0xcc, 0xab, 0xba, 0x08, 0x11, 0x24, 0x32,
+ 0x00, 0xeb, 0xcc, 0xdb, 0xba, 0x89, 0x28, 0x34, 0x33, 0x33, 0x00, 0xb9, 0xce, 0xca, 0x89, 0x28,
+ 0x44, 0x53, 0x43, 0x12, 0x01, 0x99, 0xcb, 0xbb, 0x9b, 0x28, 0x44, 0x44, 0x32, 0x13, 0x81, 0xcb,
+ 0xcc, 0xbb, 0x9b, 0x08, 0x43, 0x53, 0x24, 0x21, 0x80, 0xba, 0xbd, 0xbc, 0xaa, 0x89, 0x38, 0x43,
+ 0x35, 0x12, 0x90, 0xca, 0xcc, 0xcc, 0xba, 0xaa, 0xaa, 0x89, 0x81, 0x81, 0xb9, 0xbb, 0xcf, 0xba,
+ 0x8b, 0x18, 0x64, 0x63, 0x24, 0x53, 0x12, 0x12, 0x00, 0x99, 0x80, 0x18, 0x73, 0x43, 0x34, 0x22,
+ 0x01, 0xb9, 0xcc, 0xcc, 0xba, 0x9a, 0x08, 0x21, 0x34, 0x32, 0x81, 0xcc, 0xcc, 0xbc, 0xaa, 0x0a,
+ 0x20, 0x53, 0x24, 0x33, 0x01, 0xa0, 0xbb, 0xac, 0x9a, 0x11, 0x73, 0x34, 0x25, 0x21, 0x80, 0xca,
+ 0xdb, 0xab, 0xab, 0x99, 0x01, 0x38, 0x01, 0x91, 0xcd, 0xcb, 0xbc, 0xbc, 0xaa, 0x0a, 0x23, 0x31,
+ 0x14, 0x08, 0x83, 0xbb, 0x99, 0x43, 0x73, 0x26, 0x20, 0x14, 0x11, 0x00, 0x88, 0x09, 0x21, 0x31,
+ 0xd5, 0x00, 0x1f, 0x00, 0x27, 0x13, 0x80, 0xca, 0xce, 0x9a, 0x99, 0x21, 0x54, 0x33, 0x53, 0x12,
+ 0x98, 0xbb, 0xdb, 0xab, 0x9a, 0x30, 0x65, 0x33, 0x33, 0x02, 0xb8, 0xdd, 0xbb, 0xbb, 0x9c, 0x80,
+ 0x08, 0x91, 0xb9, 0xec, 0xae, 0xca, 0xbc, 0xaa, 0x9c, 0x98, 0x28, 0x21, 0x32, 0x24, 0x20, 0x03,
+ 0x61, 0x22, 0x43, 0x25, 0x34, 0x44, 0x24, 0x43, 0x22, 0x32, 0x01, 0x80, 0x88, 0x09, 0x99, 0x08,
+ 0x19, 0x98, 0xc9, 0xcc, 0xbc, 0xb9, 0xac, 0xcd, 0x9a, 0xbb, 0x9a, 0xac, 0xa9, 0xad, 0x08, 0x08,
+ 0x30, 0x34, 0x45, 0x12, 0x92, 0x08, 0x0a, 0xa0, 0x20, 0x29, 0x98, 0x17, 0x8b, 0xfa, 0xaf, 0xda,
+ 0x9b, 0xbb, 0xaa, 0x8a, 0x19, 0xb1, 0x80, 0xeb, 0x91, 0x9f, 0xb8, 0x9a, 0xa9, 0x98, 0x09, 0x01,
+ 0x47, 0x52, 0x13, 0x21, 0x01, 0x10, 0x88, 0xab, 0xc0, 0x31, 0x59, 0x24, 0x63, 0x13, 0x22, 0x19,
+ 0xc8, 0x9a, 0x89, 0x21, 0x74, 0x24, 0x34, 0x33, 0x24, 0x32, 0x03, 0x00, 0xb9, 0xaa, 0x01, 0x35,
+ 0x45, 0x33, 0x41, 0x13, 0xaa, 0xf8, 0xae, 0xba, 0xcc, 0xbc, 0xbb, 0xba, 0xcb, 0xbc, 0xaa, 0xbd,
+ 0xca, 0xbb, 0xaa, 0x09, 0x11, 0x42, 0x35, 0x45, 0x23, 0x12, 0x32, 0x53, 0x43, 0x32, 0x35, 0x34,
+ 0x24, 0x23, 0x02, 0x10, 0x09, 0x91, 0x99, 0x89, 0x02, 0x08, 0xcd, 0xeb, 0x0a, 0xda, 0xab, 0xad,
+ 0x9a, 0x99, 0x98, 0xa9, 0x9a, 0xab, 0xcb, 0x1a, 0xb8, 0x53, 0x33, 0x56, 0x32, 0x04, 0x41, 0x12,
+ 0x81, 0xa8, 0x8b, 0xea, 0xba, 0xbd, 0x89, 0xa8, 0xa8, 0xbe, 0x9b, 0xbb, 0xca, 0xad, 0xcc, 0x9a,
+ 0xaa, 0xa0, 0x08, 0x08, 0x48, 0x90, 0x9e, 0xb9, 0x0b, 0xa4, 0xaa, 0x21, 0x72, 0x33, 0x53, 0x22,
+ 0x15, 0x88, 0x9a, 0xad, 0xa9, 0x10, 0x23, 0x71, 0x43, 0x34, 0x33, 0x23, 0x08, 0x41, 0xa0, 0x11,
+ 0xed, 0x01, 0x1d, 0x00, 0x64, 0x43, 0x34, 0x23, 0x23, 0x21, 0xa8, 0x8b, 0xa0, 0x8a, 0xc1, 0xa8,
+ 0x89, 0x0f, 0xaa, 0xb9, 0xff, 0xac, 0xcd, 0xba, 0xdb, 0xab, 0xba, 0x8b, 0xb9, 0x0b, 0x98, 0x2a,
+ 0xc3, 0x0b, 0x13, 0x71, 0x25, 0x62, 0x23, 0x52, 0x13, 0x53, 0x12, 0x43, 0x23, 0x32, 0x03, 0x41,
+ 0x81, 0x21, 0x81, 0x90, 0xc8, 0xbb, 0xcc, 0xbd, 0xa9, 0x9a, 0x9a, 0xaa, 0xea, 0x8a, 0xa0, 0xba,
+ 0xdb, 0x8a, 0xb9, 0x0b, 0xaa, 0x56, 0x42, 0x23, 0x16, 0x22, 0x01, 0x22, 0xb8, 0x9c, 0xac, 0xbc,
+ 0xc8, 0x0b, 0xd8, 0x80, 0xa0, 0x9f, 0xc9, 0x8c, 0xc9, 0x8a, 0xaa, 0x00, 0x8a, 0x01, 0xc1, 0x30,
+ 0xcb, 0x21, 0xcf, 0x90, 0x09, 0x21, 0x23, 0x10, 0x04, 0x22, 0x1b, 0xf9, 0x90, 0x8a, 0xa9, 0x39,
+ 0xd9, 0x25, 0x31, 0x2a, 0xc3, 0x58, 0x90, 0x44, 0x41, 0x24, 0x43, 0x33, 0x62, 0x32, 0x12, 0x23,
+ 0x21, 0x10, 0x03, 0x73, 0x12, 0x40, 0x04, 0x91, 0x18, 0xad, 0x90, 0xfb, 0x1a, 0xea, 0xa9, 0xac,
+ 0xcb, 0xb9, 0xbc, 0xcc, 0xa9, 0xac, 0xaa, 0xaa, 0x99, 0x8b, 0x00, 0x08, 0x27, 0x41, 0x13, 0x53,
+ 0x03, 0x32, 0x24, 0x63, 0x24, 0x53, 0x23, 0x42, 0x12, 0x11, 0x10, 0x98, 0x09, 0xc8, 0x88, 0x80,
+ 0x28, 0x99, 0x98, 0x9b, 0xfc, 0xac, 0xca, 0x8b, 0xa0, 0x19, 0x81, 0x11, 0x41, 0xbb, 0x93, 0x1f,
+ 0xb0, 0x12, 0x79, 0x14, 0x24, 0x00, 0x21, 0xa9, 0xa8, 0xbe, 0xda, 0xbc, 0x98, 0x0d, 0xa9, 0x98,
+ 0x9a, 0x9c, 0xfa, 0x8a, 0xca, 0x08, 0xaa, 0x09, 0xc8, 0x00, 0xa8, 0x8a, 0xb9, 0xb8, 0x8e, 0xc3,
+ 0x59, 0x90, 0x40, 0x91, 0x82, 0x0c, 0xb1, 0x88, 0x18, 0x2e, 0x93, 0x5a, 0x92, 0x23, 0x04, 0x7b,
+ 0x81, 0x22, 0x32, 0x46, 0x32, 0x27, 0x32, 0x22, 0x11, 0x04, 0x11, 0x12, 0x63, 0x10, 0x32, 0x32,
+ 0xf9, 0x0b, 0x20, 0x00, 0x41, 0x02, 0x98, 0x9a, 0x9e, 0xb9, 0xab, 0xc9, 0x9f, 0xe9, 0xac, 0xca,
+ 0xbc, 0xdb, 0xbb, 0xbb, 0xcb, 0xb9, 0x9a, 0x99, 0x8b, 0x98, 0x98, 0x42, 0x62, 0x34, 0x53, 0x33,
+ 0x63, 0x33, 0x42, 0x24, 0x33, 0x34, 0x42, 0x22, 0x22, 0x31, 0x11, 0x88, 0xb9, 0xcb, 0x99, 0x88,
+ 0x0c, 0x00, 0xbb, 0xa1, 0xff, 0xb9, 0xba, 0xb9, 0x8c, 0x98, 0x3b, 0x14, 0x11, 0x14, 0x52, 0x14,
+ 0x30, 0x11, 0x40, 0x13, 0x24, 0x00, 0x12, 0xca, 0xcb, 0xbc, 0xbf, 0xcb, 0xba, 0xbc, 0xaa, 0xbb,
+ 0xbc, 0xcb, 0xaa, 0xeb, 0xaa, 0xab, 0xbd, 0xa0, 0x0b, 0x09, 0x22, 0x98, 0x13, 0x12, 0x29, 0x10,
+ 0xfc, 0x80, 0x4a, 0x80, 0x03, 0x63, 0x11, 0x83, 0xac, 0xba, 0x8c, 0xa0, 0x04, 0x51, 0x62, 0x22,
+ 0x41, 0x43, 0x16, 0x32, 0x32, 0x43, 0x42, 0x34, 0x43, 0x43, 0x11, 0x22, 0x33, 0x12, 0x34, 0x42,
+ 0x30, 0x14, 0x02, 0x98, 0xb0, 0xac, 0xaf, 0xfa, 0xaa, 0xbb, 0xad, 0xda, 0xac, 0xcb, 0xcb, 0xbb,
+ 0xac, 0xab, 0xba, 0xa8, 0x89, 0x09, 0x11, 0x22, 0x45, 0x31, 0x24, 0x63, 0x24, 0x34, 0x53, 0x23,
+ 0x24, 0x43, 0x21, 0x13, 0x02, 0x22, 0x81, 0x42, 0x89, 0x00, 0xb8, 0x98, 0xcb, 0xbd, 0x8a, 0xae,
+ 0x81, 0xa8, 0xa9, 0x9b, 0xb9, 0x1d, 0x80, 0x09, 0x37, 0x41, 0x31, 0x64, 0x12, 0x23, 0x00, 0x10,
+ 0x91, 0xa9, 0x8e, 0xa9, 0xc0, 0x8b, 0xbf, 0xc8, 0x9d, 0xba, 0xbc, 0xb9, 0xb9, 0xae, 0x99, 0xaa,
+ 0xcb, 0xaa, 0xaa, 0xaa, 0xab, 0xa9, 0x29, 0x39, 0x20, 0x97, 0x59, 0x89, 0x84, 0x0a, 0xa8, 0xa3,
+ 0x42, 0x39, 0x70, 0x89, 0x22, 0xae, 0xb1, 0x91, 0x09, 0x04, 0x3a, 0x62, 0x42, 0x43, 0x33, 0x27,
+ 0x22, 0x42, 0x32, 0x24, 0x34, 0x33, 0x45, 0x31, 0x22, 0x03, 0x34, 0x30, 0x42, 0x02, 0x11, 0x12,
+ 0x4b, 0x0d, 0x1b, 0x00, 0xb9, 0x8b, 0xfb, 0xad, 0xbb, 0xbc, 0xce, 0xca, 0xba, 0xbc, 0xbc, 0xbc,
+ 0xdb, 0xab, 0xbb, 0xbb, 0xaa, 0xbb, 0xa8, 0x9a, 0x21, 0x10, 0x44, 0x44, 0x42, 0x33, 0x44, 0x35,
+ 0x34, 0x34, 0x33, 0x34, 0x42, 0x23, 0x21, 0x33, 0x13, 0x04, 0x20, 0x98, 0x08, 0x8a, 0xf8, 0x80,
+ 0x89, 0x9b, 0x89, 0xa0, 0x0c, 0xd2, 0x9a, 0xbc, 0x92, 0x38, 0x1c, 0x36, 0x43, 0x45, 0x12, 0x22,
+ 0x11, 0x04, 0x88, 0x09, 0x18, 0xc8, 0xb9, 0x9c, 0xac, 0xfb, 0xaa, 0xcc, 0xca, 0x9d, 0xbb, 0x9b,
+ 0xbb, 0xbd, 0xba, 0xba, 0x9d, 0xba, 0x8d, 0xa8, 0x88, 0x90, 0x19, 0x11, 0x09, 0x82, 0x83, 0x2c,
+ 0xb0, 0x12, 0x8f, 0x4b, 0x94, 0x82, 0xa0, 0x92, 0x19, 0xaf, 0xa8, 0xa8, 0xb3, 0x48, 0x1d, 0x37,
+ 0x21, 0x46, 0x12, 0x20, 0x24, 0x23, 0x40, 0x42, 0x43, 0x24, 0x25, 0x30, 0x11, 0x32, 0x30, 0x84,
+ 0x21, 0x22, 0x21, 0x31, 0x49, 0xf0, 0x8a, 0xd9, 0xad, 0xaa, 0xbb, 0xcd, 0xa9, 0xab, 0xb9, 0xcc,
+ 0xbc, 0xcc, 0xca, 0xab, 0xbb, 0x9c, 0xb9, 0xac, 0x99, 0xba, 0xaa, 0x11, 0x0a, 0x28, 0x24, 0x34,
+ 0x37, 0x53, 0x42, 0x33, 0x35, 0x42, 0x23, 0x24, 0x43, 0x32, 0x33, 0x34, 0x11, 0x04, 0x21, 0x18,
+ 0x40, 0x02, 0x20, 0x12, 0x88, 0x81, 0xa1, 0xbf, 0x10, 0x99, 0x90, 0x91, 0x03, 0x78, 0x21, 0x38,
+ 0x44, 0x95, 0x21, 0x31, 0x27, 0x41, 0x20, 0x93, 0x28, 0xc9, 0xda, 0xc9, 0xae, 0x68, 0x93, 0x9c,
+ 0x01, 0xa2, 0x80, 0xef, 0xbc, 0xba, 0x11, 0x18, 0xa8, 0x98, 0x0a, 0x9b, 0xfb, 0xcb, 0x1b, 0x98,
+ 0x01, 0x89, 0x89, 0x64, 0x12, 0xa1, 0xae, 0xab, 0x10, 0x43, 0x82, 0x18, 0x22, 0x91, 0x10, 0xcd,
+ 0x19, 0x21, 0x22, 0xb1, 0x4a, 0x67, 0x43, 0x22, 0x01, 0x92, 0x10, 0x0b, 0x33, 0x35, 0x47, 0x21,
+ 0xb3, 0x08, 0x2b, 0x00, 0x81, 0x1b, 0x1a, 0x97, 0x8a, 0xc8, 0x01, 0x2a, 0xca, 0x18, 0x10, 0x03,
+ 0xaf, 0xf9, 0xa9, 0x8a, 0x81, 0x09, 0xcb, 0x98, 0xba, 0xdd, 0xab, 0xca, 0xba, 0xbd, 0xb9, 0x99,
+ 0x1a, 0x10, 0xb8, 0x11, 0x50, 0x77, 0x23, 0x23, 0x21, 0x40, 0x43, 0x35, 0x24, 0x22, 0x21, 0x22,
+ 0x24, 0x33, 0x13, 0x43, 0x00, 0x92, 0xbc, 0xbe, 0xaa, 0xa8, 0xda, 0xdb, 0xbc, 0xbb, 0xaa, 0xba,
+ 0xbc, 0xbd, 0xbc, 0xdb, 0xa9, 0x99, 0x88, 0x89, 0x88, 0x98, 0x91, 0x08, 0x50, 0x55, 0x42, 0x22,
+ 0x12, 0x21, 0x73, 0x44, 0x33, 0x11, 0x20, 0x32, 0x15, 0x01, 0x00, 0x62, 0x14, 0x01, 0x8a, 0xa9,
+ 0x21, 0x19, 0xfb, 0xbc, 0xab, 0x99, 0x9a, 0xdc, 0xab, 0xab, 0xdb, 0xca, 0xbc, 0xac, 0x9a, 0x9a,
+ 0x9a, 0xbb, 0xba, 0x28, 0x09, 0xc8, 0x88, 0x29, 0x37, 0x44, 0x43, 0x32, 0x44, 0x43, 0x34, 0x13,
+ 0x32, 0x22, 0x45, 0x43, 0x32, 0x22, 0x01, 0x01, 0x22, 0x01, 0xcb, 0xbd, 0x0a, 0xa8, 0xfa, 0xad,
+ 0xab, 0xba, 0xcc, 0xdc, 0xaa, 0x9a, 0x9a, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xbb, 0xdb, 0x9c,
+ 0xa9, 0x98, 0x89, 0x88, 0x45, 0x46, 0x33, 0x44, 0x63, 0x43, 0x24, 0x32, 0x32, 0x25, 0x23, 0x03,
+ 0x80, 0x20, 0x45, 0x24, 0x82, 0x90, 0x88, 0x98, 0xcc, 0xdc, 0xbb, 0xab, 0xca, 0xba, 0xac, 0xab,
+ 0xbb, 0xcc, 0xbc, 0xbc, 0xab, 0xac, 0x99, 0x08, 0x11, 0x11, 0x11, 0x22, 0x24, 0x43, 0x34, 0x72,
+ 0x24, 0x34, 0x33, 0x34, 0x63, 0x33, 0x23, 0x02, 0x88, 0x22, 0x45, 0x21, 0x01, 0x81, 0x08, 0xa1,
+ 0xcc, 0xdc, 0xaa, 0xbb, 0xdb, 0xbc, 0xac, 0xaa, 0x99, 0xba, 0xdd, 0xba, 0x9b, 0x9a, 0xaa, 0xaa,
+ 0x89, 0x10, 0x01, 0x20, 0x11, 0x35, 0x44, 0x34, 0x35, 0x34, 0x43, 0x44, 0x24, 0x33, 0x21, 0x12,
+ 0x4c, 0x15, 0x32, 0x00, 0x43, 0x23, 0x22, 0x21, 0x34, 0x24, 0x91, 0x99, 0xad, 0xaa, 0xbb, 0xcf,
+ 0xcb, 0xab, 0xbb, 0xca, 0xad, 0xcb, 0xaa, 0xab, 0xcb, 0xbb, 0xac, 0xac, 0xaa, 0x98, 0x89, 0xb8,
+ 0x8b, 0x11, 0x12, 0x11, 0x01, 0x73, 0x55, 0x35, 0x52, 0x44, 0x53, 0x34, 0x22, 0x33, 0x23, 0x34,
+ 0x01, 0x80, 0x18, 0x72, 0x32, 0x13, 0x88, 0x90, 0xa9, 0xbf, 0xdd, 0xba, 0xbb, 0xba, 0xbc, 0xba,
+ 0xba, 0xba, 0xcc, 0xcb, 0xbc, 0xba, 0xac, 0x9a, 0x08, 0x32, 0x34, 0x24, 0x32, 0x42, 0x43, 0x23,
+ 0x33, 0x45, 0x44, 0x43, 0x33, 0x44, 0x23, 0x23, 0x00, 0x98, 0x88, 0x21, 0x23, 0x33, 0x00, 0x93,
+ 0xbb, 0xff, 0xbc, 0xad, 0xbb, 0xbb, 0xbd, 0xba, 0x8a, 0x89, 0xb8, 0xcc, 0xac, 0xbb, 0xab, 0xba,
+ 0x89, 0x32, 0x45, 0x33, 0x43, 0x22, 0x33, 0x11, 0x43, 0x44, 0x53, 0x43, 0x44, 0x33, 0x24, 0x22,
+ 0x01, 0x10, 0x00, 0x80, 0x18, 0x20, 0x25, 0x24, 0x98, 0xdb, 0xbd, 0xdb, 0xca, 0xbc, 0xab, 0xaa,
+ 0xaa, 0xc9, 0xca, 0xba, 0xdb, 0xca, 0xcb, 0xb9, 0x9a, 0x89, 0x00, 0x33, 0x41, 0x83, 0x08, 0x13,
+ 0x0b, 0x35, 0x42, 0x57, 0x33, 0x34, 0x45, 0x43, 0x53, 0x23, 0x22, 0x22, 0x11, 0x13, 0x80, 0x00,
+ 0x52, 0x33, 0x23, 0xa0, 0xbd, 0xfa, 0xcb, 0xcc, 0xbc, 0xbb, 0xab, 0xbb, 0xac, 0xab, 0xba, 0xcb,
+ 0xbc, 0xbc, 0x9c, 0x9a, 0x89, 0x11, 0x32, 0x37, 0x33, 0x24, 0x33, 0x43, 0x53, 0x23, 0x43, 0x24,
+ 0x34, 0x34, 0x25, 0x22, 0x02, 0x80, 0x88, 0x99, 0x09, 0x08, 0x00, 0x02, 0xca, 0xde, 0xba, 0xcd,
+ 0xac, 0xac, 0xab, 0xbb, 0xba, 0x9b, 0x08, 0xa9, 0xba, 0xbe, 0xaa, 0xbb, 0x8b, 0x39, 0x45, 0x35,
+ 0x34, 0x32, 0x43, 0x13, 0x11, 0x32, 0x34, 0x43, 0x44, 0x43, 0x34, 0x24, 0x12, 0x02, 0x80, 0x98,
+ 0x60, 0x2a, 0x30, 0x00, 0xa9, 0x09, 0x00, 0x30, 0x85, 0xc9, 0xdd, 0xac, 0xcb, 0xbc, 0xcb, 0xab,
+ 0xaa, 0xaa, 0xab, 0xab, 0x99, 0xbd, 0xdc, 0xbb, 0xba, 0x9b, 0x28, 0x33, 0x46, 0x32, 0x13, 0x32,
+ 0x12, 0x89, 0x55, 0x01, 0x35, 0x31, 0x55, 0x43, 0x34, 0x34, 0x25, 0x21, 0x12, 0x18, 0x12, 0x98,
+ 0x80, 0x09, 0x34, 0x32, 0xb2, 0xbd, 0xeb, 0xcc, 0xdb, 0xad, 0xbb, 0xab, 0xba, 0xab, 0xaa, 0xac,
+ 0xa9, 0xcb, 0xdb, 0xba, 0xaa, 0x89, 0x21, 0x51, 0x54, 0x43, 0x33, 0x23, 0x43, 0x33, 0x43, 0x32,
+ 0x35, 0x34, 0x44, 0x22, 0x43, 0x22, 0x01, 0xa9, 0xa9, 0xab, 0x89, 0x9a, 0xa2, 0x0a, 0xf8, 0x9f,
+ 0xcb, 0xad, 0xac, 0xbb, 0xbb, 0xab, 0xac, 0x88, 0x00, 0x80, 0xc8, 0x9b, 0xbb, 0xaa, 0x9c, 0x30,
+ 0x37, 0x35, 0x34, 0x42, 0x22, 0x12, 0x10, 0x12, 0x23, 0x62, 0x43, 0x53, 0x34, 0x23, 0x22, 0x11,
+ 0x81, 0xaa, 0xac, 0xab, 0x89, 0x00, 0x11, 0x99, 0xef, 0xbb, 0xcd, 0xcb, 0xcb, 0xac, 0xa9, 0x99,
+ 0x9a, 0xa9, 0x08, 0x9a, 0xdc, 0xbb, 0xcb, 0xa9, 0x9a, 0x20, 0x44, 0x34, 0x33, 0x23, 0x33, 0x12,
+ 0x40, 0x02, 0x72, 0x24, 0x34, 0x55, 0x34, 0x34, 0x34, 0x22, 0x23, 0x21, 0x01, 0x90, 0x9a, 0x89,
+ 0x63, 0x42, 0x83, 0x98, 0xcb, 0xcd, 0xcc, 0xcc, 0xba, 0xbb, 0xab, 0xcb, 0x9a, 0x99, 0x9a, 0xba,
+ 0xcc, 0xab, 0xcb, 0xab, 0x89, 0x20, 0x46, 0x43, 0x24, 0x33, 0x33, 0x24, 0x23, 0x22, 0x43, 0x73,
+ 0x32, 0x34, 0x34, 0x23, 0x13, 0x80, 0x98, 0xaa, 0x89, 0xba, 0x98, 0x10, 0xa3, 0x9e, 0xfc, 0xbc,
+ 0xcc, 0xcb, 0xca, 0xab, 0xba, 0x8a, 0x88, 0x80, 0xa8, 0xa9, 0xdb, 0xba, 0xbd, 0x9a, 0x08, 0x42,
+ 0x44, 0x43, 0x34, 0x33, 0x22, 0x22, 0x22, 0x31, 0x24, 0x55, 0x44, 0x42, 0x32, 0x23, 0x13, 0x11,
+ 0x78, 0x2e, 0x31, 0x00, 0x99, 0x9a, 0x9a, 0x89, 0x08, 0xc8, 0x9a, 0xcb, 0xce, 0xcd, 0xcc, 0xbb,
+ 0xbb, 0xcb, 0xab, 0xaa, 0x98, 0x99, 0xbb, 0xfb, 0xbb, 0xbb, 0xab, 0x0b, 0x20, 0x34, 0x54, 0x33,
+ 0x34, 0x22, 0x23, 0x22, 0x52, 0x32, 0x45, 0x44, 0x63, 0x42, 0x43, 0x33, 0x33, 0x33, 0x43, 0x21,
+ 0x01, 0x89, 0x08, 0x11, 0x52, 0x10, 0x98, 0xa9, 0xde, 0xfb, 0xcb, 0xbb, 0xac, 0xac, 0xba, 0xba,
+ 0xba, 0xba, 0xba, 0xcb, 0xaa, 0xac, 0xba, 0xcb, 0xaa, 0x00, 0x42, 0x54, 0x53, 0x33, 0x43, 0x33,
+ 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x42, 0x22, 0x32, 0x22, 0x32, 0x23, 0x03, 0x81, 0x18, 0xca,
+ 0xba, 0xbf, 0xbd, 0xcb, 0xbb, 0xbd, 0xbc, 0xcc, 0xaa, 0xba, 0xbb, 0xcc, 0xaa, 0xaa, 0xba, 0xbb,
+ 0xac, 0xab, 0x89, 0xb9, 0x80, 0x41, 0x63, 0x43, 0x35, 0x53, 0x53, 0x22, 0x33, 0x43, 0x33, 0x43,
+ 0x33, 0x43, 0x43, 0x12, 0x22, 0x00, 0x11, 0x80, 0xb8, 0xcd, 0xcb, 0xbb, 0xcb, 0xbc, 0xac, 0xac,
+ 0xba, 0xcc, 0xbb, 0xad, 0xab, 0xbb, 0xba, 0xac, 0xab, 0x9a, 0x8a, 0x9a, 0xa9, 0x98, 0x98, 0x1a,
+ 0x24, 0x71, 0x23, 0x45, 0x34, 0x31, 0x24, 0x53, 0x33, 0x24, 0x33, 0x44, 0x43, 0x34, 0x43, 0x23,
+ 0x34, 0x32, 0x12, 0x31, 0x12, 0x23, 0x20, 0x21, 0x88, 0xc8, 0xbc, 0xfb, 0xcb, 0xbc, 0xcd, 0xca,
+ 0xaa, 0xac, 0xaa, 0xaa, 0xa9, 0x9a, 0xbb, 0xac, 0xca, 0xaa, 0xbb, 0x38, 0x00, 0x35, 0x44, 0x43,
+ 0x34, 0x25, 0x42, 0x22, 0x22, 0x32, 0x34, 0x22, 0x44, 0x43, 0x33, 0x33, 0x33, 0x81, 0x98, 0xd9,
+ 0xbc, 0x9c, 0xab, 0xba, 0xbb, 0xea, 0x8a, 0xbd, 0xcb, 0xbd, 0xbb, 0xdb, 0xa9, 0x9b, 0xba, 0xa9,
+ 0x9b, 0xab, 0xc9, 0xac, 0xbb, 0xbd, 0x9b, 0x80, 0x12, 0x78, 0x12, 0x73, 0x23, 0x22, 0x11, 0x34,
+ 0xa3, 0xfb, 0x23, 0x00, 0x42, 0x00, 0x01, 0x23, 0x34, 0x24, 0x12, 0x51, 0x82, 0x00, 0x13, 0xca,
+ 0x99, 0xab, 0xa8, 0x04, 0xbf, 0xaa, 0xcb, 0xa9, 0xad, 0xcc, 0x89, 0x9a, 0xa9, 0x88, 0xaa, 0x88,
+ 0x8f, 0xa8, 0xc2, 0x00, 0x22, 0x0b, 0x91, 0x8d, 0xc0, 0xa2, 0x53, 0x71, 0x33, 0xa0, 0x02, 0x2b,
+ 0xa9, 0xb5, 0x08, 0x40, 0xbb, 0x28, 0xf0, 0xa9, 0x9c, 0xaa, 0x91, 0x7a, 0x91, 0x37, 0x30, 0x53,
+ 0x82, 0x41, 0x32, 0x30, 0x12, 0x54, 0x24, 0x12, 0x25, 0x31, 0x80, 0x00, 0x89, 0x08, 0x0c, 0x02,
+ 0x94, 0x69, 0x80, 0xb0, 0x70, 0x88, 0x8a, 0xb2, 0x80, 0xbb, 0x29, 0x23, 0x76, 0x22, 0x32, 0x11,
+ 0x03, 0x02, 0x82, 0x73, 0x15, 0x29, 0x11, 0x40, 0xb2, 0xb5, 0x9d, 0xb9, 0xbd, 0xad, 0xaa, 0xbb,
+ 0xac, 0xba, 0xba, 0xba, 0xcc, 0xbc, 0xbc, 0xaa, 0xca, 0x99, 0xaa, 0x21, 0x1a, 0x17, 0x20, 0x92,
+ 0x20, 0x92, 0x8c, 0x80, 0xce, 0xa8, 0x18, 0x3b, 0xa3, 0xb1, 0x0c, 0xad, 0xed, 0x89, 0x8a, 0xda,
+ 0x99, 0x18, 0x98, 0x88, 0x88, 0x80, 0x30, 0x60, 0x04, 0x28, 0x72, 0x15, 0x44, 0x23, 0x31, 0x32,
+ 0x22, 0x21, 0x82, 0x22, 0x17, 0x28, 0x23, 0x24, 0x73, 0x10, 0x82, 0x00, 0xa9, 0xea, 0xc9, 0x0c,
+ 0x8a, 0xb8, 0x99, 0x3a, 0xc2, 0xca, 0xcc, 0xbd, 0xcb, 0xcc, 0xab, 0xac, 0x98, 0x98, 0x89, 0x0b,
+ 0xc8, 0xb0, 0x9c, 0x8a, 0x11, 0x40, 0x34, 0x37, 0x35, 0x32, 0x34, 0x53, 0x22, 0x13, 0x33, 0x43,
+ 0x63, 0x22, 0x23, 0x24, 0x33, 0x11, 0x12, 0xa8, 0x0a, 0x9a, 0xb9, 0xb9, 0xbd, 0x8d, 0xb0, 0x9c,
+ 0xba, 0xde, 0xaa, 0xad, 0xaa, 0xa8, 0x9a, 0x88, 0x09, 0x1a, 0x33, 0x5a, 0xd8, 0xc8, 0xa1, 0x9b,
+ 0x8a, 0x98, 0x6b, 0x25, 0x09, 0x23, 0xa8, 0x28, 0x52, 0xe0, 0x8a, 0x00, 0x00, 0x51, 0x17, 0x10,
+ 0xd5, 0x05, 0x1f, 0x00, 0x11, 0x09, 0xf9, 0x9b, 0xab, 0xca, 0x8b, 0xa8, 0x90, 0xa0, 0xbc, 0xcb,
+ 0xbf, 0xcb, 0xcb, 0xcc, 0x9b, 0xb9, 0xaa, 0x9b, 0x90, 0x9d, 0xb9, 0xb8, 0xaf, 0x99, 0x98, 0x18,
+ 0x92, 0x43, 0x42, 0x56, 0x32, 0x21, 0x02, 0x21, 0x24, 0x44, 0x33, 0x45, 0x11, 0x14, 0x22, 0x22,
+ 0x02, 0x01, 0x80, 0x38, 0x1c, 0x05, 0x12, 0x18, 0x84, 0x99, 0xae, 0xc9, 0xbd, 0xab, 0xdb, 0x8a,
+ 0xeb, 0x99, 0x98, 0x99, 0x9b, 0xeb, 0xaa, 0x9c, 0xab, 0xbc, 0xa9, 0xd8, 0x19, 0x08, 0x08, 0x91,
+ 0x0d, 0xb3, 0x48, 0x28, 0x32, 0x67, 0x01, 0x31, 0x34, 0x34, 0x51, 0x33, 0x33, 0x42, 0x22, 0x17,
+ 0x22, 0x21, 0x23, 0x03, 0x43, 0x20, 0xa8, 0x09, 0xaa, 0xce, 0xba, 0xca, 0x9d, 0x98, 0x9c, 0xab,
+ 0xab, 0xe8, 0xaa, 0xb9, 0xba, 0xab, 0x1b, 0xa2, 0x21, 0x33, 0x64, 0x50, 0x13, 0x35, 0x23, 0x30,
+ 0x27, 0x50, 0x11, 0x21, 0x14, 0x18, 0x11, 0x00, 0xb0, 0x89, 0x0c, 0x98, 0x98, 0xbe, 0xe8, 0xab,
+ 0xac, 0xdb, 0xb9, 0x8c, 0xbc, 0xa9, 0x9b, 0xba, 0xc8, 0xab, 0xdb, 0xab, 0xcb, 0xb8, 0xbf, 0x99,
+ 0x0b, 0xa9, 0xdb, 0x80, 0xbb, 0x8c, 0xca, 0x8b, 0x00, 0x32, 0x95, 0x24, 0x38, 0x50, 0x23, 0x62,
+ 0x01, 0x24, 0x24, 0x43, 0x34, 0x24, 0x22, 0x52, 0x01, 0x11, 0x13, 0x31, 0x03, 0x11, 0x02, 0x00,
+ 0x27, 0x88, 0x1c, 0x9b, 0xcb, 0xd2, 0xda, 0xa9, 0x0b, 0xdc, 0x9c, 0x99, 0xba, 0xbc, 0x09, 0x99,
+ 0xa9, 0xb2, 0x09, 0x60, 0xb8, 0x8d, 0x01, 0xbb, 0x87, 0x3b, 0x8a, 0x06, 0x20, 0x28, 0x12, 0x98,
+ 0xc9, 0x20, 0x28, 0x17, 0x48, 0x10, 0x43, 0xa8, 0x84, 0x99, 0x35, 0x38, 0x03, 0x61, 0x80, 0x04,
+ 0x41, 0x23, 0x38, 0x42, 0x05, 0x81, 0x09, 0x33, 0x43, 0x22, 0x2b, 0x30, 0xa4, 0x34, 0x47, 0x08,
+ 0xd1, 0x04, 0x1a, 0x00, 0xa4, 0x32, 0x58, 0x28, 0xb1, 0xa1, 0x43, 0x89, 0x43, 0x60, 0x41, 0x83,
+ 0x33, 0x23, 0x29, 0x96, 0x81, 0x09, 0x4b, 0x9c, 0x90, 0xb8, 0xa1, 0xf5, 0x8e, 0xaa, 0xab, 0xba,
+ 0xcd, 0x88, 0xab, 0x9c, 0xcb, 0xc9, 0xba, 0x9c, 0xac, 0x99, 0xe8, 0x0a, 0x88, 0x88, 0x9a, 0x04,
+ 0x91, 0x3b, 0x28, 0xc1, 0x32, 0x18, 0x02, 0x37, 0x13, 0x7a, 0x21, 0x03, 0x82, 0x20, 0xb8, 0x50,
+ 0xc9, 0x14, 0x01, 0x0b, 0x2b, 0xfb, 0x11, 0x89, 0x0d, 0xb8, 0x84, 0x9a, 0x02, 0x11, 0x0b, 0x72,
+ 0x01, 0xa0, 0x2a, 0x17, 0x31, 0x33, 0x15, 0x39, 0x62, 0x02, 0x52, 0x02, 0x98, 0x25, 0x19, 0x20,
+ 0x23, 0x89, 0x42, 0xf2, 0x08, 0x39, 0x0a, 0xf0, 0xbc, 0x8b, 0xb9, 0xc0, 0x1e, 0xa9, 0xbc, 0xa9,
+ 0x0c, 0x90, 0xb8, 0xae, 0x90, 0xba, 0xad, 0x0b, 0xaa, 0xda, 0x01, 0xaa, 0x25, 0x31, 0x11, 0x26,
+ 0x63, 0x32, 0x03, 0x45, 0x21, 0x34, 0x13, 0x31, 0x44, 0x33, 0x10, 0x25, 0x39, 0x42, 0x04, 0x00,
+ 0x82, 0x39, 0x10, 0x39, 0x89, 0x82, 0xf3, 0x88, 0xd9, 0x29, 0x9e, 0x98, 0xa8, 0xdd, 0x80, 0x8a,
+ 0x98, 0x9b, 0xb8, 0xbb, 0x10, 0xbf, 0x99, 0xcb, 0xe8, 0x28, 0x1a, 0x98, 0x93, 0x80, 0x99, 0x85,
+ 0x1a, 0x0d, 0x33, 0x31, 0x97, 0x1a, 0x17, 0x18, 0x88, 0x2a, 0xa8, 0x91, 0xaa, 0xf0, 0x0b, 0x0a,
+ 0xab, 0x8d, 0xd2, 0x89, 0xde, 0x88, 0xa9, 0xda, 0x9a, 0x8b, 0x9a, 0xb9, 0xd9, 0x09, 0x9d, 0xca,
+ 0x90, 0x9e, 0x01, 0x82, 0x20, 0x28, 0x99, 0x73, 0x92, 0x52, 0x09, 0x43, 0x22, 0x14, 0x13, 0x63,
+ 0x10, 0x42, 0x82, 0x03, 0x18, 0x19, 0x31, 0xe2, 0x90, 0x3a, 0x10, 0x20, 0xfa, 0x98, 0xdd, 0x0a,
+ 0x2c, 0xe8, 0x00, 0x9a, 0x9a, 0x98, 0x8a, 0xab, 0x70, 0x67, 0x10, 0x31, 0xaf, 0xa2, 0x19, 0x98,
+ 0xa1, 0xfd, 0x28, 0x00, 0x98, 0x01, 0x18, 0x21, 0x88, 0x84, 0x99, 0x34, 0x1f, 0x35, 0xd0, 0x51,
+ 0xb9, 0x80, 0xb8, 0x0b, 0xca, 0xa9, 0x9c, 0x8b, 0xa8, 0x88, 0xa0, 0x2b, 0xb9, 0xec, 0x20, 0x28,
+ 0x55, 0x14, 0x54, 0x22, 0x32, 0x22, 0x03, 0x32, 0x21, 0x83, 0x44, 0x21, 0x14, 0x33, 0x43, 0x35,
+ 0x20, 0x88, 0x1a, 0xf0, 0xdb, 0xba, 0x0c, 0xab, 0xa0, 0x20, 0x9b, 0xc8, 0xd8, 0xab, 0xcc, 0x8c,
+ 0xcc, 0xa0, 0x0a, 0xa0, 0x89, 0x10, 0x0b, 0x88, 0xc2, 0x9a, 0x1a, 0xde, 0x10, 0x90, 0x64, 0x22,
+ 0x25, 0x32, 0x42, 0x42, 0x33, 0x02, 0xa1, 0xa0, 0x8a, 0x69, 0x02, 0x1a, 0x06, 0x12, 0x9a, 0xb8,
+ 0xcf, 0xac, 0xd9, 0x99, 0x9a, 0xba, 0x89, 0xa9, 0x88, 0xc1, 0x9e, 0xcb, 0xba, 0xca, 0x99, 0x89,
+ 0x4b, 0x22, 0x33, 0x36, 0x21, 0x92, 0x18, 0x08, 0x60, 0x00, 0x24, 0x54, 0x32, 0x25, 0x02, 0x31,
+ 0x88, 0xb1, 0x89, 0x09, 0x00, 0x17, 0x32, 0x31, 0x79, 0x91, 0xa8, 0xea, 0xc9, 0x99, 0x0b, 0xda,
+ 0xaa, 0xca, 0xbb, 0xbc, 0x89, 0xbe, 0xbd, 0xdc, 0xcb, 0xb9, 0xab, 0x99, 0x09, 0x08, 0xa0, 0x2b,
+ 0x67, 0x63, 0x44, 0x33, 0x43, 0x33, 0x24, 0x02, 0x80, 0xa9, 0x10, 0x54, 0x24, 0x21, 0x01, 0x08,
+ 0xa9, 0xcd, 0xbc, 0xbd, 0xbb, 0xac, 0xbb, 0xab, 0x9a, 0x8a, 0xa9, 0xbb, 0xdc, 0xcc, 0xcb, 0xab,
+ 0x8a, 0x31, 0x35, 0x24, 0x33, 0x33, 0x34, 0x12, 0x22, 0x53, 0x54, 0x43, 0x23, 0x12, 0x33, 0x33,
+ 0x45, 0x11, 0x81, 0x90, 0xba, 0xbd, 0xa9, 0x2b, 0x90, 0x90, 0xdc, 0xdc, 0xdc, 0xbb, 0xcb, 0xaa,
+ 0x98, 0x88, 0x99, 0xa9, 0xaa, 0x09, 0x99, 0xba, 0xcb, 0xad, 0x00, 0x51, 0x72, 0x44, 0x42, 0x23,
+ 0x22, 0x00, 0x80, 0x00, 0x51, 0x43, 0x34, 0x24, 0x22, 0x12, 0x81, 0xa9, 0xaa, 0xcb, 0xcb, 0xba,
+ 0xe0, 0x10, 0x29, 0x00, 0xbc, 0x9a, 0xc9, 0x80, 0xdd, 0xcc, 0xbc, 0xac, 0xab, 0x99, 0x89, 0x22,
+ 0x11, 0x82, 0xbb, 0xcc, 0xab, 0xba, 0x8a, 0x43, 0x43, 0x46, 0x22, 0x34, 0x22, 0x02, 0x89, 0xca,
+ 0x9d, 0x90, 0x28, 0x25, 0x40, 0x25, 0x53, 0x34, 0x46, 0x33, 0x43, 0x23, 0x20, 0xb9, 0xbc, 0xbb,
+ 0x39, 0x43, 0x25, 0x01, 0xa9, 0xeb, 0xcb, 0xcd, 0xba, 0xbc, 0xaa, 0xaa, 0x9a, 0x8a, 0x08, 0x02,
+ 0x02, 0xca, 0xfb, 0xab, 0x9a, 0x30, 0x37, 0x36, 0x33, 0x24, 0x11, 0x11, 0x01, 0x21, 0x32, 0x35,
+ 0x43, 0x33, 0x22, 0x22, 0x21, 0x91, 0xca, 0xdf, 0xbc, 0xcb, 0x9b, 0x88, 0x10, 0x10, 0xb9, 0xec,
+ 0xdb, 0xbb, 0xab, 0xaa, 0x18, 0x11, 0x52, 0x13, 0x12, 0x12, 0x33, 0x21, 0xa0, 0x9a, 0x0a, 0x77,
+ 0x34, 0x44, 0x22, 0x01, 0x99, 0xaa, 0x9a, 0x99, 0x31, 0x35, 0x44, 0x11, 0x01, 0x90, 0xb9, 0x9d,
+ 0xdb, 0xab, 0xba, 0x08, 0x21, 0x26, 0x02, 0xda, 0xcb, 0xbd, 0xbc, 0xca, 0x89, 0x00, 0x10, 0x01,
+ 0x18, 0x08, 0x90, 0xcb, 0xcc, 0x8a, 0xbb, 0x51, 0x35, 0x34, 0x14, 0x00, 0x90, 0xbb, 0xac, 0x28,
+ 0x53, 0x32, 0x43, 0x80, 0x98, 0xec, 0x9a, 0x9b, 0xa0, 0x1c, 0x44, 0x76, 0x53, 0x33, 0x33, 0x02,
+ 0x80, 0xc9, 0xbc, 0xaa, 0x18, 0x44, 0x24, 0x11, 0x99, 0xcc, 0xbb, 0xcd, 0xbb, 0xbc, 0x9a, 0x8a,
+ 0x09, 0x10, 0x32, 0x92, 0xca, 0xcd, 0xbb, 0x9a, 0x20, 0x74, 0x34, 0x34, 0x23, 0x11, 0x00, 0x00,
+ 0x10, 0x21, 0x52, 0x33, 0x35, 0x34, 0x11, 0x81, 0xba, 0xeb, 0xdb, 0xbc, 0xca, 0x9b, 0x80, 0x10,
+ 0x00, 0xba, 0xcd, 0xdb, 0xab, 0xab, 0x89, 0x00, 0x31, 0x34, 0x63, 0x23, 0x12, 0x01, 0x12, 0x00,
+ 0x23, 0x41, 0x73, 0x53, 0x32, 0x11, 0xa9, 0xcb, 0xba, 0x9a, 0x88, 0x09, 0x30, 0x33, 0x22, 0xaa,
+ 0xa9, 0x06, 0x1f, 0x00, 0xcf, 0xc9, 0xab, 0xa9, 0x21, 0x61, 0x42, 0x03, 0x14, 0xb9, 0xcb, 0x9e,
+ 0x8a, 0x80, 0xa8, 0x8a, 0xda, 0xab, 0xbe, 0xbb, 0x90, 0x8a, 0x88, 0x9a, 0x99, 0x99, 0x29, 0x8a,
+ 0xf2, 0x40, 0x08, 0x78, 0x85, 0x18, 0x02, 0x32, 0x25, 0xd9, 0x19, 0x9a, 0x38, 0x07, 0x98, 0x19,
+ 0xd8, 0x2b, 0x82, 0x3b, 0x77, 0x47, 0x33, 0x22, 0x12, 0x10, 0x91, 0xaa, 0xbb, 0x8d, 0x43, 0x23,
+ 0x92, 0xab, 0xed, 0xaa, 0xdc, 0xac, 0xbb, 0x9c, 0x98, 0x88, 0x88, 0x18, 0x98, 0xa0, 0xbb, 0xad,
+ 0x18, 0x42, 0x46, 0x34, 0x34, 0x24, 0x21, 0x10, 0x11, 0x21, 0x22, 0x52, 0x32, 0x25, 0x33, 0x02,
+ 0xa9, 0xdc, 0xab, 0xcc, 0xba, 0xcd, 0x9a, 0x8a, 0x08, 0x99, 0xda, 0xaa, 0xbb, 0xbb, 0xab, 0x0a,
+ 0x34, 0x62, 0x52, 0x32, 0x24, 0x11, 0x12, 0x31, 0x15, 0x13, 0x21, 0x31, 0x22, 0x34, 0xa1, 0xbd,
+ 0xbe, 0xab, 0xaa, 0xb8, 0x8a, 0x0b, 0x08, 0xc9, 0xdd, 0x0a, 0x9a, 0x21, 0x52, 0x52, 0x10, 0x93,
+ 0x31, 0x41, 0x21, 0x84, 0x08, 0x9a, 0x18, 0xba, 0xfa, 0xec, 0x9b, 0xbc, 0xad, 0xaa, 0x99, 0x88,
+ 0x01, 0xb0, 0x8a, 0xac, 0x1a, 0x1b, 0x91, 0x47, 0x24, 0x40, 0x05, 0x09, 0x81, 0x09, 0x33, 0x32,
+ 0x17, 0x31, 0x89, 0x92, 0xce, 0xbb, 0xbb, 0x8d, 0x98, 0xa8, 0x72, 0x37, 0x36, 0x43, 0x21, 0x11,
+ 0x80, 0x01, 0xba, 0xaa, 0x0c, 0x35, 0x44, 0x91, 0xc9, 0xbc, 0xab, 0xcc, 0xac, 0xbc, 0xa9, 0x88,
+ 0x08, 0x80, 0x98, 0xa8, 0xb9, 0xcb, 0x9c, 0x10, 0x37, 0x35, 0x35, 0x23, 0x23, 0x12, 0x20, 0x10,
+ 0x32, 0x35, 0x34, 0x33, 0x23, 0x33, 0x90, 0xcc, 0xce, 0xac, 0xba, 0xab, 0xbd, 0xbb, 0x99, 0x09,
+ 0x9a, 0xfb, 0x8a, 0x99, 0x98, 0x29, 0x89, 0x54, 0x42, 0x43, 0x24, 0x23, 0x31, 0x22, 0x22, 0x11,
+ 0x77, 0x0e, 0x2a, 0x00, 0x00, 0x82, 0x12, 0x0d, 0xda, 0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbf, 0x89,
+ 0xa9, 0x80, 0x19, 0x22, 0x53, 0x33, 0x3a, 0x95, 0x41, 0x32, 0x35, 0x53, 0x53, 0x82, 0x21, 0x88,
+ 0x20, 0xc1, 0xd9, 0xbc, 0xdb, 0xbb, 0xb9, 0x99, 0x18, 0xc8, 0xc9, 0xaf, 0xb9, 0x8a, 0x89, 0x00,
+ 0x11, 0x1a, 0x83, 0x73, 0x04, 0x10, 0x22, 0x19, 0x26, 0x01, 0x72, 0x80, 0x12, 0x20, 0xd9, 0x8b,
+ 0xb9, 0x18, 0x84, 0x29, 0x9c, 0x73, 0x45, 0x37, 0x21, 0x12, 0x12, 0x21, 0x22, 0xd9, 0x9b, 0x9a,
+ 0x52, 0x24, 0xb8, 0xea, 0xbb, 0xab, 0xcc, 0xcc, 0xbb, 0x9a, 0x09, 0x98, 0xa9, 0x9a, 0x98, 0xaa,
+ 0x99, 0x8b, 0x65, 0x44, 0x34, 0x44, 0x12, 0x23, 0x12, 0x20, 0x22, 0x44, 0x43, 0x14, 0x42, 0x01,
+ 0x88, 0xba, 0xbc, 0xab, 0xc8, 0xac, 0xdd, 0x9b, 0x9a, 0x98, 0xa8, 0xbc, 0xcb, 0x98, 0x89, 0x91,
+ 0x38, 0x44, 0x25, 0x12, 0x08, 0x80, 0x73, 0x34, 0x13, 0x81, 0x88, 0x10, 0x22, 0x80, 0x9a, 0xbd,
+ 0x9c, 0xda, 0xb9, 0xab, 0xa9, 0x9b, 0xcb, 0xbf, 0xcb, 0x19, 0x22, 0x54, 0x01, 0x00, 0x11, 0x18,
+ 0x26, 0x21, 0x42, 0x32, 0x42, 0x02, 0x01, 0xa9, 0xa8, 0xc8, 0xcf, 0xbb, 0xfb, 0x09, 0xa8, 0x88,
+ 0xd8, 0x9c, 0xa9, 0x0a, 0x90, 0x00, 0x90, 0x21, 0x41, 0x20, 0xa3, 0x32, 0x78, 0x23, 0x23, 0xa2,
+ 0x2a, 0x92, 0x76, 0x85, 0x81, 0xbb, 0x19, 0x98, 0x63, 0xa9, 0x12, 0xdd, 0x89, 0x19, 0x77, 0x32,
+ 0x15, 0x22, 0x01, 0x10, 0x91, 0xad, 0xa9, 0x0a, 0x35, 0x13, 0x90, 0xac, 0xbc, 0xbb, 0xbf, 0xbc,
+ 0xba, 0x8a, 0x88, 0x80, 0x89, 0x88, 0xb8, 0xcb, 0xcc, 0x0a, 0x52, 0x35, 0x44, 0x33, 0x33, 0x23,
+ 0x00, 0x10, 0x22, 0x45, 0x43, 0x24, 0x32, 0x12, 0x88, 0xc9, 0xcc, 0xab, 0x9c, 0xaa, 0x9a, 0xec,
+ 0x64, 0x04, 0x37, 0x00, 0x9a, 0xab, 0x9a, 0xdb, 0x9a, 0x18, 0x80, 0x10, 0x02, 0x41, 0x04, 0x20,
+ 0x43, 0x32, 0x25, 0x35, 0x43, 0x32, 0x81, 0x80, 0x88, 0xc9, 0xa9, 0x89, 0xbb, 0xc9, 0xad, 0xaa,
+ 0xce, 0xab, 0xcb, 0x9b, 0x0a, 0x31, 0x36, 0x24, 0x01, 0x12, 0x89, 0x90, 0x51, 0x53, 0x45, 0x23,
+ 0x22, 0x92, 0x8a, 0x99, 0xca, 0xcd, 0xbb, 0xbc, 0xa8, 0xbc, 0x99, 0xb9, 0xcb, 0xce, 0xab, 0x89,
+ 0x00, 0x32, 0x25, 0x39, 0xa4, 0x2a, 0x82, 0x33, 0x55, 0x21, 0x11, 0x83, 0x0d, 0x03, 0x30, 0x34,
+ 0x90, 0x19, 0x9a, 0x3a, 0xd4, 0x98, 0x9d, 0xbd, 0xdb, 0xab, 0x53, 0x56, 0x25, 0x22, 0x01, 0x80,
+ 0x21, 0x21, 0x98, 0xa9, 0x8b, 0x64, 0x04, 0x00, 0xca, 0xbc, 0xbc, 0xcb, 0xbc, 0xab, 0xaa, 0x98,
+ 0x99, 0xac, 0xbb, 0xdb, 0x8c, 0x90, 0x20, 0x42, 0x24, 0x45, 0x33, 0x43, 0x23, 0x21, 0x21, 0x24,
+ 0x44, 0x34, 0x33, 0x24, 0x12, 0x88, 0x99, 0xad, 0xba, 0xcb, 0xa9, 0x98, 0xcb, 0xec, 0xbd, 0x9b,
+ 0x9a, 0x90, 0xa8, 0xaa, 0x90, 0x9a, 0x18, 0xa9, 0x99, 0x0a, 0x74, 0x27, 0x32, 0x32, 0x33, 0x26,
+ 0x00, 0xa8, 0x9b, 0x19, 0x34, 0x34, 0x11, 0xa8, 0xda, 0xdb, 0xbc, 0xca, 0xbb, 0x09, 0x22, 0x32,
+ 0x01, 0xe9, 0xbb, 0xa9, 0x20, 0x21, 0x62, 0x55, 0x53, 0x33, 0x01, 0xa8, 0xb9, 0xaa, 0x01, 0x09,
+ 0x8a, 0xa0, 0xc9, 0xfa, 0xdf, 0x9a, 0x9a, 0x99, 0xa8, 0x99, 0x28, 0x81, 0x8a, 0x80, 0xea, 0x18,
+ 0x10, 0x73, 0x26, 0x01, 0x33, 0x09, 0x98, 0xa9, 0x9e, 0x24, 0x22, 0x37, 0x09, 0x81, 0xad, 0x99,
+ 0xab, 0x08, 0xb9, 0xca, 0x11, 0x41, 0x77, 0x04, 0x22, 0x82, 0x28, 0x24, 0x33, 0x43, 0x98, 0x99,
+ 0x31, 0x28, 0x95, 0xbb, 0xae, 0xdb, 0xba, 0xae, 0xcb, 0xaa, 0xab, 0xba, 0xbb, 0xbc, 0xcb, 0x88,
+ 0x17, 0xdb, 0x2e, 0x00, 0x18, 0x21, 0x22, 0x46, 0x43, 0x53, 0x33, 0x33, 0x24, 0x42, 0x34, 0x43,
+ 0x23, 0x33, 0x22, 0x22, 0x11, 0xc0, 0xaa, 0xfa, 0x9a, 0xac, 0xac, 0xbc, 0xca, 0x9a, 0xb9, 0xbd,
+ 0xcc, 0x9c, 0x88, 0x18, 0x08, 0x98, 0x8a, 0x80, 0x88, 0x12, 0x73, 0x33, 0x34, 0x24, 0x12, 0x23,
+ 0x34, 0x53, 0x11, 0x90, 0x89, 0x91, 0x44, 0x22, 0x09, 0xeb, 0xca, 0xab, 0x9a, 0x0b, 0xb2, 0x9a,
+ 0xad, 0xab, 0xa8, 0x71, 0x21, 0x14, 0x91, 0x41, 0x89, 0x32, 0x34, 0x30, 0xc9, 0xb5, 0xaf, 0x99,
+ 0xa9, 0x29, 0xa9, 0xea, 0xbb, 0xed, 0x8a, 0x88, 0x28, 0x03, 0xbb, 0xba, 0x02, 0x70, 0x84, 0x12,
+ 0x31, 0x49, 0x05, 0x43, 0x31, 0x81, 0x21, 0x8a, 0xc9, 0xc8, 0x2b, 0x35, 0x31, 0xd8, 0xb9, 0xad,
+ 0x9a, 0xfb, 0x08, 0x9d, 0x80, 0x88, 0x09, 0xb0, 0x08, 0x72, 0x47, 0x32, 0x23, 0x10, 0x34, 0x31,
+ 0x06, 0x01, 0x98, 0x18, 0x00, 0x42, 0xa8, 0xab, 0xdd, 0xbb, 0xcd, 0xbb, 0xac, 0x99, 0xaa, 0xa8,
+ 0xbc, 0xbb, 0x9b, 0x08, 0x32, 0x13, 0x72, 0x63, 0x42, 0x23, 0x23, 0x24, 0x33, 0x43, 0x34, 0x43,
+ 0x23, 0x34, 0x11, 0x01, 0x08, 0xa8, 0xbb, 0xde, 0x89, 0xca, 0x9b, 0xbd, 0x9a, 0x99, 0xca, 0xdc,
+ 0xac, 0x8b, 0x18, 0x01, 0x90, 0x9b, 0xc9, 0xbb, 0xba, 0x90, 0x72, 0x33, 0x53, 0x12, 0x12, 0x39,
+ 0x33, 0x17, 0x25, 0x22, 0x22, 0x10, 0x81, 0x18, 0xb2, 0xab, 0xcc, 0x2c, 0x05, 0x11, 0x81, 0xdc,
+ 0xdb, 0xba, 0x0b, 0xa1, 0x80, 0x19, 0xa2, 0x32, 0x8c, 0xbf, 0xa1, 0xa8, 0x32, 0x21, 0xaf, 0x11,
+ 0x32, 0x44, 0xea, 0x8b, 0x89, 0xb1, 0x99, 0x0c, 0x08, 0x83, 0x8d, 0xa8, 0xbc, 0x08, 0x8e, 0x16,
+ 0x33, 0x91, 0x99, 0x32, 0x68, 0x05, 0x09, 0x09, 0x82, 0x04, 0x8d, 0xcb, 0x09, 0x32, 0x44, 0xb9,
+ 0x98, 0xfc, 0x26, 0x00, 0xfb, 0x89, 0x89, 0x99, 0x90, 0x40, 0xe1, 0x99, 0xaf, 0x00, 0x44, 0x52,
+ 0x01, 0x03, 0x48, 0x32, 0x15, 0x33, 0x18, 0xa8, 0x89, 0x38, 0x45, 0x13, 0x99, 0xf8, 0x9b, 0xca,
+ 0xcb, 0xba, 0x9b, 0xba, 0xa9, 0xaf, 0xba, 0xab, 0x9a, 0x99, 0x9a, 0x9a, 0x39, 0x45, 0x36, 0x43,
+ 0x21, 0x12, 0x32, 0x43, 0x54, 0x43, 0x33, 0x24, 0x23, 0x00, 0x01, 0x10, 0x22, 0x80, 0xa9, 0x8e,
+ 0xd8, 0x99, 0xec, 0xaa, 0xaa, 0xab, 0xeb, 0xeb, 0x9b, 0x9a, 0x99, 0xba, 0xbc, 0xab, 0xa9, 0x08,
+ 0x12, 0x88, 0x11, 0x46, 0x35, 0x42, 0x22, 0x40, 0x23, 0x36, 0x32, 0x22, 0x42, 0x23, 0x32, 0x31,
+ 0x18, 0x04, 0x02, 0xa9, 0xdb, 0xbf, 0x99, 0xbb, 0xa8, 0xac, 0xbd, 0xcb, 0xaa, 0x89, 0xb9, 0xad,
+ 0xba, 0xba, 0x80, 0x0e, 0xa8, 0x19, 0x11, 0x3a, 0xf0, 0x80, 0x0a, 0x51, 0x92, 0x61, 0xa8, 0x10,
+ 0x22, 0x09, 0x74, 0x02, 0x33, 0x13, 0x78, 0x91, 0x89, 0x30, 0x28, 0x26, 0x83, 0x8a, 0xb0, 0x8e,
+ 0x38, 0xdc, 0xa8, 0xa8, 0x2b, 0x10, 0xf1, 0x98, 0xbd, 0xab, 0x8a, 0xcb, 0xa0, 0xa2, 0x2c, 0xda,
+ 0x9d, 0x09, 0x45, 0x24, 0x23, 0x00, 0x44, 0x42, 0x35, 0x24, 0x22, 0x00, 0x81, 0x39, 0x05, 0x21,
+ 0x13, 0x09, 0xf9, 0xaa, 0xad, 0xab, 0xda, 0x9a, 0xba, 0xea, 0xab, 0xac, 0x9a, 0x98, 0xaa, 0x98,
+ 0xaa, 0x01, 0x44, 0x41, 0x33, 0x14, 0x44, 0x11, 0x53, 0x33, 0x25, 0x34, 0x22, 0x22, 0x82, 0x00,
+ 0x21, 0x31, 0x88, 0x00, 0xfa, 0xc0, 0x9d, 0xc9, 0x9a, 0xad, 0xcb, 0xeb, 0xa9, 0x99, 0x88, 0x99,
+ 0xbb, 0xcd, 0x99, 0x0a, 0x81, 0x11, 0x11, 0x25, 0x42, 0x32, 0x03, 0x43, 0x35, 0x34, 0x34, 0x32,
+ 0x33, 0x24, 0x20, 0x01, 0x91, 0x08, 0x88, 0x81, 0xd8, 0xbd, 0xaf, 0xba, 0xcb, 0xac, 0xca, 0xb8,
+ 0x50, 0xfb, 0x29, 0x00, 0x89, 0xa9, 0xca, 0xba, 0xac, 0xa9, 0x29, 0x43, 0x30, 0x80, 0x32, 0x24,
+ 0xa2, 0x22, 0x50, 0x71, 0x17, 0x80, 0x88, 0x20, 0x22, 0x05, 0x25, 0x00, 0x19, 0x88, 0x98, 0x91,
+ 0x2a, 0x80, 0x73, 0xea, 0xd0, 0x89, 0x0b, 0x11, 0x91, 0x8f, 0xca, 0x9b, 0x98, 0x10, 0x07, 0x19,
+ 0xb9, 0x0c, 0xc0, 0x2a, 0x90, 0x28, 0x86, 0x1a, 0xf8, 0x09, 0x8c, 0x44, 0x22, 0x26, 0x88, 0x12,
+ 0x41, 0x26, 0x23, 0x33, 0x80, 0x10, 0x8b, 0x83, 0x72, 0x32, 0x01, 0xe8, 0x8c, 0xda, 0x89, 0xaa,
+ 0x9a, 0xcb, 0xbb, 0xbc, 0xbb, 0x9b, 0xbb, 0xcb, 0xac, 0xbb, 0x80, 0x41, 0x33, 0x25, 0x10, 0x11,
+ 0x21, 0x26, 0x65, 0x22, 0x23, 0x33, 0x22, 0x24, 0x33, 0x32, 0x33, 0x21, 0x07, 0x18, 0x81, 0x2a,
+ 0xb8, 0xd8, 0xcd, 0x88, 0xaa, 0xa0, 0xef, 0xab, 0xab, 0x99, 0xa9, 0xc9, 0xbb, 0xcb, 0xab, 0xa9,
+ 0xba, 0x1a, 0x0b, 0x17, 0x21, 0x10, 0x29, 0x54, 0x40, 0x15, 0x11, 0x33, 0x34, 0x34, 0x44, 0x11,
+ 0x30, 0xa8, 0x20, 0x22, 0x44, 0x14, 0x18, 0xfa, 0x88, 0x8c, 0x88, 0x90, 0x80, 0xbb, 0xfb, 0x9c,
+ 0xaa, 0xba, 0x88, 0xbb, 0xb8, 0xbb, 0xab, 0xb9, 0xca, 0x59, 0xcb, 0x53, 0x8a, 0x19, 0x03, 0x27,
+ 0x80, 0x92, 0x3c, 0x73, 0x22, 0x35, 0x80, 0x90, 0x11, 0x32, 0x73, 0x12, 0x20, 0x02, 0x22, 0x02,
+ 0xe3, 0x0f, 0x98, 0x09, 0x82, 0xcc, 0xa8, 0x9c, 0xb9, 0x0a, 0xbb, 0xda, 0xb8, 0x9d, 0xc9, 0x90,
+ 0x8d, 0xd0, 0x8d, 0x80, 0x99, 0x15, 0x29, 0x12, 0x55, 0x81, 0x14, 0x30, 0x73, 0x13, 0x34, 0x01,
+ 0x11, 0x01, 0x34, 0x10, 0x04, 0x18, 0x02, 0x80, 0xfb, 0x9c, 0xda, 0x9a, 0xb9, 0xac, 0xcb, 0xbb,
+ 0xbb, 0xdb, 0xab, 0xbb, 0xbb, 0x9c, 0xba, 0x88, 0x18, 0x80, 0x33, 0x63, 0x52, 0x32, 0x27, 0x52,
+ 0x25, 0xf9, 0x31, 0x00, 0x42, 0x33, 0x22, 0x21, 0x15, 0x42, 0x22, 0x12, 0x21, 0x82, 0x30, 0x23,
+ 0x01, 0xdd, 0xfb, 0xac, 0xa9, 0x80, 0x08, 0xdb, 0xdb, 0xac, 0xba, 0xa9, 0xaa, 0x99, 0xaa, 0x99,
+ 0xba, 0xac, 0xb9, 0x0b, 0x20, 0x36, 0x43, 0x25, 0x32, 0x53, 0x14, 0x31, 0x23, 0x35, 0x35, 0x44,
+ 0x11, 0x11, 0x01, 0x18, 0x13, 0x32, 0x12, 0x11, 0x01, 0xa3, 0xfd, 0xbc, 0x9c, 0xac, 0xa9, 0xa9,
+ 0x9a, 0xdb, 0xac, 0xdb, 0xcb, 0xba, 0x99, 0x01, 0x09, 0xa0, 0x8c, 0xdb, 0x88, 0x18, 0x62, 0x23,
+ 0x44, 0x12, 0x10, 0x82, 0x44, 0x20, 0x27, 0x31, 0x33, 0x18, 0x13, 0x18, 0x90, 0x88, 0x92, 0x74,
+ 0x00, 0xa1, 0xbc, 0xaa, 0xdb, 0xa8, 0xae, 0xb9, 0x9b, 0x21, 0xdb, 0xf0, 0x8d, 0xb8, 0x1a, 0xb0,
+ 0x8a, 0xd8, 0x1b, 0x90, 0x73, 0x81, 0x41, 0x91, 0x73, 0x01, 0x24, 0x40, 0x24, 0x32, 0x04, 0x10,
+ 0x02, 0x31, 0x24, 0x01, 0x01, 0x39, 0xa9, 0xd8, 0xfa, 0x9a, 0xcc, 0x99, 0xac, 0xba, 0xbc, 0xc9,
+ 0xbb, 0xca, 0xbb, 0xda, 0x9a, 0x9a, 0x98, 0x99, 0x88, 0xaa, 0x21, 0x54, 0x42, 0x34, 0x43, 0x24,
+ 0x24, 0x53, 0x22, 0x33, 0x43, 0x43, 0x23, 0x33, 0x31, 0x33, 0x16, 0x24, 0x10, 0xc8, 0xae, 0x99,
+ 0x19, 0x81, 0xb0, 0xbf, 0xcb, 0xac, 0xaa, 0xbb, 0xbb, 0xdb, 0xab, 0xba, 0x9e, 0xaa, 0x9b, 0x89,
+ 0x01, 0x08, 0x11, 0x11, 0x27, 0x53, 0x22, 0x34, 0x52, 0x24, 0x43, 0x33, 0x32, 0x43, 0x12, 0x43,
+ 0x32, 0x34, 0x23, 0x22, 0x12, 0xb0, 0xae, 0xaa, 0xbb, 0xb1, 0xbf, 0xf9, 0xab, 0xbb, 0xac, 0xea,
+ 0xb9, 0xaa, 0x9b, 0xca, 0xb9, 0xbc, 0xa0, 0x99, 0x38, 0x9a, 0x12, 0x41, 0x43, 0x33, 0x73, 0x63,
+ 0x22, 0x52, 0x12, 0x52, 0x12, 0x31, 0x43, 0x33, 0x22, 0x23, 0x49, 0x01, 0x11, 0x32, 0x09, 0xf3,
+ 0xe2, 0x0e, 0x26, 0x00, 0xd0, 0xac, 0xac, 0xb9, 0xab, 0xdc, 0xba, 0xbc, 0x99, 0xab, 0xaa, 0xf9,
+ 0x89, 0xaa, 0x88, 0xcb, 0x09, 0x19, 0x34, 0x02, 0x25, 0x80, 0x61, 0x12, 0x57, 0x00, 0x04, 0x18,
+ 0x33, 0x62, 0x13, 0x22, 0x11, 0x30, 0x10, 0x55, 0x11, 0x11, 0x90, 0x2a, 0xbc, 0xb0, 0xab, 0xab,
+ 0xaf, 0xda, 0xbb, 0xeb, 0xbb, 0xb9, 0x9c, 0xba, 0x9c, 0xbc, 0xa9, 0xaa, 0x98, 0x89, 0x9a, 0x8b,
+ 0x12, 0x70, 0x15, 0x24, 0x22, 0x52, 0x31, 0x34, 0x53, 0x12, 0x34, 0x32, 0x24, 0x41, 0x12, 0x33,
+ 0x24, 0x13, 0xaa, 0xbd, 0x18, 0x48, 0x03, 0xd9, 0xbb, 0xcf, 0xaa, 0x8a, 0xa9, 0x9d, 0xc9, 0x9a,
+ 0xca, 0x9a, 0xbc, 0x98, 0x9a, 0xa9, 0xa9, 0x19, 0x9a, 0x60, 0x00, 0x02, 0x28, 0x61, 0x45, 0x24,
+ 0x23, 0x14, 0x21, 0x32, 0x73, 0x22, 0x24, 0x11, 0x32, 0x00, 0x12, 0x31, 0x82, 0x48, 0x01, 0x9b,
+ 0xfb, 0xca, 0xc8, 0x9a, 0xaf, 0xca, 0x9a, 0xb9, 0xba, 0xac, 0xcb, 0xbb, 0xad, 0xaa, 0x99, 0xc0,
+ 0x29, 0xa9, 0x3b, 0xb0, 0x82, 0x23, 0x66, 0x11, 0x73, 0x01, 0x13, 0x33, 0x44, 0x10, 0x12, 0x26,
+ 0x21, 0x24, 0x02, 0x18, 0x81, 0x00, 0x09, 0x02, 0x08, 0xa4, 0xa8, 0xe8, 0xaf, 0xba, 0xbc, 0x8b,
+ 0x9c, 0xf3, 0x0a, 0xbb, 0xda, 0xa0, 0x0c, 0xa8, 0xa8, 0x9a, 0xae, 0x83, 0x59, 0x80, 0x22, 0x80,
+ 0x32, 0x12, 0x72, 0x06, 0x42, 0x21, 0x53, 0x13, 0x43, 0x01, 0x34, 0x28, 0x13, 0x24, 0x33, 0x30,
+ 0x83, 0x19, 0xd8, 0xd8, 0x09, 0x8c, 0xda, 0xb8, 0xbd, 0xbb, 0xcc, 0xaa, 0xbc, 0xca, 0xbb, 0xbb,
+ 0x9b, 0xcb, 0xbb, 0xc9, 0xad, 0x08, 0x89, 0x21, 0x08, 0x84, 0x42, 0x41, 0x33, 0x17, 0x52, 0x32,
+ 0x33, 0x35, 0x33, 0x13, 0x33, 0x48, 0x26, 0x62, 0x01, 0x11, 0x88, 0x00, 0x90, 0x80, 0xba, 0xba,
+ 0xac, 0x0f, 0x20, 0x00, 0xea, 0xac, 0xcc, 0xcb, 0xba, 0xab, 0xcc, 0xba, 0x9d, 0xaa, 0xa9, 0xbc,
+ 0xaa, 0x9c, 0x99, 0x19, 0x01, 0x10, 0x12, 0x51, 0x42, 0x24, 0x22, 0x47, 0x31, 0x23, 0x24, 0x24,
+ 0x21, 0x34, 0x32, 0x15, 0x12, 0x33, 0x31, 0x94, 0x38, 0xa0, 0x08, 0xcb, 0xaa, 0xfd, 0x9b, 0xab,
+ 0xca, 0xdb, 0xaa, 0xbc, 0xac, 0xbc, 0x98, 0xaa, 0xab, 0xbe, 0xb8, 0x99, 0x00, 0x8a, 0x03, 0x1e,
+ 0x31, 0x81, 0x35, 0x10, 0x27, 0x58, 0x32, 0x21, 0x05, 0x31, 0x13, 0x63, 0x14, 0x22, 0x01, 0x11,
+ 0x01, 0x01, 0x43, 0x23, 0x2b, 0xfa, 0xb9, 0xba, 0x9d, 0x88, 0xca, 0xda, 0xa9, 0xae, 0xca, 0x9c,
+ 0x19, 0x98, 0x91, 0xba, 0xec, 0x9b, 0x9a, 0x30, 0x11, 0x88, 0xd8, 0x08, 0x1b, 0x27, 0x32, 0x73,
+ 0x80, 0x11, 0x00, 0x25, 0x23, 0x44, 0x31, 0x13, 0x43, 0x32, 0x40, 0x03, 0x61, 0x11, 0x21, 0x01,
+ 0x38, 0xc0, 0x98, 0xbc, 0xb4, 0x9c, 0x9c, 0x9c, 0xb8, 0xeb, 0xa9, 0xca, 0xc9, 0x8c, 0x9a, 0xa9,
+ 0xc9, 0x9a, 0x99, 0xab, 0x98, 0x0c, 0x81, 0x28, 0xb0, 0x63, 0x01, 0x38, 0x35, 0x72, 0x84, 0x30,
+ 0x14, 0x32, 0x28, 0x54, 0x11, 0x81, 0x80, 0x24, 0x10, 0x11, 0x50, 0x82, 0xaa, 0x91, 0x28, 0xfc,
+ 0xa0, 0x1a, 0xbc, 0xc8, 0x1a, 0xb9, 0xad, 0xbe, 0x98, 0x9a, 0xc8, 0x9a, 0x9d, 0xc9, 0x9b, 0x88,
+ 0x91, 0x8f, 0x98, 0xb8, 0xc9, 0x32, 0x5b, 0x02, 0x11, 0x81, 0x32, 0x12, 0x27, 0x70, 0x01, 0x12,
+ 0x40, 0x11, 0x04, 0x02, 0x31, 0x32, 0x13, 0x38, 0xb2, 0xeb, 0x49, 0xf8, 0x89, 0xba, 0xba, 0x21,
+ 0x1a, 0xbb, 0xf9, 0xbd, 0xab, 0xab, 0x82, 0xc8, 0x99, 0x0e, 0x00, 0xac, 0x89, 0xc0, 0x14, 0x32,
+ 0x38, 0x11, 0x9c, 0x14, 0x52, 0x04, 0x40, 0x01, 0x26, 0x18, 0x58, 0x01, 0x20, 0xb1, 0x35, 0x40,
+ 0x6f, 0x02, 0x23, 0x00, 0x33, 0x98, 0x28, 0x3b, 0x09, 0x87, 0x23, 0x28, 0x0c, 0x93, 0xaf, 0xc0,
+ 0xa9, 0xaa, 0x48, 0xa0, 0x99, 0xbf, 0xbc, 0xd0, 0x10, 0x1b, 0x99, 0x99, 0xa1, 0x9d, 0x19, 0x89,
+ 0x97, 0x20, 0x11, 0x7b, 0xa2, 0x4a, 0x91, 0x25, 0x20, 0x02, 0x16, 0x01, 0x09, 0x1a, 0x24, 0x24,
+ 0x82, 0x60, 0x91, 0x18, 0x20, 0x82, 0x90, 0x4d, 0x93, 0x41, 0x9b, 0x08, 0xfa, 0xa0, 0x1d, 0x10,
+ 0xb9, 0xa8, 0xbc, 0x18, 0x9f, 0x00, 0xa8, 0xd1, 0x09, 0x09, 0x0b, 0xf8, 0x89, 0x10, 0x39, 0xa0,
+ 0x20, 0xd8, 0xc1, 0x10, 0x73, 0x31, 0x80, 0x98, 0x92, 0xfb, 0x13, 0x59, 0x83, 0x88, 0x08, 0xa8,
+ 0x0c, 0x90, 0x52, 0x21, 0xa5, 0x10, 0x78, 0x02, 0xab, 0xf0, 0x9a, 0xba, 0x70, 0x11, 0x88, 0x9a,
+ 0xf9, 0x99, 0x8a, 0x80, 0x19, 0xb0, 0x19, 0xfc, 0xa9, 0x0b, 0x19, 0x12, 0x09, 0x88, 0xa2, 0x91,
+ 0x50, 0x20, 0x14, 0x20, 0x78, 0x04, 0x23, 0x48, 0x93, 0x28, 0x98, 0x49, 0x35, 0x94, 0x21, 0x2a,
+ 0xe1, 0x8a, 0x08, 0x40, 0x12, 0x26, 0x89, 0xb8, 0x2d, 0x99, 0x32, 0xa1, 0x9b, 0x41, 0xfa, 0xbb,
+ 0x1d, 0xa2, 0x10, 0x9d, 0x0a, 0xe9, 0xba, 0x31, 0x18, 0x9e, 0x00, 0x12, 0x89, 0x2c, 0x53, 0x14,
+ 0x11, 0x08, 0x85, 0x2c, 0x81, 0x52, 0x13, 0x32, 0x83, 0x50, 0x41, 0x91, 0x81, 0x41, 0x32, 0x32,
+ 0x97, 0x98, 0x0d, 0x88, 0x83, 0x3c, 0xc4, 0x18, 0x0a, 0xc0, 0x0d, 0xa0, 0x08, 0x80, 0x82, 0x3e,
+ 0xca, 0xd1, 0x9a, 0xa2, 0x5a, 0x89, 0x90, 0xaa, 0x8c, 0x90, 0xbb, 0x25, 0x32, 0x89, 0x03, 0xbf,
+ 0x93, 0x3e, 0x93, 0x44, 0x00, 0x86, 0x0b, 0x1b, 0x83, 0x20, 0xb2, 0x4e, 0xc1, 0x19, 0x01, 0x92,
+ 0x48, 0x98, 0x33, 0x1c, 0xa5, 0x00, 0x09, 0x88, 0x8a, 0xc8, 0x98, 0x92, 0x1f, 0x81, 0xca, 0x13,
+ 0x9d, 0x00, 0x17, 0x00, 0x91, 0xfc, 0x89, 0x2e, 0x80, 0x08, 0xa0, 0x88, 0x90, 0xa0, 0x67, 0x1b,
+ 0x80, 0x03, 0x22, 0x88, 0x1a, 0x68, 0xa1, 0x06, 0x92, 0x49, 0x92, 0x08, 0x89, 0xdd, 0xa0, 0x72,
+ 0x00, 0x30, 0xb1, 0xc2, 0x18, 0x0a, 0x10, 0x90, 0xd2, 0x19, 0x2a, 0x39, 0xc2, 0xa3, 0x2b, 0xfa,
+ 0x39, 0x1f, 0x12, 0x8a, 0x88, 0xf8, 0x89, 0xa9, 0x49, 0xb2, 0x19, 0x0c, 0xeb, 0xaa, 0x80, 0x99,
+ 0x52, 0xaa, 0xd0, 0x8b, 0xac, 0x13, 0x0b, 0x84, 0x8a, 0x19, 0x17, 0x6c, 0x91, 0x98, 0xa3, 0x28,
+ 0x8a, 0x31, 0x56, 0x00, 0xb1, 0x10, 0xbd, 0x19, 0x02, 0x11, 0x11, 0xb2, 0x4d, 0xa8, 0x27, 0x41,
+ 0x01, 0x11, 0x88, 0x99, 0x15, 0x8b, 0x94, 0x9c, 0xba, 0x1d, 0xc2, 0x18, 0xb8, 0x8a, 0xef, 0x89,
+ 0xa1, 0x29, 0x02, 0x9c, 0xa1, 0x9c, 0xa2, 0x89, 0x46, 0x31, 0x91, 0x12, 0xf9, 0x09, 0x48, 0x21,
+ 0x21, 0x84, 0xb8, 0xbd, 0x9b, 0x61, 0x82, 0x22, 0x80, 0xbe, 0x98, 0xbb, 0x59, 0x16, 0x01, 0x81,
+ 0xaa, 0x90, 0x5a, 0x02, 0x25, 0x89, 0x98, 0xa1, 0x80, 0x30, 0xbf, 0x14, 0xe9, 0x3a, 0xb0, 0x9e,
+ 0x01, 0x99, 0x22, 0x90, 0x49, 0xb9, 0xc1, 0x39, 0xf0, 0x30, 0x33, 0x72, 0x15, 0x00, 0x09, 0x09,
+ 0x91, 0x13, 0x23, 0x19, 0xea, 0x89, 0x2c, 0x94, 0x8a, 0x11, 0xfb, 0x11, 0xab, 0x32, 0xbc, 0x38,
+ 0xb4, 0x1f, 0x90, 0x10, 0x91, 0x23, 0xbb, 0x73, 0x92, 0xd0, 0xc9, 0xac, 0x2b, 0xc1, 0x44, 0x11,
+ 0x99, 0x18, 0xd8, 0x2a, 0xc0, 0x28, 0x43, 0x38, 0x41, 0xe2, 0xa9, 0xa9, 0x3a, 0x71, 0x15, 0x90,
+ 0x88, 0x99, 0xad, 0x21, 0x01, 0x34, 0x90, 0xae, 0x99, 0xa9, 0x39, 0x26, 0x01, 0x9a, 0xf9, 0x29,
+ 0x98, 0x22, 0x0a, 0x92, 0xaf, 0x93, 0x49, 0x81, 0x00, 0x80, 0x9e, 0xa2, 0x8e, 0x42, 0x22, 0x01,
+ 0x3c, 0x01, 0x24, 0x00, 0xdc, 0x0a, 0xb8, 0x71, 0x01, 0x21, 0x90, 0x10, 0xcc, 0x00, 0x89, 0x73,
+ 0x01, 0xb0, 0x8a, 0xc0, 0x1d, 0x12, 0x01, 0x33, 0xaa, 0xa0, 0xdd, 0x28, 0x08, 0x51, 0xb2, 0x9e,
+ 0xa3, 0x8d, 0x22, 0x18, 0x42, 0xa1, 0xfa, 0x80, 0x9a, 0x38, 0x92, 0x21, 0xd0, 0x19, 0x89, 0xcb,
+ 0x33, 0xc9, 0x63, 0x90, 0x44, 0xca, 0x28, 0xb0, 0x48, 0xa1, 0x34, 0x8a, 0x89, 0xbb, 0xb1, 0x67,
+ 0x83, 0x48, 0xd9, 0x99, 0xab, 0x62, 0x11, 0x80, 0x98, 0xa9, 0xac, 0x42, 0xb0, 0x70, 0xa2, 0x09,
+ 0xa2, 0xad, 0x22, 0xb0, 0x71, 0x80, 0xa8, 0x02, 0x08, 0x2d, 0x83, 0xa8, 0x98, 0x50, 0xcb, 0x78,
+ 0xc0, 0x20, 0xa1, 0x0a, 0x88, 0x29, 0xd4, 0x3a, 0x13, 0x9e, 0x32, 0xc9, 0x81, 0x3a, 0x11, 0x8a,
+ 0x24, 0x22, 0xfb, 0x00, 0xcb, 0x69, 0xa1, 0x23, 0xc0, 0x4b, 0xa1, 0x9c, 0x04, 0xea, 0x48, 0x80,
+ 0xa0, 0x21, 0x18, 0x98, 0x98, 0x20, 0x7b, 0xf2, 0x21, 0x09, 0x1b, 0x94, 0xaa, 0x35, 0xcb, 0x3b,
+ 0xb5, 0x2d, 0x83, 0x0a, 0xb3, 0x0a, 0xe0, 0x30, 0x01, 0x2b, 0xa7, 0x2b, 0x00, 0x1b, 0xf3, 0x40,
+ 0x8a, 0x81, 0x81, 0x1d, 0x93, 0x9b, 0x37, 0x8d, 0x02, 0xa0, 0x89, 0x21, 0xba, 0x33, 0x8b, 0xa1,
+ 0x23, 0x9f, 0x60, 0xc9, 0x24, 0x0b, 0x81, 0x9b, 0x31, 0x91, 0x0a, 0xa5, 0x3b, 0xe4, 0x2d, 0x84,
+ 0xaa, 0x24, 0xb0, 0x5b, 0x81, 0x9e, 0x03, 0x0a, 0xb3, 0x7b, 0xa1, 0x3a, 0xd3, 0x19, 0x02, 0x8c,
+ 0x00, 0x92, 0x5a, 0xb2, 0x1b, 0x97, 0x2a, 0x0a, 0xb1, 0x40, 0xa1, 0x6a, 0xa0, 0x10, 0x90, 0x89,
+ 0x60, 0xe2, 0x3b, 0x93, 0x9a, 0x41, 0x81, 0x0f, 0x94, 0x8b, 0x13, 0x1f, 0xb3, 0x09, 0x93, 0x2a,
+ 0x90, 0x98, 0x4a, 0x88, 0xc2, 0x31, 0x8a, 0x32, 0x59, 0xf2, 0x18, 0xc1, 0x4b, 0x91, 0x89, 0x53,
+ 0x1d, 0x04, 0x2f, 0x00, 0x9f, 0x41, 0xd1, 0x80, 0x30, 0xbb, 0x30, 0xd1, 0x10, 0x38, 0xb9, 0x13,
+ 0xa8, 0x0c, 0xa9, 0xa4, 0x3e, 0x86, 0x0a, 0x01, 0xa1, 0x0e, 0x85, 0xaa, 0x32, 0xc9, 0x32, 0x08,
+ 0xad, 0x25, 0xaa, 0x11, 0x08, 0xa8, 0x3c, 0xa4, 0x88, 0x42, 0x9b, 0xa4, 0x1c, 0x90, 0x00, 0x40,
+ 0x28, 0xb4, 0x38, 0xb8, 0xbf, 0x25, 0x8e, 0x83, 0x08, 0x81, 0x4b, 0xd4, 0x5b, 0x80, 0x9a, 0x03,
+ 0x9a, 0x00, 0x03, 0x98, 0x58, 0xc9, 0x18, 0x3b, 0xc5, 0x09, 0x83, 0x1a, 0x82, 0x18, 0xce, 0x15,
+ 0xac, 0x32, 0x0b, 0x11, 0xb7, 0x6a, 0x98, 0x98, 0x82, 0x3b, 0xa3, 0x09, 0x19, 0xa2, 0x10, 0xbc,
+ 0x74, 0xf1, 0x01, 0x00, 0x0c, 0x81, 0xa2, 0x79, 0x90, 0x08, 0xbb, 0x16, 0x9a, 0x30, 0xb8, 0x42,
+ 0xda, 0x40, 0xb0, 0x18, 0x88, 0x00, 0x00, 0x39, 0x18, 0xcc, 0x06, 0x0c, 0x99, 0x24, 0xc9, 0x60,
+ 0xb0, 0x10, 0x8a, 0xa2, 0x48, 0xa1, 0x1c, 0x02, 0xb0, 0x28, 0x97, 0x5c, 0xa1, 0x0b, 0x82, 0xa8,
+ 0x4c, 0xa5, 0x3a, 0xb3, 0x4a, 0xd9, 0x58, 0xe1, 0x39, 0xa2, 0x2b, 0x95, 0x0b, 0x83, 0x1a, 0xb0,
+ 0x50, 0xd8, 0x11, 0x1a, 0xa1, 0x4b, 0xa7, 0x1a, 0x81, 0x0a, 0x81, 0x10, 0x0c, 0x32, 0xd1, 0x4a,
+ 0xa4, 0x8b, 0x58, 0xe2, 0x3a, 0xa4, 0x09, 0x10, 0xa8, 0x81, 0x31, 0xae, 0x02, 0xa0, 0x7b, 0x90,
+ 0xa8, 0x23, 0xb9, 0x21, 0x1d, 0x83, 0x8d, 0xa3, 0x48, 0x0a, 0xd3, 0x79, 0xb8, 0x21, 0xa9, 0x4c,
+ 0x82, 0xa9, 0x04, 0x8c, 0x86, 0x1b, 0x81, 0x3a, 0xf2, 0x49, 0xc2, 0x3a, 0x92, 0x0b, 0x04, 0xa9,
+ 0x38, 0x89, 0x98, 0x40, 0xd3, 0x18, 0x01, 0xba, 0x60, 0xe0, 0x59, 0xa8, 0x00, 0x91, 0x92, 0x0c,
+ 0x21, 0xd8, 0x21, 0x3b, 0xe0, 0x08, 0x84, 0xa9, 0x61, 0xb8, 0x20, 0xc0, 0x39, 0xa0, 0x38, 0xa1,
+ 0xe0, 0xfd, 0x2e, 0x00, 0x72, 0xba, 0x14, 0x9c, 0x97, 0x4b, 0x80, 0x1b, 0xa4, 0x28, 0xa8, 0x69,
+ 0xd8, 0x30, 0xa8, 0x29, 0x92, 0x09, 0x29, 0xa8, 0x92, 0x48, 0x99, 0x69, 0xe3, 0x1b, 0x13, 0x9c,
+ 0x82, 0x82, 0x11, 0x8f, 0x82, 0xa8, 0x28, 0x12, 0xeb, 0x13, 0x6a, 0xca, 0x33, 0xca, 0x10, 0x02,
+ 0x8b, 0x23, 0xd0, 0x70, 0x9a, 0x11, 0xa0, 0x9a, 0x87, 0x1a, 0x92, 0x5b, 0xe3, 0x3a, 0x81, 0xb9,
+ 0x41, 0xb8, 0x38, 0x20, 0xf9, 0x18, 0x31, 0xcd, 0x32, 0xd1, 0x49, 0xa8, 0x18, 0xa4, 0x98, 0x5b,
+ 0xb3, 0x2e, 0xa4, 0x88, 0x20, 0x89, 0x98, 0x02, 0xa1, 0x2e, 0xa3, 0x5b, 0xc1, 0x11, 0x8a, 0x38,
+ 0xb8, 0x95, 0x89, 0x30, 0xe0, 0x68, 0xb0, 0x49, 0xa1, 0x0c, 0x87, 0x9a, 0x31, 0x9a, 0x08, 0x03,
+ 0xe9, 0x12, 0x09, 0x09, 0x91, 0x2c, 0xb5, 0x2a, 0xa4, 0x2d, 0x93, 0x1d, 0xb3, 0x0a, 0x51, 0xd9,
+ 0x11, 0xa0, 0x21, 0x09, 0x29, 0x94, 0x0e, 0x94, 0x19, 0xd0, 0x42, 0xab, 0x42, 0xe8, 0x21, 0x9b,
+ 0x04, 0x1b, 0xa5, 0x2c, 0x82, 0x1d, 0x81, 0xa8, 0x13, 0x0a, 0x28, 0x8e, 0x94, 0x08, 0x81, 0x29,
+ 0xb9, 0x25, 0x8f, 0x01, 0xc3, 0x3a, 0x80, 0x0a, 0x02, 0x48, 0xae, 0x04, 0xb1, 0x7b, 0xb8, 0x03,
+ 0x18, 0x2b, 0xc1, 0x38, 0xa2, 0xda, 0x15, 0x8c, 0x42, 0xea, 0x32, 0xd9, 0x31, 0xa9, 0x00, 0x19,
+ 0x92, 0x0a, 0x33, 0xdb, 0xa1, 0x52, 0x9d, 0x83, 0xa0, 0x61, 0x8c, 0x13, 0xad, 0x13, 0x99, 0x01,
+ 0x00, 0x2d, 0xa2, 0xf1, 0x50, 0xa9, 0x38, 0xa2, 0x2c, 0xb3, 0x28, 0x88, 0x4a, 0xb1, 0x08, 0x38,
+ 0xdd, 0x53, 0xc0, 0x6a, 0xd2, 0x18, 0x91, 0x1a, 0xb2, 0x21, 0x8a, 0x20, 0xb0, 0x8b, 0x27, 0x9d,
+ 0x31, 0xa9, 0x81, 0x3a, 0xa6, 0x0c, 0x04, 0xaa, 0x41, 0xd8, 0x10, 0x39, 0x9b, 0x85, 0x0b, 0x05,
+ 0x33, 0xff, 0x3a, 0x00, 0x4a, 0xc1, 0x00, 0xa1, 0x28, 0x3a, 0xd8, 0x23, 0x9b, 0x85, 0x2e, 0xa4,
+ 0x0b, 0x84, 0x0b, 0x03, 0x1b, 0x92, 0x8a, 0x44, 0xad, 0x14, 0xba, 0x33, 0xca, 0x11, 0x4b, 0xd2,
+ 0x29, 0x92, 0x9b, 0x24, 0x9c, 0x58, 0xd1, 0x39, 0xc3, 0x09, 0x22, 0x9e, 0x23, 0xab, 0x93, 0x28,
+ 0x2d, 0x84, 0x9b, 0x92, 0x19, 0x03, 0x9f, 0x86, 0x2b, 0x93, 0x9c, 0x05, 0x9a, 0x32, 0x8c, 0x00,
+ 0x82, 0xab, 0x34, 0x8e, 0x13, 0xc9, 0x31, 0xb0, 0x39, 0xe1, 0x58, 0xa9, 0x82, 0x90, 0x48, 0xb9,
+ 0x30, 0xe5, 0x4b, 0x81, 0xb8, 0x40, 0x88, 0x8b, 0x01, 0xa5, 0x3f, 0xc5, 0x39, 0xc1, 0x38, 0xa9,
+ 0x23, 0x8e, 0x04, 0xaa, 0x32, 0x8b, 0xa1, 0x20, 0xc1, 0x88, 0x51, 0xa8, 0x1d, 0x96, 0x0a, 0x12,
+ 0x9c, 0x84, 0x19, 0xb0, 0x58, 0xd1, 0x38, 0xa0, 0x00, 0x1b, 0x96, 0x1c, 0x02, 0x0c, 0x82, 0x98,
+ 0x18, 0x93, 0x0c, 0x00, 0x40, 0xe8, 0x40, 0x99, 0xa2, 0x6a, 0xa1, 0x1a, 0x98, 0x96, 0x2c, 0xb2,
+ 0x6a, 0xc1, 0x59, 0xb0, 0x10, 0x90, 0x08, 0x01, 0xaa, 0x52, 0xca, 0x42, 0xaa, 0x21, 0xba, 0x25,
+ 0xdb, 0x60, 0xb8, 0x20, 0xc1, 0x38, 0x90, 0x88, 0x38, 0xf0, 0x20, 0x98, 0x58, 0xba, 0x23, 0x98,
+ 0x0a, 0x34, 0xdc, 0x31, 0xd8, 0x13, 0x1e, 0x81, 0x09, 0x83, 0x8c, 0x04, 0xca, 0x70, 0xb8, 0x00,
+ 0x81, 0x90, 0x18, 0x88, 0x81, 0xa8, 0x70, 0xa8, 0x19, 0xb5, 0x1a, 0x12, 0xb9, 0x70, 0xa9, 0x11,
+ 0xa9, 0x94, 0x2a, 0xa3, 0x2a, 0xe2, 0x21, 0x4b, 0xc9, 0x02, 0x92, 0x1c, 0x32, 0xbc, 0x71, 0xb0,
+ 0x0a, 0x86, 0x1b, 0x90, 0x82, 0x4e, 0xb0, 0x81, 0x81, 0x7b, 0xb9, 0x03, 0x88, 0x99, 0x52, 0xb0,
+ 0x1b, 0x85, 0x1a, 0x58, 0xe8, 0x10, 0x93, 0x0e, 0x11, 0x90, 0x1b, 0x84, 0x8a, 0x21, 0x8c, 0x03,
+ 0x18, 0xfd, 0x30, 0x00, 0x38, 0xa5, 0x6c, 0xd1, 0x59, 0xd1, 0x38, 0xa0, 0x08, 0x81, 0x89, 0x11,
+ 0xb0, 0x40, 0x9b, 0x95, 0x8a, 0x14, 0x8c, 0x58, 0xe0, 0x40, 0xc0, 0x28, 0x90, 0x20, 0x8d, 0x85,
+ 0x0c, 0x84, 0x1b, 0xa2, 0x19, 0x91, 0x09, 0x10, 0xd0, 0x61, 0xb9, 0x22, 0x8c, 0x21, 0x9a, 0x31,
+ 0x9b, 0x95, 0x89, 0x48, 0xb4, 0x0c, 0x32, 0x9c, 0x2a, 0x95, 0x0b, 0x12, 0x1c, 0xc4, 0x39, 0xa0,
+ 0x48, 0xc0, 0x19, 0x03, 0x0e, 0x12, 0xb8, 0x12, 0x9b, 0x71, 0xd8, 0x31, 0xf0, 0x59, 0xc0, 0x30,
+ 0xa9, 0x20, 0x89, 0x01, 0x89, 0x90, 0x50, 0xab, 0x14, 0x8b, 0x93, 0x68, 0xb9, 0x93, 0x3f, 0xa2,
+ 0x1d, 0x86, 0x0c, 0x02, 0x9a, 0x13, 0x99, 0x39, 0xf0, 0x40, 0xb8, 0x30, 0xb9, 0x41, 0xd0, 0x59,
+ 0xb1, 0x2a, 0x93, 0x2d, 0xb2, 0x5a, 0xa0, 0x3a, 0xc3, 0x3a, 0x82, 0x9c, 0x13, 0x8c, 0x85, 0x1c,
+ 0x94, 0x1c, 0x94, 0x0b, 0x03, 0x9b, 0x22, 0xc9, 0x51, 0xd9, 0x32, 0xca, 0x33, 0x9c, 0x21, 0xb9,
+ 0x50, 0xb8, 0x20, 0x91, 0x3c, 0xc4, 0x29, 0xa2, 0x1c, 0x85, 0x8e, 0x05, 0x0c, 0x83, 0x8a, 0x02,
+ 0x89, 0x80, 0x80, 0x09, 0x80, 0xb2, 0x32, 0x0f, 0x82, 0x2e, 0xe3, 0x5a, 0xa1, 0x1c, 0x85, 0x0b,
+ 0x83, 0x0b, 0xa3, 0x29, 0xa3, 0x1d, 0x01, 0x88, 0xa3, 0x2c, 0x33, 0xdf, 0x24, 0x9c, 0x42, 0xca,
+ 0x22, 0x9a, 0x20, 0x88, 0x09, 0x90, 0x21, 0xab, 0x33, 0xf0, 0x69, 0xb1, 0x3b, 0x84, 0x0e, 0x02,
+ 0x9a, 0x13, 0x0b, 0x08, 0x98, 0x86, 0x0c, 0x02, 0x0a, 0x99, 0x87, 0x2b, 0xc8, 0x23, 0xaa, 0x61,
+ 0xf0, 0x48, 0xa0, 0x1a, 0x93, 0x0a, 0x82, 0x3a, 0x10, 0xfa, 0x40, 0xb0, 0x38, 0xc1, 0x59, 0x89,
+ 0x81, 0xa9, 0x14, 0xaa, 0x60, 0xa8, 0x89, 0x03, 0xc8, 0x70, 0xaa, 0x22, 0xb8, 0x40, 0xcb, 0x14,
+ 0x75, 0xfe, 0x38, 0x00, 0x19, 0xb4, 0x29, 0x00, 0x8b, 0x95, 0x89, 0x23, 0x8e, 0x38, 0xf2, 0x10,
+ 0x00, 0x2c, 0xb2, 0x79, 0xc0, 0x00, 0x81, 0x2a, 0xa8, 0x13, 0x8a, 0x48, 0x89, 0xc8, 0x23, 0xab,
+ 0x86, 0x6c, 0xa8, 0x80, 0x10, 0xc2, 0x3c, 0xa5, 0x8b, 0x06, 0x9b, 0x22, 0x98, 0x09, 0x18, 0x88,
+ 0xc3, 0x01, 0x09, 0x29, 0x1c, 0xa1, 0x15, 0xf1, 0x5b, 0x93, 0x9d, 0x05, 0x8a, 0x00, 0x29, 0xb3,
+ 0x0c, 0x86, 0x0b, 0x12, 0xaa, 0x84, 0x1a, 0x29, 0xb0, 0x25, 0xfb, 0x42, 0xaa, 0x10, 0x01, 0x9d,
+ 0x14, 0x1d, 0xa3, 0x1a, 0xb3, 0x3a, 0xb1, 0x3a, 0xa5, 0x2f, 0x92, 0x1b, 0xb4, 0x30, 0xab, 0x13,
+ 0x9d, 0x34, 0xbc, 0x04, 0x0a, 0x84, 0x2e, 0xb5, 0x3b, 0xb3, 0x2b, 0xb4, 0x6a, 0xb0, 0x39, 0x82,
+ 0x0e, 0x83, 0x9a, 0x31, 0xd8, 0x10, 0x91, 0x4c, 0x90, 0x20, 0xf2, 0x28, 0x98, 0x20, 0xc8, 0x20,
+ 0x92, 0x9d, 0x43, 0x9c, 0x22, 0xe9, 0x20, 0x08, 0x19, 0x99, 0x85, 0x0c, 0x05, 0xab, 0x53, 0xd9,
+ 0x38, 0xa1, 0x08, 0x88, 0x31, 0xaa, 0x69, 0xe3, 0x49, 0xd1, 0x39, 0xb1, 0x48, 0xa8, 0x10, 0x98,
+ 0x03, 0x2f, 0x91, 0x8a, 0x83, 0x0a, 0x18, 0x95, 0x1d, 0x93, 0x9b, 0x16, 0xbb, 0x33, 0x8d, 0x94,
+ 0x1a, 0x84, 0x1f, 0x93, 0x0a, 0x02, 0x8b, 0x81, 0x18, 0x09, 0xa4, 0x0a, 0x13, 0x3a, 0x9c, 0xa3,
+ 0xf4, 0x48, 0x2b, 0x88, 0xa3, 0x3a, 0xb4, 0x18, 0x29, 0xbf, 0x06, 0xc8, 0x30, 0xb1, 0x79, 0xc0,
+ 0x38, 0xa1, 0x1a, 0x81, 0xc8, 0x7a, 0xc1, 0x38, 0xb1, 0x00, 0x08, 0x80, 0x08, 0xc0, 0x49, 0xa8,
+ 0x61, 0xd0, 0x21, 0x9a, 0x11, 0x2b, 0x80, 0xbd, 0x17, 0x0b, 0x32, 0xbb, 0x18, 0xb2, 0x82, 0xa0,
+ 0x78, 0xc9, 0x29, 0x15, 0xcb, 0x26, 0x9d, 0x21, 0xb8, 0x38, 0xa8, 0x02, 0xa8, 0x7a, 0xd1, 0x29,
+ 0xdb, 0x01, 0x38, 0x00, 0xd1, 0x3a, 0x04, 0x8f, 0x03, 0x0b, 0x93, 0x89, 0x93, 0x3a, 0xa8, 0x31,
+ 0xac, 0x86, 0x2a, 0xc1, 0x18, 0x80, 0x30, 0xad, 0x15, 0x1d, 0x91, 0x29, 0xe2, 0x49, 0xa0, 0x28,
+ 0x80, 0x08, 0x09, 0x89, 0x97, 0x2e, 0xa2, 0x29, 0xa1, 0x29, 0xa1, 0x10, 0xab, 0x63, 0xa9, 0xa1,
+ 0x52, 0xcc, 0x52, 0xc8, 0x31, 0xaa, 0x38, 0xe3, 0x18, 0x38, 0x8d, 0x84, 0xa9, 0x32, 0xe8, 0x59,
+ 0xa0, 0x08, 0x11, 0x9a, 0x50, 0xd1, 0x18, 0xa1, 0x11, 0x0f, 0x04, 0xab, 0x13, 0x99, 0x28, 0x18,
+ 0xe8, 0x23, 0xcb, 0x31, 0x98, 0x4b, 0xb2, 0x30, 0xc9, 0x03, 0xc0, 0x2d, 0x31, 0xba, 0x33, 0xd0,
+ 0x21, 0x2a, 0xe9, 0x1d, 0x04, 0x09, 0xa2, 0x2d, 0xa3, 0x00, 0x0a, 0x12, 0x0f, 0x93, 0xab, 0x86,
+ 0x1a, 0x32, 0xba, 0x4b, 0x07, 0xae, 0x34, 0x9e, 0x33, 0xbc, 0x24, 0xaa, 0x21, 0x99, 0x18, 0x20,
+ 0xf9, 0x20, 0x91, 0x1a, 0x84, 0xac, 0x52, 0xa8, 0x1a, 0xa5, 0x0a, 0x83, 0x1b, 0xb2, 0x50, 0xb0,
+ 0x20, 0x0c, 0x03, 0xae, 0x06, 0x0c, 0x03, 0x8a, 0x00, 0x81, 0x0c, 0x85, 0x8c, 0x11, 0x88, 0xb2,
+ 0x38, 0x02, 0x0f, 0x93, 0x9b, 0x32, 0xc8, 0x93, 0x4c, 0x81, 0x1a, 0x00, 0xc0, 0x10, 0xe2, 0x4a,
+ 0x91, 0x90, 0x10, 0x4b, 0xc1, 0x92, 0xa7, 0x2f, 0x92, 0x1c, 0x93, 0x89, 0x10, 0x94, 0x1c, 0x83,
+ 0x2f, 0xb1, 0x18, 0xa2, 0x4c, 0xa0, 0x49, 0xa0, 0x28, 0xb4, 0x2b, 0x05, 0x8f, 0x02, 0xaa, 0x15,
+ 0x0b, 0x81, 0x81, 0xa9, 0x71, 0xb9, 0x38, 0xc0, 0x08, 0x12, 0x08, 0x1b, 0x83, 0x1e, 0x95, 0x1b,
+ 0xa3, 0x89, 0x18, 0x90, 0x41, 0x90, 0x33, 0x2f, 0xf0, 0x11, 0xba, 0x41, 0xda, 0x52, 0xa8, 0x2a,
+ 0x13, 0xac, 0x24, 0xac, 0x02, 0x88, 0x3a, 0x09, 0x03, 0xb0, 0x13, 0x9f, 0x07, 0xb9, 0x68, 0xc9,
+ 0xdb, 0xfb, 0x3a, 0x00, 0x03, 0x9b, 0x04, 0x98, 0x81, 0x88, 0x2a, 0x11, 0xae, 0x03, 0xa0, 0x14,
+ 0x1b, 0x80, 0xa1, 0x3f, 0x97, 0x0d, 0x83, 0x0c, 0x02, 0xa0, 0x28, 0x22, 0xcb, 0x11, 0x18, 0xca,
+ 0x12, 0x0a, 0x2d, 0x23, 0xf8, 0x38, 0xd3, 0x18, 0x08, 0x39, 0x8f, 0x86, 0x8d, 0x03, 0xa9, 0x30,
+ 0x90, 0x2a, 0x95, 0xb8, 0x29, 0x33, 0x9f, 0x30, 0xe2, 0x00, 0x84, 0x0c, 0x21, 0xaa, 0x30, 0xa8,
+ 0x98, 0x83, 0x0a, 0xe3, 0x30, 0x2a, 0x48, 0xea, 0x08, 0x04, 0xba, 0x21, 0x3b, 0x94, 0x29, 0xd5,
+ 0x38, 0x19, 0xba, 0x31, 0xa0, 0xa4, 0x2c, 0xa1, 0x78, 0xb9, 0xb3, 0x6b, 0x93, 0x8f, 0x03, 0xab,
+ 0x43, 0xab, 0x05, 0x19, 0x98, 0x3b, 0x85, 0x8e, 0x84, 0x0b, 0x82, 0x19, 0xb1, 0x78, 0xb1, 0x3a,
+ 0x81, 0x0b, 0x4a, 0xa4, 0x80, 0x9b, 0x21, 0x30, 0x41, 0xdf, 0x04, 0x89, 0x10, 0xe9, 0x48, 0x80,
+ 0x0a, 0x83, 0x99, 0x5a, 0xb0, 0x00, 0xa3, 0x38, 0x9c, 0x04, 0xcc, 0x24, 0xa9, 0x61, 0xa8, 0x89,
+ 0x86, 0x0a, 0x29, 0xa9, 0x10, 0x92, 0x30, 0xf2, 0x5b, 0xa8, 0x30, 0x8c, 0xa5, 0x5a, 0xb1, 0x3a,
+ 0xb4, 0x29, 0x10, 0x8f, 0x03, 0x0a, 0x93, 0x0f, 0x04, 0xa9, 0x02, 0x1b, 0x00, 0x00, 0xfb, 0x42,
+ 0xba, 0x51, 0xca, 0x23, 0xa8, 0x38, 0xc8, 0x39, 0xa5, 0x0a, 0xa3, 0x7a, 0xa9, 0x21, 0xd1, 0x01,
+ 0x10, 0x0b, 0x00, 0xd1, 0x18, 0x91, 0x12, 0x82, 0x9f, 0x41, 0xda, 0x14, 0xd9, 0x58, 0xb1, 0x39,
+ 0xc0, 0x28, 0xa2, 0x31, 0xac, 0x81, 0xa2, 0x1c, 0x93, 0x8a, 0x35, 0x8b, 0xb8, 0x17, 0x0b, 0x02,
+ 0x9f, 0x02, 0x08, 0x0a, 0x40, 0xf2, 0x21, 0xa0, 0x1d, 0x85, 0xab, 0x43, 0xea, 0x41, 0xa9, 0x38,
+ 0x91, 0x1b, 0xa4, 0x8a, 0x14, 0x0c, 0x01, 0x0a, 0xa3, 0x80, 0xa3, 0x3f, 0x11, 0x9d, 0xa4, 0x19,
+ 0x2f, 0x01, 0x35, 0x00, 0x8a, 0x95, 0x89, 0x04, 0x1d, 0x91, 0x19, 0xa1, 0x81, 0x9b, 0x53, 0xa9,
+ 0x40, 0xd8, 0x12, 0x9b, 0x51, 0xd9, 0x32, 0x99, 0x98, 0x30, 0xaa, 0x32, 0xc6, 0x09, 0x04, 0x1e,
+ 0x01, 0xbb, 0x24, 0xc8, 0x38, 0xc1, 0x59, 0xd1, 0x20, 0xa0, 0x6b, 0x90, 0x9a, 0x96, 0x19, 0x21,
+ 0x9c, 0x22, 0xb9, 0x31, 0xb9, 0x38, 0xae, 0x17, 0xaa, 0x13, 0x0b, 0x13, 0xbc, 0x84, 0x88, 0x01,
+ 0x89, 0x39, 0x8c, 0x05, 0xf0, 0x40, 0xb8, 0x6a, 0xa1, 0x9a, 0x84, 0x18, 0x3b, 0xa2, 0x8a, 0x86,
+ 0x99, 0x22, 0x9c, 0x21, 0xe2, 0x39, 0x98, 0xa0, 0x20, 0x91, 0x01, 0x39, 0x99, 0x0f, 0xd6, 0x5a,
+ 0xc2, 0x38, 0xb1, 0x3a, 0x00, 0x1c, 0x23, 0xac, 0x01, 0xb1, 0x9b, 0x33, 0x4c, 0x2b, 0x01, 0xdc,
+ 0x07, 0x8b, 0x83, 0x2c, 0x01, 0xd9, 0x84, 0x89, 0x30, 0xa9, 0x29, 0x21, 0xf9, 0x52, 0xbb, 0x22,
+ 0x1a, 0xa3, 0x0b, 0x87, 0x1b, 0x33, 0xdc, 0x11, 0xa8, 0x69, 0x98, 0xa1, 0x18, 0x82, 0x3c, 0x91,
+ 0x8a, 0xb0, 0x72, 0xb8, 0x1d, 0x85, 0x8b, 0x15, 0x8c, 0x51, 0xaa, 0x12, 0xc9, 0x20, 0x80, 0x89,
+ 0x49, 0xc3, 0x2a, 0x13, 0xfa, 0x48, 0xc1, 0x29, 0xc2, 0x3a, 0xb1, 0x08, 0x39, 0x15, 0x8c, 0x80,
+ 0x90, 0x82, 0x3e, 0x83, 0x9f, 0x16, 0x9a, 0x30, 0x8a, 0x00, 0x90, 0x82, 0xac, 0x02, 0x89, 0x78,
+ 0xa8, 0x11, 0x91, 0x0a, 0x83, 0x8b, 0x8c, 0x68, 0xf3, 0x8a, 0x15, 0x0d, 0x32, 0xc8, 0x08, 0x02,
+ 0x8d, 0x22, 0xe9, 0x42, 0x99, 0x29, 0x90, 0x80, 0x22, 0xbc, 0x38, 0x9a, 0x84, 0xa0, 0x18, 0x0a,
+ 0x31, 0x13, 0xfc, 0x31, 0xb9, 0x4e, 0x92, 0xaa, 0x16, 0xd8, 0x58, 0x90, 0x4b, 0xb0, 0x00, 0x80,
+ 0x91, 0x1a, 0x10, 0x5b, 0x19, 0xe4, 0x28, 0x81, 0xa8, 0x2b, 0x60, 0xd9, 0x82, 0x21, 0xac, 0x15,
+ 0x90, 0x01, 0x34, 0x00, 0x9a, 0x69, 0xc8, 0x28, 0x83, 0x0d, 0x23, 0xae, 0x05, 0xa8, 0x48, 0x98,
+ 0x19, 0xa3, 0x1a, 0xb2, 0x3c, 0xa6, 0x19, 0xc1, 0x28, 0x91, 0x8a, 0x87, 0x2c, 0x81, 0x9a, 0x82,
+ 0x18, 0x29, 0x80, 0x0e, 0x06, 0x9b, 0x04, 0x09, 0x0c, 0x94, 0x9a, 0x14, 0x9a, 0x10, 0x38, 0x2b,
+ 0xe8, 0x22, 0xe8, 0x31, 0xc8, 0x6b, 0xa2, 0x0a, 0x02, 0x0b, 0x93, 0x1a, 0x11, 0x0e, 0xa7, 0x38,
+ 0xca, 0x14, 0x8c, 0x22, 0x0d, 0xa3, 0x09, 0xc3, 0x49, 0x08, 0x2a, 0x98, 0xa0, 0xa1, 0x71, 0x9a,
+ 0x31, 0xb0, 0xa0, 0x21, 0xb9, 0x72, 0xf9, 0x48, 0xd0, 0x41, 0xc9, 0x48, 0xa0, 0x18, 0x80, 0x09,
+ 0x82, 0xc0, 0x78, 0xa9, 0x31, 0xd0, 0x38, 0xb1, 0x5b, 0xa1, 0x1d, 0x03, 0x9b, 0x22, 0xa9, 0x12,
+ 0x28, 0x9d, 0x53, 0xdb, 0x03, 0xa8, 0x59, 0x18, 0xba, 0x05, 0xb0, 0x42, 0x9c, 0x18, 0x81, 0xaa,
+ 0x23, 0x9f, 0x86, 0x1a, 0x95, 0x1d, 0x03, 0x8e, 0x84, 0x8a, 0x02, 0x99, 0x82, 0x09, 0x83, 0x1b,
+ 0x08, 0x90, 0xaa, 0x17, 0x9d, 0x53, 0xb9, 0x31, 0xb9, 0x41, 0xc8, 0x80, 0x01, 0x08, 0x4c, 0xf1,
+ 0x10, 0xb2, 0x49, 0x08, 0x0b, 0x83, 0xc8, 0x38, 0x90, 0x90, 0xd0, 0x61, 0x09, 0xa1, 0x08, 0xb3,
+ 0x5b, 0x95, 0x0e, 0x01, 0x89, 0xa4, 0x4b, 0xa3, 0x1b, 0xa3, 0x1a, 0xa0, 0x43, 0xdd, 0x51, 0xc0,
+ 0x18, 0x92, 0x1a, 0x82, 0x81, 0x1e, 0x92, 0x8a, 0x95, 0x1a, 0x29, 0x01, 0xa9, 0xa7, 0x38, 0x88,
+ 0x3c, 0xe1, 0x19, 0xa4, 0x1d, 0x95, 0x3b, 0xa2, 0x99, 0x02, 0x8b, 0x22, 0x8f, 0xa3, 0x4a, 0x82,
+ 0xaa, 0x05, 0xc8, 0x78, 0x98, 0x08, 0x93, 0xab, 0x35, 0xad, 0x24, 0xba, 0x32, 0xaa, 0x30, 0xb1,
+ 0x2b, 0xa2, 0x79, 0xd0, 0x20, 0x98, 0x18, 0x09, 0xb6, 0x2e, 0x82, 0x98, 0x01, 0x09, 0x0e, 0x82,
+ 0xe4, 0xfe, 0x32, 0x00, 0x18, 0xa0, 0x38, 0x9a, 0x17, 0xab, 0x94, 0x18, 0x11, 0x19, 0xf8, 0x28,
+ 0x12, 0xa9, 0x60, 0x99, 0x80, 0xb6, 0x8b, 0x38, 0x09, 0x18, 0xf3, 0x38, 0x00, 0x98, 0x8b, 0x33,
+ 0xf1, 0x38, 0xd8, 0x48, 0x81, 0x19, 0x9b, 0x26, 0xd1, 0x3d, 0xd2, 0x49, 0x98, 0x88, 0x99, 0x07,
+ 0x1b, 0x92, 0x09, 0x8a, 0x06, 0xaa, 0x23, 0xab, 0x72, 0xb9, 0x31, 0xd8, 0x21, 0x91, 0x0a, 0x18,
+ 0xb1, 0x28, 0x84, 0x8e, 0x32, 0x8c, 0x84, 0xba, 0x11, 0x3a, 0x08, 0xf2, 0x8b, 0x27, 0xcb, 0x11,
+ 0x89, 0x32, 0x99, 0x10, 0xeb, 0x43, 0xc9, 0x28, 0x91, 0x2b, 0x83, 0x8a, 0x07, 0x9a, 0x10, 0xac,
+ 0x35, 0xf8, 0x49, 0xd0, 0x48, 0x80, 0x09, 0x08, 0xd3, 0x20, 0x08, 0x19, 0xb8, 0x90, 0x30, 0x80,
+ 0x13, 0xdb, 0x52, 0x9a, 0xa4, 0x9c, 0x13, 0x9c, 0x07, 0x8d, 0x13, 0x88, 0x0b, 0x87, 0x8b, 0x14,
+ 0x8c, 0x91, 0x28, 0xc0, 0x51, 0xa9, 0x30, 0xb8, 0x81, 0x01, 0x0b, 0x88, 0x2a, 0x87, 0x2d, 0xa3,
+ 0x1a, 0xa2, 0x71, 0xca, 0x31, 0xb8, 0x08, 0x28, 0xf0, 0x78, 0xb0, 0x49, 0xa1, 0x18, 0x0a, 0xc8,
+ 0x40, 0xb0, 0x4a, 0xd2, 0x20, 0x91, 0x8b, 0x33, 0xad, 0x16, 0xca, 0x31, 0xa9, 0x02, 0x89, 0x80,
+ 0x52, 0xaa, 0x85, 0x0b, 0xa3, 0x3b, 0xe1, 0x49, 0xa2, 0x3a, 0xc3, 0x09, 0x81, 0x8a, 0x11, 0xb9,
+ 0x30, 0xcf, 0x44, 0xca, 0x51, 0xc8, 0x48, 0xa1, 0x18, 0x99, 0x90, 0x31, 0x99, 0x23, 0x1f, 0x85,
+ 0x0b, 0xa1, 0x18, 0x88, 0x99, 0x38, 0xf0, 0x59, 0xa1, 0x3c, 0xa3, 0x0b, 0x24, 0xa9, 0x0c, 0xc2,
+ 0x3a, 0x05, 0x1b, 0x12, 0x08, 0x48, 0xf8, 0x30, 0x8d, 0x10, 0xc0, 0x19, 0x84, 0x2c, 0xa5, 0x19,
+ 0x84, 0x9b, 0x21, 0x9b, 0x39, 0xf1, 0x48, 0xb0, 0x30, 0x81, 0xac, 0x52, 0xf9, 0x20, 0x99, 0x92,
+ 0x22, 0xfa, 0x31, 0x00, 0x72, 0xa8, 0x21, 0xa0, 0x3a, 0x02, 0xad, 0x30, 0xc1, 0x5b, 0x82, 0x09,
+ 0x88, 0x05, 0x0b, 0x82, 0xbc, 0x21, 0xaa, 0x51, 0x88, 0x88, 0x24, 0xf0, 0x69, 0xc8, 0x20, 0xb9,
+ 0x68, 0xa0, 0x4a, 0xa2, 0x2b, 0x82, 0xa8, 0x10, 0x88, 0x09, 0x81, 0x3b, 0x94, 0x2c, 0xa7, 0x2c,
+ 0x95, 0x8d, 0x04, 0x8b, 0x12, 0x0c, 0x03, 0x8a, 0x84, 0xba, 0x72, 0xa9, 0x11, 0x98, 0x08, 0x83,
+ 0x1c, 0xb0, 0x30, 0x8a, 0x86, 0x8e, 0x04, 0x9c, 0x14, 0xca, 0x31, 0xa9, 0x10, 0x91, 0xb3, 0x1e,
+ 0x13, 0xad, 0x34, 0xea, 0x12, 0x09, 0x39, 0xa0, 0x20, 0xc3, 0x2c, 0xb2, 0x6a, 0xc0, 0x30, 0xc8,
+ 0x31, 0xb8, 0x38, 0xf0, 0x3a, 0xb3, 0x3b, 0xa4, 0x2a, 0x80, 0x4b, 0xb4, 0x2a, 0x92, 0x3d, 0xc3,
+ 0x09, 0x21, 0xbd, 0x48, 0x96, 0x1b, 0x32, 0xda, 0x21, 0xc2, 0x0d, 0x81, 0x91, 0x08, 0x18, 0x99,
+ 0x73, 0xb4, 0x1a, 0x93, 0x8f, 0x21, 0xc9, 0x32, 0xa8, 0x48, 0xc1, 0x38, 0x99, 0x83, 0x8a, 0xb2,
+ 0x8f, 0x83, 0x99, 0x20, 0xbb, 0x37, 0x0b, 0x02, 0xcb, 0x85, 0x09, 0x89, 0xa0, 0x2c, 0x33, 0x94,
+ 0x20, 0x9b, 0x36, 0xcc, 0x12, 0xcb, 0x20, 0xa1, 0x18, 0x62, 0x09, 0xe0, 0x21, 0xea, 0x59, 0xa0,
+ 0x0a, 0x92, 0x22, 0x2a, 0x42, 0xfa, 0x21, 0xa9, 0x88, 0x10, 0xac, 0x30, 0xfa, 0x52, 0x08, 0x80,
+ 0x99, 0x04, 0x89, 0x0a, 0x89, 0x18, 0x53, 0xa2, 0x1c, 0x07, 0x1b, 0x92, 0x8c, 0x84, 0x08, 0x3b,
+ 0xd3, 0x0a, 0x82, 0x88, 0x0a, 0xf2, 0x4b, 0xa3, 0x2b, 0xa7, 0x2d, 0x03, 0x9c, 0x14, 0x8c, 0x01,
+ 0x89, 0x91, 0x59, 0xd8, 0x30, 0xb2, 0x19, 0x01, 0x3b, 0xa8, 0x99, 0x87, 0x2c, 0x85, 0x89, 0x82,
+ 0x3b, 0xd8, 0x32, 0xc8, 0x2a, 0xe1, 0x29, 0x31, 0xba, 0x11, 0x81, 0x13, 0x3e, 0xa8, 0xf9, 0x40,
+ 0x93, 0x00, 0x2a, 0x00, 0xad, 0x34, 0xaa, 0x02, 0x9a, 0x02, 0x19, 0xa6, 0x0c, 0x80, 0x18, 0x81,
+ 0x93, 0x3a, 0x2b, 0x37, 0x0d, 0x81, 0x90, 0xac, 0x44, 0xbb, 0x38, 0x02, 0x93, 0x79, 0xc1, 0x3a,
+ 0x02, 0xd8, 0x29, 0xb8, 0x39, 0xa5, 0x8a, 0x88, 0x35, 0xb8, 0x8a, 0x28, 0xf9, 0x58, 0x91, 0x0a,
+ 0x22, 0xd9, 0x48, 0x98, 0xa0, 0x1b, 0xc1, 0x48, 0xd4, 0x19, 0x1a, 0x17, 0x89, 0xb1, 0x28, 0x99,
+ 0x39, 0xe2, 0x08, 0x63, 0x98, 0x0a, 0xa2, 0x4c, 0x91, 0x88, 0xc0, 0x61, 0x9a, 0x10, 0xe1, 0x30,
+ 0xb8, 0x60, 0xa0, 0x28, 0xc1, 0x2b, 0x85, 0xba, 0x30, 0xb8, 0x3e, 0xb3, 0x0b, 0x84, 0x98, 0x29,
+ 0x0a, 0x20, 0x07, 0x8e, 0x03, 0x9a, 0x30, 0xa0, 0x2b, 0x92, 0x4c, 0x97, 0x59, 0xa8, 0x09, 0x93,
+ 0x20, 0x10, 0x8b, 0x20, 0x16, 0x9c, 0x22, 0xcb, 0x58, 0xb8, 0x09, 0xa1, 0x29, 0x0c, 0x90, 0xb1,
+ 0x73, 0xb1, 0x9f, 0xc1, 0x29, 0x95, 0x8c, 0x32, 0xaa, 0x54, 0xa2, 0x0c, 0x92, 0x89, 0x13, 0xae,
+ 0x20, 0x88, 0x10, 0x08, 0xa1, 0x30, 0xc1, 0x10, 0xa0, 0x38, 0x3e, 0x02, 0xe9, 0x24, 0x28, 0x82,
+ 0xae, 0x14, 0x98, 0x1d, 0x91, 0x09, 0xa2, 0x8c, 0x00, 0x48, 0x34, 0xfb, 0x18, 0x98, 0x29, 0xea,
+ 0x28, 0x01, 0x28, 0x91, 0x02, 0x10, 0x84, 0x3a, 0xd0, 0xac, 0x50, 0xc0, 0x19, 0x17, 0x9b, 0x14,
+ 0x98, 0xb9, 0x20, 0x10, 0xab, 0x92, 0x90, 0x78, 0x87, 0x19, 0x01, 0x21, 0x98, 0xf0, 0x0a, 0x93,
+ 0x2c, 0xa8, 0x3b, 0xa2, 0xc8, 0x40, 0x9b, 0x12, 0xbc, 0xa2, 0x3c, 0x31, 0xb1, 0x94, 0x17, 0x2a,
+ 0x81, 0x21, 0x10, 0x70, 0xc4, 0x58, 0xc8, 0x19, 0x18, 0xc8, 0x32, 0x8a, 0x2a, 0x92, 0x3a, 0xe4,
+ 0x6b, 0xe3, 0x2b, 0xa2, 0x2d, 0x93, 0x8b, 0x05, 0x8a, 0x82, 0x1b, 0x83, 0x0b, 0x07, 0x28, 0xa2,
+ 0xea, 0x00, 0x1f, 0x00, 0x13, 0xae, 0x32, 0xba, 0x20, 0xfb, 0x09, 0x98, 0x2b, 0x93, 0x30, 0xc0,
+ 0x78, 0xb0, 0x39, 0x94, 0x39, 0x2a, 0xa3, 0x84, 0x09, 0x40, 0xba, 0x9e, 0x91, 0x0c, 0x95, 0x9c,
+ 0x0a, 0x28, 0x00, 0xc4, 0x41, 0x80, 0x51, 0xd9, 0x80, 0x69, 0x88, 0x88, 0x94, 0x18, 0x12, 0x8d,
+ 0x81, 0x10, 0xaa, 0x19, 0xb1, 0x8c, 0x15, 0xb8, 0x08, 0x28, 0x0f, 0x0a, 0xb3, 0xa0, 0x12, 0xcb,
+ 0x47, 0x1b, 0x8b, 0x12, 0x95, 0x68, 0x91, 0x8b, 0x23, 0xd9, 0x08, 0x08, 0x5c, 0x82, 0xc9, 0x21,
+ 0x98, 0x19, 0x01, 0x19, 0xc3, 0x31, 0xad, 0x10, 0x0c, 0xa4, 0x35, 0x98, 0x21, 0xab, 0x17, 0x1a,
+ 0xa8, 0xb9, 0x8c, 0xb4, 0x52, 0xab, 0x1e, 0x93, 0x99, 0xda, 0x98, 0x0c, 0xc8, 0x28, 0x52, 0x09,
+ 0x96, 0x20, 0x89, 0x10, 0xa8, 0x90, 0xc1, 0x72, 0x10, 0x8e, 0x82, 0x92, 0x11, 0x01, 0x28, 0x1d,
+ 0xb4, 0x8e, 0x92, 0x18, 0x31, 0x2b, 0x86, 0x19, 0xf3, 0x1a, 0x08, 0x09, 0xac, 0x95, 0x08, 0x23,
+ 0x4b, 0x00, 0x51, 0xd1, 0xc1, 0x1a, 0xaa, 0x19, 0x91, 0x38, 0x30, 0xb1, 0x17, 0x01, 0x80, 0x1d,
+ 0xad, 0xa2, 0x60, 0xb8, 0x22, 0x30, 0x81, 0x4b, 0xd0, 0x9c, 0xa0, 0x90, 0x38, 0x90, 0x73, 0x99,
+ 0x01, 0x00, 0x10, 0x87, 0x28, 0x89, 0x9c, 0x40, 0xb9, 0xb0, 0x42, 0x01, 0x28, 0xe2, 0x58, 0xa0,
+ 0x25, 0x9c, 0x8b, 0x93, 0x9b, 0x24, 0x11, 0x28, 0x13, 0xdf, 0x01, 0x09, 0xd0, 0x9a, 0x19, 0x98,
+ 0x81, 0x66, 0x88, 0x12, 0x10, 0x90, 0x9f, 0x92, 0x48, 0xa9, 0x80, 0x59, 0x98, 0x82, 0x11, 0x9e,
+ 0x80, 0x9a, 0xa2, 0x38, 0x86, 0x8c, 0x6b, 0x82, 0x99, 0x94, 0x80, 0x88, 0x18, 0x8f, 0x84, 0xb0,
+ 0x51, 0x01, 0x1c, 0x94, 0x8a, 0x92, 0x1a, 0xc0, 0xaa, 0x10, 0x0a, 0x4b, 0x06, 0x92, 0x31, 0xc3,
+ 0xfa, 0xff, 0x16, 0x00, 0x91, 0xa8, 0xad, 0xc0, 0x7a, 0x82, 0x49, 0x93, 0x09, 0xb2, 0x33, 0x2d,
+ 0xba, 0x4b, 0xb2, 0x33, 0x13, 0xc9, 0x35, 0x39, 0x90, 0x18, 0xf9, 0x9f, 0x88, 0x89, 0x05, 0x20,
+ 0xa8, 0x80, 0x11, 0x80, 0x9b, 0xaf, 0xa3, 0x2e, 0xa8, 0x41, 0xc8, 0x88, 0x32, 0xba, 0x44, 0x9c,
+ 0x0e, 0x91, 0x11, 0x21, 0x82, 0x1d, 0x83, 0x73, 0x98, 0x12, 0xaa, 0xa0, 0x2b, 0xaa, 0x97, 0x80,
+ 0x2b, 0x8b, 0xc9, 0x34, 0xa0, 0x8d, 0xc9, 0x22, 0x0a, 0x86, 0x8a, 0x21, 0x99, 0xdb, 0x25, 0x0f,
+ 0x82, 0x99, 0x21, 0x99, 0x3a, 0xc6, 0x51, 0x19, 0x0a, 0xc1, 0x21, 0x1c, 0xb2, 0x00, 0x89, 0x1b,
+ 0x15, 0xca, 0x61, 0x88, 0x80, 0x93, 0x1b, 0xa0, 0x9d, 0x11, 0x5b, 0xa3, 0xf2, 0x89, 0x20, 0x21,
+ 0x18, 0xb9, 0x7b, 0xa0, 0xd2, 0x00, 0x9c, 0x12, 0x17, 0x19, 0x08, 0x92, 0x10, 0xac, 0x24, 0xba,
+ 0x39, 0xc4, 0x30, 0xb1, 0x71, 0xca, 0x29, 0xb3, 0x00, 0x3b, 0xcc, 0x38, 0x10, 0xfb, 0x81, 0x19,
+ 0x21, 0x6b, 0xb2, 0x1a, 0x26, 0x08, 0x88, 0x29, 0x92, 0x63, 0xea, 0x00, 0x88, 0x68, 0xc1, 0x2a,
+ 0x91, 0x80, 0x1a, 0xa5, 0xa8, 0x29, 0x9b, 0x07, 0x0d, 0x8a, 0x14, 0xc0, 0x00, 0x89, 0x43, 0xab,
+ 0x93, 0x0e, 0x89, 0x88, 0x91, 0xf3, 0x30, 0xb9, 0x40, 0x08, 0x32, 0xbb, 0x99, 0x51, 0x17, 0x18,
+ 0x88, 0x6a, 0x8a, 0xb4, 0x0a, 0x91, 0x8a, 0xa8, 0x35, 0xb2, 0x5d, 0x90, 0x89, 0x98, 0x13, 0x8e,
+ 0x91, 0x1c, 0x91, 0xa3, 0x32, 0xab, 0x45, 0x0d, 0x89, 0xb2, 0x90, 0x93, 0x05, 0x2d, 0xa8, 0x3c,
+ 0x96, 0x18, 0xba, 0x80, 0x70, 0xc0, 0x30, 0x88, 0xa9, 0x24, 0x3a, 0xf1, 0x11, 0x0b, 0xa8, 0x50,
+ 0x08, 0x01, 0x81, 0xe9, 0xb0, 0x5b, 0x92, 0x5b, 0xc8, 0x00, 0x92, 0x30, 0xf9, 0x30, 0x0c, 0x30,
+ 0xa1, 0xff, 0x1a, 0x00, 0x48, 0x09, 0x28, 0xc8, 0x48, 0x80, 0xc4, 0xa2, 0x59, 0xab, 0x40, 0x21,
+ 0xb9, 0x93, 0xa3, 0xaf, 0x00, 0x19, 0x1a, 0xb0, 0x92, 0x00, 0x27, 0xa3, 0x0c, 0x49, 0xc8, 0xd0,
+ 0x52, 0x9a, 0x68, 0x88, 0xc1, 0x04, 0x8b, 0x11, 0x1c, 0x83, 0x09, 0xa2, 0x28, 0xa1, 0x7a, 0x08,
+ 0xa9, 0x48, 0xd0, 0xd9, 0x00, 0x4b, 0x00, 0x00, 0x82, 0x93, 0x10, 0x2e, 0x03, 0xe9, 0x49, 0x99,
+ 0x01, 0xab, 0xa7, 0x9a, 0x21, 0x62, 0x88, 0x12, 0x0a, 0x91, 0xb9, 0xb3, 0x5f, 0xc9, 0x01, 0x3a,
+ 0x86, 0x89, 0x88, 0x3a, 0xa5, 0x09, 0x01, 0x3b, 0xe1, 0x80, 0x9b, 0x04, 0x99, 0x7a, 0xb0, 0x10,
+ 0xb1, 0x60, 0x80, 0x3a, 0xc1, 0x23, 0x88, 0xa4, 0x3c, 0xc0, 0x29, 0xb9, 0x19, 0x41, 0x9d, 0xb3,
+ 0x4a, 0x82, 0x12, 0x2a, 0x03, 0xf1, 0x1c, 0xaa, 0x19, 0x41, 0x95, 0x2a, 0xa8, 0x87, 0x1e, 0x90,
+ 0xe9, 0x01, 0x2a, 0xa2, 0x2c, 0x98, 0xa3, 0xb1, 0x42, 0x11, 0x0b, 0x48, 0x02, 0x97, 0x82, 0x4a,
+ 0xca, 0x59, 0x11, 0xf1, 0x19, 0x00, 0x00, 0x90, 0x51, 0xad, 0x08, 0x81, 0x13, 0xc1, 0x51, 0x0a,
+ 0x01, 0x28, 0x91, 0xf9, 0x10, 0x28, 0xba, 0x4b, 0x90, 0xf8, 0x00, 0x10, 0x91, 0xb9, 0x48, 0x0e,
+ 0x83, 0xbb, 0x09, 0x17, 0x18, 0x93, 0x30, 0x80, 0xbd, 0x7b, 0xb0, 0xa2, 0xb0, 0x80, 0x79, 0x58,
+ 0xa9, 0x83, 0xa3, 0xa0, 0x1d, 0x28, 0xc8, 0x89, 0x26, 0x9a, 0x50, 0x92, 0x91, 0x98, 0x8b, 0x48,
+ 0xd0, 0x4a, 0x81, 0xf2, 0x19, 0x2a, 0x81, 0x4a, 0x92, 0xe8, 0x10, 0x9b, 0x93, 0x58, 0x00, 0x0b,
+ 0x91, 0x29, 0xd5, 0x81, 0x71, 0xa8, 0x18, 0x19, 0x0c, 0x12, 0xf4, 0x09, 0x29, 0x00, 0xda, 0x53,
+ 0x08, 0x8a, 0xa1, 0x20, 0x22, 0x1a, 0xce, 0x01, 0x24, 0xb9, 0x4a, 0x09, 0x00, 0xb3, 0x18, 0xa7,
+ 0x3f, 0x00, 0x19, 0x00, 0xe1, 0x11, 0xba, 0x90, 0x59, 0xc0, 0x19, 0xa2, 0x3b, 0x03, 0xc0, 0x96,
+ 0x2c, 0x12, 0x88, 0x20, 0xa0, 0x91, 0x81, 0xcf, 0x92, 0x28, 0x68, 0x00, 0xa3, 0x18, 0xac, 0x68,
+ 0xa2, 0x21, 0xbc, 0x21, 0x9a, 0x35, 0xb8, 0xa0, 0x20, 0x5b, 0x0a, 0xb8, 0xfc, 0x0f, 0x01, 0xa0,
+ 0x21, 0x09, 0x10, 0x01, 0xe2, 0x2b, 0x10, 0xa0, 0xac, 0x85, 0x48, 0x18, 0x10, 0x99, 0xf8, 0x30,
+ 0x89, 0xa8, 0x40, 0xd9, 0x50, 0x99, 0xa1, 0x78, 0x01, 0x90, 0x82, 0x8a, 0x2a, 0x02, 0x10, 0xf9,
+ 0x59, 0x01, 0xaa, 0xc4, 0x89, 0x1b, 0x10, 0x84, 0x2b, 0xd4, 0x28, 0x51, 0xab, 0x04, 0xba, 0x62,
+ 0x99, 0x21, 0xa0, 0xa8, 0x8f, 0x01, 0x58, 0x90, 0xc4, 0x2a, 0x21, 0xc9, 0x08, 0x13, 0x9b, 0xc9,
+ 0xb8, 0x29, 0x0f, 0x06, 0x28, 0xa0, 0xa1, 0x41, 0x08, 0x9a, 0x88, 0x20, 0x0e, 0xa2, 0x01, 0xca,
+ 0x47, 0x90, 0x18, 0x1b, 0xc9, 0x08, 0xba, 0x07, 0x81, 0x1a, 0x3a, 0xa9, 0x30, 0x89, 0x95, 0xd3,
+ 0x61, 0x8a, 0x28, 0x13, 0x28, 0x4e, 0xb5, 0x82, 0x28, 0xaa, 0xca, 0x31, 0xb8, 0x1b, 0xa8, 0x12,
+ 0x37, 0x17, 0x2a, 0x8a, 0xb8, 0x9a, 0x06, 0x19, 0x88, 0x88, 0x23, 0x88, 0x25, 0x18, 0xff, 0x08,
+ 0x88, 0xa0, 0x0a, 0xa3, 0x18, 0x81, 0x3f, 0x80, 0xa1, 0xb3, 0x29, 0x1b, 0x9f, 0x11, 0x31, 0x41,
+ 0x97, 0x8c, 0x8b, 0x84, 0x10, 0x99, 0x6a, 0xc1, 0x98, 0x0a, 0x42, 0x4a, 0xb1, 0x31, 0x8b, 0x27,
+ 0x38, 0xb2, 0xca, 0x0a, 0x3c, 0x90, 0x13, 0xf0, 0x89, 0x08, 0x4b, 0xf1, 0xa1, 0x4a, 0x8b, 0xa1,
+ 0xa0, 0x32, 0x0b, 0x07, 0xa9, 0x13, 0x2f, 0x08, 0xb2, 0x18, 0xa0, 0x89, 0xb7, 0x68, 0x09, 0x19,
+ 0xa2, 0x89, 0xb8, 0x87, 0x19, 0x0a, 0x11, 0x81, 0xe9, 0x04, 0x0a, 0x58, 0xa9, 0x99, 0x02, 0x05,
+ 0xbe, 0xff, 0x17, 0x00, 0x95, 0x22, 0x2a, 0x12, 0xed, 0x30, 0xb1, 0x89, 0x80, 0x01, 0x7c, 0x80,
+ 0xa3, 0x8c, 0x24, 0xba, 0x29, 0x81, 0x48, 0xd0, 0x40, 0xc9, 0x3b, 0x93, 0x82, 0x59, 0x90, 0x9b,
+ 0x83, 0x12, 0xf8, 0x2e, 0xc9, 0x10, 0x18, 0xc2, 0x28, 0x08, 0xb4, 0x39, 0x1a, 0x34, 0x8d, 0x91,
+ 0xf8, 0x20, 0x48, 0x10, 0xa8, 0x48, 0x94, 0xcb, 0x08, 0x39, 0xa1, 0x01, 0xc8, 0x59, 0xd8, 0xa0,
+ 0x19, 0x41, 0xa8, 0x7a, 0xa1, 0x0a, 0xc2, 0x18, 0x84, 0x29, 0x4c, 0x91, 0xc0, 0x21, 0x90, 0x32,
+ 0x99, 0x1e, 0x11, 0xbb, 0xe1, 0xc3, 0x48, 0x29, 0xb8, 0x89, 0x14, 0x3c, 0xa0, 0x10, 0xc7, 0x5a,
+ 0x18, 0x99, 0x84, 0x9c, 0x01, 0xaa, 0x28, 0x19, 0x12, 0x3a, 0x87, 0xea, 0x18, 0x18, 0x80, 0xa8,
+ 0x01, 0xaa, 0x0f, 0x95, 0x0a, 0x41, 0xa1, 0xb8, 0x40, 0x92, 0x81, 0x18, 0x5b, 0xa0, 0xf1, 0x38,
+ 0xc2, 0x5c, 0x09, 0x9a, 0x06, 0x91, 0x81, 0x0a, 0x2b, 0x18, 0xa2, 0xd6, 0x48, 0x3a, 0xa9, 0x95,
+ 0xa1, 0x23, 0x1e, 0x31, 0xa8, 0x1a, 0xb3, 0xeb, 0xa1, 0x31, 0x00, 0x5c, 0x91, 0x9a, 0x21, 0xa6,
+ 0x8b, 0x29, 0xc2, 0xa3, 0x11, 0x2f, 0x8a, 0xa2, 0x94, 0xc1, 0x99, 0x4e, 0x18, 0xb2, 0x80, 0x18,
+ 0x08, 0x00, 0x73, 0xd1, 0x28, 0x8c, 0xa1, 0x29, 0xb8, 0x11, 0x23, 0x11, 0x4d, 0x9b, 0x11, 0xf1,
+ 0x31, 0x0b, 0xd4, 0x19, 0x32, 0x1a, 0xde, 0x13, 0x00, 0x08, 0x4b, 0x93, 0x86, 0x1a, 0x01, 0x08,
+ 0xb2, 0x98, 0x8f, 0x08, 0xa0, 0x11, 0x94, 0x28, 0x4a, 0xf1, 0x4c, 0x81, 0xa0, 0x0e, 0x80, 0x01,
+ 0xb9, 0x02, 0x10, 0xca, 0x08, 0x5c, 0x40, 0xe8, 0x90, 0x0a, 0x80, 0x05, 0x30, 0x88, 0x3a, 0xab,
+ 0x85, 0x81, 0x30, 0xb1, 0x49, 0x3b, 0x27, 0xa0, 0x6b, 0x80, 0xab, 0x99, 0xc1, 0x98, 0x35, 0xc1,
+ 0xf7, 0xff, 0x17, 0x00, 0xa2, 0x09, 0x84, 0x20, 0xae, 0x1b, 0x85, 0x19, 0x97, 0x0b, 0x39, 0x29,
+ 0xa0, 0xa4, 0x18, 0x93, 0xfa, 0x3c, 0x1b, 0xb8, 0x80, 0xf2, 0x48, 0x29, 0x21, 0xb9, 0x92, 0xaa,
+ 0x10, 0x8b, 0x2e, 0x81, 0x16, 0xd9, 0x25, 0x0c, 0x81, 0x80, 0x3a, 0x44, 0x98, 0xaa, 0x43, 0xc0,
+ 0x10, 0x1d, 0x90, 0xd2, 0x08, 0x28, 0xb8, 0x58, 0xcb, 0xa3, 0x04, 0x2a, 0x2f, 0x90, 0x80, 0x03,
+ 0x39, 0x89, 0x05, 0xb0, 0x9c, 0x29, 0x9c, 0x34, 0x19, 0x54, 0xe1, 0x19, 0x09, 0x98, 0x43, 0xa8,
+ 0x10, 0x08, 0xa2, 0x1d, 0xa9, 0xb0, 0x99, 0x50, 0x12, 0x52, 0x0b, 0x41, 0xf9, 0x22, 0x9b, 0x94,
+ 0x48, 0x2b, 0x83, 0xc6, 0x3a, 0x20, 0xad, 0xb4, 0x28, 0x8c, 0x92, 0x8b, 0x51, 0x11, 0xc1, 0x89,
+ 0x14, 0x9f, 0x00, 0x28, 0x00, 0x0b, 0x95, 0xb0, 0x3a, 0xa8, 0x07, 0x1c, 0x09, 0x90, 0xf3, 0x30,
+ 0x18, 0x9b, 0x38, 0xd9, 0xb3, 0x14, 0x2a, 0x09, 0x13, 0xbf, 0x15, 0x98, 0xa1, 0x2b, 0x12, 0x19,
+ 0xe5, 0x1a, 0x10, 0x10, 0x0a, 0xa3, 0x32, 0x2d, 0xb7, 0x90, 0x7b, 0x90, 0x90, 0x08, 0xd9, 0x90,
+ 0x99, 0x71, 0x91, 0x21, 0xb9, 0x1a, 0xa1, 0x95, 0x19, 0x74, 0x89, 0x90, 0x92, 0x91, 0x2e, 0x91,
+ 0x08, 0xb1, 0x93, 0x1f, 0xa1, 0x1a, 0x0a, 0x97, 0x31, 0xab, 0x29, 0xe0, 0x21, 0x20, 0x91, 0x0a,
+ 0xc0, 0x3c, 0x22, 0x15, 0xfb, 0x81, 0x8a, 0x28, 0xbb, 0x07, 0xa8, 0x19, 0x19, 0x86, 0x48, 0xa8,
+ 0xc1, 0x12, 0x18, 0x1b, 0x85, 0x0a, 0x11, 0x09, 0xa4, 0x18, 0x9f, 0x94, 0x98, 0x85, 0x1c, 0x91,
+ 0x3a, 0xb9, 0x2d, 0x84, 0x02, 0xc1, 0x12, 0x8c, 0x13, 0x20, 0x0f, 0x80, 0x88, 0x82, 0xd3, 0x28,
+ 0x21, 0xba, 0x15, 0x88, 0xa0, 0x8f, 0xd8, 0x29, 0x07, 0x0a, 0x81, 0x88, 0x39, 0xa2, 0xc8, 0xb9,
+ 0xcc, 0xff, 0x14, 0x00, 0x22, 0xbc, 0xa3, 0x49, 0xa8, 0x87, 0x78, 0x89, 0x98, 0x01, 0x9a, 0xa2,
+ 0x33, 0x0c, 0x3f, 0xc1, 0x10, 0x24, 0x8c, 0x80, 0x00, 0xc1, 0x51, 0x0a, 0x9a, 0x31, 0xd5, 0x9a,
+ 0x88, 0x88, 0x91, 0x1a, 0x15, 0x2a, 0x89, 0xd4, 0xa9, 0x59, 0x91, 0x50, 0x00, 0x9b, 0x96, 0x1a,
+ 0x4a, 0xa1, 0xc8, 0x03, 0x3b, 0x09, 0xac, 0xc1, 0x86, 0xbb, 0x58, 0x08, 0x8b, 0x88, 0x17, 0x11,
+ 0x92, 0x49, 0x20, 0x19, 0xf1, 0x20, 0xb8, 0x81, 0x30, 0x12, 0x1e, 0x92, 0x80, 0xab, 0x32, 0x01,
+ 0xef, 0x99, 0x00, 0x11, 0x09, 0x73, 0xa0, 0x21, 0x9a, 0x31, 0x87, 0xba, 0x01, 0x8f, 0x80, 0x13,
+ 0x20, 0x9a, 0xd0, 0x9a, 0x23, 0x2a, 0xa3, 0x4b, 0x35, 0xf0, 0x2a, 0x1a, 0xa0, 0xe0, 0x09, 0x3b,
+ 0xc8, 0x91, 0x29, 0x33, 0x83, 0x8c, 0xba, 0x20, 0x1d, 0xa6, 0x6b, 0xc2, 0x92, 0x60, 0x1b, 0xb0,
+ 0x11, 0xe1, 0x1a, 0x12, 0xab, 0x22, 0x31, 0xcf, 0xc3, 0x42, 0x8d, 0x03, 0x88, 0x80, 0x48, 0xc2,
+ 0x11, 0x18, 0x18, 0x89, 0x08, 0x95, 0x89, 0x01, 0x2f, 0xb3, 0x02, 0x02, 0xa1, 0x8f, 0xc4, 0x30,
+ 0xaa, 0x86, 0x9c, 0x08, 0xa1, 0x29, 0x81, 0x02, 0x09, 0xa9, 0xa1, 0x84, 0xad, 0x2d, 0xf1, 0x19,
+ 0x11, 0x82, 0x81, 0x3b, 0xa6, 0xf9, 0x20, 0x1c, 0x10, 0x80, 0xb0, 0x05, 0x89, 0x29, 0xa0, 0x28,
+ 0x0c, 0xfa, 0x00, 0x31, 0x16, 0x89, 0x9a, 0xa0, 0xda, 0x58, 0x11, 0x0b, 0x94, 0x94, 0x49, 0x29,
+ 0xb1, 0x20, 0x08, 0xb7, 0x40, 0x40, 0x89, 0x81, 0xeb, 0x28, 0x99, 0x13, 0x28, 0xac, 0x14, 0x8b,
+ 0xb3, 0xeb, 0x92, 0x0c, 0x99, 0x4d, 0xb2, 0x80, 0xb3, 0x5b, 0xb8, 0x7a, 0x00, 0xa2, 0x90, 0x72,
+ 0xb9, 0x03, 0x22, 0x99, 0x0d, 0xba, 0x94, 0x92, 0x2f, 0xb0, 0x31, 0x23, 0xcc, 0x40, 0x88, 0x13,
+ 0xf6, 0xff, 0x16, 0x00, 0x3a, 0x32, 0x98, 0x8f, 0x93, 0x00, 0x9c, 0xd0, 0x30, 0x99, 0x7b, 0x92,
+ 0xaa, 0x02, 0xa9, 0xa0, 0x37, 0x2c, 0x2c, 0xb8, 0xb3, 0x99, 0xa5, 0x8c, 0x68, 0x01, 0x88, 0x8b,
+ 0x15, 0x9a, 0x90, 0x30, 0x83, 0x93, 0x71, 0x0c, 0xc4, 0x80, 0x50, 0x19, 0x99, 0xa3, 0x03, 0x31,
+ 0xdb, 0xeb, 0x20, 0x0b, 0x93, 0x41, 0x9f, 0x30, 0xd0, 0x81, 0x10, 0x81, 0x8b, 0x69, 0x9a, 0xa3,
+ 0x31, 0x81, 0xb9, 0x71, 0xac, 0x82, 0xb0, 0x0b, 0x2c, 0x84, 0x50, 0xd9, 0xa8, 0x53, 0x90, 0x29,
+ 0x22, 0x09, 0x1a, 0x97, 0x9a, 0x25, 0x9a, 0x2a, 0x08, 0x83, 0xbb, 0xf3, 0xa3, 0x70, 0x8d, 0x00,
+ 0xa0, 0x98, 0x92, 0x05, 0x0c, 0x11, 0x2b, 0x12, 0xf0, 0x29, 0x09, 0x00, 0x06, 0x08, 0x80, 0x4b,
+ 0x80, 0x83, 0x4d, 0xca, 0x21, 0x08, 0x33, 0xf0, 0x1a, 0x11, 0xca, 0x4b, 0xc8, 0x84, 0x39, 0x38,
+ 0xf0, 0x90, 0x81, 0x58, 0x88, 0x88, 0x20, 0x94, 0xaa, 0xe8, 0x8b, 0x07, 0x39, 0xaa, 0x88, 0x10,
+ 0xb1, 0x6b, 0xa2, 0x88, 0x98, 0x10, 0x08, 0x0d, 0x9a, 0xa1, 0x17, 0x8d, 0x80, 0x80, 0x58, 0x91,
+ 0x94, 0x90, 0x1a, 0x31, 0xae, 0xb3, 0x3a, 0x15, 0x41, 0x98, 0x2f, 0xb4, 0x81, 0x93, 0x0f, 0x10,
+ 0x11, 0x9a, 0xa2, 0x8b, 0xb1, 0x36, 0x88, 0x39, 0x9e, 0xa4, 0x08, 0x01, 0x4a, 0x81, 0x8d, 0xb0,
+ 0x99, 0x33, 0x88, 0x2f, 0x84, 0x1c, 0xa4, 0x39, 0x80, 0x23, 0x8e, 0x02, 0xb8, 0x98, 0xc3, 0x3b,
+ 0x01, 0x2d, 0x99, 0xc3, 0x52, 0x29, 0x18, 0xf9, 0xad, 0x28, 0x82, 0x21, 0x09, 0x8d, 0x01, 0xd1,
+ 0xb2, 0x68, 0x2a, 0x00, 0xa0, 0x94, 0x0c, 0x38, 0xa8, 0x34, 0xb0, 0xba, 0xb1, 0x71, 0x81, 0xa3,
+ 0x4f, 0xb0, 0x81, 0x32, 0xea, 0x04, 0x4a, 0x18, 0x11, 0x9c, 0xa4, 0x89, 0x82, 0xa9, 0x01, 0x70,
+ 0x69, 0x00, 0x19, 0x00, 0x08, 0x3a, 0xb5, 0x11, 0x9c, 0x6b, 0x98, 0x90, 0xa0, 0xba, 0x48, 0x17,
+ 0xa8, 0x29, 0x10, 0x09, 0xf3, 0x80, 0x01, 0x8d, 0x6a, 0x80, 0xb1, 0x11, 0x0b, 0x87, 0x1a, 0x80,
+ 0x19, 0x08, 0x91, 0x44, 0xab, 0x82, 0x5b, 0xb9, 0xb3, 0xa8, 0x31, 0xbf, 0x1a, 0x94, 0x95, 0x19,
+ 0x83, 0x1f, 0x92, 0xa1, 0x59, 0x30, 0xa9, 0xa1, 0xf3, 0x1b, 0x29, 0x19, 0xd3, 0x83, 0x29, 0x32,
+ 0xba, 0x99, 0x45, 0xdb, 0x88, 0x19, 0xfb, 0x88, 0x13, 0x31, 0x4b, 0x09, 0xc7, 0x00, 0x19, 0x1a,
+ 0x89, 0xd0, 0x21, 0xa4, 0x3a, 0xac, 0x38, 0xc1, 0x02, 0x33, 0x9e, 0x31, 0x31, 0xd0, 0xba, 0x08,
+ 0xb3, 0x8f, 0xb8, 0x05, 0x9e, 0x38, 0x12, 0x92, 0x80, 0x12, 0x34, 0xa0, 0x68, 0x9a, 0xc9, 0x09,
+ 0x40, 0xf0, 0x00, 0x48, 0x80, 0xa9, 0x12, 0x4a, 0x98, 0x04, 0x08, 0x98, 0x45, 0xf8, 0x30, 0x8b,
+ 0x21, 0xba, 0x11, 0x8a, 0xcc, 0x17, 0xa8, 0x88, 0x4a, 0x8a, 0x12, 0xc0, 0xa0, 0x2b, 0x83, 0x97,
+ 0x2e, 0x99, 0xb4, 0x8a, 0x29, 0xa8, 0x1b, 0x19, 0xd3, 0x85, 0x41, 0x5a, 0xa1, 0x13, 0x8a, 0x90,
+ 0x12, 0x32, 0xb1, 0xcf, 0x23, 0x1a, 0x80, 0x86, 0x8f, 0x81, 0x83, 0x0a, 0x0c, 0xa9, 0x85, 0x19,
+ 0x23, 0x1a, 0xf9, 0x20, 0x89, 0x8b, 0x13, 0xca, 0x8a, 0x43, 0x0d, 0x13, 0x9c, 0xe3, 0x02, 0x5a,
+ 0x38, 0xd8, 0x12, 0x32, 0x8f, 0x98, 0x81, 0x00, 0x98, 0x21, 0xa1, 0x8f, 0x01, 0x84, 0x19, 0xa8,
+ 0x29, 0x08, 0xb3, 0xcf, 0x05, 0x19, 0xb3, 0x09, 0xe2, 0x7a, 0x08, 0x91, 0x00, 0x38, 0x82, 0xd0,
+ 0x88, 0x20, 0x8e, 0x22, 0x1a, 0x92, 0x19, 0xcb, 0xa4, 0xb8, 0x41, 0x19, 0x1f, 0xc8, 0x82, 0x94,
+ 0x2a, 0x0b, 0x30, 0x22, 0xae, 0xf3, 0x18, 0x00, 0x29, 0x50, 0x89, 0xa4, 0x2a, 0x00, 0x0c, 0xd2,
+ 0xef, 0xff, 0x19, 0x00, 0x81, 0x82, 0x12, 0x2d, 0x00, 0xa0, 0xb4, 0xbc, 0xc2, 0x09, 0x3f, 0x90,
+ 0xa1, 0x28, 0x23, 0x04, 0x9a, 0xdc, 0x10, 0x99, 0x72, 0x80, 0x08, 0x90, 0x8e, 0xa3, 0xa9, 0x7a,
+ 0xb9, 0x03, 0x13, 0x1c, 0x01, 0x19, 0xc2, 0x8c, 0xc3, 0x92, 0x5e, 0x91, 0x21, 0xb9, 0x41, 0xc0,
+ 0x81, 0x1b, 0x30, 0x22, 0x2a, 0xbb, 0x07, 0x8a, 0x29, 0xac, 0x17, 0x89, 0x38, 0x99, 0x25, 0xbb,
+ 0x95, 0x98, 0x20, 0x3d, 0xaa, 0xd4, 0x80, 0x31, 0x0a, 0x91, 0xf9, 0x1a, 0x0f, 0x93, 0x01, 0x92,
+ 0x3c, 0xa1, 0x90, 0x79, 0x99, 0xc1, 0x00, 0x20, 0x89, 0x2b, 0x07, 0x18, 0x0c, 0x98, 0xb1, 0x10,
+ 0x39, 0x93, 0x2a, 0xc5, 0x39, 0x71, 0xa9, 0x20, 0x92, 0xeb, 0x59, 0xc1, 0x81, 0x48, 0x8b, 0xb2,
+ 0x0d, 0x11, 0x19, 0x06, 0x28, 0x41, 0xf1, 0x01, 0x2a, 0x49, 0xba, 0x81, 0x31, 0xc4, 0x49, 0x02,
+ 0x0b, 0x8a, 0xf9, 0x1a, 0x82, 0xb2, 0x4c, 0x21, 0xc0, 0x9a, 0x19, 0x43, 0x9d, 0xc3, 0x08, 0x19,
+ 0x8a, 0x14, 0x09, 0xab, 0x27, 0xb9, 0x08, 0x3c, 0xc3, 0x28, 0x19, 0x80, 0x05, 0xc2, 0x6a, 0xb2,
+ 0x01, 0x29, 0x68, 0x89, 0xb9, 0x06, 0xa8, 0x11, 0x9b, 0x68, 0x98, 0x01, 0xbb, 0x95, 0x01, 0x1c,
+ 0x49, 0xb1, 0xa3, 0xae, 0x48, 0x32, 0xfb, 0x82, 0x0b, 0xa8, 0x31, 0x2d, 0x13, 0x98, 0x87, 0x9c,
+ 0x32, 0x8a, 0x61, 0x9a, 0x91, 0x90, 0x23, 0x11, 0x04, 0x41, 0xcc, 0x30, 0x9a, 0x88, 0x23, 0xf8,
+ 0x1e, 0x91, 0x0a, 0x99, 0x93, 0xb9, 0x3d, 0x00, 0xb2, 0x0c, 0xd3, 0x1a, 0x35, 0x98, 0x8a, 0xdc,
+ 0x38, 0x04, 0xb9, 0x11, 0x78, 0xc0, 0x01, 0x88, 0x11, 0x8e, 0x32, 0x00, 0x81, 0x31, 0xf8, 0x90,
+ 0x02, 0x1f, 0x82, 0x28, 0x9c, 0x13, 0x10, 0x01, 0x28, 0x8b, 0xf3, 0x2c, 0x82, 0x20, 0x24, 0xaf,
+ 0x33, 0x00, 0x1c, 0x00, 0x20, 0x30, 0xaa, 0xb8, 0x63, 0x9b, 0x91, 0x9b, 0xf1, 0x83, 0x30, 0x3c,
+ 0x14, 0x9c, 0xa1, 0x2c, 0x96, 0x98, 0x14, 0x9b, 0x19, 0x38, 0xbe, 0xa3, 0x21, 0xb9, 0xc9, 0x5a,
+ 0x29, 0xb2, 0xa9, 0x14, 0x82, 0x38, 0x30, 0xab, 0x63, 0xa1, 0x12, 0xd0, 0x0e, 0xa5, 0x1b, 0x82,
+ 0x30, 0x0c, 0x19, 0x03, 0xfa, 0x10, 0x21, 0xb1, 0xb1, 0x43, 0x0f, 0xf3, 0x28, 0xa8, 0x82, 0xc1,
+ 0x1b, 0x00, 0x1f, 0x91, 0x00, 0x32, 0xb3, 0x01, 0x1f, 0x12, 0x1a, 0xdc, 0xb2, 0x69, 0x1a, 0xb4,
+ 0x13, 0x01, 0xab, 0x52, 0x8d, 0x12, 0x81, 0x18, 0xa5, 0xa8, 0x22, 0x9b, 0x0e, 0x08, 0x11, 0xc3,
+ 0x53, 0xbb, 0x80, 0x7b, 0xc2, 0x1a, 0xb3, 0x21, 0x8e, 0xaa, 0x92, 0x11, 0x41, 0x38, 0xa2, 0x9c,
+ 0x52, 0x9b, 0xf1, 0x8b, 0x02, 0x19, 0x99, 0x7b, 0x90, 0x08, 0x13, 0xd2, 0x83, 0x20, 0x8f, 0x09,
+ 0x03, 0xa8, 0x92, 0x1c, 0x05, 0x80, 0x2d, 0x14, 0xa2, 0x2b, 0xc0, 0x18, 0x3a, 0x92, 0x98, 0x45,
+ 0xa1, 0x11, 0x9f, 0x09, 0xd3, 0x20, 0xa0, 0x3a, 0x0b, 0x2f, 0xd2, 0x87, 0x89, 0x18, 0x08, 0x48,
+ 0x9b, 0xd3, 0x11, 0xa8, 0x83, 0x4b, 0x8c, 0x2a, 0x20, 0xa7, 0x81, 0x9a, 0x82, 0x2c, 0x0a, 0x08,
+ 0x87, 0x0e, 0x93, 0x10, 0x1b, 0xa8, 0x98, 0x33, 0x04, 0xe1, 0x18, 0x72, 0x99, 0x91, 0x0a, 0x05,
+ 0xaa, 0x98, 0x00, 0x95, 0x2a, 0x60, 0xad, 0x94, 0x28, 0x88, 0x92, 0x88, 0x48, 0x80, 0x08, 0x08,
+ 0xeb, 0x01, 0xdd, 0x13, 0x88, 0xaa, 0x69, 0x08, 0x9a, 0x91, 0xd5, 0x19, 0x30, 0xa1, 0x8a, 0x31,
+ 0x32, 0x9a, 0x06, 0xa1, 0xbb, 0x68, 0xca, 0x12, 0x22, 0x0f, 0x90, 0x01, 0x98, 0x2a, 0x13, 0xc2,
+ 0x89, 0x40, 0xfe, 0x11, 0x2a, 0x28, 0xb2, 0x21, 0xba, 0xab, 0x87, 0x28, 0x38, 0x0e, 0x13, 0xb5,
+ 0xcc, 0xff, 0x18, 0x00, 0x40, 0x89, 0xd8, 0x11, 0x48, 0x8a, 0xc1, 0x95, 0x20, 0x8b, 0x0a, 0xb8,
+ 0x70, 0x21, 0xb4, 0x29, 0xc1, 0x19, 0x0b, 0x34, 0x92, 0x19, 0xae, 0x1a, 0x79, 0xb3, 0x98, 0x39,
+ 0xd2, 0x0c, 0xc8, 0x31, 0x30, 0x83, 0x0e, 0x02, 0xa2, 0x99, 0x11, 0x9f, 0x84, 0x29, 0xb0, 0x00,
+ 0x29, 0x8f, 0xd2, 0x00, 0x09, 0x03, 0x1b, 0x97, 0x8a, 0x1a, 0x91, 0x21, 0x2a, 0x54, 0xa9, 0x09,
+ 0xa4, 0x20, 0x84, 0x9d, 0x7a, 0x12, 0xe0, 0x1a, 0x12, 0x08, 0xc1, 0x49, 0xab, 0x09, 0x20, 0x80,
+ 0x04, 0xc9, 0x15, 0x9a, 0x10, 0xa0, 0x6c, 0x9a, 0x91, 0x20, 0x83, 0xbb, 0x16, 0x30, 0x88, 0x8d,
+ 0xba, 0x24, 0x2b, 0xf1, 0x84, 0x88, 0x2d, 0x2b, 0xf1, 0x11, 0x98, 0x32, 0xb0, 0x2d, 0xa3, 0x18,
+ 0x18, 0x10, 0x9d, 0xa7, 0x3a, 0x21, 0x89, 0x2c, 0x92, 0x82, 0xf3, 0x29, 0x0b, 0x38, 0xb0, 0x3c,
+ 0x06, 0xc0, 0x01, 0x1c, 0xa2, 0x79, 0xb9, 0x02, 0x09, 0x91, 0x1a, 0xb0, 0x6a, 0xb8, 0xb4, 0x09,
+ 0x98, 0x71, 0x1a, 0x02, 0xc2, 0xb0, 0x73, 0x01, 0x81, 0x8b, 0x8c, 0xab, 0x96, 0x2c, 0x91, 0xa3,
+ 0x80, 0x70, 0x21, 0x88, 0xd8, 0xc2, 0x88, 0xab, 0x31, 0xe9, 0x39, 0x38, 0x8c, 0xb3, 0x82, 0x8d,
+ 0xb0, 0x17, 0x2d, 0x81, 0x1a, 0xa6, 0x8b, 0x28, 0x89, 0xb1, 0x16, 0x81, 0x4a, 0xc8, 0x1a, 0x58,
+ 0xb9, 0x94, 0x12, 0x00, 0x3a, 0x8b, 0x42, 0x19, 0xb6, 0x99, 0xd3, 0x5a, 0x11, 0x29, 0x82, 0xe9,
+ 0x31, 0x9b, 0xb8, 0x52, 0xf1, 0x18, 0x80, 0x18, 0xaa, 0x11, 0x33, 0xd9, 0x95, 0x1b, 0x9a, 0x3d,
+ 0x05, 0xaa, 0x43, 0x08, 0x90, 0x2a, 0x97, 0x08, 0x1e, 0x92, 0x2a, 0xa2, 0x8a, 0xaa, 0x19, 0x26,
+ 0x80, 0x10, 0xfb, 0x01, 0x59, 0xca, 0x21, 0x98, 0x89, 0x43, 0xc2, 0x1b, 0xaa, 0x68, 0xb4, 0x28,
+ 0x06, 0x00, 0x17, 0x00, 0x03, 0x8e, 0x40, 0xc9, 0x88, 0x21, 0x80, 0xa8, 0x78, 0x88, 0x95, 0x10,
+ 0x1d, 0xa1, 0x18, 0xa8, 0x21, 0x02, 0x00, 0x0a, 0x9f, 0x83, 0x98, 0x1b, 0x50, 0x81, 0x02, 0xd2,
+ 0x08, 0xd3, 0x4c, 0x9d, 0x03, 0x08, 0x82, 0x8b, 0x3a, 0x17, 0x08, 0xda, 0x30, 0xc3, 0x99, 0x1b,
+ 0xbf, 0x05, 0x11, 0x99, 0x91, 0x8c, 0x30, 0x89, 0xb6, 0x09, 0x1b, 0x92, 0x4a, 0xb0, 0x32, 0x87,
+ 0x1a, 0xb9, 0x4b, 0xd8, 0x35, 0xa9, 0x92, 0x62, 0x8b, 0x1b, 0x92, 0x02, 0xa8, 0xe9, 0x01, 0x40,
+ 0x12, 0xaf, 0x32, 0x82, 0x0a, 0x90, 0x22, 0xf2, 0x91, 0x09, 0x9f, 0x12, 0x82, 0x02, 0xab, 0xbb,
+ 0x17, 0x42, 0x8a, 0x3d, 0xb2, 0xf2, 0x18, 0x19, 0x10, 0x0a, 0xb3, 0x99, 0xa8, 0x04, 0x8a, 0x0f,
+ 0xb0, 0x71, 0x80, 0x00, 0xb9, 0x89, 0x52, 0x8b, 0x99, 0x07, 0xb9, 0x33, 0x1c, 0x89, 0x48, 0xb3,
+ 0x81, 0xc0, 0x9b, 0x37, 0x0f, 0x00, 0x08, 0xa2, 0x92, 0x30, 0x9a, 0xfc, 0x29, 0x20, 0x99, 0x82,
+ 0xaa, 0x12, 0x8c, 0xc7, 0x51, 0x0c, 0xa1, 0x02, 0x09, 0xc2, 0x11, 0x4c, 0x28, 0xa3, 0xe8, 0x19,
+ 0x01, 0xd2, 0x3b, 0x08, 0x10, 0xb2, 0x8a, 0x83, 0x70, 0x10, 0xb8, 0x0a, 0x00, 0x47, 0x98, 0xc2,
+ 0x39, 0x98, 0x19, 0xac, 0x83, 0xf9, 0x60, 0x9a, 0x12, 0x80, 0x89, 0x27, 0x0c, 0x09, 0x08, 0x32,
+ 0xb8, 0xda, 0x80, 0x24, 0x08, 0x19, 0x2d, 0xf0, 0x98, 0x41, 0xb9, 0x90, 0x40, 0x41, 0xba, 0x80,
+ 0x91, 0x01, 0x19, 0x1d, 0x42, 0xc0, 0x91, 0x28, 0x39, 0xf4, 0x3a, 0xb2, 0x1f, 0x88, 0xb0, 0x40,
+ 0xba, 0x48, 0xa3, 0x31, 0xc0, 0x39, 0x5a, 0x81, 0xf8, 0xa1, 0x69, 0x40, 0x80, 0x80, 0x88, 0x08,
+ 0x92, 0xd0, 0x3b, 0x99, 0xe9, 0x23, 0x48, 0x00, 0x9b, 0xb1, 0x12, 0x35, 0x8c, 0x05, 0x8f, 0x10,
+ 0x83, 0x00, 0x1c, 0x00, 0x08, 0x8a, 0x80, 0xc9, 0x9d, 0x05, 0x01, 0x4a, 0xa0, 0xa8, 0xa9, 0x89,
+ 0x62, 0xa2, 0x01, 0x2c, 0xb9, 0x52, 0x09, 0xc0, 0xa5, 0x4b, 0x80, 0x31, 0x08, 0x8a, 0x30, 0x13,
+ 0xd1, 0x8f, 0x04, 0xaa, 0x5a, 0x09, 0xa4, 0x8a, 0x80, 0x99, 0x60, 0xb0, 0x53, 0x8c, 0xa8, 0x19,
+ 0x91, 0x87, 0x0a, 0x2a, 0x21, 0x80, 0x11, 0xe8, 0x92, 0x1a, 0x1b, 0xd3, 0x59, 0x03, 0x22, 0xbf,
+ 0x43, 0xc8, 0x80, 0x08, 0xa0, 0x2c, 0x20, 0x61, 0x90, 0xaa, 0xf8, 0x42, 0x80, 0x11, 0xab, 0x50,
+ 0x13, 0x8d, 0xc3, 0x89, 0x19, 0x81, 0x9c, 0xd2, 0x98, 0x7a, 0x00, 0x19, 0xa1, 0x91, 0xc0, 0x33,
+ 0x1c, 0x99, 0xcb, 0x12, 0x49, 0xb9, 0x85, 0x09, 0x82, 0xf8, 0x18, 0x3d, 0x88, 0x82, 0x43, 0xb1,
+ 0xc1, 0x10, 0x1a, 0x78, 0x88, 0x91, 0x99, 0xb5, 0x31, 0x2b, 0x80, 0x13, 0x9c, 0xf2, 0x8a, 0x0b,
+ 0x35, 0x08, 0xca, 0x8a, 0x85, 0x22, 0x6b, 0xa0, 0xb3, 0x10, 0xbd, 0x48, 0x10, 0xd8, 0x58, 0x99,
+ 0x94, 0x18, 0x98, 0xc1, 0x30, 0x9c, 0x84, 0x0a, 0x8c, 0x90, 0x43, 0x08, 0xf1, 0x1a, 0xa3, 0x10,
+ 0x4c, 0x8b, 0x81, 0x13, 0x26, 0xb8, 0x2f, 0x88, 0x92, 0x82, 0x48, 0x1a, 0xb9, 0x38, 0x13, 0xdd,
+ 0x99, 0x14, 0xdb, 0x41, 0x2a, 0xb2, 0xa8, 0x71, 0x99, 0xba, 0x41, 0x92, 0x24, 0x29, 0xc8, 0x21,
+ 0x2a, 0xd8, 0x05, 0x0d, 0xa8, 0x20, 0x09, 0x08, 0x97, 0x08, 0x1b, 0x3b, 0x00, 0xa4, 0x22, 0xb3,
+ 0x9c, 0x72, 0xf3, 0x28, 0x3a, 0xa1, 0xea, 0x30, 0x99, 0xa2, 0x00, 0x8d, 0x10, 0x11, 0x3a, 0x97,
+ 0x2b, 0xd2, 0x18, 0xa0, 0x0b, 0x0d, 0x83, 0x32, 0x42, 0x0f, 0xa1, 0xd2, 0x04, 0x0b, 0x3b, 0x12,
+ 0xc2, 0x4a, 0x99, 0xb8, 0x80, 0x07, 0x9c, 0x59, 0xb2, 0x30, 0x90, 0xb1, 0x9a, 0x38, 0x11, 0xf0,
+ 0xba, 0xff, 0x16, 0x00, 0x07, 0x88, 0x10, 0x91, 0x9b, 0x00, 0x1a, 0x37, 0x99, 0x3b, 0xe2, 0x20,
+ 0xf9, 0x40, 0x19, 0x99, 0x81, 0xb1, 0xc2, 0x10, 0x4d, 0x1b, 0x81, 0xb2, 0x23, 0xab, 0x31, 0xd0,
+ 0xc9, 0x29, 0x9c, 0x92, 0x1a, 0x81, 0xdf, 0x84, 0x89, 0x2b, 0x14, 0x32, 0x09, 0x0a, 0x0c, 0x95,
+ 0xa9, 0x11, 0x27, 0x8f, 0x10, 0xa8, 0xb0, 0x22, 0x0d, 0x02, 0x02, 0x1e, 0xb2, 0x22, 0xa1, 0x3d,
+ 0x01, 0xc3, 0x19, 0x62, 0x80, 0xc8, 0x12, 0x18, 0x0a, 0x1c, 0x91, 0xb0, 0x32, 0x37, 0x9f, 0x03,
+ 0x2b, 0x9c, 0xb2, 0x04, 0x60, 0x99, 0xa8, 0xc8, 0x22, 0x8c, 0x03, 0x5a, 0xa1, 0x98, 0x32, 0x9e,
+ 0x14, 0xa3, 0x9b, 0x98, 0x8f, 0x33, 0x98, 0x9c, 0x1a, 0xd3, 0x13, 0x09, 0x11, 0x2c, 0xc8, 0x70,
+ 0x92, 0x89, 0x09, 0xa4, 0x39, 0xcb, 0x02, 0x91, 0x2c, 0xe0, 0x29, 0x91, 0x7b, 0x94, 0x90, 0x1c,
+ 0x01, 0xa1, 0x09, 0x3b, 0x81, 0x88, 0x70, 0xa2, 0xb1, 0x05, 0x0b, 0x78, 0x09, 0xe3, 0x30, 0xc8,
+ 0x28, 0x09, 0x02, 0x00, 0x60, 0xab, 0xa8, 0xa3, 0xb0, 0x78, 0x13, 0x9b, 0x0a, 0x82, 0xa4, 0x8a,
+ 0x1f, 0x0c, 0xd2, 0x02, 0x08, 0x13, 0x0f, 0xa2, 0x69, 0x9a, 0xa1, 0xa0, 0x11, 0x80, 0x5b, 0x2c,
+ 0xe2, 0x32, 0x98, 0x03, 0x8a, 0x39, 0x9a, 0xc0, 0x22, 0x79, 0xd1, 0x08, 0xc2, 0x28, 0x89, 0x8a,
+ 0xc3, 0x91, 0x1b, 0x91, 0x7e, 0x8b, 0xd4, 0x21, 0x08, 0x00, 0x89, 0x1d, 0x09, 0xb1, 0x16, 0x09,
+ 0x90, 0x38, 0x89, 0x98, 0x98, 0x85, 0xb2, 0x79, 0x88, 0x39, 0xca, 0x02, 0x92, 0x87, 0x49, 0x84,
+ 0x4b, 0xa1, 0x39, 0xca, 0x83, 0xc9, 0x91, 0x2a, 0x4b, 0x30, 0xf3, 0x30, 0xa9, 0x92, 0x47, 0x1e,
+ 0x88, 0x80, 0x91, 0x20, 0x08, 0x09, 0x98, 0xe8, 0xa8, 0x4a, 0x83, 0x3c, 0xa9, 0xb7, 0x98, 0x22,
+ 0x48, 0x00, 0x18, 0x00, 0xe2, 0x38, 0xa9, 0x08, 0x1a, 0x31, 0xb8, 0xb1, 0x0e, 0x07, 0x18, 0x1b,
+ 0xf3, 0x28, 0xc8, 0x18, 0x38, 0xd2, 0x1a, 0x80, 0x8a, 0x12, 0x33, 0xac, 0x50, 0x89, 0xd4, 0x90,
+ 0x00, 0x4c, 0xc8, 0x13, 0x1a, 0x9a, 0x94, 0x03, 0x51, 0x9b, 0x04, 0x90, 0x0a, 0x9b, 0xd1, 0x89,
+ 0x91, 0x1b, 0xf8, 0x4e, 0x90, 0x29, 0x11, 0x12, 0x96, 0x09, 0xaa, 0x0a, 0x07, 0x88, 0x30, 0x60,
+ 0x9b, 0x84, 0x86, 0x0a, 0x91, 0x1c, 0xb8, 0x38, 0xa2, 0xf9, 0x30, 0x99, 0x02, 0x19, 0xc0, 0x6b,
+ 0xa8, 0x8a, 0x86, 0xa8, 0x40, 0x09, 0x89, 0x91, 0xa3, 0xb4, 0x4d, 0x31, 0x9e, 0x92, 0x11, 0xb9,
+ 0xda, 0x21, 0x38, 0xb2, 0x2e, 0x00, 0xb4, 0x29, 0x11, 0x2b, 0x1a, 0x06, 0x98, 0x69, 0x82, 0x83,
+ 0xca, 0x9e, 0x03, 0x2c, 0x18, 0x93, 0x0b, 0xe3, 0x02, 0x24, 0x09, 0x18, 0x6a, 0xa0, 0xb0, 0x18,
+ 0x0b, 0xf2, 0x3a, 0x11, 0xc1, 0x19, 0x38, 0x2c, 0xfb, 0x95, 0x10, 0x1a, 0x20, 0x05, 0xa9, 0xa1,
+ 0xba, 0x79, 0x0a, 0x83, 0xe2, 0x09, 0x80, 0x92, 0x1c, 0x1c, 0x82, 0x94, 0x20, 0xa0, 0x4d, 0x70,
+ 0xd9, 0x13, 0x00, 0x0b, 0x0c, 0x81, 0xa1, 0x90, 0x71, 0x02, 0x90, 0xaa, 0x10, 0x30, 0x28, 0xfa,
+ 0x89, 0x22, 0x1d, 0xa5, 0x88, 0x89, 0x50, 0x89, 0xb0, 0x69, 0xc1, 0xa8, 0x30, 0x99, 0x6a, 0xd1,
+ 0xa0, 0x68, 0x98, 0x98, 0x32, 0x18, 0x88, 0xba, 0x07, 0x89, 0x0a, 0x41, 0x80, 0x00, 0x25, 0x0b,
+ 0xa1, 0x8f, 0x90, 0x31, 0xd3, 0x91, 0x8b, 0x3b, 0x9c, 0x21, 0xc0, 0xf0, 0x99, 0x20, 0x3b, 0x07,
+ 0x8c, 0x82, 0x81, 0x29, 0x00, 0x58, 0x08, 0xc8, 0x33, 0x4a, 0xe8, 0x13, 0x29, 0x99, 0x03, 0xa9,
+ 0x10, 0xb8, 0xb9, 0x79, 0xa4, 0x87, 0x9c, 0x3b, 0xb3, 0x38, 0xca, 0x90, 0x8f, 0x8a, 0x03, 0xc0,
+ 0x73, 0xff, 0x17, 0x00, 0x89, 0xf2, 0x11, 0x10, 0x08, 0x18, 0x87, 0x29, 0x39, 0xe2, 0x08, 0x1c,
+ 0x05, 0x98, 0x90, 0x81, 0x1c, 0xab, 0xb0, 0x32, 0x91, 0x37, 0x0c, 0x81, 0xc0, 0x13, 0x30, 0x08,
+ 0x13, 0x8f, 0xc0, 0x21, 0x80, 0x03, 0x7b, 0x10, 0x02, 0xb8, 0x80, 0x0a, 0x38, 0xa8, 0xdb, 0xd2,
+ 0x1a, 0xbf, 0x12, 0x02, 0xac, 0x29, 0x27, 0xb0, 0x38, 0xb0, 0x0f, 0x20, 0x96, 0x00, 0x99, 0x29,
+ 0x30, 0xaf, 0xa1, 0x10, 0x99, 0x00, 0x81, 0xb8, 0x21, 0x5f, 0xa1, 0xa9, 0x0a, 0x80, 0x97, 0x3a,
+ 0x3b, 0xa3, 0x03, 0x2b, 0xa7, 0x7a, 0x81, 0xba, 0x58, 0x01, 0xc1, 0x80, 0x2a, 0x28, 0x88, 0x04,
+ 0x02, 0x4d, 0xfa, 0x91, 0x39, 0x83, 0x0e, 0x90, 0x88, 0x21, 0xa3, 0x09, 0x2e, 0xd2, 0x01, 0x00,
+ 0x99, 0x7c, 0xa8, 0xa2, 0x20, 0x0c, 0xb0, 0x82, 0x71, 0x90, 0x09, 0x2a, 0xc1, 0xd1, 0x00, 0x53,
+ 0x20, 0x9c, 0xa2, 0x12, 0x09, 0x50, 0xd9, 0x88, 0x12, 0xa8, 0x02, 0x69, 0x90, 0x08, 0xa9, 0x59,
+ 0xc5, 0x39, 0x08, 0xda, 0x90, 0x01, 0x20, 0xbb, 0x19, 0x26, 0xaf, 0x81, 0x93, 0x19, 0x48, 0xb0,
+ 0xc4, 0x98, 0x7a, 0x99, 0x89, 0xb4, 0x04, 0x1a, 0x51, 0x00, 0x90, 0x10, 0x0d, 0xa0, 0x09, 0x93,
+ 0x80, 0x0f, 0xb8, 0x42, 0x19, 0xa4, 0x9d, 0x89, 0x41, 0x11, 0x0a, 0xec, 0x01, 0x82, 0x8a, 0x92,
+ 0x10, 0x29, 0x11, 0xf0, 0x21, 0xaa, 0x7a, 0xb1, 0x23, 0xe3, 0x51, 0x19, 0x9a, 0x08, 0xc4, 0x11,
+ 0x0c, 0xc1, 0x59, 0x08, 0x91, 0x84, 0x1a, 0x39, 0x80, 0x05, 0x29, 0x9b, 0x92, 0x25, 0xbb, 0x3a,
+ 0x9b, 0x97, 0xb0, 0x29, 0xc9, 0x25, 0x1a, 0x38, 0x2e, 0xa3, 0x96, 0x81, 0x8e, 0x19, 0xa8, 0x80,
+ 0x04, 0x89, 0x30, 0x8c, 0xa6, 0x08, 0xa0, 0x00, 0x0b, 0x00, 0x08, 0x93, 0x1d, 0xf5, 0x28, 0xa8,
+ 0xc6, 0xff, 0x17, 0x00, 0x11, 0xb8, 0x19, 0x19, 0x12, 0xe3, 0x6f, 0xb0, 0x01, 0x92, 0x28, 0x2a,
+ 0x04, 0x9c, 0x10, 0xf1, 0x49, 0x00, 0xa8, 0x18, 0x05, 0x1a, 0x8e, 0xa1, 0x84, 0x2a, 0x48, 0x90,
+ 0x99, 0x1b, 0xb8, 0x52, 0x85, 0x1c, 0xc0, 0x80, 0x1a, 0x01, 0xb1, 0x8a, 0x0d, 0x98, 0x64, 0x98,
+ 0xd9, 0x13, 0x0b, 0x31, 0x9a, 0x22, 0xb6, 0x02, 0x9f, 0x40, 0x90, 0x03, 0x98, 0xa0, 0x4a, 0x30,
+ 0xaa, 0x97, 0x09, 0x53, 0x98, 0x82, 0x89, 0x9a, 0x93, 0xaa, 0x01, 0x7a, 0xf1, 0x40, 0x99, 0x91,
+ 0x03, 0x8d, 0x08, 0x00, 0xf9, 0x98, 0x12, 0x60, 0x8b, 0x92, 0x99, 0x83, 0x3d, 0x14, 0x08, 0xd8,
+ 0x81, 0x83, 0x8b, 0xda, 0x22, 0x59, 0x19, 0xc1, 0xa4, 0x6b, 0x09, 0xc8, 0x40, 0xa2, 0x0b, 0x2a,
+ 0x97, 0x38, 0x21, 0xac, 0x88, 0x01, 0x93, 0x11, 0x9f, 0x93, 0x1b, 0x88, 0x13, 0xf1, 0x29, 0x88,
+ 0x88, 0x14, 0x0e, 0x9a, 0x93, 0x40, 0x90, 0xca, 0xa3, 0x71, 0xa8, 0x21, 0xf0, 0x41, 0x9b, 0x90,
+ 0xb1, 0x93, 0x70, 0xa0, 0x09, 0x8a, 0xa1, 0xf1, 0x4a, 0x08, 0x12, 0x01, 0x90, 0xac, 0xc8, 0x6a,
+ 0x01, 0x13, 0xa9, 0x89, 0xea, 0x41, 0x18, 0x99, 0x05, 0xba, 0x30, 0x0c, 0x08, 0xa1, 0xb2, 0x9f,
+ 0x09, 0x37, 0x89, 0x3b, 0x89, 0x97, 0xa9, 0x39, 0x2a, 0xa8, 0x3a, 0xd1, 0x09, 0xb2, 0x80, 0x78,
+ 0x40, 0xb0, 0x05, 0x10, 0x1b, 0xa3, 0x37, 0x9d, 0x81, 0x5b, 0xf9, 0x08, 0x00, 0x80, 0x10, 0x02,
+ 0x59, 0xa8, 0x88, 0x88, 0x83, 0xbe, 0x22, 0x92, 0x39, 0x8a, 0x99, 0xa7, 0x1a, 0x09, 0x01, 0xc3,
+ 0x0e, 0x00, 0xb2, 0x34, 0xa8, 0x8f, 0x83, 0x2a, 0x86, 0x09, 0xa0, 0x18, 0x14, 0x82, 0xaf, 0x98,
+ 0x21, 0xb2, 0x3b, 0x48, 0xc6, 0x80, 0x09, 0xc8, 0x9b, 0x72, 0xa1, 0x88, 0x38, 0x13, 0xba, 0x73,
+ 0xcb, 0xff, 0x1a, 0x00, 0x4a, 0x1a, 0xc0, 0x00, 0xc3, 0x19, 0x5b, 0x11, 0x81, 0xb1, 0xf1, 0x30,
+ 0x8c, 0xa8, 0x48, 0x82, 0x89, 0xa4, 0x93, 0x5c, 0xa8, 0x34, 0x8a, 0x12, 0x2b, 0xc5, 0x89, 0x0c,
+ 0x88, 0x10, 0xa3, 0xab, 0x01, 0xbc, 0x49, 0x80, 0x1e, 0x19, 0xa7, 0xa1, 0x12, 0x1e, 0x00, 0x08,
+ 0xc1, 0x40, 0x38, 0xa0, 0x84, 0x60, 0x9c, 0xb3, 0x48, 0x86, 0x3a, 0x9a, 0x92, 0x1a, 0x32, 0xb4,
+ 0x31, 0x3c, 0xf8, 0x19, 0xa0, 0xaa, 0x21, 0x91, 0x2d, 0x93, 0x6d, 0xc2, 0x08, 0x80, 0x80, 0x18,
+ 0x9e, 0x03, 0x8a, 0x82, 0x93, 0xbf, 0x39, 0xa2, 0x12, 0x11, 0x07, 0x0a, 0x89, 0x8e, 0x01, 0xc3,
+ 0x91, 0x21, 0x1c, 0x11, 0x19, 0x3d, 0xb1, 0xe3, 0x28, 0xe1, 0x88, 0x91, 0x20, 0x79, 0x91, 0x18,
+ 0xac, 0x15, 0xc0, 0x1a, 0x14, 0x89, 0x02, 0x38, 0xca, 0x39, 0xb4, 0x84, 0x8f, 0x91, 0x30, 0xb1,
+ 0x10, 0xa9, 0x50, 0x8c, 0x98, 0xd2, 0x00, 0x5c, 0xaa, 0xb3, 0x12, 0x31, 0x28, 0xaf, 0x91, 0x01,
+ 0x18, 0x1a, 0x26, 0xa1, 0x1a, 0x73, 0x80, 0xa1, 0x0a, 0x87, 0x8b, 0x82, 0x0b, 0x3c, 0xf4, 0x10,
+ 0x18, 0x2c, 0x98, 0x82, 0x91, 0x98, 0x61, 0xaa, 0x14, 0x3a, 0xb0, 0x1e, 0xa3, 0x22, 0xc2, 0x08,
+ 0x7b, 0x08, 0xb1, 0xa8, 0x01, 0x1e, 0x00, 0xf0, 0x81, 0x28, 0x1b, 0x80, 0x0e, 0x92, 0x90, 0x83,
+ 0x81, 0x59, 0x39, 0xc3, 0xa9, 0x11, 0x1d, 0xb0, 0xdd, 0x21, 0x88, 0x0e, 0xa1, 0x23, 0x82, 0x3d,
+ 0xab, 0xd1, 0x81, 0x43, 0xaa, 0xa2, 0x3a, 0x7c, 0xc2, 0x1a, 0x88, 0x31, 0xbd, 0x33, 0x10, 0xe8,
+ 0x30, 0x88, 0x90, 0x70, 0x88, 0x88, 0xa8, 0xa0, 0xab, 0x27, 0x5b, 0xa2, 0x82, 0x98, 0x7a, 0x89,
+ 0x90, 0x98, 0x00, 0xb0, 0xb8, 0x70, 0x89, 0x21, 0xa0, 0x87, 0x90, 0x00, 0x69, 0x18, 0x8b, 0xb1,
+ 0xd4, 0xff, 0x13, 0x00, 0x30, 0x2f, 0x98, 0xe4, 0x01, 0x01, 0x9a, 0x99, 0x19, 0x19, 0x32, 0xb9,
+ 0x62, 0xe9, 0x18, 0xac, 0xa3, 0xaa, 0x71, 0x3a, 0xa0, 0x82, 0x81, 0x99, 0x17, 0x9f, 0x22, 0xa0,
+ 0x1a, 0x80, 0x03, 0x68, 0xbc, 0x03, 0x00, 0x14, 0x29, 0xc9, 0x81, 0x2a, 0x8a, 0x59, 0x86, 0x91,
+ 0x28, 0x3c, 0xb1, 0xa3, 0x58, 0x8b, 0xd9, 0x81, 0x04, 0x8f, 0x80, 0x19, 0x95, 0x82, 0x8a, 0x82,
+ 0x79, 0x89, 0xa9, 0xa8, 0xa3, 0x52, 0x8a, 0xf0, 0x38, 0x89, 0x2c, 0x93, 0xda, 0x70, 0xa3, 0x10,
+ 0x3a, 0x88, 0x08, 0x98, 0xb4, 0x0f, 0x00, 0x92, 0x41, 0xb9, 0x49, 0xd0, 0x33, 0x8a, 0x92, 0x8b,
+ 0x17, 0x18, 0xa0, 0xc2, 0x99, 0x18, 0x78, 0x2b, 0xc0, 0xd2, 0x38, 0x91, 0x1a, 0x1a, 0xa3, 0x8f,
+ 0x80, 0xa1, 0x30, 0xa7, 0x30, 0x9b, 0x18, 0x14, 0x1b, 0x2d, 0xd8, 0xb1, 0x84, 0x20, 0x0c, 0x2e,
+ 0xa3, 0x81, 0x38, 0x1a, 0xc3, 0x98, 0x1d, 0x9a, 0x97, 0x5a, 0xa0, 0x80, 0x09, 0x24, 0x09, 0x10,
+ 0x6a, 0xc8, 0x01, 0x01, 0x1b, 0x10, 0xba, 0xb4, 0x1a, 0x71, 0x28, 0x93, 0x39, 0xf2, 0x80, 0x39,
+ 0x9b, 0x07, 0x1c, 0x9a, 0xa4, 0x08, 0x18, 0xf2, 0x89, 0x1a, 0x19, 0x89, 0xc5, 0x09, 0x50, 0x21,
+ 0x91, 0x88, 0xeb, 0x50, 0x18, 0xc8, 0x00, 0xc1, 0x80, 0x2a, 0x08, 0xa8, 0x1e, 0x01, 0x05, 0x39,
+ 0xc1, 0x24, 0xad, 0x02, 0x2a, 0x01, 0x9c, 0x03, 0x1b, 0xd1, 0x11, 0x31, 0x89, 0xa5, 0xbd, 0x71,
+ 0x10, 0xa0, 0x29, 0x82, 0xbb, 0x02, 0x1b, 0xf0, 0x16, 0x9b, 0x29, 0x68, 0xd9, 0x91, 0x80, 0x30,
+ 0x20, 0x9d, 0x11, 0x90, 0x20, 0xd1, 0x88, 0x8a, 0x33, 0xa3, 0x8f, 0x29, 0x87, 0x18, 0x99, 0x20,
+ 0x8c, 0xd8, 0x01, 0x13, 0x72, 0xa9, 0x0c, 0x29, 0xa3, 0x91, 0x99, 0x34, 0x80, 0x0e, 0x22, 0xd1,
+ 0xe9, 0xff, 0x18, 0x00, 0x22, 0x00, 0xb2, 0x6a, 0x0d, 0xa2, 0x81, 0x29, 0x1d, 0x29, 0x14, 0xe2,
+ 0x10, 0x8a, 0x09, 0x2a, 0xd9, 0x10, 0x3b, 0xf9, 0x31, 0x1b, 0x94, 0xa8, 0x0a, 0x70, 0x18, 0x81,
+ 0xf3, 0x1a, 0x22, 0x8a, 0x83, 0xbb, 0x84, 0x50, 0x49, 0xa9, 0x61, 0xa8, 0xd1, 0x2b, 0x02, 0x32,
+ 0x11, 0x8f, 0x22, 0x08, 0x9b, 0xe2, 0x88, 0x0a, 0xc3, 0x31, 0x2b, 0xdb, 0x93, 0x06, 0x30, 0xbc,
+ 0x91, 0x20, 0x9f, 0x9b, 0x03, 0x80, 0x53, 0x1b, 0xd1, 0x81, 0x38, 0x41, 0x98, 0x9b, 0xc1, 0x1b,
+ 0x61, 0xe1, 0x93, 0x0d, 0xab, 0x00, 0xa4, 0x30, 0x12, 0x0f, 0x80, 0xb2, 0x8b, 0x72, 0x10, 0x88,
+ 0x99, 0x15, 0x80, 0x20, 0xb0, 0x19, 0xc2, 0x38, 0x75, 0xbb, 0xa4, 0x02, 0x98, 0x09, 0x0c, 0x92,
+ 0x1b, 0x8b, 0xc6, 0xc9, 0x14, 0x3a, 0x49, 0xd1, 0x80, 0x08, 0x19, 0x81, 0x72, 0xb0, 0xaa, 0x83,
+ 0x2b, 0xb3, 0x1f, 0x33, 0x08, 0x2a, 0xf9, 0x02, 0x9d, 0x30, 0x92, 0x38, 0x4b, 0x85, 0x80, 0x15,
+ 0x1c, 0x81, 0x0c, 0xa2, 0x11, 0x42, 0xaa, 0x01, 0x8d, 0x21, 0xe1, 0x84, 0x88, 0x1c, 0x32, 0x8a,
+ 0x1a, 0xf1, 0x1d, 0x11, 0x0b, 0xb0, 0x89, 0xa1, 0x99, 0x5d, 0x99, 0xb3, 0x21, 0xb5, 0x48, 0xcb,
+ 0x78, 0x00, 0xa1, 0x91, 0x18, 0x93, 0x5c, 0xc2, 0x08, 0x8c, 0x22, 0x19, 0xc9, 0x34, 0x2a, 0xba,
+ 0x95, 0xd2, 0x3a, 0x92, 0x5d, 0xa9, 0xa1, 0x23, 0x0a, 0x80, 0x30, 0xb0, 0x04, 0xa1, 0x4f, 0x89,
+ 0xb8, 0x12, 0x92, 0xbd, 0x38, 0x39, 0x12, 0xfb, 0x83, 0xbb, 0x3d, 0xb0, 0x9a, 0xa1, 0x82, 0x2a,
+ 0x3d, 0xb0, 0xf8, 0x68, 0x98, 0x39, 0xb1, 0xd0, 0x78, 0x21, 0xca, 0x21, 0xa8, 0x38, 0xc0, 0x2a,
+ 0xa0, 0x58, 0xe0, 0x84, 0x29, 0x4c, 0x90, 0xa2, 0x08, 0x91, 0x4a, 0x1a, 0xc9, 0xa9, 0xa6, 0x10,
+ 0x6e, 0xff, 0x15, 0x00, 0xa5, 0x88, 0x80, 0x78, 0x09, 0x95, 0x10, 0x88, 0x0d, 0xb8, 0x22, 0x89,
+ 0xb2, 0x18, 0x21, 0x55, 0xae, 0xa3, 0x89, 0x2b, 0x43, 0xc4, 0x10, 0x20, 0x0e, 0x88, 0x20, 0xa9,
+ 0x84, 0x30, 0xb1, 0x70, 0x99, 0x1a, 0x16, 0x9b, 0xb5, 0x19, 0x80, 0x08, 0x3a, 0x09, 0xb4, 0x13,
+ 0xbc, 0x3f, 0xa1, 0x82, 0x48, 0xa0, 0x8c, 0x88, 0xb0, 0xb1, 0x78, 0x9a, 0x26, 0xba, 0x80, 0x92,
+ 0x33, 0x9f, 0xc1, 0x51, 0xa1, 0xa0, 0x72, 0x01, 0x98, 0x03, 0xc0, 0x10, 0x0a, 0x1f, 0xb0, 0x92,
+ 0x93, 0x99, 0x00, 0x78, 0xab, 0x11, 0x81, 0x42, 0xc2, 0x06, 0x29, 0x00, 0x0e, 0xb8, 0xc2, 0x99,
+ 0x00, 0x2d, 0x21, 0x28, 0xa0, 0xe2, 0xa2, 0x1c, 0x39, 0xaa, 0x15, 0x99, 0x91, 0x4b, 0xf8, 0x81,
+ 0x43, 0x08, 0x90, 0xa0, 0x06, 0xa8, 0x0a, 0x1a, 0x13, 0x04, 0x0f, 0xa2, 0x88, 0x29, 0x24, 0xf8,
+ 0x03, 0x18, 0x3c, 0x1b, 0x84, 0xa4, 0x1a, 0xa1, 0x8a, 0x85, 0x2b, 0x9f, 0x93, 0x28, 0x2a, 0x90,
+ 0xa8, 0x26, 0x0e, 0xb1, 0x20, 0xa9, 0xb0, 0x38, 0xca, 0x11, 0xa4, 0x98, 0xaf, 0x28, 0x0b, 0xb6,
+ 0x91, 0x28, 0x8d, 0x38, 0x97, 0x2a, 0x19, 0xb6, 0x01, 0x2a, 0xab, 0x24, 0x91, 0x0d, 0xc9, 0x85,
+ 0x2b, 0x81, 0x1b, 0x89, 0xd8, 0x02, 0x02, 0xb1, 0x62, 0x18, 0xaf, 0x32, 0xa4, 0x22, 0x19, 0xc1,
+ 0x00, 0x31, 0x8e, 0x01, 0x8b, 0x63, 0xaa, 0xb3, 0x38, 0x8f, 0xb0, 0x29, 0x16, 0x08, 0xcb, 0x81,
+ 0x10, 0x5b, 0x0b, 0x07, 0x90, 0x00, 0xa9, 0x0b, 0x18, 0x14, 0x8e, 0xa9, 0x15, 0x88, 0x10, 0x99,
+ 0x83, 0x21, 0x0c, 0xcb, 0x2a, 0xb5, 0x63, 0x90, 0x0b, 0x8e, 0x23, 0xa9, 0x84, 0x89, 0x68, 0x0b,
+ 0x84, 0x98, 0x85, 0x19, 0x19, 0x9a, 0xd0, 0x30, 0x09, 0x31, 0xb2, 0x27, 0x4c, 0xe9, 0x10, 0x99,
+ 0x17, 0x00, 0x1a, 0x00, 0x91, 0x02, 0x8c, 0x91, 0x33, 0x9b, 0x99, 0xf8, 0x1f, 0x81, 0x00, 0x12,
+ 0x08, 0x09, 0xca, 0x23, 0xe3, 0x48, 0x88, 0x89, 0x90, 0x1c, 0x87, 0x88, 0x82, 0xb8, 0x71, 0x22,
+ 0x1e, 0xbb, 0x94, 0x19, 0xa0, 0x38, 0x18, 0x93, 0x81, 0x8f, 0x12, 0x30, 0xea, 0x29, 0x03, 0x9c,
+ 0xa4, 0x13, 0x59, 0x1c, 0xd9, 0x92, 0x80, 0x33, 0xab, 0x29, 0xca, 0x42, 0xfa, 0xa0, 0x71, 0x1b,
+ 0xb0, 0x22, 0xc8, 0x02, 0x11, 0x02, 0x2a, 0x09, 0xeb, 0xa0, 0x18, 0x40, 0xb9, 0x80, 0x57, 0x09,
+ 0x0b, 0x98, 0xb1, 0x0b, 0x43, 0xb7, 0x2b, 0x21, 0x8d, 0xa3, 0x10, 0x5b, 0xa1, 0x21, 0xb2, 0x09,
+ 0xca, 0xa2, 0x7e, 0x91, 0x10, 0xa3, 0x1b, 0xb9, 0x48, 0x0c, 0xa4, 0x98, 0x81, 0x9a, 0x3f, 0x12,
+ 0xa1, 0x21, 0x08, 0xa4, 0x1b, 0x24, 0x80, 0xf0, 0x9b, 0xcb, 0x64, 0x80, 0x08, 0x16, 0x2a, 0x9a,
+ 0xc6, 0x29, 0x29, 0xab, 0x11, 0x86, 0xa9, 0x39, 0x98, 0xb2, 0x35, 0x28, 0xbd, 0x81, 0x8a, 0x31,
+ 0xb3, 0xc8, 0x0e, 0x9f, 0x81, 0x01, 0x28, 0x51, 0x9a, 0xaa, 0x92, 0x11, 0xb8, 0x51, 0x99, 0x38,
+ 0x1d, 0x9d, 0xd1, 0x95, 0x28, 0x52, 0x09, 0x8a, 0x81, 0xb3, 0x0b, 0x01, 0xe3, 0x69, 0x20, 0xbb,
+ 0xb1, 0x23, 0x10, 0xc9, 0x16, 0x2a, 0xa1, 0x5d, 0xc0, 0x00, 0x88, 0x16, 0x1a, 0x80, 0x11, 0xba,
+ 0xc2, 0x94, 0x5a, 0xab, 0x18, 0xa8, 0x1a, 0xa4, 0x0a, 0x9f, 0x82, 0x13, 0x98, 0x1f, 0x80, 0x82,
+ 0xc2, 0x4b, 0x80, 0x21, 0x2e, 0xc8, 0x85, 0x4a, 0xb1, 0x18, 0x10, 0x31, 0xba, 0xf8, 0x1a, 0x05,
+ 0x0a, 0x0b, 0x00, 0xc1, 0x05, 0x99, 0x5e, 0x80, 0x09, 0x90, 0x81, 0xb9, 0x72, 0x9b, 0x20, 0xc8,
+ 0xc0, 0x41, 0x90, 0x93, 0x1b, 0x19, 0x02, 0x10, 0xf1, 0x08, 0x2b, 0x1f, 0x93, 0x15, 0xa1, 0x10,
+ 0x13, 0x00, 0x17, 0x00, 0x10, 0xf3, 0x28, 0xab, 0x82, 0x3a, 0xf0, 0x28, 0x32, 0xba, 0x09, 0xb2,
+ 0x3e, 0xa5, 0x21, 0x99, 0xac, 0x11, 0x0a, 0x29, 0x36, 0xcb, 0xa1, 0x00, 0x12, 0x41, 0x68, 0xfa,
+ 0x31, 0x89, 0x19, 0xe2, 0x02, 0x39, 0xd0, 0x11, 0x1d, 0x81, 0x90, 0xa0, 0x93, 0x71, 0xba, 0x00,
+ 0x61, 0x98, 0x32, 0xc9, 0x00, 0x90, 0x3a, 0x63, 0xcc, 0x83, 0x89, 0x78, 0xb0, 0x90, 0x21, 0x99,
+ 0x03, 0x19, 0x1a, 0x19, 0xc4, 0xc1, 0x7a, 0xa9, 0xb1, 0x3d, 0x98, 0x02, 0x83, 0xe9, 0x08, 0x8e,
+ 0x00, 0x83, 0x9b, 0x02, 0x63, 0x90, 0x09, 0xbc, 0x05, 0xb8, 0x68, 0x98, 0x99, 0x80, 0xd1, 0x32,
+ 0x3c, 0x1a, 0xc1, 0x04, 0xb0, 0x0f, 0x11, 0x89, 0x84, 0x41, 0x09, 0x98, 0x4b, 0xc2, 0x80, 0xd9,
+ 0x23, 0x8a, 0x52, 0x18, 0x4b, 0x80, 0xf4, 0x10, 0x1a, 0x90, 0xb9, 0x39, 0xa2, 0x42, 0xab, 0x49,
+ 0x00, 0x15, 0xf9, 0x31, 0x1b, 0x10, 0xe0, 0x11, 0x0b, 0x91, 0xc0, 0x19, 0xd8, 0x72, 0x91, 0xb8,
+ 0x38, 0x00, 0x14, 0x9a, 0x99, 0x81, 0x32, 0x48, 0x38, 0xdd, 0x94, 0x31, 0xbb, 0xbb, 0x47, 0x8a,
+ 0x82, 0x0a, 0x44, 0xca, 0x90, 0x40, 0x01, 0xa8, 0x22, 0x80, 0x9f, 0x03, 0x49, 0x9b, 0xd3, 0x31,
+ 0x20, 0x9b, 0xa2, 0xfa, 0x48, 0x9c, 0x01, 0x8d, 0x88, 0x08, 0x95, 0x40, 0x8b, 0xa4, 0x30, 0x40,
+ 0x8e, 0xb2, 0x11, 0x2a, 0x92, 0x91, 0x2f, 0x80, 0x81, 0xd8, 0x00, 0x91, 0x0b, 0x1a, 0x82, 0x3c,
+ 0x22, 0x17, 0xca, 0xb1, 0x18, 0x8e, 0x42, 0x98, 0x30, 0x1d, 0xa4, 0x19, 0xc0, 0x09, 0x0a, 0xc3,
+ 0x22, 0x69, 0x01, 0x50, 0x2a, 0xf4, 0x98, 0x38, 0x99, 0x00, 0x10, 0x89, 0x0f, 0x81, 0xb0, 0x21,
+ 0x99, 0x20, 0x59, 0x87, 0x2a, 0x81, 0x8b, 0xa2, 0x39, 0xef, 0xa2, 0x10, 0x01, 0x59, 0x98, 0x0b,
+ 0xc6, 0xff, 0x18, 0x00, 0x40, 0xab, 0x91, 0x99, 0x30, 0x24, 0x85, 0x9d, 0xb3, 0x39, 0x18, 0x99,
+ 0x93, 0x2e, 0x10, 0x94, 0x3a, 0xc3, 0x82, 0x2f, 0xb4, 0x1b, 0xb2, 0x96, 0x08, 0x1f, 0x80, 0x28,
+ 0xb1, 0x94, 0x08, 0x3a, 0x87, 0x1d, 0x1a, 0xa0, 0x02, 0xac, 0x12, 0xc3, 0x42, 0x1a, 0xa9, 0x5c,
+ 0xb1, 0x28, 0x91, 0x03, 0x62, 0x80, 0x81, 0xa9, 0xe9, 0x38, 0xa8, 0x0f, 0x11, 0x80, 0xa9, 0xb2,
+ 0x07, 0x38, 0x9d, 0x50, 0xa2, 0x19, 0x4a, 0xa0, 0xd1, 0x80, 0x30, 0x90, 0x99, 0x2f, 0x80, 0x86,
+ 0x09, 0x90, 0x08, 0x19, 0x53, 0x0c, 0x82, 0xaa, 0xa3, 0x4c, 0xf1, 0x21, 0x0d, 0x81, 0xa8, 0x08,
+ 0x19, 0x99, 0x21, 0x90, 0x87, 0x09, 0x10, 0x2b, 0x98, 0x86, 0x9c, 0x90, 0x07, 0x99, 0x28, 0x20,
+ 0x1b, 0x81, 0xd2, 0x12, 0x8a, 0x7a, 0xd1, 0x1b, 0xc3, 0x12, 0x09, 0x48, 0xa3, 0x88, 0x39, 0x33,
+ 0x2c, 0xfe, 0xa2, 0x48, 0x19, 0xa9, 0x81, 0x8c, 0x82, 0x04, 0x31, 0x2b, 0x1e, 0xda, 0xb2, 0x11,
+ 0x99, 0x41, 0xb1, 0x3f, 0x89, 0x19, 0xb1, 0x22, 0xc3, 0x30, 0x8a, 0x7b, 0x81, 0xb5, 0x89, 0x78,
+ 0x99, 0x0a, 0xf1, 0x02, 0x1a, 0x29, 0x91, 0x02, 0x3a, 0x81, 0xf2, 0x08, 0x02, 0x0e, 0x80, 0x03,
+ 0x38, 0x35, 0x91, 0x39, 0xa4, 0x04, 0x0f, 0x98, 0x9c, 0x84, 0x18, 0xa0, 0x29, 0xb1, 0xe8, 0x71,
+ 0x08, 0x08, 0xa2, 0x1b, 0x38, 0xb9, 0xb0, 0xb9, 0xb6, 0x0f, 0x83, 0x0a, 0x01, 0x25, 0x1d, 0xa2,
+ 0xa2, 0x59, 0x80, 0x08, 0xeb, 0x31, 0x10, 0x84, 0x19, 0xaa, 0xa9, 0x07, 0x29, 0x88, 0x90, 0x72,
+ 0x9a, 0x93, 0x8c, 0x90, 0x91, 0xae, 0x49, 0x14, 0xc9, 0xa1, 0x0b, 0x00, 0x28, 0xe5, 0x48, 0x98,
+ 0x91, 0x13, 0xbb, 0x80, 0xc4, 0x29, 0x70, 0x0b, 0x92, 0xa1, 0x80, 0x40, 0x08, 0xf8, 0x11, 0x8c,
+ 0xd0, 0xff, 0x1a, 0x00, 0x9a, 0x28, 0x03, 0x0d, 0x96, 0x88, 0x21, 0x1e, 0x00, 0x01, 0x80, 0x06,
+ 0xdb, 0x30, 0x2a, 0xb0, 0x2a, 0xa3, 0xa0, 0xa6, 0x30, 0x9f, 0x08, 0x21, 0xa0, 0x82, 0x1d, 0x83,
+ 0x8b, 0x02, 0xf9, 0x10, 0x50, 0x10, 0xab, 0xb3, 0x13, 0xbb, 0x41, 0x9e, 0xc0, 0x91, 0x38, 0x33,
+ 0xb8, 0xa9, 0x8f, 0x51, 0xd1, 0x21, 0x99, 0x28, 0xf9, 0x10, 0x29, 0x11, 0xae, 0x32, 0xf0, 0x10,
+ 0x01, 0x00, 0x30, 0xad, 0x01, 0x08, 0xa2, 0x22, 0x0f, 0x98, 0x20, 0xc1, 0x38, 0x00, 0x08, 0xa5,
+ 0x2e, 0x98, 0x15, 0x39, 0xc1, 0x85, 0x2c, 0xa0, 0xa0, 0x88, 0x12, 0x88, 0x48, 0xd3, 0xa8, 0x2f,
+ 0x89, 0xa4, 0x98, 0x91, 0x60, 0x00, 0x1a, 0x89, 0xc5, 0x39, 0x98, 0x20, 0x03, 0xab, 0x50, 0x04,
+ 0x1c, 0xb6, 0x28, 0x0a, 0xb8, 0xc0, 0x82, 0x14, 0x3e, 0x00, 0x9b, 0x87, 0x11, 0x2a, 0xa8, 0x82,
+ 0x2b, 0xa2, 0xbb, 0x7b, 0xb1, 0xa4, 0xb2, 0x3f, 0xa1, 0x81, 0x80, 0x54, 0xdb, 0x88, 0x21, 0x99,
+ 0xc1, 0xe8, 0x20, 0x21, 0x2b, 0xa0, 0x14, 0x19, 0xd9, 0xa8, 0x85, 0x8a, 0x3a, 0x39, 0xd3, 0xa2,
+ 0x0a, 0x37, 0x3b, 0xa9, 0xcd, 0x03, 0x02, 0x9c, 0x53, 0x9b, 0xa2, 0x2c, 0x30, 0xe9, 0x12, 0x20,
+ 0x00, 0x8c, 0x91, 0x18, 0xba, 0xc6, 0x2d, 0x02, 0x3a, 0x20, 0xf1, 0x89, 0x98, 0x98, 0xc9, 0x81,
+ 0x3b, 0x78, 0x19, 0xa3, 0x82, 0x91, 0x8c, 0x48, 0x86, 0x38, 0xb1, 0xd3, 0x39, 0x3b, 0x15, 0x0a,
+ 0x89, 0xfd, 0x02, 0x83, 0x19, 0x8b, 0x13, 0x2a, 0x89, 0xe3, 0xb1, 0x33, 0x49, 0x2f, 0xba, 0x06,
+ 0x08, 0xaa, 0xb3, 0x50, 0x3a, 0x12, 0xb8, 0x86, 0x9b, 0x2e, 0xb1, 0x80, 0x12, 0x59, 0xa0, 0x69,
+ 0x80, 0x88, 0x09, 0xd3, 0x04, 0x1b, 0x0a, 0x89, 0x97, 0x2a, 0x08, 0x91, 0x1f, 0xc1, 0x01, 0x0a,
+ 0xbd, 0xff, 0x18, 0x00, 0x49, 0x08, 0xc9, 0x01, 0xa1, 0x7b, 0xb1, 0x6a, 0x90, 0x81, 0x31, 0x0a,
+ 0xc2, 0x90, 0x30, 0x71, 0x98, 0x91, 0xc9, 0x0c, 0xa3, 0xba, 0x5a, 0x29, 0xb3, 0x90, 0x62, 0x14,
+ 0x0c, 0x9a, 0x04, 0xb0, 0x12, 0x1c, 0x00, 0x99, 0x68, 0x1a, 0x82, 0xc6, 0x80, 0x18, 0x0f, 0x92,
+ 0x90, 0xb0, 0x15, 0x2c, 0x98, 0x1a, 0x10, 0xf1, 0x80, 0x82, 0x10, 0x88, 0x89, 0x1f, 0xa0, 0x12,
+ 0x84, 0x81, 0x20, 0x17, 0x8d, 0x80, 0x83, 0x4b, 0x98, 0x1a, 0xd4, 0x38, 0x1b, 0xc4, 0xb1, 0x28,
+ 0x0d, 0x40, 0xcb, 0x92, 0x81, 0x90, 0x31, 0x01, 0x70, 0xf9, 0x12, 0x98, 0x1a, 0xa2, 0x81, 0x2b,
+ 0xa8, 0xe9, 0x80, 0x3a, 0x17, 0x2b, 0x03, 0x08, 0x09, 0x24, 0xe0, 0x8e, 0x83, 0x28, 0x98, 0x88,
+ 0x00, 0x80, 0x46, 0x8d, 0x10, 0xa0, 0xca, 0x88, 0x58, 0xb0, 0x48, 0xc8, 0x13, 0xaa, 0x58, 0x91,
+ 0x22, 0x3a, 0xf8, 0x4a, 0xb4, 0xaa, 0x11, 0x8a, 0x61, 0x1b, 0x91, 0x82, 0x8b, 0xc5, 0x30, 0x1a,
+ 0x85, 0x9e, 0x91, 0x08, 0x40, 0x90, 0x80, 0x31, 0xa1, 0xcc, 0x01, 0x40, 0xa8, 0x20, 0x4c, 0xb4,
+ 0x30, 0x8b, 0xa5, 0x19, 0xc1, 0x33, 0x6a, 0x28, 0x32, 0xba, 0xf1, 0x00, 0x01, 0x91, 0x9d, 0x13,
+ 0x9e, 0x8a, 0x0a, 0x07, 0x08, 0xda, 0x50, 0x90, 0x88, 0x8a, 0x18, 0x25, 0xa8, 0x19, 0x1d, 0x94,
+ 0xd0, 0x48, 0x8a, 0x09, 0x41, 0xc1, 0x10, 0xbd, 0x24, 0x0a, 0x84, 0x4a, 0xc8, 0x00, 0x98, 0x19,
+ 0x00, 0xc1, 0x10, 0x49, 0x23, 0x10, 0xcc, 0x80, 0xea, 0x89, 0x18, 0xb0, 0x91, 0x71, 0x48, 0xb0,
+ 0x04, 0x8b, 0x8c, 0x20, 0xb3, 0xc8, 0x14, 0x1d, 0x0b, 0x11, 0xb6, 0x51, 0xa0, 0x18, 0x88, 0x89,
+ 0x07, 0x19, 0x88, 0xa2, 0xc8, 0x4a, 0x1c, 0x82, 0x08, 0xf8, 0x29, 0x18, 0x85, 0x1c, 0x99, 0x83,
+ 0xb0, 0xff, 0x17, 0x00, 0xa0, 0xb1, 0x1a, 0x73, 0x09, 0x00, 0xe0, 0x10, 0x9c, 0xa8, 0x92, 0x9b,
+ 0x7a, 0x9b, 0xa4, 0xb3, 0x58, 0x0b, 0x08, 0x12, 0x95, 0x5a, 0x23, 0xba, 0x98, 0x14, 0x59, 0x91,
+ 0x43, 0xaa, 0x19, 0xc2, 0x79, 0xc3, 0x80, 0x10, 0x99, 0x18, 0x5a, 0xc4, 0x09, 0x29, 0xa0, 0x30,
+ 0x93, 0x46, 0xac, 0x09, 0x87, 0x89, 0x12, 0x8a, 0x40, 0xd8, 0xb9, 0x31, 0x02, 0x2b, 0xa8, 0xc1,
+ 0xd2, 0x1a, 0x62, 0x91, 0x8f, 0x00, 0x12, 0x08, 0xba, 0x15, 0x81, 0x39, 0x8b, 0x88, 0x17, 0xda,
+ 0x0a, 0x42, 0x98, 0x18, 0x80, 0xe9, 0x81, 0xe8, 0x28, 0x1c, 0x8a, 0x20, 0xa5, 0x01, 0x82, 0x3a,
+ 0x3a, 0x09, 0xb2, 0x35, 0xac, 0x2b, 0x97, 0x00, 0x30, 0x99, 0xaf, 0x88, 0xa2, 0x10, 0x51, 0x88,
+ 0x04, 0xac, 0x40, 0xc1, 0x19, 0x03, 0xdb, 0x88, 0x71, 0x82, 0x0a, 0xa8, 0xb9, 0x02, 0x19, 0x17,
+ 0xbb, 0x29, 0x3a, 0x05, 0xe0, 0x01, 0x0b, 0x3a, 0x00, 0xf0, 0x99, 0x1b, 0xf8, 0x84, 0x0a, 0x2a,
+ 0x19, 0x35, 0x18, 0x83, 0xa1, 0x07, 0x8a, 0x2d, 0xa2, 0xba, 0x61, 0x91, 0x9b, 0x90, 0x30, 0x14,
+ 0xba, 0x73, 0x08, 0x14, 0x0a, 0xbb, 0xa9, 0xc4, 0xcb, 0x40, 0x62, 0x20, 0xbb, 0xb3, 0x00, 0x29,
+ 0x2b, 0xaa, 0xaa, 0xc7, 0x89, 0x5c, 0x80, 0x06, 0x09, 0x98, 0x1b, 0xb0, 0xa3, 0x02, 0x1c, 0x85,
+ 0x59, 0x90, 0x90, 0xc8, 0x79, 0xc3, 0x82, 0x39, 0x09, 0xa9, 0xc1, 0x18, 0x92, 0x02, 0x98, 0x6a,
+ 0x18, 0xad, 0x24, 0xd1, 0x00, 0xd9, 0x61, 0x88, 0x90, 0x89, 0x02, 0x1a, 0x50, 0xa2, 0x91, 0x31,
+ 0x7a, 0xf1, 0x0a, 0x10, 0x18, 0x80, 0x92, 0x10, 0x2d, 0x52, 0xa8, 0xa8, 0xb0, 0x5a, 0xc1, 0x80,
+ 0x40, 0x99, 0x2a, 0x86, 0x9d, 0x82, 0xa1, 0x1c, 0x18, 0x29, 0x28, 0xf2, 0x10, 0x28, 0x92, 0x2a,
+ 0x78, 0x00, 0x11, 0x00, 0x1f, 0x01, 0xa0, 0xc9, 0xd1, 0x52, 0x28, 0xac, 0x98, 0x0a, 0x04, 0x0a,
+ 0xd3, 0x01, 0x19, 0x9c, 0x12, 0x91, 0x0f, 0x91, 0x00, 0xb9, 0x7a, 0xe0, 0x91, 0x38, 0x39, 0x81,
+ 0x9a, 0xd2, 0x14, 0x08, 0x1b, 0xe8, 0x12, 0x29, 0x96, 0x9a, 0x30, 0x19, 0x92, 0x19, 0xa3, 0xfd,
+ 0x23, 0x0b, 0x4c, 0x92, 0x99, 0xc9, 0x00, 0x38, 0x8a, 0x3a, 0xbf, 0x24, 0xb0, 0x98, 0x30, 0x30,
+ 0x1d, 0xe8, 0x50, 0xa0, 0x15, 0x18, 0x8a, 0x29, 0x80, 0x02, 0x17, 0xa9, 0x2c, 0x11, 0xb8, 0x4a,
+ 0x5a, 0xf2, 0x92, 0x18, 0x19, 0x2b, 0x08, 0xb5, 0x41, 0x2b, 0xa5, 0x88, 0x09, 0x84, 0x1f, 0xa1,
+ 0x28, 0x9a, 0xa2, 0x00, 0xa8, 0x23, 0xab, 0x5f, 0x90, 0x00, 0x33, 0xb8, 0x17, 0xb0, 0x3c, 0x89,
+ 0x3e, 0x95, 0x91, 0x20, 0xa8, 0x99, 0xab, 0x7c, 0xa1, 0x88, 0x98, 0x52, 0xb1, 0x18, 0x8b, 0xa8,
+ 0xaa, 0x9f, 0x98, 0x91, 0x83, 0xa3, 0x34, 0x4f, 0x02, 0x09, 0x21, 0x99, 0xd5, 0x90, 0x2c, 0x90,
+ 0x29, 0x04, 0x01, 0x98, 0x69, 0xb0, 0x83, 0x11, 0x68, 0xb2, 0x9b, 0x69, 0xea, 0x12, 0x09, 0x12,
+ 0xda, 0x90, 0x13, 0x8a, 0x38, 0x07, 0x9e, 0x48, 0xc9, 0x91, 0x83, 0x0a, 0x19, 0x40, 0xb0, 0x11,
+ 0x88, 0x04, 0x3a, 0xbf, 0x93, 0x11, 0xd8, 0x7a, 0x80, 0x10, 0xe1, 0x01, 0x09, 0x8a, 0x12, 0x00,
+ 0x30, 0x8b, 0xa5, 0xc8, 0x8b, 0x89, 0x55, 0x20, 0x88, 0xc9, 0x21, 0x0b, 0x20, 0x97, 0x79, 0x0a,
+ 0xa8, 0x12, 0x89, 0x14, 0x01, 0x90, 0x9f, 0x02, 0xbd, 0x20, 0xa3, 0x92, 0x02, 0x2c, 0x08, 0x41,
+ 0x0f, 0xc2, 0x01, 0x07, 0x0a, 0x09, 0x81, 0x1c, 0xaa, 0x91, 0x84, 0x88, 0x1a, 0x8f, 0x04, 0x02,
+ 0x99, 0xa0, 0x98, 0x39, 0xb1, 0x83, 0x6a, 0x4a, 0x02, 0xc2, 0xe1, 0x80, 0xab, 0x89, 0x2a, 0x16,
+ 0xe3, 0xff, 0x15, 0x00, 0x25, 0x0c, 0xa9, 0x02, 0x90, 0x3c, 0x63, 0xb9, 0x93, 0x19, 0xb9, 0x19,
+ 0x4e, 0xa0, 0x30, 0x07, 0x89, 0x01, 0xb1, 0x61, 0x3a, 0xea, 0xa0, 0x21, 0x49, 0x18, 0xa2, 0x9e,
+ 0x15, 0x98, 0x1b, 0x89, 0x84, 0x30, 0xf1, 0x18, 0x52, 0xab, 0xb0, 0x92, 0xa1, 0x20, 0xbc, 0x7a,
+ 0xa1, 0x91, 0x18, 0x09, 0xea, 0x48, 0x98, 0xc8, 0xa2, 0x12, 0x1d, 0x00, 0x0a, 0x17, 0x08, 0xa1,
+ 0x90, 0x1b, 0x82, 0x8e, 0x84, 0x8a, 0x10, 0x17, 0x0a, 0x9b, 0x88, 0xa0, 0xd5, 0x18, 0x91, 0x8b,
+ 0x7a, 0x98, 0x01, 0x80, 0x20, 0x26, 0xb1, 0x5a, 0x1a, 0xe9, 0x82, 0x80, 0xc8, 0x7a, 0x08, 0xa0,
+ 0x91, 0x02, 0x21, 0x81, 0x8f, 0x09, 0xb2, 0x9b, 0x60, 0x22, 0x88, 0x94, 0x90, 0x39, 0x8e, 0x10,
+ 0x98, 0xfa, 0x85, 0x08, 0x09, 0x28, 0x88, 0x31, 0xfa, 0x19, 0xf3, 0x31, 0x1c, 0x80, 0x98, 0x39,
+ 0xb2, 0x93, 0x22, 0x3f, 0xb8, 0x82, 0x41, 0x2e, 0xc1, 0x03, 0x28, 0x1a, 0xaa, 0x14, 0x80, 0x2c,
+ 0xb3, 0xa6, 0xa9, 0x6c, 0x80, 0x8a, 0x12, 0xdb, 0x80, 0x41, 0xa8, 0x98, 0x42, 0xab, 0x88, 0x15,
+ 0x08, 0x1a, 0x0d, 0xb3, 0x09, 0x5a, 0xb3, 0x30, 0xa4, 0x79, 0xc0, 0x8a, 0x28, 0x32, 0x8b, 0x96,
+ 0x9a, 0xd2, 0x19, 0x2c, 0xc0, 0xaa, 0x13, 0x19, 0x30, 0x71, 0x49, 0xa1, 0xac, 0x03, 0x12, 0x04,
+ 0x0e, 0x81, 0x91, 0x9a, 0x27, 0x0a, 0x98, 0x8b, 0x38, 0xf6, 0x80, 0x19, 0x99, 0x38, 0x8a, 0x80,
+ 0x18, 0xc0, 0xf3, 0x1a, 0x13, 0x40, 0xbb, 0xad, 0x22, 0x23, 0x0a, 0x72, 0x86, 0x8a, 0x02, 0x99,
+ 0x38, 0x29, 0xb3, 0xfa, 0x21, 0xa0, 0x34, 0x8f, 0x98, 0x11, 0x0a, 0x19, 0xf8, 0x49, 0x92, 0x08,
+ 0x91, 0x0a, 0x80, 0x0d, 0x94, 0xa4, 0x2a, 0x2a, 0xb8, 0xac, 0x20, 0xf0, 0x18, 0x89, 0x40, 0x8f,
+ 0x0b, 0xff, 0x1b, 0x00, 0x31, 0x3a, 0x8d, 0x92, 0x93, 0x1d, 0x81, 0x33, 0x99, 0x98, 0x03, 0x38,
+ 0x12, 0x37, 0x0b, 0x6a, 0xdd, 0x02, 0x90, 0x11, 0x80, 0xaa, 0x7a, 0x81, 0xa9, 0x82, 0x82, 0x09,
+ 0xfa, 0x13, 0x58, 0xa0, 0x79, 0xa8, 0xa2, 0x89, 0x18, 0xc3, 0x59, 0x29, 0xf3, 0x09, 0x10, 0x88,
+ 0x09, 0x33, 0xcb, 0x09, 0xc9, 0x14, 0x8b, 0x5c, 0x03, 0x88, 0xd3, 0x18, 0x20, 0x12, 0x4b, 0x99,
+ 0x9e, 0x24, 0xb9, 0xd8, 0x90, 0x63, 0x0b, 0xa2, 0xb0, 0x18, 0x31, 0x8d, 0x07, 0x08, 0x0b, 0x98,
+ 0xa3, 0x12, 0x9a, 0x52, 0xc9, 0x70, 0xb9, 0x90, 0xc9, 0x11, 0x91, 0x89, 0x0d, 0x52, 0x09, 0x3a,
+ 0xba, 0x07, 0x01, 0x8a, 0x20, 0x41, 0x01, 0x0f, 0xf2, 0x21, 0x90, 0x88, 0xd0, 0x20, 0x19, 0x80,
+ 0x32, 0xba, 0xa9, 0xa3, 0x34, 0xe8, 0x9b, 0x6a, 0x00, 0x11, 0xe0, 0xa2, 0x99, 0x2a, 0x17, 0x39,
+ 0xb9, 0x28, 0xc8, 0x15, 0xa9, 0x18, 0x69, 0x01, 0xc2, 0x89, 0x1e, 0xb2, 0xa0, 0x19, 0x2b, 0x0b,
+ 0x00, 0xb6, 0x23, 0xa1, 0x03, 0x67, 0x8d, 0x30, 0x18, 0xf3, 0x88, 0x08, 0x08, 0x09, 0x8b, 0x13,
+ 0x87, 0x08, 0x18, 0x01, 0x9f, 0x01, 0x00, 0x42, 0x8a, 0xa2, 0x1a, 0xa4, 0x8c, 0x61, 0x0a, 0xb2,
+ 0x02, 0x29, 0x41, 0x83, 0x93, 0x10, 0x9f, 0xb1, 0x42, 0xc9, 0x0f, 0xa0, 0xa0, 0x05, 0x19, 0x49,
+ 0x98, 0xa8, 0xa2, 0x82, 0xab, 0x7c, 0xa4, 0x10, 0xb9, 0x09, 0x2e, 0x28, 0xa4, 0x09, 0xc1, 0x80,
+ 0x4a, 0x0a, 0x33, 0xfa, 0x10, 0x01, 0x84, 0x30, 0x40, 0x91, 0x0d, 0xd1, 0x39, 0xb1, 0x2b, 0x14,
+ 0xf3, 0x39, 0x88, 0x9b, 0x95, 0x89, 0x38, 0x11, 0x8f, 0xb3, 0x22, 0x19, 0x0c, 0x92, 0xe1, 0x88,
+ 0x5b, 0x10, 0xb0, 0xaa, 0x11, 0xb6, 0x18, 0x2f, 0xb9, 0x00, 0xb2, 0x29, 0x32, 0x86, 0x18, 0x8a,
+ 0x2b, 0x00, 0x12, 0x00, 0xf1, 0x11, 0x1c, 0x90, 0x29, 0xe9, 0x31, 0x81, 0xab, 0x71, 0x80, 0x80,
+ 0xa2, 0x11, 0xe2, 0x3a, 0x1b, 0xf2, 0x12, 0x2a, 0x9a, 0x11, 0xa9, 0x95, 0x09, 0x33, 0xc1, 0x1f,
+ 0x12, 0x31, 0xcb, 0xd2, 0x90, 0x1f, 0x85, 0x88, 0x29, 0x9a, 0x02, 0x9a, 0x87, 0x3b, 0x80, 0xa2,
+ 0x00, 0xc0, 0x4a, 0x0c, 0xe1, 0x82, 0x10, 0x38, 0x9b, 0xa2, 0xd2, 0x19, 0x92, 0x1f, 0x8a, 0xa4,
+ 0xc3, 0x3b, 0x32, 0x0e, 0x48, 0xc2, 0xb0, 0x23, 0x5b, 0x92, 0xba, 0x10, 0xa9, 0x48, 0x9c, 0x9b,
+ 0xb5, 0x19, 0x17, 0x4a, 0x88, 0x9a, 0x88, 0x01, 0x54, 0xc8, 0x20, 0x00, 0x30, 0xd8, 0xb9, 0x38,
+ 0x15, 0x0b, 0xd3, 0x9a, 0x60, 0xa8, 0x01, 0x0b, 0x84, 0x8a, 0x8d, 0x03, 0x30, 0x95, 0x08, 0x7a,
+ 0xa8, 0x19, 0xe3, 0x00, 0x21, 0x9a, 0x1a, 0x01, 0xe1, 0x43, 0x9c, 0x18, 0x30, 0xf5, 0x18, 0x12,
+ 0x0a, 0xba, 0x23, 0x61, 0x9a, 0xa0, 0x99, 0x01,
+};
@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define GAMEOVER_BITS_PER_SAMPLE 4
+#define GAMEOVER_SAMPLE_RATE 32000
+#define GAMEOVER_SAMPLES 80054
+#define GAMEOVER_BYTES 40600
+
+extern const uint8_t gameOver[GAMEOVER_BYTES];
@@ -0,0 +1,488 @@
+
+#include <stdint.h>
+
+const uint8_t ouch[] = {
+ 0x4c, 0x53, 0x4e, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x50, 0x3b, 0x00, 0x00,
+ 0x03, 0x00, 0x00, 0x00, 0x77, 0x77, 0xe8, 0x29, 0x24, 0xb8, 0xae, 0x20, 0x23, 0xb8, 0xbc, 0x20,
+ 0x34, 0x02, 0x99, 0x18, 0x03, 0xfb, 0x9e, 0x28, 0x02, 0xed, 0x9c, 0x41, 0x45, 0x12, 0xa0, 0xcb,
+ 0x9b, 0x10, 0x22, 0x81, 0xa8, 0xaa, 0xa9, 0x99, 0x61, 0x45, 0x13, 0xb8, 0xca, 0xaa, 0x9a, 0x20,
+ 0x14, 0xa0, 0x09, 0x22, 0xb8, 0x8b, 0x54, 0x82, 0x08, 0x43, 0xc0, 0xbe, 0x99, 0x98, 0x08, 0x22,
+ 0xd0, 0xbb, 0x09, 0x80, 0x60, 0x25, 0xb0, 0x8b, 0x22, 0xfb, 0x9f, 0x20, 0x90, 0x9b, 0x42, 0x82,
+ 0x38, 0x67, 0xb0, 0xad, 0x28, 0x13, 0x80, 0x21, 0xe8, 0x9d, 0x40, 0x92, 0xbc, 0x62, 0x03, 0xcc,
+ 0x40, 0xf2, 0xff, 0x9c, 0x30, 0x37, 0x12, 0xa8, 0xbd, 0x8b, 0x31, 0x24, 0x00, 0x00, 0x82, 0xf2,
+ 0xea, 0x58, 0x8c, 0x13, 0x03, 0xa0, 0xcb, 0x8a, 0x20, 0x33, 0x83, 0xf0, 0xd9, 0x50, 0x8b, 0x04,
+ 0x02, 0x98, 0xaa, 0x88, 0x10, 0x11, 0x20, 0x21, 0x90, 0xeb, 0xdb, 0x99, 0x10, 0x33, 0x34, 0x13,
+ 0x81, 0xdb, 0xbd, 0xac, 0x10, 0x35, 0x02, 0xea, 0xab, 0x19, 0x44, 0x33, 0x81, 0xa9, 0x9a, 0x9a,
+ 0x88, 0x20, 0x34, 0x23, 0xc9, 0xbf, 0xac, 0x28, 0x54, 0x22, 0xa8, 0xdb, 0x8a, 0x31, 0x34, 0x03,
+ 0xda, 0xcc, 0xab, 0x09, 0x54, 0x34, 0x02, 0xb9, 0xbc, 0x8a, 0x20, 0x32, 0x11, 0x88, 0xba, 0xcd,
+ 0xab, 0x30, 0x57, 0x13, 0x82, 0xab, 0x8e, 0x0b, 0xab, 0x27, 0xd5, 0x59, 0x00, 0x90, 0xb9, 0xb8,
+ 0x7a, 0x91, 0x08, 0x86, 0x00, 0xaa, 0xab, 0x09, 0x51, 0x33, 0x01, 0xb9, 0xcc, 0xaa, 0x00, 0x32,
+ 0x34, 0x13, 0xa0, 0xdc, 0xab, 0x18, 0x42, 0x32, 0x00, 0xa9, 0xa9, 0x88, 0xa9, 0x8a, 0x62, 0x24,
+ 0x80, 0xb8, 0xca, 0x18, 0x57, 0x43, 0x80, 0xae, 0xcd, 0x33, 0xcb, 0x34, 0x02, 0xba, 0x8a, 0x31,
+ 0xa9, 0x43, 0x4b, 0x00, 0x91, 0xdb, 0x9b, 0x89, 0x98, 0xaa, 0x48, 0x67, 0x13, 0x00, 0xc9, 0x9a,
+ 0x28, 0x32, 0x81, 0xfb, 0xcb, 0x09, 0x21, 0x43, 0x81, 0xba, 0x8a, 0x63, 0x23, 0xc9, 0xae, 0x0a,
+ 0x42, 0x24, 0xa8, 0xad, 0x09, 0x33, 0x23, 0x81, 0xb9, 0xaa, 0x32, 0x87, 0xd8, 0x89, 0x50, 0x19,
+ 0x9f, 0x32, 0xf2, 0x31, 0x08, 0xb9, 0x8e, 0x30, 0x23, 0x88, 0xaf, 0x96, 0x9a, 0x50, 0x01, 0x88,
+ 0x9d, 0x02, 0x9a, 0x24, 0x01, 0x98, 0x8c, 0x19, 0x00, 0xc8, 0xf9, 0x23, 0x2e, 0x22, 0x81, 0x90,
+ 0xa8, 0xa0, 0xba, 0x5f, 0x84, 0x8d, 0x23, 0x81, 0xc8, 0x9b, 0x30, 0x43, 0x81, 0xbc, 0x9a, 0x31,
+ 0x25, 0x01, 0x00, 0xbb, 0xcf, 0x03, 0x9b, 0x27, 0x00, 0xb9, 0x3e, 0xaa, 0x16, 0x81, 0xcb, 0x09,
+ 0x25, 0x00, 0xb8, 0x8b, 0x30, 0x88, 0x8f, 0xc5, 0x40, 0x11, 0x08, 0x9d, 0xd2, 0x41, 0x01, 0xa8,
+ 0x9c, 0x59, 0xa9, 0x02, 0x13, 0x90, 0x0a, 0x52, 0x00, 0x98, 0x9c, 0xac, 0x96, 0x00, 0x7b, 0x01,
+ 0x80, 0xfb, 0x21, 0xa8, 0x43, 0x00, 0x08, 0x08, 0xdb, 0xcb, 0x87, 0x1c, 0x30, 0x12, 0x90, 0xda,
+ 0x3b, 0xc3, 0x4a, 0x14, 0x80, 0xa8, 0x9b, 0x8d, 0x05, 0xab, 0x03, 0x43, 0x02, 0x08, 0xaf, 0x20,
+ 0xf2, 0x40, 0x00, 0x98, 0xbc, 0x41, 0xc8, 0x28, 0x30, 0x12, 0x00, 0xa8, 0xea, 0xaa, 0x31, 0x24,
+ 0xa9, 0x9f, 0x04, 0x8a, 0x34, 0x00, 0xb9, 0xac, 0x09, 0x08, 0x32, 0x24, 0xa0, 0xbd, 0xab, 0x20,
+ 0x46, 0x02, 0x98, 0x28, 0x43, 0x00, 0x08, 0x90, 0xff, 0x39, 0xb9, 0x72, 0x00, 0x08, 0xad, 0x02,
+ 0x0a, 0x16, 0xb9, 0x8a, 0x63, 0x00, 0xb8, 0x9d, 0x30, 0x23, 0xb0, 0xfb, 0x21, 0x3c, 0x12, 0xa0,
+ 0xf9, 0x11, 0x4b, 0x03, 0xa0, 0xfb, 0x12, 0x2c, 0x01, 0x98, 0x98, 0x20, 0x43, 0x02, 0xa8, 0xaf,
+ 0x9c, 0xac, 0x53, 0x00, 0x18, 0x11, 0x09, 0x2f, 0xd2, 0x23, 0x11, 0x98, 0xcb, 0x8b, 0x40, 0x24,
+ 0x82, 0x98, 0x99, 0x9d, 0x2e, 0xe2, 0x11, 0x22, 0x01, 0xc9, 0xac, 0x18, 0x34, 0x02, 0xb9, 0xbc,
+ 0x29, 0x34, 0x83, 0xdb, 0x9a, 0x32, 0x14, 0xb8, 0xae, 0x29, 0x73, 0x02, 0xa0, 0xfb, 0x23, 0x1f,
+ 0x02, 0x81, 0x98, 0x88, 0x00, 0x00, 0x08, 0x99, 0x9b, 0x51, 0x25, 0xa1, 0xcd, 0x9a, 0x21, 0x33,
+ 0x81, 0xbb, 0x39, 0x35, 0xb1, 0xce, 0x9a, 0x20, 0x52, 0x43, 0x02, 0x18, 0x01, 0x80, 0xff, 0x08,
+ 0x29, 0x1d, 0x04, 0x01, 0xb8, 0xbc, 0x0a, 0x43, 0x12, 0xa8, 0x18, 0x24, 0x91, 0xab, 0x4a, 0x41,
+ 0xda, 0xed, 0x94, 0x3a, 0x41, 0x00, 0xb9, 0xaa, 0x20, 0x23, 0x80, 0x9b, 0x29, 0x22, 0xb0, 0xce,
+ 0x9a, 0x52, 0x25, 0x82, 0xcb, 0xab, 0x18, 0x23, 0x12, 0xa8, 0xba, 0x99, 0x00, 0x22, 0x34, 0x34,
+ 0x02, 0xca, 0xbd, 0x89, 0x52, 0x02, 0xfb, 0xaf, 0x09, 0x44, 0x33, 0x91, 0xbb, 0x9c, 0x00, 0x01,
+ 0x80, 0x09, 0x22, 0x92, 0xde, 0xbb, 0x48, 0x45, 0x22, 0xa9, 0xcc, 0x99, 0x21, 0x33, 0x82, 0xca,
+ 0xab, 0x38, 0x34, 0xa0, 0xce, 0x8a, 0x73, 0x33, 0x91, 0xcb, 0x9b, 0x09, 0x00, 0x89, 0x20, 0x44,
+ 0x13, 0xc9, 0xad, 0x09, 0x53, 0x23, 0x82, 0xda, 0xcb, 0x89, 0x21, 0x22, 0x12, 0x90, 0xde, 0xac,
+ 0x39, 0x46, 0x13, 0xb0, 0xbd, 0x8b, 0x31, 0x34, 0x22, 0xa0, 0xdc, 0xab, 0x41, 0x26, 0x82, 0xcc,
+ 0x1e, 0x93, 0x29, 0x05, 0x98, 0xab, 0x09, 0x21, 0x81, 0x99, 0x32, 0x27, 0x91, 0xbb, 0x0c, 0x40,
+ 0x0b, 0x8f, 0xc7, 0x49, 0x21, 0x88, 0xba, 0x9a, 0x32, 0x14, 0xa0, 0xba, 0x08, 0x11, 0x80, 0xbb,
+ 0x1a, 0x56, 0x23, 0x90, 0xbd, 0xab, 0x10, 0x32, 0x13, 0x81, 0xda, 0xab, 0x0a, 0x44, 0x24, 0x91,
+ 0x3a, 0x19, 0x42, 0x00, 0x9a, 0x09, 0x01, 0x00, 0x88, 0x00, 0xfb, 0xef, 0x8a, 0x41, 0x34, 0x12,
+ 0xa9, 0x9a, 0x00, 0xa8, 0xcb, 0x08, 0x33, 0xa0, 0xbe, 0x18, 0x35, 0x81, 0x9a, 0x30, 0x25, 0xe9,
+ 0xbd, 0x19, 0x55, 0x12, 0xb9, 0xbd, 0x8b, 0x32, 0x36, 0x03, 0xb8, 0xbc, 0x99, 0x11, 0x11, 0x88,
+ 0x90, 0xa8, 0xaa, 0x28, 0x57, 0x24, 0x90, 0xda, 0x8a, 0x20, 0x33, 0x91, 0xed, 0xbc, 0x0a, 0x52,
+ 0x24, 0x02, 0x99, 0x9a, 0x09, 0x00, 0x80, 0x31, 0x22, 0x09, 0x78, 0x36, 0xe9, 0xde, 0x17, 0x0f,
+ 0x14, 0x00, 0xa8, 0xbb, 0x09, 0x21, 0x22, 0x21, 0x11, 0x90, 0xec, 0xab, 0x28, 0x34, 0x92, 0xcd,
+ 0x8a, 0x63, 0x23, 0xa0, 0xcc, 0x99, 0x31, 0x12, 0x90, 0xa9, 0x11, 0x14, 0x98, 0x8e, 0x49, 0x40,
+ 0xb9, 0xde, 0x87, 0x4c, 0x20, 0x98, 0xa9, 0x98, 0x01, 0x82, 0x98, 0x99, 0x41, 0x33, 0xa1, 0xdc,
+ 0x9a, 0x21, 0x24, 0x91, 0xdb, 0xab, 0x18, 0x43, 0x24, 0x01, 0xa9, 0xcb, 0x99, 0x11, 0x12, 0x21,
+ 0x22, 0x11, 0xba, 0xbc, 0xdc, 0xcd, 0xad, 0x38, 0x56, 0x12, 0xa0, 0xab, 0x19, 0x43, 0x82, 0xca,
+ 0xbb, 0x8a, 0x20, 0x32, 0x33, 0x92, 0xdd, 0x9b, 0x31, 0x36, 0x02, 0x88, 0xb8, 0xec, 0xac, 0x09,
+ 0x42, 0x13, 0x00, 0x41, 0x35, 0xb1, 0xcf, 0xab, 0x30, 0x43, 0x02, 0x98, 0xcb, 0x9a, 0x28, 0x43,
+ 0x33, 0x23, 0x22, 0xc8, 0xee, 0xcb, 0x89, 0x20, 0x22, 0x33, 0x24, 0x91, 0xbc, 0xaa, 0x88, 0x21,
+ 0x53, 0x10, 0x78, 0x55, 0x81, 0xfa, 0xcb, 0x23, 0x2f, 0x11, 0x12, 0xb8, 0xca, 0x89, 0x11, 0x21,
+ 0x32, 0x24, 0xa0, 0xbd, 0xab, 0xba, 0xaa, 0x38, 0x57, 0x43, 0x81, 0xba, 0xbc, 0x88, 0x22, 0x12,
+ 0x00, 0x88, 0x00, 0xb8, 0xbd, 0x8b, 0x74, 0x24, 0x91, 0xdc, 0xab, 0x28, 0x35, 0x03, 0xb8, 0xbb,
+ 0xe4, 0xd3, 0x49, 0x00, 0x18, 0x22, 0x11, 0x21, 0x24, 0x90, 0xdd, 0xab, 0x18, 0x23, 0x02, 0xcb,
+ 0x9b, 0x63, 0x33, 0x91, 0xcb, 0x9a, 0x10, 0x12, 0x90, 0x0a, 0x73, 0x34, 0x91, 0xdc, 0xab, 0x99,
+ 0x88, 0xba, 0x1a, 0x67, 0x34, 0x82, 0xca, 0xac, 0x08, 0x11, 0x01, 0x10, 0x32, 0x25, 0x91, 0xfc,
+ 0xbc, 0xab, 0x30, 0x46, 0x22, 0x80, 0xa9, 0x9a, 0x98, 0x9a, 0x18, 0x43, 0x13, 0xb9, 0x9c, 0x20,
+ 0x91, 0xce, 0x0a, 0x73, 0x23, 0x01, 0xaa, 0xcc, 0xbb, 0x99, 0x40, 0x54, 0x24, 0x81, 0xc9, 0xcb,
+ 0x9a, 0x18, 0x43, 0x23, 0x00, 0x08, 0x98, 0xdb, 0xad, 0x9b, 0x30, 0x36, 0x13, 0x92, 0x82, 0x84,
+ 0xbb, 0xef, 0x2f, 0xe2, 0x21, 0x21, 0x08, 0x9a, 0x9a, 0x09, 0x11, 0x12, 0x00, 0x72, 0x13, 0xda,
+ 0xbf, 0x14, 0xa9, 0x23, 0x12, 0x98, 0xad, 0x0a, 0x21, 0x81, 0x99, 0x31, 0x35, 0x91, 0xcd, 0xac,
+ 0x89, 0x22, 0x33, 0x32, 0x12, 0x91, 0xdb, 0xcb, 0x8a, 0x10, 0x22, 0x90, 0xba, 0x40, 0x46, 0x13,
+ 0xeb, 0xbd, 0x8a, 0x63, 0x33, 0x81, 0xcb, 0xab, 0x10, 0x23, 0x81, 0x89, 0x31, 0x16, 0xc0, 0xcd,
+ 0x9c, 0x08, 0x43, 0x33, 0x12, 0x90, 0xba, 0xad, 0x9b, 0x10, 0x32, 0x22, 0x80, 0x89, 0x90, 0xdc,
+ 0xac, 0x38, 0x46, 0x01, 0xa9, 0x8a, 0x38, 0x18, 0xbc, 0x1b, 0x67, 0x05, 0xb2, 0xf9, 0xaa, 0x7b,
+ 0xe2, 0x02, 0x02, 0x01, 0x88, 0x89, 0x89, 0x9a, 0x9a, 0x20, 0x44, 0x03, 0xe9, 0xad, 0x0a, 0x53,
+ 0x33, 0x80, 0xba, 0x8a, 0x10, 0xb0, 0xcd, 0x0a, 0x63, 0x33, 0xa0, 0xbc, 0x8a, 0x20, 0x22, 0x00,
+ 0x08, 0x42, 0x13, 0xea, 0xbd, 0x9b, 0x30, 0x45, 0x12, 0x90, 0xbb, 0xbb, 0x8a, 0x38, 0x54, 0x34,
+ 0x23, 0xc0, 0xce, 0xab, 0x19, 0x44, 0x22, 0x80, 0x99, 0x89, 0xa8, 0xcc, 0x9b, 0x62, 0x34, 0x02,
+ 0x64, 0x2f, 0x48, 0x00, 0xac, 0x8b, 0x10, 0x11, 0x11, 0x27, 0x05, 0xd0, 0xbc, 0x6d, 0xa9, 0x02,
+ 0x03, 0x01, 0x89, 0x88, 0x88, 0xba, 0x8b, 0x72, 0x24, 0xa0, 0xfd, 0x21, 0xb8, 0x41, 0x00, 0xa9,
+ 0x09, 0x22, 0x03, 0xdb, 0x9c, 0x38, 0x34, 0x81, 0xcc, 0x9a, 0x28, 0x22, 0x81, 0x88, 0x41, 0x44,
+ 0x91, 0xdb, 0xbb, 0x09, 0x10, 0x12, 0x12, 0x01, 0x98, 0xbb, 0x8a, 0x72, 0x43, 0x18, 0x0a, 0x01,
+ 0xc3, 0xf1, 0xb1, 0xe1, 0xdb, 0x7e, 0xa9, 0x13, 0x12, 0x88, 0x9a, 0x29, 0x21, 0xb8, 0xbd, 0x8a,
+ 0x53, 0x12, 0xb8, 0xbb, 0x18, 0x23, 0x81, 0x09, 0x74, 0x33, 0xa0, 0xcd, 0x8a, 0x18, 0x88, 0xaa,
+ 0x29, 0x37, 0x14, 0xa9, 0xac, 0x28, 0x33, 0xc8, 0xcd, 0x19, 0x63, 0x12, 0x99, 0x8b, 0x40, 0x02,
+ 0xf9, 0xfb, 0x23, 0x2e, 0x10, 0x80, 0x90, 0x02, 0x02, 0xc8, 0xcb, 0x0a, 0x30, 0x02, 0xa8, 0x9a,
+ 0x42, 0x34, 0x02, 0xa9, 0x89, 0x80, 0xd8, 0xcd, 0x8a, 0x31, 0x25, 0x01, 0xb9, 0x9b, 0x18, 0x21,
+ 0x80, 0x09, 0x64, 0x24, 0x81, 0xca, 0xab, 0x89, 0xa9, 0xcd, 0x9b, 0x28, 0x43, 0x43, 0x34, 0x25,
+ 0x23, 0xa0, 0xec, 0xcb, 0x9a, 0x88, 0x22, 0x23, 0xb0, 0xbc, 0x89, 0x53, 0x44, 0x32, 0x11, 0x30,
+ 0x10, 0xed, 0x9c, 0x32, 0x87, 0xe9, 0x3c, 0xb2, 0x3c, 0x23, 0x92, 0xca, 0x19, 0x63, 0x81, 0xdb,
+ 0x8b, 0x40, 0x23, 0xa0, 0xcc, 0x9a, 0x20, 0x23, 0x01, 0x09, 0x51, 0x24, 0x02, 0xda, 0xbc, 0x9a,
+ 0x01, 0x80, 0xbb, 0x18, 0x47, 0x33, 0x81, 0xa9, 0x8a, 0x10, 0xc9, 0xcd, 0x8a, 0x30, 0x24, 0x80,
+ 0xaa, 0x19, 0x44, 0x13, 0xa8, 0x9b, 0x51, 0x22, 0xda, 0xbe, 0x8a, 0x31, 0x33, 0x90, 0xcb, 0x09,
+ 0x32, 0x23, 0x88, 0x29, 0x56, 0x33, 0xa0, 0xdc, 0x9a, 0x10, 0xa1, 0xdf, 0xbb, 0x29, 0x45, 0x14,
+ 0x08, 0x30, 0x4c, 0x00, 0x80, 0x10, 0x22, 0xb0, 0xdf, 0xaa, 0x09, 0x12, 0x01, 0x00, 0x42, 0x34,
+ 0x01, 0xba, 0xbc, 0x9a, 0x89, 0xaa, 0x8a, 0x52, 0x35, 0x33, 0x23, 0x82, 0xfb, 0xcc, 0xab, 0x89,
+ 0x01, 0x22, 0x63, 0x35, 0x23, 0x90, 0xba, 0xab, 0xc9, 0xdd, 0xac, 0x0a, 0x32, 0x25, 0x11, 0x22,
+ 0x43, 0x12, 0xda, 0xbc, 0x9b, 0x88, 0x00, 0x88, 0x20, 0x34, 0x02, 0x98, 0x18, 0x22, 0xa1, 0xab,
+ 0x71, 0x25, 0xa1, 0xcd, 0x9a, 0x00, 0xc8, 0xbe, 0x8b, 0x41, 0x34, 0x22, 0x42, 0x43, 0x03, 0xda,
+ 0xad, 0x9b, 0x89, 0xa9, 0xa9, 0x28, 0x53, 0x34, 0x23, 0x23, 0x23, 0x22, 0x98, 0xeb, 0xcc, 0xcb,
+ 0xab, 0x9a, 0x98, 0x08, 0x31, 0x47, 0x34, 0x24, 0x12, 0x91, 0xca, 0xbd, 0xab, 0x9a, 0xba, 0xac,
+ 0x20, 0x47, 0x22, 0x01, 0x10, 0x32, 0x03, 0xec, 0xbc, 0x9a, 0x08, 0x98, 0x89, 0x52, 0x44, 0x12,
+ 0x88, 0x18, 0x11, 0xd9, 0xdd, 0x9a, 0x20, 0x11, 0x88, 0x28, 0x55, 0x34, 0x13, 0xa8, 0xcc, 0xbc,
+ 0xac, 0xaa, 0x99, 0x30, 0x55, 0x44, 0x22, 0x81, 0x88, 0x89, 0xba, 0xdc, 0xba, 0x99, 0x89, 0x98,
+ 0x28, 0x55, 0x34, 0x13, 0x11, 0x01, 0x90, 0xbc, 0xbc, 0x99, 0xaa, 0xce, 0x9c, 0x18, 0x43, 0x12,
+ 0x81, 0x52, 0x35, 0x12, 0xb9, 0xbc, 0x88, 0x88, 0xdc, 0xac, 0x89, 0x21, 0x12, 0x11, 0x53, 0x35,
+ 0x13, 0x98, 0xbb, 0xaa, 0xcb, 0xbd, 0xab, 0x10, 0x12, 0x81, 0x18, 0x56, 0x43, 0x01, 0x89, 0x08,
+ 0x22, 0xc8, 0xcd, 0x89, 0x22, 0x91, 0xde, 0xab, 0x10, 0x22, 0x98, 0x18, 0x67, 0x24, 0x01, 0xa9,
+ 0x0a, 0x00, 0xb8, 0xcf, 0xab, 0x88, 0x11, 0x01, 0x10, 0x54, 0x44, 0x11, 0x90, 0x99, 0x98, 0xba,
+ 0xdc, 0xab, 0x0a, 0x20, 0x11, 0x20, 0x54, 0x34, 0x22, 0x88, 0x9a, 0x99, 0xc9, 0xcd, 0xac, 0x08,
+ 0x99, 0xd4, 0x43, 0x00, 0x21, 0x00, 0x20, 0x53, 0x23, 0x90, 0xaa, 0x10, 0x33, 0xc0, 0xbe, 0x9a,
+ 0x10, 0xa0, 0xcd, 0x8b, 0x10, 0x13, 0x80, 0x41, 0x37, 0x23, 0x90, 0x08, 0x31, 0x83, 0xfb, 0xac,
+ 0x99, 0xd9, 0xcd, 0xac, 0x08, 0x31, 0x22, 0x42, 0x45, 0x24, 0x02, 0x80, 0x10, 0x11, 0xc8, 0xef,
+ 0xbb, 0x9b, 0x00, 0x80, 0x9a, 0x40, 0x47, 0x33, 0x02, 0x88, 0x20, 0x23, 0xb0, 0xdf, 0xbb, 0x9b,
+ 0x98, 0x99, 0x88, 0x41, 0x55, 0x33, 0x12, 0x01, 0x10, 0x00, 0xd9, 0xbd, 0xac, 0x99, 0x98, 0xaa,
+ 0x08, 0x54, 0x34, 0x12, 0x11, 0x22, 0x12, 0xd8, 0xcc, 0xaa, 0x8a, 0xb9, 0xbb, 0x8a, 0x62, 0x24,
+ 0x22, 0x21, 0x53, 0x33, 0x91, 0xcb, 0xab, 0x88, 0xc9, 0xcf, 0xba, 0x08, 0x10, 0x80, 0x00, 0x45,
+ 0x45, 0x12, 0x81, 0x80, 0x10, 0xb8, 0xcd, 0xbc, 0x99, 0x98, 0xb9, 0x9a, 0x52, 0x36, 0x22, 0x10,
+ 0x22, 0x34, 0x81, 0xcc, 0xbb, 0x89, 0xb9, 0xcd, 0xbb, 0x08, 0x33, 0x12, 0x10, 0x55, 0x25, 0x12,
+ 0x88, 0x08, 0x12, 0xa0, 0xcd, 0xac, 0xa9, 0xbc, 0xbc, 0x9a, 0x11, 0x32, 0x53, 0x46, 0x34, 0x13,
+ 0x80, 0x00, 0x80, 0xfb, 0xbc, 0xab, 0xaa, 0xb9, 0xaa, 0x28, 0x65, 0x33, 0x24, 0x32, 0x33, 0x02,
+ 0xc9, 0xcc, 0xbb, 0xcb, 0xac, 0x9b, 0x08, 0x31, 0x43, 0x43, 0x53, 0x33, 0x13, 0x90, 0xaa, 0xba,
+ 0xdc, 0xbb, 0xac, 0x99, 0x98, 0x99, 0x18, 0x45, 0x13, 0x90, 0x38, 0x57, 0x22, 0x80, 0x09, 0x42,
+ 0x23, 0xea, 0xbc, 0x9b, 0xa9, 0xdc, 0xbb, 0x0a, 0x31, 0x35, 0x34, 0x35, 0x33, 0x24, 0x01, 0xa9,
+ 0xdc, 0xbb, 0xac, 0xbb, 0xac, 0x9a, 0x21, 0x45, 0x22, 0x23, 0x44, 0x33, 0x12, 0xb9, 0xbd, 0xbb,
+ 0xeb, 0xcb, 0xab, 0x19, 0x32, 0x33, 0x44, 0x44, 0x34, 0x02, 0xa8, 0xba, 0xaa, 0xdc, 0xcc, 0xab,
+ 0xd7, 0xa4, 0x46, 0x00, 0x20, 0x22, 0x11, 0x52, 0x54, 0x22, 0x81, 0x88, 0x88, 0xa8, 0xdd, 0xbb,
+ 0x9a, 0x08, 0x99, 0x8a, 0x73, 0x35, 0x12, 0x80, 0x20, 0x23, 0xb0, 0xcf, 0xaa, 0x08, 0x98, 0xcb,
+ 0x8b, 0x63, 0x33, 0x01, 0x89, 0x52, 0x24, 0xb0, 0xbe, 0x9a, 0x11, 0xa8, 0xbd, 0x8a, 0x54, 0x13,
+ 0x81, 0x20, 0x45, 0x13, 0xd9, 0xbb, 0x89, 0x90, 0xdd, 0xac, 0x18, 0x43, 0x82, 0x88, 0x51, 0x35,
+ 0x12, 0xb8, 0x8a, 0x10, 0x90, 0xbf, 0x9d, 0x09, 0x01, 0xa8, 0x8a, 0x51, 0x34, 0x03, 0x98, 0x20,
+ 0x43, 0x91, 0xdc, 0x9b, 0x09, 0x90, 0xcc, 0x9b, 0x41, 0x33, 0x02, 0x88, 0x53, 0x34, 0x91, 0xbc,
+ 0x9b, 0x08, 0xd9, 0xcc, 0x8a, 0x31, 0x23, 0x11, 0x51, 0x45, 0x13, 0x80, 0xba, 0xaa, 0xbb, 0xcf,
+ 0xcb, 0x8a, 0x10, 0x22, 0x11, 0x42, 0x46, 0x33, 0x02, 0x88, 0x08, 0x81, 0xda, 0xcd, 0xab, 0x99,
+ 0x98, 0xaa, 0x8a, 0x41, 0x45, 0x22, 0x21, 0x42, 0x23, 0x03, 0xa9, 0xbc, 0xbb, 0xbc, 0xcc, 0xac,
+ 0x9a, 0x10, 0x12, 0x81, 0x18, 0x64, 0x24, 0x02, 0xaa, 0x0a, 0x32, 0xb1, 0xdf, 0x9b, 0x21, 0x12,
+ 0xb9, 0x0b, 0x57, 0x24, 0x91, 0xcb, 0x09, 0x12, 0xe9, 0xbe, 0x9b, 0x21, 0x12, 0xa8, 0x19, 0x66,
+ 0x33, 0x02, 0x88, 0x41, 0x24, 0xa1, 0xcd, 0x9a, 0x88, 0xa8, 0xbe, 0x9c, 0x20, 0x32, 0x80, 0x88,
+ 0x62, 0x34, 0x12, 0x98, 0x09, 0x12, 0xa1, 0xce, 0xac, 0x88, 0x00, 0xa9, 0x9c, 0x28, 0x34, 0x03,
+ 0x88, 0x18, 0x45, 0x12, 0xb9, 0xad, 0x09, 0x12, 0xb8, 0xbe, 0x09, 0x53, 0x24, 0x00, 0x00, 0x31,
+ 0x13, 0xd9, 0xdd, 0xab, 0x9a, 0x99, 0xca, 0xbb, 0x48, 0x46, 0x43, 0x21, 0x22, 0x35, 0x23, 0x98,
+ 0xbb, 0xab, 0xa9, 0xdd, 0xbd, 0xaa, 0x99, 0x98, 0x99, 0x18, 0x54, 0x24, 0x12, 0x11, 0x43, 0x24,
+ 0xb8, 0x40, 0x42, 0x00, 0x98, 0x99, 0x88, 0xa8, 0xce, 0xcb, 0x9a, 0x88, 0x99, 0x9a, 0x28, 0x63,
+ 0x22, 0x10, 0x21, 0x35, 0x13, 0xa0, 0x9a, 0x08, 0x91, 0xdc, 0xab, 0x50, 0x45, 0x24, 0x81, 0x98,
+ 0x28, 0x34, 0xc1, 0xef, 0xaa, 0x88, 0x90, 0xcc, 0xab, 0x30, 0x36, 0x02, 0x80, 0x52, 0x35, 0x13,
+ 0x98, 0x89, 0x21, 0x91, 0xdd, 0xbb, 0x8a, 0x98, 0xeb, 0xbb, 0x89, 0x32, 0x12, 0x88, 0x51, 0x45,
+ 0x23, 0x01, 0x00, 0x22, 0x12, 0xd9, 0xbc, 0xaa, 0x88, 0xcb, 0xbd, 0x8b, 0x10, 0x01, 0x98, 0x20,
+ 0x46, 0x33, 0x81, 0x88, 0x31, 0x13, 0xe9, 0xad, 0x8a, 0x22, 0x12, 0x99, 0x71, 0x46, 0x14, 0x90,
+ 0x9a, 0x31, 0x15, 0xe8, 0xbc, 0x8a, 0x11, 0xb8, 0xcf, 0x8b, 0x21, 0x23, 0xa0, 0x8a, 0x64, 0x34,
+ 0x01, 0x98, 0x28, 0x34, 0x82, 0xdb, 0x9b, 0x10, 0x81, 0xdc, 0xac, 0x0a, 0x10, 0xa0, 0xbc, 0x09,
+ 0x53, 0x13, 0x98, 0x89, 0x62, 0x33, 0x81, 0x89, 0x20, 0x34, 0x91, 0xbd, 0x8b, 0x10, 0x90, 0xce,
+ 0x9c, 0x88, 0x01, 0xa9, 0x9b, 0x38, 0x36, 0x01, 0x98, 0x20, 0x43, 0x82, 0xaa, 0x29, 0x46, 0x24,
+ 0x11, 0x52, 0x25, 0x02, 0x99, 0x30, 0x37, 0x82, 0xcd, 0xac, 0x18, 0x01, 0xfa, 0xbd, 0x89, 0x11,
+ 0x92, 0xdb, 0x9a, 0x63, 0x24, 0x01, 0x99, 0x20, 0x45, 0x02, 0xa8, 0x9a, 0x32, 0x14, 0xd9, 0xbc,
+ 0x99, 0x10, 0xb9, 0xbe, 0x9b, 0x20, 0x11, 0xa9, 0x8b, 0x63, 0x34, 0x02, 0x89, 0x10, 0x34, 0x03,
+ 0xb8, 0x89, 0x42, 0x23, 0xa8, 0x9c, 0x28, 0x23, 0xd8, 0xbe, 0xab, 0x99, 0xc9, 0xbd, 0xab, 0x89,
+ 0x18, 0x00, 0x21, 0x55, 0x44, 0x43, 0x44, 0x24, 0x12, 0x81, 0x20, 0x34, 0x03, 0xfb, 0xbb, 0x8a,
+ 0x11, 0xc8, 0xce, 0xab, 0x09, 0x80, 0xdb, 0xbc, 0x08, 0x43, 0x13, 0x80, 0x20, 0x55, 0x33, 0x01,
+ 0xff, 0x1a, 0x3e, 0x00, 0x10, 0x42, 0x23, 0xa9, 0xbd, 0x9a, 0x08, 0xd9, 0xdc, 0xbb, 0x8a, 0x98,
+ 0xcb, 0xac, 0x09, 0x53, 0x13, 0x81, 0x09, 0x62, 0x34, 0x12, 0x98, 0x08, 0x42, 0x12, 0xc9, 0xab,
+ 0x71, 0x45, 0x02, 0xb9, 0x8a, 0x62, 0x13, 0xc9, 0xae, 0x09, 0x31, 0xa0, 0xcf, 0xab, 0x10, 0x23,
+ 0xc8, 0xad, 0x09, 0x34, 0x14, 0x90, 0x89, 0x62, 0x34, 0x02, 0x9a, 0x19, 0x53, 0x03, 0xc8, 0xab,
+ 0x08, 0x22, 0xb0, 0xcf, 0xaa, 0x88, 0x90, 0xcb, 0xbc, 0x89, 0x21, 0x11, 0x98, 0x10, 0x44, 0x24,
+ 0x01, 0x00, 0x31, 0x44, 0x12, 0x90, 0x18, 0x42, 0x24, 0x81, 0xba, 0xab, 0x89, 0xda, 0xce, 0xbb,
+ 0xaa, 0x89, 0xaa, 0xcc, 0xaa, 0x31, 0x46, 0x33, 0x33, 0x43, 0x44, 0x34, 0x23, 0x90, 0x89, 0x31,
+ 0x26, 0xb0, 0xce, 0xab, 0x10, 0x23, 0xd8, 0xcd, 0xab, 0x08, 0x81, 0xda, 0xad, 0x19, 0x42, 0x22,
+ 0x90, 0x8a, 0x42, 0x45, 0x22, 0x80, 0x88, 0x18, 0x11, 0x01, 0xb9, 0xbe, 0xad, 0x89, 0x00, 0x98,
+ 0xcc, 0x9c, 0x18, 0x34, 0x03, 0xda, 0xac, 0x18, 0x34, 0x83, 0xda, 0x9c, 0x38, 0x54, 0x12, 0x98,
+ 0x88, 0x73, 0x34, 0x12, 0xa0, 0xa9, 0x09, 0x11, 0xc8, 0xdd, 0xcb, 0x99, 0x08, 0x98, 0xcb, 0xab,
+ 0x18, 0x33, 0x02, 0xa8, 0x99, 0x41, 0x44, 0x22, 0x98, 0xba, 0x09, 0x64, 0x33, 0x24, 0x32, 0x53,
+ 0x33, 0x24, 0x01, 0x98, 0x89, 0x98, 0xdb, 0xbd, 0xbc, 0xcb, 0xbc, 0xab, 0x10, 0x81, 0xda, 0x8c,
+ 0x61, 0x35, 0x13, 0x00, 0x31, 0x56, 0x33, 0x02, 0x99, 0x18, 0x34, 0x03, 0xec, 0xcc, 0x9a, 0x89,
+ 0xa9, 0xcb, 0xbc, 0xaa, 0x88, 0x01, 0x21, 0x32, 0x53, 0x33, 0x34, 0x24, 0x33, 0x12, 0x01, 0x08,
+ 0x99, 0x99, 0x9a, 0x88, 0xa9, 0xcc, 0x8a, 0x73, 0x23, 0xa0, 0xcd, 0xba, 0x9a, 0xbb, 0xcd, 0xdb,
+ 0x5f, 0xe2, 0x37, 0x00, 0xcc, 0xac, 0xaa, 0x89, 0x00, 0x10, 0x20, 0x43, 0x35, 0x34, 0x54, 0x43,
+ 0x43, 0x12, 0x01, 0x11, 0x43, 0x34, 0x13, 0x90, 0xaa, 0x89, 0x90, 0xdd, 0xcd, 0xba, 0xaa, 0xba,
+ 0xbc, 0xbc, 0xaa, 0x9a, 0x9a, 0x99, 0x20, 0x43, 0x44, 0x53, 0x34, 0x25, 0x23, 0x22, 0x31, 0x43,
+ 0x22, 0x01, 0x98, 0xa9, 0xba, 0xdb, 0xbd, 0xbb, 0x99, 0xca, 0xdb, 0x9b, 0x89, 0xb9, 0xbd, 0xac,
+ 0xaa, 0xca, 0xcb, 0xaa, 0x99, 0xa9, 0xa9, 0x19, 0x63, 0x44, 0x33, 0x44, 0x33, 0x23, 0x80, 0x9a,
+ 0x40, 0x47, 0x33, 0x02, 0x21, 0x44, 0x34, 0x34, 0x33, 0x44, 0x43, 0x01, 0x98, 0x9b, 0x99, 0xca,
+ 0xbd, 0xad, 0x9b, 0x9a, 0xba, 0xac, 0x0a, 0x21, 0x01, 0xa9, 0x9a, 0x41, 0x33, 0xd0, 0xdd, 0x9a,
+ 0x18, 0xa0, 0xdc, 0x9b, 0x28, 0x53, 0x43, 0x53, 0x54, 0x33, 0x13, 0x01, 0x11, 0x01, 0xa9, 0xbd,
+ 0xa9, 0x98, 0xcb, 0xac, 0x0a, 0x33, 0x14, 0xca, 0xbc, 0x19, 0x32, 0xa1, 0xdc, 0xcb, 0xba, 0xbb,
+ 0xbc, 0xbb, 0xab, 0x9a, 0x52, 0x36, 0x03, 0xb8, 0x8a, 0x65, 0x44, 0x33, 0x12, 0x88, 0xbb, 0x8a,
+ 0x42, 0x35, 0x02, 0x90, 0x10, 0x65, 0x35, 0x34, 0x24, 0x12, 0x01, 0x90, 0xa9, 0xbc, 0xcc, 0xba,
+ 0xaa, 0xba, 0xdc, 0xcc, 0xaa, 0x89, 0x99, 0xba, 0x8b, 0x41, 0x34, 0x11, 0x00, 0x10, 0x32, 0x92,
+ 0xfc, 0xab, 0x89, 0x98, 0xfb, 0xbb, 0x8a, 0x08, 0x00, 0x98, 0x88, 0x31, 0x46, 0x13, 0xc9, 0xce,
+ 0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xba, 0xbb, 0xab, 0x89, 0x01, 0x80, 0xaa, 0xcc, 0xbc, 0xcb,
+ 0xba, 0xca, 0xaa, 0x10, 0x14, 0x91, 0x1a, 0x67, 0x44, 0x22, 0x12, 0x10, 0x11, 0x80, 0xdb, 0xbd,
+ 0x9b, 0x09, 0x00, 0x88, 0x09, 0x65, 0x45, 0x33, 0x01, 0x98, 0x00, 0x33, 0x02, 0xeb, 0xac, 0x8a,
+ 0x79, 0xc1, 0x32, 0x00, 0x11, 0x31, 0x45, 0x44, 0x34, 0x24, 0x12, 0x88, 0x88, 0x00, 0xa9, 0xde,
+ 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0x8a, 0x32, 0x33, 0x80, 0x9a, 0x08, 0x43, 0x82, 0xfd, 0xcc, 0xab,
+ 0x99, 0xbb, 0xad, 0x20, 0x46, 0x24, 0x02, 0x88, 0x89, 0xa9, 0xba, 0xac, 0x9b, 0x18, 0x32, 0x36,
+ 0x35, 0x33, 0x24, 0x12, 0x81, 0xc9, 0xcb, 0x9a, 0x10, 0x11, 0xa8, 0xbb, 0x28, 0x47, 0x34, 0x43,
+ 0x33, 0x33, 0x43, 0x32, 0x33, 0x34, 0x54, 0x32, 0x02, 0x00, 0x41, 0x25, 0x02, 0x99, 0x52, 0x47,
+ 0x22, 0x98, 0xbb, 0x8a, 0x42, 0x43, 0x12, 0x11, 0x53, 0x22, 0x22, 0x54, 0x45, 0x23, 0x01, 0x00,
+ 0x32, 0x35, 0x91, 0xba, 0x8b, 0x41, 0x33, 0x23, 0x23, 0x02, 0xfb, 0xcb, 0x18, 0x32, 0xd0, 0xdf,
+ 0xbb, 0x89, 0x01, 0x98, 0xba, 0x9a, 0x10, 0x81, 0xda, 0x9a, 0x51, 0x24, 0xa1, 0xcd, 0xbb, 0x8a,
+ 0x98, 0xcc, 0xbb, 0x28, 0x55, 0x12, 0x80, 0x18, 0x52, 0x13, 0xc8, 0xac, 0x09, 0x01, 0xeb, 0xbc,
+ 0x9a, 0x89, 0x89, 0x09, 0x88, 0xca, 0xcc, 0x9a, 0x20, 0x45, 0x12, 0x08, 0x28, 0x33, 0x14, 0x01,
+ 0x41, 0x44, 0x81, 0xdd, 0xbb, 0x18, 0x32, 0xa8, 0xad, 0x38, 0x45, 0x12, 0x81, 0x10, 0x43, 0x35,
+ 0x23, 0x53, 0x55, 0x24, 0x02, 0xa9, 0x9b, 0x08, 0x90, 0xec, 0xbc, 0x8a, 0x32, 0x36, 0x22, 0x12,
+ 0x10, 0x00, 0x21, 0x54, 0x33, 0x81, 0xbc, 0x9a, 0x31, 0x33, 0x82, 0x00, 0x21, 0xd8, 0xde, 0xcb,
+ 0x99, 0x88, 0xc8, 0xdd, 0xba, 0x89, 0x90, 0xcb, 0xbd, 0x0a, 0x32, 0x15, 0x80, 0x9a, 0x08, 0x33,
+ 0x23, 0x90, 0xdb, 0xdc, 0xbc, 0xac, 0x89, 0x31, 0x33, 0x13, 0x21, 0x55, 0x34, 0x22, 0x12, 0x32,
+ 0x13, 0xe8, 0xcd, 0xbc, 0x9b, 0x99, 0x88, 0x99, 0x89, 0x10, 0x42, 0x53, 0x43, 0x23, 0x01, 0x80,
+ 0x6a, 0x0d, 0x2b, 0x00, 0x42, 0x35, 0x13, 0x00, 0x28, 0x47, 0x34, 0x01, 0x00, 0x21, 0x24, 0x81,
+ 0x88, 0x98, 0xfa, 0xce, 0xbb, 0x8b, 0x10, 0x01, 0x98, 0x89, 0x52, 0x25, 0x02, 0xa9, 0x8a, 0x32,
+ 0x15, 0xb9, 0xae, 0x19, 0x43, 0x03, 0xd9, 0xab, 0x18, 0x23, 0xc0, 0xcd, 0x9a, 0x08, 0x88, 0xa9,
+ 0x8a, 0x51, 0x43, 0x22, 0x01, 0x11, 0x11, 0x10, 0x53, 0x25, 0xa0, 0xce, 0xab, 0x08, 0x21, 0x21,
+ 0x11, 0x80, 0xfe, 0xcd, 0xac, 0x88, 0x10, 0x98, 0xcc, 0xac, 0x89, 0x10, 0x22, 0x43, 0x35, 0x24,
+ 0x81, 0xa9, 0x9a, 0x20, 0x80, 0xaa, 0x49, 0x46, 0x13, 0xb8, 0xbc, 0x30, 0x47, 0x23, 0x90, 0xca,
+ 0xaa, 0x9a, 0xbb, 0xab, 0x09, 0x32, 0x12, 0x88, 0x30, 0x66, 0x43, 0x13, 0x98, 0xba, 0x9a, 0x90,
+ 0xca, 0x9d, 0x51, 0x37, 0x14, 0xa8, 0xbb, 0x9a, 0x08, 0xa9, 0xce, 0xbc, 0xba, 0xb9, 0xaa, 0x9a,
+ 0x42, 0x25, 0x91, 0x9b, 0x70, 0x45, 0x33, 0x81, 0xaa, 0x89, 0x21, 0x82, 0xdb, 0xab, 0x88, 0x90,
+ 0xeb, 0x9b, 0x62, 0x35, 0x24, 0x11, 0x99, 0xaa, 0xab, 0xaa, 0xdc, 0xcb, 0x89, 0x42, 0x13, 0xa0,
+ 0xcb, 0x0a, 0x54, 0x24, 0x81, 0xa9, 0x9a, 0xba, 0xcc, 0xbb, 0x09, 0x81, 0xda, 0xac, 0x09, 0x22,
+ 0xb0, 0xcd, 0xbb, 0xca, 0xbd, 0xbc, 0x9a, 0x20, 0x34, 0x01, 0xa9, 0x48, 0x47, 0x33, 0x11, 0x11,
+ 0x21, 0x91, 0xdf, 0xac, 0x8a, 0x10, 0x02, 0xc9, 0xbc, 0x9b, 0x09, 0x42, 0x33, 0x82, 0x89, 0x20,
+ 0x14, 0xd9, 0xbd, 0x18, 0x55, 0x23, 0x91, 0xbd, 0x9c, 0x20, 0x23, 0x81, 0x88, 0x31, 0x23, 0xd9,
+ 0xbe, 0x8b, 0x21, 0x81, 0xdb, 0x8b, 0x42, 0x83, 0xfb, 0xbc, 0x09, 0x33, 0x12, 0xba, 0x8b, 0x52,
+ 0x23, 0x22, 0x45, 0x35, 0x23, 0x91, 0x9a, 0x40, 0x37, 0x03, 0xb9, 0x9c, 0x18, 0x01, 0xea, 0xbc,
+ 0x47, 0xe8, 0x31, 0x00, 0x9a, 0x99, 0xdb, 0x9b, 0x48, 0x46, 0x33, 0x12, 0x00, 0x08, 0x88, 0x88,
+ 0x08, 0x32, 0x82, 0xea, 0xbb, 0x9a, 0x11, 0x43, 0x35, 0x23, 0x90, 0xba, 0xac, 0x1a, 0x22, 0xe8,
+ 0xbd, 0x28, 0x03, 0xfd, 0xbe, 0x09, 0x43, 0x23, 0x91, 0x18, 0x54, 0x33, 0x81, 0x88, 0x31, 0x25,
+ 0xa0, 0xcd, 0x9b, 0x08, 0x80, 0xdb, 0x9c, 0x19, 0x10, 0x90, 0x99, 0x20, 0x55, 0x53, 0x22, 0x81,
+ 0xa9, 0x9a, 0x31, 0x44, 0x91, 0xeb, 0x9a, 0x40, 0x44, 0x02, 0xb8, 0xcb, 0xaa, 0xa9, 0xeb, 0xbd,
+ 0x9b, 0x10, 0x24, 0x02, 0x80, 0x28, 0x53, 0x35, 0x23, 0x81, 0xaa, 0xcb, 0xbb, 0xac, 0x28, 0x44,
+ 0x81, 0xaa, 0x09, 0x44, 0x33, 0x32, 0x22, 0x22, 0x90, 0xed, 0xcd, 0xbc, 0xab, 0x9a, 0x99, 0x8a,
+ 0x41, 0x53, 0x12, 0x32, 0x56, 0x34, 0x13, 0x90, 0x98, 0x00, 0xa0, 0xdd, 0xbc, 0x89, 0x31, 0x14,
+ 0xb8, 0xcc, 0x9a, 0x00, 0x32, 0x43, 0x34, 0x03, 0xd9, 0xbc, 0x89, 0x32, 0x13, 0x90, 0x88, 0x20,
+ 0x43, 0x53, 0x43, 0x23, 0x22, 0x63, 0x35, 0x83, 0xee, 0xcb, 0x09, 0x11, 0x81, 0xcb, 0x9b, 0x38,
+ 0x34, 0x82, 0xb9, 0x28, 0x44, 0x82, 0xcb, 0xab, 0x10, 0x13, 0x22, 0x44, 0x13, 0xe9, 0xbc, 0x18,
+ 0x44, 0x12, 0xa8, 0xcb, 0xbb, 0xdb, 0xcc, 0xab, 0x09, 0x22, 0x81, 0x98, 0x41, 0x36, 0x13, 0x88,
+ 0x30, 0x37, 0x14, 0xb9, 0xae, 0x0a, 0x42, 0x23, 0x90, 0x88, 0x10, 0x01, 0xa9, 0x89, 0x12, 0x91,
+ 0x9b, 0x38, 0x36, 0x32, 0x53, 0x46, 0x23, 0xa1, 0xcc, 0x0a, 0x53, 0x13, 0xb8, 0xad, 0x1a, 0x22,
+ 0xa1, 0xef, 0xab, 0x09, 0x42, 0x23, 0x91, 0xba, 0x19, 0x64, 0x34, 0x12, 0x01, 0x08, 0x98, 0xda,
+ 0x9a, 0x62, 0x34, 0x90, 0xeb, 0xab, 0x18, 0x22, 0xa8, 0xbc, 0x19, 0x34, 0xb1, 0xbf, 0x0b, 0x42,
+ 0x27, 0x05, 0x2c, 0x00, 0x82, 0xa9, 0x8a, 0x32, 0x12, 0x08, 0x31, 0xb1, 0xff, 0xcb, 0xde, 0xcb,
+ 0x29, 0x65, 0x22, 0xa0, 0xcc, 0x9a, 0x41, 0x34, 0x01, 0xca, 0xab, 0x28, 0x43, 0x02, 0xb9, 0xad,
+ 0x18, 0x43, 0x13, 0xa9, 0xbc, 0x8a, 0x30, 0x22, 0x81, 0xba, 0xbc, 0xab, 0x40, 0x13, 0xfa, 0xae,
+ 0x38, 0x47, 0x23, 0xa0, 0xbc, 0x8a, 0x41, 0x14, 0x80, 0xba, 0x89, 0x20, 0x01, 0x99, 0xbb, 0x9a,
+ 0x98, 0xa8, 0xa9, 0xb9, 0xce, 0xab, 0x41, 0x35, 0x12, 0xa9, 0x99, 0x51, 0x24, 0x02, 0x99, 0x30,
+ 0x35, 0x92, 0xbc, 0x8b, 0x42, 0x23, 0xc8, 0xcf, 0xbb, 0x89, 0x00, 0x98, 0x09, 0x74, 0x44, 0x02,
+ 0xa0, 0x99, 0x08, 0x98, 0xdd, 0xac, 0x9a, 0x08, 0xb9, 0xac, 0x19, 0x55, 0x33, 0x22, 0x33, 0x33,
+ 0x23, 0x11, 0x80, 0xca, 0xbc, 0xbc, 0xcb, 0xcc, 0xcb, 0xab, 0x19, 0x44, 0x24, 0x01, 0x88, 0x00,
+ 0x21, 0x02, 0xca, 0xbc, 0xac, 0xba, 0xab, 0x61, 0x46, 0x23, 0x01, 0x88, 0x88, 0x21, 0x02, 0xfb,
+ 0xcd, 0xba, 0x9a, 0x99, 0x09, 0x31, 0x36, 0x24, 0x01, 0x11, 0x31, 0x33, 0x13, 0x80, 0xba, 0xbd,
+ 0xad, 0x9a, 0x08, 0x22, 0x43, 0x44, 0x45, 0x33, 0x90, 0xeb, 0x8a, 0x22, 0x83, 0xde, 0xbc, 0x8a,
+ 0x08, 0x90, 0xba, 0x09, 0x54, 0x13, 0x81, 0x09, 0x32, 0x14, 0xa0, 0xce, 0x9b, 0x20, 0x44, 0x81,
+ 0x89, 0x20, 0x33, 0x80, 0x9b, 0x60, 0x36, 0x14, 0xb9, 0xbd, 0x9b, 0x99, 0xaa, 0x9a, 0x38, 0x55,
+ 0x34, 0x22, 0x00, 0x08, 0x10, 0x42, 0x22, 0xe9, 0xce, 0xab, 0x89, 0x01, 0x10, 0x31, 0x34, 0x12,
+ 0xa8, 0xaa, 0x72, 0x44, 0x01, 0xda, 0xcc, 0xaa, 0x09, 0x21, 0x22, 0x32, 0x55, 0x22, 0xb8, 0xcd,
+ 0x99, 0x11, 0x01, 0x98, 0xaa, 0x20, 0x55, 0x12, 0xb9, 0xad, 0x89, 0x98, 0xdb, 0xab, 0x9a, 0x9a,
+ 0xf3, 0xf7, 0x25, 0x00, 0x30, 0x36, 0x13, 0x08, 0x62, 0x46, 0x23, 0x82, 0xa9, 0x88, 0x01, 0x90,
+ 0xa9, 0x88, 0xd9, 0xcd, 0xab, 0x28, 0x32, 0x80, 0xcb, 0x0a, 0x21, 0x81, 0xfc, 0xbd, 0x9a, 0x31,
+ 0x14, 0xa0, 0x19, 0x47, 0x23, 0xa1, 0x9a, 0x48, 0x44, 0x02, 0xa9, 0xab, 0x10, 0x01, 0xa9, 0x28,
+ 0x36, 0x83, 0xfb, 0xae, 0x8a, 0x32, 0x03, 0xca, 0x9b, 0x41, 0xb1, 0xcf, 0x9b, 0x08, 0x11, 0x98,
+ 0x9a, 0x51, 0x35, 0x13, 0x98, 0x18, 0x45, 0x33, 0x91, 0xdc, 0xac, 0x8a, 0x99, 0x8a, 0x20, 0x23,
+ 0x88, 0x9a, 0x89, 0x30, 0x25, 0xf8, 0x9c, 0x61, 0x34, 0x81, 0xba, 0xaa, 0x29, 0x45, 0x82, 0xcb,
+ 0x28, 0x15, 0xda, 0x8b, 0x11, 0x91, 0x40, 0x04, 0xef, 0x8a, 0x34, 0xe0, 0xaf, 0x29, 0x45, 0x82,
+ 0xca, 0x8a, 0x31, 0x12, 0x88, 0x18, 0x55, 0x81, 0xed, 0x9b, 0x41, 0x33, 0xa1, 0xbb, 0x19, 0x11,
+ 0xb8, 0x9b, 0x62, 0x24, 0xa0, 0xcc, 0x19, 0x32, 0x92, 0xeb, 0x89, 0x42, 0x12, 0xb8, 0xbc, 0x0a,
+ 0x53, 0x23, 0xa1, 0xbb, 0x8b, 0x42, 0x23, 0xa0, 0xbb, 0x9a, 0x42, 0x45, 0x81, 0xcc, 0x9b, 0x30,
+ 0x24, 0x80, 0xc9, 0xcc, 0x9b, 0x52, 0x25, 0x92, 0xda, 0x9a, 0x40, 0x24, 0xc8, 0xae, 0x39, 0x45,
+ 0x02, 0xcb, 0xac, 0x20, 0x34, 0x03, 0xea, 0xbb, 0x19, 0x45, 0x14, 0xa8, 0xae, 0x0a, 0x53, 0x13,
+ 0xb9, 0xbd, 0x09, 0x63, 0x12, 0xa8, 0xad, 0x19, 0x51, 0x12, 0xa0, 0xf9, 0x03, 0x8b, 0x69, 0x01,
+ 0xa8, 0x0d, 0xd2, 0x23, 0x02, 0xa9, 0x0f, 0x83, 0x2b, 0x06, 0x90, 0xd9, 0x38, 0x1b, 0x06, 0xa0,
+ 0x8c, 0x93, 0x2b, 0x16, 0x88, 0x9b, 0x2d, 0xd2, 0x23, 0x82, 0xd9, 0x4a, 0x0b, 0x24, 0x80, 0xa8,
+ 0x1f, 0xc1, 0x23, 0x11, 0xaa, 0x9c, 0x20, 0x33, 0x91, 0xcb, 0x89, 0x23, 0x92, 0xba, 0x19, 0x25,
+ 0x3f, 0x31, 0x47, 0x00, 0xd9, 0xac, 0x19, 0x62, 0x22, 0xb0, 0xcd, 0x0a, 0x41, 0x14, 0x90, 0xbc,
+ 0x0a, 0x62, 0x12, 0xb8, 0xad, 0x18, 0x34, 0x81, 0xca, 0x0a, 0x32, 0x14, 0xc9, 0xaa, 0x28, 0x43,
+ 0x02, 0xca, 0xac, 0x18, 0x43, 0x02, 0xcb, 0x0a, 0x41, 0x02, 0xda, 0x9b, 0x30, 0x36, 0x80, 0xcb,
+ 0xbb, 0x08, 0x43, 0x35, 0x03, 0xfb, 0xbb, 0x28, 0x45, 0x12, 0xb8, 0xbe, 0x89, 0x42, 0x05, 0x91,
+ 0xb9, 0xaa, 0x7e, 0xa9, 0x24, 0x81, 0xea, 0x30, 0xa8, 0x43, 0x80, 0xca, 0x4c, 0xa8, 0x06, 0x80,
+ 0xcb, 0x09, 0x41, 0x11, 0x99, 0x9a, 0x08, 0x11, 0x02, 0xa8, 0xaa, 0x18, 0x32, 0x22, 0x92, 0xeb,
+ 0x8b, 0x52, 0x23, 0xc8, 0xbc, 0x09, 0x44, 0x03, 0xd9, 0x9c, 0x30, 0x26, 0x98, 0xbc, 0x0a, 0x43,
+ 0x23, 0xa0, 0xcd, 0x8a, 0x42, 0x24, 0xb9, 0xae, 0x18, 0x44, 0x82, 0xcb, 0x8b, 0x51, 0x23, 0xb8,
+ 0xbd, 0x19, 0x44, 0x02, 0xca, 0xab, 0x20, 0x34, 0x03, 0xca, 0xbd, 0x19, 0x45, 0x02, 0xc9, 0xab,
+ 0x28, 0x43, 0x03, 0xc9, 0xbc, 0x18, 0x35, 0x02, 0xca, 0xab, 0x10, 0x24, 0x02, 0xb9, 0xac, 0x18,
+ 0x22, 0x02, 0x01, 0xc8, 0xbe, 0x29, 0x46, 0x82, 0xba, 0x9d, 0x20, 0x33, 0x82, 0xdb, 0x9b, 0x31,
+ 0x24, 0xa8, 0x9b, 0x30, 0x83, 0xce, 0x0b, 0x55, 0x14, 0xc8, 0xad, 0x1a, 0x53, 0x13, 0xb8, 0xbc,
+ 0x0a, 0x41, 0x43, 0x80, 0xac, 0x0c, 0x32, 0x95, 0xf1, 0x58, 0x9a, 0x28, 0x84, 0xc0, 0x3c, 0x9a,
+ 0x16, 0x80, 0xf8, 0x11, 0x4d, 0x02, 0x80, 0x9e, 0xc3, 0x41, 0x00, 0xa9, 0x8c, 0x20, 0x23, 0xb0,
+ 0xbc, 0x18, 0x43, 0x81, 0xaa, 0x8a, 0x10, 0x12, 0x90, 0x88, 0x21, 0xd8, 0xaf, 0x48, 0x36, 0xa1,
+ 0xbe, 0x0a, 0x53, 0x13, 0xb9, 0xbc, 0x19, 0x52, 0x23, 0xb8, 0xcd, 0x09, 0x53, 0x12, 0xc9, 0x9c,
+ 0xf3, 0x98, 0x54, 0x00, 0x42, 0x02, 0xba, 0x8c, 0x30, 0x23, 0x90, 0xbd, 0x8a, 0x63, 0x13, 0xb8,
+ 0xbe, 0x08, 0x25, 0x03, 0xca, 0x7d, 0xda, 0x14, 0x82, 0xbb, 0x21, 0x9b, 0x27, 0x90, 0xac, 0x0a,
+ 0x52, 0x12, 0xb8, 0xbc, 0x18, 0x44, 0x82, 0xf8, 0x31, 0xe8, 0x40, 0x80, 0xca, 0x21, 0x8a, 0x34,
+ 0xa8, 0xbd, 0x95, 0x58, 0x00, 0xb9, 0xab, 0x30, 0x25, 0x92, 0xdb, 0x8a, 0x41, 0x13, 0xb9, 0xaa,
+ 0x11, 0x02, 0x89, 0x21, 0x82, 0xcc, 0x8b, 0x52, 0x24, 0xb8, 0xcc, 0x09, 0x43, 0x14, 0xb8, 0xbc,
+ 0x0b, 0x73, 0x03, 0xc9, 0x9b, 0x52, 0x03, 0xca, 0x9b, 0x42, 0x04, 0xb8, 0x9c, 0x20, 0x25, 0xb1,
+ 0xbe, 0x29, 0x45, 0x81, 0xcb, 0x20, 0x9a, 0x45, 0x88, 0xcc, 0x93, 0x5a, 0x10, 0x88, 0x99, 0x89,
+ 0x88, 0x21, 0x23, 0x01, 0xdb, 0xbd, 0x28, 0x46, 0x82, 0xdb, 0x9a, 0x41, 0x23, 0xa8, 0xbc, 0x1a,
+ 0x53, 0x03, 0xc9, 0xab, 0x38, 0x34, 0x92, 0xdb, 0x9b, 0x42, 0x24, 0x98, 0xad, 0x0a, 0x43, 0x13,
+ 0xc9, 0xad, 0x18, 0x43, 0x82, 0xaa, 0x0a, 0x22, 0x81, 0x9a, 0x18, 0x11, 0x00, 0x80, 0xcc, 0x2a,
+ 0x47, 0xb1, 0xbf, 0x38, 0x36, 0xa0, 0xad, 0x29, 0x32, 0x80, 0xba, 0x8a, 0x30, 0x35, 0xb0, 0x9c,
+ 0x41, 0x92, 0xcf, 0x0a, 0x53, 0x14, 0x98, 0xdb, 0x8a, 0x52, 0x13, 0xda, 0x9b, 0x41, 0x14, 0x90,
+ 0xab, 0x8a, 0x20, 0x33, 0x91, 0xac, 0x20, 0x83, 0xdb, 0x1a, 0x44, 0x90, 0xac, 0x30, 0x24, 0xd8,
+ 0xbc, 0x39, 0x46, 0x81, 0xdb, 0x8b, 0x53, 0x12, 0xb8, 0xad, 0x18, 0x43, 0x02, 0xd9, 0xaa, 0x31,
+ 0x25, 0x88, 0x0f, 0xd0, 0x33, 0x01, 0xb9, 0x9d, 0x10, 0x33, 0x91, 0xeb, 0x09, 0x43, 0x02, 0xda,
+ 0x9a, 0x32, 0x85, 0xe8, 0x49, 0x2c, 0x13, 0x80, 0xfb, 0xa3, 0x59, 0x11, 0x98, 0xab, 0x08, 0x22,
+ 0xe6, 0x2c, 0x4e, 0x00, 0x98, 0x99, 0x10, 0x81, 0x80, 0x00, 0x12, 0xda, 0xbe, 0x29, 0x46, 0x13,
+ 0xeb, 0xab, 0x40, 0x24, 0xa0, 0xbc, 0x19, 0x53, 0x02, 0xc9, 0xbb, 0x30, 0x35, 0x90, 0xcb, 0x09,
+ 0x31, 0x13, 0x99, 0xbb, 0x9a, 0x31, 0x45, 0x01, 0xd9, 0xab, 0x19, 0x54, 0x23, 0xd9, 0xbd, 0x29,
+ 0x45, 0x02, 0xdb, 0x9b, 0x41, 0x14, 0xa0, 0xac, 0x19, 0x33, 0x02, 0xca, 0x9a, 0x20, 0x23, 0x82,
+ 0xdb, 0x9b, 0x42, 0x14, 0xb8, 0xac, 0x19, 0x42, 0x33, 0xb1, 0xcf, 0x8a, 0x53, 0x03, 0xa9, 0x9b,
+ 0x88, 0x08, 0x53, 0x14, 0xda, 0x9d, 0x30, 0x24, 0xa0, 0xbc, 0x19, 0x44, 0x12, 0xda, 0x9c, 0x48,
+ 0x34, 0xa0, 0xcc, 0x0a, 0x43, 0x02, 0xba, 0x8b, 0x41, 0x12, 0xb9, 0xbb, 0x31, 0x25, 0x90, 0xbb,
+ 0x18, 0x33, 0xa1, 0xcb, 0x28, 0x35, 0x91, 0xcd, 0x0a, 0x34, 0xa0, 0xbe, 0x38, 0x36, 0x80, 0xcb,
+ 0x9b, 0x28, 0x54, 0x03, 0xda, 0x9c, 0x31, 0x13, 0xa9, 0x89, 0x01, 0xdb, 0x29, 0x47, 0x82, 0xcd,
+ 0x8b, 0x41, 0x25, 0x90, 0xbd, 0x0a, 0x34, 0x03, 0xda, 0x9a, 0x21, 0x14, 0x90, 0xab, 0x19, 0x22,
+ 0x91, 0x9b, 0x30, 0x15, 0xda, 0x9b, 0x21, 0x24, 0x02, 0xc8, 0xbd, 0x2a, 0x45, 0x82, 0xbc, 0x09,
+ 0x23, 0x82, 0xa8, 0xbb, 0x2a, 0x47, 0x82, 0xcc, 0x09, 0x33, 0xa0, 0x9b, 0x42, 0x93, 0xcd, 0x0a,
+ 0x42, 0x33, 0xc0, 0xbe, 0x2a, 0x46, 0x92, 0xcc, 0x1a, 0x43, 0x83, 0xca, 0x9b, 0x30, 0x25, 0xa1,
+ 0xcc, 0x0a, 0x53, 0x82, 0xba, 0x89, 0x21, 0x12, 0x80, 0xa9, 0xac, 0x38, 0x35, 0xa1, 0xad, 0x18,
+ 0x22, 0x81, 0xa8, 0xaa, 0x38, 0x26, 0xc8, 0x0c, 0x53, 0x92, 0xbf, 0x0a, 0x63, 0x13, 0xa0, 0xcd,
+ 0x8a, 0x63, 0x03, 0xda, 0x8b, 0x52, 0x03, 0xca, 0x9b, 0x40, 0x33, 0xa1, 0xdc, 0x0a, 0x42, 0x13,
+ 0xf7, 0x50, 0x51, 0x00, 0xbc, 0x19, 0x42, 0x02, 0xba, 0xab, 0x40, 0x43, 0xa0, 0xbc, 0x19, 0x53,
+ 0x81, 0xb9, 0x89, 0x80, 0x21, 0x33, 0xc0, 0xbe, 0x19, 0x43, 0x14, 0x90, 0xcd, 0x8b, 0x52, 0x14,
+ 0xd8, 0x9b, 0x40, 0x33, 0xb8, 0xbd, 0x09, 0x44, 0x12, 0xb9, 0x9d, 0x28, 0x22, 0x90, 0x89, 0x00,
+ 0x98, 0x9b, 0x19, 0x63, 0x34, 0xb0, 0xdf, 0x1a, 0x52, 0x02, 0xb9, 0xab, 0x31, 0x13, 0xc9, 0x8b,
+ 0x73, 0x02, 0xdb, 0x9b, 0x52, 0x33, 0xb8, 0xcc, 0x89, 0x42, 0x12, 0xb8, 0x9b, 0x31, 0x82, 0xcc,
+ 0x18, 0x34, 0x02, 0xdb, 0xbc, 0x29, 0x47, 0x82, 0xdb, 0x9b, 0x52, 0x22, 0xb8, 0xbb, 0x19, 0x43,
+ 0x02, 0xa9, 0x9c, 0x20, 0x32, 0x81, 0xeb, 0xbb, 0x61, 0x25, 0xb0, 0xbd, 0x29, 0x35, 0x91, 0xbc,
+ 0x19, 0x34, 0x92, 0xcc, 0x8a, 0x53, 0x12, 0xc9, 0x9c, 0x20, 0x24, 0x91, 0xcb, 0x9a, 0x32, 0x25,
+ 0xa0, 0xbc, 0x09, 0x43, 0x12, 0xb9, 0xab, 0x18, 0x32, 0x32, 0xa0, 0xbf, 0x0a, 0x46, 0x02, 0xcc,
+ 0x9b, 0x53, 0x14, 0xa9, 0xad, 0x18, 0x43, 0x02, 0xc9, 0x9b, 0x20, 0x14, 0x90, 0xbb, 0x29, 0x35,
+ 0x83, 0xcd, 0x9b, 0x62, 0x13, 0xb8, 0xbc, 0x09, 0x44, 0x12, 0xb9, 0xaa, 0x20, 0x90, 0xad, 0x61,
+ 0x34, 0xb0, 0xbf, 0x09, 0x63, 0x12, 0xb8, 0xad, 0x18, 0x43, 0x81, 0xca, 0x89, 0x22, 0x01, 0x98,
+ 0x99, 0x00, 0x08, 0x08, 0x21, 0x23, 0xf9, 0xac, 0x38, 0x35, 0x92, 0xcc, 0xab, 0x51, 0x25, 0x91,
+ 0xbc, 0x8b, 0x42, 0x23, 0xa0, 0xbc, 0x0a, 0x43, 0x03, 0xb9, 0x09, 0x12, 0xfc, 0x9c, 0x73, 0x23,
+ 0xc9, 0xbc, 0x28, 0x44, 0x01, 0xcb, 0x9b, 0x41, 0x34, 0xa0, 0xad, 0x0a, 0x31, 0x14, 0x91, 0xcb,
+ 0x8a, 0x31, 0x14, 0xa8, 0xab, 0x18, 0x53, 0x83, 0xeb, 0x9c, 0x41, 0x14, 0xb9, 0x8b, 0x32, 0x92,
+ 0x67, 0x00, 0x46, 0x00, 0x8b, 0x53, 0x82, 0xba, 0x09, 0x12, 0x88, 0x99, 0x99, 0x39, 0x67, 0x02,
+ 0xda, 0xac, 0x28, 0x45, 0x02, 0xdb, 0xab, 0x40, 0x24, 0x90, 0xbc, 0x19, 0x44, 0x82, 0xcc, 0x9b,
+ 0x52, 0x24, 0xb0, 0xcc, 0x19, 0x32, 0x12, 0xa8, 0xac, 0x89, 0x32, 0x13, 0x90, 0xab, 0x89, 0x88,
+ 0x28, 0x46, 0x82, 0xdb, 0x8b, 0x32, 0x81, 0xbd, 0x28, 0x47, 0x92, 0xdd, 0x8a, 0x63, 0x03, 0xda,
+ 0x9b, 0x32, 0x24, 0xa9, 0xaa, 0x18, 0x11, 0x00, 0x99, 0x30, 0x14, 0xea, 0x9c, 0x41, 0x14, 0xa9,
+ 0xac, 0x10, 0x43, 0x03, 0xfa, 0xab, 0x51, 0x14, 0xc8, 0xbb, 0x40, 0x44, 0x80, 0x9d, 0x01, 0x1a,
+ 0x06, 0xa8, 0x9c, 0x38, 0x33, 0xb1, 0xbd, 0x09, 0x34, 0x03, 0xd9, 0xab, 0x30, 0x35, 0x90, 0xad,
+ 0x09, 0x32, 0x03, 0xb9, 0xac, 0x18, 0x53, 0x01, 0xca, 0x8a, 0x32, 0x02, 0xba, 0x09, 0x02, 0xa8,
+ 0x20, 0x34, 0xc9, 0xbb, 0x10, 0x33, 0x44, 0xb1, 0xdf, 0x29, 0x34, 0x90, 0xab, 0x89, 0x9a, 0x78,
+ 0x36, 0xb0, 0xce, 0x19, 0x43, 0x03, 0xca, 0xab, 0x28, 0x36, 0x91, 0xbc, 0x09, 0x22, 0x81, 0x99,
+ 0x10, 0x01, 0x80, 0xca, 0xac, 0x51, 0x24, 0xb8, 0x9b, 0x53, 0x92, 0xbd, 0x0b, 0x54, 0x13, 0xd9,
+ 0xbc, 0x28, 0x45, 0x82, 0xca, 0xab, 0x10, 0x44, 0x01, 0xba, 0x0a, 0x22, 0xd0, 0x9c, 0x52, 0x14,
+ 0xb8, 0xac, 0x19, 0x33, 0x81, 0x99, 0x38, 0x83, 0xfd, 0xab, 0x44, 0x07, 0xa0, 0x2d, 0xba, 0x24,
+ 0x82, 0xb9, 0x8c, 0x20, 0x23, 0xa0, 0xad, 0x18, 0x33, 0x82, 0xd9, 0xaa, 0x28, 0x34, 0x02, 0xcb,
+ 0xac, 0x30, 0x24, 0x91, 0xba, 0x89, 0x01, 0x00, 0x01, 0x90, 0x30, 0x37, 0xf0, 0xbd, 0x39, 0x46,
+ 0x81, 0xdb, 0x8a, 0x41, 0x22, 0xa8, 0xbc, 0x19, 0x35, 0x92, 0xdb, 0x0a, 0x42, 0x82, 0xba, 0x8a,
+ 0x48, 0xee, 0x48, 0x00, 0x34, 0xb8, 0xad, 0x18, 0x32, 0x11, 0x88, 0xb8, 0xbd, 0x19, 0x45, 0x02,
+ 0xca, 0x9b, 0x40, 0x23, 0xa8, 0xcc, 0x09, 0x53, 0x24, 0xb8, 0xcd, 0x19, 0x44, 0x82, 0xdb, 0x0a,
+ 0x22, 0x83, 0xa9, 0x09, 0x81, 0xa8, 0x9a, 0x08, 0x65, 0x14, 0xd8, 0xbd, 0x28, 0x35, 0x81, 0xba,
+ 0xab, 0x28, 0x45, 0x12, 0xda, 0xac, 0x30, 0x24, 0x91, 0xac, 0x89, 0x31, 0x23, 0xc8, 0xbc, 0x28,
+ 0x36, 0xa1, 0xbc, 0x0b, 0x52, 0x23, 0xa1, 0xbe, 0x8b, 0x54, 0x13, 0xca, 0x9c, 0x20, 0x24, 0x91,
+ 0xdb, 0x8a, 0x41, 0x33, 0xb0, 0xcc, 0x0a, 0x52, 0x12, 0xb9, 0xac, 0x20, 0x25, 0x90, 0xab, 0x0a,
+ 0x21, 0x22, 0x82, 0xda, 0x9b, 0x28, 0x34, 0x82, 0xdb, 0x9b, 0x52, 0x15, 0xc8, 0x9c, 0x51, 0x13,
+ 0xea, 0xaa, 0x41, 0x24, 0xa8, 0xcb, 0x0a, 0x53, 0x13, 0xc8, 0xad, 0x18, 0x44, 0x01, 0xba, 0x9c,
+ 0x28, 0x33, 0x03, 0xca, 0xbb, 0x29, 0x44, 0x02, 0xba, 0x9d, 0x28, 0x34, 0x82, 0xdb, 0x9b, 0x21,
+ 0x24, 0x02, 0xc8, 0xcc, 0x09, 0x63, 0x13, 0xca, 0xac, 0x28, 0x35, 0x82, 0xdc, 0x8b, 0x52, 0x23,
+ 0xb9, 0xad, 0x28, 0x33, 0x91, 0xcb, 0x08, 0x22, 0xa0, 0xac, 0x48, 0x35, 0xb0, 0xbe, 0x19, 0x34,
+ 0x03, 0xc9, 0xac, 0x18, 0x43, 0x02, 0xba, 0x9b, 0x33, 0x03, 0xeb, 0x8a, 0x31, 0x34, 0x91, 0xfb,
+ 0x9b, 0x40, 0x15, 0xa0, 0xbb, 0x29, 0x43, 0x01, 0xbb, 0x8c, 0x52, 0x23, 0xeb, 0xab, 0x51, 0x23,
+ 0xb9, 0x8c, 0x31, 0x91, 0xbd, 0x38, 0x37, 0x90, 0xcc, 0x8a, 0x51, 0x33, 0xc0, 0xcc, 0x19, 0x34,
+ 0x82, 0xca, 0x8b, 0x30, 0x23, 0x98, 0xab, 0x09, 0x33, 0x82, 0xbb, 0x8a, 0x80, 0x09, 0x73, 0x05,
+ 0xc9, 0x8a, 0x32, 0x82, 0xbb, 0x8b, 0x10, 0x63, 0x14, 0xd9, 0x9c, 0x31, 0x04, 0xca, 0x8a, 0x12,
+ 0x1b, 0xfd, 0x3d, 0x00, 0x22, 0x13, 0xfd, 0x9b, 0x51, 0x04, 0xb8, 0x9b, 0x52, 0x03, 0xd9, 0xab,
+ 0x41, 0x34, 0xc8, 0xbc, 0x20, 0x26, 0x91, 0xbc, 0x0a, 0x42, 0x23, 0xb8, 0xbd, 0x1b, 0x44, 0x23,
+ 0xb9, 0xbd, 0x8a, 0x31, 0x45, 0x03, 0xe9, 0xbb, 0x19, 0x54, 0x02, 0xc8, 0xba, 0x28, 0x34, 0x91,
+ 0xcb, 0x0a, 0x43, 0x82, 0xba, 0x9a, 0x31, 0x14, 0x90, 0xca, 0x8b, 0x63, 0x24, 0xc8, 0xbd, 0x18,
+ 0x44, 0x01, 0xca, 0x9a, 0x20, 0x33, 0x91, 0xbc, 0x8b, 0x63, 0x13, 0xe9, 0xab, 0x40, 0x35, 0xa0,
+ 0xbd, 0x1a, 0x44, 0x03, 0xdb, 0x9b, 0x30, 0x34, 0x80, 0xcb, 0x8a, 0x31, 0x33, 0x90, 0xbd, 0x9b,
+ 0x51, 0x33, 0xb0, 0xbd, 0x09, 0x35, 0x02, 0xdb, 0x9b, 0x31, 0x26, 0x90, 0xba, 0x8a, 0x20, 0x22,
+ 0x90, 0x89, 0x28, 0x12, 0xa8, 0xcb, 0xbb, 0x2a, 0x57, 0x13, 0xc9, 0xab, 0x11, 0x91, 0xac, 0x68,
+ 0x34, 0x91, 0xbe, 0x8b, 0x63, 0x23, 0xc8, 0xbc, 0x18, 0x43, 0x82, 0xa9, 0x8b, 0x30, 0x25, 0x90,
+ 0xbd, 0x9c, 0x20, 0x55, 0x22, 0xc9, 0xbd, 0x28, 0x25, 0x91, 0xdb, 0x09, 0x42, 0x12, 0xa0, 0xbc,
+ 0x8b, 0x42, 0x23, 0xa0, 0xbc, 0x18, 0x45, 0x02, 0xdc, 0x9c, 0x30, 0x35, 0x81, 0xbc, 0x8c, 0x31,
+ 0x15, 0xa0, 0xac, 0x18, 0x22, 0xa0, 0xaa, 0x51, 0x24, 0xa0, 0xbe, 0x9b, 0x62, 0x24, 0x90, 0xcb,
+ 0x9a, 0x21, 0x23, 0x80, 0x99, 0x89, 0x10, 0x80, 0x88, 0x20, 0x90, 0xcd, 0x29, 0x37, 0x81, 0xdc,
+ 0x0a, 0x63, 0x02, 0xea, 0xab, 0x40, 0x35, 0x92, 0xeb, 0x9b, 0x31, 0x24, 0x91, 0xbb, 0x8a, 0x32,
+ 0x81, 0xaa, 0x18, 0x34, 0xa1, 0xbf, 0x09, 0x45, 0x12, 0xc9, 0x9b, 0x09, 0x01, 0x11, 0x44, 0x03,
+ 0xe9, 0xbc, 0x89, 0x53, 0x33, 0x91, 0xdb, 0x9a, 0x08, 0x11, 0x22, 0x21, 0x90, 0xcd, 0x9a, 0x30,
+ 0x6f, 0x06, 0x42, 0x00, 0x26, 0xb8, 0xbe, 0x09, 0x42, 0x14, 0x80, 0xca, 0xbb, 0x1a, 0x46, 0x22,
+ 0xc9, 0xac, 0x18, 0x43, 0x81, 0xc9, 0x9a, 0x40, 0x33, 0xb0, 0xac, 0x09, 0x23, 0x81, 0x8a, 0x08,
+ 0xa0, 0x8a, 0x74, 0x14, 0xda, 0xad, 0x29, 0x45, 0x12, 0xc9, 0xbc, 0x18, 0x44, 0x02, 0xc9, 0xac,
+ 0x20, 0x34, 0x82, 0xdb, 0xab, 0x40, 0x34, 0x91, 0xdb, 0x8a, 0x30, 0x14, 0xa8, 0xac, 0x38, 0x36,
+ 0xa1, 0xcc, 0x8b, 0x52, 0x23, 0xb8, 0xbc, 0x09, 0x33, 0x13, 0xc9, 0xbb, 0x30, 0x34, 0xa1, 0xcb,
+ 0x19, 0x45, 0x02, 0xcc, 0xab, 0x41, 0x25, 0x92, 0xbc, 0x9c, 0x21, 0x34, 0x11, 0xa9, 0xcc, 0x9a,
+ 0x30, 0x35, 0x02, 0xda, 0x9b, 0x28, 0x24, 0x91, 0xba, 0x09, 0x33, 0xa1, 0xbc, 0x29, 0x36, 0x92,
+ 0xcc, 0x8b, 0x30, 0x35, 0x02, 0xc9, 0xcc, 0x8a, 0x42, 0x24, 0x91, 0xca, 0x9b, 0x30, 0x34, 0x90,
+ 0xcc, 0x19, 0x34, 0x92, 0xcc, 0x8a, 0x34, 0x04, 0xd9, 0xab, 0x28, 0x35, 0x03, 0xca, 0xac, 0x19,
+ 0x24, 0x83, 0xb9, 0xab, 0x10, 0x13, 0x80, 0x18, 0x33, 0xc0, 0xcf, 0x8a, 0x52, 0x24, 0x80, 0xbc,
+ 0xab, 0x08, 0x42, 0x45, 0x02, 0xc9, 0xac, 0x1a, 0x41, 0x12, 0x88, 0x89, 0x08, 0x98, 0xba, 0x0b,
+ 0x64, 0x14, 0xc8, 0xbc, 0x19, 0x54, 0x12, 0xc8, 0xbb, 0x29, 0x34, 0xa1, 0xac, 0x48, 0x34, 0xc8,
+ 0xbd, 0x19, 0x54, 0x02, 0xc8, 0xbb, 0x19, 0x44, 0x12, 0xb9, 0xac, 0x08, 0x53, 0x22, 0xb8, 0xbe,
+ 0x09, 0x44, 0x12, 0xb9, 0x9d, 0x28, 0x24, 0x91, 0xdb, 0x9a, 0x52, 0x23, 0xc8, 0xbc, 0x28, 0x34,
+ 0x01, 0xca, 0x9b, 0x10, 0x23, 0x81, 0x88, 0x21, 0xb0, 0xdf, 0x0a, 0x63, 0x13, 0xb8, 0xbd, 0x1a,
+ 0x63, 0x03, 0xc8, 0xbb, 0x28, 0x44, 0x81, 0xcb, 0x8a, 0x52, 0x12, 0xd9, 0x9b, 0x30, 0x26, 0x91,
+ 0x07, 0x14, 0x4d, 0x00, 0xad, 0x29, 0x44, 0x02, 0xca, 0x9c, 0x20, 0x33, 0x92, 0xdb, 0x8a, 0x31,
+ 0x14, 0xa8, 0xac, 0x18, 0x34, 0x81, 0xcb, 0x9b, 0x40, 0x35, 0x90, 0xcc, 0x8a, 0x42, 0x23, 0xc8,
+ 0xbc, 0x18, 0x34, 0x13, 0xca, 0xac, 0x08, 0x33, 0x12, 0x80, 0xb9, 0xcb, 0x9a, 0x42, 0x25, 0x12,
+ 0xa8, 0xbd, 0x9c, 0x21, 0x25, 0x81, 0x9a, 0x8a, 0x88, 0x89, 0x20, 0x44, 0x01, 0xcb, 0xad, 0x19,
+ 0x45, 0x24, 0xa8, 0xeb, 0xaa, 0x18, 0x53, 0x33, 0x91, 0xcc, 0x9b, 0x10, 0x22, 0x81, 0x08, 0x01,
+ 0xb8, 0xbc, 0x50, 0x35, 0xa0, 0xce, 0x09, 0x32, 0x03, 0xa8, 0x19, 0x34, 0xd0, 0xce, 0x8b, 0x53,
+ 0x33, 0x90, 0xbb, 0x8b, 0x21, 0x90, 0xac, 0x29, 0x47, 0x82, 0xca, 0x9c, 0x20, 0x33, 0x90, 0xcc,
+ 0x0a, 0x52, 0x23, 0x90, 0xbd, 0x9a, 0x21, 0x22, 0x12, 0xa8, 0xac, 0x09, 0x32, 0x91, 0xbb, 0x89,
+ 0x21, 0x73, 0x34, 0x92, 0xdc, 0xbb, 0xa9, 0x08, 0x73, 0x35, 0x03, 0xb8, 0xbe, 0xac, 0x38, 0x45,
+ 0x03, 0xc9, 0x9c, 0x20, 0x24, 0x80, 0xdb, 0x9b, 0x18, 0x43, 0x33, 0x02, 0xb9, 0xce, 0xbb, 0x20,
+ 0x35, 0x14, 0x91, 0xbb, 0xac, 0x10, 0x12, 0x80, 0x32, 0x14, 0xfa, 0xad, 0x20, 0x44, 0x12, 0xc9,
+ 0xbc, 0x8a, 0x53, 0x33, 0x91, 0xdb, 0xab, 0x19, 0x43, 0x13, 0x01, 0x01, 0xda, 0xbf, 0x0a, 0x42,
+ 0x25, 0x91, 0xba, 0xab, 0x38, 0x34, 0x82, 0xbb, 0x9b, 0x38, 0x53, 0x12, 0x98, 0xa8, 0xfb, 0xbe,
+ 0x8a, 0x64, 0x24, 0x91, 0xda, 0xaa, 0x18, 0x22, 0x11, 0x98, 0x11, 0x12, 0xc9, 0xbd, 0x28, 0x34,
+ 0x82, 0xdc, 0x8a, 0x51, 0x34, 0x90, 0xcc, 0xab, 0x28, 0x34, 0x13, 0x90, 0xba, 0xaa, 0xba, 0xbb,
+ 0x58, 0x47, 0x13, 0xb9, 0xad, 0x18, 0x22, 0x91, 0xaa, 0x09, 0x43, 0x22, 0xa0, 0xab, 0xab, 0xeb,
+ 0x02, 0xed, 0x38, 0x00, 0x29, 0x56, 0x23, 0x98, 0xbc, 0xbb, 0x8a, 0x30, 0x45, 0x23, 0x02, 0xb8,
+ 0xcc, 0xaa, 0x08, 0x00, 0x30, 0x47, 0x23, 0xa0, 0xbc, 0x9c, 0x89, 0x08, 0x30, 0x43, 0x33, 0x02,
+ 0xda, 0xce, 0x9a, 0x18, 0x23, 0x32, 0x12, 0x90, 0xbc, 0x9a, 0xa8, 0xce, 0x8b, 0x74, 0x43, 0x01,
+ 0xca, 0xbb, 0x89, 0x10, 0x32, 0x33, 0x34, 0x81, 0xcd, 0xbc, 0x8a, 0x21, 0x45, 0x12, 0xa9, 0xbb,
+ 0x18, 0x23, 0xd9, 0xac, 0x40, 0x25, 0x91, 0xbc, 0x0a, 0x32, 0x82, 0xcc, 0x89, 0x42, 0x13, 0x99,
+ 0x8a, 0x42, 0x13, 0xeb, 0x9c, 0x30, 0x35, 0x01, 0x99, 0x08, 0xb8, 0xce, 0x89, 0x73, 0x23, 0xa0,
+ 0xcc, 0x9b, 0x31, 0x34, 0xa1, 0xcb, 0x09, 0x21, 0x98, 0xac, 0x41, 0x45, 0x81, 0xdb, 0x9a, 0x20,
+ 0x23, 0x01, 0xa9, 0xba, 0x9b, 0x51, 0x35, 0x02, 0xc9, 0xbc, 0x09, 0x45, 0x12, 0xb9, 0x8b, 0x41,
+ 0x82, 0xbc, 0x29, 0x45, 0x82, 0xca, 0xab, 0x19, 0x53, 0x13, 0xc9, 0xbb, 0x9a, 0x31, 0x34, 0x92,
+ 0xce, 0xab, 0x31, 0x24, 0xa0, 0xab, 0x38, 0x46, 0x12, 0xa8, 0xbc, 0x8a, 0x41, 0x33, 0x12, 0x99,
+ 0x38, 0x25, 0xe8, 0xbe, 0x19, 0x54, 0x02, 0xca, 0x9b, 0x30, 0x34, 0x92, 0xeb, 0xab, 0x19, 0x53,
+ 0x13, 0xb0, 0xbd, 0x8b, 0x21, 0x12, 0x89, 0x18, 0x03, 0xfb, 0xad, 0x29, 0x34, 0x14, 0xc9, 0xcb,
+ 0x08, 0x24, 0x83, 0xba, 0x9a, 0x42, 0x23, 0xb9, 0xad, 0x20, 0x35, 0xa2, 0xbf, 0x8b, 0x63, 0x12,
+ 0xba, 0x9b, 0x20, 0x82, 0xa9, 0x41, 0x25, 0xb8, 0xbe, 0x0a, 0x34, 0x13, 0xca, 0x9d, 0x28, 0x25,
+ 0x82, 0xba, 0x9b, 0x31, 0x14, 0xa9, 0x9b, 0x53, 0x34, 0x80, 0xdb, 0xcb, 0x1a, 0x54, 0x24, 0xb0,
+ 0xcc, 0x89, 0x32, 0x12, 0xa8, 0xac, 0x19, 0x42, 0x22, 0x81, 0xaa, 0x89, 0x90, 0xec, 0x0a, 0x75,
+ 0x80, 0x02, 0x34, 0x00, 0x82, 0xca, 0x9c, 0x08, 0x21, 0x12, 0x80, 0x99, 0x9a, 0x88, 0xb9, 0x8a,
+ 0x73, 0x03, 0xd9, 0x9b, 0x62, 0x24, 0xa8, 0xbe, 0x8a, 0x21, 0x24, 0x02, 0x98, 0x89, 0x99, 0x89,
+ 0x10, 0x12, 0x08, 0x88, 0x89, 0x30, 0x26, 0xd8, 0x9d, 0x71, 0x35, 0x81, 0xcb, 0x0a, 0x43, 0x82,
+ 0xcc, 0x8a, 0x63, 0x12, 0x80, 0x08, 0xb8, 0xbe, 0x8b, 0x42, 0x14, 0xa0, 0xbb, 0x28, 0x45, 0x83,
+ 0xeb, 0x9a, 0x42, 0x04, 0xa9, 0x9b, 0x11, 0x82, 0xb9, 0x18, 0x23, 0xb0, 0xad, 0x09, 0x80, 0xbb,
+ 0x0a, 0x02, 0xed, 0x0b, 0x46, 0x12, 0xba, 0x2a, 0x35, 0xc8, 0x9c, 0x41, 0x24, 0x80, 0xba, 0xcd,
+ 0x9b, 0x51, 0x24, 0x81, 0x89, 0x31, 0x33, 0x22, 0x03, 0xea, 0x9c, 0x40, 0x34, 0xa0, 0xa9, 0x88,
+ 0xdb, 0x9d, 0x28, 0x33, 0xb0, 0xbd, 0x2a, 0x45, 0x03, 0xda, 0xbd, 0x8a, 0x31, 0x33, 0xa0, 0xaa,
+ 0x52, 0x25, 0xc9, 0xad, 0x30, 0x25, 0x91, 0xa9, 0x18, 0x90, 0xdc, 0x8a, 0x52, 0x23, 0x98, 0xac,
+ 0x18, 0x43, 0x81, 0xba, 0xab, 0x10, 0x43, 0x23, 0xc8, 0xbd, 0x9a, 0x08, 0x32, 0x37, 0x92, 0xdd,
+ 0xab, 0x28, 0x33, 0x82, 0xba, 0x8b, 0x73, 0x25, 0x22, 0x21, 0x01, 0xfb, 0xad, 0x08, 0x23, 0x91,
+ 0xac, 0x18, 0x43, 0x23, 0xb8, 0xbe, 0x1b, 0x64, 0x02, 0xda, 0x9c, 0x08, 0x02, 0x98, 0x8a, 0x20,
+ 0x44, 0x01, 0xcb, 0xab, 0x41, 0x24, 0xa8, 0xaa, 0x18, 0x11, 0x20, 0x22, 0xc9, 0x9c, 0x73, 0x27,
+ 0x81, 0xba, 0x9a, 0x20, 0x03, 0xfb, 0xbc, 0x0a, 0x52, 0x13, 0xb9, 0xab, 0x51, 0x24, 0xb8, 0xac,
+ 0x09, 0x32, 0x23, 0x82, 0xec, 0xbb, 0x40, 0x14, 0xb8, 0x9c, 0x31, 0x35, 0x01, 0x80, 0xa9, 0xab,
+ 0x18, 0x23, 0x82, 0x90, 0xb9, 0xce, 0xbc, 0x9b, 0x50, 0x36, 0x83, 0xfb, 0xab, 0x28, 0x35, 0x03,
+ 0x7c, 0x01, 0x2a, 0x00, 0xbb, 0x0a, 0x11, 0xa8, 0x9c, 0x40, 0x24, 0xb8, 0x9c, 0x73, 0x23, 0xe9,
+ 0xac, 0x28, 0x45, 0x81, 0xaa, 0x0a, 0x43, 0x02, 0xca, 0x8b, 0x52, 0x92, 0xdc, 0xab, 0x41, 0x33,
+ 0x90, 0x9a, 0x41, 0x12, 0xda, 0xac, 0x30, 0x25, 0xa0, 0xbe, 0x8a, 0x43, 0x14, 0xb8, 0xab, 0x41,
+ 0x35, 0xa8, 0xbd, 0x19, 0x44, 0x12, 0xa9, 0xab, 0x20, 0x24, 0x81, 0xcb, 0x09, 0x43, 0x02, 0xaa,
+ 0xab, 0x99, 0xde, 0xad, 0x18, 0x44, 0x03, 0xb9, 0xbb, 0x0a, 0x33, 0x33, 0x03, 0x90, 0xba, 0xeb,
+ 0xab, 0x29, 0x46, 0x22, 0x88, 0x9a, 0xba, 0xab, 0x60, 0x36, 0x03, 0xca, 0x9b, 0x88, 0x88, 0x38,
+ 0x46, 0x13, 0xc9, 0xad, 0x1a, 0x42, 0x82, 0xdc, 0xab, 0x41, 0x24, 0xb0, 0xbc, 0x1a, 0x45, 0x12,
+ 0xa8, 0x9a, 0x41, 0x24, 0x81, 0xaa, 0x8a, 0x22, 0x13, 0xfa, 0xbc, 0x19, 0x53, 0x01, 0x9a, 0x09,
+ 0x01, 0xda, 0xac, 0x18, 0x11, 0xb9, 0x0b, 0x64, 0x25, 0x02, 0xb9, 0xad, 0x0a, 0x34, 0x83, 0xdc,
+ 0xbb, 0x18, 0x10, 0x11, 0x00, 0x88, 0x72, 0x35, 0x92, 0xcc, 0x89, 0x42, 0x22, 0x90, 0xbb, 0xab,
+ 0x28, 0x34, 0x80, 0x48, 0x45, 0xa0, 0xce, 0x0a, 0x63, 0x12, 0xc8, 0xac, 0x19, 0x33, 0x03, 0xc9,
+ 0x9b, 0x41, 0x34, 0x81, 0xcc, 0xab, 0x28, 0x43, 0x02, 0xa9, 0xba, 0x09, 0x64, 0x35, 0x01, 0xeb,
+ 0x9b, 0x30, 0x33, 0xd8, 0xbc, 0x1a, 0x44, 0x01, 0xba, 0x09, 0x42, 0x02, 0xa8, 0xba, 0x9b, 0x41,
+ 0x25, 0xc0, 0xbd, 0x0a, 0x43, 0x02, 0xa8, 0xaa, 0x31, 0x36, 0x91, 0xba, 0x49, 0x45, 0x81, 0xdb,
+ 0xcb, 0x99, 0x10, 0x00, 0x98, 0x29, 0x55, 0x22, 0xb9, 0xbd, 0x89, 0x31, 0x02, 0xda, 0xbb, 0x19,
+ 0x42, 0x34, 0x25, 0x91, 0xbc, 0x29, 0x34, 0x91, 0xbc, 0x19, 0x32, 0x80, 0x9a, 0xa8, 0xbb, 0x40,
+ 0xb0, 0x02, 0x1a, 0x00, 0x05, 0xec, 0x0a, 0x64, 0x22, 0xa8, 0xab, 0x09, 0x32, 0xb0, 0xcf, 0x8a,
+ 0x20, 0x98, 0x8a, 0x46, 0x13, 0xca, 0x9b, 0x31, 0x91, 0xdc, 0x9b, 0x31, 0x35, 0xb0, 0xcd, 0x38,
+ 0x36, 0x91, 0xcc, 0x89, 0x22, 0x23, 0x98, 0xca, 0x9a, 0x53, 0x25, 0x90, 0xcb, 0xaa, 0x8a, 0x10,
+ 0x34, 0x23, 0xa8, 0xbd, 0x8a, 0x63, 0x12, 0xba, 0x8b, 0x32, 0xc0, 0xbd, 0x40, 0x35, 0x81, 0xba,
+ 0xaa, 0x48, 0x56, 0x02, 0xea, 0xab, 0x31, 0x24, 0xa0, 0xbb, 0x09, 0x22, 0x90, 0xcc, 0x9a, 0x31,
+ 0x02, 0xcb, 0x09, 0x34, 0x03, 0x98, 0xb9, 0xde, 0xac, 0x18, 0x21, 0x10, 0x22, 0xa1, 0xce, 0x09,
+ 0x55, 0x13, 0xa8, 0xac, 0x19, 0x45, 0x13, 0xa9, 0xbd, 0x8a, 0x21, 0x12, 0x88, 0x89, 0x31, 0x12,
+ 0xed, 0xad, 0x09, 0x34, 0x03, 0xda, 0x9a, 0x52, 0x13, 0xa8, 0xac, 0x18, 0x23, 0x02, 0xca, 0x09,
+ 0x53, 0xa2, 0xcf, 0x8b, 0x42, 0x13, 0xb9, 0x9c, 0x20, 0x34, 0x82, 0xca, 0x0b, 0x73, 0x23, 0xca,
+ 0x9c, 0x10, 0x02, 0xba, 0x09, 0x33, 0xd8, 0xbe, 0x09, 0x11, 0x88, 0x30, 0x25, 0xa8, 0x9b, 0x64,
+ 0x33, 0xa1, 0xeb, 0xab, 0x19, 0x45, 0x01, 0xca, 0x09, 0x43, 0x02, 0xca, 0x8a, 0x52, 0x34, 0x82,
+ 0xcb, 0x09, 0x34, 0x82, 0xdb, 0x8a, 0x21, 0xa0, 0xab, 0x48, 0x37, 0x03, 0xdb, 0x9b, 0x41, 0x12,
+ 0xda, 0x9c, 0x08, 0x33, 0x13, 0xa8, 0xac, 0x30, 0x36, 0xa1, 0xcd, 0x8a, 0x62, 0x24, 0xa8, 0xcb,
+ 0x19, 0x24, 0x90, 0xcb, 0x08, 0x22, 0x02, 0x90, 0xaa, 0x8a, 0x32, 0x91, 0xdc, 0x08, 0x23, 0xfa,
+ 0xab, 0x51, 0x25, 0x81, 0xaa, 0x9b, 0x99, 0xaa, 0x29, 0x47, 0x03, 0xdb, 0x8b, 0x41, 0x03, 0xc9,
+ 0x9b, 0x51, 0x24, 0xa0, 0xcc, 0x09, 0x42, 0x22, 0x90, 0xa9, 0x9a, 0x10, 0x33, 0xda, 0xad, 0x38,
+ 0x5d, 0x01, 0x21, 0x00, 0x83, 0xba, 0x0a, 0x81, 0x28, 0x77, 0x15, 0xb8, 0xbc, 0x0a, 0x32, 0x01,
+ 0x88, 0x01, 0xa1, 0xdc, 0x0b,
+};
@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define OUCH_BITS_PER_SAMPLE 4
+#define OUCH_SAMPLE_RATE 32000
+#define OUCH_SAMPLES 15184
+#define OUCH_BYTES 7717
+
+extern const uint8_t ouch[OUCH_BYTES];
@@ -0,0 +1,1574 @@
+
+#include <stdint.h>
+
+const uint8_t pacmanDeath[] = {
+ 0x4c, 0x53, 0x4e, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x3f, 0xc1, 0x00, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0x99, 0x32, 0xa0, 0x19, 0x44, 0xb0, 0xbc, 0x2a, 0x24, 0xa1, 0xcb, 0xa9,
+ 0xcb, 0x39, 0x77, 0x13, 0xa0, 0xbc, 0x8a, 0x22, 0x92, 0xcb, 0x19, 0x52, 0x43, 0xa0, 0xbd, 0x0a,
+ 0x01, 0x99, 0x53, 0x83, 0x08, 0x35, 0xc0, 0x8c, 0x22, 0xeb, 0x9c, 0x20, 0x11, 0x11, 0x21, 0x72,
+ 0x14, 0xc9, 0x9c, 0xa9, 0x99, 0x41, 0x92, 0xbd, 0x9a, 0x99, 0x38, 0x27, 0x01, 0x89, 0x00, 0x10,
+ 0x81, 0xbd, 0x49, 0x14, 0xcc, 0x50, 0x25, 0x81, 0x10, 0xa0, 0xbd, 0x0a, 0xb9, 0x9b, 0x63, 0x23,
+ 0x81, 0x99, 0x28, 0x04, 0xee, 0x9b, 0x10, 0x10, 0x64, 0x13, 0xb9, 0x9b, 0x10, 0x11, 0x31, 0xb2,
+ 0xef, 0xab, 0x20, 0x34, 0x90, 0x9a, 0x88, 0x09, 0x66, 0x03, 0xc9, 0x8a, 0x00, 0x08, 0x53, 0xb1,
+ 0xbf, 0x19, 0x12, 0x88, 0x20, 0x92, 0xbe, 0x1b, 0x34, 0x82, 0xbb, 0x28, 0x37, 0x03, 0xc9, 0x19,
+ 0x36, 0x93, 0xdc, 0x9c, 0x08, 0x22, 0x01, 0x99, 0x28, 0x82, 0xbb, 0x58, 0x15, 0xa0, 0x9c, 0x10,
+ 0x02, 0x99, 0x51, 0x25, 0xd9, 0xac, 0x10, 0x13, 0x01, 0x80, 0x99, 0xa9, 0x30, 0x67, 0x91, 0xcc,
+ 0x9a, 0x18, 0x11, 0x01, 0x88, 0xa0, 0xce, 0x49, 0x16, 0xb9, 0x49, 0x05, 0xcd, 0x68, 0x03, 0xcd,
+ 0x58, 0x14, 0xec, 0x58, 0x67, 0x13, 0x98, 0xab, 0x18, 0x43, 0x23, 0x12, 0x88, 0x18, 0x54, 0x13,
+ 0xfa, 0xcd, 0xbb, 0x8a, 0x10, 0x02, 0x80, 0x80, 0x32, 0x55, 0x23, 0x90, 0xda, 0xab, 0x19, 0x43,
+ 0x34, 0x02, 0x90, 0x20, 0x53, 0x23, 0xf9, 0xcd, 0xac, 0x99, 0x01, 0x02, 0x00, 0x08, 0x30, 0x44,
+ 0x33, 0x92, 0xdb, 0xac, 0x08, 0x42, 0x24, 0x12, 0x88, 0x08, 0x53, 0x22, 0xd9, 0xcf, 0xbb, 0x8a,
+ 0x10, 0x11, 0x00, 0x88, 0x30, 0x54, 0x24, 0x81, 0xbb, 0xad, 0x0a, 0x32, 0x26, 0x12, 0x98, 0x18,
+ 0x6b, 0x3a, 0x3c, 0x00, 0x44, 0x81, 0xec, 0xcc, 0xaa, 0x08, 0x11, 0x01, 0x80, 0x08, 0x42, 0x53,
+ 0x13, 0xb8, 0xcc, 0x9a, 0x28, 0x34, 0x24, 0x81, 0x88, 0x30, 0x44, 0x01, 0xfc, 0xcc, 0xaa, 0x09,
+ 0x10, 0x02, 0x88, 0x18, 0x42, 0x44, 0x13, 0xa8, 0xdb, 0x9a, 0x28, 0x34, 0x34, 0x00, 0x88, 0x30,
+ 0x44, 0x02, 0xfb, 0xbe, 0xac, 0x88, 0x11, 0x01, 0x80, 0x08, 0x42, 0x34, 0x14, 0xa0, 0xcb, 0xaa,
+ 0x28, 0x35, 0x24, 0x01, 0x89, 0x20, 0x44, 0x02, 0xfa, 0xcd, 0xaa, 0x89, 0x11, 0x01, 0x80, 0x08,
+ 0x42, 0x34, 0x24, 0xa0, 0xdb, 0x9b, 0x18, 0x34, 0x24, 0x01, 0x88, 0x20, 0x44, 0x12, 0xfb, 0xbe,
+ 0xbb, 0x0a, 0x20, 0x11, 0x90, 0x00, 0x51, 0x34, 0x14, 0x90, 0xcb, 0x9c, 0x18, 0x43, 0x33, 0x02,
+ 0x88, 0x20, 0x45, 0x12, 0xfb, 0xcd, 0xbb, 0x0a, 0x10, 0x12, 0x80, 0x08, 0x42, 0x44, 0x33, 0x90,
+ 0xcc, 0xaa, 0x19, 0x34, 0x25, 0x11, 0x88, 0x18, 0x34, 0x13, 0xf9, 0xce, 0xba, 0x89, 0x20, 0x11,
+ 0x00, 0x08, 0x31, 0x45, 0x23, 0x81, 0xbc, 0xac, 0x08, 0x53, 0x43, 0x01, 0x90, 0x00, 0x53, 0x12,
+ 0xe9, 0xcd, 0xac, 0x89, 0x10, 0x01, 0x00, 0x08, 0x30, 0x54, 0x32, 0x80, 0xdb, 0xab, 0x19, 0x43,
+ 0x34, 0x02, 0x90, 0x18, 0x63, 0x23, 0xe9, 0xcd, 0xac, 0x89, 0x10, 0x11, 0x81, 0x88, 0x21, 0x35,
+ 0x24, 0x81, 0xcb, 0xac, 0x89, 0x42, 0x43, 0x22, 0x88, 0x08, 0x41, 0x34, 0x91, 0xdf, 0xbc, 0xab,
+ 0x08, 0x11, 0x02, 0x80, 0x08, 0x52, 0x44, 0x13, 0x90, 0xcb, 0xbb, 0x09, 0x44, 0x34, 0x02, 0x80,
+ 0x08, 0x43, 0x24, 0xb0, 0xef, 0xcb, 0x9a, 0x18, 0x11, 0x01, 0x08, 0x00, 0x43, 0x44, 0x22, 0xa8,
+ 0xdb, 0x9b, 0x10, 0x44, 0x23, 0x02, 0x89, 0x28, 0x44, 0x23, 0xe9, 0xbe, 0xad, 0x8a, 0x00, 0x12,
+ 0x90, 0xd3, 0x43, 0x00, 0x80, 0x08, 0x41, 0x43, 0x14, 0x91, 0xca, 0xab, 0x09, 0x52, 0x24, 0x12,
+ 0x80, 0x08, 0x32, 0x35, 0xa0, 0xef, 0xcb, 0x9b, 0x08, 0x21, 0x01, 0x88, 0x00, 0x52, 0x53, 0x22,
+ 0x98, 0xbc, 0x9c, 0x18, 0x43, 0x24, 0x11, 0x88, 0x18, 0x53, 0x13, 0xd8, 0xde, 0xbb, 0x8b, 0x18,
+ 0x12, 0x01, 0x88, 0x20, 0x54, 0x43, 0x12, 0xa9, 0xbc, 0xab, 0x21, 0x55, 0x22, 0x01, 0x88, 0x20,
+ 0x34, 0x03, 0xfa, 0xce, 0xab, 0x8a, 0x10, 0x12, 0x00, 0x88, 0x21, 0x54, 0x24, 0x02, 0xc9, 0xbb,
+ 0x8b, 0x32, 0x36, 0x23, 0x81, 0x88, 0x40, 0x34, 0x93, 0xfd, 0xbc, 0xac, 0x09, 0x20, 0x01, 0x80,
+ 0x88, 0x41, 0x53, 0x23, 0x81, 0xcb, 0xbc, 0x89, 0x52, 0x43, 0x12, 0x81, 0x08, 0x41, 0x33, 0x91,
+ 0xdf, 0xcc, 0x9b, 0x19, 0x11, 0x01, 0x88, 0x08, 0x42, 0x44, 0x23, 0x90, 0xeb, 0x9b, 0x19, 0x43,
+ 0x24, 0x02, 0x90, 0x00, 0x43, 0x24, 0xc0, 0xed, 0xac, 0x9b, 0x18, 0x11, 0x01, 0x88, 0x10, 0x53,
+ 0x34, 0x13, 0xa0, 0xbd, 0xab, 0x18, 0x45, 0x33, 0x01, 0x88, 0x28, 0x63, 0x22, 0xd9, 0xce, 0xac,
+ 0x8a, 0x18, 0x12, 0x81, 0x80, 0x10, 0x63, 0x43, 0x11, 0xa9, 0xbc, 0x8b, 0x30, 0x45, 0x13, 0x01,
+ 0x88, 0x20, 0x44, 0x02, 0xfb, 0xbd, 0xad, 0x89, 0x10, 0x02, 0x00, 0x88, 0x21, 0x44, 0x43, 0x01,
+ 0xba, 0xbc, 0x8b, 0x42, 0x44, 0x22, 0x80, 0x88, 0x30, 0x35, 0x92, 0xed, 0xcc, 0xab, 0x09, 0x20,
+ 0x11, 0x80, 0x88, 0x21, 0x45, 0x33, 0x03, 0xd9, 0xcb, 0x9a, 0x20, 0x44, 0x33, 0x11, 0x89, 0x10,
+ 0x44, 0x14, 0xc8, 0xde, 0xbb, 0x9b, 0x18, 0x12, 0x11, 0x88, 0x18, 0x53, 0x35, 0x33, 0x90, 0xdb,
+ 0xbb, 0x09, 0x52, 0x34, 0x22, 0x80, 0x08, 0x31, 0x36, 0x82, 0xec, 0xcd, 0xab, 0x89, 0x10, 0x12,
+ 0xdb, 0xd7, 0x41, 0x00, 0x80, 0x08, 0x42, 0x44, 0x23, 0x80, 0xdb, 0xbb, 0x0a, 0x52, 0x43, 0x22,
+ 0x80, 0x88, 0x31, 0x44, 0x02, 0xfb, 0xce, 0xba, 0x89, 0x10, 0x11, 0x80, 0x08, 0x28, 0x63, 0x34,
+ 0x22, 0xa8, 0xcc, 0x9a, 0x18, 0x44, 0x33, 0x02, 0x88, 0x18, 0x52, 0x23, 0xb0, 0xff, 0xbb, 0xab,
+ 0x09, 0x12, 0x02, 0x80, 0x08, 0x51, 0x44, 0x23, 0x01, 0xda, 0xbb, 0x9a, 0x42, 0x35, 0x22, 0x81,
+ 0x88, 0x20, 0x35, 0x13, 0xfa, 0xce, 0xbb, 0x9a, 0x10, 0x12, 0x01, 0x88, 0x10, 0x54, 0x43, 0x13,
+ 0x98, 0xcc, 0xaa, 0x08, 0x53, 0x33, 0x13, 0x90, 0x08, 0x52, 0x24, 0x91, 0xed, 0xbd, 0xab, 0x09,
+ 0x21, 0x11, 0x80, 0x08, 0x41, 0x44, 0x33, 0x02, 0xca, 0xbc, 0x8b, 0x30, 0x45, 0x23, 0x01, 0x88,
+ 0x10, 0x44, 0x23, 0xd9, 0xcf, 0xcb, 0x9a, 0x00, 0x12, 0x00, 0x80, 0x18, 0x52, 0x34, 0x23, 0xa0,
+ 0xdb, 0xac, 0x08, 0x42, 0x43, 0x12, 0x90, 0x88, 0x32, 0x35, 0x82, 0xfd, 0xbc, 0xac, 0x89, 0x11,
+ 0x11, 0x00, 0x88, 0x20, 0x35, 0x25, 0x12, 0xb9, 0xcc, 0x9a, 0x30, 0x34, 0x24, 0x02, 0x98, 0x10,
+ 0x53, 0x33, 0xc8, 0xdf, 0xac, 0x8b, 0x08, 0x21, 0x01, 0x88, 0x00, 0x42, 0x35, 0x23, 0x81, 0xdb,
+ 0xac, 0x09, 0x41, 0x43, 0x22, 0x80, 0x88, 0x31, 0x44, 0x02, 0xfb, 0xbe, 0xac, 0x8a, 0x20, 0x11,
+ 0x00, 0x09, 0x10, 0x63, 0x43, 0x12, 0xb8, 0xcc, 0xaa, 0x10, 0x53, 0x33, 0x12, 0x89, 0x08, 0x44,
+ 0x33, 0xb0, 0xef, 0xbc, 0xaa, 0x08, 0x11, 0x12, 0x00, 0x08, 0x31, 0x46, 0x23, 0x82, 0xc9, 0xbc,
+ 0xaa, 0x30, 0x44, 0x43, 0x01, 0x88, 0x08, 0x42, 0x24, 0x91, 0xed, 0xcc, 0xab, 0x89, 0x20, 0x21,
+ 0x80, 0x88, 0x20, 0x44, 0x44, 0x12, 0x98, 0xcb, 0xac, 0x08, 0x32, 0x35, 0x23, 0x80, 0x89, 0x31,
+ 0x31, 0x2f, 0x38, 0x00, 0x26, 0x90, 0xde, 0xbd, 0xab, 0x09, 0x20, 0x21, 0x00, 0x88, 0x20, 0x45,
+ 0x24, 0x13, 0x98, 0xcc, 0xba, 0x08, 0x53, 0x24, 0x22, 0x80, 0x89, 0x31, 0x35, 0x03, 0xfb, 0xce,
+ 0xab, 0x9a, 0x10, 0x21, 0x01, 0x88, 0x00, 0x52, 0x44, 0x23, 0x80, 0xca, 0xbc, 0x8a, 0x41, 0x53,
+ 0x22, 0x01, 0x98, 0x00, 0x63, 0x22, 0xc0, 0xdd, 0xbc, 0xab, 0x09, 0x21, 0x12, 0x80, 0x88, 0x21,
+ 0x46, 0x43, 0x02, 0xa8, 0xbd, 0xaa, 0x28, 0x53, 0x24, 0x12, 0x88, 0x09, 0x32, 0x26, 0x82, 0xfb,
+ 0xbe, 0xac, 0x89, 0x10, 0x12, 0x00, 0x08, 0x18, 0x42, 0x35, 0x23, 0x91, 0xbc, 0xad, 0x09, 0x41,
+ 0x43, 0x23, 0x00, 0x89, 0x20, 0x44, 0x13, 0xd8, 0xde, 0xcb, 0x9a, 0x08, 0x12, 0x01, 0x80, 0x08,
+ 0x31, 0x45, 0x33, 0x02, 0xca, 0xcc, 0x9a, 0x20, 0x53, 0x23, 0x12, 0x98, 0x08, 0x52, 0x24, 0xa1,
+ 0xed, 0xbd, 0xbb, 0x89, 0x21, 0x21, 0x00, 0x00, 0x20, 0x54, 0x34, 0x13, 0xa0, 0xdb, 0xab, 0x19,
+ 0x53, 0x34, 0x12, 0x80, 0x89, 0x30, 0x45, 0x12, 0xea, 0xdd, 0xbb, 0x9a, 0x18, 0x22, 0x01, 0x88,
+ 0x08, 0x52, 0x35, 0x33, 0x81, 0xcb, 0xad, 0x8a, 0x20, 0x35, 0x24, 0x81, 0x88, 0x18, 0x43, 0x24,
+ 0xb0, 0xdf, 0xbc, 0xab, 0x08, 0x21, 0x11, 0x00, 0x88, 0x30, 0x45, 0x34, 0x12, 0xa8, 0xbd, 0x9b,
+ 0x18, 0x63, 0x33, 0x13, 0x88, 0x88, 0x42, 0x34, 0x03, 0xfc, 0xcd, 0xab, 0x8a, 0x10, 0x21, 0x81,
+ 0x80, 0x00, 0x53, 0x44, 0x32, 0x90, 0xda, 0xbb, 0x89, 0x41, 0x44, 0x22, 0x00, 0x89, 0x10, 0x44,
+ 0x13, 0xd8, 0xdd, 0xbc, 0x9a, 0x88, 0x21, 0x11, 0x00, 0x88, 0x21, 0x44, 0x25, 0x13, 0x90, 0xcc,
+ 0xab, 0x0a, 0x41, 0x35, 0x22, 0x01, 0x99, 0x28, 0x63, 0x23, 0xa0, 0xcf, 0xbd, 0xac, 0x89, 0x11,
+ 0x6a, 0xcb, 0x44, 0x00, 0x11, 0x88, 0x80, 0x21, 0x44, 0x24, 0x13, 0xb8, 0xcc, 0xab, 0x19, 0x53,
+ 0x34, 0x12, 0x80, 0x98, 0x20, 0x44, 0x33, 0xc8, 0xee, 0xcb, 0xaa, 0x08, 0x11, 0x02, 0x81, 0x88,
+ 0x10, 0x44, 0x34, 0x23, 0x90, 0xcc, 0xac, 0x89, 0x31, 0x44, 0x32, 0x81, 0x98, 0x18, 0x62, 0x23,
+ 0xa2, 0xde, 0xbd, 0xac, 0x89, 0x10, 0x12, 0x00, 0x98, 0x00, 0x52, 0x34, 0x24, 0x82, 0xb9, 0xbd,
+ 0x9a, 0x20, 0x45, 0x23, 0x12, 0x88, 0x08, 0x31, 0x44, 0x02, 0xfb, 0xdd, 0xbb, 0x9a, 0x18, 0x12,
+ 0x02, 0x80, 0x08, 0x31, 0x55, 0x43, 0x02, 0xa8, 0xcc, 0xaa, 0x19, 0x42, 0x44, 0x12, 0x80, 0x89,
+ 0x20, 0x53, 0x22, 0xc8, 0xcf, 0xbc, 0x9b, 0x08, 0x11, 0x12, 0x80, 0x80, 0x28, 0x54, 0x34, 0x13,
+ 0xa1, 0xeb, 0xbb, 0x09, 0x41, 0x34, 0x23, 0x01, 0x98, 0x18, 0x54, 0x23, 0xa1, 0xee, 0xbc, 0xbb,
+ 0x89, 0x20, 0x22, 0x01, 0x98, 0x10, 0x62, 0x44, 0x23, 0x81, 0xca, 0xbc, 0x9a, 0x21, 0x44, 0x33,
+ 0x12, 0x90, 0x09, 0x52, 0x34, 0x82, 0xfb, 0xce, 0xab, 0x9a, 0x18, 0x12, 0x11, 0x08, 0x08, 0x31,
+ 0x46, 0x33, 0x03, 0xb9, 0xbe, 0xab, 0x08, 0x63, 0x43, 0x12, 0x80, 0x98, 0x20, 0x44, 0x12, 0xc8,
+ 0xde, 0xbc, 0xaa, 0x09, 0x12, 0x12, 0x00, 0x88, 0x20, 0x54, 0x34, 0x13, 0xa0, 0xeb, 0xab, 0x89,
+ 0x42, 0x34, 0x23, 0x01, 0x98, 0x18, 0x44, 0x24, 0x91, 0xde, 0xcc, 0xab, 0x09, 0x20, 0x11, 0x01,
+ 0x98, 0x10, 0x52, 0x35, 0x23, 0x91, 0xda, 0xac, 0x8a, 0x20, 0x44, 0x32, 0x02, 0x88, 0x89, 0x52,
+ 0x43, 0x82, 0xec, 0xbd, 0xbc, 0x8a, 0x18, 0x12, 0x11, 0x98, 0x08, 0x41, 0x35, 0x34, 0x12, 0xb8,
+ 0xbd, 0x9c, 0x10, 0x53, 0x24, 0x12, 0x88, 0x08, 0x31, 0x34, 0x81, 0xee, 0xcc, 0xab, 0x89, 0x10,
+ 0xbc, 0xcc, 0x43, 0x00, 0x11, 0x08, 0x88, 0x31, 0x45, 0x24, 0x01, 0xb8, 0xbd, 0x9a, 0x28, 0x44,
+ 0x24, 0x01, 0x88, 0x08, 0x41, 0x43, 0x91, 0xed, 0xbc, 0xac, 0x09, 0x10, 0x11, 0x01, 0x88, 0x28,
+ 0x63, 0x43, 0x13, 0xa0, 0xdb, 0x9c, 0x09, 0x42, 0x33, 0x23, 0x80, 0x98, 0x31, 0x46, 0x02, 0xd9,
+ 0xce, 0xcb, 0x99, 0x18, 0x11, 0x11, 0x88, 0x80, 0x32, 0x45, 0x24, 0x81, 0xba, 0xbc, 0x8b, 0x40,
+ 0x34, 0x24, 0x01, 0x88, 0x18, 0x52, 0x33, 0xb0, 0xdf, 0xbd, 0xab, 0x88, 0x21, 0x12, 0x80, 0x88,
+ 0x30, 0x54, 0x34, 0x12, 0xa8, 0xbd, 0xab, 0x29, 0x63, 0x33, 0x13, 0x88, 0x09, 0x41, 0x44, 0x01,
+ 0xfb, 0xcd, 0xbb, 0x99, 0x10, 0x22, 0x00, 0x80, 0x18, 0x62, 0x53, 0x23, 0x80, 0xcb, 0xac, 0x89,
+ 0x31, 0x35, 0x33, 0x81, 0x98, 0x10, 0x35, 0x24, 0xc0, 0xde, 0xbc, 0xaa, 0x08, 0x12, 0x02, 0x80,
+ 0x88, 0x41, 0x44, 0x33, 0x12, 0xba, 0xbe, 0x9b, 0x10, 0x44, 0x24, 0x02, 0x88, 0x88, 0x42, 0x43,
+ 0x81, 0xed, 0xcc, 0xab, 0x89, 0x10, 0x12, 0x81, 0x88, 0x18, 0x63, 0x34, 0x22, 0x90, 0xcc, 0xac,
+ 0x88, 0x42, 0x43, 0x12, 0x81, 0x08, 0x20, 0x44, 0x12, 0xd8, 0xce, 0xac, 0x9a, 0x08, 0x12, 0x01,
+ 0x88, 0x08, 0x41, 0x44, 0x24, 0x81, 0xb9, 0xbd, 0x9a, 0x21, 0x44, 0x33, 0x02, 0x98, 0x08, 0x63,
+ 0x33, 0xa0, 0xdf, 0xbc, 0xac, 0x88, 0x11, 0x02, 0x81, 0x88, 0x20, 0x44, 0x34, 0x13, 0xa8, 0xcc,
+ 0xbb, 0x18, 0x53, 0x43, 0x12, 0x80, 0x88, 0x31, 0x35, 0x03, 0xfb, 0xce, 0xbb, 0x99, 0x10, 0x21,
+ 0x01, 0x08, 0x08, 0x52, 0x44, 0x23, 0x81, 0xcb, 0xbc, 0x89, 0x31, 0x35, 0x24, 0x01, 0x89, 0x28,
+ 0x53, 0x23, 0xc8, 0xde, 0xbc, 0xab, 0x09, 0x21, 0x12, 0x80, 0x88, 0x31, 0x46, 0x24, 0x02, 0xb9,
+ 0x8a, 0x03, 0x3e, 0x00, 0xbc, 0x08, 0x52, 0x24, 0x12, 0x80, 0x08, 0x31, 0x45, 0x81, 0xec, 0xcc,
+ 0xab, 0x0a, 0x20, 0x11, 0x00, 0x88, 0x21, 0x45, 0x43, 0x02, 0xa9, 0xbd, 0xaa, 0x30, 0x44, 0x33,
+ 0x02, 0x98, 0x18, 0x44, 0x23, 0xc0, 0xdf, 0xcb, 0xaa, 0x00, 0x11, 0x01, 0x80, 0x00, 0x42, 0x35,
+ 0x23, 0x81, 0xdb, 0xac, 0x09, 0x41, 0x43, 0x22, 0x00, 0x89, 0x31, 0x35, 0x02, 0xec, 0xbe, 0xac,
+ 0x0a, 0x10, 0x11, 0x00, 0x88, 0x10, 0x44, 0x34, 0x12, 0xb8, 0xbd, 0xab, 0x28, 0x44, 0x43, 0x01,
+ 0x90, 0x18, 0x42, 0x24, 0xa0, 0xdf, 0xbc, 0xab, 0x08, 0x22, 0x02, 0x80, 0x08, 0x42, 0x54, 0x33,
+ 0x81, 0xca, 0xcb, 0x89, 0x31, 0x44, 0x22, 0x81, 0x98, 0x21, 0x44, 0x03, 0xfa, 0xcd, 0xac, 0x8a,
+ 0x10, 0x11, 0x81, 0x80, 0x28, 0x52, 0x34, 0x13, 0xa0, 0xcc, 0xab, 0x19, 0x63, 0x33, 0x12, 0x88,
+ 0x08, 0x52, 0x33, 0xa1, 0xdf, 0xbd, 0xab, 0x89, 0x12, 0x02, 0x80, 0x80, 0x32, 0x55, 0x33, 0x02,
+ 0xca, 0xbc, 0x8a, 0x21, 0x45, 0x22, 0x01, 0x88, 0x28, 0x44, 0x12, 0xd8, 0xde, 0xbb, 0x9a, 0x00,
+ 0x22, 0x00, 0x80, 0x18, 0x53, 0x44, 0x23, 0x90, 0xbc, 0xac, 0x09, 0x43, 0x34, 0x12, 0x80, 0x09,
+ 0x32, 0x36, 0x81, 0xfc, 0xcc, 0xab, 0x89, 0x11, 0x11, 0x00, 0x88, 0x21, 0x54, 0x43, 0x02, 0xa9,
+ 0xbd, 0x9a, 0x20, 0x44, 0x23, 0x02, 0x98, 0x10, 0x44, 0x23, 0xc8, 0xdf, 0xcb, 0xaa, 0x00, 0x21,
+ 0x01, 0x88, 0x00, 0x32, 0x37, 0x23, 0x91, 0xdb, 0xbb, 0x09, 0x51, 0x34, 0x22, 0x80, 0x08, 0x31,
+ 0x44, 0x02, 0xfb, 0xbe, 0xac, 0x8a, 0x11, 0x11, 0x00, 0x88, 0x20, 0x44, 0x34, 0x02, 0xa8, 0xbd,
+ 0xaa, 0x18, 0x54, 0x32, 0x11, 0x88, 0x18, 0x52, 0x23, 0xb0, 0xff, 0xbb, 0xab, 0x08, 0x21, 0x01,
+ 0x3c, 0xd7, 0x3f, 0x00, 0x88, 0x20, 0x63, 0x34, 0x12, 0xa8, 0xbd, 0x9c, 0x10, 0x53, 0x23, 0x12,
+ 0x88, 0x10, 0x63, 0x22, 0xc9, 0xde, 0xcb, 0x99, 0x00, 0x11, 0x00, 0x88, 0x10, 0x44, 0x43, 0x02,
+ 0xb8, 0xcc, 0x9a, 0x21, 0x34, 0x24, 0x81, 0x88, 0x21, 0x44, 0x12, 0xfa, 0xcd, 0xac, 0x09, 0x10,
+ 0x01, 0x00, 0x88, 0x11, 0x44, 0x43, 0x81, 0xb9, 0xbc, 0x8a, 0x31, 0x36, 0x23, 0x80, 0x88, 0x32,
+ 0x35, 0x92, 0xde, 0xbd, 0xac, 0x09, 0x20, 0x11, 0x80, 0x08, 0x31, 0x45, 0x33, 0x91, 0xda, 0xbb,
+ 0x89, 0x53, 0x34, 0x12, 0x88, 0x08, 0x42, 0x24, 0x91, 0xdf, 0xbc, 0xaa, 0x08, 0x11, 0x02, 0x08,
+ 0x08, 0x43, 0x45, 0x22, 0x98, 0xcb, 0xab, 0x19, 0x63, 0x33, 0x03, 0x80, 0x18, 0x53, 0x23, 0xc0,
+ 0xdf, 0xbc, 0x9b, 0x00, 0x21, 0x81, 0x80, 0x10, 0x52, 0x44, 0x12, 0xa0, 0xcc, 0x9a, 0x28, 0x53,
+ 0x23, 0x02, 0x89, 0x10, 0x44, 0x13, 0xe9, 0xce, 0xbb, 0x8a, 0x10, 0x21, 0x00, 0x88, 0x21, 0x54,
+ 0x24, 0x02, 0xb8, 0xad, 0x9a, 0x21, 0x35, 0x33, 0x81, 0x88, 0x31, 0x45, 0x02, 0xfb, 0xcd, 0xbb,
+ 0x89, 0x11, 0x12, 0x08, 0x08, 0x30, 0x45, 0x24, 0x01, 0xca, 0xcb, 0x89, 0x41, 0x33, 0x14, 0x80,
+ 0x09, 0x31, 0x44, 0x91, 0xed, 0xcc, 0xaa, 0x88, 0x11, 0x11, 0x88, 0x08, 0x41, 0x34, 0x24, 0x91,
+ 0xca, 0xbb, 0x19, 0x53, 0x34, 0x13, 0x80, 0x00, 0x52, 0x33, 0xa0, 0xff, 0xcb, 0x9a, 0x08, 0x11,
+ 0x01, 0x88, 0x00, 0x42, 0x44, 0x22, 0xa0, 0xbc, 0x9c, 0x18, 0x53, 0x23, 0x02, 0x88, 0x10, 0x53,
+ 0x14, 0xc8, 0xcf, 0xbb, 0x9a, 0x18, 0x12, 0x01, 0x88, 0x20, 0x54, 0x24, 0x03, 0xb8, 0xbc, 0x9c,
+ 0x20, 0x44, 0x23, 0x01, 0x88, 0x20, 0x63, 0x12, 0xda, 0xbf, 0xbc, 0x89, 0x10, 0x11, 0x81, 0x80,
+ 0xf4, 0xda, 0x3e, 0x00, 0x32, 0x36, 0x14, 0x90, 0xcb, 0xab, 0x18, 0x53, 0x24, 0x02, 0x88, 0x18,
+ 0x43, 0x24, 0xc8, 0xce, 0xbc, 0x9b, 0x08, 0x12, 0x01, 0x08, 0x20, 0x54, 0x24, 0x02, 0xb9, 0xad,
+ 0x8a, 0x31, 0x35, 0x13, 0x81, 0x88, 0x52, 0x43, 0xa0, 0xcf, 0xbd, 0x9a, 0x08, 0x21, 0x00, 0x08,
+ 0x10, 0x63, 0x33, 0x13, 0xba, 0xbe, 0x8a, 0x31, 0x35, 0x14, 0x00, 0x09, 0x31, 0x34, 0xa2, 0xef,
+ 0xbc, 0xaa, 0x00, 0x11, 0x01, 0x80, 0x10, 0x53, 0x34, 0x13, 0xb9, 0xbd, 0x8b, 0x40, 0x34, 0x14,
+ 0x81, 0x88, 0x31, 0x34, 0x91, 0xdf, 0xcc, 0x9a, 0x08, 0x11, 0x10, 0x88, 0x18, 0x43, 0x25, 0x03,
+ 0xb8, 0xcc, 0x8a, 0x20, 0x44, 0x13, 0x81, 0x88, 0x31, 0x25, 0x91, 0xde, 0xbd, 0xab, 0x08, 0x21,
+ 0x00, 0x88, 0x10, 0x63, 0x53, 0x12, 0xa8, 0xcb, 0x9a, 0x30, 0x35, 0x24, 0x81, 0x88, 0x31, 0x34,
+ 0x92, 0xfd, 0xcc, 0xaa, 0x09, 0x21, 0x00, 0x08, 0x08, 0x43, 0x35, 0x12, 0xb0, 0xcc, 0x9a, 0x20,
+ 0x44, 0x23, 0x00, 0x09, 0x30, 0x35, 0x02, 0xed, 0xbd, 0x9c, 0x09, 0x11, 0x01, 0x88, 0x00, 0x42,
+ 0x34, 0x23, 0xa8, 0xbd, 0xab, 0x20, 0x45, 0x23, 0x81, 0x88, 0x31, 0x44, 0x82, 0xec, 0xcd, 0xaa,
+ 0x09, 0x11, 0x01, 0x80, 0x18, 0x42, 0x34, 0x14, 0x98, 0xdb, 0x9a, 0x18, 0x34, 0x34, 0x01, 0x98,
+ 0x21, 0x44, 0x02, 0xec, 0xcd, 0xaa, 0x09, 0x10, 0x11, 0x08, 0x18, 0x41, 0x44, 0x12, 0x90, 0xbc,
+ 0xab, 0x28, 0x54, 0x23, 0x82, 0x88, 0x20, 0x35, 0x12, 0xfc, 0xcc, 0xbb, 0x09, 0x11, 0x11, 0x80,
+ 0x08, 0x41, 0x35, 0x33, 0xa0, 0xcc, 0xab, 0x18, 0x54, 0x23, 0x01, 0x88, 0x28, 0x44, 0x02, 0xfa,
+ 0xcd, 0xba, 0x09, 0x10, 0x02, 0x00, 0x08, 0x31, 0x36, 0x24, 0x90, 0xcb, 0xaa, 0x19, 0x44, 0x33,
+ 0xaf, 0x24, 0x3f, 0x00, 0x00, 0x09, 0x42, 0x24, 0xa1, 0xdf, 0xbc, 0xaa, 0x18, 0x11, 0x01, 0x88,
+ 0x20, 0x44, 0x34, 0x02, 0xb9, 0xbd, 0x8a, 0x40, 0x53, 0x13, 0x80, 0x88, 0x41, 0x33, 0xa1, 0xef,
+ 0xbc, 0xab, 0x18, 0x21, 0x00, 0x88, 0x10, 0x54, 0x24, 0x01, 0xb9, 0xac, 0x0a, 0x53, 0x33, 0x13,
+ 0x80, 0x20, 0x44, 0x23, 0xfa, 0xce, 0xab, 0x89, 0x11, 0x01, 0x80, 0x18, 0x41, 0x35, 0x22, 0xb8,
+ 0xcc, 0x9a, 0x21, 0x35, 0x13, 0x81, 0x08, 0x42, 0x24, 0xb0, 0xef, 0xac, 0x8a, 0x18, 0x11, 0x80,
+ 0x80, 0x21, 0x44, 0x14, 0x81, 0xcb, 0xab, 0x18, 0x44, 0x23, 0x02, 0x88, 0x20, 0x35, 0x82, 0xed,
+ 0xbd, 0xab, 0x09, 0x12, 0x01, 0x08, 0x28, 0x44, 0x34, 0x12, 0xca, 0xcb, 0x89, 0x42, 0x24, 0x13,
+ 0x88, 0x18, 0x53, 0x13, 0xe9, 0xce, 0xbb, 0x89, 0x20, 0x11, 0x08, 0x08, 0x42, 0x35, 0x23, 0xa8,
+ 0xbd, 0x9b, 0x21, 0x45, 0x22, 0x81, 0x08, 0x31, 0x35, 0xa0, 0xdf, 0xbc, 0x9b, 0x00, 0x12, 0x00,
+ 0x88, 0x21, 0x45, 0x24, 0x80, 0xca, 0xab, 0x19, 0x53, 0x24, 0x01, 0x08, 0x28, 0x53, 0x02, 0xfb,
+ 0xbe, 0xab, 0x09, 0x21, 0x01, 0x88, 0x10, 0x44, 0x43, 0x12, 0xb9, 0xbd, 0x0a, 0x41, 0x34, 0x12,
+ 0x80, 0x18, 0x43, 0x24, 0xd9, 0xce, 0xac, 0x89, 0x10, 0x01, 0x80, 0x18, 0x31, 0x45, 0x22, 0xa0,
+ 0xdb, 0xaa, 0x20, 0x44, 0x22, 0x81, 0x88, 0x31, 0x35, 0xa1, 0xdf, 0xbc, 0x9b, 0x18, 0x11, 0x81,
+ 0x80, 0x20, 0x54, 0x33, 0x01, 0xdb, 0xbb, 0x09, 0x53, 0x24, 0x02, 0x80, 0x28, 0x35, 0x12, 0xfb,
+ 0xbe, 0x9c, 0x09, 0x11, 0x01, 0x80, 0x18, 0x42, 0x34, 0x12, 0xb9, 0xbd, 0x8b, 0x41, 0x34, 0x23,
+ 0x80, 0x08, 0x52, 0x24, 0xc8, 0xcf, 0xbb, 0x9a, 0x10, 0x12, 0x80, 0x00, 0x41, 0x35, 0x14, 0xa1,
+ 0x6c, 0x09, 0x40, 0x00, 0xbc, 0x89, 0x42, 0x34, 0x12, 0x90, 0x18, 0x53, 0x23, 0xe9, 0xce, 0xac,
+ 0x89, 0x11, 0x10, 0x80, 0x08, 0x32, 0x35, 0x14, 0xa0, 0xcb, 0x9b, 0x30, 0x44, 0x33, 0x00, 0x09,
+ 0x41, 0x34, 0xa0, 0xdf, 0xbc, 0x9b, 0x00, 0x12, 0x00, 0x08, 0x30, 0x45, 0x33, 0x81, 0xdb, 0xbb,
+ 0x18, 0x63, 0x23, 0x11, 0x88, 0x30, 0x44, 0x82, 0xee, 0xbc, 0x9a, 0x18, 0x11, 0x00, 0x08, 0x30,
+ 0x45, 0x23, 0x90, 0xbc, 0xab, 0x38, 0x45, 0x22, 0x81, 0x08, 0x41, 0x33, 0xc1, 0xef, 0xbb, 0x8a,
+ 0x10, 0x01, 0x00, 0x08, 0x42, 0x35, 0x13, 0xb8, 0xcc, 0x8a, 0x31, 0x35, 0x12, 0x80, 0x10, 0x53,
+ 0x22, 0xea, 0xce, 0xbb, 0x89, 0x11, 0x11, 0x08, 0x18, 0x63, 0x43, 0x02, 0xb9, 0xbc, 0x89, 0x43,
+ 0x34, 0x02, 0x80, 0x28, 0x44, 0x02, 0xfc, 0xcc, 0xaa, 0x08, 0x11, 0x81, 0x08, 0x20, 0x44, 0x33,
+ 0x91, 0xdb, 0xab, 0x29, 0x44, 0x33, 0x81, 0x88, 0x40, 0x34, 0xa1, 0xef, 0xcb, 0x9a, 0x10, 0x01,
+ 0x00, 0x08, 0x31, 0x45, 0x22, 0x90, 0xbc, 0x9a, 0x31, 0x36, 0x22, 0x80, 0x09, 0x42, 0x23, 0xe8,
+ 0xde, 0xab, 0x8a, 0x11, 0x01, 0x80, 0x18, 0x52, 0x34, 0x12, 0xb9, 0xbd, 0x89, 0x41, 0x34, 0x12,
+ 0x80, 0x18, 0x44, 0x02, 0xfb, 0xbe, 0xab, 0x09, 0x21, 0x10, 0x08, 0x10, 0x54, 0x33, 0x81, 0xca,
+ 0xac, 0x19, 0x43, 0x34, 0x01, 0x88, 0x30, 0x44, 0x91, 0xed, 0xbc, 0x9b, 0x18, 0x11, 0x81, 0x08,
+ 0x31, 0x36, 0x33, 0x90, 0xcc, 0x9b, 0x20, 0x44, 0x23, 0x81, 0x08, 0x42, 0x34, 0xc0, 0xcf, 0xbc,
+ 0x89, 0x10, 0x01, 0x80, 0x00, 0x41, 0x34, 0x23, 0xa9, 0xbe, 0x99, 0x41, 0x43, 0x12, 0x88, 0x10,
+ 0x43, 0x23, 0xfa, 0xbe, 0xbc, 0x09, 0x10, 0x01, 0x80, 0x10, 0x53, 0x24, 0x02, 0xc9, 0xcb, 0x09,
+ 0x56, 0xf1, 0x40, 0x00, 0x34, 0x13, 0x81, 0x08, 0x43, 0x24, 0xc0, 0xdf, 0xbb, 0x99, 0x11, 0x01,
+ 0x80, 0x00, 0x52, 0x34, 0x12, 0xb8, 0xbc, 0x8b, 0x42, 0x35, 0x12, 0x80, 0x28, 0x43, 0x14, 0xfa,
+ 0xbd, 0xac, 0x09, 0x11, 0x00, 0x80, 0x28, 0x63, 0x33, 0x01, 0xca, 0xac, 0x09, 0x43, 0x24, 0x02,
+ 0x88, 0x20, 0x34, 0x82, 0xee, 0xbd, 0xaa, 0x00, 0x11, 0x00, 0x88, 0x10, 0x53, 0x43, 0x03, 0xb8,
+ 0xcc, 0xaa, 0x10, 0x53, 0x24, 0x02, 0x88, 0x18, 0x52, 0x33, 0xb0, 0xef, 0xcb, 0x9a, 0x18, 0x11,
+ 0x01, 0x80, 0x88, 0x31, 0x45, 0x24, 0x80, 0xba, 0xbc, 0x8a, 0x42, 0x44, 0x22, 0x80, 0x89, 0x21,
+ 0x44, 0x02, 0xfa, 0xdc, 0xbb, 0x99, 0x10, 0x12, 0x01, 0x88, 0x28, 0x63, 0x34, 0x13, 0xa8, 0xbd,
+ 0xab, 0x18, 0x44, 0x24, 0x12, 0x88, 0x19, 0x42, 0x24, 0x90, 0xde, 0xcc, 0x9b, 0x09, 0x20, 0x01,
+ 0x00, 0x08, 0x21, 0x45, 0x24, 0x01, 0xba, 0xbc, 0x8a, 0x31, 0x45, 0x23, 0x00, 0x98, 0x21, 0x44,
+ 0x12, 0xe9, 0xdd, 0xbb, 0x9b, 0x10, 0x12, 0x02, 0x88, 0x18, 0x44, 0x44, 0x22, 0x90, 0xbc, 0xac,
+ 0x08, 0x43, 0x34, 0x12, 0x90, 0x88, 0x42, 0x34, 0x81, 0xed, 0xbd, 0xac, 0x88, 0x11, 0x01, 0x00,
+ 0x88, 0x20, 0x44, 0x34, 0x02, 0xc8, 0xcb, 0x9a, 0x30, 0x44, 0x23, 0x01, 0x98, 0x20, 0x53, 0x14,
+ 0xb8, 0xef, 0xbb, 0x9b, 0x18, 0x21, 0x01, 0x80, 0x18, 0x52, 0x44, 0x23, 0x90, 0xda, 0xab, 0x89,
+ 0x43, 0x44, 0x12, 0x80, 0x08, 0x30, 0x44, 0x01, 0xec, 0xbd, 0xbb, 0x8a, 0x11, 0x12, 0x81, 0x80,
+ 0x20, 0x55, 0x33, 0x13, 0xb9, 0xcd, 0xaa, 0x20, 0x53, 0x33, 0x11, 0x98, 0x10, 0x53, 0x24, 0xb8,
+ 0xdf, 0xcc, 0x9a, 0x08, 0x11, 0x01, 0x08, 0x08, 0x41, 0x53, 0x33, 0x81, 0xca, 0xbc, 0x09, 0x32,
+ 0x66, 0x06, 0x3c, 0x00, 0x35, 0x12, 0x98, 0x18, 0x42, 0x34, 0xa0, 0xef, 0xbc, 0xaa, 0x09, 0x21,
+ 0x11, 0x08, 0x88, 0x41, 0x44, 0x24, 0x81, 0xc9, 0xbb, 0x8a, 0x41, 0x44, 0x22, 0x00, 0x98, 0x20,
+ 0x44, 0x12, 0xea, 0xdd, 0xbb, 0x99, 0x10, 0x21, 0x00, 0x88, 0x10, 0x63, 0x34, 0x22, 0x98, 0xcc,
+ 0xab, 0x18, 0x63, 0x23, 0x12, 0x80, 0x88, 0x42, 0x34, 0x91, 0xee, 0xbc, 0xbb, 0x88, 0x21, 0x11,
+ 0x00, 0x08, 0x40, 0x44, 0x24, 0x02, 0xb9, 0xbd, 0x9a, 0x30, 0x44, 0x33, 0x12, 0x98, 0x19, 0x62,
+ 0x33, 0xa1, 0xdf, 0xcc, 0xaa, 0x09, 0x10, 0x12, 0x80, 0x80, 0x10, 0x44, 0x34, 0x22, 0xa8, 0xcc,
+ 0xab, 0x09, 0x53, 0x34, 0x22, 0x80, 0x89, 0x31, 0x45, 0x02, 0xeb, 0xcd, 0xbc, 0x99, 0x18, 0x12,
+ 0x01, 0x08, 0x08, 0x42, 0x54, 0x22, 0x81, 0xca, 0xcb, 0x89, 0x30, 0x35, 0x23, 0x82, 0x88, 0x28,
+ 0x63, 0x23, 0xb0, 0xef, 0xbc, 0xaa, 0x08, 0x20, 0x21, 0x80, 0x88, 0x21, 0x45, 0x34, 0x02, 0xb8,
+ 0xcc, 0xaa, 0x28, 0x53, 0x33, 0x12, 0x90, 0x08, 0x51, 0x34, 0x81, 0xfb, 0xbf, 0xbb, 0x8a, 0x20,
+ 0x21, 0x00, 0x80, 0x08, 0x53, 0x35, 0x33, 0x90, 0xcc, 0xcb, 0x89, 0x32, 0x35, 0x23, 0x01, 0x88,
+ 0x20, 0x44, 0x14, 0xb8, 0xdf, 0xcb, 0xaa, 0x18, 0x11, 0x02, 0x88, 0x88, 0x31, 0x55, 0x33, 0x01,
+ 0xc9, 0xbc, 0x9a, 0x20, 0x44, 0x24, 0x01, 0x90, 0x08, 0x33, 0x35, 0x91, 0xde, 0xbd, 0xac, 0x09,
+ 0x10, 0x02, 0x81, 0x08, 0x28, 0x53, 0x44, 0x12, 0x98, 0xcb, 0xbb, 0x19, 0x53, 0x34, 0x12, 0x91,
+ 0x88, 0x30, 0x45, 0x02, 0xe9, 0xcd, 0xac, 0x9a, 0x00, 0x21, 0x01, 0x88, 0x00, 0x42, 0x44, 0x23,
+ 0x01, 0xca, 0xbc, 0x9a, 0x21, 0x36, 0x23, 0x02, 0x98, 0x18, 0x63, 0x23, 0xb1, 0xef, 0xcb, 0xab,
+ 0x77, 0xbc, 0x46, 0x00, 0x00, 0x12, 0x01, 0x88, 0x18, 0x51, 0x53, 0x23, 0x80, 0xca, 0xcb, 0x8a,
+ 0x31, 0x35, 0x33, 0x82, 0x98, 0x10, 0x45, 0x23, 0xb8, 0xef, 0xbc, 0xaa, 0x88, 0x11, 0x12, 0x80,
+ 0x08, 0x30, 0x45, 0x24, 0x03, 0xb8, 0xcc, 0x9b, 0x18, 0x44, 0x33, 0x12, 0x88, 0x88, 0x42, 0x25,
+ 0x82, 0xec, 0xcd, 0xba, 0x89, 0x10, 0x11, 0x01, 0x80, 0x28, 0x53, 0x44, 0x22, 0x80, 0xcb, 0xac,
+ 0x0a, 0x42, 0x53, 0x12, 0x81, 0x98, 0x20, 0x53, 0x13, 0xd8, 0xbf, 0xbd, 0x9a, 0x08, 0x12, 0x11,
+ 0x88, 0x08, 0x31, 0x45, 0x43, 0x02, 0xa9, 0xcc, 0x9b, 0x19, 0x43, 0x34, 0x23, 0x90, 0x89, 0x30,
+ 0x45, 0x13, 0xd8, 0xdd, 0xbc, 0x9b, 0x09, 0x12, 0x12, 0x00, 0x80, 0x21, 0x54, 0x44, 0x12, 0x98,
+ 0xbc, 0xbb, 0x89, 0x43, 0x44, 0x22, 0x81, 0x88, 0x18, 0x53, 0x33, 0xa1, 0xef, 0xbc, 0xbb, 0x89,
+ 0x11, 0x12, 0x01, 0x88, 0x18, 0x44, 0x35, 0x14, 0x81, 0xba, 0xbd, 0x8a, 0x20, 0x35, 0x43, 0x11,
+ 0x88, 0x09, 0x42, 0x24, 0x82, 0xec, 0xcd, 0xbb, 0x9a, 0x10, 0x21, 0x02, 0x80, 0x08, 0x42, 0x45,
+ 0x33, 0x02, 0xb9, 0xbd, 0x9c, 0x18, 0x52, 0x43, 0x12, 0x80, 0x89, 0x21, 0x44, 0x12, 0xd8, 0xce,
+ 0xbc, 0x9b, 0x19, 0x21, 0x11, 0x00, 0x88, 0x20, 0x45, 0x34, 0x13, 0xa0, 0xeb, 0xbb, 0x09, 0x43,
+ 0x34, 0x23, 0x00, 0x89, 0x28, 0x44, 0x34, 0xa0, 0xcf, 0xbd, 0x9c, 0x89, 0x11, 0x11, 0x00, 0x88,
+ 0x00, 0x42, 0x35, 0x24, 0x80, 0xca, 0xcb, 0x99, 0x31, 0x34, 0x24, 0x02, 0x90, 0x88, 0x43, 0x35,
+ 0x81, 0xec, 0xbd, 0xbc, 0x99, 0x10, 0x21, 0x01, 0x80, 0x08, 0x42, 0x35, 0x34, 0x01, 0xb9, 0xbd,
+ 0xaa, 0x28, 0x44, 0x43, 0x12, 0x80, 0x88, 0x30, 0x35, 0x03, 0xf9, 0xcd, 0xbc, 0xaa, 0x08, 0x12,
+ 0x0c, 0xd7, 0x41, 0x00, 0x81, 0x80, 0x08, 0x43, 0x44, 0x24, 0x81, 0xba, 0xbd, 0x9a, 0x28, 0x44,
+ 0x33, 0x03, 0x80, 0x89, 0x32, 0x36, 0x03, 0xfb, 0xbf, 0xac, 0x8a, 0x00, 0x12, 0x01, 0x00, 0x08,
+ 0x22, 0x45, 0x34, 0x02, 0xb9, 0xcc, 0xab, 0x18, 0x53, 0x43, 0x12, 0x08, 0x89, 0x21, 0x44, 0x13,
+ 0xd9, 0xce, 0xbc, 0xab, 0x08, 0x21, 0x12, 0x80, 0x88, 0x21, 0x45, 0x34, 0x23, 0xa0, 0xcc, 0xbb,
+ 0x8a, 0x52, 0x43, 0x23, 0x82, 0x88, 0x18, 0x44, 0x14, 0x90, 0xde, 0xbc, 0xac, 0x89, 0x10, 0x12,
+ 0x01, 0x88, 0x10, 0x43, 0x35, 0x24, 0x01, 0xca, 0xbc, 0x9a, 0x21, 0x44, 0x33, 0x12, 0x90, 0x09,
+ 0x41, 0x35, 0x12, 0xea, 0xce, 0xcb, 0x9a, 0x88, 0x21, 0x12, 0x80, 0x08, 0x18, 0x34, 0x36, 0x14,
+ 0x81, 0xba, 0xad, 0x9b, 0x28, 0x44, 0x33, 0x22, 0x80, 0x8a, 0x31, 0x46, 0x12, 0xb0, 0xdf, 0xbc,
+ 0xab, 0x89, 0x11, 0x12, 0x01, 0x88, 0x18, 0x42, 0x55, 0x23, 0x02, 0xa9, 0xcc, 0xbb, 0x08, 0x34,
+ 0x44, 0x22, 0x81, 0x99, 0x10, 0x53, 0x23, 0x91, 0xee, 0xcc, 0xab, 0x9a, 0x10, 0x22, 0x11, 0x80,
+ 0x88, 0x31, 0x46, 0x24, 0x03, 0xa0, 0xdb, 0xbb, 0x0a, 0x32, 0x36, 0x33, 0x02, 0xa8, 0x18, 0x53,
+ 0x24, 0x12, 0xfb, 0xbe, 0xad, 0xaa, 0x18, 0x11, 0x02, 0x00, 0x88, 0x10, 0x63, 0x34, 0x23, 0x91,
+ 0xdb, 0xcb, 0x9a, 0x20, 0x44, 0x33, 0x12, 0x98, 0x89, 0x41, 0x44, 0x23, 0xc9, 0xcf, 0xbc, 0x9b,
+ 0x09, 0x21, 0x22, 0x00, 0x08, 0x08, 0x42, 0x36, 0x34, 0x01, 0xba, 0xbd, 0xbb, 0x18, 0x44, 0x34,
+ 0x22, 0x80, 0x98, 0x20, 0x44, 0x33, 0xa0, 0xef, 0xdb, 0xab, 0x89, 0x10, 0x21, 0x01, 0x80, 0x88,
+ 0x32, 0x46, 0x33, 0x13, 0xa9, 0xbd, 0xbc, 0x09, 0x42, 0x34, 0x33, 0x01, 0xa8, 0x08, 0x63, 0x24,
+ 0x52, 0x43, 0x3d, 0x00, 0xa8, 0xcf, 0xbd, 0xaa, 0x09, 0x10, 0x22, 0x00, 0x90, 0x00, 0x42, 0x35,
+ 0x25, 0x02, 0xa9, 0xad, 0xab, 0x19, 0x53, 0x24, 0x13, 0x01, 0x89, 0x18, 0x44, 0x23, 0x91, 0xdf,
+ 0xcc, 0xab, 0x8a, 0x18, 0x22, 0x11, 0x88, 0x08, 0x41, 0x44, 0x34, 0x12, 0xa0, 0xcc, 0xbb, 0x8a,
+ 0x52, 0x34, 0x22, 0x02, 0x99, 0x19, 0x53, 0x43, 0x01, 0xea, 0xce, 0xbc, 0x99, 0x08, 0x11, 0x12,
+ 0x80, 0x09, 0x20, 0x63, 0x34, 0x23, 0x90, 0xdb, 0xcb, 0x8a, 0x30, 0x35, 0x33, 0x23, 0x98, 0x89,
+ 0x42, 0x26, 0x12, 0xd8, 0xce, 0xbc, 0xaa, 0x09, 0x20, 0x22, 0x01, 0x88, 0x10, 0x53, 0x54, 0x32,
+ 0x81, 0xb9, 0xbd, 0xab, 0x18, 0x44, 0x43, 0x22, 0x80, 0x99, 0x20, 0x44, 0x32, 0x91, 0xfd, 0xcc,
+ 0xbb, 0x8a, 0x08, 0x22, 0x12, 0x80, 0x89, 0x20, 0x44, 0x35, 0x43, 0x81, 0xba, 0xcc, 0xab, 0x18,
+ 0x44, 0x33, 0x23, 0x02, 0xa8, 0x19, 0x45, 0x24, 0x01, 0xd9, 0xde, 0xbb, 0xab, 0x88, 0x21, 0x23,
+ 0x00, 0x89, 0x08, 0x52, 0x45, 0x33, 0x03, 0xb8, 0xcc, 0xac, 0x0a, 0x41, 0x43, 0x23, 0x12, 0x98,
+ 0x8a, 0x41, 0x35, 0x22, 0xb8, 0xef, 0xbc, 0xbb, 0x89, 0x10, 0x32, 0x01, 0x90, 0x08, 0x31, 0x55,
+ 0x34, 0x23, 0x90, 0xcb, 0xcc, 0x9a, 0x20, 0x53, 0x33, 0x13, 0x81, 0x99, 0x28, 0x45, 0x33, 0x90,
+ 0xde, 0xcd, 0xab, 0x9a, 0x00, 0x21, 0x22, 0x88, 0x08, 0x20, 0x62, 0x44, 0x14, 0x81, 0xa9, 0xcb,
+ 0xbb, 0x18, 0x53, 0x24, 0x23, 0x82, 0x98, 0x09, 0x53, 0x34, 0x02, 0xfa, 0xdd, 0xbb, 0xaa, 0x88,
+ 0x21, 0x22, 0x01, 0x98, 0x10, 0x32, 0x56, 0x34, 0x02, 0xa9, 0xdb, 0xbb, 0x8a, 0x52, 0x33, 0x34,
+ 0x12, 0x90, 0x8a, 0x41, 0x44, 0x22, 0xb8, 0xef, 0xcb, 0xab, 0x89, 0x10, 0x22, 0x02, 0x90, 0x08,
+ 0x6e, 0xdb, 0x3a, 0x00, 0x42, 0x54, 0x33, 0x83, 0xb9, 0xcc, 0xbb, 0x89, 0x53, 0x34, 0x32, 0x12,
+ 0x98, 0x09, 0x52, 0x43, 0x13, 0xd8, 0xcf, 0xbc, 0xaa, 0x89, 0x10, 0x22, 0x02, 0x88, 0x08, 0x32,
+ 0x46, 0x43, 0x13, 0x98, 0xbc, 0xad, 0x9a, 0x21, 0x34, 0x34, 0x22, 0x90, 0x99, 0x40, 0x34, 0x23,
+ 0xa1, 0xff, 0xdb, 0xab, 0x99, 0x10, 0x22, 0x11, 0x80, 0x08, 0x20, 0x54, 0x34, 0x33, 0x81, 0xcb,
+ 0xcc, 0xaa, 0x18, 0x34, 0x43, 0x32, 0x81, 0x99, 0x19, 0x54, 0x23, 0x01, 0xfa, 0xce, 0xbb, 0x9b,
+ 0x88, 0x22, 0x22, 0x80, 0x88, 0x10, 0x53, 0x45, 0x33, 0x02, 0xb9, 0xcc, 0xac, 0x09, 0x32, 0x35,
+ 0x23, 0x12, 0x98, 0x99, 0x62, 0x43, 0x11, 0xb8, 0xef, 0xcb, 0xab, 0x09, 0x10, 0x22, 0x01, 0x88,
+ 0x08, 0x32, 0x45, 0x35, 0x12, 0xa0, 0xca, 0xdb, 0x9a, 0x20, 0x34, 0x24, 0x22, 0x01, 0xa8, 0x08,
+ 0x53, 0x24, 0x12, 0xc9, 0xef, 0xbb, 0xab, 0x89, 0x10, 0x32, 0x12, 0x98, 0x08, 0x21, 0x54, 0x54,
+ 0x32, 0x81, 0xaa, 0xbc, 0xbc, 0x0a, 0x52, 0x43, 0x32, 0x02, 0x90, 0x8a, 0x31, 0x36, 0x13, 0x91,
+ 0xee, 0xdc, 0xab, 0x8a, 0x08, 0x21, 0x12, 0x00, 0x89, 0x10, 0x32, 0x55, 0x25, 0x12, 0x98, 0xbb,
+ 0xbd, 0x9a, 0x20, 0x44, 0x24, 0x22, 0x81, 0xa8, 0x19, 0x52, 0x24, 0x12, 0xd9, 0xde, 0xcb, 0xaa,
+ 0x88, 0x10, 0x22, 0x02, 0x98, 0x08, 0x30, 0x73, 0x53, 0x22, 0x81, 0xb9, 0xcc, 0xab, 0x09, 0x43,
+ 0x34, 0x23, 0x13, 0xa0, 0x9a, 0x41, 0x35, 0x23, 0xa1, 0xef, 0xcc, 0xab, 0x9a, 0x08, 0x21, 0x13,
+ 0x81, 0x88, 0x08, 0x42, 0x45, 0x34, 0x13, 0xa8, 0xcb, 0xac, 0x9b, 0x20, 0x36, 0x24, 0x22, 0x81,
+ 0x98, 0x19, 0x43, 0x24, 0x02, 0xe9, 0xde, 0xcb, 0xaa, 0x09, 0x10, 0x21, 0x02, 0x88, 0x08, 0x21,
+ 0x7b, 0xe4, 0x38, 0x00, 0x55, 0x43, 0x12, 0x98, 0xdb, 0xbb, 0x9a, 0x30, 0x45, 0x23, 0x23, 0x81,
+ 0xa9, 0x19, 0x45, 0x33, 0x01, 0xea, 0xde, 0xcb, 0xaa, 0x89, 0x11, 0x22, 0x02, 0x98, 0x08, 0x21,
+ 0x54, 0x34, 0x24, 0x00, 0xba, 0xbc, 0xad, 0x08, 0x43, 0x33, 0x24, 0x02, 0x90, 0x8a, 0x31, 0x36,
+ 0x23, 0xa0, 0xdf, 0xbd, 0xac, 0x99, 0x08, 0x12, 0x22, 0x80, 0x09, 0x10, 0x32, 0x46, 0x34, 0x02,
+ 0xa8, 0xcb, 0xbc, 0x9a, 0x30, 0x45, 0x32, 0x23, 0x00, 0xaa, 0x28, 0x54, 0x23, 0x01, 0xf9, 0xdd,
+ 0xcb, 0xaa, 0x88, 0x11, 0x12, 0x01, 0x98, 0x00, 0x31, 0x63, 0x44, 0x33, 0x80, 0xca, 0xcb, 0xab,
+ 0x09, 0x53, 0x34, 0x23, 0x12, 0x98, 0x8a, 0x41, 0x35, 0x23, 0xa8, 0xdf, 0xbd, 0xac, 0x8a, 0x08,
+ 0x22, 0x22, 0x80, 0x89, 0x10, 0x52, 0x44, 0x24, 0x02, 0xa8, 0xbb, 0xae, 0x9a, 0x31, 0x34, 0x24,
+ 0x23, 0x91, 0x99, 0x28, 0x54, 0x23, 0x81, 0xde, 0xcd, 0xab, 0x9a, 0x08, 0x21, 0x22, 0x80, 0x09,
+ 0x20, 0x52, 0x54, 0x33, 0x01, 0xba, 0xcd, 0xba, 0x19, 0x52, 0x33, 0x43, 0x11, 0x99, 0x08, 0x42,
+ 0x34, 0x13, 0xe9, 0xce, 0xbc, 0xaa, 0x88, 0x21, 0x21, 0x81, 0x98, 0x10, 0x42, 0x44, 0x44, 0x02,
+ 0xa8, 0xcb, 0xbb, 0x8b, 0x41, 0x35, 0x33, 0x23, 0x98, 0x8a, 0x51, 0x34, 0x22, 0xb0, 0xff, 0xbc,
+ 0xaa, 0x8a, 0x10, 0x31, 0x11, 0x88, 0x08, 0x21, 0x45, 0x44, 0x22, 0x90, 0xca, 0xcb, 0x9a, 0x28,
+ 0x35, 0x33, 0x23, 0x81, 0xa9, 0x38, 0x46, 0x13, 0x81, 0xfb, 0xbf, 0xac, 0x8a, 0x08, 0x21, 0x11,
+ 0x00, 0x88, 0x10, 0x42, 0x36, 0x24, 0x81, 0xa9, 0xcc, 0xaa, 0x19, 0x43, 0x24, 0x23, 0x02, 0x98,
+ 0x0a, 0x53, 0x34, 0x02, 0xd9, 0xcf, 0xbc, 0x9b, 0x89, 0x21, 0x22, 0x81, 0x98, 0x10, 0x41, 0x54,
+ 0x97, 0x07, 0x40, 0x00, 0x33, 0x80, 0xba, 0xcd, 0xab, 0x18, 0x53, 0x43, 0x22, 0x01, 0x99, 0x08,
+ 0x63, 0x23, 0x82, 0xfb, 0xbe, 0xad, 0xaa, 0x08, 0x21, 0x21, 0x00, 0x89, 0x10, 0x33, 0x46, 0x34,
+ 0x01, 0x99, 0xbc, 0xcb, 0x0a, 0x42, 0x34, 0x23, 0x03, 0x98, 0x89, 0x52, 0x34, 0x13, 0xc9, 0xdf,
+ 0xbc, 0xab, 0x09, 0x10, 0x22, 0x02, 0x98, 0x18, 0x31, 0x45, 0x35, 0x23, 0xa8, 0xdb, 0xcb, 0x9a,
+ 0x21, 0x34, 0x34, 0x22, 0x91, 0x8a, 0x20, 0x35, 0x24, 0x91, 0xee, 0xcc, 0xbb, 0x9a, 0x00, 0x22,
+ 0x12, 0x00, 0x08, 0x21, 0x44, 0x35, 0x24, 0x82, 0xaa, 0xcc, 0xab, 0x18, 0x53, 0x33, 0x33, 0x02,
+ 0xa9, 0x29, 0x54, 0x33, 0x12, 0xfb, 0xcf, 0xbb, 0xab, 0x08, 0x21, 0x22, 0x01, 0x89, 0x00, 0x53,
+ 0x35, 0x25, 0x12, 0xa9, 0xbc, 0xbc, 0x89, 0x42, 0x34, 0x32, 0x13, 0x98, 0x89, 0x52, 0x34, 0x12,
+ 0xb0, 0xff, 0xbc, 0x9b, 0x99, 0x11, 0x22, 0x01, 0x88, 0x18, 0x21, 0x55, 0x34, 0x12, 0x98, 0xcb,
+ 0xbc, 0x8a, 0x41, 0x43, 0x43, 0x11, 0x98, 0x08, 0x32, 0x35, 0x12, 0xfa, 0xcd, 0xbc, 0xaa, 0x08,
+ 0x21, 0x11, 0x01, 0x88, 0x28, 0x63, 0x44, 0x22, 0x81, 0xba, 0xae, 0x9a, 0x10, 0x34, 0x34, 0x12,
+ 0x88, 0x89, 0x30, 0x54, 0x23, 0xb8, 0xef, 0xac, 0xab, 0x89, 0x11, 0x12, 0x01, 0x98, 0x00, 0x42,
+ 0x45, 0x33, 0x02, 0xb9, 0xbe, 0xaa, 0x19, 0x43, 0x35, 0x22, 0x01, 0x89, 0x18, 0x44, 0x33, 0x90,
+ 0xdf, 0xcc, 0xbb, 0x99, 0x10, 0x21, 0x12, 0x08, 0x08, 0x31, 0x46, 0x43, 0x12, 0xa0, 0xdb, 0xbb,
+ 0x89, 0x51, 0x43, 0x23, 0x02, 0x98, 0x09, 0x52, 0x24, 0x02, 0xfa, 0xcd, 0xcb, 0x9a, 0x08, 0x21,
+ 0x11, 0x80, 0x88, 0x10, 0x34, 0x36, 0x23, 0x91, 0xdb, 0xac, 0x8b, 0x20, 0x35, 0x33, 0x13, 0x90,
+ 0xb7, 0x1c, 0x39, 0x00, 0x08, 0x54, 0x33, 0x81, 0xfc, 0xbd, 0xac, 0x9a, 0x10, 0x31, 0x11, 0x80,
+ 0x88, 0x31, 0x45, 0x43, 0x13, 0xa8, 0xdb, 0xcb, 0x8a, 0x31, 0x44, 0x33, 0x12, 0xa8, 0x88, 0x53,
+ 0x43, 0x02, 0xe9, 0xce, 0xac, 0xaa, 0x08, 0x21, 0x11, 0x80, 0x08, 0x10, 0x53, 0x44, 0x33, 0x91,
+ 0xda, 0xcb, 0x8a, 0x20, 0x53, 0x33, 0x13, 0x80, 0x99, 0x31, 0x45, 0x23, 0xc8, 0xdf, 0xcb, 0x9b,
+ 0x09, 0x10, 0x12, 0x01, 0x08, 0x18, 0x42, 0x45, 0x33, 0x01, 0xb9, 0xcd, 0xaa, 0x08, 0x43, 0x34,
+ 0x23, 0x81, 0x99, 0x10, 0x35, 0x24, 0x91, 0xfd, 0xbc, 0xac, 0x8a, 0x10, 0x12, 0x01, 0x80, 0x09,
+ 0x31, 0x45, 0x34, 0x12, 0xa0, 0xcc, 0xac, 0x09, 0x32, 0x34, 0x24, 0x01, 0x98, 0x08, 0x42, 0x34,
+ 0x02, 0xfc, 0xdc, 0xba, 0x9a, 0x18, 0x11, 0x12, 0x00, 0x09, 0x20, 0x54, 0x34, 0x23, 0x91, 0xdb,
+ 0xbc, 0x99, 0x20, 0x44, 0x24, 0x11, 0x88, 0x88, 0x31, 0x35, 0x12, 0xd9, 0xce, 0xad, 0xab, 0x08,
+ 0x11, 0x12, 0x00, 0x88, 0x10, 0x53, 0x44, 0x23, 0x02, 0xca, 0xad, 0x9a, 0x28, 0x53, 0x33, 0x12,
+ 0x80, 0x09, 0x40, 0x35, 0x02, 0xfa, 0xcd, 0xac, 0x9a, 0x18, 0x11, 0x11, 0x08, 0x89, 0x21, 0x45,
+ 0x24, 0x12, 0xa8, 0xcc, 0xab, 0x08, 0x42, 0x25, 0x13, 0x81, 0x08, 0x20, 0x53, 0x23, 0xc8, 0xde,
+ 0xbc, 0x9c, 0x09, 0x20, 0x11, 0x80, 0x88, 0x10, 0x63, 0x43, 0x23, 0x90, 0xdb, 0xac, 0x89, 0x21,
+ 0x35, 0x23, 0x02, 0x98, 0x18, 0x53, 0x24, 0x91, 0xed, 0xcc, 0xbb, 0x8a, 0x20, 0x21, 0x01, 0x88,
+ 0x18, 0x52, 0x44, 0x24, 0x81, 0xba, 0xbc, 0x9b, 0x20, 0x45, 0x23, 0x12, 0x88, 0x88, 0x41, 0x44,
+ 0x02, 0xfb, 0xcc, 0xac, 0x8a, 0x18, 0x11, 0x11, 0x08, 0x09, 0x31, 0x45, 0x34, 0x11, 0xa9, 0xcc,
+ 0xbc, 0xf0, 0x41, 0x00, 0x99, 0x21, 0x44, 0x23, 0x11, 0x98, 0x18, 0x42, 0x34, 0x92, 0xfc, 0xbd,
+ 0xac, 0x9a, 0x10, 0x21, 0x01, 0x80, 0x08, 0x41, 0x35, 0x34, 0x01, 0xb9, 0xbd, 0x9b, 0x18, 0x54,
+ 0x33, 0x12, 0x88, 0x09, 0x31, 0x36, 0x12, 0xea, 0xdd, 0xbc, 0x9a, 0x08, 0x21, 0x11, 0x80, 0x08,
+ 0x20, 0x45, 0x24, 0x13, 0xa8, 0xbc, 0x9d, 0x09, 0x42, 0x43, 0x22, 0x80, 0x89, 0x20, 0x44, 0x23,
+ 0xb0, 0xef, 0xbc, 0xaa, 0x09, 0x11, 0x12, 0x00, 0x88, 0x10, 0x44, 0x35, 0x22, 0x80, 0xdb, 0xbb,
+ 0x8a, 0x31, 0x36, 0x33, 0x02, 0x98, 0x08, 0x53, 0x25, 0x81, 0xdd, 0xcd, 0xba, 0x89, 0x00, 0x12,
+ 0x01, 0x88, 0x18, 0x41, 0x35, 0x24, 0x01, 0xb9, 0xbd, 0xab, 0x28, 0x44, 0x34, 0x02, 0x80, 0x08,
+ 0x32, 0x35, 0x03, 0xfa, 0xcd, 0xbc, 0x9a, 0x18, 0x21, 0x01, 0x80, 0x09, 0x21, 0x55, 0x33, 0x13,
+ 0xb8, 0xcd, 0xba, 0x08, 0x42, 0x44, 0x12, 0x81, 0x98, 0x20, 0x53, 0x13, 0xb0, 0xff, 0xbb, 0xab,
+ 0x09, 0x21, 0x12, 0x00, 0x88, 0x10, 0x54, 0x34, 0x33, 0x90, 0xeb, 0xbb, 0x8a, 0x32, 0x36, 0x23,
+ 0x02, 0x89, 0x08, 0x44, 0x24, 0x90, 0xed, 0xbc, 0xac, 0x89, 0x20, 0x11, 0x81, 0x08, 0x10, 0x63,
+ 0x53, 0x12, 0x90, 0xbc, 0xab, 0x09, 0x53, 0x43, 0x13, 0x00, 0x89, 0x31, 0x35, 0x03, 0xfa, 0xce,
+ 0xbb, 0x9a, 0x18, 0x12, 0x11, 0x88, 0x18, 0x52, 0x44, 0x33, 0x81, 0xca, 0xbc, 0x9a, 0x21, 0x45,
+ 0x23, 0x82, 0x98, 0x10, 0x53, 0x33, 0xa0, 0xff, 0xcb, 0xaa, 0x09, 0x11, 0x11, 0x80, 0x08, 0x20,
+ 0x45, 0x33, 0x13, 0xb8, 0xcd, 0x9b, 0x08, 0x53, 0x43, 0x12, 0x80, 0x09, 0x31, 0x44, 0x82, 0xfb,
+ 0xbe, 0xac, 0x99, 0x10, 0x12, 0x01, 0x88, 0x00, 0x52, 0x34, 0x33, 0x91, 0xdb, 0xac, 0x8a, 0x32,
+ 0xb3, 0x04, 0x3c, 0x00, 0x35, 0x12, 0x88, 0x09, 0x42, 0x34, 0x82, 0xfc, 0xcd, 0xab, 0x99, 0x11,
+ 0x11, 0x01, 0x88, 0x18, 0x43, 0x45, 0x13, 0x91, 0xdb, 0xbb, 0x0a, 0x42, 0x34, 0x14, 0x00, 0x99,
+ 0x30, 0x34, 0x14, 0xc9, 0xcf, 0xcb, 0x9a, 0x08, 0x21, 0x11, 0x00, 0x08, 0x41, 0x44, 0x33, 0x01,
+ 0xc9, 0xad, 0x8b, 0x20, 0x53, 0x33, 0x02, 0x88, 0x19, 0x53, 0x34, 0x90, 0xde, 0xbd, 0x9c, 0x89,
+ 0x10, 0x12, 0x00, 0x88, 0x10, 0x53, 0x34, 0x23, 0xa0, 0xbd, 0xac, 0x19, 0x42, 0x34, 0x22, 0x80,
+ 0x88, 0x21, 0x35, 0x13, 0xfb, 0xce, 0xbb, 0x9b, 0x10, 0x12, 0x11, 0x88, 0x00, 0x43, 0x36, 0x24,
+ 0x81, 0xba, 0xbd, 0x8a, 0x31, 0x44, 0x33, 0x01, 0x88, 0x18, 0x63, 0x23, 0xb0, 0xef, 0xcb, 0xab,
+ 0x88, 0x21, 0x11, 0x00, 0x88, 0x21, 0x54, 0x34, 0x02, 0xb8, 0xbc, 0x9c, 0x18, 0x53, 0x33, 0x13,
+ 0x90, 0x88, 0x42, 0x35, 0x82, 0xec, 0xcd, 0xbb, 0x8a, 0x10, 0x12, 0x01, 0x88, 0x18, 0x53, 0x35,
+ 0x23, 0x81, 0xcc, 0xbb, 0x8a, 0x42, 0x44, 0x23, 0x81, 0x98, 0x20, 0x44, 0x13, 0xc8, 0xdf, 0xcb,
+ 0x9a, 0x08, 0x21, 0x01, 0x80, 0x08, 0x31, 0x54, 0x43, 0x01, 0xb8, 0xbc, 0x9b, 0x20, 0x54, 0x33,
+ 0x02, 0x88, 0x08, 0x53, 0x24, 0xa0, 0xee, 0xcb, 0xab, 0x08, 0x21, 0x01, 0x80, 0x08, 0x31, 0x46,
+ 0x23, 0x81, 0xca, 0xac, 0x8a, 0x31, 0x35, 0x33, 0x81, 0x88, 0x20, 0x45, 0x12, 0xfa, 0xcd, 0xbb,
+ 0x8b, 0x18, 0x12, 0x01, 0x88, 0x20, 0x45, 0x34, 0x13, 0xa0, 0xcc, 0xaa, 0x18, 0x34, 0x34, 0x03,
+ 0x90, 0x08, 0x42, 0x25, 0x91, 0xed, 0xcc, 0xab, 0x88, 0x11, 0x11, 0x80, 0x08, 0x21, 0x45, 0x43,
+ 0x01, 0xb9, 0xad, 0x9a, 0x21, 0x44, 0x23, 0x82, 0x88, 0x10, 0x44, 0x13, 0xd8, 0xcf, 0xcb, 0x9a,
+ 0xf4, 0xb8, 0x47, 0x00, 0x20, 0x10, 0x80, 0x80, 0x21, 0x44, 0x43, 0x01, 0xa9, 0xcc, 0x8a, 0x20,
+ 0x53, 0x23, 0x02, 0x89, 0x28, 0x63, 0x13, 0xc8, 0xde, 0xbc, 0x9a, 0x18, 0x21, 0x01, 0x88, 0x00,
+ 0x42, 0x35, 0x33, 0x91, 0xcc, 0xbb, 0x09, 0x62, 0x33, 0x13, 0x80, 0x08, 0x31, 0x36, 0x02, 0xfc,
+ 0xbd, 0xac, 0x89, 0x11, 0x11, 0x00, 0x88, 0x10, 0x44, 0x34, 0x02, 0xa8, 0xbd, 0x9b, 0x28, 0x44,
+ 0x43, 0x01, 0x88, 0x00, 0x43, 0x33, 0xc0, 0xdf, 0xdb, 0x9a, 0x08, 0x11, 0x01, 0x80, 0x08, 0x32,
+ 0x35, 0x34, 0x91, 0xca, 0xbc, 0x89, 0x32, 0x36, 0x22, 0x00, 0x88, 0x30, 0x44, 0x02, 0xfb, 0xcd,
+ 0xbb, 0x8a, 0x10, 0x21, 0x01, 0x88, 0x20, 0x54, 0x43, 0x13, 0xa8, 0xbc, 0xac, 0x18, 0x53, 0x33,
+ 0x13, 0x88, 0x09, 0x53, 0x34, 0x90, 0xdf, 0xbc, 0xab, 0x09, 0x11, 0x11, 0x00, 0x09, 0x31, 0x46,
+ 0x33, 0x01, 0xca, 0xad, 0x8a, 0x31, 0x34, 0x24, 0x81, 0x88, 0x20, 0x45, 0x12, 0xd9, 0xce, 0xbb,
+ 0x9a, 0x10, 0x12, 0x11, 0x88, 0x18, 0x53, 0x35, 0x23, 0xa0, 0xcc, 0xbb, 0x08, 0x53, 0x34, 0x12,
+ 0x80, 0x09, 0x42, 0x34, 0x81, 0xde, 0xbd, 0xac, 0x88, 0x20, 0x01, 0x81, 0x08, 0x20, 0x44, 0x34,
+ 0x02, 0xc9, 0xcb, 0x8a, 0x20, 0x44, 0x23, 0x82, 0x88, 0x10, 0x44, 0x13, 0xd8, 0xde, 0xcb, 0x99,
+ 0x18, 0x11, 0x00, 0x08, 0x10, 0x53, 0x34, 0x12, 0xa9, 0xcc, 0x9a, 0x28, 0x44, 0x33, 0x01, 0x88,
+ 0x20, 0x44, 0x12, 0xf9, 0xcd, 0xbb, 0x9a, 0x20, 0x21, 0x00, 0x88, 0x30, 0x45, 0x34, 0x01, 0xc9,
+ 0xbb, 0x8b, 0x41, 0x35, 0x22, 0x81, 0x08, 0x31, 0x35, 0x02, 0xed, 0xcd, 0xab, 0x09, 0x10, 0x11,
+ 0x80, 0x08, 0x31, 0x45, 0x33, 0x82, 0xdb, 0xbb, 0x8a, 0x43, 0x35, 0x13, 0x91, 0x88, 0x42, 0x34,
+ 0xf2, 0x42, 0x3c, 0x00, 0xe9, 0xdd, 0xbb, 0x8a, 0x10, 0x21, 0x00, 0x88, 0x20, 0x54, 0x24, 0x02,
+ 0xb9, 0xbc, 0x8b, 0x31, 0x36, 0x23, 0x01, 0x88, 0x21, 0x45, 0x02, 0xfb, 0xcd, 0xab, 0x89, 0x20,
+ 0x11, 0x80, 0x08, 0x30, 0x45, 0x33, 0x82, 0xda, 0xbb, 0x8a, 0x42, 0x44, 0x22, 0x80, 0x88, 0x31,
+ 0x35, 0x92, 0xde, 0xcd, 0xaa, 0x08, 0x10, 0x11, 0x08, 0x08, 0x31, 0x45, 0x23, 0x90, 0xdb, 0xab,
+ 0x08, 0x53, 0x43, 0x12, 0x80, 0x08, 0x53, 0x33, 0xb0, 0xef, 0xbb, 0x9c, 0x08, 0x11, 0x01, 0x88,
+ 0x00, 0x43, 0x44, 0x22, 0xa0, 0xbc, 0x9c, 0x18, 0x43, 0x34, 0x11, 0x98, 0x10, 0x53, 0x23, 0xd8,
+ 0xcf, 0xcb, 0x99, 0x18, 0x11, 0x81, 0x80, 0x28, 0x53, 0x34, 0x12, 0xb8, 0xbd, 0x9a, 0x28, 0x35,
+ 0x24, 0x82, 0x88, 0x11, 0x44, 0x02, 0xea, 0xdd, 0xab, 0x8a, 0x10, 0x11, 0x81, 0x08, 0x20, 0x45,
+ 0x24, 0x02, 0xba, 0xcc, 0x89, 0x21, 0x44, 0x12, 0x81, 0x88, 0x21, 0x44, 0x82, 0xfb, 0xbe, 0xab,
+ 0x89, 0x11, 0x11, 0x80, 0x08, 0x32, 0x46, 0x32, 0x81, 0xda, 0xab, 0x0a, 0x42, 0x34, 0x23, 0x80,
+ 0x09, 0x52, 0x43, 0x91, 0xde, 0xbd, 0x9b, 0x09, 0x21, 0x01, 0x08, 0x08, 0x42, 0x35, 0x24, 0x90,
+ 0xcb, 0xac, 0x18, 0x52, 0x23, 0x12, 0x88, 0x18, 0x43, 0x34, 0xb8, 0xff, 0xbb, 0x9a, 0x18, 0x21,
+ 0x00, 0x90, 0x10, 0x63, 0x43, 0x22, 0x98, 0xbc, 0x9c, 0x18, 0x42, 0x43, 0x12, 0x80, 0x88, 0x30,
+ 0x54, 0x12, 0xc9, 0xbf, 0xbd, 0xaa, 0x08, 0x21, 0x11, 0x00, 0x88, 0x20, 0x45, 0x43, 0x12, 0x90,
+ 0xbc, 0xbc, 0x89, 0x42, 0x34, 0x14, 0x01, 0x89, 0x18, 0x53, 0x23, 0xb1, 0xdf, 0xbd, 0xbb, 0x89,
+ 0x21, 0x21, 0x01, 0x80, 0x10, 0x63, 0x34, 0x24, 0x81, 0xc9, 0xcb, 0x8a, 0x20, 0x34, 0x34, 0x02,
+ 0x58, 0x24, 0x3c, 0x00, 0x98, 0x20, 0x63, 0x13, 0xc0, 0xde, 0xbc, 0x9b, 0x09, 0x20, 0x12, 0x00,
+ 0x88, 0x20, 0x63, 0x44, 0x22, 0x90, 0xcb, 0xac, 0x8a, 0x32, 0x44, 0x23, 0x02, 0x98, 0x18, 0x53,
+ 0x24, 0x91, 0xde, 0xcc, 0xab, 0x8a, 0x20, 0x21, 0x01, 0x88, 0x18, 0x52, 0x44, 0x33, 0x81, 0xc9,
+ 0xbc, 0x9b, 0x30, 0x44, 0x24, 0x02, 0x90, 0x08, 0x31, 0x26, 0x02, 0xeb, 0xdd, 0xbb, 0x9a, 0x00,
+ 0x12, 0x02, 0x80, 0x08, 0x32, 0x46, 0x33, 0x12, 0xb8, 0xcd, 0xab, 0x18, 0x52, 0x43, 0x13, 0x00,
+ 0x89, 0x20, 0x44, 0x13, 0xc8, 0xde, 0xcc, 0x9a, 0x09, 0x11, 0x11, 0x00, 0x88, 0x10, 0x53, 0x44,
+ 0x12, 0x90, 0xcb, 0xac, 0x89, 0x32, 0x44, 0x23, 0x01, 0x89, 0x18, 0x63, 0x33, 0xa1, 0xfd, 0xcc,
+ 0xaa, 0x0a, 0x10, 0x21, 0x00, 0x88, 0x00, 0x43, 0x45, 0x22, 0x81, 0xc9, 0xcb, 0x8a, 0x20, 0x53,
+ 0x24, 0x02, 0x80, 0x09, 0x41, 0x43, 0x02, 0xfb, 0xcd, 0xcb, 0x99, 0x18, 0x11, 0x01, 0x80, 0x80,
+ 0x31, 0x45, 0x33, 0x12, 0xb9, 0xcd, 0xab, 0x18, 0x43, 0x44, 0x12, 0x80, 0x89, 0x20, 0x53, 0x13,
+ 0xd8, 0xde, 0xcb, 0xaa, 0x88, 0x21, 0x21, 0x80, 0x80, 0x21, 0x44, 0x34, 0x33, 0x90, 0xcc, 0xbb,
+ 0x89, 0x42, 0x35, 0x22, 0x01, 0x98, 0x28, 0x63, 0x33, 0xb1, 0xdf, 0xbd, 0xab, 0x0a, 0x20, 0x21,
+ 0x10, 0x98, 0x00, 0x63, 0x34, 0x24, 0x81, 0xc9, 0xbc, 0x8a, 0x30, 0x44, 0x23, 0x02, 0x88, 0x08,
+ 0x52, 0x24, 0x82, 0xfb, 0xbe, 0xbc, 0x99, 0x18, 0x21, 0x11, 0x80, 0x08, 0x20, 0x45, 0x34, 0x13,
+ 0x90, 0xdb, 0xcb, 0x99, 0x21, 0x44, 0x33, 0x11, 0x90, 0x09, 0x42, 0x44, 0x11, 0xd9, 0xdd, 0xbc,
+ 0x9a, 0x09, 0x11, 0x12, 0x81, 0x88, 0x10, 0x53, 0x35, 0x24, 0x81, 0xba, 0xcc, 0x9a, 0x28, 0x53,
+ 0xa2, 0x0f, 0x3f, 0x00, 0x23, 0x02, 0x89, 0x09, 0x53, 0x43, 0x02, 0xfb, 0xce, 0xbb, 0x9a, 0x00,
+ 0x21, 0x12, 0x80, 0x88, 0x20, 0x63, 0x35, 0x23, 0x80, 0xdb, 0xac, 0x9a, 0x21, 0x44, 0x32, 0x13,
+ 0x90, 0x89, 0x42, 0x34, 0x13, 0xe8, 0xde, 0xcb, 0xaa, 0x88, 0x21, 0x11, 0x81, 0x08, 0x00, 0x43,
+ 0x45, 0x33, 0x81, 0xb9, 0xbd, 0xab, 0x28, 0x35, 0x34, 0x22, 0x91, 0x99, 0x30, 0x54, 0x23, 0xa1,
+ 0xef, 0xdb, 0xaa, 0x89, 0x10, 0x12, 0x81, 0x80, 0x08, 0x21, 0x36, 0x25, 0x02, 0xa8, 0xcc, 0xaa,
+ 0x09, 0x42, 0x43, 0x23, 0x01, 0x98, 0x00, 0x53, 0x24, 0x81, 0xfc, 0xcc, 0xbb, 0x9a, 0x18, 0x22,
+ 0x12, 0x80, 0x08, 0x41, 0x54, 0x43, 0x22, 0x90, 0xbc, 0xad, 0x89, 0x30, 0x34, 0x24, 0x01, 0x88,
+ 0x09, 0x41, 0x34, 0x12, 0xda, 0xcf, 0xbc, 0x9b, 0x08, 0x11, 0x12, 0x00, 0x88, 0x10, 0x53, 0x35,
+ 0x24, 0x81, 0xca, 0xcb, 0x9a, 0x10, 0x44, 0x33, 0x22, 0x80, 0x99, 0x30, 0x36, 0x23, 0xc8, 0xcf,
+ 0xbd, 0xab, 0x09, 0x10, 0x22, 0x01, 0x90, 0x10, 0x42, 0x45, 0x33, 0x03, 0xc9, 0xbc, 0xbb, 0x19,
+ 0x63, 0x43, 0x13, 0x81, 0x98, 0x18, 0x34, 0x25, 0x80, 0xfc, 0xbc, 0xbc, 0x99, 0x00, 0x22, 0x01,
+ 0x90, 0x08, 0x22, 0x45, 0x44, 0x02, 0xa0, 0xcb, 0xbb, 0x89, 0x42, 0x44, 0x22, 0x02, 0x90, 0x09,
+ 0x52, 0x43, 0x82, 0xfa, 0xcd, 0xbb, 0x9b, 0x09, 0x22, 0x12, 0x81, 0x88, 0x21, 0x64, 0x53, 0x22,
+ 0x80, 0xbb, 0xbd, 0x9a, 0x20, 0x35, 0x34, 0x12, 0x90, 0x89, 0x31, 0x26, 0x13, 0xc8, 0xee, 0xcb,
+ 0xaa, 0x09, 0x10, 0x22, 0x01, 0x88, 0x08, 0x32, 0x55, 0x43, 0x12, 0xa8, 0xda, 0xba, 0x8a, 0x30,
+ 0x45, 0x23, 0x12, 0x80, 0x9a, 0x30, 0x36, 0x23, 0xa8, 0xef, 0xbc, 0xac, 0x89, 0x10, 0x21, 0x01,
+ 0xbc, 0xdb, 0x3f, 0x00, 0x88, 0x10, 0x21, 0x45, 0x34, 0x11, 0xa9, 0xbc, 0xbc, 0x8a, 0x32, 0x36,
+ 0x33, 0x12, 0x88, 0x09, 0x51, 0x53, 0x12, 0xb8, 0xdf, 0xbc, 0xab, 0x89, 0x10, 0x22, 0x11, 0x98,
+ 0x08, 0x42, 0x44, 0x35, 0x12, 0x90, 0xcb, 0xbc, 0x9b, 0x30, 0x44, 0x24, 0x13, 0x91, 0x99, 0x21,
+ 0x44, 0x33, 0x91, 0xee, 0xbd, 0xac, 0x8a, 0x18, 0x11, 0x12, 0x80, 0x88, 0x20, 0x53, 0x35, 0x24,
+ 0x81, 0xba, 0xbc, 0xac, 0x19, 0x34, 0x34, 0x32, 0x01, 0xa8, 0x29, 0x73, 0x32, 0x11, 0xea, 0xce,
+ 0xac, 0x9b, 0x09, 0x21, 0x12, 0x81, 0x88, 0x00, 0x42, 0x54, 0x43, 0x02, 0xa8, 0xdb, 0xab, 0x8a,
+ 0x42, 0x34, 0x33, 0x12, 0x90, 0x9a, 0x52, 0x34, 0x13, 0xb8, 0xff, 0xbc, 0xaa, 0x8a, 0x10, 0x22,
+ 0x02, 0x88, 0x08, 0x21, 0x55, 0x34, 0x12, 0x90, 0xcb, 0xcb, 0x9b, 0x38, 0x54, 0x23, 0x13, 0x81,
+ 0x99, 0x28, 0x36, 0x23, 0x90, 0xfd, 0xcc, 0xbb, 0x9a, 0x08, 0x22, 0x22, 0x88, 0x08, 0x10, 0x44,
+ 0x45, 0x33, 0x81, 0xba, 0xcc, 0xab, 0x19, 0x53, 0x34, 0x32, 0x01, 0x99, 0x09, 0x63, 0x33, 0x03,
+ 0xfb, 0xdd, 0xcb, 0x9a, 0x08, 0x10, 0x22, 0x81, 0x88, 0x00, 0x31, 0x55, 0x43, 0x02, 0x99, 0xbc,
+ 0xcb, 0x0a, 0x31, 0x35, 0x33, 0x12, 0x90, 0x99, 0x41, 0x35, 0x13, 0xc0, 0xdf, 0xbc, 0x9c, 0x8a,
+ 0x10, 0x21, 0x02, 0x88, 0x00, 0x22, 0x44, 0x44, 0x23, 0x88, 0xca, 0xbb, 0x9c, 0x21, 0x34, 0x34,
+ 0x22, 0x81, 0x9a, 0x30, 0x45, 0x23, 0x81, 0xfd, 0xdc, 0xba, 0x99, 0x08, 0x21, 0x12, 0x80, 0x88,
+ 0x11, 0x53, 0x35, 0x24, 0x01, 0xaa, 0xbd, 0xbb, 0x18, 0x44, 0x33, 0x33, 0x02, 0xa9, 0x09, 0x63,
+ 0x43, 0x12, 0xc0, 0xde, 0xbd, 0xab, 0x89, 0x18, 0x22, 0x12, 0x80, 0x08, 0x20, 0x53, 0x45, 0x33,
+ 0xce, 0x1d, 0x3e, 0x00, 0x90, 0xcb, 0xdb, 0x9a, 0x18, 0x53, 0x33, 0x33, 0x12, 0xa9, 0x8a, 0x63,
+ 0x34, 0x12, 0xb9, 0xff, 0xbb, 0xac, 0x89, 0x10, 0x21, 0x12, 0x88, 0x09, 0x10, 0x53, 0x35, 0x34,
+ 0x01, 0xb9, 0xdb, 0xac, 0x0a, 0x32, 0x44, 0x32, 0x22, 0x80, 0xa9, 0x20, 0x45, 0x23, 0x01, 0xfc,
+ 0xcd, 0xac, 0x99, 0x09, 0x11, 0x12, 0x01, 0x89, 0x18, 0x31, 0x64, 0x43, 0x22, 0x98, 0xca, 0xcb,
+ 0x9b, 0x18, 0x44, 0x33, 0x33, 0x02, 0xb8, 0x09, 0x44, 0x34, 0x12, 0xc8, 0xdf, 0xbc, 0xbb, 0x89,
+ 0x10, 0x22, 0x13, 0x88, 0x88, 0x21, 0x44, 0x54, 0x24, 0x01, 0xa9, 0xbc, 0xbb, 0x8a, 0x43, 0x44,
+ 0x23, 0x13, 0x90, 0x9a, 0x20, 0x36, 0x33, 0x91, 0xde, 0xbe, 0xbc, 0x9a, 0x08, 0x11, 0x22, 0x81,
+ 0x89, 0x18, 0x42, 0x44, 0x44, 0x12, 0x88, 0xbb, 0xbd, 0x9b, 0x20, 0x45, 0x32, 0x23, 0x02, 0x98,
+ 0x19, 0x53, 0x34, 0x13, 0xd9, 0xcf, 0xbc, 0xbb, 0x89, 0x10, 0x22, 0x12, 0x88, 0x88, 0x21, 0x73,
+ 0x34, 0x34, 0x01, 0xb9, 0xcc, 0xbb, 0x0a, 0x52, 0x43, 0x23, 0x22, 0x90, 0x9a, 0x40, 0x44, 0x22,
+ 0x91, 0xfb, 0xcf, 0xba, 0x8a, 0x88, 0x21, 0x12, 0x81, 0x88, 0x18, 0x32, 0x36, 0x45, 0x12, 0x98,
+ 0xba, 0xbc, 0xab, 0x20, 0x54, 0x33, 0x33, 0x01, 0xa9, 0x09, 0x73, 0x33, 0x02, 0xd8, 0xcf, 0xbc,
+ 0xab, 0x89, 0x10, 0x32, 0x11, 0x88, 0x88, 0x21, 0x54, 0x44, 0x33, 0x81, 0xb9, 0xbd, 0xbc, 0x09,
+ 0x43, 0x24, 0x33, 0x13, 0xa0, 0x99, 0x31, 0x27, 0x23, 0x91, 0xfd, 0xcc, 0xbb, 0x9a, 0x08, 0x21,
+ 0x22, 0x81, 0x98, 0x00, 0x42, 0x64, 0x43, 0x12, 0xa0, 0xca, 0xac, 0x9b, 0x20, 0x44, 0x33, 0x23,
+ 0x02, 0xa9, 0x09, 0x54, 0x33, 0x03, 0xd9, 0xdf, 0xac, 0xab, 0x89, 0x18, 0x32, 0x12, 0x80, 0x88,
+ 0xc0, 0xda, 0x39, 0x00, 0x31, 0x54, 0x53, 0x23, 0x02, 0xb9, 0xcc, 0xac, 0x89, 0x31, 0x44, 0x32,
+ 0x22, 0x01, 0xb9, 0x19, 0x73, 0x23, 0x12, 0xc8, 0xee, 0xbc, 0xbb, 0x99, 0x18, 0x31, 0x13, 0x81,
+ 0x99, 0x10, 0x33, 0x47, 0x43, 0x23, 0x90, 0xca, 0xbc, 0xac, 0x89, 0x52, 0x33, 0x24, 0x12, 0x81,
+ 0xa9, 0x28, 0x45, 0x23, 0x11, 0xd8, 0xcf, 0xbc, 0xab, 0x89, 0x00, 0x32, 0x12, 0x80, 0x89, 0x10,
+ 0x52, 0x45, 0x24, 0x03, 0xa0, 0xcb, 0xbc, 0xaa, 0x29, 0x44, 0x24, 0x23, 0x12, 0xa8, 0x9a, 0x31,
+ 0x46, 0x22, 0x80, 0xfb, 0xce, 0xab, 0x9b, 0x88, 0x20, 0x32, 0x02, 0x89, 0x08, 0x11, 0x73, 0x44,
+ 0x23, 0x02, 0xa9, 0xcc, 0xbb, 0x9a, 0x30, 0x36, 0x43, 0x22, 0x01, 0x99, 0x0a, 0x52, 0x24, 0x13,
+ 0xa8, 0xee, 0xcc, 0xab, 0x9a, 0x09, 0x22, 0x23, 0x00, 0x89, 0x08, 0x31, 0x46, 0x44, 0x13, 0x81,
+ 0xba, 0xdb, 0xbb, 0x8a, 0x42, 0x35, 0x33, 0x13, 0x81, 0xaa, 0x29, 0x45, 0x24, 0x02, 0xc9, 0xde,
+ 0xcc, 0xaa, 0x99, 0x00, 0x22, 0x12, 0x00, 0x89, 0x08, 0x32, 0x55, 0x25, 0x13, 0x90, 0xca, 0xcb,
+ 0xab, 0x19, 0x53, 0x24, 0x23, 0x12, 0x90, 0x99, 0x38, 0x36, 0x33, 0x01, 0xfb, 0xcf, 0xbb, 0xab,
+ 0x89, 0x10, 0x23, 0x13, 0x80, 0x88, 0x11, 0x44, 0x55, 0x33, 0x02, 0xa8, 0xdb, 0xcb, 0xaa, 0x20,
+ 0x44, 0x33, 0x32, 0x11, 0x99, 0x8a, 0x42, 0x35, 0x33, 0x90, 0xfe, 0xcc, 0xbb, 0x9a, 0x09, 0x21,
+ 0x22, 0x01, 0x98, 0x08, 0x22, 0x54, 0x54, 0x32, 0x01, 0xaa, 0xcc, 0xbb, 0x9b, 0x41, 0x35, 0x32,
+ 0x23, 0x02, 0xa9, 0x19, 0x63, 0x24, 0x13, 0xa0, 0xef, 0xdb, 0xaa, 0x9a, 0x18, 0x11, 0x13, 0x00,
+ 0x98, 0x80, 0x22, 0x55, 0x34, 0x33, 0x80, 0xda, 0xcb, 0xab, 0x89, 0x52, 0x34, 0x32, 0x12, 0x81,
+ 0x59, 0x21, 0x39, 0x00, 0x8a, 0x42, 0x35, 0x12, 0x91, 0xed, 0xcd, 0xbb, 0xaa, 0x88, 0x20, 0x32,
+ 0x22, 0x88, 0x89, 0x10, 0x52, 0x45, 0x34, 0x23, 0x90, 0xba, 0xcd, 0xba, 0x0a, 0x41, 0x44, 0x22,
+ 0x13, 0x01, 0xa8, 0x0a, 0x51, 0x34, 0x32, 0x80, 0xed, 0xcd, 0xac, 0x9a, 0x89, 0x11, 0x22, 0x02,
+ 0x80, 0x89, 0x10, 0x42, 0x54, 0x34, 0x32, 0x80, 0xca, 0xbc, 0xac, 0x89, 0x30, 0x35, 0x24, 0x22,
+ 0x02, 0xa8, 0x8a, 0x51, 0x34, 0x22, 0x81, 0xfb, 0xcf, 0xcb, 0x9a, 0x88, 0x00, 0x22, 0x02, 0x80,
+ 0x09, 0x18, 0x31, 0x46, 0x34, 0x23, 0x81, 0xc9, 0xcc, 0xba, 0x8a, 0x31, 0x54, 0x32, 0x32, 0x01,
+ 0xa8, 0x9a, 0x51, 0x34, 0x23, 0x01, 0xfb, 0xbf, 0xbd, 0x9a, 0x89, 0x18, 0x22, 0x22, 0x80, 0x09,
+ 0x10, 0x31, 0x55, 0x44, 0x22, 0x81, 0xb9, 0xdb, 0xcb, 0x8a, 0x30, 0x34, 0x34, 0x32, 0x11, 0xa8,
+ 0xaa, 0x41, 0x45, 0x22, 0x00, 0xea, 0xce, 0xbc, 0xaa, 0x8a, 0x00, 0x22, 0x22, 0x80, 0x88, 0x18,
+ 0x31, 0x64, 0x44, 0x33, 0x81, 0xa9, 0xbc, 0xbc, 0x9b, 0x40, 0x34, 0x25, 0x23, 0x02, 0x98, 0x99,
+ 0x30, 0x44, 0x33, 0x82, 0xfa, 0xde, 0xcb, 0x9b, 0x8a, 0x00, 0x22, 0x22, 0x80, 0x98, 0x00, 0x32,
+ 0x45, 0x35, 0x24, 0x01, 0xa9, 0xdb, 0xcb, 0x9a, 0x20, 0x44, 0x23, 0x33, 0x12, 0xa0, 0xaa, 0x30,
+ 0x37, 0x33, 0x01, 0xea, 0xcf, 0xbc, 0xab, 0x99, 0x00, 0x32, 0x22, 0x81, 0x89, 0x18, 0x32, 0x46,
+ 0x34, 0x25, 0x01, 0xa8, 0xdb, 0xbb, 0xaa, 0x20, 0x54, 0x33, 0x23, 0x12, 0x90, 0xaa, 0x38, 0x37,
+ 0x23, 0x12, 0xea, 0xde, 0xbc, 0xab, 0x99, 0x18, 0x31, 0x23, 0x81, 0x89, 0x18, 0x31, 0x64, 0x44,
+ 0x23, 0x12, 0xb8, 0xcc, 0xcb, 0xaa, 0x10, 0x53, 0x43, 0x32, 0x11, 0x90, 0x9a, 0x18, 0x36, 0x24,
+ 0x96, 0x3e, 0x3b, 0x00, 0x80, 0xfb, 0xbe, 0xbc, 0xaa, 0x09, 0x10, 0x22, 0x13, 0x88, 0x88, 0x10,
+ 0x43, 0x55, 0x53, 0x12, 0x90, 0xb9, 0xbc, 0xac, 0x09, 0x52, 0x33, 0x43, 0x12, 0x80, 0x9a, 0x28,
+ 0x45, 0x23, 0x01, 0xea, 0xdd, 0xbc, 0xba, 0x89, 0x10, 0x32, 0x12, 0x80, 0x89, 0x10, 0x53, 0x45,
+ 0x24, 0x12, 0x98, 0xda, 0xbb, 0xab, 0x18, 0x44, 0x34, 0x32, 0x02, 0x98, 0x9a, 0x41, 0x35, 0x23,
+ 0x80, 0xfd, 0xcc, 0xac, 0x9a, 0x89, 0x10, 0x22, 0x02, 0x88, 0x08, 0x22, 0x44, 0x45, 0x23, 0x02,
+ 0xa9, 0xcb, 0xbc, 0x9a, 0x31, 0x45, 0x32, 0x22, 0x01, 0x99, 0x0a, 0x63, 0x33, 0x23, 0xb0, 0xff,
+ 0xcc, 0xab, 0x8a, 0x09, 0x22, 0x12, 0x01, 0x89, 0x00, 0x31, 0x64, 0x34, 0x14, 0x81, 0xb9, 0xdb,
+ 0xbb, 0x8a, 0x42, 0x44, 0x32, 0x22, 0x80, 0xa9, 0x18, 0x54, 0x32, 0x11, 0xc9, 0xdf, 0xbc, 0xbb,
+ 0x99, 0x10, 0x31, 0x13, 0x81, 0x88, 0x18, 0x52, 0x54, 0x43, 0x13, 0x90, 0xca, 0xbc, 0xab, 0x18,
+ 0x63, 0x33, 0x33, 0x22, 0x98, 0xaa, 0x30, 0x37, 0x33, 0x02, 0xfc, 0xcd, 0xbb, 0xbb, 0x89, 0x20,
+ 0x33, 0x12, 0x88, 0x89, 0x21, 0x54, 0x45, 0x33, 0x12, 0xa9, 0xbc, 0xbd, 0x9a, 0x38, 0x44, 0x43,
+ 0x22, 0x01, 0xa0, 0x99, 0x41, 0x25, 0x13, 0x91, 0xfd, 0xcc, 0xbb, 0xaa, 0x88, 0x31, 0x32, 0x01,
+ 0x98, 0x08, 0x31, 0x45, 0x45, 0x23, 0x82, 0xb9, 0xdb, 0xac, 0x9a, 0x31, 0x45, 0x22, 0x22, 0x81,
+ 0xa9, 0x09, 0x44, 0x33, 0x22, 0xb8, 0xff, 0xbc, 0xbb, 0x9a, 0x00, 0x22, 0x23, 0x81, 0x99, 0x00,
+ 0x33, 0x37, 0x36, 0x22, 0x91, 0xba, 0xbd, 0xac, 0x09, 0x42, 0x43, 0x23, 0x22, 0x90, 0xaa, 0x28,
+ 0x46, 0x22, 0x01, 0xd9, 0xcf, 0xbc, 0xab, 0x99, 0x10, 0x22, 0x03, 0x80, 0x88, 0x21, 0x44, 0x54,
+ 0x99, 0x03, 0x40, 0x00, 0x23, 0x82, 0xb8, 0xcc, 0xbb, 0x8a, 0x42, 0x34, 0x24, 0x13, 0x01, 0xaa,
+ 0x19, 0x54, 0x33, 0x12, 0xc8, 0xdf, 0xbd, 0xab, 0x99, 0x18, 0x31, 0x22, 0x00, 0x89, 0x10, 0x32,
+ 0x56, 0x34, 0x22, 0x98, 0xcb, 0xbc, 0x9b, 0x28, 0x35, 0x34, 0x23, 0x01, 0xa9, 0x19, 0x63, 0x33,
+ 0x13, 0xd9, 0xdf, 0xdb, 0x9a, 0x89, 0x10, 0x21, 0x11, 0x88, 0x88, 0x21, 0x52, 0x44, 0x24, 0x81,
+ 0xa9, 0xbc, 0xbb, 0x09, 0x52, 0x34, 0x23, 0x13, 0xa0, 0x99, 0x40, 0x54, 0x22, 0x91, 0xdd, 0xcd,
+ 0xbb, 0x9a, 0x08, 0x21, 0x13, 0x01, 0x89, 0x18, 0x42, 0x45, 0x34, 0x13, 0x98, 0xdb, 0xcb, 0x9b,
+ 0x20, 0x44, 0x33, 0x23, 0x82, 0xa9, 0x19, 0x54, 0x33, 0x12, 0xe9, 0xde, 0xbc, 0xaa, 0x89, 0x10,
+ 0x22, 0x02, 0x90, 0x08, 0x21, 0x44, 0x45, 0x23, 0x81, 0xb9, 0xcc, 0xbb, 0x89, 0x43, 0x25, 0x33,
+ 0x12, 0x90, 0x99, 0x40, 0x44, 0x22, 0x80, 0xed, 0xdc, 0xab, 0x9a, 0x08, 0x21, 0x22, 0x81, 0x89,
+ 0x10, 0x42, 0x54, 0x34, 0x12, 0x98, 0xdb, 0xbb, 0xab, 0x21, 0x45, 0x23, 0x33, 0x81, 0xaa, 0x08,
+ 0x54, 0x33, 0x03, 0xea, 0xde, 0xcb, 0x9b, 0x8a, 0x10, 0x32, 0x11, 0x98, 0x08, 0x20, 0x63, 0x35,
+ 0x24, 0x00, 0xb9, 0xdb, 0xab, 0x09, 0x53, 0x24, 0x33, 0x22, 0x90, 0x8a, 0x41, 0x43, 0x23, 0xa1,
+ 0xef, 0xcc, 0xbb, 0x9a, 0x08, 0x21, 0x13, 0x81, 0x98, 0x10, 0x43, 0x55, 0x43, 0x02, 0x98, 0xca,
+ 0xcb, 0xaa, 0x21, 0x44, 0x33, 0x32, 0x01, 0xaa, 0x18, 0x54, 0x23, 0x12, 0xe9, 0xcf, 0xbc, 0xaa,
+ 0x09, 0x10, 0x22, 0x11, 0x88, 0x88, 0x22, 0x44, 0x45, 0x23, 0x81, 0xba, 0xbc, 0xbc, 0x09, 0x53,
+ 0x43, 0x23, 0x12, 0x98, 0x8a, 0x41, 0x35, 0x13, 0xa0, 0xee, 0xcc, 0xbb, 0x8a, 0x08, 0x31, 0x12,
+ 0x15, 0xde, 0x3d, 0x00, 0x88, 0x08, 0x21, 0x54, 0x34, 0x24, 0x80, 0xb9, 0xcc, 0xab, 0x09, 0x53,
+ 0x43, 0x32, 0x12, 0x98, 0x8a, 0x31, 0x36, 0x23, 0xa1, 0xef, 0xcc, 0xba, 0x99, 0x18, 0x21, 0x21,
+ 0x80, 0x89, 0x10, 0x42, 0x45, 0x34, 0x02, 0x98, 0xcb, 0xbc, 0x8b, 0x31, 0x45, 0x32, 0x22, 0x90,
+ 0x99, 0x31, 0x45, 0x22, 0x90, 0xed, 0xcd, 0xab, 0x8a, 0x18, 0x21, 0x12, 0x80, 0x09, 0x11, 0x44,
+ 0x35, 0x24, 0x81, 0xba, 0xcc, 0xaa, 0x28, 0x43, 0x34, 0x32, 0x81, 0x99, 0x08, 0x44, 0x24, 0x02,
+ 0xeb, 0xce, 0xbc, 0x9a, 0x08, 0x20, 0x12, 0x81, 0x89, 0x18, 0x43, 0x54, 0x43, 0x01, 0xa9, 0xcb,
+ 0xac, 0x89, 0x32, 0x35, 0x33, 0x12, 0x98, 0x89, 0x62, 0x43, 0x12, 0xc8, 0xcf, 0xcb, 0xab, 0x89,
+ 0x20, 0x22, 0x01, 0x98, 0x88, 0x32, 0x46, 0x34, 0x23, 0xa8, 0xcb, 0xad, 0x9b, 0x21, 0x44, 0x33,
+ 0x23, 0x80, 0x9a, 0x31, 0x45, 0x23, 0x91, 0xdf, 0xbd, 0xac, 0x99, 0x00, 0x21, 0x02, 0x80, 0x08,
+ 0x10, 0x53, 0x54, 0x22, 0x81, 0xc9, 0xbb, 0xac, 0x18, 0x53, 0x24, 0x22, 0x01, 0xa8, 0x19, 0x63,
+ 0x23, 0x02, 0xfa, 0xbe, 0xad, 0x9a, 0x08, 0x11, 0x12, 0x00, 0x88, 0x10, 0x32, 0x55, 0x33, 0x03,
+ 0xb8, 0xbd, 0xac, 0x8a, 0x42, 0x34, 0x33, 0x13, 0x98, 0x8a, 0x52, 0x34, 0x13, 0xb8, 0xff, 0xbc,
+ 0xab, 0x89, 0x10, 0x22, 0x02, 0x88, 0x18, 0x21, 0x55, 0x34, 0x22, 0x98, 0xcb, 0xbc, 0x9b, 0x30,
+ 0x35, 0x34, 0x22, 0x80, 0x8a, 0x20, 0x36, 0x23, 0x90, 0xfd, 0xdc, 0xab, 0x99, 0x00, 0x21, 0x12,
+ 0x90, 0x88, 0x21, 0x53, 0x35, 0x24, 0x81, 0xaa, 0xbd, 0xab, 0x18, 0x34, 0x25, 0x23, 0x82, 0x98,
+ 0x08, 0x53, 0x24, 0x02, 0xe9, 0xce, 0xbc, 0x9a, 0x88, 0x21, 0x21, 0x81, 0x89, 0x10, 0x42, 0x54,
+ 0x5a, 0x0b, 0x40, 0x00, 0x23, 0x90, 0xca, 0xdb, 0xaa, 0x28, 0x34, 0x43, 0x22, 0x01, 0x9a, 0x28,
+ 0x44, 0x33, 0x82, 0xed, 0xdd, 0xab, 0x9b, 0x08, 0x11, 0x12, 0x81, 0x88, 0x20, 0x63, 0x44, 0x33,
+ 0x01, 0xb9, 0xbc, 0xac, 0x1a, 0x53, 0x43, 0x23, 0x02, 0xa8, 0x0a, 0x43, 0x25, 0x03, 0xd9, 0xcf,
+ 0xbc, 0x9a, 0x89, 0x20, 0x12, 0x01, 0x08, 0x08, 0x32, 0x47, 0x33, 0x02, 0xa8, 0xdc, 0xab, 0x08,
+ 0x42, 0x34, 0x23, 0x81, 0x98, 0x18, 0x53, 0x24, 0x92, 0xfc, 0xbd, 0xac, 0x8a, 0x18, 0x21, 0x11,
+ 0x80, 0x88, 0x21, 0x54, 0x34, 0x13, 0x90, 0xcc, 0xab, 0x8a, 0x41, 0x34, 0x43, 0x11, 0x88, 0x09,
+ 0x41, 0x34, 0x02, 0xea, 0xce, 0xbc, 0x9a, 0x08, 0x11, 0x12, 0x80, 0x80, 0x10, 0x44, 0x44, 0x22,
+ 0x81, 0xba, 0xae, 0x9a, 0x28, 0x44, 0x23, 0x22, 0x80, 0x99, 0x30, 0x36, 0x23, 0xc8, 0xdf, 0xbc,
+ 0xaa, 0x89, 0x11, 0x22, 0x00, 0x88, 0x08, 0x42, 0x45, 0x43, 0x01, 0xb9, 0xdb, 0xaa, 0x19, 0x53,
+ 0x43, 0x22, 0x81, 0x98, 0x10, 0x44, 0x23, 0xa1, 0xee, 0xcc, 0xab, 0x8a, 0x00, 0x22, 0x11, 0x88,
+ 0x08, 0x32, 0x55, 0x43, 0x12, 0xa8, 0xcb, 0xac, 0x89, 0x42, 0x34, 0x32, 0x01, 0x98, 0x08, 0x63,
+ 0x23, 0x02, 0xfb, 0xce, 0xcb, 0x99, 0x08, 0x11, 0x02, 0x80, 0x88, 0x20, 0x62, 0x43, 0x23, 0x90,
+ 0xcb, 0xbc, 0x9a, 0x21, 0x35, 0x34, 0x12, 0x90, 0x89, 0x41, 0x34, 0x13, 0xe9, 0xde, 0xcb, 0x9a,
+ 0x88, 0x21, 0x21, 0x00, 0x88, 0x20, 0x53, 0x44, 0x23, 0x01, 0xca, 0xbc, 0xab, 0x28, 0x53, 0x34,
+ 0x22, 0x90, 0x88, 0x20, 0x44, 0x33, 0xa0, 0xef, 0xbc, 0xac, 0x89, 0x10, 0x12, 0x01, 0x88, 0x08,
+ 0x31, 0x36, 0x25, 0x02, 0xa8, 0xbc, 0xac, 0x08, 0x42, 0x43, 0x23, 0x02, 0x99, 0x08, 0x53, 0x34,
+ 0x31, 0x40, 0x3b, 0x00, 0xc8, 0xde, 0xbc, 0xaa, 0x89, 0x21, 0x21, 0x01, 0x88, 0x00, 0x53, 0x44,
+ 0x24, 0x01, 0xb9, 0xcc, 0x9a, 0x08, 0x43, 0x34, 0x22, 0x80, 0x98, 0x20, 0x44, 0x33, 0xa0, 0xdf,
+ 0xcc, 0xbb, 0x8a, 0x20, 0x21, 0x01, 0x90, 0x08, 0x42, 0x54, 0x33, 0x23, 0xb8, 0xcd, 0xab, 0x09,
+ 0x32, 0x36, 0x32, 0x01, 0x98, 0x08, 0x52, 0x34, 0x81, 0xfb, 0xce, 0xab, 0x8b, 0x08, 0x21, 0x12,
+ 0x80, 0x98, 0x31, 0x45, 0x44, 0x12, 0x90, 0xbc, 0xbb, 0x89, 0x52, 0x34, 0x33, 0x81, 0x98, 0x10,
+ 0x44, 0x24, 0xa0, 0xde, 0xcc, 0xab, 0x89, 0x11, 0x21, 0x01, 0x88, 0x18, 0x53, 0x44, 0x23, 0x81,
+ 0xca, 0xbc, 0x8a, 0x30, 0x35, 0x24, 0x11, 0x98, 0x08, 0x42, 0x34, 0x01, 0xfc, 0xcc, 0xac, 0x99,
+ 0x10, 0x11, 0x01, 0x88, 0x80, 0x32, 0x45, 0x33, 0x02, 0xc9, 0xcc, 0x9a, 0x18, 0x43, 0x24, 0x13,
+ 0x90, 0x88, 0x31, 0x45, 0x12, 0xd9, 0xce, 0xcb, 0xaa, 0x08, 0x12, 0x12, 0x80, 0x80, 0x21, 0x54,
+ 0x43, 0x12, 0xa0, 0xbc, 0xbc, 0x09, 0x42, 0x34, 0x14, 0x81, 0x88, 0x10, 0x53, 0x23, 0xa0, 0xef,
+ 0xbc, 0xab, 0x89, 0x11, 0x12, 0x01, 0x88, 0x10, 0x63, 0x34, 0x24, 0x80, 0xca, 0xac, 0x9a, 0x31,
+ 0x44, 0x33, 0x01, 0x88, 0x09, 0x43, 0x35, 0x81, 0xfb, 0xbf, 0xab, 0x8a, 0x10, 0x21, 0x01, 0x80,
+ 0x08, 0x51, 0x34, 0x25, 0x01, 0xb9, 0xbc, 0x9b, 0x28, 0x44, 0x34, 0x12, 0x88, 0x88, 0x41, 0x34,
+ 0x03, 0xfa, 0xcd, 0xbc, 0x9a, 0x00, 0x11, 0x11, 0x80, 0x08, 0x30, 0x45, 0x34, 0x12, 0xa8, 0xcc,
+ 0xba, 0x08, 0x42, 0x34, 0x14, 0x00, 0x88, 0x10, 0x53, 0x23, 0xb8, 0xef, 0xdb, 0xaa, 0x88, 0x10,
+ 0x12, 0x00, 0x98, 0x10, 0x53, 0x34, 0x24, 0x80, 0xda, 0xab, 0x8a, 0x30, 0x35, 0x34, 0x01, 0x90,
+ 0xc6, 0x20, 0x3b, 0x00, 0x20, 0x34, 0x14, 0xc8, 0xcf, 0xbc, 0x9b, 0x08, 0x11, 0x12, 0x81, 0x80,
+ 0x10, 0x54, 0x53, 0x22, 0x98, 0xcb, 0xbb, 0x0a, 0x42, 0x35, 0x23, 0x01, 0x89, 0x18, 0x44, 0x24,
+ 0xa0, 0xde, 0xbd, 0xab, 0x89, 0x11, 0x12, 0x81, 0x88, 0x18, 0x53, 0x35, 0x24, 0x80, 0xc9, 0xbc,
+ 0x8a, 0x20, 0x44, 0x33, 0x11, 0x98, 0x08, 0x52, 0x43, 0x82, 0xfb, 0xcd, 0xbb, 0x8b, 0x18, 0x22,
+ 0x12, 0x08, 0x08, 0x42, 0x54, 0x33, 0x02, 0xb9, 0xbe, 0xab, 0x18, 0x44, 0x43, 0x12, 0x80, 0x09,
+ 0x40, 0x34, 0x02, 0xfb, 0xcd, 0xac, 0x8a, 0x18, 0x21, 0x00, 0x80, 0x08, 0x52, 0x53, 0x23, 0x80,
+ 0xca, 0xcb, 0x8a, 0x31, 0x35, 0x33, 0x01, 0x98, 0x28, 0x54, 0x23, 0xc0, 0xde, 0xbc, 0xaa, 0x09,
+ 0x21, 0x11, 0x00, 0x88, 0x21, 0x45, 0x34, 0x12, 0xa9, 0xbd, 0xab, 0x20, 0x44, 0x43, 0x02, 0x90,
+ 0x08, 0x32, 0x35, 0x82, 0xdd, 0xcd, 0xac, 0x89, 0x10, 0x11, 0x81, 0x80, 0x18, 0x52, 0x53, 0x22,
+ 0x90, 0xda, 0xab, 0x89, 0x42, 0x53, 0x22, 0x00, 0x89, 0x20, 0x63, 0x12, 0xc8, 0xcf, 0xcb, 0x9a,
+ 0x08, 0x21, 0x01, 0x80, 0x88, 0x31, 0x36, 0x34, 0x01, 0xc9, 0xcb, 0x9a, 0x20, 0x44, 0x33, 0x02,
+ 0x88, 0x19, 0x43, 0x35, 0x80, 0xde, 0xcc, 0xab, 0x0a, 0x20, 0x11, 0x81, 0x88, 0x11, 0x54, 0x34,
+ 0x12, 0x98, 0xbc, 0xac, 0x08, 0x42, 0x34, 0x13, 0x81, 0x89, 0x40, 0x34, 0x13, 0xfb, 0xce, 0xbb,
+ 0x8a, 0x18, 0x12, 0x01, 0x90, 0x00, 0x42, 0x45, 0x23, 0x81, 0xca, 0xbc, 0x8a, 0x30, 0x45, 0x22,
+ 0x01, 0x98, 0x10, 0x53, 0x23, 0xb0, 0xef, 0xbc, 0xab, 0x09, 0x11, 0x12, 0x01, 0x08, 0x20, 0x55,
+ 0x43, 0x02, 0xa0, 0xbc, 0xab, 0x10, 0x53, 0x34, 0x11, 0x80, 0x09, 0x41, 0x34, 0x82, 0xfc, 0xcc,
+ 0x3f, 0xe3, 0x47, 0x00, 0x9b, 0x09, 0x21, 0x11, 0x80, 0x88, 0x31, 0x46, 0x33, 0x03, 0xc8, 0xbc,
+ 0xab, 0x10, 0x54, 0x23, 0x12, 0x88, 0x09, 0x52, 0x43, 0x81, 0xec, 0xbd, 0xac, 0x8a, 0x10, 0x12,
+ 0x00, 0x80, 0x10, 0x52, 0x44, 0x22, 0x90, 0xda, 0xab, 0x09, 0x41, 0x34, 0x23, 0x81, 0x98, 0x21,
+ 0x35, 0x14, 0xc9, 0xcf, 0xbc, 0x9a, 0x08, 0x21, 0x01, 0x80, 0x08, 0x41, 0x44, 0x24, 0x01, 0xb9,
+ 0xad, 0x9a, 0x10, 0x44, 0x33, 0x11, 0x98, 0x00, 0x53, 0x24, 0x90, 0xfd, 0xdb, 0xaa, 0x89, 0x11,
+ 0x11, 0x81, 0x80, 0x10, 0x53, 0x35, 0x12, 0x98, 0xbc, 0xbc, 0x09, 0x32, 0x44, 0x23, 0x02, 0x88,
+ 0x09, 0x42, 0x34, 0x14, 0xc9, 0xcf, 0xbc, 0xab, 0x89, 0x11, 0x32, 0x01, 0x88, 0x08, 0x32, 0x46,
+ 0x34, 0x23, 0xa8, 0xbc, 0xbc, 0x9a, 0x41, 0x34, 0x43, 0x22, 0x90, 0x89, 0x31, 0x35, 0x33, 0xa0,
+ 0xff, 0xbc, 0xbb, 0x99, 0x10, 0x21, 0x12, 0x90, 0x08, 0x30, 0x45, 0x35, 0x23, 0x91, 0xda, 0xcb,
+ 0xaa, 0x28, 0x34, 0x34, 0x32, 0x81, 0xa9, 0x28, 0x45, 0x23, 0x02, 0xfc, 0xcd, 0xbb, 0xaa, 0x08,
+ 0x31, 0x22, 0x00, 0x88, 0x00, 0x63, 0x54, 0x23, 0x02, 0xa9, 0xcc, 0xba, 0x09, 0x42, 0x43, 0x33,
+ 0x11, 0x98, 0x89, 0x53, 0x34, 0x12, 0xd8, 0xde, 0xbc, 0xab, 0x89, 0x20, 0x22, 0x01, 0x88, 0x08,
+ 0x31, 0x46, 0x25, 0x12, 0x90, 0xbb, 0xbd, 0x9a, 0x21, 0x45, 0x32, 0x12, 0x80, 0x99, 0x20, 0x36,
+ 0x13, 0xa0, 0xdf, 0xcc, 0xab, 0x8a, 0x08, 0x22, 0x12, 0x88, 0x08, 0x21, 0x63, 0x35, 0x14, 0x91,
+ 0xb9, 0xbc, 0xab, 0x18, 0x35, 0x25, 0x13, 0x01, 0x99, 0x00, 0x34, 0x25, 0x81, 0xfb, 0xcd, 0xcb,
+ 0x99, 0x09, 0x11, 0x22, 0x80, 0x88, 0x10, 0x32, 0x46, 0x24, 0x02, 0xa9, 0xbc, 0xac, 0x09, 0x42,
+ 0xee, 0x01, 0x3d, 0x00, 0x24, 0x23, 0x80, 0x99, 0x20, 0x44, 0x33, 0x92, 0xfd, 0xbd, 0xbc, 0x99,
+ 0x08, 0x21, 0x12, 0x80, 0x88, 0x11, 0x43, 0x55, 0x23, 0x82, 0xb9, 0xcc, 0xab, 0x09, 0x53, 0x43,
+ 0x23, 0x02, 0x99, 0x08, 0x34, 0x25, 0x02, 0xe9, 0xce, 0xac, 0xaa, 0x88, 0x11, 0x22, 0x00, 0x88,
+ 0x18, 0x43, 0x44, 0x24, 0x03, 0xa8, 0xdb, 0xcb, 0x89, 0x41, 0x33, 0x43, 0x22, 0x88, 0x8a, 0x41,
+ 0x34, 0x13, 0xb0, 0xff, 0xbc, 0xbb, 0x99, 0x10, 0x22, 0x11, 0x88, 0x88, 0x21, 0x55, 0x34, 0x23,
+ 0x91, 0xdb, 0xbc, 0x9a, 0x38, 0x44, 0x33, 0x23, 0x81, 0x99, 0x38, 0x45, 0x14, 0x01, 0xfb, 0xcd,
+ 0xbb, 0x9a, 0x08, 0x21, 0x12, 0x80, 0x88, 0x10, 0x43, 0x46, 0x33, 0x12, 0xb9, 0xbc, 0xbd, 0x8a,
+ 0x31, 0x35, 0x24, 0x22, 0x81, 0x9a, 0x28, 0x35, 0x24, 0x01, 0xfa, 0xbe, 0xbd, 0x9a, 0x88, 0x11,
+ 0x22, 0x81, 0x88, 0x18, 0x21, 0x45, 0x44, 0x13, 0x80, 0xba, 0xbd, 0xab, 0x18, 0x44, 0x33, 0x24,
+ 0x02, 0x98, 0x89, 0x41, 0x44, 0x12, 0xa8, 0xdf, 0xbc, 0xbb, 0x9a, 0x00, 0x32, 0x13, 0x80, 0x89,
+ 0x20, 0x54, 0x44, 0x43, 0x01, 0xa8, 0xdb, 0xbb, 0x8a, 0x42, 0x34, 0x33, 0x23, 0x81, 0xaa, 0x38,
+ 0x55, 0x23, 0x02, 0xec, 0xce, 0xbb, 0x9a, 0x09, 0x20, 0x22, 0x82, 0x88, 0x08, 0x32, 0x55, 0x44,
+ 0x22, 0x88, 0xca, 0xca, 0xab, 0x18, 0x44, 0x33, 0x32, 0x12, 0x99, 0x8a, 0x53, 0x34, 0x23, 0xb8,
+ 0xff, 0xbc, 0x9c, 0x99, 0x10, 0x11, 0x02, 0x80, 0x88, 0x11, 0x42, 0x54, 0x24, 0x01, 0xa8, 0xac,
+ 0xbb, 0x8a, 0x41, 0x44, 0x32, 0x22, 0x80, 0xa9, 0x20, 0x45, 0x23, 0x81, 0xec, 0xdd, 0xbb, 0xaa,
+ 0x88, 0x21, 0x23, 0x81, 0x98, 0x18, 0x41, 0x54, 0x43, 0x23, 0x90, 0xcb, 0xbc, 0xbb, 0x28, 0x54,
+ 0x76, 0x04, 0x3f, 0x00, 0x32, 0x22, 0x80, 0x9a, 0x38, 0x35, 0x34, 0x01, 0xfb, 0xbf, 0xbc, 0x9a,
+ 0x08, 0x20, 0x22, 0x02, 0x89, 0x00, 0x31, 0x64, 0x34, 0x22, 0x90, 0xca, 0xcc, 0xaa, 0x10, 0x43,
+ 0x34, 0x22, 0x02, 0xa8, 0x09, 0x53, 0x24, 0x13, 0xb8, 0xff, 0xbc, 0xaa, 0x8a, 0x00, 0x22, 0x12,
+ 0x88, 0x88, 0x21, 0x53, 0x45, 0x33, 0x02, 0xba, 0xcc, 0xbb, 0x8a, 0x42, 0x44, 0x23, 0x13, 0x80,
+ 0x9a, 0x20, 0x36, 0x33, 0x91, 0xfc, 0xcd, 0xac, 0x9a, 0x08, 0x20, 0x22, 0x00, 0x89, 0x00, 0x32,
+ 0x45, 0x44, 0x12, 0x88, 0xbb, 0xcc, 0x9b, 0x28, 0x34, 0x34, 0x32, 0x12, 0xa9, 0x1a, 0x63, 0x33,
+ 0x13, 0xd8, 0xdf, 0xbc, 0xba, 0x89, 0x00, 0x32, 0x02, 0x80, 0x88, 0x11, 0x63, 0x54, 0x23, 0x01,
+ 0xa9, 0xcc, 0xba, 0x8a, 0x41, 0x53, 0x32, 0x22, 0x81, 0xa9, 0x18, 0x54, 0x23, 0x12, 0xc0, 0xdf,
+ 0xcc, 0xaa, 0x99, 0x00, 0x21, 0x12, 0x81, 0x89, 0x10, 0x31, 0x46, 0x34, 0x13, 0x91, 0xba, 0xbe,
+ 0xab, 0x09, 0x53, 0x34, 0x32, 0x12, 0x91, 0x99, 0x20, 0x36, 0x33, 0x02, 0xfb, 0xcf, 0xbb, 0x9c,
+ 0x89, 0x18, 0x22, 0x12, 0x90, 0x88, 0x20, 0x42, 0x45, 0x34, 0x12, 0xa8, 0xcb, 0xbc, 0xab, 0x18,
+ 0x35, 0x25, 0x22, 0x11, 0xa8, 0x99, 0x41, 0x34, 0x23, 0x91, 0xfd, 0xbd, 0xad, 0x9a, 0x08, 0x20,
+ 0x12, 0x11, 0x08, 0x08, 0x11, 0x44, 0x44, 0x24, 0x01, 0xa9, 0xbc, 0xcb, 0x8a, 0x30, 0x44, 0x33,
+ 0x32, 0x01, 0xa9, 0x0a, 0x54, 0x43, 0x12, 0xa8, 0xdf, 0xcc, 0xab, 0x9a, 0x08, 0x21, 0x23, 0x00,
+ 0x89, 0x00, 0x22, 0x46, 0x44, 0x22, 0x91, 0xb9, 0xbc, 0xbc, 0x89, 0x42, 0x34, 0x33, 0x23, 0x92,
+ 0xba, 0x39, 0x46, 0x23, 0x02, 0xd0, 0xcf, 0xcc, 0xaa, 0x89, 0x00, 0x22, 0x11, 0x80, 0x88, 0x10,
+ 0x0a, 0xe1, 0x38, 0x00, 0x53, 0x35, 0x24, 0x82, 0xa9, 0xbc, 0xbc, 0x8a, 0x31, 0x35, 0x24, 0x23,
+ 0x01, 0xa9, 0x09, 0x44, 0x34, 0x11, 0xa8, 0xdf, 0xcd, 0xaa, 0x99, 0x08, 0x21, 0x22, 0x80, 0x88,
+ 0x18, 0x31, 0x46, 0x43, 0x23, 0x80, 0xca, 0xcb, 0xac, 0x09, 0x51, 0x33, 0x32, 0x22, 0x81, 0xaa,
+ 0x39, 0x46, 0x23, 0x11, 0xe8, 0xde, 0xcb, 0xaa, 0x99, 0x10, 0x22, 0x12, 0x80, 0x89, 0x11, 0x42,
+ 0x55, 0x33, 0x13, 0x98, 0xdb, 0xcb, 0x9b, 0x18, 0x53, 0x43, 0x32, 0x12, 0x90, 0x99, 0x30, 0x45,
+ 0x23, 0x82, 0xfb, 0xcf, 0xbb, 0xaa, 0x89, 0x11, 0x23, 0x02, 0x88, 0x08, 0x11, 0x63, 0x54, 0x33,
+ 0x11, 0xa9, 0xcc, 0xcb, 0x8a, 0x28, 0x44, 0x32, 0x32, 0x11, 0xa9, 0x0a, 0x52, 0x34, 0x13, 0xa1,
+ 0xef, 0xcc, 0xab, 0x9a, 0x08, 0x21, 0x23, 0x01, 0x88, 0x00, 0x22, 0x45, 0x35, 0x24, 0x81, 0xb9,
+ 0xdb, 0xbb, 0x9b, 0x30, 0x45, 0x33, 0x33, 0x12, 0xa8, 0xab, 0x51, 0x35, 0x23, 0x01, 0xf9, 0xdd,
+ 0xbc, 0xab, 0x89, 0x18, 0x22, 0x22, 0x81, 0x98, 0x00, 0x41, 0x54, 0x34, 0x24, 0x01, 0xa9, 0xbc,
+ 0xbc, 0x9b, 0x20, 0x44, 0x34, 0x22, 0x12, 0x90, 0xaa, 0x30, 0x55, 0x22, 0x01, 0xc9, 0xdf, 0xbc,
+ 0xaa, 0x8a, 0x08, 0x22, 0x23, 0x81, 0x98, 0x00, 0x32, 0x54, 0x45, 0x23, 0x82, 0xa9, 0xdb, 0xcb,
+ 0x9a, 0x28, 0x44, 0x33, 0x23, 0x13, 0x90, 0xab, 0x38, 0x37, 0x24, 0x01, 0xc9, 0xcf, 0xbd, 0xba,
+ 0x99, 0x00, 0x21, 0x23, 0x01, 0x89, 0x08, 0x21, 0x54, 0x35, 0x25, 0x01, 0xa8, 0xcb, 0xcb, 0xaa,
+ 0x10, 0x44, 0x33, 0x32, 0x23, 0x90, 0xab, 0x20, 0x37, 0x24, 0x11, 0xc9, 0xcf, 0xbd, 0xba, 0x8a,
+ 0x08, 0x21, 0x33, 0x81, 0x98, 0x08, 0x31, 0x45, 0x45, 0x23, 0x02, 0xa8, 0xbc, 0xbc, 0xaa, 0x29,
+ 0xfc, 0xf2, 0x38, 0x00, 0x36, 0x33, 0x23, 0x12, 0xb9, 0x8a, 0x63, 0x34, 0x32, 0x91, 0xed, 0xbe,
+ 0xbc, 0x9b, 0x89, 0x10, 0x23, 0x12, 0x80, 0x89, 0x18, 0x42, 0x55, 0x53, 0x22, 0x80, 0xba, 0xbc,
+ 0xbc, 0x8a, 0x30, 0x45, 0x23, 0x23, 0x11, 0x98, 0x8a, 0x52, 0x34, 0x23, 0x82, 0xfa, 0xcf, 0xcb,
+ 0x9a, 0x89, 0x10, 0x21, 0x12, 0x90, 0x88, 0x18, 0x32, 0x55, 0x34, 0x14, 0x81, 0xb9, 0xbc, 0xbc,
+ 0x8a, 0x30, 0x35, 0x34, 0x23, 0x02, 0xa8, 0x9a, 0x42, 0x45, 0x12, 0x81, 0xda, 0xcf, 0xbc, 0xaa,
+ 0x8a, 0x10, 0x31, 0x22, 0x80, 0x98, 0x10, 0x31, 0x55, 0x35, 0x33, 0x81, 0xb9, 0xdc, 0xbb, 0x8a,
+ 0x30, 0x35, 0x34, 0x22, 0x12, 0x98, 0x9a, 0x31, 0x37, 0x23, 0x01, 0xfa, 0xdd, 0xcb, 0xab, 0x99,
+ 0x00, 0x22, 0x13, 0x81, 0x89, 0x00, 0x32, 0x64, 0x44, 0x23, 0x01, 0xb9, 0xdb, 0xcb, 0x9a, 0x20,
+ 0x44, 0x33, 0x32, 0x12, 0x90, 0xab, 0x40, 0x45, 0x32, 0x01, 0xc9, 0xdf, 0xbc, 0xbb, 0x9a, 0x08,
+ 0x31, 0x32, 0x02, 0x98, 0x88, 0x20, 0x63, 0x54, 0x43, 0x23, 0x81, 0xba, 0xcc, 0xac, 0x9a, 0x28,
+ 0x63, 0x33, 0x23, 0x13, 0x91, 0xaa, 0x19, 0x54, 0x24, 0x13, 0x80, 0xed, 0xcd, 0xbb, 0xab, 0x89,
+ 0x10, 0x32, 0x23, 0x01, 0x89, 0x18, 0x31, 0x64, 0x54, 0x33, 0x02, 0x98, 0xcb, 0xcc, 0xaa, 0x89,
+ 0x32, 0x35, 0x24, 0x32, 0x11, 0xa8, 0x9b, 0x40, 0x35, 0x23, 0x02, 0xc9, 0xef, 0xbc, 0xbb, 0x9b,
+ 0x08, 0x30, 0x42, 0x11, 0x98, 0x89, 0x10, 0x42, 0x54, 0x44, 0x22, 0x81, 0xa9, 0xbc, 0xbb, 0xab,
+ 0x20, 0x55, 0x33, 0x33, 0x22, 0x91, 0xba, 0x1a, 0x64, 0x24, 0x11, 0x80, 0xfb, 0xce, 0xbb, 0xbb,
+ 0x89, 0x18, 0x42, 0x22, 0x00, 0x89, 0x09, 0x21, 0x44, 0x54, 0x33, 0x23, 0x98, 0xbc, 0xbd, 0xba,
+ 0x7e, 0xe5, 0x3b, 0x00, 0x18, 0x63, 0x43, 0x22, 0x22, 0x81, 0xaa, 0x0a, 0x53, 0x34, 0x22, 0x81,
+ 0xec, 0xce, 0xbc, 0xaa, 0x89, 0x00, 0x22, 0x23, 0x81, 0x98, 0x08, 0x21, 0x44, 0x45, 0x24, 0x13,
+ 0x88, 0xca, 0xcb, 0xbb, 0x9a, 0x41, 0x44, 0x33, 0x23, 0x12, 0x98, 0xaa, 0x38, 0x46, 0x23, 0x13,
+ 0xc8, 0xee, 0xcc, 0xba, 0x9a, 0x08, 0x10, 0x23, 0x12, 0x80, 0x89, 0x10, 0x32, 0x65, 0x34, 0x24,
+ 0x81, 0xa9, 0xcb, 0xcb, 0xab, 0x18, 0x53, 0x34, 0x32, 0x23, 0x81, 0xb9, 0x8a, 0x72, 0x43, 0x12,
+ 0x01, 0xfa, 0xcd, 0xbc, 0xbb, 0x99, 0x00, 0x22, 0x33, 0x82, 0x98, 0x88, 0x31, 0x73, 0x44, 0x34,
+ 0x12, 0x80, 0xba, 0xbd, 0xcb, 0x9a, 0x21, 0x45, 0x32, 0x23, 0x12, 0x98, 0xaa, 0x28, 0x45, 0x24,
+ 0x12, 0xa8, 0xee, 0xcc, 0xbb, 0xaa, 0x88, 0x10, 0x32, 0x23, 0x80, 0x89, 0x08, 0x32, 0x46, 0x45,
+ 0x32, 0x01, 0xa8, 0xcb, 0xcc, 0xaa, 0x09, 0x42, 0x34, 0x33, 0x22, 0x01, 0xa9, 0x8b, 0x61, 0x44,
+ 0x22, 0x01, 0xda, 0xde, 0xcb, 0xab, 0x89, 0x08, 0x11, 0x33, 0x02, 0x88, 0x89, 0x00, 0x32, 0x47,
+ 0x53, 0x33, 0x12, 0x98, 0xbc, 0xbd, 0xbb, 0x9a, 0x31, 0x36, 0x34, 0x32, 0x12, 0x81, 0xba, 0x0a,
+ 0x73, 0x33, 0x23, 0x01, 0xfa, 0xce, 0xcc, 0xaa, 0x9a, 0x08, 0x20, 0x22, 0x13, 0x80, 0x89, 0x08,
+ 0x22, 0x45, 0x45, 0x33, 0x13, 0x80, 0xcb, 0xcc, 0xba, 0xaa, 0x20, 0x35, 0x34, 0x33, 0x23, 0x81,
+ 0xb9, 0x9a, 0x62, 0x44, 0x22, 0x01, 0xc8, 0xde, 0xcc, 0xbb, 0x9a, 0x09, 0x10, 0x23, 0x23, 0x81,
+ 0x89, 0x08, 0x21, 0x44, 0x46, 0x34, 0x12, 0x80, 0xb9, 0xcc, 0xac, 0x9a, 0x18, 0x43, 0x34, 0x24,
+ 0x12, 0x01, 0xa8, 0x9a, 0x30, 0x46, 0x22, 0x12, 0xa8, 0xef, 0xbc, 0xbc, 0x9a, 0x89, 0x10, 0x22,
+ 0xf3, 0xd5, 0x3d, 0x00, 0x12, 0x88, 0x89, 0x18, 0x22, 0x55, 0x44, 0x33, 0x12, 0xa0, 0xcb, 0xcc,
+ 0xbb, 0x8a, 0x31, 0x45, 0x33, 0x32, 0x22, 0x81, 0xba, 0x0b, 0x73, 0x43, 0x22, 0x01, 0xd9, 0xcf,
+ 0xcc, 0xaa, 0x8a, 0x09, 0x10, 0x33, 0x12, 0x80, 0x99, 0x00, 0x22, 0x54, 0x44, 0x34, 0x13, 0x90,
+ 0xca, 0xbc, 0xcb, 0x9a, 0x28, 0x44, 0x43, 0x22, 0x22, 0x00, 0xaa, 0x8b, 0x51, 0x44, 0x22, 0x81,
+ 0xb8, 0xef, 0xcc, 0xba, 0x9a, 0x88, 0x11, 0x32, 0x23, 0x00, 0x98, 0x00, 0x12, 0x54, 0x35, 0x34,
+ 0x23, 0x80, 0xba, 0xbe, 0xac, 0xab, 0x18, 0x53, 0x34, 0x23, 0x23, 0x02, 0xa9, 0x9b, 0x40, 0x45,
+ 0x23, 0x12, 0xb8, 0xef, 0xcc, 0xbb, 0xaa, 0x89, 0x10, 0x32, 0x23, 0x01, 0x98, 0x88, 0x21, 0x63,
+ 0x45, 0x34, 0x23, 0x01, 0xb9, 0xbd, 0xbc, 0xbb, 0x19, 0x53, 0x34, 0x24, 0x22, 0x02, 0x98, 0x9b,
+ 0x38, 0x45, 0x43, 0x12, 0xa0, 0xed, 0xdc, 0xbb, 0xab, 0x89, 0x18, 0x31, 0x33, 0x02, 0x98, 0x88,
+ 0x20, 0x52, 0x55, 0x53, 0x22, 0x02, 0x99, 0xdb, 0xcb, 0xab, 0x09, 0x41, 0x34, 0x24, 0x23, 0x11,
+ 0x90, 0xab, 0x18, 0x55, 0x23, 0x12, 0xa0, 0xee, 0xbd, 0xbc, 0xaa, 0x88, 0x20, 0x32, 0x12, 0x90,
+ 0x89, 0x00, 0x22, 0x46, 0x54, 0x32, 0x01, 0xa8, 0xcb, 0xcb, 0xbb, 0x09, 0x53, 0x34, 0x33, 0x33,
+ 0x01, 0xaa, 0x8a, 0x52, 0x35, 0x23, 0x82, 0xea, 0xcf, 0xbc, 0xab, 0x9a, 0x08, 0x22, 0x33, 0x02,
+ 0x88, 0x88, 0x21, 0x53, 0x55, 0x34, 0x22, 0x80, 0xca, 0xbb, 0xad, 0x9a, 0x28, 0x44, 0x24, 0x23,
+ 0x11, 0x80, 0xba, 0x08, 0x54, 0x33, 0x13, 0xa0, 0xee, 0xcd, 0xbb, 0xab, 0x89, 0x11, 0x32, 0x23,
+ 0x90, 0x99, 0x18, 0x41, 0x54, 0x44, 0x43, 0x11, 0x98, 0xba, 0xbd, 0xba, 0x09, 0x43, 0x35, 0x33,
+ 0x71, 0x20, 0x3b, 0x00, 0x12, 0x90, 0xba, 0x09, 0x54, 0x24, 0x13, 0x90, 0xed, 0xcd, 0xbb, 0xab,
+ 0x89, 0x10, 0x32, 0x23, 0x01, 0x99, 0x08, 0x32, 0x46, 0x35, 0x34, 0x12, 0x99, 0xcb, 0xdb, 0xbb,
+ 0x89, 0x42, 0x44, 0x23, 0x22, 0x02, 0x99, 0xaa, 0x30, 0x46, 0x23, 0x11, 0xc9, 0xdf, 0xbc, 0xbb,
+ 0x9a, 0x08, 0x11, 0x24, 0x02, 0x90, 0x88, 0x10, 0x42, 0x54, 0x34, 0x33, 0x01, 0xba, 0xdc, 0xbb,
+ 0x9b, 0x18, 0x45, 0x33, 0x23, 0x23, 0x91, 0xaa, 0x0a, 0x45, 0x34, 0x22, 0x91, 0xfc, 0xdd, 0xab,
+ 0xab, 0x98, 0x00, 0x32, 0x23, 0x81, 0x88, 0x08, 0x30, 0x54, 0x45, 0x33, 0x13, 0x90, 0xbc, 0xbd,
+ 0xbb, 0x8a, 0x42, 0x44, 0x33, 0x32, 0x11, 0x98, 0xab, 0x30, 0x46, 0x33, 0x12, 0xc9, 0xdf, 0xbd,
+ 0xab, 0x9a, 0x09, 0x21, 0x32, 0x12, 0x80, 0x88, 0x18, 0x52, 0x54, 0x34, 0x24, 0x81, 0xa8, 0xbc,
+ 0xbc, 0xaa, 0x18, 0x44, 0x43, 0x23, 0x22, 0x81, 0xb9, 0x0a, 0x62, 0x24, 0x13, 0x91, 0xfb, 0xce,
+ 0xbc, 0x9a, 0x8a, 0x00, 0x22, 0x32, 0x00, 0x89, 0x09, 0x21, 0x63, 0x35, 0x25, 0x22, 0x88, 0xca,
+ 0xdb, 0xab, 0x8a, 0x31, 0x35, 0x24, 0x23, 0x11, 0x98, 0xab, 0x20, 0x46, 0x33, 0x12, 0xc9, 0xdf,
+ 0xdb, 0xaa, 0x8a, 0x09, 0x21, 0x23, 0x82, 0x99, 0x08, 0x20, 0x54, 0x44, 0x33, 0x13, 0xa8, 0xcc,
+ 0xac, 0xab, 0x08, 0x53, 0x34, 0x32, 0x22, 0x80, 0xaa, 0x19, 0x45, 0x33, 0x13, 0xb8, 0xff, 0xcc,
+ 0xba, 0x99, 0x08, 0x20, 0x32, 0x01, 0x88, 0x09, 0x20, 0x44, 0x35, 0x25, 0x12, 0x98, 0xca, 0xcb,
+ 0xab, 0x09, 0x53, 0x43, 0x33, 0x22, 0x81, 0xba, 0x19, 0x54, 0x24, 0x02, 0xa0, 0xde, 0xcd, 0xab,
+ 0x9a, 0x88, 0x21, 0x22, 0x02, 0x88, 0x88, 0x21, 0x43, 0x56, 0x33, 0x13, 0x98, 0xcb, 0xbc, 0xac,
+ 0xb8, 0xe9, 0x3d, 0x00, 0x20, 0x53, 0x23, 0x33, 0x12, 0xa8, 0x9a, 0x41, 0x45, 0x22, 0x01, 0xea,
+ 0xce, 0xbc, 0xab, 0x8a, 0x18, 0x31, 0x23, 0x00, 0x89, 0x08, 0x22, 0x55, 0x45, 0x32, 0x81, 0xa9,
+ 0xdb, 0xbb, 0x9b, 0x20, 0x45, 0x33, 0x33, 0x12, 0x98, 0x9b, 0x30, 0x47, 0x22, 0x01, 0xe9, 0xcd,
+ 0xbd, 0xba, 0x89, 0x08, 0x22, 0x23, 0x01, 0x89, 0x08, 0x22, 0x45, 0x45, 0x23, 0x02, 0xb9, 0xdb,
+ 0xbb, 0x9c, 0x28, 0x44, 0x33, 0x33, 0x22, 0x98, 0xbb, 0x40, 0x45, 0x22, 0x02, 0xd9, 0xcf, 0xbc,
+ 0xbb, 0x8a, 0x08, 0x22, 0x14, 0x81, 0x98, 0x08, 0x21, 0x44, 0x45, 0x32, 0x02, 0xa9, 0xcc, 0xbb,
+ 0xab, 0x20, 0x45, 0x43, 0x22, 0x12, 0x80, 0x99, 0x20, 0x54, 0x23, 0x02, 0xc9, 0xdf, 0xcc, 0xaa,
+ 0x99, 0x08, 0x21, 0x22, 0x81, 0x88, 0x08, 0x21, 0x63, 0x54, 0x32, 0x02, 0xa8, 0xdb, 0xcb, 0x9a,
+ 0x08, 0x53, 0x43, 0x32, 0x21, 0x88, 0x9a, 0x29, 0x54, 0x23, 0x12, 0xc8, 0xee, 0xbc, 0xac, 0x99,
+ 0x08, 0x11, 0x22, 0x01, 0x90, 0x08, 0x11, 0x44, 0x54, 0x33, 0x12, 0xa8, 0xdb, 0xcb, 0xaa, 0x19,
+ 0x53, 0x24, 0x23, 0x22, 0x80, 0xb9, 0x19, 0x54, 0x24, 0x02, 0xa8, 0xdf, 0xbc, 0xbc, 0x99, 0x88,
+ 0x21, 0x32, 0x01, 0x88, 0x09, 0x11, 0x53, 0x45, 0x34, 0x12, 0xa8, 0xcb, 0xbc, 0xab, 0x38, 0x54,
+ 0x23, 0x23, 0x12, 0xa8, 0x8a, 0x52, 0x34, 0x32, 0x91, 0xee, 0xcd, 0xbb, 0x9a, 0x09, 0x21, 0x22,
+ 0x02, 0x98, 0x08, 0x22, 0x54, 0x54, 0x23, 0x01, 0xa9, 0xbc, 0xad, 0x8a, 0x30, 0x44, 0x23, 0x23,
+ 0x82, 0xa9, 0x09, 0x63, 0x43, 0x12, 0xb0, 0xdf, 0xcc, 0xab, 0x99, 0x08, 0x31, 0x22, 0x81, 0x98,
+ 0x00, 0x32, 0x55, 0x34, 0x33, 0x91, 0xca, 0xcc, 0xba, 0x09, 0x42, 0x34, 0x33, 0x23, 0x80, 0xab,
+ 0x6c, 0x1d, 0x35, 0x00, 0x52, 0x34, 0x23, 0xa1, 0xef, 0xbc, 0xbc, 0x9a, 0x09, 0x11, 0x23, 0x01,
+ 0x98, 0x08, 0x22, 0x54, 0x35, 0x34, 0x81, 0xb8, 0xdb, 0xbb, 0x8a, 0x41, 0x35, 0x33, 0x32, 0x01,
+ 0xa9, 0x0b, 0x73, 0x33, 0x12, 0xb8, 0xff, 0xbc, 0xbb, 0x99, 0x18, 0x31, 0x22, 0x80, 0x98, 0x00,
+ 0x42, 0x45, 0x25, 0x23, 0x80, 0xbb, 0xbd, 0xbb, 0x0a, 0x63, 0x43, 0x22, 0x22, 0x80, 0xaa, 0x28,
+ 0x45, 0x33, 0x11, 0xfa, 0xdd, 0xcb, 0xaa, 0x89, 0x10, 0x22, 0x11, 0x80, 0x09, 0x20, 0x52, 0x44,
+ 0x34, 0x12, 0x98, 0xcb, 0xbc, 0xab, 0x18, 0x44, 0x24, 0x23, 0x22, 0x98, 0x9a, 0x40, 0x35, 0x23,
+ 0x81, 0xfc, 0xcd, 0xac, 0x9a, 0x88, 0x20, 0x22, 0x01, 0x88, 0x08, 0x20, 0x52, 0x35, 0x25, 0x02,
+ 0xa9, 0xcb, 0xcb, 0x9a, 0x30, 0x44, 0x33, 0x33, 0x11, 0xb9, 0x0a, 0x72, 0x33, 0x22, 0xa0, 0xef,
+ 0xcc, 0xbb, 0x99, 0x08, 0x30, 0x32, 0x00, 0x99, 0x10, 0x31, 0x54, 0x45, 0x13, 0x81, 0xb9, 0xcc,
+ 0xab, 0x89, 0x42, 0x34, 0x33, 0x33, 0x81, 0xaa, 0x19, 0x55, 0x23, 0x12, 0xd8, 0xee, 0xcb, 0xaa,
+ 0x99, 0x00, 0x22, 0x13, 0x80, 0x89, 0x10, 0x32, 0x56, 0x43, 0x12, 0x90, 0xba, 0xbd, 0xab, 0x09,
+ 0x44, 0x43, 0x22, 0x13, 0x90, 0x9a, 0x38, 0x36, 0x33, 0x81, 0xfb, 0xcf, 0xcb, 0x9a, 0x89, 0x18,
+ 0x32, 0x11, 0x88, 0x89, 0x20, 0x53, 0x54, 0x33, 0x02, 0xa8, 0xcc, 0xbb, 0x9a, 0x52, 0x34, 0x33,
+ 0x23, 0x91, 0xa9, 0x28, 0x54, 0x23, 0x02, 0xfc, 0xcd, 0xac, 0x9a, 0x09, 0x11, 0x12, 0x01, 0x98,
+ 0x00, 0x31, 0x45, 0x35, 0x22, 0x88, 0xca, 0xcb, 0xbb, 0x28, 0x44, 0x33, 0x24, 0x01, 0x98, 0x09,
+ 0x52, 0x24, 0x12, 0xb8, 0xef, 0xbc, 0xab, 0x8a, 0x18, 0x22, 0x13, 0x88, 0x08, 0x20, 0x53, 0x55,
+ 0x86, 0x0b, 0x41, 0x00, 0x13, 0x90, 0xca, 0xbb, 0x9c, 0x18, 0x53, 0x33, 0x24, 0x01, 0x98, 0x09,
+ 0x42, 0x35, 0x12, 0xc9, 0xde, 0xbc, 0xbb, 0x8a, 0x10, 0x22, 0x13, 0x90, 0x88, 0x30, 0x44, 0x45,
+ 0x33, 0x02, 0xa9, 0xbd, 0xbc, 0x8a, 0x42, 0x34, 0x33, 0x23, 0x91, 0xaa, 0x30, 0x37, 0x23, 0x01,
+ 0xed, 0xdd, 0xba, 0x9a, 0x88, 0x11, 0x22, 0x01, 0x89, 0x00, 0x32, 0x55, 0x34, 0x23, 0x98, 0xcb,
+ 0xbc, 0xbb, 0x28, 0x45, 0x23, 0x33, 0x02, 0x99, 0x09, 0x63, 0x24, 0x02, 0xb8, 0xef, 0xbc, 0xab,
+ 0x8a, 0x10, 0x22, 0x12, 0x90, 0x88, 0x21, 0x54, 0x34, 0x25, 0x01, 0xa9, 0xdb, 0xab, 0x0a, 0x41,
+ 0x34, 0x33, 0x23, 0x91, 0xab, 0x40, 0x54, 0x22, 0x91, 0xec, 0xcd, 0xcb, 0xa9, 0x08, 0x11, 0x12,
+ 0x01, 0x98, 0x08, 0x32, 0x64, 0x43, 0x22, 0x98, 0xca, 0xbc, 0x9b, 0x28, 0x44, 0x24, 0x23, 0x01,
+ 0x98, 0x09, 0x53, 0x43, 0x22, 0xc8, 0xcf, 0xad, 0xab, 0x89, 0x00, 0x22, 0x02, 0x80, 0x89, 0x11,
+ 0x63, 0x44, 0x33, 0x01, 0xaa, 0xcc, 0xcb, 0x09, 0x41, 0x33, 0x24, 0x22, 0x90, 0x99, 0x30, 0x36,
+ 0x23, 0x80, 0xfc, 0xce, 0xba, 0x9a, 0x08, 0x20, 0x22, 0x81, 0x88, 0x18, 0x32, 0x46, 0x34, 0x13,
+ 0x90, 0xdb, 0xbb, 0x9c, 0x28, 0x34, 0x34, 0x23, 0x02, 0xa9, 0x09, 0x54, 0x33, 0x12, 0xe9, 0xce,
+ 0xbc, 0xbb, 0x89, 0x10, 0x32, 0x02, 0x90, 0x88, 0x21, 0x45, 0x54, 0x32, 0x81, 0xa9, 0xcc, 0xab,
+ 0x0a, 0x43, 0x34, 0x33, 0x13, 0x98, 0x8a, 0x62, 0x43, 0x12, 0xc8, 0xdf, 0xcb, 0x9b, 0x89, 0x10,
+ 0x22, 0x11, 0x89, 0x00, 0x22, 0x45, 0x44, 0x12, 0x98, 0xbb, 0xbd, 0x9a, 0x31, 0x44, 0x43, 0x12,
+ 0x80, 0x89, 0x30, 0x35, 0x23, 0xa1, 0xef, 0xbc, 0xbc, 0x89, 0x18, 0x11, 0x12, 0x80, 0x08, 0x30,
+ 0xb8, 0xe6, 0x38, 0x00, 0x45, 0x34, 0x12, 0x98, 0xbc, 0xad, 0x8a, 0x32, 0x35, 0x23, 0x23, 0x98,
+ 0x8a, 0x42, 0x35, 0x23, 0xb8, 0xff, 0xcb, 0xab, 0x99, 0x10, 0x22, 0x01, 0x80, 0x09, 0x21, 0x45,
+ 0x44, 0x22, 0x90, 0xca, 0xcb, 0xaa, 0x20, 0x34, 0x34, 0x22, 0x82, 0x9a, 0x28, 0x36, 0x32, 0x82,
+ 0xfc, 0xce, 0xba, 0x9a, 0x18, 0x21, 0x12, 0x80, 0x08, 0x20, 0x62, 0x34, 0x34, 0x81, 0xb9, 0xbd,
+ 0xab, 0x1a, 0x53, 0x34, 0x32, 0x11, 0x98, 0x0a, 0x53, 0x24, 0x02, 0xe9, 0xce, 0xbc, 0xaa, 0x89,
+ 0x11, 0x22, 0x01, 0x88, 0x00, 0x32, 0x56, 0x33, 0x13, 0xa8, 0xeb, 0xbb, 0x9a, 0x41, 0x34, 0x24,
+ 0x22, 0x88, 0x99, 0x30, 0x36, 0x13, 0xb0, 0xef, 0xbc, 0xab, 0x8a, 0x00, 0x32, 0x02, 0x90, 0x00,
+ 0x21, 0x64, 0x34, 0x14, 0x90, 0xb9, 0xad, 0x9b, 0x10, 0x44, 0x33, 0x23, 0x81, 0xa9, 0x18, 0x45,
+ 0x33, 0x92, 0xfc, 0xcd, 0xbb, 0x9a, 0x08, 0x31, 0x12, 0x81, 0x09, 0x20, 0x52, 0x54, 0x33, 0x02,
+ 0xba, 0xcc, 0xac, 0x08, 0x42, 0x43, 0x32, 0x01, 0x98, 0x08, 0x42, 0x34, 0x13, 0xea, 0xcf, 0xcb,
+ 0xaa, 0x88, 0x10, 0x22, 0x01, 0x98, 0x00, 0x33, 0x46, 0x43, 0x12, 0x98, 0xbc, 0xbc, 0x8a, 0x41,
+ 0x43, 0x33, 0x23, 0x90, 0x8a, 0x42, 0x44, 0x22, 0xa1, 0xef, 0xdb, 0xba, 0x89, 0x10, 0x21, 0x11,
+ 0x88, 0x88, 0x21, 0x54, 0x34, 0x23, 0x91, 0xcb, 0xcc, 0x9a, 0x28, 0x34, 0x33, 0x24, 0x81, 0xa9,
+ 0x28, 0x35, 0x24, 0x81, 0xfb, 0xbf, 0xac, 0x9a, 0x18, 0x20, 0x02, 0x00, 0x89, 0x10, 0x44, 0x34,
+ 0x24, 0x80, 0xba, 0xbd, 0xaa, 0x20, 0x44, 0x24, 0x13, 0x00, 0x09, 0x30, 0x54, 0x22, 0xb0, 0xdf,
+ 0xbc, 0xab, 0x8a, 0x11, 0x22, 0x81, 0x88, 0x18, 0x52, 0x44, 0x24, 0x02, 0xb8, 0xbc, 0xac, 0x19,
+ 0xc0, 0xf0, 0x3c, 0x00, 0x34, 0x34, 0x11, 0x80, 0x89, 0x31, 0x36, 0x12, 0xe9, 0xdd, 0xcb, 0xaa,
+ 0x09, 0x11, 0x12, 0x01, 0x89, 0x10, 0x53, 0x35, 0x24, 0x00, 0xba, 0xbc, 0xab, 0x18, 0x54, 0x33,
+ 0x33, 0x80, 0x89, 0x20, 0x46, 0x22, 0xa8, 0xfd, 0xdb, 0xba, 0x89, 0x10, 0x12, 0x11, 0x88, 0x08,
+ 0x32, 0x36, 0x25, 0x12, 0xa8, 0xbc, 0xac, 0x09, 0x42, 0x34, 0x32, 0x01, 0x98, 0x19, 0x63, 0x24,
+ 0x81, 0xec, 0xbd, 0xbc, 0x99, 0x00, 0x21, 0x02, 0x80, 0x88, 0x21, 0x45, 0x34, 0x13, 0xa0, 0xcb,
+ 0xad, 0x8a, 0x30, 0x35, 0x33, 0x13, 0x98, 0x09, 0x62, 0x33, 0x03, 0xfa, 0xce, 0xac, 0x9b, 0x88,
+ 0x21, 0x21, 0x80, 0x08, 0x10, 0x53, 0x35, 0x24, 0x80, 0xb9, 0xcc, 0x9a, 0x28, 0x44, 0x32, 0x12,
+ 0x91, 0x89, 0x31, 0x35, 0x24, 0xb0, 0xef, 0xbc, 0xaa, 0x89, 0x11, 0x12, 0x81, 0x80, 0x18, 0x41,
+ 0x45, 0x33, 0x02, 0xc9, 0xdb, 0xaa, 0x08, 0x43, 0x34, 0x22, 0x01, 0x89, 0x10, 0x35, 0x24, 0x90,
+ 0xee, 0xbc, 0xac, 0x8a, 0x18, 0x21, 0x01, 0x80, 0x08, 0x31, 0x46, 0x24, 0x12, 0x98, 0xcb, 0xbb,
+ 0x0a, 0x43, 0x35, 0x33, 0x02, 0x99, 0x09, 0x53, 0x34, 0x12, 0xfb, 0xce, 0xbb, 0xab, 0x00, 0x12,
+ 0x12, 0x80, 0x88, 0x20, 0x54, 0x44, 0x22, 0x80, 0xca, 0xcb, 0x9a, 0x21, 0x44, 0x33, 0x22, 0x88,
+ 0x89, 0x41, 0x44, 0x13, 0xd9, 0xce, 0xbc, 0xab, 0x09, 0x11, 0x22, 0x01, 0x88, 0x18, 0x53, 0x35,
+ 0x34, 0x01, 0xba, 0xbd, 0xab, 0x18, 0x73, 0x23, 0x13, 0x81, 0x99, 0x20, 0x54, 0x22, 0xa0, 0xed,
+ 0xcc, 0xbb, 0x89, 0x10, 0x21, 0x01, 0x88, 0x18, 0x31, 0x54, 0x53, 0x22, 0x80, 0xba, 0xdb, 0xbb,
+ 0x0a, 0x53, 0x34, 0x32, 0x22, 0x91, 0x9a, 0x28, 0x45, 0x33, 0x02, 0xf9, 0xce, 0xbc, 0xaa, 0x8a,
+ 0x86, 0xbf, 0x41, 0x00, 0x11, 0x13, 0x01, 0x98, 0x08, 0x21, 0x54, 0x35, 0x24, 0x81, 0xa9, 0xbc,
+ 0xac, 0x8a, 0x41, 0x43, 0x33, 0x33, 0x81, 0xa9, 0x09, 0x64, 0x23, 0x12, 0xc9, 0xcf, 0xbd, 0xab,
+ 0x9a, 0x00, 0x22, 0x23, 0x00, 0x88, 0x10, 0x42, 0x55, 0x43, 0x13, 0x91, 0xba, 0xbd, 0xbb, 0x09,
+ 0x53, 0x34, 0x33, 0x23, 0x90, 0xab, 0x38, 0x37, 0x33, 0x01, 0xf9, 0xce, 0xbc, 0x9b, 0x8a, 0x10,
+ 0x22, 0x12, 0x80, 0x89, 0x10, 0x53, 0x54, 0x24, 0x12, 0xa8, 0xcb, 0xdb, 0x9a, 0x18, 0x34, 0x34,
+ 0x23, 0x12, 0x90, 0x9a, 0x51, 0x35, 0x22, 0x80, 0xfb, 0xce, 0xbb, 0x9b, 0x89, 0x21, 0x22, 0x02,
+ 0x98, 0x08, 0x20, 0x45, 0x35, 0x24, 0x02, 0xa9, 0xcc, 0xab, 0x9b, 0x21, 0x45, 0x33, 0x22, 0x02,
+ 0xa9, 0x09, 0x44, 0x34, 0x11, 0x90, 0xef, 0xcc, 0xba, 0x99, 0x08, 0x11, 0x13, 0x01, 0x88, 0x18,
+ 0x31, 0x54, 0x35, 0x14, 0x81, 0xaa, 0xbc, 0xbb, 0x89, 0x42, 0x35, 0x33, 0x24, 0x80, 0x99, 0x19,
+ 0x35, 0x24, 0x02, 0xc8, 0xdf, 0xbc, 0xab, 0x99, 0x10, 0x31, 0x22, 0x90, 0x08, 0x00, 0x42, 0x46,
+ 0x43, 0x22, 0x98, 0xca, 0xcb, 0xab, 0x08, 0x53, 0x34, 0x32, 0x12, 0x80, 0xaa, 0x30, 0x46, 0x22,
+ 0x81, 0xfb, 0xdd, 0xbb, 0xaa, 0x89, 0x20, 0x22, 0x12, 0x98, 0x09, 0x11, 0x44, 0x36, 0x34, 0x02,
+ 0xa8, 0xcb, 0xbc, 0xab, 0x20, 0x45, 0x33, 0x23, 0x11, 0x98, 0x8a, 0x52, 0x44, 0x12, 0x98, 0xfc,
+ 0xcc, 0xac, 0x9a, 0x08, 0x11, 0x22, 0x01, 0x98, 0x08, 0x21, 0x54, 0x44, 0x23, 0x00, 0xa9, 0xbc,
+ 0xbc, 0x8a, 0x41, 0x53, 0x32, 0x22, 0x01, 0xaa, 0x19, 0x44, 0x34, 0x12, 0xb9, 0xff, 0xcb, 0xab,
+ 0x8a, 0x08, 0x21, 0x22, 0x81, 0x99, 0x08, 0x32, 0x64, 0x53, 0x33, 0x81, 0xa9, 0xbd, 0xbc, 0x9a,
+ 0x6f, 0xe1, 0x3b, 0x00, 0x42, 0x44, 0x22, 0x12, 0x81, 0x98, 0x09, 0x63, 0x33, 0x12, 0x90, 0xfd,
+ 0xcd, 0xba, 0x9a, 0x88, 0x20, 0x31, 0x01, 0x80, 0x88, 0x10, 0x53, 0x45, 0x43, 0x12, 0x80, 0xca,
+ 0xcb, 0xbb, 0x0a, 0x42, 0x44, 0x23, 0x23, 0x81, 0xa9, 0x8a, 0x53, 0x35, 0x12, 0x80, 0xfc, 0xcd,
+ 0xbb, 0xaa, 0x09, 0x10, 0x23, 0x13, 0x90, 0x88, 0x11, 0x43, 0x55, 0x34, 0x23, 0x80, 0xca, 0xdb,
+ 0xba, 0x89, 0x41, 0x34, 0x33, 0x23, 0x02, 0xa9, 0x0a, 0x62, 0x34, 0x23, 0x81, 0xfd, 0xcc, 0xac,
+ 0x9b, 0x89, 0x10, 0x32, 0x12, 0x88, 0x88, 0x10, 0x32, 0x56, 0x53, 0x22, 0x80, 0xba, 0xbc, 0xac,
+ 0x8a, 0x41, 0x53, 0x32, 0x22, 0x11, 0x99, 0x8b, 0x52, 0x34, 0x23, 0x91, 0xfc, 0xbe, 0xad, 0xaa,
+ 0x98, 0x10, 0x22, 0x12, 0x80, 0x88, 0x00, 0x32, 0x46, 0x34, 0x14, 0x81, 0xaa, 0xbc, 0xbc, 0x8a,
+ 0x40, 0x44, 0x22, 0x22, 0x12, 0xa8, 0x8a, 0x41, 0x35, 0x22, 0x82, 0xfb, 0xcf, 0xbb, 0xaa, 0x99,
+ 0x11, 0x32, 0x22, 0x88, 0x98, 0x10, 0x52, 0x44, 0x35, 0x23, 0x81, 0xca, 0xdb, 0xab, 0x9a, 0x21,
+ 0x35, 0x34, 0x32, 0x02, 0x98, 0x8b, 0x50, 0x34, 0x23, 0x01, 0xfa, 0xcf, 0xbc, 0x9a, 0x89, 0x18,
+ 0x21, 0x12, 0x80, 0x09, 0x18, 0x31, 0x65, 0x34, 0x23, 0x01, 0xb9, 0xcc, 0xab, 0x9a, 0x31, 0x45,
+ 0x33, 0x33, 0x11, 0xa8, 0x9b, 0x50, 0x44, 0x13, 0x01, 0xea, 0xce, 0xcc, 0xaa, 0x89, 0x18, 0x21,
+ 0x12, 0x81, 0x88, 0x08, 0x21, 0x54, 0x35, 0x24, 0x01, 0xa9, 0xdb, 0xbb, 0x9b, 0x20, 0x35, 0x34,
+ 0x33, 0x21, 0x98, 0xaa, 0x40, 0x35, 0x24, 0x01, 0xd9, 0xde, 0xbc, 0xba, 0x99, 0x18, 0x31, 0x23,
+ 0x81, 0x89, 0x18, 0x31, 0x55, 0x34, 0x25, 0x01, 0x99, 0xcb, 0xcb, 0x9a, 0x18, 0x44, 0x33, 0x33,
+ 0x6c, 0x20, 0x39, 0x00, 0x01, 0xb8, 0x8a, 0x52, 0x35, 0x22, 0x82, 0xe9, 0xde, 0xcb, 0xab, 0x9a,
+ 0x08, 0x22, 0x32, 0x11, 0x98, 0x89, 0x21, 0x53, 0x45, 0x34, 0x23, 0x81, 0xbb, 0xcd, 0xbb, 0x9b,
+ 0x30, 0x45, 0x33, 0x33, 0x22, 0x90, 0xba, 0x29, 0x46, 0x24, 0x11, 0x90, 0xfc, 0xcd, 0xbb, 0xaa,
+ 0x89, 0x20, 0x32, 0x22, 0x80, 0x09, 0x18, 0x31, 0x64, 0x54, 0x23, 0x12, 0xa8, 0xcb, 0xbc, 0xab,
+ 0x09, 0x43, 0x35, 0x33, 0x33, 0x02, 0xa8, 0x9a, 0x51, 0x45, 0x22, 0x00, 0xc9, 0xcf, 0xcc, 0xab,
+ 0x99, 0x08, 0x11, 0x23, 0x02, 0x98, 0x89, 0x10, 0x43, 0x55, 0x43, 0x23, 0x00, 0xba, 0xbd, 0xbc,
+ 0xaa, 0x10, 0x54, 0x23, 0x33, 0x22, 0x90, 0xba, 0x19, 0x55, 0x23, 0x13, 0x91, 0xfc, 0xcd, 0xbc,
+ 0x9a, 0x89, 0x10, 0x32, 0x22, 0x00, 0x89, 0x09, 0x10, 0x54, 0x45, 0x23, 0x12, 0x98, 0xdb, 0xcb,
+ 0xab, 0x0a, 0x41, 0x44, 0x32, 0x32, 0x11, 0xa8, 0x9a, 0x40, 0x35, 0x14, 0x02, 0xb9, 0xff, 0xcb,
+ 0xab, 0x9a, 0x08, 0x11, 0x23, 0x12, 0x88, 0x89, 0x10, 0x43, 0x45, 0x44, 0x23, 0x81, 0xa9, 0xcc,
+ 0xbb, 0xab, 0x28, 0x54, 0x24, 0x22, 0x22, 0x80, 0xa9, 0x09, 0x44, 0x24, 0x22, 0x80, 0xfb, 0xbf,
+ 0xbc, 0xab, 0x99, 0x10, 0x22, 0x33, 0x81, 0x89, 0x09, 0x21, 0x45, 0x45, 0x43, 0x11, 0x90, 0xca,
+ 0xcb, 0xba, 0x89, 0x41, 0x34, 0x24, 0x23, 0x11, 0x98, 0x99, 0x38, 0x55, 0x32, 0x02, 0xb8, 0xff,
+ 0xcb, 0xac, 0x99, 0x08, 0x10, 0x22, 0x11, 0x88, 0x09, 0x18, 0x32, 0x55, 0x53, 0x23, 0x01, 0xa9,
+ 0xdb, 0xac, 0xab, 0x18, 0x53, 0x34, 0x32, 0x22, 0x81, 0xa9, 0x89, 0x53, 0x35, 0x22, 0x81, 0xfb,
+ 0xce, 0xbc, 0xaa, 0x99, 0x00, 0x22, 0x32, 0x01, 0x88, 0x88, 0x21, 0x63, 0x35, 0x35, 0x12, 0x90,
+ 0x8a, 0x17, 0x3a, 0x00, 0xcb, 0xac, 0xab, 0x09, 0x44, 0x43, 0x22, 0x23, 0x00, 0xaa, 0x8a, 0x52,
+ 0x34, 0x23, 0x01, 0xe9, 0xde, 0xcc, 0xab, 0x9a, 0x88, 0x20, 0x32, 0x12, 0x80, 0x89, 0x08, 0x21,
+ 0x55, 0x54, 0x32, 0x13, 0x80, 0xba, 0xbd, 0xab, 0xab, 0x20, 0x55, 0x33, 0x23, 0x22, 0x82, 0xb9,
+ 0x9a, 0x51, 0x35, 0x24, 0x11, 0xb9, 0xff, 0xcb, 0xbb, 0xaa, 0x89, 0x11, 0x32, 0x23, 0x01, 0x89,
+ 0x08, 0x21, 0x54, 0x45, 0x43, 0x13, 0x81, 0xb9, 0xcc, 0xcb, 0xaa, 0x18, 0x53, 0x43, 0x23, 0x22,
+ 0x02, 0xa9, 0xaa, 0x31, 0x37, 0x24, 0x02, 0xb0, 0xde, 0xcd, 0xbb, 0xaa, 0x8a, 0x10, 0x32, 0x33,
+ 0x01, 0x98, 0x08, 0x21, 0x44, 0x55, 0x43, 0x23, 0x00, 0xb8, 0xeb, 0xbb, 0xab, 0x09, 0x53, 0x34,
+ 0x43, 0x22, 0x12, 0xa8, 0xba, 0x28, 0x46, 0x32, 0x12, 0x90, 0xfc, 0xbe, 0xbc, 0x9b, 0x8a, 0x18,
+ 0x31, 0x33, 0x11, 0x99, 0x88, 0x10, 0x52, 0x54, 0x44, 0x32, 0x01, 0xa8, 0xbc, 0xbc, 0xac, 0x89,
+ 0x41, 0x34, 0x33, 0x43, 0x21, 0x98, 0xaa, 0x09, 0x54, 0x33, 0x23, 0x80, 0xfc, 0xcd, 0xcc, 0x9a,
+ 0x99, 0x08, 0x21, 0x32, 0x11, 0x88, 0x09, 0x10, 0x32, 0x54, 0x35, 0x34, 0x12, 0x98, 0xcb, 0xbc,
+ 0xac, 0x99, 0x31, 0x44, 0x33, 0x24, 0x11, 0x81, 0xaa, 0x8a, 0x63, 0x34, 0x12, 0x81, 0xda, 0xcf,
+ 0xbd, 0xab, 0x8a, 0x09, 0x20, 0x23, 0x13, 0x80, 0x9a, 0x00, 0x32, 0x46, 0x44, 0x24, 0x12, 0x90,
+ 0xcb, 0xcb, 0xbb, 0x9a, 0x31, 0x45, 0x24, 0x23, 0x32, 0x01, 0xa8, 0x8a, 0x52, 0x34, 0x22, 0x02,
+ 0xfa, 0xdd, 0xbc, 0xac, 0xaa, 0x88, 0x11, 0x32, 0x22, 0x80, 0x98, 0x08, 0x30, 0x54, 0x35, 0x35,
+ 0x22, 0x80, 0xca, 0xcb, 0xcb, 0x9a, 0x18, 0x53, 0x34, 0x22, 0x13, 0x02, 0xa9, 0x9a, 0x40, 0x35,
+ 0x4d, 0x31, 0x37, 0x00, 0x23, 0x80, 0xdd, 0xce, 0xbc, 0xbb, 0x99, 0x08, 0x21, 0x33, 0x13, 0x90,
+ 0x89, 0x10, 0x42, 0x45, 0x45, 0x23, 0x12, 0xa8, 0xca, 0xbc, 0xac, 0x8a, 0x20, 0x44, 0x43, 0x22,
+ 0x22, 0x01, 0xa9, 0x9b, 0x30, 0x46, 0x23, 0x13, 0x91, 0xfc, 0xcd, 0xbc, 0xab, 0x9a, 0x08, 0x11,
+ 0x43, 0x12, 0x81, 0x89, 0x88, 0x20, 0x53, 0x45, 0x43, 0x33, 0x01, 0xb8, 0xcc, 0xcb, 0xbb, 0x8a,
+ 0x30, 0x45, 0x43, 0x22, 0x22, 0x81, 0xb8, 0xaa, 0x40, 0x54, 0x32, 0x22, 0x98, 0xdd, 0xce, 0xcb,
+ 0xba, 0x99, 0x08, 0x11, 0x33, 0x22, 0x81, 0x98, 0x08, 0x20, 0x54, 0x35, 0x35, 0x33, 0x11, 0xa9,
+ 0xcc, 0xbb, 0xbc, 0x8a, 0x31, 0x54, 0x43, 0x22, 0x22, 0x01, 0xa9, 0xab, 0x40, 0x44, 0x33, 0x23,
+ 0xa0, 0xde, 0xbe, 0xbd, 0xbb, 0x99, 0x08, 0x20, 0x43, 0x12, 0x88, 0x88, 0x88, 0x11, 0x42, 0x36,
+ 0x26, 0x33, 0x01, 0xb9, 0xcc, 0xbb, 0xbc, 0x99, 0x41, 0x44, 0x33, 0x22, 0x22, 0x12, 0xa9, 0x9a,
+ 0x41, 0x46, 0x22, 0x01, 0xa0, 0xdd, 0xbe, 0xbc, 0xbb, 0x9a, 0x88, 0x31, 0x33, 0x14, 0x80, 0x98,
+ 0x88, 0x21, 0x44, 0x45, 0x34, 0x23, 0x82, 0xb8, 0xcc, 0xbc, 0xba, 0x8a, 0x40, 0x34, 0x25, 0x23,
+ 0x21, 0x01, 0xa9, 0xaa, 0x31, 0x46, 0x23, 0x22, 0x98, 0xde, 0xcd, 0xbc, 0xab, 0x9a, 0x08, 0x21,
+ 0x43, 0x22, 0x90, 0x98, 0x00, 0x11, 0x53, 0x45, 0x43, 0x33, 0x01, 0xb8, 0xcc, 0xcb, 0xbb, 0x89,
+ 0x31, 0x46, 0x32, 0x22, 0x22, 0x81, 0xa9, 0x9b, 0x41, 0x35, 0x25, 0x12, 0x98, 0xfc, 0xcc, 0xbc,
+ 0xab, 0x99, 0x08, 0x21, 0x43, 0x12, 0x88, 0x98, 0x08, 0x11, 0x44, 0x54, 0x43, 0x22, 0x01, 0xa9,
+ 0xdb, 0xdb, 0xba, 0x89, 0x31, 0x44, 0x43, 0x22, 0x22, 0x00, 0xaa, 0x8b, 0x51, 0x34, 0x33, 0x13,
+ 0x85, 0x3a, 0x33, 0x00, 0xfa, 0xdd, 0xbc, 0xac, 0xaa, 0x88, 0x00, 0x32, 0x23, 0x02, 0x88, 0x89,
+ 0x20, 0x53, 0x54, 0x53, 0x33, 0x12, 0x90, 0xca, 0xdb, 0xbb, 0xab, 0x29, 0x73, 0x33, 0x24, 0x12,
+ 0x02, 0x90, 0xab, 0x09, 0x73, 0x33, 0x23, 0x01, 0xda, 0xcf, 0xcc, 0xcb, 0x9a, 0x99, 0x00, 0x21,
+ 0x32, 0x12, 0x80, 0x99, 0x88, 0x20, 0x53, 0x45, 0x53, 0x33, 0x13, 0xa0, 0xcb, 0xac, 0xbc, 0xab,
+ 0x89, 0x53, 0x44, 0x33, 0x33, 0x13, 0x82, 0xb8, 0xac, 0x19, 0x54, 0x43, 0x12, 0x01, 0xda, 0xde,
+ 0xbc, 0xcb, 0xaa, 0x98, 0x00, 0x21, 0x33, 0x23, 0x80, 0x99, 0x00, 0x20, 0x53, 0x55, 0x34, 0x24,
+ 0x12, 0x90, 0xba, 0xbd, 0xbc, 0xbb, 0x08, 0x42, 0x44, 0x33, 0x24, 0x12, 0x81, 0xa8, 0xab, 0x20,
+ 0x46, 0x33, 0x22, 0x81, 0xda, 0xde, 0xbd, 0xac, 0x9b, 0x89, 0x18, 0x31, 0x33, 0x12, 0x80, 0x98,
+ 0x08, 0x20, 0x44, 0x45, 0x44, 0x23, 0x12, 0x90, 0xbb, 0xcd, 0xbb, 0xbb, 0x09, 0x53, 0x34, 0x34,
+ 0x23, 0x22, 0x01, 0xb9, 0xbb, 0x38, 0x46, 0x43, 0x22, 0x01, 0xea, 0xce, 0xcc, 0xba, 0xaa, 0x89,
+ 0x18, 0x21, 0x43, 0x12, 0x80, 0x89, 0x88, 0x10, 0x43, 0x55, 0x53, 0x33, 0x12, 0x98, 0xca, 0xbc,
+ 0xcc, 0x9a, 0x09, 0x32, 0x35, 0x34, 0x22, 0x22, 0x01, 0xb9, 0x9c, 0x30, 0x54, 0x32, 0x23, 0x00,
+ 0xeb, 0xce, 0xbd, 0xac, 0xaa, 0x98, 0x10, 0x21, 0x33, 0x13, 0x91, 0x89, 0x88, 0x21, 0x63, 0x45,
+ 0x34, 0x33, 0x13, 0xa0, 0xcc, 0xcb, 0xcb, 0x9b, 0x09, 0x42, 0x44, 0x33, 0x22, 0x12, 0x81, 0xb9,
+ 0x9c, 0x28, 0x45, 0x43, 0x12, 0x80, 0xeb, 0xdd, 0xcb, 0xac, 0x9b, 0x8a, 0x00, 0x22, 0x43, 0x12,
+ 0x81, 0x98, 0x08, 0x21, 0x53, 0x45, 0x34, 0x33, 0x13, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x08, 0x42,
+ 0xa8, 0xf9, 0x39, 0x00, 0x35, 0x32, 0x22, 0x12, 0x98, 0xbb, 0x0a, 0x73, 0x43, 0x23, 0x12, 0xb8,
+ 0xdf, 0xbd, 0xbd, 0xab, 0x8a, 0x09, 0x20, 0x42, 0x23, 0x81, 0x88, 0x89, 0x00, 0x32, 0x56, 0x43,
+ 0x34, 0x22, 0x81, 0xba, 0xcc, 0xcb, 0xab, 0x9a, 0x30, 0x45, 0x24, 0x13, 0x22, 0x12, 0x98, 0xbb,
+ 0x1a, 0x73, 0x43, 0x22, 0x02, 0xc9, 0xde, 0xcc, 0xcb, 0x9a, 0x89, 0x18, 0x21, 0x23, 0x02, 0x90,
+ 0x88, 0x10, 0x22, 0x55, 0x44, 0x43, 0x12, 0x80, 0xb9, 0xcc, 0xcb, 0xaa, 0x08, 0x32, 0x36, 0x33,
+ 0x33, 0x12, 0x90, 0xca, 0x89, 0x53, 0x34, 0x33, 0x02, 0xd8, 0xde, 0xbd, 0xbc, 0xaa, 0x89, 0x00,
+ 0x32, 0x33, 0x11, 0x98, 0x89, 0x10, 0x32, 0x46, 0x54, 0x43, 0x12, 0x80, 0xba, 0xbc, 0xbc, 0xab,
+ 0x08, 0x53, 0x34, 0x24, 0x13, 0x12, 0x80, 0xba, 0x89, 0x73, 0x24, 0x22, 0x01, 0xb8, 0xef, 0xbc,
+ 0xcb, 0xaa, 0x89, 0x10, 0x31, 0x32, 0x12, 0x98, 0x89, 0x10, 0x32, 0x55, 0x35, 0x25, 0x12, 0x90,
+ 0xb9, 0xcc, 0xbb, 0xab, 0x09, 0x53, 0x44, 0x32, 0x23, 0x12, 0x98, 0xbb, 0x0a, 0x63, 0x44, 0x12,
+ 0x02, 0xc9, 0xde, 0xcc, 0xab, 0x9b, 0x89, 0x18, 0x32, 0x43, 0x12, 0x88, 0x08, 0x00, 0x22, 0x54,
+ 0x54, 0x23, 0x23, 0x90, 0xca, 0xcc, 0xbb, 0xab, 0x19, 0x53, 0x44, 0x32, 0x22, 0x11, 0x90, 0xba,
+ 0x0a, 0x54, 0x43, 0x22, 0x02, 0xd9, 0xce, 0xcd, 0xba, 0xaa, 0x98, 0x10, 0x31, 0x33, 0x12, 0x98,
+ 0x89, 0x18, 0x32, 0x47, 0x44, 0x33, 0x22, 0x90, 0xca, 0xbc, 0xbc, 0xab, 0x18, 0x53, 0x34, 0x24,
+ 0x22, 0x12, 0x80, 0xba, 0x0a, 0x63, 0x34, 0x23, 0x01, 0xd9, 0xde, 0xcc, 0xab, 0x9b, 0x89, 0x00,
+ 0x32, 0x33, 0x12, 0x98, 0x89, 0x20, 0x42, 0x54, 0x35, 0x34, 0x23, 0x90, 0xca, 0xbc, 0xbc, 0xab,
+ 0x4c, 0xe8, 0x39, 0x00, 0x31, 0x45, 0x32, 0x33, 0x22, 0x01, 0xb9, 0xab, 0x48, 0x36, 0x34, 0x02,
+ 0x91, 0xfc, 0xcd, 0xcb, 0xab, 0x99, 0x08, 0x11, 0x33, 0x13, 0x80, 0x98, 0x88, 0x21, 0x54, 0x35,
+ 0x35, 0x33, 0x02, 0xba, 0xcc, 0xcb, 0xbb, 0x99, 0x41, 0x44, 0x33, 0x32, 0x32, 0x81, 0xa9, 0x9b,
+ 0x41, 0x45, 0x33, 0x13, 0xa1, 0xee, 0xcd, 0xcb, 0xaa, 0x99, 0x08, 0x11, 0x33, 0x22, 0x80, 0x89,
+ 0x08, 0x31, 0x64, 0x44, 0x33, 0x14, 0x80, 0xbb, 0xbd, 0xac, 0x9b, 0x18, 0x44, 0x24, 0x23, 0x12,
+ 0x81, 0xa9, 0x9a, 0x51, 0x34, 0x24, 0x01, 0xc8, 0xde, 0xbd, 0xbb, 0xaa, 0x09, 0x10, 0x43, 0x32,
+ 0x81, 0x90, 0x00, 0x21, 0x52, 0x44, 0x35, 0x23, 0x80, 0xc9, 0xcb, 0xbc, 0xab, 0x18, 0x44, 0x43,
+ 0x32, 0x22, 0x02, 0xa9, 0xaa, 0x31, 0x37, 0x33, 0x22, 0xb0, 0xff, 0xbc, 0xbc, 0xaa, 0x99, 0x10,
+ 0x32, 0x23, 0x01, 0x98, 0x08, 0x20, 0x62, 0x45, 0x43, 0x23, 0x01, 0xa9, 0xcc, 0xcb, 0xaa, 0x09,
+ 0x42, 0x44, 0x32, 0x22, 0x02, 0xa0, 0xaa, 0x20, 0x55, 0x23, 0x12, 0x90, 0xed, 0xcd, 0xac, 0x9b,
+ 0x99, 0x18, 0x31, 0x23, 0x02, 0x89, 0x09, 0x10, 0x52, 0x44, 0x35, 0x33, 0x02, 0xb8, 0xcc, 0xcb,
+ 0xbb, 0x89, 0x42, 0x35, 0x23, 0x33, 0x13, 0x90, 0xbb, 0x1a, 0x55, 0x24, 0x12, 0x01, 0xfb, 0xce,
+ 0xcb, 0xab, 0x99, 0x08, 0x20, 0x33, 0x12, 0x88, 0x89, 0x18, 0x42, 0x54, 0x44, 0x43, 0x11, 0x98,
+ 0xca, 0xbb, 0xbc, 0x9a, 0x31, 0x45, 0x33, 0x23, 0x23, 0x91, 0xba, 0x8a, 0x64, 0x43, 0x22, 0x00,
+ 0xda, 0xde, 0xbc, 0xbb, 0x9a, 0x08, 0x11, 0x33, 0x23, 0x90, 0x88, 0x18, 0x32, 0x46, 0x45, 0x33,
+ 0x13, 0x90, 0xdb, 0xcb, 0xac, 0x8a, 0x28, 0x53, 0x24, 0x23, 0x21, 0x81, 0xb9, 0x8a, 0x52, 0x34,
+ 0x48, 0x30, 0x37, 0x00, 0x22, 0xa0, 0xfd, 0xbd, 0xad, 0xab, 0x99, 0x08, 0x22, 0x23, 0x12, 0x80,
+ 0x08, 0x11, 0x52, 0x44, 0x35, 0x24, 0x12, 0xa8, 0xbb, 0xbd, 0xac, 0x8a, 0x31, 0x54, 0x32, 0x32,
+ 0x11, 0x90, 0xab, 0x08, 0x54, 0x24, 0x13, 0x81, 0xfb, 0xce, 0xcb, 0xab, 0x9a, 0x00, 0x20, 0x33,
+ 0x12, 0x90, 0x89, 0x10, 0x41, 0x54, 0x35, 0x24, 0x02, 0x90, 0xbb, 0xcd, 0xba, 0x8a, 0x30, 0x54,
+ 0x32, 0x33, 0x12, 0x91, 0xb9, 0x09, 0x63, 0x34, 0x13, 0x01, 0xfa, 0xdd, 0xbc, 0xbb, 0x9a, 0x00,
+ 0x21, 0x24, 0x81, 0x88, 0x88, 0x11, 0x42, 0x45, 0x44, 0x12, 0x80, 0xa9, 0xcc, 0xba, 0x8a, 0x20,
+ 0x35, 0x43, 0x32, 0x22, 0x90, 0xaa, 0x18, 0x55, 0x23, 0x12, 0x90, 0xfd, 0xdc, 0xab, 0xab, 0x89,
+ 0x10, 0x32, 0x13, 0x81, 0x89, 0x08, 0x31, 0x55, 0x44, 0x33, 0x03, 0xa8, 0xbc, 0xbd, 0xbb, 0x09,
+ 0x42, 0x35, 0x24, 0x22, 0x02, 0xa8, 0x9a, 0x41, 0x44, 0x13, 0x02, 0xc9, 0xdf, 0xcc, 0xaa, 0x99,
+ 0x08, 0x20, 0x22, 0x02, 0x88, 0x08, 0x11, 0x32, 0x47, 0x43, 0x33, 0x81, 0xc9, 0xdb, 0xba, 0x9a,
+ 0x28, 0x54, 0x32, 0x23, 0x22, 0x81, 0xba, 0x19, 0x64, 0x23, 0x22, 0x90, 0xed, 0xdd, 0xab, 0xab,
+ 0x89, 0x18, 0x32, 0x22, 0x00, 0x99, 0x08, 0x20, 0x55, 0x44, 0x33, 0x13, 0xa8, 0xcc, 0xcb, 0xab,
+ 0x0a, 0x52, 0x34, 0x33, 0x23, 0x12, 0x98, 0x8a, 0x51, 0x44, 0x22, 0x02, 0xd8, 0xde, 0xbc, 0xbb,
+ 0x9b, 0x88, 0x21, 0x33, 0x12, 0x88, 0x89, 0x10, 0x43, 0x56, 0x53, 0x22, 0x81, 0xa9, 0xbc, 0xbc,
+ 0xaa, 0x18, 0x44, 0x34, 0x32, 0x22, 0x81, 0xaa, 0x0a, 0x54, 0x33, 0x23, 0x91, 0xfc, 0xce, 0xcb,
+ 0xaa, 0x89, 0x18, 0x31, 0x22, 0x81, 0x88, 0x88, 0x21, 0x54, 0x44, 0x33, 0x23, 0x98, 0xdb, 0xcb,
+ 0x5e, 0xf4, 0x3c, 0x00, 0x9b, 0x08, 0x44, 0x43, 0x33, 0x22, 0x80, 0xa9, 0x89, 0x44, 0x25, 0x12,
+ 0x81, 0xfb, 0xce, 0xbb, 0xbb, 0x99, 0x00, 0x23, 0x24, 0x00, 0x98, 0x08, 0x11, 0x63, 0x44, 0x34,
+ 0x12, 0x90, 0xca, 0xbc, 0xba, 0x9a, 0x41, 0x44, 0x33, 0x32, 0x12, 0x98, 0xaa, 0x20, 0x46, 0x23,
+ 0x12, 0xc0, 0xee, 0xcc, 0xab, 0xaa, 0x88, 0x11, 0x33, 0x12, 0x90, 0x89, 0x10, 0x42, 0x54, 0x44,
+ 0x33, 0x01, 0xb9, 0xcb, 0xbc, 0x9c, 0x09, 0x53, 0x33, 0x24, 0x13, 0x82, 0xa9, 0x8a, 0x52, 0x34,
+ 0x33, 0x01, 0xfb, 0xcf, 0xbb, 0xbb, 0x9a, 0x00, 0x32, 0x33, 0x81, 0x98, 0x00, 0x32, 0x56, 0x44,
+ 0x23, 0x01, 0xa8, 0xcc, 0xcb, 0xaa, 0x10, 0x53, 0x33, 0x24, 0x02, 0xa0, 0x9a, 0x28, 0x45, 0x23,
+ 0x02, 0xd9, 0xde, 0xcc, 0xaa, 0x8a, 0x18, 0x21, 0x13, 0x01, 0x88, 0x08, 0x32, 0x54, 0x44, 0x33,
+ 0x02, 0xa9, 0xcc, 0xbb, 0x9c, 0x18, 0x53, 0x33, 0x33, 0x23, 0xa0, 0xba, 0x38, 0x46, 0x33, 0x12,
+ 0xc8, 0xef, 0xbc, 0xab, 0x9a, 0x08, 0x21, 0x33, 0x01, 0x89, 0x08, 0x31, 0x73, 0x44, 0x24, 0x02,
+ 0x98, 0xcb, 0xcb, 0xab, 0x18, 0x44, 0x33, 0x43, 0x12, 0x91, 0xa9, 0x18, 0x45, 0x23, 0x12, 0xb9,
+ 0xff, 0xbc, 0xab, 0x9a, 0x08, 0x21, 0x23, 0x02, 0x98, 0x08, 0x21, 0x45, 0x44, 0x34, 0x11, 0xa8,
+ 0xda, 0xbb, 0xbb, 0x18, 0x44, 0x25, 0x23, 0x12, 0x80, 0xa9, 0x19, 0x54, 0x23, 0x22, 0xb8, 0xff,
+ 0xbc, 0xab, 0x9a, 0x88, 0x22, 0x22, 0x02, 0x98, 0x08, 0x21, 0x73, 0x34, 0x35, 0x12, 0x98, 0xdb,
+ 0xcb, 0xaa, 0x09, 0x52, 0x43, 0x23, 0x22, 0x80, 0xa9, 0x19, 0x54, 0x33, 0x02, 0xa0, 0xef, 0xcc,
+ 0xbb, 0x9a, 0x88, 0x21, 0x32, 0x02, 0x88, 0x88, 0x11, 0x63, 0x45, 0x33, 0x13, 0xa0, 0xcb, 0xbd,
+ 0xa2, 0xf1, 0x3d, 0x00, 0x9a, 0x21, 0x54, 0x32, 0x22, 0x02, 0x90, 0xaa, 0x31, 0x46, 0x22, 0x81,
+ 0xd9, 0xde, 0xbc, 0xab, 0x89, 0x08, 0x22, 0x13, 0x81, 0x89, 0x00, 0x31, 0x64, 0x44, 0x23, 0x82,
+ 0xb8, 0xcc, 0xac, 0x9a, 0x20, 0x53, 0x33, 0x23, 0x22, 0x98, 0xaa, 0x40, 0x36, 0x24, 0x01, 0xc9,
+ 0xde, 0xbc, 0xab, 0x8a, 0x08, 0x32, 0x23, 0x80, 0x99, 0x08, 0x32, 0x55, 0x44, 0x24, 0x01, 0xa9,
+ 0xcb, 0xbb, 0x9c, 0x28, 0x44, 0x33, 0x33, 0x22, 0x98, 0x9b, 0x30, 0x37, 0x24, 0x11, 0xd9, 0xde,
+ 0xbc, 0xab, 0x99, 0x08, 0x22, 0x23, 0x01, 0x89, 0x08, 0x21, 0x55, 0x44, 0x23, 0x02, 0xa9, 0xdb,
+ 0xcb, 0xaa, 0x28, 0x44, 0x24, 0x23, 0x01, 0x90, 0x99, 0x40, 0x44, 0x22, 0x91, 0xfc, 0xcc, 0xbb,
+ 0xab, 0x09, 0x11, 0x23, 0x02, 0x88, 0x08, 0x30, 0x64, 0x44, 0x33, 0x01, 0xa9, 0xbc, 0xbd, 0x8a,
+ 0x30, 0x35, 0x33, 0x24, 0x01, 0xa9, 0x09, 0x53, 0x34, 0x12, 0xa8, 0xef, 0xbc, 0xac, 0x99, 0x08,
+ 0x11, 0x13, 0x81, 0x88, 0x18, 0x21, 0x54, 0x35, 0x14, 0x81, 0xb9, 0xbc, 0xac, 0x0a, 0x41, 0x34,
+ 0x33, 0x13, 0x91, 0xa9, 0x28, 0x45, 0x33, 0x13, 0xe9, 0xde, 0xbc, 0xab, 0x8a, 0x00, 0x32, 0x12,
+ 0x00, 0x09, 0x10, 0x53, 0x54, 0x43, 0x13, 0x90, 0xca, 0xcb, 0xab, 0x19, 0x44, 0x33, 0x33, 0x13,
+ 0x90, 0x9b, 0x50, 0x44, 0x22, 0x81, 0xfb, 0xce, 0xcb, 0x9a, 0x89, 0x10, 0x22, 0x11, 0x98, 0x88,
+ 0x21, 0x53, 0x44, 0x24, 0x02, 0xa8, 0xcb, 0xbc, 0x9c, 0x10, 0x34, 0x34, 0x22, 0x12, 0x98, 0x89,
+ 0x53, 0x34, 0x22, 0x80, 0xee, 0xcc, 0xac, 0x99, 0x88, 0x11, 0x12, 0x01, 0x98, 0x80, 0x21, 0x63,
+ 0x44, 0x33, 0x01, 0xba, 0xcc, 0xcb, 0x8a, 0x41, 0x43, 0x23, 0x13, 0x82, 0xa9, 0x19, 0x73, 0x23,
+ 0x76, 0x37, 0x39, 0x00, 0x91, 0xfb, 0xce, 0xbb, 0xaa, 0x89, 0x20, 0x32, 0x02, 0x90, 0x08, 0x21,
+ 0x73, 0x44, 0x33, 0x02, 0xa9, 0xdb, 0xbc, 0x9a, 0x20, 0x45, 0x32, 0x22, 0x02, 0xa8, 0x89, 0x52,
+ 0x34, 0x12, 0xa0, 0xfe, 0xbc, 0xbb, 0x9b, 0x09, 0x31, 0x33, 0x81, 0x88, 0x00, 0x41, 0x45, 0x44,
+ 0x23, 0x81, 0xb9, 0xcc, 0xbb, 0x8a, 0x41, 0x35, 0x23, 0x23, 0x82, 0xaa, 0x19, 0x45, 0x33, 0x12,
+ 0xd0, 0xcf, 0xbd, 0xab, 0x9a, 0x00, 0x22, 0x22, 0x00, 0x89, 0x18, 0x42, 0x64, 0x34, 0x22, 0x88,
+ 0xbb, 0xbd, 0xac, 0x08, 0x43, 0x24, 0x33, 0x22, 0x90, 0xaa, 0x30, 0x37, 0x22, 0x01, 0xf9, 0xce,
+ 0xcb, 0xaa, 0x89, 0x20, 0x21, 0x12, 0x88, 0x80, 0x21, 0x52, 0x54, 0x33, 0x12, 0xa8, 0xdb, 0xbc,
+ 0x9a, 0x30, 0x44, 0x33, 0x33, 0x01, 0xa9, 0x19, 0x54, 0x33, 0x03, 0xfa, 0xce, 0xbc, 0x9b, 0x99,
+ 0x20, 0x21, 0x02, 0x88, 0x08, 0x21, 0x54, 0x35, 0x23, 0x81, 0xba, 0xbd, 0xad, 0x09, 0x41, 0x43,
+ 0x32, 0x12, 0x90, 0x89, 0x42, 0x35, 0x22, 0xa0, 0xed, 0xcd, 0xab, 0x9a, 0x18, 0x21, 0x02, 0x80,
+ 0x88, 0x10, 0x33, 0x47, 0x24, 0x12, 0x98, 0xcb, 0xbc, 0xaa, 0x30, 0x35, 0x24, 0x23, 0x01, 0xa9,
+ 0x19, 0x54, 0x33, 0x01, 0xf9, 0xcd, 0xbc, 0xab, 0x89, 0x11, 0x32, 0x11, 0x98, 0x08, 0x31, 0x45,
+ 0x44, 0x33, 0x00, 0xba, 0xbd, 0xac, 0x09, 0x43, 0x34, 0x32, 0x22, 0x98, 0x89, 0x41, 0x44, 0x22,
+ 0x90, 0xee, 0xcc, 0xbb, 0x99, 0x08, 0x31, 0x22, 0x80, 0x88, 0x28, 0x42, 0x36, 0x35, 0x11, 0xa8,
+ 0xcb, 0xcb, 0x9a, 0x30, 0x35, 0x43, 0x22, 0x81, 0xa9, 0x28, 0x44, 0x33, 0x02, 0xfa, 0xce, 0xbc,
+ 0x9b, 0x89, 0x20, 0x21, 0x02, 0x88, 0x00, 0x21, 0x44, 0x36, 0x24, 0x80, 0xb9, 0xcc, 0xaa, 0x09,
+ 0xfd, 0xef, 0x3b, 0x00, 0x34, 0x24, 0x23, 0x00, 0xa9, 0x29, 0x54, 0x23, 0x01, 0xfa, 0xcd, 0xbc,
+ 0x9b, 0x89, 0x20, 0x22, 0x02, 0x98, 0x08, 0x41, 0x63, 0x34, 0x23, 0x81, 0xba, 0xcd, 0xba, 0x08,
+ 0x53, 0x43, 0x32, 0x02, 0x90, 0x8a, 0x41, 0x34, 0x33, 0xb0, 0xff, 0xbc, 0xbb, 0x99, 0x08, 0x22,
+ 0x22, 0x80, 0x88, 0x10, 0x43, 0x46, 0x24, 0x02, 0xa8, 0xcb, 0xac, 0x8b, 0x30, 0x44, 0x33, 0x23,
+ 0x81, 0x9a, 0x28, 0x45, 0x23, 0x02, 0xfa, 0xcf, 0xbb, 0x9b, 0x09, 0x20, 0x22, 0x12, 0x08, 0x00,
+ 0x32, 0x55, 0x44, 0x13, 0x90, 0xba, 0xbd, 0xba, 0x08, 0x53, 0x34, 0x32, 0x12, 0x98, 0x8a, 0x51,
+ 0x34, 0x23, 0xa8, 0xff, 0xcb, 0xab, 0x9a, 0x18, 0x22, 0x12, 0x80, 0x88, 0x10, 0x53, 0x45, 0x33,
+ 0x02, 0xa8, 0xcc, 0xcb, 0x8a, 0x31, 0x44, 0x32, 0x13, 0x81, 0xaa, 0x09, 0x53, 0x34, 0x12, 0x80,
+ 0xfc, 0xdc, 0xcb, 0xaa, 0x89, 0x18, 0x31, 0x22, 0x00, 0x89, 0x18, 0x21, 0x63, 0x44, 0x34, 0x12,
+ 0x80, 0xcb, 0xcc, 0xaa, 0x89, 0x22, 0x44, 0x43, 0x12, 0x02, 0x90, 0x9a, 0x38, 0x36, 0x33, 0x11,
+ 0xc8, 0xdf, 0xcc, 0xab, 0xaa, 0x88, 0x21, 0x32, 0x02, 0x90, 0x88, 0x10, 0x32, 0x56, 0x44, 0x22,
+ 0x82, 0xa8, 0xcc, 0xbb, 0x9b, 0x18, 0x44, 0x43, 0x33, 0x22, 0x81, 0xa9, 0x0a, 0x63, 0x34, 0x23,
+ 0x81, 0xfb, 0xbf, 0xad, 0xab, 0x99, 0x00, 0x22, 0x22, 0x01, 0x98, 0x08, 0x21, 0x44, 0x45, 0x34,
+ 0x12, 0x90, 0xba, 0xcc, 0xab, 0x8b, 0x31, 0x36, 0x24, 0x23, 0x12, 0x98, 0x9b, 0x30, 0x45, 0x33,
+ 0x12, 0xc8, 0xee, 0xcc, 0xab, 0x9b, 0x89, 0x11, 0x23, 0x12, 0x80, 0x89, 0x00, 0x42, 0x54, 0x44,
+ 0x23, 0x02, 0xa9, 0xcc, 0xcb, 0xab, 0x18, 0x52, 0x43, 0x23, 0x23, 0x01, 0x99, 0x8a, 0x53, 0x35,
+ 0xd7, 0x33, 0x39, 0x00, 0x12, 0x98, 0xde, 0xcd, 0xbb, 0xaa, 0x89, 0x20, 0x32, 0x13, 0x90, 0x89,
+ 0x18, 0x32, 0x56, 0x34, 0x24, 0x02, 0xa8, 0xdb, 0xac, 0xab, 0x08, 0x52, 0x43, 0x33, 0x22, 0x81,
+ 0xa8, 0x8a, 0x52, 0x35, 0x22, 0x81, 0xea, 0xde, 0xcb, 0xab, 0x99, 0x08, 0x21, 0x23, 0x11, 0x98,
+ 0x08, 0x10, 0x53, 0x45, 0x34, 0x23, 0x80, 0xc9, 0xbc, 0xac, 0x9a, 0x30, 0x44, 0x43, 0x22, 0x12,
+ 0x90, 0xa9, 0x28, 0x45, 0x23, 0x12, 0xa0, 0xee, 0xcd, 0xbb, 0xaa, 0x98, 0x11, 0x32, 0x13, 0x80,
+ 0x98, 0x18, 0x32, 0x55, 0x35, 0x34, 0x11, 0xa8, 0xbc, 0xdb, 0xaa, 0x89, 0x43, 0x34, 0x24, 0x22,
+ 0x01, 0xa9, 0x99, 0x52, 0x34, 0x22, 0x02, 0xe9, 0xde, 0xbc, 0xbb, 0x99, 0x19, 0x21, 0x23, 0x02,
+ 0x88, 0x88, 0x10, 0x53, 0x55, 0x53, 0x12, 0x81, 0xaa, 0xcb, 0xac, 0x9b, 0x10, 0x44, 0x34, 0x22,
+ 0x12, 0x80, 0x9a, 0x19, 0x44, 0x34, 0x12, 0x81, 0xec, 0xce, 0xcb, 0xaa, 0x89, 0x08, 0x21, 0x23,
+ 0x02, 0x88, 0x89, 0x10, 0x32, 0x46, 0x35, 0x24, 0x11, 0xa8, 0xcb, 0xbc, 0xbb, 0x8a, 0x41, 0x44,
+ 0x33, 0x32, 0x22, 0x90, 0xbb, 0x1a, 0x64, 0x43, 0x12, 0x81, 0xfa, 0xdd, 0xcb, 0xba, 0x99, 0x08,
+ 0x21, 0x33, 0x12, 0x80, 0x98, 0x11, 0x42, 0x44, 0x45, 0x33, 0x12, 0x98, 0xbc, 0xbc, 0xcb, 0x9a,
+ 0x20, 0x35, 0x34, 0x23, 0x23, 0x00, 0xba, 0x8b, 0x63, 0x35, 0x22, 0x01, 0xca, 0xdf, 0xcc, 0xba,
+ 0x99, 0x88, 0x10, 0x23, 0x13, 0x80, 0x89, 0x00, 0x12, 0x54, 0x45, 0x33, 0x23, 0x90, 0xca, 0xcc,
+ 0xab, 0x9b, 0x20, 0x44, 0x34, 0x22, 0x32, 0x01, 0xa9, 0x8b, 0x51, 0x44, 0x32, 0x11, 0xc9, 0xcf,
+ 0xbd, 0xac, 0x9a, 0x09, 0x10, 0x22, 0x22, 0x01, 0x98, 0x08, 0x11, 0x44, 0x45, 0x43, 0x23, 0x00,
+ 0x8d, 0x19, 0x39, 0x00, 0xcb, 0xcb, 0xbb, 0x8b, 0x41, 0x44, 0x33, 0x33, 0x22, 0x90, 0xba, 0x19,
+ 0x54, 0x34, 0x23, 0x81, 0xfb, 0xce, 0xbc, 0xac, 0x99, 0x08, 0x20, 0x22, 0x12, 0x90, 0x89, 0x00,
+ 0x32, 0x54, 0x45, 0x33, 0x12, 0x90, 0xcb, 0xbc, 0xbc, 0x9a, 0x20, 0x35, 0x34, 0x33, 0x23, 0x00,
+ 0xaa, 0x8b, 0x72, 0x43, 0x13, 0x02, 0xd9, 0xcf, 0xbc, 0xac, 0x99, 0x09, 0x10, 0x32, 0x22, 0x00,
+ 0x99, 0x00, 0x31, 0x73, 0x53, 0x34, 0x22, 0x90, 0xba, 0xcc, 0xcb, 0xaa, 0x10, 0x44, 0x33, 0x33,
+ 0x23, 0x82, 0xb9, 0xab, 0x51, 0x36, 0x23, 0x02, 0xc8, 0xdf, 0xcc, 0xab, 0xaa, 0x89, 0x10, 0x32,
+ 0x32, 0x00, 0x99, 0x88, 0x31, 0x55, 0x34, 0x35, 0x23, 0x01, 0xb9, 0xbc, 0xcc, 0xaa, 0x08, 0x53,
+ 0x33, 0x24, 0x23, 0x01, 0xa8, 0xaa, 0x48, 0x45, 0x33, 0x11, 0xa8, 0xee, 0xcd, 0xbb, 0xaa, 0x99,
+ 0x10, 0x22, 0x33, 0x01, 0x88, 0x88, 0x20, 0x63, 0x45, 0x34, 0x32, 0x01, 0xa9, 0xbd, 0xbc, 0xbb,
+ 0x09, 0x52, 0x34, 0x33, 0x33, 0x13, 0x80, 0xbb, 0x0b, 0x73, 0x35, 0x12, 0x02, 0xa8, 0xef, 0xcc,
+ 0xab, 0x9b, 0x89, 0x00, 0x31, 0x33, 0x02, 0x88, 0x89, 0x00, 0x32, 0x47, 0x44, 0x33, 0x23, 0x90,
+ 0xca, 0xbc, 0xcc, 0x9a, 0x19, 0x32, 0x36, 0x32, 0x32, 0x12, 0x80, 0xbb, 0x09, 0x54, 0x34, 0x32,
+ 0x01, 0xc9, 0xdf, 0xcc, 0xbb, 0xab, 0x89, 0x18, 0x32, 0x33, 0x12, 0x98, 0x88, 0x10, 0x32, 0x56,
+ 0x44, 0x34, 0x12, 0x80, 0xba, 0xcc, 0xcb, 0xab, 0x08, 0x43, 0x44, 0x23, 0x23, 0x12, 0x88, 0xab,
+ 0x0a, 0x54, 0x53, 0x12, 0x02, 0xb9, 0xef, 0xdb, 0xbb, 0x9a, 0x89, 0x00, 0x32, 0x33, 0x12, 0x88,
+ 0x89, 0x10, 0x33, 0x46, 0x54, 0x43, 0x12, 0x80, 0xba, 0xcc, 0xbb, 0x9b, 0x19, 0x53, 0x44, 0x22,
+ 0x4d, 0x19, 0x3b, 0x00, 0x12, 0x01, 0xb8, 0xaa, 0x30, 0x46, 0x32, 0x21, 0x90, 0xfc, 0xcd, 0xac,
+ 0xab, 0x9a, 0x88, 0x11, 0x33, 0x13, 0x80, 0x89, 0x88, 0x31, 0x46, 0x34, 0x35, 0x24, 0x01, 0x99,
+ 0xba, 0xcc, 0xbb, 0x8a, 0x30, 0x45, 0x33, 0x43, 0x22, 0x01, 0xb9, 0x9b, 0x48, 0x54, 0x23, 0x12,
+ 0x90, 0xfc, 0xcd, 0xcb, 0xbb, 0x99, 0x08, 0x10, 0x43, 0x12, 0x00, 0x89, 0x08, 0x11, 0x52, 0x54,
+ 0x34, 0x23, 0x82, 0xb8, 0xdb, 0xbc, 0xbb, 0x9a, 0x31, 0x36, 0x34, 0x23, 0x23, 0x81, 0xa9, 0x9b,
+ 0x40, 0x36, 0x24, 0x12, 0x90, 0xed, 0xdc, 0xbb, 0x9c, 0x8a, 0x88, 0x11, 0x33, 0x22, 0x80, 0x89,
+ 0x18, 0x20, 0x63, 0x54, 0x43, 0x33, 0x81, 0xb8, 0xdb, 0xcb, 0xbb, 0x8a, 0x31, 0x45, 0x43, 0x32,
+ 0x22, 0x81, 0xa9, 0x8b, 0x40, 0x35, 0x24, 0x22, 0x98, 0xde, 0xcd, 0xcb, 0xab, 0x99, 0x08, 0x20,
+ 0x33, 0x13, 0x81, 0xa9, 0x08, 0x21, 0x54, 0x54, 0x43, 0x33, 0x01, 0xa9, 0xcc, 0xcb, 0xab, 0x8a,
+ 0x31, 0x45, 0x43, 0x22, 0x21, 0x00, 0xa9, 0x9a, 0x30, 0x46, 0x23, 0x22, 0x90, 0xed, 0xcd, 0xcb,
+ 0xab, 0x99, 0x88, 0x10, 0x32, 0x24, 0x02, 0x88, 0x89, 0x00, 0x21, 0x55, 0x53, 0x43, 0x13, 0x01,
+ 0xa9, 0xbc, 0xbd, 0xbb, 0x9a, 0x28, 0x45, 0x43, 0x22, 0x22, 0x12, 0x90, 0xcb, 0x89, 0x42, 0x35,
+ 0x32, 0x02, 0xa8, 0xee, 0xdc, 0xcb, 0xab, 0x9a, 0x09, 0x10, 0x42, 0x23, 0x01, 0x80, 0x89, 0x00,
+ 0x32, 0x55, 0x34, 0x35, 0x32, 0x81, 0xb9, 0xcc, 0xbb, 0xbc, 0x9a, 0x30, 0x44, 0x43, 0x33, 0x23,
+ 0x11, 0x90, 0xcb, 0x8a, 0x63, 0x34, 0x22, 0x12, 0xa0, 0xee, 0xdc, 0xbb, 0xbb, 0xaa, 0x88, 0x11,
+ 0x53, 0x22, 0x82, 0x88, 0x09, 0x00, 0x31, 0x45, 0x35, 0x34, 0x24, 0x81, 0xa9, 0xcb, 0xbc, 0xac,
+ 0x9e, 0xe9, 0x3b, 0x00, 0x19, 0x41, 0x34, 0x33, 0x23, 0x23, 0x02, 0xba, 0xac, 0x30, 0x46, 0x33,
+ 0x22, 0x01, 0xfa, 0xdd, 0xdb, 0xbb, 0xaa, 0x99, 0x10, 0x31, 0x43, 0x12, 0x90, 0x98, 0x08, 0x11,
+ 0x53, 0x54, 0x34, 0x34, 0x11, 0xa0, 0xca, 0xcb, 0xcb, 0xab, 0x08, 0x42, 0x44, 0x33, 0x23, 0x12,
+ 0x82, 0xb9, 0x9c, 0x28, 0x45, 0x24, 0x22, 0x81, 0xea, 0xce, 0xcc, 0xba, 0x9a, 0x89, 0x18, 0x21,
+ 0x24, 0x12, 0x90, 0x98, 0x80, 0x21, 0x52, 0x54, 0x53, 0x32, 0x12, 0x98, 0xbb, 0xcd, 0xbb, 0x9b,
+ 0x19, 0x52, 0x34, 0x24, 0x23, 0x22, 0x01, 0xba, 0xab, 0x40, 0x45, 0x33, 0x13, 0x82, 0xfb, 0xdd,
+ 0xbc, 0xac, 0x9b, 0x89, 0x00, 0x31, 0x33, 0x13, 0x90, 0x99, 0x80, 0x21, 0x63, 0x45, 0x34, 0x24,
+ 0x02, 0x98, 0xbb, 0xbd, 0xbc, 0xab, 0x19, 0x42, 0x35, 0x34, 0x22, 0x12, 0x81, 0xaa, 0xab, 0x38,
+ 0x47, 0x33, 0x22, 0x81, 0xfa, 0xdd, 0xcb, 0xbb, 0xaa, 0x89, 0x10, 0x32, 0x43, 0x02, 0x90, 0x89,
+ 0x08, 0x21, 0x43, 0x56, 0x53, 0x23, 0x02, 0xa0, 0xcb, 0xdb, 0xbb, 0xaa, 0x08, 0x43, 0x45, 0x32,
+ 0x32, 0x12, 0x81, 0xb9, 0xab, 0x41, 0x45, 0x23, 0x13, 0x81, 0xeb, 0xce, 0xcd, 0xba, 0xaa, 0x89,
+ 0x08, 0x20, 0x33, 0x24, 0x11, 0x99, 0x89, 0x10, 0x30, 0x54, 0x44, 0x34, 0x43, 0x12, 0xa0, 0xba,
+ 0xcc, 0xdb, 0xaa, 0x89, 0x21, 0x63, 0x33, 0x33, 0x22, 0x22, 0x80, 0xca, 0xaa, 0x31, 0x55, 0x33,
+ 0x23, 0x01, 0xda, 0xde, 0xbd, 0xad, 0xaa, 0x99, 0x88, 0x11, 0x32, 0x33, 0x12, 0x88, 0x99, 0x08,
+ 0x21, 0x63, 0x45, 0x44, 0x32, 0x23, 0x90, 0xba, 0xbd, 0xbc, 0xbc, 0x9a, 0x10, 0x44, 0x34, 0x33,
+ 0x23, 0x12, 0x01, 0xba, 0x9c, 0x28, 0x45, 0x53, 0x22, 0x00, 0xa8, 0xde, 0xcd, 0xcb, 0xba, 0x99,
+ 0x61, 0xbc, 0x40, 0x00, 0x08, 0x21, 0x33, 0x23, 0x01, 0x89, 0x88, 0x11, 0x32, 0x45, 0x45, 0x34,
+ 0x24, 0x12, 0x90, 0xcb, 0xcb, 0xcb, 0xab, 0x89, 0x31, 0x35, 0x35, 0x32, 0x22, 0x12, 0x90, 0xca,
+ 0x9a, 0x31, 0x45, 0x43, 0x22, 0x91, 0xda, 0xed, 0xbc, 0xbc, 0xab, 0x9a, 0x88, 0x21, 0x33, 0x24,
+ 0x02, 0xa8, 0x99, 0x00, 0x21, 0x54, 0x45, 0x43, 0x43, 0x12, 0x91, 0xba, 0xcb, 0xcb, 0xac, 0x8a,
+ 0x20, 0x44, 0x43, 0x32, 0x22, 0x22, 0x81, 0xca, 0xab, 0x30, 0x36, 0x25, 0x22, 0x01, 0xb9, 0xdf,
+ 0xdc, 0xbb, 0xbb, 0x9a, 0x09, 0x10, 0x43, 0x23, 0x13, 0x88, 0x99, 0x08, 0x21, 0x63, 0x54, 0x53,
+ 0x33, 0x32, 0x80, 0xba, 0xbd, 0xbc, 0xbc, 0xaa, 0x10, 0x63, 0x43, 0x23, 0x23, 0x12, 0x02, 0xa9,
+ 0xbc, 0x18, 0x54, 0x43, 0x23, 0x01, 0xa8, 0xed, 0xcd, 0xdb, 0xaa, 0x9a, 0x88, 0x00, 0x22, 0x33,
+ 0x13, 0x81, 0x99, 0x09, 0x20, 0x53, 0x54, 0x44, 0x33, 0x14, 0x01, 0xa9, 0xcb, 0xdb, 0xbb, 0xab,
+ 0x19, 0x52, 0x44, 0x33, 0x32, 0x22, 0x12, 0xa8, 0xbc, 0x0a, 0x63, 0x24, 0x33, 0x12, 0x90, 0xed,
+ 0xcd, 0xbc, 0xac, 0x9a, 0x99, 0x00, 0x21, 0x33, 0x33, 0x01, 0x99, 0x09, 0x00, 0x42, 0x45, 0x45,
+ 0x43, 0x32, 0x01, 0xa8, 0xbb, 0xbd, 0xcc, 0xaa, 0x89, 0x11, 0x44, 0x34, 0x33, 0x22, 0x22, 0x02,
+ 0xb9, 0xcb, 0x89, 0x53, 0x44, 0x33, 0x12, 0x81, 0xda, 0xcf, 0xcc, 0xbc, 0xaa, 0x9a, 0x88, 0x10,
+ 0x31, 0x24, 0x13, 0x81, 0xa8, 0x89, 0x10, 0x21, 0x63, 0x45, 0x34, 0x43, 0x13, 0x81, 0xba, 0xbd,
+ 0xcb, 0xbc, 0xaa, 0x0a, 0x31, 0x55, 0x33, 0x23, 0x33, 0x32, 0x81, 0xb9, 0xad, 0x18, 0x45, 0x34,
+ 0x22, 0x11, 0x80, 0xdc, 0xce, 0xbc, 0xbc, 0xab, 0x99, 0x88, 0x11, 0x33, 0x25, 0x12, 0x80, 0xa9,
+ 0xac, 0xdc, 0x35, 0x00, 0x18, 0x21, 0x42, 0x45, 0x35, 0x33, 0x24, 0x02, 0xb9, 0xdb, 0xcb, 0xcb,
+ 0xab, 0x89, 0x31, 0x44, 0x34, 0x24, 0x21, 0x12, 0x02, 0xb9, 0xbb, 0x0a, 0x73, 0x34, 0x33, 0x12,
+ 0x81, 0xfa, 0xec, 0xbc, 0xbc, 0xba, 0x9a, 0x88, 0x10, 0x42, 0x33, 0x23, 0x80, 0xa8, 0x09, 0x20,
+ 0x32, 0x73, 0x45, 0x34, 0x33, 0x23, 0x81, 0xcb, 0xbc, 0xbc, 0xcc, 0x9a, 0x18, 0x31, 0x44, 0x24,
+ 0x23, 0x22, 0x12, 0x81, 0xbb, 0xac, 0x28, 0x44, 0x35, 0x23, 0x11, 0x98, 0xec, 0xdd, 0xcb, 0xac,
+ 0x9b, 0x99, 0x08, 0x10, 0x33, 0x24, 0x02, 0x80, 0xa9, 0x08, 0x20, 0x32, 0x74, 0x34, 0x25, 0x33,
+ 0x12, 0xa0, 0xca, 0xbc, 0xbc, 0xbc, 0x9a, 0x10, 0x43, 0x35, 0x24, 0x22, 0x22, 0x12, 0xa0, 0xbb,
+ 0x9b, 0x41, 0x36, 0x34, 0x22, 0x02, 0xb8, 0xdf, 0xcc, 0xcc, 0xba, 0x9a, 0x89, 0x08, 0x21, 0x43,
+ 0x22, 0x12, 0x98, 0x99, 0x00, 0x11, 0x41, 0x55, 0x44, 0x33, 0x33, 0x02, 0xb8, 0xbd, 0xbc, 0xcc,
+ 0xaa, 0x89, 0x28, 0x52, 0x44, 0x22, 0x22, 0x21, 0x81, 0xb8, 0xab, 0x8a, 0x62, 0x44, 0x33, 0x22,
+ 0x82, 0xc9, 0xcf, 0xcc, 0xbc, 0xab, 0x9b, 0x88, 0x00, 0x22, 0x34, 0x23, 0x01, 0x99, 0x99, 0x18,
+ 0x21, 0x44, 0x56, 0x43, 0x33, 0x23, 0x81, 0xb9, 0xbd, 0xcc, 0xbb, 0xbb, 0x09, 0x41, 0x44, 0x34,
+ 0x23, 0x23, 0x21, 0x80, 0xca, 0x9b, 0x30, 0x46, 0x23, 0x23, 0x01, 0xd9, 0xde, 0xcc, 0xcb, 0xaa,
+ 0x8a, 0x88, 0x11, 0x22, 0x24, 0x02, 0x90, 0x88, 0x08, 0x20, 0x53, 0x44, 0x44, 0x24, 0x12, 0x80,
+ 0xb9, 0xdb, 0xcb, 0xab, 0x9a, 0x28, 0x44, 0x34, 0x24, 0x12, 0x12, 0x01, 0xb9, 0xab, 0x28, 0x45,
+ 0x34, 0x33, 0x11, 0xb8, 0xef, 0xcc, 0xcb, 0xbb, 0x9a, 0x88, 0x00, 0x32, 0x34, 0x13, 0x88, 0x89,
+ 0xda, 0xdf, 0x34, 0x00, 0x00, 0x21, 0x63, 0x44, 0x44, 0x33, 0x11, 0x98, 0xca, 0xbc, 0xbc, 0xab,
+ 0x8a, 0x31, 0x55, 0x33, 0x33, 0x32, 0x22, 0x80, 0xdb, 0x8a, 0x40, 0x34, 0x34, 0x22, 0x01, 0xda,
+ 0xde, 0xcc, 0xcb, 0xaa, 0x99, 0x08, 0x10, 0x33, 0x24, 0x01, 0x90, 0x88, 0x18, 0x21, 0x53, 0x54,
+ 0x34, 0x43, 0x12, 0x80, 0xba, 0xbd, 0xbc, 0xbb, 0x9a, 0x30, 0x54, 0x34, 0x32, 0x22, 0x22, 0x81,
+ 0xca, 0xaa, 0x20, 0x44, 0x35, 0x32, 0x01, 0xc9, 0xed, 0xcc, 0xbc, 0xab, 0x9a, 0x88, 0x18, 0x32,
+ 0x34, 0x12, 0x88, 0x88, 0x18, 0x11, 0x53, 0x45, 0x44, 0x33, 0x33, 0x81, 0xba, 0xcc, 0xbc, 0xac,
+ 0xaa, 0x00, 0x43, 0x44, 0x23, 0x23, 0x22, 0x01, 0xb9, 0xac, 0x18, 0x63, 0x34, 0x32, 0x11, 0xb8,
+ 0xfd, 0xcc, 0xbc, 0xac, 0x9a, 0x89, 0x00, 0x22, 0x33, 0x14, 0x80, 0x99, 0x08, 0x10, 0x41, 0x54,
+ 0x34, 0x34, 0x23, 0x02, 0xb9, 0xbd, 0xbc, 0xcb, 0xab, 0x08, 0x52, 0x34, 0x24, 0x32, 0x22, 0x11,
+ 0xa8, 0xbb, 0x1a, 0x73, 0x53, 0x22, 0x12, 0x98, 0xfb, 0xcd, 0xbd, 0xbb, 0xaa, 0x89, 0x08, 0x22,
+ 0x34, 0x23, 0x01, 0x98, 0x89, 0x10, 0x32, 0x55, 0x35, 0x34, 0x34, 0x11, 0xa8, 0xcb, 0xbc, 0xdb,
+ 0xaa, 0x09, 0x31, 0x54, 0x33, 0x23, 0x32, 0x12, 0xa0, 0xcb, 0x8a, 0x42, 0x35, 0x34, 0x12, 0x80,
+ 0xea, 0xed, 0xbc, 0xbc, 0xaa, 0x89, 0x88, 0x21, 0x33, 0x24, 0x02, 0x98, 0x89, 0x00, 0x31, 0x64,
+ 0x34, 0x35, 0x33, 0x01, 0xb8, 0xdb, 0xbc, 0xbc, 0x99, 0x28, 0x63, 0x33, 0x24, 0x22, 0x12, 0x80,
+ 0xba, 0x8a, 0x51, 0x44, 0x23, 0x12, 0x90, 0xed, 0xcd, 0xbc, 0xab, 0xaa, 0x88, 0x10, 0x32, 0x24,
+ 0x02, 0x88, 0x89, 0x00, 0x21, 0x45, 0x35, 0x35, 0x32, 0x01, 0xb9, 0xeb, 0xcb, 0xab, 0x9a, 0x18,
+ 0xe2, 0xeb, 0x36, 0x00, 0x45, 0x33, 0x32, 0x22, 0x12, 0xa8, 0xbb, 0x28, 0x47, 0x43, 0x22, 0x00,
+ 0xb9, 0xdf, 0xbd, 0xbc, 0xaa, 0x99, 0x18, 0x21, 0x33, 0x13, 0x90, 0x98, 0x08, 0x21, 0x63, 0x54,
+ 0x34, 0x34, 0x12, 0x98, 0xba, 0xbd, 0xbc, 0xbb, 0x09, 0x52, 0x53, 0x33, 0x33, 0x22, 0x01, 0xb8,
+ 0xac, 0x28, 0x54, 0x24, 0x23, 0x01, 0xda, 0xcf, 0xbc, 0xac, 0x9b, 0x99, 0x00, 0x31, 0x42, 0x12,
+ 0x80, 0x88, 0x08, 0x20, 0x52, 0x54, 0x43, 0x24, 0x02, 0x80, 0xbb, 0xcc, 0xbb, 0xbb, 0x09, 0x52,
+ 0x44, 0x33, 0x23, 0x22, 0x02, 0xb9, 0xac, 0x28, 0x45, 0x24, 0x22, 0x00, 0xca, 0xcf, 0xbd, 0xbc,
+ 0xaa, 0x89, 0x00, 0x21, 0x43, 0x12, 0x80, 0x99, 0x88, 0x21, 0x52, 0x54, 0x43, 0x33, 0x13, 0x98,
+ 0xcb, 0xcc, 0xcb, 0xaa, 0x09, 0x41, 0x44, 0x32, 0x23, 0x22, 0x01, 0xaa, 0x9c, 0x28, 0x54, 0x33,
+ 0x23, 0x01, 0xfb, 0xdd, 0xcc, 0xba, 0xaa, 0x89, 0x00, 0x22, 0x43, 0x12, 0x80, 0x89, 0x08, 0x21,
+ 0x43, 0x45, 0x44, 0x33, 0x22, 0x98, 0xca, 0xcc, 0xbb, 0xab, 0x08, 0x42, 0x35, 0x24, 0x23, 0x22,
+ 0x81, 0xa9, 0x9c, 0x20, 0x45, 0x32, 0x22, 0x81, 0xfa, 0xdd, 0xbc, 0xbc, 0x9a, 0x89, 0x18, 0x21,
+ 0x33, 0x13, 0x90, 0x99, 0x88, 0x20, 0x63, 0x45, 0x44, 0x32, 0x12, 0x90, 0xca, 0xcb, 0xbc, 0x9a,
+ 0x08, 0x43, 0x35, 0x43, 0x12, 0x12, 0x01, 0xaa, 0x9c, 0x28, 0x45, 0x32, 0x12, 0x01, 0xeb, 0xde,
+ 0xdb, 0xab, 0x9a, 0x99, 0x00, 0x22, 0x33, 0x23, 0xa0, 0xdc, 0xab, 0x89, 0x88, 0x08, 0x20, 0x23,
+ 0x22, 0x22, 0x12, 0x21, 0x44, 0x34, 0x43, 0x44, 0x33, 0x12, 0x32, 0x35, 0x12, 0x32, 0x36, 0x44,
+ 0x32, 0x34, 0x32, 0x23, 0x23, 0x11, 0x22, 0x44, 0x43, 0x22, 0x11, 0x12, 0x32, 0x24, 0x81, 0xba,
+ 0xbc, 0x2b, 0x22, 0x00, 0x0a, 0x52, 0x23, 0x81, 0xa9, 0xcc, 0xad, 0x8a, 0xca, 0xcf, 0xbb, 0x89,
+ 0x98, 0xba, 0xbc, 0xcc, 0xbc, 0xbb, 0xbb, 0xbd, 0xbc, 0xbb, 0xcb, 0xaa, 0xcc, 0xcd, 0xbb, 0xcb,
+ 0xcb, 0xab, 0x99, 0x99, 0xaa, 0x99, 0xb9, 0xdc, 0xab, 0xbb, 0xab, 0x9a, 0x08, 0x22, 0x02, 0xfb,
+ 0xbc, 0x89, 0x21, 0x22, 0x43, 0x24, 0x33, 0x67, 0x34, 0x12, 0x80, 0x31, 0x42, 0x42, 0x53, 0x33,
+ 0x33, 0x43, 0x43, 0x43, 0x22, 0x12, 0x42, 0x46, 0x33, 0x33, 0x43, 0x24, 0x02, 0x11, 0x21, 0x22,
+ 0x22, 0x43, 0x12, 0x01, 0x42, 0x34, 0x12, 0xb9, 0xbd, 0x89, 0x21, 0x02, 0x99, 0xdb, 0xcc, 0x9a,
+ 0xa9, 0xec, 0xcc, 0xac, 0x9a, 0x89, 0x99, 0xcb, 0xbc, 0xbc, 0xbb, 0xbc, 0xdb, 0xcb, 0xab, 0x99,
+ 0x99, 0xcc, 0xbc, 0xbb, 0xcd, 0xcb, 0xaa, 0x99, 0x99, 0x9a, 0x9a, 0xca, 0xcb, 0xab, 0xaa, 0xcb,
+ 0xcb, 0x8a, 0x41, 0x25, 0x91, 0xbd, 0xab, 0x18, 0x32, 0x12, 0x22, 0x53, 0x55, 0x34, 0x24, 0x12,
+ 0x18, 0x30, 0x44, 0x33, 0x43, 0x54, 0x23, 0x13, 0x20, 0x22, 0x23, 0x43, 0x55, 0x24, 0x33, 0x42,
+ 0x43, 0x22, 0x01, 0x00, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x92, 0xdf, 0xbb, 0x19,
+ 0x23, 0x80, 0xba, 0xce, 0xbc, 0x9a, 0xc9, 0xdd, 0xbc, 0xab, 0x8a, 0x98, 0xca, 0xcc, 0xaa, 0xba,
+ 0xdb, 0xbc, 0xcb, 0xba, 0xab, 0xab, 0xda, 0xcc, 0xcb, 0xcb, 0xcb, 0xac, 0x9b, 0x88, 0x99, 0x99,
+ 0x18, 0x90, 0xcc, 0xab, 0xaa, 0x9a, 0x09, 0x42, 0x44, 0x14, 0xc9, 0xad, 0x28, 0x23, 0x10, 0x31,
+ 0x24, 0x43, 0x47, 0x24, 0x12, 0x22, 0x54, 0x44, 0x23, 0x23, 0x44, 0x34, 0x34, 0x32, 0x23, 0x23,
+ 0x32, 0x43, 0x12, 0x80, 0x80, 0x00, 0x98, 0xdd, 0xcc, 0xbb, 0xbc, 0xbc, 0xcc, 0xcb, 0xbb, 0xac,
+ 0x5a, 0xff, 0x35, 0x00, 0xcc, 0xbb, 0xbc, 0xab, 0xba, 0xbb, 0xbc, 0xab, 0xa9, 0xba, 0xbb, 0x0a,
+ 0x31, 0x45, 0x34, 0x33, 0x63, 0x44, 0x43, 0x22, 0x43, 0x44, 0x33, 0x24, 0x33, 0x33, 0x43, 0x32,
+ 0x32, 0x33, 0x22, 0x33, 0x43, 0x12, 0x99, 0xab, 0xbb, 0xbc, 0xdc, 0xcc, 0xbc, 0xac, 0xcb, 0xbd,
+ 0xad, 0xab, 0xaa, 0xaa, 0xcb, 0xab, 0xaa, 0x99, 0xa9, 0xaa, 0x09, 0x51, 0x35, 0x24, 0x32, 0x45,
+ 0x34, 0x24, 0x32, 0x53, 0x53, 0x33, 0x33, 0x32, 0x43, 0x32, 0x23, 0x12, 0x01, 0x01, 0x08, 0x88,
+ 0xdc, 0xdc, 0xba, 0xcb, 0xbc, 0xcc, 0xca, 0xca, 0xbb, 0xdb, 0xcb, 0xcb, 0xaa, 0xaa, 0xbb, 0xac,
+ 0xaa, 0x9a, 0xa9, 0xba, 0xaa, 0x09, 0x63, 0x43, 0x33, 0x43, 0x54, 0x43, 0x23, 0x43, 0x53, 0x34,
+ 0x33, 0x24, 0x23, 0x33, 0x34, 0x22, 0x23, 0x12, 0x22, 0x33, 0x12, 0xb8, 0xcb, 0xba, 0xcc, 0xcc,
+ 0xbd, 0xdb, 0xba, 0xdb, 0xcb, 0xbc, 0xcb, 0xaa, 0xa9, 0xcb, 0xab, 0x9a, 0x98, 0xaa, 0x9b, 0x99,
+ 0x21, 0x46, 0x34, 0x22, 0x53, 0x35, 0x34, 0x32, 0x43, 0x44, 0x43, 0x33, 0x33, 0x32, 0x43, 0x23,
+ 0x13, 0x11, 0x11, 0x21, 0x00, 0xda, 0xbc, 0xbc, 0xbc, 0xbd, 0xbc, 0xcc, 0xcb, 0xba, 0xdb, 0xcb,
+ 0xac, 0xbb, 0xab, 0xbb, 0xcb, 0xcb, 0x9a, 0x99, 0xba, 0xab, 0x09, 0x31, 0x43, 0x34, 0x34, 0x44,
+ 0x35, 0x24, 0x32, 0x43, 0x45, 0x23, 0x24, 0x22, 0x23, 0x43, 0x22, 0x22, 0x21, 0x21, 0x32, 0x11,
+ 0x98, 0xcb, 0xbb, 0xbd, 0xbc, 0xbd, 0xbd, 0xbc, 0xba, 0xbd, 0xcd, 0xbb, 0xab, 0xaa, 0xaa, 0xbc,
+ 0xbb, 0x9a, 0xaa, 0xbb, 0x9b, 0x18, 0x73, 0x44, 0x33, 0x33, 0x46, 0x43, 0x23, 0x33, 0x44, 0x35,
+ 0x34, 0x43, 0x32, 0x22, 0x12, 0x12, 0x12, 0xa0, 0xcb, 0xcb, 0xcc, 0xcc, 0xcb, 0xcb, 0xbc, 0xbb,
+ 0x2d, 0xed, 0x39, 0x00, 0xcb, 0xaa, 0xaa, 0xaa, 0x8a, 0x18, 0x22, 0x53, 0x44, 0x43, 0x53, 0x53,
+ 0x23, 0x33, 0x33, 0x33, 0x22, 0x21, 0x12, 0xa8, 0xdb, 0xcb, 0xcc, 0xbc, 0xcc, 0xcb, 0xac, 0xbb,
+ 0xbb, 0xbb, 0xbb, 0xba, 0x9b, 0x08, 0x33, 0x54, 0x35, 0x35, 0x33, 0x45, 0x43, 0x23, 0x33, 0x33,
+ 0x33, 0x22, 0x23, 0x01, 0xa8, 0xba, 0xdd, 0xbc, 0xbc, 0xcc, 0xcc, 0xba, 0xba, 0xbb, 0xbb, 0xab,
+ 0xab, 0x89, 0x31, 0x43, 0x45, 0x34, 0x44, 0x43, 0x34, 0x43, 0x33, 0x32, 0x33, 0x22, 0x22, 0x12,
+ 0x98, 0xbb, 0xcd, 0xcc, 0xcb, 0xbc, 0xcc, 0xcb, 0xab, 0xbb, 0xbb, 0xbb, 0xba, 0xab, 0x18, 0x32,
+ 0x53, 0x54, 0x34, 0x33, 0x45, 0x34, 0x23, 0x23, 0x43, 0x12, 0x12, 0x11, 0x91, 0xb9, 0xca, 0xcc,
+ 0xbd, 0xbb, 0xbd, 0xcd, 0xba, 0xba, 0xbb, 0xba, 0xaa, 0xbb, 0x9a, 0x31, 0x34, 0x63, 0x44, 0x33,
+ 0x44, 0x53, 0x33, 0x32, 0x24, 0x23, 0x22, 0x11, 0x11, 0x80, 0xaa, 0xbb, 0xce, 0xbc, 0xcc, 0xcb,
+ 0xbc, 0xab, 0xbb, 0xbb, 0xab, 0xab, 0xab, 0x08, 0x52, 0x53, 0x34, 0x44, 0x33, 0x45, 0x43, 0x23,
+ 0x23, 0x33, 0x23, 0x22, 0x22, 0x81, 0xb9, 0xbc, 0xcc, 0xcd, 0xbb, 0xbd, 0xcc, 0xbb, 0xbb, 0xbb,
+ 0xac, 0xaa, 0xaa, 0x8a, 0x10, 0x33, 0x35, 0x36, 0x43, 0x34, 0x35, 0x34, 0x22, 0x32, 0x33, 0x12,
+ 0x12, 0x01, 0x98, 0xcb, 0xcb, 0xcd, 0xbc, 0xcb, 0xbd, 0xac, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xaa,
+ 0x18, 0x33, 0x45, 0x44, 0x53, 0x42, 0x43, 0x34, 0x23, 0x33, 0x43, 0x22, 0x12, 0x12, 0x81, 0x9a,
+ 0xba, 0xdc, 0xbd, 0xac, 0xdb, 0xbc, 0xac, 0xba, 0xba, 0xab, 0xa9, 0xab, 0x09, 0x21, 0x34, 0x45,
+ 0x34, 0x53, 0x43, 0x34, 0x24, 0x33, 0x32, 0x23, 0x22, 0x32, 0x02, 0xa0, 0xcc, 0xcc, 0xeb, 0xcb,
+ 0x34, 0x0d, 0x3b, 0x00, 0xbc, 0xcb, 0xaa, 0xab, 0x9a, 0x09, 0x30, 0x43, 0x44, 0x44, 0x43, 0x24,
+ 0x32, 0x22, 0x21, 0x11, 0x88, 0xaa, 0xcc, 0xbc, 0xbd, 0xbd, 0xbb, 0xbb, 0xbb, 0xab, 0x8a, 0x10,
+ 0x43, 0x54, 0x53, 0x53, 0x23, 0x24, 0x12, 0x22, 0x12, 0x80, 0xa8, 0xdb, 0xcb, 0xcc, 0xbc, 0xcb,
+ 0xbb, 0xba, 0xba, 0xa9, 0x18, 0x32, 0x34, 0x46, 0x53, 0x43, 0x23, 0x23, 0x23, 0x23, 0x01, 0x98,
+ 0xaa, 0xbd, 0xbe, 0xbd, 0xbc, 0xbb, 0xbb, 0xba, 0xaa, 0x88, 0x41, 0x53, 0x33, 0x36, 0x35, 0x34,
+ 0x32, 0x32, 0x22, 0x02, 0x80, 0xb9, 0xeb, 0xdb, 0xdb, 0xac, 0xac, 0xba, 0xaa, 0xaa, 0x89, 0x18,
+ 0x32, 0x35, 0x45, 0x53, 0x33, 0x33, 0x33, 0x33, 0x22, 0x81, 0xa8, 0xcc, 0xcc, 0xbc, 0xbd, 0xac,
+ 0xbb, 0xab, 0xab, 0x9a, 0x09, 0x31, 0x54, 0x43, 0x44, 0x34, 0x33, 0x33, 0x32, 0x22, 0x12, 0x98,
+ 0xca, 0xcc, 0xcc, 0xbc, 0xbc, 0xbb, 0xac, 0xaa, 0xaa, 0x89, 0x20, 0x53, 0x53, 0x53, 0x43, 0x33,
+ 0x24, 0x23, 0x22, 0x11, 0x00, 0xa9, 0xdb, 0xdb, 0xcc, 0xcb, 0xbb, 0xac, 0xaa, 0xaa, 0x89, 0x18,
+ 0x32, 0x44, 0x44, 0x34, 0x34, 0x24, 0x23, 0x22, 0x21, 0x01, 0xa8, 0xcb, 0xbc, 0xdc, 0xdb, 0xbb,
+ 0xbb, 0xbb, 0xac, 0x99, 0x09, 0x21, 0x34, 0x35, 0x35, 0x35, 0x33, 0x43, 0x22, 0x12, 0x11, 0x98,
+ 0xb9, 0xeb, 0xdb, 0xbc, 0xbc, 0xac, 0xab, 0xaa, 0xaa, 0x99, 0x20, 0x43, 0x44, 0x34, 0x35, 0x43,
+ 0x23, 0x23, 0x23, 0x11, 0x81, 0xb9, 0xdb, 0xcc, 0xcc, 0xcb, 0xcb, 0xaa, 0xab, 0xaa, 0x99, 0x18,
+ 0x31, 0x54, 0x43, 0x44, 0x33, 0x34, 0x32, 0x22, 0x12, 0x01, 0x98, 0xca, 0xbc, 0xcd, 0xcc, 0xbb,
+ 0xbb, 0xbb, 0xbb, 0x9a, 0x19, 0x31, 0x45, 0x34, 0x45, 0x43, 0x33, 0x33, 0x32, 0x23, 0x01, 0x90,
+ 0xbe, 0x34, 0x32, 0x00, 0xcb, 0xcc, 0xbc, 0xbe, 0xbb, 0xcb, 0xba, 0xba, 0x99, 0x10, 0x53, 0x44,
+ 0x44, 0x33, 0x24, 0x22, 0x22, 0x80, 0xa8, 0xcb, 0xdc, 0xbc, 0xcb, 0xba, 0xaa, 0x9a, 0x18, 0x32,
+ 0x45, 0x44, 0x33, 0x43, 0x22, 0x12, 0x81, 0xa8, 0xca, 0xdc, 0xbc, 0xbb, 0xac, 0xab, 0x8a, 0x08,
+ 0x22, 0x45, 0x53, 0x43, 0x33, 0x32, 0x12, 0x01, 0x98, 0xdb, 0xdb, 0xcc, 0xcb, 0xaa, 0xaa, 0x9a,
+ 0x08, 0x31, 0x44, 0x34, 0x35, 0x43, 0x22, 0x21, 0x01, 0x98, 0xba, 0xdc, 0xcc, 0xbb, 0xbb, 0xac,
+ 0x9a, 0x08, 0x22, 0x63, 0x53, 0x43, 0x33, 0x32, 0x22, 0x02, 0x90, 0xbb, 0xce, 0xcc, 0xbb, 0xcb,
+ 0xaa, 0x9a, 0x09, 0x30, 0x53, 0x44, 0x34, 0x43, 0x22, 0x22, 0x11, 0x88, 0xba, 0xdc, 0xbc, 0xbd,
+ 0xba, 0xab, 0x9b, 0x09, 0x20, 0x44, 0x44, 0x34, 0x43, 0x22, 0x22, 0x02, 0x90, 0xb9, 0xdc, 0xbc,
+ 0xbc, 0xac, 0xba, 0x9a, 0x89, 0x20, 0x53, 0x34, 0x35, 0x34, 0x23, 0x13, 0x12, 0x88, 0xb9, 0xbd,
+ 0xbe, 0xcc, 0xab, 0xab, 0xaa, 0x89, 0x20, 0x43, 0x54, 0x43, 0x24, 0x23, 0x22, 0x11, 0x80, 0xb9,
+ 0xeb, 0xcc, 0xcb, 0xbb, 0xab, 0xab, 0x8a, 0x11, 0x34, 0x36, 0x35, 0x43, 0x32, 0x32, 0x21, 0x80,
+ 0xa8, 0xcc, 0xcc, 0xbc, 0xbb, 0xac, 0xaa, 0x99, 0x10, 0x33, 0x45, 0x34, 0x35, 0x32, 0x32, 0x21,
+ 0x80, 0xa9, 0xbc, 0xbe, 0xbd, 0xcb, 0xaa, 0xab, 0x8a, 0x10, 0x32, 0x45, 0x44, 0x33, 0x24, 0x22,
+ 0x12, 0x81, 0x99, 0xdb, 0xcc, 0xdb, 0xba, 0xbb, 0xba, 0x99, 0x18, 0x32, 0x46, 0x53, 0x33, 0x43,
+ 0x22, 0x12, 0x01, 0x99, 0xcb, 0xcc, 0xbd, 0xcb, 0xba, 0xaa, 0x8a, 0x08, 0x32, 0x54, 0x53, 0x24,
+ 0x33, 0x32, 0x22, 0x01, 0xa9, 0xca, 0xdc, 0xbc, 0xbc, 0xba, 0xbb, 0x9a, 0x18, 0x31, 0x45, 0x44,
+ 0x3f, 0xfb, 0x3e, 0x00, 0x43, 0x32, 0x22, 0x11, 0x00, 0xa9, 0xcc, 0xcc, 0xbc, 0xbb, 0xac, 0xaa,
+ 0x89, 0x10, 0x33, 0x45, 0x44, 0x43, 0x22, 0x13, 0x11, 0x90, 0xca, 0xdc, 0xcb, 0xbb, 0xbb, 0x9a,
+ 0x18, 0x42, 0x54, 0x43, 0x33, 0x23, 0x22, 0x80, 0xb9, 0xbe, 0xcd, 0xab, 0xbb, 0x9a, 0x09, 0x21,
+ 0x45, 0x34, 0x34, 0x33, 0x12, 0x81, 0xa8, 0xdc, 0xdb, 0xbb, 0xac, 0x9a, 0x89, 0x11, 0x53, 0x44,
+ 0x33, 0x33, 0x23, 0x01, 0xa0, 0xeb, 0xcc, 0xac, 0xbb, 0xab, 0x8a, 0x10, 0x43, 0x45, 0x24, 0x33,
+ 0x22, 0x11, 0x88, 0xcb, 0xdc, 0xcb, 0xbb, 0xab, 0xaa, 0x08, 0x43, 0x35, 0x35, 0x24, 0x23, 0x11,
+ 0x80, 0xa9, 0xbd, 0xbd, 0xac, 0xab, 0x9b, 0x08, 0x21, 0x45, 0x53, 0x33, 0x33, 0x13, 0x01, 0xb9,
+ 0xdc, 0xcc, 0xbb, 0xac, 0xaa, 0x09, 0x20, 0x53, 0x35, 0x43, 0x23, 0x22, 0x01, 0x98, 0xdb, 0xbd,
+ 0xbc, 0xbb, 0xab, 0x9a, 0x20, 0x53, 0x35, 0x35, 0x23, 0x23, 0x11, 0x98, 0xca, 0xdc, 0xcb, 0xbb,
+ 0xab, 0x9a, 0x18, 0x42, 0x35, 0x35, 0x24, 0x22, 0x02, 0x80, 0xa9, 0xcd, 0xdb, 0xab, 0xbb, 0xa9,
+ 0x08, 0x41, 0x53, 0x44, 0x32, 0x23, 0x22, 0x00, 0xa9, 0xbd, 0xcd, 0xbb, 0xcb, 0xa9, 0x09, 0x20,
+ 0x53, 0x44, 0x33, 0x24, 0x12, 0x00, 0xa0, 0xda, 0xcc, 0xbb, 0xbb, 0xbb, 0x8a, 0x20, 0x44, 0x54,
+ 0x33, 0x24, 0x22, 0x01, 0x90, 0xca, 0xcc, 0xbc, 0xcb, 0xaa, 0x99, 0x00, 0x42, 0x34, 0x35, 0x43,
+ 0x22, 0x11, 0x90, 0xb9, 0xdc, 0xdb, 0xab, 0xbb, 0x9a, 0x09, 0x32, 0x55, 0x43, 0x33, 0x33, 0x22,
+ 0x80, 0xa9, 0xcd, 0xcc, 0xbb, 0xac, 0x9a, 0x88, 0x20, 0x44, 0x34, 0x34, 0x23, 0x13, 0x01, 0xa8,
+ 0xeb, 0xbc, 0xad, 0xbb, 0x9b, 0x8a, 0x11, 0x53, 0x44, 0x43, 0x23, 0x13, 0x02, 0x90, 0xdb, 0xbc,
+ 0x25, 0x04, 0x3c, 0x00, 0xbd, 0xba, 0xab, 0x88, 0x21, 0x44, 0x35, 0x34, 0x33, 0x22, 0x00, 0xa8,
+ 0xcc, 0xcc, 0xcb, 0xab, 0x9b, 0x8a, 0x11, 0x44, 0x44, 0x43, 0x32, 0x12, 0x11, 0x98, 0xcb, 0xdc,
+ 0xbb, 0xac, 0xab, 0x99, 0x20, 0x44, 0x35, 0x43, 0x22, 0x11, 0x88, 0xcb, 0xbd, 0xbc, 0xab, 0x9a,
+ 0x18, 0x43, 0x45, 0x33, 0x24, 0x11, 0x90, 0xb9, 0xcd, 0xac, 0xbb, 0x9a, 0x19, 0x41, 0x44, 0x24,
+ 0x33, 0x12, 0x00, 0xba, 0xcd, 0xbc, 0xbb, 0xab, 0x09, 0x41, 0x44, 0x34, 0x33, 0x13, 0x01, 0xa9,
+ 0xcd, 0xbc, 0xbc, 0xaa, 0x89, 0x20, 0x44, 0x44, 0x23, 0x22, 0x01, 0x98, 0xeb, 0xcb, 0xac, 0xab,
+ 0x89, 0x10, 0x43, 0x35, 0x34, 0x23, 0x11, 0x98, 0xca, 0xcd, 0xbb, 0xbb, 0xaa, 0x18, 0x53, 0x35,
+ 0x34, 0x23, 0x12, 0x80, 0xca, 0xdc, 0xbb, 0xac, 0x9a, 0x08, 0x31, 0x45, 0x24, 0x33, 0x21, 0x00,
+ 0xb9, 0xcd, 0xbc, 0xbb, 0xab, 0x89, 0x31, 0x46, 0x43, 0x33, 0x22, 0x01, 0xa9, 0xcc, 0xbd, 0xac,
+ 0xaa, 0x89, 0x20, 0x53, 0x35, 0x33, 0x22, 0x02, 0x98, 0xcc, 0xcc, 0xbb, 0xab, 0x9a, 0x20, 0x63,
+ 0x34, 0x34, 0x23, 0x11, 0x88, 0xcb, 0xcd, 0xbb, 0xbb, 0xaa, 0x18, 0x53, 0x44, 0x24, 0x23, 0x21,
+ 0x90, 0xc9, 0xcc, 0xcb, 0xab, 0xaa, 0x08, 0x41, 0x44, 0x43, 0x23, 0x12, 0x81, 0xb9, 0xcd, 0xbc,
+ 0xcb, 0x9a, 0x09, 0x30, 0x44, 0x34, 0x24, 0x12, 0x01, 0xa8, 0xdb, 0xbc, 0xac, 0xab, 0x89, 0x20,
+ 0x53, 0x35, 0x43, 0x12, 0x11, 0x98, 0xdb, 0xbc, 0xbc, 0xba, 0x99, 0x18, 0x53, 0x35, 0x43, 0x22,
+ 0x02, 0x80, 0xca, 0xcc, 0xbc, 0xba, 0x9a, 0x18, 0x42, 0x44, 0x34, 0x32, 0x11, 0x91, 0xc9, 0xbc,
+ 0xbd, 0xcb, 0xa9, 0x08, 0x31, 0x44, 0x34, 0x33, 0x23, 0x00, 0xb9, 0xbe, 0xbd, 0xcb, 0xa9, 0x09,
+ 0x46, 0xd1, 0x3d, 0x00, 0x32, 0x45, 0x33, 0x24, 0x11, 0x90, 0xc9, 0xdb, 0xcb, 0xab, 0x9a, 0x09,
+ 0x32, 0x36, 0x35, 0x32, 0x12, 0x80, 0xa9, 0xcd, 0xbc, 0xbb, 0xab, 0x09, 0x31, 0x46, 0x43, 0x33,
+ 0x12, 0x01, 0xa9, 0xdc, 0xdb, 0xba, 0xaa, 0x89, 0x20, 0x63, 0x34, 0x24, 0x12, 0x11, 0xa8, 0xeb,
+ 0xdb, 0xba, 0x9a, 0x09, 0x42, 0x44, 0x33, 0x22, 0x01, 0xb8, 0xcd, 0xbc, 0xba, 0x9a, 0x28, 0x44,
+ 0x34, 0x24, 0x12, 0x81, 0xba, 0xcd, 0xac, 0xaa, 0x89, 0x30, 0x44, 0x34, 0x32, 0x02, 0x90, 0xdb,
+ 0xcc, 0xbb, 0xaa, 0x08, 0x42, 0x35, 0x24, 0x13, 0x11, 0xa9, 0xcc, 0xad, 0xab, 0x9a, 0x18, 0x63,
+ 0x43, 0x32, 0x22, 0x80, 0xba, 0xce, 0xbb, 0xab, 0x89, 0x20, 0x45, 0x34, 0x23, 0x12, 0x98, 0xdb,
+ 0xcc, 0xbb, 0xaa, 0x08, 0x41, 0x44, 0x43, 0x22, 0x01, 0xa8, 0xcc, 0xcb, 0xbb, 0x9a, 0x28, 0x63,
+ 0x53, 0x32, 0x12, 0x81, 0xb9, 0xcd, 0xac, 0xab, 0x89, 0x20, 0x44, 0x34, 0x23, 0x12, 0x90, 0xdb,
+ 0xcc, 0xbb, 0xaa, 0x09, 0x42, 0x44, 0x43, 0x22, 0x01, 0x98, 0xcc, 0xbc, 0xbb, 0x9a, 0x18, 0x63,
+ 0x53, 0x32, 0x12, 0x81, 0xb9, 0xcd, 0xcb, 0xaa, 0x99, 0x20, 0x44, 0x34, 0x33, 0x12, 0x90, 0xdb,
+ 0xcc, 0xbb, 0xaa, 0x88, 0x41, 0x44, 0x43, 0x22, 0x11, 0x99, 0xbc, 0xbd, 0xac, 0x9a, 0x18, 0x52,
+ 0x43, 0x33, 0x23, 0x81, 0xb9, 0xbf, 0xac, 0xab, 0x8a, 0x20, 0x44, 0x34, 0x24, 0x02, 0x80, 0xca,
+ 0xcc, 0xab, 0xab, 0x09, 0x31, 0x36, 0x25, 0x13, 0x02, 0xa8, 0xdb, 0xbc, 0xac, 0x9a, 0x18, 0x42,
+ 0x34, 0x25, 0x12, 0x01, 0xb9, 0xcc, 0xbc, 0xab, 0x9a, 0x20, 0x54, 0x43, 0x23, 0x12, 0x80, 0xda,
+ 0xdb, 0xbb, 0xab, 0x89, 0x32, 0x36, 0x25, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xac, 0x9a, 0x19, 0x42,
+ 0x23, 0xf0, 0x3e, 0x00, 0x35, 0x23, 0x12, 0xa0, 0xda, 0xcc, 0xab, 0x9b, 0x09, 0x41, 0x44, 0x43,
+ 0x22, 0x01, 0x99, 0xcc, 0xdb, 0xaa, 0x9a, 0x00, 0x43, 0x44, 0x23, 0x13, 0x81, 0xc9, 0xcc, 0xcb,
+ 0xaa, 0x8a, 0x20, 0x44, 0x34, 0x23, 0x12, 0x90, 0xcb, 0xcd, 0xbb, 0xab, 0x88, 0x32, 0x46, 0x33,
+ 0x33, 0x11, 0xa8, 0xbd, 0xcd, 0xaa, 0x8a, 0x08, 0x43, 0x35, 0x33, 0x22, 0x90, 0xdb, 0xbd, 0xcb,
+ 0x99, 0x10, 0x53, 0x24, 0x23, 0x01, 0xa8, 0xbd, 0xbd, 0xaa, 0x09, 0x41, 0x34, 0x34, 0x12, 0x80,
+ 0xca, 0xbd, 0xac, 0x9a, 0x20, 0x53, 0x43, 0x23, 0x01, 0xa8, 0xcd, 0xbb, 0x9c, 0x09, 0x31, 0x45,
+ 0x23, 0x12, 0x80, 0xda, 0xdb, 0xab, 0x9a, 0x20, 0x63, 0x43, 0x22, 0x01, 0xa9, 0xcc, 0xcb, 0x9b,
+ 0x09, 0x41, 0x34, 0x34, 0x12, 0x90, 0xda, 0xbc, 0xbb, 0x9a, 0x20, 0x54, 0x43, 0x23, 0x01, 0xa9,
+ 0xbd, 0xad, 0x9b, 0x09, 0x41, 0x34, 0x34, 0x12, 0x90, 0xda, 0xbc, 0xbb, 0x9a, 0x20, 0x54, 0x24,
+ 0x23, 0x01, 0xa9, 0xcd, 0xbb, 0xbb, 0x08, 0x52, 0x34, 0x34, 0x21, 0x90, 0xcb, 0xbd, 0xac, 0x99,
+ 0x20, 0x53, 0x43, 0x23, 0x01, 0xa9, 0xcd, 0xbb, 0xab, 0x89, 0x43, 0x45, 0x23, 0x12, 0x80, 0xcb,
+ 0xbd, 0xac, 0x99, 0x20, 0x53, 0x34, 0x22, 0x01, 0xa9, 0xbd, 0xad, 0x9b, 0x09, 0x32, 0x36, 0x24,
+ 0x12, 0x88, 0xcb, 0xcc, 0xba, 0x99, 0x20, 0x44, 0x43, 0x23, 0x81, 0xa9, 0xcd, 0xbb, 0xab, 0x09,
+ 0x52, 0x44, 0x32, 0x12, 0x90, 0xdb, 0xbc, 0xbb, 0x9a, 0x20, 0x45, 0x24, 0x23, 0x00, 0xb8, 0xcd,
+ 0xcb, 0x9a, 0x08, 0x42, 0x53, 0x23, 0x12, 0x90, 0xda, 0xbc, 0xbb, 0x9a, 0x21, 0x45, 0x43, 0x13,
+ 0x01, 0xb9, 0xcd, 0xbb, 0xab, 0x09, 0x53, 0x44, 0x23, 0x02, 0x90, 0xda, 0xbc, 0xcb, 0x99, 0x11,
+ 0x2b, 0xe6, 0x3e, 0x00, 0x35, 0x43, 0x11, 0x90, 0xcb, 0xcc, 0xba, 0x99, 0x20, 0x54, 0x33, 0x22,
+ 0x01, 0xb9, 0xcd, 0xbc, 0x9a, 0x09, 0x42, 0x44, 0x23, 0x12, 0x90, 0xbc, 0xbd, 0xbb, 0x8a, 0x20,
+ 0x45, 0x34, 0x22, 0x01, 0xb9, 0xcd, 0xcb, 0x9a, 0x08, 0x32, 0x36, 0x23, 0x12, 0x90, 0xeb, 0xcb,
+ 0xab, 0x8a, 0x20, 0x54, 0x43, 0x12, 0x01, 0xb9, 0xcc, 0xac, 0x9b, 0x08, 0x42, 0x44, 0x32, 0x02,
+ 0x90, 0xdb, 0xbc, 0xbb, 0x8a, 0x30, 0x55, 0x33, 0x22, 0x90, 0xdb, 0xbc, 0xbb, 0x89, 0x43, 0x35,
+ 0x24, 0x01, 0xa8, 0xcc, 0xac, 0x9a, 0x10, 0x53, 0x43, 0x12, 0x81, 0xca, 0xcc, 0xaa, 0x89, 0x31,
+ 0x35, 0x24, 0x02, 0xa8, 0xeb, 0xbb, 0x9b, 0x28, 0x63, 0x43, 0x22, 0x80, 0xc9, 0xbc, 0xac, 0x89,
+ 0x31, 0x44, 0x24, 0x11, 0xa8, 0xcb, 0xbc, 0xab, 0x18, 0x63, 0x43, 0x22, 0x81, 0xba, 0xcd, 0xab,
+ 0x8a, 0x21, 0x35, 0x34, 0x12, 0xa0, 0xeb, 0xcb, 0xaa, 0x08, 0x42, 0x34, 0x14, 0x01, 0xb9, 0xcc,
+ 0xac, 0x99, 0x20, 0x53, 0x24, 0x12, 0x90, 0xca, 0xbc, 0x9c, 0x09, 0x42, 0x53, 0x22, 0x82, 0xb8,
+ 0xcc, 0xcb, 0x99, 0x10, 0x34, 0x34, 0x13, 0x90, 0xcb, 0xcd, 0xaa, 0x09, 0x32, 0x35, 0x24, 0x01,
+ 0xa8, 0xbd, 0xac, 0x8b, 0x28, 0x53, 0x34, 0x22, 0x80, 0xda, 0xbc, 0xab, 0x89, 0x32, 0x36, 0x24,
+ 0x02, 0xa8, 0xcc, 0xbb, 0xab, 0x28, 0x44, 0x25, 0x13, 0x81, 0xca, 0xbc, 0xac, 0x89, 0x31, 0x35,
+ 0x24, 0x02, 0x98, 0xbc, 0xbd, 0xaa, 0x18, 0x53, 0x53, 0x12, 0x01, 0xba, 0xcc, 0xbb, 0x8a, 0x40,
+ 0x53, 0x43, 0x11, 0xa0, 0xda, 0xcb, 0xaa, 0x18, 0x42, 0x34, 0x33, 0x01, 0xca, 0xcc, 0xbb, 0x9a,
+ 0x30, 0x45, 0x33, 0x23, 0x98, 0xcc, 0xcc, 0x9a, 0x09, 0x32, 0x45, 0x22, 0x01, 0xb9, 0xcc, 0xbb,
+ 0x48, 0xda, 0x40, 0x00, 0x09, 0x42, 0x35, 0x23, 0x02, 0xb9, 0xcd, 0xcb, 0x8a, 0x28, 0x53, 0x43,
+ 0x22, 0x90, 0xca, 0xcc, 0xaa, 0x09, 0x31, 0x35, 0x24, 0x02, 0xa9, 0xeb, 0xbb, 0xaa, 0x10, 0x44,
+ 0x34, 0x22, 0x91, 0xca, 0xcc, 0xab, 0x89, 0x41, 0x34, 0x24, 0x11, 0xa8, 0xeb, 0xbb, 0x9b, 0x28,
+ 0x53, 0x34, 0x23, 0x81, 0xca, 0xbd, 0xac, 0x89, 0x21, 0x44, 0x33, 0x13, 0xa8, 0xbd, 0xbd, 0xaa,
+ 0x18, 0x52, 0x43, 0x23, 0x01, 0xca, 0xcc, 0xab, 0x9a, 0x21, 0x45, 0x33, 0x22, 0x98, 0xcc, 0xcb,
+ 0xab, 0x18, 0x53, 0x34, 0x23, 0x90, 0xdb, 0xbc, 0x9b, 0x18, 0x44, 0x43, 0x12, 0x98, 0xbc, 0xad,
+ 0x9a, 0x20, 0x44, 0x33, 0x11, 0xa9, 0xcd, 0xbb, 0x8a, 0x32, 0x36, 0x33, 0x01, 0xca, 0xbd, 0xbb,
+ 0x09, 0x53, 0x34, 0x22, 0x81, 0xdb, 0xbc, 0xab, 0x18, 0x44, 0x43, 0x12, 0x90, 0xdb, 0xac, 0x9a,
+ 0x10, 0x44, 0x33, 0x02, 0xa8, 0xcd, 0xbb, 0x8a, 0x31, 0x45, 0x33, 0x01, 0xba, 0xcd, 0xab, 0x89,
+ 0x42, 0x44, 0x22, 0x80, 0xca, 0xdb, 0xaa, 0x18, 0x42, 0x34, 0x22, 0x90, 0xbc, 0xbd, 0xaa, 0x20,
+ 0x44, 0x43, 0x11, 0x98, 0xcc, 0xbb, 0x8a, 0x30, 0x45, 0x23, 0x02, 0xb9, 0xcd, 0xbb, 0x09, 0x41,
+ 0x34, 0x24, 0x00, 0xca, 0xdb, 0xaa, 0x08, 0x42, 0x34, 0x22, 0x80, 0xdb, 0xbc, 0xab, 0x10, 0x44,
+ 0x24, 0x12, 0x98, 0xbc, 0xad, 0x9a, 0x21, 0x44, 0x23, 0x02, 0xb8, 0xcd, 0xbb, 0x89, 0x41, 0x44,
+ 0x22, 0x81, 0xb9, 0xbd, 0x9c, 0x09, 0x42, 0x34, 0x13, 0x91, 0xdb, 0xdb, 0x9a, 0x08, 0x53, 0x33,
+ 0x13, 0x98, 0xcc, 0xbc, 0x9a, 0x20, 0x44, 0x24, 0x11, 0xa9, 0xbc, 0xad, 0x89, 0x30, 0x44, 0x23,
+ 0x01, 0xc9, 0xbc, 0xac, 0x09, 0x41, 0x34, 0x23, 0x91, 0xda, 0xbc, 0xab, 0x08, 0x44, 0x43, 0x22,
+ 0xe6, 0x24, 0x41, 0x00, 0xa9, 0xbd, 0xbb, 0x09, 0x43, 0x44, 0x23, 0x81, 0xcb, 0xcc, 0xaa, 0x18,
+ 0x42, 0x34, 0x22, 0x98, 0xdb, 0xbc, 0xaa, 0x20, 0x63, 0x33, 0x22, 0xa8, 0xcd, 0xbb, 0x9a, 0x31,
+ 0x45, 0x23, 0x02, 0xb9, 0xcd, 0xbb, 0x89, 0x42, 0x34, 0x24, 0x00, 0xba, 0xcd, 0xaa, 0x19, 0x42,
+ 0x34, 0x22, 0x80, 0xdb, 0xbc, 0x9b, 0x18, 0x44, 0x43, 0x12, 0x98, 0xbc, 0xad, 0x9a, 0x20, 0x44,
+ 0x33, 0x02, 0xb8, 0xbe, 0xbb, 0x89, 0x41, 0x44, 0x23, 0x81, 0xc9, 0xbc, 0x9c, 0x09, 0x32, 0x35,
+ 0x14, 0x91, 0xca, 0xdb, 0x9a, 0x18, 0x42, 0x34, 0x12, 0x90, 0xcc, 0xcb, 0x8a, 0x88, 0x80, 0x88,
+ 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x10, 0x11, 0x11, 0x21, 0x42, 0x22,
+ 0x12, 0x21, 0x35, 0x14, 0x81, 0x18, 0x34, 0x23, 0x11, 0xa9, 0x1a, 0x57, 0x03, 0x88, 0x41, 0x23,
+ 0x90, 0x89, 0x98, 0x30, 0x57, 0x02, 0x99, 0x19, 0x80, 0x99, 0x10, 0x80, 0x72, 0x26, 0x81, 0x99,
+ 0x00, 0x11, 0x12, 0xa0, 0xad, 0x61, 0x25, 0x01, 0x88, 0x01, 0x10, 0x73, 0x24, 0xb0, 0x9b, 0x73,
+ 0x12, 0x88, 0x41, 0x23, 0x00, 0x42, 0x24, 0x88, 0x41, 0x36, 0x32, 0x34, 0x13, 0x99, 0x51, 0x35,
+ 0x12, 0x32, 0x34, 0x02, 0x08, 0x61, 0x34, 0x23, 0x33, 0x53, 0x22, 0x00, 0x18, 0x56, 0x23, 0x90,
+ 0x20, 0x34, 0x91, 0x19, 0x44, 0x01, 0x30, 0x47, 0x01, 0xaa, 0x38, 0x24, 0x01, 0x88, 0x90, 0xa9,
+ 0x31, 0x47, 0x11, 0x08, 0x10, 0x91, 0xa9, 0x09, 0x98, 0x08, 0x12, 0x91, 0x19, 0x22, 0xd9, 0xcb,
+ 0x89, 0x41, 0x37, 0x13, 0xb9, 0x8c, 0x31, 0xf0, 0xef, 0x9a, 0x10, 0x01, 0x08, 0x00, 0x98, 0x99,
+ 0x08, 0x00, 0x91, 0xbb, 0x59, 0x25, 0xb8, 0x29, 0x15, 0xeb, 0x68, 0x36, 0x81, 0x89, 0x08, 0x98,
+ 0xdf, 0xff, 0x14, 0x00, 0x54, 0x23, 0xa0, 0x09, 0x62, 0x34, 0x03, 0xb9, 0x38, 0x46, 0x81, 0x08,
+ 0x73, 0x12, 0x99, 0x0a, 0x43, 0x23, 0x90, 0x18, 0x73, 0x33, 0x80, 0xaa, 0x40, 0x45, 0x02, 0x90,
+ 0x89, 0x11, 0x90, 0x89, 0x10, 0x02, 0x08, 0x53, 0xa0, 0xad, 0x29, 0x01, 0xaa, 0x19, 0x02, 0xab,
+ 0x0a, 0x53, 0x35, 0xf8, 0xff, 0x99, 0x10, 0x81, 0x9a, 0x10, 0x81, 0xdc, 0x9c, 0x89, 0x98, 0x10,
+ 0x01, 0xfc, 0xab, 0x18, 0x80, 0x99, 0x31, 0xa3, 0xdf, 0x9b, 0x08, 0x00, 0x88, 0x80, 0x00, 0x22,
+ 0x21, 0x00, 0xa9, 0xab, 0x10, 0x53, 0x45, 0x92, 0xce, 0x09, 0x33, 0xc9, 0x69, 0x46, 0x82, 0x99,
+ 0x18, 0x11, 0x99, 0x89, 0x08, 0x72, 0x37, 0x90, 0x3a, 0x77, 0x77, 0x12, 0x11, 0x21, 0x21, 0x42,
+ 0x43, 0x33, 0x33, 0x25, 0x12, 0x11, 0x21, 0x23, 0x43, 0x23, 0x12, 0x33, 0x34, 0x34, 0x33, 0x91,
+ 0xdb, 0xab, 0x30, 0x44, 0x02, 0xb8, 0xac, 0x8a, 0xba, 0xce, 0xcc, 0xdb, 0xab, 0x9a, 0xa8, 0xca,
+ 0xbd, 0xbc, 0xba, 0xbc, 0xcb, 0xcb, 0xcb, 0xac, 0xa9, 0xba, 0xbd, 0xbc, 0xca, 0xbc, 0xad, 0xaa,
+ 0x98, 0x9a, 0x9a, 0x9a, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xca, 0x8a, 0x31, 0x93, 0xbf, 0xac, 0x9a,
+ 0x88, 0x11, 0x82, 0x88, 0x71, 0x36, 0x25, 0x11, 0x10, 0x00, 0x31, 0x44, 0x43, 0x33, 0x44, 0x23,
+ 0x23, 0x22, 0x33, 0x24, 0x44, 0x45, 0x33, 0x43, 0x33, 0x24, 0x12, 0x01, 0x22, 0x33, 0x43, 0x22,
+ 0x22, 0x42, 0x33, 0x33, 0x12, 0xa0, 0xdc, 0x8b, 0x53, 0x23, 0x98, 0xbb, 0xbb, 0xab, 0x9a, 0xff,
+ 0xcd, 0xbb, 0x09, 0x80, 0xb9, 0xcc, 0xac, 0xcb, 0x9a, 0xba, 0xcc, 0xac, 0xab, 0x9a, 0xba, 0xbd,
+ 0xad, 0xbb, 0xcd, 0xdb, 0x9a, 0x99, 0x98, 0xa9, 0x9a, 0x89, 0xba, 0xcd, 0xa9, 0x99, 0xcb, 0x0a,
+ 0x36, 0xde, 0x26, 0x00, 0x24, 0x91, 0xbc, 0xbb, 0x99, 0x10, 0x11, 0x33, 0x22, 0x73, 0x57, 0x43,
+ 0x01, 0x80, 0x00, 0x22, 0x33, 0x54, 0x43, 0x33, 0x13, 0x22, 0x34, 0x33, 0x22, 0x65, 0x35, 0x24,
+ 0x32, 0x43, 0x33, 0x22, 0x11, 0x31, 0x32, 0x33, 0x22, 0x11, 0x08, 0x41, 0x45, 0x81, 0xcc, 0xab,
+ 0x08, 0x11, 0x22, 0xa0, 0xcd, 0xaa, 0x9a, 0xcc, 0xcc, 0xcc, 0xbb, 0x9b, 0x09, 0x98, 0xdc, 0xbc,
+ 0xaa, 0xbb, 0xbc, 0xbd, 0xcb, 0xbb, 0x9a, 0x9a, 0xdc, 0xcc, 0xba, 0xbc, 0xcc, 0xaa, 0x8a, 0x89,
+ 0x98, 0x98, 0xa8, 0xba, 0xbb, 0xaa, 0xba, 0xac, 0x38, 0x47, 0x13, 0x91, 0xba, 0x9a, 0x10, 0x45,
+ 0x33, 0x12, 0x63, 0x46, 0x35, 0x22, 0x00, 0x00, 0x32, 0x33, 0x43, 0x45, 0x43, 0x22, 0x33, 0x22,
+ 0x22, 0x32, 0x43, 0x54, 0x46, 0x43, 0x33, 0x32, 0x34, 0x33, 0x24, 0x22, 0x01, 0x80, 0x88, 0x80,
+ 0xda, 0xce, 0xcb, 0xbb, 0xdb, 0xcb, 0xcc, 0xba, 0xcb, 0xcb, 0xdb, 0xbb, 0xac, 0xaa, 0xba, 0xca,
+ 0xaa, 0x99, 0x99, 0xa9, 0x8a, 0x18, 0x53, 0x35, 0x34, 0x43, 0x44, 0x43, 0x43, 0x32, 0x34, 0x34,
+ 0x35, 0x32, 0x33, 0x43, 0x32, 0x32, 0x33, 0x32, 0x23, 0x33, 0x23, 0x02, 0xc9, 0xbc, 0xab, 0xcb,
+ 0xce, 0xcc, 0xba, 0xbb, 0xbd, 0xbd, 0xbc, 0xbb, 0xab, 0xcb, 0xcb, 0xaa, 0xaa, 0xa9, 0xba, 0xba,
+ 0x99, 0x32, 0x35, 0x32, 0x53, 0x63, 0x53, 0x33, 0x32, 0x44, 0x44, 0x23, 0x33, 0x33, 0x43, 0x32,
+ 0x23, 0x22, 0x01, 0x10, 0x10, 0x90, 0xdc, 0xdc, 0xbb, 0xcb, 0xdb, 0xcc, 0xbb, 0xac, 0xbb, 0xcc,
+ 0xbc, 0xcb, 0xba, 0xaa, 0xba, 0xcb, 0xaa, 0x99, 0x9a, 0xaa, 0x98, 0x10, 0x54, 0x35, 0x32, 0x43,
+ 0x35, 0x25, 0x23, 0x43, 0x44, 0x43, 0x33, 0x33, 0x32, 0x24, 0x33, 0x24, 0x12, 0x22, 0x32, 0x22,
+ 0xaf, 0x3b, 0x2c, 0x00, 0x00, 0xb9, 0xbc, 0xcb, 0xcb, 0xbd, 0xbd, 0xcb, 0xbb, 0xcc, 0xcc, 0xbb,
+ 0xbb, 0xab, 0xcb, 0xbb, 0xac, 0x8a, 0x99, 0xaa, 0xaa, 0x08, 0x41, 0x45, 0x32, 0x32, 0x54, 0x44,
+ 0x23, 0x32, 0x53, 0x44, 0x33, 0x23, 0x23, 0x43, 0x22, 0x22, 0x22, 0x11, 0x18, 0x10, 0x98, 0xcd,
+ 0xbd, 0xbc, 0xbb, 0xcc, 0xcc, 0xbb, 0xbc, 0xcb, 0xbc, 0xbc, 0xbc, 0xab, 0xab, 0xca, 0xbb, 0xab,
+ 0xa9, 0xaa, 0xab, 0x9a, 0x38, 0x45, 0x34, 0x33, 0x44, 0x35, 0x34, 0x33, 0x34, 0x45, 0x33, 0x24,
+ 0x33, 0x23, 0x24, 0x33, 0x23, 0x32, 0x22, 0x32, 0x24, 0x01, 0xb9, 0xcb, 0xaa, 0xbd, 0xcd, 0xbb,
+ 0xcc, 0xbc, 0xbb, 0xcc, 0xcc, 0xba, 0xaa, 0xba, 0xba, 0xac, 0xaa, 0x9a, 0xaa, 0x9a, 0x89, 0x30,
+ 0x55, 0x24, 0x22, 0x53, 0x44, 0x33, 0x33, 0x44, 0x53, 0x43, 0x23, 0x23, 0x22, 0x43, 0x32, 0x12,
+ 0x11, 0x21, 0x11, 0xa9, 0xbe, 0xbd, 0xcc, 0xcc, 0xcb, 0xdb, 0xcb, 0xba, 0xbb, 0xca, 0xaa, 0xaa,
+ 0xba, 0x89, 0x10, 0x33, 0x54, 0x34, 0x34, 0x35, 0x44, 0x33, 0x32, 0x42, 0x22, 0x21, 0x21, 0x01,
+ 0x98, 0xaa, 0xcc, 0xdc, 0xca, 0xca, 0xbc, 0xcb, 0xba, 0xab, 0xbb, 0xaa, 0xaa, 0x9a, 0x21, 0x44,
+ 0x43, 0x35, 0x34, 0x44, 0x43, 0x34, 0x32, 0x32, 0x33, 0x23, 0x12, 0x22, 0x81, 0xa9, 0xcb, 0xec,
+ 0xcb, 0xcb, 0xcb, 0xbd, 0xbb, 0xba, 0xac, 0xaa, 0xaa, 0xaa, 0x09, 0x21, 0x43, 0x44, 0x44, 0x33,
+ 0x44, 0x44, 0x22, 0x22, 0x33, 0x22, 0x12, 0x12, 0x00, 0xaa, 0xcb, 0xcc, 0xcc, 0xbc, 0xcb, 0xcc,
+ 0xbb, 0xbb, 0xcb, 0xab, 0xba, 0xaa, 0x9a, 0x10, 0x23, 0x34, 0x45, 0x34, 0x34, 0x45, 0x33, 0x32,
+ 0x33, 0x24, 0x12, 0x12, 0x12, 0x88, 0xaa, 0xca, 0xcd, 0xbc, 0xdb, 0xcb, 0xbc, 0xac, 0xba, 0xab,
+ 0xaf, 0xca, 0x37, 0x00, 0x9a, 0xaa, 0x99, 0x20, 0x43, 0x44, 0x34, 0x53, 0x43, 0x44, 0x32, 0x33,
+ 0x33, 0x43, 0x22, 0x21, 0x12, 0x90, 0xa9, 0xca, 0xcc, 0xbc, 0xdb, 0xbc, 0xbd, 0xba, 0xbb, 0xac,
+ 0x9a, 0xaa, 0xaa, 0x08, 0x21, 0x33, 0x46, 0x44, 0x32, 0x44, 0x43, 0x33, 0x33, 0x33, 0x33, 0x21,
+ 0x22, 0x82, 0xbb, 0xbc, 0xcd, 0xcc, 0xbc, 0xdb, 0xdb, 0xba, 0xba, 0xbb, 0xab, 0xab, 0xba, 0x9a,
+ 0x21, 0x43, 0x34, 0x36, 0x34, 0x34, 0x35, 0x34, 0x32, 0x33, 0x24, 0x12, 0x12, 0x02, 0x90, 0xab,
+ 0xdb, 0xbd, 0xad, 0xcb, 0xcc, 0xcb, 0xba, 0xba, 0xbb, 0xbb, 0xba, 0xaa, 0x00, 0x33, 0x63, 0x44,
+ 0x34, 0x43, 0x44, 0x43, 0x23, 0x33, 0x24, 0x22, 0x21, 0x21, 0x81, 0x98, 0xaa, 0xcc, 0xbd, 0xbc,
+ 0xeb, 0xcb, 0xbb, 0xbb, 0xbc, 0xba, 0xaa, 0xa9, 0x8a, 0x21, 0x43, 0x44, 0x53, 0x34, 0x43, 0x44,
+ 0x23, 0x33, 0x33, 0x24, 0x21, 0x21, 0x02, 0x98, 0xaa, 0xcb, 0xce, 0xbb, 0xcc, 0xcc, 0xac, 0xbb,
+ 0xbb, 0xba, 0x9b, 0x89, 0x21, 0x53, 0x35, 0x44, 0x34, 0x43, 0x32, 0x32, 0x22, 0x11, 0x88, 0xb9,
+ 0xbd, 0xcc, 0xcc, 0xbc, 0xbb, 0xcb, 0xaa, 0xaa, 0x89, 0x18, 0x42, 0x43, 0x44, 0x44, 0x33, 0x43,
+ 0x22, 0x22, 0x12, 0x00, 0xa8, 0xca, 0xbc, 0xcd, 0xdb, 0xbb, 0xbb, 0xba, 0xbb, 0xa9, 0x18, 0x41,
+ 0x35, 0x44, 0x43, 0x34, 0x34, 0x32, 0x22, 0x22, 0x11, 0x98, 0xba, 0xbc, 0xce, 0xdb, 0xbb, 0xbc,
+ 0xba, 0xab, 0xaa, 0x89, 0x21, 0x53, 0x53, 0x34, 0x35, 0x43, 0x32, 0x23, 0x22, 0x11, 0x80, 0xa9,
+ 0xcc, 0xcc, 0xbc, 0xcc, 0xab, 0xac, 0xaa, 0xaa, 0x99, 0x00, 0x22, 0x44, 0x44, 0x34, 0x43, 0x33,
+ 0x33, 0x32, 0x22, 0x01, 0x99, 0xdb, 0xdb, 0xcc, 0xbc, 0xac, 0xbb, 0xbb, 0xba, 0xaa, 0x09, 0x31,
+ 0x48, 0xcb, 0x31, 0x00, 0x45, 0x44, 0x43, 0x34, 0x33, 0x32, 0x32, 0x12, 0x01, 0xa9, 0xdb, 0xbc,
+ 0xbe, 0xcc, 0xab, 0xbb, 0xbb, 0xbb, 0x9a, 0x08, 0x42, 0x44, 0x53, 0x34, 0x44, 0x32, 0x22, 0x23,
+ 0x22, 0x01, 0x98, 0xba, 0xcc, 0xdc, 0xcb, 0xac, 0xbb, 0xbb, 0xab, 0xaa, 0x89, 0x31, 0x54, 0x43,
+ 0x53, 0x34, 0x34, 0x32, 0x32, 0x22, 0x11, 0x80, 0xb9, 0xcc, 0xbc, 0xcd, 0xcb, 0xcb, 0xaa, 0xaa,
+ 0x9b, 0x99, 0x10, 0x31, 0x54, 0x53, 0x43, 0x34, 0x32, 0x23, 0x23, 0x12, 0x01, 0xa9, 0xcb, 0xbd,
+ 0xcd, 0xbc, 0xac, 0xbb, 0xbb, 0xba, 0x9a, 0x88, 0x32, 0x44, 0x44, 0x53, 0x34, 0x33, 0x33, 0x23,
+ 0x23, 0x02, 0xa0, 0xba, 0xdd, 0xdb, 0xbc, 0xbc, 0xac, 0xba, 0xaa, 0x9b, 0x89, 0x21, 0x43, 0x44,
+ 0x44, 0x43, 0x43, 0x32, 0x22, 0x13, 0x12, 0x81, 0xa9, 0xbc, 0xdc, 0xdb, 0xcb, 0xbb, 0xbb, 0xcb,
+ 0xaa, 0x89, 0x00, 0x32, 0x54, 0x53, 0x43, 0x34, 0x32, 0x33, 0x32, 0x22, 0x00, 0xa8, 0xda, 0xdb,
+ 0xcc, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0x88, 0x32, 0x55, 0x44, 0x34, 0x34, 0x32, 0x32, 0x12,
+ 0x80, 0xa9, 0xeb, 0xcc, 0xbc, 0xbb, 0xbb, 0xbb, 0x89, 0x10, 0x53, 0x44, 0x44, 0x33, 0x33, 0x33,
+ 0x12, 0x80, 0xa9, 0xbd, 0xbe, 0xbd, 0xcb, 0xaa, 0xab, 0x99, 0x00, 0x33, 0x45, 0x44, 0x33, 0x24,
+ 0x22, 0x22, 0x80, 0xa8, 0xcb, 0xcd, 0xdb, 0xab, 0xbb, 0xba, 0x99, 0x18, 0x33, 0x36, 0x36, 0x43,
+ 0x23, 0x23, 0x22, 0x00, 0xa8, 0xcb, 0xcd, 0xbc, 0xbc, 0xab, 0xab, 0x99, 0x08, 0x42, 0x63, 0x43,
+ 0x34, 0x33, 0x33, 0x22, 0x01, 0x99, 0xdb, 0xdc, 0xcb, 0xac, 0xab, 0xab, 0x99, 0x08, 0x31, 0x44,
+ 0x35, 0x35, 0x32, 0x32, 0x22, 0x01, 0xa8, 0xca, 0xdc, 0xbc, 0xbc, 0xab, 0xbb, 0x9a, 0x09, 0x22,
+ 0x56, 0xd6, 0x34, 0x00, 0x46, 0x53, 0x33, 0x24, 0x22, 0x11, 0x80, 0xa9, 0xdb, 0xcc, 0xdb, 0xab,
+ 0xbb, 0xaa, 0x99, 0x10, 0x33, 0x46, 0x53, 0x43, 0x22, 0x22, 0x12, 0x00, 0x99, 0xcb, 0xcd, 0xbc,
+ 0xbb, 0xac, 0xab, 0x99, 0x10, 0x42, 0x53, 0x44, 0x43, 0x22, 0x23, 0x21, 0x81, 0xa8, 0xda, 0xeb,
+ 0xcb, 0xba, 0xbb, 0xbb, 0x9a, 0x00, 0x43, 0x44, 0x44, 0x43, 0x33, 0x22, 0x22, 0x01, 0xa9, 0xcb,
+ 0xcd, 0xbc, 0xbc, 0xba, 0xab, 0x9b, 0x18, 0x32, 0x45, 0x44, 0x43, 0x23, 0x23, 0x22, 0x01, 0xa8,
+ 0xda, 0xcc, 0xbc, 0xbc, 0xbb, 0xba, 0x9a, 0x08, 0x42, 0x63, 0x43, 0x34, 0x43, 0x22, 0x12, 0x01,
+ 0x98, 0xba, 0xcd, 0xcc, 0xcb, 0xaa, 0xba, 0xa9, 0x08, 0x21, 0x34, 0x36, 0x44, 0x32, 0x32, 0x22,
+ 0x01, 0x98, 0xba, 0xdd, 0xdb, 0xbb, 0xac, 0xab, 0x9a, 0x09, 0x21, 0x34, 0x36, 0x35, 0x32, 0x33,
+ 0x22, 0x12, 0x88, 0xca, 0xdc, 0xcb, 0xbc, 0xcb, 0xaa, 0x99, 0x09, 0x20, 0x43, 0x54, 0x43, 0x33,
+ 0x33, 0x22, 0x12, 0x80, 0xca, 0xcc, 0xcc, 0xcb, 0xba, 0xab, 0xab, 0x88, 0x21, 0x53, 0x44, 0x44,
+ 0x32, 0x23, 0x22, 0x12, 0x80, 0xba, 0xbf, 0xcd, 0xba, 0xbb, 0xaa, 0x09, 0x21, 0x54, 0x34, 0x34,
+ 0x23, 0x22, 0x01, 0xa8, 0xcc, 0xcc, 0xcb, 0xbb, 0xaa, 0x89, 0x10, 0x63, 0x53, 0x33, 0x24, 0x22,
+ 0x10, 0x98, 0xca, 0xbd, 0xbc, 0xbc, 0xaa, 0x9a, 0x10, 0x42, 0x44, 0x34, 0x24, 0x22, 0x11, 0x88,
+ 0xb9, 0xcd, 0xdb, 0xba, 0xbb, 0x99, 0x08, 0x41, 0x44, 0x53, 0x23, 0x23, 0x22, 0x80, 0xb9, 0xdc,
+ 0xbc, 0xbc, 0xab, 0x9a, 0x89, 0x31, 0x45, 0x53, 0x33, 0x24, 0x11, 0x01, 0x99, 0xdb, 0xbc, 0xad,
+ 0xbb, 0xaa, 0x89, 0x10, 0x34, 0x36, 0x34, 0x33, 0x22, 0x01, 0x98, 0xdb, 0xcc, 0xbc, 0xcb, 0xaa,
+ 0x6a, 0xcd, 0x3e, 0x00, 0x88, 0x11, 0x34, 0x35, 0x34, 0x23, 0x22, 0x81, 0xa8, 0xeb, 0xbc, 0xad,
+ 0xbb, 0x9a, 0x89, 0x21, 0x53, 0x35, 0x34, 0x23, 0x13, 0x11, 0x98, 0xeb, 0xdb, 0xcb, 0xbb, 0xab,
+ 0x8a, 0x18, 0x53, 0x44, 0x43, 0x33, 0x23, 0x11, 0x88, 0xca, 0xdc, 0xcb, 0xbb, 0xbb, 0x9a, 0x18,
+ 0x42, 0x54, 0x43, 0x33, 0x33, 0x21, 0x80, 0xb9, 0xdd, 0xcb, 0xac, 0xab, 0xaa, 0x08, 0x21, 0x35,
+ 0x45, 0x32, 0x33, 0x12, 0x01, 0xa9, 0xcc, 0xcc, 0xac, 0xbb, 0xaa, 0x98, 0x21, 0x63, 0x53, 0x33,
+ 0x24, 0x22, 0x00, 0x98, 0xca, 0xbd, 0xcc, 0xba, 0xaa, 0x89, 0x18, 0x53, 0x53, 0x43, 0x33, 0x22,
+ 0x11, 0x90, 0xca, 0xbd, 0xbd, 0xbb, 0xac, 0x99, 0x18, 0x31, 0x36, 0x34, 0x34, 0x22, 0x02, 0x81,
+ 0xb9, 0xcd, 0xbc, 0xbc, 0xab, 0x9b, 0x09, 0x31, 0x45, 0x34, 0x34, 0x23, 0x22, 0x00, 0xa9, 0xdc,
+ 0xbc, 0xbc, 0xbb, 0xaa, 0x89, 0x21, 0x44, 0x35, 0x34, 0x33, 0x23, 0x01, 0x99, 0xeb, 0xdb, 0xac,
+ 0xac, 0xa9, 0x88, 0x18, 0x42, 0x34, 0x44, 0x32, 0x22, 0x01, 0x90, 0xc9, 0xcc, 0xbc, 0xbb, 0xbb,
+ 0x9a, 0x19, 0x52, 0x54, 0x33, 0x24, 0x23, 0x11, 0x80, 0xb9, 0xcd, 0xcc, 0xba, 0xbb, 0x9a, 0x08,
+ 0x31, 0x46, 0x34, 0x33, 0x23, 0x01, 0xa8, 0xdc, 0xcc, 0xbb, 0xaa, 0x99, 0x20, 0x44, 0x44, 0x23,
+ 0x23, 0x11, 0x98, 0xcb, 0xbd, 0xcc, 0xaa, 0x89, 0x18, 0x32, 0x36, 0x34, 0x23, 0x11, 0x80, 0xcb,
+ 0xbd, 0xad, 0xbb, 0x9a, 0x18, 0x32, 0x36, 0x35, 0x32, 0x12, 0x80, 0xc9, 0xdb, 0xbc, 0xac, 0x9a,
+ 0x08, 0x21, 0x54, 0x33, 0x24, 0x12, 0x01, 0xa9, 0xdc, 0xcb, 0xbb, 0xab, 0x09, 0x30, 0x45, 0x34,
+ 0x33, 0x23, 0x02, 0xa9, 0xdc, 0xbc, 0xbc, 0xaa, 0x8a, 0x20, 0x63, 0x53, 0x32, 0x23, 0x01, 0x90,
+ 0xb1, 0x25, 0x3a, 0x00, 0xdc, 0xcb, 0xbb, 0xaa, 0x09, 0x21, 0x45, 0x34, 0x33, 0x23, 0x01, 0xa9,
+ 0xcd, 0xbc, 0xac, 0xab, 0x89, 0x10, 0x44, 0x44, 0x32, 0x22, 0x11, 0x98, 0xbc, 0xcd, 0xbb, 0xbb,
+ 0x99, 0x10, 0x53, 0x35, 0x34, 0x32, 0x11, 0x90, 0xda, 0xdb, 0xac, 0xbb, 0x8a, 0x08, 0x42, 0x44,
+ 0x34, 0x22, 0x12, 0x00, 0xba, 0xbe, 0xbd, 0xba, 0x9a, 0x09, 0x41, 0x44, 0x43, 0x23, 0x22, 0x81,
+ 0xa9, 0xcd, 0xbc, 0xbb, 0xab, 0x89, 0x31, 0x46, 0x43, 0x33, 0x22, 0x01, 0xb8, 0xcc, 0xcc, 0xbb,
+ 0xab, 0x99, 0x21, 0x44, 0x44, 0x33, 0x23, 0x11, 0x98, 0xcc, 0xcc, 0xbb, 0xbb, 0x8a, 0x28, 0x53,
+ 0x35, 0x34, 0x22, 0x12, 0x90, 0xda, 0xbc, 0xad, 0xab, 0x9a, 0x08, 0x32, 0x46, 0x33, 0x33, 0x13,
+ 0x80, 0xd9, 0xeb, 0xbb, 0xcb, 0x9a, 0x88, 0x22, 0x45, 0x34, 0x23, 0x22, 0x00, 0xa9, 0xcd, 0xbc,
+ 0xcb, 0x9a, 0x89, 0x21, 0x34, 0x45, 0x32, 0x22, 0x01, 0x99, 0xcc, 0xbc, 0xbc, 0xaa, 0x8a, 0x10,
+ 0x44, 0x44, 0x32, 0x22, 0x02, 0x90, 0xbc, 0xcd, 0xbb, 0xbb, 0x9a, 0x18, 0x44, 0x44, 0x33, 0x33,
+ 0x12, 0x90, 0xcb, 0xcd, 0xac, 0xbb, 0xa9, 0x08, 0x33, 0x46, 0x33, 0x24, 0x21, 0x80, 0xaa, 0xcd,
+ 0xcb, 0xab, 0xaa, 0x88, 0x32, 0x45, 0x34, 0x33, 0x22, 0x81, 0xa9, 0xcd, 0xcc, 0xba, 0xaa, 0x08,
+ 0x41, 0x35, 0x34, 0x22, 0x01, 0xa9, 0xeb, 0xbc, 0xab, 0x9a, 0x18, 0x63, 0x53, 0x32, 0x12, 0x80,
+ 0xb9, 0xcd, 0xcb, 0xaa, 0x89, 0x20, 0x44, 0x34, 0x32, 0x12, 0x98, 0xda, 0xbd, 0xbb, 0xab, 0x09,
+ 0x42, 0x45, 0x33, 0x32, 0x01, 0xa8, 0xdc, 0xbc, 0xbb, 0x9a, 0x18, 0x63, 0x43, 0x24, 0x12, 0x81,
+ 0xb9, 0xdc, 0xbb, 0xbb, 0x89, 0x20, 0x45, 0x34, 0x23, 0x12, 0x80, 0xdb, 0xcc, 0xab, 0xab, 0x09,
+ 0x9b, 0xd8, 0x3c, 0x00, 0x53, 0x34, 0x24, 0x12, 0x80, 0xc9, 0xbc, 0xbc, 0xab, 0x8a, 0x31, 0x36,
+ 0x34, 0x33, 0x02, 0xa0, 0xeb, 0xbc, 0xac, 0x9b, 0x08, 0x42, 0x34, 0x34, 0x23, 0x81, 0xb8, 0xcd,
+ 0xbc, 0xba, 0x9a, 0x10, 0x53, 0x35, 0x33, 0x13, 0x91, 0xc9, 0xbd, 0xbc, 0xbb, 0x89, 0x31, 0x36,
+ 0x44, 0x22, 0x11, 0x98, 0xda, 0xcb, 0xac, 0x9a, 0x08, 0x31, 0x45, 0x33, 0x32, 0x01, 0xa9, 0xcd,
+ 0xbc, 0xab, 0x9b, 0x10, 0x44, 0x34, 0x24, 0x22, 0x80, 0xb9, 0xcd, 0xac, 0xab, 0x89, 0x21, 0x44,
+ 0x34, 0x23, 0x12, 0x90, 0xdb, 0xbd, 0xbb, 0x9b, 0x09, 0x51, 0x34, 0x25, 0x13, 0x11, 0xa9, 0xeb,
+ 0xcb, 0xba, 0x9a, 0x10, 0x52, 0x34, 0x24, 0x22, 0x00, 0xba, 0xcd, 0xbb, 0xac, 0x89, 0x20, 0x44,
+ 0x34, 0x23, 0x12, 0x90, 0xcb, 0xcd, 0xbb, 0xaa, 0x88, 0x32, 0x46, 0x33, 0x32, 0x01, 0xa8, 0xcd,
+ 0xcb, 0xbb, 0x9a, 0x18, 0x53, 0x44, 0x23, 0x13, 0x81, 0xb9, 0xdd, 0xbb, 0xbb, 0x99, 0x30, 0x54,
+ 0x34, 0x33, 0x11, 0x80, 0xdb, 0xcc, 0xbb, 0xaa, 0x89, 0x32, 0x46, 0x33, 0x23, 0x02, 0xa8, 0xdc,
+ 0xbc, 0xbb, 0x9a, 0x18, 0x43, 0x36, 0x33, 0x23, 0x81, 0xb9, 0xce, 0xcb, 0x9b, 0x8a, 0x20, 0x63,
+ 0x43, 0x23, 0x12, 0x90, 0xca, 0xcc, 0xcb, 0xaa, 0x88, 0x31, 0x35, 0x34, 0x33, 0x11, 0xa8, 0xcc,
+ 0xbd, 0xbb, 0x9a, 0x08, 0x52, 0x44, 0x33, 0x22, 0x00, 0xca, 0xcd, 0xba, 0x9b, 0x08, 0x53, 0x34,
+ 0x33, 0x02, 0xa0, 0xcc, 0xbd, 0xab, 0x99, 0x31, 0x45, 0x33, 0x23, 0x82, 0xba, 0xbf, 0xac, 0x9a,
+ 0x08, 0x53, 0x43, 0x33, 0x02, 0x98, 0xcc, 0xbc, 0xbb, 0x8a, 0x31, 0x45, 0x24, 0x13, 0x81, 0xc9,
+ 0xdb, 0xcb, 0xa9, 0x00, 0x42, 0x34, 0x24, 0x01, 0x90, 0xdb, 0xbc, 0xba, 0x89, 0x30, 0x45, 0x43,
+ 0xae, 0x1f, 0x43, 0x00, 0x11, 0x98, 0xcb, 0xbc, 0x9c, 0x89, 0x20, 0x44, 0x43, 0x12, 0x81, 0xba,
+ 0xdc, 0xab, 0xaa, 0x18, 0x53, 0x34, 0x33, 0x12, 0xa8, 0xdc, 0xac, 0xab, 0x8a, 0x31, 0x45, 0x33,
+ 0x23, 0x00, 0xca, 0xbd, 0xbc, 0x9a, 0x08, 0x53, 0x34, 0x33, 0x02, 0x98, 0xdc, 0xcb, 0xab, 0x0a,
+ 0x21, 0x45, 0x33, 0x23, 0x81, 0xda, 0xbc, 0xbc, 0x9a, 0x18, 0x53, 0x34, 0x33, 0x02, 0xa8, 0xdc,
+ 0xcb, 0xab, 0x89, 0x30, 0x45, 0x43, 0x21, 0x80, 0xb9, 0xbd, 0xbc, 0x9a, 0x08, 0x63, 0x33, 0x24,
+ 0x11, 0x98, 0xcc, 0xcb, 0xab, 0x89, 0x30, 0x36, 0x24, 0x13, 0x00, 0xca, 0xbc, 0xbc, 0x9a, 0x18,
+ 0x53, 0x34, 0x33, 0x12, 0xa8, 0xdc, 0xbc, 0xaa, 0x89, 0x31, 0x45, 0x33, 0x23, 0x80, 0xca, 0xbd,
+ 0xbc, 0x9a, 0x18, 0x53, 0x34, 0x33, 0x02, 0xa8, 0xdc, 0xbc, 0xaa, 0x89, 0x31, 0x45, 0x33, 0x22,
+ 0x81, 0xcb, 0xbd, 0xbc, 0x9a, 0x18, 0x53, 0x34, 0x33, 0x11, 0xa8, 0xcd, 0xac, 0xab, 0x0a, 0x31,
+ 0x45, 0x24, 0x12, 0x80, 0xb9, 0xbd, 0xac, 0x9b, 0x10, 0x53, 0x34, 0x23, 0x02, 0xa8, 0xdc, 0xbc,
+ 0xaa, 0x89, 0x31, 0x45, 0x33, 0x23, 0x80, 0xda, 0xcc, 0xab, 0x9a, 0x18, 0x53, 0x34, 0x24, 0x01,
+ 0xa8, 0xdb, 0xbc, 0xaa, 0x89, 0x31, 0x45, 0x43, 0x12, 0x80, 0xba, 0xcd, 0xab, 0x9a, 0x18, 0x34,
+ 0x35, 0x24, 0x01, 0xa8, 0xdb, 0xbc, 0xaa, 0x89, 0x32, 0x45, 0x33, 0x13, 0x81, 0xcb, 0xcd, 0xab,
+ 0x9a, 0x10, 0x53, 0x34, 0x33, 0x01, 0xc9, 0xcc, 0xcb, 0x99, 0x20, 0x53, 0x43, 0x12, 0x90, 0xca,
+ 0xbc, 0x9c, 0x09, 0x31, 0x35, 0x24, 0x01, 0xa8, 0xcc, 0xac, 0x8a, 0x28, 0x43, 0x34, 0x23, 0x80,
+ 0xdb, 0xbc, 0xac, 0x88, 0x31, 0x35, 0x24, 0x11, 0xa8, 0xcc, 0xac, 0x9a, 0x18, 0x43, 0x25, 0x13,
+ 0xbd, 0x28, 0x41, 0x00, 0xa8, 0xdb, 0xcb, 0x9a, 0x18, 0x43, 0x34, 0x14, 0x81, 0xba, 0xdc, 0xba,
+ 0x89, 0x31, 0x44, 0x24, 0x02, 0x98, 0xdb, 0xcb, 0x9a, 0x08, 0x43, 0x34, 0x33, 0x81, 0xca, 0xcc,
+ 0xbb, 0x9a, 0x31, 0x45, 0x43, 0x02, 0xa0, 0xda, 0xcb, 0xaa, 0x08, 0x42, 0x34, 0x24, 0x81, 0xa9,
+ 0xbd, 0xbc, 0x99, 0x30, 0x53, 0x24, 0x13, 0x90, 0xdb, 0xdb, 0xaa, 0x88, 0x42, 0x43, 0x33, 0x01,
+ 0xb9, 0xcd, 0xcb, 0x8a, 0x28, 0x34, 0x25, 0x13, 0x90, 0xca, 0xbc, 0xab, 0x0a, 0x52, 0x53, 0x23,
+ 0x02, 0xa9, 0xbd, 0xad, 0x9a, 0x10, 0x43, 0x34, 0x23, 0x91, 0xda, 0xbc, 0xac, 0x09, 0x31, 0x44,
+ 0x33, 0x03, 0xa8, 0xcd, 0xcb, 0x9a, 0x18, 0x43, 0x34, 0x33, 0x91, 0xca, 0xbd, 0xac, 0x89, 0x21,
+ 0x35, 0x24, 0x12, 0x98, 0xcc, 0xcb, 0x9a, 0x19, 0x43, 0x44, 0x12, 0x81, 0xb9, 0xcc, 0xbb, 0x9a,
+ 0x31, 0x45, 0x24, 0x02, 0x90, 0xcb, 0xcc, 0x9a, 0x08, 0x32, 0x35, 0x24, 0x81, 0xa9, 0xbd, 0xac,
+ 0x8a, 0x20, 0x44, 0x33, 0x23, 0x98, 0xcc, 0xbc, 0xab, 0x09, 0x42, 0x35, 0x24, 0x01, 0xa9, 0xcc,
+ 0xac, 0x8a, 0x10, 0x53, 0x43, 0x12, 0x80, 0xcb, 0xbc, 0xbb, 0x89, 0x52, 0x34, 0x24, 0x01, 0xa8,
+ 0xcc, 0xac, 0x9a, 0x10, 0x43, 0x44, 0x12, 0x80, 0xba, 0xcd, 0xaa, 0x89, 0x31, 0x35, 0x24, 0x02,
+ 0xa8, 0xeb, 0xbb, 0xaa, 0x18, 0x44, 0x34, 0x22, 0x81, 0xca, 0xcc, 0xab, 0x89, 0x30, 0x45, 0x33,
+ 0x02, 0xa0, 0xcc, 0xbc, 0xaa, 0x18, 0x53, 0x24, 0x23, 0x81, 0xc9, 0xcc, 0xab, 0x8a, 0x21, 0x45,
+ 0x23, 0x12, 0xa9, 0xcd, 0xab, 0x9a, 0x32, 0x45, 0x23, 0x01, 0xc9, 0xbc, 0xac, 0x09, 0x41, 0x34,
+ 0x23, 0x91, 0xda, 0xbc, 0xab, 0x19, 0x63, 0x43, 0x12, 0x90, 0xcb, 0xac, 0x9b, 0x20, 0x44, 0x24,
+ 0xff, 0x24, 0x43, 0x00, 0x80, 0xc9, 0xcb, 0xab, 0x18, 0x52, 0x43, 0x22, 0x90, 0xdb, 0xac, 0xaa,
+ 0x10, 0x34, 0x25, 0x12, 0xa8, 0xdb, 0xac, 0x8a, 0x20, 0x44, 0x33, 0x11, 0xb9, 0xcd, 0xbb, 0x0a,
+ 0x41, 0x44, 0x22, 0x01, 0xca, 0xdb, 0xaa, 0x19, 0x42, 0x53, 0x12, 0x80, 0xca, 0xbc, 0xab, 0x10,
+ 0x63, 0x33, 0x13, 0xa0, 0xcc, 0xbc, 0x9a, 0x20, 0x35, 0x34, 0x01, 0xb8, 0xcc, 0xac, 0x89, 0x31,
+ 0x44, 0x23, 0x81, 0xc9, 0xbc, 0xac, 0x08, 0x41, 0x34, 0x23, 0x80, 0xdb, 0xbc, 0xaa, 0x18, 0x53,
+ 0x34, 0x12, 0x90, 0xcc, 0xcb, 0x8a, 0x28, 0x44, 0x33, 0x11, 0xa9, 0xbd, 0xad, 0x99, 0x21, 0x35,
+ 0x33, 0x01, 0xc9, 0xcc, 0xab, 0x0a, 0x42, 0x44, 0x22, 0x91, 0xba, 0xbe, 0xaa, 0x08, 0x53, 0x43,
+ 0x22, 0x90, 0xdb, 0xac, 0x9b, 0x20, 0x53, 0x24, 0x12, 0xa8, 0xeb, 0xab, 0x9a, 0x31, 0x44, 0x24,
+ 0x01, 0xa9, 0xcc, 0xbb, 0x09, 0x41, 0x44, 0x22, 0x81, 0xba, 0xbd, 0x9c, 0x09, 0x42, 0x34, 0x13,
+ 0x80, 0xdb, 0xbc, 0xab, 0x20, 0x63, 0x33, 0x22, 0xa8, 0xdc, 0xbb, 0x9a, 0x20, 0x45, 0x33, 0x02,
+ 0xb9, 0xcd, 0xbb, 0x89, 0x31, 0x36, 0x33, 0x81, 0xd9, 0xbc, 0xab, 0x09, 0x52, 0x44, 0x12, 0x80,
+ 0xca, 0xcb, 0x9a, 0x18, 0x43, 0x44, 0x02, 0x90, 0xdb, 0xbb, 0x9b, 0x30, 0x54, 0x33, 0x02, 0xb8,
+ 0xcd, 0xbb, 0x89, 0x40, 0x34, 0x24, 0x01, 0xc9, 0xdb, 0xaa, 0x89, 0x42, 0x53, 0x22, 0x81, 0xbb,
+ 0xbe, 0xaa, 0x08, 0x53, 0x24, 0x13, 0x90, 0xdb, 0xbc, 0x9a, 0x20, 0x53, 0x24, 0x02, 0xa0, 0xcc,
+ 0xbb, 0x8a, 0x30, 0x36, 0x33, 0x02, 0xba, 0xdd, 0xab, 0x09, 0x32, 0x03, 0xb9, 0xbb, 0x89, 0x98,
+ 0x89, 0x00, 0x88, 0x09, 0x21, 0x81, 0x08, 0x32, 0x92, 0x19, 0x45, 0x01, 0x18, 0x42, 0x91, 0x08,
+ 0xf6, 0xdf, 0x1f, 0x00, 0x34, 0x01, 0x21, 0x44, 0x22, 0x01, 0x90, 0x20, 0x46, 0x23, 0x22, 0x42,
+ 0x02, 0x99, 0x28, 0x34, 0x01, 0x18, 0x46, 0x03, 0xbb, 0x3a, 0x47, 0x12, 0x00, 0x23, 0x82, 0xaa,
+ 0x08, 0x88, 0x51, 0x37, 0x02, 0x18, 0x63, 0x81, 0xcb, 0x29, 0x45, 0x22, 0x90, 0x09, 0x43, 0x83,
+ 0xad, 0x49, 0x34, 0x02, 0x31, 0x03, 0x89, 0x63, 0x13, 0x99, 0x73, 0x14, 0x88, 0x31, 0x13, 0x99,
+ 0x72, 0x26, 0x81, 0x09, 0x32, 0x04, 0x99, 0x30, 0x27, 0xa0, 0x8a, 0x41, 0x12, 0x00, 0x20, 0x12,
+ 0x00, 0x64, 0x13, 0x98, 0x38, 0x27, 0x82, 0x09, 0x42, 0x03, 0x88, 0x40, 0x35, 0x22, 0x00, 0xb8,
+ 0x0a, 0x56, 0x14, 0x90, 0x88, 0x98, 0x8a, 0x55, 0x14, 0x99, 0x09, 0x22, 0x81, 0x08, 0x80, 0x9a,
+ 0x0a, 0x30, 0x32, 0x13, 0xa9, 0x8b, 0x31, 0xf0, 0xcc, 0x19, 0x35, 0x02, 0xb9, 0xdc, 0xcb, 0x1a,
+ 0x63, 0x24, 0x90, 0x0a, 0x55, 0x04, 0xb8, 0x8a, 0x20, 0x22, 0x82, 0xa9, 0x73, 0x47, 0x90, 0x28,
+ 0x43, 0x91, 0x89, 0x22, 0x81, 0xaa, 0x89, 0x30, 0x56, 0x23, 0x81, 0x11, 0x90, 0x29, 0x77, 0x02,
+ 0x98, 0x09, 0x88, 0x18, 0x64, 0x23, 0x80, 0x10, 0x82, 0xeb, 0x8a, 0x62, 0x23, 0x81, 0x08, 0x21,
+ 0x90, 0x09, 0x11, 0xf9, 0x9a, 0x54, 0x24, 0x02, 0x88, 0x89, 0x09, 0x21, 0x91, 0xdb, 0x0a, 0x32,
+ 0x22, 0xa8, 0x9a, 0x30, 0xa4, 0xff, 0xbf, 0x09, 0x01, 0x00, 0x21, 0x01, 0xb9, 0x19, 0x82, 0xff,
+ 0xbb, 0x19, 0x22, 0x01, 0x88, 0xa9, 0x8a, 0x01, 0xfd, 0xac, 0x08, 0x00, 0x98, 0x80, 0x90, 0x99,
+ 0x20, 0x23, 0x81, 0xda, 0xac, 0x89, 0x32, 0x35, 0x02, 0xcb, 0x29, 0x35, 0x81, 0x18, 0x81, 0xff,
+ 0x29, 0x47, 0x02, 0xa8, 0x08, 0x12, 0x88, 0x00, 0x10, 0x98, 0xba, 0x0c, 0x67, 0x34, 0x01, 0x8a,
+ 0xab, 0x05, 0x17, 0x00, 0x01, 0x81, 0x80, 0x90, 0xca, 0x2a, 0x77, 0x12, 0x98, 0x08, 0x11, 0xa8,
+ 0x99, 0x20, 0x00, 0x99, 0x8a, 0x62, 0x82, 0xbc, 0x71, 0x36, 0x01, 0x18, 0x81, 0xcd, 0x9c, 0x10,
+ 0x91, 0xa9, 0x09, 0x23, 0x11, 0x12, 0xb8, 0x9f, 0x38, 0xb1, 0xff, 0x9a, 0x11, 0x81, 0x89, 0x18,
+ 0x88, 0x9a, 0x08, 0x11, 0x11, 0x88, 0x40, 0x04, 0xff, 0xad, 0x09, 0x01, 0x00, 0x09, 0x08, 0x88,
+ 0x08, 0x00, 0x00, 0x80, 0x98, 0x19, 0x81, 0xda, 0x9b, 0x42, 0x24, 0x01, 0x11, 0xb0, 0x9d, 0x47,
+ 0xb1, 0xcf, 0x61, 0x25, 0xa8, 0xac, 0x08, 0x11, 0x89, 0x08, 0x10, 0x88, 0x80, 0x88, 0x08, 0x90,
+ 0x98, 0x20, 0x12, 0x89, 0x21, 0x90, 0x9a, 0xb9, 0xac, 0x31, 0x26, 0xa0, 0xaa, 0x99, 0x99, 0x00,
+ 0x53, 0x14, 0xc9, 0x9b, 0x41, 0x01, 0x9b, 0x98, 0xaa, 0x41, 0x14, 0xb9, 0x39, 0x93, 0xaf, 0x73,
+ 0x94, 0xef, 0x9b, 0x18, 0x81, 0x88, 0x18, 0x00, 0x99, 0x89, 0x01, 0x00, 0x80, 0xa9, 0x10, 0x23,
+ 0x01, 0xb9, 0xba, 0x9a, 0x99, 0x99, 0x10, 0x21, 0x02, 0xb9, 0x1b, 0x53, 0xb9, 0x3c, 0x77, 0x67,
+ 0x90, 0xaa, 0x9a, 0x00, 0x81, 0x80, 0x08, 0x80, 0x88, 0x88, 0x00, 0x11, 0xa9, 0x18, 0x25, 0xfb,
+ 0x2b, 0x77, 0x13, 0x88, 0x08, 0x10, 0x89, 0x89, 0x11, 0x81, 0x98, 0x99, 0x09, 0x21, 0x01, 0x99,
+ 0x90, 0x31, 0x02, 0x99, 0x19, 0x02, 0xca, 0x9b, 0x63, 0x02, 0x89, 0x01, 0xba, 0x1c, 0x33, 0xfb,
+ 0x39, 0x17, 0xfe, 0xbb, 0x1a, 0x11, 0x98, 0x09, 0x01, 0xa8, 0x18, 0x23, 0xca, 0x39, 0x15, 0xfe,
+ 0xad, 0x08, 0x01, 0x98, 0x08, 0x10, 0x98, 0x19, 0x11, 0xb9, 0x39, 0x27, 0xfa, 0xbf, 0x88, 0x01,
+ 0x88, 0x08, 0x81, 0x88, 0x18, 0x00, 0x99, 0x8a, 0x10, 0x11, 0x11, 0x01, 0x10, 0x91, 0x9b, 0x52,
+ 0xf7, 0x01, 0x04, 0x00, 0xb8, 0xae, 0x19, 0x33, 0xb9, 0x2a, 0x37, 0xa0, 0x0a, 0x23, 0xee, 0x49,
+ 0x77, 0x12, 0x98, 0x08, 0x00, 0x88, 0x00, 0x08, 0x80, 0x90, 0x89, 0x28, 0x12, 0xa0, 0x09, 0xa0,
+ 0xbb, 0x19, 0xb1, 0x3b, 0x57, 0xa0, 0x8c, 0x77, 0x24, 0x90, 0xdb, 0x9a, 0x00, 0x00, 0x88, 0x08,
+ 0x00, 0x88, 0x80, 0x00, 0x98, 0x10, 0x90, 0xab, 0x38, 0x84, 0xbc, 0x40, 0x83, 0x9c, 0x74, 0xe0,
+ 0xcf, 0x9a, 0x01, 0x81, 0x89, 0x00, 0x80, 0x09, 0x10, 0x90, 0x09, 0x20, 0x01, 0xa9, 0x9a, 0x22,
+ 0x02, 0x99, 0x19, 0x11, 0x09, 0x11, 0xa0, 0xab, 0x41, 0x01, 0xaa, 0x11, 0x91, 0x19, 0x43, 0xba,
+ 0x0e, 0x33, 0xf9, 0x1a, 0x27, 0xfa, 0xaf, 0x89, 0x01, 0x80, 0x88, 0x01, 0x88, 0x88, 0x10, 0x98,
+ 0x09, 0x00, 0x88, 0x98, 0x01, 0x90, 0x10, 0x19, 0x09, 0x21, 0x01, 0xa9, 0x10, 0x91, 0xba, 0x09,
+ 0x32, 0x03, 0x99, 0x9b, 0x11, 0x11, 0x99, 0x99, 0x11, 0x22, 0x99, 0xaa, 0x11, 0x91, 0x09, 0x09,
+ 0x01, 0x10, 0x01, 0x91, 0x09, 0x10, 0x11, 0x91, 0x9b, 0x09, 0x11, 0x01, 0x10, 0x01, 0xa9, 0x30,
+ 0x03, 0xb9, 0x1a, 0x03, 0xa9, 0x29, 0xa1, 0x1b, 0x36, 0xe9, 0x0c, 0x77, 0x24, 0x90, 0x89, 0x11,
+ 0xa1, 0xdd, 0x9a, 0x18, 0x80, 0x08, 0x08, 0x88, 0x11, 0xa8, 0x0c, 0x77, 0x13, 0x80, 0x89, 0x10,
+ 0x90, 0x08, 0x00, 0x88, 0x88, 0x00, 0x88, 0x00, 0x00, 0x88, 0x10, 0x11, 0x09, 0x09, 0x00, 0x01,
+ 0x90, 0x01, 0x91, 0x10, 0x11, 0x90, 0x0b, 0x00, 0x00, 0x11, 0x91, 0xab, 0x53, 0x91, 0xac, 0x63,
+ 0xc1, 0x8d, 0x44, 0xf1, 0xcd, 0x09, 0x90, 0xdb, 0x8b, 0x11, 0x80, 0x89, 0x10, 0x90, 0x88, 0x01,
+ 0x98, 0x08, 0x10, 0x88, 0x09, 0x00, 0x09,
+};
@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define PACMANDEATH_BITS_PER_SAMPLE 4
+#define PACMANDEATH_SAMPLE_RATE 32000
+#define PACMANDEATH_SAMPLES 49471
+#define PACMANDEATH_BYTES 25095
+
+extern const uint8_t pacmanDeath[PACMANDEATH_BYTES];
@@ -0,0 +1,1284 @@
+
+#include <stdint.h>
+
+const uint8_t powerUp[] = {
+ 0x4c, 0x53, 0x4e, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x7f, 0x9d, 0x00, 0x00,
+ 0xff, 0xff, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x9a, 0x10, 0x12, 0x03, 0x90, 0xeb, 0xdb, 0xbc, 0xbd,
+ 0xcb, 0xbb, 0xaa, 0x89, 0x32, 0x55, 0x44, 0x43, 0x43, 0x33, 0x33, 0x24, 0x33, 0x33, 0x43, 0x53,
+ 0x33, 0x34, 0x43, 0x22, 0x01, 0xc9, 0xdd, 0xcc, 0xbc, 0xbd, 0xbc, 0xbb, 0xcb, 0xaa, 0x89, 0x08,
+ 0x22, 0x53, 0x43, 0x23, 0x23, 0x01, 0xa0, 0xca, 0xcb, 0xab, 0x09, 0x54, 0x55, 0x34, 0x45, 0x33,
+ 0x34, 0x33, 0x22, 0x01, 0xa9, 0xbd, 0xcd, 0xcb, 0xcb, 0xaa, 0xaa, 0x89, 0x18, 0x31, 0x43, 0x43,
+ 0x22, 0x81, 0xb9, 0xce, 0xdb, 0xac, 0xcb, 0x9a, 0x8a, 0x18, 0x42, 0x44, 0x53, 0x23, 0x24, 0x12,
+ 0x02, 0x90, 0xa9, 0xcb, 0xbb, 0xac, 0x99, 0x10, 0x63, 0x53, 0x43, 0x33, 0x24, 0x21, 0x00, 0x99,
+ 0xcb, 0xbc, 0xcb, 0xab, 0xab, 0x9a, 0x89, 0x99, 0xca, 0xcd, 0xdc, 0xcb, 0xbc, 0xbc, 0xac, 0xaa,
+ 0x99, 0x19, 0x21, 0x34, 0x35, 0x43, 0x33, 0x22, 0x22, 0x11, 0x22, 0x63, 0x44, 0x35, 0x45, 0x43,
+ 0x43, 0x32, 0x33, 0x12, 0x80, 0xca, 0xcc, 0xcc, 0xbb, 0xbc, 0xbb, 0xbb, 0x9a, 0x89, 0x88, 0x08,
+ 0x99, 0xdb, 0xcd, 0xdb, 0xcb, 0xbb, 0xac, 0x89, 0x18, 0x53, 0x45, 0x53, 0x33, 0x44, 0x22, 0x32,
+ 0x11, 0x01, 0x90, 0xa9, 0xbb, 0xbb, 0xab, 0x8a, 0x10, 0x43, 0x43, 0x22, 0x98, 0xed, 0xdc, 0xdb,
+ 0xcb, 0xbc, 0xbb, 0xbb, 0xab, 0x8a, 0x08, 0x32, 0x45, 0x43, 0x43, 0x32, 0x33, 0x32, 0x22, 0x22,
+ 0x23, 0x42, 0x33, 0x44, 0x33, 0x34, 0x23, 0x22, 0x00, 0xb9, 0xdc, 0xcb, 0xbc, 0xbb, 0xac, 0xab,
+ 0xbb, 0xbb, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xbb, 0xbb, 0x99, 0x21, 0x55, 0x34, 0x35, 0x34, 0x32,
+ 0x22, 0x00, 0xa9, 0xcc, 0xbc, 0xcb, 0xab, 0x89, 0x20, 0x44, 0x35, 0x35, 0x32, 0x23, 0x02, 0xa9,
+ 0x6f, 0x0a, 0x27, 0x00, 0xce, 0xcb, 0xac, 0xab, 0x9a, 0x08, 0x32, 0x36, 0x44, 0x33, 0x23, 0x12,
+ 0x91, 0xca, 0xbd, 0xbd, 0xbb, 0xac, 0x9a, 0x00, 0x31, 0x44, 0x34, 0x33, 0x33, 0x01, 0xa8, 0xcd,
+ 0xbc, 0xbd, 0xbb, 0xab, 0x9a, 0x00, 0x43, 0x45, 0x43, 0x24, 0x33, 0x33, 0x22, 0x11, 0x80, 0x99,
+ 0xbb, 0xbc, 0xac, 0xaa, 0xaa, 0x88, 0x08, 0x01, 0x01, 0xa8, 0xdd, 0xcd, 0xbd, 0xcd, 0xcb, 0xbc,
+ 0xcb, 0xba, 0xab, 0x9a, 0x08, 0x42, 0x45, 0x44, 0x43, 0x33, 0x24, 0x23, 0x22, 0x11, 0x80, 0x99,
+ 0xaa, 0xab, 0x9a, 0x18, 0x42, 0x34, 0x34, 0x13, 0xa8, 0xde, 0xcd, 0xcc, 0xcb, 0xac, 0xbb, 0xbb,
+ 0xaa, 0x09, 0x20, 0x53, 0x53, 0x43, 0x33, 0x33, 0x23, 0x12, 0x10, 0x08, 0x08, 0x20, 0x53, 0x54,
+ 0x34, 0x34, 0x34, 0x32, 0x12, 0x80, 0xcb, 0xcd, 0xbc, 0xbd, 0xbb, 0xbc, 0xab, 0xaa, 0x99, 0x00,
+ 0x21, 0x43, 0x33, 0x24, 0x12, 0x00, 0xa8, 0xba, 0xbc, 0x9b, 0x18, 0x64, 0x45, 0x44, 0x43, 0x24,
+ 0x33, 0x33, 0x22, 0x80, 0xa9, 0xcd, 0xdb, 0xbb, 0xbb, 0xac, 0x89, 0x08, 0x31, 0x43, 0x43, 0x12,
+ 0x91, 0xda, 0xcd, 0xbc, 0xcc, 0xba, 0xab, 0x99, 0x18, 0x43, 0x35, 0x35, 0x34, 0x32, 0x23, 0x11,
+ 0x88, 0xaa, 0xbc, 0xab, 0x9b, 0x10, 0x54, 0x44, 0x34, 0x33, 0x23, 0x81, 0xd9, 0xdc, 0xdb, 0xcb,
+ 0xbb, 0xbb, 0xaa, 0x89, 0x20, 0x43, 0x44, 0x33, 0x32, 0x12, 0x80, 0xb9, 0xbc, 0xbc, 0x8a, 0x28,
+ 0x45, 0x45, 0x34, 0x34, 0x43, 0x12, 0x01, 0x98, 0xcb, 0xcc, 0xbc, 0xbb, 0xac, 0x9a, 0x89, 0x00,
+ 0x32, 0x43, 0x43, 0x12, 0x00, 0xa9, 0xcc, 0xdb, 0xab, 0xab, 0x89, 0x21, 0x55, 0x34, 0x35, 0x33,
+ 0x24, 0x22, 0x00, 0xa9, 0xdb, 0xcc, 0xbb, 0xac, 0xab, 0x99, 0x18, 0x32, 0x45, 0x24, 0x24, 0x22,
+ 0x18, 0x0f, 0x32, 0x00, 0x81, 0x98, 0xbb, 0xbe, 0xcb, 0xbb, 0xab, 0x89, 0x20, 0x52, 0x43, 0x33,
+ 0x23, 0x01, 0xb9, 0xce, 0xbc, 0xbc, 0xbb, 0x9a, 0x28, 0x63, 0x35, 0x35, 0x24, 0x33, 0x23, 0x12,
+ 0x88, 0xca, 0xbc, 0xbc, 0xcb, 0xaa, 0x99, 0x08, 0x10, 0x11, 0x00, 0xba, 0xcf, 0xcc, 0xcb, 0xbb,
+ 0xab, 0x9a, 0x21, 0x54, 0x35, 0x44, 0x33, 0x33, 0x22, 0x01, 0x99, 0xdb, 0xcb, 0xab, 0xab, 0x09,
+ 0x31, 0x45, 0x34, 0x24, 0x13, 0x81, 0xb9, 0xdd, 0xbc, 0xbc, 0xbb, 0xbb, 0x9a, 0x10, 0x43, 0x44,
+ 0x33, 0x24, 0x12, 0x90, 0xb9, 0xcd, 0xbb, 0xcb, 0x99, 0x18, 0x43, 0x45, 0x34, 0x34, 0x32, 0x13,
+ 0x02, 0x98, 0xca, 0xcb, 0xbb, 0xbb, 0x9a, 0x00, 0x32, 0x44, 0x32, 0x81, 0xc9, 0xce, 0xcc, 0xbc,
+ 0xcb, 0xbb, 0xab, 0x9a, 0x08, 0x31, 0x53, 0x43, 0x33, 0x43, 0x32, 0x22, 0x33, 0x44, 0x43, 0x44,
+ 0x43, 0x43, 0x33, 0x23, 0x23, 0x81, 0xb8, 0xcc, 0xbd, 0xcc, 0xbb, 0xbb, 0xbc, 0xba, 0xab, 0xbb,
+ 0xbb, 0xbc, 0xbb, 0xbc, 0xab, 0x8a, 0x18, 0x54, 0x44, 0x44, 0x43, 0x33, 0x24, 0x23, 0x22, 0x01,
+ 0x80, 0x98, 0xa9, 0x89, 0x18, 0x42, 0x54, 0x43, 0x24, 0x33, 0x23, 0x01, 0x98, 0xcc, 0xcc, 0xcc,
+ 0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xba, 0xac, 0xaa, 0xaa, 0xaa, 0xa9, 0x89, 0x18, 0x31, 0x54, 0x44,
+ 0x44, 0x53, 0x43, 0x43, 0x43, 0x43, 0x33, 0x33, 0x24, 0x12, 0x01, 0x98, 0xca, 0xcc, 0xdb, 0xba,
+ 0xac, 0xaa, 0x9a, 0x99, 0x89, 0x99, 0xb9, 0xbd, 0xbe, 0xcc, 0xbb, 0xcb, 0xaa, 0x88, 0x21, 0x54,
+ 0x34, 0x35, 0x33, 0x43, 0x22, 0x11, 0x00, 0x98, 0x9a, 0xaa, 0x99, 0x08, 0x41, 0x53, 0x43, 0x33,
+ 0x23, 0x02, 0xb9, 0xcf, 0xbc, 0xcd, 0xbb, 0xcb, 0xba, 0xa9, 0x08, 0x21, 0x43, 0x24, 0x23, 0x00,
+ 0x87, 0xfc, 0x26, 0x00, 0xcb, 0xbd, 0xbc, 0xab, 0x08, 0x53, 0x45, 0x34, 0x34, 0x33, 0x22, 0x01,
+ 0x98, 0xbb, 0xcb, 0xba, 0x9a, 0x98, 0x98, 0xda, 0xcd, 0xbd, 0xbd, 0xcb, 0xaa, 0x8a, 0x18, 0x43,
+ 0x35, 0x34, 0x33, 0x33, 0x22, 0x12, 0x22, 0x53, 0x53, 0x43, 0x23, 0x12, 0xb8, 0xce, 0xcd, 0xdb,
+ 0xba, 0xbb, 0xaa, 0x09, 0x20, 0x42, 0x33, 0x33, 0x11, 0x80, 0xaa, 0xab, 0x89, 0x63, 0x45, 0x34,
+ 0x34, 0x33, 0x23, 0x11, 0x10, 0x00, 0x32, 0x44, 0x43, 0x23, 0x91, 0xfb, 0xdc, 0xcb, 0xcb, 0xaa,
+ 0x09, 0x20, 0x43, 0x24, 0x13, 0xa0, 0xcd, 0xbe, 0xbc, 0xbc, 0xaa, 0x09, 0x20, 0x53, 0x53, 0x32,
+ 0x32, 0x11, 0x01, 0x08, 0x18, 0x32, 0x45, 0x35, 0x43, 0x32, 0x12, 0x81, 0x99, 0xba, 0xbc, 0xbb,
+ 0xcb, 0xcc, 0xcc, 0xcc, 0xcb, 0xbc, 0xbb, 0xaa, 0x89, 0x21, 0x53, 0x43, 0x32, 0x01, 0x90, 0xba,
+ 0xab, 0x19, 0x56, 0x45, 0x34, 0x34, 0x23, 0x12, 0x90, 0xcb, 0xcc, 0xbb, 0xab, 0x9a, 0x10, 0x32,
+ 0x25, 0x23, 0x11, 0x99, 0xdb, 0xdb, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xbc, 0xbc, 0xbc, 0x9a, 0x18,
+ 0x44, 0x45, 0x43, 0x32, 0x12, 0x01, 0x98, 0x89, 0x20, 0x56, 0x44, 0x44, 0x32, 0x13, 0x01, 0xc9,
+ 0xeb, 0xcb, 0xbb, 0xba, 0x9a, 0x89, 0x00, 0x80, 0xa9, 0xdb, 0xbc, 0xab, 0x0a, 0x52, 0x45, 0x34,
+ 0x24, 0x13, 0x01, 0x99, 0xab, 0xab, 0x18, 0x55, 0x44, 0x34, 0x22, 0x82, 0xb8, 0xcd, 0xbc, 0xcb,
+ 0xa9, 0x08, 0x11, 0x33, 0x22, 0x90, 0xfb, 0xdb, 0xbb, 0xba, 0x89, 0x21, 0x34, 0x34, 0x12, 0x91,
+ 0xa9, 0x9a, 0x40, 0x47, 0x36, 0x44, 0x32, 0x22, 0x81, 0xba, 0xdc, 0xbb, 0xab, 0x9a, 0x18, 0x32,
+ 0x32, 0x81, 0xfb, 0xcc, 0xbc, 0xbb, 0xab, 0x89, 0x11, 0x32, 0x14, 0x11, 0x98, 0x88, 0x51, 0x46,
+ 0xab, 0xf6, 0x34, 0x00, 0x46, 0x34, 0x32, 0x13, 0x01, 0xaa, 0xcc, 0xcb, 0xba, 0x99, 0x08, 0x10,
+ 0x81, 0xa8, 0xdc, 0xbd, 0xcb, 0xab, 0x99, 0x11, 0x43, 0x34, 0x33, 0x12, 0x88, 0xba, 0xaa, 0x09,
+ 0x63, 0x54, 0x33, 0x23, 0x81, 0xb9, 0xbd, 0xbb, 0x08, 0x64, 0x54, 0x33, 0x24, 0x12, 0x90, 0xcb,
+ 0xcc, 0xbb, 0xbb, 0x9b, 0x9a, 0x89, 0xba, 0xcc, 0xcc, 0xbb, 0xaa, 0x08, 0x53, 0x45, 0x43, 0x33,
+ 0x22, 0x01, 0x98, 0x99, 0x89, 0x21, 0x45, 0x53, 0x32, 0x22, 0x80, 0xca, 0xcb, 0xac, 0xaa, 0x89,
+ 0x10, 0x00, 0x90, 0xeb, 0xcc, 0xdb, 0xba, 0xba, 0x9a, 0xa9, 0xaa, 0xcc, 0xbc, 0xbc, 0xab, 0x28,
+ 0x55, 0x45, 0x44, 0x33, 0x33, 0x22, 0x02, 0x88, 0x9a, 0xab, 0x9a, 0x99, 0x98, 0xba, 0xce, 0xbd,
+ 0xbc, 0xac, 0x9b, 0x8a, 0x88, 0x98, 0xca, 0xdd, 0xcb, 0xbb, 0xab, 0x18, 0x63, 0x35, 0x35, 0x32,
+ 0x23, 0x11, 0x00, 0x10, 0x21, 0x54, 0x43, 0x23, 0x12, 0xb8, 0xdd, 0xcc, 0xbb, 0xbb, 0xaa, 0x89,
+ 0x08, 0x00, 0x99, 0xba, 0xad, 0x9b, 0x28, 0x54, 0x35, 0x24, 0x23, 0x81, 0xa9, 0xcb, 0xab, 0x18,
+ 0x55, 0x44, 0x34, 0x43, 0x12, 0x00, 0xa9, 0xcb, 0xbb, 0xac, 0xaa, 0xaa, 0xaa, 0xbb, 0xbe, 0xbc,
+ 0xac, 0xab, 0x9a, 0x18, 0x32, 0x44, 0x34, 0x33, 0x24, 0x33, 0x24, 0x24, 0x34, 0x43, 0x33, 0x24,
+ 0x21, 0x90, 0xc9, 0xcc, 0xbc, 0xbc, 0xba, 0xa9, 0x08, 0x12, 0x33, 0x02, 0xb8, 0xcf, 0xbd, 0xac,
+ 0xbb, 0x9a, 0x00, 0x22, 0x24, 0x23, 0x11, 0x01, 0x31, 0x57, 0x54, 0x34, 0x44, 0x22, 0x12, 0x91,
+ 0xb9, 0xbd, 0xbc, 0xab, 0x9a, 0x09, 0x00, 0x80, 0xc9, 0xdc, 0xcb, 0xcb, 0x99, 0x08, 0x32, 0x45,
+ 0x33, 0x23, 0x01, 0x98, 0xab, 0x9b, 0x19, 0x63, 0x34, 0x34, 0x12, 0x98, 0xdb, 0xbc, 0x9a, 0x18,
+ 0x0a, 0x00, 0x2a, 0x00, 0x47, 0x34, 0x33, 0x13, 0x91, 0xdb, 0xcc, 0xbb, 0xac, 0x9a, 0x89, 0x88,
+ 0x99, 0xca, 0xbc, 0xad, 0x9b, 0x09, 0x42, 0x45, 0x43, 0x33, 0x23, 0x01, 0x88, 0x99, 0x09, 0x31,
+ 0x46, 0x53, 0x32, 0x12, 0x90, 0xca, 0xbc, 0xac, 0x9b, 0x89, 0x18, 0x00, 0x90, 0xdb, 0xcd, 0xcb,
+ 0xbb, 0xab, 0x9b, 0xaa, 0xca, 0xbc, 0xbe, 0xbb, 0x9b, 0x30, 0x66, 0x44, 0x53, 0x33, 0x33, 0x22,
+ 0x00, 0x90, 0x9a, 0xab, 0xa9, 0x98, 0x99, 0xca, 0xdc, 0xcc, 0xcb, 0xab, 0x9b, 0x8a, 0x88, 0x98,
+ 0xeb, 0xcc, 0xbc, 0xbc, 0x9a, 0x18, 0x44, 0x54, 0x33, 0x43, 0x12, 0x11, 0x00, 0x18, 0x30, 0x53,
+ 0x34, 0x33, 0x02, 0xc8, 0xcd, 0xbd, 0xcb, 0xba, 0x9a, 0x88, 0x08, 0x80, 0x98, 0xba, 0xcb, 0x8a,
+ 0x20, 0x46, 0x34, 0x24, 0x12, 0x90, 0xba, 0xbc, 0x9b, 0x40, 0x55, 0x44, 0x33, 0x43, 0x11, 0x00,
+ 0xa9, 0xbb, 0xcb, 0xba, 0xba, 0xbc, 0xcc, 0xdb, 0xcb, 0xab, 0xab, 0x8a, 0x18, 0x32, 0x34, 0x34,
+ 0x33, 0x34, 0x53, 0x53, 0x43, 0x33, 0x23, 0x12, 0x80, 0xbb, 0xbe, 0xcb, 0xab, 0xaa, 0x9a, 0xaa,
+ 0xaa, 0xbb, 0x9c, 0x89, 0x31, 0x46, 0x33, 0x12, 0xa0, 0xdd, 0xdb, 0xba, 0x99, 0x10, 0x34, 0x35,
+ 0x33, 0x01, 0x98, 0xba, 0x89, 0x73, 0x45, 0x35, 0x33, 0x13, 0x91, 0xcc, 0xbd, 0xbc, 0xab, 0xaa,
+ 0x88, 0x11, 0x01, 0x80, 0xaa, 0xcc, 0x9a, 0x28, 0x64, 0x44, 0x34, 0x33, 0x22, 0x00, 0xb9, 0xbc,
+ 0xbb, 0x9b, 0x10, 0x42, 0x24, 0x01, 0xca, 0xce, 0xbc, 0xbb, 0x9b, 0x28, 0x63, 0x34, 0x33, 0x13,
+ 0x90, 0xbc, 0xbd, 0xbb, 0x89, 0x32, 0x36, 0x25, 0x22, 0x90, 0xcb, 0xbd, 0xac, 0x9b, 0x09, 0x31,
+ 0x44, 0x43, 0x22, 0x11, 0x00, 0x10, 0x42, 0x44, 0x34, 0x24, 0x11, 0xb8, 0xce, 0xcc, 0xbc, 0xab,
+ 0x93, 0xe9, 0x37, 0x00, 0x8a, 0x08, 0x21, 0x32, 0x24, 0x11, 0x00, 0x10, 0x42, 0x55, 0x34, 0x25,
+ 0x23, 0x01, 0xa9, 0xcc, 0xcb, 0xab, 0x89, 0x20, 0x43, 0x23, 0x01, 0xc9, 0xcc, 0xbc, 0xaa, 0x08,
+ 0x31, 0x34, 0x13, 0xa0, 0xce, 0xcc, 0xab, 0x9b, 0x10, 0x53, 0x35, 0x34, 0x33, 0x23, 0x11, 0x80,
+ 0x00, 0x10, 0x32, 0x33, 0x02, 0xea, 0xde, 0xdc, 0xcb, 0xcb, 0xaa, 0x9a, 0x19, 0x31, 0x44, 0x43,
+ 0x32, 0x21, 0x00, 0x88, 0x00, 0x31, 0x45, 0x43, 0x22, 0x80, 0xca, 0xcd, 0xcb, 0x9a, 0x89, 0x31,
+ 0x43, 0x33, 0x01, 0xd9, 0xcc, 0xac, 0xbb, 0x8a, 0x18, 0x42, 0x43, 0x23, 0x22, 0x11, 0x10, 0x31,
+ 0x43, 0x44, 0x33, 0x22, 0x81, 0xb9, 0xcd, 0xdb, 0xbb, 0xbc, 0xab, 0xab, 0x09, 0x21, 0x45, 0x34,
+ 0x32, 0x81, 0xca, 0xdc, 0xcb, 0xaa, 0x89, 0x31, 0x34, 0x34, 0x12, 0x00, 0x88, 0x18, 0x73, 0x44,
+ 0x43, 0x22, 0x01, 0xba, 0xcd, 0xcb, 0xaa, 0x9a, 0x89, 0x88, 0x88, 0xaa, 0x9a, 0x08, 0x54, 0x44,
+ 0x43, 0x11, 0x90, 0xcb, 0xbb, 0x8b, 0x40, 0x45, 0x43, 0x11, 0x98, 0xcc, 0xac, 0xaa, 0x20, 0x54,
+ 0x53, 0x22, 0x02, 0xa9, 0xcc, 0xbb, 0xbb, 0x89, 0x21, 0x32, 0x02, 0xb9, 0xbe, 0xbc, 0x09, 0x63,
+ 0x35, 0x25, 0x13, 0x01, 0xb9, 0xbc, 0xbc, 0xbb, 0xaa, 0xaa, 0xba, 0xcb, 0x9a, 0x40, 0x56, 0x35,
+ 0x44, 0x22, 0x12, 0x90, 0xa9, 0xba, 0xab, 0xa9, 0xb9, 0xdd, 0xcc, 0xcc, 0xab, 0x9a, 0x10, 0x53,
+ 0x34, 0x24, 0x12, 0x80, 0x98, 0x89, 0x11, 0x43, 0x34, 0x12, 0xa8, 0xcc, 0xbc, 0xaa, 0x89, 0x21,
+ 0x12, 0xa0, 0xec, 0xbc, 0xac, 0x9a, 0x18, 0x31, 0x33, 0x33, 0x33, 0x54, 0x44, 0x53, 0x33, 0x12,
+ 0x98, 0xcc, 0xcc, 0xba, 0xa9, 0x08, 0x10, 0x00, 0x88, 0x89, 0x28, 0x65, 0x44, 0x43, 0x12, 0x91,
+ 0x9f, 0x0b, 0x2e, 0x00, 0xcc, 0xbc, 0xab, 0xaa, 0x99, 0x88, 0x99, 0xa9, 0x18, 0x64, 0x55, 0x34,
+ 0x24, 0x23, 0x01, 0xa8, 0xba, 0xcb, 0xaa, 0xba, 0xdb, 0xbd, 0xbd, 0xbb, 0xaa, 0x20, 0x54, 0x34,
+ 0x24, 0x12, 0x01, 0x88, 0x88, 0x01, 0x12, 0x80, 0xeb, 0xcd, 0xbc, 0xab, 0x09, 0x31, 0x45, 0x32,
+ 0x22, 0x00, 0x89, 0x89, 0x10, 0x33, 0x23, 0xd9, 0xde, 0xcc, 0xbb, 0x9a, 0x19, 0x31, 0x35, 0x33,
+ 0x23, 0x22, 0x22, 0x43, 0x34, 0x24, 0x81, 0xc9, 0xdc, 0xcb, 0xac, 0xaa, 0x99, 0x89, 0x08, 0x00,
+ 0x31, 0x54, 0x34, 0x35, 0x33, 0x12, 0x81, 0xba, 0xbd, 0xcb, 0xba, 0xaa, 0xbb, 0xac, 0xab, 0x0a,
+ 0x42, 0x46, 0x34, 0x23, 0x22, 0x10, 0x08, 0x21, 0x32, 0x03, 0xfa, 0xce, 0xcc, 0xab, 0x99, 0x21,
+ 0x53, 0x23, 0x80, 0xda, 0xcb, 0x9a, 0x30, 0x55, 0x43, 0x12, 0x80, 0xca, 0xba, 0x89, 0x31, 0x35,
+ 0x23, 0xb8, 0xcf, 0xcb, 0xaa, 0x08, 0x42, 0x43, 0x12, 0x80, 0xa9, 0x8a, 0x41, 0x45, 0x23, 0x02,
+ 0xda, 0xcd, 0xcb, 0xaa, 0x08, 0x20, 0x23, 0x23, 0x11, 0x21, 0x63, 0x44, 0x43, 0x23, 0x81, 0xca,
+ 0xcc, 0xac, 0xab, 0xaa, 0xa9, 0x98, 0x89, 0x18, 0x44, 0x45, 0x34, 0x33, 0x12, 0x80, 0xca, 0xca,
+ 0xaa, 0xaa, 0xaa, 0xdb, 0xbb, 0xab, 0x28, 0x46, 0x45, 0x33, 0x22, 0x01, 0xb9, 0xcb, 0xbb, 0xba,
+ 0xbb, 0xcc, 0xcc, 0xaa, 0x8a, 0x32, 0x37, 0x35, 0x33, 0x12, 0x81, 0x98, 0x9a, 0x9a, 0xbb, 0xdd,
+ 0xdb, 0xcb, 0xaa, 0x09, 0x21, 0x44, 0x33, 0x23, 0x12, 0x11, 0x00, 0x00, 0x99, 0xdb, 0xbc, 0xbc,
+ 0x99, 0x20, 0x44, 0x43, 0x12, 0x80, 0xa9, 0xba, 0xba, 0xba, 0xcd, 0xbd, 0xbd, 0xbb, 0x09, 0x52,
+ 0x54, 0x43, 0x32, 0x12, 0x01, 0x98, 0xbb, 0xcd, 0xbd, 0xdb, 0xaa, 0x89, 0x30, 0x55, 0x43, 0x33,
+ 0x97, 0x0d, 0x33, 0x00, 0x12, 0x81, 0x90, 0x98, 0xbb, 0xce, 0xbd, 0xcd, 0xba, 0xab, 0x88, 0x31,
+ 0x44, 0x43, 0x33, 0x43, 0x24, 0x33, 0x23, 0x91, 0xeb, 0xbd, 0xad, 0xab, 0x99, 0x00, 0x11, 0x11,
+ 0x01, 0x20, 0x63, 0x44, 0x34, 0x22, 0x80, 0xdb, 0xbc, 0xbc, 0x9a, 0x89, 0x88, 0x80, 0x00, 0x41,
+ 0x64, 0x34, 0x24, 0x13, 0x90, 0xba, 0xbd, 0xab, 0xaa, 0x99, 0xaa, 0xbc, 0xab, 0x09, 0x55, 0x54,
+ 0x33, 0x22, 0x01, 0x98, 0xa9, 0xaa, 0xb9, 0xcc, 0xbd, 0xbd, 0xaa, 0x89, 0x32, 0x36, 0x34, 0x22,
+ 0x01, 0x88, 0x99, 0xa8, 0xa9, 0xbb, 0xad, 0x9b, 0x08, 0x44, 0x34, 0x33, 0x23, 0x21, 0x22, 0x34,
+ 0x02, 0xfa, 0xcf, 0xcc, 0xbb, 0x9b, 0x0a, 0x20, 0x43, 0x33, 0x34, 0x34, 0x34, 0x34, 0x22, 0x81,
+ 0xba, 0xcd, 0xaa, 0x8a, 0x00, 0x11, 0x90, 0xda, 0xbc, 0xab, 0x89, 0x10, 0x01, 0xb9, 0xce, 0xbc,
+ 0xab, 0x09, 0x41, 0x45, 0x35, 0x44, 0x33, 0x33, 0x13, 0x90, 0xcc, 0xbc, 0xbc, 0xba, 0xaa, 0x99,
+ 0x9a, 0x89, 0x18, 0x54, 0x44, 0x43, 0x22, 0x01, 0x99, 0xcb, 0xbb, 0xcb, 0xca, 0xbb, 0xbb, 0x8a,
+ 0x63, 0x46, 0x53, 0x32, 0x11, 0x80, 0xba, 0xcb, 0xbb, 0xba, 0xcb, 0xbc, 0xbb, 0x8a, 0x52, 0x45,
+ 0x34, 0x33, 0x22, 0x11, 0x01, 0x88, 0xb9, 0xed, 0xbc, 0xbd, 0xab, 0x99, 0x20, 0x42, 0x32, 0x22,
+ 0x11, 0x11, 0x32, 0x12, 0xb8, 0xde, 0xac, 0x9b, 0x30, 0x54, 0x34, 0x33, 0x22, 0x33, 0x34, 0x34,
+ 0x01, 0xfb, 0xcd, 0xbc, 0xac, 0x9a, 0x09, 0x08, 0x01, 0x12, 0x53, 0x53, 0x34, 0x32, 0x02, 0x88,
+ 0xbb, 0xcb, 0x9a, 0x9a, 0xa9, 0xba, 0x9a, 0x41, 0x57, 0x43, 0x23, 0x02, 0xa9, 0xbc, 0xbd, 0xbb,
+ 0xbc, 0xbc, 0xbb, 0x8a, 0x20, 0x54, 0x43, 0x23, 0x12, 0x10, 0x20, 0x32, 0x24, 0x03, 0xa0, 0xbb,
+ 0xdd, 0x05, 0x25, 0x00, 0x38, 0x57, 0x43, 0x23, 0x81, 0xc9, 0xcb, 0xbc, 0xcc, 0xcb, 0xbc, 0xcb,
+ 0x9a, 0x00, 0x43, 0x34, 0x43, 0x12, 0x11, 0x00, 0x80, 0x98, 0xca, 0xdb, 0xba, 0x09, 0x52, 0x54,
+ 0x33, 0x24, 0x22, 0x22, 0x21, 0x00, 0xda, 0xce, 0xcc, 0xcb, 0xaa, 0x9a, 0x00, 0x22, 0x43, 0x33,
+ 0x34, 0x33, 0x22, 0x01, 0xba, 0xcd, 0xbc, 0xaa, 0x09, 0x10, 0x53, 0x43, 0x43, 0x43, 0x32, 0x02,
+ 0xa0, 0xfb, 0xbc, 0xbd, 0xcb, 0xaa, 0x8a, 0x18, 0x43, 0x45, 0x43, 0x23, 0x23, 0x02, 0x98, 0xcb,
+ 0xcc, 0xcb, 0xbb, 0xba, 0x8a, 0x18, 0x53, 0x44, 0x43, 0x23, 0x22, 0x81, 0xa8, 0xcc, 0xcc, 0xbb,
+ 0xbc, 0xab, 0x89, 0x30, 0x45, 0x44, 0x33, 0x33, 0x23, 0x81, 0xb8, 0xbd, 0xbd, 0xbc, 0xbb, 0xbb,
+ 0x99, 0x10, 0x34, 0x45, 0x43, 0x23, 0x23, 0x11, 0x98, 0xcb, 0xbc, 0xbc, 0xac, 0x9a, 0x08, 0x11,
+ 0x43, 0x43, 0x23, 0x13, 0x01, 0xa9, 0xcd, 0xbc, 0xbc, 0xaa, 0x88, 0x31, 0x45, 0x33, 0x34, 0x32,
+ 0x12, 0x81, 0xba, 0xcd, 0xbc, 0xbb, 0xab, 0x08, 0x41, 0x44, 0x43, 0x33, 0x22, 0x80, 0xdb, 0xbd,
+ 0xbd, 0xbb, 0x9a, 0x19, 0x31, 0x45, 0x34, 0x34, 0x24, 0x12, 0x80, 0xca, 0xcc, 0xac, 0xac, 0x9a,
+ 0x89, 0x18, 0x32, 0x45, 0x43, 0x43, 0x22, 0x01, 0xa9, 0xdc, 0xcb, 0xbb, 0xaa, 0x99, 0x21, 0x63,
+ 0x34, 0x44, 0x22, 0x22, 0x80, 0xa9, 0xcc, 0xbc, 0xbc, 0xcb, 0xaa, 0x88, 0x21, 0x54, 0x43, 0x33,
+ 0x23, 0x23, 0x00, 0xc9, 0xcc, 0xcc, 0xbb, 0xac, 0x99, 0x00, 0x32, 0x44, 0x34, 0x43, 0x22, 0x02,
+ 0x98, 0xba, 0xcc, 0xcb, 0xba, 0xaa, 0x8a, 0x10, 0x34, 0x45, 0x32, 0x33, 0x12, 0x81, 0xca, 0xbe,
+ 0xbd, 0xac, 0x9b, 0x09, 0x20, 0x43, 0x34, 0x35, 0x43, 0x22, 0x01, 0xaa, 0xbc, 0xbc, 0xbb, 0xbb,
+ 0x05, 0xf6, 0x2e, 0x00, 0xab, 0x09, 0x62, 0x53, 0x23, 0x13, 0x22, 0x22, 0x22, 0xa1, 0xdd, 0xcc,
+ 0xab, 0x8a, 0x88, 0x00, 0x11, 0x41, 0x44, 0x24, 0x12, 0x90, 0xaa, 0xaa, 0x9a, 0xa9, 0xdb, 0xcb,
+ 0x9b, 0x99, 0x98, 0xba, 0x9a, 0x62, 0x56, 0x53, 0x43, 0x32, 0x23, 0x02, 0xb8, 0xcd, 0xad, 0xbb,
+ 0xab, 0xbb, 0xac, 0x8a, 0x20, 0x45, 0x43, 0x23, 0x33, 0x34, 0x23, 0x91, 0xec, 0xbc, 0xbb, 0x89,
+ 0x18, 0x11, 0x32, 0x55, 0x44, 0x23, 0x82, 0xba, 0xbe, 0xbb, 0xba, 0xcb, 0xac, 0x9a, 0x41, 0x45,
+ 0x43, 0x11, 0x01, 0x10, 0x32, 0x12, 0xd9, 0xbe, 0xbc, 0x8a, 0x08, 0x80, 0x88, 0x00, 0x54, 0x44,
+ 0x13, 0x90, 0xbb, 0xad, 0x99, 0x80, 0x99, 0xaa, 0x29, 0x65, 0x34, 0x23, 0x81, 0x99, 0x88, 0x81,
+ 0xb8, 0xcf, 0xbc, 0x9b, 0x08, 0x00, 0x80, 0x8a, 0x40, 0x46, 0x24, 0x02, 0x98, 0xa9, 0x88, 0x88,
+ 0xa9, 0xbc, 0x0a, 0x64, 0x34, 0x13, 0x90, 0xa9, 0x88, 0x90, 0xea, 0xcc, 0xac, 0x99, 0x88, 0xb9,
+ 0xcc, 0x9a, 0x30, 0x55, 0x23, 0x23, 0x43, 0x34, 0x35, 0x02, 0xa8, 0xbd, 0xcb, 0x9a, 0xaa, 0xdb,
+ 0xcb, 0x89, 0x32, 0x36, 0x22, 0x81, 0x01, 0x53, 0x33, 0xa0, 0xee, 0xcb, 0x9a, 0x18, 0x10, 0x00,
+ 0x28, 0x64, 0x44, 0x23, 0x81, 0xba, 0xac, 0x99, 0xa9, 0xeb, 0xbc, 0x9b, 0x21, 0x45, 0x22, 0x01,
+ 0x00, 0x21, 0x33, 0x90, 0xed, 0xcb, 0x8a, 0x28, 0x22, 0x02, 0x00, 0x41, 0x45, 0x24, 0x01, 0xda,
+ 0xbc, 0xbb, 0x9a, 0x89, 0xa9, 0x99, 0x38, 0x57, 0x34, 0x23, 0x90, 0xa9, 0x89, 0x20, 0x02, 0xea,
+ 0xcc, 0x89, 0x31, 0x35, 0x02, 0xba, 0xbc, 0x8a, 0x01, 0xc8, 0xdd, 0xbb, 0x08, 0x44, 0x33, 0x12,
+ 0x01, 0x32, 0x36, 0x14, 0xb8, 0xcc, 0xbb, 0x99, 0x00, 0x98, 0x9a, 0x20, 0x46, 0x24, 0x81, 0xba,
+ 0x41, 0x00, 0x2f, 0x00, 0xab, 0x89, 0xb9, 0xce, 0xac, 0x18, 0x45, 0x33, 0x13, 0x11, 0x42, 0x35,
+ 0x13, 0xc9, 0xcd, 0xab, 0x09, 0x88, 0xda, 0xcb, 0x8b, 0x31, 0x36, 0x12, 0x90, 0x08, 0x42, 0x35,
+ 0x12, 0xb9, 0xbc, 0x89, 0x22, 0x82, 0xec, 0xcc, 0x99, 0x20, 0x33, 0x12, 0xa8, 0x89, 0x51, 0x34,
+ 0x83, 0xea, 0xbc, 0x9a, 0x20, 0x22, 0x91, 0xcb, 0x29, 0x56, 0x34, 0x02, 0xb9, 0xac, 0x88, 0x11,
+ 0xb0, 0xcf, 0xbb, 0x19, 0x43, 0x23, 0x80, 0x18, 0x63, 0x35, 0x01, 0xc9, 0xbc, 0x8a, 0x00, 0x90,
+ 0xcb, 0x9c, 0x38, 0x45, 0x12, 0x90, 0x89, 0x40, 0x53, 0x01, 0xb9, 0xad, 0x89, 0x01, 0xa8, 0xcd,
+ 0x9c, 0x18, 0x43, 0x23, 0x80, 0x10, 0x63, 0x33, 0x92, 0xcc, 0xbc, 0x8a, 0x80, 0x90, 0xcb, 0x89,
+ 0x73, 0x43, 0x12, 0x88, 0x89, 0x10, 0x02, 0xe9, 0xbd, 0xac, 0x09, 0x11, 0x10, 0x08, 0x31, 0x47,
+ 0x43, 0x11, 0xa9, 0xba, 0x9a, 0x88, 0xa9, 0xbe, 0x9c, 0x28, 0x45, 0x23, 0x98, 0xcb, 0x89, 0x32,
+ 0x03, 0xfa, 0xbc, 0x18, 0x44, 0x14, 0xa0, 0xac, 0x0a, 0x43, 0x14, 0xa8, 0xbb, 0x19, 0x46, 0x12,
+ 0xca, 0xbd, 0x8a, 0x20, 0x81, 0xba, 0xac, 0x41, 0x37, 0x23, 0x01, 0x08, 0x20, 0x12, 0xb8, 0xdf,
+ 0xbb, 0x9a, 0x98, 0x99, 0x8a, 0x30, 0x46, 0x33, 0x23, 0x22, 0x33, 0x12, 0xea, 0xbd, 0xab, 0x88,
+ 0x00, 0xa9, 0x8b, 0x41, 0x36, 0x03, 0xda, 0xcb, 0x09, 0x21, 0x12, 0xa9, 0x8a, 0x72, 0x34, 0x13,
+ 0xb9, 0xbd, 0x8a, 0x20, 0x22, 0x98, 0x9a, 0x62, 0x45, 0x23, 0xb8, 0xbf, 0xbc, 0x89, 0x80, 0x90,
+ 0xab, 0x28, 0x57, 0x34, 0x02, 0x90, 0x89, 0x21, 0x02, 0xfa, 0xbd, 0xab, 0x18, 0x23, 0x02, 0x89,
+ 0x30, 0x47, 0x12, 0xa8, 0xbd, 0x9b, 0x89, 0x80, 0xaa, 0x09, 0x64, 0x35, 0x33, 0x12, 0x00, 0x90,
+ 0xe3, 0x0b, 0x2c, 0x00, 0xdd, 0xbc, 0xaa, 0x09, 0x10, 0x00, 0x10, 0x54, 0x43, 0x01, 0xaa, 0xab,
+ 0x20, 0x14, 0xb8, 0xaf, 0x09, 0x63, 0x23, 0x81, 0xaa, 0x09, 0x22, 0xb0, 0xdf, 0x9b, 0x19, 0x12,
+ 0x90, 0xca, 0x89, 0x42, 0x33, 0x01, 0x41, 0x54, 0x23, 0xa0, 0xba, 0x09, 0x24, 0x91, 0xcf, 0xbb,
+ 0x8a, 0x88, 0xca, 0xac, 0x39, 0x57, 0x33, 0x02, 0xa8, 0x9a, 0x08, 0x90, 0xfb, 0xcc, 0xaa, 0x20,
+ 0x44, 0x22, 0x10, 0x30, 0x54, 0x13, 0xc8, 0xbe, 0xac, 0x88, 0x01, 0x90, 0x89, 0x40, 0x54, 0x22,
+ 0x98, 0xa9, 0x08, 0x12, 0xb8, 0xdd, 0x8a, 0x30, 0x23, 0x01, 0x00, 0x52, 0x13, 0xea, 0xbd, 0x9b,
+ 0x10, 0x11, 0xa9, 0x09, 0x56, 0x24, 0x82, 0xb9, 0x89, 0x21, 0xb0, 0xcf, 0xac, 0x09, 0x33, 0x24,
+ 0x22, 0x32, 0x35, 0x82, 0xfa, 0xcb, 0xaa, 0x9a, 0xa9, 0x9a, 0x30, 0x46, 0x43, 0x21, 0x11, 0x22,
+ 0x13, 0xd9, 0xbe, 0xab, 0x09, 0x11, 0x98, 0xbb, 0x29, 0x46, 0x13, 0xb9, 0xad, 0x28, 0x45, 0x12,
+ 0xa8, 0xab, 0x28, 0x35, 0x02, 0xcc, 0xac, 0x0a, 0x01, 0xa0, 0xcc, 0x89, 0x73, 0x43, 0x12, 0x80,
+ 0x88, 0x00, 0xa9, 0xcd, 0xbc, 0xaa, 0x8a, 0x08, 0x41, 0x45, 0x34, 0x23, 0x12, 0x00, 0xb9, 0xdd,
+ 0xdb, 0xaa, 0x89, 0x08, 0x00, 0x20, 0x44, 0x43, 0x23, 0x12, 0x11, 0x80, 0xda, 0xbd, 0xac, 0x9a,
+ 0x9a, 0x9a, 0x20, 0x55, 0x33, 0x12, 0x01, 0x11, 0x22, 0xd9, 0xce, 0xab, 0x89, 0x11, 0x10, 0x11,
+ 0x45, 0x43, 0x01, 0xa9, 0xab, 0xaa, 0xb9, 0xbd, 0x9c, 0x10, 0x23, 0x80, 0x8a, 0x74, 0x36, 0x13,
+ 0x98, 0xab, 0x89, 0x88, 0xec, 0xbd, 0x9a, 0x31, 0x35, 0x12, 0x80, 0x20, 0x45, 0x02, 0xe9, 0xdb,
+ 0x8a, 0x08, 0x80, 0x98, 0x18, 0x54, 0x34, 0x02, 0x98, 0x99, 0x10, 0xa0, 0xdc, 0xac, 0x9a, 0x98,
+ 0x12, 0xf6, 0x2e, 0x00, 0x9a, 0x28, 0x55, 0x24, 0x33, 0x32, 0x23, 0xa0, 0xdc, 0xcb, 0xaa, 0xbb,
+ 0xbc, 0x8a, 0x31, 0x43, 0x22, 0x42, 0x45, 0x22, 0x91, 0x99, 0x10, 0x23, 0xc0, 0xcd, 0xab, 0xba,
+ 0xdc, 0xbc, 0x9a, 0x11, 0x34, 0x53, 0x34, 0x34, 0x12, 0x08, 0x88, 0x80, 0xd9, 0xdc, 0xba, 0x99,
+ 0x98, 0xbb, 0x9c, 0x30, 0x36, 0x24, 0x12, 0x32, 0x33, 0x12, 0xa0, 0xdc, 0xcc, 0xba, 0xab, 0xa9,
+ 0xa9, 0x09, 0x63, 0x44, 0x12, 0x88, 0x08, 0x33, 0x82, 0xdc, 0xab, 0x20, 0x13, 0xc9, 0x0a, 0x67,
+ 0x34, 0x11, 0x88, 0x00, 0x91, 0xfc, 0xbc, 0x9b, 0x09, 0x80, 0xa9, 0x20, 0x56, 0x22, 0x90, 0x89,
+ 0x20, 0x12, 0xc9, 0xcb, 0x08, 0x22, 0xa8, 0xcd, 0xaa, 0x88, 0x98, 0x18, 0x56, 0x44, 0x23, 0x33,
+ 0x43, 0x11, 0xd9, 0xbc, 0xbb, 0xaa, 0xbb, 0xad, 0x18, 0x43, 0x22, 0x88, 0x99, 0x98, 0xca, 0xae,
+ 0x0a, 0x41, 0x33, 0x43, 0x53, 0x33, 0x90, 0xcd, 0xab, 0x8a, 0x98, 0x9a, 0x58, 0x46, 0x14, 0x81,
+ 0x88, 0x18, 0x80, 0xda, 0x9b, 0x40, 0x35, 0x12, 0x98, 0x99, 0xa9, 0xdf, 0xcc, 0x9b, 0x09, 0x01,
+ 0x21, 0x42, 0x44, 0x23, 0x80, 0xa9, 0x9a, 0xa9, 0xba, 0x8b, 0x61, 0x34, 0x22, 0x80, 0x88, 0xb9,
+ 0xcd, 0xbb, 0x28, 0x44, 0x24, 0x43, 0x43, 0x03, 0xc9, 0xcc, 0x9b, 0x8a, 0xaa, 0x9b, 0x40, 0x45,
+ 0x02, 0xb9, 0xdb, 0xaa, 0xbc, 0xac, 0x8a, 0x43, 0x45, 0x33, 0x34, 0x23, 0x81, 0xda, 0xbb, 0xac,
+ 0xba, 0xba, 0x28, 0x55, 0x33, 0x02, 0x00, 0x10, 0x81, 0xda, 0xbb, 0x40, 0x44, 0x02, 0xa8, 0xba,
+ 0xda, 0xdd, 0xcc, 0x9a, 0x09, 0x21, 0x42, 0x33, 0x35, 0x22, 0x91, 0xc9, 0xbb, 0xbb, 0xab, 0x28,
+ 0x45, 0x44, 0x22, 0x12, 0x01, 0xa8, 0xcd, 0xbb, 0x9a, 0x88, 0x00, 0x11, 0x53, 0x22, 0xa8, 0xbe,
+ 0x5a, 0xfd, 0x2d, 0x00, 0x09, 0x10, 0x00, 0x42, 0x46, 0x23, 0xa1, 0xce, 0xbc, 0xba, 0xbb, 0xaa,
+ 0x28, 0x56, 0x34, 0x34, 0x23, 0x12, 0x88, 0xba, 0xcc, 0xbc, 0xcb, 0x9a, 0x08, 0x12, 0x12, 0x10,
+ 0x42, 0x33, 0x01, 0x88, 0x31, 0x46, 0x12, 0xa9, 0xbb, 0xdb, 0xdc, 0xbc, 0xab, 0x19, 0x42, 0x33,
+ 0x35, 0x34, 0x23, 0xb8, 0xcc, 0xcb, 0xba, 0xaa, 0x18, 0x55, 0x34, 0x12, 0x01, 0x01, 0xa0, 0xec,
+ 0xbc, 0xaa, 0x08, 0x10, 0x00, 0x10, 0x53, 0x24, 0x12, 0x08, 0x18, 0x42, 0x34, 0x23, 0x82, 0xeb,
+ 0xdd, 0xcb, 0xbb, 0xac, 0xaa, 0x20, 0x54, 0x34, 0x24, 0x12, 0x11, 0x98, 0xca, 0xac, 0xaa, 0x89,
+ 0x99, 0x08, 0x41, 0x22, 0xb8, 0xbe, 0x8b, 0x31, 0x43, 0x32, 0x64, 0x35, 0x24, 0x90, 0xca, 0xcb,
+ 0xbb, 0xbb, 0x9a, 0x30, 0x54, 0x33, 0x22, 0x81, 0xcb, 0xbe, 0xac, 0x0a, 0x20, 0x53, 0x43, 0x34,
+ 0x14, 0x81, 0xa9, 0xcb, 0xcb, 0xcb, 0xba, 0x08, 0x32, 0x14, 0x81, 0x08, 0x20, 0x02, 0x98, 0x40,
+ 0x77, 0x43, 0x22, 0x80, 0xca, 0xcc, 0xdb, 0xba, 0x9a, 0x09, 0x32, 0x54, 0x24, 0x23, 0x01, 0xa8,
+ 0xa9, 0xaa, 0xcb, 0xab, 0x09, 0x53, 0x33, 0x12, 0xb9, 0xbd, 0xcb, 0xaa, 0x89, 0x43, 0x46, 0x33,
+ 0x24, 0x81, 0xb9, 0xce, 0xbb, 0x9a, 0x08, 0x22, 0x34, 0x24, 0x13, 0x88, 0xdb, 0xcc, 0xab, 0x9a,
+ 0x31, 0x45, 0x34, 0x22, 0x12, 0x01, 0xb9, 0xdd, 0xac, 0x9a, 0x08, 0x22, 0x33, 0x33, 0x03, 0xb8,
+ 0xdd, 0xbc, 0x9a, 0x19, 0x52, 0x34, 0x34, 0x11, 0xb8, 0xdc, 0xbc, 0xba, 0x99, 0x10, 0x43, 0x44,
+ 0x24, 0x14, 0x01, 0xa8, 0xbb, 0x9b, 0x08, 0x00, 0x00, 0x31, 0x43, 0x92, 0xdf, 0xbd, 0xac, 0x09,
+ 0x20, 0x44, 0x33, 0x32, 0x12, 0x80, 0xd9, 0xcc, 0xac, 0x8a, 0x31, 0x33, 0x03, 0x80, 0xa9, 0xda,
+ 0xe8, 0xfa, 0x2d, 0x00, 0xbc, 0x9b, 0x41, 0x55, 0x34, 0x24, 0x12, 0x90, 0xca, 0xbc, 0xbb, 0xbb,
+ 0xba, 0x09, 0x42, 0x24, 0x01, 0xba, 0xac, 0x8a, 0x40, 0x46, 0x44, 0x23, 0x12, 0x01, 0xb8, 0xdd,
+ 0xbc, 0xaa, 0x09, 0x22, 0x33, 0x33, 0x13, 0x81, 0xb9, 0xce, 0xaa, 0x19, 0x53, 0x43, 0x33, 0x03,
+ 0xfb, 0xcd, 0xab, 0xab, 0x9a, 0x09, 0x51, 0x44, 0x33, 0x33, 0x11, 0x99, 0x9a, 0x20, 0x44, 0x24,
+ 0x22, 0x11, 0x90, 0xeb, 0xdd, 0xbc, 0xab, 0x29, 0x42, 0x22, 0x21, 0x21, 0x81, 0xdb, 0xcd, 0xba,
+ 0x99, 0x28, 0x44, 0x33, 0x01, 0x98, 0xba, 0xcc, 0xac, 0x9b, 0x10, 0x64, 0x44, 0x33, 0x13, 0x00,
+ 0x80, 0xaa, 0xab, 0x0a, 0x12, 0x90, 0xba, 0xdb, 0xee, 0xcc, 0xac, 0x9a, 0x10, 0x42, 0x43, 0x33,
+ 0x22, 0x01, 0xa8, 0xdd, 0xbb, 0xab, 0x89, 0x21, 0x34, 0x14, 0x01, 0x08, 0x32, 0x23, 0x11, 0x63,
+ 0x45, 0x33, 0x02, 0xc9, 0xdd, 0xcb, 0xaa, 0x89, 0x10, 0x42, 0x43, 0x33, 0x12, 0x90, 0xdd, 0xbd,
+ 0xaa, 0x08, 0x11, 0x12, 0x22, 0x23, 0x22, 0x01, 0x99, 0xaa, 0x71, 0x55, 0x33, 0x02, 0xc9, 0xbd,
+ 0xad, 0xab, 0x9a, 0x08, 0x63, 0x44, 0x24, 0x11, 0x88, 0xba, 0xdb, 0xcb, 0x8a, 0x08, 0x11, 0x33,
+ 0x33, 0x02, 0x98, 0xbb, 0xac, 0x0a, 0x65, 0x34, 0x13, 0x90, 0xdb, 0xcc, 0xac, 0x9a, 0x09, 0x32,
+ 0x37, 0x35, 0x22, 0x90, 0xba, 0xbc, 0xbc, 0xaa, 0x8a, 0x18, 0x52, 0x43, 0x12, 0x98, 0xaa, 0x8a,
+ 0x10, 0x44, 0x34, 0x11, 0x98, 0xb9, 0xdc, 0xdc, 0xba, 0x88, 0x42, 0x45, 0x33, 0x12, 0xa8, 0xba,
+ 0xac, 0xbc, 0xcb, 0x9a, 0x18, 0x53, 0x34, 0x01, 0xa8, 0x8b, 0x30, 0x34, 0x23, 0x01, 0xa0, 0xba,
+ 0xdc, 0xdd, 0xbc, 0x9b, 0x20, 0x35, 0x34, 0x33, 0x01, 0xa8, 0xaa, 0xab, 0xbc, 0x9b, 0x28, 0x42,
+ 0x16, 0x01, 0x29, 0x00, 0x43, 0x91, 0xec, 0xbb, 0x18, 0x53, 0x34, 0x22, 0x98, 0xcc, 0xaa, 0xdb,
+ 0xbc, 0xab, 0x30, 0x46, 0x34, 0x13, 0x91, 0xba, 0xaa, 0xa9, 0xcb, 0x8a, 0x42, 0x34, 0x24, 0x90,
+ 0xec, 0xac, 0x8a, 0x11, 0x42, 0x43, 0x33, 0x13, 0x81, 0xb9, 0xdf, 0xab, 0x0a, 0x31, 0x43, 0x32,
+ 0x81, 0xda, 0xbb, 0xbc, 0xeb, 0xaa, 0x30, 0x45, 0x43, 0x22, 0x80, 0xca, 0xaa, 0x89, 0xa9, 0x9a,
+ 0x51, 0x44, 0x32, 0x02, 0xd9, 0xbc, 0x9a, 0x11, 0x33, 0x43, 0x23, 0x12, 0x98, 0xea, 0xdd, 0xac,
+ 0x9a, 0x20, 0x43, 0x43, 0x02, 0x90, 0x99, 0xaa, 0xca, 0xdb, 0x9a, 0x00, 0x42, 0x35, 0x11, 0x98,
+ 0xab, 0x20, 0x24, 0x34, 0x02, 0x10, 0x22, 0x54, 0x82, 0xce, 0xbb, 0xab, 0x00, 0x22, 0x53, 0x80,
+ 0x19, 0x12, 0xb8, 0xef, 0xcc, 0xa9, 0x8a, 0x31, 0x24, 0x32, 0x22, 0x34, 0x03, 0x99, 0xc9, 0xbc,
+ 0x89, 0x52, 0x14, 0xa0, 0x99, 0x98, 0x18, 0x34, 0x35, 0x12, 0x73, 0x25, 0x91, 0xea, 0xdb, 0xbb,
+ 0xbb, 0x08, 0x00, 0x08, 0x53, 0x44, 0x12, 0x11, 0x98, 0xcb, 0x8a, 0x11, 0x91, 0xbc, 0x89, 0x00,
+ 0x62, 0x35, 0x24, 0x11, 0x63, 0x33, 0x12, 0x80, 0xeb, 0xdc, 0xab, 0xaa, 0xb9, 0x9b, 0x08, 0x41,
+ 0x44, 0x43, 0x02, 0xa8, 0xaa, 0xbb, 0xaa, 0xab, 0x89, 0xaa, 0x71, 0x27, 0x21, 0x12, 0x21, 0x34,
+ 0x34, 0x35, 0x91, 0xaa, 0xcc, 0xbb, 0xcb, 0xaa, 0x88, 0x28, 0x46, 0x23, 0x13, 0xa8, 0xbc, 0xcc,
+ 0xab, 0xbb, 0xbc, 0xab, 0x18, 0x63, 0x43, 0x43, 0x23, 0x53, 0x23, 0x12, 0x90, 0xcb, 0xcb, 0xaa,
+ 0x88, 0xb9, 0x9c, 0x19, 0x42, 0x35, 0x35, 0x13, 0x88, 0x80, 0xe9, 0xce, 0xbc, 0xbc, 0xbb, 0x09,
+ 0x31, 0x33, 0x34, 0x35, 0x12, 0x11, 0x01, 0xa8, 0xac, 0x08, 0x12, 0xa0, 0xbc, 0xdc, 0xbb, 0x29,
+ 0x21, 0xf6, 0x2a, 0x00, 0x47, 0x23, 0x43, 0x14, 0x81, 0xaa, 0xcc, 0xbd, 0x9c, 0x09, 0x00, 0x00,
+ 0x11, 0x01, 0x00, 0x22, 0x01, 0xca, 0x19, 0x44, 0x01, 0x88, 0x98, 0xba, 0x58, 0x57, 0x12, 0x01,
+ 0x31, 0x43, 0x22, 0x34, 0x81, 0xca, 0x0a, 0x01, 0xba, 0x9c, 0x88, 0x51, 0x47, 0x34, 0x91, 0xb9,
+ 0xcb, 0xbb, 0x8a, 0x98, 0xaa, 0x28, 0x45, 0x24, 0x03, 0xc8, 0xbd, 0x9b, 0x88, 0x99, 0xb9, 0xcd,
+ 0xaa, 0x10, 0x82, 0xda, 0xbb, 0x9c, 0x18, 0x45, 0x23, 0x90, 0xdb, 0xcc, 0xbc, 0xbc, 0xac, 0x89,
+ 0x20, 0x54, 0x33, 0x12, 0x98, 0x99, 0x98, 0x8a, 0x10, 0x90, 0xbd, 0x9b, 0xeb, 0xcd, 0x9a, 0x10,
+ 0x53, 0x34, 0x24, 0x00, 0x89, 0x21, 0x34, 0x22, 0x21, 0x80, 0xdb, 0xab, 0xcc, 0xbc, 0x29, 0x57,
+ 0x43, 0x32, 0x02, 0x98, 0x89, 0x31, 0x34, 0x42, 0x33, 0x81, 0xba, 0xcc, 0xbe, 0xad, 0x09, 0x32,
+ 0x44, 0x22, 0x81, 0xb9, 0xaa, 0x89, 0x88, 0x90, 0xba, 0xbd, 0xcd, 0xbb, 0xac, 0x9b, 0x28, 0x55,
+ 0x23, 0x81, 0xa8, 0xbc, 0x9c, 0x10, 0x22, 0x10, 0x00, 0xda, 0xbd, 0xbb, 0xcb, 0x9a, 0x21, 0x14,
+ 0x90, 0xca, 0xce, 0xbc, 0x9a, 0x08, 0x11, 0x32, 0x13, 0x90, 0xca, 0xce, 0xcd, 0xcb, 0xab, 0x99,
+ 0x09, 0x21, 0x32, 0x34, 0x53, 0x33, 0x12, 0x11, 0x33, 0x24, 0x23, 0xe8, 0xcf, 0xbb, 0x9a, 0x28,
+ 0x54, 0x43, 0x43, 0x22, 0x22, 0x00, 0x88, 0x88, 0x11, 0x32, 0x14, 0xb8, 0xcd, 0x09, 0x54, 0x45,
+ 0x34, 0x23, 0x01, 0x88, 0xba, 0xbc, 0xaa, 0x89, 0x21, 0x43, 0x12, 0x98, 0xa9, 0x50, 0x57, 0x43,
+ 0x23, 0x01, 0xda, 0xcc, 0xab, 0xbb, 0x9a, 0x18, 0x11, 0x32, 0x12, 0xb8, 0xbb, 0x18, 0x32, 0x54,
+ 0xa1, 0xef, 0xbc, 0xbc, 0xba, 0x8a, 0x08, 0x20, 0x22, 0x12, 0x90, 0xdb, 0xbc, 0x9b, 0x89, 0xb9,
+ 0x2c, 0xe9, 0x26, 0x00, 0xdf, 0xcc, 0xab, 0x9a, 0x00, 0x42, 0x34, 0x33, 0x23, 0x12, 0xa8, 0xaa,
+ 0x09, 0x42, 0x43, 0x91, 0xdd, 0xcc, 0x99, 0x20, 0x63, 0x34, 0x43, 0x22, 0x22, 0x00, 0x99, 0x88,
+ 0x31, 0x54, 0x23, 0x81, 0xba, 0xac, 0x28, 0x56, 0x34, 0x34, 0x22, 0x00, 0x99, 0xba, 0xac, 0x09,
+ 0x42, 0x34, 0x23, 0x82, 0xb9, 0x8b, 0x73, 0x36, 0x25, 0x12, 0x98, 0xdb, 0xbc, 0xbc, 0x9a, 0x89,
+ 0x21, 0x23, 0x12, 0xa8, 0xbd, 0x9c, 0x08, 0x32, 0x33, 0xd9, 0xdf, 0xdb, 0xba, 0xaa, 0x8a, 0x10,
+ 0x32, 0x32, 0x81, 0xdb, 0xcd, 0xaa, 0x89, 0x08, 0x98, 0xdb, 0xcd, 0xbb, 0x99, 0x00, 0x43, 0x35,
+ 0x33, 0x23, 0x80, 0xdb, 0xbb, 0x89, 0x32, 0x24, 0x82, 0xdb, 0xbc, 0x8a, 0x52, 0x54, 0x43, 0x33,
+ 0x23, 0x11, 0xa8, 0xaa, 0x18, 0x73, 0x44, 0x22, 0x01, 0x99, 0x9a, 0x89, 0x43, 0x25, 0x22, 0x33,
+ 0x02, 0x89, 0x11, 0x00, 0x73, 0x47, 0x32, 0x21, 0x01, 0xb9, 0x9b, 0x88, 0x80, 0x20, 0xa1, 0xbe,
+ 0x9a, 0xa8, 0x8b, 0x42, 0x12, 0x73, 0x24, 0xc8, 0xbe, 0xcc, 0xbc, 0x89, 0x08, 0x88, 0x88, 0xc8,
+ 0xcb, 0xaa, 0xdb, 0xcb, 0x99, 0x98, 0x89, 0xda, 0xcf, 0xbb, 0xab, 0x08, 0x43, 0x33, 0x22, 0x00,
+ 0xa8, 0xba, 0xbd, 0x9c, 0x09, 0x22, 0x92, 0xfd, 0xbd, 0xab, 0x29, 0x54, 0x34, 0x13, 0x01, 0x88,
+ 0xaa, 0x99, 0x89, 0x10, 0x53, 0x03, 0xd9, 0xcd, 0xbb, 0x29, 0x56, 0x34, 0x33, 0x02, 0xa9, 0xbb,
+ 0xab, 0x89, 0x20, 0x22, 0x02, 0xc8, 0xcd, 0xac, 0x30, 0x57, 0x44, 0x23, 0x12, 0x88, 0xba, 0xab,
+ 0x09, 0x20, 0x11, 0x80, 0xba, 0xbe, 0xab, 0x20, 0x47, 0x45, 0x23, 0x82, 0xb9, 0xbe, 0xbc, 0xaa,
+ 0x88, 0x80, 0x99, 0xda, 0xbb, 0x9b, 0x08, 0x42, 0x46, 0x23, 0x02, 0xb8, 0xdd, 0xbb, 0x99, 0x10,
+ 0xdd, 0xf2, 0x34, 0x00, 0x34, 0x02, 0x98, 0x98, 0x00, 0x31, 0x37, 0x23, 0x02, 0xa0, 0xef, 0xcb,
+ 0xab, 0x9a, 0x20, 0x33, 0x02, 0x98, 0xca, 0xac, 0x18, 0x12, 0x01, 0x21, 0xd8, 0xbe, 0xcb, 0xbb,
+ 0x3a, 0x57, 0x43, 0x23, 0x13, 0x88, 0x89, 0x10, 0x11, 0x32, 0x82, 0xca, 0xcb, 0xbc, 0xac, 0x18,
+ 0x44, 0x45, 0x32, 0x81, 0xb9, 0xbc, 0xbb, 0x99, 0x88, 0x98, 0xcb, 0xbc, 0xab, 0x09, 0x64, 0x44,
+ 0x43, 0x33, 0x11, 0x98, 0xba, 0xab, 0x19, 0x44, 0x13, 0x81, 0xea, 0xbb, 0x0a, 0x52, 0x44, 0x23,
+ 0x12, 0x90, 0xcb, 0xbc, 0xbb, 0x0a, 0x32, 0x35, 0x82, 0xda, 0xac, 0x19, 0x73, 0x33, 0x02, 0xa8,
+ 0xbc, 0xab, 0x20, 0x21, 0x32, 0x04, 0xb9, 0xdf, 0xcc, 0xbb, 0x09, 0x43, 0x24, 0x81, 0xdb, 0xbc,
+ 0x8b, 0x08, 0x21, 0x82, 0xca, 0xbc, 0xbd, 0xac, 0x99, 0x10, 0x34, 0x22, 0x90, 0xeb, 0xab, 0x38,
+ 0x35, 0x25, 0x82, 0xdb, 0xcd, 0xbb, 0x9b, 0x18, 0x32, 0x44, 0x12, 0x00, 0x99, 0x9a, 0x08, 0x20,
+ 0x43, 0x23, 0xa1, 0xfc, 0xcb, 0x9b, 0x38, 0x46, 0x34, 0x33, 0x23, 0x31, 0x33, 0x24, 0x21, 0x01,
+ 0x80, 0x81, 0xec, 0xac, 0x9a, 0x40, 0x57, 0x23, 0x23, 0x82, 0xa9, 0x99, 0xaa, 0x0a, 0x00, 0x28,
+ 0x23, 0xf9, 0xbd, 0xab, 0x2a, 0x57, 0x23, 0x23, 0x91, 0xca, 0xa9, 0xb9, 0xab, 0xa8, 0xbd, 0x9b,
+ 0xcb, 0xac, 0x18, 0x52, 0x45, 0x22, 0xa0, 0xea, 0xbc, 0xab, 0xaa, 0x89, 0x98, 0xda, 0xab, 0xbb,
+ 0x8a, 0x53, 0x33, 0x42, 0x02, 0xdb, 0xbb, 0xcd, 0xbb, 0x9a, 0xbb, 0x9a, 0xca, 0xac, 0x18, 0x51,
+ 0x46, 0x23, 0x02, 0xa8, 0xdb, 0x99, 0x98, 0x89, 0x90, 0x9b, 0x40, 0x44, 0x53, 0x34, 0x33, 0x45,
+ 0x22, 0x12, 0x80, 0x09, 0x20, 0x21, 0x01, 0xba, 0x9c, 0x72, 0x46, 0x34, 0x33, 0x21, 0x11, 0x00,
+ 0x34, 0x27, 0x2f, 0x00, 0x00, 0x98, 0x08, 0xca, 0xba, 0xfb, 0x9b, 0x42, 0x45, 0x35, 0x23, 0x00,
+ 0xa8, 0xba, 0x8a, 0x90, 0x99, 0xb9, 0xdf, 0xaa, 0xba, 0x89, 0x32, 0x34, 0x45, 0x01, 0xba, 0xfb,
+ 0xdb, 0xba, 0xba, 0xbb, 0xbb, 0xbd, 0xac, 0x99, 0x09, 0x21, 0x12, 0x80, 0xca, 0xbe, 0xcc, 0xbc,
+ 0xbc, 0xaa, 0x8a, 0x08, 0x80, 0x88, 0x10, 0x52, 0x46, 0x23, 0x11, 0x90, 0xbb, 0xbb, 0xbc, 0xac,
+ 0xaa, 0x29, 0x45, 0x34, 0x25, 0x22, 0x34, 0x33, 0x33, 0xa1, 0xbc, 0xb9, 0xac, 0x21, 0xb8, 0x38,
+ 0x25, 0x75, 0x35, 0x32, 0x33, 0x02, 0x21, 0x01, 0x09, 0x21, 0x88, 0x52, 0x82, 0x20, 0x36, 0x65,
+ 0x54, 0x32, 0x23, 0x01, 0x98, 0x9a, 0x8a, 0x00, 0x10, 0x80, 0xcb, 0xab, 0xac, 0x60, 0x34, 0x53,
+ 0x13, 0xb9, 0xcc, 0xcd, 0xaa, 0xba, 0x9a, 0xa9, 0xcc, 0x9a, 0xcb, 0x19, 0x11, 0x21, 0x83, 0xec,
+ 0xbb, 0xcd, 0xaa, 0xa9, 0xac, 0x99, 0xba, 0x09, 0x80, 0x08, 0x02, 0x99, 0x01, 0xfa, 0xbd, 0xcb,
+ 0xac, 0x9a, 0xca, 0xbb, 0xbc, 0x09, 0x51, 0x35, 0x13, 0x11, 0xa9, 0xaa, 0x00, 0x80, 0x53, 0x02,
+ 0x31, 0x25, 0x20, 0x65, 0x43, 0x54, 0x33, 0x22, 0x12, 0x80, 0x20, 0x33, 0x44, 0x44, 0x21, 0x22,
+ 0x13, 0x32, 0x34, 0x44, 0x35, 0x32, 0x22, 0xa0, 0xbb, 0xcc, 0x0a, 0x32, 0x44, 0x24, 0x90, 0xa9,
+ 0xdb, 0x9a, 0x11, 0x11, 0x02, 0xed, 0xbc, 0xdb, 0x9a, 0x00, 0x11, 0x23, 0xb8, 0xdb, 0xeb, 0x9a,
+ 0x11, 0x08, 0x82, 0xde, 0xab, 0xba, 0x0a, 0x22, 0x08, 0x82, 0xec, 0x09, 0xb0, 0x0a, 0xc8, 0xbf,
+ 0xaa, 0xbc, 0x0a, 0xa8, 0x18, 0xb1, 0xbd, 0xa9, 0xae, 0x38, 0x01, 0x31, 0xe0, 0xbe, 0xa9, 0x8b,
+ 0x62, 0x12, 0x22, 0x91, 0x8c, 0x22, 0x42, 0x46, 0x12, 0x10, 0xa1, 0x0a, 0x21, 0x52, 0x36, 0x13,
+ 0x37, 0x01, 0x34, 0x00, 0x12, 0x89, 0x32, 0x34, 0x54, 0x12, 0x98, 0x99, 0x9b, 0x72, 0x23, 0x42,
+ 0x82, 0xbb, 0x08, 0x99, 0x56, 0x03, 0x00, 0xc1, 0xbd, 0x08, 0x8a, 0x73, 0x02, 0x20, 0xa1, 0x9c,
+ 0x88, 0x8a, 0x45, 0x91, 0x10, 0xfa, 0x9c, 0x99, 0x1a, 0x32, 0x80, 0x01, 0xec, 0x9a, 0xb9, 0x8a,
+ 0x91, 0xac, 0xaa, 0xbf, 0xab, 0xcb, 0x9a, 0x80, 0x00, 0x81, 0xda, 0xba, 0xcb, 0x89, 0x80, 0x89,
+ 0xb9, 0xbd, 0x08, 0x10, 0x62, 0x33, 0x42, 0x35, 0x31, 0x34, 0x01, 0x32, 0x02, 0x43, 0x03, 0x40,
+ 0x35, 0x62, 0x44, 0x01, 0x21, 0x98, 0x30, 0x23, 0x53, 0x13, 0x89, 0x90, 0x8c, 0x54, 0x22, 0x55,
+ 0x11, 0x10, 0xa1, 0x8a, 0x02, 0x18, 0x37, 0x81, 0x11, 0xc8, 0x1a, 0x12, 0x72, 0x25, 0x81, 0x02,
+ 0xcb, 0x18, 0xa8, 0x39, 0xe1, 0x9d, 0xa9, 0xab, 0x33, 0xb8, 0x30, 0xfc, 0x8b, 0xb0, 0x1a, 0x83,
+ 0xad, 0xc8, 0xce, 0xaa, 0xab, 0x19, 0x81, 0x00, 0xc0, 0xae, 0x88, 0x18, 0x46, 0x02, 0x00, 0xda,
+ 0xbb, 0x9a, 0x8b, 0x34, 0x00, 0x21, 0xda, 0x2a, 0x14, 0x73, 0x15, 0x08, 0x91, 0xba, 0x88, 0xb9,
+ 0x18, 0xda, 0x1a, 0xa8, 0x48, 0x26, 0x41, 0x24, 0x89, 0x90, 0xac, 0x20, 0x01, 0x11, 0xfc, 0xbb,
+ 0x88, 0x51, 0x36, 0x21, 0x02, 0xb9, 0x98, 0x99, 0x52, 0x13, 0x32, 0xb2, 0xae, 0xaa, 0x29, 0x57,
+ 0x22, 0x12, 0xc9, 0xba, 0xaa, 0x28, 0x13, 0x20, 0xd8, 0x9c, 0xaa, 0x3a, 0x26, 0x31, 0x83, 0xcf,
+ 0xa9, 0xac, 0x38, 0xa1, 0x39, 0xf0, 0x0b, 0x83, 0x49, 0x17, 0x98, 0x11, 0xcb, 0x09, 0xc8, 0x3a,
+ 0x82, 0x1a, 0x94, 0x9e, 0x11, 0x08, 0x55, 0x81, 0x08, 0xd9, 0x9a, 0x90, 0x89, 0x12, 0xb9, 0x18,
+ 0xc8, 0x48, 0x03, 0x51, 0x13, 0x99, 0xb9, 0xae, 0x89, 0x08, 0x80, 0x00, 0x10, 0x72, 0x44, 0x32,
+ 0xae, 0x01, 0x2a, 0x00, 0x12, 0x80, 0x98, 0xad, 0x10, 0x89, 0x44, 0xb0, 0x28, 0xa1, 0x74, 0x27,
+ 0x21, 0x81, 0xba, 0x9a, 0x9a, 0x10, 0x90, 0xab, 0xdb, 0x0b, 0x12, 0x73, 0x33, 0x32, 0x82, 0xcb,
+ 0xdd, 0xab, 0x99, 0x0a, 0xb0, 0xbf, 0xba, 0x9a, 0x52, 0x33, 0x11, 0xe8, 0xbb, 0xaa, 0x19, 0x23,
+ 0xb9, 0xed, 0xbc, 0x9a, 0x08, 0x32, 0x11, 0xb8, 0xbc, 0x9a, 0x30, 0x47, 0x33, 0x23, 0xa0, 0xad,
+ 0xcb, 0x8a, 0x35, 0x22, 0x13, 0xdc, 0x8a, 0x21, 0x57, 0x33, 0x12, 0x80, 0xaa, 0x20, 0x21, 0x44,
+ 0x92, 0x9a, 0xb9, 0x0c, 0x35, 0x42, 0x36, 0x02, 0x12, 0xa0, 0x8a, 0x01, 0x29, 0x05, 0xbc, 0xcb,
+ 0xbe, 0x18, 0x11, 0x33, 0xa1, 0xcc, 0xca, 0x8b, 0x11, 0x80, 0xb9, 0xdf, 0xaa, 0xaa, 0x88, 0x98,
+ 0xa9, 0xeb, 0xab, 0xbb, 0xab, 0x98, 0x18, 0x22, 0xca, 0xcc, 0xbc, 0x19, 0x32, 0x42, 0xd8, 0xcd,
+ 0xba, 0x09, 0x43, 0x32, 0x22, 0x80, 0x20, 0x35, 0x35, 0x24, 0x21, 0x11, 0x10, 0x80, 0x9a, 0x21,
+ 0x72, 0x37, 0x12, 0x12, 0x98, 0x51, 0x34, 0x46, 0x02, 0x80, 0x90, 0x09, 0x35, 0x21, 0x33, 0xc9,
+ 0x0a, 0x90, 0x78, 0x23, 0x31, 0x26, 0x08, 0x12, 0xb9, 0x20, 0xa0, 0x41, 0xf8, 0xbd, 0xcb, 0x9c,
+ 0x00, 0x10, 0x11, 0xea, 0xaa, 0xba, 0x19, 0x02, 0xaa, 0xfc, 0xcc, 0xa9, 0x99, 0x08, 0x90, 0xa9,
+ 0xcb, 0x9b, 0x89, 0x20, 0x22, 0x90, 0xda, 0xcd, 0xaa, 0x0a, 0x52, 0x12, 0xa8, 0xed, 0x9b, 0x18,
+ 0x53, 0x25, 0x01, 0x08, 0x09, 0x73, 0x33, 0x43, 0x91, 0x99, 0x99, 0x09, 0x34, 0x42, 0x35, 0x11,
+ 0x23, 0x11, 0x45, 0x24, 0x43, 0x91, 0xbb, 0xcd, 0x9a, 0x20, 0x42, 0x23, 0x80, 0x88, 0x00, 0x65,
+ 0x23, 0x12, 0xd0, 0xbc, 0xbb, 0x9c, 0x01, 0x80, 0x01, 0xa9, 0x0a, 0x90, 0x89, 0xd8, 0xdf, 0xbb,
+ 0xcb, 0xfe, 0x28, 0x00, 0xae, 0xa9, 0x9a, 0x00, 0x99, 0x88, 0x9a, 0x30, 0x44, 0x43, 0x81, 0xcc,
+ 0xbc, 0x9b, 0x41, 0x54, 0x23, 0x22, 0x00, 0x10, 0x41, 0x34, 0x24, 0x81, 0xba, 0xce, 0x9a, 0x89,
+ 0x21, 0x33, 0x22, 0x81, 0xa9, 0xb9, 0xba, 0xbb, 0xbe, 0xab, 0x9a, 0x18, 0x44, 0x43, 0x35, 0x45,
+ 0x44, 0x43, 0x33, 0x11, 0xa8, 0xcb, 0xbb, 0x9b, 0x11, 0x10, 0x92, 0xbf, 0xcc, 0xbc, 0x99, 0x09,
+ 0x11, 0xa8, 0xdd, 0xcd, 0xba, 0x9b, 0x18, 0x32, 0x24, 0x01, 0x98, 0x19, 0x63, 0x45, 0x34, 0x23,
+ 0x13, 0x01, 0x11, 0x10, 0x10, 0x98, 0x10, 0x22, 0x55, 0xa1, 0xca, 0xde, 0x9a, 0x08, 0x31, 0x02,
+ 0xda, 0xce, 0xac, 0x99, 0x18, 0x12, 0x12, 0x98, 0x08, 0x89, 0x44, 0x02, 0x44, 0x11, 0x44, 0x81,
+ 0x00, 0xdb, 0x9a, 0x08, 0x54, 0x12, 0x81, 0xcd, 0xbb, 0xbb, 0x10, 0x90, 0x81, 0xbe, 0x99, 0xab,
+ 0x21, 0xdb, 0x99, 0xbc, 0x52, 0x32, 0x25, 0xba, 0xbb, 0x8d, 0x55, 0x44, 0x14, 0x81, 0x98, 0x9b,
+ 0x10, 0x31, 0x05, 0xa9, 0xc9, 0x9b, 0x22, 0x21, 0x13, 0x9a, 0x11, 0x62, 0x03, 0xdc, 0xdd, 0xbb,
+ 0x99, 0x20, 0x22, 0x10, 0xa9, 0x8a, 0x52, 0x45, 0x33, 0x82, 0xaa, 0xbc, 0x9a, 0x88, 0xaa, 0xca,
+ 0x1b, 0x47, 0x45, 0x23, 0x80, 0xcb, 0x9b, 0x28, 0x53, 0x82, 0xdb, 0xbd, 0x8b, 0x20, 0x36, 0x12,
+ 0x81, 0xaa, 0x00, 0x20, 0x13, 0xea, 0xdb, 0x9b, 0x20, 0x52, 0x82, 0x99, 0xbb, 0x50, 0x35, 0x34,
+ 0xa0, 0xbc, 0xcd, 0x89, 0x80, 0x11, 0xb8, 0xaa, 0x9d, 0x21, 0x32, 0x14, 0xcb, 0xba, 0x8c, 0x24,
+ 0x08, 0xf9, 0xae, 0xaa, 0x20, 0x34, 0x22, 0xc8, 0xbb, 0x08, 0x65, 0x23, 0x81, 0xc9, 0x99, 0x20,
+ 0x53, 0x81, 0xa9, 0xab, 0x50, 0x34, 0x15, 0x80, 0x98, 0x18, 0x35, 0x43, 0x02, 0xaa, 0xcb, 0x0a,
+ 0xb1, 0x09, 0x29, 0x00, 0x10, 0x82, 0xbc, 0xba, 0x2a, 0x37, 0x33, 0x93, 0x9c, 0x99, 0x60, 0x04,
+ 0xa9, 0xee, 0x9b, 0x8a, 0x20, 0x91, 0xba, 0xdc, 0x19, 0x22, 0x24, 0xb0, 0xcb, 0xab, 0x20, 0xa1,
+ 0xfb, 0xbe, 0x9b, 0x19, 0x22, 0x81, 0xa9, 0x9b, 0x73, 0x25, 0x14, 0x80, 0x99, 0x89, 0x30, 0x11,
+ 0x90, 0xeb, 0x09, 0x41, 0x46, 0x23, 0x12, 0x80, 0x31, 0x54, 0x34, 0x81, 0xc8, 0xcb, 0x89, 0x21,
+ 0x24, 0x80, 0xca, 0x8b, 0x53, 0x45, 0x12, 0x98, 0xbb, 0x0a, 0x22, 0x14, 0xea, 0xbc, 0x9c, 0x38,
+ 0x33, 0x03, 0xea, 0xbb, 0x09, 0x44, 0x13, 0xb8, 0xcf, 0xaa, 0x08, 0x12, 0x91, 0xeb, 0xbb, 0x09,
+ 0x52, 0x12, 0xb9, 0xcd, 0x8b, 0x11, 0x43, 0x90, 0xbc, 0xad, 0x18, 0x33, 0x25, 0xa8, 0xba, 0x8b,
+ 0x53, 0x43, 0x02, 0xaa, 0xaa, 0x48, 0x36, 0x32, 0x91, 0x9b, 0x89, 0x74, 0x33, 0x02, 0xc9, 0xab,
+ 0x09, 0x55, 0x22, 0x80, 0xca, 0x8a, 0x30, 0x26, 0x01, 0xb9, 0x9d, 0x08, 0x43, 0x12, 0xaa, 0xcd,
+ 0x09, 0x31, 0x35, 0x81, 0xca, 0xab, 0x18, 0x35, 0x23, 0x90, 0xbc, 0x8a, 0x52, 0x24, 0x01, 0xca,
+ 0x8b, 0x20, 0x36, 0x82, 0xc9, 0xbd, 0x08, 0x42, 0x14, 0xa8, 0xcc, 0x8b, 0x10, 0x32, 0xb8, 0xce,
+ 0xab, 0x18, 0x11, 0xc0, 0xbd, 0xbb, 0x31, 0x43, 0x92, 0xcd, 0xab, 0x2a, 0x14, 0x00, 0xfa, 0x8b,
+ 0x88, 0x43, 0x91, 0xa9, 0xad, 0x42, 0x43, 0x14, 0xaa, 0xcb, 0x1a, 0x24, 0x32, 0xd0, 0x9c, 0x9a,
+ 0x52, 0x13, 0x01, 0xcb, 0x09, 0x52, 0x25, 0x01, 0xca, 0xab, 0x28, 0x54, 0x12, 0xa9, 0xbb, 0x1a,
+ 0x47, 0x22, 0x81, 0xaa, 0x08, 0x72, 0x14, 0x00, 0xca, 0x8a, 0x20, 0x45, 0x82, 0x99, 0xac, 0x20,
+ 0x52, 0x23, 0xb9, 0xcb, 0x0b, 0x33, 0x33, 0xf8, 0xad, 0x9b, 0x31, 0x23, 0xa0, 0xcf, 0xaa, 0x10,
+ 0xb1, 0x02, 0x34, 0x00, 0x03, 0xc8, 0xbd, 0x8b, 0x20, 0x23, 0xc8, 0xbd, 0x9b, 0x40, 0x33, 0x91,
+ 0xcd, 0x9b, 0x38, 0x35, 0x82, 0xc9, 0xab, 0x28, 0x45, 0x12, 0xa8, 0xab, 0x38, 0x46, 0x22, 0xa8,
+ 0xbb, 0x1a, 0x55, 0x23, 0x91, 0xcb, 0x8a, 0x42, 0x34, 0x81, 0xcb, 0x9b, 0x31, 0x35, 0x82, 0xeb,
+ 0x9b, 0x38, 0x44, 0x03, 0xc9, 0xbb, 0x1a, 0x54, 0x22, 0xa8, 0xbc, 0x0a, 0x52, 0x13, 0xb0, 0xdc,
+ 0x99, 0x31, 0x24, 0xa0, 0xdc, 0xab, 0x10, 0x33, 0x92, 0xdc, 0xac, 0x08, 0x32, 0x02, 0xda, 0xbb,
+ 0x29, 0x45, 0x12, 0xb8, 0xac, 0x19, 0x45, 0x23, 0x80, 0xbb, 0x19, 0x54, 0x23, 0x91, 0xbb, 0x09,
+ 0x63, 0x13, 0xb8, 0xbe, 0x8a, 0x31, 0x23, 0xc0, 0xcc, 0x9b, 0x20, 0x23, 0xa0, 0xbd, 0x9a, 0x41,
+ 0x24, 0x98, 0xcc, 0x8a, 0x42, 0x44, 0x81, 0xba, 0xac, 0x28, 0x34, 0x81, 0xcd, 0x9c, 0x09, 0x12,
+ 0xa0, 0xdd, 0xbb, 0x18, 0x33, 0x02, 0xdd, 0xab, 0x29, 0x44, 0x12, 0xb8, 0x9b, 0x52, 0x45, 0x13,
+ 0x88, 0x89, 0x63, 0x34, 0x23, 0x98, 0x99, 0x41, 0x44, 0x12, 0xa9, 0xab, 0x28, 0x34, 0x81, 0xcd,
+ 0xac, 0x09, 0x11, 0x90, 0xdd, 0xab, 0x8a, 0x20, 0x80, 0xcb, 0xbc, 0x09, 0x21, 0x12, 0xc9, 0xcb,
+ 0x09, 0x53, 0x23, 0x90, 0xbd, 0x8b, 0x31, 0x26, 0x90, 0xeb, 0xab, 0x09, 0x02, 0xd8, 0xcd, 0xaa,
+ 0x08, 0x11, 0xb8, 0xbe, 0x9b, 0x31, 0x25, 0x81, 0xb9, 0x29, 0x37, 0x25, 0x00, 0x88, 0x41, 0x45,
+ 0x13, 0x81, 0x08, 0x51, 0x34, 0x13, 0x88, 0x89, 0x52, 0x33, 0x91, 0xcc, 0x9a, 0x21, 0x14, 0xb9,
+ 0xbf, 0x9b, 0x10, 0x02, 0xc9, 0xbd, 0x8a, 0x21, 0x03, 0xc8, 0xbd, 0x89, 0x41, 0x23, 0xa0, 0xdc,
+ 0x9a, 0x20, 0x33, 0x90, 0xec, 0xab, 0x19, 0x23, 0xa1, 0xee, 0xab, 0x09, 0x23, 0x81, 0xed, 0xbb,
+ 0x33, 0xea, 0x32, 0x00, 0x30, 0x22, 0xb0, 0xbe, 0x0a, 0x62, 0x23, 0x90, 0xba, 0x28, 0x56, 0x23,
+ 0x81, 0xaa, 0x28, 0x55, 0x22, 0x88, 0xaa, 0x10, 0x34, 0x03, 0xba, 0xae, 0x10, 0x32, 0xa1, 0xdc,
+ 0xab, 0x18, 0x11, 0xb8, 0xbd, 0x9b, 0x30, 0x12, 0xe9, 0xab, 0x19, 0x36, 0x13, 0xa1, 0x89, 0x52,
+ 0x36, 0x12, 0x80, 0x19, 0x42, 0x34, 0x81, 0xda, 0x9b, 0x00, 0x22, 0xc8, 0xdd, 0xab, 0x89, 0x01,
+ 0xa8, 0xcd, 0xab, 0x08, 0x21, 0xb9, 0xdd, 0x9c, 0x10, 0x33, 0x02, 0xca, 0x9c, 0x31, 0x46, 0x01,
+ 0xa8, 0x09, 0x62, 0x43, 0x81, 0xbb, 0x8c, 0x21, 0x34, 0xb8, 0xce, 0x8a, 0x20, 0x13, 0xd9, 0xcc,
+ 0x89, 0x21, 0x02, 0xd9, 0xac, 0x18, 0x34, 0x13, 0xc9, 0x9c, 0x28, 0x44, 0x02, 0xa8, 0x0a, 0x63,
+ 0x25, 0x82, 0xa9, 0x8a, 0x42, 0x25, 0x81, 0xb9, 0x09, 0x44, 0x23, 0xb8, 0xbe, 0x8a, 0x32, 0x14,
+ 0xb9, 0xbd, 0x19, 0x34, 0x03, 0xcc, 0xad, 0x09, 0x33, 0x02, 0xca, 0x9c, 0x38, 0x34, 0xa2, 0xcd,
+ 0x9c, 0x28, 0x33, 0x81, 0xda, 0x8a, 0x30, 0x13, 0xe9, 0xbd, 0x8a, 0x21, 0x23, 0xa0, 0xbc, 0x09,
+ 0x32, 0x91, 0xdd, 0xab, 0x10, 0x34, 0x13, 0x90, 0x08, 0x42, 0x13, 0xa0, 0xaa, 0x51, 0x37, 0x34,
+ 0x24, 0x32, 0x23, 0x02, 0x99, 0x88, 0x31, 0x35, 0x23, 0x43, 0x34, 0x14, 0xc8, 0xcd, 0xab, 0x89,
+ 0x00, 0x98, 0xba, 0x9a, 0x80, 0xdb, 0xcf, 0xcb, 0xaa, 0x89, 0x10, 0x10, 0x11, 0x88, 0x99, 0x09,
+ 0xb8, 0xee, 0xbc, 0x89, 0x63, 0x24, 0x91, 0xcb, 0xab, 0x08, 0xa0, 0xed, 0xac, 0x09, 0x33, 0x13,
+ 0xfb, 0xbb, 0x18, 0x33, 0x92, 0xcc, 0x0a, 0x74, 0x33, 0x91, 0xaa, 0x29, 0x46, 0x13, 0x90, 0x9a,
+ 0x61, 0x44, 0x12, 0xa8, 0x8a, 0x31, 0x26, 0x91, 0xcb, 0x9a, 0x42, 0x14, 0xa8, 0xbd, 0x8b, 0x21,
+ 0xdb, 0x09, 0x2c, 0x00, 0xa0, 0xcd, 0x9a, 0x30, 0x23, 0xc0, 0xbc, 0x8b, 0x31, 0x23, 0xc8, 0xac,
+ 0x0a, 0x32, 0x11, 0xc8, 0xab, 0x9a, 0x99, 0xab, 0xba, 0xba, 0xff, 0xbb, 0x0a, 0x21, 0x91, 0xff,
+ 0xac, 0x19, 0x31, 0x11, 0xcb, 0xac, 0x40, 0x34, 0x02, 0xca, 0x8a, 0x73, 0x34, 0x02, 0xb9, 0x09,
+ 0x63, 0x33, 0x81, 0xca, 0x19, 0x52, 0x23, 0xa8, 0xbc, 0x1a, 0x42, 0x82, 0xcc, 0xac, 0x19, 0x21,
+ 0x91, 0xcc, 0xaa, 0x28, 0x12, 0xc0, 0xbc, 0x09, 0x73, 0x22, 0x91, 0x9a, 0x20, 0x46, 0x12, 0x81,
+ 0x09, 0x32, 0x45, 0x01, 0xb9, 0x9d, 0x08, 0x21, 0xa0, 0xdc, 0xac, 0x89, 0x10, 0x98, 0xcc, 0xbb,
+ 0x89, 0x21, 0xa0, 0xed, 0xab, 0x08, 0x53, 0x02, 0xb8, 0xac, 0x30, 0x55, 0x02, 0x98, 0x8a, 0x52,
+ 0x34, 0x83, 0xca, 0x9c, 0x20, 0x43, 0xa1, 0xcd, 0x9b, 0x20, 0x32, 0xc8, 0xbe, 0x9b, 0x31, 0x13,
+ 0xd9, 0xbc, 0x0a, 0x54, 0x12, 0xa8, 0xbb, 0x19, 0x36, 0x23, 0xa8, 0x9b, 0x73, 0x44, 0x11, 0xa9,
+ 0x9a, 0x31, 0x36, 0x01, 0xa9, 0x8a, 0x52, 0x24, 0xa0, 0xcc, 0x9a, 0x31, 0x14, 0xb0, 0xcc, 0x09,
+ 0x32, 0x14, 0xd9, 0xbc, 0x0a, 0x32, 0x14, 0xb9, 0xad, 0x28, 0x34, 0x82, 0xdc, 0xbb, 0x18, 0x34,
+ 0x02, 0xca, 0x9b, 0x20, 0x14, 0xb8, 0xcf, 0x8a, 0x10, 0x23, 0x90, 0xca, 0x89, 0x31, 0x81, 0xeb,
+ 0xac, 0x18, 0x43, 0x13, 0x90, 0x88, 0x42, 0x13, 0xb0, 0xac, 0x28, 0x47, 0x33, 0x22, 0x32, 0x43,
+ 0x23, 0xb8, 0xdb, 0x09, 0x52, 0x33, 0x23, 0x21, 0x32, 0x91, 0xdd, 0xbd, 0x9b, 0x19, 0x21, 0x12,
+ 0x01, 0xa8, 0xdc, 0xcc, 0xcb, 0xba, 0xbb, 0x89, 0x32, 0x36, 0x01, 0xc9, 0xac, 0x99, 0x90, 0xcc,
+ 0xbb, 0x48, 0x37, 0x23, 0xb0, 0xdb, 0x99, 0x01, 0xc9, 0xcc, 0x1a, 0x63, 0x33, 0xa0, 0xcc, 0x89,
+ 0x49, 0xfb, 0x29, 0x00, 0x12, 0xa8, 0xbd, 0x39, 0x47, 0x22, 0xb8, 0xbb, 0x28, 0x45, 0x81, 0xca,
+ 0x8a, 0x73, 0x33, 0x81, 0xcb, 0x0a, 0x52, 0x03, 0xc8, 0xac, 0x28, 0x44, 0x82, 0xd9, 0xaa, 0x28,
+ 0x23, 0xb0, 0xbe, 0x8b, 0x53, 0x13, 0xb8, 0xae, 0x1a, 0x32, 0x82, 0xfb, 0x9a, 0x20, 0x34, 0x91,
+ 0xdb, 0x8a, 0x32, 0x14, 0xc8, 0xcb, 0x18, 0x44, 0x02, 0xb9, 0x9c, 0x30, 0x33, 0xb0, 0xbf, 0x0a,
+ 0x53, 0x23, 0x98, 0xac, 0x28, 0x43, 0x92, 0xeb, 0x9a, 0x41, 0x25, 0x80, 0xba, 0x89, 0x42, 0x12,
+ 0xca, 0xac, 0x30, 0x46, 0x01, 0xa9, 0xab, 0x28, 0x12, 0xd8, 0xbd, 0x09, 0x53, 0x14, 0xa0, 0xbb,
+ 0x09, 0x32, 0x81, 0xcd, 0x9b, 0x51, 0x34, 0x81, 0xcc, 0x9a, 0x28, 0x12, 0x98, 0xab, 0x70, 0x44,
+ 0x12, 0xba, 0xbc, 0x0a, 0x11, 0xa1, 0xbc, 0x1a, 0x46, 0x14, 0xa0, 0xbc, 0x0a, 0x32, 0x03, 0xc9,
+ 0x9b, 0x62, 0x34, 0xb0, 0xcd, 0x9b, 0x21, 0x24, 0x90, 0x99, 0x51, 0x35, 0x82, 0xdb, 0xbb, 0x18,
+ 0x23, 0xa1, 0xbc, 0x29, 0x55, 0x02, 0xc9, 0xbb, 0x28, 0x44, 0x01, 0xba, 0x8a, 0x53, 0x03, 0xfb,
+ 0xac, 0x09, 0x32, 0x12, 0xa9, 0x1a, 0x64, 0x23, 0xb0, 0xbd, 0x8a, 0x42, 0x02, 0xba, 0x9d, 0x30,
+ 0x25, 0x91, 0xdb, 0x89, 0x43, 0x14, 0x90, 0xaa, 0x38, 0x24, 0xa0, 0xbf, 0x9b, 0x20, 0x23, 0xa0,
+ 0xab, 0x62, 0x35, 0x82, 0xba, 0x9c, 0x21, 0x02, 0xeb, 0xad, 0x08, 0x23, 0x82, 0xdb, 0x8a, 0x51,
+ 0x23, 0xa0, 0xbb, 0x38, 0x36, 0x82, 0xec, 0xaa, 0x08, 0x01, 0xb9, 0xac, 0x30, 0x37, 0x13, 0x88,
+ 0x09, 0x31, 0x83, 0xfb, 0xad, 0x09, 0x21, 0x81, 0xa9, 0x29, 0x54, 0x23, 0xa0, 0xab, 0x30, 0x47,
+ 0x02, 0xa0, 0x99, 0x09, 0x90, 0xdc, 0xac, 0x09, 0x53, 0x43, 0x22, 0x11, 0x21, 0x01, 0xda, 0xcd,
+ 0x08, 0x02, 0x2d, 0x00, 0x99, 0x00, 0x88, 0x99, 0x28, 0x54, 0x12, 0xca, 0xbc, 0x18, 0x24, 0xa1,
+ 0xcc, 0x8a, 0x42, 0x82, 0xfc, 0xac, 0x09, 0x32, 0x12, 0x90, 0x30, 0x45, 0x13, 0xca, 0xbd, 0x8a,
+ 0x10, 0x80, 0x99, 0x31, 0x46, 0x22, 0x98, 0x89, 0x21, 0x23, 0xa8, 0x9d, 0x30, 0x26, 0x81, 0xbc,
+ 0x9c, 0x10, 0x11, 0x90, 0x20, 0x57, 0x24, 0x12, 0x90, 0xb9, 0xca, 0xbc, 0xbc, 0x89, 0x21, 0x23,
+ 0x01, 0x30, 0x44, 0x02, 0xfb, 0xbb, 0x1a, 0x33, 0x92, 0xdf, 0xaa, 0x18, 0x11, 0xc8, 0xbd, 0x09,
+ 0x63, 0x22, 0x98, 0x8a, 0x41, 0x24, 0xb0, 0xbe, 0x9b, 0x21, 0x02, 0xa9, 0x1a, 0x66, 0x33, 0x90,
+ 0xcb, 0x09, 0x42, 0x82, 0xca, 0x8b, 0x63, 0x24, 0xa0, 0xcb, 0x0a, 0x32, 0x13, 0xca, 0x9b, 0x61,
+ 0x34, 0x91, 0xba, 0x9b, 0x20, 0x02, 0xdb, 0x8c, 0x41, 0x25, 0x82, 0xba, 0xab, 0x08, 0xd9, 0xcd,
+ 0x9a, 0x41, 0x34, 0x81, 0xaa, 0x0a, 0x32, 0xc0, 0xcf, 0x9b, 0x30, 0x24, 0xa0, 0xcb, 0x1a, 0x33,
+ 0x82, 0xbd, 0x1a, 0x46, 0x14, 0x90, 0x9a, 0x08, 0x02, 0xda, 0xad, 0x19, 0x53, 0x02, 0x90, 0x30,
+ 0x36, 0x13, 0xb9, 0xbc, 0x18, 0x11, 0xd9, 0xbb, 0x28, 0x35, 0x91, 0xbb, 0x19, 0x55, 0x12, 0x80,
+ 0x20, 0x34, 0xa1, 0xcf, 0xac, 0x99, 0x88, 0x99, 0x08, 0x63, 0x33, 0x01, 0x89, 0x09, 0x01, 0xea,
+ 0xbc, 0xab, 0x98, 0xc9, 0xcb, 0x19, 0x53, 0x13, 0x80, 0x18, 0x44, 0x33, 0x90, 0x99, 0x10, 0xb0,
+ 0xef, 0xac, 0x89, 0x21, 0x42, 0x43, 0x44, 0x23, 0x01, 0xaa, 0xaa, 0x99, 0xa9, 0x9b, 0x39, 0x54,
+ 0x12, 0x99, 0x19, 0x64, 0x23, 0x82, 0x88, 0x28, 0x01, 0xfb, 0xbc, 0xab, 0x89, 0xa9, 0xcd, 0xaa,
+ 0x41, 0x45, 0x13, 0x81, 0xa9, 0xaa, 0xec, 0xcc, 0xab, 0x09, 0x42, 0x13, 0x90, 0x9a, 0x10, 0x81,
+ 0x6e, 0xfd, 0x1c, 0x00, 0xbf, 0x1a, 0x73, 0x12, 0xb8, 0xac, 0x19, 0x23, 0xa0, 0xbd, 0x40, 0x36,
+ 0x03, 0xba, 0x0a, 0x54, 0x13, 0xc9, 0xbb, 0x31, 0x26, 0x90, 0x9b, 0x61, 0x34, 0x81, 0xcc, 0x9a,
+ 0x21, 0x03, 0xb9, 0x1b, 0x47, 0x23, 0xb8, 0xad, 0x09, 0x22, 0xa0, 0xbc, 0x19, 0x44, 0x81, 0xcc,
+ 0x9a, 0x32, 0x03, 0xca, 0x9c, 0x30, 0x23, 0xca, 0xad, 0x19, 0x12, 0xf9, 0xbc, 0x9a, 0x11, 0x12,
+ 0x11, 0x63, 0x33, 0x92, 0xdc, 0xab, 0x9a, 0xa9, 0x8a, 0x62, 0x35, 0x13, 0x98, 0x89, 0x21, 0x02,
+ 0xdb, 0x8b, 0x64, 0x43, 0x01, 0x88, 0x21, 0x12, 0xca, 0xae, 0x0a, 0x31, 0x23, 0x44, 0x36, 0x33,
+ 0xb0, 0xcd, 0xab, 0x9a, 0x99, 0x19, 0x73, 0x35, 0x02, 0xa8, 0xbb, 0xcb, 0xcb, 0xac, 0x08, 0x43,
+ 0x23, 0x81, 0x98, 0x08, 0xea, 0xcd, 0xbb, 0x09, 0x22, 0x32, 0x21, 0x32, 0x13, 0xe9, 0xdd, 0xcb,
+ 0x9a, 0x18, 0x63, 0x43, 0x13, 0x01, 0x90, 0xba, 0xcd, 0xab, 0x1a, 0x63, 0x43, 0x23, 0x12, 0x81,
+ 0xaa, 0xdb, 0x9a, 0x09, 0x22, 0x44, 0x34, 0x24, 0x81, 0xb9, 0xcb, 0xbb, 0xbc, 0x8a, 0x51, 0x53,
+ 0x32, 0x21, 0x11, 0xda, 0xce, 0xac, 0x89, 0x11, 0x12, 0x11, 0x31, 0x22, 0xf9, 0xcc, 0xbb, 0x89,
+ 0x11, 0x21, 0x43, 0x23, 0x81, 0xdb, 0xab, 0xaa, 0xcc, 0xab, 0x30, 0x47, 0x12, 0x91, 0x88, 0x11,
+ 0x91, 0xcc, 0x9b, 0x40, 0x34, 0x33, 0x23, 0x33, 0xa0, 0xcf, 0xab, 0x18, 0x32, 0x23, 0x63, 0x44,
+ 0x13, 0xa0, 0xcc, 0xaa, 0x99, 0x88, 0x11, 0x34, 0x23, 0x01, 0x00, 0x01, 0xfb, 0xcf, 0x9a, 0x20,
+ 0x22, 0x81, 0x99, 0x18, 0x12, 0xe9, 0xbd, 0x9b, 0x18, 0x22, 0x33, 0x34, 0x82, 0xed, 0xbb, 0x89,
+ 0x80, 0xb9, 0x9c, 0x61, 0x45, 0x12, 0x90, 0x99, 0x98, 0xb9, 0xcd, 0xaa, 0x08, 0x21, 0x41, 0x55,
+ 0xba, 0x00, 0x2a, 0x00, 0x13, 0xb8, 0xbc, 0x19, 0x22, 0xa0, 0xbc, 0x2a, 0x55, 0x02, 0xa9, 0x9c,
+ 0x18, 0x22, 0x21, 0x42, 0x24, 0x81, 0x99, 0x41, 0x34, 0xf9, 0xce, 0x9a, 0x18, 0x22, 0x01, 0x31,
+ 0x46, 0x23, 0xa1, 0xeb, 0xbb, 0xba, 0x9a, 0x19, 0x44, 0x33, 0x81, 0x88, 0x21, 0x02, 0xfb, 0xbd,
+ 0x09, 0x21, 0x12, 0xa9, 0x9a, 0x00, 0x81, 0xcb, 0xbd, 0xab, 0x0a, 0x74, 0x36, 0x15, 0x81, 0xca,
+ 0xba, 0xab, 0xbb, 0x9c, 0x38, 0x47, 0x24, 0x13, 0x00, 0xa9, 0xbb, 0xac, 0x9a, 0x08, 0x08, 0x10,
+ 0x64, 0x33, 0x03, 0xb8, 0xaa, 0x09, 0x01, 0x88, 0x09, 0x63, 0x34, 0x82, 0xea, 0xcd, 0xcc, 0x9a,
+ 0x18, 0x44, 0x43, 0x22, 0x02, 0x98, 0xcb, 0xcd, 0xbb, 0x9b, 0x28, 0x52, 0x23, 0x23, 0x10, 0x88,
+ 0x99, 0xba, 0xdb, 0xbb, 0x9a, 0x21, 0x35, 0x33, 0xa8, 0xdc, 0xaa, 0x09, 0x00, 0x08, 0x64, 0x46,
+ 0x24, 0x81, 0xca, 0xcb, 0xba, 0x99, 0x08, 0x53, 0x44, 0x22, 0x02, 0x00, 0x99, 0xdb, 0xac, 0x8a,
+ 0x31, 0x22, 0x80, 0x09, 0x52, 0x33, 0x90, 0xba, 0x9a, 0xa9, 0xcb, 0x1a, 0x55, 0x82, 0xea, 0xbb,
+ 0x89, 0x90, 0xeb, 0x9a, 0x64, 0x44, 0x11, 0xa9, 0xbb, 0xaa, 0xba, 0xbc, 0x8a, 0x21, 0x43, 0x32,
+ 0x53, 0x23, 0x01, 0xb9, 0x99, 0x80, 0xfd, 0xcc, 0x9a, 0x20, 0x43, 0x12, 0x10, 0x01, 0x01, 0x98,
+ 0x19, 0x73, 0x43, 0x02, 0x00, 0xa8, 0xfb, 0xcc, 0xaa, 0x38, 0x44, 0x33, 0x21, 0x21, 0x43, 0x01,
+ 0xb9, 0xcd, 0xbb, 0xaa, 0x9b, 0x89, 0x31, 0x36, 0x34, 0x24, 0x81, 0xda, 0xcc, 0xaa, 0x18, 0x21,
+ 0x11, 0x99, 0x9a, 0xbb, 0xcd, 0xbc, 0x8a, 0x52, 0x34, 0x12, 0x98, 0xaa, 0xba, 0xbb, 0xbd, 0x9a,
+ 0x98, 0x98, 0x0a, 0x75, 0x45, 0x23, 0x12, 0x81, 0xa9, 0xce, 0xbc, 0x9b, 0x30, 0x45, 0x23, 0x33,
+ 0x98, 0x01, 0x1e, 0x00, 0x12, 0xa8, 0xdb, 0x9b, 0x18, 0x21, 0x80, 0x08, 0x21, 0x92, 0xdd, 0xab,
+ 0x21, 0x34, 0x90, 0x20, 0x77, 0x33, 0x81, 0xca, 0xbc, 0xcc, 0xbc, 0xbb, 0x1a, 0x44, 0x34, 0x14,
+ 0x02, 0x90, 0xcb, 0xbc, 0x9a, 0x00, 0x11, 0x81, 0x01, 0x00, 0xd9, 0xae, 0x8a, 0x51, 0x34, 0x22,
+ 0x01, 0x10, 0x01, 0xa9, 0xdc, 0xbb, 0xbb, 0xab, 0x19, 0x65, 0x34, 0x34, 0x12, 0x02, 0xca, 0xcc,
+ 0xac, 0x89, 0x31, 0x35, 0x22, 0x82, 0xa9, 0xeb, 0xaa, 0x88, 0x30, 0x23, 0x32, 0xa1, 0xdb, 0xed,
+ 0x8a, 0x08, 0x53, 0x12, 0x12, 0xa8, 0x98, 0x9c, 0x98, 0xac, 0xca, 0xae, 0xb9, 0x0a, 0x23, 0x65,
+ 0x34, 0x43, 0x02, 0x98, 0xdc, 0xbb, 0xab, 0x09, 0x00, 0x33, 0x10, 0x22, 0x18, 0x36, 0x53, 0x35,
+ 0x22, 0x03, 0xcb, 0xec, 0xac, 0x9a, 0x0a, 0x00, 0x30, 0x13, 0x53, 0x22, 0x54, 0x23, 0x23, 0xa0,
+ 0xea, 0xcd, 0xba, 0xac, 0x88, 0x20, 0x34, 0x43, 0x12, 0x10, 0x80, 0x89, 0x90, 0x18, 0xc8, 0xbc,
+ 0xce, 0xab, 0x9a, 0x38, 0x32, 0x47, 0x22, 0x13, 0x98, 0x99, 0x9a, 0xa0, 0xac, 0xea, 0xbb, 0xba,
+ 0x8c, 0x23, 0x57, 0x24, 0x32, 0x81, 0xa9, 0xfb, 0xba, 0xaa, 0x09, 0x01, 0x22, 0x01, 0x33, 0x31,
+ 0x36, 0x52, 0x34, 0x11, 0xb0, 0xbe, 0xcc, 0xbb, 0xa9, 0x18, 0x21, 0x44, 0x12, 0x32, 0x12, 0x44,
+ 0x11, 0x11, 0xeb, 0xda, 0xcc, 0xba, 0xab, 0x00, 0x41, 0x43, 0x32, 0x23, 0x11, 0x03, 0x20, 0x03,
+ 0x08, 0xfb, 0xae, 0xcb, 0x8a, 0x89, 0x53, 0x33, 0x26, 0x02, 0x81, 0x9a, 0x99, 0x9a, 0x81, 0xab,
+ 0xfa, 0xbc, 0xcb, 0x8c, 0x08, 0x41, 0x33, 0x34, 0x02, 0x99, 0xea, 0x99, 0x98, 0x20, 0x81, 0x21,
+ 0xaa, 0x32, 0x51, 0x47, 0x31, 0x23, 0x00, 0xc8, 0xae, 0xb9, 0x1a, 0x21, 0x42, 0x82, 0x88, 0xfb,
+ 0x27, 0x00, 0x1f, 0x00, 0x98, 0x28, 0x34, 0x22, 0xa1, 0xbd, 0xcd, 0x9c, 0x9a, 0x28, 0x32, 0x34,
+ 0x91, 0xa9, 0xbd, 0x9a, 0x89, 0x21, 0x01, 0xb0, 0xcf, 0xbb, 0x09, 0x44, 0x55, 0x33, 0x34, 0x12,
+ 0x01, 0x89, 0x10, 0x42, 0x24, 0x22, 0x90, 0xab, 0xcc, 0x8b, 0x08, 0x42, 0x91, 0xea, 0xde, 0xbb,
+ 0xbd, 0xba, 0xab, 0xa9, 0xbb, 0xda, 0x9c, 0x98, 0x30, 0x36, 0x63, 0x23, 0x32, 0x01, 0x20, 0x01,
+ 0x55, 0x23, 0x35, 0x23, 0x32, 0x88, 0x01, 0x8a, 0x13, 0x09, 0xd0, 0xbf, 0xdc, 0xac, 0xbb, 0xac,
+ 0xa9, 0x8a, 0xba, 0xab, 0xdb, 0x89, 0xa8, 0x42, 0x12, 0x44, 0x00, 0x42, 0x20, 0x37, 0x43, 0x26,
+ 0x32, 0x14, 0x11, 0x01, 0x18, 0x81, 0x28, 0xb0, 0x9b, 0xfc, 0xab, 0xbd, 0x9b, 0xba, 0x99, 0xcb,
+ 0xb9, 0xbf, 0xa9, 0xbb, 0xa8, 0x8b, 0x01, 0x19, 0x94, 0x4a, 0x27, 0x73, 0x23, 0x43, 0x13, 0x22,
+ 0x80, 0x11, 0xa0, 0x52, 0x13, 0x33, 0xa0, 0xb8, 0xdf, 0xa9, 0x9c, 0x98, 0x9a, 0xc9, 0xac, 0xc9,
+ 0xbc, 0xcb, 0x8a, 0xa0, 0x19, 0x23, 0x42, 0x52, 0x36, 0x22, 0x33, 0x98, 0x11, 0xba, 0x88, 0x09,
+ 0x77, 0x33, 0x14, 0x11, 0x80, 0xba, 0xab, 0xca, 0xbb, 0x20, 0xb0, 0xab, 0xff, 0x9f, 0xa8, 0x99,
+ 0x88, 0x28, 0x22, 0x24, 0x21, 0x12, 0x90, 0xa8, 0x89, 0xed, 0x0a, 0x81, 0x61, 0x15, 0x32, 0x34,
+ 0x21, 0x90, 0x99, 0xab, 0xa9, 0xac, 0x44, 0xa8, 0xb8, 0xae, 0xc8, 0x9e, 0x80, 0x19, 0x24, 0x30,
+ 0x05, 0x09, 0xc9, 0x9c, 0xc9, 0x9a, 0xdb, 0x39, 0x02, 0x32, 0x22, 0x57, 0x00, 0x22, 0x80, 0xa0,
+ 0x9e, 0x01, 0x9a, 0x91, 0x8c, 0x22, 0x88, 0xa0, 0x8c, 0x43, 0x44, 0x33, 0x35, 0xa9, 0x80, 0xcc,
+ 0x98, 0xdf, 0x08, 0x80, 0x18, 0x91, 0x18, 0x13, 0x89, 0x25, 0x90, 0x90, 0xae, 0x11, 0xdc, 0x89,
+ 0xc4, 0xf8, 0x2e, 0x00, 0x89, 0x42, 0x80, 0x62, 0x91, 0x2a, 0x05, 0x28, 0x92, 0x8d, 0x12, 0x08,
+ 0xb0, 0x8e, 0x33, 0x10, 0x54, 0x02, 0x09, 0x00, 0x30, 0x94, 0xcf, 0x80, 0x99, 0x98, 0xbd, 0xaa,
+ 0x8b, 0x33, 0x20, 0x37, 0x81, 0x30, 0x14, 0xba, 0xdd, 0x9b, 0x80, 0xab, 0x01, 0x10, 0x44, 0x41,
+ 0x36, 0x81, 0x18, 0x01, 0x30, 0x05, 0x9b, 0x23, 0xbb, 0xc0, 0xef, 0xa9, 0xac, 0x28, 0x11, 0x42,
+ 0x81, 0x31, 0x83, 0xcf, 0xba, 0xdb, 0x09, 0x99, 0x10, 0xa8, 0x29, 0x02, 0x34, 0xc8, 0x39, 0x26,
+ 0x21, 0x12, 0x98, 0x30, 0x23, 0x62, 0x03, 0xa9, 0x99, 0x73, 0x03, 0x41, 0x54, 0x54, 0x13, 0x00,
+ 0x98, 0xbc, 0xbc, 0x9a, 0xaa, 0x09, 0x52, 0x33, 0x24, 0xa8, 0x1a, 0xb0, 0x2b, 0x85, 0x2b, 0x04,
+ 0x2b, 0x17, 0xa8, 0xb8, 0x0c, 0x35, 0x90, 0x40, 0x33, 0x72, 0x25, 0x21, 0x13, 0xaa, 0x01, 0xdc,
+ 0xbb, 0xbe, 0x0a, 0x80, 0x10, 0x80, 0x18, 0x91, 0xbf, 0xb9, 0xce, 0x8a, 0x98, 0x18, 0xb9, 0x9b,
+ 0xca, 0xbc, 0xcd, 0x9b, 0x08, 0x18, 0x73, 0x12, 0x21, 0x01, 0x20, 0x92, 0xab, 0x08, 0x10, 0x02,
+ 0x43, 0x80, 0x60, 0x34, 0x54, 0x14, 0x01, 0x8a, 0x21, 0xca, 0xab, 0x09, 0x44, 0x24, 0x02, 0x90,
+ 0xfc, 0x9b, 0x80, 0x9a, 0x32, 0x65, 0x24, 0x22, 0x00, 0x88, 0x88, 0x88, 0x20, 0x25, 0x53, 0x44,
+ 0x22, 0x13, 0x99, 0x31, 0x81, 0x9b, 0x28, 0x13, 0x21, 0x55, 0x14, 0xa9, 0xba, 0xce, 0xaa, 0xcd,
+ 0x9a, 0x98, 0x10, 0x80, 0x89, 0xca, 0xcd, 0xab, 0x99, 0xcc, 0x8a, 0x18, 0xb0, 0x9d, 0xb9, 0x9c,
+ 0x88, 0x08, 0x81, 0xba, 0xbb, 0x08, 0xec, 0xab, 0xba, 0x42, 0xd1, 0xbd, 0xcc, 0xca, 0xaa, 0x20,
+ 0x22, 0x21, 0x54, 0x02, 0x88, 0xea, 0x8b, 0x80, 0x29, 0x44, 0x80, 0x00, 0xa9, 0x31, 0x02, 0x30,
+ 0x29, 0xed, 0x1f, 0x00, 0x77, 0x24, 0x11, 0x21, 0x80, 0x20, 0x25, 0x33, 0x14, 0x18, 0x32, 0x81,
+ 0x90, 0xab, 0x63, 0x44, 0x26, 0x22, 0x33, 0x12, 0x62, 0x23, 0x02, 0x80, 0x32, 0x01, 0x98, 0xdc,
+ 0xaa, 0xab, 0x0a, 0x01, 0xb9, 0x3a, 0x77, 0x43, 0x12, 0x88, 0x00, 0xca, 0xde, 0xab, 0xcb, 0xbb,
+ 0x98, 0x98, 0xa9, 0x9a, 0x20, 0x90, 0xce, 0x09, 0x90, 0xaa, 0xdc, 0xbb, 0xdc, 0xab, 0xa9, 0xaa,
+ 0xcd, 0x0b, 0x01, 0x88, 0xba, 0x29, 0x02, 0x19, 0xb0, 0xcf, 0xcd, 0x1a, 0x13, 0x90, 0xaa, 0x50,
+ 0x24, 0x01, 0xb9, 0x9b, 0xa9, 0x71, 0x16, 0x88, 0x89, 0x72, 0x24, 0x01, 0x08, 0x21, 0x31, 0x13,
+ 0x08, 0xa1, 0x8f, 0x46, 0x02, 0x01, 0xa8, 0x62, 0x02, 0x21, 0x02, 0x31, 0x13, 0x54, 0x81, 0xba,
+ 0xad, 0x32, 0x13, 0x33, 0x98, 0x46, 0x81, 0x41, 0xc1, 0x9b, 0x98, 0x29, 0x05, 0xdd, 0x09, 0x98,
+ 0x38, 0xb2, 0x5a, 0x94, 0x2a, 0x95, 0xac, 0xb0, 0x9f, 0x00, 0xab, 0x89, 0x89, 0x10, 0x99, 0x99,
+ 0x8b, 0x82, 0x8c, 0xa2, 0xcf, 0x08, 0xbc, 0x98, 0xde, 0x9a, 0xb8, 0x89, 0xa0, 0x0c, 0x26, 0x80,
+ 0x24, 0xd8, 0x09, 0xb9, 0x29, 0xc1, 0x0b, 0x82, 0x50, 0x15, 0x88, 0xca, 0x8b, 0x00, 0x55, 0x01,
+ 0x22, 0x90, 0x73, 0x93, 0x18, 0xc8, 0x1a, 0x25, 0x21, 0x24, 0xa8, 0x51, 0x91, 0x30, 0xd2, 0x1b,
+ 0x84, 0x2a, 0x16, 0x8a, 0x36, 0x80, 0x43, 0xa0, 0x19, 0xd8, 0x8a, 0xa8, 0x9e, 0x00, 0x88, 0x32,
+ 0x80, 0x10, 0xb9, 0x8b, 0x22, 0x21, 0x05, 0xec, 0x89, 0xc9, 0xcb, 0xdc, 0xbc, 0x9a, 0x09, 0x31,
+ 0x22, 0x62, 0x25, 0x00, 0x91, 0xbe, 0xbb, 0xcc, 0x8a, 0x89, 0x30, 0x25, 0x22, 0x03, 0xa9, 0xaa,
+ 0xcc, 0x9a, 0x28, 0x44, 0x33, 0x81, 0x08, 0xda, 0x8a, 0xe9, 0x1a, 0x34, 0x65, 0x23, 0x10, 0x91,
+ 0xbc, 0x06, 0x34, 0x00, 0x89, 0xb9, 0xac, 0x88, 0x19, 0x55, 0x22, 0x45, 0x82, 0x18, 0xa8, 0x8a,
+ 0x91, 0xad, 0x99, 0x18, 0x44, 0x03, 0xca, 0x09, 0x80, 0x31, 0xfa, 0x8f, 0x21, 0x33, 0x02, 0xec,
+ 0x8b, 0x20, 0x10, 0xc1, 0xbf, 0x18, 0x22, 0x33, 0xd8, 0x9c, 0x19, 0x31, 0x83, 0xdb, 0xbb, 0x18,
+ 0x32, 0x03, 0xca, 0xab, 0x08, 0x02, 0x00, 0xe8, 0x8b, 0xb0, 0x79, 0x05, 0x19, 0x92, 0xad, 0x01,
+ 0x08, 0x24, 0x88, 0x91, 0x59, 0x14, 0x20, 0x95, 0xac, 0x12, 0x88, 0x45, 0xa1, 0x8c, 0x12, 0x10,
+ 0x46, 0xb8, 0x28, 0x92, 0x61, 0x83, 0xaa, 0x99, 0x28, 0x22, 0x11, 0xce, 0x40, 0x81, 0x51, 0xb1,
+ 0x2b, 0xa3, 0x2a, 0xa3, 0x9d, 0x98, 0x10, 0xe9, 0x18, 0xea, 0x18, 0xd9, 0x18, 0xa1, 0x8a, 0xc9,
+ 0x18, 0x98, 0x82, 0xff, 0x8b, 0x08, 0x11, 0xb0, 0xdc, 0x1b, 0x13, 0x20, 0xf1, 0x9e, 0x00, 0x00,
+ 0x13, 0xdb, 0x0a, 0x08, 0x43, 0x91, 0xab, 0x99, 0x18, 0x25, 0x90, 0x8a, 0x08, 0x42, 0x44, 0x02,
+ 0x28, 0xb1, 0x2a, 0x27, 0x21, 0x25, 0x88, 0x18, 0x53, 0x21, 0x34, 0xa8, 0x48, 0x23, 0x56, 0x12,
+ 0x90, 0x08, 0x10, 0x42, 0x04, 0xbb, 0x80, 0x48, 0x37, 0x81, 0x09, 0x8a, 0x41, 0x24, 0xc9, 0xab,
+ 0x99, 0x48, 0x84, 0xcc, 0x99, 0x88, 0x42, 0xc8, 0xbc, 0x89, 0x09, 0x13, 0xcd, 0xac, 0x8a, 0x10,
+ 0xa8, 0xea, 0xac, 0x08, 0x80, 0x98, 0xdc, 0xaa, 0x19, 0x81, 0xa9, 0xfa, 0xab, 0x31, 0x80, 0x80,
+ 0xdb, 0x8a, 0x12, 0x22, 0xda, 0xdb, 0x09, 0x43, 0x13, 0x88, 0xaa, 0x51, 0x55, 0x82, 0x88, 0x99,
+ 0x40, 0x25, 0x21, 0x90, 0x39, 0x35, 0x23, 0x04, 0x08, 0x43, 0x54, 0x23, 0x10, 0x01, 0x20, 0x05,
+ 0x18, 0x23, 0x72, 0x35, 0x00, 0x11, 0x18, 0x43, 0x13, 0x88, 0xca, 0x28, 0x53, 0x82, 0x18, 0x81,
+ 0xf7, 0x1a, 0x22, 0x00, 0x56, 0x91, 0xaa, 0xda, 0x0a, 0x33, 0x90, 0x81, 0xdc, 0xac, 0xb9, 0xbd,
+ 0xab, 0x88, 0x28, 0x24, 0xe9, 0xab, 0xeb, 0x89, 0x90, 0xcd, 0xba, 0xbc, 0x09, 0xa8, 0x0a, 0xba,
+ 0x39, 0xa4, 0xbd, 0xfc, 0xab, 0x08, 0x10, 0x81, 0xbb, 0xae, 0x99, 0xcb, 0x8a, 0xab, 0x71, 0x12,
+ 0x10, 0xa8, 0x19, 0x11, 0x23, 0xea, 0xbc, 0x9a, 0x42, 0x11, 0x37, 0x22, 0x37, 0x12, 0x18, 0xc9,
+ 0x1a, 0x34, 0x34, 0x44, 0x81, 0x20, 0x02, 0x19, 0x14, 0x39, 0x47, 0x21, 0x33, 0x81, 0x21, 0x22,
+ 0x23, 0x01, 0xd8, 0x1b, 0x12, 0x71, 0x26, 0x30, 0x34, 0x90, 0xa8, 0xbd, 0xab, 0x18, 0x12, 0x22,
+ 0xd8, 0xab, 0xf9, 0xab, 0xb8, 0x8c, 0x12, 0x98, 0xa8, 0xcf, 0xaa, 0xab, 0xac, 0xda, 0xcc, 0x9a,
+ 0xab, 0x19, 0x98, 0x20, 0xb0, 0xac, 0xec, 0xbc, 0xaa, 0x9b, 0x88, 0x80, 0xba, 0xcb, 0xcd, 0x89,
+ 0x88, 0x30, 0x03, 0x31, 0x84, 0xab, 0x11, 0x98, 0x64, 0x91, 0x0a, 0xa2, 0x5b, 0x67, 0x11, 0x44,
+ 0x11, 0x21, 0x81, 0x08, 0x21, 0x31, 0x47, 0x11, 0x22, 0x03, 0x28, 0x33, 0x51, 0x45, 0x23, 0x22,
+ 0x02, 0x11, 0x33, 0x13, 0x51, 0x82, 0x39, 0x03, 0x0a, 0x54, 0x42, 0x36, 0x11, 0x88, 0xc8, 0xab,
+ 0xa9, 0xac, 0x18, 0x88, 0xa8, 0xdf, 0xbb, 0xba, 0x99, 0xa8, 0xcb, 0xab, 0xdb, 0xcc, 0xbc, 0xbc,
+ 0xa9, 0xbb, 0xeb, 0xac, 0xab, 0x99, 0x99, 0xba, 0xba, 0xbc, 0xcb, 0xcd, 0xac, 0x9a, 0x89, 0x98,
+ 0xaa, 0xcb, 0xaa, 0xba, 0x8b, 0xa0, 0x59, 0x84, 0x9a, 0x02, 0xad, 0x52, 0x00, 0x38, 0x13, 0x40,
+ 0x55, 0x12, 0x62, 0x23, 0x31, 0x27, 0x01, 0x22, 0x01, 0x38, 0x16, 0x42, 0x44, 0x11, 0x22, 0x22,
+ 0x41, 0x34, 0x21, 0x42, 0x13, 0x52, 0x23, 0x00, 0x31, 0x30, 0x37, 0x13, 0x20, 0x82, 0x51, 0x32,
+ 0xbf, 0x25, 0x27, 0x00, 0x18, 0x12, 0x25, 0x18, 0xfa, 0x9d, 0x19, 0x00, 0x14, 0xab, 0x99, 0xb0,
+ 0x0b, 0xfc, 0x9c, 0x09, 0x89, 0xa8, 0xce, 0xab, 0x88, 0x8b, 0xb9, 0xcd, 0x8a, 0xb9, 0xdb, 0xbb,
+ 0xad, 0x11, 0xa8, 0xcb, 0xec, 0x9b, 0x88, 0x99, 0x09, 0xa9, 0x89, 0x98, 0xbf, 0x8a, 0xbb, 0x2a,
+ 0xd3, 0x8c, 0xa2, 0xab, 0x32, 0xa9, 0x64, 0x11, 0x88, 0x92, 0x8e, 0x11, 0x23, 0x74, 0x02, 0x11,
+ 0x10, 0x99, 0x34, 0x61, 0x53, 0x23, 0x40, 0x82, 0x11, 0x41, 0x88, 0x24, 0x42, 0x23, 0x16, 0x28,
+ 0x32, 0x15, 0x62, 0x81, 0x10, 0x10, 0x89, 0x12, 0x29, 0x71, 0x04, 0x30, 0xa0, 0x99, 0x41, 0x10,
+ 0x15, 0x11, 0x89, 0x92, 0xae, 0xcc, 0xba, 0x0a, 0x00, 0x81, 0x48, 0xba, 0x13, 0xbb, 0xbf, 0xda,
+ 0x8c, 0xca, 0xdb, 0x9b, 0xcb, 0x00, 0x88, 0x9a, 0xc8, 0x0b, 0xb0, 0xd9, 0x0b, 0xeb, 0x80, 0xbb,
+ 0xbf, 0xca, 0x8c, 0x98, 0x88, 0x30, 0x01, 0x27, 0x80, 0xb8, 0xb9, 0x0b, 0xba, 0xd9, 0x8c, 0x98,
+ 0x24, 0x21, 0x90, 0x33, 0x74, 0x22, 0x84, 0x39, 0x82, 0x33, 0x08, 0xcd, 0x00, 0x28, 0x41, 0x86,
+ 0x6a, 0x14, 0x32, 0x15, 0x80, 0x03, 0x09, 0x98, 0xb0, 0x1d, 0x13, 0x41, 0x45, 0x08, 0x43, 0x00,
+ 0x11, 0x82, 0x58, 0x13, 0x10, 0x08, 0xdc, 0x88, 0xaa, 0x98, 0x11, 0x60, 0x14, 0x31, 0x81, 0x12,
+ 0xb0, 0x8d, 0xfc, 0x8b, 0xaa, 0x9b, 0xaa, 0x9a, 0x51, 0x92, 0x2c, 0xf1, 0x0b, 0xa1, 0x9c, 0xa8,
+ 0xab, 0x0a, 0xf8, 0xae, 0xa8, 0xab, 0x13, 0xaa, 0x21, 0x80, 0x40, 0x94, 0xbf, 0x89, 0xbc, 0x20,
+ 0xca, 0x8a, 0x81, 0x1a, 0x17, 0xab, 0x32, 0x90, 0x73, 0xa0, 0x8a, 0x01, 0x09, 0x16, 0xca, 0x38,
+ 0xa0, 0x72, 0xa1, 0x28, 0x22, 0x54, 0x12, 0x80, 0x98, 0x88, 0x22, 0xa8, 0x20, 0x42, 0x57, 0x03,
+ 0xb4, 0x01, 0x2d, 0x00, 0x20, 0xa9, 0x71, 0x82, 0x39, 0xa1, 0x3a, 0x15, 0x88, 0x08, 0xc1, 0x79,
+ 0x94, 0x2a, 0xc3, 0x2b, 0x95, 0x29, 0x91, 0x09, 0x99, 0x23, 0xae, 0x24, 0xad, 0x34, 0xaa, 0x23,
+ 0xbd, 0x00, 0xab, 0x12, 0x1a, 0x91, 0x10, 0x00, 0x26, 0xfb, 0x08, 0xda, 0x48, 0xa1, 0x0c, 0xa1,
+ 0x9c, 0x34, 0xc8, 0x39, 0xd0, 0x49, 0x93, 0x9c, 0x81, 0xad, 0x33, 0xd8, 0x09, 0xa0, 0x1b, 0x27,
+ 0xcb, 0x32, 0xeb, 0x42, 0xd0, 0x08, 0xa0, 0x1a, 0x03, 0xab, 0x21, 0xc9, 0x71, 0xb1, 0x2a, 0xc1,
+ 0x4a, 0xa3, 0x0b, 0x91, 0x8d, 0x24, 0xb9, 0x30, 0xb8, 0x70, 0x93, 0x0b, 0x83, 0x8c, 0x16, 0x99,
+ 0x28, 0xa8, 0x61, 0x81, 0x19, 0x80, 0x31, 0x23, 0x91, 0x0c, 0x12, 0x58, 0x85, 0x0a, 0x23, 0x38,
+ 0x37, 0x9b, 0x02, 0x9a, 0x36, 0xb8, 0x09, 0x82, 0x2a, 0x37, 0xdb, 0x41, 0xb0, 0x60, 0xb2, 0x0c,
+ 0x94, 0x8c, 0x12, 0xdb, 0x20, 0xc1, 0x39, 0xa3, 0x0d, 0x04, 0xab, 0x23, 0xfb, 0x28, 0xb8, 0x0a,
+ 0x91, 0x9d, 0x22, 0xba, 0x31, 0xc8, 0x18, 0x91, 0xab, 0x89, 0xd9, 0x8d, 0xa1, 0xaf, 0x01, 0xab,
+ 0x23, 0xa9, 0x32, 0x13, 0x08, 0x93, 0xef, 0x08, 0xba, 0x18, 0xda, 0x30, 0x81, 0x53, 0x80, 0x03,
+ 0x09, 0x16, 0x8a, 0x01, 0x99, 0x51, 0x05, 0x9a, 0x34, 0xcb, 0x73, 0xc1, 0x58, 0x92, 0x28, 0x06,
+ 0x89, 0x22, 0xa9, 0x28, 0xb1, 0x0c, 0x16, 0x09, 0x35, 0x98, 0x43, 0x90, 0x38, 0xb0, 0x8a, 0x12,
+ 0x88, 0x64, 0x91, 0x48, 0x94, 0x0a, 0x83, 0x9f, 0x21, 0xa8, 0x30, 0x84, 0x09, 0x15, 0xca, 0x89,
+ 0xfb, 0x89, 0x88, 0x89, 0x10, 0x12, 0x18, 0x83, 0xce, 0xaa, 0xdb, 0x9b, 0x89, 0xcc, 0x38, 0xc1,
+ 0x1b, 0xc2, 0x9f, 0x80, 0xab, 0x10, 0xb8, 0x4b, 0x04, 0x9b, 0x82, 0xbf, 0x99, 0xeb, 0x08, 0xa8,
+ 0x29, 0xe9, 0x2d, 0x00, 0x23, 0x31, 0x25, 0x90, 0x20, 0xe0, 0x8d, 0x81, 0xac, 0x33, 0xa8, 0x72,
+ 0x82, 0x29, 0x05, 0x99, 0x41, 0xa1, 0x48, 0x03, 0x19, 0x14, 0x88, 0x10, 0x90, 0xab, 0x55, 0x02,
+ 0x62, 0x14, 0x31, 0x12, 0x00, 0xa0, 0xac, 0x9a, 0x08, 0x18, 0x44, 0x53, 0x15, 0x10, 0x23, 0xd9,
+ 0x19, 0x91, 0xab, 0x10, 0xb9, 0x71, 0xc0, 0x1a, 0xc0, 0x9c, 0x80, 0x89, 0x98, 0x40, 0x83, 0x9a,
+ 0xb9, 0xff, 0xaa, 0xca, 0x9a, 0xa0, 0x9c, 0x33, 0xa8, 0x29, 0xd1, 0x9c, 0xc9, 0xac, 0x90, 0xbc,
+ 0x38, 0xa0, 0x8a, 0xc9, 0x8b, 0xf9, 0x8c, 0x81, 0x89, 0x43, 0x22, 0x33, 0xb0, 0x29, 0xf2, 0xbf,
+ 0x01, 0x9c, 0x42, 0x90, 0x73, 0x82, 0x28, 0x14, 0xaa, 0x42, 0xc8, 0x38, 0xa2, 0x3a, 0x06, 0x09,
+ 0x22, 0x98, 0x20, 0x34, 0x21, 0x54, 0x32, 0x32, 0x01, 0x12, 0xdc, 0x9b, 0xba, 0x10, 0x80, 0x72,
+ 0x27, 0x12, 0x21, 0x03, 0xaa, 0x89, 0xba, 0xfb, 0x9a, 0x80, 0x20, 0xb0, 0x50, 0x92, 0x9a, 0x11,
+ 0x11, 0xec, 0x38, 0xa3, 0xae, 0x98, 0xdd, 0xaa, 0xcb, 0x8b, 0xa0, 0x0c, 0x53, 0x91, 0x19, 0x13,
+ 0xcd, 0xa9, 0xbc, 0xaa, 0xcc, 0x0a, 0x80, 0xa9, 0x19, 0x22, 0xb0, 0x0c, 0x25, 0xa8, 0x48, 0x13,
+ 0x8a, 0xb2, 0xaf, 0x01, 0xcf, 0x08, 0x01, 0x30, 0x44, 0x53, 0x23, 0x31, 0x24, 0x9a, 0x00, 0xdc,
+ 0x28, 0xc9, 0x2b, 0x04, 0x18, 0x27, 0x00, 0x52, 0x01, 0x10, 0x82, 0x98, 0xb9, 0x9c, 0xb8, 0xbf,
+ 0x89, 0x98, 0x32, 0x92, 0x73, 0x17, 0x08, 0x32, 0xb9, 0x0a, 0xfb, 0x8b, 0xc0, 0x9d, 0x11, 0x98,
+ 0x42, 0x82, 0x62, 0x82, 0x29, 0x13, 0xbc, 0x00, 0xfb, 0x1a, 0xc0, 0x1b, 0x13, 0x8b, 0x37, 0x80,
+ 0x52, 0x82, 0x19, 0x83, 0xac, 0x81, 0xbe, 0x19, 0xb8, 0x0c, 0x03, 0x08, 0x35, 0x81, 0x62, 0x91,
+ 0x6b, 0x09, 0x30, 0x00, 0x28, 0xd0, 0x9c, 0xa9, 0xac, 0x88, 0xba, 0x29, 0x82, 0x49, 0x24, 0x88,
+ 0x32, 0xb0, 0xac, 0xdb, 0xbb, 0xcd, 0x9c, 0x18, 0xc9, 0x19, 0x24, 0x22, 0x11, 0x51, 0x26, 0xb8,
+ 0x29, 0x04, 0xca, 0x09, 0x80, 0x01, 0xba, 0x70, 0x17, 0x08, 0x41, 0x23, 0x00, 0x10, 0x22, 0xa0,
+ 0x9b, 0x89, 0x10, 0xfb, 0x49, 0x15, 0x80, 0x33, 0x23, 0x42, 0x80, 0x19, 0xb1, 0xae, 0xa9, 0xbd,
+ 0x9b, 0xcc, 0x19, 0xa8, 0x0b, 0x05, 0x19, 0x36, 0xd8, 0x09, 0xd8, 0x9c, 0x98, 0xbe, 0x08, 0xaa,
+ 0x39, 0x82, 0x1a, 0x16, 0xaa, 0x32, 0xd9, 0x29, 0xd8, 0x0b, 0x91, 0x9d, 0x32, 0xd9, 0x18, 0x91,
+ 0x71, 0x13, 0x09, 0x35, 0x91, 0x28, 0x82, 0x8b, 0x82, 0xce, 0x41, 0x81, 0x68, 0x04, 0x09, 0x22,
+ 0x80, 0x34, 0xc1, 0x19, 0x03, 0x1b, 0x16, 0xbb, 0x11, 0xfb, 0x1a, 0x81, 0x1a, 0x24, 0x9a, 0x62,
+ 0x80, 0x20, 0xd8, 0xae, 0x89, 0x99, 0x8a, 0xba, 0x8c, 0x81, 0x9a, 0x22, 0xe9, 0x0b, 0x01, 0x28,
+ 0x84, 0xaf, 0x08, 0xca, 0xaa, 0xea, 0xab, 0x18, 0x30, 0x37, 0x01, 0x31, 0x33, 0x13, 0x82, 0xdd,
+ 0xab, 0x18, 0x63, 0x14, 0xa9, 0x38, 0x37, 0x22, 0x91, 0x8b, 0x44, 0x03, 0x11, 0xa9, 0x39, 0x17,
+ 0xba, 0xaa, 0x0a, 0x67, 0x82, 0x99, 0x00, 0x52, 0x13, 0xeb, 0xbb, 0x99, 0x20, 0x82, 0xcc, 0x89,
+ 0x20, 0x44, 0x91, 0xab, 0xbb, 0xac, 0x21, 0x90, 0xdc, 0xcd, 0x0a, 0x32, 0xa8, 0xbc, 0x9c, 0x52,
+ 0x14, 0x89, 0x88, 0x09, 0x32, 0xf9, 0xbb, 0x9a, 0x21, 0x04, 0xba, 0x40, 0x35, 0x34, 0xa1, 0x9a,
+ 0x11, 0x21, 0x23, 0xb9, 0x29, 0xa2, 0x1c, 0x54, 0x53, 0x03, 0xda, 0x29, 0x67, 0x22, 0x90, 0xbb,
+ 0x19, 0x34, 0x81, 0xeb, 0xab, 0x41, 0x24, 0x01, 0x99, 0x09, 0x11, 0x98, 0x8a, 0xa8, 0xa9, 0xdd,
+ 0x63, 0x08, 0x2f, 0x00, 0x38, 0x34, 0x82, 0xde, 0xab, 0x40, 0x34, 0x91, 0xcc, 0x9a, 0x21, 0x13,
+ 0xd9, 0xbd, 0x9c, 0x20, 0x22, 0x02, 0xca, 0x9b, 0x09, 0x20, 0x82, 0xde, 0xac, 0x8a, 0x42, 0x25,
+ 0x81, 0xa8, 0x8b, 0x62, 0x24, 0x82, 0xca, 0x8a, 0x52, 0x23, 0xa0, 0xbd, 0x8a, 0x10, 0x11, 0x80,
+ 0x90, 0x30, 0x04, 0x99, 0x21, 0x01, 0xf9, 0xef, 0x09, 0x43, 0x14, 0x81, 0x9a, 0x51, 0x43, 0x12,
+ 0xc9, 0x9b, 0x21, 0x32, 0x83, 0xcc, 0x09, 0x90, 0x9b, 0xca, 0x8a, 0x02, 0xdd, 0x89, 0x88, 0x51,
+ 0x92, 0xbe, 0x9a, 0x09, 0x44, 0xa1, 0x89, 0x21, 0x32, 0x03, 0xdd, 0x89, 0x90, 0x89, 0xb0, 0x9e,
+ 0x52, 0x22, 0x13, 0xfa, 0x0b, 0x10, 0x89, 0xb9, 0xaf, 0x18, 0x80, 0x11, 0xa1, 0x1b, 0x53, 0x12,
+ 0x01, 0x9b, 0x73, 0x15, 0xa8, 0xba, 0x89, 0x21, 0x90, 0x9a, 0x61, 0x46, 0x34, 0x01, 0x10, 0x41,
+ 0x14, 0xc0, 0xcc, 0x9b, 0x21, 0x12, 0xb8, 0xbc, 0x1a, 0x55, 0x23, 0x90, 0xcb, 0x09, 0x32, 0x03,
+ 0xdb, 0xbc, 0x89, 0x32, 0x01, 0x80, 0x29, 0x47, 0x01, 0xcb, 0xbb, 0x38, 0x15, 0xfa, 0xcc, 0x8a,
+ 0x31, 0x24, 0xa0, 0xbb, 0x2a, 0x55, 0x13, 0xa8, 0xbc, 0x89, 0x32, 0x81, 0xeb, 0xab, 0x38, 0x34,
+ 0x04, 0xa8, 0xaa, 0x89, 0x10, 0xc8, 0xce, 0xbb, 0x09, 0x43, 0x24, 0x81, 0x99, 0x30, 0x67, 0x33,
+ 0x01, 0xa8, 0x9b, 0x40, 0x43, 0x02, 0xeb, 0xbc, 0x08, 0x53, 0x23, 0xa8, 0xbd, 0x9b, 0x28, 0x23,
+ 0xd9, 0xbd, 0x9b, 0x40, 0x34, 0x00, 0xba, 0x9b, 0x72, 0x34, 0x13, 0xa8, 0xab, 0x18, 0x22, 0x02,
+ 0xea, 0x8a, 0x30, 0x35, 0x92, 0xdc, 0xac, 0x8a, 0x20, 0x02, 0xca, 0xcd, 0x9c, 0x09, 0x22, 0x21,
+ 0xa0, 0x8a, 0x41, 0x45, 0x24, 0x81, 0x99, 0x99, 0x00, 0x12, 0x32, 0x22, 0x02, 0xfb, 0xac, 0x0a,
+ 0x37, 0x02, 0x30, 0x00, 0x47, 0x22, 0xa0, 0xcd, 0xbb, 0x99, 0x00, 0x81, 0x98, 0xba, 0x99, 0x21,
+ 0x45, 0x44, 0x33, 0x24, 0x01, 0x80, 0xba, 0xcc, 0x9a, 0x31, 0x36, 0x03, 0xca, 0xae, 0x0a, 0x53,
+ 0x34, 0x01, 0xba, 0xbe, 0xba, 0x89, 0x18, 0x21, 0x81, 0x98, 0x9a, 0x48, 0x47, 0x33, 0x13, 0xba,
+ 0xcb, 0xbb, 0x9a, 0x98, 0x30, 0x35, 0x24, 0x81, 0xdc, 0xac, 0x18, 0x53, 0x22, 0xa0, 0xcd, 0xbb,
+ 0xac, 0x08, 0x31, 0x35, 0x24, 0x22, 0x12, 0x11, 0x11, 0xa8, 0xbc, 0xcd, 0x8a, 0x09, 0x10, 0x23,
+ 0xb0, 0xce, 0xac, 0x48, 0x45, 0x33, 0x90, 0xcd, 0xac, 0x8a, 0x10, 0x22, 0x11, 0x80, 0x08, 0x30,
+ 0x45, 0x33, 0x22, 0x80, 0x10, 0x10, 0x21, 0x81, 0xcc, 0xdd, 0xbc, 0xac, 0x8b, 0x20, 0x34, 0x13,
+ 0xb0, 0xbe, 0xac, 0x8a, 0x21, 0x44, 0x23, 0x01, 0xda, 0xbc, 0xaa, 0x20, 0x46, 0x43, 0x01, 0xa8,
+ 0x9a, 0x19, 0x54, 0x33, 0x81, 0xda, 0xbd, 0xbb, 0x99, 0x10, 0x12, 0x90, 0xcc, 0xbc, 0x0a, 0x61,
+ 0x45, 0x33, 0x02, 0xb9, 0xbe, 0x9b, 0x20, 0x36, 0x24, 0x90, 0xcb, 0xbc, 0x89, 0x31, 0x35, 0x12,
+ 0xa8, 0xbc, 0xab, 0x19, 0x43, 0x12, 0xa0, 0xcc, 0xcb, 0x09, 0x31, 0x36, 0x25, 0x02, 0x90, 0xdb,
+ 0xbb, 0x0b, 0x62, 0x44, 0x23, 0xa0, 0xdc, 0xbc, 0x8a, 0x28, 0x43, 0x23, 0x81, 0xca, 0xac, 0x8a,
+ 0x21, 0x24, 0x12, 0x90, 0x98, 0x08, 0x33, 0x45, 0x12, 0xb8, 0xed, 0xbb, 0x9b, 0x30, 0x55, 0x23,
+ 0x02, 0xb9, 0xce, 0xba, 0x89, 0x32, 0x35, 0x23, 0x81, 0xba, 0xbe, 0xaa, 0x0a, 0x21, 0x35, 0x34,
+ 0x33, 0x12, 0x90, 0xbb, 0xbd, 0xbb, 0xbb, 0xbc, 0xab, 0x20, 0x56, 0x24, 0x13, 0xa0, 0xcc, 0xac,
+ 0x9a, 0x41, 0x45, 0x23, 0x12, 0xa9, 0xcc, 0xbc, 0xac, 0x89, 0x30, 0x54, 0x33, 0x22, 0x90, 0xcb,
+ 0x18, 0x07, 0x3c, 0x00, 0xad, 0x9b, 0x09, 0x22, 0x44, 0x22, 0x02, 0x98, 0xcb, 0xbc, 0xbb, 0x8a,
+ 0x41, 0x36, 0x35, 0x33, 0x80, 0xeb, 0xcc, 0xab, 0x8a, 0x28, 0x52, 0x32, 0x13, 0x80, 0xca, 0xbc,
+ 0xbb, 0x8a, 0x31, 0x47, 0x34, 0x32, 0x01, 0xb9, 0xcd, 0xac, 0x9a, 0x08, 0x43, 0x44, 0x22, 0x12,
+ 0x88, 0xba, 0xcb, 0x9b, 0x09, 0x32, 0x44, 0x23, 0x02, 0xb9, 0xcd, 0xbc, 0xab, 0x0a, 0x41, 0x46,
+ 0x43, 0x23, 0x01, 0xc9, 0xbd, 0xbc, 0xaa, 0x09, 0x21, 0x34, 0x32, 0x01, 0xa8, 0xcc, 0xbb, 0xab,
+ 0x08, 0x43, 0x35, 0x23, 0x12, 0x90, 0xdb, 0xbd, 0xbd, 0xba, 0x99, 0x10, 0x43, 0x34, 0x33, 0x01,
+ 0xb8, 0xcb, 0xaa, 0x89, 0x20, 0x32, 0x34, 0x03, 0xb8, 0xcd, 0xbc, 0xbc, 0xab, 0x0a, 0x54, 0x35,
+ 0x44, 0x32, 0x23, 0x12, 0x90, 0xcc, 0xbc, 0x9b, 0x09, 0x20, 0x44, 0x33, 0x33, 0x11, 0x80, 0xa8,
+ 0xdb, 0xcb, 0x19, 0x55, 0x45, 0x32, 0x11, 0xa8, 0xdb, 0xbc, 0xcb, 0x8a, 0x09, 0x21, 0x22, 0x24,
+ 0x22, 0x80, 0xcb, 0xbb, 0x9a, 0x30, 0x64, 0x53, 0x33, 0x02, 0xd9, 0xcd, 0xcb, 0xaa, 0x8a, 0x20,
+ 0x53, 0x24, 0x02, 0x90, 0xba, 0xcb, 0xaa, 0x09, 0x41, 0x34, 0x24, 0x02, 0xa8, 0xcc, 0xdc, 0xbb,
+ 0xac, 0x89, 0x10, 0x31, 0x35, 0x24, 0x12, 0x98, 0xca, 0xba, 0xaa, 0x89, 0x00, 0x22, 0x02, 0xca,
+ 0xbe, 0xac, 0x9a, 0x10, 0x73, 0x34, 0x35, 0x33, 0x23, 0x32, 0x12, 0x90, 0xcc, 0xbb, 0xab, 0x08,
+ 0x21, 0x24, 0x13, 0xb8, 0xce, 0x8a, 0x20, 0x44, 0x43, 0x44, 0x44, 0x33, 0x22, 0x00, 0xb9, 0xec,
+ 0xbc, 0xbc, 0xbb, 0x9a, 0x09, 0x31, 0x45, 0x34, 0x22, 0x01, 0x88, 0x80, 0xa8, 0xba, 0xad, 0x9b,
+ 0xaa, 0xbb, 0xbc, 0xbb, 0xbd, 0xac, 0x18, 0x55, 0x34, 0x13, 0x80, 0x98, 0x9a, 0xba, 0x9c, 0x30,
+ 0x60, 0x02, 0x25, 0x00, 0x37, 0x02, 0xa8, 0xcc, 0xbd, 0xbd, 0xbb, 0x9b, 0x88, 0x11, 0x52, 0x54,
+ 0x33, 0x23, 0x90, 0xca, 0xdb, 0xba, 0xbb, 0x9b, 0x88, 0x98, 0xca, 0xaa, 0x41, 0x56, 0x43, 0x24,
+ 0x22, 0x12, 0x80, 0x80, 0x80, 0x10, 0x21, 0x31, 0x32, 0x12, 0x98, 0xa8, 0xfb, 0xff, 0xcc, 0xcb,
+ 0xaa, 0x18, 0x53, 0x44, 0x24, 0x12, 0x81, 0x98, 0x99, 0x89, 0xa9, 0xcc, 0xcc, 0xab, 0xab, 0x18,
+ 0x63, 0x44, 0x32, 0x22, 0x11, 0x11, 0x01, 0xa8, 0xcd, 0xcc, 0xcb, 0xba, 0x99, 0x18, 0x43, 0x33,
+ 0x13, 0x01, 0x80, 0xa8, 0xba, 0xad, 0xaa, 0x99, 0xaa, 0x29, 0x75, 0x34, 0x22, 0xa8, 0xeb, 0xcb,
+ 0xba, 0xba, 0xba, 0xbb, 0xbb, 0x8a, 0x73, 0x47, 0x44, 0x43, 0x22, 0x01, 0x99, 0xcb, 0xac, 0xbb,
+ 0xba, 0xcb, 0xba, 0xaa, 0x08, 0x63, 0x44, 0x34, 0x22, 0x81, 0x99, 0x88, 0x31, 0x35, 0x12, 0xb8,
+ 0xcd, 0xbb, 0x9a, 0x42, 0x35, 0x23, 0xa0, 0xcc, 0xcb, 0x9a, 0x99, 0x9a, 0x99, 0x99, 0x18, 0x63,
+ 0x55, 0x53, 0x22, 0x02, 0x99, 0xba, 0xab, 0xbb, 0xab, 0xbb, 0xbc, 0xcd, 0xbb, 0x19, 0x64, 0x44,
+ 0x23, 0x12, 0x80, 0xaa, 0xdb, 0xcb, 0xab, 0xbb, 0xbb, 0x8a, 0x72, 0x45, 0x34, 0x23, 0x01, 0xb9,
+ 0xdb, 0xac, 0xbb, 0xaa, 0xbb, 0xbc, 0xbc, 0x8b, 0x52, 0x56, 0x43, 0x32, 0x12, 0x01, 0x99, 0xa9,
+ 0xcb, 0xcb, 0xbc, 0xbc, 0x9a, 0x10, 0x44, 0x25, 0x33, 0x11, 0x98, 0xba, 0xcb, 0xbb, 0xcb, 0xcb,
+ 0xab, 0xaa, 0x21, 0x56, 0x44, 0x32, 0x33, 0x22, 0x80, 0xa9, 0xeb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbb,
+ 0x09, 0x52, 0x54, 0x33, 0x23, 0x11, 0x88, 0xaa, 0xba, 0xba, 0xca, 0xca, 0xba, 0x9a, 0x40, 0x47,
+ 0x33, 0x23, 0x80, 0xba, 0xcc, 0xa9, 0xa9, 0xb9, 0xcd, 0xbc, 0xbc, 0x09, 0x42, 0x54, 0x43, 0x22,
+ 0x91, 0x14, 0x3c, 0x00, 0x11, 0x11, 0x11, 0x10, 0x90, 0xcd, 0xcc, 0xbb, 0x9a, 0x08, 0x01, 0x90,
+ 0xb9, 0xbb, 0xac, 0x18, 0x45, 0x34, 0x14, 0x01, 0xa9, 0x9a, 0x19, 0x31, 0x34, 0x44, 0x22, 0x22,
+ 0x21, 0x12, 0x10, 0x02, 0xfc, 0xcf, 0xbc, 0xbc, 0xaa, 0x89, 0x80, 0x80, 0x00, 0x21, 0x64, 0x35,
+ 0x25, 0x23, 0x11, 0x80, 0x89, 0x09, 0x01, 0x90, 0xca, 0xbf, 0xad, 0x9b, 0x10, 0x43, 0x33, 0x01,
+ 0xca, 0xbc, 0xab, 0x89, 0x21, 0x43, 0x22, 0x22, 0x43, 0x54, 0x44, 0x24, 0x12, 0x90, 0xa9, 0xaa,
+ 0xbb, 0xcb, 0xcd, 0xbc, 0xbb, 0xbc, 0xbb, 0x9a, 0x89, 0x20, 0x43, 0x23, 0x33, 0x53, 0x43, 0x53,
+ 0x53, 0x23, 0x12, 0x01, 0x88, 0x88, 0x10, 0xb8, 0xde, 0xdd, 0xbb, 0xbc, 0x99, 0x88, 0x01, 0x00,
+ 0x98, 0x89, 0x52, 0x35, 0x34, 0x23, 0x12, 0x22, 0x53, 0x63, 0x32, 0x23, 0x13, 0x88, 0xba, 0xab,
+ 0x99, 0xb9, 0xdf, 0xdb, 0xba, 0xa9, 0x89, 0x10, 0x00, 0x21, 0x64, 0x34, 0x24, 0x34, 0x24, 0x12,
+ 0x01, 0x88, 0xa9, 0xaa, 0x09, 0x12, 0x72, 0x24, 0x12, 0xfa, 0xbd, 0xbc, 0xac, 0x9a, 0x99, 0xb9,
+ 0xdb, 0xbb, 0x88, 0x41, 0x45, 0x34, 0x33, 0x12, 0x11, 0x00, 0x11, 0x80, 0xca, 0xde, 0xcc, 0xab,
+ 0xac, 0x9a, 0x9a, 0x08, 0x10, 0x20, 0x81, 0x99, 0xb9, 0xab, 0x61, 0x45, 0x35, 0x34, 0x32, 0x13,
+ 0x00, 0x21, 0x21, 0x02, 0x98, 0x90, 0xdd, 0xbb, 0xcc, 0xdb, 0xbb, 0x9b, 0x18, 0x42, 0x46, 0x34,
+ 0x32, 0x00, 0x10, 0x00, 0x20, 0x24, 0x22, 0x00, 0x28, 0x64, 0x33, 0x34, 0x24, 0x12, 0xa0, 0xac,
+ 0xba, 0xcc, 0xba, 0xbf, 0xcc, 0xbc, 0x9a, 0x89, 0x08, 0x00, 0x21, 0x43, 0x24, 0x25, 0x22, 0x22,
+ 0x80, 0xa8, 0xcc, 0xbb, 0xaa, 0x88, 0x90, 0x99, 0x98, 0xea, 0xcd, 0xbc, 0x9c, 0x9a, 0x09, 0x98,
+ 0xcd, 0xe9, 0x2b, 0x00, 0xcd, 0xad, 0x99, 0x11, 0x63, 0x34, 0x23, 0x11, 0x80, 0x18, 0x22, 0x62,
+ 0x22, 0x80, 0xdb, 0xac, 0x89, 0x18, 0x43, 0x35, 0x23, 0x11, 0x00, 0x00, 0xaa, 0x99, 0xaa, 0xeb,
+ 0xab, 0x10, 0x00, 0xb0, 0xae, 0xc9, 0xbd, 0x09, 0x10, 0x45, 0x12, 0x32, 0x92, 0xba, 0xa9, 0x50,
+ 0x57, 0x33, 0x45, 0x22, 0x81, 0x98, 0xcb, 0xaa, 0xcb, 0x9a, 0xea, 0xcc, 0xcb, 0xab, 0x9a, 0x9a,
+ 0x08, 0x10, 0x01, 0x28, 0x54, 0x53, 0x34, 0x53, 0x13, 0x11, 0x22, 0x32, 0x24, 0x01, 0x08, 0xa0,
+ 0xbc, 0x98, 0xcb, 0x99, 0xcf, 0xab, 0xec, 0x9b, 0xa9, 0x18, 0x11, 0x89, 0x00, 0xda, 0x9b, 0x89,
+ 0x50, 0x36, 0x43, 0x43, 0x90, 0x99, 0xa8, 0x50, 0x24, 0x43, 0x24, 0x01, 0xa8, 0xab, 0x99, 0x10,
+ 0x13, 0x11, 0xfa, 0xef, 0xa9, 0x9a, 0x89, 0x8a, 0x08, 0xba, 0xcb, 0xaa, 0x89, 0x32, 0x44, 0x35,
+ 0x02, 0x20, 0x24, 0x73, 0x33, 0x33, 0x35, 0x00, 0x11, 0x10, 0x10, 0x11, 0x08, 0xa1, 0xff, 0xac,
+ 0xba, 0x89, 0x88, 0x00, 0x91, 0xdb, 0xcb, 0xac, 0xa9, 0x10, 0x24, 0x24, 0xa1, 0xbc, 0xbb, 0x8b,
+ 0x34, 0x54, 0x24, 0x01, 0x10, 0x80, 0x28, 0x53, 0x45, 0x34, 0x02, 0x00, 0x88, 0x09, 0x12, 0x28,
+ 0x83, 0xdd, 0xca, 0xcd, 0xbb, 0xbc, 0x9a, 0xa9, 0xaa, 0xcb, 0xbb, 0x9a, 0x18, 0x53, 0x43, 0x34,
+ 0x44, 0x43, 0x33, 0x44, 0x43, 0x32, 0x13, 0x10, 0x12, 0x10, 0x24, 0x00, 0xb9, 0xff, 0xba, 0xcb,
+ 0xab, 0xba, 0xaa, 0xbb, 0xcd, 0xbc, 0xba, 0x9a, 0x00, 0x22, 0x24, 0x00, 0x11, 0x10, 0x45, 0x44,
+ 0x44, 0x23, 0x22, 0x00, 0x18, 0x10, 0x53, 0x24, 0x12, 0xa0, 0xcc, 0xcb, 0xbb, 0x8a, 0x80, 0x00,
+ 0xd8, 0xbd, 0xdb, 0x9b, 0x20, 0x31, 0x25, 0x91, 0x88, 0xcb, 0x09, 0x42, 0x45, 0x34, 0x22, 0x11,
+ 0xcb, 0x07, 0x30, 0x00, 0x18, 0x63, 0x53, 0x35, 0x22, 0x22, 0x81, 0x08, 0x80, 0x42, 0x23, 0x32,
+ 0xb0, 0xaf, 0xbd, 0xad, 0xa9, 0x9a, 0xa9, 0xcd, 0xcb, 0xcc, 0xaa, 0x99, 0x89, 0x88, 0x99, 0x90,
+ 0xaa, 0x28, 0x42, 0x47, 0x24, 0x33, 0x13, 0x11, 0x22, 0x33, 0x53, 0x13, 0x10, 0xa0, 0xbf, 0xcb,
+ 0xae, 0xaa, 0xba, 0xba, 0xec, 0xab, 0xca, 0x9a, 0xa9, 0x99, 0x88, 0x08, 0x00, 0x00, 0x21, 0x74,
+ 0x44, 0x33, 0x34, 0x22, 0x43, 0x33, 0x44, 0x23, 0x33, 0x25, 0x22, 0x13, 0x88, 0x31, 0x01, 0x53,
+ 0xa0, 0x9b, 0xda, 0x9b, 0xa9, 0xcd, 0xaa, 0xcb, 0xaa, 0xd9, 0xbd, 0x99, 0x8a, 0x22, 0xb8, 0x08,
+ 0xa8, 0x70, 0x25, 0x42, 0x24, 0x32, 0x35, 0x23, 0x21, 0x12, 0x54, 0x33, 0x12, 0x90, 0xca, 0xbb,
+ 0xaa, 0xcc, 0xbc, 0xdc, 0xba, 0xeb, 0xbc, 0xbb, 0xac, 0x99, 0xba, 0xbb, 0xbe, 0xab, 0x9a, 0x99,
+ 0x80, 0x00, 0x62, 0x12, 0x18, 0x12, 0x51, 0x47, 0x32, 0x33, 0x81, 0x20, 0x13, 0x41, 0x04, 0x10,
+ 0x34, 0x80, 0x98, 0xdd, 0x8a, 0x88, 0x11, 0x92, 0xdc, 0xba, 0xaa, 0x99, 0x99, 0x8a, 0x73, 0x02,
+ 0x21, 0xb0, 0x2b, 0x47, 0x63, 0x24, 0x01, 0x22, 0x12, 0x44, 0x12, 0x42, 0x43, 0x32, 0x24, 0x90,
+ 0x88, 0x08, 0x43, 0x15, 0x90, 0x99, 0xba, 0x8a, 0xd9, 0xac, 0xa8, 0x9a, 0x98, 0xef, 0xac, 0xbb,
+ 0x9a, 0x98, 0xda, 0xba, 0xbb, 0x9b, 0xa9, 0xae, 0x99, 0x9a, 0x32, 0xf8, 0xac, 0xc9, 0x19, 0x23,
+ 0x88, 0x13, 0xa9, 0x55, 0x01, 0x32, 0x02, 0x60, 0x25, 0x00, 0x98, 0xbb, 0x38, 0x24, 0x32, 0x92,
+ 0xbb, 0x09, 0x98, 0xa9, 0xdf, 0x9b, 0x80, 0xeb, 0xcd, 0xbc, 0x9a, 0x88, 0x10, 0x90, 0xba, 0x09,
+ 0x21, 0x42, 0x12, 0x50, 0x47, 0x13, 0x22, 0x90, 0x50, 0x44, 0x53, 0x14, 0x01, 0x12, 0x21, 0x32,
+ 0x23, 0x1c, 0x31, 0x00, 0x00, 0x32, 0x23, 0x22, 0xd0, 0xbd, 0x8a, 0x20, 0x45, 0xa1, 0xaa, 0xba,
+ 0x9c, 0xa9, 0xbd, 0x8a, 0xc9, 0x18, 0xf8, 0xac, 0xaa, 0x29, 0x36, 0x81, 0x11, 0x99, 0x38, 0x12,
+ 0x41, 0x25, 0x42, 0x54, 0x11, 0x08, 0x99, 0x40, 0x35, 0x11, 0x80, 0xda, 0xbb, 0xdb, 0xbb, 0xdb,
+ 0xac, 0x9b, 0xeb, 0xcb, 0xbc, 0x9b, 0x99, 0x9a, 0xaa, 0xcc, 0xab, 0xaa, 0x9a, 0x98, 0x88, 0x54,
+ 0x12, 0x10, 0x01, 0x61, 0x36, 0x32, 0x26, 0x01, 0x11, 0x12, 0x41, 0x12, 0x40, 0x24, 0x11, 0x01,
+ 0xa9, 0x18, 0x11, 0x53, 0x13, 0xb9, 0xac, 0xba, 0xab, 0xdb, 0x8c, 0x43, 0x90, 0x10, 0xfb, 0x1a,
+ 0x12, 0x73, 0x16, 0x10, 0x21, 0x21, 0x43, 0x12, 0x62, 0x43, 0x32, 0x23, 0x80, 0x88, 0x20, 0x54,
+ 0x14, 0x88, 0x08, 0xa9, 0x08, 0xea, 0x9b, 0x98, 0x8a, 0xb1, 0xff, 0xbc, 0xba, 0x99, 0xa8, 0xcb,
+ 0xbb, 0xbc, 0x9a, 0xca, 0xbc, 0xa8, 0x8b, 0x32, 0xfc, 0xab, 0xca, 0x29, 0x04, 0x19, 0x02, 0x09,
+ 0x45, 0x11, 0x32, 0x82, 0x72, 0x15, 0x00, 0x98, 0xab, 0x20, 0x22, 0x22, 0xb0, 0xad, 0x88, 0xa9,
+ 0xca, 0xce, 0x8b, 0x90, 0xdb, 0xcd, 0xac, 0x8a, 0x18, 0x10, 0x01, 0x99, 0x40, 0x33, 0x53, 0x02,
+ 0x62, 0x35, 0x23, 0x22, 0x98, 0x52, 0x34, 0x45, 0x23, 0x10, 0x21, 0x20, 0x23, 0x99, 0x28, 0x12,
+ 0x21, 0xe9, 0xce, 0xab, 0x08, 0x42, 0x13, 0xca, 0xa9, 0xca, 0x88, 0xcb, 0x0b, 0x90, 0x29, 0x94,
+ 0xcf, 0xaa, 0x89, 0x55, 0x13, 0x11, 0x90, 0x09, 0x00, 0x89, 0x11, 0x11, 0x64, 0x14, 0xa8, 0xbc,
+ 0x9c, 0x41, 0x14, 0x01, 0xb8, 0xbe, 0xcb, 0xbc, 0xaa, 0xbc, 0x9a, 0xa9, 0xeb, 0xcc, 0xbb, 0x89,
+ 0x09, 0x08, 0x90, 0xdb, 0xab, 0xab, 0xa9, 0xba, 0x59, 0x25, 0x01, 0x00, 0x89, 0x32, 0x53, 0x57,
+ 0x30, 0xd4, 0x37, 0x00, 0x12, 0x21, 0x21, 0x32, 0x23, 0x73, 0x35, 0x32, 0x24, 0x33, 0x32, 0x23,
+ 0x53, 0x54, 0x12, 0x22, 0x01, 0x88, 0xa8, 0x8a, 0x91, 0xbc, 0xca, 0xbb, 0xec, 0xcc, 0xab, 0x9b,
+ 0x9a, 0x98, 0xb9, 0xce, 0xab, 0x9b, 0x89, 0x98, 0x09, 0x22, 0x01, 0x80, 0xbd, 0x48, 0x45, 0x46,
+ 0x13, 0x02, 0x80, 0x08, 0x33, 0x25, 0x23, 0x35, 0x22, 0x01, 0xca, 0x19, 0xa8, 0x70, 0x13, 0xa9,
+ 0xdf, 0xac, 0xa9, 0xab, 0xab, 0xaa, 0xcc, 0xbc, 0xbb, 0xbb, 0xcb, 0x09, 0x32, 0x00, 0xa9, 0xbc,
+ 0x9b, 0x38, 0x57, 0x24, 0x11, 0x21, 0x21, 0x33, 0x22, 0x55, 0x24, 0x24, 0x11, 0x90, 0xa9, 0x19,
+ 0x63, 0x35, 0x81, 0x10, 0x01, 0x51, 0x11, 0x41, 0x14, 0x20, 0x13, 0x98, 0xed, 0x9c, 0x09, 0x00,
+ 0xb8, 0xbb, 0xcd, 0xba, 0x9a, 0x98, 0xbc, 0x8a, 0x10, 0x03, 0xbf, 0x9a, 0x10, 0x47, 0x33, 0x24,
+ 0x02, 0x31, 0x34, 0x34, 0x22, 0x32, 0x43, 0x13, 0x98, 0xfa, 0xac, 0x18, 0x10, 0x02, 0xfb, 0xba,
+ 0xbb, 0x9b, 0xda, 0xcb, 0x9a, 0x08, 0xca, 0xdd, 0xba, 0x99, 0x08, 0x31, 0x80, 0xca, 0xcb, 0x99,
+ 0xa9, 0x19, 0x43, 0x25, 0x33, 0x15, 0x90, 0x09, 0x72, 0x47, 0x22, 0x11, 0x81, 0x00, 0x89, 0x11,
+ 0x01, 0x11, 0x33, 0xc1, 0xce, 0xcb, 0xbb, 0x98, 0x29, 0x13, 0xdd, 0xca, 0xac, 0x89, 0x19, 0x32,
+ 0x22, 0x34, 0x43, 0x03, 0x8a, 0x54, 0x53, 0x44, 0x02, 0x81, 0xc9, 0x8a, 0x21, 0x08, 0x11, 0x89,
+ 0x12, 0xde, 0xaa, 0xcc, 0x8b, 0x10, 0x20, 0xd8, 0xbd, 0xaa, 0x9b, 0x28, 0x22, 0x11, 0x08, 0x42,
+ 0xa2, 0xce, 0x8a, 0x41, 0x44, 0x23, 0x80, 0xca, 0x29, 0x34, 0x43, 0x33, 0x54, 0x14, 0x08, 0x01,
+ 0x9a, 0x00, 0x38, 0x37, 0x90, 0xaa, 0xdb, 0xac, 0x89, 0xb9, 0xa8, 0xce, 0x09, 0xea, 0xbb, 0xcb,
+ 0x5e, 0xd8, 0x39, 0x00, 0x88, 0x88, 0x00, 0x80, 0x99, 0x18, 0x22, 0x55, 0x33, 0x54, 0x22, 0x32,
+ 0x24, 0x11, 0x11, 0x54, 0x34, 0x23, 0x22, 0x21, 0x00, 0x10, 0x82, 0x88, 0x91, 0x9c, 0xc0, 0xcf,
+ 0xca, 0xcc, 0x99, 0x98, 0x98, 0xdb, 0xbc, 0xba, 0xbc, 0xba, 0xbc, 0x9a, 0xa9, 0x99, 0xda, 0xac,
+ 0x98, 0x40, 0x35, 0x32, 0x23, 0x20, 0x63, 0x34, 0x33, 0x34, 0x53, 0x35, 0x22, 0x11, 0x80, 0x62,
+ 0x23, 0x33, 0x92, 0x99, 0x98, 0x9a, 0xc8, 0xbd, 0x0a, 0x88, 0xca, 0xde, 0xac, 0xaa, 0x8a, 0x08,
+ 0xc9, 0xbc, 0xcb, 0xab, 0xba, 0xad, 0x88, 0x80, 0x11, 0xb8, 0xac, 0xb9, 0x49, 0x47, 0x11, 0x22,
+ 0x00, 0x53, 0x81, 0x52, 0x23, 0x44, 0x24, 0x31, 0x14, 0x18, 0x22, 0x23, 0x43, 0x01, 0x31, 0xb1,
+ 0xac, 0x80, 0xbb, 0xd8, 0xbd, 0x00, 0xfa, 0xab, 0xcb, 0x9b, 0xca, 0xad, 0xa9, 0xcb, 0x9a, 0xca,
+ 0x9a, 0xba, 0x09, 0x82, 0xdb, 0x8a, 0x21, 0x12, 0xc8, 0x1b, 0x45, 0x82, 0x88, 0xba, 0x58, 0x35,
+ 0x52, 0x14, 0x99, 0x32, 0x01, 0x21, 0xda, 0x70, 0x04, 0x18, 0x90, 0xad, 0x98, 0x9b, 0x54, 0x81,
+ 0x18, 0xa8, 0x1a, 0xd8, 0x9c, 0x12, 0x41, 0x36, 0x80, 0x89, 0xbc, 0x38, 0x27, 0x31, 0x24, 0x21,
+ 0x24, 0x98, 0x11, 0x22, 0x75, 0x22, 0x21, 0x91, 0xbb, 0x09, 0x19, 0x43, 0x82, 0x22, 0xd8, 0xbd,
+ 0xca, 0xac, 0x98, 0x99, 0x81, 0xed, 0xdb, 0xab, 0x8b, 0x98, 0xa9, 0xa9, 0xcd, 0xaa, 0xca, 0xab,
+ 0xa9, 0x1a, 0x13, 0xfb, 0xcb, 0xad, 0x08, 0x00, 0x31, 0x14, 0x01, 0x12, 0x18, 0x53, 0x21, 0x65,
+ 0x33, 0x33, 0x02, 0x18, 0x22, 0x64, 0x44, 0x22, 0x22, 0x11, 0x22, 0x12, 0x00, 0x55, 0x33, 0x24,
+ 0x91, 0xaa, 0xc9, 0x9b, 0x12, 0x08, 0x35, 0xa8, 0x99, 0xef, 0xab, 0xbb, 0xab, 0x99, 0xcb, 0xaa,
+ 0x3e, 0x02, 0x30, 0x00, 0xdf, 0x9a, 0xab, 0x99, 0xba, 0x8b, 0xb9, 0xac, 0xcc, 0x9b, 0x00, 0x00,
+ 0x34, 0x82, 0x00, 0xa0, 0x70, 0x14, 0x52, 0x36, 0x32, 0x33, 0x10, 0x33, 0x11, 0x73, 0x25, 0x53,
+ 0x12, 0x21, 0x23, 0x88, 0x10, 0x10, 0x63, 0x01, 0x28, 0x92, 0xbc, 0x99, 0xbc, 0x99, 0xdd, 0x8b,
+ 0xd9, 0xcc, 0xaa, 0xba, 0xaa, 0xeb, 0x9a, 0xc8, 0xbd, 0xa9, 0xab, 0x88, 0xba, 0x28, 0x92, 0xab,
+ 0xa0, 0xbc, 0x08, 0x0a, 0x77, 0x12, 0x20, 0x24, 0x23, 0x12, 0x31, 0x46, 0x22, 0x33, 0x44, 0x33,
+ 0x12, 0x32, 0x24, 0x23, 0x02, 0x31, 0x15, 0x89, 0x32, 0x80, 0x20, 0x98, 0x61, 0xe1, 0xad, 0x99,
+ 0xba, 0xca, 0xbb, 0x09, 0xca, 0xbd, 0xbb, 0xcc, 0xcb, 0xab, 0x09, 0x98, 0x09, 0x90, 0xaa, 0xdb,
+ 0xcd, 0xaa, 0xcb, 0x1b, 0x02, 0x09, 0x93, 0x9e, 0x23, 0xfb, 0x28, 0x80, 0x61, 0x82, 0x19, 0x03,
+ 0xac, 0x00, 0x89, 0x56, 0x02, 0x20, 0x01, 0x20, 0x15, 0x30, 0x46, 0x31, 0x44, 0x91, 0x89, 0xa9,
+ 0x38, 0x26, 0x22, 0x44, 0x23, 0x01, 0xb8, 0x8c, 0x11, 0x10, 0x36, 0x02, 0x90, 0xdd, 0xbb, 0x9a,
+ 0xab, 0x20, 0xc0, 0xac, 0xdb, 0xbd, 0xda, 0xac, 0x10, 0x90, 0x9a, 0xeb, 0x9a, 0xb9, 0x9b, 0x00,
+ 0x00, 0x01, 0x88, 0xc0, 0xcf, 0x88, 0x28, 0x34, 0x12, 0x37, 0x82, 0x28, 0x13, 0x62, 0x03, 0x29,
+ 0x36, 0x11, 0x11, 0x80, 0x52, 0x13, 0x52, 0x34, 0x00, 0x32, 0x22, 0x12, 0xdb, 0x8a, 0x99, 0xbc,
+ 0x9c, 0x98, 0xbc, 0xcb, 0x1a, 0x83, 0xbd, 0x20, 0x11, 0x04, 0xde, 0xab, 0xcd, 0x9a, 0x89, 0x89,
+ 0x99, 0x08, 0x11, 0xe8, 0x9b, 0x41, 0x12, 0x22, 0x90, 0x90, 0xef, 0x9b, 0x98, 0x10, 0x33, 0x44,
+ 0x02, 0x00, 0x10, 0x11, 0x10, 0x56, 0x34, 0x81, 0xca, 0xba, 0x9b, 0x9a, 0x48, 0x26, 0x10, 0x13,
+ 0x56, 0x01, 0x2f, 0x00, 0x0a, 0xb0, 0x1c, 0x27, 0x09, 0x33, 0xd8, 0xaa, 0xdb, 0x29, 0x15, 0x09,
+ 0x21, 0x99, 0x00, 0xdc, 0x9a, 0x80, 0x51, 0x24, 0x00, 0xa9, 0x19, 0x12, 0x18, 0x23, 0x73, 0x15,
+ 0x89, 0x22, 0xb9, 0x30, 0x13, 0x57, 0x82, 0x89, 0x12, 0x08, 0x24, 0x01, 0x88, 0xba, 0xaa, 0xd9,
+ 0xff, 0x89, 0x02, 0x00, 0x90, 0xab, 0x82, 0xcd, 0xaa, 0xdb, 0xab, 0xcb, 0xcb, 0xbb, 0xae, 0x88,
+ 0xa8, 0xa9, 0xa9, 0x88, 0xeb, 0x8b, 0x80, 0x20, 0x82, 0x58, 0x04, 0xaa, 0x11, 0x41, 0x47, 0x32,
+ 0x54, 0x22, 0x21, 0x23, 0x02, 0x11, 0x43, 0x37, 0x13, 0x30, 0x25, 0x42, 0x12, 0x10, 0x24, 0x80,
+ 0x33, 0xa8, 0x8a, 0xdb, 0x38, 0xb2, 0xbf, 0x89, 0xaa, 0xcb, 0xcd, 0x9b, 0xb9, 0xad, 0x90, 0xbc,
+ 0xcb, 0xac, 0x99, 0xcc, 0x9b, 0x88, 0x80, 0x99, 0x89, 0xb8, 0xcf, 0x8b, 0xb9, 0xaa, 0xaa, 0x52,
+ 0x04, 0x88, 0x11, 0x11, 0xa8, 0x39, 0x37, 0x00, 0x28, 0x63, 0x13, 0xb9, 0x39, 0x37, 0x11, 0x33,
+ 0x32, 0x37, 0x00, 0x63, 0x02, 0x89, 0x34, 0x21, 0x13, 0xbb, 0x74, 0x15, 0x21, 0x33, 0x43, 0x25,
+ 0x10, 0x21, 0x90, 0x29, 0x24, 0x32, 0x13, 0x48, 0x26, 0x91, 0x88, 0x08, 0x00, 0x00, 0x28, 0x15,
+ 0xed, 0xab, 0xcb, 0xac, 0xbd, 0xab, 0xba, 0xcb, 0xcb, 0xcb, 0xcc, 0xbb, 0xba, 0xbc, 0xcc, 0xab,
+ 0xaa, 0xdb, 0xab, 0xaa, 0x9a, 0xa8, 0xac, 0xa9, 0xbc, 0x88, 0xa8, 0x20, 0x32, 0x75, 0x33, 0x11,
+ 0x32, 0x43, 0x45, 0x33, 0x44, 0x24, 0x43, 0x23, 0x33, 0x34, 0x33, 0x45, 0x24, 0x32, 0x24, 0x32,
+ 0x24, 0x21, 0x22, 0x21, 0x32, 0x23, 0x32, 0x22, 0x08, 0x55, 0x81, 0x89, 0xb9, 0x0a, 0xd8, 0xce,
+ 0xbb, 0xbc, 0xac, 0xbb, 0xbd, 0xbc, 0xac, 0xbb, 0xdb, 0xbc, 0xab, 0xbb, 0xbc, 0xdb, 0xac, 0xba,
+ 0x02, 0xcd, 0x37, 0x00, 0xac, 0xab, 0xac, 0xaa, 0xa9, 0x88, 0xca, 0x9c, 0x9a, 0xaa, 0x98, 0x8a,
+ 0x80, 0x18, 0x44, 0x23, 0x81, 0x50, 0x47, 0x34, 0x12, 0x43, 0x34, 0x53, 0x22, 0x42, 0x24, 0x42,
+ 0x34, 0x22, 0x33, 0x43, 0x44, 0x22, 0x22, 0x34, 0x33, 0x23, 0x22, 0x23, 0x24, 0x21, 0x35, 0x14,
+ 0x21, 0x11, 0x11, 0x80, 0xaa, 0xa9, 0xcb, 0xac, 0xaa, 0xde, 0xbe, 0xab, 0xcb, 0xca, 0xbd, 0x9a,
+ 0xb9, 0xcb, 0xcc, 0xba, 0xca, 0xbb, 0xbb, 0xbd, 0xba, 0xba, 0xbc, 0xbc, 0xac, 0x89, 0xaa, 0xbb,
+ 0xba, 0x99, 0xcc, 0xab, 0xaa, 0x99, 0x88, 0x18, 0x12, 0x08, 0x73, 0x22, 0x64, 0x34, 0x45, 0x23,
+ 0x32, 0x35, 0x22, 0x32, 0x33, 0x55, 0x23, 0x33, 0x43, 0x43, 0x33, 0x33, 0x43, 0x44, 0x33, 0x43,
+ 0x22, 0x32, 0x33, 0x24, 0x11, 0x21, 0x43, 0x33, 0x01, 0x21, 0x22, 0x22, 0x91, 0xdc, 0x99, 0xfb,
+ 0xab, 0xdd, 0xac, 0xaa, 0xad, 0xba, 0xbc, 0xaa, 0xcb, 0xac, 0xba, 0xbc, 0xba, 0xbc, 0xab, 0xbc,
+ 0xbc, 0xcc, 0xab, 0xbb, 0xbc, 0xbb, 0x9c, 0x8a, 0xaa, 0xba, 0xad, 0x88, 0x98, 0x88, 0xa0, 0x40,
+ 0x24, 0x12, 0x21, 0x21, 0x67, 0x33, 0x32, 0x44, 0x42, 0x34, 0x22, 0x33, 0x53, 0x33, 0x33, 0x34,
+ 0x42, 0x23, 0x43, 0x34, 0x33, 0x34, 0x43, 0x23, 0x34, 0x23, 0x23, 0x13, 0x62, 0x13, 0x81, 0x88,
+ 0x10, 0x08, 0xd1, 0xbf, 0x99, 0xcb, 0x89, 0xfb, 0xaa, 0xaa, 0xa9, 0xa9, 0xcc, 0x8b, 0x80, 0x98,
+ 0xb9, 0xce, 0xaa, 0xbb, 0xcc, 0xbb, 0xcc, 0x9b, 0x98, 0xaa, 0x89, 0x99, 0x51, 0x24, 0x30, 0x13,
+ 0x99, 0x20, 0x32, 0xa0, 0x1a, 0x22, 0x77, 0x27, 0x21, 0x32, 0x42, 0x44, 0x22, 0x01, 0x00, 0x09,
+ 0x80, 0xdb, 0xcb, 0x9b, 0x10, 0x21, 0x03, 0x28, 0x37, 0x42, 0x14, 0xa9, 0xaa, 0xbc, 0xdb, 0xcd,
+ 0x31, 0x05, 0x31, 0x00, 0xbc, 0xbb, 0xbb, 0xba, 0xbd, 0xaa, 0xab, 0x8a, 0xcc, 0xbc, 0xbb, 0xbb,
+ 0xca, 0xcc, 0xbb, 0xab, 0x89, 0x99, 0x88, 0xbb, 0x68, 0x03, 0x30, 0xc1, 0x9d, 0x52, 0x12, 0x42,
+ 0x02, 0x71, 0x34, 0x43, 0x23, 0x33, 0x54, 0x34, 0x33, 0x32, 0x33, 0x45, 0x34, 0x23, 0x32, 0x25,
+ 0x33, 0x25, 0x12, 0x21, 0x22, 0x41, 0x23, 0x81, 0x32, 0x24, 0x54, 0x23, 0x21, 0x33, 0x33, 0x34,
+ 0x01, 0xdb, 0xad, 0x9a, 0xcc, 0xdb, 0xdb, 0x9a, 0xa9, 0xaa, 0xba, 0xbe, 0x9a, 0xaa, 0xcc, 0xcc,
+ 0xbb, 0xab, 0xbc, 0xcc, 0xac, 0xaa, 0xaa, 0x9a, 0xdb, 0xaa, 0xaa, 0xab, 0xca, 0xcd, 0xaa, 0xb9,
+ 0xab, 0xcb, 0xbb, 0xbb, 0x99, 0x00, 0x10, 0x10, 0x62, 0x35, 0x23, 0x43, 0x22, 0x52, 0x45, 0x21,
+ 0x43, 0x11, 0x63, 0x43, 0x22, 0x33, 0x34, 0x44, 0x24, 0x23, 0x42, 0x42, 0x42, 0x33, 0x22, 0x42,
+ 0x43, 0x32, 0x33, 0x12, 0x53, 0x23, 0x32, 0x24, 0x11, 0x43, 0x12, 0x32, 0x02, 0x09, 0x10, 0xa8,
+ 0xbd, 0xbd, 0xcd, 0xbb, 0xca, 0xcb, 0xba, 0xdc, 0x9a, 0xba, 0xad, 0xcb, 0xbc, 0xbb, 0xcc, 0xbb,
+ 0xcc, 0xbb, 0xab, 0xbc, 0xbb, 0xbc, 0xaa, 0xab, 0xcb, 0xdb, 0xaa, 0xaa, 0xac, 0xca, 0xbb, 0xab,
+ 0xac, 0xba, 0xca, 0x8a, 0x90, 0x08, 0x00, 0x30, 0x25, 0x10, 0x44, 0x32, 0x44, 0x23, 0x52, 0x34,
+ 0x33, 0x36, 0x22, 0x63, 0x33, 0x43, 0x23, 0x33, 0x35, 0x34, 0x23, 0x43, 0x43, 0x33, 0x34, 0x23,
+ 0x52, 0x23, 0x52, 0x23, 0x31, 0x34, 0x24, 0x33, 0x34, 0x32, 0x34, 0x22, 0x32, 0x23, 0x12, 0x11,
+ 0x12, 0x19, 0x43, 0x90, 0x88, 0x11, 0x20, 0x37, 0xda, 0x1a, 0xa0, 0xbc, 0xee, 0xbc, 0xbc, 0xca,
+ 0xbb, 0xbc, 0xac, 0xaa, 0xb9, 0xdb, 0xcb, 0xbb, 0xcb, 0xdb, 0xdb, 0xba, 0xbb, 0xac, 0xbb, 0xbc,
+ 0xcc, 0xe1, 0x33, 0x00, 0xba, 0xcb, 0xba, 0xbc, 0xba, 0xbb, 0xbb, 0xbc, 0xca, 0xcc, 0xbb, 0xbc,
+ 0xbb, 0xbb, 0xbb, 0x0a, 0x88, 0x40, 0x90, 0x88, 0x88, 0x33, 0xa8, 0xa8, 0x4a, 0x77, 0x43, 0x33,
+ 0x63, 0x43, 0x33, 0x24, 0x21, 0x42, 0x43, 0x34, 0x24, 0x34, 0x43, 0x33, 0x33, 0x34, 0x53, 0x24,
+ 0x43, 0x43, 0x33, 0x24, 0x33, 0x33, 0x43, 0x23, 0x34, 0x32, 0x34, 0x34, 0x34, 0x33, 0x34, 0x32,
+ 0x23, 0x00, 0x90, 0x19, 0x80, 0x30, 0x02, 0x62, 0x02, 0xa0, 0xde, 0xbb, 0xad, 0xbb, 0xcd, 0xba,
+ 0xbc, 0xdb, 0xbc, 0xdb, 0xba, 0xac, 0xbb, 0xcb, 0xbb, 0xbb, 0xbc, 0xcb, 0xbc, 0xbb, 0xbd, 0xbc,
+ 0xbc, 0xba, 0xbb, 0xba, 0xab, 0xaa, 0xab, 0xcc, 0xbb, 0xbd, 0xaa, 0xbb, 0xaa, 0xab, 0x80, 0x09,
+ 0x12, 0x48, 0x37, 0x53, 0x43, 0x42, 0x43, 0x34, 0x33, 0x34, 0x33, 0x44, 0x22, 0x32, 0x33, 0x36,
+ 0x44, 0x33, 0x34, 0x34, 0x33, 0x33, 0x33, 0x43, 0x43, 0x33, 0x24, 0x34, 0x43, 0x33, 0x32, 0x33,
+ 0x43, 0x33, 0x11, 0x00, 0x08, 0x99, 0x89, 0xba, 0xaa, 0xed, 0x99, 0xba, 0x9a, 0xcb, 0x9a, 0xcb,
+ 0xb9, 0xde, 0xcc, 0xbd, 0xac, 0xcb, 0xba, 0xbc, 0xca, 0xaa, 0xaa, 0xbb, 0xbd, 0xcb, 0xab, 0xbb,
+ 0xcc, 0xcb, 0xab, 0xaa, 0xa9, 0x99, 0xaa, 0x9a, 0xa9, 0xb9, 0xce, 0xcb, 0xbb, 0xaa, 0xcc, 0xcb,
+ 0xcb, 0xaa, 0xa9, 0x98, 0x10, 0x44, 0x54, 0x43, 0x23, 0x33, 0x34, 0x22, 0x23, 0x11, 0x31, 0x32,
+ 0x46, 0x33, 0x34, 0x43, 0x34, 0x33, 0x13, 0x02, 0x41, 0x54, 0x43, 0x34, 0x32, 0x44, 0x43, 0x33,
+ 0x32, 0x33, 0x44, 0x34, 0x33, 0x23, 0x01, 0x08, 0xa8, 0xbb, 0xce, 0xbb, 0x99, 0x30, 0x35, 0x34,
+ 0x23, 0x32, 0x23, 0x82, 0xda, 0xbe, 0xaa, 0x08, 0x21, 0xa0, 0xdc, 0xbd, 0xcc, 0xdb, 0xbb, 0xcc,
+ 0x08, 0x10, 0x35, 0x00, 0xaa, 0x99, 0xa8, 0xca, 0xdb, 0xbb, 0xab, 0xbb, 0xba, 0xac, 0x18, 0x43,
+ 0x33, 0xa0, 0xdd, 0xdb, 0xcb, 0xbb, 0xbd, 0xba, 0x99, 0x00, 0x11, 0x81, 0xa9, 0xba, 0x9c, 0x09,
+ 0x20, 0x56, 0x63, 0x34, 0x33, 0x32, 0x01, 0x08, 0x08, 0x18, 0x32, 0x46, 0x35, 0x43, 0x22, 0x11,
+ 0x81, 0xa8, 0xb9, 0x19, 0x75, 0x44, 0x34, 0x33, 0x34, 0x22, 0x12, 0x80, 0x99, 0x89, 0x32, 0x54,
+ 0x43, 0x12, 0x01, 0x98, 0xca, 0xcc, 0xac, 0x9a, 0x28, 0x63, 0x33, 0x33, 0x11, 0x80, 0xb9, 0xcd,
+ 0xcb, 0x9a, 0x28, 0x53, 0x23, 0x82, 0xea, 0xcc, 0xcc, 0xac, 0xbb, 0xbb, 0x99, 0x10, 0x11, 0x02,
+ 0xb0, 0xcc, 0xdb, 0xab, 0xab, 0x8a, 0x20, 0x44, 0x24, 0x82, 0xca, 0xce, 0xcb, 0xac, 0xbb, 0xab,
+ 0x8a, 0x08, 0x01, 0x01, 0xa9, 0xbc, 0xac, 0x8a, 0x31, 0x47, 0x44, 0x34, 0x33, 0x23, 0x01, 0xb9,
+ 0xdb, 0xbb, 0xac, 0x8a, 0x08, 0x32, 0x34, 0x33, 0x23, 0x22, 0x42, 0x54, 0x45, 0x44, 0x34, 0x34,
+ 0x32, 0x33, 0x12, 0x01, 0x99, 0xaa, 0xa9, 0x88, 0x10, 0x11, 0x11, 0x21, 0x80, 0xba, 0xad, 0x29,
+ 0x57, 0x45, 0x34, 0x34, 0x33, 0x22, 0x02, 0xa8, 0xcd, 0xdb, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xbb,
+ 0xbc, 0xcc, 0xcb, 0xcb, 0xaa, 0xaa, 0xa9, 0x9a, 0x98, 0x99, 0xba, 0xce, 0xcc, 0xbc, 0xcb, 0xbb,
+ 0xbb, 0xab, 0x9a, 0x89, 0x99, 0xba, 0xdc, 0xcc, 0xbb, 0xab, 0x8a, 0x28, 0x63, 0x34, 0x34, 0x22,
+ 0x01, 0xa8, 0xa9, 0x99, 0x20, 0x47, 0x54, 0x34, 0x34, 0x43, 0x21, 0x21, 0x01, 0x12, 0x21, 0x43,
+ 0x44, 0x34, 0x33, 0x23, 0x01, 0x88, 0x08, 0x22, 0x54, 0x45, 0x44, 0x44, 0x32, 0x22, 0x11, 0x80,
+ 0x90, 0x98, 0x9a, 0x8a, 0x18, 0x22, 0x13, 0xd9, 0xdd, 0xcc, 0xba, 0xbb, 0xba, 0x9a, 0x28, 0x44,
+ 0x2c, 0x1d, 0x28, 0x00, 0x33, 0x81, 0xda, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xac, 0xba, 0xdb, 0xbd,
+ 0xbd, 0xbc, 0xaa, 0xab, 0x99, 0x89, 0x20, 0x34, 0x24, 0x01, 0x99, 0xcb, 0xcb, 0xcb, 0xbc, 0xba,
+ 0x99, 0x08, 0x98, 0xdb, 0xbd, 0xbc, 0xac, 0x99, 0x00, 0x52, 0x44, 0x44, 0x32, 0x22, 0x12, 0x11,
+ 0x11, 0x21, 0x33, 0x36, 0x35, 0x24, 0x02, 0x00, 0x99, 0xba, 0xbc, 0x8a, 0x72, 0x45, 0x44, 0x32,
+ 0x24, 0x22, 0x22, 0x00, 0x80, 0x00, 0x31, 0x54, 0x33, 0x23, 0x10, 0xa9, 0xdb, 0xcc, 0xcb, 0x9a,
+ 0x19, 0x63, 0x33, 0x24, 0x02, 0x01, 0x99, 0xba, 0xbd, 0xab, 0x28, 0x45, 0x23, 0x02, 0xca, 0xde,
+ 0xdb, 0xcb, 0xbb, 0xba, 0x9a, 0x18, 0x11, 0x11, 0x90, 0xcc, 0xcb, 0xac, 0xab, 0x9a, 0x10, 0x53,
+ 0x34, 0x11, 0xc9, 0xcd, 0xbd, 0xcb, 0xbb, 0xba, 0x9a, 0x08, 0x10, 0x01, 0xa8, 0xdb, 0xbb, 0x9a,
+ 0x30, 0x47, 0x44, 0x44, 0x32, 0x13, 0x01, 0x98, 0xbb, 0xbd, 0xba, 0xaa, 0x08, 0x32, 0x34, 0x34,
+ 0x22, 0x21, 0x32, 0x54, 0x45, 0x44, 0x44, 0x33, 0x43, 0x22, 0x22, 0x00, 0x88, 0x9a, 0x9a, 0x89,
+ 0x10, 0x10, 0x11, 0x11, 0x00, 0xb9, 0xcb, 0x1a, 0x56, 0x46, 0x34, 0x53, 0x22, 0x23, 0x11, 0x98,
+ 0xdb, 0xcc, 0xbb, 0xbb, 0xbc, 0xba, 0xcb, 0xaa, 0xbb, 0xbc, 0xbd, 0xac, 0xab, 0xab, 0xa9, 0x9a,
+ 0x88, 0x88, 0xa8, 0xdd, 0xcc, 0xbc, 0xcc, 0xba, 0xbb, 0xaa, 0x99, 0x88, 0x88, 0xa8, 0xcb, 0xcd,
+ 0xbb, 0xbb, 0x99, 0x20, 0x45, 0x44, 0x33, 0x22, 0x80, 0xba, 0xcc, 0xaa, 0x09, 0x62, 0x54, 0x44,
+ 0x33, 0x24, 0x22, 0x11, 0x01, 0x00, 0x21, 0x43, 0x54, 0x33, 0x24, 0x02, 0x90, 0xb9, 0xbc, 0x9a,
+ 0x18, 0x73, 0x45, 0x34, 0x43, 0x22, 0x12, 0x80, 0x80, 0x98, 0x08, 0x18, 0x32, 0x23, 0xa0, 0xef,
+ 0xc3, 0x22, 0x2e, 0x00, 0xcd, 0xcb, 0xbb, 0xba, 0x8a, 0x08, 0x42, 0x33, 0x33, 0x12, 0x98, 0xaa,
+ 0xac, 0xaa, 0xaa, 0x99, 0xaa, 0xee, 0xdd, 0xbc, 0xbd, 0xbc, 0xba, 0x9a, 0x8a, 0x18, 0x32, 0x34,
+ 0x33, 0x23, 0x21, 0x32, 0x43, 0x53, 0x33, 0x34, 0x14, 0x81, 0xda, 0xcd, 0xbc, 0xac, 0xba, 0xa9,
+ 0x08, 0x21, 0x44, 0x43, 0x33, 0x32, 0x43, 0x53, 0x33, 0x34, 0x33, 0x34, 0x22, 0x01, 0xda, 0xbc,
+ 0xbd, 0xbb, 0xab, 0x9b, 0x09, 0x31, 0x45, 0x43, 0x32, 0x32, 0x53, 0x53, 0x33, 0x34, 0x24, 0x23,
+ 0x23, 0x02, 0xba, 0xce, 0xab, 0xbb, 0xaa, 0x9b, 0x89, 0x41, 0x34, 0x43, 0x21, 0x21, 0x44, 0x44,
+ 0x33, 0x43, 0x23, 0x23, 0x02, 0xd8, 0xcd, 0xcc, 0xbb, 0xbb, 0xbb, 0xac, 0xaa, 0x8a, 0x89, 0xba,
+ 0xbd, 0xad, 0x8a, 0x89, 0x88, 0xa9, 0x89, 0x99, 0xdc, 0xce, 0xcc, 0xcb, 0xba, 0xaa, 0xba, 0xaa,
+ 0xa9, 0x88, 0x98, 0xba, 0xbc, 0x9c, 0x28, 0x63, 0x34, 0x34, 0x34, 0x34, 0x32, 0x01, 0x98, 0x09,
+ 0x20, 0x35, 0x35, 0x34, 0x35, 0x43, 0x32, 0x22, 0x12, 0x43, 0x35, 0x45, 0x33, 0x34, 0x33, 0x34,
+ 0x22, 0x12, 0x00, 0x00, 0x22, 0x44, 0x33, 0x33, 0x33, 0x12, 0x98, 0xdd, 0xbc, 0xab, 0x08, 0x33,
+ 0x36, 0x33, 0x34, 0x12, 0x90, 0xeb, 0xcc, 0xba, 0xa9, 0x88, 0x89, 0xaa, 0xcc, 0xcc, 0xbd, 0xbd,
+ 0xcb, 0xaa, 0x98, 0x10, 0x21, 0x12, 0x12, 0xa8, 0xec, 0xbc, 0xbc, 0x9b, 0x89, 0x00, 0x11, 0x80,
+ 0xb9, 0xcf, 0xbd, 0xbd, 0xab, 0x9a, 0x08, 0x21, 0x32, 0x22, 0x81, 0xfb, 0xdb, 0xac, 0xaa, 0x09,
+ 0x22, 0x34, 0x24, 0x01, 0xb8, 0xce, 0xbc, 0xbc, 0xaa, 0x09, 0x22, 0x44, 0x32, 0x12, 0x90, 0xbb,
+ 0xbe, 0xba, 0x09, 0x42, 0x45, 0x43, 0x12, 0x80, 0xba, 0xcd, 0xbb, 0xaa, 0x19, 0x53, 0x45, 0x23,
+ 0x2f, 0xef, 0x2e, 0x00, 0x02, 0x80, 0xba, 0xcb, 0x9b, 0x09, 0x53, 0x54, 0x23, 0x23, 0x80, 0xb9,
+ 0xbc, 0xac, 0x8a, 0x41, 0x45, 0x44, 0x23, 0x22, 0x80, 0xa9, 0xca, 0xaa, 0x89, 0x31, 0x46, 0x34,
+ 0x23, 0x12, 0x88, 0xb9, 0xba, 0x8a, 0x52, 0x46, 0x34, 0x34, 0x23, 0x02, 0x90, 0xaa, 0xbb, 0x8b,
+ 0x30, 0x46, 0x35, 0x43, 0x12, 0x81, 0xa8, 0xba, 0xac, 0x99, 0x21, 0x36, 0x35, 0x33, 0x13, 0x90,
+ 0xca, 0xdb, 0xbb, 0x9a, 0x08, 0x32, 0x23, 0x92, 0xec, 0xdd, 0xdb, 0xbb, 0xac, 0x9a, 0x09, 0x10,
+ 0x21, 0x12, 0x90, 0xeb, 0xcc, 0xbc, 0xcb, 0xaa, 0xaa, 0x99, 0xba, 0xdb, 0xbc, 0xbd, 0xbd, 0xbb,
+ 0xab, 0x8a, 0x18, 0x11, 0x12, 0x01, 0xa9, 0xde, 0xbc, 0xbc, 0xab, 0x8a, 0x08, 0x08, 0x98, 0xbb,
+ 0xce, 0xcc, 0xcb, 0xbb, 0x89, 0x21, 0x34, 0x24, 0x33, 0x23, 0x02, 0xa9, 0xcc, 0x99, 0x41, 0x44,
+ 0x24, 0x12, 0x02, 0x80, 0xc9, 0xbc, 0x9c, 0x18, 0x55, 0x44, 0x33, 0x33, 0x43, 0x32, 0x21, 0x10,
+ 0x31, 0x46, 0x34, 0x34, 0x33, 0x22, 0x11, 0x80, 0xa9, 0xab, 0x38, 0x66, 0x44, 0x33, 0x43, 0x33,
+ 0x33, 0x24, 0x32, 0x43, 0x44, 0x53, 0x32, 0x12, 0x01, 0x98, 0xb9, 0xbc, 0xac, 0x8a, 0x42, 0x45,
+ 0x24, 0x33, 0x32, 0x23, 0x12, 0x81, 0x10, 0x41, 0x34, 0x33, 0x90, 0xdc, 0xbd, 0xcc, 0xcb, 0xab,
+ 0x9a, 0x18, 0x33, 0x33, 0x02, 0xb9, 0xdd, 0xbc, 0xbd, 0xbb, 0x8a, 0x08, 0x00, 0xb0, 0xdc, 0xbd,
+ 0xbd, 0xbc, 0xbc, 0xaa, 0x9a, 0x88, 0x99, 0xca, 0xcc, 0xbc, 0xcb, 0xbb, 0xaa, 0x09, 0x22, 0x24,
+ 0x82, 0xc9, 0xce, 0xdb, 0xcb, 0xca, 0x9a, 0x8a, 0x08, 0x08, 0x98, 0xaa, 0xbc, 0xbb, 0xba, 0x8a,
+ 0x51, 0x45, 0x34, 0x12, 0x98, 0xcc, 0xcb, 0xac, 0xbb, 0x9a, 0x28, 0x44, 0x43, 0x12, 0x00, 0x99,
+ 0x2c, 0xc8, 0x29, 0x00, 0x99, 0x88, 0x31, 0x57, 0x44, 0x33, 0x23, 0x80, 0xa8, 0xaa, 0xba, 0x8a,
+ 0x40, 0x56, 0x34, 0x24, 0x12, 0x81, 0x80, 0x00, 0x11, 0x44, 0x54, 0x34, 0x34, 0x22, 0x11, 0x98,
+ 0xaa, 0xa9, 0x09, 0x42, 0x55, 0x34, 0x24, 0x23, 0x12, 0x00, 0x80, 0x20, 0x52, 0x44, 0x43, 0x33,
+ 0x33, 0x02, 0x98, 0xbc, 0xab, 0x19, 0x53, 0x35, 0x34, 0x24, 0x23, 0x80, 0xc9, 0xbb, 0x9a, 0x42,
+ 0x54, 0x33, 0x43, 0x22, 0x01, 0xca, 0xbe, 0xad, 0xaa, 0x99, 0x99, 0xaa, 0xaa, 0xbb, 0xcc, 0xcc,
+ 0xaa, 0x89, 0x42, 0x43, 0x22, 0x81, 0xc9, 0xdd, 0xcc, 0xbc, 0xac, 0xaa, 0xaa, 0x9a, 0x9a, 0xaa,
+ 0xbb, 0xcc, 0xbb, 0x9b, 0x89, 0x10, 0x01, 0x00, 0xca, 0xde, 0xcd, 0xcb, 0xbb, 0xaa, 0xaa, 0xa9,
+ 0x9a, 0xaa, 0xca, 0xcd, 0xcc, 0xaa, 0x89, 0x11, 0x23, 0x33, 0x53, 0x23, 0x81, 0xec, 0xcb, 0x9a,
+ 0x08, 0x10, 0x00, 0x18, 0x31, 0x02, 0xfb, 0xcd, 0x8a, 0x30, 0x44, 0x43, 0x22, 0x43, 0x33, 0x12,
+ 0xa8, 0x9b, 0x30, 0x57, 0x33, 0x33, 0x33, 0x34, 0x02, 0xb8, 0xae, 0x9a, 0x31, 0x45, 0x34, 0x43,
+ 0x34, 0x33, 0x13, 0x01, 0x10, 0x33, 0x46, 0x32, 0x24, 0x32, 0x22, 0x02, 0xa9, 0x9a, 0x28, 0x55,
+ 0x34, 0x35, 0x43, 0x32, 0x11, 0x88, 0x9a, 0x8a, 0x20, 0x44, 0x45, 0x43, 0x33, 0x13, 0x91, 0xb9,
+ 0xcb, 0xbb, 0xbb, 0x9b, 0x08, 0x01, 0xc9, 0xdd, 0xbc, 0xbb, 0x9a, 0x09, 0x42, 0x45, 0x23, 0x02,
+ 0xca, 0xdd, 0xcb, 0xbc, 0xbb, 0xab, 0x99, 0x88, 0x98, 0xba, 0xcd, 0xcb, 0xbc, 0xcb, 0x9a, 0x08,
+ 0x11, 0x11, 0x98, 0xdb, 0xeb, 0xdb, 0xac, 0xbb, 0x9a, 0x89, 0x98, 0xba, 0xcc, 0xdb, 0xcb, 0xcb,
+ 0xaa, 0x89, 0x21, 0x22, 0x12, 0x90, 0xea, 0xdc, 0xbd, 0xcb, 0x9a, 0x89, 0x88, 0x80, 0x08, 0xa8,
+ 0xdf, 0xca, 0x27, 0x00, 0xdd, 0xbc, 0xbb, 0x9a, 0x88, 0x88, 0x80, 0x00, 0xb9, 0xde, 0xbd, 0xab,
+ 0x88, 0x22, 0x34, 0x43, 0x33, 0x13, 0xe8, 0xdc, 0xcb, 0x9a, 0x89, 0x10, 0x21, 0x35, 0x35, 0x22,
+ 0x01, 0x00, 0x31, 0x45, 0x34, 0x43, 0x34, 0x33, 0x22, 0x98, 0xbb, 0x9c, 0x08, 0x43, 0x54, 0x44,
+ 0x34, 0x43, 0x12, 0x01, 0x10, 0x32, 0x43, 0x34, 0x44, 0x43, 0x33, 0x02, 0x90, 0xaa, 0x9a, 0x89,
+ 0x08, 0x62, 0x45, 0x34, 0x22, 0x81, 0x88, 0x08, 0x11, 0x21, 0x53, 0x55, 0x43, 0x22, 0x98, 0xca,
+ 0xac, 0xbb, 0xca, 0x9a, 0x19, 0x53, 0x23, 0x82, 0xba, 0xbc, 0xbb, 0xcb, 0xab, 0x18, 0x46, 0x34,
+ 0x12, 0xc9, 0xcb, 0xac, 0xbb, 0xac, 0x8a, 0x20, 0x34, 0x23, 0xc8, 0xdc, 0xcb, 0xbb, 0xac, 0x9b,
+ 0x18, 0x43, 0x34, 0x12, 0x88, 0xa9, 0xbb, 0xbd, 0xba, 0x19, 0x43, 0x24, 0xb8, 0xee, 0xdb, 0xcb,
+ 0xbb, 0xbb, 0x9a, 0x10, 0x33, 0x25, 0x02, 0x81, 0xa8, 0xca, 0xbb, 0x9a, 0x20, 0x33, 0xa1, 0xdf,
+ 0xdd, 0xcb, 0xbc, 0xac, 0xaa, 0x09, 0x00, 0x22, 0x23, 0x22, 0x00, 0xa9, 0xbb, 0x8a, 0x41, 0x35,
+ 0x23, 0x82, 0xeb, 0xce, 0xbd, 0xad, 0xaa, 0x99, 0x00, 0x12, 0x33, 0x34, 0x13, 0x80, 0xba, 0x8a,
+ 0x63, 0x54, 0x32, 0x33, 0x43, 0x02, 0xb8, 0xbf, 0xbc, 0x89, 0x18, 0x21, 0x22, 0x44, 0x24, 0x13,
+ 0x90, 0x8a, 0x41, 0x47, 0x43, 0x23, 0x43, 0x32, 0x12, 0xa0, 0xcc, 0xaa, 0x09, 0x21, 0x32, 0x43,
+ 0x35, 0x35, 0x22, 0x00, 0x08, 0x52, 0x35, 0x34, 0x23, 0x23, 0x33, 0x01, 0xc9, 0xbd, 0xab, 0x10,
+ 0x53, 0x33, 0x34, 0x34, 0x24, 0x02, 0x98, 0x9a, 0x19, 0x42, 0x43, 0x22, 0x11, 0x11, 0x90, 0xec,
+ 0xbc, 0x9a, 0x28, 0x63, 0x33, 0x23, 0x23, 0x01, 0xc9, 0xcd, 0xcc, 0xaa, 0x89, 0x08, 0x08, 0x98,
+ 0x13, 0x22, 0x21, 0x00, 0x99, 0xba, 0xcc, 0xbb, 0xab, 0x10, 0x34, 0x24, 0xa8, 0xdc, 0xcc, 0xcb,
+ 0xbc, 0xbc, 0xbb, 0x9a, 0x89, 0xaa, 0xcc, 0xac, 0xaa, 0x99, 0xba, 0xbd, 0x9a, 0x18, 0x90, 0xdd,
+ 0xbd, 0xaa, 0x99, 0xca, 0xdc, 0xbb, 0xab, 0xca, 0xdc, 0xcb, 0x9b, 0x89, 0x80, 0x98, 0x99, 0x28,
+ 0x44, 0x11, 0xb9, 0x9a, 0x53, 0x24, 0xc8, 0xde, 0xbb, 0xac, 0xbc, 0xbd, 0xbb, 0x09, 0x31, 0x33,
+ 0x32, 0x44, 0x35, 0x24, 0x12, 0x11, 0x32, 0x25, 0x82, 0xdc, 0xbc, 0xbc, 0xac, 0xac, 0xab, 0x09,
+ 0x52, 0x43, 0x33, 0x42, 0x33, 0x25, 0x23, 0x11, 0x21, 0x24, 0x02, 0xca, 0xce, 0xbb, 0xcb, 0xba,
+ 0xab, 0x09, 0x44, 0x35, 0x33, 0x32, 0x33, 0x34, 0x24, 0x11, 0x22, 0x43, 0x23, 0xa8, 0xde, 0xcb,
+ 0xab, 0xbb, 0xaa, 0x89, 0x53, 0x44, 0x33, 0x12, 0x21, 0x31, 0x33, 0x33, 0x44, 0x44, 0x33, 0x01,
+ 0xda, 0xcc, 0xcb, 0xaa, 0xab, 0x8a, 0x20, 0x34, 0x33, 0x01, 0x88, 0x18, 0x22, 0x44, 0x54, 0x34,
+ 0x25, 0x02, 0xa8, 0xbd, 0xbc, 0xcb, 0xab, 0x9b, 0x08, 0x21, 0x12, 0xa0, 0xab, 0x9a, 0x20, 0x43,
+ 0x46, 0x45, 0x43, 0x11, 0xa9, 0xcc, 0xac, 0xbb, 0xac, 0xaa, 0x88, 0x21, 0x13, 0x90, 0x9a, 0x09,
+ 0x42, 0x43, 0x53, 0x63, 0x33, 0x12, 0xea, 0xcc, 0xbb, 0xbb, 0xab, 0xab, 0x19, 0x53, 0x43, 0x11,
+ 0x88, 0x10, 0x53, 0x23, 0x11, 0x21, 0x33, 0xa2, 0xff, 0xbd, 0xcb, 0xa9, 0x89, 0x99, 0x08, 0x43,
+ 0x44, 0x11, 0x80, 0x00, 0x22, 0x23, 0x91, 0xa9, 0x08, 0xa0, 0xef, 0xcd, 0xab, 0x9a, 0x80, 0x80,
+ 0x18, 0x63, 0x34, 0x13, 0x81, 0x09, 0x31, 0x34, 0x02, 0x98, 0x28, 0x34, 0xc1, 0xde, 0xbb, 0x89,
+ 0x11, 0x12, 0x11, 0x64, 0x44, 0x13, 0x81, 0x08, 0x30, 0x44, 0x12, 0x00, 0x21, 0x34, 0x13, 0xda,
+ 0xb6, 0x09, 0x28, 0x00, 0xab, 0x28, 0x24, 0x22, 0x41, 0x45, 0x25, 0x02, 0xa9, 0x99, 0x10, 0x12,
+ 0x81, 0x08, 0x54, 0x34, 0x02, 0xca, 0xab, 0x09, 0x12, 0xa8, 0xbb, 0x09, 0x82, 0xfe, 0xce, 0xbb,
+ 0x9b, 0x89, 0x08, 0x10, 0x44, 0x25, 0x13, 0x90, 0xbb, 0xbc, 0xcc, 0xcb, 0xbc, 0xbb, 0xbb, 0xcb,
+ 0xbc, 0xbb, 0x9b, 0x28, 0x53, 0x44, 0x43, 0x33, 0x23, 0x98, 0xeb, 0xbd, 0xbc, 0xbb, 0xcb, 0xaa,
+ 0x99, 0x09, 0x10, 0x11, 0x22, 0x54, 0x35, 0x35, 0x23, 0x32, 0x11, 0x91, 0xea, 0xdc, 0xab, 0xab,
+ 0x99, 0x99, 0x09, 0x41, 0x53, 0x33, 0x22, 0x53, 0x44, 0x34, 0x23, 0x22, 0x22, 0x13, 0xb0, 0xed,
+ 0xbb, 0xaa, 0xa9, 0xb9, 0x9b, 0x18, 0x45, 0x33, 0x21, 0x52, 0x55, 0x43, 0x22, 0x12, 0x22, 0x22,
+ 0xa0, 0xdd, 0xcb, 0xab, 0xbb, 0xbc, 0xac, 0x9a, 0x00, 0x01, 0x00, 0x41, 0x45, 0x34, 0x33, 0x21,
+ 0x22, 0x13, 0xc8, 0xce, 0xcb, 0xbb, 0xcb, 0xcb, 0xac, 0x99, 0x08, 0x08, 0x10, 0x41, 0x54, 0x33,
+ 0x24, 0x22, 0x33, 0x14, 0x81, 0xb9, 0xbc, 0xbb, 0xcd, 0xdb, 0xba, 0x99, 0x00, 0x10, 0x31, 0x46,
+ 0x44, 0x24, 0x33, 0x42, 0x32, 0x23, 0x01, 0xa8, 0xca, 0xcb, 0xbc, 0xbd, 0xbb, 0xaa, 0x89, 0x10,
+ 0x32, 0x37, 0x35, 0x34, 0x32, 0x33, 0x22, 0x01, 0xba, 0xce, 0xbc, 0xbc, 0xcc, 0xba, 0xba, 0x9a,
+ 0x99, 0x00, 0x22, 0x44, 0x33, 0x33, 0x33, 0x22, 0xa8, 0xdd, 0xcc, 0xcb, 0xcb, 0xcb, 0xba, 0xab,
+ 0x89, 0x09, 0x00, 0x32, 0x45, 0x24, 0x22, 0x12, 0x21, 0x11, 0xa8, 0xcc, 0xcb, 0x99, 0x99, 0xba,
+ 0x9a, 0x52, 0x36, 0x24, 0x23, 0x53, 0x34, 0x24, 0x12, 0x00, 0x11, 0x23, 0x80, 0xba, 0x0b, 0x63,
+ 0x34, 0x21, 0x21, 0x55, 0x34, 0x23, 0x10, 0x10, 0x43, 0x23, 0xa0, 0xbc, 0x9a, 0x99, 0xfb, 0xcc,
+ 0xf5, 0x06, 0x27, 0x00, 0x8a, 0x18, 0x80, 0x88, 0x18, 0x53, 0x33, 0xa0, 0xbc, 0xab, 0xa9, 0xfb,
+ 0xcd, 0xcb, 0xbb, 0xdb, 0xbc, 0xbc, 0xaa, 0x99, 0x88, 0x80, 0x21, 0x33, 0x24, 0x81, 0xa9, 0xab,
+ 0xa9, 0xb9, 0xcd, 0xcb, 0xcb, 0xcc, 0xdc, 0xbb, 0xbb, 0x9b, 0x09, 0x21, 0x55, 0x53, 0x33, 0x34,
+ 0x34, 0x43, 0x43, 0x33, 0x43, 0x22, 0x02, 0xa8, 0xcc, 0xcc, 0xbb, 0x9c, 0x0a, 0x30, 0x64, 0x53,
+ 0x43, 0x33, 0x43, 0x33, 0x32, 0x12, 0x11, 0x80, 0xba, 0xcd, 0xcc, 0xbb, 0xcb, 0xaa, 0x89, 0x20,
+ 0x63, 0x53, 0x23, 0x24, 0x12, 0x02, 0x81, 0x98, 0xaa, 0xbb, 0xcd, 0xcc, 0xdb, 0xbc, 0xcb, 0xbb,
+ 0xac, 0xaa, 0x99, 0x18, 0x21, 0x32, 0x34, 0x43, 0x22, 0x12, 0x80, 0xb9, 0xdd, 0xcd, 0xbc, 0xbd,
+ 0xbc, 0xcb, 0xaa, 0x9a, 0x08, 0x32, 0x54, 0x33, 0x34, 0x33, 0x23, 0x12, 0x01, 0x89, 0xba, 0xdb,
+ 0xbc, 0xbc, 0xbb, 0x9c, 0x8a, 0x20, 0x54, 0x44, 0x34, 0x34, 0x33, 0x33, 0x33, 0x32, 0x12, 0x12,
+ 0x12, 0x12, 0x81, 0xb9, 0xce, 0xcb, 0xcb, 0xaa, 0x09, 0x31, 0x37, 0x45, 0x33, 0x43, 0x23, 0x22,
+ 0x02, 0x80, 0xaa, 0xcc, 0xbc, 0xbd, 0xbd, 0xbb, 0xac, 0xaa, 0x99, 0x10, 0x42, 0x44, 0x32, 0x22,
+ 0x01, 0xa8, 0xcc, 0xbd, 0xcc, 0xba, 0xbb, 0xcb, 0xba, 0xaa, 0xaa, 0x89, 0x00, 0x21, 0x44, 0x44,
+ 0x32, 0x22, 0x81, 0xa8, 0xcb, 0xcd, 0xbc, 0xbb, 0xac, 0xba, 0xaa, 0xab, 0x09, 0x31, 0x55, 0x44,
+ 0x34, 0x35, 0x34, 0x33, 0x22, 0x02, 0x88, 0xcb, 0xcc, 0xac, 0xab, 0x9b, 0x89, 0x20, 0x63, 0x34,
+ 0x35, 0x34, 0x33, 0x34, 0x23, 0x12, 0x90, 0xb9, 0xeb, 0xcb, 0xbb, 0xac, 0x9a, 0x08, 0x11, 0x33,
+ 0x35, 0x43, 0x23, 0x12, 0x01, 0x80, 0x80, 0x99, 0xdb, 0xbb, 0xcd, 0xbc, 0xcd, 0xcb, 0xba, 0xbb,
+ 0x3f, 0xfd, 0x26, 0x00, 0xba, 0x99, 0x18, 0x31, 0x34, 0x35, 0x43, 0x24, 0x22, 0x80, 0xca, 0xcd,
+ 0xcc, 0xbc, 0xbc, 0xab, 0x9b, 0x08, 0x32, 0x55, 0x43, 0x24, 0x23, 0x22, 0x11, 0x98, 0xc9, 0xcb,
+ 0xcb, 0xbb, 0xab, 0xab, 0x08, 0x41, 0x44, 0x44, 0x43, 0x43, 0x22, 0x22, 0x10, 0x98, 0xa9, 0xcb,
+ 0xbb, 0xab, 0x8a, 0x89, 0x98, 0x98, 0x99, 0xaa, 0xba, 0x0b, 0x73, 0x57, 0x33, 0x43, 0x22, 0x12,
+ 0x91, 0xeb, 0xcc, 0xbc, 0xbb, 0xbc, 0xcb, 0xaa, 0x09, 0x20, 0x53, 0x34, 0x35, 0x34, 0x33, 0x02,
+ 0x98, 0xcc, 0xcc, 0xbc, 0xcb, 0xaa, 0x89, 0x10, 0x42, 0x44, 0x53, 0x32, 0x23, 0x22, 0x11, 0x98,
+ 0xc9, 0xdb, 0xcb, 0xbb, 0xcb, 0x9a, 0x99, 0x20, 0x53, 0x34, 0x34, 0x34, 0x32, 0x22, 0x01, 0x98,
+ 0xaa, 0xcb, 0xcb, 0xcb, 0xba, 0xbc, 0xdb, 0xbb, 0xcb, 0xab, 0x9a, 0x09, 0x31, 0x54, 0x43, 0x24,
+ 0x22, 0x12, 0x80, 0xca, 0xcd, 0xdb, 0xbc, 0xcb, 0xcb, 0xbb, 0xab, 0x9a, 0x09, 0x20, 0x53, 0x34,
+ 0x43, 0x22, 0x01, 0xa8, 0xdb, 0xbd, 0xbc, 0xac, 0xab, 0x9b, 0x9a, 0x08, 0x21, 0x53, 0x34, 0x35,
+ 0x43, 0x33, 0x24, 0x22, 0x12, 0x00, 0x88, 0x89, 0x89, 0x30, 0x54, 0x45, 0x53, 0x43, 0x34, 0x43,
+ 0x43, 0x43, 0x33, 0x43, 0x32, 0x33, 0x23, 0x12, 0x11, 0x00, 0x88, 0x00, 0x20, 0x54, 0x53, 0x34,
+ 0x34, 0x44, 0x32, 0x43, 0x22, 0x22, 0x01, 0xa9, 0xdc, 0xbd, 0xbd, 0xbc, 0xbc, 0xbb, 0xac, 0xaa,
+ 0x9a, 0x8a, 0x89, 0x89, 0x99, 0xca, 0xcc, 0xcc, 0xdb, 0xbc, 0xdb, 0xcb, 0xbb, 0xac, 0xbb, 0xbb,
+ 0xaa, 0x9a, 0x89, 0x00, 0x10, 0x12, 0x21, 0x10, 0x98, 0xca, 0xdb, 0xbc, 0xcb, 0xbb, 0xbb, 0x99,
+ 0x41, 0x55, 0x54, 0x53, 0x53, 0x33, 0x44, 0x32, 0x33, 0x24, 0x23, 0x23, 0x33, 0x33, 0x43, 0x33,
+ 0x9c, 0x06, 0x22, 0x00, 0x34, 0x44, 0x53, 0x33, 0x35, 0x34, 0x33, 0x24, 0x33, 0x22, 0x22, 0x11,
+ 0x00, 0x88, 0xa9, 0xaa, 0xab, 0xaa, 0x88, 0x21, 0x43, 0x12, 0xb9, 0xff, 0xdb, 0xdb, 0xcb, 0xbc,
+ 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xba, 0xbb, 0xcb, 0xbb, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb,
+ 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbb, 0xbb, 0xba, 0xbc, 0xbc, 0xbe, 0xbc, 0xcb, 0xaa, 0x9a, 0x00,
+ 0x32, 0x34, 0x43, 0x33, 0x34, 0x43, 0x44, 0x33, 0x34, 0x33, 0x33, 0x34, 0x53, 0x54, 0x43, 0x44,
+ 0x33, 0x43, 0x23, 0x33, 0x33, 0x43, 0x43, 0x34, 0x43, 0x33, 0x33, 0x34, 0x43, 0x34, 0x34, 0x34,
+ 0x33, 0x33, 0x12, 0x01, 0x88, 0x00, 0x21, 0x53, 0x34, 0x23, 0x12, 0x91, 0x99, 0xba, 0xca, 0xdb,
+ 0xcd, 0xcd, 0xbd, 0xcc, 0xca, 0xaa, 0xaa, 0x99, 0xa9, 0xb9, 0xdb, 0xbc, 0xcc, 0xbb, 0xbc, 0xcb,
+ 0xbb, 0xbd, 0xcb, 0xbb, 0xac, 0xaa, 0x9a, 0x89, 0x89, 0xa8, 0xca, 0xdb, 0xac, 0xac, 0xaa, 0xaa,
+ 0xaa, 0x9a, 0x9b, 0xaa, 0x00, 0x54, 0x45, 0x34, 0x24, 0x33, 0x22, 0x01, 0x11, 0x31, 0x45, 0x44,
+ 0x43, 0x43, 0x33, 0x34, 0x43, 0x34, 0x43, 0x43, 0x33, 0x23, 0x23, 0x21, 0x22, 0x43, 0x44, 0x34,
+ 0x44, 0x32, 0x33, 0x32, 0x22, 0x23, 0x43, 0x32, 0x22, 0x81, 0xa9, 0xbd, 0xac, 0x9a, 0x18, 0x42,
+ 0x24, 0x02, 0xc9, 0xdd, 0xdb, 0xcb, 0xbb, 0xcb, 0xcb, 0xcb, 0xbc, 0xdb, 0xba, 0xab, 0xaa, 0xaa,
+ 0xaa, 0xdb, 0xbc, 0xcd, 0xbb, 0xbc, 0xba, 0xbb, 0xba, 0xbc, 0xcb, 0xcb, 0xbb, 0xab, 0x99, 0x08,
+ 0x00, 0x98, 0xda, 0xdb, 0xbb, 0xaa, 0x20, 0x73, 0x43, 0x23, 0x23, 0x22, 0x31, 0x45, 0x44, 0x44,
+ 0x43, 0x32, 0x32, 0x32, 0x33, 0x45, 0x53, 0x53, 0x32, 0x33, 0x33, 0x12, 0x22, 0x33, 0x54, 0x43,
+ 0x76, 0x26, 0x31, 0x00, 0x33, 0x33, 0x23, 0x23, 0x42, 0x34, 0x35, 0x34, 0x22, 0x02, 0xa9, 0xdb,
+ 0xbb, 0x9c, 0x8a, 0x88, 0x98, 0xc9, 0xcc, 0xcc, 0xba, 0xaa, 0xaa, 0xb9, 0xdc, 0xdc, 0xbc, 0xbd,
+ 0xbb, 0xbb, 0xab, 0xaa, 0xba, 0xca, 0xbc, 0xbc, 0xac, 0xab, 0xa9, 0xaa, 0xcb, 0xdc, 0xdb, 0xbb,
+ 0xbb, 0xab, 0x88, 0x20, 0x22, 0x22, 0x01, 0x88, 0x00, 0x52, 0x45, 0x43, 0x23, 0x11, 0x88, 0x89,
+ 0x30, 0x57, 0x45, 0x43, 0x24, 0x33, 0x22, 0x23, 0x32, 0x43, 0x34, 0x34, 0x33, 0x22, 0x22, 0x22,
+ 0x43, 0x45, 0x44, 0x43, 0x32, 0x23, 0x11, 0x81, 0x00, 0x00, 0x11, 0x22, 0x01, 0xa8, 0xdc, 0xbb,
+ 0xbb, 0x08, 0x43, 0x34, 0x03, 0xd9, 0xce, 0xbd, 0xcb, 0xbb, 0xbb, 0xbb, 0xbc, 0xdb, 0xcb, 0xcb,
+ 0xba, 0x9a, 0x9a, 0x98, 0xba, 0xcc, 0xdc, 0xbb, 0xbc, 0xbb, 0xba, 0x9a, 0xaa, 0xbb, 0xbc, 0xcb,
+ 0x9a, 0x09, 0x21, 0x34, 0x23, 0x82, 0xb9, 0xbd, 0xac, 0x09, 0x41, 0x44, 0x34, 0x32, 0x33, 0x43,
+ 0x54, 0x53, 0x34, 0x34, 0x43, 0x32, 0x12, 0x12, 0x11, 0x32, 0x43, 0x34, 0x34, 0x32, 0x22, 0x33,
+ 0x63, 0x53, 0x34, 0x34, 0x43, 0x22, 0x02, 0x81, 0x98, 0x99, 0x99, 0x99, 0xaa, 0xcb, 0xbc, 0xbc,
+ 0xab, 0x08, 0x52, 0x34, 0x24, 0x81, 0xd9, 0xdc, 0xbc, 0xbc, 0xac, 0xbb, 0xbb, 0xbc, 0xbc, 0xca,
+ 0xaa, 0x99, 0x88, 0x10, 0x01, 0x90, 0xdb, 0xcd, 0xbc, 0xbc, 0xac, 0xaa, 0xab, 0xaa, 0xab, 0xab,
+ 0x99, 0x20, 0x54, 0x34, 0x25, 0x13, 0x02, 0x90, 0xba, 0xbb, 0xaa, 0x89, 0x21, 0x43, 0x34, 0x44,
+ 0x35, 0x45, 0x34, 0x35, 0x33, 0x43, 0x12, 0x11, 0x00, 0x00, 0x00, 0x31, 0x43, 0x43, 0x33, 0x34,
+ 0x44, 0x43, 0x34, 0x34, 0x33, 0x24, 0x11, 0x80, 0x98, 0x9a, 0x9a, 0x88, 0x10, 0x31, 0x32, 0x33,
+ 0x1a, 0x08, 0x0b, 0x00, 0x34, 0x34, 0x25, 0x13, 0x91, 0xec, 0xcc, 0xbd, 0xbc, 0xbb, 0xac, 0x9a,
+ 0x8a, 0x89, 0x88, 0x98, 0xa9, 0xcb, 0xbd, 0xcd, 0xcb, 0xbc, 0xcc, 0xbb, 0xcb, 0xab, 0x9b, 0x9a,
+ 0x08, 0x21, 0x32, 0x23, 0x01, 0xd9, 0xcd, 0xcc, 0xcb, 0xac, 0xcb, 0xaa, 0xaa, 0x9a, 0x08, 0x42,
+ 0x44, 0x44, 0x33, 0x43, 0x22, 0x00, 0xa8, 0xcb, 0xdb, 0xbb, 0xbb, 0xaa, 0x8a, 0x21, 0x64, 0x44,
+ 0x44, 0x43, 0x24, 0x33, 0x22, 0x01, 0x98, 0xba, 0xcc, 0xbb, 0xac, 0xaa, 0x99, 0x00, 0x42, 0x45,
+ 0x44, 0x34, 0x43, 0x23, 0x13, 0x81, 0xa9, 0xcc, 0xbc, 0xcb, 0xac, 0xba, 0xaa, 0x99, 0x08, 0x31,
+ 0x45, 0x44, 0x33, 0x24, 0x12, 0x80, 0xb9, 0xcd, 0xdb, 0xbb, 0xcb, 0xbb, 0xba, 0xaa, 0x89, 0x20,
+ 0x54, 0x53, 0x43, 0x33, 0x22, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xbc, 0xbb, 0xab, 0xab, 0x89, 0x31,
+ 0x46, 0x44, 0x43, 0x33, 0x33, 0x22, 0x81, 0xa8, 0xbc, 0xbc, 0xbc, 0xbc, 0xba, 0xab, 0x89, 0x30,
+ 0x45, 0x45, 0x43, 0x43, 0x32, 0x21, 0x01, 0x88, 0xba, 0xcb, 0xcb, 0xac, 0xbb, 0xac, 0xaa, 0x88,
+ 0x41, 0x44, 0x34, 0x34, 0x33, 0x13, 0x80, 0xb9, 0xdb, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xac, 0xaa,
+ 0x08, 0x41, 0x44, 0x43, 0x22, 0x02, 0xa9, 0xdb, 0xcb, 0xab, 0xaa, 0x89, 0x89, 0xaa, 0xcc, 0xcb,
+ 0xaa, 0x08, 0x52, 0x34, 0x34, 0x12, 0xa8, 0xdb, 0xcb, 0x9a, 0x10, 0x44, 0x34, 0x32, 0x01, 0xa8,
+ 0xcb, 0xab, 0x19, 0x63, 0x34, 0x24, 0x02, 0xa0, 0xba, 0xab, 0x20, 0x57, 0x53, 0x33, 0x23, 0x01,
+ 0xa8, 0xbb, 0xbb, 0x8a, 0x21, 0x32, 0xa1, 0xed, 0xdc, 0xab, 0xab, 0x18, 0x63, 0x34, 0x34, 0x23,
+ 0x02, 0xa8, 0xcc, 0xdb, 0xbc, 0xcb, 0xcb, 0xba, 0xab, 0xaa, 0x88, 0x31, 0x45, 0x53, 0x33, 0x43,
+ 0x5b, 0x00, 0x1a, 0x00, 0x01, 0xa8, 0xdc, 0xbc, 0xcd, 0xba, 0xab, 0x99, 0x11, 0x34, 0x36, 0x33,
+ 0x24, 0x22, 0x01, 0x80, 0x99, 0xaa, 0xcc, 0xbc, 0xbd, 0xbb, 0x9b, 0x28, 0x46, 0x45, 0x24, 0x33,
+ 0x22, 0x80, 0xa9, 0xcc, 0xba, 0xaa, 0x89, 0x08, 0x01, 0x00, 0x10, 0x42, 0x46, 0x45, 0x33, 0x24,
+ 0x82, 0xb8, 0xcd, 0xbc, 0xac, 0x8a, 0x08, 0x31, 0x43, 0x22, 0x02, 0x88, 0x9a, 0x99, 0x00, 0x12,
+ 0xa0, 0xdf, 0xdc, 0xcb, 0xbb, 0x8a, 0x20, 0x35, 0x35, 0x22, 0x01, 0xb9, 0xcd, 0xab, 0xab, 0x89,
+ 0x18, 0x12, 0x01, 0x99, 0xaa, 0x19, 0x64, 0x45, 0x43, 0x23, 0x80, 0xcb, 0xbe, 0xac, 0x9b, 0x08,
+ 0x32, 0x45, 0x33, 0x23, 0x11, 0x08, 0x89, 0x08, 0x11, 0x11, 0xa8, 0xdd, 0xcc, 0xbb, 0x9a, 0x31,
+ 0x47, 0x34, 0x43, 0x22, 0x00, 0xa9, 0xcb, 0xbb, 0xab, 0x99, 0x00, 0x10, 0x00, 0x80, 0x21, 0x54,
+ 0x35, 0x35, 0x23, 0x81, 0xca, 0xcd, 0xbc, 0xac, 0xa9, 0x08, 0x22, 0x33, 0x34, 0x12, 0x01, 0xa9,
+ 0xca, 0xcc, 0xcb, 0xcb, 0xcb, 0xba, 0xaa, 0x08, 0x42, 0x54, 0x33, 0x34, 0x12, 0x80, 0xca, 0xbd,
+ 0xbd, 0xcb, 0xab, 0x9b, 0x09, 0x32, 0x55, 0x34, 0x34, 0x33, 0x22, 0x00, 0xaa, 0xcd, 0xbc, 0xcb,
+ 0xbb, 0xaa, 0x99, 0x21, 0x45, 0x54, 0x43, 0x33, 0x33, 0x13, 0x90, 0xdb, 0xcc, 0xbc, 0xbb, 0xab,
+ 0x8a, 0x18, 0x43, 0x35, 0x44, 0x43, 0x33, 0x32, 0x12, 0xa0, 0xeb, 0xcc, 0xbc, 0xcb, 0xaa, 0x99,
+ 0x10, 0x43, 0x34, 0x34, 0x24, 0x22, 0x12, 0x81, 0xa9, 0xeb, 0xcc, 0xcb, 0xbb, 0xac, 0x99, 0x18,
+ 0x52, 0x43, 0x34, 0x33, 0x23, 0x11, 0xa8, 0xca, 0xcc, 0xcb, 0xbb, 0xbc, 0xab, 0x9a, 0x18, 0x53,
+ 0x45, 0x43, 0x33, 0x33, 0x11, 0x98, 0xcb, 0xbd, 0xbc, 0xbb, 0xbb, 0x9a, 0x09, 0x21, 0x44, 0x35,
+ 0xf3, 0xfe, 0x26, 0x00, 0x44, 0x23, 0x23, 0x01, 0xa9, 0xcc, 0xcc, 0xab, 0xbb, 0x9a, 0x09, 0x21,
+ 0x43, 0x44, 0x33, 0x34, 0x33, 0x23, 0x02, 0xb9, 0xcd, 0xcc, 0xcb, 0xab, 0x9a, 0x08, 0x21, 0x34,
+ 0x44, 0x23, 0x33, 0x12, 0x11, 0x98, 0xcb, 0xbd, 0xcc, 0xbb, 0xbb, 0x9b, 0x08, 0x43, 0x45, 0x33,
+ 0x24, 0x22, 0x81, 0xa9, 0xdb, 0xdb, 0xbb, 0xbb, 0xab, 0x99, 0x20, 0x53, 0x44, 0x34, 0x33, 0x23,
+ 0x81, 0xb9, 0xcd, 0xbd, 0xcb, 0xbb, 0xaa, 0x08, 0x41, 0x44, 0x53, 0x33, 0x23, 0x22, 0x80, 0xba,
+ 0xbe, 0xbd, 0xcb, 0xbb, 0x9a, 0x89, 0x31, 0x55, 0x53, 0x43, 0x23, 0x23, 0x02, 0xa8, 0xcc, 0xcc,
+ 0xcb, 0xba, 0xaa, 0x98, 0x11, 0x53, 0x53, 0x43, 0x24, 0x33, 0x22, 0x01, 0xb8, 0xcd, 0xcc, 0xcb,
+ 0xbb, 0xaa, 0x89, 0x20, 0x44, 0x34, 0x34, 0x33, 0x33, 0x22, 0x80, 0xc9, 0xdc, 0xbc, 0xcc, 0xbb,
+ 0xba, 0x99, 0x10, 0x63, 0x34, 0x34, 0x33, 0x33, 0x11, 0x98, 0xda, 0xdb, 0xdb, 0xca, 0xaa, 0xab,
+ 0x99, 0x10, 0x43, 0x45, 0x34, 0x33, 0x33, 0x12, 0x98, 0xbc, 0xcd, 0xbb, 0xac, 0xab, 0x9a, 0x09,
+ 0x20, 0x44, 0x44, 0x43, 0x33, 0x33, 0x22, 0x98, 0xdb, 0xcc, 0xbc, 0xba, 0xab, 0x89, 0x10, 0x42,
+ 0x53, 0x33, 0x34, 0x33, 0x23, 0x02, 0xa8, 0xeb, 0xcc, 0xcb, 0xab, 0xab, 0x89, 0x20, 0x53, 0x53,
+ 0x33, 0x32, 0x13, 0x11, 0x98, 0xbb, 0xbe, 0xbc, 0xbc, 0xcb, 0x9a, 0x09, 0x30, 0x63, 0x34, 0x43,
+ 0x22, 0x02, 0x90, 0xba, 0xbd, 0xcc, 0xaa, 0xab, 0x89, 0x08, 0x32, 0x54, 0x43, 0x33, 0x43, 0x11,
+ 0x91, 0xba, 0xbe, 0xbd, 0xbb, 0xab, 0x8a, 0x20, 0x54, 0x43, 0x24, 0x33, 0x22, 0x01, 0xa9, 0xeb,
+ 0xdb, 0xcb, 0xba, 0xaa, 0x8a, 0x20, 0x44, 0x44, 0x43, 0x33, 0x32, 0x01, 0xa9, 0xeb, 0xbc, 0xbc,
+ 0xac, 0xfe, 0x21, 0x00, 0xbb, 0x9a, 0x09, 0x22, 0x45, 0x34, 0x25, 0x33, 0x23, 0x12, 0x98, 0xdb,
+ 0xbd, 0xbd, 0xbb, 0xac, 0x9a, 0x88, 0x31, 0x54, 0x43, 0x43, 0x33, 0x33, 0x22, 0x80, 0xda, 0xcc,
+ 0xcc, 0xbb, 0xac, 0xab, 0x99, 0x10, 0x34, 0x36, 0x34, 0x34, 0x33, 0x22, 0x81, 0xb9, 0xcd, 0xcc,
+ 0xac, 0xac, 0xaa, 0x99, 0x18, 0x42, 0x44, 0x34, 0x34, 0x32, 0x13, 0x81, 0xb9, 0xdc, 0xcc, 0xbb,
+ 0xac, 0xab, 0x99, 0x10, 0x43, 0x45, 0x43, 0x43, 0x32, 0x11, 0x81, 0xba, 0xcd, 0xbc, 0xcb, 0xab,
+ 0x9b, 0x89, 0x21, 0x44, 0x44, 0x43, 0x23, 0x23, 0x02, 0x98, 0xdb, 0xcc, 0xac, 0xbb, 0xab, 0x8a,
+ 0x18, 0x43, 0x44, 0x34, 0x33, 0x24, 0x12, 0x80, 0xba, 0xcd, 0xbc, 0xcb, 0xaa, 0x99, 0x10, 0x32,
+ 0x35, 0x34, 0x34, 0x22, 0x12, 0x88, 0xc9, 0xcc, 0xbc, 0xac, 0x9b, 0x89, 0x21, 0x53, 0x53, 0x23,
+ 0x33, 0x11, 0x80, 0xa9, 0xcc, 0xdb, 0xcb, 0xbb, 0xaa, 0x09, 0x42, 0x54, 0x33, 0x34, 0x22, 0x01,
+ 0xa8, 0xcc, 0xbb, 0xbc, 0xba, 0xab, 0x9b, 0x18, 0x54, 0x44, 0x43, 0x32, 0x22, 0x00, 0xca, 0xcc,
+ 0xbc, 0xaa, 0x99, 0x80, 0x01, 0x32, 0x54, 0x43, 0x33, 0x22, 0x01, 0xb8, 0xdc, 0xcd, 0xcb, 0xaa,
+ 0x09, 0x21, 0x53, 0x33, 0x43, 0x33, 0x33, 0x01, 0xa9, 0xcc, 0xcc, 0xdb, 0xcb, 0xbb, 0x9a, 0x21,
+ 0x54, 0x33, 0x34, 0x33, 0x33, 0x12, 0xa8, 0xbc, 0xbd, 0xbc, 0xcc, 0xbb, 0xac, 0x89, 0x31, 0x44,
+ 0x24, 0x43, 0x32, 0x22, 0x02, 0x98, 0xbb, 0xcc, 0xbb, 0xcd, 0xcb, 0xab, 0x8a, 0x20, 0x33, 0x35,
+ 0x44, 0x33, 0x24, 0x12, 0x80, 0x98, 0x99, 0xdb, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x20, 0x41, 0x44,
+ 0x34, 0x24, 0x13, 0x11, 0x00, 0x88, 0xda, 0xcc, 0xbc, 0xac, 0xaa, 0x89, 0x88, 0x21, 0x35, 0x26,
+ 0x42, 0x01, 0x30, 0x00, 0x32, 0x11, 0x80, 0x88, 0xba, 0xdd, 0xcb, 0xbb, 0xaa, 0x89, 0x00, 0x31,
+ 0x36, 0x36, 0x33, 0x22, 0x80, 0xa8, 0xca, 0xdb, 0xcb, 0xbb, 0x9a, 0x18, 0x42, 0x43, 0x34, 0x35,
+ 0x34, 0x23, 0x81, 0xa9, 0xbd, 0xcb, 0xac, 0xbb, 0x99, 0x20, 0x44, 0x53, 0x32, 0x43, 0x32, 0x33,
+ 0x82, 0xc9, 0xcd, 0xdb, 0xba, 0xab, 0x9b, 0x09, 0x42, 0x53, 0x23, 0x23, 0x22, 0x21, 0x01, 0xca,
+ 0xdd, 0xcc, 0xbb, 0xbb, 0xab, 0x99, 0x20, 0x44, 0x24, 0x13, 0x01, 0x08, 0x89, 0xa8, 0xdb, 0xdc,
+ 0xbb, 0xbb, 0x9a, 0x09, 0x52, 0x54, 0x43, 0x33, 0x11, 0x98, 0x9a, 0x9a, 0x98, 0xa9, 0xaa, 0x19,
+ 0x73, 0x44, 0x44, 0x34, 0x44, 0x23, 0x12, 0x90, 0xcb, 0xba, 0x9b, 0x9a, 0x99, 0x10, 0x53, 0x35,
+ 0x35, 0x43, 0x53, 0x32, 0x12, 0xb0, 0xec, 0xbb, 0xbc, 0xaa, 0xaa, 0x89, 0x00, 0x31, 0x33, 0x24,
+ 0x33, 0x44, 0x12, 0xc0, 0xed, 0xdb, 0xbb, 0xab, 0x9b, 0x8a, 0x08, 0x22, 0x33, 0x32, 0x21, 0x21,
+ 0x23, 0x82, 0xee, 0xcd, 0xcb, 0xab, 0x99, 0x10, 0x41, 0x34, 0x34, 0x33, 0x22, 0x10, 0x10, 0x10,
+ 0x98, 0xeb, 0xdb, 0x9a, 0x28, 0x73, 0x34, 0x35, 0x34, 0x23, 0x12, 0x81, 0x99, 0x9a, 0xbb, 0xcb,
+ 0xbc, 0xab, 0x0a, 0x63, 0x45, 0x34, 0x34, 0x33, 0x12, 0x88, 0xcb, 0xcc, 0xbb, 0xbc, 0xbb, 0xcb,
+ 0x9a, 0x09, 0x21, 0x45, 0x43, 0x33, 0x12, 0x91, 0xcb, 0xbe, 0xbc, 0xbc, 0xba, 0xba, 0xaa, 0x9a,
+ 0x10, 0x53, 0x34, 0x34, 0x23, 0x11, 0x98, 0xcc, 0xbd, 0xbb, 0xbb, 0x9a, 0x99, 0x00, 0x42, 0x45,
+ 0x34, 0x24, 0x33, 0x12, 0x01, 0xa9, 0xcc, 0xbc, 0xaa, 0x09, 0x21, 0x53, 0x53, 0x34, 0x44, 0x32,
+ 0x23, 0x12, 0x80, 0xb9, 0xcd, 0xbc, 0xac, 0x9b, 0x09, 0x20, 0x43, 0x44, 0x44, 0x33, 0x33, 0x22,
+ 0xd2, 0x08, 0x22, 0x00, 0x90, 0xcb, 0xcd, 0xcc, 0xca, 0xaa, 0x99, 0x89, 0x10, 0x42, 0x44, 0x43,
+ 0x33, 0x23, 0x12, 0x90, 0xda, 0xcc, 0xcc, 0xbb, 0xbb, 0xaa, 0x8a, 0x10, 0x53, 0x35, 0x44, 0x32,
+ 0x32, 0x21, 0x88, 0xc9, 0xcc, 0xdb, 0xba, 0xbb, 0x9b, 0x8a, 0x11, 0x44, 0x34, 0x44, 0x32, 0x22,
+ 0x11, 0x88, 0xca, 0xcb, 0xbc, 0xcb, 0xaa, 0x8a, 0x08, 0x31, 0x35, 0x34, 0x24, 0x23, 0x21, 0x80,
+ 0xaa, 0xcb, 0xbb, 0xbb, 0x9a, 0x18, 0x63, 0x53, 0x33, 0x33, 0x02, 0xa0, 0xeb, 0xcc, 0xbb, 0xbb,
+ 0x0a, 0x31, 0x46, 0x44, 0x43, 0x33, 0x22, 0x01, 0xc9, 0xeb, 0xdb, 0xcb, 0xba, 0xaa, 0x0a, 0x20,
+ 0x44, 0x44, 0x33, 0x43, 0x22, 0x81, 0xa9, 0xcc, 0xcc, 0xcb, 0xbb, 0xab, 0x8a, 0x10, 0x53, 0x34,
+ 0x44, 0x32, 0x22, 0x01, 0xa8, 0xcb, 0xbd, 0xbc, 0xac, 0xab, 0x89, 0x10, 0x53, 0x53, 0x33, 0x24,
+ 0x13, 0x01, 0xa0, 0xca, 0xcb, 0xbc, 0xbb, 0xab, 0x89, 0x32, 0x36, 0x45, 0x32, 0x33, 0x22, 0x80,
+ 0xba, 0xcc, 0xcb, 0xbb, 0xbb, 0x9b, 0x18, 0x52, 0x44, 0x34, 0x43, 0x22, 0x02, 0xa8, 0xcc, 0xcb,
+ 0xcb, 0xba, 0xaa, 0x9a, 0x09, 0x32, 0x44, 0x34, 0x25, 0x33, 0x22, 0x80, 0xcb, 0xcc, 0xbb, 0xbc,
+ 0xbb, 0xbb, 0xab, 0x89, 0x20, 0x63, 0x35, 0x45, 0x33, 0x24, 0x12, 0x00, 0x99, 0xaa, 0xbd, 0xcc,
+ 0xbc, 0xbb, 0xac, 0x9a, 0x18, 0x53, 0x45, 0x34, 0x33, 0x33, 0x13, 0x01, 0xa9, 0xcd, 0xcc, 0xcb,
+ 0xcb, 0xba, 0x9a, 0x09, 0x42, 0x54, 0x33, 0x24, 0x23, 0x12, 0x81, 0xb9, 0xcc, 0xcc, 0xbb, 0xbc,
+ 0xbb, 0x8a, 0x18, 0x34, 0x45, 0x33, 0x24, 0x12, 0x01, 0x90, 0xba, 0xcc, 0xbb, 0xac, 0xbb, 0xaa,
+ 0x10, 0x53, 0x44, 0x33, 0x33, 0x12, 0x88, 0xcb, 0xcb, 0xab, 0x9a, 0x00, 0x31, 0x44, 0x44, 0x34,
+ 0x95, 0x02, 0x1f, 0x00, 0x23, 0x02, 0xb8, 0xdd, 0xcc, 0xac, 0xab, 0x99, 0x20, 0x43, 0x44, 0x43,
+ 0x33, 0x23, 0x02, 0x90, 0xdb, 0xdc, 0xdb, 0xbb, 0xbb, 0x9a, 0x08, 0x43, 0x35, 0x34, 0x43, 0x22,
+ 0x11, 0x88, 0xba, 0xcd, 0xcb, 0xbc, 0xba, 0xaa, 0x18, 0x42, 0x44, 0x43, 0x32, 0x23, 0x01, 0xa0,
+ 0xba, 0xbd, 0xbc, 0xac, 0xab, 0x8a, 0x20, 0x54, 0x34, 0x34, 0x33, 0x12, 0x80, 0xca, 0xbc, 0xbc,
+ 0xcb, 0x9a, 0x99, 0x10, 0x53, 0x44, 0x34, 0x33, 0x23, 0x02, 0xb9, 0xdd, 0xdb, 0xba, 0xab, 0xaa,
+ 0x88, 0x21, 0x53, 0x44, 0x43, 0x33, 0x22, 0x01, 0xb9, 0xcd, 0xbd, 0xcb, 0xaa, 0xaa, 0x88, 0x21,
+ 0x52, 0x43, 0x43, 0x33, 0x23, 0x01, 0xa8, 0xfb, 0xcb, 0xac, 0xab, 0xaa, 0x08, 0x21, 0x34, 0x35,
+ 0x33, 0x34, 0x22, 0x02, 0x98, 0xda, 0xbc, 0xbd, 0xba, 0x8a, 0x08, 0x33, 0x36, 0x34, 0x33, 0x24,
+ 0x11, 0x00, 0xb9, 0xeb, 0xcb, 0xbc, 0xbb, 0x9a, 0x10, 0x53, 0x44, 0x43, 0x23, 0x22, 0x01, 0xa8,
+ 0xda, 0xdb, 0xcb, 0xcb, 0xbb, 0xaa, 0x08, 0x41, 0x44, 0x53, 0x32, 0x22, 0x02, 0x90, 0xca, 0xdb,
+ 0xdb, 0xca, 0xaa, 0x9b, 0x8a, 0x20, 0x44, 0x44, 0x33, 0x33, 0x13, 0x81, 0xb9, 0xdc, 0xbb, 0xbd,
+ 0xba, 0xab, 0x8a, 0x30, 0x64, 0x53, 0x33, 0x24, 0x12, 0x00, 0xa9, 0xcc, 0xbb, 0xbc, 0xbb, 0xaa,
+ 0x09, 0x41, 0x54, 0x34, 0x34, 0x32, 0x22, 0x90, 0xca, 0xbd, 0xbd, 0xbb, 0xba, 0x9a, 0x00, 0x42,
+ 0x44, 0x34, 0x34, 0x24, 0x11, 0x90, 0xba, 0xbe, 0xcc, 0xba, 0xaa, 0x9a, 0x00, 0x31, 0x35, 0x35,
+ 0x34, 0x32, 0x22, 0x80, 0xba, 0xce, 0xcb, 0xcb, 0x9a, 0x8a, 0x18, 0x31, 0x34, 0x35, 0x24, 0x23,
+ 0x13, 0x00, 0xb9, 0xcd, 0xbc, 0xcb, 0x9a, 0x89, 0x10, 0x43, 0x34, 0x34, 0x33, 0x23, 0x02, 0x98,
+ 0x47, 0x02, 0x18, 0x00, 0xcd, 0xdb, 0xbb, 0xab, 0x8a, 0x20, 0x54, 0x43, 0x24, 0x23, 0x11, 0x80,
+ 0xb9, 0xcc, 0xbc, 0xbc, 0xcb, 0x9a, 0x89, 0x21, 0x54, 0x43, 0x24, 0x13, 0x12, 0x98, 0xba, 0xcd,
+ 0xbb, 0xad, 0xbb, 0xaa, 0x89, 0x20, 0x44, 0x35, 0x34, 0x33, 0x23, 0x01, 0xb9, 0xcc, 0xbc, 0xbc,
+ 0xcb, 0xaa, 0x9a, 0x18, 0x32, 0x46, 0x53, 0x32, 0x33, 0x12, 0x88, 0xca, 0xdb, 0xcb, 0xbb, 0xac,
+ 0x9a, 0x09, 0x21, 0x54, 0x53, 0x33, 0x43, 0x12, 0x80, 0xb9, 0xcc, 0xbc, 0xcb, 0xab, 0xaa, 0x88,
+ 0x31, 0x54, 0x34, 0x34, 0x24, 0x12, 0x81, 0xb9, 0xcc, 0xbc, 0xbc, 0xab, 0x9b, 0x89, 0x31, 0x45,
+ 0x53, 0x24, 0x33, 0x22, 0x01, 0xa9, 0xcd, 0xcb, 0xbc, 0xba, 0xaa, 0x09, 0x20, 0x53, 0x44, 0x43,
+ 0x33, 0x23, 0x02, 0xa8, 0xcc, 0xcc, 0xbb, 0xac, 0x9a, 0x89, 0x10, 0x33, 0x36, 0x34, 0x33, 0x14,
+ 0x02, 0x98, 0xbc, 0xbd, 0xbc, 0xab, 0x9a, 0x19, 0x31, 0x44, 0x43, 0x24, 0x23, 0x12, 0x80, 0xca,
+ 0xcc, 0xbc, 0xac, 0xaa, 0x88, 0x32, 0x44, 0x34, 0x24, 0x22, 0x02, 0x90, 0xca, 0xcc, 0xbc, 0xcb,
+ 0xbb, 0x99, 0x28, 0x44, 0x35, 0x34, 0x24, 0x12, 0x01, 0xa9, 0xcb, 0xbd, 0xbc, 0xcb, 0xaa, 0x8a,
+ 0x10, 0x63, 0x34, 0x44, 0x32, 0x12, 0x01, 0x99, 0xbc, 0xbd, 0xbc, 0xbb, 0xbb, 0x9a, 0x10, 0x44,
+ 0x54, 0x33, 0x34, 0x22, 0x11, 0x99, 0xbc, 0xbd, 0xcc, 0xaa, 0xaa, 0x89, 0x18, 0x42, 0x44, 0x43,
+ 0x33, 0x23, 0x02, 0x98, 0xcc, 0xbc, 0xcc, 0xaa, 0x9a, 0x89, 0x11, 0x42, 0x53, 0x43, 0x33, 0x32,
+ 0x11, 0xa8, 0xeb, 0xbc, 0xac, 0xbb, 0x9a, 0x08, 0x31, 0x63, 0x43, 0x33, 0x33, 0x22, 0x01, 0xb8,
+ 0xcd, 0xcc, 0xbb, 0xbb, 0x99, 0x28, 0x43, 0x35, 0x24, 0x33, 0x12, 0x01, 0x99, 0xdb, 0xdb, 0xcb,
+ 0x52, 0xff, 0x1d, 0x00, 0xab, 0x99, 0x10, 0x53, 0x44, 0x33, 0x33, 0x11, 0x98, 0xdb, 0xbc, 0xbc,
+ 0xbb, 0xbb, 0x9a, 0x10, 0x54, 0x44, 0x43, 0x33, 0x23, 0x81, 0xc9, 0xcc, 0xbc, 0xac, 0xab, 0x9a,
+ 0x00, 0x31, 0x45, 0x53, 0x33, 0x43, 0x12, 0x01, 0xba, 0xcd, 0xbc, 0xbc, 0xaa, 0x9a, 0x08, 0x32,
+ 0x45, 0x34, 0x43, 0x32, 0x23, 0x00, 0xb8, 0xcd, 0xcc, 0xbb, 0xbb, 0x9b, 0x09, 0x32, 0x45, 0x34,
+ 0x34, 0x23, 0x23, 0x02, 0xa8, 0xdc, 0xdb, 0xcb, 0xbb, 0xaa, 0x0a, 0x20, 0x34, 0x36, 0x43, 0x23,
+ 0x23, 0x11, 0x98, 0xda, 0xbc, 0xbd, 0xac, 0xab, 0x8a, 0x18, 0x43, 0x44, 0x43, 0x32, 0x23, 0x11,
+ 0x90, 0xba, 0xcd, 0xbc, 0xbc, 0xbb, 0x9a, 0x19, 0x41, 0x44, 0x34, 0x33, 0x23, 0x12, 0x80, 0xca,
+ 0xdb, 0xbc, 0xcb, 0xbb, 0xaa, 0x09, 0x31, 0x55, 0x43, 0x33, 0x32, 0x02, 0x80, 0xca, 0xdb, 0xbb,
+ 0xbc, 0xbb, 0xab, 0x09, 0x32, 0x37, 0x44, 0x33, 0x23, 0x12, 0x98, 0xcb, 0xbd, 0xcb, 0xab, 0xab,
+ 0x9a, 0x00, 0x42, 0x35, 0x35, 0x24, 0x23, 0x02, 0x98, 0xdb, 0xbc, 0xbc, 0xba, 0xaa, 0x89, 0x10,
+ 0x42, 0x34, 0x35, 0x34, 0x23, 0x13, 0x90, 0xca, 0xcd, 0xbb, 0xac, 0xaa, 0x99, 0x08, 0x21, 0x43,
+ 0x53, 0x53, 0x32, 0x33, 0x23, 0x80, 0xca, 0xdc, 0xbb, 0xbc, 0xab, 0xaa, 0x9a, 0x80, 0x31, 0x45,
+ 0x44, 0x44, 0x32, 0x33, 0x12, 0x98, 0xcb, 0xcd, 0xcb, 0xbb, 0xbb, 0xba, 0x89, 0x20, 0x45, 0x54,
+ 0x43, 0x33, 0x33, 0x11, 0xa8, 0xfb, 0xcb, 0xcb, 0xab, 0xab, 0x9a, 0x00, 0x42, 0x35, 0x35, 0x34,
+ 0x32, 0x12, 0x90, 0xca, 0xbd, 0xad, 0xbb, 0xab, 0x8a, 0x18, 0x33, 0x46, 0x33, 0x34, 0x23, 0x12,
+ 0x90, 0xdb, 0xcc, 0xcb, 0xba, 0x9a, 0x08, 0x31, 0x53, 0x34, 0x33, 0x33, 0x12, 0x98, 0xdb, 0xcc,
+ 0xfb, 0xff, 0x17, 0x00, 0xcb, 0x9b, 0x8a, 0x21, 0x54, 0x43, 0x43, 0x12, 0x01, 0xa8, 0xdb, 0xbc,
+ 0xbc, 0xab, 0x9b, 0x09, 0x32, 0x47, 0x43, 0x43, 0x32, 0x11, 0x98, 0xdb, 0xcc, 0xcb, 0xba, 0xaa,
+ 0x89, 0x20, 0x53, 0x44, 0x43, 0x33, 0x23, 0x11, 0xa9, 0xdc, 0xbc, 0xbc, 0xbb, 0xab, 0x88, 0x31,
+ 0x54, 0x53, 0x33, 0x33, 0x23, 0x01, 0xb8, 0xdc, 0xbc, 0xbc, 0xbb, 0xab, 0x08, 0x31, 0x54, 0x43,
+ 0x43, 0x22, 0x12, 0x81, 0xa8, 0xdb, 0xdb, 0xbb, 0xbb, 0x9a, 0x08, 0x41, 0x53, 0x33, 0x24, 0x22,
+ 0x01, 0x98, 0xaa, 0xbc, 0xbc, 0xab, 0xab, 0x08, 0x31, 0x45, 0x33, 0x22, 0x90, 0xdb, 0xcc, 0xcb,
+ 0xaa, 0x88, 0x32, 0x45, 0x34, 0x34, 0x32, 0x11, 0xa0, 0xeb, 0xcc, 0xbc, 0xbc, 0xaa, 0x8a, 0x21,
+ 0x54, 0x34, 0x44, 0x22, 0x22, 0x00, 0xa9, 0xcc, 0xcc, 0xbb, 0xbc, 0x9a, 0x89, 0x31, 0x45, 0x34,
+ 0x34, 0x33, 0x22, 0x00, 0xba, 0xdd, 0xcb, 0xcb, 0xab, 0x9a, 0x89, 0x22, 0x45, 0x34, 0x34, 0x23,
+ 0x13, 0x80, 0xc9, 0xeb, 0xcb, 0xbb, 0xcb, 0xa9, 0x08, 0x31, 0x44, 0x44, 0x33, 0x33, 0x22, 0x80,
+ 0xca, 0xdc, 0xbb, 0xbc, 0xbb, 0xaa, 0x08, 0x42, 0x44, 0x34, 0x24, 0x33, 0x12, 0x90, 0xba, 0xbe,
+ 0xbd, 0xbb, 0xbb, 0x9a, 0x18, 0x52, 0x44, 0x43, 0x33, 0x33, 0x12, 0x98, 0xcb, 0xcd, 0xcb, 0xbb,
+ 0xab, 0x99, 0x20, 0x53, 0x44, 0x43, 0x32, 0x13, 0x02, 0x99, 0xbc, 0xbe, 0xcb, 0xbb, 0xaa, 0x89,
+ 0x31, 0x54, 0x43, 0x24, 0x23, 0x22, 0x80, 0xa9, 0xbd, 0xbd, 0xbc, 0xbb, 0x9a, 0x08, 0x41, 0x44,
+ 0x43, 0x43, 0x22, 0x12, 0x90, 0xc9, 0xdb, 0xcb, 0xbb, 0xac, 0x99, 0x08, 0x41, 0x53, 0x43, 0x43,
+ 0x22, 0x11, 0x90, 0xc9, 0xcb, 0xbc, 0xbc, 0xba, 0x9a, 0x18, 0x32, 0x36, 0x44, 0x33, 0x33, 0x12,
+ 0x0c, 0x02, 0x19, 0x00, 0xa8, 0xbc, 0xcd, 0xbb, 0xcb, 0xaa, 0x89, 0x20, 0x43, 0x35, 0x34, 0x24,
+ 0x22, 0x01, 0x98, 0xcb, 0xcc, 0xcb, 0xab, 0xab, 0x99, 0x20, 0x43, 0x35, 0x25, 0x33, 0x23, 0x02,
+ 0x98, 0xbc, 0xcd, 0xbb, 0xbc, 0xaa, 0x89, 0x28, 0x52, 0x53, 0x33, 0x34, 0x22, 0x11, 0x98, 0xdb,
+ 0xbc, 0xbc, 0xac, 0xaa, 0x89, 0x28, 0x42, 0x44, 0x43, 0x23, 0x23, 0x11, 0xa8, 0xcb, 0xcd, 0xbb,
+ 0xac, 0xaa, 0x99, 0x11, 0x53, 0x53, 0x33, 0x24, 0x23, 0x01, 0x98, 0xdb, 0xbc, 0xbc, 0xac, 0xaa,
+ 0x89, 0x20, 0x42, 0x35, 0x43, 0x33, 0x23, 0x12, 0x99, 0xeb, 0xcb, 0xbc, 0xbb, 0xbb, 0x8a, 0x10,
+ 0x63, 0x53, 0x42, 0x32, 0x22, 0x11, 0x98, 0xca, 0xbc, 0xbd, 0xbb, 0xbb, 0x9a, 0x10, 0x53, 0x34,
+ 0x44, 0x32, 0x23, 0x11, 0x88, 0xbb, 0xcd, 0xcb, 0xbb, 0xbb, 0x9a, 0x00, 0x43, 0x44, 0x43, 0x33,
+ 0x23, 0x12, 0x98, 0xbb, 0xcd, 0xcb, 0xbb, 0xaa, 0x9a, 0x18, 0x33, 0x36, 0x34, 0x33, 0x13, 0x02,
+ 0xaa, 0xcb, 0xab, 0xbc, 0xb9, 0xab, 0x99, 0x11, 0x31, 0x33, 0x12, 0x13, 0x11, 0xa9, 0xa0, 0x9a,
+ 0x99, 0x19, 0x21, 0x12, 0x12, 0x11, 0x01, 0xa9, 0xa9, 0xaa, 0xaa, 0xa9, 0x99, 0x10, 0x31, 0x33,
+ 0x53, 0x12, 0x12, 0x99, 0xb9, 0xcb, 0xba, 0xbb, 0xab, 0x99, 0x10, 0x32, 0x33, 0x24, 0x33, 0x33,
+ 0x11, 0x99, 0xcb, 0xbb, 0xeb, 0x99, 0x0a, 0x10, 0x31, 0x53, 0x22, 0x22, 0x13, 0x93, 0x99, 0xcb,
+ 0xba, 0xbc, 0xbb, 0xab, 0x10, 0x43, 0x33, 0x03,
+};
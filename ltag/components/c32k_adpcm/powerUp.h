@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define POWERUP_BITS_PER_SAMPLE 4
+#define POWERUP_SAMPLE_RATE 32000
+#define POWERUP_SAMPLES 40319
+#define POWERUP_BYTES 20456
+
+extern const uint8_t powerUp[POWERUP_BYTES];
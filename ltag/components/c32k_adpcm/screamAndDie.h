@@ -0,0 +1,9 @@
+
+#include <stdint.h>
+
+#define SCREAMANDDIE_BITS_PER_SAMPLE 4
+#define SCREAMANDDIE_SAMPLE_RATE 32000
+#define SCREAMANDDIE_SAMPLES 55678
+#define SCREAMANDDIE_BYTES 28244
+
+extern const uint8_t screamAndDie[SCREAMANDDIE_BYTES];
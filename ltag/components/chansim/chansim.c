@@ -0,0 +1,163 @@
+#include <math.h> // cosf, logf, sqrtf
+#include <string.h> // memset
+
+#include "chansim.h"
+
+#define PI 3.14159265358979323846f
+#define CHUNK 256 // Samples synthesized per pass over the shooters
+#define NEVER UINT64_MAX
+
+// Convert microseconds to samples.
+static uint64_t chansim_samples(const chansim_t *c, uint32_t us)
+{
+	return (uint64_t)us * c->sample_hz / 1000000;
+}
+
+int32_t chansim_init(chansim_t *c, uint32_t sample_hz, uint16_t bits)
+{
+	if (!sample_hz || !bits || bits > 16) return -1;
+	memset(c, 0, sizeof(chansim_t));
+	c->sample_hz = sample_hz;
+	c->bits = bits;
+	c->dc = 0.5f;
+	c->flicker_hz = 120;
+	c->seed = 2463534242U;
+	chansim_reset(c);
+	return 0;
+}
+
+int32_t chansim_addShooter(chansim_t *c, const chansim_shooter_t *s)
+{
+	uint16_t i = c->shooters;
+
+	if (i == CHANSIM_MAX_SHOOTERS || !s->freq_hz || s->freq_hz >= c->sample_hz/2 ||
+		(s->period_us && s->period_us < s->pulse_us)) return -1;
+	c->shooter[i] = *s;
+	c->first[i] = chansim_samples(c, s->start_us);
+	c->plen[i] = chansim_samples(c, s->pulse_us);
+	c->per[i] = chansim_samples(c, s->period_us);
+	c->off[i] = (uint32_t)(s->phase * c->sample_hz) % c->sample_hz;
+	c->shooters++;
+	return i;
+}
+
+void chansim_reset(chansim_t *c)
+{
+	c->n = 0;
+	c->rng = c->seed;
+	c->has_spare = false;
+	c->clipped = 0;
+}
+
+// Find when a shooter next changes state.
+// s: shooter index.
+// n: sample index.
+// on: set to true if the shooter is transmitting at sample n.
+// Returns the index of the next sample with a different state, or NEVER.
+static uint64_t chansim_next(const chansim_t *c, uint16_t s, uint64_t n, bool *on)
+{
+	const chansim_shooter_t *p = &c->shooter[s];
+	uint64_t per = c->per[s], beg, k;
+
+	*on = false;
+	if (n < c->first[s]) return c->first[s];
+	k = per ? (n - c->first[s]) / per : 0;
+	if (p->count && k >= p->count) return NEVER;
+	beg = c->first[s] + k * per;
+	if (n < beg + c->plen[s]) {
+		*on = true;
+		return beg + c->plen[s];
+	}
+	if (!per || (p->count && k+1 >= p->count)) return NEVER;
+	return beg + per;
+}
+
+bool chansim_isOn(const chansim_t *c, uint16_t s, uint64_t n)
+{
+	bool on;
+
+	chansim_next(c, s, n, &on);
+	return on;
+}
+
+// Return a pseudo-random value uniformly distributed in (0.0, 1.0].
+static float chansim_rand(chansim_t *c)
+{
+	uint32_t x = c->rng; // xorshift32
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	c->rng = x;
+	return ((x >> 8) + 1) * (1.0f / 16777216.0f);
+}
+
+// Return a normally distributed value with zero mean and unit variance.
+static float chansim_gauss(chansim_t *c)
+{
+	if (c->has_spare) {
+		c->has_spare = false;
+		return c->spare;
+	}
+	// Box-Muller transform, produces a pair of values
+	float r = sqrtf(-2.0f * logf(chansim_rand(c)));
+	float a = 2.0f * PI * chansim_rand(c);
+	c->spare = r * sinf(a);
+	c->has_spare = true;
+	return r * cosf(a);
+}
+
+uint32_t chansim_generate(uint16_t *buf, uint32_t size, void *ctx)
+{
+	chansim_t *c = (chansim_t *)ctx;
+	const float scale = (float)(1UL << c->bits);
+	const float max = scale - 1.0f;
+	float x[CHUNK];
+
+	if (c->n == 0) c->rng = c->seed; // Seed may have changed since init
+	if (c->length && size > c->length - c->n) size = c->length - c->n;
+	for (uint32_t done = 0, k; done < size; done += k, buf += k) {
+		k = (size - done < CHUNK) ? size - done : CHUNK;
+		for (uint32_t i = 0; i < k; i++) x[i] = c->dc;
+
+		// Flicker is a raised cosine at the flicker rate.
+		if (c->flicker != 0.0f) {
+			uint32_t ph = (c->n * c->flicker_hz) % c->sample_hz;
+			for (uint32_t i = 0; i < k; i++) {
+				x[i] += c->flicker * 0.5f *
+					(1.0f - cosf(2.0f * PI * ph / c->sample_hz));
+				if ((ph += c->flicker_hz) >= c->sample_hz) ph -= c->sample_hz;
+			}
+		}
+
+		// Add each shooter in runs of samples with the same on/off state.
+		for (uint16_t s = 0; s < c->shooters; s++) {
+			const chansim_shooter_t *p = &c->shooter[s];
+			uint32_t i = 0;
+			while (i < k) {
+				bool on;
+				uint64_t next = chansim_next(c, s, c->n + i, &on);
+				uint32_t end = (next - c->n < k) ? next - c->n : k;
+				if (on) {
+					uint32_t ph = (uint32_t)(((c->n + i) * p->freq_hz + c->off[s]) % c->sample_hz);
+					for (; i < end; i++) {
+						x[i] += (ph < c->sample_hz/2) ? p->amp : -p->amp;
+						if ((ph += p->freq_hz) >= c->sample_hz) ph -= c->sample_hz;
+					}
+				}
+				i = end;
+			}
+		}
+
+		// Add noise, then quantize and clip like the ADC.
+		for (uint32_t i = 0; i < k; i++) {
+			float v = x[i];
+			if (c->noise != 0.0f) v += c->noise * chansim_gauss(c);
+			v *= scale;
+			if (v < 0.0f) {v = 0.0f; c->clipped++;}
+			else if (v > max) {v = max; c->clipped++;}
+			buf[i] = (uint16_t)(v + 0.5f);
+		}
+		c->n += k;
+	}
+	return size;
+}
@@ -0,0 +1,86 @@
+#ifndef CHANSIM_H_
+#define CHANSIM_H_
+
+// Synthetic optical channel. Produces the ADC sample stream a receiver
+// would see with several shooters transmitting at once. Each shooter emits
+// a square wave at its channel frequency (like the transmitter) during its
+// pulses, scaled by an amplitude that stands in for range. The stream also
+// has an ambient light level (DC), mains flicker, Gaussian noise, and is
+// quantized and clipped like the ADC. The generator is deterministic for a
+// given seed, so a scenario can be replayed exactly.
+//
+// chansim_generate() has the signature of a receiver sample generator and
+// can feed the filter/detector pipeline directly, for example with
+// rx_host_generator(chansim_generate, &sim).
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Maximum number of shooters
+#define CHANSIM_MAX_SHOOTERS 10
+
+// Shooter parameters. Times are in microseconds from the start of the stream.
+typedef struct {
+	uint16_t freq_hz; // Transmit frequency
+	float amp; // Peak amplitude as a fraction of ADC full scale
+	float phase; // Phase of the square wave in cycles (0.0 to 1.0)
+	uint32_t start_us; // Start of the first pulse
+	uint32_t pulse_us; // Duration of each pulse
+	uint32_t period_us; // Time between pulse starts, zero for one pulse
+	uint16_t count; // Number of pulses, zero for no limit
+} chansim_shooter_t;
+
+typedef struct {
+	uint32_t sample_hz; // Sample rate
+	uint16_t bits; // ADC resolution
+	float dc; // Ambient level (including bias) as a fraction of full scale
+	float flicker; // Peak flicker amplitude as a fraction of full scale
+	uint16_t flicker_hz; // Flicker rate, twice the mains frequency
+	float noise; // Noise standard deviation as a fraction of full scale
+	uint32_t seed; // Noise generator seed, must not be zero
+	uint64_t length; // Samples to generate, zero for no limit
+	// State
+	uint16_t shooters; // Number of shooters
+	chansim_shooter_t shooter[CHANSIM_MAX_SHOOTERS];
+	uint64_t first[CHANSIM_MAX_SHOOTERS]; // First pulse start, in samples
+	uint64_t plen[CHANSIM_MAX_SHOOTERS]; // Pulse length, in samples
+	uint64_t per[CHANSIM_MAX_SHOOTERS]; // Pulse period, in samples
+	uint32_t off[CHANSIM_MAX_SHOOTERS]; // Square wave phase offset
+	uint64_t n; // Index of the next sample
+	uint32_t rng; // Noise generator state
+	float spare; // Second value from the last pair of noise values
+	bool has_spare; // True if spare is valid
+	uint32_t clipped; // Samples clipped to the ADC range
+} chansim_t;
+
+// Initialize the channel with no shooters, an ambient level at mid scale,
+// and no flicker or noise. Other fields may be changed before generating.
+// c: channel data structure.
+// sample_hz: sample rate in Hz.
+// bits: ADC resolution in bits.
+// Return zero if successful, or non-zero otherwise.
+int32_t chansim_init(chansim_t *c, uint32_t sample_hz, uint16_t bits);
+
+// Add a shooter to the channel.
+// s: shooter parameters, copied.
+// Returns the shooter index, or -1 if there is no room or a parameter is
+// out of range.
+int32_t chansim_addShooter(chansim_t *c, const chansim_shooter_t *s);
+
+// Restart the stream from the first sample with the noise generator
+// seeded again. Shooters and parameters are kept.
+void chansim_reset(chansim_t *c);
+
+// Return true if a shooter is transmitting at a sample index.
+// s: shooter index.
+// n: sample index.
+bool chansim_isOn(const chansim_t *c, uint16_t s, uint64_t n);
+
+// Generate the next samples of the stream.
+// buf: buffer to fill with ADC samples.
+// size: capacity of the buffer in samples.
+// ctx: channel data structure (chansim_t *).
+// Returns the number of samples produced, zero at the end of the stream.
+uint32_t chansim_generate(uint16_t *buf, uint32_t size, void *ctx);
+
+#endif // CHANSIM_H_
@@ -0,0 +1,215 @@
+#include <math.h> // cosf, sinf
+#include <stdlib.h> // calloc, free, abort
+#include <string.h> // memset
+
+#include "mfilter.h"
+
+#define PI 3.14159265358979323846
+#define EPS 1.0e-20f // Keeps the quality finite when the floor is zero
+#define FLOOR_CLAMP 4.0f // Limit on floor growth from a single update
+
+// Allocate a zeroed array of n elements, abort if out of memory.
+static mfilter_data_t *mfilter_alloc(uint32_t n)
+{
+	mfilter_data_t *p = calloc(n, sizeof(mfilter_data_t));
+	if (p == NULL) abort();
+	return p;
+}
+
+// Initialize the matched filter. Allocate memory for the per-channel state.
+// If malloc() fails, abort() is called to print an error message and
+// terminate.
+// m: matched filter data structure.
+// freq_hz: array of channel frequencies in Hz.
+// chans: number of channels.
+// sample_hz: sample rate of the (decimated) input stream in Hz.
+// code: chip pattern, one bit per chip, sent most significant chip first.
+// chips: number of chips in the code (up to MFILTER_MAX_CHIPS).
+// chip_us: chip duration in microseconds.
+// Return zero if successful, or non-zero otherwise.
+int32_t mfilter_init(mfilter_t *m, const uint16_t freq_hz[], uint16_t chans,
+	uint32_t sample_hz, uint32_t code, uint16_t chips, uint32_t chip_us)
+{
+	uint16_t n_on = 0;
+
+	if (!chans || !chips || chips > MFILTER_MAX_CHIPS) return -1;
+	m->chip_len = (uint64_t)sample_hz * chip_us / 1000000;
+	if (m->chip_len < MFILTER_HOPS) return -1;
+	for (uint16_t k = 0; k < chips; k++)
+		if (code & (1UL << k)) n_on++;
+	if (!n_on) return -1;
+
+	// Chip k is the k-th chip sent. Zero chips are only weighted if the
+	// code has any, so an all-ones code reduces to an energy detector.
+	for (uint16_t k = 0; k < chips; k++) {
+		if (code & (1UL << (chips-1-k))) m->weight[k] = 1.0f / n_on;
+		else m->weight[k] = -1.0f / (chips - n_on);
+	}
+	m->chans = chans;
+	m->chips = chips;
+	m->alpha = 1.0f / (chips * MFILTER_HOPS * MFILTER_FLOOR_CODES);
+	m->rot = mfilter_alloc(2 * chans);
+	m->osc = mfilter_alloc(2 * chans);
+	m->acc = mfilter_alloc(2 * chans);
+	m->hist = mfilter_alloc(2 * chans * chips * MFILTER_HOPS);
+	m->floor = mfilter_alloc(chans);
+	m->peak = mfilter_alloc(chans);
+	m->out = mfilter_alloc(chans);
+	// Mix down by exp(-j*w*n) to bring each channel to baseband.
+	for (uint16_t c = 0; c < chans; c++) {
+		double w = 2.0 * PI * freq_hz[c] / sample_hz;
+		m->rot[2*c]   = cosf(w);
+		m->rot[2*c+1] = -sinf(w);
+	}
+	mfilter_reset(m);
+	return 0;
+}
+
+// Free the storage allocated for the matched filter.
+void mfilter_free(mfilter_t *m)
+{
+	free(m->rot);
+	free(m->osc);
+	free(m->acc);
+	free(m->hist);
+	free(m->floor);
+	free(m->peak);
+	free(m->out);
+	m->rot = m->osc = m->acc = m->hist = NULL;
+	m->floor = m->peak = m->out = NULL;
+}
+
+// Reset the matched filter state, including the noise floor, to zero.
+void mfilter_reset(mfilter_t *m)
+{
+	for (uint16_t c = 0; c < m->chans; c++) {
+		m->osc[2*c]   = 1.0f;
+		m->osc[2*c+1] = 0.0f;
+	}
+	memset(m->acc, 0, 2 * m->chans * sizeof(mfilter_data_t));
+	memset(m->hist, 0,
+		2 * m->chans * m->chips * MFILTER_HOPS * sizeof(mfilter_data_t));
+	memset(m->floor, 0, m->chans * sizeof(mfilter_data_t));
+	memset(m->peak, 0, m->chans * sizeof(mfilter_data_t));
+	memset(m->out, 0, m->chans * sizeof(mfilter_data_t));
+	m->phase = 0;
+	m->hops = 0;
+	m->pos = 0;
+}
+
+// Correlate the hop sum history of a channel with the code. Also update
+// the noise floor of the channel with the energy of the newest chip.
+static void mfilter_correlate(mfilter_t *m, uint16_t c)
+{
+	const uint32_t len = m->chips * MFILTER_HOPS;
+	const mfilter_data_t *h = m->hist + 2 * c * len;
+	const mfilter_data_t norm = 1.0f / ((mfilter_data_t)m->chip_len * m->chip_len);
+	mfilter_data_t corr = 0.0f, peak = 0.0f, p = 0.0f;
+	uint32_t idx = m->pos; // Oldest hop sum
+
+	for (uint16_t k = 0; k < m->chips; k++) {
+		mfilter_data_t re = 0.0f, im = 0.0f;
+		for (uint16_t i = 0; i < MFILTER_HOPS; i++) {
+			re += h[2*idx];
+			im += h[2*idx+1];
+			if (++idx == len) idx = 0;
+		}
+		p = (re*re + im*im) * norm; // Mean energy of chip k
+		corr += m->weight[k] * p;
+		if (p > peak) peak = p;
+	}
+	m->out[c] = corr;
+	m->peak[c] = peak;
+
+	// Track the noise floor with the newest chip. The update starts as a
+	// running mean and settles to an exponential average. Growth is
+	// clamped so a strong burst does not raise its own floor.
+	mfilter_data_t a = 1.0f / (m->hops - len + 1);
+	if (a < m->alpha) a = m->alpha;
+	if (m->hops > len && p > FLOOR_CLAMP * m->floor[c])
+		p = FLOOR_CLAMP * m->floor[c];
+	m->floor[c] += a * (p - m->floor[c]);
+}
+
+// Add a sample to the matched filter. At the end of each hop the
+// correlation is computed for all channels.
+// in: next sample of the decimated input stream.
+// Returns true if new correlation outputs are available.
+bool mfilter_addSample(mfilter_t *m, mfilter_data_t in)
+{
+	mfilter_data_t *o = m->osc, *r = m->rot, *a = m->acc;
+
+	for (uint16_t c = 0; c < m->chans; c++, o += 2, r += 2, a += 2) {
+		mfilter_data_t re = o[0], im = o[1];
+		a[0] += in * re;
+		a[1] += in * im;
+		o[0] = re * r[0] - im * r[1];
+		o[1] = re * r[1] + im * r[0];
+	}
+
+	// Hops end on average every chip_len/MFILTER_HOPS samples.
+	m->phase += MFILTER_HOPS;
+	if (m->phase < m->chip_len) return false;
+	m->phase -= m->chip_len;
+
+	const uint32_t len = m->chips * MFILTER_HOPS;
+	for (uint16_t c = 0; c < m->chans; c++) {
+		mfilter_data_t *h = m->hist + 2 * (c * len + m->pos);
+		o = m->osc + 2*c;
+		a = m->acc + 2*c;
+		// Keep the oscillator on the unit circle.
+		mfilter_data_t g = (3.0f - (o[0]*o[0] + o[1]*o[1])) * 0.5f;
+		o[0] *= g;
+		o[1] *= g;
+		// Replace the oldest hop sum with the newest one.
+		h[0] = a[0];
+		h[1] = a[1];
+		a[0] = a[1] = 0.0f;
+	}
+	if (++m->pos == len) m->pos = 0;
+	if (m->hops < len * (MFILTER_FLOOR_CODES + 1)) m->hops++;
+	if (m->hops < len) return false;
+	for (uint16_t c = 0; c < m->chans; c++) mfilter_correlate(m, c);
+	return true;
+}
+
+// Retrieve the current correlation output for a channel.
+// chan: Specify which channel.
+mfilter_data_t mfilter_getOutput(mfilter_t *m, uint16_t chan)
+{
+	return m->out[chan];
+}
+
+// Copy all current correlation outputs to the specified array.
+// out: Array that will be populated upon return.
+void mfilter_getOutputArray(mfilter_t *m, mfilter_data_t out[])
+{
+	memcpy(out, m->out, m->chans * sizeof(mfilter_data_t));
+}
+
+// Return the correlation output of a channel divided by its noise floor.
+// chan: Specify which channel.
+mfilter_data_t mfilter_getQuality(mfilter_t *m, uint16_t chan)
+{
+	return m->out[chan] / (m->floor[chan] + EPS);
+}
+
+// Check for a hit. The channel with the largest chip energy in the window
+// is selected, so leakage into neighboring channels is ignored. It is a
+// hit if its quality is above the threshold and its output is at least
+// MFILTER_SHAPE times its largest chip energy.
+// thresh: minimum quality for a hit.
+// Returns the channel with a hit, or -1 if there is no hit.
+int32_t mfilter_getHitChannel(mfilter_t *m, mfilter_data_t thresh)
+{
+	uint16_t max = 0;
+
+	// Wait for the noise floor to average over a full code length.
+	if (m->hops < 2 * m->chips * MFILTER_HOPS) return -1;
+	for (uint16_t c = 1; c < m->chans; c++)
+		if (m->peak[c] > m->peak[max]) max = c;
+	if (m->out[max] > 0.0f && mfilter_getQuality(m, max) > thresh &&
+		m->out[max] >= MFILTER_SHAPE * m->peak[max])
+		return max;
+	return -1;
+}
@@ -0,0 +1,101 @@
+#ifndef MFILTER_H_
+#define MFILTER_H_
+
+// Matched filter for short coded pulses. A coded pulse is a burst of chips
+// at a channel frequency. During a one chip the carrier is emitted, during
+// a zero chip it is not. For each channel, the filter mixes the decimated
+// input stream down to baseband, integrates the result over each chip and
+// correlates the chip energies with the known code. The output for a
+// channel peaks when a complete burst at that frequency has been received,
+// so a hit can be declared at the end of the burst instead of after an
+// energy window fills. Chips with a zero in the code are subtracted from
+// the correlation, which rejects steady tones and ambient light.
+//
+// The correlation is evaluated MFILTER_HOPS times per chip. Each channel
+// keeps a noise floor, a slow average of its chip energies, that is used
+// to normalize the output when checking for a hit. A hit also requires the
+// output to be close to the largest chip energy in the correlation window,
+// which is only true when the whole burst lines up with the code.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Correlation outputs per chip
+#define MFILTER_HOPS 4
+// Maximum number of chips in a code
+#define MFILTER_MAX_CHIPS 32
+// Noise floor time constant in code lengths
+#define MFILTER_FLOOR_CODES 8
+// Minimum ratio of output to largest chip energy in the window for a hit
+#define MFILTER_SHAPE 0.5f
+
+// Type for matched filter data.
+typedef float mfilter_data_t;
+
+typedef struct {
+	uint16_t chans; // Number of channels.
+	uint16_t chips; // Number of chips in the code.
+	uint32_t chip_len; // Samples per chip.
+	uint32_t phase; // Hop phase accumulator, a hop ends at chip_len.
+	uint32_t hops; // Hops received, saturates once the floor settles.
+	uint16_t pos; // Position (in hist[]) of the oldest hop sum.
+	mfilter_data_t alpha; // Minimum noise floor update weight.
+	mfilter_data_t weight[MFILTER_MAX_CHIPS]; // Weight of each chip.
+	mfilter_data_t *rot; // Phase step per sample (re, im), per channel.
+	mfilter_data_t *osc; // Oscillator phasor (re, im), per channel.
+	mfilter_data_t *acc; // Baseband sum of current hop (re, im), per channel.
+	mfilter_data_t *hist; // Hop sum history (re, im), chips*HOPS per channel.
+	mfilter_data_t *floor; // Noise floor, per channel.
+	mfilter_data_t *peak; // Largest chip energy in the window, per channel.
+	mfilter_data_t *out; // Correlation output, per channel.
+} mfilter_t;
+
+// Initialize the matched filter. Allocate memory for the per-channel state.
+// If malloc() fails, abort() is called to print an error message and
+// terminate.
+// m: matched filter data structure.
+// freq_hz: array of channel frequencies in Hz.
+// chans: number of channels.
+// sample_hz: sample rate of the (decimated) input stream in Hz.
+// code: chip pattern, one bit per chip, sent most significant chip first.
+// chips: number of chips in the code (up to MFILTER_MAX_CHIPS).
+// chip_us: chip duration in microseconds.
+// Return zero if successful, or non-zero otherwise.
+int32_t mfilter_init(mfilter_t *m, const uint16_t freq_hz[], uint16_t chans,
+	uint32_t sample_hz, uint32_t code, uint16_t chips, uint32_t chip_us);
+
+// Free the storage allocated for the matched filter.
+void mfilter_free(mfilter_t *m);
+
+// Reset the matched filter state, including the noise floor, to zero.
+void mfilter_reset(mfilter_t *m);
+
+// Add a sample to the matched filter. At the end of each hop the
+// correlation is computed for all channels.
+// in: next sample of the decimated input stream.
+// Returns true if new correlation outputs are available.
+bool mfilter_addSample(mfilter_t *m, mfilter_data_t in);
+
+// Retrieve the current correlation output for a channel. The output is
+// the mean energy of the one chips less the mean energy of the zero chips.
+// A sine wave of amplitude A, keyed by the code, produces A*A/4 when the
+// burst is aligned with the filter.
+// chan: Specify which channel.
+mfilter_data_t mfilter_getOutput(mfilter_t *m, uint16_t chan);
+
+// Copy all current correlation outputs to the specified array.
+// out: Array that will be populated upon return.
+void mfilter_getOutputArray(mfilter_t *m, mfilter_data_t out[]);
+
+// Return the correlation output of a channel divided by its noise floor.
+// chan: Specify which channel.
+mfilter_data_t mfilter_getQuality(mfilter_t *m, uint16_t chan);
+
+// Check for a hit. The channel with the largest chip energy in the window
+// is selected. It is a hit if its quality is above the threshold and its
+// output is at least MFILTER_SHAPE times its largest chip energy.
+// thresh: minimum quality for a hit.
+// Returns the channel with a hit, or -1 if there is no hit.
+int32_t mfilter_getHitChannel(mfilter_t *m, mfilter_data_t thresh);
+
+#endif // MFILTER_H_
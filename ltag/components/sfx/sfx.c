@@ -0,0 +1,28 @@
+#include "sfx.h"
+
+// Laser shot: a noise burst swept down from a hiss to a rumble.
+const synth_asset_t bcFireSynth = {ASSET_SYNTH_HDR, {
+	.wave = SYNTH_NOISE,
+	.freq = 4000, .freq_end = 200,
+	.attack = 5, .decay = 80, .sustain = 250, .release = 600,
+	.level = 0x6000, .volume = 0x7000,
+}};
+
+// Empty clip: two short clicks of bright noise.
+const synth_asset_t clipEmptySynth = {ASSET_SYNTH_HDR, {
+	.wave = SYNTH_NOISE,
+	.freq = 5000, .freq_end = 2500,
+	.attack = 2, .decay = 30, .sustain = 20, .release = 48,
+	.level = 0x2000, .volume = 0x6000,
+	.repeat = 2,
+}};
+
+// Reload: a rising 8-bit square chirp, six times.
+const synth_asset_t powerUpSynth = {ASSET_SYNTH_HDR, {
+	.wave = SYNTH_SQUARE,
+	.crush = 8,
+	.freq = 350, .freq_end = 1000,
+	.attack = 5, .decay = 40, .sustain = 100, .release = 60,
+	.level = 0x4CCC, .volume = 0x5000,
+	.repeat = 6,
+}};
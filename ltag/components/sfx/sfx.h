@@ -0,0 +1,15 @@
+#ifndef SFX_H_
+#define SFX_H_
+
+#include "asset.h" // synth_asset_t
+
+// Synthesized versions of the short game effects, in place of the
+// samples of c32k_16b. Each is a patch of a few dozen bytes that
+// sound_start() plays like the samples. The names match the sounds they
+// replace, with "Synth" added.
+
+extern const synth_asset_t bcFireSynth;
+extern const synth_asset_t clipEmptySynth;
+extern const synth_asset_t powerUpSynth;
+
+#endif // SFX_H_
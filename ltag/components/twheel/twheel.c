@@ -0,0 +1,118 @@
+// Target backend of the timer service. A free-running 1 MHz GPTimer
+// counts from a single time base and its alarm is stepped one tick at a
+// time while timers run. The alarm ISR advances the wheel and wakes the
+// dispatch task when timers expire.
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/peripherals/gptimer.html
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gptimer.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "esp_check.h"
+
+#include "twheel.h"
+#include "twheel_port.h"
+
+#define TWHEEL_RES_HZ 1000000 // GPTimer resolution, 1 us
+#define TWHEEL_TASK_STACK 4096
+#define TWHEEL_TASK_PRIO (configMAX_PRIORITIES-3) // Below the esp_timer task
+
+static const char *TAG = "twheel";
+
+// Critical section protected variables
+static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+static uint64_t at; // Timer count of the next tick
+
+// Other global variables
+static gptimer_handle_t timer;
+static TaskHandle_t task;
+
+// Set the next alarm at a timer count or, if zero, disable the alarm.
+static void twheel_alarm(uint64_t count)
+{
+	gptimer_alarm_config_t cfg = {.alarm_count = count};
+	gptimer_set_alarm_action(timer, count ? &cfg : NULL);
+}
+
+void twheel_port_lock(void)
+{
+	portENTER_CRITICAL_SAFE(&spinlock);
+}
+
+void twheel_port_unlock(void)
+{
+	portEXIT_CRITICAL_SAFE(&spinlock);
+}
+
+void twheel_port_wake(void)
+{
+	gptimer_get_raw_count(timer, &at);
+	twheel_alarm(at += TWHEEL_TICK_US);
+}
+
+uint64_t twheel_port_time(void)
+{
+	return esp_timer_get_time();
+}
+
+// Called at each tick while timers run.
+static bool twheel_alarm_cb(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_ctx)
+{
+	BaseType_t woken = pdFALSE;
+	bool wake;
+
+	portENTER_CRITICAL_ISR(&spinlock);
+	twheel_alarm(twheel_wheel_tick() ? (at += TWHEEL_TICK_US) : 0);
+	wake = twheel_wheel_ready();
+	portEXIT_CRITICAL_ISR(&spinlock);
+	if (wake) vTaskNotifyGiveFromISR(task, &woken);
+	return woken == pdTRUE;
+}
+
+// Call the callbacks of expired timers.
+static void twheel_task(void *arg)
+{
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		twheel_wheel_dispatch();
+	}
+}
+
+int32_t twheel_init(void)
+{
+	if (timer != NULL) return 0; // Already initialized
+	twheel_wheel_reset();
+
+	gptimer_config_t timer_config = {
+		.clk_src = GPTIMER_CLK_SRC_DEFAULT,
+		.direction = GPTIMER_COUNT_UP,
+		.resolution_hz = TWHEEL_RES_HZ,
+	};
+	ESP_RETURN_ON_ERROR(gptimer_new_timer(&timer_config, &timer), TAG, "new timer");
+	gptimer_event_callbacks_t cbs = {
+		.on_alarm = twheel_alarm_cb,
+	};
+	ESP_RETURN_ON_ERROR(gptimer_register_event_callbacks(timer, &cbs, NULL), TAG, "callbacks");
+	ESP_RETURN_ON_ERROR(gptimer_enable(timer), TAG, "enable");
+	if (xTaskCreate(twheel_task, "twheel", TWHEEL_TASK_STACK, NULL,
+		TWHEEL_TASK_PRIO, &task) != pdPASS) {
+		ESP_LOGE(TAG, "xTaskCreate failed");
+		return -1;
+	}
+	ESP_RETURN_ON_ERROR(gptimer_start(timer), TAG, "start");
+	return 0;
+}
+
+int32_t twheel_deinit(void)
+{
+	if (timer == NULL) return 0;
+	ESP_RETURN_ON_ERROR(gptimer_stop(timer), TAG, "stop");
+	ESP_RETURN_ON_ERROR(gptimer_disable(timer), TAG, "disable");
+	ESP_RETURN_ON_ERROR(gptimer_del_timer(timer), TAG, "delete");
+	timer = NULL;
+	vTaskDelete(task);
+	task = NULL;
+	twheel_wheel_reset();
+	return 0;
+}
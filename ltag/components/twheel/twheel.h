@@ -0,0 +1,100 @@
+#ifndef TWHEEL_H_
+#define TWHEEL_H_
+
+// Timer service for the one-shot timers of the game: hit LED, lockout,
+// invincibility and shot reload. It is a hashed timing wheel driven by a
+// single GPTimer alarm that ticks every TWHEEL_TICK_US while any timer
+// runs and stops when none do. A timer is a linked list entry owned by
+// the caller, so starting, restarting and stopping a timer is O(1) with no
+// allocation. A tick only looks at the one wheel slot it hashes to, and a
+// timer longer than a wheel revolution simply stays in its slot for more
+// revolutions.
+//
+// The alarm ISR moves expired timers to a ready list. One task calls
+// their callbacks, so callbacks may block briefly and use any driver, but
+// they delay each other. The service also records the dispatch latency,
+// the time from when a timer was due to when its callback started.
+//
+// Client module, e.g. lockoutTimer.c:
+//   static twheel_timer_t timer;
+//   static uint32_t period;
+//   int32_t lockoutTimer_init(uint32_t ms)
+//   {
+//     period = ms;
+//     twheel_timer_init(&timer, NULL, NULL);
+//     return twheel_init();
+//   }
+//   void lockoutTimer_start(void) { twheel_start(&timer, period); }
+//   bool lockoutTimer_running(void) { return twheel_running(&timer); }
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TWHEEL_TICK_US 1000 // Tick period, the resolution of the timers
+#define TWHEEL_SLOTS 64 // Wheel slots, a power of two
+
+// Timer states
+typedef enum {
+	TWHEEL_IDLE, // Not started, stopped, or the callback was called
+	TWHEEL_ARMED, // In the wheel
+	TWHEEL_READY, // Expired, waiting for its callback
+} twheel_state_t;
+
+// Doubly linked list entry
+typedef struct twheel_link {
+	struct twheel_link *next, *prev;
+} twheel_link_t;
+
+// Timer. The fields are private to the service.
+typedef struct {
+	twheel_link_t link; // In a slot or the ready list, must be first
+	uint64_t expiry; // Tick count when the timer expires
+	uint64_t due_us; // Time when the timer is due
+	void (*cb)(void *arg); // Called when the timer expires, may be NULL
+	void *arg;
+	volatile twheel_state_t state;
+} twheel_timer_t;
+
+// Dispatch statistics
+typedef struct {
+	uint32_t count; // Callbacks dispatched
+	uint32_t max_us; // Max latency
+	uint64_t sum_us; // Sum of latencies, for the mean
+} twheel_stats_t;
+
+// Initialize the timer service. Safe to call more than once, so each
+// client can call it from its own init function.
+// Return zero if successful, or non-zero otherwise.
+int32_t twheel_init(void);
+
+// Free resources used by the timer service. Running timers are dropped.
+// Return zero if successful, or non-zero otherwise.
+int32_t twheel_deinit(void);
+
+// Initialize a timer. Must be called once before any other use.
+// t: timer.
+// cb: function called in the dispatch task when the timer expires, or NULL.
+// arg: argument passed to cb.
+void twheel_timer_init(twheel_timer_t *t, void (*cb)(void *arg), void *arg);
+
+// Start the timer from the beginning, also if it is running or has
+// expired but its callback has not been called yet. It never expires
+// early and at most one tick late, plus the dispatch latency. Safe to call
+// from an ISR or a callback.
+// t: timer.
+// ms: period in milliseconds.
+void twheel_start(twheel_timer_t *t, uint32_t ms);
+
+// Stop the timer. Its callback is not called. Safe to call from an ISR.
+void twheel_stop(twheel_timer_t *t);
+
+// Return true if the timer is running, until its callback is called.
+bool twheel_running(const twheel_timer_t *t);
+
+// Get the dispatch statistics.
+void twheel_stats(twheel_stats_t *s);
+
+// Clear the dispatch statistics.
+void twheel_stats_clear(void);
+
+#endif // TWHEEL_H_
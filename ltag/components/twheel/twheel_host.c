@@ -0,0 +1,65 @@
+// Host (Linux) build of the timer service on a virtual clock, see
+// twheel_host.h.
+
+#include "twheel.h"
+#include "twheel_host.h"
+#include "twheel_port.h"
+
+static uint64_t now; // Virtual time
+static uint64_t next; // Time of the next tick
+static bool ticking;
+static bool initialized;
+
+void twheel_port_lock(void)
+{
+}
+
+void twheel_port_unlock(void)
+{
+}
+
+void twheel_port_wake(void)
+{
+	next = now + TWHEEL_TICK_US;
+	ticking = true;
+}
+
+uint64_t twheel_port_time(void)
+{
+	return now;
+}
+
+int32_t twheel_init(void)
+{
+	if (initialized) return 0;
+	twheel_wheel_reset();
+	ticking = false;
+	initialized = true;
+	return 0;
+}
+
+int32_t twheel_deinit(void)
+{
+	twheel_wheel_reset();
+	ticking = false;
+	initialized = false;
+	return 0;
+}
+
+void twheel_host_advance(uint32_t us)
+{
+	uint64_t end = now + us;
+
+	while (ticking && next <= end) {
+		now = next;
+		next += TWHEEL_TICK_US;
+		ticking = twheel_wheel_tick();
+		twheel_wheel_dispatch(); // May start timers and change next
+	}
+	now = end;
+}
+
+uint64_t twheel_host_time(void)
+{
+	return now;
+}
@@ -0,0 +1,22 @@
+#ifndef TWHEEL_HOST_H_
+#define TWHEEL_HOST_H_
+
+// Host (Linux) build of the timer service. Time is a virtual clock that
+// starts at zero and only moves with twheel_host_advance(), which also
+// runs the ticks and calls the callbacks in order, so tests can check
+// exact expiry times. Starting the first timer aligns the ticks to the
+// current virtual time, as on the target.
+
+#include <stdint.h>
+
+#include "twheel.h"
+
+// Advance the virtual clock, running the ticks and callbacks on the way.
+// A callback sees twheel_host_time() at its tick.
+// us: time to advance in microseconds.
+void twheel_host_advance(uint32_t us);
+
+// Return the virtual time in microseconds.
+uint64_t twheel_host_time(void);
+
+#endif // TWHEEL_HOST_H_
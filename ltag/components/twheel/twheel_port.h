@@ -0,0 +1,41 @@
+#ifndef TWHEEL_PORT_H_
+#define TWHEEL_PORT_H_
+
+// Interface between the timing wheel (twheel_wheel.c), which is the same
+// on every build, and the backend that ticks it: twheel.c on the target
+// and twheel_host.c on a host. Not for clients.
+
+#include "twheel.h"
+
+// Functions provided by the backend
+
+// Enter and exit the critical section that protects the wheel.
+void twheel_port_lock(void);
+void twheel_port_unlock(void);
+
+// Start ticking, with the first tick one tick period from now. Called in
+// the critical section when the first timer is started.
+void twheel_port_wake(void);
+
+// Return the time in microseconds.
+uint64_t twheel_port_time(void);
+
+// Functions provided by the wheel, to be called by the backend
+
+// Empty the wheel and the ready list and clear the statistics.
+void twheel_wheel_reset(void);
+
+// Advance one tick and move the expired timers to the ready list. Call in
+// the critical section.
+// Returns true if timers are still in the wheel, so ticking must go on.
+bool twheel_wheel_tick(void);
+
+// Return true if timers are waiting for their callbacks. Call in the
+// critical section.
+bool twheel_wheel_ready(void);
+
+// Call the callbacks of the ready timers, oldest first. Takes the critical
+// section as needed, so call it outside.
+void twheel_wheel_dispatch(void);
+
+#endif // TWHEEL_PORT_H_
@@ -0,0 +1,166 @@
+// Hashed timing wheel shared by the target and host builds. The backend
+// provides the locking, the tick and the time, see twheel_port.h.
+
+#include <stddef.h> // NULL
+
+#include "twheel.h"
+#include "twheel_port.h"
+
+#define TWHEEL_MASK (TWHEEL_SLOTS-1)
+
+#if TWHEEL_SLOTS & TWHEEL_MASK
+#error "TWHEEL_SLOTS must be a power of two"
+#endif
+
+// Critical section protected variables
+static twheel_link_t wheel[TWHEEL_SLOTS]; // List heads, one per slot
+static twheel_link_t ready; // Expired timers, oldest first
+static uint64_t cur; // Ticks so far
+static uint32_t armed; // Timers in the wheel
+static twheel_stats_t stats;
+
+// Initialize an empty list.
+static inline void twheel_list_init(twheel_link_t *h)
+{
+	h->next = h->prev = h;
+}
+
+// Remove an entry from its list.
+static inline void twheel_list_remove(twheel_link_t *l)
+{
+	l->prev->next = l->next;
+	l->next->prev = l->prev;
+	l->next = l->prev = l;
+}
+
+// Add an entry at the tail of a list.
+static inline void twheel_list_append(twheel_link_t *h, twheel_link_t *l)
+{
+	l->prev = h->prev;
+	l->next = h;
+	h->prev->next = l;
+	h->prev = l;
+}
+
+// Take a timer out of the wheel or the ready list. Must be called in a
+// critical section.
+static void twheel_unlink(twheel_timer_t *t)
+{
+	if (t->state == TWHEEL_IDLE) return;
+	if (t->state == TWHEEL_ARMED) armed--;
+	twheel_list_remove(&t->link);
+	t->state = TWHEEL_IDLE;
+}
+
+void twheel_wheel_reset(void)
+{
+	for (uint16_t i = 0; i < TWHEEL_SLOTS; i++) twheel_list_init(&wheel[i]);
+	twheel_list_init(&ready);
+	cur = 0;
+	armed = 0;
+	stats = (twheel_stats_t){0};
+}
+
+bool twheel_wheel_tick(void)
+{
+	twheel_link_t *h = &wheel[++cur & TWHEEL_MASK];
+
+	for (twheel_link_t *l = h->next, *n; l != h; l = n) {
+		twheel_timer_t *t = (twheel_timer_t *)l;
+		n = l->next;
+		if (t->expiry > cur) continue; // Due in a later revolution
+		twheel_list_remove(l);
+		twheel_list_append(&ready, l);
+		t->state = TWHEEL_READY;
+		armed--;
+	}
+	return armed != 0;
+}
+
+bool twheel_wheel_ready(void)
+{
+	return ready.next != &ready;
+}
+
+void twheel_wheel_dispatch(void)
+{
+	for (;;) {
+		void (*cb)(void *);
+		void *arg;
+
+		twheel_port_lock();
+		if (ready.next == &ready) {
+			twheel_port_unlock();
+			return;
+		}
+		twheel_timer_t *t = (twheel_timer_t *)ready.next;
+		twheel_unlink(t);
+		cb = t->cb;
+		arg = t->arg;
+		uint64_t now = twheel_port_time();
+		uint32_t lat = (now > t->due_us) ? now - t->due_us : 0;
+		stats.count++;
+		stats.sum_us += lat;
+		if (lat > stats.max_us) stats.max_us = lat;
+		twheel_port_unlock();
+		if (cb) cb(arg);
+	}
+}
+
+void twheel_timer_init(twheel_timer_t *t, void (*cb)(void *arg), void *arg)
+{
+	twheel_list_init(&t->link);
+	t->expiry = 0;
+	t->due_us = 0;
+	t->cb = cb;
+	t->arg = arg;
+	t->state = TWHEEL_IDLE;
+}
+
+void twheel_start(twheel_timer_t *t, uint32_t ms)
+{
+	uint64_t ticks = ((uint64_t)ms*1000 + TWHEEL_TICK_US-1) / TWHEEL_TICK_US;
+
+	if (!ticks) ticks = 1;
+	twheel_port_lock();
+	twheel_unlink(t);
+	if (armed) {
+		// The next tick is up to a tick period away, so wait one more
+		// to never expire early.
+		ticks++;
+	} else {
+		twheel_port_wake(); // Next tick is exactly one period away
+	}
+	t->expiry = cur + ticks;
+	t->due_us = twheel_port_time() + (uint64_t)ms*1000;
+	twheel_list_append(&wheel[t->expiry & TWHEEL_MASK], &t->link);
+	t->state = TWHEEL_ARMED;
+	armed++;
+	twheel_port_unlock();
+}
+
+void twheel_stop(twheel_timer_t *t)
+{
+	twheel_port_lock();
+	twheel_unlink(t);
+	twheel_port_unlock();
+}
+
+bool twheel_running(const twheel_timer_t *t)
+{
+	return t->state != TWHEEL_IDLE;
+}
+
+void twheel_stats(twheel_stats_t *s)
+{
+	twheel_port_lock();
+	*s = stats;
+	twheel_port_unlock();
+}
+
+void twheel_stats_clear(void)
+{
+	twheel_port_lock();
+	stats = (twheel_stats_t){0};
+	twheel_port_unlock();
+}
@@ -0,0 +1,230 @@
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/peripherals/ledc.html
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/peripherals/gptimer.html
+
+#include "freertos/FreeRTOS.h"
+#include "driver/ledc.h"
+#include "driver/gptimer.h"
+#include "driver/gpio.h"
+#include "hal/ledc_ll.h"
+#include "soc/soc.h" // APB_CLK_FREQ
+#include "esp_log.h"
+#include "esp_check.h"
+
+#include "txsched.h"
+
+#define TXSCHED_MODE LEDC_LOW_SPEED_MODE
+#define TXSCHED_TIMER LEDC_TIMER_1 // LEDC_TIMER_0 is left to tx.c
+#define TXSCHED_CHAN LEDC_CHANNEL_1
+#define TXSCHED_RES LEDC_TIMER_10_BIT
+#define TXSCHED_DUTY (1U << (TXSCHED_RES-1)) // 50%
+#define TXSCHED_FREQ 1000 // Initial carrier frequency in Hz
+#define TXSCHED_CLK LEDC_USE_APB_CLK
+#define TXSCHED_CLK_HZ APB_CLK_FREQ
+#define TXSCHED_DIV(f) (((uint64_t)TXSCHED_CLK_HZ << LEDC_LL_FRACTIONAL_BITS) / \
+	((uint64_t)(f) << TXSCHED_RES)) // LEDC timer divider, fixed point
+#define TXSCHED_RES_HZ 1000000 // GPTimer resolution, 1 us
+#define TXSCHED_LEAD_US 5 // Time to the first edge after queueing when idle
+
+static const char *TAG = "txsched";
+
+// Critical section protected variables
+static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+static txsched_seg_t q[TXSCHED_QUEUE]; // Segment queue
+static uint32_t qdiv[TXSCHED_QUEUE]; // LEDC timer divider of each segment
+static volatile uint16_t qhead; // Oldest segment, playing if emitting
+static volatile uint16_t qcount; // Segments in the queue
+static volatile bool playing; // Segments are playing, including off time
+static volatile bool emitting; // In the on time of the head segment
+static uint64_t at; // Timer count of the next edge
+
+// Other global variables
+static gptimer_handle_t timer;
+static ledc_dev_t *ledc; // LEDC registers
+static uint32_t cur_div;
+static int32_t pin = -1;
+
+// Set the next alarm at a timer count or, if zero, disable the alarm.
+static void txsched_alarm(uint64_t count)
+{
+	gptimer_alarm_config_t cfg = {.alarm_count = count};
+	gptimer_set_alarm_action(timer, count ? &cfg : NULL);
+}
+
+// Start the carrier with a timer divider or, if div is zero, stop it with
+// the output low. The duty cycle is set once by txsched_init(), so only
+// register writes are needed here, which are safe in the ISR. The LEDC
+// driver functions take a lock and may log, so they are not called.
+static void txsched_carrier(uint32_t div)
+{
+	if (!div) {
+		ledc_ll_set_sig_out_en(ledc, TXSCHED_MODE, TXSCHED_CHAN, false);
+		ledc_ll_ls_channel_update(ledc, TXSCHED_MODE, TXSCHED_CHAN);
+		return;
+	}
+	if (div != cur_div) {
+		ledc_ll_set_clock_divider(ledc, TXSCHED_MODE, TXSCHED_TIMER, div);
+		ledc_ll_ls_timer_update(ledc, TXSCHED_MODE, TXSCHED_TIMER);
+		cur_div = div;
+	}
+	ledc_ll_timer_rst(ledc, TXSCHED_MODE, TXSCHED_TIMER); // Start a full carrier period
+	ledc_ll_set_sig_out_en(ledc, TXSCHED_MODE, TXSCHED_CHAN, true);
+	ledc_ll_ls_channel_update(ledc, TXSCHED_MODE, TXSCHED_CHAN);
+}
+
+// Remove the head segment. Must be called in a critical section.
+static inline void txsched_retire(void)
+{
+	if (++qhead == TXSCHED_QUEUE) qhead = 0;
+	qcount--;
+}
+
+// Play the schedule up to the next edge. Called at each alarm, the first
+// one set when playing starts. Must be called in a critical section.
+static void txsched_step(void)
+{
+	if (emitting) { // End of the on time
+		uint32_t off = q[qhead].off_us;
+		txsched_carrier(0);
+		emitting = false;
+		txsched_retire();
+		if (off) {
+			txsched_alarm(at += off);
+			return;
+		}
+	}
+	while (qcount) {
+		const txsched_seg_t *s = &q[qhead];
+		if (s->on_us) {
+			txsched_carrier(qdiv[qhead]);
+			emitting = true;
+			txsched_alarm(at += s->on_us);
+			return;
+		}
+		uint32_t off = s->off_us;
+		txsched_retire();
+		if (off) {
+			txsched_alarm(at += off);
+			return;
+		}
+	}
+	playing = false;
+	txsched_alarm(0);
+}
+
+// Called at each segment edge.
+static bool txsched_alarm_cb(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_ctx)
+{
+	portENTER_CRITICAL_ISR(&spinlock);
+	if (playing) txsched_step();
+	portEXIT_CRITICAL_ISR(&spinlock);
+	return false; // no high priority task awoken
+}
+
+int32_t txsched_init(int32_t gpio_num)
+{
+	ESP_LOGI(TAG, "gpio_num:%ld", gpio_num);
+	if (timer != NULL) txsched_deinit();
+	qhead = qcount = 0;
+	playing = emitting = false;
+
+	// The clock source is fixed, so the timer divider of each carrier
+	// frequency is computed when its segment is queued.
+	ledc_timer_config_t ledc_timer = {
+		.speed_mode = TXSCHED_MODE,
+		.duty_resolution = TXSCHED_RES,
+		.timer_num = TXSCHED_TIMER,
+		.freq_hz = TXSCHED_FREQ,
+		.clk_cfg = TXSCHED_CLK,
+	};
+	ESP_RETURN_ON_ERROR(ledc_timer_config(&ledc_timer), TAG, "ledc timer");
+	cur_div = 0;
+	ledc_channel_config_t ledc_channel = {
+		.gpio_num = gpio_num,
+		.speed_mode = TXSCHED_MODE,
+		.channel = TXSCHED_CHAN,
+		.timer_sel = TXSCHED_TIMER,
+		.duty = TXSCHED_DUTY,
+		.hpoint = 0,
+	};
+	ESP_RETURN_ON_ERROR(ledc_channel_config(&ledc_channel), TAG, "ledc channel");
+	ESP_RETURN_ON_ERROR(ledc_stop(TXSCHED_MODE, TXSCHED_CHAN, 0), TAG, "ledc stop"); // Idle low
+	ledc = LEDC_LL_GET_HW();
+	pin = gpio_num;
+
+	// The timer runs freely from here on, so edges are counted from a
+	// single time base. At 1 MHz the 64-bit count does not wrap.
+	gptimer_config_t timer_config = {
+		.clk_src = GPTIMER_CLK_SRC_DEFAULT,
+		.direction = GPTIMER_COUNT_UP,
+		.resolution_hz = TXSCHED_RES_HZ,
+	};
+	ESP_RETURN_ON_ERROR(gptimer_new_timer(&timer_config, &timer), TAG, "new timer");
+	gptimer_event_callbacks_t cbs = {
+		.on_alarm = txsched_alarm_cb,
+	};
+	ESP_RETURN_ON_ERROR(gptimer_register_event_callbacks(timer, &cbs, NULL), TAG, "callbacks");
+	ESP_RETURN_ON_ERROR(gptimer_enable(timer), TAG, "enable");
+	ESP_RETURN_ON_ERROR(gptimer_start(timer), TAG, "start");
+	return 0;
+}
+
+int32_t txsched_deinit(void)
+{
+	if (timer == NULL) return 0;
+	txsched_cancel();
+	ESP_RETURN_ON_ERROR(gptimer_stop(timer), TAG, "stop");
+	ESP_RETURN_ON_ERROR(gptimer_disable(timer), TAG, "disable");
+	ESP_RETURN_ON_ERROR(gptimer_del_timer(timer), TAG, "delete");
+	timer = NULL;
+	gpio_reset_pin(pin); // Hand the pin back, see tx_init()
+	gpio_set_pull_mode(pin, GPIO_PULLDOWN_ONLY); // Keep it low
+	pin = -1;
+	return 0;
+}
+
+int32_t txsched_queue(const txsched_seg_t *seg, uint16_t count)
+{
+	if (timer == NULL) return -1;
+	for (uint16_t i = 0; i < count; i++)
+		if (seg[i].on_us && (seg[i].freq_hz < TXSCHED_FREQ_MIN ||
+			seg[i].freq_hz > TXSCHED_FREQ_MAX)) return -1;
+	portENTER_CRITICAL_SAFE(&spinlock);
+	if (count > TXSCHED_QUEUE - qcount) {
+		portEXIT_CRITICAL_SAFE(&spinlock);
+		return -1;
+	}
+	for (uint16_t i = 0, t = qhead + qcount; i < count; i++, t++) {
+		q[t % TXSCHED_QUEUE] = seg[i];
+		qdiv[t % TXSCHED_QUEUE] = seg[i].on_us ? TXSCHED_DIV(seg[i].freq_hz) : 0;
+	}
+	qcount += count;
+	if (!playing) {
+		playing = true;
+		emitting = false;
+		gptimer_get_raw_count(timer, &at);
+		txsched_alarm(at += TXSCHED_LEAD_US);
+	}
+	portEXIT_CRITICAL_SAFE(&spinlock);
+	return 0;
+}
+
+void txsched_cancel(void)
+{
+	if (timer == NULL) return;
+	portENTER_CRITICAL_SAFE(&spinlock);
+	qhead = qcount = 0;
+	playing = emitting = false;
+	txsched_alarm(0);
+	txsched_carrier(0);
+	portEXIT_CRITICAL_SAFE(&spinlock);
+}
+
+bool txsched_busy(void)
+{
+	return playing;
+}
+
+uint16_t txsched_room(void)
+{
+	return TXSCHED_QUEUE - qcount;
+}
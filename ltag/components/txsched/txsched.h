@@ -0,0 +1,74 @@
+#ifndef TXSCHED_H_
+#define TXSCHED_H_
+
+// Hardware-timed transmit scheduler. Plays a queue of segments on a GPIO
+// pin. Each segment emits a square wave at its frequency for its on time,
+// then keeps the output low for its off time. The carrier is generated by
+// LEDC and the segment edges are timed by a GPTimer alarm with microsecond
+// resolution, so the caller never waits. Segments are queued without
+// blocking, also from a timer callback or ISR, which keeps the game tick
+// short while a burst or coded shot is playing.
+//
+// The scheduler uses its own LEDC timer and channel, so do not drive the
+// same pin with tx_emit() or tx_pulse() while it is in use. The pin is
+// reset by txsched_deinit(); call tx_init() again to use it with tx.c.
+//
+// Burst of three shots:
+//   txsched_seg_t burst[3];
+//   for (uint16_t i = 0; i < 3; i++)
+//     burst[i] = (txsched_seg_t){freq_hz, 50000, 100000};
+//   txsched_queue(burst, 3);
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TXSCHED_QUEUE 32 // Max queued segments
+#define TXSCHED_FREQ_MIN 100 // Carrier range in Hz
+#define TXSCHED_FREQ_MAX 20000
+
+// Transmit segment
+typedef struct {
+	uint32_t freq_hz; // Carrier frequency during the on time
+	uint32_t on_us; // Emitting time in microseconds
+	uint32_t off_us; // Silent time after the on time in microseconds
+} txsched_seg_t;
+
+// Initialize the scheduler. The output is low until segments are queued.
+// gpio_num: GPIO pin number.
+// Return zero if successful, or non-zero otherwise.
+int32_t txsched_init(int32_t gpio_num);
+
+// Free resources used by the scheduler. Stops any playing segments.
+// Return zero if successful, or non-zero otherwise.
+int32_t txsched_deinit(void);
+
+// Queue segments to play after those already queued. Playing starts right
+// away if the scheduler is idle. Does not block, may be called from an ISR.
+// Either all segments are queued or none.
+// seg: segments to play in order.
+// count: number of segments.
+// Return zero if successful, or non-zero if the queue has no room or a
+// segment with an on time has a frequency outside the carrier range.
+int32_t txsched_queue(const txsched_seg_t *seg, uint16_t count);
+
+// Queue a coded burst. The code is sent most significant chip first. The
+// output emits during a one chip and is off during a zero chip and after
+// the last chip. Each run of one chips becomes the on time of a segment
+// and the following run of zero chips its off time.
+// freq_hz: carrier frequency.
+// code: chip pattern, one bit per chip, first chip in the MSB.
+// chips: number of chips in the code (up to 32).
+// chip_us: duration of each chip in microseconds.
+// Return zero if successful, or non-zero if the queue has no room.
+int32_t txsched_code(uint32_t freq_hz, uint32_t code, uint16_t chips, uint32_t chip_us);
+
+// Stop the output and discard all queued segments.
+void txsched_cancel(void);
+
+// Return true while segments are playing, including their off time.
+bool txsched_busy(void);
+
+// Return the number of segments that can be queued now.
+uint16_t txsched_room(void);
+
+#endif // TXSCHED_H_
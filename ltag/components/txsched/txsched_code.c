@@ -0,0 +1,19 @@
+// Coded bursts, shared by the hardware and host backends.
+
+#include "txsched.h"
+
+int32_t txsched_code(uint32_t freq_hz, uint32_t code, uint16_t chips, uint32_t chip_us)
+{
+	txsched_seg_t seg[TXSCHED_QUEUE];
+	uint16_t n = 0;
+
+	if (chips > 32) return -1;
+	for (uint16_t i = 0; i < chips; ) {
+		uint32_t on = 0, off = 0;
+		// Leading zero chips give a segment with no on time.
+		for (; i < chips && (code >> (chips-1-i) & 1); i++) on += chip_us;
+		for (; i < chips && !(code >> (chips-1-i) & 1); i++) off += chip_us;
+		seg[n++] = (txsched_seg_t){freq_hz, on, off};
+	}
+	return txsched_queue(seg, n);
+}
@@ -0,0 +1,113 @@
+// Host (Linux) build of the transmit scheduler. The waveform is recorded
+// on a virtual clock instead of driving a pin, see txsched_host.h.
+
+#include "txsched.h"
+#include "txsched_host.h"
+
+static uint64_t qend[TXSCHED_QUEUE]; // End time of each queued segment
+static uint16_t qhead; // Oldest segment
+static uint16_t qcount; // Segments in the queue
+static uint64_t now; // Virtual time
+static uint64_t end; // End of the last queued segment
+static txsched_edge_t edge[TXSCHED_HOST_EDGES];
+static uint32_t ecount;
+static bool initialized;
+
+// Record an edge. Edges are kept minimal: an edge that does not change the
+// output is dropped, and a later edge at the same time replaces the first.
+static void txsched_host_edge(uint64_t t, uint32_t freq_hz)
+{
+	uint32_t prev = ecount ? edge[ecount-1].freq_hz : 0;
+
+	if (ecount && edge[ecount-1].t_us == t) {
+		ecount--;
+		prev = ecount ? edge[ecount-1].freq_hz : 0;
+	}
+	if (freq_hz == prev || ecount == TXSCHED_HOST_EDGES) return;
+	edge[ecount++] = (txsched_edge_t){t, freq_hz};
+}
+
+// Remove the segments that ended.
+static void txsched_host_retire(void)
+{
+	while (qcount && qend[qhead] <= now) {
+		if (++qhead == TXSCHED_QUEUE) qhead = 0;
+		qcount--;
+	}
+}
+
+int32_t txsched_init(int32_t gpio_num)
+{
+	qhead = qcount = 0;
+	end = now;
+	initialized = true;
+	return 0;
+}
+
+int32_t txsched_deinit(void)
+{
+	txsched_cancel();
+	initialized = false;
+	return 0;
+}
+
+int32_t txsched_queue(const txsched_seg_t *seg, uint16_t count)
+{
+	if (!initialized) return -1;
+	txsched_host_retire();
+	if (count > TXSCHED_QUEUE - qcount) return -1;
+	for (uint16_t i = 0; i < count; i++)
+		if (seg[i].on_us && (seg[i].freq_hz < TXSCHED_FREQ_MIN ||
+			seg[i].freq_hz > TXSCHED_FREQ_MAX)) return -1;
+	if (end < now) end = now;
+	for (uint16_t i = 0; i < count; i++) {
+		if (seg[i].on_us) {
+			txsched_host_edge(end, seg[i].freq_hz);
+			txsched_host_edge(end + seg[i].on_us, 0);
+		}
+		end += seg[i].on_us + seg[i].off_us;
+		qend[(qhead + qcount++) % TXSCHED_QUEUE] = end;
+	}
+	return 0;
+}
+
+void txsched_cancel(void)
+{
+	while (ecount && edge[ecount-1].t_us >= now) ecount--;
+	txsched_host_edge(now, 0);
+	qhead = qcount = 0;
+	end = now;
+}
+
+bool txsched_busy(void)
+{
+	return now < end;
+}
+
+uint16_t txsched_room(void)
+{
+	txsched_host_retire();
+	return TXSCHED_QUEUE - qcount;
+}
+
+void txsched_host_advance(uint32_t us)
+{
+	now += us;
+	txsched_host_retire();
+}
+
+uint64_t txsched_host_time(void)
+{
+	return now;
+}
+
+uint32_t txsched_host_edges(const txsched_edge_t **edges)
+{
+	*edges = edge;
+	return ecount;
+}
+
+void txsched_host_clear(void)
+{
+	ecount = 0;
+}
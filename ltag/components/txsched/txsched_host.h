@@ -0,0 +1,37 @@
+#ifndef TXSCHED_HOST_H_
+#define TXSCHED_HOST_H_
+
+// Host (Linux) build of the transmit scheduler. Instead of driving a pin,
+// the scheduled waveform is recorded as a list of edges on a virtual clock
+// that starts at zero and only moves with txsched_host_advance(). Segments
+// queued while idle start at the current virtual time, so tests can assert
+// exact edge times.
+
+#include <stdint.h>
+
+#include "txsched.h"
+
+#define TXSCHED_HOST_EDGES 1024 // Max recorded edges
+
+// Recorded output edge
+typedef struct {
+	uint64_t t_us; // Virtual time of the edge
+	uint32_t freq_hz; // Carrier frequency from here on, zero if off
+} txsched_edge_t;
+
+// Advance the virtual clock. Segments that end are removed from the queue.
+// us: time to advance in microseconds.
+void txsched_host_advance(uint32_t us);
+
+// Return the virtual time in microseconds.
+uint64_t txsched_host_time(void);
+
+// Get the recorded edges, oldest first.
+// edges: set to the edge array.
+// Returns the number of edges.
+uint32_t txsched_host_edges(const txsched_edge_t **edges);
+
+// Discard the recorded edges. The virtual clock is not changed.
+void txsched_host_clear(void);
+
+#endif // TXSCHED_HOST_H_
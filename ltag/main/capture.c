@@ -0,0 +1,287 @@
+#include <stdlib.h> // malloc, free, abort
+#include <string.h> // memcmp, memcpy, memchr, strstr
+
+#include "sdkconfig.h"
+#if CONFIG_SPIRAM
+#include "esp_heap_caps.h"
+#endif
+
+#include "capture.h"
+
+#define FRAME_BYTES(n) (6U+2U*(n)+2U) // sync, seq, count, samples, crc
+
+static const uint8_t magic[4] = {'L', 'T', 'C', 'P'};
+static const char b64[] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static rx_data_t *ring; // Recorded samples
+static uint32_t rsize; // Capacity of the ring
+static uint32_t rpos; // Next position to write
+static uint32_t rcnt; // Samples in the ring
+static bool enabled;
+static capture_header_t header;
+
+
+// Little-endian field access
+static void put16(uint8_t *p, uint16_t v) {p[0] = v; p[1] = v >> 8;}
+static void put32(uint8_t *p, uint32_t v) {put16(p, v); put16(p+2, v >> 16);}
+static uint16_t get16(const uint8_t *p) {return p[0] | (uint16_t)p[1] << 8;}
+static uint32_t get32(const uint8_t *p) {return get16(p) | (uint32_t)get16(p+2) << 16;}
+
+// CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF)
+static uint16_t crc16(const uint8_t *p, uint32_t n)
+{
+	uint16_t crc = 0xFFFF;
+
+	while (n--) {
+		crc ^= (uint16_t)*p++ << 8;
+		for (uint8_t i = 0; i < 8; i++)
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+	}
+	return crc;
+}
+
+// Write a record in the selected form.
+// Return zero if successful, or non-zero otherwise.
+static int32_t capture_put(FILE *fp, bool text, const uint8_t *p, uint32_t n)
+{
+	if (!text) return fwrite(p, 1, n, fp) != n;
+	fputs("CAP:", fp);
+	for (uint32_t i = 0; i < n; i += 3) {
+		uint32_t v = (uint32_t)p[i] << 16;
+		if (i+1 < n) v |= (uint32_t)p[i+1] << 8;
+		if (i+2 < n) v |= p[i+2];
+		fputc(b64[v >> 18 & 0x3F], fp);
+		fputc(b64[v >> 12 & 0x3F], fp);
+		fputc((i+1 < n) ? b64[v >> 6 & 0x3F] : '=', fp);
+		fputc((i+2 < n) ? b64[v & 0x3F] : '=', fp);
+	}
+	return fputc('\n', fp) == EOF;
+}
+
+int32_t capture_init(uint32_t size, const capture_header_t *hdr)
+{
+	if (!size) return -1;
+	capture_free();
+#if CONFIG_SPIRAM
+	ring = heap_caps_malloc(size*sizeof(rx_data_t), MALLOC_CAP_SPIRAM);
+	if (ring == NULL)
+#endif
+	ring = malloc(size*sizeof(rx_data_t));
+	if (ring == NULL) abort();
+	rsize = size;
+	header = *hdr;
+	capture_reset();
+	enabled = true;
+	return 0;
+}
+
+void capture_free(void)
+{
+	free(ring); // Also releases PSRAM allocations
+	ring = NULL;
+	rsize = 0;
+	capture_reset();
+}
+
+void capture_reset(void)
+{
+	rpos = rcnt = 0;
+}
+
+void capture_enable(bool enable)
+{
+	enabled = enable;
+}
+
+void capture_addBlock(const rx_data_t *blk, uint32_t count)
+{
+	if (!enabled || ring == NULL) return;
+	if (count > rsize) { // Only the newest samples fit
+		blk += count - rsize;
+		count = rsize;
+	}
+	// Copy in at most two parts, split at the end of the ring.
+	uint32_t n = rsize - rpos;
+	if (n > count) n = count;
+	memcpy(ring + rpos, blk, n*sizeof(rx_data_t));
+	memcpy(ring, blk + n, (count - n)*sizeof(rx_data_t));
+	rpos += count;
+	if (rpos >= rsize) rpos -= rsize;
+	rcnt += count;
+	if (rcnt > rsize) rcnt = rsize;
+}
+
+uint32_t capture_getCount(void)
+{
+	return rcnt;
+}
+
+int32_t capture_dump(FILE *fp, bool text)
+{
+	uint8_t rec[FRAME_BYTES(CAPTURE_FRAME)];
+	uint32_t idx = (rcnt > rpos) ? rpos + rsize - rcnt : rpos - rcnt; // Oldest
+	uint32_t left = rcnt;
+	uint16_t seq = 0;
+	int32_t err = 0;
+	bool was = enabled;
+
+	enabled = false;
+	memcpy(rec, magic, sizeof(magic));
+	put16(rec+4, CAPTURE_VERSION);
+	put16(rec+6, CAPTURE_HEADER_SIZE);
+	put32(rec+8, header.sample_hz);
+	put16(rec+12, (uint16_t)header.gain);
+	put16(rec+14, header.bits);
+	put32(rec+16, header.unit_id);
+	put32(rec+20, rcnt);
+	err |= capture_put(fp, text, rec, CAPTURE_HEADER_SIZE);
+	while (left && !err) {
+		uint16_t n = (left < CAPTURE_FRAME) ? left : CAPTURE_FRAME;
+		put16(rec, CAPTURE_SYNC);
+		put16(rec+2, seq++);
+		put16(rec+4, n);
+		for (uint16_t i = 0; i < n; i++) {
+			put16(rec+6+2*i, ring[idx]);
+			if (++idx == rsize) idx = 0;
+		}
+		put16(rec+6+2*n, crc16(rec+2, 4+2*n));
+		err |= capture_put(fp, text, rec, FRAME_BYTES(n));
+		left -= n;
+	}
+	fflush(fp);
+	enabled = was;
+	return err;
+}
+
+// Read the next console log line into r->line.
+// Returns false at the end of the source.
+static bool capture_getline(capture_reader_t *r)
+{
+	uint16_t n = r->pend;
+
+	r->pend = 0;
+	if (n) { // Complete the line started while detecting the format
+		r->line[n] = '\0';
+		if (fgets(r->line+n, CAPTURE_LINE-n, r->fp) == NULL) r->line[n] = '\0';
+		return true;
+	}
+	return fgets(r->line, CAPTURE_LINE, r->fp) != NULL;
+}
+
+// Decode the base64 record following "CAP:" in r->line.
+// p: destination for the record.
+// size: capacity of p in bytes.
+// Returns the record length in bytes, or zero if the line has none.
+static uint32_t capture_decode(capture_reader_t *r, uint8_t *p, uint32_t size)
+{
+	const char *s = strstr(r->line, "CAP:");
+	uint32_t v = 0, bits = 0, n = 0;
+
+	if (s == NULL) return 0;
+	for (s += 4; *s && *s != '='; s++) {
+		const char *c = memchr(b64, *s, sizeof(b64)-1);
+		if (c == NULL) break;
+		v = v << 6 | (c - b64);
+		if ((bits += 6) >= 8) {
+			bits -= 8;
+			if (n == size) return 0;
+			p[n++] = v >> bits;
+		}
+	}
+	return n;
+}
+
+// Read the next record.
+// p: destination for the record.
+// size: capacity of p in bytes.
+// Returns the record length in bytes, or zero at the end of the source.
+static uint32_t capture_record(capture_reader_t *r, uint8_t *p, uint32_t size)
+{
+	if (r->text) {
+		while (capture_getline(r)) {
+			uint32_t n = capture_decode(r, p, size);
+			if (n) return n;
+		}
+		return 0;
+	}
+	// Binary frame, scan for the sync word
+	uint16_t sync = 0;
+	int c;
+	while (sync != CAPTURE_SYNC) {
+		if ((c = fgetc(r->fp)) == EOF) return 0;
+		sync = sync >> 8 | (uint16_t)c << 8;
+	}
+	put16(p, sync);
+	if (fread(p+2, 1, 4, r->fp) != 4) return 0;
+	uint16_t cnt = get16(p+4);
+	if (cnt > CAPTURE_FRAME) return 6; // Rejected by the caller
+	if (fread(p+6, 1, 2U*cnt+2U, r->fp) != 2U*cnt+2U) return 0;
+	return FRAME_BYTES(cnt);
+}
+
+int32_t capture_open(capture_reader_t *r, FILE *fp, capture_header_t *hdr)
+{
+	uint8_t rec[CAPTURE_HEADER_SIZE];
+	uint32_t n;
+
+	memset(r, 0, sizeof(capture_reader_t));
+	r->fp = fp;
+	if (fread(rec, 1, sizeof(magic), fp) != sizeof(magic)) return -1;
+	if (!memcmp(rec, magic, sizeof(magic))) {
+		if (fread(rec+4, 1, CAPTURE_HEADER_SIZE-4, fp) != CAPTURE_HEADER_SIZE-4)
+			return -1;
+	} else {
+		// Keep the bytes after the last newline as the start of a line
+		r->text = true;
+		for (n = sizeof(magic); n > 0 && rec[n-1] != '\n'; n--) ;
+		r->pend = sizeof(magic) - n;
+		memcpy(r->line, rec+n, r->pend);
+		do {
+			if (!capture_getline(r)) return -1;
+		} while (capture_decode(r, rec, sizeof(rec)) != CAPTURE_HEADER_SIZE ||
+			memcmp(rec, magic, sizeof(magic)));
+	}
+	if (get16(rec+4) != CAPTURE_VERSION) return -1;
+	hdr->sample_hz = get32(rec+8);
+	hdr->gain = (int16_t)get16(rec+12);
+	hdr->bits = get16(rec+14);
+	hdr->unit_id = get32(rec+16);
+	hdr->samples = get32(rec+20);
+	return 0;
+}
+
+uint32_t capture_read(capture_reader_t *r, rx_data_t *buf, uint32_t size)
+{
+	uint8_t rec[FRAME_BYTES(CAPTURE_FRAME)];
+	uint32_t n = 0;
+
+	while (n < size) {
+		if (r->off == r->count) {
+			uint32_t len = capture_record(r, rec, sizeof(rec));
+			if (!len) break;
+			uint16_t cnt = (len >= 6) ? get16(rec+4) : 0;
+			if (len < 6 || get16(rec) != CAPTURE_SYNC || cnt > CAPTURE_FRAME ||
+				len != FRAME_BYTES(cnt) ||
+				get16(rec+6+2*cnt) != crc16(rec+2, 4+2*cnt)) {
+				r->bad++;
+				continue;
+			}
+			uint16_t seq = get16(rec+2);
+			r->lost += (uint16_t)(seq - r->seq);
+			r->seq = seq + 1;
+			for (uint16_t i = 0; i < cnt; i++) r->frame[i] = get16(rec+6+2*i);
+			r->count = cnt;
+			r->off = 0;
+			continue;
+		}
+		buf[n++] = r->frame[r->off++];
+	}
+	return n;
+}
+
+void capture_close(capture_reader_t *r)
+{
+	r->fp = NULL;
+	r->count = r->off = r->pend = 0;
+}
@@ -0,0 +1,107 @@
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rx.h"
+
+// Records raw receive samples (rx_data_t) in a RAM ring so the optical
+// signal around a missed hit can be brought back to a desk. The ring is
+// allocated in PSRAM if present and always holds the most recent samples.
+//
+// A capture is a header followed by frames of up to CAPTURE_FRAME samples.
+// All fields are little-endian.
+//   header: magic "LTCP", version:u16, header size:u16, sample rate:u32,
+//           gain:i16 (tenths of dB), bits:u16, unit ID:u32, samples:u32
+//   frame:  sync:u16 (CAPTURE_SYNC), sequence:u16, count:u16,
+//           samples:u16[count], crc:u16 (CRC-16/CCITT of sequence..samples)
+// A capture file holds the records back to back. Over the console, each
+// record is sent as a text line "CAP:" followed by the record in base64, so
+// it survives newline translation and can be cut from a log with other
+// output around it. capture_open() reads either form.
+
+#define CAPTURE_VERSION 1
+#define CAPTURE_FRAME 64 // Max samples per frame
+#define CAPTURE_SYNC 0x5AA5
+#define CAPTURE_HEADER_SIZE 24 // Bytes
+#define CAPTURE_LINE 512 // Max length of a console log line
+
+// Capture header
+typedef struct {
+	uint32_t sample_hz; // Sample rate in Hz
+	int16_t gain; // Receiver gain in tenths of dB
+	uint16_t bits; // Significant bits per sample
+	uint32_t unit_id; // Identifies the tag unit
+	uint32_t samples; // Samples in the capture
+} capture_header_t;
+
+// Capture reader
+typedef struct {
+	FILE *fp; // Capture source
+	bool text; // Source is a console log
+	char line[CAPTURE_LINE]; // Current console log line
+	uint16_t pend; // Bytes of the next line already read into line[]
+	uint16_t seq; // Next expected frame sequence number
+	rx_data_t frame[CAPTURE_FRAME]; // Current frame
+	uint16_t count; // Samples in the current frame
+	uint16_t off; // Samples consumed from the current frame
+	uint32_t bad; // Frames dropped due to a bad checksum
+	uint32_t lost; // Frames missing from the sequence
+} capture_reader_t;
+
+// Initialize the recorder. Allocate the ring for the specified number of
+// samples. If malloc() fails, abort() is called to print an error message
+// and terminate. Recording is enabled.
+// size: capacity of the ring in samples.
+// hdr: header fields recorded with the capture (samples is ignored).
+// Return zero if successful, or non-zero otherwise.
+int32_t capture_init(uint32_t size, const capture_header_t *hdr);
+
+// Free the storage allocated for the recorder.
+void capture_free(void);
+
+// Discard all recorded samples.
+void capture_reset(void);
+
+// Enable or disable recording. Disable recording to freeze the ring, for
+// example right after a missed hit is noticed.
+// enable: if true, enable recording, otherwise disable.
+void capture_enable(bool enable);
+
+// Record a block of samples. Must be called from the same task as
+// capture_dump().
+// blk: samples to record.
+// count: number of samples in the block.
+void capture_addBlock(const rx_data_t *blk, uint32_t count);
+
+// Return the number of samples in the ring.
+uint32_t capture_getCount(void);
+
+// Write the recorded samples, oldest first. Recording is paused during
+// the dump.
+// fp: destination, for example stdout for the console.
+// text: if true, write "CAP:" base64 lines, otherwise write binary.
+// Return zero if successful, or non-zero otherwise.
+int32_t capture_dump(FILE *fp, bool text);
+
+// Open a capture for reading and read its header. The format (binary or
+// console log) is detected from the first bytes.
+// r: reader data structure.
+// fp: capture source, owned by the caller.
+// hdr: set to the capture header.
+// Return zero if successful, or non-zero otherwise.
+int32_t capture_open(capture_reader_t *r, FILE *fp, capture_header_t *hdr);
+
+// Read samples from a capture. Frames with a bad checksum are skipped and
+// counted in r->bad; gaps in the frame sequence are counted in r->lost.
+// buf: buffer to fill.
+// size: capacity of the buffer in samples.
+// Returns the number of samples read, zero at the end of the capture.
+uint32_t capture_read(capture_reader_t *r, rx_data_t *buf, uint32_t size);
+
+// Release resources used by the reader. Does not close r->fp.
+void capture_close(capture_reader_t *r);
+
+#endif // CAPTURE_H_
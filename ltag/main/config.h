@@ -6,6 +6,7 @@
 #define CONFIG_LOCKOUT_PERIOD 500 // ms
 #define CONFIG_HITLED_PERIOD 500 // ms
 #define CONFIG_INVINCIBILITY_PERIOD 5000 // ms
+#define CONFIG_TRIGGER_SETTLE 50 // ms, debounce time of trigger_irq.c
 
 #if CONFIG_IDF_TARGET_ESP32
 #define CONFIG_SND_SAMPLE_RATE 24000 // samples/sec
@@ -15,11 +16,37 @@
 #define CONFIG_RX_SAMPLE_RATE 80000 // samples/sec
 #endif
 
+#define CONFIG_RX_DUAL_RATE (CONFIG_RX_SAMPLE_RATE/2) // samples/sec per sensor, rx_init_dual()
+#define CONFIG_RX_FRAME 256 // samples per ADC frame (block)
+#define CONFIG_RX_FRAMES 16 // blocks buffered by the receiver
+#define CONFIG_RX_GAIN (-120) // tenths of dB, recorded in captures
+#if CONFIG_SPIRAM
+#define CONFIG_CAPTURE_MS 5000 // raw receive capture length in ms
+#else
+#define CONFIG_CAPTURE_MS 200 // raw receive capture length in ms
+#endif
+
 #define CONFIG_TX_PULSE 200 // ms
+// Short-pulse mode sends a coded burst instead of a long pulse.
+#define CONFIG_TX_CODE 0x1F35 // Barker-13 chip pattern, first chip in MSB
+#define CONFIG_TX_CODE_CHIPS 13 // chips in code
+#define CONFIG_TX_CHIP 4000 // us
+#define CONFIG_TX_CODE_THRESH 8.0f // matched filter hit quality
+#define CONFIG_TX_CODED 0 // 1: the event game (game_ev.c) shoots coded bursts
+// Identity shots send a sequence of tones that encodes the shooter.
+#define CONFIG_TX_ID_TONES 3 // tones per shot, the first on the team channel
+#define CONFIG_TX_ID_TONE 70 // ms per tone
+#define CONFIG_TX_ID 0 // 1: the event game (game_ev.c) shoots identity shots
+#define CONFIG_GAME_PLAYER 0 // player ID sent in identity shots
 #define CONFIG_SHOT_COUNT 10 // max shot count
 #define CONFIG_SHOT_RELOAD_PERIOD 3000 // ms
 
 #define CONFIG_GAMEOVER_DELAY 1000 // ms
+#define CONFIG_GAME_LIVES 3 // lives per game
+#define CONFIG_GAME_HITS 5 // hits per life
+#define CONFIG_GAME_BASE_PERIOD 10000 // ms, return to base reminder
+#define CONFIG_GAME_TEAM_A 6 // channel
+#define CONFIG_GAME_TEAM_B 9 // channel
 
 #define CONFIG_PLAY_FREQ \
 	{1250, 1481, 1739, 2000, 2353, 2667, 3077, 3333, 3636, 4000}
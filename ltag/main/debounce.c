@@ -0,0 +1,38 @@
+#include "esp_attr.h" // IRAM_ATTR
+
+#include "debounce.h"
+
+void debounce_init(debounce_t *d, uint32_t settle_us, bool level)
+{
+	d->settle_us = settle_us;
+	d->stable = d->raw = level;
+	d->edge_us = 0;
+	d->armed = false;
+	d->due_us = 0;
+	d->edges = 0;
+}
+
+bool IRAM_ATTR debounce_edge(debounce_t *d, bool level, int64_t t_us)
+{
+	d->raw = level;
+	d->edge_us = t_us;
+	d->edges++;
+	if (d->armed) return false; // The expiry checks the edge time
+	d->armed = true;
+	d->due_us = t_us + d->settle_us;
+	return true;
+}
+
+debounce_event_t debounce_expire(debounce_t *d, bool level, int64_t t_us)
+{
+	if (!d->armed) return DEBOUNCE_NONE;
+	if (level != d->raw) debounce_edge(d, level, t_us); // Missed edge
+	if (t_us - d->edge_us < d->settle_us) { // Still bouncing
+		d->due_us = d->edge_us + d->settle_us;
+		return DEBOUNCE_NONE;
+	}
+	d->armed = false;
+	if (d->raw == d->stable) return DEBOUNCE_NONE; // Glitch
+	d->stable = d->raw;
+	return d->stable ? DEBOUNCE_PRESSED : DEBOUNCE_RELEASED;
+}
@@ -0,0 +1,66 @@
+#ifndef DEBOUNCE_H_
+#define DEBOUNCE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Event-driven debounce state machine for a switch input. Instead of
+// sampling the input every tick, the caller reports each edge with a
+// timestamp (from a GPIO interrupt) and runs a one-shot timer. The input
+// is debounced once it has stayed at one level for the settle time after
+// its last edge. Bounces only update the edge time, so the timer is
+// started once per burst of edges and restarted only if the input was
+// still bouncing when it expired.
+//
+// The state machine does no I/O and takes time as a parameter, so it can
+// be driven by scripted edges and a simulated clock. The caller provides
+// the locking when edges and expiries come from different contexts.
+//
+// Typical driver:
+//   edge ISR:     if (debounce_edge(&d, level, now)) start timer at d.due_us
+//   timer expiry: e = debounce_expire(&d, level, now);
+//                 if (d.armed) start timer at d.due_us
+//                 if (e == DEBOUNCE_PRESSED) ...
+
+// Debounced event
+typedef enum {
+	DEBOUNCE_NONE,
+	DEBOUNCE_PRESSED, // The debounced level became active
+	DEBOUNCE_RELEASED, // The debounced level became inactive
+} debounce_event_t;
+
+// Debounce state
+typedef struct {
+	uint32_t settle_us; // Time the input must be stable
+	bool stable; // Debounced level, true if active
+	bool raw; // Last raw level seen
+	int64_t edge_us; // Time of the last raw edge
+	bool armed; // The timer must expire at due_us
+	int64_t due_us; // Time the pending expiry is due
+	uint32_t edges; // Raw edges seen, for statistics
+} debounce_t;
+
+// Initialize the state machine.
+// d: debounce state.
+// settle_us: time in microseconds the input must be stable.
+// level: current input level, true if active.
+void debounce_init(debounce_t *d, uint32_t settle_us, bool level);
+
+// Record an edge of the input. Safe to call from an ISR.
+// d: debounce state.
+// level: input level after the edge, true if active.
+// t_us: time of the edge in microseconds.
+// Returns true if the caller must start the timer to expire at d->due_us.
+bool debounce_edge(debounce_t *d, bool level, int64_t t_us);
+
+// Handle the expiry of the timer. If d->armed is still true afterwards,
+// the input was still bouncing and the caller must start the timer again
+// to expire at d->due_us. An edge missed by the interrupt is caught here
+// by comparing the current level with the last one seen.
+// d: debounce state.
+// level: input level now, true if active.
+// t_us: current time in microseconds.
+// Returns the debounced event, if any.
+debounce_event_t debounce_expire(debounce_t *d, bool level, int64_t t_us);
+
+#endif // DEBOUNCE_H_
@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "detector_ctx.h"
+
+#define MEDIAN_INDEX ((FILTER_CHANNELS-1)/2)
+
+struct detector_ctx {
+	filter_ctx_t *filter; // Supplies the energy values
+	bool enabled[FILTER_CHANNELS]; // Channels enabled for hit detection
+	filter_data_t threshFactor; // Rise threshold factor
+	filter_data_t fallFactor; // Fall threshold factor
+	uint16_t dwell; // Samples above threshold needed for a hit
+	uint16_t dwellCount; // Consecutive samples above threshold so far
+	uint16_t dwellChan; // Channel above threshold
+	bool armed; // False after a hit until below the fall threshold
+	bool ignoreAll;
+	bool hit; // A hit was detected and not cleared
+	uint16_t hitChan; // Channel of the last hit
+};
+
+detector_ctx_t *detector_ctx_init(filter_ctx_t *f)
+{
+	detector_ctx_t *d = calloc(1, sizeof(detector_ctx_t));
+	if (d == NULL) {
+		printf("detector_ctx: out of memory\n");
+		abort();
+	}
+	d->filter = f;
+	for (uint16_t c = 0; c < FILTER_CHANNELS; c++) d->enabled[c] = true;
+	d->threshFactor = DETECTOR_CTX_THRESH_FACTOR;
+	d->dwell = 1;
+	d->armed = true;
+	return d;
+}
+
+void detector_ctx_free(detector_ctx_t *d)
+{
+	free(d);
+}
+
+void detector_ctx_setChannels(detector_ctx_t *d, const bool chanArray[])
+{
+	memcpy(d->enabled, chanArray, sizeof(d->enabled));
+}
+
+void detector_ctx_setThreshFactor(detector_ctx_t *d, filter_data_t tfac)
+{
+	d->threshFactor = tfac;
+}
+
+void detector_ctx_setQualify(detector_ctx_t *d, filter_data_t fallFactor, uint16_t dwell)
+{
+	d->fallFactor = fallFactor;
+	d->dwell = dwell ? dwell : 1;
+	d->dwellCount = 0;
+	d->armed = true;
+}
+
+void detector_ctx_ignoreAllHits(detector_ctx_t *d, bool flagValue)
+{
+	d->ignoreAll = flagValue;
+}
+
+// Return the median of the energy values. Sorted by insertion, which is
+// quick for a handful of channels.
+static filter_data_t detector_ctx_median(const filter_data_t energyValues[])
+{
+	filter_data_t s[FILTER_CHANNELS];
+
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) {
+		filter_data_t v = energyValues[i];
+		uint16_t j = i;
+		for (; j > 0 && s[j-1] > v; j--) s[j] = s[j-1];
+		s[j] = v;
+	}
+	return s[MEDIAN_INDEX];
+}
+
+void detector_ctx_checkHit(detector_ctx_t *d, const filter_data_t energyValues[])
+{
+	filter_data_t median = detector_ctx_median(energyValues);
+
+	// Re-arm once the energy of the last hit channel has fallen.
+	if (!d->armed && energyValues[d->hitChan] < median * d->fallFactor) d->armed = true;
+	if (d->ignoreAll || d->hit || !d->armed) return;
+
+	int16_t max = -1;
+	for (uint16_t c = 0; c < FILTER_CHANNELS; c++)
+		if (d->enabled[c] && (max < 0 || energyValues[c] > energyValues[max])) max = c;
+	if (max < 0 || energyValues[max] <= median * d->threshFactor) {
+		d->dwellCount = 0;
+		return;
+	}
+	if (d->dwellCount == 0 || max != d->dwellChan) {
+		d->dwellChan = max;
+		d->dwellCount = 0;
+	}
+	if (++d->dwellCount < d->dwell) return;
+	d->dwellCount = 0;
+	d->hit = true;
+	d->hitChan = max;
+	d->armed = d->fallFactor <= (filter_data_t)0.0;
+}
+
+bool detector_ctx_getHit(const detector_ctx_t *d)
+{
+	return d->hit;
+}
+
+uint16_t detector_ctx_getHitChannel(const detector_ctx_t *d)
+{
+	return d->hitChan;
+}
+
+void detector_ctx_clearHit(detector_ctx_t *d)
+{
+	d->hit = false;
+}
+
+uint32_t detector_ctx_runBlock(detector_ctx_t *d, const rx_data_t *blk, uint32_t count)
+{
+	const filter_data_t half = (filter_data_t)(1U << (DETECTOR_CTX_ADC_BITS-1));
+	filter_data_t energy[FILTER_CHANNELS];
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (!filter_ctx_addSample(d->filter, (filter_data_t)blk[i] / half - (filter_data_t)1.0))
+			continue;
+		filter_ctx_getEnergyArray(d->filter, energy);
+		detector_ctx_checkHit(d, energy);
+		if (d->hit) return i+1;
+	}
+	return count;
+}
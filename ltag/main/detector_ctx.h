@@ -0,0 +1,86 @@
+#ifndef DETECTOR_CTX_H_
+#define DETECTOR_CTX_H_
+
+// Instance-based hit detector for the filter instances of filter_ctx.h.
+// An instance checks the energy values of its filter instance like
+// detector_checkHit(): a hit is the highest enabled channel above the
+// median energy of all channels times the threshold factor, skipped while
+// ignoring hits or until a previous hit is cleared. Hits can also be
+// qualified with a dwell count and a fall threshold, see
+// detector_ctx_setQualify(). Instances keep their own settings and hit
+// state, so several receivers or streams can be processed side by side,
+// one instance per task or thread. The detector.h functions are not used.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filter_ctx.h"
+#include "rx.h" // rx_data_t
+
+// Significant bits per ADC sample, used to scale samples in
+// detector_ctx_runBlock()
+#define DETECTOR_CTX_ADC_BITS 12
+// Default threshold factor
+#define DETECTOR_CTX_THRESH_FACTOR 5.0f
+
+// Detector instance, see detector_ctx_init()
+typedef struct detector_ctx detector_ctx_t;
+
+// Allocate and initialize a detector instance. By default, all channels
+// are considered for hits with a threshold factor of
+// DETECTOR_CTX_THRESH_FACTOR. If malloc() fails, abort() is called to
+// print an error message and terminate.
+// f: filter instance that supplies the energy values.
+// Returns the detector instance.
+detector_ctx_t *detector_ctx_init(filter_ctx_t *f);
+
+// Free the storage allocated for a detector instance. The filter instance
+// is not freed.
+void detector_ctx_free(detector_ctx_t *d);
+
+// Set channels that are enabled for hit detection, like
+// detector_setChannels().
+void detector_ctx_setChannels(detector_ctx_t *d, const bool chanArray[]);
+
+// Set the threshold factor used in determining a hit.
+void detector_ctx_setThreshFactor(detector_ctx_t *d, filter_data_t tfac);
+
+// Set the hit qualification parameters. The threshold factor sets the rise
+// threshold. A hit is registered only after the same channel stays above
+// the rise threshold for dwell consecutive calls to detector_ctx_checkHit()
+// (one call per decimated sample). After a hit, the instance reports no
+// further hits until the energy of the hit channel falls below the fall
+// threshold, so a pulse envelope yields one hit. The fall threshold is
+// computed like the rise threshold using fallFactor, which should not
+// exceed the threshold factor. A zero fallFactor re-arms the instance as
+// soon as the hit is cleared. The defaults are a zero fallFactor and a
+// dwell of one, so a single sample above threshold is a hit.
+// fallFactor: threshold factor used to re-arm the instance after a hit.
+// dwell: number of consecutive samples above threshold needed for a hit.
+void detector_ctx_setQualify(detector_ctx_t *d, filter_data_t fallFactor, uint16_t dwell);
+
+// Ignore all hits if the flag is true.
+void detector_ctx_ignoreAllHits(detector_ctx_t *d, bool flagValue);
+
+// Check the energy values for a hit, like detector_checkHit().
+void detector_ctx_checkHit(detector_ctx_t *d, const filter_data_t energyValues[]);
+
+// Returns true if a hit was detected.
+bool detector_ctx_getHit(const detector_ctx_t *d);
+
+// Returns the channel that had a hit.
+uint16_t detector_ctx_getHitChannel(const detector_ctx_t *d);
+
+// Clear the detected hit once you have accounted for it.
+void detector_ctx_clearHit(detector_ctx_t *d);
+
+// Run the receive path for a block of samples from the ADC (or a
+// capture): scale each sample, add it to the filter instance, and check
+// for a hit after each decimated sample. Stops early at a hit, so the
+// caller can account for it before processing the rest of the block.
+// blk: raw ADC samples.
+// count: number of samples in the block.
+// Returns the number of samples processed.
+uint32_t detector_ctx_runBlock(detector_ctx_t *d, const rx_data_t *blk, uint32_t count);
+
+#endif // DETECTOR_CTX_H_
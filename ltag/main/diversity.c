@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h> // abort
+
+#include "diversity.h"
+
+// Initialize a diversity receiver.
+// v: diversity receiver.
+// mode: how the sensor energies are combined.
+// bits: significant bits per ADC sample.
+// freq_hz: sample frequency of each sensor in Hz.
+void diversity_init(diversity_t *v, diversity_mode_t mode, uint16_t bits, uint32_t freq_hz)
+{
+	for (uint16_t s = 0; s < DIVERSITY_SENSORS; s++) {
+		v->filter[s] = filter_ctx_init();
+		if (filter_ctx_setInputRate(v->filter[s], freq_hz)) {
+			printf("diversity: unsupported sample rate:%lu Hz\n", (unsigned long)freq_hz);
+			abort();
+		}
+	}
+	v->detector = detector_ctx_init(v->filter[0]);
+	v->mode = mode;
+	v->half = (filter_data_t)(1U << (bits-1));
+	diversity_reset(v);
+}
+
+// Free the instances allocated for the diversity receiver.
+// v: diversity receiver.
+void diversity_free(diversity_t *v)
+{
+	detector_ctx_free(v->detector);
+	for (uint16_t s = 0; s < DIVERSITY_SENSORS; s++)
+		filter_ctx_free(v->filter[s]);
+}
+
+// Reset the filter instances and clear any hit.
+// v: diversity receiver.
+void diversity_reset(diversity_t *v)
+{
+	for (uint16_t s = 0; s < DIVERSITY_SENSORS; s++)
+		filter_ctx_reset(v->filter[s]);
+	for (uint16_t c = 0; c < FILTER_CHANNELS; c++)
+		v->energy[c] = 0.0f;
+	detector_ctx_clearHit(v->detector);
+}
+
+// Run the receive path for a block of interleaved sensor pairs.
+// v: diversity receiver.
+// blk: interleaved raw ADC samples, blk[2*i] from the first sensor.
+// count: number of samples in the block.
+// Returns the number of samples processed.
+uint32_t diversity_runBlock(diversity_t *v, const rx_data_t *blk, uint32_t count)
+{
+	filter_data_t e0[FILTER_CHANNELS], e1[FILTER_CHANNELS];
+	const filter_data_t half = v->half;
+	uint32_t i;
+
+	for (i = 0; i+1 < count; ) {
+		filter_data_t x0 = (filter_data_t)blk[i++] / half - (filter_data_t)1.0;
+		filter_data_t x1 = (filter_data_t)blk[i++] / half - (filter_data_t)1.0;
+		if (!filter_ctx_addPair(v->filter[0], v->filter[1], x0, x1)) continue;
+		filter_ctx_getEnergyArray(v->filter[0], e0);
+		filter_ctx_getEnergyArray(v->filter[1], e1);
+		if (v->mode == DIVERSITY_SUM) {
+			for (uint16_t c = 0; c < FILTER_CHANNELS; c++)
+				v->energy[c] = e0[c] + e1[c];
+		} else {
+			for (uint16_t c = 0; c < FILTER_CHANNELS; c++)
+				v->energy[c] = (e0[c] > e1[c]) ? e0[c] : e1[c];
+		}
+		detector_ctx_checkHit(v->detector, v->energy);
+		if (detector_ctx_getHit(v->detector)) break;
+	}
+	return i;
+}
+
+// Return the sensor with the higher energy on a channel.
+// v: diversity receiver.
+// chan: filter channel.
+uint16_t diversity_getSensor(diversity_t *v, uint16_t chan)
+{
+	return filter_ctx_getEnergyValue(v->filter[1], chan) >
+		filter_ctx_getEnergyValue(v->filter[0], chan);
+}
@@ -0,0 +1,81 @@
+#ifndef DIVERSITY_H_
+#define DIVERSITY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "detector_ctx.h"
+#include "filter_ctx.h"
+#include "rx.h"
+
+// Combines two receive sensors, for example one on each side of a vest, so
+// a hit is seen when either sensor faces the shooter. Each sensor has its
+// own filter instance. The blocks from rx_init_dual() hold interleaved
+// sensor pairs, sampled at CONFIG_RX_DUAL_RATE so the ADC scan fits the
+// limit of the target. Each pair goes to both filter instances in a single
+// pass (filter_ctx_addPair()), which share the FIR coefficient loads and
+// decimate on the same pair. Then the energies of each channel are
+// combined and checked once by the detector instance, so hit detection is
+// not repeated per sensor.
+//
+// Typical block consumer:
+//   const rx_data_t *blk;
+//   uint32_t cnt, n;
+//   while ((blk = rx_get_block(&cnt)) != NULL) {
+//     for (uint32_t i = 0; i < cnt; i += n) {
+//       n = diversity_runBlock(&v, blk+i, cnt-i);
+//       if (detector_ctx_getHit(v.detector)) ... account for the hit ...
+//     }
+//     rx_release_block();
+//   }
+
+#define DIVERSITY_SENSORS 2
+
+// How the energies of the two sensors are combined for each channel.
+typedef enum {
+	DIVERSITY_MAX, // Use the stronger sensor, selection combining
+	DIVERSITY_SUM, // Add the sensor energies, equal gain combining
+} diversity_mode_t;
+
+// Diversity receiver
+typedef struct {
+	filter_ctx_t *filter[DIVERSITY_SENSORS]; // One pipeline per sensor
+	detector_ctx_t *detector; // Checks the combined energies
+	diversity_mode_t mode;
+	filter_data_t half; // Half of the ADC full scale
+	filter_data_t energy[FILTER_CHANNELS]; // Last combined energies
+} diversity_t;
+
+// Initialize a diversity receiver. Allocates both filter instances and
+// the detector instance with its defaults. Assumes filter_init() was
+// called previously. If malloc() fails or the sample frequency is not
+// supported, abort() is called to print an error message and terminate.
+// v: diversity receiver.
+// mode: how the sensor energies are combined.
+// bits: significant bits per ADC sample.
+// freq_hz: sample frequency of each sensor in Hz, as given to
+//   rx_init_dual(), see filter_ctx_setInputRate().
+void diversity_init(diversity_t *v, diversity_mode_t mode, uint16_t bits, uint32_t freq_hz);
+
+// Free the instances allocated for the diversity receiver.
+void diversity_free(diversity_t *v);
+
+// Reset the filter instances and clear any hit.
+void diversity_reset(diversity_t *v);
+
+// Run the receive path for a block of interleaved sensor pairs: scale
+// each sample, add it to the filter instance of its sensor, and check the
+// combined energies for a hit after each decimated pair. Stops early at a
+// hit, like detector_ctx_runBlock(). An odd sample at the end is not
+// processed.
+// blk: interleaved raw ADC samples, blk[2*i] from the first sensor.
+// count: number of samples in the block.
+// Returns the number of samples processed.
+uint32_t diversity_runBlock(diversity_t *v, const rx_data_t *blk, uint32_t count);
+
+// Return the sensor with the higher energy on a channel. Useful to tell
+// which side of the vest was hit.
+// chan: filter channel.
+uint16_t diversity_getSensor(diversity_t *v, uint16_t chan);
+
+#endif // DIVERSITY_H_
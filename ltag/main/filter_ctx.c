@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h" // CONFIG_RX_SAMPLE_RATE
+#include "filter_ctx.h"
+
+#define SOS_B 3 // Feed-forward coefficients of a section
+#define SOS_A 2 // Feedback coefficients of a section, a0 of one
+
+struct filter_ctx {
+	uint32_t taps; // FIR coefficients
+	filter_data_t *fir; // FIR coefficients, first applied to the newest input
+	filter_data_t *x; // FIR input history, twice the taps, newest at x[xpos]
+	uint32_t xpos;
+	uint16_t decim; // Decimation factor at the input rate
+	uint16_t count; // Inputs since the last FIR computation
+	uint32_t sections; // IIR second-order sections per channel
+	filter_data_t *b; // Per channel and section: b0 b1 b2
+	filter_data_t *a; // Per channel and section: a1 a2, over a0
+	filter_data_t *w; // Per channel and section: two state values
+	uint32_t window; // Energy window length in decimated samples
+	filter_data_t *e; // Per channel: squared IIR outputs in the window
+	uint32_t epos; // Position of the oldest value in the window
+	filter_data_t energy[FILTER_CHANNELS]; // Current energy, per channel
+};
+
+// Allocate zeroed storage, or abort.
+static void *filter_ctx_alloc(size_t n, size_t size)
+{
+	void *p = calloc(n, size);
+	if (p == NULL) {
+		printf("filter_ctx: out of memory\n");
+		abort();
+	}
+	return p;
+}
+
+filter_ctx_t *filter_ctx_init(void)
+{
+	filter_ctx_t *f = filter_ctx_alloc(1, sizeof(filter_ctx_t));
+	uint32_t ncoef = filter_getIirSosCoefCount();
+
+	f->taps = filter_getFirCoefCount();
+	f->fir = filter_ctx_alloc(f->taps, sizeof(filter_data_t));
+	memcpy(f->fir, filter_getFirCoefArray(), f->taps*sizeof(filter_data_t));
+	f->x = filter_ctx_alloc(2*f->taps, sizeof(filter_data_t));
+	f->decim = FILTER_FIR_DECIMATION_FACTOR;
+	f->sections = filter_getIirSosSectionCount();
+	f->b = filter_ctx_alloc(FILTER_CHANNELS*f->sections*SOS_B, sizeof(filter_data_t));
+	f->a = filter_ctx_alloc(FILTER_CHANNELS*f->sections*SOS_A, sizeof(filter_data_t));
+	f->w = filter_ctx_alloc(FILTER_CHANNELS*f->sections*2, sizeof(filter_data_t));
+	for (uint16_t c = 0; c < FILTER_CHANNELS; c++) {
+		const filter_data_t *sos = filter_getIirSosCoefArray(c);
+		for (uint32_t s = 0; s < f->sections; s++, sos += ncoef) {
+			filter_data_t *b = f->b + (c*f->sections + s)*SOS_B;
+			filter_data_t *a = f->a + (c*f->sections + s)*SOS_A;
+			filter_data_t a0 = (ncoef > SOS_B+SOS_A) ? sos[SOS_B] : (filter_data_t)1.0;
+			const filter_data_t *fb = sos + ncoef - SOS_A;
+			for (uint16_t i = 0; i < SOS_B; i++) b[i] = sos[i] / a0;
+			for (uint16_t i = 0; i < SOS_A; i++) a[i] = fb[i] / a0;
+		}
+	}
+	f->e = filter_ctx_alloc(FILTER_CHANNELS*FILTER_ENERGY_SAMPLE_COUNT, sizeof(filter_data_t));
+	f->window = FILTER_ENERGY_SAMPLE_COUNT;
+	filter_ctx_reset(f);
+	return f;
+}
+
+void filter_ctx_free(filter_ctx_t *f)
+{
+	if (f == NULL) return;
+	free(f->fir);
+	free(f->x);
+	free(f->b);
+	free(f->a);
+	free(f->w);
+	free(f->e);
+	free(f);
+}
+
+void filter_ctx_reset(filter_ctx_t *f)
+{
+	memset(f->x, 0, 2*f->taps*sizeof(filter_data_t));
+	f->xpos = 0;
+	f->count = 0;
+	memset(f->w, 0, FILTER_CHANNELS*f->sections*2*sizeof(filter_data_t));
+	filter_ctx_setEnergyWindow(f, f->window);
+}
+
+void filter_ctx_setEnergyWindow(filter_ctx_t *f, uint32_t count)
+{
+	if (count < 1) count = 1;
+	if (count > FILTER_ENERGY_SAMPLE_COUNT) count = FILTER_ENERGY_SAMPLE_COUNT;
+	f->window = count;
+	memset(f->e, 0, FILTER_CHANNELS*FILTER_ENERGY_SAMPLE_COUNT*sizeof(filter_data_t));
+	f->epos = 0;
+	for (uint16_t c = 0; c < FILTER_CHANNELS; c++) f->energy[c] = 0;
+}
+
+int32_t filter_ctx_setInputRate(filter_ctx_t *f, uint32_t freq_hz)
+{
+	const filter_data_t *h = filter_getFirCoefArray();
+	uint32_t k = freq_hz ? CONFIG_RX_SAMPLE_RATE / freq_hz : 0;
+
+	if (!k || k*freq_hz != CONFIG_RX_SAMPLE_RATE || FILTER_FIR_DECIMATION_FACTOR % k)
+		return -1;
+	f->taps = (filter_getFirCoefCount() + k - 1) / k;
+	for (uint32_t i = 0; i < f->taps; i++) f->fir[i] = h[i*k] * (filter_data_t)k;
+	f->decim = FILTER_FIR_DECIMATION_FACTOR / k;
+	filter_ctx_reset(f);
+	return 0;
+}
+
+// Save an input in the FIR history. Each input is written twice, so the
+// taps always read a contiguous run from x[xpos].
+static inline void filter_ctx_save(filter_ctx_t *f, filter_data_t in)
+{
+	f->xpos = f->xpos ? f->xpos - 1 : f->taps - 1;
+	f->x[f->xpos] = f->x[f->xpos + f->taps] = in;
+}
+
+// Run the IIR filter of a channel, second-order sections in transposed
+// direct form II, and add its squared output to the energy window.
+static inline void filter_ctx_channel(filter_ctx_t *f, uint16_t c, filter_data_t in)
+{
+	uint32_t k = c*f->sections;
+	const filter_data_t *b = f->b + k*SOS_B, *a = f->a + k*SOS_A;
+	filter_data_t *w = f->w + k*2;
+
+	for (uint32_t s = 0; s < f->sections; s++, b += SOS_B, a += SOS_A, w += 2) {
+		filter_data_t out = b[0]*in + w[0];
+		w[0] = b[1]*in - a[0]*out + w[1];
+		w[1] = b[2]*in - a[1]*out;
+		in = out;
+	}
+	filter_data_t *e = f->e + c*FILTER_ENERGY_SAMPLE_COUNT + f->epos;
+	filter_data_t sq = in*in;
+	f->energy[c] += sq - *e;
+	*e = sq;
+}
+
+bool filter_ctx_addSample(filter_ctx_t *f, filter_data_t in)
+{
+	filter_ctx_save(f, in);
+	if (++f->count < f->decim) return false;
+	f->count = 0;
+
+	const filter_data_t *x = f->x + f->xpos;
+	filter_data_t y = 0;
+	for (uint32_t i = 0; i < f->taps; i++) y += f->fir[i] * x[i];
+	for (uint16_t c = 0; c < FILTER_CHANNELS; c++) filter_ctx_channel(f, c, y);
+	if (++f->epos == f->window) f->epos = 0;
+	return true;
+}
+
+bool filter_ctx_addPair(filter_ctx_t *a, filter_ctx_t *b, filter_data_t ina, filter_data_t inb)
+{
+	filter_ctx_save(a, ina);
+	filter_ctx_save(b, inb);
+	if (++a->count < a->decim) return false;
+	a->count = 0;
+
+	// One pass over the taps computes both FIR outputs.
+	const filter_data_t *xa = a->x + a->xpos, *xb = b->x + b->xpos;
+	filter_data_t ya = 0, yb = 0;
+	for (uint32_t i = 0; i < a->taps; i++) {
+		filter_data_t h = a->fir[i];
+		ya += h * xa[i];
+		yb += h * xb[i];
+	}
+	for (uint16_t c = 0; c < FILTER_CHANNELS; c++) {
+		filter_ctx_channel(a, c, ya);
+		filter_ctx_channel(b, c, yb);
+	}
+	if (++a->epos == a->window) a->epos = 0;
+	if (++b->epos == b->window) b->epos = 0;
+	return true;
+}
+
+filter_data_t filter_ctx_getEnergyValue(const filter_ctx_t *f, uint16_t chan)
+{
+	return f->energy[chan];
+}
+
+void filter_ctx_getEnergyArray(const filter_ctx_t *f, filter_data_t energy[])
+{
+	memcpy(energy, f->energy, sizeof(f->energy));
+}
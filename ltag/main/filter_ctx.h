@@ -0,0 +1,75 @@
+#ifndef FILTER_CTX_H_
+#define FILTER_CTX_H_
+
+// Instance-based receive filter pipeline. An instance runs the same three
+// stages as filter.h (decimating FIR filter, bank of IIR filters, energy
+// over a window) on its own state, so several streams can be processed
+// side by side: a second receiver, or one stream per thread in a host
+// tool. The module itself keeps no state, so instances in different tasks
+// or threads run concurrently.
+//
+// The coefficients are taken from the filter module with its
+// verification-assisting functions (filter_getFirCoefArray() and
+// filter_getIirSosCoefArray()), so an instance filters like filter.c. The
+// IIR coefficients of a section are in the order b0 b1 b2 a0 a1 a2, or
+// b0 b1 b2 a1 a2 with a0 of one. The filter.h functions themselves are
+// not used, so they keep working on their own state.
+//
+// An instance can also take its input at a fraction of
+// CONFIG_RX_SAMPLE_RATE, the rate the FIR filter is designed for, as each
+// sensor does with two receivers (rx_init_dual()). The FIR filter then uses
+// every k-th coefficient, scaled by k, and decimates by k less, so the IIR
+// filters and the energy window run at the same decimated rate.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filter.h" // filter_data_t, FILTER_*
+
+// Filter instance, see filter_ctx_init()
+typedef struct filter_ctx filter_ctx_t;
+
+// Allocate and initialize a filter instance with the coefficients of the
+// filter module, an energy window of FILTER_ENERGY_SAMPLE_COUNT, and its
+// state reset to zero. If malloc() fails, abort() is called to print an
+// error message and terminate.
+// Returns the filter instance.
+filter_ctx_t *filter_ctx_init(void);
+
+// Free the storage allocated for a filter instance.
+void filter_ctx_free(filter_ctx_t *f);
+
+// Reset the state of the filter instance to zero.
+void filter_ctx_reset(filter_ctx_t *f);
+
+// Set the length of the energy window. The default and maximum length is
+// FILTER_ENERGY_SAMPLE_COUNT. Also resets the energy values to zero.
+// count: window length in decimated samples (1 to FILTER_ENERGY_SAMPLE_COUNT).
+void filter_ctx_setEnergyWindow(filter_ctx_t *f, uint32_t count);
+
+// Set the sample frequency of the input. The default is
+// CONFIG_RX_SAMPLE_RATE. Also resets the state to zero.
+// freq_hz: CONFIG_RX_SAMPLE_RATE divided by a factor of
+//   FILTER_FIR_DECIMATION_FACTOR, for example CONFIG_RX_DUAL_RATE.
+// Return zero if successful, or non-zero if the rate is not supported.
+int32_t filter_ctx_setInputRate(filter_ctx_t *f, uint32_t freq_hz);
+
+// Add a sample to the pipeline and run each of the stages as necessary,
+// like filter_addSample().
+// Returns true if the filters were run (decimation occurred).
+bool filter_ctx_addSample(filter_ctx_t *f, filter_data_t in);
+
+// Add a sample to each of two instances, for example one per sensor, in a
+// single pass: the FIR outputs of both are computed in one loop over the
+// coefficients. Both instances must have the same input rate and must be
+// reset together, and b must only be given samples with this function.
+// Returns true if the filters were run (decimation occurred).
+bool filter_ctx_addPair(filter_ctx_t *a, filter_ctx_t *b, filter_data_t ina, filter_data_t inb);
+
+// Retrieve the current energy value for a channel.
+filter_data_t filter_ctx_getEnergyValue(const filter_ctx_t *f, uint16_t chan);
+
+// Copy all current energy values to the specified array.
+void filter_ctx_getEnergyArray(const filter_ctx_t *f, filter_data_t energy[]);
+
+#endif // FILTER_CTX_H_
@@ -3,6 +3,13 @@
 
 #include <stdint.h>
 
+// Two implementations of this interface can be selected with GAME in
+// CMakeLists.txt. game.c ("tick") runs the game from game_tick() and
+// polls in game_loop(). game_ev.c ("event") is driven by the event queue
+// in gevent.h: game_tick() does nothing and game_loop() blocks until an
+// event arrives, then hands it to the game core in gcore.h, which holds
+// the rules as a state machine that also runs on a host.
+
 // Initialize the game state.
 // period: Specify the period in milliseconds between calls to game_tick().
 // Return zero if successful, or non-zero otherwise.
@@ -0,0 +1,350 @@
+// Event-driven implementation of game.h. Select it instead of game.c with
+// GAME "event" in CMakeLists.txt.
+//
+// The rules are in the game core (gcore.h). This module connects the core
+// to the hardware: trigger callbacks, timer expiries (twheel.h) and
+// detector hits are posted to the event queue (gevent.h), and game_loop()
+// blocks on the queue and hands each event to the core. Nothing runs on a
+// fixed tick, so game_tick() does nothing. The receive task sleeps until
+// the receiver queues a block (rx_register_ready()), then runs the filter
+// and detector over each block.
+//
+// Shots are queued on the transmit scheduler (txsched.h), which owns the
+// transmit pin, so firing never waits for the pulse to end. With
+// CONFIG_TX_CODED in config.h, a shot is a short coded burst instead of a
+// CONFIG_TX_PULSE pulse, and the receive task runs the decimated FIR
+// output through the matched filter (mfilter.h) in place of the energy
+// detector. With CONFIG_TX_ID, a shot is an identity shot (shotid.h) that
+// carries CONFIG_GAME_PLAYER, and a hit is posted when the decoder has
+// the whole shot, with the ID of the shooter in the event data.
+//
+// Sounds in the bank of the flash partition (bank.h) replace the sounds
+// compiled in with the same name, so they can change without a rebuild.
+// With SOUNDS "synth" in CMakeLists.txt, the short effects are patches of
+// the synthesizer (sfx.h) in place of samples.
+//
+// Sounds are posted to the sound scheduler (sndq.h), so the game loop
+// never waits on audio. Each sound has a priority and a policy: a hit
+// cuts off a shot, a shot fired while another plays cuts it off too, and
+// the empty clip click is dropped rather than pile up.
+
+#include <stdio.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "config.h" // CONFIG_*
+#include "hw.h" // HW_*
+#include "lcd.h"
+#include "neo.h"
+#include "sound.h"
+#include "bank.h"
+#include "txsched.h"
+#include "trigger.h"
+#include "rx.h"
+#include "filter.h"
+#include "detector.h"
+#include "mfilter.h"
+#include "shotid.h"
+#include "twheel.h"
+#include "gevent.h"
+#include "gcore.h"
+#include "game.h"
+
+#include "bcFire.h"
+#include "clipEmpty.h"
+#include "gameBoyStartup.h"
+#include "gameOver.h"
+#include "ouch.h"
+#include "pacmanDeath.h"
+#include "powerUp.h"
+#include "screamAndDie.h"
+#if LTAG_SOUNDS_SYNTH
+#include "sfx.h"
+#endif
+
+#define RX_TASK_STACK 4096
+#define RX_TASK_PRIO 5
+#define FONT_SIZE 2
+#define ADC_HALF_SCALE (1 << (12-1)) // 12-bit ADC samples
+#define DEC_RATE (CONFIG_RX_SAMPLE_RATE/FILTER_FIR_DECIMATION_FACTOR)
+#define CODE_HOPS (MFILTER_HOPS*CONFIG_TX_CODE_CHIPS) // Matched filter hops in a burst
+#define ID_THRESH 5.0f // Identity shot decoder threshold factor
+#define ID_INTERVAL (DEC_RATE*CONFIG_TX_ID_TONE/1000/4) // Decoder checks, a quarter of a tone
+
+#if CONFIG_TX_CODED && CONFIG_TX_ID
+#error "Select one of CONFIG_TX_CODED and CONFIG_TX_ID"
+#endif
+
+static const char *TAG = "game";
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+static const uint8_t pixels_red[] = {0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00};
+static const uint8_t pixels_blk[] = {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
+
+// Sound of each gcore_sound_t
+static struct {
+	const char *name; // In the sound bank
+	const void *audio;
+	uint32_t size;
+	uint8_t prio; // Of the sound event
+	uint8_t policy; // sndq_policy_t
+} snd[GCORE_SNDS] = {
+	[GCORE_SND_START] = {"gameBoyStartup", gameBoyStartup, sizeof(gameBoyStartup), 3, SNDQ_QUEUE},
+#if LTAG_SOUNDS_SYNTH
+	[GCORE_SND_SHOT] = {"bcFire", &bcFireSynth, sizeof(bcFireSynth), 1, SNDQ_INTERRUPT},
+	[GCORE_SND_EMPTY] = {"clipEmpty", &clipEmptySynth, sizeof(clipEmptySynth), 1, SNDQ_DROP},
+	[GCORE_SND_RELOAD] = {"powerUp", &powerUpSynth, sizeof(powerUpSynth), 1, SNDQ_QUEUE},
+#else
+	[GCORE_SND_SHOT] = {"bcFire", bcFire, sizeof(bcFire), 1, SNDQ_INTERRUPT},
+	[GCORE_SND_EMPTY] = {"clipEmpty", clipEmpty, sizeof(clipEmpty), 1, SNDQ_DROP},
+	[GCORE_SND_RELOAD] = {"powerUp", powerUp, sizeof(powerUp), 1, SNDQ_QUEUE},
+#endif
+	[GCORE_SND_HIT] = {"ouch", ouch, sizeof(ouch), 2, SNDQ_INTERRUPT},
+	[GCORE_SND_LIFE] = {"screamAndDie", screamAndDie, sizeof(screamAndDie), 3, SNDQ_INTERRUPT},
+	[GCORE_SND_OVER] = {"gameOver", gameOver, sizeof(gameOver), 4, SNDQ_QUEUE},
+	[GCORE_SND_BASE] = {"pacmanDeath", pacmanDeath, sizeof(pacmanDeath), 4, SNDQ_DROP},
+};
+static bank_t bank; // Stays mapped while the game runs
+
+static gcore_t game;
+static twheel_timer_t timer[GCORE_TIMERS];
+static volatile uint32_t timer_gen[GCORE_TIMERS];
+static TaskHandle_t rx_task;
+#if CONFIG_TX_CODED
+static mfilter_t mf; // Correlates the coded bursts
+#elif CONFIG_TX_ID
+static shotid_dec_t dec; // Decodes the identity shots
+#endif
+static int64_t max_latency; // us from posting an event to handling it
+
+// Post the expiry of a core timer. Called in the twheel task.
+static void game_expire(void *arg)
+{
+	uint16_t id = (uintptr_t)arg;
+	gevent_post(GEVENT_TIMER, id, timer_gen[id]);
+}
+
+static void game_shoot(void *ctx, uint16_t chan)
+{
+#if CONFIG_TX_CODED
+	if (txsched_code(play_freq[chan], CONFIG_TX_CODE, CONFIG_TX_CODE_CHIPS, CONFIG_TX_CHIP))
+#elif CONFIG_TX_ID
+	if (shotid_send(chan, CONFIG_GAME_PLAYER, CONFIG_TX_ID_TONE*1000))
+#else
+	const txsched_seg_t seg = {play_freq[chan], CONFIG_TX_PULSE*1000, 0};
+	if (txsched_queue(&seg, 1))
+#endif
+		ESP_LOGW(TAG, "shot dropped, scheduler full");
+}
+
+static void game_timer(void *ctx, gcore_timer_t id, uint32_t ms, uint32_t gen)
+{
+	if (!ms) {
+		twheel_stop(&timer[id]);
+		return;
+	}
+	timer_gen[id] = gen;
+	twheel_start(&timer[id], ms);
+}
+
+static void game_sound(void *ctx, gcore_sound_t s)
+{
+	sound_post(snd[s].audio, snd[s].size, snd[s].prio, snd[s].policy, NULL, NULL);
+}
+
+static void game_led(void *ctx, bool on)
+{
+	neo_write(on ? pixels_red : pixels_blk, sizeof(pixels_red), false);
+}
+
+// Use the sounds of the bank in flash, if any, in place of the sounds
+// compiled in.
+static void game_bank(void)
+{
+	uint16_t found = 0;
+
+	if (bank_map(&bank, BANK_PARTITION)) return;
+	for (uint16_t i = 0; i < GCORE_SNDS; i++) {
+		const void *audio = bank_audio(&bank, bank_find(&bank, snd[i].name), &snd[i].size);
+		if (audio == NULL) continue;
+		snd[i].audio = audio;
+		found++;
+	}
+	ESP_LOGI(TAG, "%u of %u sounds from the bank", found, GCORE_SNDS);
+}
+
+static const gcore_ops_t ops = {
+	.shoot = game_shoot,
+	.timer = game_timer,
+	.sound = game_sound,
+	.led = game_led,
+};
+
+static void trig_pressed(void)
+{
+	gevent_post(GEVENT_TRIGGER_PRESSED, 0, 0);
+}
+
+static void trig_released(void)
+{
+	gevent_post(GEVENT_TRIGGER_RELEASED, 0, 0);
+}
+
+// Wake the receive task. Called in the ADC ISR when a block is queued.
+static bool IRAM_ATTR game_rx_ready(void *arg)
+{
+	BaseType_t woken = pdFALSE;
+
+	vTaskNotifyGiveFromISR(rx_task, &woken);
+	return woken == pdTRUE;
+}
+
+// Run the receive path on a sample.
+// x: sample scaled to -1.0 to +1.0.
+// id: set to the player ID of an identity shot, otherwise not changed.
+// Returns the channel of a hit, or -1 if there is no hit.
+static int32_t game_rx_sample(filter_data_t x, uint32_t *id)
+{
+#if CONFIG_TX_CODED
+	static uint16_t phase; // Samples since the last decimated one
+	static uint32_t hold; // Hops left of the burst of the last hit
+	bool run = ++phase == FILTER_FIR_DECIMATION_FACTOR;
+
+	if (run) phase = 0;
+	filter_data_t y = filter_firFilter(x, run);
+	if (!run || !mfilter_addSample(&mf, y)) return -1;
+	if (hold) { // One hit per burst
+		hold--;
+		return -1;
+	}
+	int32_t hit = mfilter_getHitChannel(&mf, CONFIG_TX_CODE_THRESH);
+	if (hit >= 0) hold = CODE_HOPS;
+	return hit;
+#elif CONFIG_TX_ID
+	filter_data_t energy[FILTER_CHANNELS];
+
+	if (!filter_addSample(x)) return -1;
+	filter_getEnergyArray(energy);
+	if (!shotid_dec_addEnergy(&dec, energy)) return -1;
+	*id = shotid_dec_getId(&dec);
+	int32_t team = shotid_dec_getTeam(&dec);
+	shotid_dec_clear(&dec);
+	return team;
+#else
+	filter_data_t energy[FILTER_CHANNELS];
+
+	if (!filter_addSample(x)) return -1;
+	filter_getEnergyArray(energy);
+	detector_checkHit(energy);
+	if (!detector_getHit()) return -1;
+	detector_clearHit();
+	return detector_getHitChannel();
+#endif
+}
+
+// Run the receive path on each block as it arrives and post hits.
+static void game_rx(void *arg)
+{
+	const rx_data_t *blk;
+	uint32_t cnt;
+
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		while ((blk = rx_get_block(&cnt)) != NULL) {
+			for (uint32_t i = 0; i < cnt; i++) {
+				uint32_t id = 0;
+				int32_t hit = game_rx_sample((filter_data_t)blk[i] / ADC_HALF_SCALE - 1.0f, &id);
+				if (hit >= 0) gevent_post(GEVENT_HIT, hit, id);
+			}
+			rx_release_block();
+		}
+	}
+}
+
+// Show the state seen by the player.
+static void game_draw(void)
+{
+	static const char *state[] = {"Play", "Invincible", "Return to base"};
+	char str[32];
+
+	snprintf(str, sizeof(str), "Lives:%u Hits:%u  ", game.lives, game.hits);
+	lcd_drawString(0, 0, str, WHITE);
+	snprintf(str, sizeof(str), "Shots:%-2u ", game.shots);
+	lcd_drawString(0, FONT_SIZE*LCD_CHAR_H, str, WHITE);
+	snprintf(str, sizeof(str), "%-14s", state[game.state]);
+	lcd_drawString(0, 2*FONT_SIZE*LCD_CHAR_H, str,
+		game.state == GCORE_OVER ? RED : GREEN);
+}
+
+int32_t game_init(uint32_t period)
+{
+	uint16_t team = CONFIG_GAME_TEAM_A;
+	bool chan[FILTER_CHANNELS];
+	uint32_t mask = 0;
+
+	if (twheel_init() || gevent_init()) return -1;
+	for (uint16_t i = 0; i < GCORE_TIMERS; i++)
+		twheel_timer_init(&timer[i], game_expire, (void *)(uintptr_t)i);
+
+	// Holding the right navigation button at startup selects team B.
+	if (!gpio_get_level(HW_NAV_RT)) team = CONFIG_GAME_TEAM_B;
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) {
+		chan[i] = i != team;
+		if (chan[i]) mask |= 1UL << i;
+	}
+	detector_setChannels(chan);
+#if CONFIG_TX_CODED // The game core ignores hits on disabled channels
+	if (mfilter_init(&mf, play_freq, FILTER_CHANNELS, DEC_RATE,
+		CONFIG_TX_CODE, CONFIG_TX_CODE_CHIPS, CONFIG_TX_CHIP)) return -1;
+#elif CONFIG_TX_ID
+	shotid_dec_init(&dec, ID_THRESH, ID_INTERVAL);
+#endif
+
+	game_bank();
+	lcd_setFontSize(FONT_SIZE);
+	lcd_setFontBackground(BLACK);
+	gcore_init(&game, &ops, team, mask);
+	game_draw();
+
+	trigger_register_pressed(trig_pressed);
+	trigger_register_released(trig_released);
+	trigger_operation(true); // The core ignores the trigger when disabled
+	if (xTaskCreate(game_rx, "game_rx", RX_TASK_STACK, NULL, RX_TASK_PRIO,
+		&rx_task) != pdPASS) {
+		ESP_LOGE(TAG, "xTaskCreate failed");
+		return -1;
+	}
+	rx_register_ready(game_rx_ready, NULL);
+	ESP_LOGI(TAG, "team:%u", team);
+	return 0;
+}
+
+void game_tick(void)
+{
+	// Events drive the game.
+}
+
+void game_loop(void)
+{
+	gevent_t e;
+
+	for (;;) {
+		if (!gevent_wait(&e, GEVENT_FOREVER)) continue;
+		int64_t lat = esp_timer_get_time() - e.t_us;
+		if (lat > max_latency) max_latency = lat;
+		gcore_state_t prev = game.state;
+		if (gcore_event(&game, &e)) {
+#if CONFIG_TX_ID
+			if (e.type == GEVENT_HIT) ESP_LOGI(TAG, "hit by player:%lu", e.data);
+#endif
+			game_draw();
+		}
+		if (game.state == GCORE_OVER && prev != GCORE_OVER)
+			ESP_LOGI(TAG, "game over, shots:%lu hits:%lu max latency:%lld us dropped:%lu",
+				game.fired, game.taken, max_latency, gevent_dropped());
+	}
+}
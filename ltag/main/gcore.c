@@ -0,0 +1,163 @@
+#include "gcore.h"
+
+// Start a timer with a new generation.
+static void gcore_timer(gcore_t *g, gcore_timer_t id, uint32_t ms)
+{
+	g->armed[id] = true;
+	g->ops->timer(g->ops->ctx, id, ms, ++g->gen[id]);
+}
+
+// Stop a timer. A pending expiry becomes stale.
+static void gcore_stop(gcore_t *g, gcore_timer_t id)
+{
+	if (!g->armed[id]) return;
+	g->armed[id] = false;
+	g->gen[id]++;
+	g->ops->timer(g->ops->ctx, id, 0, g->gen[id]);
+}
+
+// Play a sound.
+static inline void gcore_sound(gcore_t *g, gcore_sound_t snd)
+{
+	g->ops->sound(g->ops->ctx, snd);
+}
+
+// End the game.
+static void gcore_over(gcore_t *g)
+{
+	for (uint16_t i = 0; i < GCORE_TIMERS; i++)
+		if (i != GCORE_TIMER_HITLED) gcore_stop(g, i);
+	g->state = GCORE_OVER;
+	g->locked = false;
+	g->pressed = false;
+	gcore_sound(g, GCORE_SND_OVER);
+	gcore_timer(g, GCORE_TIMER_BASE, CONFIG_GAMEOVER_DELAY);
+}
+
+void gcore_init(gcore_t *g, const gcore_ops_t *ops, uint16_t team, uint32_t hitMask)
+{
+	g->ops = ops;
+	g->team = team;
+	g->hitMask = hitMask;
+	for (uint16_t i = 0; i < GCORE_TIMERS; i++) {
+		g->gen[i] = 0;
+		g->armed[i] = false;
+	}
+	gcore_restart(g);
+}
+
+void gcore_restart(gcore_t *g)
+{
+	for (uint16_t i = 0; i < GCORE_TIMERS; i++) gcore_stop(g, i);
+	g->ops->led(g->ops->ctx, false);
+	g->state = GCORE_PLAY;
+	g->lives = CONFIG_GAME_LIVES;
+	g->hits = 0;
+	g->shots = CONFIG_SHOT_COUNT;
+	g->pressed = false;
+	g->locked = false;
+	g->fired = 0;
+	g->taken = 0;
+	gcore_sound(g, GCORE_SND_START);
+}
+
+// Handle a hit on a channel.
+// Returns true if it counted.
+static bool gcore_hit(gcore_t *g, uint16_t chan)
+{
+	if (g->state != GCORE_PLAY || g->locked || chan >= 32 ||
+		!(g->hitMask & (1UL << chan)))
+		return false;
+	g->taken++;
+	g->locked = true;
+	gcore_timer(g, GCORE_TIMER_LOCKOUT, CONFIG_LOCKOUT_PERIOD);
+	g->ops->led(g->ops->ctx, true);
+	gcore_timer(g, GCORE_TIMER_HITLED, CONFIG_HITLED_PERIOD);
+	if (++g->hits < CONFIG_GAME_HITS) {
+		gcore_sound(g, GCORE_SND_HIT);
+		return true;
+	}
+	g->hits = 0;
+	if (--g->lives == 0) {
+		gcore_over(g);
+		return true;
+	}
+	gcore_stop(g, GCORE_TIMER_RELOAD);
+	g->pressed = false;
+	g->state = GCORE_INVINCIBLE;
+	gcore_sound(g, GCORE_SND_LIFE);
+	gcore_timer(g, GCORE_TIMER_INVINCIBLE, CONFIG_INVINCIBILITY_PERIOD);
+	return true;
+}
+
+// Handle a timer expiry.
+// Returns true if the state seen by the player changed.
+static bool gcore_expire(gcore_t *g, gcore_timer_t id)
+{
+	g->armed[id] = false;
+	switch (id) {
+	case GCORE_TIMER_RELOAD:
+		g->shots = CONFIG_SHOT_COUNT;
+		gcore_sound(g, GCORE_SND_RELOAD);
+		return true;
+	case GCORE_TIMER_LOCKOUT:
+		g->locked = false;
+		break;
+	case GCORE_TIMER_HITLED:
+		g->ops->led(g->ops->ctx, false);
+		break;
+	case GCORE_TIMER_INVINCIBLE:
+		g->state = GCORE_PLAY;
+		return true;
+	case GCORE_TIMER_BASE:
+		gcore_sound(g, GCORE_SND_BASE);
+		gcore_timer(g, GCORE_TIMER_BASE, CONFIG_GAME_BASE_PERIOD);
+		break;
+	default:
+		break;
+	}
+	return false;
+}
+
+bool gcore_event(gcore_t *g, const gevent_t *e)
+{
+	switch (e->type) {
+	case GEVENT_TRIGGER_PRESSED:
+		if (g->state != GCORE_PLAY) return false;
+		g->pressed = true;
+		gcore_timer(g, GCORE_TIMER_RELOAD, CONFIG_SHOT_RELOAD_PERIOD);
+		if (!g->shots) {
+			gcore_sound(g, GCORE_SND_EMPTY);
+			return false;
+		}
+		g->shots--;
+		g->fired++;
+		g->ops->shoot(g->ops->ctx, g->team);
+		gcore_sound(g, GCORE_SND_SHOT);
+		return true;
+	case GEVENT_TRIGGER_RELEASED:
+		if (!g->pressed) return false;
+		g->pressed = false;
+		if (g->shots) gcore_stop(g, GCORE_TIMER_RELOAD);
+		return false;
+	case GEVENT_HIT:
+		return gcore_hit(g, e->arg);
+	case GEVENT_TIMER:
+		if (e->arg >= GCORE_TIMERS || !g->armed[e->arg] ||
+			e->data != g->gen[e->arg])
+			return false; // Stale
+		return gcore_expire(g, e->arg);
+	case GEVENT_NET:
+		if (e->arg == GCORE_NET_START) {
+			gcore_restart(g);
+			return true;
+		}
+		if (e->arg == GCORE_NET_END && g->state != GCORE_OVER) {
+			gcore_over(g);
+			return true;
+		}
+		return false;
+	default:
+		return false;
+	}
+}
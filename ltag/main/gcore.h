@@ -0,0 +1,124 @@
+#ifndef GCORE_H_
+#define GCORE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "config.h" // CONFIG_GAME_*
+#include "gevent.h"
+
+// Game core: the rules of the laser tag game as a state machine driven by
+// events (gevent.h). The core does no I/O and has no clock. It acts
+// through the functions in an ops table, and time passes only through
+// timer events, so the same core runs on the target, where game_ev.c
+// feeds it from the event queue, and on a host, where tests and
+// simulators feed it scripted event traces.
+//
+// Rules:
+// - The player starts with CONFIG_GAME_LIVES lives and a full clip of
+//   CONFIG_SHOT_COUNT shots.
+// - Pressing the trigger fires a shot on the team channel if the clip is
+//   not empty. Each press starts the reload timer. The clip is reloaded if
+//   the timer expires: when empty, or when the trigger is held.
+// - A hit on an enabled channel counts unless the lockout timer runs.
+//   Each hit starts the lockout timer and lights the hit LED.
+// - After CONFIG_GAME_HITS hits a life is lost and the player is
+//   invincible for CONFIG_INVINCIBILITY_PERIOD: hits are ignored and the
+//   trigger is disabled.
+// - After the last life the game is over. The trigger is disabled and,
+//   after CONFIG_GAMEOVER_DELAY, the player is told to return to base
+//   every CONFIG_GAME_BASE_PERIOD.
+// - A GCORE_NET_START message starts a new game and a GCORE_NET_END
+//   message ends it.
+//
+// Each timer start has a generation number that comes back with its
+// expiry event. An expiry of a timer that was stopped or restarted after
+// the expiry was posted is ignored, so the order of events in the queue
+// never matters for stale expiries.
+
+// Timers used by the core. Event arg of GEVENT_TIMER.
+typedef enum {
+	GCORE_TIMER_RELOAD, // Reloads the clip, the reload completion event
+	GCORE_TIMER_LOCKOUT, // Hits are ignored while it runs
+	GCORE_TIMER_HITLED, // Hit LED is on while it runs
+	GCORE_TIMER_INVINCIBLE, // Life lost, hits and trigger ignored
+	GCORE_TIMER_BASE, // Return to base reminder after game over
+	GCORE_TIMERS
+} gcore_timer_t;
+
+// Sounds played by the core
+typedef enum {
+	GCORE_SND_START, // Game started
+	GCORE_SND_SHOT, // Shot fired
+	GCORE_SND_EMPTY, // Trigger pressed with an empty clip
+	GCORE_SND_RELOAD, // Clip reloaded
+	GCORE_SND_HIT, // Hit taken
+	GCORE_SND_LIFE, // Life lost
+	GCORE_SND_OVER, // Game over
+	GCORE_SND_BASE, // Return to base
+	GCORE_SNDS
+} gcore_sound_t;
+
+// Network messages handled by the core. Event arg of GEVENT_NET.
+typedef enum {
+	GCORE_NET_START, // Start a new game
+	GCORE_NET_END, // End the game
+} gcore_net_t;
+
+// Game states
+typedef enum {
+	GCORE_PLAY,
+	GCORE_INVINCIBLE,
+	GCORE_OVER,
+} gcore_state_t;
+
+// Actions of the core. All are required. ctx is passed to each.
+typedef struct {
+	// Fire a shot on a channel.
+	void (*shoot)(void *ctx, uint16_t chan);
+	// Start a timer, or stop it if ms is zero. When a started timer
+	// expires, post GEVENT_TIMER with arg id and data gen.
+	void (*timer)(void *ctx, gcore_timer_t id, uint32_t ms, uint32_t gen);
+	// Play a sound.
+	void (*sound)(void *ctx, gcore_sound_t snd);
+	// Turn the hit LED on or off.
+	void (*led)(void *ctx, bool on);
+	void *ctx;
+} gcore_ops_t;
+
+// Game state
+typedef struct {
+	const gcore_ops_t *ops;
+	uint16_t team; // Channel shots are fired on
+	uint32_t hitMask; // Channels that count as hits, bit per channel
+	gcore_state_t state;
+	uint16_t lives; // Lives left
+	uint16_t hits; // Hits taken in this life
+	uint16_t shots; // Shots left in the clip
+	bool pressed; // Trigger held
+	bool locked; // Lockout timer running
+	uint32_t gen[GCORE_TIMERS]; // Generation of each timer start
+	bool armed[GCORE_TIMERS]; // Timer running
+	uint32_t fired; // Shots fired, for statistics
+	uint32_t taken; // Hits taken, for statistics
+} gcore_t;
+
+// Initialize the core and start a game. Calls the ops.
+// g: game state.
+// ops: actions of the core, must stay valid.
+// team: channel shots are fired on.
+// hitMask: channels that count as hits, bit per channel. Leaving out the
+//   team channel is a good default.
+void gcore_init(gcore_t *g, const gcore_ops_t *ops, uint16_t team, uint32_t hitMask);
+
+// Start a new game with the same team and hit channels.
+void gcore_restart(gcore_t *g);
+
+// Handle one event.
+// g: game state.
+// e: event.
+// Returns true if the state seen by the player (lives, hits, shots or
+// game state) changed, so a display can be updated.
+bool gcore_event(gcore_t *g, const gevent_t *e);
+
+#endif // GCORE_H_
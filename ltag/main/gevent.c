@@ -0,0 +1,65 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "gevent.h"
+
+static const char *TAG = "gevent";
+
+static QueueHandle_t queue;
+static volatile uint32_t dropped;
+
+int32_t gevent_init(void)
+{
+	if (queue != NULL) return 0; // Already initialized
+	queue = xQueueCreate(GEVENT_QUEUE, sizeof(gevent_t));
+	if (queue == NULL) {
+		ESP_LOGE(TAG, "xQueueCreate failed");
+		return -1;
+	}
+	dropped = 0;
+	return 0;
+}
+
+int32_t gevent_deinit(void)
+{
+	if (queue == NULL) return 0;
+	vQueueDelete(queue);
+	queue = NULL;
+	return 0;
+}
+
+int32_t gevent_post(gevent_type_t type, uint16_t arg, uint32_t data)
+{
+	gevent_t e = {type, arg, data, esp_timer_get_time()};
+	BaseType_t ok;
+
+	if (queue == NULL) return -1;
+	if (xPortInIsrContext()) {
+		BaseType_t woken = pdFALSE;
+		ok = xQueueSendFromISR(queue, &e, &woken);
+		portYIELD_FROM_ISR(woken);
+	} else {
+		ok = xQueueSend(queue, &e, 0);
+	}
+	if (ok != pdTRUE) {
+		dropped++;
+		return -1;
+	}
+	return 0;
+}
+
+bool gevent_wait(gevent_t *e, uint32_t timeout_ms)
+{
+	TickType_t ticks = (timeout_ms == GEVENT_FOREVER) ?
+		portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+
+	if (queue == NULL) return false;
+	return xQueueReceive(queue, e, ticks) == pdTRUE;
+}
+
+uint32_t gevent_dropped(void)
+{
+	return dropped;
+}
@@ -0,0 +1,59 @@
+#ifndef GEVENT_H_
+#define GEVENT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Game events. Inputs of the game, from trigger edges and detector hits to
+// timer expiries and network messages, are posted as typed events to one
+// queue. The game task blocks on the queue, so it runs as soon as
+// something happens and the CPU idles otherwise. Each event records the
+// time it was posted, so the delay to its handling can be measured.
+
+// Event types
+typedef enum {
+	GEVENT_NONE,
+	GEVENT_TRIGGER_PRESSED,
+	GEVENT_TRIGGER_RELEASED,
+	GEVENT_HIT, // arg: channel
+	GEVENT_TIMER, // arg: timer, data: generation, see gcore.h
+	GEVENT_NET, // arg: message, data: payload
+	GEVENT_TYPES
+} gevent_type_t;
+
+// Event
+typedef struct {
+	uint16_t type; // gevent_type_t
+	uint16_t arg;
+	uint32_t data;
+	int64_t t_us; // Time posted
+} gevent_t;
+
+#define GEVENT_QUEUE 32 // Max queued events
+#define GEVENT_FOREVER UINT32_MAX // Wait without a timeout
+
+// Initialize the event queue.
+// Return zero if successful, or non-zero otherwise.
+int32_t gevent_init(void);
+
+// Free resources used by the event queue.
+// Return zero if successful, or non-zero otherwise.
+int32_t gevent_deinit(void);
+
+// Post an event. Does not block, may be called from an ISR.
+// type: event type.
+// arg: event argument.
+// data: event data.
+// Return zero if successful, or non-zero if the queue is full.
+int32_t gevent_post(gevent_type_t type, uint16_t arg, uint32_t data);
+
+// Wait for the next event.
+// e: set to the event.
+// timeout_ms: time to wait, or GEVENT_FOREVER.
+// Returns true if an event was received, false on timeout.
+bool gevent_wait(gevent_t *e, uint32_t timeout_ms);
+
+// Return the number of events dropped because the queue was full.
+uint32_t gevent_dropped(void);
+
+#endif // GEVENT_H_
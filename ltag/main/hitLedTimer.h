@@ -6,7 +6,8 @@
 
 // Each time _start is called, the timer runs once for the period specified
 // in _init. The timer is started after a hit is detected. While the timer
-// is active, the hit LED is turned on.
+// is active, the hit LED is turned on. The timer is a twheel_timer_t
+// (twheel.h) whose callback turns the LED back to the default color.
 
 // Initialize the timer.
 // period: Specify the timer period in milliseconds.
@@ -6,7 +6,8 @@
 
 // Each time _start is called, the timer runs once for the period specified
 // in _init. The timer is started when a life is lost. While the timer is
-// active, hits are ignored and the trigger is disabled.
+// active, hits are ignored and the trigger is disabled. Use a timer of the
+// timer service (twheel.h), like lockoutTimer.
 
 // Initialize the timer.
 // period: Specify the timer period in milliseconds.
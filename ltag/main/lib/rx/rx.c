@@ -0,0 +1,291 @@
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/peripherals/adc_continuous.html
+// https://github.com/espressif/esp-idf/tree/v6.0.2/examples/peripherals/adc/continuous_read
+
+#include "freertos/FreeRTOS.h"
+#include "esp_adc/adc_continuous.h"
+#include "esp_log.h"
+#include "esp_check.h"
+
+#include "chk.h"
+#include "config.h"
+#include "rx.h"
+
+#define RX_ATTEN ADC_ATTEN_DB_12
+#define RX_BITWIDTH SOC_ADC_DIGI_MAX_BITWIDTH
+#define RX_FRAME_BYTES (CONFIG_RX_FRAME*SOC_ADC_DIGI_RESULT_BYTES)
+
+#if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+#define RX_OUTPUT_TYPE ADC_DIGI_OUTPUT_FORMAT_TYPE1
+#define RX_GET_DATA(p) ((p)->type1.data)
+#define RX_GET_CHAN(p) ((p)->type1.channel)
+#else
+#define RX_OUTPUT_TYPE ADC_DIGI_OUTPUT_FORMAT_TYPE2
+#define RX_GET_DATA(p) ((p)->type2.data)
+#define RX_GET_CHAN(p) ((p)->type2.channel)
+#endif
+#define RX_SENSORS_MAX 2
+
+static const char *TAG = "rx";
+
+// Critical section protected variables
+static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+static rx_data_t pool[CONFIG_RX_FRAMES][CONFIG_RX_FRAME]; // Block storage
+static uint32_t pcnt[CONFIG_RX_FRAMES]; // Samples in each block
+static volatile uint32_t head; // Oldest ready block
+static volatile uint32_t tail; // Next block to fill
+static volatile uint32_t ready; // Count of ready blocks
+static volatile uint32_t off; // Samples consumed from the head block
+static volatile uint32_t avail; // Samples available in all ready blocks
+static volatile uint32_t dropped; // Samples dropped
+static volatile bool held; // Head block held by rx_get_block()
+
+// Other global variables
+static adc_continuous_handle_t adc_handle;
+static volatile bool running;
+static uint16_t sensors = 1; // Sensors interleaved in each block
+static adc_channel_t second; // ADC channel of the second sensor
+static volatile rx_ready_t ready_fn; // Called when a block is queued
+static void *volatile ready_arg;
+
+// Retire the head block. Must be called in a critical section.
+static inline void IRAM_ATTR rx_retire(void)
+{
+	avail -= pcnt[head] - off;
+	if (++head == CONFIG_RX_FRAMES) head = 0;
+	ready--;
+	off = 0;
+	held = false;
+}
+
+// Called when the ADC finishes a conversion frame. Convert the frame into
+// the tail block and add it to the queue.
+static bool IRAM_ATTR rx_conv_done_cb(adc_continuous_handle_t handle,
+	const adc_continuous_evt_data_t *edata, void *user_data)
+{
+	const adc_digi_output_data_t *p = (const adc_digi_output_data_t *)edata->conv_frame_buffer;
+	uint32_t n = edata->size / SOC_ADC_DIGI_RESULT_BYTES;
+	uint32_t t;
+
+	if (n > CONFIG_RX_FRAME) n = CONFIG_RX_FRAME;
+	portENTER_CRITICAL_ISR(&spinlock);
+	if (ready == CONFIG_RX_FRAMES) {
+		if (held) { // Consumer owns the oldest block, drop the new frame
+			dropped += n;
+			portEXIT_CRITICAL_ISR(&spinlock);
+			return false;
+		}
+		dropped += pcnt[head] - off;
+		rx_retire(); // Overwrite the oldest block
+	}
+	t = tail;
+	portEXIT_CRITICAL_ISR(&spinlock);
+
+	// The tail block is not visible to the consumer until it is queued.
+	uint32_t m = n, skip = 0;
+	if (sensors == 1) {
+		for (uint32_t i = 0; i < n; i++) pool[t][i] = RX_GET_DATA(p+i);
+	} else {
+		// Keep pairs aligned by channel, so a lost conversion does not swap
+		// the sensors. An incomplete pair at the end is dropped.
+		m = 0;
+		for (uint32_t i = 0; i < n; i++) {
+			if ((RX_GET_CHAN(p+i) == second) != (m & 1)) {skip++; continue;}
+			pool[t][m++] = RX_GET_DATA(p+i);
+		}
+		skip += m & 1;
+		m &= ~1U;
+	}
+
+	portENTER_CRITICAL_ISR(&spinlock);
+	dropped += skip;
+	pcnt[t] = m;
+	if (++tail == CONFIG_RX_FRAMES) tail = 0;
+	ready++;
+	avail += m;
+	portEXIT_CRITICAL_ISR(&spinlock);
+	rx_ready_t fn = ready_fn;
+	return fn != NULL && fn(ready_arg);
+}
+
+// Start continuous conversion of one or two GPIO pins.
+// gpio: GPIO pin numbers.
+// num: number of pins.
+// freq_hz: sample frequency of each pin in Hz.
+// Return zero if successful, or non-zero otherwise.
+static int32_t rx_start(const int32_t *gpio, uint16_t num, uint32_t freq_hz)
+{
+	adc_digi_pattern_config_t adc_pattern[RX_SENSORS_MAX];
+	adc_unit_t unit[RX_SENSORS_MAX];
+	adc_channel_t channel[RX_SENSORS_MAX];
+
+	if (adc_handle != NULL) rx_deinit();
+	rx_clear_buffer();
+	dropped = 0;
+	for (uint16_t i = 0; i < num; i++) {
+		CHK_RET(adc_continuous_io_to_channel(gpio[i], &unit[i], &channel[i]));
+		adc_pattern[i] = (adc_digi_pattern_config_t){
+			.atten = RX_ATTEN,
+			.channel = channel[i],
+			.unit = unit[i],
+			.bit_width = RX_BITWIDTH,
+		};
+	}
+	if (num > 1 && (unit[1] != unit[0] || channel[1] == channel[0] ||
+		freq_hz*num > SOC_ADC_SAMPLE_FREQ_THRES_HIGH)) {
+		ESP_LOGE(TAG, "sensors must be on one ADC unit, scan rate max:%d Hz",
+			SOC_ADC_SAMPLE_FREQ_THRES_HIGH);
+		return -1;
+	}
+	sensors = num;
+	second = channel[num-1];
+
+	adc_continuous_handle_cfg_t adc_config = {
+		.max_store_buf_size = RX_FRAME_BYTES*2,
+		.conv_frame_size = RX_FRAME_BYTES,
+		.flags.flush_pool = true, // frames are consumed in the callback
+	};
+	CHK_RET(adc_continuous_new_handle(&adc_config, &adc_handle));
+
+	adc_continuous_config_t dig_cfg = {
+		.pattern_num = num,
+		.adc_pattern = adc_pattern,
+		.sample_freq_hz = freq_hz*num, // The scan visits each pattern in turn
+		.conv_mode = (unit[0] == ADC_UNIT_1) ? ADC_CONV_SINGLE_UNIT_1 : ADC_CONV_SINGLE_UNIT_2,
+		.format = RX_OUTPUT_TYPE,
+	};
+	CHK_RET(adc_continuous_config(adc_handle, &dig_cfg));
+
+	adc_continuous_evt_cbs_t cbs = {
+		.on_conv_done = rx_conv_done_cb,
+	};
+	CHK_RET(adc_continuous_register_event_callbacks(adc_handle, &cbs, NULL));
+	CHK_RET(adc_continuous_start(adc_handle));
+	running = true;
+	return 0;
+}
+
+// Initialize the receiver (ADC unit).
+// gpio_num: GPIO pin number.
+// freq_hz: sample frequency of the input signal in Hz.
+// Return zero if successful, or non-zero otherwise.
+int32_t rx_init(int32_t gpio_num, uint32_t freq_hz)
+{
+	ESP_LOGI(TAG, "gpio_num:%ld freq:%lu Hz", gpio_num, freq_hz);
+	return rx_start(&gpio_num, 1, freq_hz);
+}
+
+// Initialize the receiver with two sensors sampled in the same ADC scan.
+// gpio_num: GPIO pin number of the first sensor.
+// gpio_num2: GPIO pin number of the second sensor.
+// freq_hz: sample frequency of each sensor in Hz.
+// Return zero if successful, or non-zero otherwise.
+int32_t rx_init_dual(int32_t gpio_num, int32_t gpio_num2, uint32_t freq_hz)
+{
+	const int32_t gpio[RX_SENSORS_MAX] = {gpio_num, gpio_num2};
+
+	ESP_LOGI(TAG, "gpio_num:%ld,%ld freq:%lu Hz", gpio_num, gpio_num2, freq_hz);
+	return rx_start(gpio, RX_SENSORS_MAX, freq_hz);
+}
+
+// Return the number of sensors interleaved in each block (1 or 2).
+uint16_t rx_get_sensors(void)
+{
+	return sensors;
+}
+
+// Free resources used by the receiver (ADC unit).
+// Return zero if successful, or non-zero otherwise.
+int32_t rx_deinit(void)
+{
+	if (adc_handle == NULL) return 0;
+	if (running) CHK_RET(adc_continuous_stop(adc_handle));
+	running = false;
+	CHK_RET(adc_continuous_deinit(adc_handle));
+	adc_handle = NULL;
+	return 0;
+}
+
+// Get a sample from the input buffer.
+// Returns the next sample, or zero if empty.
+rx_data_t rx_get_sample(void)
+{
+	rx_data_t val = 0;
+
+	portENTER_CRITICAL(&spinlock);
+	if (ready) {
+		val = pool[head][off++];
+		avail--;
+		if (off == pcnt[head]) rx_retire();
+	}
+	portEXIT_CRITICAL(&spinlock);
+	return val;
+}
+
+// Get a count of samples in the input buffer.
+// Returns the number of samples available.
+uint32_t rx_get_count(void)
+{
+	return avail;
+}
+
+// Clear the input buffer.
+void rx_clear_buffer(void)
+{
+	portENTER_CRITICAL(&spinlock);
+	head = tail = 0;
+	ready = off = avail = 0;
+	held = false;
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Get the oldest block of samples without copying.
+// count: set to the number of samples in the block.
+// Returns a pointer to the samples, or NULL if no block is available.
+const rx_data_t *rx_get_block(uint32_t *count)
+{
+	const rx_data_t *blk = NULL;
+
+	portENTER_CRITICAL(&spinlock);
+	if (ready) {
+		held = true;
+		blk = pool[head] + off;
+		*count = pcnt[head] - off;
+	}
+	portEXIT_CRITICAL(&spinlock);
+	return blk;
+}
+
+// Release the block returned by rx_get_block() so it can be reused.
+void rx_release_block(void)
+{
+	portENTER_CRITICAL(&spinlock);
+	if (held) rx_retire();
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Return the number of samples dropped because the consumer fell behind.
+uint32_t rx_get_dropped(void)
+{
+	return dropped;
+}
+
+// Register a function called each time a block is queued.
+// ready: block ready function, or NULL for none.
+// arg: argument passed to each call of the function.
+void rx_register_ready(rx_ready_t ready, void *arg)
+{
+	portENTER_CRITICAL(&spinlock);
+	ready_fn = ready;
+	ready_arg = arg;
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Enable or disable capture from the input device.
+// enable: if true, enable capture, otherwise disable.
+void rx_device(bool enable)
+{
+	if (adc_handle == NULL || enable == running) return;
+	if (enable) ESP_ERROR_CHECK(adc_continuous_start(adc_handle));
+	else ESP_ERROR_CHECK(adc_continuous_stop(adc_handle));
+	running = enable;
+}
@@ -0,0 +1,161 @@
+// Host (Linux) build of the receiver. Blocks are produced on demand from
+// a generator or a file instead of an ADC, see rx_host.h.
+
+#include <stdio.h>
+
+#include "config.h"
+#include "rx.h"
+#include "rx_host.h"
+
+static rx_data_t blk[CONFIG_RX_FRAME]; // Current block
+static uint32_t bcnt; // Samples in the current block
+static uint32_t off; // Samples consumed from the current block
+static bool held; // Current block held by rx_get_block()
+static bool running;
+static bool eof;
+static uint32_t freq;
+static uint16_t sensors = 1;
+
+static rx_host_gen_t src_gen;
+static void *src_ctx;
+static FILE *src_file;
+
+// Read samples from the source file.
+static uint32_t rx_host_read(rx_data_t *buf, uint32_t size, void *ctx)
+{
+	uint8_t raw[2];
+	uint32_t n;
+
+	for (n = 0; n < size; n++) {
+		if (fread(raw, 1, 2, src_file) != 2) break;
+		buf[n] = raw[0] | (rx_data_t)raw[1] << 8;
+	}
+	return n;
+}
+
+// Make sure a block with unconsumed samples is available.
+// Returns true if successful.
+static bool rx_host_fill(void)
+{
+	if (off < bcnt) return true;
+	if (!running || eof || src_gen == NULL) return false;
+	bcnt = src_gen(blk, CONFIG_RX_FRAME, src_ctx);
+	off = 0;
+	if (!bcnt) eof = true;
+	return bcnt != 0;
+}
+
+static void rx_host_close(void)
+{
+	if (src_file != NULL) fclose(src_file);
+	src_file = NULL;
+	src_gen = NULL;
+	src_ctx = NULL;
+	bcnt = off = 0;
+	held = false;
+	eof = false;
+}
+
+void rx_host_generator(rx_host_gen_t gen, void *ctx)
+{
+	rx_host_close();
+	src_gen = gen;
+	src_ctx = ctx;
+}
+
+int32_t rx_host_file(const char *path)
+{
+	rx_host_close();
+	if ((src_file = fopen(path, "rb")) == NULL) return -1;
+	src_gen = rx_host_read;
+	return 0;
+}
+
+bool rx_host_eof(void)
+{
+	return !rx_host_fill();
+}
+
+uint32_t rx_host_get_freq(void)
+{
+	return freq;
+}
+
+int32_t rx_init(int32_t gpio_num, uint32_t freq_hz)
+{
+	freq = freq_hz;
+	sensors = 1;
+	rx_clear_buffer();
+	running = true;
+	return 0;
+}
+
+// The source produces the interleaved pairs, see rx_host.h.
+int32_t rx_init_dual(int32_t gpio_num, int32_t gpio_num2, uint32_t freq_hz)
+{
+	rx_init(gpio_num, freq_hz);
+	sensors = 2;
+	return 0;
+}
+
+uint16_t rx_get_sensors(void)
+{
+	return sensors;
+}
+
+int32_t rx_deinit(void)
+{
+	rx_host_close();
+	running = false;
+	return 0;
+}
+
+rx_data_t rx_get_sample(void)
+{
+	if (!rx_host_fill()) return 0;
+	return blk[off++];
+}
+
+// The host source has no fixed rate, so a whole block is reported when
+// the current one is used up.
+uint32_t rx_get_count(void)
+{
+	return rx_host_fill() ? bcnt - off : 0;
+}
+
+void rx_clear_buffer(void)
+{
+	bcnt = off = 0;
+	held = false;
+}
+
+const rx_data_t *rx_get_block(uint32_t *count)
+{
+	if (!rx_host_fill()) return NULL;
+	held = true;
+	*count = bcnt - off;
+	return blk + off;
+}
+
+void rx_release_block(void)
+{
+	if (held) off = bcnt;
+	held = false;
+}
+
+// Nothing is dropped, samples are produced only when asked for.
+uint32_t rx_get_dropped(void)
+{
+	return 0;
+}
+
+// Blocks are produced when the consumer asks for them, so there is
+// nothing to wait for and the function is never called.
+void rx_register_ready(rx_ready_t ready, void *arg)
+{
+}
+
+void rx_device(bool enable)
+{
+	running = enable;
+}
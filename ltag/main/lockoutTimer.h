@@ -7,6 +7,8 @@
 // Each time _start is called, the timer runs once for the period specified
 // in _init. The timer is started after a hit is detected. While the timer
 // is active, hits are ignored. Only one hit is detected per timer interval.
+// The timer needs no callback, twheel.h shows this module as a client of
+// the timer service.
 
 // Initialize the timer.
 // period: Specify the timer period in milliseconds.
@@ -0,0 +1,46 @@
+// Host (Linux) test runner for the tests that do not need the target
+// hardware. Build with MILESTONE "host" and the linux target, then run
+// ./build/ltag.elf
+
+#include <stdlib.h> // exit
+
+#include "test_adpcm.h"
+#include "test_bank.h"
+#include "test_debounce.h"
+#include "test_detector_ctx.h"
+#include "test_filter_ctx.h"
+#include "test_gcore.h"
+#include "test_mixer.h"
+#include "test_resample.h"
+#include "test_ring.h"
+#include "test_shotid.h"
+#include "test_sndq.h"
+#include "test_sound.h"
+#include "test_synth.h"
+#include "test_twheel.h"
+#include "test_txsched.h"
+#include "test_unit.h"
+#include "test_volume.h"
+
+// Main application
+void app_main(void)
+{
+	test_debounce();
+	test_twheel();
+	test_gcore();
+	test_txsched();
+	test_filter_ctx();
+	test_detector_ctx();
+	test_shotid();
+	test_unit();
+	test_mixer();
+	test_adpcm();
+	test_bank();
+	test_resample();
+	test_synth();
+	test_sndq();
+	test_volume();
+	test_ring();
+	test_sound();
+	exit(0);
+}
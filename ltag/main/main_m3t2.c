@@ -8,6 +8,8 @@
 #include "neo.h"
 #include "test_trigger.h"
 #include "test_tx.h"
+#include "test_txsched.h"
+#include "test_twheel.h"
 #include "test_hitLedTimer.h"
 #include "test_shot.h"
 
@@ -26,6 +28,8 @@ void app_main(void)
 
 	test_trigger();
 	test_tx();
+	test_txsched();
+	test_twheel();
 	test_shot();
 	test_hitLedTimer();
 
@@ -6,7 +6,15 @@
 #include "hw.h" // HW_LTAG_*
 #include "lcd.h"
 #include "test_buffer.h"
+#include "test_capture.h"
+#include "test_chansim.h"
 #include "test_detector.h"
+#include "test_detector_ctx.h"
+#include "test_diversity.h"
+#include "test_filter_ctx.h"
+#include "test_mfilter.h"
+#include "test_rx.h"
+#include "test_shotid.h"
 
 static const char *TAG = "m3t3";
 
@@ -21,7 +29,15 @@ void app_main(void)
 	lcd_init(); // Clears display
 
 	test_buffer();
+	test_rx();
+	test_capture();
 	test_detector();
+	test_filter_ctx();
+	test_detector_ctx();
+	test_mfilter();
+	test_chansim();
+	test_diversity();
+	test_shotid();
 
 	return;
 }
@@ -15,6 +15,9 @@
 #include "shot.h"
 #include "trigger.h"
 #include "tx.h"
+#if LTAG_GAME_EVENT
+#include "txsched.h"
+#endif
 #include "rx.h"
 #include "sound.h"
 #include "game.h"
@@ -23,8 +26,9 @@
 #define TPERIOD CONFIG_MAIN_TICK_PERIOD // timer period in ms
 
 static const char *TAG = "ltag";
-static TimerHandle_t update_timer; // Declare timer handle for update callback
 
+#if !LTAG_GAME_EVENT
+static TimerHandle_t update_timer; // Declare timer handle for update callback
 
 // Called when the timer expires
 static void update(TimerHandle_t pt)
@@ -32,6 +36,7 @@ static void update(TimerHandle_t pt)
 	trigger_tick();
 	game_tick();
 }
+#endif
 
 // Main application
 void app_main(void)
@@ -67,10 +72,15 @@ void app_main(void)
 	detector_init();
 	trigger_init(TPERIOD, HW_LTAG_TRIGGER);
 	rx_init(HW_LTAG_RX, CONFIG_RX_SAMPLE_RATE);
+#if LTAG_GAME_EVENT
+	txsched_init(HW_LTAG_TX); // Shots are queued, see game_ev.c
+#else
 	tx_init(HW_LTAG_TX);
+#endif
 	sound_init(CONFIG_SND_SAMPLE_RATE);
 	game_init(TPERIOD); // last
 
+#if !LTAG_GAME_EVENT // The event-driven game needs no tick
 	// Initialize update timer
 	update_timer = xTimerCreate(
 		"update_timer",         // Text name for the timer.
@@ -88,11 +98,16 @@ void app_main(void)
 		ESP_LOGE(TAG, "Error starting update timer");
 		return;
 	}
+#endif
 
 	game_loop();
 
 	// Turn off and release resources
 	sound_deinit();
+#if LTAG_GAME_EVENT
+	txsched_deinit();
+#else
 	tx_emit(false);
+#endif
 	rx_deinit();
 }
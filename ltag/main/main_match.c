@@ -0,0 +1,340 @@
+// Host (Linux target) simulator of a match between many tag units. Each
+// player is a simulated unit (unit.h) with its own game, filter and
+// detector instance. Players move on a field, aim at opponents and pull
+// the trigger. A geometric model decides how strongly each transmitted
+// pulse reaches each receiver, and the receive samples of every unit are
+// synthesized from all the pulses in the air. Build with MILESTONE "match"
+// and the linux target, then run:
+//   [LTAG_UNITS=<players>] [LTAG_SECONDS=<match length>] [LTAG_JOBS=<workers>]
+//   [LTAG_SEED=<seed>] [LTAG_CHECK=1] ./build/ltag.elf
+//
+// Units are spread over worker threads. The simulation advances in ticks
+// of TICK_MS. In each tick, every unit hears the pulses and positions
+// published at the end of the previous tick, so the units of a tick are
+// independent and one barrier per tick keeps the workers in step. Each
+// player has its own random generator, so results do not depend on the
+// number of workers; LTAG_CHECK=1 runs the match again with one worker and
+// compares.
+//
+// The game settings come from config.h, so the effect of the detector,
+// lockout and invincibility settings on a match can be seen before a live
+// event. The headline figure is simulated unit-seconds per wall second.
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h> // getenv, atol, calloc, exit
+#include <time.h> // clock_gettime
+#include <unistd.h> // sysconf
+
+#include "config.h" // CONFIG_*
+#include "filter.h"
+#include "unit.h"
+
+#define MAX_UNITS 64
+#define UNITS 20
+#define SECONDS 60
+#define ADC_BITS 12
+#define TICK_MS 1 // Simulation tick
+#define TICK_SAMPLES (CONFIG_RX_SAMPLE_RATE*TICK_MS/1000)
+
+// Field and players
+#define FIELD_W 40.0f // m
+#define FIELD_H 25.0f // m
+#define SPEED 1.0f // m/s walking speed
+#define TURN_MS 2000 // Mean time between changes of walking direction
+#define AIM_MS 1000 // Mean time between picking a target
+#define AIM_ERR 0.05f // rad, standard deviation of the aim
+#define PRESS_MS 1200 // Mean time between trigger presses
+#define HOLD_MS 100 // Trigger held
+
+// Optical model. The transmitter is a beam with a Gaussian profile, the
+// receiver has a cosine response, and power falls with the square of the
+// distance. AMP_1M is the received amplitude, as a fraction of ADC full
+// scale, on the beam axis at 1 m facing the shooter.
+#define AMP_1M 2.0f
+#define AMP_MAX 0.45f // Clip near the receiver
+#define BEAM 0.06f // rad, beam width (standard deviation)
+#define AMP_MIN 0.002f // Pulses weaker than this are left out
+#define DC 0.5f // Ambient level
+#define NOISE 0.01f // Noise standard deviation
+
+// Player state, owned by the worker of the unit
+typedef struct {
+	unit_t u;
+	float x, y; // Position in m
+	float dir; // Walking direction
+	float aim; // Heading of the tag unit
+	int16_t target; // Player aimed at, or -1
+	uint32_t rng; // Random generator state
+	uint32_t turn_ms, aim_ms, press_ms, release_ms; // Next behavior changes
+	bool was_on; // Emitting at the last tick
+	// Statistics
+	uint32_t exposures; // Opponents reached by this player's shots
+} player_t;
+
+// State of a player published at the end of a tick
+typedef struct {
+	float x, y, aim;
+	bool on; // Emitting
+	bool out; // Game over
+	uint16_t chan;
+} pose_t;
+
+static player_t *player;
+static pose_t pose[2][MAX_UNITS]; // Double buffered by tick
+static uint32_t units, seconds, jobs, seed;
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+static pthread_barrier_t barrier;
+
+// Return a random number from a player's generator (xorshift32).
+static inline uint32_t mt_rand(player_t *p)
+{
+	uint32_t x = p->rng;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return p->rng = x;
+}
+
+// Return a uniform random number in [0, 1).
+static inline float mt_uniform(player_t *p)
+{
+	return (mt_rand(p) >> 8) * (1.0f / (1 << 24));
+}
+
+// Return an approximately normal random number, zero mean, unit variance.
+static inline float mt_normal(player_t *p)
+{
+	return (mt_uniform(p) + mt_uniform(p) + mt_uniform(p) - 1.5f) * 2.0f;
+}
+
+// Return an exponentially distributed time in ms with a mean.
+static inline uint32_t mt_wait(player_t *p, uint32_t mean_ms)
+{
+	return 1 + (uint32_t)(-logf(1.0f - mt_uniform(p)) * mean_ms);
+}
+
+// Return the amplitude at which a shooter's pulse reaches a receiver.
+static float mt_link(const pose_t *tx, const pose_t *rx)
+{
+	float dx = rx->x - tx->x, dy = rx->y - tx->y;
+	float d2 = dx*dx + dy*dy;
+	if (d2 < 1.0f) d2 = 1.0f;
+	float off = remainderf(atan2f(dy, dx) - tx->aim, 2*(float)M_PI); // Off the beam axis
+	float inc = cosf(atan2f(-dy, -dx) - rx->aim); // Incidence at the receiver
+	if (inc <= 0.0f) return 0.0f;
+	float a = AMP_1M * expf(-0.5f*off*off/(BEAM*BEAM)) * inc / d2;
+	return (a > AMP_MAX) ? AMP_MAX : a;
+}
+
+// Synthesize the receive samples of a player for one tick from the pulses
+// published in the last tick.
+static void mt_receive(player_t *p, uint16_t i, const pose_t *ps, uint64_t n0, rx_data_t *buf)
+{
+	float amp[MAX_UNITS];
+	uint32_t freq[MAX_UNITS];
+	uint16_t k = 0;
+	const float scale = (float)(1 << ADC_BITS), max = scale - 1.0f;
+
+	for (uint16_t j = 0; j < units; j++) {
+		if (j == i || !ps[j].on) continue;
+		float a = mt_link(&ps[j], &ps[i]);
+		if (a < AMP_MIN) continue;
+		amp[k] = a;
+		freq[k++] = play_freq[ps[j].chan];
+	}
+	for (uint32_t s = 0; s < TICK_SAMPLES; s++) {
+		uint64_t n = n0 + s;
+		float v = DC + NOISE*mt_normal(p);
+		for (uint16_t j = 0; j < k; j++) // Square wave like the transmitter
+			v += ((n * freq[j]) % CONFIG_RX_SAMPLE_RATE < CONFIG_RX_SAMPLE_RATE/2) ?
+				amp[j] : -amp[j];
+		v *= scale;
+		buf[s] = (v < 0.0f) ? 0 : (v > max) ? max : (rx_data_t)v;
+	}
+}
+
+// Move a player, aim and work the trigger for one tick.
+static void mt_behave(player_t *p, uint16_t i, const pose_t *ps, uint32_t ms)
+{
+	if (p->u.game.state == GCORE_OVER) return; // Out, waits at its spot
+	if (ms >= p->turn_ms) {
+		p->dir = 2*(float)M_PI*mt_uniform(p);
+		p->turn_ms = ms + mt_wait(p, TURN_MS);
+	}
+	float step = SPEED * TICK_MS / 1000.0f;
+	p->x += step * cosf(p->dir);
+	p->y += step * sinf(p->dir);
+	if (p->x < 0.0f || p->x > FIELD_W) {p->dir = (float)M_PI - p->dir; p->x = fminf(fmaxf(p->x, 0.0f), FIELD_W);}
+	if (p->y < 0.0f || p->y > FIELD_H) {p->dir = -p->dir; p->y = fminf(fmaxf(p->y, 0.0f), FIELD_H);}
+
+	// Pick an opponent that is still in the game
+	if (ms >= p->aim_ms || p->target < 0 || ps[p->target].out) {
+		uint16_t pick = mt_rand(p) % units;
+		p->target = -1;
+		for (uint16_t k = 0; k < units; k++) {
+			uint16_t j = (pick + k) % units;
+			if (ps[j].chan != ps[i].chan && !ps[j].out) {
+				p->target = j;
+				break;
+			}
+		}
+		p->aim_ms = ms + mt_wait(p, AIM_MS);
+	}
+	if (p->target >= 0) // Track the target with some error
+		p->aim = atan2f(ps[p->target].y - p->y, ps[p->target].x - p->x) +
+			AIM_ERR*mt_normal(p);
+
+	if (ms >= p->press_ms) {
+		unit_trigger(&p->u, true);
+		p->release_ms = ms + HOLD_MS;
+		p->press_ms = ms + HOLD_MS + mt_wait(p, PRESS_MS);
+	} else if (ms == p->release_ms) {
+		unit_trigger(&p->u, false);
+	}
+}
+
+// Publish the state of a player at the end of a tick, and count the
+// opponents reached when a shot starts.
+static void mt_publish(player_t *p, uint16_t i, const pose_t *ps, pose_t *next)
+{
+	uint16_t chan;
+	bool on = unit_emitting(&p->u, &chan);
+
+	next[i] = (pose_t){p->x, p->y, p->aim, on, p->u.game.state == GCORE_OVER, ps[i].chan};
+	if (on && !p->was_on)
+		for (uint16_t j = 0; j < units; j++)
+			if (ps[j].chan != ps[i].chan && mt_link(&next[i], &ps[j]) >= AMP_MIN)
+				p->exposures++;
+	p->was_on = on;
+}
+
+// Worker thread j runs players j, j+jobs, j+2*jobs, ... in every tick.
+static void *mt_worker(void *arg)
+{
+	uint32_t w = (uintptr_t)arg;
+	rx_data_t buf[TICK_SAMPLES];
+	uint32_t ticks = seconds * 1000 / TICK_MS;
+
+	for (uint32_t t = 0; t < ticks; t++) {
+		const pose_t *ps = pose[t & 1];
+		pose_t *next = pose[(t+1) & 1];
+		for (uint32_t i = w; i < units; i += jobs) {
+			player_t *p = &player[i];
+			mt_receive(p, i, ps, p->u.samples, buf);
+			unit_step(&p->u, buf, TICK_SAMPLES);
+			mt_behave(p, i, ps, (t+1)*TICK_MS);
+			mt_publish(p, i, ps, next);
+		}
+		pthread_barrier_wait(&barrier);
+	}
+	return NULL;
+}
+
+// Set up the players: two teams, each starting on its own half.
+static void mt_setup(void)
+{
+	for (uint16_t i = 0; i < units; i++) {
+		player_t *p = &player[i];
+		uint16_t team = (i & 1) ? CONFIG_GAME_TEAM_B : CONFIG_GAME_TEAM_A;
+		*p = (player_t){0};
+		p->rng = seed*2654435761U + i*40503U + 1;
+		if (!p->rng) p->rng = 1;
+		p->x = FIELD_W * (0.05f + 0.4f*mt_uniform(p)) + ((i & 1) ? FIELD_W/2 : 0.0f);
+		p->y = FIELD_H * mt_uniform(p);
+		p->aim = (i & 1) ? (float)M_PI : 0.0f;
+		p->target = -1;
+		p->press_ms = mt_wait(p, PRESS_MS) + 1000; // After the detector warms up
+		unit_init(&p->u, i, team, NULL, NULL);
+		pose[0][i] = (pose_t){p->x, p->y, p->aim, false, false, team};
+	}
+}
+
+// Run a match with a number of workers.
+// Returns the wall time in seconds.
+static double mt_match(uint32_t workers)
+{
+	struct timespec t0, t1;
+
+	jobs = workers;
+	mt_setup();
+	pthread_barrier_init(&barrier, NULL, jobs);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	pthread_t tid[jobs];
+	for (uint32_t j = 0; j < jobs; j++)
+		if (pthread_create(&tid[j], NULL, mt_worker, (void *)(uintptr_t)j)) {
+			printf("match: cannot start worker\n");
+			exit(1);
+		}
+	for (uint32_t j = 0; j < jobs; j++) pthread_join(tid[j], NULL);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	pthread_barrier_destroy(&barrier);
+	return (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec)/1e9;
+}
+
+// Print the results by team and return a hash of all unit results.
+static uint32_t mt_report(void)
+{
+	uint32_t hash = 2166136261;
+
+	for (uint16_t team = 0; team < 2; team++) {
+		uint32_t n = 0, out = 0, fired = 0, exposed = 0, taken = 0;
+		for (uint16_t i = team; i < units; i += 2) {
+			const player_t *p = &player[i];
+			n++;
+			out += p->u.game.state == GCORE_OVER;
+			fired += p->u.game.fired;
+			exposed += p->exposures;
+			taken += p->u.game.taken;
+		}
+		printf("team %c (ch%u): players:%lu out:%lu shots:%lu on target:%lu hits taken:%lu\n",
+			'A' + team, team ? CONFIG_GAME_TEAM_B : CONFIG_GAME_TEAM_A,
+			(unsigned long)n, (unsigned long)out, (unsigned long)fired,
+			(unsigned long)exposed, (unsigned long)taken);
+	}
+	for (uint16_t i = 0; i < units; i++) {
+		const player_t *p = &player[i];
+		uint32_t v[] = {p->u.game.fired, p->u.game.taken, p->u.game.lives,
+			p->u.detected, p->exposures};
+		for (uint16_t k = 0; k < sizeof(v)/sizeof(v[0]); k++)
+			hash = (hash ^ v[k]) * 16777619;
+	}
+	return hash;
+}
+
+// Main application
+void app_main(void)
+{
+	const char *s;
+	long n;
+
+	units = (s = getenv("LTAG_UNITS")) ? atol(s) : UNITS;
+	if (units < 2 || units > MAX_UNITS) units = UNITS;
+	seconds = (s = getenv("LTAG_SECONDS")) ? atol(s) : SECONDS;
+	if (seconds < 1) seconds = SECONDS;
+	seed = (s = getenv("LTAG_SEED")) ? atol(s) : 1;
+	n = (s = getenv("LTAG_JOBS")) ? atol(s) : sysconf(_SC_NPROCESSORS_ONLN);
+	if (n < 1) n = 1;
+	if (n > units) n = units;
+	if ((player = calloc(units, sizeof(player_t))) == NULL) abort();
+
+	filter_init(); // Coefficients shared by all instances
+	printf("match: %lu players, %lu s, %ld workers, lockout:%d ms invincibility:%d ms\n",
+		(unsigned long)units, (unsigned long)seconds, n,
+		CONFIG_LOCKOUT_PERIOD, CONFIG_INVINCIBILITY_PERIOD);
+	double wall = mt_match(n);
+	uint32_t hash = mt_report();
+	printf("simulated %lu unit-seconds in %.2f s: %.1f unit-s per wall-s\n",
+		(unsigned long)(units*seconds), wall, units*seconds/wall);
+	for (uint16_t i = 0; i < units; i++) unit_free(&player[i].u);
+
+	if ((s = getenv("LTAG_CHECK")) != NULL && atol(s)) {
+		mt_match(1);
+		uint32_t again = mt_report();
+		printf("check with one worker: %s\n", again == hash ? "same results" : "DIFFERENT RESULTS");
+		for (uint16_t i = 0; i < units; i++) unit_free(&player[i].u);
+		exit(again == hash ? 0 : 1);
+	}
+	exit(0);
+}
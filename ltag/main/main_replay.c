@@ -0,0 +1,94 @@
+// Host (Linux target) tool that replays a raw receive capture through the
+// filter and detector as fast as possible. Build with MILESTONE "replay"
+// and the linux target, then run:
+//   LTAG_CAPTURE=<capture file or console log> [LTAG_THRESH=<factor>] ./build/ltag.elf
+
+#include <stdio.h>
+#include <stdlib.h> // getenv, strtof, exit
+#include <time.h> // clock_gettime
+
+#include "capture.h"
+#include "config.h" // CONFIG_*
+#include "detector.h"
+#include "filter.h"
+#include "rx.h"
+#include "rx_host.h"
+
+// Generator for rx_host_generator() that reads a capture.
+static uint32_t replay_gen(rx_data_t *buf, uint32_t size, void *ctx)
+{
+	return capture_read((capture_reader_t *)ctx, buf, size);
+}
+
+// Return the time in seconds from a monotonic clock.
+static double replay_time(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Main application
+void app_main(void)
+{
+	static capture_reader_t rd;
+	const char *path = getenv("LTAG_CAPTURE");
+	const char *thresh = getenv("LTAG_THRESH");
+	capture_header_t hdr;
+	const rx_data_t *blk;
+	uint32_t cnt, hits = 0;
+	uint64_t n = 0;
+	FILE *fp;
+
+	if (path == NULL) path = "capture.bin";
+	if ((fp = fopen(path, "rb")) == NULL) {
+		printf("replay: cannot open %s\n", path);
+		exit(1);
+	}
+	if (capture_open(&rd, fp, &hdr)) {
+		printf("replay: %s is not a capture\n", path);
+		exit(1);
+	}
+	printf("replay: %s unit:%08lx rate:%lu Hz gain:%.1f dB bits:%u samples:%lu\n",
+		path, (unsigned long)hdr.unit_id, (unsigned long)hdr.sample_hz,
+		hdr.gain / 10.0, hdr.bits, (unsigned long)hdr.samples);
+	if (hdr.sample_hz != CONFIG_RX_SAMPLE_RATE)
+		printf("replay: warning, filters are designed for %u Hz\n", CONFIG_RX_SAMPLE_RATE);
+
+	filter_init();
+	detector_init();
+	if (thresh != NULL) detector_setThreshFactor(strtof(thresh, NULL));
+	rx_init(0, hdr.sample_hz);
+	rx_host_generator(replay_gen, &rd);
+
+	const filter_data_t half = (filter_data_t)(1U << (hdr.bits-1));
+	double tbeg = replay_time();
+	while ((blk = rx_get_block(&cnt)) != NULL) {
+		for (uint32_t i = 0; i < cnt; i++, n++) {
+			if (!filter_addSample((filter_data_t)blk[i] / half - (filter_data_t)1.0))
+				continue;
+			filter_data_t energyValues[FILTER_CHANNELS];
+			filter_getEnergyArray(energyValues);
+			detector_checkHit(energyValues);
+			if (detector_getHit()) {
+				printf("hit chan:%u at:%.1f ms\n", detector_getHitChannel(),
+					n * 1000.0 / hdr.sample_hz);
+				detector_clearHit();
+				hits++;
+			}
+		}
+		rx_release_block();
+	}
+	double elapsed = replay_time() - tbeg;
+
+	printf("replay: hits:%lu samples:%llu bad frames:%lu lost frames:%lu\n",
+		(unsigned long)hits, (unsigned long long)n,
+		(unsigned long)rd.bad, (unsigned long)rd.lost);
+	if (elapsed > 0.0)
+		printf("replay: %.3f s, %.1f times real time\n",
+			elapsed, n / (double)hdr.sample_hz / elapsed);
+	rx_deinit();
+	capture_close(&rd);
+	fclose(fp);
+	exit(0);
+}
@@ -0,0 +1,312 @@
+// Host (Linux target) tool that sweeps detector settings over a directory
+// of raw receive captures with hit ground truth. For every combination of
+// threshold factor and energy window it runs the filter and detector over
+// all captures and writes ROC and detection-latency tables as CSV. Build
+// with MILESTONE "roc" and the linux target, then run:
+//   LTAG_CAPTURES=<dir> [LTAG_THRESH=2,4,8] [LTAG_WINDOW=1000,2000]
+//   [LTAG_JOBS=<workers>] [LTAG_OUT=<dir>] ./build/ltag.elf
+//
+// Each capture <name>.cap (or console log <name>.log) needs a ground truth
+// file <name>.csv with one line per shot: start time in ms, channel.
+// A hit matches a shot on the same channel that started no more than a
+// pulse plus an energy window earlier. Other hits are false alarms. After
+// each hit, detection pauses for the lockout period like the game does.
+//
+// Settings are spread over worker threads, each with its own filter and
+// detector instance (filter_ctx.h, detector_ctx.h). The instances take
+// their coefficients from the filter module, so like the m3t1 milestone
+// the tool links filter.c, coef.c and delay.c from main.
+
+#include <dirent.h> // opendir, readdir
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h> // getenv, malloc, qsort, exit
+#include <string.h> // strcmp, strrchr, strtok
+#include <unistd.h> // sysconf
+
+#include "capture.h"
+#include "config.h" // CONFIG_*
+#include "detector_ctx.h"
+#include "filter_ctx.h"
+
+#define ROC_MAX_CAPTURES 256
+#define ROC_MAX_PARAMS 16 // Values per swept parameter
+#define ROC_MAX_SHOTS 1024 // Shots per capture
+#define ROC_MAX_LAT 4096 // Latencies kept per setting
+#define ROC_PATH 512
+
+typedef struct {
+	char name[ROC_PATH]; // Capture file name
+	rx_data_t *data; // Samples
+	uint32_t count; // Number of samples
+	filter_data_t half; // Half of the ADC range
+	uint32_t shots; // Number of shots in the ground truth
+	uint32_t shot_ms[ROC_MAX_SHOTS]; // Start time of each shot
+	uint16_t shot_ch[ROC_MAX_SHOTS]; // Channel of each shot
+} roc_capture_t;
+
+typedef struct {
+	filter_data_t thresh; // Threshold factor
+	uint32_t window; // Energy window in decimated samples
+	uint32_t shots; // Shots in all captures
+	uint32_t tp; // Hits that matched a shot
+	uint32_t fp; // Hits that did not match a shot
+	double seconds; // Duration of all captures
+	uint32_t lats; // Number of latencies kept
+	float lat[ROC_MAX_LAT]; // Detection latency of each matched hit, ms
+} roc_result_t;
+
+static roc_capture_t *caps[ROC_MAX_CAPTURES];
+static uint32_t ncaps;
+static roc_result_t res[ROC_MAX_PARAMS*ROC_MAX_PARAMS];
+static uint32_t nres;
+static uint32_t jobs;
+
+// Parse a comma-separated list of numbers.
+// Returns the number of values.
+static uint32_t roc_list(const char *s, float val[], uint32_t max)
+{
+	char buf[ROC_PATH];
+	uint32_t n = 0;
+
+	snprintf(buf, sizeof(buf), "%s", s);
+	for (char *t = strtok(buf, ","); t != NULL && n < max; t = strtok(NULL, ","))
+		val[n++] = strtof(t, NULL);
+	return n;
+}
+
+// Load a capture and its ground truth.
+// Return zero if successful, or non-zero otherwise.
+static int32_t roc_load(const char *dir, const char *name)
+{
+	char path[ROC_PATH*2];
+	capture_reader_t *rd;
+	capture_header_t hdr;
+	roc_capture_t *c;
+	FILE *fp;
+	int32_t err = 0;
+
+	if (ncaps == ROC_MAX_CAPTURES) return -1;
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	if ((fp = fopen(path, "rb")) == NULL) return -1;
+	rd = malloc(sizeof(capture_reader_t));
+	c = calloc(1, sizeof(roc_capture_t));
+	if (rd == NULL || c == NULL) abort();
+	snprintf(c->name, sizeof(c->name), "%s", name);
+	if (capture_open(rd, fp, &hdr) || hdr.sample_hz != CONFIG_RX_SAMPLE_RATE || !hdr.bits) {
+		printf("roc: skipping %s, not a capture at %u Hz\n", name, CONFIG_RX_SAMPLE_RATE);
+		err = -1;
+	} else {
+		if ((c->data = malloc(hdr.samples*sizeof(rx_data_t) + 1)) == NULL) abort();
+		c->count = capture_read(rd, c->data, hdr.samples);
+		c->half = (filter_data_t)(1U << (hdr.bits-1));
+		if (rd->bad || rd->lost)
+			printf("roc: %s has %lu bad and %lu lost frames\n", name,
+				(unsigned long)rd->bad, (unsigned long)rd->lost);
+	}
+	capture_close(rd);
+	fclose(fp);
+	free(rd);
+
+	// Ground truth has the same name with a .csv extension
+	char *ext = strrchr(path, '.');
+	strcpy(ext, ".csv");
+	if (!err && (fp = fopen(path, "r")) == NULL) {
+		printf("roc: skipping %s, no ground truth\n", name);
+		err = -1;
+	}
+	if (!err) {
+		unsigned long ms;
+		unsigned ch;
+		char line[ROC_PATH];
+		while (fgets(line, sizeof(line), fp) != NULL && c->shots < ROC_MAX_SHOTS) {
+			if (sscanf(line, "%lu,%u", &ms, &ch) != 2 || ch >= FILTER_CHANNELS) continue;
+			c->shot_ms[c->shots] = ms;
+			c->shot_ch[c->shots++] = ch;
+		}
+		fclose(fp);
+	}
+	if (err) {
+		free(c->data);
+		free(c);
+		return err;
+	}
+	caps[ncaps++] = c;
+	return 0;
+}
+
+// Run one capture through a pipeline instance with the settings in r and
+// accumulate the results.
+static void roc_run(const roc_capture_t *c, roc_result_t *r, filter_ctx_t *f)
+{
+	const uint64_t warmup = (uint64_t)r->window*FILTER_FIR_DECIMATION_FACTOR;
+	const uint64_t lockout = (uint64_t)CONFIG_RX_SAMPLE_RATE*CONFIG_LOCKOUT_PERIOD/1000;
+	const uint32_t tol = CONFIG_TX_PULSE +
+		(uint64_t)r->window*FILTER_FIR_DECIMATION_FACTOR*1000/CONFIG_RX_SAMPLE_RATE;
+	bool matched[ROC_MAX_SHOTS] = {false};
+	uint64_t resume = warmup;
+	detector_ctx_t *d;
+
+	filter_ctx_reset(f);
+	filter_ctx_setEnergyWindow(f, r->window);
+	d = detector_ctx_init(f);
+	detector_ctx_setThreshFactor(d, r->thresh);
+	for (uint64_t n = 0; n < c->count; n++) {
+		if (!filter_ctx_addSample(f, (filter_data_t)c->data[n] / c->half - (filter_data_t)1.0) ||
+			n < resume)
+			continue;
+		filter_data_t energyValues[FILTER_CHANNELS];
+		filter_ctx_getEnergyArray(f, energyValues);
+		detector_ctx_checkHit(d, energyValues);
+		if (!detector_ctx_getHit(d)) continue;
+		uint16_t ch = detector_ctx_getHitChannel(d);
+		uint32_t ms = n*1000/CONFIG_RX_SAMPLE_RATE;
+		detector_ctx_clearHit(d);
+		resume = n + lockout;
+		uint32_t i;
+		for (i = 0; i < c->shots; i++)
+			if (!matched[i] && c->shot_ch[i] == ch &&
+				ms >= c->shot_ms[i] && ms <= c->shot_ms[i] + tol) break;
+		if (i < c->shots) {
+			matched[i] = true;
+			r->tp++;
+			if (r->lats < ROC_MAX_LAT) r->lat[r->lats++] = ms - c->shot_ms[i];
+		} else {
+			r->fp++;
+		}
+	}
+	detector_ctx_free(d);
+	r->shots += c->shots;
+	r->seconds += (double)c->count / CONFIG_RX_SAMPLE_RATE;
+}
+
+// Run all captures with one setting.
+static void roc_setting(roc_result_t *r, filter_ctx_t *f)
+{
+	filter_data_t thresh = r->thresh;
+	uint32_t window = r->window;
+
+	memset(r, 0, sizeof(roc_result_t));
+	r->thresh = thresh;
+	r->window = window;
+	for (uint32_t i = 0; i < ncaps; i++) roc_run(caps[i], r, f);
+}
+
+// Worker thread j runs settings j, j+jobs, j+2*jobs, ...
+static void *roc_worker(void *arg)
+{
+	filter_ctx_t *f = filter_ctx_init();
+
+	for (uint32_t i = (uintptr_t)arg; i < nres; i += jobs) roc_setting(&res[i], f);
+	filter_ctx_free(f);
+	return NULL;
+}
+
+static int roc_cmp(const void *a, const void *b)
+{
+	float x = *(const float *)a, y = *(const float *)b;
+	return (x > y) - (x < y);
+}
+
+// Write the ROC and latency tables.
+// Return zero if successful, or non-zero otherwise.
+static int32_t roc_write(const char *dir)
+{
+	char path[ROC_PATH*2];
+	FILE *roc, *lat;
+
+	snprintf(path, sizeof(path), "%s/roc.csv", dir);
+	if ((roc = fopen(path, "w")) == NULL) return -1;
+	snprintf(path, sizeof(path), "%s/latency.csv", dir);
+	if ((lat = fopen(path, "w")) == NULL) {fclose(roc); return -1;}
+	fprintf(roc, "window,thresh,shots,hits,false_alarms,minutes,pd,fa_per_min\n");
+	fprintf(lat, "window,thresh,count,mean_ms,p50_ms,p90_ms,max_ms\n");
+	for (uint32_t i = 0; i < nres; i++) {
+		roc_result_t *r = &res[i];
+		double minutes = r->seconds / 60.0;
+		fprintf(roc, "%lu,%g,%lu,%lu,%lu,%.3f,%.4f,%.3f\n",
+			(unsigned long)r->window, r->thresh, (unsigned long)r->shots,
+			(unsigned long)r->tp, (unsigned long)r->fp, minutes,
+			r->shots ? (double)r->tp / r->shots : 0.0,
+			(minutes > 0.0) ? r->fp / minutes : 0.0);
+		double sum = 0.0;
+		qsort(r->lat, r->lats, sizeof(float), roc_cmp);
+		for (uint32_t k = 0; k < r->lats; k++) sum += r->lat[k];
+		if (r->lats)
+			fprintf(lat, "%lu,%g,%lu,%.1f,%.0f,%.0f,%.0f\n",
+				(unsigned long)r->window, r->thresh, (unsigned long)r->lats,
+				sum / r->lats, r->lat[r->lats/2], r->lat[r->lats*9/10],
+				r->lat[r->lats-1]);
+		else
+			fprintf(lat, "%lu,%g,0,,,,\n", (unsigned long)r->window, r->thresh);
+	}
+	fclose(roc);
+	fclose(lat);
+	return 0;
+}
+
+// Main application
+void app_main(void)
+{
+	const char *dir = getenv("LTAG_CAPTURES");
+	const char *out = getenv("LTAG_OUT");
+	const char *s;
+	float thresh[ROC_MAX_PARAMS], window[ROC_MAX_PARAMS];
+	uint32_t nthresh, nwindow;
+	long n;
+	struct dirent *de;
+	DIR *dp;
+
+	if (dir == NULL) dir = ".";
+	if (out == NULL) out = ".";
+	nthresh = roc_list((s = getenv("LTAG_THRESH")) ? s : "2,4,8,16,32,64", thresh, ROC_MAX_PARAMS);
+	nwindow = roc_list((s = getenv("LTAG_WINDOW")) ? s : "500,1000,2000", window, ROC_MAX_PARAMS);
+	n = (s = getenv("LTAG_JOBS")) ? atol(s) : sysconf(_SC_NPROCESSORS_ONLN);
+	jobs = (n < 1) ? 1 : n;
+
+	if ((dp = opendir(dir)) == NULL) {
+		printf("roc: cannot open %s\n", dir);
+		exit(1);
+	}
+	while ((de = readdir(dp)) != NULL) {
+		const char *ext = strrchr(de->d_name, '.');
+		if (ext != NULL && (!strcmp(ext, ".cap") || !strcmp(ext, ".log")))
+			roc_load(dir, de->d_name);
+	}
+	closedir(dp);
+	if (!ncaps) {
+		printf("roc: no captures with ground truth in %s\n", dir);
+		exit(1);
+	}
+
+	filter_init(); // Coefficients shared by all instances
+	for (uint32_t w = 0; w < nwindow; w++) {
+		if (window[w] < 1 || window[w] > FILTER_ENERGY_SAMPLE_COUNT) continue;
+		for (uint32_t t = 0; t < nthresh; t++) {
+			res[nres].window = window[w];
+			res[nres++].thresh = thresh[t];
+		}
+	}
+	if (!nres) {
+		printf("roc: no LTAG_WINDOW in 1..%d\n", FILTER_ENERGY_SAMPLE_COUNT);
+		exit(1);
+	}
+	if (jobs > nres) jobs = nres;
+	printf("roc: %lu captures, %lu settings, %lu workers\n",
+		(unsigned long)ncaps, (unsigned long)nres, (unsigned long)jobs);
+
+	pthread_t tid[jobs];
+	for (uint32_t j = 0; j < jobs; j++)
+		if (pthread_create(&tid[j], NULL, roc_worker, (void *)(uintptr_t)j)) {
+			printf("roc: cannot start worker\n");
+			exit(1);
+		}
+	for (uint32_t j = 0; j < jobs; j++) pthread_join(tid[j], NULL);
+
+	if (roc_write(out)) {
+		printf("roc: error writing results\n");
+		exit(1);
+	}
+	printf("roc: wrote %s/roc.csv and %s/latency.csv\n", out, out);
+	exit(0);
+}
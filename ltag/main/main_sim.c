@@ -0,0 +1,166 @@
+// Host (Linux target) simulation of a complete tag unit. Runs a scripted
+// match against one unit (unit.h): trigger presses, with bounces, and
+// shots from other players through a synthetic optical channel
+// (chansim.h). The game, debounce and timers are the same code as on the
+// target, and the filter instance uses the coefficients of filter.c, all
+// on a virtual clock, so a match runs many times faster than real time.
+// Build with MILESTONE "sim" and the linux target, then run:
+//   [LTAG_RUNS=<runs>] [LTAG_SECONDS=<match length>] [LTAG_QUIET=1]
+//   ./build/ltag.elf
+//
+// The game log of the first run is printed, one line per state change,
+// then a summary of each run (each with its own noise seed) and the speed
+// of the simulation. The first run is repeated at the end and must give
+// the same log, which makes the log usable as a regression reference.
+
+#include <stdio.h>
+#include <stdlib.h> // getenv, exit
+#include <time.h> // clock_gettime
+
+#include "chansim.h"
+#include "config.h" // CONFIG_*
+#include "unit.h"
+
+#define ADC_BITS 12
+#define TEAM CONFIG_GAME_TEAM_A
+#define FOE CONFIG_GAME_TEAM_B
+#define RUNS 10
+#define SECONDS 60
+#define END UINT32_MAX
+
+// Scripted trigger level change
+typedef struct {
+	uint32_t t_ms;
+	bool pressed;
+} sim_press_t;
+
+// Trigger script: single shots with a bouncy press, an empty clip, and a
+// held trigger for a manual reload.
+static const sim_press_t press[] = {
+	{.t_ms = 500, .pressed = 1}, {.t_ms = 501, .pressed = 0}, // Bouncy press, one shot
+	{.t_ms = 502, .pressed = 1}, {.t_ms = 700, .pressed = 0},
+	{.t_ms = 1500, .pressed = 1}, {.t_ms = 1600, .pressed = 0},
+	{.t_ms = 2000, .pressed = 1}, {.t_ms = 2100, .pressed = 0},
+	{.t_ms = 2500, .pressed = 1}, {.t_ms = 2600, .pressed = 0},
+	{.t_ms = 3000, .pressed = 1}, {.t_ms = 3100, .pressed = 0},
+	{.t_ms = 3500, .pressed = 1}, {.t_ms = 3600, .pressed = 0},
+	{.t_ms = 4000, .pressed = 1}, {.t_ms = 4100, .pressed = 0},
+	{.t_ms = 4500, .pressed = 1}, {.t_ms = 4600, .pressed = 0},
+	{.t_ms = 5000, .pressed = 1}, {.t_ms = 5100, .pressed = 0},
+	{.t_ms = 5500, .pressed = 1}, {.t_ms = 5600, .pressed = 0},
+	{.t_ms = 6000, .pressed = 1}, {.t_ms = 6100, .pressed = 0}, // Clip empty, auto reload
+	{.t_ms = 10000, .pressed = 1}, {.t_ms = 10100, .pressed = 0},
+	{.t_ms = 12000, .pressed = 1}, {.t_ms = 12003, .pressed = 0}, // Glitch, no shot
+	{.t_ms = 14000, .pressed = 1}, {.t_ms = 18000, .pressed = 0}, // Held, manual reload
+	{.t_ms = 20000, .pressed = 1}, {.t_ms = 20100, .pressed = 0},
+	{.t_ms = END},
+};
+
+// Other players, shooting at the unit
+static const chansim_shooter_t shooter[] = {
+	// Foe in range, a shot every 1.3 s
+	{.freq_hz = 0, .amp = 0.02f, .start_us = 1000000, .pulse_us = CONFIG_TX_PULSE*1000,
+	 .period_us = 1300000, .count = 0},
+	// Teammate, never counts
+	{.freq_hz = 0, .amp = 0.01f, .start_us = 1500000, .pulse_us = CONFIG_TX_PULSE*1000,
+	 .period_us = 2100000, .count = 0},
+};
+static const uint16_t shooter_chan[] = {FOE, TEAM};
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+
+static bool print_log;
+static uint32_t log_hash;
+
+// Log callback: hash every line and print it if enabled.
+static void sim_log(void *ctx, const unit_t *u, const char *msg)
+{
+	char line[UNIT_LOG+32];
+	int n = snprintf(line, sizeof(line), "%9.3f u%u %s", u->now_us/1e6, u->id, msg);
+
+	for (int i = 0; i < n; i++) log_hash = (log_hash ^ (uint8_t)line[i]) * 16777619;
+	if (print_log) printf("%s\n", line);
+}
+
+// Run one match.
+// Returns the log hash.
+static uint32_t sim_run(unit_t *u, uint32_t seed, uint32_t seconds)
+{
+	static rx_data_t buf[CONFIG_RX_FRAME];
+	chansim_t c;
+	const sim_press_t *p = press;
+	uint32_t cnt;
+
+	log_hash = 2166136261;
+	chansim_init(&c, CONFIG_RX_SAMPLE_RATE, ADC_BITS);
+	c.noise = 0.01f;
+	c.flicker = 0.02f;
+	c.seed = seed;
+	c.length = (uint64_t)seconds * CONFIG_RX_SAMPLE_RATE;
+	for (uint16_t i = 0; i < sizeof(shooter)/sizeof(shooter[0]); i++) {
+		chansim_shooter_t s = shooter[i];
+		s.freq_hz = play_freq[shooter_chan[i]];
+		chansim_addShooter(&c, &s);
+	}
+	unit_init(u, 0, TEAM, sim_log, NULL);
+	for (;;) {
+		// Stop at the next scripted press
+		uint32_t n = CONFIG_RX_FRAME;
+		if (p->t_ms != END) {
+			uint64_t at = (uint64_t)p->t_ms * CONFIG_RX_SAMPLE_RATE / 1000;
+			while (p->t_ms != END && at <= u->samples) {
+				unit_trigger(u, p->pressed);
+				p++;
+				at = (uint64_t)p->t_ms * CONFIG_RX_SAMPLE_RATE / 1000;
+			}
+			if (p->t_ms != END && at - u->samples < n) n = at - u->samples;
+		}
+		if (!(cnt = chansim_generate(buf, n, &c))) break;
+		unit_step(u, buf, cnt);
+	}
+	unit_free(u);
+	return log_hash;
+}
+
+// Return the wall time in seconds.
+static double sim_wall(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec/1e9;
+}
+
+// Main application
+void app_main(void)
+{
+	static unit_t u;
+	const char *s;
+	uint32_t runs = RUNS, seconds = SECONDS;
+
+	if ((s = getenv("LTAG_RUNS")) != NULL && atoi(s) > 0) runs = atoi(s);
+	if ((s = getenv("LTAG_SECONDS")) != NULL && atoi(s) > 0) seconds = atoi(s);
+	print_log = getenv("LTAG_QUIET") == NULL;
+
+	printf("sim: %lu runs of %lu s, team ch%u, foe ch%u\n",
+		(unsigned long)runs, (unsigned long)seconds, TEAM, FOE);
+	filter_init(); // Coefficients shared by all instances
+	double t0 = sim_wall();
+	uint32_t first = 0;
+	for (uint32_t r = 0; r < runs; r++) {
+		uint32_t h = sim_run(&u, r+1, seconds);
+		if (r == 0) {
+			first = h;
+			print_log = false;
+		}
+		printf("run %3lu: lives:%u taken:%lu fired:%lu detected:%lu state:%u log:%08lx\n",
+			(unsigned long)r, u.game.lives, (unsigned long)u.game.taken,
+			(unsigned long)u.game.fired, (unsigned long)u.detected, u.game.state,
+			(unsigned long)h);
+	}
+	double wall = sim_wall() - t0;
+	printf("simulated %lu s in %.2f s, %.0fx real time\n",
+		(unsigned long)(runs*seconds), wall, runs*seconds/wall);
+
+	uint32_t again = sim_run(&u, 1, seconds);
+	printf("repeat of run 0: %s\n", again == first ? "same log" : "DIFFERENT LOG");
+	exit(again == first ? 0 : 1);
+}
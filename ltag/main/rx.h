@@ -5,19 +5,58 @@
 #include <stdint.h>
 
 // The receiver captures an input signal on a GPIO pin. The GPIO pin and
-// sample frequency are selected at initialization. The samples are stored in
-// a circular buffer until retrieved with rx_get_sample(). Writes to the
-// buffer overwrite previous values if they are not retrieved fast enough.
+// sample frequency are selected at initialization. The ADC delivers samples
+// in frames of up to CONFIG_RX_FRAME samples. Frames are stored as blocks in
+// a circular queue of CONFIG_RX_FRAMES blocks until retrieved, either one
+// sample at a time with rx_get_sample(), or a whole block at a time with
+// rx_get_block() and rx_release_block(). If the queue is full when a new
+// frame arrives, the oldest block is overwritten unless it is held by
+// rx_get_block(), in which case the new frame is dropped.
+//
+// Typical block consumer:
+//   const rx_data_t *blk;
+//   uint32_t cnt;
+//   while ((blk = rx_get_block(&cnt)) != NULL) {
+//     for (uint32_t i = 0; i < cnt; i++) ... process blk[i] ...
+//     rx_release_block();
+//   }
+//
+// A consumer task can sleep until blocks arrive instead of polling: a
+// function registered with rx_register_ready() is called each time a block
+// is queued, for example to give the task a notification.
+//
+// With two sensors (rx_init_dual()), both pins are sampled in the same ADC
+// scan and blocks hold interleaved pairs: blk[2*i] from the first sensor,
+// blk[2*i+1] from the second. Block counts are then always even.
 
 // Receive sample type
 typedef uint16_t rx_data_t;
 
+// Block ready function. Called in the ADC ISR, so it must be short, must
+// not block, and must be placed in IRAM (IRAM_ATTR).
+// arg: argument given to rx_register_ready().
+// Returns true if a higher priority task was woken.
+typedef bool (*rx_ready_t)(void *arg);
+
 // Initialize the receiver (ADC unit).
 // gpio_num: GPIO pin number.
 // freq_hz: sample frequency of the input signal in Hz.
 // Return zero if successful, or non-zero otherwise.
 int32_t rx_init(int32_t gpio_num, uint32_t freq_hz);
 
+// Initialize the receiver with two sensors sampled in the same ADC scan,
+// for example one on each side of a vest. Both pins must be on the same
+// ADC unit. The ADC scan rate is twice the sample frequency, which must be
+// within the ADC limit of the target. CONFIG_RX_DUAL_RATE fits all targets.
+// gpio_num: GPIO pin number of the first sensor.
+// gpio_num2: GPIO pin number of the second sensor.
+// freq_hz: sample frequency of each sensor in Hz.
+// Return zero if successful, or non-zero otherwise.
+int32_t rx_init_dual(int32_t gpio_num, int32_t gpio_num2, uint32_t freq_hz);
+
+// Return the number of sensors interleaved in each block (1 or 2).
+uint16_t rx_get_sensors(void);
+
 // Free resources used by the receiver (ADC unit).
 // Return zero if successful, or non-zero otherwise.
 int32_t rx_deinit(void);
@@ -33,6 +72,25 @@ uint32_t rx_get_count(void);
 // Clear the input buffer.
 void rx_clear_buffer(void);
 
+// Get the oldest block of samples without copying. The block stays valid
+// and is not overwritten until rx_release_block() is called. Calling
+// rx_get_block() again before release returns the same block. Do not
+// call rx_get_sample() while a block is held.
+// count: set to the number of samples in the block.
+// Returns a pointer to the samples, or NULL if no block is available.
+const rx_data_t *rx_get_block(uint32_t *count);
+
+// Release the block returned by rx_get_block() so it can be reused.
+void rx_release_block(void);
+
+// Return the number of samples dropped because the consumer fell behind.
+uint32_t rx_get_dropped(void);
+
+// Register a function called each time a block is queued.
+// ready: block ready function, or NULL for none.
+// arg: argument passed to each call of the function.
+void rx_register_ready(rx_ready_t ready, void *arg);
+
 // Enable or disable capture from the input device.
 // enable: if true, enable capture, otherwise disable.
 void rx_device(bool enable);
@@ -0,0 +1,41 @@
+#ifndef RX_HOST_H_
+#define RX_HOST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rx.h"
+
+// Sample sources for the host (Linux) build of the receiver. Instead of an
+// ADC, blocks are produced on demand from a generator function or a file
+// when the consumer asks for samples, so the same consumer code runs on a
+// host as fast as it can process the samples. Select a source before or
+// after rx_init(). The sample frequency given to rx_init() is recorded and
+// returned by rx_host_get_freq() for generators that need it. After
+// rx_init_dual(), the source must produce interleaved sensor pairs and an
+// even number of samples per call.
+
+// Generator function. Fill buf with up to size samples.
+// buf: buffer to fill.
+// size: capacity of the buffer in samples.
+// ctx: context pointer given to rx_host_generator().
+// Returns the number of samples produced, zero at the end of the stream.
+typedef uint32_t (*rx_host_gen_t)(rx_data_t *buf, uint32_t size, void *ctx);
+
+// Produce samples by calling a generator function.
+// gen: generator function.
+// ctx: context pointer passed to each call of the generator.
+void rx_host_generator(rx_host_gen_t gen, void *ctx);
+
+// Produce samples read from a file of raw 16-bit little-endian samples.
+// path: path of the file.
+// Return zero if successful, or non-zero otherwise.
+int32_t rx_host_file(const char *path);
+
+// Return true if the source has no more samples.
+bool rx_host_eof(void);
+
+// Return the sample frequency given to rx_init().
+uint32_t rx_host_get_freq(void);
+
+#endif // RX_HOST_H_
@@ -12,13 +12,14 @@ reload of the clip at any time by pulling and holding the trigger for S seconds
 (if the clip contains shots, the initial press of the trigger will fire a shot).
 
 Implementation: During initialization, the shot count is set to the maximum 
-count N. Also, a reload timer is created. The shot count is decremented when a 
-user fires a shot and can be reloaded after a delay (S). A call to 
-shot_timer_start() initiates a timer that runs once for the period specified in 
-shot_init(). At timer expiration, the shot count is reloaded to the maximum 
-count and the reload callback function is called. The timer can be stopped 
-before expiration with a call to shot_timer_stop(), thus preventing a reload of 
-shots.
+count N. Also, a reload timer is created, a twheel_timer_t of the timer 
+service in twheel.h, whose callback reloads the shots. The shot count is 
+decremented when a user fires a shot and can be reloaded after a delay (S). A 
+call to shot_timer_start() initiates a timer that runs once for the period 
+specified in shot_init(). At timer expiration, the shot count is reloaded to 
+the maximum count and the reload callback function is called. The timer can be 
+stopped before expiration with a call to shot_timer_stop(), thus preventing a 
+reload of shots.
 
 Usage Instructions: when the trigger is pressed with shots remaining, call 
 shot_decrement(). Call shot_timer_start() each time the trigger is pressed to 
@@ -0,0 +1,140 @@
+#include "shotid.h"
+#include "txsched.h"
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+
+int32_t shotid_encode(uint16_t team, uint16_t id, uint16_t tone[])
+{
+	if (team >= FILTER_CHANNELS || id >= SHOTID_IDS) return -1;
+	tone[0] = team;
+	// Most significant digit first
+	for (uint16_t i = SHOTID_TONES-1; i > 0; i--) {
+		tone[i] = id % SHOTID_BASE;
+		id /= SHOTID_BASE;
+	}
+	for (uint16_t i = 1; i < SHOTID_TONES; i++)
+		tone[i] = (tone[i-1] + 1 + tone[i]) % FILTER_CHANNELS;
+	return 0;
+}
+
+int32_t shotid_decode(const uint16_t tone[])
+{
+	int32_t id = 0;
+
+	for (uint16_t i = 1; i < SHOTID_TONES; i++) {
+		if (tone[i] >= FILTER_CHANNELS || tone[i] == tone[i-1]) return -1;
+		id = id*SHOTID_BASE +
+			(tone[i] + FILTER_CHANNELS - tone[i-1] - 1) % FILTER_CHANNELS;
+	}
+	return id;
+}
+
+int32_t shotid_send(uint16_t team, uint16_t id, uint32_t tone_us)
+{
+	uint16_t tone[SHOTID_TONES];
+	txsched_seg_t seg[SHOTID_TONES];
+
+	if (shotid_encode(team, id, tone)) return -1;
+	for (uint16_t i = 0; i < SHOTID_TONES; i++)
+		seg[i] = (txsched_seg_t){play_freq[tone[i]], tone_us, 0};
+	return txsched_queue(seg, SHOTID_TONES);
+}
+
+void shotid_dec_init(shotid_dec_t *d, filter_data_t threshFactor, uint16_t interval)
+{
+	d->threshFactor = threshFactor;
+	d->interval = interval ? interval : 1;
+	shotid_dec_reset(d);
+}
+
+void shotid_dec_reset(shotid_dec_t *d)
+{
+	d->phase = 0;
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) d->prev[i] = 0.0f;
+	d->count = 0;
+	d->cand = -1;
+	d->candCount = 0;
+	d->quiet = 0;
+	d->hold = false;
+	d->ready = false;
+}
+
+// Return the median of the channel energies.
+static filter_data_t shotid_median(const filter_data_t energy[])
+{
+	filter_data_t s[FILTER_CHANNELS];
+
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) { // Insertion sort
+		filter_data_t v = energy[i];
+		uint16_t j = i;
+		for (; j > 0 && s[j-1] > v; j--) s[j] = s[j-1];
+		s[j] = v;
+	}
+	return (s[(FILTER_CHANNELS-1)/2] + s[FILTER_CHANNELS/2]) / 2;
+}
+
+bool shotid_dec_addEnergy(shotid_dec_t *d, const filter_data_t energy[])
+{
+	filter_data_t thresh, rise = 0.0f;
+	int16_t c = -1;
+	bool above = false;
+
+	if (d->ready) return true;
+	if (++d->phase < d->interval) return false;
+	d->phase = 0;
+
+	// Find the channel with the largest rise among those above threshold.
+	thresh = d->threshFactor * shotid_median(energy);
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) {
+		filter_data_t r = energy[i] - d->prev[i];
+		d->prev[i] = energy[i];
+		if (energy[i] <= thresh) continue;
+		above = true;
+		if (r > rise) {
+			rise = r;
+			c = i;
+		}
+	}
+	if (!above) {
+		d->cand = -1;
+		d->hold = false; // The last shot has ended
+		if (d->count && ++d->quiet >= SHOTID_GAP) d->count = 0;
+		return false;
+	}
+	d->quiet = 0;
+	if (c < 0 || d->hold || (d->count && c == d->tone[d->count-1])) {
+		d->cand = -1;
+		return false;
+	}
+	if (c != d->cand) {
+		d->cand = c;
+		d->candCount = 0;
+	}
+	if (++d->candCount < SHOTID_DWELL) return false;
+	d->tone[d->count++] = c;
+	d->cand = -1;
+	if (d->count < SHOTID_TONES) return false;
+	d->count = 0;
+	d->hold = true; // Ignore the tail of the last tone
+	int32_t id = shotid_decode(d->tone);
+	if (id < 0) return false;
+	d->team = d->tone[0];
+	d->id = id;
+	d->ready = true;
+	return true;
+}
+
+uint16_t shotid_dec_getTeam(shotid_dec_t *d)
+{
+	return d->team;
+}
+
+uint16_t shotid_dec_getId(shotid_dec_t *d)
+{
+	return d->id;
+}
+
+void shotid_dec_clear(shotid_dec_t *d)
+{
+	d->ready = false;
+}
@@ -0,0 +1,103 @@
+#ifndef SHOTID_H_
+#define SHOTID_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "config.h" // CONFIG_TX_ID_*
+#include "filter.h"
+
+// Identity shots. A shot is a sequence of CONFIG_TX_ID_TONES tones from
+// CONFIG_PLAY_FREQ. The first tone is on the team channel, so an ordinary
+// detector still sees a hit on that channel. Each following tone differs
+// from the one before it and carries one base-(FILTER_CHANNELS-1) digit of
+// the player ID: tone[i] = (tone[i-1] + 1 + digit) % FILTER_CHANNELS.
+// With three tones there are 81 players per team.
+//
+// The decoder looks at the energy values from the filter once per check
+// interval of decimated samples. During a tone, the energy of its channel
+// rises while the energy of the tone before it falls, so the channel with
+// the largest rise steps through the tones in order, even when the
+// channels have somewhat different gains. A channel counts as the next
+// tone once it has had the largest rise, with its energy above threshold,
+// for SHOTID_DWELL consecutive checks. Between checks the decoder only
+// counts samples, and a check costs a median of the channel energies and
+// a few comparisons.
+
+#define SHOTID_TONES CONFIG_TX_ID_TONES
+#define SHOTID_BASE (FILTER_CHANNELS-1)
+#if SHOTID_TONES == 2
+#define SHOTID_IDS SHOTID_BASE // Players per team
+#elif SHOTID_TONES == 3
+#define SHOTID_IDS (SHOTID_BASE*SHOTID_BASE)
+#else
+#error "CONFIG_TX_ID_TONES must be 2 or 3"
+#endif
+#define SHOTID_DWELL 2 // Checks with the largest rise to accept a tone
+#define SHOTID_GAP 4 // Checks below threshold to abandon a shot
+
+// Decoder state
+typedef struct {
+	filter_data_t threshFactor; // Energy vs. median energy
+	uint16_t interval; // Decimated samples between checks
+	uint16_t phase; // Decimated samples since the last check
+	filter_data_t prev[FILTER_CHANNELS]; // Energies at the last check
+	uint16_t tone[SHOTID_TONES]; // Channels of the tones so far
+	uint16_t count; // Tones so far
+	int16_t cand; // Channel that may become the next tone, or -1
+	uint16_t candCount; // Checks the candidate has had the largest rise
+	uint16_t quiet; // Checks below threshold
+	bool hold; // Decoded, waiting for the energy to fall
+	bool ready; // A decoded shot is available
+	uint16_t team; // Team channel of the decoded shot
+	uint16_t id; // Player ID of the decoded shot
+} shotid_dec_t;
+
+// Compute the tone channels for a shot.
+// team: team channel (0 to FILTER_CHANNELS-1).
+// id: player ID (0 to SHOTID_IDS-1).
+// tone: set to the channel of each tone.
+// Return zero if successful, or non-zero if the ID is out of range.
+int32_t shotid_encode(uint16_t team, uint16_t id, uint16_t tone[]);
+
+// Compute the player ID from the tone channels of a shot.
+// tone: channel of each tone.
+// Returns the player ID, or -1 if the tones are not a valid shot.
+int32_t shotid_decode(const uint16_t tone[]);
+
+// Queue an identity shot on the transmit scheduler (txsched.h), which must
+// be initialized. Does not block.
+// team: team channel.
+// id: player ID.
+// tone_us: duration of each tone in microseconds.
+// Return zero if successful, or non-zero otherwise.
+int32_t shotid_send(uint16_t team, uint16_t id, uint32_t tone_us);
+
+// Initialize a decoder.
+// d: decoder state.
+// threshFactor: the energy of a tone must exceed threshFactor times the
+//   median energy.
+// interval: decimated samples between checks. Use about a quarter of the
+//   tone duration.
+void shotid_dec_init(shotid_dec_t *d, filter_data_t threshFactor, uint16_t interval);
+
+// Abandon a partial shot and clear a decoded one.
+void shotid_dec_reset(shotid_dec_t *d);
+
+// Add the energy values of one decimated sample, the same values given to
+// the detector.
+// energy: energy value of each channel.
+// Returns true when a shot has been decoded. It stays available until
+// shotid_dec_clear() is called.
+bool shotid_dec_addEnergy(shotid_dec_t *d, const filter_data_t energy[]);
+
+// Return the team channel of the decoded shot.
+uint16_t shotid_dec_getTeam(shotid_dec_t *d);
+
+// Return the player ID of the decoded shot.
+uint16_t shotid_dec_getId(shotid_dec_t *d);
+
+// Clear the decoded shot once you have accounted for it.
+void shotid_dec_clear(shotid_dec_t *d);
+
+#endif // SHOTID_H_
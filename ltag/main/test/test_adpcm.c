@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h> // log10
+#include <string.h> // memcpy
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_cpu.h" // esp_cpu_get_cycle_count
+#endif
+
+#include "adpcm.h"
+#include "asset.h"
+#include "mixer.h"
+#include "bcFire.h"
+#include "ouch.h"
+
+#define BLOCK 64 // Samples in an I2S DMA block
+#define PIECE 37 // Odd piece size, not aligned with blocks or bytes
+#define MIN_SNR 20.0 // dB, round trip of the game sounds
+#define BENCH_BLOCKS 500
+#define MAX_SAMPLES BCFIRE_SAMPLES
+
+static uint8_t enc[sizeof(asset_hdr_t) + (MAX_SAMPLES/ADPCM_SAMPLES+1)*ADPCM_BLOCK];
+static int16_t dec[MAX_SAMPLES];
+static int16_t alt[MAX_SAMPLES];
+
+// Return the SNR in dB of decoded samples.
+static double ad_snr(const int16_t *ref, const int16_t *d, uint32_t n)
+{
+	double sig = 0.0, err = 0.0;
+	for (uint32_t i = 0; i < n; i++) {
+		sig += (double)ref[i]*ref[i];
+		err += (double)(ref[i]-d[i])*(ref[i]-d[i]);
+	}
+	return 10.0*log10((sig + 1e-9)/(err + 1e-9));
+}
+
+// Encode and decode a sound, check the size and SNR, and check that
+// decoding in odd pieces gives the same samples as in one go.
+// Return true if the checks pass.
+static bool ad_round_trip(const char *name, const int16_t *s, uint32_t n)
+{
+	adpcm_state_t st;
+	uint32_t size = adpcm_encode(s, n, enc);
+	bool ok = true;
+
+	if (size != adpcm_size(n)) {
+		printf(" -- error: %s encoded to %lu bytes, expecting %lu\n", name,
+			(unsigned long)size, (unsigned long)adpcm_size(n));
+		ok = false;
+	}
+	adpcm_decode(&st, enc, 0, dec, n);
+	for (uint32_t i = 0; i < n; i += PIECE)
+		adpcm_decode(&st, enc, i, alt + i, (n - i < PIECE) ? n - i : PIECE);
+	if (memcmp(dec, alt, n*sizeof(dec[0]))) {
+		printf(" -- error: %s decoded in pieces differs\n", name);
+		ok = false;
+	}
+	double snr = ad_snr(s, dec, n);
+	printf("%s: %lu samples, %lu bytes (%.1f:1), SNR %.1f dB\n", name, (unsigned long)n,
+		(unsigned long)size, (double)n*sizeof(int16_t)/size, snr);
+	if (snr < MIN_SNR) {
+		printf(" -- error: SNR below %.1f dB\n", MIN_SNR);
+		ok = false;
+	}
+	return ok;
+}
+
+// Play an ADPCM asset with a header through the mixer, as sound_start()
+// does, and compare with the decoded samples. The sound is looped to
+// check that it starts over at the end.
+// Return true if the checks pass.
+static bool ad_asset(void)
+{
+	static mixer_t mix;
+	asset_hdr_t hdr = {ASSET_MAGIC, MIXER_ADPCM, {0}, OUCH_SAMPLE_RATE, OUCH_SAMPLES};
+	uint32_t size = sizeof(hdr) + adpcm_encode(ouch, OUCH_SAMPLES, enc + sizeof(hdr));
+	int16_t blk[BLOCK];
+	adpcm_state_t st;
+
+	memcpy(enc, &hdr, sizeof(hdr));
+	adpcm_decode(&st, enc + sizeof(hdr), 0, dec, OUCH_SAMPLES);
+	mixer_init(&mix);
+	if (mixer_play_asset(&mix, enc, size, MIXER_S16, true, MIXER_UNITY) < 0) {
+		printf(" -- error: asset header not found\n");
+		return false;
+	}
+	for (uint32_t n = 0; n < OUCH_SAMPLES*2; n += BLOCK) {
+		mixer_render(&mix, blk, BLOCK);
+		for (uint32_t i = 0; i < BLOCK; i++)
+			if (blk[i] != dec[(n+i) % OUCH_SAMPLES]) {
+				printf(" -- error: asset sample %lu is %d, expecting %d\n",
+					(unsigned long)(n+i), blk[i], dec[(n+i) % OUCH_SAMPLES]);
+				return false;
+			}
+	}
+	if (asset_parse(enc, size - 1, &hdr)) {
+		printf(" -- error: truncated asset accepted\n");
+		return false;
+	}
+	printf("ADPCM asset played through the mixer, looped\n");
+	return true;
+}
+
+// Time the decoding of a DMA block.
+static void ad_bench(void)
+{
+	adpcm_state_t st;
+	int16_t blk[BLOCK];
+	uint32_t blocks = BCFIRE_SAMPLES/BLOCK; // Decoded in order, then again
+
+	adpcm_encode(bcFire, BCFIRE_SAMPLES, enc);
+#if CONFIG_IDF_TARGET_LINUX
+	int64_t t0 = esp_timer_get_time();
+	for (uint32_t k = 0; k < BENCH_BLOCKS; k++)
+		adpcm_decode(&st, enc, (k % blocks)*BLOCK, blk, BLOCK);
+	int64_t t1 = esp_timer_get_time();
+	printf("adpcm_decode() %d samples: %lld ns per block\n",
+		BLOCK, (long long)(t1-t0)*1000/BENCH_BLOCKS);
+#else
+	uint32_t c0 = esp_cpu_get_cycle_count();
+	for (uint32_t k = 0; k < BENCH_BLOCKS; k++)
+		adpcm_decode(&st, enc, (k % blocks)*BLOCK, blk, BLOCK);
+	uint32_t c1 = esp_cpu_get_cycle_count();
+	printf("adpcm_decode() %d samples: %lu cycles per block\n",
+		BLOCK, (c1-c0)/BENCH_BLOCKS);
+#endif
+}
+
+void test_adpcm(void)
+{
+	bool err = false;
+
+	printf("******** test_adpcm() ********\n");
+	if (!ad_round_trip("bcFire", bcFire, BCFIRE_SAMPLES)) err = true;
+	if (!ad_round_trip("ouch", ouch, OUCH_SAMPLES)) err = true;
+	if (!ad_asset()) err = true;
+	ad_bench();
+
+	printf("******** test_adpcm() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
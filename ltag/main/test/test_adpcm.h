@@ -0,0 +1,7 @@
+#ifndef TEST_ADPCM_H_
+#define TEST_ADPCM_H_
+
+// Run tests of the ADPCM codec and ADPCM assets.
+void test_adpcm(void);
+
+#endif // TEST_ADPCM_H_
@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h> // memcpy, memset
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "adpcm.h"
+#include "asset.h"
+#include "bank.h"
+#include "mixer.h"
+#include "bcFire.h"
+#include "ouch.h"
+
+#define BANK_FILE "bank.bin" // Written on a host to test bank_load()
+#define BLOCK 64 // Samples in an I2S DMA block
+#define BANK_MAX (sizeof(bank_hdr_t) + 2*sizeof(bank_entry_t) + \
+	2*sizeof(asset_hdr_t) + sizeof(ouch) + (BCFIRE_SAMPLES/ADPCM_SAMPLES+1)*ADPCM_BLOCK)
+
+static uint8_t enc[(BCFIRE_SAMPLES/ADPCM_SAMPLES+1)*ADPCM_BLOCK];
+static uint8_t buf[BANK_MAX]; // Packed bank
+static uint8_t bad[BANK_MAX]; // Damaged copy
+static int16_t dec[BCFIRE_SAMPLES];
+
+// Play a sound of a bank through the mixer, as sound_start() does, and
+// compare with the expected samples. Check that the voice plays from the
+// bank, with no copy.
+// Return true if the checks pass.
+static bool bk_play(const bank_t *b, const char *name, const int16_t *ref, uint32_t n)
+{
+	static mixer_t mix;
+	int16_t blk[BLOCK];
+	uint32_t size;
+	const uint8_t *audio = bank_audio(b, bank_find(b, name), &size);
+
+	if (audio == NULL) {
+		printf(" -- error: %s not found\n", name);
+		return false;
+	}
+	mixer_init(&mix);
+	mixer_handle_t h = mixer_play_asset(&mix, audio, size, MIXER_S16, false, MIXER_UNITY);
+	if (h < 0 || mix.v[h & 0xFF].base != audio + sizeof(asset_hdr_t)) {
+		printf(" -- error: %s not played from the bank\n", name);
+		return false;
+	}
+	for (uint32_t k = 0; k < n; k += BLOCK) {
+		mixer_render(&mix, blk, BLOCK);
+		for (uint32_t i = 0; i < BLOCK && k+i < n; i++)
+			if (blk[i] != ref[k+i]) {
+				printf(" -- error: %s sample %lu is %d, expecting %d\n", name,
+					(unsigned long)(k+i), blk[i], ref[k+i]);
+				return false;
+			}
+	}
+	return true;
+}
+
+// Pack a bank with a 16-bit and an ADPCM sound, open it and play both.
+// On a host, the bank also goes through a file and bank_load().
+// Return true if the checks pass.
+static bool bk_pack(uint32_t *size)
+{
+	bank_src_t src[] = {
+		{"ouch", MIXER_S16, OUCH_SAMPLE_RATE, OUCH_SAMPLES, ouch},
+		{"bcFire", MIXER_ADPCM, BCFIRE_SAMPLE_RATE, BCFIRE_SAMPLES, enc},
+	};
+	adpcm_state_t st;
+	bank_t b;
+	bool ok = true;
+
+	adpcm_encode(bcFire, BCFIRE_SAMPLES, enc);
+	adpcm_decode(&st, enc, 0, dec, BCFIRE_SAMPLES);
+	*size = bank_pack(buf, sizeof(buf), src, 2);
+	if (!*size || *size != bank_pack(NULL, 0, src, 2) || bank_pack(buf, *size-1, src, 2)) {
+		printf(" -- error: bank_pack() size %lu\n", (unsigned long)*size);
+		return false;
+	}
+#if CONFIG_IDF_TARGET_LINUX
+	FILE *f = fopen(BANK_FILE, "wb");
+	if (f == NULL || fwrite(buf, 1, *size, f) != *size) {
+		printf(" -- error: cannot write %s\n", BANK_FILE);
+		if (f) fclose(f);
+		return false;
+	}
+	fclose(f);
+	if (!bank_load(&b, BANK_FILE)) {
+		printf(" -- error: bank_load() failed\n");
+		return false;
+	}
+#else
+	if (!bank_open(&b, buf, *size)) {
+		printf(" -- error: bank_open() failed\n");
+		return false;
+	}
+#endif
+	const bank_entry_t *e = bank_entry(&b, bank_find(&b, "bcFire"));
+	if (b.count != 2 || e == NULL || e->fmt != MIXER_ADPCM ||
+		e->rate != BCFIRE_SAMPLE_RATE || e->samples != BCFIRE_SAMPLES ||
+		bank_find(&b, "ouc") != BANK_NONE || bank_entry(&b, 2) != NULL) {
+		printf(" -- error: bad index\n");
+		ok = false;
+	}
+	if (!bk_play(&b, "ouch", ouch, OUCH_SAMPLES)) ok = false;
+	if (!bk_play(&b, "bcFire", dec, BCFIRE_SAMPLES)) ok = false;
+	bank_close(&b);
+	if (ok) printf("bank of %lu bytes packed, opened and played\n", (unsigned long)*size);
+	return ok;
+}
+
+// Damage the bank in several ways and check that it is not opened.
+// Return true if the checks pass.
+static bool bk_damaged(uint32_t size)
+{
+	static const struct {
+		const char *what;
+		uint32_t off; // First byte changed
+		uint32_t len; // Bytes changed
+		uint8_t val;
+		uint32_t cut; // Bytes cut from the end
+	} dmg[] = {
+		{"magic", 0, 1, 'X', 0},
+		{"version", 4, 1, BANK_VERSION+1, 0},
+		{"truncated", 0, 1, 'L', 1},
+		{"count", 6, 1, 3, 0},
+		{"name", sizeof(bank_hdr_t), BANK_NAME, 'x', 0},
+		{"offset", sizeof(bank_hdr_t) + BANK_NAME, 1, 1, 0},
+		{"entry size", sizeof(bank_hdr_t) + BANK_NAME+4, 1, 0xFF, 0},
+		{"asset", sizeof(bank_hdr_t) + 2*sizeof(bank_entry_t) + 12, 1, 0xFF, 0},
+	};
+	bank_t b;
+	bool ok = true;
+
+	if (!bank_open(&b, buf, size)) {
+		printf(" -- error: undamaged bank not opened\n");
+		return false;
+	}
+	for (uint32_t i = 0; i < sizeof(dmg)/sizeof(dmg[0]); i++) {
+		memcpy(bad, buf, size);
+		memset(bad + dmg[i].off, dmg[i].val, dmg[i].len);
+		if (bank_open(&b, bad, size - dmg[i].cut)) {
+			printf(" -- error: bank with bad %s opened\n", dmg[i].what);
+			ok = false;
+		}
+	}
+	if (ok) printf("damaged banks rejected\n");
+	return ok;
+}
+
+void test_bank(void)
+{
+	uint32_t size = 0;
+	bool err = false;
+
+	printf("******** test_bank() ********\n");
+	if (!bk_pack(&size)) err = true;
+	else if (!bk_damaged(size)) err = true;
+
+	printf("******** test_bank() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_BANK_H_
+#define TEST_BANK_H_
+
+// Run tests of the sound bank.
+void test_bank(void);
+
+#endif // TEST_BANK_H_
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h> // free
+#include <string.h> // strstr
+
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "capture.h"
+
+#define RING_SIZE 1000 // Samples in the capture ring
+#define BLOCK_SIZE 256 // Samples per recorded block
+#define BLOCKS 10 // Blocks recorded, wraps the ring
+#define TEST_UNIT 0x12345678
+#define TEST_RATE 80000
+#define TEST_GAIN (-120)
+
+// Dump the capture to memory, optionally corrupt one frame, and read it
+// back. Return true if there is an error.
+static bool tc_roundtrip(bool text, bool corrupt)
+{
+	static rx_data_t buf[RING_SIZE+CAPTURE_FRAME];
+	capture_reader_t *rd = malloc(sizeof(capture_reader_t));
+	capture_header_t hdr;
+	uint32_t first = BLOCKS*BLOCK_SIZE - RING_SIZE; // Oldest sample kept
+	uint32_t n, lost = corrupt ? CAPTURE_FRAME : 0;
+	char *mem = NULL;
+	size_t len = 0;
+	bool err = false;
+	FILE *fp;
+
+	fp = open_memstream(&mem, &len);
+	if (text) fputs("I (100) log output before the capture\n", fp);
+	if (capture_dump(fp, text)) {
+		printf(" -- error: capture_dump()\n");
+		err = true;
+	}
+	fclose(fp);
+	if (corrupt) { // Flip a character in the second frame
+		char *p = strstr(strstr(strstr(mem, "CAP:")+1, "CAP:")+1, "CAP:");
+		p[10] = (p[10] == 'A') ? 'B' : 'A';
+	}
+
+	fp = fmemopen(mem, len, "rb");
+	if (capture_open(rd, fp, &hdr)) {
+		printf(" -- error: capture_open() text:%d\n", text);
+		err = true;
+		goto tcr_end;
+	}
+	if (hdr.sample_hz != TEST_RATE || hdr.gain != TEST_GAIN ||
+		hdr.unit_id != TEST_UNIT || hdr.samples != RING_SIZE) {
+		printf(" -- error: header mismatch text:%d\n", text);
+		err = true;
+	}
+	n = capture_read(rd, buf, sizeof(buf)/sizeof(buf[0]));
+	if (n != RING_SIZE - lost || rd->bad != (corrupt ? 1 : 0) ||
+		rd->lost != (corrupt ? 1 : 0)) {
+		printf(" -- error: read:%lu bad:%lu lost:%lu text:%d corrupt:%d\n",
+			n, rd->bad, rd->lost, text, corrupt);
+		err = true;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		uint32_t expect = first + i + ((corrupt && i >= CAPTURE_FRAME) ? lost : 0);
+		if (buf[i] != (rx_data_t)expect) {
+			printf(" -- error: sample:%lu is:%u expecting:%lu\n", i, buf[i], expect);
+			err = true;
+			break;
+		}
+	}
+	capture_close(rd);
+
+tcr_end:
+	fclose(fp);
+	free(mem);
+	free(rd);
+	return err;
+}
+
+// Run tests for the capture module.
+// - Record a ramp that wraps the ring.
+// - Dump it in binary and console form and read it back.
+// - Verify a corrupted frame is detected and skipped.
+void test_capture(void)
+{
+	static rx_data_t blk[BLOCK_SIZE];
+	capture_header_t hdr = {
+		.sample_hz = TEST_RATE,
+		.gain = TEST_GAIN,
+		.bits = 12,
+		.unit_id = TEST_UNIT,
+	};
+	bool err = false;
+
+	printf("******** test_capture() ********\n");
+	if (!capture_init(0, &hdr)) {
+		printf(" -- error: no error with zero size\n");
+		err = true;
+	}
+	capture_init(RING_SIZE, &hdr);
+	for (uint32_t b = 0; b < BLOCKS; b++) {
+		for (uint32_t i = 0; i < BLOCK_SIZE; i++) blk[i] = b*BLOCK_SIZE + i;
+		capture_addBlock(blk, BLOCK_SIZE);
+	}
+	if (capture_getCount() != RING_SIZE) {
+		printf(" -- error: count:%lu expecting:%u\n", capture_getCount(), RING_SIZE);
+		err = true;
+	}
+
+	printf("binary round trip test\n");
+	err |= tc_roundtrip(false, false);
+	printf("console round trip test\n");
+	err |= tc_roundtrip(true, false);
+	printf("corrupted frame test\n");
+	err |= tc_roundtrip(true, true);
+
+	capture_enable(false);
+	capture_addBlock(blk, BLOCK_SIZE);
+	if (capture_getCount() != RING_SIZE) {
+		printf(" -- error: recorded while disabled\n");
+		err = true;
+	}
+	capture_free();
+
+	printf("******** test_capture() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
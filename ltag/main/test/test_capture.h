@@ -0,0 +1,7 @@
+#ifndef TEST_CAPTURE_H_
+#define TEST_CAPTURE_H_
+
+// Run tests for the capture module.
+void test_capture(void);
+
+#endif // TEST_CAPTURE_H_
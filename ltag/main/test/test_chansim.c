@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+
+#include "config.h" // CONFIG_*
+#include "filter.h" // FILTER_*, filter_*
+#include "detector.h" // detector_*
+#include "detector_ctx.h" // detector_ctx_*
+#include "filter_ctx.h" // filter_ctx_*
+#include "chansim.h"
+
+#define ADC_BITS 12
+#define ADC_HALF_SCALE (1 << (ADC_BITS-1))
+#define MS_SAMPLES(ms) ((uint64_t)CONFIG_RX_SAMPLE_RATE*(ms)/1000)
+#define SAMPLES_MS(n) ((uint64_t)(n)*1000/CONFIG_RX_SAMPLE_RATE)
+
+// Input samples to fill the energy window, hits are ignored until then
+#define WARMUP ((uint64_t)FILTER_FIR_DECIMATION_FACTOR*FILTER_ENERGY_SAMPLE_COUNT)
+#define PULSE_START 300 // ms, after the energy window fills with ambient
+#define RUN_MS 800 // ms, duration of each scenario
+#define SIG_AMP 0.05f // Shooter amplitude at moderate range
+#define NOISE 0.01f // Noise standard deviation
+#define FLICKER 0.05f // Flicker amplitude
+#define LOAD_SHOOTERS 4 // Simultaneous shooters in the load test
+#define LOAD_MS 2000 // ms, duration of the load test
+#define LOAD_FALL 1.0f // Fall threshold factor in the load test
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+
+// Set up a channel with ambient light, flicker and noise.
+static void cs_ambient(chansim_t *c)
+{
+	chansim_init(c, CONFIG_RX_SAMPLE_RATE, ADC_BITS);
+	c->flicker = FLICKER;
+	c->noise = NOISE;
+}
+
+// Add a shooter sending one pulse at PULSE_START.
+static void cs_shooter(chansim_t *c, uint16_t chan, float amp, float phase)
+{
+	chansim_shooter_t s = {
+		.freq_hz = play_freq[chan],
+		.amp = amp,
+		.phase = phase,
+		.start_us = PULSE_START*1000,
+		.pulse_us = CONFIG_TX_PULSE*1000,
+	};
+	chansim_addShooter(c, &s);
+}
+
+// Run the channel through the filter and detector, and stop at the first
+// hit. Return the hit channel, or -1. Set *at to the sample index of the
+// hit.
+static int32_t cs_run(chansim_t *c, uint64_t count, uint64_t *at)
+{
+	static uint16_t buf[CONFIG_RX_FRAME];
+	int32_t chan = -1;
+
+	filter_reset();
+	detector_init();
+	chansim_reset(c);
+	c->length = count;
+	for (uint64_t n = 0; ; ) {
+		uint32_t cnt = chansim_generate(buf, CONFIG_RX_FRAME, c);
+		if (!cnt) break;
+		for (uint32_t i = 0; i < cnt; i++, n++) {
+			if (!filter_addSample((filter_data_t)buf[i] / ADC_HALF_SCALE - (filter_data_t)1.0) ||
+				n < WARMUP)
+				continue;
+			filter_data_t energyValues[FILTER_CHANNELS];
+			filter_getEnergyArray(energyValues);
+			detector_checkHit(energyValues);
+			if (detector_getHit()) {
+				*at = n;
+				return detector_getHitChannel();
+			}
+		}
+	}
+	return chan;
+}
+
+// Run the channel through a filter and detector instance that qualifies
+// hits, so each pulse gives one hit. Clear each hit and return the number
+// of hits.
+static uint32_t cs_load(chansim_t *c, uint64_t count)
+{
+	static uint16_t buf[CONFIG_RX_FRAME];
+	filter_ctx_t *f = filter_ctx_init();
+	detector_ctx_t *d = detector_ctx_init(f);
+	uint32_t hits = 0;
+	uint32_t cnt;
+	uint64_t n = 0;
+
+	detector_ctx_setQualify(d, LOAD_FALL, 1);
+	chansim_reset(c);
+	c->length = count;
+	while ((cnt = chansim_generate(buf, CONFIG_RX_FRAME, c))) {
+		for (uint32_t i = 0; i < cnt; ) {
+			detector_ctx_ignoreAllHits(d, n < WARMUP);
+			uint32_t m = detector_ctx_runBlock(d, buf + i, cnt - i);
+			i += m;
+			n += m;
+			if (detector_ctx_getHit(d)) {
+				detector_ctx_clearHit(d);
+				hits++;
+			}
+		}
+	}
+	detector_ctx_free(d);
+	filter_ctx_free(f);
+	return hits;
+}
+
+// Run tests with the synthetic optical channel.
+// - Ambient light, flicker and noise alone give no hit.
+// - A single shooter on each channel gives a hit on that channel.
+// - Two shooters colliding give a hit on the stronger one.
+// - A clipped signal is still detected.
+// - Report pipeline throughput with several shooters relative to real time.
+void test_chansim(void)
+{
+	chansim_t c;
+	uint64_t at;
+	int32_t hit;
+	bool err = false;
+
+	printf("******** test_chansim() ********\n");
+	filter_init();
+
+	printf("chansim_addShooter() test\n");
+	cs_ambient(&c);
+	chansim_shooter_t bad = {.freq_hz = CONFIG_RX_SAMPLE_RATE/2};
+	if (chansim_addShooter(&c, &bad) >= 0) {
+		printf(" -- error: accepted frequency at Nyquist\n");
+		err = true;
+	}
+
+	printf("ambient only test\n");
+	if ((hit = cs_run(&c, MS_SAMPLES(RUN_MS), &at)) >= 0) {
+		printf(" -- error: hit on chan:%ld at:%llu ms\n", hit, SAMPLES_MS(at));
+		err = true;
+	}
+
+	printf("single shooter test\n");
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) {
+		cs_ambient(&c);
+		cs_shooter(&c, i, SIG_AMP, 0.0f);
+		hit = cs_run(&c, MS_SAMPLES(RUN_MS), &at);
+		if (hit != i) {
+			printf(" -- error: hit on chan:%ld, expecting:%hu\n", hit, i);
+			err = true;
+		} else if (at < MS_SAMPLES(PULSE_START)) {
+			printf(" -- error: chan:%hu hit before the pulse\n", i);
+			err = true;
+		}
+	}
+
+	printf("collision test\n");
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) {
+		uint16_t j = (i + FILTER_CHANNELS/2) % FILTER_CHANNELS;
+		cs_ambient(&c);
+		cs_shooter(&c, i, SIG_AMP*4, 0.25f); // Near
+		cs_shooter(&c, j, SIG_AMP, 0.0f); // Far
+		hit = cs_run(&c, MS_SAMPLES(RUN_MS), &at);
+		if (hit != i) {
+			printf(" -- error: near:%hu far:%hu hit on chan:%ld\n", i, j, hit);
+			err = true;
+		}
+	}
+
+	printf("clipping test\n");
+	cs_ambient(&c);
+	c.dc = 0.8f; // Bright ambient light pushes the signal into the rail
+	cs_shooter(&c, FILTER_CHANNELS-1, 0.4f, 0.0f);
+	hit = cs_run(&c, MS_SAMPLES(RUN_MS), &at);
+	if (!c.clipped) {
+		printf(" -- error: no samples clipped\n");
+		err = true;
+	}
+	if (hit != FILTER_CHANNELS-1) {
+		printf(" -- error: clipped signal hit on chan:%ld\n", hit);
+		err = true;
+	}
+
+	printf("load test, %d shooters\n", LOAD_SHOOTERS);
+	cs_ambient(&c);
+	for (uint16_t i = 0; i < LOAD_SHOOTERS; i++) {
+		chansim_shooter_t s = {
+			.freq_hz = play_freq[i*2],
+			.amp = SIG_AMP,
+			.phase = i * 0.1f,
+			.start_us = i * 37000,
+			.pulse_us = CONFIG_TX_PULSE*1000,
+			.period_us = (CONFIG_TX_PULSE + CONFIG_LOCKOUT_PERIOD)*1000,
+		};
+		chansim_addShooter(&c, &s);
+	}
+	int64_t tbeg = esp_timer_get_time();
+	uint32_t hits = cs_load(&c, MS_SAMPLES(LOAD_MS));
+	int64_t tend = esp_timer_get_time();
+	if (!hits) {
+		printf(" -- error: no hits\n");
+		err = true;
+	}
+	printf("hits:%lu in %d ms, %.1f times real time\n", hits, LOAD_MS,
+		(tend > tbeg) ? LOAD_MS*1000.0/(tend - tbeg) : 0.0);
+
+	printf("******** test_chansim() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_CHANSIM_H_
+#define TEST_CHANSIM_H_
+
+// Run tests with the synthetic optical channel.
+void test_chansim(void);
+
+#endif // TEST_CHANSIM_H_
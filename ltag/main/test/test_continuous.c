@@ -2,8 +2,10 @@
 #include <string.h> // memset
 
 #include "driver/gpio.h"
+#include "esp_mac.h" // esp_efuse_mac_get_default
 #include "esp_timer.h"
 
+#include "capture.h"
 #include "config.h" // CONFIG_*
 #include "filter.h"
 #include "histogram.h"
@@ -17,9 +19,11 @@
 
 // #define DEBUG 1
 // #define DISP_MIN 1.0f
-#define ADC_HALF_SCALE 2048
+#define ADC_BITS 12
+#define ADC_HALF_SCALE (1 << (ADC_BITS-1))
 #define BUTTON_UPDATE_PERIOD 10000 // microseconds
 #define DISPLAY_UPDATE_PERIOD 250000 // microseconds
+#define CAPTURE_HOLD_PERIOD 1000000 // microseconds
 
 static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
 static uint32_t freq_num;
@@ -56,20 +60,34 @@ static void control(uint8_t tx, uint8_t ch)
 // Run the DSP stages: FIR filter, IIR filters, energy calculation
 static void dsp_run(void)
 {
-	uint32_t adc_cnt = rx_get_count(); // Save count of elements in ADC buffer
+	const rx_data_t *blk;
+	uint32_t adc_cnt;
 
-	while (adc_cnt) {
-		rx_data_t rawAdcValue;
-		filter_data_t scaledAdcValue;
+	while ((blk = rx_get_block(&adc_cnt)) != NULL) {
+		capture_addBlock(blk, adc_cnt); // Record raw ADC values
+		for (uint32_t i = 0; i < adc_cnt; i++) {
+			// Scale ADC value
+			filter_data_t scaledAdcValue =
+				(filter_data_t)blk[i] / ADC_HALF_SCALE - (filter_data_t)1.0;
+			filter_addSample(scaledAdcValue); // Process scaled ADC value
+		}
+		rx_release_block();
+	}
+}
 
-		// Get next ADC value
-		rawAdcValue = rx_get_sample();
-		adc_cnt--;
+// Start recording raw ADC values for capture_dump().
+static void capture_start(void)
+{
+	uint8_t mac[6];
+	capture_header_t hdr = {
+		.sample_hz = CONFIG_RX_SAMPLE_RATE,
+		.gain = CONFIG_RX_GAIN,
+		.bits = ADC_BITS,
+	};
 
-		// Scale ADC value
-		scaledAdcValue = (filter_data_t)rawAdcValue / ADC_HALF_SCALE - (filter_data_t)1.0;
-		filter_addSample(scaledAdcValue); // Process scaled ADC value
-	}
+	if (esp_efuse_mac_get_default(mac) == ESP_OK)
+		hdr.unit_id = (uint32_t)mac[2] << 24 | mac[3] << 16 | mac[4] << 8 | mac[5];
+	capture_init((uint64_t)CONFIG_RX_SAMPLE_RATE*CONFIG_CAPTURE_MS/1000, &hdr);
 }
 
 // Run tests for continuous mode.
@@ -78,13 +96,15 @@ static void dsp_run(void)
 // - Run the DSP pipeline and display energy for each channel.
 // - Flash hit indicator when NAV_RT is pressed.
 // - Play sound when NAV_LT is pressed.
+// - Dump the raw ADC capture to the console when NAV_RT is held.
 // Assumptions.
 // - Transmit signal is looped back through receiver
 //   (optically or electrically).
 void test_continuous(void)
 {
-	int64_t tbtn, tdisp;
+	int64_t tbtn, tdisp, trt = 0;
 
+	capture_start();
 	tx_set_freq(play_freq[freq_num]);
 	control(tx_on, freq_num);
 	tbtn = esp_timer_get_time() + BUTTON_UPDATE_PERIOD;
@@ -116,6 +136,7 @@ void test_continuous(void)
 					sound_start(gameBoyStartup, sizeof(gameBoyStartup), true);
 				}
 				if (btns & (1ULL << HW_NAV_RT)) {
+					trt = esp_timer_get_time();
 					hitLedTimer_start();
 				}
 				if (btns & (1ULL << HW_NAV_DN)) {
@@ -127,6 +148,11 @@ void test_continuous(void)
 				}
 			} else if (pressed && !btns) { // All buttons released
 				if (tx_on) {tx_on = false; tx_emit(false);}
+				if (trt && esp_timer_get_time() - trt >= CAPTURE_HOLD_PERIOD) {
+					capture_dump(stdout, true);
+					rx_clear_buffer(); // Skip samples missed during the dump
+				}
+				trt = 0;
 				pressed = false;
 			}
 		}
@@ -154,4 +180,5 @@ void test_continuous(void)
 		}
 	}
 	tx_emit(false);
+	capture_free();
 }
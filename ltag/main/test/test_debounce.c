@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "debounce.h"
+
+#define SETTLE 50000 // us
+#define MAX_EVENTS 8
+
+// Scripted input edge. An edge missed by the interrupt has irq false: the
+// input changes but debounce_edge() is not called. The expiry catches it
+// and restarts the settle time from there.
+typedef struct {
+	int64_t t_us;
+	bool level;
+	bool irq;
+} db_edge_t;
+
+// Expected debounced event
+typedef struct {
+	debounce_event_t e;
+	int64_t t_us;
+} db_event_t;
+
+// Scripted test case
+typedef struct {
+	const char *name;
+	db_edge_t edge[16];
+	uint16_t edges;
+	db_event_t event[MAX_EVENTS];
+	uint16_t events;
+} db_case_t;
+
+static const db_case_t cases[] = {
+	{"clean press and release",
+		{{1000, true, true}, {200000, false, true}}, 2,
+		{{DEBOUNCE_PRESSED, 51000}, {DEBOUNCE_RELEASED, 250000}}, 2},
+	{"bouncy press",
+		{{1000, true, true}, {1500, false, true}, {2200, true, true},
+		 {9000, false, true}, {30000, true, true}}, 5,
+		{{DEBOUNCE_PRESSED, 80000}}, 1},
+	{"short glitch",
+		{{1000, true, true}, {3000, false, true}}, 2,
+		{{0}}, 0},
+	{"bouncy release",
+		{{1000, true, true}, {100000, false, true}, {100400, true, true},
+		 {101000, false, true}}, 4,
+		{{DEBOUNCE_PRESSED, 51000}, {DEBOUNCE_RELEASED, 151000}}, 2},
+	{"missed release edge",
+		{{1000, true, true}, {20000, false, false}}, 2,
+		{{0}}, 0},
+	{"missed last bounce",
+		{{1000, true, true}, {2000, false, true}, {2500, true, false}}, 3,
+		{{DEBOUNCE_PRESSED, 101000}}, 1},
+};
+
+// Run one scripted case on a simulated clock. The one-shot timer expires
+// at the time requested by the state machine, between scripted edges.
+// Return true if the events match the expected ones.
+static bool db_run(const db_case_t *c)
+{
+	debounce_t d;
+	db_event_t got[MAX_EVENTS];
+	uint16_t n = 0;
+	bool level = false, timer = false;
+	int64_t due = 0;
+
+	debounce_init(&d, SETTLE, false);
+	for (uint16_t i = 0; i <= c->edges; i++) {
+		// Time of the next edge, or the end of the script
+		int64_t t = (i < c->edges) ? c->edge[i].t_us : INT64_MAX;
+		while (timer && due <= t) {
+			int64_t now = due;
+			debounce_event_t e = debounce_expire(&d, level, now);
+			timer = d.armed;
+			if (timer) {
+				if (d.due_us <= now) return false; // Would never settle
+				due = d.due_us;
+			}
+			if (e != DEBOUNCE_NONE && n < MAX_EVENTS)
+				got[n++] = (db_event_t){e, now};
+		}
+		if (i == c->edges) break;
+		level = c->edge[i].level;
+		if (c->edge[i].irq && debounce_edge(&d, level, t)) {
+			timer = true;
+			due = d.due_us;
+		}
+	}
+	if (n != c->events) return false;
+	for (uint16_t i = 0; i < n; i++)
+		if (got[i].e != c->event[i].e || got[i].t_us != c->event[i].t_us)
+			return false;
+	return true;
+}
+
+// Run tests of the debounce state machine. Each case is a scripted
+// sequence of edges, including bounces, glitches shorter than the settle
+// time, and edges missed by the interrupt. The events and their times
+// must match the expected ones.
+void test_debounce(void)
+{
+	bool err = false;
+
+	printf("******** test_debounce() ********\n");
+
+	for (uint16_t i = 0; i < sizeof(cases)/sizeof(cases[0]); i++) {
+		bool ok = db_run(&cases[i]);
+		printf("%-24s %s\n", cases[i].name, ok ? "pass" : "fail");
+		if (!ok) err = true;
+	}
+
+	printf("******** test_debounce() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
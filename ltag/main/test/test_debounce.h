@@ -0,0 +1,7 @@
+#ifndef TEST_DEBOUNCE_H_
+#define TEST_DEBOUNCE_H_
+
+// Run tests of the debounce state machine against scripted edges.
+void test_debounce(void);
+
+#endif // TEST_DEBOUNCE_H_
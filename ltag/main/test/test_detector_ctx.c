@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "config.h" // CONFIG_*
+#include "detector_ctx.h" // detector_ctx_*
+#include "filter_ctx.h" // FILTER_*, filter_*, filter_ctx_*
+
+#define TONE_CHAN 3 // Channel of the tone given to detector_ctx_runBlock()
+#define TONE_AMP 0.5f // Fraction of the ADC half scale
+#define ADC_HALF_SCALE (1 << (DETECTOR_CTX_ADC_BITS-1))
+
+// Hit qualification test parameters
+#define QUAL_CHAN 3 // Channel that receives the pulses
+#define QUAL_RISE 4.0f // Rise threshold factor
+#define QUAL_FALL 2.0f // Fall threshold factor
+#define QUAL_DWELL 4 // Decimated samples above threshold for a hit
+#define QUAL_PEAK 200.0f // Pulse energy at the top of the envelope
+#define QUAL_RAMP 40 // Decimated samples in each pulse edge
+#define QUAL_IDLE 100 // Decimated samples between pulses
+#define QUAL_PULSES 3 // Pulses per trace
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+
+// Return a pseudo-random value uniformly distributed in [-1.0, 1.0].
+static filter_data_t qual_rand(void)
+{
+	static uint32_t x = 2463534242U; // xorshift32 state, fixed seed
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return (filter_data_t)x / (filter_data_t)UINT32_MAX * 2.0f - 1.0f;
+}
+
+// Feed a trace of pulse envelopes to a detector instance, one energy array
+// per decimated sample, and return the number of hits on QUAL_CHAN. Hits
+// are cleared as soon as they are seen, as a game would. Returns
+// UINT32_MAX if a hit is detected on another channel.
+// width: samples at the top of each pulse envelope.
+// ramp: samples in each rising and falling edge of the envelope.
+// noise: fraction of multiplicative noise applied to each energy value.
+static uint32_t qual_run(detector_ctx_t *d, uint32_t width, uint32_t ramp, filter_data_t noise)
+{
+	static const filter_data_t base[FILTER_CHANNELS] =
+		{16.0, 11.0, 13.0, 12.0, 14.0, 15.0, 10.0, 12.0, 13.0, 11.0};
+	filter_data_t energy[FILTER_CHANNELS];
+	uint32_t period = QUAL_IDLE + ramp + width + ramp;
+	uint32_t hits = 0;
+
+	for (uint32_t t = 0; t < period * QUAL_PULSES + QUAL_IDLE; t++) {
+		uint32_t p = t % period; // Position within the pulse period
+		filter_data_t env = 0.0f; // Envelope shape (0.0 to 1.0)
+		if (t >= period * QUAL_PULSES || p < QUAL_IDLE) env = 0.0f;
+		else if ((p -= QUAL_IDLE) < ramp) env = (filter_data_t)(p+1) / (ramp+1);
+		else if ((p -= ramp) < width) env = 1.0f;
+		else env = (filter_data_t)(ramp-(p-width)) / (ramp+1);
+		for (uint16_t i = 0; i < FILTER_CHANNELS; i++) energy[i] = base[i];
+		energy[QUAL_CHAN] += (QUAL_PEAK - base[QUAL_CHAN]) * env;
+		for (uint16_t i = 0; i < FILTER_CHANNELS; i++)
+			energy[i] *= 1.0f + noise * qual_rand();
+		detector_ctx_checkHit(d, energy);
+		if (detector_ctx_getHit(d)) {
+			if (detector_ctx_getHitChannel(d) != QUAL_CHAN) return UINT32_MAX;
+			hits++;
+			detector_ctx_clearHit(d);
+		}
+	}
+	return hits;
+}
+
+// Run tests of the detector instances.
+// - Two instances check the same energies with different settings and keep
+//   separate hit states.
+// - With qualification, each pulse envelope gives one hit over a sweep of
+//   pulse widths and noise levels, and pulses narrower than the dwell
+//   count give none.
+// - detector_ctx_runBlock() stops at the hit of a tone.
+void test_detector_ctx(void)
+{
+	static rx_data_t blk[CONFIG_RX_FRAME];
+	bool en_chan[] = {true, true, false, true, true, true, true, true, true, true};
+	filter_data_t energy[] = {16.0, 11.0, 71.0, 12.0, 14.0, 57.0, 59.0, 10.0, 58.0, 13.0};
+	//                        10    11    12    13    14    16    57    58    59    71
+	//                                                 ^ median * 4 = 56, * 5 = 70
+	filter_ctx_t *f;
+	detector_ctx_t *lo, *hi;
+	bool err = false;
+
+	printf("******** test_detector_ctx() ********\n");
+	filter_init();
+	f = filter_ctx_init();
+	lo = detector_ctx_init(f);
+	hi = detector_ctx_init(f);
+
+	printf("detector_ctx_checkHit() test\n");
+	detector_ctx_setChannels(lo, en_chan);
+	detector_ctx_setThreshFactor(lo, 4.0f);
+	detector_ctx_setThreshFactor(hi, 6.0f); // Median * 6 exceeds 71
+	detector_ctx_checkHit(lo, energy);
+	detector_ctx_checkHit(hi, energy);
+	if (!detector_ctx_getHit(lo) || detector_ctx_getHitChannel(lo) != 6) {
+		printf(" -- error: hit expected on chan:6\n");
+		err = true;
+	}
+	if (detector_ctx_getHit(hi)) {
+		printf(" -- error: unexpected hit on chan:%u\n", detector_ctx_getHitChannel(hi));
+		err = true;
+	}
+	detector_ctx_setThreshFactor(hi, 4.0f);
+	detector_ctx_checkHit(hi, energy);
+	if (!detector_ctx_getHit(hi) || detector_ctx_getHitChannel(hi) != 2) {
+		printf(" -- error: hit expected on chan:2 with all channels enabled\n");
+		err = true;
+	}
+	detector_ctx_clearHit(lo);
+	if (detector_ctx_getHit(lo) || !detector_ctx_getHit(hi)) {
+		printf(" -- error: hit state shared between instances\n");
+		err = true;
+	}
+	detector_ctx_ignoreAllHits(lo, true);
+	detector_ctx_checkHit(lo, energy);
+	if (detector_ctx_getHit(lo)) {
+		printf(" -- error: hit when ignoring all hits\n");
+		err = true;
+	}
+
+	printf("detector_ctx_setQualify() test\n");
+	static const uint32_t qual_width[] = {QUAL_DWELL, 20, 200, 2000};
+	static const filter_data_t qual_noise[] = {0.0f, 0.1f, 0.25f};
+	detector_ctx_setThreshFactor(lo, QUAL_RISE);
+	detector_ctx_setQualify(lo, QUAL_FALL, QUAL_DWELL);
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) en_chan[i] = true;
+	detector_ctx_setChannels(lo, en_chan);
+	detector_ctx_ignoreAllHits(lo, false);
+	detector_ctx_clearHit(lo);
+	for (uint16_t w = 1; w < QUAL_DWELL; w++) {
+		uint32_t hits = qual_run(lo, w, 0, 0.0f);
+		if (hits) {
+			printf(" -- error: width:%u hits:%lu, expecting:0 below dwell:%d\n",
+				w, (unsigned long)hits, QUAL_DWELL);
+			err = true;
+		}
+	}
+	for (uint16_t w = 0; w < sizeof(qual_width)/sizeof(qual_width[0]); w++) {
+		for (uint16_t n = 0; n < sizeof(qual_noise)/sizeof(qual_noise[0]); n++) {
+			uint32_t hits = qual_run(lo, qual_width[w], QUAL_RAMP, qual_noise[n]);
+			if (hits != QUAL_PULSES) {
+				printf(" -- error: width:%lu noise:%.2f hits:%lu, expecting:%d\n",
+					(unsigned long)qual_width[w], qual_noise[n], (unsigned long)hits, QUAL_PULSES);
+				err = true;
+			}
+		}
+	}
+
+	printf("detector_ctx_runBlock() test\n");
+	detector_ctx_clearHit(hi);
+	for (uint32_t n = 0; n < CONFIG_RX_FRAME; n++)
+		blk[n] = ADC_HALF_SCALE + (((uint64_t)n*2*play_freq[TONE_CHAN]/CONFIG_RX_SAMPLE_RATE & 1) ?
+			-1 : 1) * (int32_t)(ADC_HALF_SCALE*TONE_AMP);
+	uint32_t n = detector_ctx_runBlock(hi, blk, CONFIG_RX_FRAME);
+	if (!detector_ctx_getHit(hi) || detector_ctx_getHitChannel(hi) != TONE_CHAN) {
+		printf(" -- error: hit expected on chan:%d\n", TONE_CHAN);
+		err = true;
+	} else if (n == CONFIG_RX_FRAME || n % FILTER_FIR_DECIMATION_FACTOR) {
+		printf(" -- error: stopped after:%lu samples, expecting a decimated sample\n",
+			(unsigned long)n);
+		err = true;
+	}
+
+	detector_ctx_free(lo);
+	detector_ctx_free(hi);
+	filter_ctx_free(f);
+	printf("******** test_detector_ctx() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
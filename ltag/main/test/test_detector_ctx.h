@@ -0,0 +1,7 @@
+#ifndef TEST_DETECTOR_CTX_H_
+#define TEST_DETECTOR_CTX_H_
+
+// Run tests of the detector instances.
+void test_detector_ctx(void);
+
+#endif // TEST_DETECTOR_CTX_H_
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h> // cosf
+
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+
+#include "config.h" // CONFIG_*
+#include "filter_ctx.h" // FILTER_*, filter_ctx_*
+#include "detector_ctx.h" // detector_ctx_*
+#include "diversity.h"
+#include "chansim.h"
+
+#define ADC_BITS 12
+#define MS_SAMPLES(rate, ms) ((uint64_t)(rate)*(ms)/1000)
+
+// Input samples to fill the energy window, hits are ignored until then
+#define WARMUP(rate) ((uint64_t)FILTER_FIR_DECIMATION_FACTOR*FILTER_ENERGY_SAMPLE_COUNT* \
+	(rate)/CONFIG_RX_SAMPLE_RATE)
+#define PULSE_START 300 // ms, after the energy window fills with ambient
+#define RUN_MS 600 // ms, duration of each trial
+#define SIG_AMP 0.02f // Shooter amplitude facing a sensor
+#define NOISE 0.01f // Noise standard deviation
+#define SHOT_CHAN 4 // Channel of the shooter
+#define ANGLES 8 // Shooter directions around the vest
+#define PI 3.14159265f
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+
+// Set up the channel of one sensor. The sensor sees the shooter with a
+// gain that falls off with the angle between them, and gets no light from
+// a shooter behind it.
+// angle: shooter direction relative to the sensor in radians.
+// rate: sample frequency of the sensor in Hz.
+static void dv_sensor(chansim_t *c, float angle, uint32_t seed, uint32_t rate)
+{
+	float g = cosf(angle);
+
+	chansim_init(c, rate, ADC_BITS);
+	c->noise = NOISE;
+	c->seed = seed;
+	c->length = MS_SAMPLES(rate, RUN_MS);
+	chansim_shooter_t s = {
+		.freq_hz = play_freq[SHOT_CHAN],
+		.amp = (g > 0.0f) ? SIG_AMP*g : 0.0f,
+		.start_us = PULSE_START*1000,
+		.pulse_us = CONFIG_TX_PULSE*1000,
+	};
+	chansim_addShooter(c, &s);
+}
+
+// Run a sensor alone at CONFIG_RX_SAMPLE_RATE through a filter and
+// detector instance. Return the hit channel, or -1. Add the processing
+// time in us to t[0] and the signal time in us to t[1].
+static int32_t dv_single(chansim_t *c, int64_t t[2])
+{
+	static rx_data_t buf[CONFIG_RX_FRAME];
+	filter_ctx_t *f = filter_ctx_init();
+	detector_ctx_t *d = detector_ctx_init(f);
+	int32_t chan = -1;
+	uint32_t cnt;
+	uint64_t n = 0;
+
+	chansim_reset(c);
+	while (chan < 0 && (cnt = chansim_generate(buf, CONFIG_RX_FRAME, c))) {
+		detector_ctx_ignoreAllHits(d, n < WARMUP(CONFIG_RX_SAMPLE_RATE));
+		int64_t tbeg = esp_timer_get_time();
+		detector_ctx_runBlock(d, buf, cnt);
+		t[0] += esp_timer_get_time() - tbeg;
+		t[1] += (uint64_t)cnt*1000000/CONFIG_RX_SAMPLE_RATE;
+		if (detector_ctx_getHit(d)) chan = detector_ctx_getHitChannel(d);
+		n += cnt;
+	}
+	detector_ctx_free(d);
+	filter_ctx_free(f);
+	return chan;
+}
+
+// Run both sensors at CONFIG_RX_DUAL_RATE, interleaved like rx_init_dual()
+// blocks, through a diversity receiver. Return the hit channel, or -1. Set
+// *side to the sensor with the stronger signal. Add the processing time in
+// us to t[0] and the signal time in us to t[1].
+static int32_t dv_dual(chansim_t c[], diversity_mode_t mode, uint16_t *side, int64_t t[2])
+{
+	static rx_data_t s0[CONFIG_RX_FRAME/2], s1[CONFIG_RX_FRAME/2];
+	static rx_data_t buf[CONFIG_RX_FRAME];
+	diversity_t v;
+	int32_t chan = -1;
+	uint32_t cnt;
+	uint64_t n = 0;
+
+	diversity_init(&v, mode, ADC_BITS, CONFIG_RX_DUAL_RATE);
+	chansim_reset(&c[0]);
+	chansim_reset(&c[1]);
+	while (chan < 0 && (cnt = chansim_generate(s0, CONFIG_RX_FRAME/2, &c[0]))) {
+		chansim_generate(s1, cnt, &c[1]);
+		for (uint32_t i = 0; i < cnt; i++) {
+			buf[2*i] = s0[i];
+			buf[2*i+1] = s1[i];
+		}
+		detector_ctx_ignoreAllHits(v.detector, n < WARMUP(CONFIG_RX_DUAL_RATE));
+		int64_t tbeg = esp_timer_get_time();
+		diversity_runBlock(&v, buf, 2*cnt);
+		t[0] += esp_timer_get_time() - tbeg;
+		t[1] += (uint64_t)cnt*1000000/CONFIG_RX_DUAL_RATE;
+		if (detector_ctx_getHit(v.detector)) {
+			chan = detector_ctx_getHitChannel(v.detector);
+			*side = diversity_getSensor(&v, chan);
+		}
+		n += cnt;
+	}
+	diversity_free(&v);
+	return chan;
+}
+
+// Run tests of the dual-receiver diversity combining with two synthetic
+// sensor streams, one on each side of a vest.
+// - A shooter facing the second sensor is missed by the first sensor
+//   alone, but hit with either combining mode on the correct side.
+// - Over a sweep of shooter directions, both combining modes detect the
+//   shooter at least as often as a single sensor (combining gain).
+// - Report the processing cost of the dual path relative to a single one,
+//   per second of signal.
+void test_diversity(void)
+{
+	chansim_t c[DIVERSITY_SENSORS], c1;
+	uint32_t single = 0, dual[2] = {0, 0};
+	int64_t t1[2] = {0, 0}, t2[2] = {0, 0};
+	uint16_t side = 0;
+	int32_t hit;
+	bool err = false;
+
+	printf("******** test_diversity() ********\n");
+	filter_init();
+
+	printf("diversity_runBlock() back side test\n");
+	dv_sensor(&c1, PI, 1, CONFIG_RX_SAMPLE_RATE);
+	dv_sensor(&c[0], PI, 1, CONFIG_RX_DUAL_RATE);
+	dv_sensor(&c[1], 0.0f, 2, CONFIG_RX_DUAL_RATE);
+	if ((hit = dv_single(&c1, t1)) >= 0) {
+		printf(" -- error: front sensor alone hit on chan:%ld\n", hit);
+		err = true;
+	}
+	for (uint16_t m = DIVERSITY_MAX; m <= DIVERSITY_SUM; m++) {
+		hit = dv_dual(c, m, &side, t2);
+		if (hit != SHOT_CHAN || side != 1) {
+			printf(" -- error: mode:%u hit on chan:%ld side:%u, expecting:%d side:1\n",
+				m, hit, side, SHOT_CHAN);
+			err = true;
+		}
+	}
+
+	printf("diversity_runBlock() direction sweep test\n");
+	for (uint16_t a = 0; a < ANGLES; a++) {
+		float angle = 2.0f*PI*a/ANGLES;
+		dv_sensor(&c1, angle, 3*a+1, CONFIG_RX_SAMPLE_RATE);
+		dv_sensor(&c[0], angle, 3*a+1, CONFIG_RX_DUAL_RATE);
+		dv_sensor(&c[1], angle - PI, 3*a+2, CONFIG_RX_DUAL_RATE);
+		single += dv_single(&c1, t1) == SHOT_CHAN;
+		for (uint16_t m = DIVERSITY_MAX; m <= DIVERSITY_SUM; m++)
+			dual[m] += dv_dual(c, m, &side, t2) == SHOT_CHAN;
+	}
+	printf("hits of %d directions, single:%lu max:%lu sum:%lu\n",
+		ANGLES, single, dual[DIVERSITY_MAX], dual[DIVERSITY_SUM]);
+	if (dual[DIVERSITY_MAX] < single || dual[DIVERSITY_SUM] < single) {
+		printf(" -- error: combining detected fewer directions\n");
+		err = true;
+	}
+	if (dual[DIVERSITY_MAX] == single && dual[DIVERSITY_SUM] == single) {
+		printf(" -- error: no combining gain\n");
+		err = true;
+	}
+	if (t1[0] > 0 && t2[1] > 0)
+		printf("dual/single processing cost per second:%.2f\n",
+			(double)t2[0] / t2[1] * t1[1] / t1[0]);
+
+	printf("******** test_diversity() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_DIVERSITY_H_
+#define TEST_DIVERSITY_H_
+
+// Run tests of the dual-receiver diversity combining.
+void test_diversity(void);
+
+#endif // TEST_DIVERSITY_H_
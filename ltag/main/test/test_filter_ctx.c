@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h> // fabsf
+
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "config.h" // CONFIG_*
+#include "filter_ctx.h" // FILTER_*, filter_*, filter_ctx_*
+
+// Number of samples in a tone, enough to fill the energy window
+#define TONE_SAMPLES ((uint32_t)FILTER_FIR_DECIMATION_FACTOR*FILTER_ENERGY_SAMPLE_COUNT)
+#define ENERGY_TOL 1.0e-3f // Relative to the largest energy
+#define SHORT_WINDOW 200 // Decimated samples
+#define WINDOW_TOL 0.1f // Relative to the scaled full window energy
+#define RATE_TOL 0.2f // Relative to the energy at the full rate
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+
+// Return sample n of a unit square wave at the frequency of a channel.
+// rate: sample frequency in Hz.
+static filter_data_t fc_toneAt(uint16_t chan, uint32_t n, uint32_t rate)
+{
+	return ((uint64_t)n*2*play_freq[chan]/rate & 1) ?
+		(filter_data_t)-1.0 : (filter_data_t)1.0;
+}
+
+// Return sample n of a unit square wave at CONFIG_RX_SAMPLE_RATE.
+static filter_data_t fc_tone(uint16_t chan, uint32_t n)
+{
+	return fc_toneAt(chan, n, CONFIG_RX_SAMPLE_RATE);
+}
+
+// Return the channel with the most energy.
+static uint16_t fc_max(const filter_data_t energy[])
+{
+	uint16_t max = 0;
+
+	for (uint16_t i = 1; i < FILTER_CHANNELS; i++)
+		if (energy[i] > energy[max]) max = i;
+	return max;
+}
+
+// Run tests of the filter instances.
+// - An instance given the same tone as the filter module decimates on the
+//   same samples and computes the same energy values, within rounding.
+// - A second instance given another tone at the same time peaks on its own
+//   channel and does not disturb the first.
+// - A shorter energy window scales the energy of a steady tone.
+// - At CONFIG_RX_DUAL_RATE, a tone peaks on its channel with about the
+//   energy it has at the full rate.
+void test_filter_ctx(void)
+{
+	filter_data_t e[FILTER_CHANNELS], ea[FILTER_CHANNELS], eb[FILTER_CHANNELS];
+	filter_ctx_t *a, *b;
+	bool err = false;
+
+	printf("******** test_filter_ctx() ********\n");
+	filter_init();
+	a = filter_ctx_init();
+	b = filter_ctx_init();
+
+	printf("filter_ctx_addSample() test\n");
+	for (uint16_t ch = 0; ch < FILTER_CHANNELS && !err; ch++) {
+		uint16_t bch = (ch + FILTER_CHANNELS/2) % FILTER_CHANNELS;
+		filter_reset();
+		filter_ctx_reset(a);
+		filter_ctx_reset(b);
+		for (uint32_t n = 0; n < TONE_SAMPLES; n++) {
+			bool ran = filter_addSample(fc_tone(ch, n));
+			filter_ctx_addSample(b, fc_tone(bch, n));
+			if (filter_ctx_addSample(a, fc_tone(ch, n)) != ran) {
+				printf(" -- error: decimation differs at sample:%lu\n", (unsigned long)n);
+				err = true;
+				break;
+			}
+		}
+		filter_getEnergyArray(e);
+		filter_ctx_getEnergyArray(a, ea);
+		filter_ctx_getEnergyArray(b, eb);
+		filter_data_t tol = e[fc_max(e)] * ENERGY_TOL;
+		for (uint16_t i = 0; i < FILTER_CHANNELS; i++) {
+			if (fabsf(ea[i] - e[i]) > tol || filter_ctx_getEnergyValue(a, i) != ea[i]) {
+				printf(" -- error: tone ch:%u energy ch:%u instance:%e, expecting:%e\n",
+					ch, i, ea[i], e[i]);
+				err = true;
+			}
+		}
+		if (fc_max(ea) != ch || fc_max(eb) != bch) {
+			printf(" -- error: tone ch:%u,%u max energy ch:%u,%u\n",
+				ch, bch, fc_max(ea), fc_max(eb));
+			err = true;
+		}
+	}
+
+	printf("filter_ctx_setEnergyWindow() test\n");
+	filter_ctx_reset(a);
+	filter_ctx_setEnergyWindow(b, SHORT_WINDOW);
+	filter_ctx_reset(b);
+	for (uint32_t n = 0; n < TONE_SAMPLES; n++) {
+		filter_ctx_addSample(a, fc_tone(0, n));
+		filter_ctx_addSample(b, fc_tone(0, n));
+	}
+	filter_data_t full = filter_ctx_getEnergyValue(a, 0);
+	filter_data_t part = filter_ctx_getEnergyValue(b, 0);
+	filter_data_t expect = full * SHORT_WINDOW / FILTER_ENERGY_SAMPLE_COUNT;
+	if (fabsf(part - expect) > expect * WINDOW_TOL) {
+		printf(" -- error: window:%d energy:%e, expecting:%e\n", SHORT_WINDOW, part, expect);
+		err = true;
+	}
+
+	printf("filter_ctx_setInputRate() test\n");
+	if (!filter_ctx_setInputRate(b, CONFIG_RX_SAMPLE_RATE/3) || !filter_ctx_setInputRate(b, 0)) {
+		printf(" -- error: accepted an unsupported rate\n");
+		err = true;
+	}
+	filter_ctx_setEnergyWindow(b, FILTER_ENERGY_SAMPLE_COUNT);
+	if (filter_ctx_setInputRate(b, CONFIG_RX_DUAL_RATE)) {
+		printf(" -- error: rejected rate:%d\n", CONFIG_RX_DUAL_RATE);
+		err = true;
+	}
+	for (uint16_t ch = 0; ch < FILTER_CHANNELS; ch++) {
+		filter_ctx_reset(a);
+		filter_ctx_reset(b);
+		for (uint32_t n = 0; n < TONE_SAMPLES; n++) {
+			filter_ctx_addSample(a, fc_tone(ch, n));
+			if (n < (uint64_t)TONE_SAMPLES*CONFIG_RX_DUAL_RATE/CONFIG_RX_SAMPLE_RATE)
+				filter_ctx_addSample(b, fc_toneAt(ch, n, CONFIG_RX_DUAL_RATE));
+		}
+		filter_ctx_getEnergyArray(a, ea);
+		filter_ctx_getEnergyArray(b, eb);
+		if (fc_max(eb) != ch || fabsf(eb[ch] - ea[ch]) > ea[ch] * RATE_TOL) {
+			printf(" -- error: tone ch:%u max energy ch:%u energy:%e, expecting:%e\n",
+				ch, fc_max(eb), eb[ch], ea[ch]);
+			err = true;
+		}
+	}
+
+	filter_ctx_free(a);
+	filter_ctx_free(b);
+	printf("******** test_filter_ctx() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
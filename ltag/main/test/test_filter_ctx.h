@@ -0,0 +1,7 @@
+#ifndef TEST_FILTER_CTX_H_
+#define TEST_FILTER_CTX_H_
+
+// Run tests of the filter instances against the filter module.
+void test_filter_ctx(void);
+
+#endif // TEST_FILTER_CTX_H_
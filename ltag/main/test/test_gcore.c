@@ -0,0 +1,269 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "config.h" // CONFIG_*
+#include "gcore.h"
+
+#define TEAM 6
+#define FOE 9
+#define MAX_SOUNDS 128
+#define END UINT32_MAX // End of a trace
+
+// Scripted input event at a time in ms
+typedef struct {
+	uint32_t t_ms;
+	uint16_t type;
+	uint16_t arg;
+} gc_step_t;
+
+// Outputs of the core, recorded by the ops, and the simulated timers
+typedef struct {
+	uint32_t now; // ms
+	bool armed[GCORE_TIMERS];
+	uint32_t due[GCORE_TIMERS];
+	uint32_t gen[GCORE_TIMERS];
+	uint32_t shots; // Shots fired
+	uint16_t chan; // Channel of the last shot
+	bool led;
+	uint16_t sounds;
+	gcore_sound_t sound[MAX_SOUNDS];
+	uint32_t sound_ms[MAX_SOUNDS];
+} gc_sim_t;
+
+static gc_sim_t sim;
+static gcore_t game;
+
+static void gc_shoot(void *ctx, uint16_t chan)
+{
+	sim.shots++;
+	sim.chan = chan;
+}
+
+static void gc_timer(void *ctx, gcore_timer_t id, uint32_t ms, uint32_t gen)
+{
+	sim.armed[id] = ms != 0;
+	sim.due[id] = sim.now + ms;
+	sim.gen[id] = gen;
+}
+
+static void gc_sound(void *ctx, gcore_sound_t snd)
+{
+	if (sim.sounds == MAX_SOUNDS) return;
+	sim.sound_ms[sim.sounds] = sim.now;
+	sim.sound[sim.sounds++] = snd;
+}
+
+static void gc_led(void *ctx, bool on)
+{
+	sim.led = on;
+}
+
+static const gcore_ops_t ops = {
+	.shoot = gc_shoot,
+	.timer = gc_timer,
+	.sound = gc_sound,
+	.led = gc_led,
+};
+
+// Start a game at time zero.
+static void gc_start(void)
+{
+	sim = (gc_sim_t){0};
+	gcore_init(&game, &ops, TEAM, ~(UINT32_C(1) << TEAM));
+}
+
+// Feed a trace to the core, with the expiries of its timers in time
+// order, up to a time in ms. A timer expiring at the time of a step is
+// handled first.
+static void gc_run(const gc_step_t *step, uint32_t until_ms)
+{
+	for (;;) {
+		int16_t id = -1;
+		for (uint16_t i = 0; i < GCORE_TIMERS; i++)
+			if (sim.armed[i] && (id < 0 || sim.due[i] < sim.due[id])) id = i;
+		uint32_t t_step = (step && step->t_ms != END) ? step->t_ms : END;
+		if (id >= 0 && sim.due[id] <= t_step && sim.due[id] <= until_ms) {
+			gevent_t e = {GEVENT_TIMER, id, sim.gen[id], 0};
+			sim.now = sim.due[id];
+			sim.armed[id] = false;
+			gcore_event(&game, &e);
+		} else if (t_step <= until_ms) {
+			gevent_t e = {step->type, step->arg, 0, 0};
+			sim.now = t_step;
+			gcore_event(&game, &e);
+			step++;
+		} else {
+			sim.now = until_ms;
+			return;
+		}
+	}
+}
+
+// Return the number of times a sound was played.
+static uint16_t gc_count(gcore_sound_t snd)
+{
+	uint16_t n = 0;
+
+	for (uint16_t i = 0; i < sim.sounds; i++)
+		if (sim.sound[i] == snd) n++;
+	return n;
+}
+
+// Return the time in ms a sound was last played, or END if never.
+static uint32_t gc_last(gcore_sound_t snd)
+{
+	for (uint16_t i = sim.sounds; i > 0; i--)
+		if (sim.sound[i-1] == snd) return sim.sound_ms[i-1];
+	return END;
+}
+
+// Report an error if a condition is false.
+// Return the condition.
+static bool gc_expect(bool cond, const char *what)
+{
+	if (!cond) printf(" -- error: %s\n", what);
+	return cond;
+}
+
+#define P GEVENT_TRIGGER_PRESSED
+#define R GEVENT_TRIGGER_RELEASED
+#define H GEVENT_HIT
+
+// Eleven quick presses, then nothing
+static const gc_step_t t_clip[] = {
+	{.t_ms = 100, .type = P}, {.t_ms = 150, .type = R},
+	{.t_ms = 200, .type = P}, {.t_ms = 250, .type = R},
+	{.t_ms = 300, .type = P}, {.t_ms = 350, .type = R},
+	{.t_ms = 400, .type = P}, {.t_ms = 450, .type = R},
+	{.t_ms = 500, .type = P}, {.t_ms = 550, .type = R},
+	{.t_ms = 600, .type = P}, {.t_ms = 650, .type = R},
+	{.t_ms = 700, .type = P}, {.t_ms = 750, .type = R},
+	{.t_ms = 800, .type = P}, {.t_ms = 850, .type = R},
+	{.t_ms = 900, .type = P}, {.t_ms = 950, .type = R},
+	{.t_ms = 1000, .type = P}, {.t_ms = 1050, .type = R},
+	{.t_ms = 1100, .type = P}, {.t_ms = 1150, .type = R},
+	{.t_ms = END},
+};
+
+// A held press reloads, a short one does not
+static const gc_step_t t_manual[] = {
+	{.t_ms = 100, .type = P}, {.t_ms = 1000, .type = R},
+	{.t_ms = 2000, .type = P}, {.t_ms = 2000+CONFIG_SHOT_RELOAD_PERIOD+100, .type = R},
+	{.t_ms = END},
+};
+
+// Own channel, lockout, and a lost life
+static const gc_step_t t_hits[] = {
+	{.t_ms = 100, .type = H, .arg = TEAM}, // Own team, ignored
+	{.t_ms = 200, .type = H, .arg = FOE}, // Hit 1
+	{.t_ms = 200+CONFIG_LOCKOUT_PERIOD-1, .type = H, .arg = FOE}, // Locked out
+	{.t_ms = 1000, .type = H, .arg = FOE}, {.t_ms = 2000, .type = H, .arg = FOE}, // Hits 2 to 5
+	{.t_ms = 3000, .type = H, .arg = FOE}, {.t_ms = 4000, .type = H, .arg = FOE},
+	{.t_ms = 4100, .type = P}, {.t_ms = 4200, .type = R}, // Invincible, trigger ignored
+	{.t_ms = 5000, .type = H, .arg = FOE}, // Invincible, ignored
+	{.t_ms = 4000+CONFIG_INVINCIBILITY_PERIOD+100, .type = H, .arg = FOE}, // Hit 1 of life 2
+	{.t_ms = END},
+};
+
+// Test a trace of hits for a whole game. Hits come every second, which is
+// longer than the lockout, and stop once the game is over.
+static bool gc_game_over(void)
+{
+	gc_step_t t[CONFIG_GAME_LIVES*CONFIG_GAME_HITS*2 + 1];
+	uint32_t ms = 0;
+	uint16_t n = 0;
+	bool ok = true;
+
+	gc_start();
+	for (uint16_t life = 0; life < CONFIG_GAME_LIVES; life++) {
+		for (uint16_t h = 0; h < CONFIG_GAME_HITS; h++) {
+			ms += 1000;
+			t[n++] = (gc_step_t){.t_ms = ms, .type = H, .arg = FOE};
+		}
+		ms += CONFIG_INVINCIBILITY_PERIOD;
+	}
+	t[n] = (gc_step_t){.t_ms = END};
+	uint32_t over_ms = t[n-1].t_ms;
+	gc_run(t, over_ms + CONFIG_GAMEOVER_DELAY + 2*CONFIG_GAME_BASE_PERIOD);
+	ok &= gc_expect(game.state == GCORE_OVER && game.lives == 0, "game not over");
+	ok &= gc_expect(gc_count(GCORE_SND_LIFE) == CONFIG_GAME_LIVES-1, "life sounds");
+	ok &= gc_expect(gc_last(GCORE_SND_OVER) == over_ms, "game over time");
+	ok &= gc_expect(gc_count(GCORE_SND_BASE) == 3 &&
+		gc_last(GCORE_SND_BASE) == over_ms + CONFIG_GAMEOVER_DELAY + 2*CONFIG_GAME_BASE_PERIOD,
+		"return to base reminders");
+	ok &= gc_expect(!sim.led, "hit LED left on");
+
+	// The trigger is ignored, then a start message starts a new game.
+	const gc_step_t t2[] = {
+		{.t_ms = sim.now+100, .type = P}, {.t_ms = sim.now+200, .type = R}, {.t_ms = END},
+	};
+	uint32_t shots = sim.shots;
+	gc_run(t2, sim.now + 300);
+	ok &= gc_expect(sim.shots == shots, "shot after game over");
+	gevent_t e = {GEVENT_NET, GCORE_NET_START, 0, 0};
+	gcore_event(&game, &e);
+	ok &= gc_expect(game.state == GCORE_PLAY && game.lives == CONFIG_GAME_LIVES &&
+		game.shots == CONFIG_SHOT_COUNT && !sim.armed[GCORE_TIMER_BASE],
+		"restart");
+	return ok;
+}
+
+// Run tests of the game core. Each test feeds a scripted trace of trigger
+// and hit events to the core, with the expiries of the timers it starts
+// on a simulated clock, and checks the shots, sounds and state.
+void test_gcore(void)
+{
+	bool err = false;
+
+	printf("******** test_gcore() ********\n");
+
+	printf("clip and auto reload test\n");
+	gc_start();
+	gc_run(t_clip, 1100 + CONFIG_SHOT_RELOAD_PERIOD - 1);
+	err |= !gc_expect(sim.shots == CONFIG_SHOT_COUNT && sim.chan == TEAM, "shots fired");
+	err |= !gc_expect(gc_count(GCORE_SND_EMPTY) == 1 && game.shots == 0, "empty clip");
+	gc_run(NULL, 1100 + CONFIG_SHOT_RELOAD_PERIOD);
+	err |= !gc_expect(game.shots == CONFIG_SHOT_COUNT &&
+		gc_last(GCORE_SND_RELOAD) == 1100 + CONFIG_SHOT_RELOAD_PERIOD, "auto reload");
+
+	printf("manual reload test\n");
+	gc_start();
+	gc_run(t_manual, 10000);
+	err |= !gc_expect(gc_count(GCORE_SND_RELOAD) == 1 &&
+		gc_last(GCORE_SND_RELOAD) == 2000 + CONFIG_SHOT_RELOAD_PERIOD, "manual reload");
+	err |= !gc_expect(game.shots == CONFIG_SHOT_COUNT && sim.shots == 2, "shots after reload");
+
+	printf("stale timer test\n");
+	gc_start();
+	{
+		const gc_step_t t[] = {
+			{.t_ms = 100, .type = P}, {.t_ms = 200, .type = R}, {.t_ms = END},
+		};
+		gc_run(t, 200);
+		// Expiry posted before the release was handled
+		gevent_t e = {GEVENT_TIMER, GCORE_TIMER_RELOAD, sim.gen[GCORE_TIMER_RELOAD]-1, 0};
+		gcore_event(&game, &e);
+		err |= !gc_expect(game.shots == CONFIG_SHOT_COUNT-1, "stale expiry reloaded");
+	}
+
+	printf("hit, lockout and life test\n");
+	gc_start();
+	gc_run(t_hits, 4000 + CONFIG_INVINCIBILITY_PERIOD + 200);
+	err |= !gc_expect(game.taken == CONFIG_GAME_HITS+1, "hits counted");
+	err |= !gc_expect(gc_count(GCORE_SND_HIT) == CONFIG_GAME_HITS, "hit sounds");
+	err |= !gc_expect(gc_last(GCORE_SND_LIFE) == 4000, "life lost time");
+	err |= !gc_expect(game.lives == CONFIG_GAME_LIVES-1 && game.hits == 1 &&
+		game.state == GCORE_PLAY, "state after invincibility");
+	err |= !gc_expect(sim.shots == 0, "shot while invincible");
+	err |= !gc_expect(sim.led, "hit LED");
+	gc_run(NULL, sim.now + CONFIG_HITLED_PERIOD);
+	err |= !gc_expect(!sim.led, "hit LED off");
+
+	printf("game over test\n");
+	err |= !gc_game_over();
+
+	printf("******** test_gcore() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_GCORE_H_
+#define TEST_GCORE_H_
+
+// Run tests of the game core against scripted event traces.
+void test_gcore(void);
+
+#endif // TEST_GCORE_H_
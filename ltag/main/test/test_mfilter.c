@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "config.h" // CONFIG_*
+#include "filter.h" // FILTER_*, filter_firFilter
+#include "mfilter.h"
+
+// Rate of the decimated stream fed to the matched filter
+#define DEC_RATE (CONFIG_RX_SAMPLE_RATE/FILTER_FIR_DECIMATION_FACTOR)
+// Input samples per chip
+#define CHIP_SAMPLES ((uint64_t)CONFIG_RX_SAMPLE_RATE*CONFIG_TX_CHIP/1000000)
+// Input samples in a coded burst
+#define BURST_SAMPLES (CHIP_SAMPLES*CONFIG_TX_CODE_CHIPS)
+#define MS_SAMPLES(ms) ((uint64_t)CONFIG_RX_SAMPLE_RATE*(ms)/1000)
+#define SAMPLES_MS(n) ((uint64_t)(n)*1000/CONFIG_RX_SAMPLE_RATE)
+
+#define SIG_AMP 0.25f // Square wave amplitude at the filter input
+#define LEAD_MS 600 // Noise before the burst, lets the noise floor settle
+#define TAIL_MS 100 // Samples checked after the burst
+#define QUIET_MS 2000 // Duration of noise-only test
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+
+// Return a pseudo-random value uniformly distributed in [-1.0, 1.0].
+static float mf_rand(void)
+{
+	static uint32_t x = 88172645U; // xorshift32 state, fixed seed
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return (float)x / (float)UINT32_MAX * 2.0f - 1.0f;
+}
+
+// Return approximately normal noise with the specified standard deviation.
+static float mf_noise(float sigma)
+{
+	// Sum of 3 uniform values has a variance of 1.0
+	return (mf_rand() + mf_rand() + mf_rand()) * sigma;
+}
+
+// Return the sample at index n of a coded burst on a channel. The burst
+// is a square wave (like the transmitter) keyed by the code. Samples
+// outside the burst are zero.
+static float mf_burst(uint16_t chan, uint64_t n)
+{
+	if (n >= BURST_SAMPLES) return 0.0f;
+	uint32_t chip = n / CHIP_SAMPLES;
+	if (!(CONFIG_TX_CODE & (1UL << (CONFIG_TX_CODE_CHIPS-1-chip)))) return 0.0f;
+	// Phase of the square wave in cycles, high for the first half cycle.
+	uint64_t ph = n * play_freq[chan] % CONFIG_RX_SAMPLE_RATE;
+	return (ph < CONFIG_RX_SAMPLE_RATE/2) ? SIG_AMP : -SIG_AMP;
+}
+
+// Run samples through the decimating FIR filter and the matched filter.
+// Return the channel with a hit, or -1. Set *at to the input sample index
+// of the hit.
+static int32_t mf_run(mfilter_t *m, int32_t chan, uint64_t start,
+	uint64_t count, float sigma, uint64_t *at)
+{
+	for (uint64_t n = 0; n < count; n++) {
+		float in = mf_noise(sigma);
+		if (chan >= 0 && n >= start) in += mf_burst(chan, n - start);
+		bool run = (n % FILTER_FIR_DECIMATION_FACTOR) == FILTER_FIR_DECIMATION_FACTOR-1;
+		filter_data_t out = filter_firFilter(in, run);
+		if (run && mfilter_addSample(m, out)) {
+			int32_t hit = mfilter_getHitChannel(m, CONFIG_TX_CODE_THRESH);
+			if (hit >= 0) {*at = n; return hit;}
+		}
+	}
+	return -1;
+}
+
+// Run tests for the matched filter (short-pulse mode).
+// - Synthesize coded bursts on each channel with noise.
+// - Process them through the decimating FIR filter and the matched filter.
+// - Verify hit channel and latency, and no hits from noise alone.
+void test_mfilter(void)
+{
+	static const float sigma[] = {0.05f, 0.2f};
+	bool err = false;
+	mfilter_t m;
+	uint64_t at;
+	int32_t hit;
+
+	printf("******** test_mfilter() ********\n");
+	filter_init();
+
+	printf("mfilter_init() test\n");
+	if (!mfilter_init(&m, play_freq, FILTER_CHANNELS, DEC_RATE, 0, 0, CONFIG_TX_CHIP)) {
+		printf(" -- error: no error with zero chips\n");
+		err = true;
+	}
+	if (mfilter_init(&m, play_freq, FILTER_CHANNELS, DEC_RATE,
+		CONFIG_TX_CODE, CONFIG_TX_CODE_CHIPS, CONFIG_TX_CHIP)) {
+		printf(" -- error: matched filter init\n");
+		err = true;
+		goto tmf_end;
+	}
+
+	// Verify noise alone does not produce a hit
+	printf("noise only test\n");
+	for (uint16_t s = 0; s < sizeof(sigma)/sizeof(sigma[0]); s++) {
+		filter_reset();
+		mfilter_reset(&m);
+		hit = mf_run(&m, -1, 0, MS_SAMPLES(QUIET_MS), sigma[s], &at);
+		if (hit >= 0) {
+			printf(" -- error: hit on chan:%ld at:%llu ms with noise:%.2f\n",
+				hit, SAMPLES_MS(at), sigma[s]);
+			err = true;
+		}
+	}
+
+	// Verify a hit on the burst channel shortly after the end of the burst
+	printf("coded burst test, burst:%llu ms\n", SAMPLES_MS(BURST_SAMPLES));
+	for (uint16_t s = 0; s < sizeof(sigma)/sizeof(sigma[0]); s++) {
+		for (uint16_t i = 0; i < FILTER_CHANNELS; i++) {
+			uint64_t start = MS_SAMPLES(LEAD_MS);
+			filter_reset();
+			mfilter_reset(&m);
+			hit = mf_run(&m, i, start,
+				start + BURST_SAMPLES + MS_SAMPLES(TAIL_MS), sigma[s], &at);
+			if (hit < 0) {
+				printf(" -- error: no hit on chan:%hu with noise:%.2f\n", i, sigma[s]);
+				err = true;
+			} else if (hit != i) {
+				printf(" -- error: hit on chan:%ld, expecting:%hu\n", hit, i);
+				err = true;
+			} else if (at < start + BURST_SAMPLES - 2*CHIP_SAMPLES ||
+				at > start + BURST_SAMPLES + 2*CHIP_SAMPLES) {
+				printf(" -- error: chan:%hu hit at:%llu ms, expecting:%llu ms\n",
+					i, SAMPLES_MS(at-start), SAMPLES_MS(BURST_SAMPLES));
+				err = true;
+			} else if (s == 0) {
+				printf("hit_ch:%hu quality:%.1f det:%2llu ms (pulse mode:%d ms)\n",
+					i, mfilter_getQuality(&m, i), SAMPLES_MS(at-start), CONFIG_TX_PULSE);
+			}
+		}
+	}
+	mfilter_free(&m);
+
+tmf_end:
+	printf("******** test_mfilter() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_MFILTER_H_
+#define TEST_MFILTER_H_
+
+// Run tests for the matched filter (short-pulse mode).
+void test_mfilter(void);
+
+#endif // TEST_MFILTER_H_
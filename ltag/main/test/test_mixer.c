@@ -0,0 +1,311 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h> // abs
+#include <string.h> // memset
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_cpu.h" // esp_cpu_get_cycle_count
+#endif
+
+#include "mixer.h"
+#include "bcFire.h"
+#include "ouch.h"
+
+#define BLOCK 64 // Samples in an I2S DMA block (DMA_DESC_SZ/2)
+#define OUCH_AT 4800 // Samples into the gunshot when the hit sound starts
+#define BENCH_BLOCKS 1000
+#define TAIL_BLOCKS 8 // Silent blocks after a sound (DMA_DESC_NUM)
+#define LOOP_LEN 100 // Samples in a looped sound, not a multiple of BLOCK
+#define PERCENT 100
+#define WAV_FILE "mixer.wav"
+
+static mixer_t mix;
+static int16_t out[BLOCK*3];
+
+// Expected saturated sum of two scaled samples.
+static int16_t mx_sum(int32_t a, int32_t b)
+{
+	int32_t s = a + b;
+	return (s > INT16_MAX) ? INT16_MAX : (s < INT16_MIN) ? INT16_MIN : s;
+}
+
+// Check rendered samples against expected ones.
+// Return true if they match.
+static bool mx_check(const char *name, const int16_t *exp, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++)
+		if (out[i] != exp[i]) {
+			printf(" -- error: %s, sample %lu is %d, expecting %d\n",
+				name, (unsigned long)i, out[i], exp[i]);
+			return false;
+		}
+	return true;
+}
+
+// Scripted checks of the voices, gains, loops and handles.
+static bool mx_basic(void)
+{
+	static const int16_t ramp[5] = {1000, -2000, 3000, -4000, 32767};
+	static const int16_t loud[4] = {30000, -30000, 20000, -20000};
+	static const uint8_t u8[3] = {0x80, 0xFF, 0x00};
+	int16_t exp[BLOCK*3];
+	bool ok = true;
+	mixer_handle_t h, h2;
+
+	// One voice played once, then silence
+	mixer_init(&mix);
+	h = mixer_play(&mix, ramp, 5, MIXER_S16, false, MIXER_UNITY);
+	memset(exp, 0, sizeof(exp));
+	memcpy(exp, ramp, sizeof(ramp));
+	ok &= mixer_render(&mix, out, BLOCK) == 1 && mx_check("once", exp, BLOCK);
+	if (mixer_busy(&mix, h) || mixer_active(&mix)) {
+		printf(" -- error: voice still busy after its sound ended\n");
+		ok = false;
+	}
+
+	// Looping across block boundaries, at half gain
+	h = mixer_play(&mix, ramp, 5, MIXER_S16, true, MIXER_UNITY/2);
+	for (uint32_t i = 0; i < BLOCK*3; i++) exp[i] = ramp[i % 5] >> 1;
+	mixer_render(&mix, out, BLOCK*3);
+	ok &= mx_check("loop", exp, BLOCK*3);
+
+	// A stale handle does not affect the sound that reuses the voice
+	mixer_stop(&mix, h);
+	h2 = mixer_play(&mix, ramp, 5, MIXER_S16, true, MIXER_UNITY);
+	mixer_stop(&mix, h);
+	if (h2 == h || !mixer_busy(&mix, h2)) {
+		printf(" -- error: stale handle stopped a new sound\n");
+		ok = false;
+	}
+	mixer_stop_all(&mix);
+
+	// Two voices summed with saturation
+	mixer_play(&mix, loud, 4, MIXER_S16, false, MIXER_UNITY);
+	mixer_play(&mix, loud, 4, MIXER_S16, false, MIXER_UNITY);
+	for (uint32_t i = 0; i < 4; i++) exp[i] = mx_sum(loud[i], loud[i]);
+	mixer_render(&mix, out, 4);
+	ok &= mx_check("saturation", exp, 4);
+	if (mix.clips != 4) {
+		printf(" -- error: %lu clipped samples, expecting 4\n", (unsigned long)mix.clips);
+		ok = false;
+	}
+
+	// Unsigned 8-bit samples and the master gain
+	mixer_master(&mix, MIXER_UNITY/4);
+	mixer_play(&mix, u8, 3, MIXER_U8, false, MIXER_UNITY);
+	exp[0] = 0; exp[1] = (127 << 8) >> 2; exp[2] = (-128 * 256) >> 2;
+	mixer_render(&mix, out, 3);
+	ok &= mx_check("unsigned 8-bit", exp, 3);
+	mixer_master(&mix, MIXER_UNITY);
+
+	// When all voices are busy, the oldest one is taken
+	mixer_handle_t first = mixer_play(&mix, ramp, 5, MIXER_S16, true, MIXER_UNITY);
+	for (uint32_t i = 1; i < MIXER_VOICES; i++)
+		mixer_play(&mix, ramp, 5, MIXER_S16, true, MIXER_UNITY);
+	h = mixer_play(&mix, ramp, 5, MIXER_S16, true, MIXER_UNITY);
+	if (mixer_busy(&mix, first) || !mixer_busy(&mix, h) || mixer_active(&mix) != MIXER_VOICES) {
+		printf(" -- error: voice not taken from the oldest sound\n");
+		ok = false;
+	}
+	mixer_stop_all(&mix);
+	return ok;
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+// Write 16-bit mono samples to a WAV file.
+static void mx_wav(FILE *f, const int16_t *s, uint32_t n, uint32_t rate)
+{
+	uint32_t data = n*sizeof(s[0]);
+	uint32_t hdr[] = {
+		0x46464952, 36+data, 0x45564157, // "RIFF", size, "WAVE"
+		0x20746d66, 16, 1 | (1 << 16), rate, rate*2, 2 | (16 << 16), // "fmt " PCM mono 16-bit
+		0x61746164, data, // "data"
+	};
+	fwrite(hdr, sizeof(hdr), 1, f);
+	fwrite(s, sizeof(s[0]), n, f);
+}
+#endif
+
+// Mix the hit sound into the gunshot one block at a time, as the DMA
+// callback does, and compare with the sum of the two sounds.
+static bool mx_assets(void)
+{
+	static int16_t mixed[BCFIRE_SAMPLES];
+	uint32_t n = 0, bad = 0;
+	mixer_handle_t fire, hit = MIXER_NONE;
+
+	mixer_init(&mix);
+	fire = mixer_play(&mix, bcFire, BCFIRE_SAMPLES, MIXER_S16, false, MIXER_UNITY*3/4);
+	while (n < BCFIRE_SAMPLES) {
+		if (n == OUCH_AT) hit = mixer_play(&mix, ouch, OUCH_SAMPLES, MIXER_S16, false, MIXER_UNITY);
+		mixer_render(&mix, mixed + n, BLOCK);
+		n += BLOCK;
+	}
+	for (uint32_t i = 0; i < BCFIRE_SAMPLES; i++) {
+		int32_t a = (bcFire[i] * (int32_t)(MIXER_UNITY*3/4)) >> 15;
+		int32_t b = (i >= OUCH_AT && i - OUCH_AT < OUCH_SAMPLES) ? ouch[i - OUCH_AT] : 0;
+		if (mixed[i] != mx_sum(a, b)) bad++;
+	}
+	if (bad || fire < 0 || hit < 0 || mixer_busy(&mix, fire)) {
+		printf(" -- error: %lu mixed samples differ from the sum\n", (unsigned long)bad);
+		return false;
+	}
+	printf("gunshot and hit mixed, %lu clipped samples\n", (unsigned long)mix.clips);
+#if CONFIG_IDF_TARGET_LINUX
+	FILE *f = fopen(WAV_FILE, "wb");
+	if (f) {
+		mx_wav(f, mixed, BCFIRE_SAMPLES, BCFIRE_SAMPLE_RATE);
+		fclose(f);
+		printf("mix written to %s\n", WAV_FILE);
+	}
+#endif
+	return true;
+}
+
+// Old fill of a DMA block in sound_i2s.c, with a modulo per sample and a
+// percent volume. A sound played once was read past its end, wrapping to
+// its start, in its last block.
+static uint32_t mx_old_fill(const int16_t *abase, uint32_t asize, uint32_t aidx,
+	bool cyclic, uint32_t volume, int16_t *buf)
+{
+	uint32_t idx = aidx;
+	uint32_t size = (!cyclic && asize < BLOCK) ? asize : BLOCK;
+	aidx = cyclic ? (aidx + size) % asize : aidx + size;
+	uint32_t i;
+	for (i = 0; i < size; i++) buf[i] = (abase[(idx+i)%asize])*(int32_t)volume/PERCENT;
+	while (i < BLOCK) buf[i++] = 0;
+	return aidx;
+}
+
+// Fill DMA blocks with a sound, as the I2S callback does, and compare
+// with a sample by sample reference using the same Q15 gain. Then check
+// the silent blocks that follow. Also compare with the old percent volume,
+// which rounds differently.
+// Return true if all match.
+static bool mx_fill_case(const int16_t *audio, uint32_t len, bool loop, uint32_t vol)
+{
+	static int16_t blk[BLOCK];
+	uint32_t tail = TAIL_BLOCKS, blocks = loop ? (len/BLOCK + 3) : (len + BLOCK-1)/BLOCK;
+	uint32_t g = vol*MIXER_UNITY/PERCENT, aidx = 0, worst = 0;
+	int16_t old[BLOCK];
+
+	mixer_init(&mix);
+	mixer_master(&mix, g);
+	mixer_play(&mix, audio, len, MIXER_S16, loop, MIXER_UNITY);
+	for (uint32_t b = 0; b < blocks; b++) {
+		if (mixer_fill(&mix, &tail, blk, BLOCK) != MIXER_FILL_SOUND) {
+			printf(" -- error: block %lu not filled with sound\n", (unsigned long)b);
+			return false;
+		}
+		aidx = mx_old_fill(audio, len, aidx, loop, vol, old);
+		for (uint32_t i = 0; i < BLOCK; i++) {
+			uint32_t n = b*BLOCK + i;
+			int16_t exp = (loop || n < len) ? (audio[n % len] * (int32_t)g) >> 15 : 0;
+			if (blk[i] != exp) {
+				printf(" -- error: %s vol:%lu sample %lu is %d, expecting %d\n",
+					loop ? "loop" : "once", (unsigned long)vol, (unsigned long)n, blk[i], exp);
+				return false;
+			}
+			if (loop || n < len) {
+				uint32_t d = abs(blk[i] - old[i]);
+				if (d > worst) worst = d;
+			}
+		}
+	}
+	if (worst > 1) {
+		printf(" -- error: %lu LSB from the percent volume\n", (unsigned long)worst);
+		return false;
+	}
+	if (loop) return true;
+	for (uint32_t b = 0; b < TAIL_BLOCKS; b++)
+		if (mixer_fill(&mix, &tail, blk, BLOCK) != MIXER_FILL_SILENCE || blk[0] || blk[BLOCK-1]) {
+			printf(" -- error: silent block %lu missing\n", (unsigned long)b);
+			return false;
+		}
+	if (mixer_fill(&mix, &tail, blk, BLOCK) != MIXER_FILL_IDLE) {
+		printf(" -- error: more than %d silent blocks\n", TAIL_BLOCKS);
+		return false;
+	}
+	return true;
+}
+
+// Sample-exact checks of the DMA block fill.
+static bool mx_fill(void)
+{
+	static const uint32_t vol[] = {100, 37, 10};
+	bool ok = true;
+
+	for (uint32_t i = 0; i < sizeof(vol)/sizeof(vol[0]); i++) {
+		ok &= mx_fill_case(ouch, OUCH_SAMPLES, false, vol[i]);
+		ok &= mx_fill_case(bcFire, LOOP_LEN, true, vol[i]);
+		ok &= mx_fill_case(bcFire, BLOCK*2, true, vol[i]);
+	}
+	if (ok) printf("mixer_fill() matches the reference, once and looped\n");
+	return ok;
+}
+
+// Time the old fill and mixer_fill() for one sound, the common case.
+static void mx_bench_fill(void)
+{
+	int16_t blk[BLOCK];
+	uint32_t tail = 0, aidx = 0;
+
+	for (uint32_t vol = 10; vol <= PERCENT; vol += PERCENT-10) {
+		mixer_init(&mix);
+		mixer_master(&mix, vol*MIXER_UNITY/PERCENT);
+		mixer_play(&mix, bcFire, BCFIRE_SAMPLES, MIXER_S16, true, MIXER_UNITY);
+		int64_t t0 = esp_timer_get_time();
+		for (uint32_t i = 0; i < BENCH_BLOCKS; i++)
+			aidx = mx_old_fill(bcFire, BCFIRE_SAMPLES, aidx, true, vol, blk);
+		int64_t t1 = esp_timer_get_time();
+		for (uint32_t i = 0; i < BENCH_BLOCKS; i++) mixer_fill(&mix, &tail, blk, BLOCK);
+		int64_t t2 = esp_timer_get_time();
+		printf("fill of %d samples at volume %lu%%: old %lld ns, mixer_fill() %lld ns per block\n",
+			BLOCK, (unsigned long)vol, (long long)(t1-t0)*1000/BENCH_BLOCKS,
+			(long long)(t2-t1)*1000/BENCH_BLOCKS);
+	}
+	mixer_stop_all(&mix);
+}
+
+// Time the rendering of a DMA block with all voices playing.
+static void mx_bench(void)
+{
+	int16_t blk[BLOCK];
+
+	mixer_init(&mix);
+	for (uint32_t i = 0; i < MIXER_VOICES; i++)
+		mixer_play(&mix, (i & 1) ? (const void *)ouch : (const void *)bcFire,
+			(i & 1) ? OUCH_SAMPLES : BCFIRE_SAMPLES, MIXER_S16, true, MIXER_UNITY/MIXER_VOICES);
+#if CONFIG_IDF_TARGET_LINUX
+	int64_t t0 = esp_timer_get_time();
+	for (uint32_t i = 0; i < BENCH_BLOCKS; i++) mixer_render(&mix, blk, BLOCK);
+	int64_t t1 = esp_timer_get_time();
+	printf("mixer_render() %d voices, %d samples: %lld ns per block\n",
+		MIXER_VOICES, BLOCK, (long long)(t1-t0)*1000/BENCH_BLOCKS);
+#else
+	uint32_t c0 = esp_cpu_get_cycle_count();
+	for (uint32_t i = 0; i < BENCH_BLOCKS; i++) mixer_render(&mix, blk, BLOCK);
+	uint32_t c1 = esp_cpu_get_cycle_count();
+	printf("mixer_render() %d voices, %d samples: %lu cycles per block\n",
+		MIXER_VOICES, BLOCK, (c1-c0)/BENCH_BLOCKS);
+#endif
+	mixer_stop_all(&mix);
+}
+
+void test_mixer(void)
+{
+	bool err = false;
+
+	printf("******** test_mixer() ********\n");
+	if (!mx_basic()) err = true;
+	if (!mx_assets()) err = true;
+	if (!mx_fill()) err = true;
+	mx_bench();
+	mx_bench_fill();
+
+	printf("******** test_mixer() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_MIXER_H_
+#define TEST_MIXER_H_
+
+// Run tests of the sound mixer.
+void test_mixer(void);
+
+#endif // TEST_MIXER_H_
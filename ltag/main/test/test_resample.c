@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h> // sin, log10
+#include <string.h> // memcpy
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_cpu.h" // esp_cpu_get_cycle_count
+#endif
+
+#include "asset.h"
+#include "mixer.h"
+
+#define IN_RATE 32000 // Of the assets
+#define OUT_RATE 24000 // Of the ESP32 build, see config.h
+#define SAMPLES 4096 // Of a test tone
+#define AMP 16384 // Of a test tone, half scale
+#define BLOCK 64 // Samples in an I2S DMA block
+#define SKIP 64 // Output samples skipped at each end of a tone
+#define BENCH_BLOCKS 500
+
+// Limits of the response in dB
+#define PASS_HZ 6000 // Top of the pass band checked
+#define PASS_DB 1.0 // Max ripple in the pass band, polyphase
+#define LINEAR_DB 2.0 // Max droop in the pass band, linear
+#define ALIAS_HZ 14000 // Above the output Nyquist rate
+#define ALIAS_DB (-30.0) // Max level of the alias, polyphase
+
+static uint8_t tone[sizeof(asset_hdr_t) + SAMPLES*sizeof(int16_t)];
+static int16_t out[SAMPLES*2];
+
+static const char *qname[] = {"linear", "polyphase"};
+
+// Make a tone asset.
+// hz: frequency, 0 for a constant.
+// Returns the size of the asset.
+static uint32_t rs_tone(double hz, uint32_t rate)
+{
+	int16_t *s = (int16_t *)(tone + sizeof(asset_hdr_t));
+
+	asset_make(tone, MIXER_S16, rate, SAMPLES);
+	for (uint32_t i = 0; i < SAMPLES; i++)
+		s[i] = hz ? lrint(AMP*sin(2*M_PI*hz*i/rate)) : AMP;
+	return sizeof(tone);
+}
+
+// Play the tone asset through a mixer at the output rate.
+// Returns the number of output samples until the sound ended.
+static uint32_t rs_play(mixer_quality_t q, uint32_t size)
+{
+	static mixer_t mix;
+	uint32_t n = 0;
+
+	mixer_init(&mix);
+	mixer_rate(&mix, OUT_RATE);
+	mixer_quality(&mix, q);
+	mixer_handle_t h = mixer_play_asset(&mix, tone, size, MIXER_S16, false, MIXER_UNITY);
+	while (mixer_busy(&mix, h) && n + BLOCK <= sizeof(out)/sizeof(out[0])) {
+		mixer_render(&mix, out + n, BLOCK);
+		n += BLOCK;
+	}
+	while (n && !out[n-1]) n--; // Silence after the end
+	return n;
+}
+
+// Return the level in dB, relative to AMP, of the output at a frequency.
+// The ends of the output are not used.
+static double rs_level(double hz, uint32_t n)
+{
+	double c = 0.0, s = 0.0;
+
+	if (n <= 2*SKIP) return -INFINITY;
+	for (uint32_t i = SKIP; i < n - SKIP; i++) {
+		c += out[i] * cos(2*M_PI*hz*i/OUT_RATE);
+		s += out[i] * sin(2*M_PI*hz*i/OUT_RATE);
+	}
+	return 20.0*log10(2.0*sqrt(c*c + s*s)/(n - 2*SKIP)/AMP + 1e-9);
+}
+
+// Check the length of a resampled sound, and that a constant is kept as
+// is. Return true if the checks pass.
+static bool rs_dc(mixer_quality_t q)
+{
+	uint32_t n = rs_play(q, rs_tone(0, IN_RATE));
+	uint32_t len = (uint64_t)SAMPLES*OUT_RATE/IN_RATE;
+
+	if (n + 1 < len || n > len + 1) {
+		printf(" -- error: %s played %lu samples, expecting %lu\n", qname[q],
+			(unsigned long)n, (unsigned long)len);
+		return false;
+	}
+	for (uint32_t i = MIXER_TAPS; i < n - MIXER_TAPS; i++)
+		if (out[i] != AMP) {
+			printf(" -- error: %s sample %lu of a constant is %d\n", qname[q],
+				(unsigned long)i, out[i]);
+			return false;
+		}
+	return true;
+}
+
+// Measure the response to tones in the pass band, and the alias of a
+// tone above the output Nyquist rate, where it folds back to
+// OUT_RATE-ALIAS_HZ. Return true if in the limits.
+static bool rs_response(mixer_quality_t q)
+{
+	static const uint32_t hz[] = {500, 1000, 2000, 4000, PASS_HZ, 8000, 10000};
+	double lim = (q == MIXER_POLY) ? PASS_DB : LINEAR_DB;
+	bool ok = true;
+
+	printf("%s response:", qname[q]);
+	for (uint32_t i = 0; i < sizeof(hz)/sizeof(hz[0]); i++) {
+		double db = rs_level(hz[i], rs_play(q, rs_tone(hz[i], IN_RATE)));
+		printf(" %lu Hz %.1f dB%s", (unsigned long)hz[i], db,
+			(i < sizeof(hz)/sizeof(hz[0])-1) ? "," : "\n");
+		if (hz[i] <= PASS_HZ && fabs(db) > lim) ok = false;
+	}
+	double alias = rs_level(OUT_RATE - ALIAS_HZ, rs_play(q, rs_tone(ALIAS_HZ, IN_RATE)));
+	printf("%s alias of %u Hz at %u Hz: %.1f dB\n", qname[q], ALIAS_HZ,
+		OUT_RATE - ALIAS_HZ, alias);
+	if (!ok) printf(" -- error: pass band over %.1f dB\n", lim);
+	if (q == MIXER_POLY && alias > ALIAS_DB) {
+		printf(" -- error: alias over %.1f dB\n", ALIAS_DB);
+		ok = false;
+	}
+	return ok;
+}
+
+// Time the render of a DMA block of a looped sound: at the output rate,
+// and resampled with each quality.
+static void rs_bench(void)
+{
+	static mixer_t mix;
+	static const char *name[] = {"not resampled", "linear", "polyphase"};
+
+	for (uint32_t t = 0; t < 3; t++) {
+		mixer_init(&mix);
+		mixer_rate(&mix, OUT_RATE);
+		mixer_quality(&mix, t ? t-1 : MIXER_RESAMPLE);
+		mixer_play_asset(&mix, tone, rs_tone(1000, t ? IN_RATE : OUT_RATE),
+			MIXER_S16, true, MIXER_UNITY);
+#if CONFIG_IDF_TARGET_LINUX
+		int64_t t0 = esp_timer_get_time();
+		for (uint32_t k = 0; k < BENCH_BLOCKS; k++) mixer_render(&mix, out, BLOCK);
+		int64_t t1 = esp_timer_get_time();
+		printf("mixer_render() %d samples, %s: %lld ns per block\n",
+			BLOCK, name[t], (long long)(t1-t0)*1000/BENCH_BLOCKS);
+#else
+		uint32_t c0 = esp_cpu_get_cycle_count();
+		for (uint32_t k = 0; k < BENCH_BLOCKS; k++) mixer_render(&mix, out, BLOCK);
+		uint32_t c1 = esp_cpu_get_cycle_count();
+		printf("mixer_render() %d samples, %s: %lu cycles per block\n",
+			BLOCK, name[t], (c1-c0)/BENCH_BLOCKS);
+#endif
+	}
+}
+
+void test_resample(void)
+{
+	bool err = false;
+
+	printf("******** test_resample() ********\n");
+	for (uint32_t q = MIXER_LINEAR; q <= MIXER_POLY; q++) {
+		if (!rs_dc(q)) err = true;
+		if (!rs_response(q)) err = true;
+	}
+	rs_bench();
+
+	printf("******** test_resample() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
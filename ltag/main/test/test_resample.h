@@ -0,0 +1,7 @@
+#ifndef TEST_RESAMPLE_H_
+#define TEST_RESAMPLE_H_
+
+// Run tests of resampling in the mixer.
+void test_resample(void);
+
+#endif // TEST_RESAMPLE_H_
@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h> // memcmp, memset
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "mixer.h"
+
+#define RATE 32000
+#define BLOCK 64 // Samples in an I2S DMA block
+#define PERIOD_US (BLOCK*1000000LL/RATE) // Between DMA callbacks
+#define BLOCKS 400 // Of a run
+#define SENTINEL 0x5A5A
+
+// Sounds of odd lengths, none a whole number of blocks but one
+#define SOUNDS 4
+#define LEN_MAX (BLOCK*5)
+static const uint32_t len[SOUNDS] = {BLOCK*3+17, BLOCK, 1, BLOCK*5-1};
+static int16_t sound[SOUNDS][LEN_MAX];
+
+static mixer_t mix;
+static int16_t stream[BLOCKS*BLOCK]; // Sent by the callback
+static int16_t want[BLOCKS*BLOCK]; // Expected
+
+// With no voice, mixer_next() returns the same prepared silence for each
+// block and does not write the buffer given.
+// Return true if it does.
+static bool rg_idle(void)
+{
+	int16_t blk[BLOCK];
+	const int16_t *sil = NULL;
+	bool ok = true;
+
+	mixer_init(&mix);
+	for (uint32_t k = 0; k < 8; k++) {
+		for (uint32_t i = 0; i < BLOCK; i++) blk[i] = SENTINEL;
+		const int16_t *src = mixer_next(&mix, blk, BLOCK, k*PERIOD_US);
+		if (!k) sil = src;
+		if (src == blk || src != sil || blk[0] != SENTINEL || blk[BLOCK-1] != SENTINEL) ok = false;
+		for (uint32_t i = 0; ok && i < BLOCK; i++)
+			if (src[i]) ok = false;
+	}
+	if (mix.stats.blocks != 8 || mix.stats.silent != 8 || mix.stats.starts) ok = false;
+	if (ok) printf("idle ring sends the prepared silence, the buffer is not written\n");
+	else printf(" -- error: idle blocks\n");
+	return ok;
+}
+
+// Run the DMA callback every block period on a virtual clock. When no
+// sound plays after a fill, start the next one: at once after the fill,
+// as the scheduler task does when woken at the end of a sound, or at a
+// random time before the next fill. The stream must be each sound from
+// the start of the block after its start, exact, with silence only in the
+// pad of its last block and in the blocks with no sound.
+// back: if true, start each sound right after the last one ends.
+// Return true if the checks pass.
+static bool rg_run(bool back)
+{
+	int16_t blk[BLOCK];
+	uint32_t seed = 1, next = 0, starts = 0, silent = 0;
+	int64_t lat_sum = 0, lat_max = 0;
+	bool ok = true;
+
+	mixer_init(&mix);
+	memset(want, 0, sizeof(want));
+	for (uint32_t k = 0; k < BLOCKS; k++) {
+		int64_t t = k*PERIOD_US;
+		const int16_t *src = mixer_next(&mix, blk, BLOCK, t);
+		if (src != blk) silent++;
+		memcpy(stream + k*BLOCK, src, sizeof(blk));
+		if (mixer_active(&mix) || k+1 == BLOCKS) continue;
+		seed = seed*1103515245 + 12345;
+		if (!back && (seed >> 16) % 4) continue; // Some silence
+		int64_t req = back ? t : t + 1 + (seed >> 8) % (PERIOD_US-1);
+		uint32_t s = next++ % SOUNDS;
+		mixer_now(&mix, req);
+		mixer_play(&mix, sound[s], len[s], MIXER_S16, false, MIXER_UNITY);
+		for (uint32_t i = 0; i < len[s] && (k+1)*BLOCK + i < BLOCKS*BLOCK; i++)
+			want[(k+1)*BLOCK + i] = sound[s][i];
+		int64_t lat = t + PERIOD_US - req; // To the next fill
+		if (lat > lat_max) lat_max = lat;
+		lat_sum += lat;
+		starts++;
+	}
+	if (memcmp(stream, want, sizeof(stream))) {
+		uint32_t i = 0;
+		while (stream[i] == want[i]) i++;
+		printf(" -- error: %s starts, sample %lu of block %lu is %d not %d\n",
+			back ? "back to back" : "random", (unsigned long)(i % BLOCK),
+			(unsigned long)(i / BLOCK), stream[i], want[i]);
+		ok = false;
+	}
+	if (mix.stats.starts != starts || mix.stats.lat_sum != lat_sum ||
+		mix.stats.lat_max != lat_max || lat_max > PERIOD_US ||
+		mix.stats.silent != silent || mix.stats.blocks != BLOCKS || (back && silent != 1)) {
+		printf(" -- error: %s starts, %lu starts, latency %lld us, %lu silent blocks\n",
+			back ? "back to back" : "random", (unsigned long)mix.stats.starts,
+			(long long)mix.stats.lat_max, (unsigned long)mix.stats.silent);
+		ok = false;
+	}
+	if (ok) printf("%lu sounds started %s, latency %lld us max, %lld us mean, "
+		"%lu of %u blocks silent\n", (unsigned long)starts,
+		back ? "back to back" : "at random", (long long)lat_max,
+		(long long)(starts ? lat_sum/starts : 0), (unsigned long)silent, BLOCKS);
+	return ok;
+}
+
+// While deferring, the commands change nothing the render reads until
+// mixer_begin(), and the queries count them at once. A stop cancels a
+// play still waiting, and the sounds that end are reported by
+// mixer_end(), not before.
+// Return true if the checks pass.
+static bool rg_defer(void)
+{
+	int16_t blk[BLOCK];
+	const int16_t *src;
+	bool ok = true;
+
+	mixer_init(&mix);
+	mixer_defer(&mix, true);
+	mixer_handle_t h = mixer_play(&mix, sound[0], len[0], MIXER_S16, false, MIXER_UNITY);
+	if (!mixer_busy(&mix, h) || mixer_active(&mix) != 1 || mix.v[h & 0xFF].on) ok = false;
+	mixer_stop(&mix, h); // Before it starts
+	if (mixer_busy(&mix, h) || mixer_active(&mix)) ok = false;
+	if (mixer_begin(&mix, 0) || mixer_block(&mix, blk, BLOCK) == blk || mixer_end(&mix)) ok = false;
+
+	h = mixer_play(&mix, sound[1], len[1], MIXER_S16, false, MIXER_UNITY/2);
+	mixer_gain(&mix, h, MIXER_UNITY); // Of the play waiting
+	mixer_master(&mix, MIXER_UNITY/2);
+	if (mix.master != MIXER_UNITY) ok = false;
+	if (!mixer_begin(&mix, PERIOD_US) || mix.master != MIXER_UNITY/2) ok = false;
+	src = mixer_block(&mix, blk, BLOCK); // The whole sound, at half gain
+	for (uint32_t i = 0; ok && i < BLOCK; i++)
+		if (src[i] != sound[1][i]/2) ok = false;
+	if (!mixer_busy(&mix, h) || !mixer_end(&mix) || mixer_busy(&mix, h)) ok = false;
+
+	h = mixer_play(&mix, sound[3], len[3], MIXER_S16, true, MIXER_UNITY);
+	mixer_begin(&mix, 2*PERIOD_US);
+	mixer_block(&mix, blk, BLOCK);
+	mixer_end(&mix);
+	mixer_stop(&mix, h);
+	if (mixer_busy(&mix, h) || !mix.v[h & 0xFF].on) ok = false; // Stop waiting
+	if (mixer_begin(&mix, 3*PERIOD_US) || mixer_end(&mix)) ok = false;
+	if (mix.stats.blocks != 4 || mix.stats.silent != 2 || mix.stats.starts != 2) ok = false;
+	if (ok) printf("deferred commands apply at the start of a block, ends at its end\n");
+	else printf(" -- error: deferred commands\n");
+	return ok;
+}
+
+void test_ring(void)
+{
+	bool err = false;
+
+	printf("******** test_ring() ********\n");
+	for (uint32_t s = 0; s < SOUNDS; s++)
+		for (uint32_t i = 0; i < LEN_MAX; i++) sound[s][i] = 1000*(s+1) + (i % 7)*100;
+	if (!rg_idle()) err = true;
+	if (!rg_run(false)) err = true;
+	if (!rg_run(true)) err = true;
+	if (!rg_defer()) err = true;
+
+	printf("******** test_ring() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_RING_H_
+#define TEST_RING_H_
+
+// Run tests of the block sequence of a standing DMA ring, mixer_next(),
+// and of the commands deferred to mixer_begin().
+void test_ring(void);
+
+#endif // TEST_RING_H_
@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h> // memcpy, memcmp
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+
+#include "config.h" // CONFIG_*
+#include "hw.h" // HW_LTAG_RX
+#include "rx.h"
+
+#define RATE_MS 1000 // Duration of sample rate measurement
+#define RATE_TOL 50 // Sample rate tolerance in parts per thousand
+// Time to fill the whole block queue, plus margin
+#define FILL_MS ((uint64_t)CONFIG_RX_FRAME*CONFIG_RX_FRAMES*1000/CONFIG_RX_SAMPLE_RATE*2+10)
+
+// Run tests for the rx module.
+// - Measure the sample rate delivered with rx_get_block().
+// - Verify a held block is not overwritten and new frames are dropped.
+// - Verify the per-sample interface still delivers samples.
+// - With a second receiver pin, measure the rate of interleaved pairs
+//   delivered after rx_init_dual() at CONFIG_RX_DUAL_RATE.
+void test_rx(void)
+{
+	static rx_data_t copy[CONFIG_RX_FRAME];
+	const rx_data_t *blk;
+	uint32_t cnt, tot = 0, max = 0;
+	uint64_t expect;
+	int64_t tbeg;
+	bool err = false;
+
+	printf("******** test_rx() ********\n");
+	if (rx_init(HW_LTAG_RX, CONFIG_RX_SAMPLE_RATE)) {
+		printf(" -- error: rx_init()\n");
+		err = true;
+		goto trx_end;
+	}
+
+	printf("rx_get_block() rate test\n");
+	vTaskDelay(pdMS_TO_TICKS(10));
+	rx_clear_buffer();
+	tbeg = esp_timer_get_time();
+	while (esp_timer_get_time() - tbeg < RATE_MS*1000) {
+		while ((blk = rx_get_block(&cnt)) != NULL) {
+			tot += cnt;
+			if (cnt > max) max = cnt;
+			rx_release_block();
+		}
+		vTaskDelay(1);
+	}
+	expect = (uint64_t)CONFIG_RX_SAMPLE_RATE*RATE_MS/1000;
+	printf("samples:%lu expect:%llu max block:%lu dropped:%lu\n",
+		tot, expect, max, rx_get_dropped());
+	if (tot < expect*(1000-RATE_TOL)/1000 || tot > expect*(1000+RATE_TOL)/1000) {
+		printf(" -- error: sample count out of tolerance\n");
+		err = true;
+	}
+	if (max > CONFIG_RX_FRAME) {
+		printf(" -- error: block larger than CONFIG_RX_FRAME\n");
+		err = true;
+	}
+	if (rx_get_dropped()) {
+		printf(" -- error: samples dropped while draining\n");
+		err = true;
+	}
+
+	printf("held block test\n");
+	rx_clear_buffer();
+	while ((blk = rx_get_block(&cnt)) == NULL) vTaskDelay(1);
+	memcpy(copy, blk, cnt*sizeof(rx_data_t));
+	vTaskDelay(pdMS_TO_TICKS(FILL_MS));
+	if (memcmp(copy, blk, cnt*sizeof(rx_data_t))) {
+		printf(" -- error: held block overwritten\n");
+		err = true;
+	}
+	if (!rx_get_dropped()) {
+		printf(" -- error: no samples dropped with a full queue\n");
+		err = true;
+	}
+	rx_release_block();
+
+	printf("rx_get_sample() test\n");
+	vTaskDelay(pdMS_TO_TICKS(10));
+	if (!rx_get_count()) {
+		printf(" -- error: no samples after release\n");
+		err = true;
+	}
+	cnt = rx_get_count();
+	while (cnt--) rx_get_sample();
+	rx_deinit();
+
+#ifdef HW_LTAG_RX2
+	printf("rx_init_dual() rate test\n");
+	bool odd = false;
+	if (rx_init_dual(HW_LTAG_RX, HW_LTAG_RX2, CONFIG_RX_DUAL_RATE) || rx_get_sensors() != 2) {
+		printf(" -- error: rx_init_dual()\n");
+		err = true;
+		goto trx_end;
+	}
+	vTaskDelay(pdMS_TO_TICKS(10));
+	rx_clear_buffer();
+	tot = 0;
+	tbeg = esp_timer_get_time();
+	while (esp_timer_get_time() - tbeg < RATE_MS*1000) {
+		while ((blk = rx_get_block(&cnt)) != NULL) {
+			tot += cnt;
+			if (cnt & 1) odd = true; // A pair was split
+			rx_release_block();
+		}
+		vTaskDelay(1);
+	}
+	expect = (uint64_t)2*CONFIG_RX_DUAL_RATE*RATE_MS/1000;
+	printf("samples:%lu expect:%llu dropped:%lu\n", tot, expect, rx_get_dropped());
+	if (tot < expect*(1000-RATE_TOL)/1000 || tot > expect*(1000+RATE_TOL)/1000) {
+		printf(" -- error: sample count out of tolerance\n");
+		err = true;
+	}
+	if (odd) {
+		printf(" -- error: block with an odd sample count\n");
+		err = true;
+	}
+	rx_deinit();
+#endif
+
+trx_end:
+	printf("******** test_rx() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
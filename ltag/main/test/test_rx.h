@@ -0,0 +1,7 @@
+#ifndef TEST_RX_H_
+#define TEST_RX_H_
+
+// Run tests for the rx module.
+void test_rx(void);
+
+#endif // TEST_RX_H_
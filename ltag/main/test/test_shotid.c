@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "config.h" // CONFIG_*
+#include "filter_ctx.h" // FILTER_*, filter_ctx_*
+#include "shotid.h"
+#include "chansim.h"
+#if CONFIG_IDF_TARGET_LINUX
+#include "txsched.h"
+#include "txsched_host.h"
+#endif
+
+#define ADC_BITS 12
+#define MS_SAMPLES(ms) ((uint64_t)CONFIG_RX_SAMPLE_RATE*(ms)/1000)
+#define DEC_RATE (CONFIG_RX_SAMPLE_RATE/FILTER_FIR_DECIMATION_FACTOR)
+
+// Input samples to fill the energy window, decoding starts after that
+#define WARMUP ((uint64_t)FILTER_FIR_DECIMATION_FACTOR*FILTER_ENERGY_SAMPLE_COUNT)
+#define PULSE_START 300 // ms, after the energy window fills with ambient
+#define TAIL 300 // ms, after the shot
+#define THRESH 5.0f // Decoder threshold factor
+#define INTERVAL (DEC_RATE*CONFIG_TX_ID_TONE/1000/4) // Quarter of a tone
+
+#if CONFIG_IDF_TARGET_LINUX
+#define TRIALS 20 // Shots per range and noise level
+#else
+#define TRIALS 4
+#endif
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+static const float range_amp[] = {0.05f, 0.02f, 0.01f, 0.005f, 0.002f};
+static const float noise_std[] = {0.01f, 0.03f};
+
+// Send one identity shot through a synthetic channel into a filter
+// instance and a decoder.
+// Return the decoded ID, -1 if nothing was decoded, or -2 if the team
+// channel was wrong.
+static int32_t si_run(uint16_t team, uint16_t id, float amp, float noise, uint32_t seed)
+{
+	static uint16_t buf[CONFIG_RX_FRAME];
+	uint16_t tone[SHOTID_TONES];
+	chansim_t c;
+	filter_ctx_t *f;
+	shotid_dec_t d;
+	int32_t res = -1;
+	uint32_t cnt;
+	uint64_t n = 0;
+
+	shotid_encode(team, id, tone);
+	chansim_init(&c, CONFIG_RX_SAMPLE_RATE, ADC_BITS);
+	c.noise = noise;
+	c.seed = seed;
+	c.length = MS_SAMPLES(PULSE_START + SHOTID_TONES*CONFIG_TX_ID_TONE + TAIL);
+	for (uint16_t i = 0; i < SHOTID_TONES; i++) {
+		chansim_shooter_t s = {
+			.freq_hz = play_freq[tone[i]],
+			.amp = amp,
+			.start_us = (PULSE_START + i*CONFIG_TX_ID_TONE)*1000,
+			.pulse_us = CONFIG_TX_ID_TONE*1000,
+		};
+		chansim_addShooter(&c, &s);
+	}
+	f = filter_ctx_init();
+	shotid_dec_init(&d, THRESH, INTERVAL);
+	while (res == -1 && (cnt = chansim_generate(buf, CONFIG_RX_FRAME, &c))) {
+		for (uint32_t i = 0; i < cnt; i++, n++) {
+			filter_data_t energy[FILTER_CHANNELS];
+			if (!filter_ctx_addSample(f, (filter_data_t)buf[i] / (1 << (ADC_BITS-1)) - (filter_data_t)1.0) ||
+				n < WARMUP)
+				continue;
+			filter_ctx_getEnergyArray(f, energy);
+			if (shotid_dec_addEnergy(&d, energy)) {
+				res = (shotid_dec_getTeam(&d) == team) ? shotid_dec_getId(&d) : -2;
+				break;
+			}
+		}
+	}
+	filter_ctx_free(f);
+	return res;
+}
+
+// Run tests of identity shots.
+// - Every ID of a team survives encoding and decoding, and invalid tone
+//   sequences are rejected.
+// - On the host, shotid_send() schedules the tones back to back.
+// - Simulate shots over a range of amplitudes (range) and noise levels and
+//   report decode accuracy. Shots at short range with low noise must all
+//   decode correctly.
+void test_shotid(void)
+{
+	uint16_t tone[SHOTID_TONES];
+	bool err = false;
+
+	printf("******** test_shotid() ********\n");
+
+	printf("shotid_encode() test\n");
+	for (uint16_t team = 0; team < FILTER_CHANNELS; team++) {
+		for (uint16_t id = 0; id < SHOTID_IDS; id++) {
+			if (shotid_encode(team, id, tone) || tone[0] != team ||
+				shotid_decode(tone) != id) {
+				printf(" -- error: team:%u id:%u\n", team, id);
+				err = true;
+				break;
+			}
+		}
+	}
+	if (!shotid_encode(0, SHOTID_IDS, tone)) {
+		printf(" -- error: accepted id:%d\n", SHOTID_IDS);
+		err = true;
+	}
+	tone[1] = tone[0];
+	if (shotid_decode(tone) >= 0) {
+		printf(" -- error: accepted a repeated tone\n");
+		err = true;
+	}
+
+#if CONFIG_IDF_TARGET_LINUX
+	printf("shotid_send() test\n");
+	{
+		const txsched_edge_t *e;
+		txsched_init(0);
+		txsched_host_clear();
+		uint64_t t0 = txsched_host_time();
+		shotid_send(2, 42, CONFIG_TX_ID_TONE*1000);
+		shotid_encode(2, 42, tone);
+		uint32_t cnt = txsched_host_edges(&e);
+		bool ok = cnt == SHOTID_TONES+1 && !e[SHOTID_TONES].freq_hz &&
+			e[SHOTID_TONES].t_us == t0 + SHOTID_TONES*CONFIG_TX_ID_TONE*1000;
+		for (uint16_t i = 0; ok && i < SHOTID_TONES; i++)
+			ok = e[i].t_us == t0 + i*CONFIG_TX_ID_TONE*1000 &&
+				e[i].freq_hz == play_freq[tone[i]];
+		if (!ok) {
+			printf(" -- error: scheduled tones\n");
+			err = true;
+		}
+		txsched_deinit();
+	}
+#endif
+
+	printf("shotid_dec_addEnergy() range and noise test, %d tones of %d ms\n",
+		SHOTID_TONES, CONFIG_TX_ID_TONE);
+	filter_init();
+	for (uint16_t ni = 0; ni < sizeof(noise_std)/sizeof(noise_std[0]); ni++) {
+		for (uint16_t ai = 0; ai < sizeof(range_amp)/sizeof(range_amp[0]); ai++) {
+			uint32_t good = 0, wrong = 0, missed = 0;
+			for (uint16_t k = 0; k < TRIALS; k++) {
+				uint16_t team = k % FILTER_CHANNELS;
+				uint16_t id = (k*37 + ai*11 + ni) % SHOTID_IDS;
+				int32_t res = si_run(team, id, range_amp[ai], noise_std[ni], k+1);
+				if (res == id) good++;
+				else if (res == -1) missed++;
+				else wrong++;
+			}
+			printf("noise:%.3f amp:%.3f correct:%3lu%% wrong:%3lu%% missed:%3lu%%\n",
+				noise_std[ni], range_amp[ai], (unsigned long)(good*100/TRIALS),
+				(unsigned long)(wrong*100/TRIALS), (unsigned long)(missed*100/TRIALS));
+			if (ni == 0 && ai == 0 && good != TRIALS) {
+				printf(" -- error: short range shots not all decoded\n");
+				err = true;
+			}
+		}
+	}
+
+	printf("******** test_shotid() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
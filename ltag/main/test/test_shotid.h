@@ -0,0 +1,7 @@
+#ifndef TEST_SHOTID_H_
+#define TEST_SHOTID_H_
+
+// Run tests of identity shots.
+void test_shotid(void);
+
+#endif // TEST_SHOTID_H_
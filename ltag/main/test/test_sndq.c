@@ -0,0 +1,271 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h> // memset
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "mixer.h"
+#include "sndq.h"
+
+#define BLOCK 64 // Samples in an I2S DMA block
+#define MAX_BLOCKS 200 // Of a run
+#define MAX_LOG 32
+#define PERCENT 100
+
+// Sounds of a few blocks, each of a constant level
+#define SOUNDS 4
+#define SOUND_BLOCKS 3
+static int16_t sound[SOUNDS][SOUND_BLOCKS*BLOCK];
+
+static mixer_t mix;
+static sndq_t sched;
+static bool no_voice; // Make play fail
+
+// Results seen by the callbacks, in order
+static struct {
+	sndq_id_t id;
+	sndq_result_t r;
+	uintptr_t tag;
+} res_log[MAX_LOG];
+static uint16_t res_n;
+static uint32_t gaps; // Blocks of silence while an event was waiting
+
+static int32_t sq_play(void *ctx, const void *audio, uint32_t size, uint32_t gain)
+{
+	if (no_voice) return MIXER_NONE;
+	return mixer_play_asset(ctx, audio, size, MIXER_S16, false, gain*MIXER_UNITY/PERCENT);
+}
+
+static void sq_stop(void *ctx, int32_t voice)
+{
+	mixer_stop(ctx, voice);
+}
+
+static bool sq_busy(void *ctx, int32_t voice)
+{
+	return mixer_busy(ctx, voice);
+}
+
+static const sndq_ops_t ops = {
+	.play = sq_play,
+	.stop = sq_stop,
+	.busy = sq_busy,
+	.ctx = &mix,
+};
+
+static void sq_done(void *arg, sndq_id_t id, sndq_result_t r)
+{
+	if (res_n == MAX_LOG) return;
+	res_log[res_n].id = id;
+	res_log[res_n].r = r;
+	res_log[res_n].tag = (uintptr_t)arg;
+	res_n++;
+}
+
+// Run the callbacks of the results, as the scheduler task does.
+static void sq_deliver(void)
+{
+	sndq_report_t res[SNDQ_RESULTS];
+	uint16_t n = sndq_results(&sched, res, SNDQ_RESULTS);
+
+	for (uint16_t i = 0; i < n; i++)
+		if (res[i].done) res[i].done(res[i].arg, res[i].id, res[i].r);
+}
+
+// Post a sound. The tag is the sound, recorded with the result.
+static sndq_id_t sq_post(uint16_t tag, uint8_t prio, sndq_policy_t policy)
+{
+	sndq_event_t e = {
+		.audio = sound[tag], .size = sizeof(sound[tag]), .gain = PERCENT,
+		.prio = prio, .policy = policy, .done = sq_done, .arg = (void *)(uintptr_t)tag,
+	};
+	sndq_id_t id = sndq_post(&sched, &e);
+	sq_deliver();
+	return id;
+}
+
+// Render blocks until the scheduler is idle, polling after each block as
+// the DMA callback wakes the scheduler task. Counts blocks of silence
+// rendered while the scheduler was busy.
+static void sq_run(void)
+{
+	int16_t blk[BLOCK];
+
+	for (uint32_t k = 0; k < MAX_BLOCKS && sndq_busy(&sched); k++) {
+		mixer_render(&mix, blk, BLOCK);
+		if (!blk[0] || !blk[BLOCK-1]) gaps++;
+		sndq_poll(&sched);
+		sq_deliver();
+	}
+}
+
+static void sq_reset(void)
+{
+	mixer_init(&mix);
+	sndq_init(&sched, &ops);
+	res_n = 0;
+	gaps = 0;
+	no_voice = false;
+}
+
+// Check the log of results against the expected tags and results.
+// Return true if they match.
+static bool sq_expect(const char *what, const uint16_t *tag, const sndq_result_t *r, uint16_t n)
+{
+	bool ok = res_n == n;
+
+	for (uint16_t i = 0; ok && i < n; i++)
+		if (res_log[i].tag != tag[i] || res_log[i].r != r[i]) ok = false;
+	if (!ok) {
+		printf(" -- error: %s, results:", what);
+		for (uint16_t i = 0; i < res_n; i++)
+			printf(" %lu:%d", (unsigned long)res_log[i].tag, res_log[i].r);
+		printf("\n");
+	}
+	return ok;
+}
+
+// Queued events play in order of priority, first in first out for the
+// same priority, with no silence in between. Return true if they do.
+static bool sq_order(void)
+{
+	static const uint16_t tag[] = {0, 2, 3, 1};
+	static const sndq_result_t r[] = {SNDQ_DONE, SNDQ_DONE, SNDQ_DONE, SNDQ_DONE};
+	bool ok;
+
+	sq_reset();
+	sq_post(0, 1, SNDQ_QUEUE); // Plays, the scheduler is idle
+	sq_post(1, 1, SNDQ_QUEUE);
+	sq_post(2, 3, SNDQ_QUEUE);
+	sq_post(3, 2, SNDQ_QUEUE);
+	sq_run();
+	ok = sq_expect("order", tag, r, 4);
+	if (gaps) {
+		printf(" -- error: %lu blocks of silence between queued events\n", (unsigned long)gaps);
+		ok = false;
+	}
+	if (ok) printf("queued events played by priority, with no gaps\n");
+	return ok;
+}
+
+// Check the preemption and drop rules.
+// Return true if they hold.
+static bool sq_preempt(void)
+{
+	static const uint16_t tag[] = {1, 3, 0, 2, 1};
+	static const sndq_result_t r[] = {
+		SNDQ_DROPPED, // 1: drop if busy
+		SNDQ_PREEMPTED, // 3: interrupted by the same priority
+		SNDQ_DONE, // 0: interrupted 3
+		SNDQ_DONE, // 2: lower priority interrupt, queued
+		SNDQ_DONE, // 1: drop if busy, played when idle
+	};
+	bool ok;
+
+	sq_reset();
+	sq_post(3, 2, SNDQ_QUEUE);
+	sq_post(2, 1, SNDQ_INTERRUPT); // Lower priority: queued
+	sq_post(1, 3, SNDQ_DROP); // Busy: dropped at once
+	if (res_n != 1 || res_log[0].r != SNDQ_DROPPED) {
+		printf(" -- error: drop if busy not reported at once\n");
+		return false;
+	}
+	sq_post(0, 2, SNDQ_INTERRUPT); // Same priority: preempts
+	sq_run();
+	sq_post(1, 3, SNDQ_DROP); // Idle: plays
+	sq_run();
+	ok = sq_expect("preemption", tag, r, 5);
+	if (ok) printf("preemption and drop rules checked\n");
+	return ok;
+}
+
+// Fill the queue, then check which events are dropped, that an event
+// with no voice is dropped, and that a flush reports each event.
+// Return true if the checks pass.
+static bool sq_full(void)
+{
+	sndq_id_t low, high;
+	bool ok = true;
+
+	sq_reset();
+	sq_post(0, 1, SNDQ_QUEUE);
+	for (uint16_t i = 0; i < SNDQ_LEN; i++) low = sq_post(1, 1, SNDQ_QUEUE);
+	sq_post(2, 1, SNDQ_QUEUE); // Full, same priority: the new one is dropped
+	high = sq_post(3, 2, SNDQ_QUEUE); // Higher priority: the last one is dropped
+	if (res_n != 2 || res_log[0].tag != 2 || res_log[0].r != SNDQ_DROPPED ||
+		res_log[1].id != low || res_log[1].r != SNDQ_DROPPED) {
+		printf(" -- error: full queue dropped the wrong events\n");
+		ok = false;
+	}
+	sndq_flush(&sched);
+	sq_deliver();
+	if (res_n != 2+1+SNDQ_LEN || res_log[2].tag != 0 || res_log[3].id != high ||
+		sndq_busy(&sched) || mixer_active(&mix)) {
+		printf(" -- error: flush\n");
+		ok = false;
+	}
+	for (uint16_t i = 2; i < res_n; i++)
+		if (res_log[i].r != SNDQ_FLUSHED) ok = false;
+
+	sq_reset();
+	no_voice = true;
+	sq_post(0, 1, SNDQ_QUEUE);
+	if (res_n != 1 || res_log[0].r != SNDQ_DROPPED || sndq_busy(&sched)) {
+		printf(" -- error: event with no voice not dropped\n");
+		ok = false;
+	}
+	if (ok) printf("full queue, no voice and flush checked\n");
+	return ok;
+}
+
+// A callback can post the next event, as a sequence of sounds.
+static void sq_chain(void *arg, sndq_id_t id, sndq_result_t r)
+{
+	uintptr_t tag = (uintptr_t)arg;
+
+	sq_done(arg, id, r);
+	if (r == SNDQ_DONE && ++tag < SOUNDS) {
+		sndq_event_t e = {
+			.audio = sound[tag], .size = sizeof(sound[tag]), .gain = PERCENT,
+			.prio = 1, .policy = SNDQ_QUEUE, .done = sq_chain, .arg = (void *)tag,
+		};
+		sndq_post(&sched, &e);
+	}
+}
+
+// Play a sequence of sounds from the callbacks.
+// Return true if all play in order.
+static bool sq_callback(void)
+{
+	static const uint16_t tag[] = {0, 1, 2, 3};
+	static const sndq_result_t r[] = {SNDQ_DONE, SNDQ_DONE, SNDQ_DONE, SNDQ_DONE};
+	sndq_event_t e = {
+		.audio = sound[0], .size = sizeof(sound[0]), .gain = PERCENT,
+		.prio = 1, .policy = SNDQ_QUEUE, .done = sq_chain, .arg = (void *)0,
+	};
+	bool ok;
+
+	sq_reset();
+	sndq_post(&sched, &e);
+	sq_run();
+	ok = sq_expect("callbacks", tag, r, SOUNDS);
+	if (ok) printf("sequence played from callbacks\n");
+	return ok;
+}
+
+void test_sndq(void)
+{
+	bool err = false;
+
+	printf("******** test_sndq() ********\n");
+	for (uint16_t s = 0; s < SOUNDS; s++)
+		for (uint32_t i = 0; i < SOUND_BLOCKS*BLOCK; i++) sound[s][i] = 1000*(s+1);
+	if (!sq_order()) err = true;
+	if (!sq_preempt()) err = true;
+	if (!sq_full()) err = true;
+	if (!sq_callback()) err = true;
+
+	printf("******** test_sndq() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_SNDQ_H_
+#define TEST_SNDQ_H_
+
+// Run tests of the sound event scheduler.
+void test_sndq(void);
+
+#endif // TEST_SNDQ_H_
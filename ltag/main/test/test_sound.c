@@ -0,0 +1,258 @@
+// Tests of the sound driver through sound.h, on the host build of the
+// driver (sound_host.h), which writes the stream to a file.
+
+#include "sdkconfig.h"
+
+#if CONFIG_IDF_TARGET_LINUX
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h> // memcmp
+
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "mixer.h"
+#include "sound.h"
+#include "sound_host.h"
+#include "bcFire.h"
+
+#define RATE 32000 // Of the c32k_16b sounds, not resampled
+#define BLOCK 64 // Samples in a DMA buffer
+#define RING 8 // Buffers of silence preloaded, DMA_DESC_NUM
+#define RAW_FILE "sound.raw"
+#define WAV_FILE "sound.wav"
+#define IDLE_MS 5000 // Max wait for the sounds to end
+#define MAX_SAMPLES (RATE*4)
+#define LOOP 1000 // Samples of the looped sound
+#define FAST_X 20 // Speed of the paced tests, times real time
+#define RACES 300 // Starts and stops in the race test
+#define STALL_US 10000 // Stall of a fill, 5 buffer periods
+
+static int16_t buf[MAX_SAMPLES];
+static int16_t ref[MAX_SAMPLES];
+static int16_t loop[LOOP];
+
+// Read the stream written by the driver.
+// Returns the number of samples.
+static uint32_t so_read(const char *path, uint32_t skip)
+{
+	FILE *f = fopen(path, "rb");
+	uint32_t n;
+
+	if (f == NULL) return 0;
+	fseek(f, skip, SEEK_SET);
+	n = fread(buf, sizeof(buf[0]), MAX_SAMPLES, f);
+	fclose(f);
+	return n;
+}
+
+// Render a sound through the mixer as the I2S driver sends it with no
+// idle time: the RING buffers of silence preloaded, then one per DMA
+// callback until the sound ends.
+// Returns the number of samples.
+static uint32_t so_ref(const void *audio, uint32_t size, uint32_t vol)
+{
+	static mixer_t mix;
+	uint32_t n = RING*BLOCK;
+
+	memset(ref, 0, n*sizeof(ref[0]));
+	mixer_init(&mix);
+	mixer_rate(&mix, RATE);
+	mixer_master(&mix, mixer_volume(vol));
+	mixer_play_asset(&mix, audio, size, MIXER_S16, false, MIXER_UNITY);
+	while (n + BLOCK <= MAX_SAMPLES && mixer_active(&mix)) {
+		mixer_next(&mix, ref + n, BLOCK, 0);
+		n += BLOCK;
+	}
+	return n;
+}
+
+// Play a sound with sound_start() and wait, as fast as the host runs, so
+// with no silence while idle, and compare the WAV file with the render of
+// the mixer.
+// Return true if they match.
+static bool so_stream(void)
+{
+	sound_host_stats_t st;
+	uint32_t n, len;
+	bool ok = true;
+
+	sound_host_output(WAV_FILE);
+	sound_host_speed(SOUND_HOST_FAST);
+	if (sound_init(RATE)) {
+		printf(" -- error: sound_init()\n");
+		return false;
+	}
+	sound_start(bcFire, sizeof(bcFire), true);
+	if (sound_busy() || !sound_host_idle(IDLE_MS)) ok = false;
+	sound_host_stats(&st);
+	sound_deinit();
+	n = so_read(WAV_FILE, 44);
+	len = so_ref(bcFire, sizeof(bcFire), 50); // Default volume
+	if (!ok || n != len || st.samples != n || st.blocks*BLOCK != n || st.starts != 1 ||
+		memcmp(buf, ref, n*sizeof(buf[0]))) {
+		printf(" -- error: stream of %lu samples, %llu sent, expecting %lu\n",
+			(unsigned long)n, (unsigned long long)st.samples, (unsigned long)len);
+		return false;
+	}
+	printf("stream of %lu samples matches the mixer, %.2f us per fill\n",
+		(unsigned long)n, st.blocks ? st.fill_sum_ns/1000.0/st.blocks : 0.0);
+	return true;
+}
+
+// Loop a sound with sound_cyclic(), then stop it. The stream must be
+// silence, the loop over and over, then silence.
+// Return true if it is.
+static bool so_cyclic(void)
+{
+	sound_host_stats_t st;
+	uint64_t start;
+	uint32_t n, i;
+
+	sound_host_output(RAW_FILE);
+	sound_host_speed(FAST_X);
+	sound_init(RATE);
+	sound_set_volume(MAX_VOL); // Samples as they are
+	sound_host_stats(&st);
+	start = st.samples;
+	sound_cyclic(loop, sizeof(loop));
+	while (sound_busy()) {
+		sound_host_stats(&st);
+		if (st.samples >= start + 3*LOOP + BLOCK) break;
+	}
+	sound_stop();
+	if (!sound_host_idle(IDLE_MS)) printf(" -- error: not idle\n");
+	sound_host_stats(&st);
+	sound_deinit();
+	n = so_read(RAW_FILE, 0);
+	for (i = 0; i < n && !buf[i]; i++);
+	uint32_t lead = i;
+	for (; i < n && buf[i] == loop[(i - lead) % LOOP]; i++);
+	uint32_t played = i - lead;
+	for (; i < n && !buf[i]; i++);
+	if (i != n || lead < RING*BLOCK || lead % BLOCK || played < 3*LOOP || st.starts != 1) {
+		printf(" -- error: %lu samples looped, %lu sent\n", (unsigned long)played, (unsigned long)n);
+		return false;
+	}
+	printf("%lu samples of silence, %lu looped, then %lu of silence\n", (unsigned long)lead,
+		(unsigned long)played, (unsigned long)(n - lead - played));
+	return true;
+}
+
+// Start and stop sounds from this thread while the DMA thread fills
+// buffers, some while it sends silence. Check that everything sent was
+// written and nothing plays after the last stop.
+// Return true if the checks pass.
+static bool so_races(void)
+{
+	sound_host_stats_t st;
+	uint64_t stop;
+	uint32_t seed = 1;
+	sound_voice_t v = MIXER_NONE;
+	bool ok = true;
+
+	sound_host_output(RAW_FILE);
+	sound_host_speed(FAST_X);
+	sound_init(RATE);
+	for (uint32_t i = 0; i < RACES; i++) {
+		seed = seed*1103515245 + 12345;
+		switch ((seed >> 16) % 4) {
+		case 0: v = sound_play(bcFire, sizeof(bcFire), false, MAX_VOL/2); break;
+		case 1: sound_voice_stop(v); break;
+		case 2: sound_stop(); break;
+		default: sound_start(loop, sizeof(loop), false); break;
+		}
+		for (uint32_t k = (seed >> 8) % 2000; k; k--) sound_busy(); // Let the fills run
+	}
+	sound_stop();
+	if (!sound_host_idle(IDLE_MS)) ok = false;
+	sound_host_stats(&st);
+	stop = st.samples;
+	while (st.samples < stop + RING*BLOCK) sound_host_stats(&st); // Some silence
+	sound_deinit();
+	sound_host_stats(&st); // All sent
+	uint32_t n = so_read(RAW_FILE, 0);
+	if (!ok || st.samples != st.blocks*BLOCK || (n < MAX_SAMPLES && n != st.samples)) ok = false;
+	for (uint32_t i = stop; i < n && n == st.samples; i++)
+		if (buf[i]) ok = false; // Silence after the last stop
+	printf("%u starts and stops, %lu sounds started, latency %lld us max, %llu samples sent\n",
+		RACES, (unsigned long)st.starts, (long long)st.lat_max_us, (unsigned long long)st.samples);
+	if (!ok) printf(" -- error: stream after the races\n");
+	return ok;
+}
+
+// Post sound events while the DMA thread runs the scheduler, and check
+// the results reported to the callbacks.
+static sndq_result_t res[4];
+static uint32_t res_n;
+
+static void so_done(void *arg, sndq_id_t id, sndq_result_t r)
+{
+	if (res_n < sizeof(res)/sizeof(res[0])) res[res_n] = r;
+	res_n++;
+}
+
+static bool so_post(void)
+{
+	static const sndq_result_t want[] = {SNDQ_DROPPED, SNDQ_PREEMPTED, SNDQ_DONE, SNDQ_DONE};
+	bool ok;
+
+	sound_host_output(NULL);
+	sound_host_speed(FAST_X);
+	sound_init(RATE);
+	res_n = 0;
+	sound_post(bcFire, sizeof(bcFire), 1, SNDQ_QUEUE, so_done, NULL);
+	sound_post(loop, sizeof(loop), 1, SNDQ_QUEUE, so_done, NULL); // After bcFire
+	sound_post(loop, sizeof(loop), 1, SNDQ_DROP, so_done, NULL); // Dropped
+	sound_post(loop, sizeof(loop), 2, SNDQ_INTERRUPT, so_done, NULL); // Cuts bcFire
+	ok = sound_host_idle(IDLE_MS);
+	sound_deinit();
+	ok = ok && res_n == 4 && !memcmp(res, want, sizeof(want));
+	if (ok) printf("sound events played from the DMA thread\n");
+	else printf(" -- error: %lu sound event results\n", (unsigned long)res_n);
+	return ok;
+}
+
+// Play in real time, and hold off one fill for several buffer periods.
+// Check that the underrun is counted.
+// Return true if it is.
+static bool so_underrun(void)
+{
+	sound_host_stats_t st;
+
+	sound_host_output(NULL);
+	sound_host_speed(SOUND_HOST_REALTIME);
+	sound_init(RATE);
+	sound_start(loop, sizeof(loop), false);
+	sound_host_stall(STALL_US);
+	sound_start(bcFire, sizeof(bcFire), true);
+	sound_host_idle(IDLE_MS);
+	sound_host_stats(&st);
+	sound_deinit();
+	printf("real time: %llu buffers, %lu underruns, latest fill %lld us, longest %lld ns\n",
+		(unsigned long long)st.blocks, (unsigned long)st.underruns,
+		(long long)st.late_max_us, (long long)st.fill_max_ns);
+	if (!st.underruns || st.late_max_us*1000 < STALL_US*1000LL/2) {
+		printf(" -- error: stall not counted as an underrun\n");
+		return false;
+	}
+	return true;
+}
+
+void test_sound(void)
+{
+	bool err = false;
+
+	printf("******** test_sound() ********\n");
+	for (uint32_t i = 0; i < LOOP; i++) loop[i] = (i*64) - 32000;
+	if (!so_stream()) err = true;
+	if (!so_cyclic()) err = true;
+	if (!so_races()) err = true;
+	if (!so_post()) err = true;
+	if (!so_underrun()) err = true;
+
+	printf("******** test_sound() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
+
+#endif
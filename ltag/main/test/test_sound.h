@@ -0,0 +1,8 @@
+#ifndef TEST_SOUND_H_
+#define TEST_SOUND_H_
+
+// Run tests of the sound driver on the host build, which writes the
+// stream to a file.
+void test_sound(void);
+
+#endif // TEST_SOUND_H_
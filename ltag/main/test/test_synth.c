@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h> // abs
+#include <string.h> // memcmp
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_cpu.h" // esp_cpu_get_cycle_count
+#endif
+
+#include "asset.h"
+#include "mixer.h"
+#include "synth.h"
+#include "sfx.h"
+#include "bcFire.h"
+#include "clipEmpty.h"
+#include "powerUp.h"
+
+#define RATE 32000
+#define BLOCK 64 // Samples in an I2S DMA block
+#define PIECE 37 // Odd piece size, not aligned with blocks or stages
+#define MAX_SAMPLES (RATE*2) // 2 s
+#define WAV_FILE "synth_%s.wav" // Render of an effect, on a host
+#define BENCH_BLOCKS 500
+
+static int16_t buf[MAX_SAMPLES];
+static int16_t alt[MAX_SAMPLES];
+
+// Test patch: 100 ms notes with every envelope stage
+static const synth_patch_t note = {
+	.wave = SYNTH_SQUARE,
+	.freq = 1000, .freq_end = 1000,
+	.attack = 10, .decay = 20, .sustain = 30, .release = 40,
+	.level = 0x4000, .volume = 0x6000,
+	.repeat = 2,
+};
+
+// Renders of the effects at RATE, FNV-1a hashes of the samples. Update
+// when a patch or the synthesizer changes on purpose, after listening to
+// the synth_*.wav files.
+static const struct {
+	const char *name;
+	const synth_asset_t *sfx;
+	uint32_t pcm; // Bytes of the samples it replaces
+	uint32_t hash;
+} effect[] = {
+	{"bcFire", &bcFireSynth, sizeof(bcFire), 0x87056ebf},
+	{"clipEmpty", &clipEmptySynth, sizeof(clipEmpty), 0xad673a9b},
+	{"powerUp", &powerUpSynth, sizeof(powerUp), 0x148abcc5},
+};
+
+// Render a patch with synth_render() in one go.
+// Returns the number of samples.
+static uint32_t sy_render(const synth_patch_t *p, int16_t *out)
+{
+	synth_state_t s;
+	uint32_t n = synth_start(&s, p, RATE);
+
+	if (n > MAX_SAMPLES) n = MAX_SAMPLES;
+	synth_render(&s, p, 0, out, n);
+	return n;
+}
+
+// Check the length, the envelope and the pieces of the test patch.
+// Return true if the checks pass.
+static bool sy_note(void)
+{
+	synth_state_t s;
+	uint32_t len = RATE/10, n = sy_render(&note, buf);
+	int32_t sus = (note.volume * note.level) >> 15, peak = 0;
+	bool ok = true;
+
+	if (n != 2*len) {
+		printf(" -- error: %lu samples, expecting %lu\n", (unsigned long)n, (unsigned long)2*len);
+		return false;
+	}
+	for (uint32_t i = 0; i < len; i++) {
+		int32_t a = abs(buf[i]);
+		if (a > peak) peak = a;
+		if (i >= RATE*30/1000 && i < RATE*60/1000 && abs(a - sus) > 1) { // Sustain
+			printf(" -- error: sample %lu is %d in the sustain, expecting %ld\n",
+				(unsigned long)i, buf[i], (long)sus);
+			ok = false;
+			break;
+		}
+	}
+	if (abs(peak - note.volume) > note.volume/100 || abs(buf[len-1]) > note.volume/100) {
+		printf(" -- error: peak %ld, end %d\n", (long)peak, buf[len-1]);
+		ok = false;
+	}
+	if (memcmp(buf, buf + len, len*sizeof(buf[0]))) {
+		printf(" -- error: notes differ\n");
+		ok = false;
+	}
+	synth_start(&s, &note, RATE);
+	for (uint32_t i = 0; i < n; i += PIECE)
+		synth_render(&s, &note, i, alt + i, (n - i < PIECE) ? n - i : PIECE);
+	if (memcmp(buf, alt, n*sizeof(buf[0]))) {
+		printf(" -- error: rendered in pieces differs\n");
+		ok = false;
+	}
+	if (ok) printf("note envelope, length and pieces checked\n");
+	return ok;
+}
+
+// Check the frequency sweep, by counting the periods of a saw, and the
+// bit-crush. Return true if the checks pass.
+static bool sy_sweep(void)
+{
+	synth_patch_t p = {
+		.wave = SYNTH_SAW, .crush = 8,
+		.freq = 1000, .freq_end = 4000,
+		.attack = 0, .decay = 0, .sustain = 500, .release = 0,
+		.level = SYNTH_UNITY, .volume = SYNTH_UNITY,
+	};
+	uint32_t n = sy_render(&p, buf), periods = 0, crushed = 0;
+	uint32_t expect = (p.freq + p.freq_end)/2 * p.sustain/1000;
+
+	for (uint32_t i = 1; i < n; i++) {
+		if (buf[i] < buf[i-1] - INT16_MAX) periods++; // Wrap of the saw
+		if (buf[i] & 0xFF) crushed++;
+	}
+	if (periods + 1 < expect || periods > expect + 1 || crushed) {
+		printf(" -- error: %lu periods, expecting %lu, %lu samples not crushed\n",
+			(unsigned long)periods, (unsigned long)expect, (unsigned long)crushed);
+		return false;
+	}
+	printf("sweep of %u to %u Hz, %lu periods\n", p.freq, p.freq_end, (unsigned long)periods);
+	return true;
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+// Write 16-bit mono samples to a WAV file.
+static void sy_wav(FILE *f, const int16_t *s, uint32_t n, uint32_t rate)
+{
+	uint32_t data = n*sizeof(s[0]);
+	uint32_t hdr[] = {
+		0x46464952, 36+data, 0x45564157, // "RIFF", size, "WAVE"
+		0x20746d66, 16, 1 | (1 << 16), rate, rate*2, 2 | (16 << 16), // "fmt " PCM mono 16-bit
+		0x61746164, data, // "data"
+	};
+	fwrite(hdr, sizeof(hdr), 1, f);
+	fwrite(s, sizeof(s[0]), n, f);
+}
+#endif
+
+// Play the effects through the mixer, as sound_start() does, and compare
+// the renders with the recorded hashes. On a host, write each render to
+// a WAV file. Return true if the hashes match.
+static bool sy_effects(void)
+{
+	static mixer_t mix;
+	bool ok = true;
+
+	for (uint32_t e = 0; e < sizeof(effect)/sizeof(effect[0]); e++) {
+		uint32_t n = 0, hash = 0x811C9DC5;
+		mixer_init(&mix);
+		mixer_rate(&mix, RATE);
+		mixer_handle_t h = mixer_play_asset(&mix, effect[e].sfx, sizeof(synth_asset_t),
+			MIXER_S16, false, MIXER_UNITY);
+		while (mixer_busy(&mix, h) && n + BLOCK <= MAX_SAMPLES) {
+			mixer_render(&mix, buf + n, BLOCK);
+			n += BLOCK;
+		}
+		n = sy_render(&effect[e].sfx->patch, alt);
+		if (h < 0 || memcmp(buf, alt, n*sizeof(buf[0]))) {
+			printf(" -- error: %s played through the mixer differs\n", effect[e].name);
+			ok = false;
+		}
+		for (uint32_t i = 0; i < n; i++) hash = (hash ^ (uint16_t)buf[i]) * 0x01000193;
+		printf("%s: %u bytes for %lu bytes of samples, %lu ms, hash %08lx\n",
+			effect[e].name, (unsigned)sizeof(synth_asset_t), (unsigned long)effect[e].pcm,
+			(unsigned long)n*1000/RATE, (unsigned long)hash);
+		if (hash != effect[e].hash) {
+			printf(" -- error: render of %s changed, expecting %08lx\n",
+				effect[e].name, (unsigned long)effect[e].hash);
+			ok = false;
+		}
+#if CONFIG_IDF_TARGET_LINUX
+		char path[64];
+		snprintf(path, sizeof(path), WAV_FILE, effect[e].name);
+		FILE *f = fopen(path, "wb");
+		if (f) {
+			sy_wav(f, buf, n, RATE);
+			fclose(f);
+		}
+#endif
+	}
+#if CONFIG_IDF_TARGET_LINUX
+	printf("effects written to " WAV_FILE "\n", "*");
+#endif
+	return ok;
+}
+
+// Time the render of a DMA block of an effect.
+static void sy_bench(void)
+{
+	static mixer_t mix;
+
+	mixer_init(&mix);
+	mixer_rate(&mix, RATE);
+	mixer_play_asset(&mix, &bcFireSynth, sizeof(bcFireSynth), MIXER_S16, true, MIXER_UNITY);
+#if CONFIG_IDF_TARGET_LINUX
+	int64_t t0 = esp_timer_get_time();
+	for (uint32_t k = 0; k < BENCH_BLOCKS; k++) mixer_render(&mix, buf, BLOCK);
+	int64_t t1 = esp_timer_get_time();
+	printf("mixer_render() %d samples of a patch: %lld ns per block\n",
+		BLOCK, (long long)(t1-t0)*1000/BENCH_BLOCKS);
+#else
+	uint32_t c0 = esp_cpu_get_cycle_count();
+	for (uint32_t k = 0; k < BENCH_BLOCKS; k++) mixer_render(&mix, buf, BLOCK);
+	uint32_t c1 = esp_cpu_get_cycle_count();
+	printf("mixer_render() %d samples of a patch: %lu cycles per block\n",
+		BLOCK, (c1-c0)/BENCH_BLOCKS);
+#endif
+}
+
+void test_synth(void)
+{
+	bool err = false;
+
+	printf("******** test_synth() ********\n");
+	if (!sy_note()) err = true;
+	if (!sy_sweep()) err = true;
+	if (!sy_effects()) err = true;
+	sy_bench();
+
+	printf("******** test_synth() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_SYNTH_H_
+#define TEST_SYNTH_H_
+
+// Run tests of the sound effect synthesizer.
+void test_synth(void);
+
+#endif // TEST_SYNTH_H_
@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "twheel.h"
+#if CONFIG_IDF_TARGET_LINUX
+#include "twheel_host.h"
+#define tw_time() twheel_host_time()
+#else
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h" // esp_timer_get_time
+#define tw_time() ((uint64_t)esp_timer_get_time())
+#endif
+
+#define TIMERS 100 // Timers running at once in the load test
+#define MAX_LATE_US (TWHEEL_TICK_US+2000) // Target: tick plus dispatch
+
+// Record of a test timer
+typedef struct {
+	twheel_timer_t t;
+	uint64_t start_us; // Time started
+	uint32_t ms; // Period
+	uint64_t fired_us; // Time of the callback, zero if not called
+	uint32_t fires; // Callbacks
+	uint32_t again; // Times to restart from the callback
+} tw_rec_t;
+
+static tw_rec_t rec[TIMERS];
+
+// Timer callback
+static void tw_cb(void *arg)
+{
+	tw_rec_t *r = arg;
+
+	r->fired_us = tw_time();
+	r->fires++;
+	if (r->again) {
+		r->again--;
+		r->start_us = r->fired_us;
+		twheel_start(&r->t, r->ms);
+	}
+}
+
+// Start a test timer.
+static void tw_start(tw_rec_t *r, uint32_t ms)
+{
+	r->start_us = tw_time();
+	r->ms = ms;
+	r->fired_us = 0;
+	twheel_start(&r->t, ms);
+}
+
+// Check that a timer fired once, not early and at most late_us late.
+// Return true if it did.
+static bool tw_check(const char *name, const tw_rec_t *r, uint32_t late_us)
+{
+	uint64_t due = r->start_us + (uint64_t)r->ms*1000;
+
+	if (r->fires == 1 && r->fired_us >= due && r->fired_us <= due + late_us &&
+		!twheel_running(&r->t))
+		return true;
+	printf(" -- error: %s fires:%lu due:%llu fired:%llu\n",
+		name, (unsigned long)r->fires, (unsigned long long)due,
+		(unsigned long long)r->fired_us);
+	return false;
+}
+
+// Initialize the test timers.
+static void tw_reset(void)
+{
+	for (uint16_t i = 0; i < TIMERS; i++) {
+		twheel_timer_init(&rec[i].t, tw_cb, &rec[i]);
+		rec[i].fires = 0;
+		rec[i].again = 0;
+	}
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+
+// Run tests of the timer service.
+// Host: on the virtual clock, check exact expiry of a timer started while
+// the wheel is idle, restart and stop, a timer longer than a wheel
+// revolution, a callback that restarts its own timer, and many timers at
+// once, each expiring within a tick after it is due.
+void test_twheel(void)
+{
+	twheel_stats_t s;
+	bool err = false;
+
+	printf("******** test_twheel() ********\n");
+	twheel_init();
+	tw_reset();
+
+	printf("twheel_start() exact expiry test\n");
+	tw_start(&rec[0], 50);
+	twheel_host_advance(50000-1);
+	if (rec[0].fires || !twheel_running(&rec[0].t)) {
+		printf(" -- error: expired early\n");
+		err = true;
+	}
+	twheel_host_advance(1);
+	err |= !tw_check("exact", &rec[0], 0);
+
+	printf("twheel_start() restart and twheel_stop() test\n");
+	tw_reset();
+	tw_start(&rec[0], 100);
+	twheel_host_advance(300); // Off the tick phase
+	tw_start(&rec[1], 100);
+	tw_start(&rec[2], 80);
+	twheel_host_advance(60000);
+	tw_start(&rec[0], 100); // Restart
+	twheel_stop(&rec[2].t);
+	twheel_host_advance(300000);
+	err |= !tw_check("restart", &rec[0], TWHEEL_TICK_US);
+	err |= !tw_check("second", &rec[1], TWHEEL_TICK_US);
+	if (rec[2].fires) {
+		printf(" -- error: stopped timer fired\n");
+		err = true;
+	}
+
+	printf("twheel_start() long timer test\n");
+	tw_reset();
+	tw_start(&rec[0], 5000); // Many wheel revolutions
+	twheel_host_advance(10000000);
+	err |= !tw_check("long", &rec[0], 0);
+
+	printf("twheel_start() from callback test\n");
+	tw_reset();
+	rec[0].again = 4;
+	uint64_t t0 = twheel_host_time();
+	tw_start(&rec[0], 30);
+	twheel_host_advance(1000000);
+	if (rec[0].fires != 5 || rec[0].fired_us != t0 + 5*30000) {
+		printf(" -- error: fires:%lu, expecting:5\n", (unsigned long)rec[0].fires);
+		err = true;
+	}
+
+	printf("twheel_start() %d timers test\n", TIMERS);
+	tw_reset();
+	twheel_stats_clear();
+	uint32_t seed = 1;
+	for (uint16_t i = 0; i < TIMERS; i++) {
+		seed = seed*1103515245 + 12345;
+		tw_start(&rec[i], 1 + (seed >> 16) % 3000);
+		twheel_host_advance(seed % 7 * 97); // Random tick phase
+	}
+	twheel_host_advance(4000000);
+	for (uint16_t i = 0; i < TIMERS; i++)
+		if (!tw_check("load", &rec[i], TWHEEL_TICK_US)) {
+			err = true;
+			break;
+		}
+	twheel_stats(&s);
+	printf("dispatched:%lu latency max:%lu us mean:%llu us\n",
+		(unsigned long)s.count, (unsigned long)s.max_us,
+		(unsigned long long)(s.count ? s.sum_us/s.count : 0));
+	if (s.count != TIMERS || s.max_us > TWHEEL_TICK_US) {
+		printf(" -- error: statistics\n");
+		err = true;
+	}
+	twheel_deinit();
+
+	printf("******** test_twheel() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
+
+#else
+
+// Run tests of the timer service.
+// Target: run many timers with random periods at once. Each must expire
+// once, not early, and within a tick plus the dispatch latency. Report
+// the dispatch latency.
+void test_twheel(void)
+{
+	twheel_stats_t s;
+	bool err = false;
+
+	printf("******** test_twheel() ********\n");
+	if (twheel_init()) {
+		printf(" -- error: twheel_init\n");
+		err = true;
+		goto tw_end;
+	}
+	tw_reset();
+
+	printf("twheel_start() %d timers test\n", TIMERS);
+	twheel_stats_clear();
+	uint32_t seed = 1;
+	for (uint16_t i = 0; i < TIMERS; i++) {
+		seed = seed*1103515245 + 12345;
+		tw_start(&rec[i], 1 + (seed >> 16) % 1000);
+	}
+	vTaskDelay(pdMS_TO_TICKS(1500));
+	for (uint16_t i = 0; i < TIMERS; i++)
+		if (!tw_check("load", &rec[i], MAX_LATE_US)) {
+			err = true;
+			break;
+		}
+	twheel_stats(&s);
+	printf("dispatched:%lu latency max:%lu us mean:%llu us\n",
+		(unsigned long)s.count, (unsigned long)s.max_us,
+		(unsigned long long)(s.count ? s.sum_us/s.count : 0));
+
+tw_end:
+	printf("******** test_twheel() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
+
+#endif
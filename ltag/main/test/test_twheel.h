@@ -0,0 +1,7 @@
+#ifndef TEST_TWHEEL_H_
+#define TEST_TWHEEL_H_
+
+// Run tests of the timer service.
+void test_twheel(void);
+
+#endif // TEST_TWHEEL_H_
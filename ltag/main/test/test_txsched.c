@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+
+#include "config.h" // CONFIG_*
+#include "txsched.h"
+#if CONFIG_IDF_TARGET_LINUX
+#include "txsched_host.h"
+#else
+#include "hw.h" // HW_LTAG_TX
+#endif
+
+#define FREQ_A 1471 // Hz, player 0
+#define FREQ_B 3333 // Hz, player 6
+#define SHOT_ON 50000 // us, burst shot on time
+#define SHOT_OFF 100000 // us, burst shot off time
+#define SHOTS 3 // Shots in a burst
+#define QUEUE_MAX_US 100 // Max time for txsched_queue() to return
+
+#if CONFIG_IDF_TARGET_LINUX
+
+// Compare the recorded edges to the expected ones.
+// Return true if they match.
+static bool ts_edges(const txsched_edge_t *exp, uint32_t n)
+{
+	const txsched_edge_t *e;
+	uint32_t cnt = txsched_host_edges(&e);
+	bool ok = cnt == n;
+
+	for (uint32_t i = 0; ok && i < n; i++)
+		ok = e[i].t_us == exp[i].t_us && e[i].freq_hz == exp[i].freq_hz;
+	if (!ok) {
+		printf(" -- error: edges:%lu, expecting:%lu\n", (unsigned long)cnt, (unsigned long)n);
+		for (uint32_t i = 0; i < cnt; i++)
+			printf("    %llu us: %lu Hz\n", (unsigned long long)e[i].t_us,
+				(unsigned long)e[i].freq_hz);
+	}
+	return ok;
+}
+
+#endif
+
+// Run tests of the transmit scheduler.
+// Host: check the recorded waveform edge by edge for a burst, back to back
+// segments, a full queue, a cancel during the on time, and a coded burst.
+// Target: check that queueing does not block and that the schedule plays
+// for its total duration.
+void test_txsched(void)
+{
+	txsched_seg_t burst[SHOTS];
+	bool err = false;
+
+	printf("******** test_txsched() ********\n");
+	for (uint16_t i = 0; i < SHOTS; i++)
+		burst[i] = (txsched_seg_t){FREQ_A, SHOT_ON, SHOT_OFF};
+
+#if CONFIG_IDF_TARGET_LINUX
+	txsched_init(0);
+	const uint64_t t0 = txsched_host_time();
+
+	printf("txsched_queue() burst test\n");
+	txsched_host_clear();
+	if (txsched_queue(burst, SHOTS)) {
+		printf(" -- error: queue\n");
+		err = true;
+	}
+	txsched_edge_t exp_burst[2*SHOTS];
+	for (uint16_t i = 0; i < SHOTS; i++) {
+		exp_burst[2*i] = (txsched_edge_t){t0 + i*(SHOT_ON+SHOT_OFF), FREQ_A};
+		exp_burst[2*i+1] = (txsched_edge_t){t0 + i*(SHOT_ON+SHOT_OFF) + SHOT_ON, 0};
+	}
+	err |= !ts_edges(exp_burst, 2*SHOTS);
+	txsched_host_advance(SHOTS*(SHOT_ON+SHOT_OFF) - 1);
+	if (!txsched_busy()) {
+		printf(" -- error: idle before the last off time ended\n");
+		err = true;
+	}
+	txsched_host_advance(1);
+	if (txsched_busy() || txsched_room() != TXSCHED_QUEUE) {
+		printf(" -- error: busy after the burst, room:%u\n", txsched_room());
+		err = true;
+	}
+
+	printf("txsched_queue() back to back test\n");
+	const uint64_t t1 = txsched_host_time();
+	txsched_host_clear();
+	txsched_seg_t b2b[3] = {
+		{FREQ_A, 1000, 0}, // Runs into the next segment
+		{FREQ_B, 2000, 0}, // Changes frequency without a gap
+		{FREQ_B, 500, 250},
+	};
+	txsched_queue(b2b, 3);
+	txsched_host_advance(1500);
+	txsched_queue(burst, 1); // Starts after the queued segments
+	const txsched_edge_t exp_b2b[] = {
+		{t1, FREQ_A},
+		{t1 + 1000, FREQ_B},
+		{t1 + 3500, 0},
+		{t1 + 3750, FREQ_A},
+		{t1 + 3750 + SHOT_ON, 0},
+	};
+	err |= !ts_edges(exp_b2b, sizeof(exp_b2b)/sizeof(exp_b2b[0]));
+	txsched_host_advance(3750 + SHOT_ON + SHOT_OFF);
+
+	printf("txsched_queue() full queue test\n");
+	txsched_seg_t one = {FREQ_A, 10, 10};
+	for (uint16_t i = 0; i < TXSCHED_QUEUE - 1; i++) txsched_queue(&one, 1);
+	if (!txsched_queue(burst, 2) || txsched_room() != 1) {
+		printf(" -- error: partial queue accepted, room:%u\n", txsched_room());
+		err = true;
+	}
+	txsched_host_advance(20);
+	if (txsched_queue(burst, 2)) {
+		printf(" -- error: queue rejected after a segment ended\n");
+		err = true;
+	}
+
+	printf("txsched_cancel() test\n");
+	txsched_cancel();
+	txsched_host_clear();
+	const uint64_t t2 = txsched_host_time();
+	txsched_queue(burst, SHOTS);
+	txsched_host_advance(SHOT_ON/2);
+	txsched_cancel();
+	const txsched_edge_t exp_cancel[] = {
+		{t2, FREQ_A},
+		{t2 + SHOT_ON/2, 0},
+	};
+	err |= !ts_edges(exp_cancel, 2);
+	if (txsched_busy()) {
+		printf(" -- error: busy after cancel\n");
+		err = true;
+	}
+
+	printf("txsched_code() test\n");
+	txsched_host_clear();
+	const uint64_t t3 = txsched_host_time();
+	txsched_code(FREQ_B, CONFIG_TX_CODE, CONFIG_TX_CODE_CHIPS, CONFIG_TX_CHIP);
+	const txsched_edge_t *e;
+	uint32_t cnt = txsched_host_edges(&e);
+	bool prev = false;
+	uint32_t k = 0;
+	for (uint16_t i = 0; i < CONFIG_TX_CODE_CHIPS; i++) {
+		bool chip = CONFIG_TX_CODE >> (CONFIG_TX_CODE_CHIPS-1-i) & 1;
+		uint64_t t = t3 + (uint64_t)i*CONFIG_TX_CHIP;
+		if (chip != prev) {
+			if (k >= cnt || e[k].t_us != t || e[k].freq_hz != (chip ? FREQ_B : 0)) {
+				printf(" -- error: chip:%u edge missing at %llu us\n", i, (unsigned long long)t);
+				err = true;
+				break;
+			}
+			k++;
+			prev = chip;
+		}
+	}
+	txsched_host_advance((uint32_t)CONFIG_TX_CODE_CHIPS*CONFIG_TX_CHIP);
+	txsched_deinit();
+#else
+	int64_t tbeg, tend, tq;
+
+	printf("txsched_queue() burst test\n");
+	if (txsched_init(HW_LTAG_TX)) {
+		printf(" -- error: txsched_init()\n");
+		err = true;
+		goto tts_end;
+	}
+	tbeg = esp_timer_get_time();
+	if (txsched_queue(burst, SHOTS)) {
+		printf(" -- error: queue\n");
+		err = true;
+	}
+	tq = esp_timer_get_time() - tbeg;
+	if (tq > QUEUE_MAX_US) {
+		printf(" -- error: txsched_queue() took:%lld us\n", tq);
+		err = true;
+	}
+	while (txsched_busy()) ;
+	tend = esp_timer_get_time();
+	int64_t total = SHOTS*(SHOT_ON+SHOT_OFF);
+	printf("queue:%lld us, burst:%lld us, expecting:%lld us\n", tq, tend - tbeg, total);
+	if (tend - tbeg < total || tend - tbeg > total + 1000) {
+		printf(" -- error: burst duration\n");
+		err = true;
+	}
+	txsched_deinit();
+tts_end:
+#endif
+
+	printf("******** test_txsched() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
@@ -0,0 +1,7 @@
+#ifndef TEST_TXSCHED_H_
+#define TEST_TXSCHED_H_
+
+// Run tests of the transmit scheduler.
+void test_txsched(void);
+
+#endif // TEST_TXSCHED_H_
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "esp_log.h" // LOG_COLOR_*
+
+#include "chansim.h"
+#include "config.h" // CONFIG_*
+#include "filter.h"
+#include "unit.h"
+
+#define ADC_BITS 12
+#define TEAM CONFIG_GAME_TEAM_A
+#define FOE CONFIG_GAME_TEAM_B
+#define SHOT_MS 1000 // Start of the foe shot
+#define PRESS_MS 1500 // Trigger press
+#define RUN_MS 3000
+
+static const uint16_t play_freq[FILTER_CHANNELS] = CONFIG_PLAY_FREQ;
+
+static uint32_t log_lines;
+static uint64_t hit_us; // Time of the first counted hit
+
+// Count log lines and record the first hit.
+static void un_log(void *ctx, const unit_t *u, const char *msg)
+{
+	log_lines++;
+	if (!hit_us && msg[0] == 'h') hit_us = u->now_us;
+}
+
+// Run one unit for RUN_MS with one foe shot and one trigger press with
+// bounces. Record the time the unit starts and stops emitting.
+static void un_run(unit_t *u, uint64_t *tx_on, uint64_t *tx_off)
+{
+	static rx_data_t buf[CONFIG_RX_FRAME];
+	chansim_t c;
+	uint32_t cnt;
+	uint16_t ch;
+
+	chansim_init(&c, CONFIG_RX_SAMPLE_RATE, ADC_BITS);
+	c.noise = 0.01f;
+	c.length = (uint64_t)RUN_MS * CONFIG_RX_SAMPLE_RATE / 1000;
+	chansim_shooter_t s = {
+		.freq_hz = play_freq[FOE],
+		.amp = 0.02f,
+		.start_us = SHOT_MS*1000,
+		.pulse_us = CONFIG_TX_PULSE*1000,
+	};
+	chansim_addShooter(&c, &s);
+	log_lines = 0;
+	hit_us = 0;
+	*tx_on = *tx_off = 0;
+	unit_init(u, 0, TEAM, un_log, NULL);
+	while ((cnt = chansim_generate(buf, CONFIG_RX_SAMPLE_RATE/1000, &c))) { // 1 ms
+		uint64_t ms = u->samples * 1000 / CONFIG_RX_SAMPLE_RATE;
+		if (ms == PRESS_MS || ms == PRESS_MS+2) unit_trigger(u, true);
+		if (ms == PRESS_MS+1 || ms == PRESS_MS+100) unit_trigger(u, false);
+		unit_step(u, buf, cnt);
+		bool on = unit_emitting(u, &ch) && ch == TEAM;
+		if (on && !*tx_on) *tx_on = u->now_us;
+		if (!on && *tx_on && !*tx_off) *tx_off = u->now_us;
+	}
+	unit_free(u);
+}
+
+// Run tests of the simulated tag unit (unit.h). A unit receives one shot
+// from a foe and its trigger is pressed once with a bounce.
+// - The shot is detected once and counts as one hit, after the shot
+//   started and before it ended.
+// - The press fires one shot after the debounce settle time, emitting on
+//   the team channel for the pulse length.
+// - A second run gives the same log.
+void test_unit(void)
+{
+	static unit_t u;
+	uint64_t on, off;
+	bool err = false;
+
+	printf("******** test_unit() ********\n");
+	filter_init(); // Coefficients shared by all instances
+
+	un_run(&u, &on, &off);
+	printf("hit at %llu us, emitting %llu to %llu us, %lu log lines\n",
+		(unsigned long long)hit_us, (unsigned long long)on, (unsigned long long)off,
+		(unsigned long)log_lines);
+	if (u.detected != 1 || u.game.taken != 1 || hit_us <= SHOT_MS*1000 ||
+		hit_us > (SHOT_MS + CONFIG_TX_PULSE)*1000) {
+		printf(" -- error: detected:%lu taken:%lu\n", (unsigned long)u.detected,
+			(unsigned long)u.game.taken);
+		err = true;
+	}
+	uint64_t settle = (PRESS_MS + 2 + CONFIG_TRIGGER_SETTLE)*1000;
+	if (u.game.fired != 1 || on < settle || on > settle + 1000 ||
+		off - on < CONFIG_TX_PULSE*1000 || off - on > CONFIG_TX_PULSE*1000 + 1000) {
+		printf(" -- error: fired:%lu\n", (unsigned long)u.game.fired);
+		err = true;
+	}
+
+	uint32_t lines = log_lines;
+	uint64_t first = hit_us;
+	un_run(&u, &on, &off);
+	if (log_lines != lines || hit_us != first) {
+		printf(" -- error: second run differs\n");
+		err = true;
+	}
+
+	printf("******** test_unit() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
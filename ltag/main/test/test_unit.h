@@ -0,0 +1,7 @@
+#ifndef TEST_UNIT_H_
+#define TEST_UNIT_H_
+
+// Run tests of the simulated tag unit.
+void test_unit(void);
+
+#endif // TEST_UNIT_H_
@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h> // abs
+#include <math.h> // log10
+
+#include "sdkconfig.h"
+#include "esp_log.h" // LOG_COLOR_*
+#include "esp_timer.h" // esp_timer_get_time
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_cpu.h" // esp_cpu_get_cycle_count
+#endif
+
+#include "mixer.h"
+
+#define AMP 16384 // Of the test sound, half scale
+#define LEN 100 // Samples of the test sound, looped
+#define BLOCK 64 // Samples in an I2S DMA block
+#define SAMPLES 2048 // Rendered in a test
+#define CHANGE 1000 // Sample where the gain changes
+#define BENCH_BLOCKS 500
+
+static int16_t dc[LEN];
+static int16_t out[SAMPLES];
+
+// Check the volume table: silent at zero, a gain of one at the top,
+// rising, and MIXER_VOLUME_DB below the top at one step above zero.
+// Return true if the checks pass.
+static bool vo_table(void)
+{
+	static mixer_t mix;
+	double mid, low;
+	bool ok;
+
+	mixer_init(&mix); // Builds the table
+	mid = 20.0*log10((double)mixer_volume(MIXER_VOLUME_MAX/2) / MIXER_UNITY);
+	low = 20.0*log10((double)mixer_volume(1) / MIXER_UNITY);
+	ok = mixer_volume(0) == 0 && mixer_volume(MIXER_VOLUME_MAX) == MIXER_UNITY &&
+		mixer_volume(MIXER_VOLUME_MAX+1) == MIXER_UNITY;
+
+	for (uint32_t i = 1; i <= MIXER_VOLUME_MAX; i++)
+		if (mixer_volume(i) <= mixer_volume(i-1)) ok = false;
+	if (fabs(mid + MIXER_VOLUME_DB/2.0) > 0.1 || fabs(low + MIXER_VOLUME_DB) > 0.5) ok = false;
+	printf("volume %u: %.1f dB, volume 1: %.1f dB\n", MIXER_VOLUME_MAX/2, mid, low);
+	if (!ok) printf(" -- error: volume table\n");
+	return ok;
+}
+
+// Render a constant sound in pieces, and change the gain at sample
+// CHANGE, as sound_set_volume() or sound_voice_gain() do between two DMA
+// callbacks. With two voices, the sum goes through the accumulator.
+// Check that no step between samples is more than a ramp step, and that
+// the level after the ramp is exact.
+// Return true if the checks pass.
+static bool vo_ramp(uint32_t piece, bool two, bool master)
+{
+	static mixer_t mix;
+	uint32_t g0 = MIXER_UNITY, g1 = mixer_volume(MIXER_VOLUME_MAX/4);
+	uint32_t gain = two ? MIXER_UNITY/2 : MIXER_UNITY, n = 0;
+	int32_t amp = (two && !master) ? AMP/2 : AMP, step = 0, end = 0, lim;
+	bool ok = true;
+
+	mixer_init(&mix);
+	mixer_handle_t h = mixer_play(&mix, dc, LEN, MIXER_S16, true, gain);
+	if (two) mixer_play(&mix, dc, LEN, MIXER_S16, true, gain);
+	while (n < SAMPLES) {
+		uint32_t cnt = (SAMPLES - n < piece) ? SAMPLES - n : piece;
+		if (n <= CHANGE && n + cnt > CHANGE) { // Change at the start of the piece
+			if (master) mixer_master(&mix, g1);
+			else mixer_gain(&mix, h, (gain*g1) >> 15);
+		}
+		mixer_render(&mix, out + n, cnt);
+		n += cnt;
+	}
+	for (uint32_t i = 1; i < SAMPLES; i++)
+		if (abs(out[i] - out[i-1]) > step) step = abs(out[i] - out[i-1]);
+	for (uint32_t j = 0; j < (two ? 2 : 1); j++) { // Level of each voice after the ramp
+		uint32_t g = (master || j) ? gain : (gain*g1) >> 15;
+		end += (AMP*(int32_t)((g * (master ? g1 : MIXER_UNITY)) >> 15)) >> 15;
+	}
+	lim = (amp*(int32_t)(g0 - g1)/(int32_t)MIXER_UNITY + MIXER_RAMP-1)/MIXER_RAMP + 2;
+	if (step > lim || out[SAMPLES-1] != end) {
+		printf(" -- error: pieces of %lu, %s voice%s, %s gain: step %ld over %ld, or end %d not %ld\n",
+			(unsigned long)piece, two ? "two" : "one", two ? "s" : "",
+			master ? "master" : "voice", (long)step, (long)lim, out[SAMPLES-1], (long)end);
+		ok = false;
+	}
+	return ok;
+}
+
+// Check the ramps in pieces of one sample (the one-shot DAC), an odd
+// size, and a DMA block, for the master and a voice gain.
+// Return true if the checks pass.
+static bool vo_ramps(void)
+{
+	static const uint32_t piece[] = {1, 37, BLOCK};
+	bool ok = true;
+
+	for (uint32_t i = 0; i < sizeof(piece)/sizeof(piece[0]); i++)
+		for (uint32_t t = 0; t < 4; t++)
+			if (!vo_ramp(piece[i], t & 1, t & 2)) ok = false;
+	if (ok) printf("gain changes ramp over %u samples, with no step\n", MIXER_RAMP);
+	return ok;
+}
+
+// Time mixer_fill() of a DMA block with a steady gain, and with the
+// master gain changed before each block, so each one ramps.
+static void vo_bench(void)
+{
+	static mixer_t mix;
+	static const char *name[] = {"steady", "ramped"};
+	volatile uint32_t tail = 0;
+
+	for (uint32_t t = 0; t < 2; t++) {
+		mixer_init(&mix);
+		mixer_play(&mix, dc, LEN, MIXER_S16, true, MIXER_UNITY/2);
+		mixer_play(&mix, dc, LEN, MIXER_S16, true, MIXER_UNITY/2);
+#if CONFIG_IDF_TARGET_LINUX
+		int64_t t0 = esp_timer_get_time();
+		for (uint32_t k = 0; k < BENCH_BLOCKS; k++) {
+			if (t) mixer_master(&mix, mixer_volume(MIXER_VOLUME_MAX - (k & 1)));
+			mixer_fill(&mix, &tail, out, BLOCK);
+		}
+		int64_t t1 = esp_timer_get_time();
+		printf("mixer_fill() %d samples of two voices, %s: %lld ns per block\n",
+			BLOCK, name[t], (long long)(t1-t0)*1000/BENCH_BLOCKS);
+#else
+		uint32_t c0 = esp_cpu_get_cycle_count();
+		for (uint32_t k = 0; k < BENCH_BLOCKS; k++) {
+			if (t) mixer_master(&mix, mixer_volume(MIXER_VOLUME_MAX - (k & 1)));
+			mixer_fill(&mix, &tail, out, BLOCK);
+		}
+		uint32_t c1 = esp_cpu_get_cycle_count();
+		printf("mixer_fill() %d samples of two voices, %s: %lu cycles per block\n",
+			BLOCK, name[t], (c1-c0)/BENCH_BLOCKS);
+#endif
+	}
+}
+
+void test_volume(void)
+{
+	bool err = false;
+
+	printf("******** test_volume() ********\n");
+	for (uint32_t i = 0; i < LEN; i++) dc[i] = AMP;
+	if (!vo_table()) err = true;
+	if (!vo_ramps()) err = true;
+	vo_bench();
+
+	printf("******** test_volume() %s ********\n\n",
+		err ? LOG_COLOR_E "Error" LOG_RESET_COLOR : "Done");
+}
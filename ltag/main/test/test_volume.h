@@ -0,0 +1,7 @@
+#ifndef TEST_VOLUME_H_
+#define TEST_VOLUME_H_
+
+// Run tests of the volume curve and the gain ramps of the mixer.
+void test_volume(void);
+
+#endif // TEST_VOLUME_H_
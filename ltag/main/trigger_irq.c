@@ -0,0 +1,154 @@
+// Interrupt-driven implementation of trigger.h. Select it instead of the
+// polled trigger.c with TRIGGER "irq" in CMakeLists.txt.
+//
+// A GPIO interrupt on both edges timestamps each edge and feeds the
+// debounce state machine (debounce.h), which asks for a one-shot esp_timer
+// at the end of the settle time. The timer callback runs in the esp_timer
+// task, not in an ISR, and calls the pressed and released callbacks from
+// there. Nothing runs while the trigger is idle, so trigger_tick() does
+// nothing and the tick period given to trigger_init() is not used.
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/peripherals/gpio.html
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/system/esp_timer.html
+
+#include "freertos/FreeRTOS.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "config.h" // CONFIG_TRIGGER_SETTLE
+#include "debounce.h"
+#include "trigger.h"
+
+#define TRIGGER_ACTIVE 0 // The trigger pulls the pin low when pressed
+
+static const char *TAG = "trigger";
+
+// Critical section protected variables
+static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+static debounce_t deb;
+
+// Other global variables
+static int32_t pin = -1;
+static esp_timer_handle_t timer;
+static volatile bool enabled;
+static void (*pressed_cb)(void);
+static void (*released_cb)(void);
+
+// Return true if the trigger is pressed. Safe to call from an ISR.
+static bool IRAM_ATTR trigger_level(void)
+{
+	return gpio_get_level(pin) == TRIGGER_ACTIVE;
+}
+
+// Start the one-shot timer to expire at a time in microseconds.
+static void trigger_arm(int64_t due_us)
+{
+	int64_t dt = due_us - esp_timer_get_time();
+	esp_timer_start_once(timer, dt > 0 ? dt : 0);
+}
+
+// Called on both edges of the trigger pin.
+static void IRAM_ATTR trigger_isr(void *arg)
+{
+	int64_t now = esp_timer_get_time();
+	bool arm;
+
+	portENTER_CRITICAL_ISR(&spinlock);
+	arm = debounce_edge(&deb, trigger_level(), now);
+	portEXIT_CRITICAL_ISR(&spinlock);
+	if (arm) esp_timer_start_once(timer, CONFIG_TRIGGER_SETTLE*1000);
+}
+
+// Called in the esp_timer task at the end of the settle time.
+static void trigger_expire(void *arg)
+{
+	debounce_event_t e;
+	bool arm;
+	int64_t due;
+
+	portENTER_CRITICAL(&spinlock);
+	e = debounce_expire(&deb, trigger_level(), esp_timer_get_time());
+	arm = deb.armed;
+	due = deb.due_us;
+	portEXIT_CRITICAL(&spinlock);
+	if (arm) trigger_arm(due);
+	if (!enabled) return;
+	if (e == DEBOUNCE_PRESSED && pressed_cb) pressed_cb();
+	else if (e == DEBOUNCE_RELEASED && released_cb) released_cb();
+}
+
+// Configure the pin for an interrupt on both edges and install the ISR.
+// Return zero if successful, or non-zero otherwise.
+static int32_t trigger_gpio(void)
+{
+	esp_err_t err;
+	gpio_config_t io_conf = {
+		.pin_bit_mask = 1ULL << pin,
+		.mode = GPIO_MODE_INPUT,
+		.pull_up_en = GPIO_PULLUP_ENABLE,
+		.pull_down_en = GPIO_PULLDOWN_DISABLE,
+		.intr_type = GPIO_INTR_ANYEDGE, // Also enables the pin interrupt
+	};
+
+	if ((err = gpio_config(&io_conf))) {
+		ESP_LOGE(TAG, "gpio_config failed: %s", esp_err_to_name(err));
+		return -1;
+	}
+	debounce_init(&deb, CONFIG_TRIGGER_SETTLE*1000, trigger_level());
+	err = gpio_install_isr_service(0);
+	if (err && err != ESP_ERR_INVALID_STATE) { // Already installed is fine
+		ESP_LOGE(TAG, "gpio_install_isr_service failed: %s", esp_err_to_name(err));
+		return -1;
+	}
+	if ((err = gpio_isr_handler_add(pin, trigger_isr, NULL))) {
+		ESP_LOGE(TAG, "gpio_isr_handler_add failed: %s", esp_err_to_name(err));
+		return -1;
+	}
+	return 0;
+}
+
+int32_t trigger_init(uint32_t period, int32_t gpio_num)
+{
+	esp_err_t err;
+
+	if (pin >= 0) return 0; // Already initialized
+	pin = gpio_num;
+	enabled = false;
+	const esp_timer_create_args_t targs = {
+		.callback = trigger_expire,
+		.dispatch_method = ESP_TIMER_TASK,
+		.name = "trigger",
+	};
+	if ((err = esp_timer_create(&targs, &timer))) {
+		ESP_LOGE(TAG, "esp_timer_create failed: %s", esp_err_to_name(err));
+		pin = -1;
+		return -1;
+	}
+	if (trigger_gpio()) { // Not initialized, so a later call tries again
+		gpio_intr_disable(pin);
+		esp_timer_delete(timer);
+		pin = -1;
+		return -1;
+	}
+	return 0;
+}
+
+void trigger_tick(void)
+{
+	// Edges and the debounce timer drive the trigger.
+}
+
+void trigger_register_pressed(void (*pressed)(void))
+{
+	pressed_cb = pressed;
+}
+
+void trigger_register_released(void (*released)(void))
+{
+	released_cb = released;
+}
+
+void trigger_operation(bool enable)
+{
+	enabled = enable;
+}
@@ -5,7 +5,8 @@
 #include <stdint.h>
 
 // The transmitter generates a square-wave output on a GPIO pin at a user
-// specified frequency. The GPIO pin is selected at initialization.
+// specified frequency. The GPIO pin is selected at initialization. For
+// bursts and coded shots played without blocking, see txsched.h.
 
 // Initialize the transmitter driver.
 // gpio_num: GPIO pin number.
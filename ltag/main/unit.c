@@ -0,0 +1,202 @@
+#include <stdio.h> // snprintf
+
+#include "unit.h"
+
+// Samples to fill the energy window. Hits are ignored until then, because
+// the energies of a window that is still filling are not comparable.
+#define UNIT_WARMUP ((uint64_t)FILTER_FIR_DECIMATION_FACTOR*FILTER_ENERGY_SAMPLE_COUNT)
+#define LOG_WHAT (UNIT_LOG/2) // Max length of the event in a game state message
+
+static const char *sound_name[GCORE_SNDS] = {
+	[GCORE_SND_START] = "start",
+	[GCORE_SND_SHOT] = "shot",
+	[GCORE_SND_EMPTY] = "empty",
+	[GCORE_SND_RELOAD] = "reload",
+	[GCORE_SND_HIT] = "hit",
+	[GCORE_SND_LIFE] = "life lost",
+	[GCORE_SND_OVER] = "game over",
+	[GCORE_SND_BASE] = "return to base",
+};
+
+static const char *state_name[] = {
+	[GCORE_PLAY] = "play",
+	[GCORE_INVINCIBLE] = "invincible",
+	[GCORE_OVER] = "over",
+};
+
+// Send a message with the game state to the log.
+static void unit_log(unit_t *u, const char *what)
+{
+	char msg[UNIT_LOG];
+
+	if (u->log == NULL) return;
+	snprintf(msg, sizeof(msg), "%.*s lives:%u hits:%u shots:%u", LOG_WHAT, what,
+		u->game.lives, u->game.hits, u->game.shots);
+	u->log(u->logCtx, u, msg);
+}
+
+static void unit_shoot(void *ctx, uint16_t chan)
+{
+	unit_t *u = ctx;
+
+	u->txChan = chan;
+	u->txStart_us = u->now_us;
+	u->txEnd_us = u->now_us + CONFIG_TX_PULSE*1000;
+}
+
+static void unit_timer(void *ctx, gcore_timer_t id, uint32_t ms, uint32_t gen)
+{
+	unit_t *u = ctx;
+
+	u->armed[id] = ms != 0;
+	u->due_us[id] = u->now_us + (uint64_t)ms*1000;
+	u->gen[id] = gen;
+}
+
+static void unit_sound(void *ctx, gcore_sound_t snd)
+{
+	unit_log(ctx, sound_name[snd]);
+}
+
+static void unit_led(void *ctx, bool on)
+{
+	((unit_t *)ctx)->led = on;
+}
+
+void unit_init(unit_t *u, uint16_t id, uint16_t team, unit_log_t log, void *ctx)
+{
+	bool chan[FILTER_CHANNELS];
+	uint32_t mask = 0;
+
+	u->id = id;
+	u->samples = 0;
+	u->now_us = 0;
+	for (uint16_t i = 0; i < GCORE_TIMERS; i++) u->armed[i] = false;
+	debounce_init(&u->trigger, CONFIG_TRIGGER_SETTLE*1000, false);
+	u->level = false;
+	u->qhead = u->qcount = 0;
+	u->dropped = 0;
+	u->txChan = team;
+	u->txStart_us = u->txEnd_us = 0;
+	u->led = false;
+	u->detected = 0;
+	u->log = log;
+	u->logCtx = ctx;
+
+	u->filter = filter_ctx_init();
+	u->detector = detector_ctx_init(u->filter);
+	for (uint16_t i = 0; i < FILTER_CHANNELS; i++) {
+		chan[i] = i != team;
+		if (chan[i]) mask |= 1UL << i;
+	}
+	detector_ctx_setChannels(u->detector, chan);
+
+	u->ops = (gcore_ops_t){unit_shoot, unit_timer, unit_sound, unit_led, u};
+	gcore_init(&u->game, &u->ops, team, mask);
+}
+
+void unit_free(unit_t *u)
+{
+	detector_ctx_free(u->detector);
+	filter_ctx_free(u->filter);
+}
+
+void unit_trigger(unit_t *u, bool pressed)
+{
+	u->level = pressed;
+	debounce_edge(&u->trigger, pressed, u->now_us);
+}
+
+int32_t unit_post(unit_t *u, gevent_type_t type, uint16_t arg, uint32_t data)
+{
+	if (u->qcount == UNIT_QUEUE) {
+		u->dropped++;
+		return -1;
+	}
+	u->q[(u->qhead + u->qcount++) % UNIT_QUEUE] =
+		(gevent_t){type, arg, data, (int64_t)u->now_us};
+	return 0;
+}
+
+// Post the expiries due by now, oldest first, then hand the queued events
+// to the game core.
+static void unit_due(unit_t *u)
+{
+	for (;;) {
+		int16_t id = -1;
+		for (uint16_t i = 0; i < GCORE_TIMERS; i++)
+			if (u->armed[i] && u->due_us[i] <= u->now_us &&
+				(id < 0 || u->due_us[i] < u->due_us[id]))
+				id = i;
+		if (id < 0) break;
+		u->armed[id] = false;
+		unit_post(u, GEVENT_TIMER, id, u->gen[id]);
+	}
+	if (u->trigger.armed && u->trigger.due_us <= (int64_t)u->now_us) {
+		debounce_event_t e = debounce_expire(&u->trigger, u->level, u->now_us);
+		if (e == DEBOUNCE_PRESSED) unit_post(u, GEVENT_TRIGGER_PRESSED, 0, 0);
+		else if (e == DEBOUNCE_RELEASED) unit_post(u, GEVENT_TRIGGER_RELEASED, 0, 0);
+	}
+	while (u->qcount) {
+		gevent_t e = u->q[u->qhead];
+		u->qhead = (u->qhead + 1) % UNIT_QUEUE;
+		u->qcount--;
+		gcore_state_t prev = u->game.state;
+		gcore_event(&u->game, &e);
+		if (u->game.state != prev && u->game.state != GCORE_OVER)
+			unit_log(u, state_name[u->game.state]);
+	}
+	// Like lockoutTimer on the target, only one hit per lockout period
+	// gets to the game, and none while it ignores hits.
+	detector_ctx_ignoreAllHits(u->detector, u->samples < UNIT_WARMUP ||
+		u->game.locked || u->game.state != GCORE_PLAY);
+}
+
+// Return the index of the first sample at or after the next due time, or
+// UINT64_MAX if nothing is due.
+static uint64_t unit_next(const unit_t *u)
+{
+	uint64_t due = UINT64_MAX;
+
+	for (uint16_t i = 0; i < GCORE_TIMERS; i++)
+		if (u->armed[i] && u->due_us[i] < due) due = u->due_us[i];
+	if (u->trigger.armed && (uint64_t)u->trigger.due_us < due)
+		due = u->trigger.due_us;
+	if (due == UINT64_MAX) return due;
+	return (due * CONFIG_RX_SAMPLE_RATE + 999999) / 1000000;
+}
+
+void unit_step(unit_t *u, const rx_data_t *blk, uint32_t count)
+{
+	uint32_t i = 0;
+
+	unit_due(u);
+	while (i < count) {
+		uint32_t n = count - i;
+		uint64_t next = unit_next(u);
+		if (u->samples < UNIT_WARMUP && UNIT_WARMUP < next) next = UNIT_WARMUP;
+		if (next > u->samples && next - u->samples < n) n = next - u->samples;
+		n = detector_ctx_runBlock(u->detector, blk + i, n);
+		i += n;
+		u->samples += n;
+		u->now_us = unit_time(u->samples);
+		if (detector_ctx_getHit(u->detector)) {
+			char msg[UNIT_LOG];
+			uint16_t ch = detector_ctx_getHitChannel(u->detector);
+			detector_ctx_clearHit(u->detector);
+			u->detected++;
+			snprintf(msg, sizeof(msg), "detect ch%u", ch);
+			unit_log(u, msg);
+			unit_post(u, GEVENT_HIT, ch, 0);
+		}
+		unit_due(u);
+	}
+}
+
+bool unit_emitting(const unit_t *u, uint16_t *chan)
+{
+	bool on = u->now_us >= u->txStart_us && u->now_us < u->txEnd_us;
+
+	if (on && chan != NULL) *chan = u->txChan;
+	return on;
+}
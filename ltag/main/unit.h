@@ -0,0 +1,111 @@
+#ifndef UNIT_H_
+#define UNIT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "config.h" // CONFIG_*
+#include "debounce.h"
+#include "detector_ctx.h"
+#include "filter_ctx.h"
+#include "gcore.h"
+#include "gevent.h"
+
+// Simulated tag unit for host builds. A unit holds everything a tag unit
+// runs: the game core (gcore.h), its own filter and detector instance,
+// the trigger debounce (debounce.h), the game timers and an event queue,
+// all on a virtual clock that advances with the receive samples given to
+// unit_step(), one sample per 1/CONFIG_RX_SAMPLE_RATE seconds. Nothing
+// depends on wall time, so a run is deterministic and runs as fast as the
+// filter can process samples.
+//
+// The stand-ins for the hardware are simple: the transmitter state is a
+// pulse on the team channel (unit_emitting()), sounds and state changes
+// go to a log callback, and the LED is a flag. Events are handled at the
+// sample where they happen, so the game reacts without latency; timers
+// expire at the first sample at or after their due time. The detector
+// ignores hits until its energy window has filled, while the lockout
+// timer runs, and while the game ignores hits.
+//
+// Units are independent, so several can run in one process, also in
+// parallel threads. Call filter_init() once before the first unit_init(),
+// it sets up the coefficients shared by all filter instances.
+
+#define UNIT_QUEUE 32 // Max queued events
+#define UNIT_LOG 96 // Max log message length
+
+struct unit;
+
+// Log callback.
+// ctx: context given to unit_init().
+// u: unit.
+// msg: message, for example "hit ch9 lives:3 hits:1 shots:10".
+typedef void (*unit_log_t)(void *ctx, const struct unit *u, const char *msg);
+
+// Unit state. The fields may be read, but are changed by the unit.
+typedef struct unit {
+	uint16_t id; // Unit number, for logs
+	gcore_t game;
+	gcore_ops_t ops;
+	filter_ctx_t *filter;
+	detector_ctx_t *detector;
+	uint64_t samples; // Samples processed, the virtual clock
+	uint64_t now_us; // Virtual time
+	// Timers
+	bool armed[GCORE_TIMERS];
+	uint64_t due_us[GCORE_TIMERS];
+	uint32_t gen[GCORE_TIMERS];
+	// Trigger
+	debounce_t trigger;
+	bool level; // Raw trigger level, true if pressed
+	// Event queue
+	gevent_t q[UNIT_QUEUE];
+	uint16_t qhead, qcount;
+	uint32_t dropped; // Events dropped, queue full
+	// Transmitter
+	uint16_t txChan; // Channel of the last shot
+	uint64_t txStart_us, txEnd_us; // Last shot pulse
+	bool led; // Hit LED
+	// Statistics
+	uint32_t detected; // Detector hits, counted or not
+	unit_log_t log;
+	void *logCtx;
+} unit_t;
+
+// Initialize a unit and start a game at time zero.
+// u: unit.
+// id: unit number, for logs.
+// team: team channel.
+// log: log callback, or NULL.
+// ctx: context passed to log.
+void unit_init(unit_t *u, uint16_t id, uint16_t team, unit_log_t log, void *ctx);
+
+// Release resources used by a unit.
+void unit_free(unit_t *u);
+
+// Change the raw trigger level at the current time. Bounces are scripted
+// as several calls between steps.
+// pressed: true if the trigger is pressed.
+void unit_trigger(unit_t *u, bool pressed);
+
+// Post an event, for example a network message, at the current time.
+// Return zero if successful, or non-zero if the queue is full.
+int32_t unit_post(unit_t *u, gevent_type_t type, uint16_t arg, uint32_t data);
+
+// Run the unit over a block of receive samples, advancing the clock by one
+// sample period for each.
+// blk: ADC samples seen by the receiver of the unit.
+// count: number of samples.
+void unit_step(unit_t *u, const rx_data_t *blk, uint32_t count);
+
+// Return true if the unit is emitting at the current time.
+// chan: set to the channel if emitting, may be NULL.
+bool unit_emitting(const unit_t *u, uint16_t *chan);
+
+// Return the time in microseconds of a sample index.
+static inline uint64_t unit_time(uint64_t sample)
+{
+	return sample * 1000000 / CONFIG_RX_SAMPLE_RATE;
+}
+
+#endif // UNIT_H_